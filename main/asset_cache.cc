@@ -0,0 +1,504 @@
+/**
+ * @file asset_cache.cc
+ * @brief 📦 服务器推送的提示音缓存
+ */
+
+#include "asset_cache.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include "audio_codec.h"
+#include "esp_crt_bundle.h"
+#include "esp_heap_caps.h"
+#include "esp_http_client.h"
+#include "esp_log.h"
+#include "esp_rom_crc.h"
+#include "esp_timer.h"
+#include "flash_scheduler.h"
+#include "mbedtls/sha256.h"
+#include "task_factory.h"
+
+const char* AssetCache::TAG = "AssetCache";
+
+static constexpr size_t kSectorBytes = 4096;
+static constexpr uint32_t kIdleCheckMs = 500;
+
+static size_t align_up(size_t value, size_t align) {
+    return (value + align - 1) / align * align;
+}
+
+static size_t record_bytes(uint32_t size) {
+    return align_up(48 + (size_t)size, 16);
+}
+
+/**
+ * @brief 取"key":后面的数字（找不到时返回false）
+ */
+static bool field_number(std::string_view obj, const char* key, uint32_t* out) {
+    size_t pos = obj.find(key);
+    if (pos == std::string_view::npos) {
+        return false;
+    }
+    *out = (uint32_t)strtoul(obj.data() + pos + strlen(key), nullptr, 10);
+    return true;
+}
+
+/**
+ * @brief 取"key":"..."里的字符串（不含转义，名字和哈希都不需要）
+ */
+static std::string_view field_string(std::string_view obj, const char* key) {
+    size_t pos = obj.find(key);
+    if (pos == std::string_view::npos) {
+        return {};
+    }
+    std::string_view value = obj.substr(pos + strlen(key));
+    return value.substr(0, value.find('"'));
+}
+
+AssetCache::AssetCache()
+    : part_(nullptr)
+    , mmap_handle_(0)
+    , base_(nullptr)
+    , append_(0)
+    , needs_format_(false)
+    , lock_(xSemaphoreCreateMutex())
+    , entries_{}
+    , entry_count_(0)
+    , entry_names_{}
+    , wanted_{}
+    , wanted_count_(0)
+    , have_manifest_(false)
+    , failed_mask_(0)
+    , base_url_{}
+    , pending_{}
+    , pending_count_(0)
+    , pending_base_{}
+    , fetching_(false)
+    , refetch_(false)
+{
+}
+
+AssetCache::~AssetCache() {
+    if (base_) {
+        esp_partition_munmap(mmap_handle_);
+    }
+    vSemaphoreDelete(lock_);
+}
+
+esp_err_t AssetCache::init(const char* partition_label) {
+    if (base_) {
+        return ESP_OK;
+    }
+    part_ = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, partition_label);
+    if (!part_) {
+        ESP_LOGW(TAG, "⚠️ 未找到资源分区 '%s'（分区表是旧的？），服务器推送的提示音不可用", partition_label);
+        return ESP_ERR_NOT_FOUND;
+    }
+    const void* mapped = nullptr;
+    esp_err_t ret = esp_partition_mmap(part_, 0, part_->size, ESP_PARTITION_MMAP_DATA, &mapped, &mmap_handle_);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ 资源分区映射失败: %s", esp_err_to_name(ret));
+        part_ = nullptr;
+        return ret;
+    }
+    base_ = (const uint8_t*)mapped;
+    scan();
+    ESP_LOGI(TAG, "✅ 资源分区已映射: %u条, 已用%u/%lu字节%s", (unsigned)entry_count_, (unsigned)append_,
+             (unsigned long)part_->size, needs_format_ ? "（不是资源格式，第一次写入前擦除）" : "");
+    return ESP_OK;
+}
+
+void AssetCache::scan() {
+    size_t offset = 0;
+    while (offset + sizeof(RecordHeader) <= part_->size) {
+        RecordHeader header;
+        memcpy(&header, base_ + offset, sizeof(header));
+        if (header.magic != MAGIC) {
+            bool erased = true;
+            for (size_t i = 0; i < sizeof(header) && erased; i++) {
+                erased = ((const uint8_t*)&header)[i] == 0xFF;
+            }
+            if (erased) {
+                break;      // 记录的末尾
+            }
+            if (header.magic == 0xFFFFFFFF && header.size <= part_->size - offset - sizeof(header)) {
+                // 掉电时写了一半：跳过它，从下一个扇区开始追加（那里一直是擦除过的）
+                ESP_LOGW(TAG, "⚠️ 跳过写了一半的记录 @%u", (unsigned)offset);
+                offset = align_up(offset + record_bytes(header.size), kSectorBytes);
+                break;
+            }
+            needs_format_ = true;
+            break;
+        }
+        if (header.size > part_->size - offset - sizeof(header) || header.name[NAME_LEN - 1] != '\0') {
+            needs_format_ = true;
+            break;
+        }
+        const uint8_t* data = base_ + offset + sizeof(header);
+        if (esp_rom_crc32_le(0, data, header.size) != header.crc32) {
+            ESP_LOGW(TAG, "⚠️ 记录 %s @%u 校验失败，忽略", header.name, (unsigned)offset);
+        } else if (entry_count_ < ASSET_MAX_ENTRIES) {
+            Entry& entry = entries_[entry_count_];
+            memcpy(entry.id, header.id, ID_BYTES);
+            memcpy(entry_names_[entry_count_], header.name, NAME_LEN);
+            entry.asset.name = entry_names_[entry_count_];
+            entry.asset.data = data;
+            entry.asset.size = header.size;
+            entry.asset.samples = header.samples;
+            entry.asset.block_bytes = header.block_bytes;
+            entry.asset.codec = (PromptCodec)header.codec;
+            entry_count_++;
+        }
+        offset += record_bytes(header.size);
+    }
+    append_ = needs_format_ ? 0 : std::min<size_t>(offset, part_->size);
+}
+
+bool AssetCache::parseId(std::string_view hex, uint8_t* id) {
+    if (hex.size() < ID_BYTES * 2) {
+        return false;
+    }
+    for (size_t i = 0; i < ID_BYTES; i++) {
+        char byte[3] = {hex[i * 2], hex[i * 2 + 1], '\0'};
+        char* end = nullptr;
+        id[i] = (uint8_t)strtoul(byte, &end, 16);
+        if (end != byte + 2) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool AssetCache::validWanted(const Wanted& wanted) {
+    if (wanted.size == 0 || wanted.size > ASSET_MAX_BYTES) {
+        return false;
+    }
+    if (wanted.codec == PromptCodec::PCM16) {
+        return wanted.size == wanted.samples * sizeof(int16_t);
+    }
+    return wanted.block_bytes > ImaAdpcmDecoder::BLOCK_HEADER_SIZE && wanted.block_bytes % 2 == 0 &&
+           wanted.size % wanted.block_bytes == 0;
+}
+
+void AssetCache::onManifest(std::string_view text) {
+    if (!base_) {
+        return;
+    }
+    uint32_t page = 0;
+    field_number(text, "\"page\":", &page);
+    if (page == 0) {
+        pending_count_ = 0;
+        std::string_view base = field_string(text, "\"base\":\"");
+        snprintf(pending_base_, sizeof(pending_base_), "%.*s", (int)base.size(), base.data());
+    }
+    size_t pos = text.find("\"list\":[");
+    while (pos != std::string_view::npos) {
+        pos = text.find("{\"n\":\"", pos);
+        if (pos == std::string_view::npos) {
+            break;
+        }
+        size_t end = text.find('}', pos);
+        std::string_view obj = text.substr(pos, end == std::string_view::npos ? std::string_view::npos : end - pos);
+        pos = end;
+        Wanted wanted = {};
+        std::string_view name = field_string(obj, "\"n\":\"");
+        uint32_t block = 0;
+        bool ok = name.size() > 0 && name.size() < NAME_LEN && parseId(field_string(obj, "\"h\":\""), wanted.id) &&
+                  field_number(obj, "\"s\":", &wanted.size) && field_number(obj, "\"c\":", &wanted.samples);
+        field_number(obj, "\"b\":", &block);
+        memcpy(wanted.name, name.data(), std::min(name.size(), NAME_LEN - 1));
+        wanted.block_bytes = (uint16_t)block;
+        wanted.codec = block > 0 ? PromptCodec::IMA_ADPCM : PromptCodec::PCM16;
+        if (!ok || !validWanted(wanted)) {
+            ESP_LOGW(TAG, "⚠️ 清单里的 %.*s 格式不对，忽略", (int)name.size(), name.data());
+            continue;
+        }
+        if (pending_count_ >= ASSET_MAX_ENTRIES) {
+            ESP_LOGW(TAG, "⚠️ 清单超过%d条，后面的忽略", ASSET_MAX_ENTRIES);
+            break;
+        }
+        pending_[pending_count_++] = wanted;
+    }
+    if (text.find("\"last\":true") == std::string_view::npos) {
+        return;
+    }
+
+    // 📋 最后一页：换成新清单，缺的开始下载
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    memcpy(wanted_, pending_, sizeof(Wanted) * pending_count_);
+    wanted_count_ = pending_count_;
+    memcpy(base_url_, pending_base_, sizeof(base_url_));
+    have_manifest_ = true;
+    failed_mask_ = 0;
+    size_t missing = 0;
+    for (size_t i = 0; i < wanted_count_; i++) {
+        missing += lookup(wanted_[i].id) == nullptr;
+    }
+    xSemaphoreGive(lock_);
+    ESP_LOGI(TAG, "📋 资源清单: %u条, 缺%u条", (unsigned)wanted_count_, (unsigned)missing);
+    if (missing == 0) {
+        return;
+    }
+    refetch_ = true;
+    if (fetching_.exchange(true)) {
+        return;     // 下载任务这一轮做完再按新清单来一轮
+    }
+    // 写Flash的任务栈必须在内部RAM（cache关闭期间还要运行），下完就退出
+    if (TaskFactory::create(fetch_task, "asset_fetch", ASSET_FETCH_TASK_STACK, this, ASSET_FETCH_TASK_PRIORITY,
+                            nullptr, ASSET_FETCH_TASK_CORE, TaskStack::INTERNAL) != pdPASS) {
+        ESP_LOGE(TAG, "❌ 创建下载任务失败");
+        fetching_ = false;
+    }
+}
+
+const AssetCache::Entry* AssetCache::lookup(const uint8_t* id) const {
+    // 同一哈希写过多次时（擦除前的重复下载）用最后一条
+    for (size_t i = entry_count_; i > 0; i--) {
+        if (memcmp(entries_[i - 1].id, id, ID_BYTES) == 0) {
+            return &entries_[i - 1];
+        }
+    }
+    return nullptr;
+}
+
+const PromptAsset* AssetCache::find(const char* name) const {
+    if (!base_) {
+        return nullptr;
+    }
+    const PromptAsset* found = nullptr;
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    if (have_manifest_) {
+        for (size_t i = 0; i < wanted_count_; i++) {
+            if (strncmp(wanted_[i].name, name, NAME_LEN) == 0) {
+                const Entry* entry = lookup(wanted_[i].id);
+                found = entry ? &entry->asset : nullptr;
+                break;
+            }
+        }
+    } else {
+        for (size_t i = entry_count_; i > 0; i--) {
+            if (strncmp(entries_[i - 1].asset.name, name, NAME_LEN) == 0) {
+                found = &entries_[i - 1].asset;
+                break;
+            }
+        }
+    }
+    xSemaphoreGive(lock_);
+    return found;
+}
+
+const PromptAsset* AssetCache::findById(std::string_view hex) const {
+    uint8_t id[ID_BYTES];
+    if (!base_ || !parseId(hex, id)) {
+        return nullptr;
+    }
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    const Entry* entry = lookup(id);
+    xSemaphoreGive(lock_);
+    return entry ? &entry->asset : nullptr;
+}
+
+size_t AssetCache::count() const {
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    size_t count = entry_count_;
+    xSemaphoreGive(lock_);
+    return count;
+}
+
+void AssetCache::fetch_task(void* arg) {
+    AssetCache* self = static_cast<AssetCache*>(arg);
+    while (true) {
+        while (self->refetch_.exchange(false)) {
+            self->fetchAll();
+        }
+        self->fetching_ = false;
+        // 清false之前刚到的清单没有建任务（看到fetching_还是true），这里接着做
+        if (!self->refetch_.load() || self->fetching_.exchange(true)) {
+            break;
+        }
+    }
+    vTaskDelete(NULL);
+}
+
+bool AssetCache::nextMissing(Wanted* out, size_t* index) {
+    bool found = false;
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    for (size_t i = 0; i < wanted_count_; i++) {
+        if (!(failed_mask_ & (1u << i)) && lookup(wanted_[i].id) == nullptr) {
+            *out = wanted_[i];
+            *index = i;
+            found = true;
+            break;
+        }
+    }
+    xSemaphoreGive(lock_);
+    return found;
+}
+
+void AssetCache::fetchAll() {
+    Wanted wanted;
+    size_t index = 0;
+    while (nextMissing(&wanted, &index)) {
+        // 放不下：分区里的旧记录都不要了，整个擦掉再按清单下载
+        if (needs_format_ || append_ + record_bytes(wanted.size) > part_->size) {
+            if (record_bytes(wanted.size) > part_->size || format() != ESP_OK) {
+                xSemaphoreTake(lock_, portMAX_DELAY);
+                failed_mask_ |= 1u << index;
+                xSemaphoreGive(lock_);
+                continue;
+            }
+        }
+        int64_t start_us = esp_timer_get_time();
+        uint8_t* data = download(wanted);
+        esp_err_t ret = data ? store(wanted, data) : ESP_FAIL;
+        heap_caps_free(data);
+        if (ret != ESP_OK) {
+            xSemaphoreTake(lock_, portMAX_DELAY);
+            failed_mask_ |= 1u << index;
+            xSemaphoreGive(lock_);
+            continue;
+        }
+        ESP_LOGI(TAG, "📦 %s 已缓存（%lu字节，用时%lu ms）", wanted.name, (unsigned long)wanted.size,
+                 (unsigned long)((esp_timer_get_time() - start_us) / 1000));
+    }
+}
+
+uint8_t* AssetCache::download(const Wanted& wanted) {
+    char url[BASE_LEN + ID_BYTES * 2 + 1];
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    int len = snprintf(url, sizeof(url), "%s", base_url_);
+    xSemaphoreGive(lock_);
+    for (size_t i = 0; i < ID_BYTES && len < (int)sizeof(url) - 2; i++) {
+        len += snprintf(url + len, sizeof(url) - len, "%02x", wanted.id[i]);
+    }
+
+    uint8_t* data = (uint8_t*)heap_caps_malloc(wanted.size, MALLOC_CAP_SPIRAM);
+    if (!data) {
+        ESP_LOGE(TAG, "❌ %s 下载缓冲区分配失败（%lu字节）", wanted.name, (unsigned long)wanted.size);
+        return nullptr;
+    }
+    esp_http_client_config_t config = {};
+    config.url = url;
+    config.timeout_ms = ASSET_HTTP_TIMEOUT_MS;
+    config.crt_bundle_attach = esp_crt_bundle_attach;
+    esp_http_client_handle_t client = esp_http_client_init(&config);
+    esp_err_t ret = client ? esp_http_client_open(client, 0) : ESP_ERR_NO_MEM;
+    int64_t length = ret == ESP_OK ? esp_http_client_fetch_headers(client) : -1;
+    int http_status = ret == ESP_OK ? esp_http_client_get_status_code(client) : 0;
+    size_t received = 0;
+    if (ret == ESP_OK && http_status == 200 && length == (int64_t)wanted.size) {
+        while (received < wanted.size) {
+            int n = esp_http_client_read(client, (char*)data + received, wanted.size - received);
+            if (n <= 0) {
+                break;
+            }
+            received += n;
+        }
+    }
+    if (client) {
+        esp_http_client_close(client);
+        esp_http_client_cleanup(client);
+    }
+    if (received != wanted.size) {
+        ESP_LOGW(TAG, "⚠️ %s 下载失败: %s, HTTP %d, 收到%u/%lu字节", wanted.name, esp_err_to_name(ret),
+                 http_status, (unsigned)received, (unsigned long)wanted.size);
+        heap_caps_free(data);
+        return nullptr;
+    }
+
+    // 🔐 内容寻址：数据的SHA-256前缀必须就是清单里的哈希
+    uint8_t digest[32];
+    mbedtls_sha256(data, wanted.size, digest, 0);
+    if (memcmp(digest, wanted.id, ID_BYTES) != 0) {
+        ESP_LOGW(TAG, "⚠️ %s 内容和哈希对不上，丢弃", wanted.name);
+        heap_caps_free(data);
+        return nullptr;
+    }
+    return data;
+}
+
+void AssetCache::waitIdle() {
+    // 写Flash时两个核心的cache都关着，会话期间写就是一段上行空洞、一次欠载（见flash_scheduler.h）
+    while (!FlashScheduler::isIdle()) {
+        vTaskDelay(pdMS_TO_TICKS(kIdleCheckMs));
+    }
+}
+
+esp_err_t AssetCache::format() {
+    waitIdle();
+    ESP_LOGI(TAG, "🧹 资源分区%s，整个擦除后按清单重新下载", needs_format_ ? "不是资源格式" : "满了");
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    entry_count_ = 0;
+    xSemaphoreGive(lock_);
+    int64_t start_us = esp_timer_get_time();
+    esp_err_t ret = esp_partition_erase_range(part_, 0, part_->size);
+    FlashScheduler::noteOp("asset_erase", esp_timer_get_time() - start_us);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ 资源分区擦除失败: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    append_ = 0;
+    needs_format_ = false;
+    return ESP_OK;
+}
+
+esp_err_t AssetCache::store(const Wanted& wanted, const uint8_t* data) {
+    RecordHeader header = {};
+    header.magic = MAGIC;
+    memcpy(header.id, wanted.id, ID_BYTES);
+    memcpy(header.name, wanted.name, NAME_LEN);
+    header.size = wanted.size;
+    header.samples = wanted.samples;
+    header.block_bytes = wanted.block_bytes;
+    header.codec = (uint8_t)wanted.codec;
+    header.crc32 = esp_rom_crc32_le(0, data, wanted.size);
+
+    // 顺序：记录头（magic除外）→ 数据（分块，每块前等空闲）→ magic，掉电时扫描能认出写了一半的记录
+    size_t offset = append_;
+    esp_err_t ret = ESP_OK;
+    waitIdle();
+    int64_t start_us = esp_timer_get_time();
+    ret = esp_partition_write(part_, offset + sizeof(header.magic), (const uint8_t*)&header + sizeof(header.magic),
+                              sizeof(header) - sizeof(header.magic));
+    FlashScheduler::noteOp("asset_write", esp_timer_get_time() - start_us);
+    for (size_t done = 0; ret == ESP_OK && done < wanted.size; done += ASSET_WRITE_CHUNK_BYTES) {
+        size_t chunk = std::min<size_t>(ASSET_WRITE_CHUNK_BYTES, wanted.size - done);
+        waitIdle();
+        start_us = esp_timer_get_time();
+        ret = esp_partition_write(part_, offset + sizeof(header) + done, data + done, chunk);
+        FlashScheduler::noteOp("asset_write", esp_timer_get_time() - start_us);
+    }
+    if (ret == ESP_OK) {
+        waitIdle();
+        start_us = esp_timer_get_time();
+        ret = esp_partition_write(part_, offset, &header.magic, sizeof(header.magic));
+        FlashScheduler::noteOp("asset_write", esp_timer_get_time() - start_us);
+    }
+    // 不管成没成，这段空间都用过了；失败的那条下次启动当作写了一半的记录跳过
+    append_ = ret == ESP_OK ? offset + record_bytes(wanted.size)
+                            : align_up(offset + record_bytes(wanted.size), kSectorBytes);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ %s 写入失败: %s", wanted.name, esp_err_to_name(ret));
+        return ret;
+    }
+
+    // 写完映射地址立即可读（IDF写Flash后会作废这段的cache）
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    if (entry_count_ < ASSET_MAX_ENTRIES) {
+        Entry& entry = entries_[entry_count_];
+        memcpy(entry.id, wanted.id, ID_BYTES);
+        memcpy(entry_names_[entry_count_], wanted.name, NAME_LEN);
+        entry.asset.name = entry_names_[entry_count_];
+        entry.asset.data = base_ + offset + sizeof(header);
+        entry.asset.size = wanted.size;
+        entry.asset.samples = wanted.samples;
+        entry.asset.block_bytes = wanted.block_bytes;
+        entry.asset.codec = wanted.codec;
+        entry_count_++;
+    } else {
+        ret = ESP_ERR_NO_MEM;
+    }
+    xSemaphoreGive(lock_);
+    return ret;
+}
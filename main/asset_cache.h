@@ -0,0 +1,153 @@
+/**
+ * @file asset_cache.h
+ * @brief 📦 服务器推送的提示音缓存 - 按内容哈希存在"assets"分区，内存映射后和提示音分区一样播放
+ *
+ * 提示音分区（prompt_store.h）随固件一起烧录，换一句提示、加一个提示音都要重新打包烧录；
+ * 临时的提示每次从服务器流式下发又浪费带宽。这里让中继推送提示音：
+ *
+ * - hello里带"assets"，中继在hello回复之后发{"type":"assets","base":...,"list":[...]}清单
+ *   （分页，每页不超过事件任务的消息上限，"last":true是最后一页），每条是名称、内容哈希和格式：
+ *   {"n":"hi","h":"<SHA-256前16个十六进制字符>","s":字节数,"c":样本数,"b":ADPCM块字节数}
+ * - 分区里已有同一哈希的直接用；缺的由后台任务从base + 哈希按HTTP下载，先进PSRAM，
+ *   校验SHA-256前缀后在空闲时写Flash（分块写，会话开始就停下等），写完映射地址立即可读
+ * - 播放：find(name)先按清单里的名字找（中继换了内容，名字不变、哈希变了），再退回提示音分区；
+ *   服务器发{"type":"play_asset","id":...}时按哈希找（findById）
+ *
+ * 📦 分区格式：从头往后追加的记录，[记录头48字节][数据，16字节对齐]，
+ *   记录头的magic最后写，掉电时写了一半的记录没有magic，启动扫描时跳过并从下一个扇区接着追加。
+ *   分区满了就在空闲时整个擦掉，按当前清单重新下载（不在清单里的旧记录这时才被清掉）。
+ *
+ * 清单在WebSocket事件任务中设置，find在主任务中调用，下载和写Flash在自己的任务里（栈在内部RAM，写Flash时要运行），
+ * 清单和条目表用互斥锁保护；返回的PromptAsset在下次整个擦除之前有效（只在空闲、没有播放时擦除）。
+ */
+
+#ifndef ASSET_CACHE_H
+#define ASSET_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <string_view>
+#include "esp_err.h"
+#include "esp_partition.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "project_config.h"
+#include "prompt_store.h"
+
+class AssetCache {
+public:
+    static constexpr uint32_t MAGIC = 0x54455341;   // "ASET"
+    static constexpr size_t ID_BYTES = 8;           // SHA-256的前8字节
+    static constexpr size_t NAME_LEN = PromptStore::NAME_LEN;
+    static constexpr size_t BASE_LEN = 128;
+
+    /**
+     * @brief 清单里的一条
+     */
+    struct Wanted {
+        char name[NAME_LEN];
+        uint8_t id[ID_BYTES];
+        uint32_t size;
+        uint32_t samples;
+        uint16_t block_bytes;   // ADPCM块字节数，PCM为0
+        PromptCodec codec;
+    };
+
+    AssetCache();
+    ~AssetCache();
+
+    /**
+     * @brief 映射资源分区并扫描已有的记录
+     *
+     * @return ESP_ERR_NOT_FOUND=分区表里没有这个分区（旧分区表），这时清单一律忽略
+     */
+    esp_err_t init(const char* partition_label);
+
+    bool isReady() const { return base_ != nullptr; }
+
+    // ===== 清单（WebSocket事件任务） =====
+
+    /**
+     * @brief 解析一页清单消息，最后一页之后开始下载缺的
+     */
+    void onManifest(std::string_view text);
+
+    // ===== 查找（主任务） =====
+
+    /**
+     * @brief 按名字找：有清单时只认清单里这个名字对应的哈希；还没收到清单（离线启动）时用最后写入的同名记录
+     */
+    const PromptAsset* find(const char* name) const;
+
+    /**
+     * @brief 按十六进制哈希找（至少16个字符，多的忽略）
+     */
+    const PromptAsset* findById(std::string_view hex) const;
+
+    size_t count() const;
+
+    static bool parseId(std::string_view hex, uint8_t* id);
+
+private:
+    static const char* TAG;
+
+    struct __attribute__((packed)) RecordHeader {
+        uint32_t magic;
+        uint8_t id[ID_BYTES];
+        char name[NAME_LEN];
+        uint32_t size;
+        uint32_t samples;
+        uint16_t block_bytes;
+        uint8_t codec;
+        uint8_t reserved;
+        uint32_t crc32;         // 数据的CRC32（启动扫描时校验，SHA-256只在下载时校验）
+        uint32_t reserved2;
+    };
+    static_assert(sizeof(RecordHeader) == 48, "RecordHeader必须是48字节");
+
+    struct Entry {
+        uint8_t id[ID_BYTES];
+        PromptAsset asset;
+    };
+
+    static void fetch_task(void* arg);
+    void scan();
+    void fetchAll();
+    bool nextMissing(Wanted* out, size_t* index);
+    const Entry* lookup(const uint8_t* id) const;
+    uint8_t* download(const Wanted& wanted);
+    esp_err_t store(const Wanted& wanted, const uint8_t* data);
+    esp_err_t format();
+    static void waitIdle();
+    static bool validWanted(const Wanted& wanted);
+
+    const esp_partition_t* part_;
+    esp_partition_mmap_handle_t mmap_handle_;
+    const uint8_t* base_;
+    size_t append_;             // 下一条记录的偏移（之后的空间都是擦除过的）
+    bool needs_format_;         // 分区里是别的数据，第一次写之前整个擦掉
+
+    SemaphoreHandle_t lock_;
+    Entry entries_[ASSET_MAX_ENTRIES];
+    size_t entry_count_;
+    char entry_names_[ASSET_MAX_ENTRIES][NAME_LEN];    // 条目的名字（PromptAsset::name指向这里）
+
+    // 当前清单（commit之后），下载任务读
+    Wanted wanted_[ASSET_MAX_ENTRIES];
+    size_t wanted_count_;
+    bool have_manifest_;
+    uint32_t failed_mask_;      // 这一轮下载失败的清单条目，下一份清单到了再试
+    char base_url_[BASE_LEN];
+
+    // 接收中的清单（只在事件任务中访问）
+    Wanted pending_[ASSET_MAX_ENTRIES];
+    size_t pending_count_;
+    char pending_base_[BASE_LEN];
+
+    std::atomic<bool> fetching_;
+    std::atomic<bool> refetch_;     // 下载任务运行期间又来了新清单
+};
+
+#endif // ASSET_CACHE_H
@@ -0,0 +1,243 @@
+/**
+ * @file audio_codec.cc
+ * @brief 🗜️ 音频编解码器实现
+ */
+
+#include "audio_codec.h"
+#include "esp_log.h"
+#include "project_config.h"
+
+#if UPLINK_OPUS_ENABLE
+#include "esp_opus_enc.h"
+#endif
+
+const char* OpusUplinkEncoder::TAG = "OpusEncoder";
+
+// IMA-ADPCM 标准步长表和索引调整表
+static const int16_t kAdpcmStepTable[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+};
+
+static const int8_t kAdpcmIndexTable[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+OpusUplinkEncoder::OpusUplinkEncoder()
+    : handle_(nullptr)
+    , in_frame_bytes_(0)
+    , sample_rate_(0)
+    , bitrate_(0)
+    , complexity_(UPLINK_OPUS_COMPLEXITY)
+{
+}
+
+OpusUplinkEncoder::~OpusUplinkEncoder() {
+#if UPLINK_OPUS_ENABLE
+    if (handle_) {
+        esp_opus_enc_close(handle_);
+    }
+#endif
+}
+
+esp_err_t OpusUplinkEncoder::init(uint32_t sample_rate, int bitrate) {
+#if UPLINK_OPUS_ENABLE
+    if (handle_) {
+        return ESP_OK;
+    }
+    sample_rate_ = sample_rate;
+    bitrate_ = bitrate;
+    esp_err_t ret = open();
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "✓ Opus编码器已就绪: %luHz, %d bit/s, 复杂度 %d, 每帧输入 %d 字节",
+                 (unsigned long)sample_rate, bitrate, complexity_, in_frame_bytes_);
+    }
+    return ret;
+#else
+    (void)sample_rate;
+    (void)bitrate;
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+esp_err_t OpusUplinkEncoder::open() {
+#if UPLINK_OPUS_ENABLE
+    esp_opus_enc_config_t cfg = ESP_OPUS_ENC_CONFIG_DEFAULT();
+    cfg.sample_rate = sample_rate_;
+    cfg.channel = 1;
+    cfg.bits_per_sample = 16;
+    cfg.bitrate = bitrate_;
+#if AUDIO_FRAME_MS == 10
+    cfg.frame_duration = ESP_OPUS_ENC_FRAME_DURATION_10_MS;
+#elif AUDIO_FRAME_MS == 40
+    cfg.frame_duration = ESP_OPUS_ENC_FRAME_DURATION_40_MS;
+#elif AUDIO_FRAME_MS == 60
+    cfg.frame_duration = ESP_OPUS_ENC_FRAME_DURATION_60_MS;
+#else
+    cfg.frame_duration = ESP_OPUS_ENC_FRAME_DURATION_20_MS;
+#endif
+    cfg.application_mode = ESP_OPUS_ENC_APPLICATION_VOIP;
+    cfg.complexity = complexity_;
+    cfg.enable_fec = false;
+    cfg.enable_dtx = false;
+    cfg.enable_vbr = true;
+
+    if (esp_opus_enc_open(&cfg, sizeof(cfg), &handle_) != ESP_AUDIO_ERR_OK) {
+        ESP_LOGE(TAG, "❌ Opus编码器初始化失败");
+        handle_ = nullptr;
+        return ESP_FAIL;
+    }
+
+    int out_frame_bytes = 0;
+    esp_opus_enc_get_frame_size(handle_, &in_frame_bytes_, &out_frame_bytes);
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+esp_err_t OpusUplinkEncoder::setBitrate(int bitrate) {
+#if UPLINK_OPUS_ENABLE
+    if (!handle_) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (esp_opus_enc_set_bitrate(handle_, bitrate) != ESP_AUDIO_ERR_OK) {
+        ESP_LOGW(TAG, "⚠️ 设置Opus码率 %d bit/s 失败", bitrate);
+        return ESP_FAIL;
+    }
+    bitrate_ = bitrate;
+    return ESP_OK;
+#else
+    (void)bitrate;
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+esp_err_t OpusUplinkEncoder::setComplexity(int complexity) {
+#if UPLINK_OPUS_ENABLE
+    if (!handle_) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (complexity == complexity_) {
+        return ESP_OK;
+    }
+    int previous = complexity_;
+    esp_opus_enc_close(handle_);
+    handle_ = nullptr;
+    complexity_ = complexity;
+    if (open() != ESP_OK) {
+        // 新复杂度打不开时退回原来的，还打不开就和init失败一样（编码返回-1，这一帧丢弃）
+        complexity_ = previous;
+        open();
+        return ESP_FAIL;
+    }
+    ESP_LOGI(TAG, "🗜️ Opus编码复杂度: %d → %d", previous, complexity);
+    return ESP_OK;
+#else
+    (void)complexity;
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+int OpusUplinkEncoder::encode(const int16_t* pcm, size_t pcm_bytes, uint8_t* out, size_t out_capacity) {
+#if UPLINK_OPUS_ENABLE
+    if (!handle_ || (int)pcm_bytes != in_frame_bytes_ || out_capacity <= 2) {
+        return -1;
+    }
+
+    esp_audio_enc_in_frame_t in_frame = {};
+    in_frame.buffer = (uint8_t*)pcm;
+    in_frame.len = pcm_bytes;
+
+    esp_audio_enc_out_frame_t out_frame = {};
+    out_frame.buffer = out + 2;
+    out_frame.len = out_capacity - 2;
+
+    if (esp_opus_enc_process(handle_, &in_frame, &out_frame) != ESP_AUDIO_ERR_OK) {
+        ESP_LOGW(TAG, "⚠️ Opus编码失败");
+        return -1;
+    }
+
+    // 2字节大端长度前缀
+    out[0] = (uint8_t)(out_frame.encoded_bytes >> 8);
+    out[1] = (uint8_t)(out_frame.encoded_bytes & 0xFF);
+    return (int)out_frame.encoded_bytes + 2;
+#else
+    (void)pcm;
+    (void)pcm_bytes;
+    (void)out;
+    (void)out_capacity;
+    return -1;
+#endif
+}
+
+static inline int16_t adpcm_decode_nibble(uint8_t nibble, int32_t& predictor, int& index) {
+    int32_t step = kAdpcmStepTable[index];
+    int32_t diff = step >> 3;
+    if (nibble & 4) diff += step;
+    if (nibble & 2) diff += step >> 1;
+    if (nibble & 1) diff += step >> 2;
+    predictor += (nibble & 8) ? -diff : diff;
+
+    if (predictor > 32767) predictor = 32767;
+    if (predictor < -32768) predictor = -32768;
+
+    index += kAdpcmIndexTable[nibble];
+    if (index < 0) index = 0;
+    if (index > 88) index = 88;
+    return (int16_t)predictor;
+}
+
+size_t ImaAdpcmDecoder::decodeBlock(const uint8_t* in, size_t len, int16_t* out, size_t out_samples) {
+    if (len <= BLOCK_HEADER_SIZE || in[2] > 88) {
+        return 0;
+    }
+
+    int32_t predictor = (int16_t)(in[0] | (in[1] << 8));
+    int index = in[2];
+
+    size_t produced = 0;
+    for (size_t i = BLOCK_HEADER_SIZE; i < len && produced + 2 <= out_samples; i++) {
+        out[produced++] = adpcm_decode_nibble(in[i] & 0x0F, predictor, index);
+        out[produced++] = adpcm_decode_nibble(in[i] >> 4, predictor, index);
+    }
+    return produced;
+}
+
+void ImaAdpcmStreamDecoder::reset() {
+    header_fill_ = 0;
+    predictor_ = 0;
+    index_ = 0;
+    corrupt_ = false;
+}
+
+size_t ImaAdpcmStreamDecoder::decode(const uint8_t* in, size_t len, int16_t* out, size_t out_samples,
+                                     size_t* consumed) {
+    size_t i = 0;
+    while (header_fill_ < ImaAdpcmDecoder::BLOCK_HEADER_SIZE && i < len) {
+        header_[header_fill_++] = in[i++];
+        if (header_fill_ == ImaAdpcmDecoder::BLOCK_HEADER_SIZE) {
+            predictor_ = (int16_t)(header_[0] | (header_[1] << 8));
+            index_ = header_[2];
+            corrupt_ = index_ > 88;
+        }
+    }
+    if (corrupt_) {
+        *consumed = len;
+        return 0;
+    }
+
+    size_t produced = 0;
+    for (; i < len && produced + 2 <= out_samples; i++) {
+        out[produced++] = adpcm_decode_nibble(in[i] & 0x0F, predictor_, index_);
+        out[produced++] = adpcm_decode_nibble(in[i] >> 4, predictor_, index_);
+    }
+    *consumed = i;
+    return produced;
+}
@@ -0,0 +1,151 @@
+/**
+ * @file audio_codec.h
+ * @brief 🗜️ 音频编解码器 - 上下行语音压缩
+ *
+ * 原始16kHz PCM上行需要256kbit/s，在拥挤的2.4GHz网络里非常占用空口。
+ * 这里封装了esp_audio_codec的Opus编码器，20ms一帧，约16~24kbit/s。
+ *
+ * 下行则使用IMA-ADPCM（4:1），解码几乎不占CPU，减轻WebSocket接收缓冲区压力。
+ *
+ * 📦 上行Opus帧格式（便于合包后服务器端拆分）：
+ *   [2字节大端长度][Opus数据包] [2字节大端长度][Opus数据包] ...
+ *
+ * 📦 下行ADPCM块格式（每条WebSocket消息一个块，丢包不影响后续块）：
+ *   [int16小端初始样本][uint8步长索引][uint8保留][4bit编码...（低半字节在前）]
+ */
+
+#ifndef AUDIO_CODEC_H
+#define AUDIO_CODEC_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+/**
+ * @brief 上行音频编码格式
+ */
+enum class UplinkCodec {
+    PCM,    // 原始16位PCM（默认，服务器总能处理）
+    OPUS,   // Opus压缩（服务器在握手中确认后才启用）
+};
+
+/**
+ * @brief 下行音频编码格式
+ */
+enum class DownlinkCodec {
+    PCM,    // 原始16位PCM（默认）
+    ADPCM,  // IMA-ADPCM，每字节两个样本
+    F32_24K,    // 豆包原始的24kHz float32，设备上重采样（见downlink_resampler.h）
+};
+
+class OpusUplinkEncoder {
+public:
+    OpusUplinkEncoder();
+    ~OpusUplinkEncoder();
+
+    /**
+     * @brief 初始化编码器
+     *
+     * @param sample_rate 采样率（Hz）
+     * @param bitrate 目标码率（bit/s）
+     * @return ESP_OK=成功，ESP_ERR_NOT_SUPPORTED=未编译Opus支持
+     */
+    esp_err_t init(uint32_t sample_rate, int bitrate);
+
+    bool isReady() const { return handle_ != nullptr; }
+
+    /**
+     * @brief 运行时调整目标码率（和encode在同一个任务里调用，下一帧生效）
+     */
+    esp_err_t setBitrate(int bitrate);
+
+    /**
+     * @brief 运行时调整编码复杂度（0~10，和encode在同一个任务里调用）
+     *
+     * 编码器没有单独设置复杂度的接口，按当前码率关闭后重新打开，编码状态从头开始（接收端会有一帧的过渡）。
+     */
+    esp_err_t setComplexity(int complexity);
+    int complexity() const { return complexity_; }
+
+    /**
+     * @brief 编码一帧20ms PCM，输出带2字节长度前缀的Opus包
+     *
+     * @param pcm 输入PCM数据
+     * @param pcm_bytes 输入字节数（必须正好是一帧）
+     * @param out 输出缓冲区
+     * @param out_capacity 输出缓冲区大小
+     * @return 写入out的字节数（含长度前缀），-1=失败
+     */
+    int encode(const int16_t* pcm, size_t pcm_bytes, uint8_t* out, size_t out_capacity);
+
+private:
+    static const char* TAG;
+
+    esp_err_t open();
+
+    void* handle_;
+    int in_frame_bytes_;
+    uint32_t sample_rate_;
+    int bitrate_;
+    int complexity_;
+};
+
+class ImaAdpcmDecoder {
+public:
+    static constexpr size_t BLOCK_HEADER_SIZE = 4;
+
+    /**
+     * @brief 解码一个ADPCM块
+     *
+     * @param in 块数据（含4字节块头）
+     * @param len 块字节数
+     * @param out 输出PCM缓冲区
+     * @param out_samples 输出缓冲区能容纳的样本数
+     * @return 解码出的样本数，0=块无效
+     */
+    static size_t decodeBlock(const uint8_t* in, size_t len, int16_t* out, size_t out_samples);
+
+    /**
+     * @brief 一个块解码后的样本数
+     */
+    static size_t samplesInBlock(size_t len) {
+        return len > BLOCK_HEADER_SIZE ? (len - BLOCK_HEADER_SIZE) * 2 : 0;
+    }
+};
+
+/**
+ * @brief 流式ADPCM块解码：一个块分成多个WebSocket片段到达时逐段解码（块头也可以被拆开）
+ */
+class ImaAdpcmStreamDecoder {
+public:
+    ImaAdpcmStreamDecoder() { reset(); }
+
+    /**
+     * @brief 开始一个新块
+     */
+    void reset();
+
+    /**
+     * @brief 解码块的下一段数据
+     *
+     * @param in 本段数据
+     * @param len 本段字节数
+     * @param out 输出PCM缓冲区
+     * @param out_samples 输出缓冲区能容纳的样本数
+     * @param consumed 输出：本次消耗的字节数（输出缓冲区满时小于len）
+     * @return 解码出的样本数
+     */
+    size_t decode(const uint8_t* in, size_t len, int16_t* out, size_t out_samples, size_t* consumed);
+
+    // 块头中的步长索引非法，这个块剩下的数据都无法解码
+    bool isCorrupt() const { return corrupt_; }
+
+private:
+    uint8_t header_[ImaAdpcmDecoder::BLOCK_HEADER_SIZE];
+    size_t header_fill_;
+    int32_t predictor_;
+    int index_;
+    bool corrupt_;
+};
+
+#endif // AUDIO_CODEC_H
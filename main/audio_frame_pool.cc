@@ -0,0 +1,97 @@
+/**
+ * @file audio_frame_pool.cc
+ * @brief 🧱 音频帧池实现
+ */
+
+#include "audio_frame_pool.h"
+#include "esp_log.h"
+#include "buffer_placement.h"
+
+const char* AudioFramePool::TAG = "FramePool";
+
+AudioFramePool::AudioFramePool(size_t slot_count, size_t slot_size, bool use_psram)
+    : slot_count_(slot_count)
+    , slot_size_(slot_size)
+    , storage_(nullptr)
+    , free_slots_(nullptr)
+    , acquired_(0)
+    , exhausted_(0)
+    , min_free_(slot_count)
+{
+    storage_ = (uint8_t*)BufferPlacement::alloc("frame_pool", slot_count_ * slot_size_,
+                                                use_psram ? Placement::PSRAM : Placement::INTERNAL);
+    if (!storage_) {
+        ESP_LOGE(TAG, "❌ 帧池内存分配失败: %zu x %zu 字节", slot_count_, slot_size_);
+        return;
+    }
+
+    free_slots_ = xQueueCreate(slot_count_, sizeof(uint16_t));
+    if (!free_slots_) {
+        ESP_LOGE(TAG, "❌ 帧池空闲队列创建失败");
+        BufferPlacement::free(storage_);
+        storage_ = nullptr;
+        return;
+    }
+
+    for (size_t i = 0; i < slot_count_; i++) {
+        uint16_t slot = (uint16_t)i;
+        xQueueSend(free_slots_, &slot, 0);
+    }
+
+    ESP_LOGI(TAG, "✓ 帧池已就绪: %zu 个槽位 x %zu 字节 (%s)",
+             slot_count_, slot_size_, BufferPlacement::regionName(storage_));
+}
+
+AudioFramePool::~AudioFramePool() {
+    if (free_slots_) {
+        vQueueDelete(free_slots_);
+    }
+    BufferPlacement::free(storage_);
+}
+
+int AudioFramePool::acquire() {
+    uint16_t slot;
+    if (!free_slots_ || xQueueReceive(free_slots_, &slot, 0) != pdTRUE) {
+        exhausted_++;
+        return -1;
+    }
+
+    acquired_++;
+    size_t free_now = uxQueueMessagesWaiting(free_slots_);
+    size_t min_free = min_free_.load();
+    while (free_now < min_free && !min_free_.compare_exchange_weak(min_free, free_now)) {
+    }
+    return slot;
+}
+
+void AudioFramePool::release(int slot) {
+    if (slot < 0 || (size_t)slot >= slot_count_ || !free_slots_) {
+        ESP_LOGW(TAG, "⚠️ 归还了无效的槽位: %d", slot);
+        return;
+    }
+    uint16_t s = (uint16_t)slot;
+    xQueueSend(free_slots_, &s, 0);
+}
+
+uint8_t* AudioFramePool::data(int slot) const {
+    if (slot < 0 || (size_t)slot >= slot_count_ || !storage_) {
+        return nullptr;
+    }
+    return storage_ + (size_t)slot * slot_size_;
+}
+
+AudioFramePool::Stats AudioFramePool::getStats() const {
+    Stats stats;
+    stats.acquired = acquired_.load();
+    stats.exhausted = exhausted_.load();
+    stats.free_slots = free_slots_ ? uxQueueMessagesWaiting(free_slots_) : 0;
+    stats.min_free_slots = min_free_.load();
+    return stats;
+}
+
+void AudioFramePool::logStats() const {
+    Stats stats = getStats();
+    ESP_LOGI(TAG, "📊 帧池统计: 申请=%lu, 耗尽=%lu, 空闲=%zu/%zu, 最低水位=%zu",
+             (unsigned long)stats.acquired, (unsigned long)stats.exhausted,
+             stats.free_slots, slot_count_, stats.min_free_slots);
+}
@@ -0,0 +1,79 @@
+/**
+ * @file audio_frame_pool.h
+ * @brief 🧱 音频帧池 - 预分配的固定大小帧缓冲区
+ *
+ * 录音任务每20ms产生一帧音频，以前每帧都要malloc/free一次，
+ * 长时间会话下会让WiFi/lwIP也在使用的内部堆产生碎片。
+ * 帧池在启动时一次性分配所有帧，队列里只传递槽位索引。
+ */
+
+#ifndef AUDIO_FRAME_POOL_H
+#define AUDIO_FRAME_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+class AudioFramePool {
+public:
+    /**
+     * @brief 帧池统计信息
+     */
+    struct Stats {
+        uint32_t acquired;      // 成功申请的次数
+        uint32_t exhausted;     // 帧池耗尽（申请失败）的次数
+        size_t free_slots;      // 当前空闲槽位数
+        size_t min_free_slots;  // 历史最少空闲槽位数（水位线）
+    };
+
+    /**
+     * @brief 创建帧池
+     *
+     * @param slot_count 槽位数量
+     * @param slot_size 每个槽位的字节数
+     * @param use_psram true=放在PSRAM，false=放在内部RAM
+     */
+    AudioFramePool(size_t slot_count, size_t slot_size, bool use_psram);
+    ~AudioFramePool();
+
+    bool isValid() const { return storage_ != nullptr && free_slots_ != nullptr; }
+
+    /**
+     * @brief 申请一个空闲槽位（不阻塞）
+     * @return 槽位索引，-1=帧池已耗尽
+     */
+    int acquire();
+
+    /**
+     * @brief 归还槽位
+     */
+    void release(int slot);
+
+    /**
+     * @brief 获取槽位的数据指针
+     */
+    uint8_t* data(int slot) const;
+
+    size_t slotSize() const { return slot_size_; }
+    size_t slotCount() const { return slot_count_; }
+    size_t freeCount() const { return free_slots_ ? uxQueueMessagesWaiting(free_slots_) : 0; }
+
+    Stats getStats() const;
+    void logStats() const;
+
+private:
+    static const char* TAG;
+
+    size_t slot_count_;
+    size_t slot_size_;
+    uint8_t* storage_;
+    QueueHandle_t free_slots_;  // 空闲槽位索引队列
+
+    std::atomic<uint32_t> acquired_;
+    std::atomic<uint32_t> exhausted_;
+    std::atomic<size_t> min_free_;
+};
+
+#endif // AUDIO_FRAME_POOL_H
@@ -0,0 +1,52 @@
+/**
+ * @file audio_framing.cc
+ * @brief 🧾 音频帧头编解码和序号检查
+ */
+
+#include "audio_framing.h"
+#include <string.h>
+
+void AudioFraming::write(uint8_t* out, Codec codec, uint16_t seq, uint32_t timestamp, uint16_t samples, uint16_t flags) {
+    Header header = { MAGIC, (uint8_t)codec, seq, timestamp, samples, flags };
+    memcpy(out, &header, sizeof(header));
+}
+
+bool AudioFraming::parse(const uint8_t* data, size_t len, Header* header) {
+    if (len < sizeof(Header) || data[0] != MAGIC) {
+        return false;
+    }
+    memcpy(header, data, sizeof(Header));
+    return true;
+}
+
+AudioFraming::Tracker::Verdict AudioFraming::Tracker::accept(const Header& header, uint32_t* missing_samples) {
+    *missing_samples = 0;
+    stats_.messages++;
+    if (header.flags & FLAG_DISCONTINUITY) {
+        stats_.sender_drops++;
+    }
+
+    Verdict verdict = Verdict::IN_ORDER;
+    if (synced_ && !(header.flags & FLAG_START)) {
+        int16_t seq_delta = (int16_t)(header.seq - next_seq_);
+        if (seq_delta < 0) {
+            stats_.late_messages++;
+            return Verdict::LATE;
+        }
+        int32_t ts_delta = (int32_t)(header.timestamp - next_timestamp_);
+        if (seq_delta > 0) {
+            stats_.lost_messages += seq_delta;
+            stats_.lost_samples += ts_delta > 0 ? ts_delta : 0;
+        }
+        // seq连续但时间戳跳了：发送端丢过数据，同样需要补上这段时长
+        if (ts_delta > 0) {
+            *missing_samples = (uint32_t)ts_delta;
+            verdict = Verdict::GAP;
+        }
+    }
+
+    next_seq_ = header.seq + 1;
+    next_timestamp_ = header.timestamp + header.samples;
+    synced_ = true;
+    return verdict;
+}
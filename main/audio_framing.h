@@ -0,0 +1,106 @@
+/**
+ * @file audio_framing.h
+ * @brief 🧾 音频帧头 - 上下行音频消息带序号和时间戳，丢包、乱序、设备端丢帧都能看出来
+ *
+ * 以前二进制音频消息只有负载：audio_record_task在队列满时丢帧、重连后旧回复的消息晚到，
+ * 两端都不知道。协商成功后（hello里"framing":"seq"）每条音频消息前面加12字节头，
+ * 参考RTP：小端，和server/server.py里的AUDIO_*保持一致。
+ *
+ *   magic(u8)=0xA5 | codec(u8) | seq(u16) | timestamp(u32) | samples(u16) | flags(u16) | payload
+ *
+ * - seq：本端发出的音频消息序号（每个方向各自计数，回绕无妨）
+ * - timestamp：第一个样本在16kHz时钟上的位置。上行从录音开始计，下行从每段回复开始计
+ * - samples：这条消息的16kHz样本数（Opus等变长编码靠它算时长）
+ * - flags：FLAG_START = 新的一段流，接收端重新同步；
+ *          FLAG_DISCONTINUITY = 发送端在这条消息之前丢过数据，丢了多少看timestamp；
+ *          FLAG_END = 这段流的最后一条消息（负载可以为空），接收端播完缓冲区就结束，不用等tts_end
+ *
+ * 接收端用Tracker检查每条消息：seq连续是正常；seq跳了说明中间的消息丢了，
+ * 缺的时长按timestamp算，下行交给抖动缓冲区做丢包补偿（JitterBuffer::conceal）；
+ * seq倒退是迟到或重复的消息，整条丢弃。控制帧的magic是0xC7，两种帧不会混淆。
+ */
+
+#ifndef AUDIO_FRAMING_H
+#define AUDIO_FRAMING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+class AudioFraming {
+public:
+    static constexpr uint8_t MAGIC = 0xA5;
+
+    /**
+     * @brief 负载的编码格式（数值写进帧里，只能在末尾追加）
+     */
+    enum class Codec : uint8_t {
+        PCM = 0,        // 16kHz int16
+        OPUS,           // 每包前2字节大端长度（见audio_codec.h）
+        ADPCM,          // IMA-ADPCM块
+        F32_24K,        // 豆包原始的24kHz float32
+    };
+
+    static constexpr uint16_t FLAG_START = 0x0001;
+    static constexpr uint16_t FLAG_DISCONTINUITY = 0x0002;
+    static constexpr uint16_t FLAG_END = 0x0004;
+
+    struct __attribute__((packed)) Header {
+        uint8_t magic;
+        uint8_t codec;
+        uint16_t seq;
+        uint32_t timestamp;
+        uint16_t samples;
+        uint16_t flags;
+    };
+    static_assert(sizeof(Header) == 12, "Header必须是12字节");
+    static constexpr size_t HEADER_BYTES = sizeof(Header);
+
+    /**
+     * @brief 写一个帧头（out至少HEADER_BYTES字节）
+     */
+    static void write(uint8_t* out, Codec codec, uint16_t seq, uint32_t timestamp, uint16_t samples, uint16_t flags);
+
+    /**
+     * @brief 从消息开头取出帧头，长度不够或magic不对时返回false
+     */
+    static bool parse(const uint8_t* data, size_t len, Header* header);
+
+    /**
+     * @brief 📊 接收端的序号检查（只在一个任务中调用，内部不加锁）
+     */
+    class Tracker {
+    public:
+        enum class Verdict {
+            IN_ORDER,   // 正常（包括流的第一条消息）
+            GAP,        // 中间丢了消息，missing_samples是缺的时长
+            LATE,       // 迟到或重复，应该丢弃
+        };
+
+        struct Stats {
+            uint32_t messages;          // 收到的消息（含迟到的）
+            uint32_t lost_messages;     // seq跳过的消息数
+            uint32_t lost_samples;      // seq跳过的时长
+            uint32_t late_messages;     // 迟到或重复的消息
+            uint32_t sender_drops;      // 带FLAG_DISCONTINUITY的消息（发送端自己丢过数据）
+        };
+
+        Tracker() : stats_{}, next_seq_(0), next_timestamp_(0), synced_(false) {}
+
+        Verdict accept(const Header& header, uint32_t* missing_samples);
+
+        /**
+         * @brief 忘掉上一段流的位置（重连后调用），下一条消息直接作为起点
+         */
+        void reset() { synced_ = false; }
+
+        const Stats& stats() const { return stats_; }
+
+    private:
+        Stats stats_;
+        uint16_t next_seq_;
+        uint32_t next_timestamp_;
+        bool synced_;
+    };
+};
+
+#endif // AUDIO_FRAMING_H
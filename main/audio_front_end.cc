@@ -0,0 +1,767 @@
+/**
+ * @file audio_front_end.cc
+ * @brief 🎛️ 音频前端实现
+ */
+
+#include "audio_front_end.h"
+#include "task_factory.h"
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+#include "buffer_placement.h"
+#include "perf_counters.h"
+#include "realtime_audio.h"
+#include "rtf_guard.h"
+#include "sched_trace.h"
+#include "scope_timer.h"
+#include "esp_timer.h"
+#include "esp_wn_models.h"
+#include "bsp_board.h"
+#include "project_config.h"
+#include "sdkconfig.h"
+
+const char* AudioFrontEnd::TAG = "AudioFrontEnd";
+
+AudioFrontEnd::AudioFrontEnd()
+    : afe_handle_(nullptr)
+    , afe_data_(nullptr)
+    , models_(nullptr)
+    , wake_mode_(WAKENET_DET_MODE)
+    , ns_model_(nullptr)
+    , vad_model_(nullptr)
+    , wakenet_model_{}
+    , wakenet_cost_{}
+    , preset_model_{}
+    , preset_cost_{}
+    , sample_rate_(16000)
+    , mic_channels_(1)
+    , aec_enabled_(false)
+    , aec_short_tail_(false)
+    , rebuild_state_(RebuildState::NONE)
+    , reference_ring_("aec_reference", Placement::INTERNAL)
+    , ref_lead_ms_(AFE_AEC_MAX_REF_LEAD_MS)
+    , wakenet_wanted_(true)
+    , wake_gate_open_(true)
+    , gate_onsets_(0)
+    , wakenet_enabled_(true)
+    , wake_threshold_{}
+    , wake_threshold_dirty_(false)
+    , fetch_task_handle_(nullptr)
+    , doa_(nullptr)
+    , doa_estimate_(-1)
+    , wake_direction_(-1)
+    , wake_volume_(0.0f)
+    , wake_model_(0)
+    , stage_(nullptr)
+    , feed_buffer_(nullptr)
+    , ref_(nullptr)
+    , chunk_samples_(0)
+    , feed_samples_(0)
+    , stage_fill_(0)
+    , doa_angle_{}
+    , doa_energy_{}
+    , doa_pos_(0)
+    , gate_floor_(WAKE_GATE_MIN_LEVEL)
+    , gate_quiet_ms_(0)
+{
+}
+
+AudioFrontEnd::~AudioFrontEnd() {
+    if (fetch_task_handle_) {
+        vTaskDelete(fetch_task_handle_);
+    }
+    BufferPlacement::free(stage_);
+    BufferPlacement::free(feed_buffer_);
+    BufferPlacement::free(ref_);
+    if (doa_) {
+        afe_doa_destroy(doa_);
+    }
+    if (afe_handle_ && afe_data_) {
+        afe_handle_->destroy(afe_data_);
+    }
+}
+
+char* AudioFrontEnd::pickWakeModel(srmodel_list_t* models, const char* wanted, const char* exclude) {
+    bool any = wanted[0] == '\0' || strcmp(wanted, "*") == 0;
+    for (int i = 0; i < models->num; i++) {
+        char* name = models->model_name[i];
+        if (strstr(name, ESP_WN_PREFIX) == nullptr || (exclude && strcmp(name, exclude) == 0)) {
+            continue;
+        }
+        if (any || strcmp(name, wanted) == 0) {
+            return name;
+        }
+    }
+    if (!any) {
+        ESP_LOGW(TAG, "⚠️ 模型分区里没有唤醒词模型 '%s'", wanted);
+    }
+    return nullptr;
+}
+
+/**
+ * @brief 单独运行一个WakeNet模型，测出处理一块音频的耗时占这块音频时长的千分比，以及每块detect的耗时
+ *
+ * 输入是静音：WakeNet每块的计算量固定，和内容无关，耗时的差别来自权重读取（Flash还是PSRAM、cache是否命中）。
+ * 模型实例测完即销毁，不和AFE同时占内存。
+ */
+AudioFrontEnd::WakeNetCost AudioFrontEnd::probeWakeNetCost(const char* model, det_mode_t mode) {
+    static constexpr int kProbeChunks = 32;
+    WakeNetCost cost = {};
+    const esp_wn_iface_t* wakenet = (const esp_wn_iface_t*)esp_wn_handle_from_name(model);
+    model_iface_data_t* data = wakenet ? wakenet->create(model, mode) : nullptr;
+    if (!data) {
+        return cost;
+    }
+    int chunk = wakenet->get_samp_chunksize(data) * wakenet->get_channel_num(data);
+    int rate = wakenet->get_samp_rate(data);
+    int16_t* silence = (int16_t*)heap_caps_calloc(chunk, sizeof(int16_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (silence && chunk > 0 && rate > 0) {
+        int64_t elapsed_us = 0;
+        for (int i = 0; i < kProbeChunks; i++) {
+            int64_t start = esp_timer_get_time();
+            wakenet->detect(data, silence);
+            int64_t detect_us = esp_timer_get_time() - start;
+            elapsed_us += detect_us;
+            if (detect_us > cost.detect_max_us) {
+                cost.detect_max_us = (uint32_t)detect_us;
+            }
+        }
+        int64_t audio_us = (int64_t)kProbeChunks * wakenet->get_samp_chunksize(data) * 1000000 / rate;
+        cost.permille = (uint32_t)(elapsed_us * 1000 / audio_us);
+        cost.detect_avg_us = (uint32_t)(elapsed_us / kProbeChunks);
+    }
+    heap_caps_free(silence);
+    wakenet->destroy(data);
+    return cost;
+}
+
+const char* AudioFrontEnd::wakeWordWeights(int index) const {
+    const char* model = wakenet_model_[index];
+    if (!models_ || !model) {
+        return "?";
+    }
+    for (int i = 0; i < models_->num; i++) {
+        srmodel_data_t* data = models_->model_data[i];
+        if (strcmp(models_->model_name[i], model) == 0 && data && data->num > 0) {
+            return esp_ptr_external_ram(data->data[0]) ? "PSRAM" : "Flash";
+        }
+    }
+    return "?";
+}
+
+void AudioFrontEnd::presetWakeNetCost(int index, const char* model, const WakeNetCost& cost) {
+    if (index < 0 || index >= WakeSettings::MAX_MODELS || !model || cost.detect_avg_us == 0 ||
+        strlen(model) >= sizeof(preset_model_[index])) {
+        return;
+    }
+    strcpy(preset_model_[index], model);
+    preset_cost_[index] = cost;
+}
+
+void AudioFrontEnd::probeWakeNets() {
+#if WAKENET_COST_PROBE
+    for (int i = 0; i < WakeSettings::MAX_MODELS; i++) {
+        if (!wakenet_model_[i]) {
+            continue;
+        }
+        WakeNetCost before = wakenet_cost_[i];
+        if (preset_model_[i][0] != '\0' && strcmp(preset_model_[i], wakenet_model_[i]) == 0) {
+            // 🌙 同一个模型刚测过（深度睡眠之前），不再花几十毫秒重测
+            wakenet_cost_[i] = preset_cost_[i];
+            preset_model_[i][0] = '\0';
+            ESP_LOGI(TAG, "🎯 唤醒词模型%d %s: 沿用上次的测量，占一个核心 %lu‰", i + 1, wakenet_model_[i],
+                     (unsigned long)wakenet_cost_[i].permille);
+            continue;
+        }
+        preset_model_[i][0] = '\0';
+        wakenet_cost_[i] = probeWakeNetCost(wakenet_model_[i], wake_mode_);
+        const WakeNetCost& now = wakenet_cost_[i];
+        ESP_LOGI(TAG, "🎯 唤醒词模型%d %s（权重在%s）: 单独运行占一个核心 %lu‰, 每块detect平均%luus/最长%luus",
+                 i + 1, wakenet_model_[i], wakeWordWeights(i), (unsigned long)now.permille,
+                 (unsigned long)now.detect_avg_us, (unsigned long)now.detect_max_us);
+        if (before.detect_avg_us > 0) {
+            ESP_LOGI(TAG, "🎯 唤醒词模型%d每块detect: %luus → %luus", i + 1,
+                     (unsigned long)before.detect_avg_us, (unsigned long)now.detect_avg_us);
+        }
+    }
+#endif
+}
+
+esp_err_t AudioFrontEnd::init(srmodel_list_t* models, uint32_t sample_rate, const WakeSettings& wake) {
+    sample_rate_ = sample_rate;
+    mic_channels_ = bsp_get_feed_channel();
+    if (!models) {
+        ESP_LOGW(TAG, "⚠️ 没有模型分区，音频前端以直通模式运行");
+        return ESP_ERR_NOT_FOUND;
+    }
+    models_ = models;
+    wake_mode_ = wake.mode;
+
+    // 🎯 唤醒词：一个或两个模型
+    wakenet_model_[0] = pickWakeModel(models, wake.model[0], nullptr);
+    if (wakenet_model_[0] && wake.model[1][0] != '\0') {
+        wakenet_model_[1] = pickWakeModel(models, wake.model[1], wakenet_model_[0]);
+    }
+    probeWakeNets();
+    for (int i = 0; i < WakeSettings::MAX_MODELS; i++) {
+        wake_threshold_[i] = wake.threshold[i];
+    }
+    wake_threshold_dirty_ = true;   // 非默认阈值在fetch任务第一次循环时设置
+
+    // 单麦克风 + 播放参考通道（软件回采）
+    bool use_aec = AFE_AEC_ENABLE && reference_ring_.isValid();
+    esp_err_t ret = createAfe(use_aec);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ AFE实例创建失败，音频前端以直通模式运行");
+        wakenet_model_[0] = wakenet_model_[1] = nullptr;
+        return ret;
+    }
+
+    aec_enabled_ = use_aec;
+    RtfGuard::setAvailable(RtfStage::NS, true);
+    RtfGuard::setAvailable(RtfStage::AEC, aec_enabled_);
+    ESP_LOGI(TAG, "✓ AFE已就绪: feed块=%d 样本, fetch块=%d 样本, 麦克风=%d, AEC=%s, NS=%s, VAD=%s, 唤醒词=%s%s%s (模式%d)",
+             afe_handle_->get_feed_chunksize(afe_data_), afe_handle_->get_fetch_chunksize(afe_data_),
+             mic_channels_, aec_enabled_ ? "开" : "关", ns_model_ ? ns_model_ : "WebRTC", vad_model_ ? vad_model_ : "WebRTC",
+             wakenet_model_[0] ? wakenet_model_[0] : "无", wakenet_model_[1] ? " + " : "",
+             wakenet_model_[1] ? wakenet_model_[1] : "", wake.modePercent());
+    afe_handle_->print_pipeline(afe_data_);
+    return ESP_OK;
+}
+
+afe_config_t* AudioFrontEnd::buildConfig(srmodel_list_t* models, uint32_t sample_rate, int mic_channels, bool use_aec,
+                                         char* const wakenet_model[WakeSettings::MAX_MODELS], det_mode_t mode) {
+    const char* format = mic_channels == 2 ? (use_aec ? "MMR" : "MM") : (use_aec ? "MR" : "M");
+    afe_config_t* cfg = afe_config_init(format, models, AFE_TYPE_SR, AFE_MODE_LOW_COST);
+    if (!cfg) {
+        return nullptr;
+    }
+
+    // 🔁 回声消除：播放回复时麦克风里的扬声器声音不再送去识别，也让打断成为可能
+    cfg->aec_init = use_aec;
+    cfg->aec_mode = AEC_MODE_SR_LOW_COST;
+    // 🎯 双麦克风语音增强（波束形成）：两路麦克风合成一路，压低侧面和背景的噪声
+    cfg->se_init = mic_channels == 2;
+
+    // 🔇 降噪：有NSNet模型就用模型，否则用WebRTC NS
+    cfg->ns_init = true;
+    char* ns_model = esp_srmodel_filter(models, ESP_NSNET_PREFIX, NULL);
+    cfg->ns_model_name = ns_model;
+    cfg->afe_ns_mode = ns_model ? AFE_NS_MODE_NET : AFE_NS_MODE_WEBRTC;
+
+    // 🗣️ VAD：优先使用VADNet，没有模型时AFE自动退回WebRTC VAD
+    cfg->vad_init = true;
+    cfg->vad_mode = AFE_VAD_MODE;
+    cfg->vad_model_name = esp_srmodel_filter(models, ESP_VADN_PREFIX, NULL);
+    cfg->vad_min_speech_ms = AFE_VAD_MIN_SPEECH_MS;
+    cfg->vad_min_noise_ms = AFE_VAD_MIN_NOISE_MS;
+
+    // 🎚️ AGC
+    cfg->agc_init = AFE_AGC_ENABLE;
+    cfg->agc_mode = AFE_AGC_MODE_WEBRTC;
+
+    cfg->wakenet_init = wakenet_model[0] != nullptr;
+    cfg->wakenet_model_name = wakenet_model[0];
+    cfg->wakenet_model_name_2 = wakenet_model[1];
+    cfg->wakenet_mode = mode;
+
+    cfg->afe_perferred_core = AFE_FETCH_TASK_CORE;
+    cfg->afe_perferred_priority = AFE_FETCH_TASK_PRIORITY;
+    cfg->afe_ringbuf_size = AFE_RINGBUF_FRAMES;
+#if CONFIG_SPIRAM
+    cfg->memory_alloc_mode = AFE_MEMORY_ALLOC_MORE_PSRAM;
+#else
+    cfg->memory_alloc_mode = AFE_MEMORY_ALLOC_MORE_INTERNAL;
+#endif
+    cfg->pcm_config.sample_rate = sample_rate;
+    return afe_config_check(cfg);
+}
+
+/**
+ * @brief 按保存的模型列表和唤醒词选择创建AFE实例（init和重建共用，两次的配置完全相同）
+ */
+esp_err_t AudioFrontEnd::createAfe(bool use_aec) {
+    afe_config_t* cfg = buildConfig(models_, sample_rate_, mic_channels_, use_aec, wakenet_model_, wake_mode_);
+    if (!cfg) {
+        ESP_LOGE(TAG, "❌ AFE配置创建失败");
+        return ESP_FAIL;
+    }
+    // 🛡️ 实时系数保护降到最后一级时用短的回声尾长（只在创建时能改）
+    if (use_aec && aec_short_tail_ && cfg->aec_filter_length > RTF_GUARD_AEC_FILTER_LENGTH) {
+        ESP_LOGW(TAG, "🛡️ AEC滤波器长度 %d → %d", cfg->aec_filter_length, RTF_GUARD_AEC_FILTER_LENGTH);
+        cfg->aec_filter_length = RTF_GUARD_AEC_FILTER_LENGTH;
+    }
+    ns_model_ = esp_srmodel_filter(models_, ESP_NSNET_PREFIX, NULL);
+    vad_model_ = esp_srmodel_filter(models_, ESP_VADN_PREFIX, NULL);
+    afe_handle_ = esp_afe_handle_from_config(cfg);
+    afe_data_ = afe_handle_ ? afe_handle_->create_from_config(cfg) : nullptr;
+    afe_config_free(cfg);
+    if (!afe_data_) {
+        afe_handle_ = nullptr;
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+bool AudioFrontEnd::aecTailPending() const {
+    return afe_data_ && aec_enabled_ && RtfGuard::degraded(RtfStage::AEC) != aec_short_tail_;
+}
+
+void AudioFrontEnd::requestRebuild() {
+    if (!afe_data_) {
+        return;
+    }
+    RebuildState expected = RebuildState::NONE;
+    rebuild_state_.compare_exchange_strong(expected, RebuildState::REQUESTED);
+}
+
+/**
+ * @brief 销毁并重新创建AFE（在fetch任务中、采集任务已经停止喂数据后调用）
+ *
+ * 先销毁再创建，PSRAM峰值不翻倍；两个实例之间重新测量唤醒词模型，对比切换前后的detect耗时。
+ * 重新创建失败时退化为直通模式。
+ */
+void AudioFrontEnd::rebuildAfe() {
+    int64_t start = esp_timer_get_time();
+    afe_handle_->destroy(afe_data_);
+    afe_data_ = nullptr;
+    probeWakeNets();
+
+    aec_short_tail_ = RtfGuard::degraded(RtfStage::AEC);
+    esp_err_t ret = createAfe(aec_enabled_);
+    if (ret == ESP_OK && (size_t)afe_handle_->get_feed_chunksize(afe_data_) != chunk_samples_) {
+        ESP_LOGE(TAG, "❌ 重建后feed块大小变了");
+        afe_handle_->destroy(afe_data_);
+        afe_data_ = nullptr;
+        afe_handle_ = nullptr;
+        ret = ESP_ERR_INVALID_SIZE;
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ AFE重建失败，音频前端以直通模式运行");
+        wakenet_model_[0] = wakenet_model_[1] = nullptr;
+        aec_enabled_ = false;
+        RtfGuard::setAvailable(RtfStage::NS, false);
+        RtfGuard::setAvailable(RtfStage::AEC, false);
+        return;
+    }
+    // 新实例的唤醒词默认启用，阈值也要重新设置
+    wakenet_enabled_ = true;
+    wake_threshold_dirty_ = true;
+    ESP_LOGI(TAG, "🔄 AFE已重建（唤醒词权重在%s），耗时%lldms", wakeWordWeights(0),
+             (esp_timer_get_time() - start) / 1000);
+}
+
+void AudioFrontEnd::setWakeThreshold(int index, float threshold) {
+    if (index < 0 || index >= WakeSettings::MAX_MODELS || !WakeSettings::validThreshold(threshold)) {
+        return;
+    }
+    wake_threshold_[index] = threshold;
+    wake_threshold_dirty_ = true;
+}
+
+void AudioFrontEnd::applyWakeThresholds() {
+    for (int i = 0; i < WakeSettings::MAX_MODELS; i++) {
+        if (!wakenet_model_[i]) {
+            continue;
+        }
+        float threshold = wake_threshold_[i].load();
+        // AFE的模型序号从1开始
+        int ret = threshold > 0.0f ? afe_handle_->set_wakenet_threshold(afe_data_, i + 1, threshold)
+                                   : afe_handle_->reset_wakenet_threshold(afe_data_, i + 1);
+        if (ret < 0) {
+            ESP_LOGW(TAG, "⚠️ 设置唤醒词模型%d阈值失败", i + 1);
+        } else if (threshold > 0.0f) {
+            ESP_LOGI(TAG, "🎯 唤醒词模型%d阈值: %.4f", i + 1, threshold);
+        }
+    }
+}
+
+void AUDIO_HOT_IRAM AudioFrontEnd::feedReference(const int16_t* samples, size_t count) {
+    if (!aec_enabled_) {
+        return;
+    }
+    // 满了说明采集停了，直接丢弃，不能阻塞播放
+    reference_ring_.write(samples, count);
+}
+
+void AudioFrontEnd::setEchoDelayMs(uint32_t ms) {
+    uint32_t lead = ms + AFE_AEC_REF_MARGIN_MS;
+    ref_lead_ms_ = lead < AFE_AEC_MAX_REF_LEAD_MS ? lead : AFE_AEC_MAX_REF_LEAD_MS;
+    ESP_LOGI(TAG, "🔊 回声延迟 %lu ms，参考信号最多领先 %lu ms", (unsigned long)ms, (unsigned long)ref_lead_ms_.load());
+}
+
+esp_err_t AudioFrontEnd::start() {
+    if (chunk_samples_ != 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (afe_data_) {
+        chunk_samples_ = afe_handle_->get_feed_chunksize(afe_data_);
+        feed_samples_ = chunk_samples_ * mic_channels_;
+        // 16字节对齐，和采集任务交过来的DMA块一样可以直接喂给AFE
+        stage_ = (int16_t*)BufferPlacement::alloc("afe_stage", feed_samples_ * sizeof(int16_t), Placement::INTERNAL);
+        if (aec_enabled_) {
+            // AEC模式下麦克风和参考信号交织成"MR"/"MMR"
+            feed_buffer_ = (int16_t*)BufferPlacement::alloc("afe_feed", (feed_samples_ + chunk_samples_) * sizeof(int16_t),
+                                                            Placement::INTERNAL);
+            ref_ = (int16_t*)BufferPlacement::alloc("afe_reference", chunk_samples_ * sizeof(int16_t), Placement::INTERNAL);
+        }
+        if (!stage_ || (aec_enabled_ && (!feed_buffer_ || !ref_))) {
+            ESP_LOGE(TAG, "❌ 无法分配feed缓冲区");
+            BufferPlacement::free(stage_);
+            BufferPlacement::free(feed_buffer_);
+            BufferPlacement::free(ref_);
+            stage_ = feed_buffer_ = ref_ = nullptr;
+            chunk_samples_ = 0;
+            return ESP_ERR_NO_MEM;
+        }
+#if AFE_DOA_ENABLE
+        if (mic_channels_ == 2) {
+            doa_ = afe_doa_create("MM", sample_rate_, AFE_DOA_RESOLUTION_DEG, MIC_SPACING_M, chunk_samples_);
+            if (!doa_) {
+                ESP_LOGW(TAG, "⚠️ 声源方向估计初始化失败，不估计方向");
+            }
+        }
+#endif
+    } else {
+        // 直通模式不需要凑块，单麦克风时DMA块原样交给音频回调
+        chunk_samples_ = SIZE_MAX;
+        if (mic_channels_ == 2) {
+            // 双麦克风只取左声道，分段拷进stage_
+            feed_samples_ = I2S_RX_CHUNK_SAMPLES;
+            stage_ = (int16_t*)BufferPlacement::alloc("afe_stage", feed_samples_ * sizeof(int16_t), Placement::INTERNAL);
+            if (!stage_) {
+                ESP_LOGE(TAG, "❌ 无法分配直通缓冲区");
+                chunk_samples_ = 0;
+                return ESP_ERR_NO_MEM;
+            }
+        }
+    }
+
+    esp_err_t ret = bsp_capture_add_sink(capture_sink, this);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ 注册采集回调失败: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    if (afe_data_ && TaskFactory::create(fetch_task, "afe_fetch", AFE_FETCH_TASK_STACK, this, AFE_FETCH_TASK_PRIORITY,
+                                         &fetch_task_handle_, AFE_FETCH_TASK_CORE, TaskStack::INTERNAL) != pdPASS) {
+        ESP_LOGE(TAG, "❌ 创建fetch任务失败");
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+void AUDIO_HOT_IRAM AudioFrontEnd::capture_sink(const int16_t* samples, size_t count, void* ctx) {
+    ((AudioFrontEnd*)ctx)->onCapture(samples, count);
+}
+
+void AUDIO_HOT_IRAM AudioFrontEnd::onCapture(const int16_t* samples, size_t count) {
+    RebuildState rebuild = rebuild_state_.load(std::memory_order_acquire);
+    if (rebuild != RebuildState::NONE) {
+        // 重建期间不碰AFE：丢弃没凑满的块，通知fetch任务可以开始
+        if (rebuild == RebuildState::REQUESTED) {
+            stage_fill_ = 0;
+            rebuild_state_.store(RebuildState::FEED_PARKED, std::memory_order_release);
+        }
+        return;
+    }
+    if (!afe_data_) {
+        // 直通模式：没有VAD，全部当作语音
+        if (mic_channels_ == 2) {
+            passthroughLeft(samples, count);
+        } else if (audio_callback_) {
+            audio_callback_(samples, count, true);
+        }
+        return;
+    }
+
+    // DMA块正好等于feed块时不拷贝，直接从DMA缓冲区喂给AFE
+    if (stage_fill_ == 0 && count == feed_samples_) {
+        feedChunk(samples);
+        return;
+    }
+
+    while (count > 0) {
+        size_t n = feed_samples_ - stage_fill_;
+        if (n > count) {
+            n = count;
+        }
+        memcpy(stage_ + stage_fill_, samples, n * sizeof(int16_t));
+        stage_fill_ += n;
+        samples += n;
+        count -= n;
+        if (stage_fill_ == feed_samples_) {
+            feedChunk(stage_);
+            stage_fill_ = 0;
+        }
+    }
+}
+
+/**
+ * @brief 直通模式下双麦克风只取左声道交给音频回调
+ */
+void AudioFrontEnd::passthroughLeft(const int16_t* samples, size_t count) {
+    if (!audio_callback_) {
+        return;
+    }
+    size_t frames = count / 2;
+    while (frames > 0) {
+        size_t n = frames < feed_samples_ ? frames : feed_samples_;
+        for (size_t i = 0; i < n; i++) {
+            stage_[i] = samples[2 * i];
+        }
+        audio_callback_(stage_, n, true);
+        samples += 2 * n;
+        frames -= n;
+    }
+}
+
+/**
+ * @brief 估计这一块的声源方向，按块能量加权平均最近kDoaHistory块
+ *
+ * 只在等待唤醒时运行，静音块能量小，几乎不影响结果；唤醒词落在最近约0.5秒里。
+ */
+void AudioFrontEnd::trackDirection(const int16_t* mic) {
+    uint32_t energy = 0;
+    for (size_t i = 0; i < chunk_samples_; i += 4) {
+        int16_t v = mic[2 * i];
+        energy += v < 0 ? -v : v;
+    }
+    doa_angle_[doa_pos_] = afe_doa_process(doa_, mic);
+    doa_energy_[doa_pos_] = energy;
+    doa_pos_ = (doa_pos_ + 1) % kDoaHistory;
+
+    float weighted = 0.0f;
+    float total = 0.0f;
+    for (int i = 0; i < kDoaHistory; i++) {
+        weighted += doa_angle_[i] * doa_energy_[i];
+        total += doa_energy_[i];
+    }
+    doa_estimate_ = total > 0.0f ? (int)(weighted / total + 0.5f) : -1;
+}
+
+/**
+ * @brief 更新唤醒词能量门：快开慢关，底噪向下立即跟随、向上慢慢爬
+ *
+ * 底噪往上每块只追差值的1/256（约8秒的时间常数），持续的说话声不会被当成底噪。
+ */
+void AUDIO_HOT_IRAM AudioFrontEnd::updateWakeGate(const int16_t* mic) {
+    const int stride = mic_channels_;
+    uint32_t sum = 0;
+    for (size_t i = 0; i < chunk_samples_; i++) {
+        int16_t v = mic[i * stride];
+        sum += v < 0 ? -v : v;
+    }
+    uint32_t level = sum / chunk_samples_;
+
+    uint32_t threshold = gate_floor_ * WAKE_GATE_RATIO;
+    if (threshold < WAKE_GATE_MIN_LEVEL) {
+        threshold = WAKE_GATE_MIN_LEVEL;
+    }
+    if (level < gate_floor_) {
+        gate_floor_ = level;
+    } else {
+        gate_floor_ += (level - gate_floor_) / 256 + 1;
+    }
+
+    if (level > threshold) {
+        if (gate_quiet_ms_ >= WAKE_GATE_HOLD_MS) {
+            gate_onsets_.fetch_add(1, std::memory_order_relaxed);
+        }
+        gate_quiet_ms_ = 0;
+        wake_gate_open_.store(true, std::memory_order_relaxed);
+        return;
+    }
+    if (gate_quiet_ms_ < WAKE_GATE_HOLD_MS) {
+        gate_quiet_ms_ += chunk_samples_ * 1000 / sample_rate_;
+        if (gate_quiet_ms_ >= WAKE_GATE_HOLD_MS) {
+            wake_gate_open_.store(false, std::memory_order_relaxed);
+        }
+    } else {
+        PerfCounters::add(PerfCounter::WAKE_GATED_BLOCKS, 1);
+    }
+}
+
+void AUDIO_HOT_IRAM AudioFrontEnd::feedChunk(const int16_t* mic) {
+    bool wake_wanted = wakenet_wanted_.load(std::memory_order_relaxed);
+    if (doa_ && wake_wanted) {
+        trackDirection(mic);
+    }
+#if WAKE_GATE_ENABLE
+    if (wakenet_model_[0] && wake_wanted) {
+        updateWakeGate(mic);
+    } else if (gate_quiet_ms_ != 0) {
+        // 会话期间门保持打开，回到空闲时从头计时
+        gate_quiet_ms_ = 0;
+        wake_gate_open_.store(true, std::memory_order_relaxed);
+    }
+#endif
+    SCOPE_TIMER(AFE_FEED);
+    SCHED_TRACE_BEGIN(AFE_FEED, 0);
+    int64_t feed_start_us = esp_timer_get_time();
+    if (!aec_enabled_) {
+        afe_handle_->feed(afe_data_, mic);
+        RtfGuard::addBusy((uint32_t)(esp_timer_get_time() - feed_start_us));
+        SCHED_TRACE_END(AFE_FEED, 0);
+        return;
+    }
+
+    // 参考信号领先太多（播放任务一次写入了很多）时丢掉最旧的，保持与回声大致对齐
+    const size_t max_ref_lead = sample_rate_ * ref_lead_ms_.load(std::memory_order_relaxed) / 1000;
+    size_t queued = reference_ring_.size();
+    if (queued > max_ref_lead + chunk_samples_) {
+        reference_ring_.commitRead(queued - max_ref_lead - chunk_samples_);
+    }
+    size_t got = reference_ring_.read(ref_, chunk_samples_);
+    if (got < chunk_samples_) {
+        memset(ref_ + got, 0, (chunk_samples_ - got) * sizeof(int16_t));
+    }
+
+    if (mic_channels_ == 2) {
+        for (size_t i = 0; i < chunk_samples_; i++) {
+            feed_buffer_[3 * i] = mic[2 * i];
+            feed_buffer_[3 * i + 1] = mic[2 * i + 1];
+            feed_buffer_[3 * i + 2] = ref_[i];
+        }
+    } else {
+        for (size_t i = 0; i < chunk_samples_; i++) {
+            feed_buffer_[2 * i] = mic[i];
+            feed_buffer_[2 * i + 1] = ref_[i];
+        }
+    }
+    afe_handle_->feed(afe_data_, feed_buffer_);
+    RtfGuard::addBusy((uint32_t)(esp_timer_get_time() - feed_start_us));
+    SCHED_TRACE_END(AFE_FEED, 0);
+}
+
+void AudioFrontEnd::fetch_task(void* arg) {
+    AudioFrontEnd* self = (AudioFrontEnd*)arg;
+    esp_afe_sr_iface_t* afe = self->afe_handle_;
+
+    ESP_LOGI(TAG, "🧠 fetch任务已启动，每块 %d 样本", afe->get_fetch_chunksize(self->afe_data_));
+    bool last_wanted = true;
+    // 📏 检测余量：每块要在一块的时长内处理完，缓冲区占用和回调耗时每AUDIO_PIPELINE_REPORT_MS报告一次
+    const int64_t chunk_us = (int64_t)afe->get_fetch_chunksize(self->afe_data_) * 1000000 / self->sample_rate_;
+    int64_t report_us = esp_timer_get_time();
+    int64_t callback_total_us = 0;
+    uint32_t callback_max_us = 0;
+    uint32_t backlog_max_pct = 0;
+    uint32_t chunks = 0;
+    // 🛡️ 实时系数：fetch在缓冲区空时要等feed，只有取完后缓冲区里还有块（没等）时测到的才是纯处理时间；
+    // 等过就说明跟得上，按最近一次没等时测到的算（还没测到过时算0）
+    uint32_t fetch_busy_us = 0;
+    bool ns_off = false;
+
+    while (true) {
+        if (self->rebuild_state_.load(std::memory_order_acquire) == RebuildState::FEED_PARKED) {
+            self->rebuildAfe();
+            afe = self->afe_handle_;
+            bool ok = self->afe_data_ != nullptr;
+            self->rebuild_state_.store(RebuildState::NONE, std::memory_order_release);
+            ns_off = false;     // 新实例默认开着降噪
+            if (!ok) {
+                // 直通模式下采集任务直接调用音频回调，不再需要fetch任务
+                self->fetch_task_handle_ = nullptr;
+                vTaskDelete(NULL);
+            }
+        }
+
+        // 唤醒词开关只在这里切换，避免与AFE内部处理并发
+        bool wanted = self->wakenet_wanted_.load();
+        bool gate_open = self->wake_gate_open_.load(std::memory_order_relaxed);
+        if (self->wakenet_model_[0] && self->wake_threshold_dirty_.exchange(false)) {
+            self->applyWakeThresholds();
+        }
+        bool run_wakenet = wanted && gate_open;
+        if (self->wakenet_model_[0] && run_wakenet != self->wakenet_enabled_) {
+            if (run_wakenet) {
+                afe->enable_wakenet(self->afe_data_);
+            } else {
+                afe->disable_wakenet(self->afe_data_);
+            }
+            self->wakenet_enabled_ = run_wakenet;
+            // 能量门的开关很频繁，只在调试级别打印
+            if (wanted == last_wanted) {
+                ESP_LOGD(TAG, "🎯 能量门%s，唤醒词检测%s", gate_open ? "打开" : "关闭", run_wakenet ? "恢复" : "暂停");
+            } else {
+                ESP_LOGI(TAG, "🎯 唤醒词检测已%s", wanted ? "启用" : "暂停");
+            }
+        }
+        last_wanted = wanted;
+
+        bool want_ns_off = RtfGuard::degraded(RtfStage::NS);
+        if (want_ns_off != ns_off) {
+            if (want_ns_off) {
+                afe->disable_ns(self->afe_data_);
+            } else {
+                afe->enable_ns(self->afe_data_);
+            }
+            ns_off = want_ns_off;
+            ESP_LOGW(TAG, "🛡️ 降噪已%s", ns_off ? "关闭" : "恢复");
+        }
+
+        afe_fetch_result_t* res;
+        int64_t fetch_start_us = esp_timer_get_time();
+        {
+            SCOPE_TIMER(AFE_FETCH);
+            res = afe->fetch(self->afe_data_);
+        }
+        if (!res || res->ret_value == ESP_FAIL) {
+            continue;
+        }
+        SCHED_TRACE_MARK(AFE_FETCH, res->wakeup_state);
+        int64_t fetched_us = esp_timer_get_time();
+
+        if (res->wakeup_state == WAKENET_DETECTED) {
+            int direction = self->doa_estimate_.load();
+            self->wake_direction_ = direction;
+            self->wake_volume_ = res->data_volume;
+            // AFE的模型序号从1开始
+            self->wake_model_ = res->wakenet_model_index == 2 ? 1 : 0;
+            ESP_LOGI(TAG, "🎉 检测到唤醒词 (模型%d, index=%d, 音量=%.1fdB)",
+                     res->wakenet_model_index, res->wake_word_index, res->data_volume);
+            if (direction >= 0) {
+                ESP_LOGI(TAG, "🧭 说话人方向: %d°", direction);
+            }
+            if (self->wake_callback_) {
+                self->wake_callback_(res->wake_word_index,
+                                     res->wake_word_length > 0 ? (uint32_t)res->wake_word_length : 0);
+            }
+        }
+
+        if (self->audio_callback_ && res->data && res->data_size > 0) {
+            self->audio_callback_(res->data, res->data_size / sizeof(int16_t), res->vad_state == VAD_SPEECH);
+        }
+
+        int64_t done_us = esp_timer_get_time();
+        uint32_t callback_us = (uint32_t)(done_us - fetched_us);
+        // 字段名叫free，但esp-sr的说明是"大于0.5表示缓冲区忙"，实际给的是占用比例
+        float used = res->ringbuff_free_pct;
+        uint32_t backlog_pct = used > 0 ? (uint32_t)(used * 100.0f + 0.5f) : 0;
+        uint32_t fetch_us = (uint32_t)(fetched_us - fetch_start_us);
+        if (backlog_pct > 0) {
+            fetch_busy_us = fetch_us;
+        }
+        RtfGuard::addBusy((fetch_us < fetch_busy_us ? fetch_us : fetch_busy_us) + callback_us);
+        RtfGuard::endFrame((uint32_t)chunk_us);
+        callback_total_us += callback_us;
+        callback_max_us = callback_us > callback_max_us ? callback_us : callback_max_us;
+        backlog_max_pct = backlog_pct > backlog_max_pct ? backlog_pct : backlog_max_pct;
+        chunks++;
+        PerfCounters::noteMax(PerfGauge::AFE_BACKLOG_MAX_PCT, backlog_pct);
+        PerfCounters::noteMax(PerfGauge::AFE_CALLBACK_MAX_US, callback_us);
+        if (done_us - report_us >= (int64_t)AUDIO_PIPELINE_REPORT_MS * 1000) {
+            ESP_LOGD(TAG, "📏 fetch: %lu块，每块%lldus，回调平均%lldus/最长%luus，缓冲区最高占用%lu%%",
+                     (unsigned long)chunks, chunk_us, callback_total_us / chunks, (unsigned long)callback_max_us,
+                     (unsigned long)backlog_max_pct);
+            report_us = done_us;
+            callback_total_us = 0;
+            callback_max_us = 0;
+            backlog_max_pct = 0;
+            chunks = 0;
+        }
+    }
+}
@@ -0,0 +1,277 @@
+/**
+ * @file audio_front_end.h
+ * @brief 🎛️ 音频前端 - 基于esp-sr AFE的降噪/VAD/AGC/唤醒词流水线
+ *
+ * 麦克风数据由bsp的采集任务统一读取（见bsp_capture_start），这里分两步处理：
+ * - feed：注册为采集回调，在采集任务中按AFE要求的块大小喂给AFE
+ *   （DMA块正好等于feed块时直接从DMA缓冲区喂，不拷贝）
+ * - fetch任务：取出经过NS/AGC处理的音频，同时拿到唤醒词和VAD结果
+ * 两个任务都在音频核心上（见project_config.h任务拓扑），DSP不占用网络核心。
+ *
+ * 每个算法都运行在自己的原生块大小上（由AFE内部处理分帧），
+ * 上层只需要注册回调：唤醒回调 + 处理后音频回调。
+ * 如果模型分区里没有可用模型，会退化为直通模式：采集到的原始音频直接交给音频回调。
+ *
+ * 唤醒词：按WakeSettings选择一个或两个WakeNet模型（AFE内部同时运行），
+ * 检测阈值可以在运行中修改（在fetch任务里生效）。打开WAKENET_COST_PROBE时，
+ * 创建AFE前逐个单独运行每个模型，测出它占一个核心的千分比和每块detect的平均/最长耗时，
+ * 方便按现场在误唤醒率和CPU之间取舍，也能直接比较权重在Flash和PSRAM时的推理耗时。
+ *
+ * 能量门（WAKE_GATE_ENABLE）：空闲时WakeNet是最大的常驻开销，安静的房间里也在一直跑。
+ * 采集任务每块算一次第一路麦克风的平均绝对值，和跟踪的底噪比：一块超过门限就立即打开，
+ * 连续WAKE_GATE_HOLD_MS都低于门限才关上；fetch任务按"需要唤醒词且门开着"启停WakeNet。
+ * feed只写AFE内部的环形缓冲区，fetch落后feed一两块，起音块之后的音频都还在缓冲区里没处理，
+ * WakeNet最多错过起音的一块（约32ms，而且这块的能量已经超过了门限，前面更弱的部分本来就接近底噪）。
+ * NS/AEC/VAD照常运行，音频回调不受影响。门从关到开记一次起音（gateOnsets()），主任务据此让服务器预热会话。
+ *
+ * 模型权重在后台拷进PSRAM后（见model_loader.h），requestRebuild()在空闲时用新的权重指针重建AFE：
+ * 采集任务先停止喂数据，fetch任务销毁旧实例、重新测量并创建新实例，再让采集任务恢复。
+ *
+ * 回声消除：播放任务通过feedReference()把写入I2S的数据送进来，
+ * feed时把它和麦克风数据交织成"MR"格式喂给AFE，参考信号不足时补静音。
+ * 领先太多的参考信号丢掉，上限是标定出的扬声器→麦克风延迟（setEchoDelayMs，见loopback_calibration.h），
+ * 没标定过时是AFE_AEC_MAX_REF_LEAD_MS。
+ *
+ * 双麦克风（MIC_CHANNELS=2）：采集数据本来就是左右交织的，输入格式变成"MMR"/"MM"，
+ * AFE打开双麦克风语音增强（波束形成/盲源分离），输出仍是一路单声道。
+ * AFE_DOA_ENABLE时采集任务在等待唤醒期间对每个feed块估计声源方向，
+ * 按块能量加权平均最近约0.5秒，检测到唤醒词时记下来（wakeDirection()）。
+ * 直通模式只取左声道。
+ */
+
+#ifndef AUDIO_FRONT_END_H
+#define AUDIO_FRONT_END_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <functional>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_err.h"
+#include "esp_afe_sr_models.h"
+#include "esp_afe_doa.h"
+#include "model_path.h"
+#include "spsc_ring.h"
+#include "rtf_guard.h"
+#include "wake_settings.h"
+
+class AudioFrontEnd {
+public:
+    // 唤醒回调在fetch任务中执行，不要在里面做阻塞操作；wake_samples是AFE给出的唤醒词长度（0=没给）
+    using WakeCallback = std::function<void(int wake_word_index, uint32_t wake_samples)>;
+    // 处理后音频回调：samples为单声道16位PCM，is_speech为VAD结果
+    using AudioCallback = std::function<void(const int16_t* samples, size_t count, bool is_speech)>;
+
+    /**
+     * @brief 单独运行一个唤醒词模型的测量结果
+     */
+    struct WakeNetCost {
+        uint32_t permille;          // 占一个核心的千分比
+        uint32_t detect_avg_us;     // 每块detect平均耗时
+        uint32_t detect_max_us;     // 每块detect最长耗时
+    };
+
+    AudioFrontEnd();
+    ~AudioFrontEnd();
+
+    /**
+     * @brief 根据模型分区创建AFE实例
+     *
+     * @param models esp_srmodel_init()返回的模型列表（可以为nullptr，进入直通模式）
+     * @param sample_rate 采样率
+     * @param wake 唤醒词模式、阈值和模型选择
+     * @return ESP_OK表示AFE可用；失败时仍可调用start()以直通模式运行
+     */
+    esp_err_t init(srmodel_list_t* models, uint32_t sample_rate, const WakeSettings& wake);
+
+    /**
+     * @brief 注册采集回调并创建fetch任务
+     *
+     * 需要在bsp_capture_start()之前调用。
+     */
+    esp_err_t start();
+
+    void setWakeCallback(WakeCallback cb) { wake_callback_ = cb; }
+    void setAudioCallback(AudioCallback cb) { audio_callback_ = cb; }
+
+    /**
+     * @brief 启用/暂停唤醒词检测（会话期间暂停以节省CPU）
+     *
+     * 只设置标志，真正的切换在fetch任务中完成，可以在任意任务调用。
+     */
+    void setWakeWordEnabled(bool enabled) { wakenet_wanted_ = enabled; }
+
+    /**
+     * @brief 送入播放参考信号（在播放任务中调用，不阻塞）
+     */
+    void feedReference(const int16_t* samples, size_t count);
+
+    /**
+     * @brief 标定出的扬声器→麦克风延迟：参考信号最多领先这么久再加AFE_AEC_REF_MARGIN_MS（不超过AFE_AEC_MAX_REF_LEAD_MS）
+     */
+    void setEchoDelayMs(uint32_t ms);
+
+    /**
+     * @brief 修改第index个模型（0或1）的检测阈值，0=恢复模型默认（只设置标志，在fetch任务中生效）
+     */
+    void setWakeThreshold(int index, float threshold);
+
+    bool hasWakeWord() const { return wakenet_model_[0] != nullptr && afe_data_ != nullptr; }
+    const char* wakeWordModel(int index = 0) const { return wakenet_model_[index]; }
+
+    /**
+     * @brief 模型单独运行时占一个核心的千分比（没有测量时为0）
+     */
+    uint32_t wakeWordCostPermille(int index) const { return wakenet_cost_[index].permille; }
+    uint32_t wakeWordDetectUs(int index) const { return wakenet_cost_[index].detect_avg_us; }
+    const WakeNetCost& wakeWordCost(int index) const { return wakenet_cost_[index]; }
+
+    /**
+     * @brief 🌙 init()之前调用：第index个模型是model时，第一次测量直接用这个结果（深度睡眠醒来沿用睡前的）
+     */
+    void presetWakeNetCost(int index, const char* model, const WakeNetCost& cost);
+
+    /**
+     * @brief 唤醒词能量门的底噪估计（采集任务在更新，读到的是近似值），start()之前可以用seed设初值
+     */
+    uint32_t wakeGateFloor() const { return gate_floor_; }
+    void seedWakeGateFloor(uint32_t floor) { gate_floor_ = floor; }
+
+    /**
+     * @brief 🔥 能量门从关到开的次数（安静WAKE_GATE_HOLD_MS之后第一块有声音），变了就是可能有人要说唤醒词
+     */
+    uint32_t gateOnsets() const { return gate_onsets_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 第index个模型的权重所在位置（"Flash"/"PSRAM"）
+     */
+    const char* wakeWordWeights(int index) const;
+    bool hasAec() const { return aec_enabled_; }
+    // AFE的降噪正在处理上行音频（不是直通模式，也没有被实时系数保护关掉）
+    bool nsActive() const { return afe_data_ != nullptr && !RtfGuard::degraded(RtfStage::NS); }
+    int micChannels() const { return mic_channels_; }
+
+    /**
+     * @brief 最近一次唤醒时说话人的方向（0~180°，两个麦克风连线方向为0°），没有估计时为-1
+     */
+    int wakeDirection() const { return wake_direction_.load(); }
+
+    /**
+     * @brief 最近一次唤醒词的音量（dB，AFE的data_volume），服务器在多台设备之间仲裁时用来比较谁离得近
+     */
+    float wakeVolume() const { return wake_volume_.load(); }
+
+    /**
+     * @brief 最近一次触发的是第几个模型（0或1），和它当时的检测阈值（0=模型默认），服务器按现场统计误唤醒时用
+     */
+    int wakeModelIndex() const { return wake_model_.load(); }
+    float wakeModelThreshold() const { return wake_threshold_[wake_model_.load()].load(); }
+
+    /**
+     * @brief 请求用模型列表里当前的权重指针重建AFE（只设置标志，可以在任意任务调用）
+     *
+     * 重建期间（约几十到几百毫秒）采集到的音频被丢弃，只应在空闲等待唤醒时调用。
+     */
+    void requestRebuild();
+
+    /**
+     * @brief 🛡️ 实时系数保护要求的AEC尾长和当前实例的不一样（主循环空闲时据此requestRebuild）
+     */
+    bool aecTailPending() const;
+
+    /**
+     * @brief 在模型列表里选一个唤醒词模型
+     *
+     * @param wanted 指定的模型名，空或"*"表示取第一个唤醒词模型
+     * @param exclude 跳过这个模型（选第二个模型时排除第一个）
+     */
+    static char* pickWakeModel(srmodel_list_t* models, const char* wanted, const char* exclude);
+
+    /**
+     * @brief 生成并检查AFE配置（前端自己和基准测试共用，调用者负责afe_config_free）
+     *
+     * @param wakenet_model 两个唤醒词模型名，第一个为nullptr时不启用唤醒词
+     */
+    static afe_config_t* buildConfig(srmodel_list_t* models, uint32_t sample_rate, int mic_channels, bool use_aec,
+                                     char* const wakenet_model[WakeSettings::MAX_MODELS], det_mode_t mode);
+
+private:
+    static const char* TAG;
+
+    // 重建AFE的交接：主循环请求 → 采集任务停止喂数据 → fetch任务重建后清零
+    enum class RebuildState : uint8_t {
+        NONE,
+        REQUESTED,
+        FEED_PARKED,
+    };
+
+    using ReferenceRing = SpscRing<int16_t, 8192>;
+
+    static void capture_sink(const int16_t* samples, size_t count, void* ctx);
+    void onCapture(const int16_t* samples, size_t count);
+    void feedChunk(const int16_t* mic);
+    void trackDirection(const int16_t* mic);
+    void updateWakeGate(const int16_t* mic);
+    void passthroughLeft(const int16_t* samples, size_t count);
+    void applyWakeThresholds();
+    esp_err_t createAfe(bool use_aec);
+    void probeWakeNets();
+    void rebuildAfe();
+    static void fetch_task(void* arg);
+
+    static WakeNetCost probeWakeNetCost(const char* model, det_mode_t mode);
+
+    esp_afe_sr_iface_t* afe_handle_;
+    esp_afe_sr_data_t* afe_data_;
+    srmodel_list_t* models_;
+    det_mode_t wake_mode_;
+    char* ns_model_;
+    char* vad_model_;
+    char* wakenet_model_[WakeSettings::MAX_MODELS];
+    WakeNetCost wakenet_cost_[WakeSettings::MAX_MODELS];
+    char preset_model_[WakeSettings::MAX_MODELS][24];       // presetWakeNetCost()的，用过一次就清掉
+    WakeNetCost preset_cost_[WakeSettings::MAX_MODELS];
+    uint32_t sample_rate_;
+    int mic_channels_;
+    bool aec_enabled_;
+    bool aec_short_tail_;            // 当前实例用的是RTF_GUARD_AEC_FILTER_LENGTH
+    std::atomic<RebuildState> rebuild_state_;
+    ReferenceRing reference_ring_;   // 播放任务写入，采集任务读取
+    std::atomic<uint32_t> ref_lead_ms_;     // 参考信号最多领先麦克风的时长
+
+    std::atomic<bool> wakenet_wanted_;
+    std::atomic<bool> wake_gate_open_;     // 采集任务写入，fetch任务读取
+    std::atomic<uint32_t> gate_onsets_;    // 采集任务写入，主任务读取
+    bool wakenet_enabled_;     // 只在fetch任务中访问
+    std::atomic<float> wake_threshold_[WakeSettings::MAX_MODELS];
+    std::atomic<bool> wake_threshold_dirty_;
+
+    TaskHandle_t fetch_task_handle_;
+
+    // 声源方向：采集任务估计，fetch任务在唤醒时记录
+    static constexpr int kDoaHistory = 16;
+    afe_doa_handle_t* doa_;
+    std::atomic<int> doa_estimate_;
+    std::atomic<int> wake_direction_;
+    std::atomic<float> wake_volume_;
+    std::atomic<int> wake_model_;
+
+    // 以下只在采集任务中访问
+    int16_t* stage_;           // DMA块和feed块大小不一致时凑块（直通模式下存左声道）
+    int16_t* feed_buffer_;     // AEC模式下交织后的"MR"/"MMR"数据
+    int16_t* ref_;
+    size_t chunk_samples_;     // 每个声道一个feed块的样本数
+    size_t feed_samples_;      // 一个feed块的麦克风样本总数（所有麦克风交织）
+    size_t stage_fill_;
+    float doa_angle_[kDoaHistory];
+    uint32_t doa_energy_[kDoaHistory];
+    int doa_pos_;
+    uint32_t gate_floor_;      // 底噪估计（块平均绝对值）
+    uint32_t gate_quiet_ms_;   // 连续低于门限的时长
+
+    WakeCallback wake_callback_;
+    AudioCallback audio_callback_;
+};
+
+#endif // AUDIO_FRONT_END_H
@@ -7,69 +7,181 @@
 
 extern "C" {
 #include <string.h>
+#include "freertos/semphr.h"
 #include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
 #include "bsp_board.h"
 }
 
+#include <algorithm>
 #include "audio_manager.h"
+#include "task_factory.h"
+#include "project_config.h"
+#include "flight_recorder.h"
+#include "perf_counters.h"
+#include "sched_trace.h"
+#include "scope_timer.h"
+#include "log_throttle.h"
+#include "rtf_guard.h"
+#include "buffer_placement.h"
+#include "realtime_audio.h"
+#include "audio_pipeline.h"
+#include "dsp_tables.h"
+#include "supervisor.h"
 
 const char* AudioManager::TAG = "AudioManager";
 
-AudioManager::AudioManager(uint32_t sample_rate, uint32_t recording_duration_sec, uint32_t response_duration_sec)
-    : sample_rate(sample_rate)
-    , recording_duration_sec(recording_duration_sec)
-    , response_duration_sec(response_duration_sec)
-    , recording_buffer(nullptr)
-    , recording_buffer_size(0)
-    , recording_length(0)
+// 构造函数的初始化列表会先分配各个环形缓冲区，所以在它之前记录空闲内存
+static size_t s_free_internal_before = 0;
+static size_t s_free_psram_before = 0;
+
+static uint32_t snapshot_free_heap(uint32_t sample_rate) {
+    s_free_internal_before = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    s_free_psram_before = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    return sample_rate;
+}
+
+AudioManager::AudioManager(uint32_t sample_rate, uint32_t capture_duration_sec)
+    : sample_rate(snapshot_free_heap(sample_rate))
+    , footprint{}
+    , capture_arena(nullptr)
+    , capture_arena_capacity(0)
+    , capture_arena_length(0)
+    , capture_arena_read_pos(0)
     , is_recording(false)
-    , response_buffer(nullptr)
-    , response_buffer_size(0)
-    , response_length(0)
-    , response_played(false)
+    , capture_ring("capture_ring", Placement::PSRAM)
+    , record_task_handle(nullptr)
+    , vad_gate(sample_rate, UPLINK_VAD_PREROLL_MS, UPLINK_VAD_HANGOVER_MS)
+    , speech_end_pending(false)
+    , user_speaking(false)
+    , session_preroll(sample_rate * (SESSION_PREROLL_MS + (WAKE_VERIFY_ENABLE ? WAKE_VERIFY_MS : 0)) / 1000,
+                      Placement::PSRAM)
+    , preroll_replay_pending(false)
+    , push_to_talk(false)
+    , talk_held(false)
+    , talk_press_pending(false)
+    , talk_release_pending(false)
+    , wake_clip_samples(0)
+    , wake_clip_dropped(0)
+    , replay_clip_samples(0)
+    , replay_clip_padded(0)
+    , wake_tail_samples(0)
+    , replay_tail_samples(0)
+    , wake_head_left(0)
+    , wake_head_upload(false)
     , is_streaming(false)
-    , streaming_buffer(nullptr)
-    , streaming_buffer_size(STREAMING_BUFFER_SIZE)
-    , streaming_write_pos(0)
-    , streaming_read_pos(0)
+    , is_draining(false)
+    , playback_idle(true)
+    , stream_generation(1)
+    , jitter_buffer(true)
+    , playback_task_handle(nullptr)
+    , prompt_queues{}
+    , active_prompts{}
+    , mixer(sample_rate * PLAYBACK_CHUNK_MS / 1000)
+    , silence_gate(sample_rate, sample_rate * PLAYBACK_CHUNK_MS / 1000)
+    , playout_drift(sample_rate, sample_rate * PLAYBACK_CHUNK_MS / 1000)
+    , prompt_arena("提示音内存池", SESSION_ARENA_BYTES, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+    , playback_active(false)
+    , half_duplex(false)
+    , duplex_muted(false)
+    , duplex_hold_until_us(0)
+    , flush_playback_pending(false)
+    , flush_prompts_pending(false)
+    , fade_prompts_pending(0)
+    , prebuffer_ms(PLAYOUT_DELAY_INITIAL_MS)
+    , prebuffer_base_ms(PLAYOUT_DELAY_INITIAL_MS)
+    , prebuffer_boost_ms(0)
+    , prebuffer_fixed_ms(0)
+    , downlink_chunk_ms(0)
+    , output_rate(sample_rate)
+    , discard_downlink(false)
+    , light_ns_wanted(false)
+    , uplink_codec(UplinkCodec::PCM)
+    , uplink_bitrate_request(0)
+    , downlink_codec(DownlinkCodec::PCM)
+    , downlink_decode_buffer(nullptr)
+    , downlink_resampler_reset(false)
+    , downlink_skip_message(false)
+    , downlink_framing(false)
+    , downlink_tracker()
+    , downlink_last_seq(0)
+    , playout_delay(sample_rate, PLAYOUT_DELAY_INITIAL_MS)
+    , downlink_has_carry(false)
+    , downlink_end_of_stream(false)
+    , downlink_carry(0)
+    , downlink_rx_bytes(0)
+    , reply_cache(REPLY_CACHE_ENABLE ? REPLY_CACHE_BYTES : 0)
+    , reply_cache_restart(false)
+    , replaying(false)
+    , replay_block(nullptr)
+    , replay_block_left(0)
 {
-    recording_buffer_size = sample_rate * recording_duration_sec * sizeof(int16_t);
-    response_buffer_size = sample_rate * response_duration_sec * sizeof(int16_t);
-
     ESP_LOGI(TAG, "初始化音频管理器...");
-    recording_buffer = (int16_t*)malloc(recording_buffer_size);
-    if (recording_buffer) {
-        ESP_LOGI(TAG, "✓ 录音缓冲区分配成功，大小: %zu 字节 (%d 秒)", recording_buffer_size, recording_duration_sec);
-    } else {
-        ESP_LOGE(TAG, "❌ 录音缓冲区分配失败");
+    if (capture_duration_sec > 0) {
+        size_t samples = (size_t)sample_rate * capture_duration_sec;
+        capture_arena = (int16_t*)BufferPlacement::alloc("capture_arena", samples * sizeof(int16_t), Placement::PSRAM);
+        if (capture_arena) {
+            capture_arena_capacity = samples;
+            ESP_LOGI(TAG, "✓ 会话录音存档: %lu 秒 (%zu 字节, %s)",
+                     (unsigned long)capture_duration_sec, samples * sizeof(int16_t),
+                     BufferPlacement::regionName(capture_arena));
+        } else {
+            ESP_LOGE(TAG, "❌ 会话录音存档分配失败");
+        }
     }
 
-    response_buffer = (int16_t*)malloc(response_buffer_size);
-    if (response_buffer) {
-        ESP_LOGI(TAG, "✓ 响应缓冲区分配成功，大小: %zu 字节 (%d 秒)", response_buffer_size, response_duration_sec);
+    bool prompts_ok = mixer.isValid();
+    for (int v = AudioMixer::VOICE_EARCON; v < AudioMixer::VOICE_COUNT; v++) {
+        prompt_queues[v] = xQueueCreateStatic(PROMPT_QUEUE_DEPTH, sizeof(PromptClip*),
+                                              (uint8_t*)prompt_queue_storage[v], &prompt_queue_structs[v]);
+        prompts_ok = prompts_ok && prompt_queues[v];
+    }
+    if (jitter_buffer.isValid() && prompts_ok) {
+        ESP_LOGI(TAG, "✓ 抖动缓冲区分配成功，大小: %zu 样本", jitter_buffer.capacity());
+        TaskFactory::create(streaming_playback_task, "audio_playback", PLAYBACK_TASK_STACK, this,
+                            PLAYBACK_TASK_PRIORITY, &playback_task_handle, PLAYBACK_TASK_CORE, TaskStack::INTERNAL);
     } else {
-        ESP_LOGE(TAG, "❌ 响应缓冲区分配失败");
+        ESP_LOGE(TAG, "❌ 抖动缓冲区分配失败");
     }
 
-    streaming_buffer = (uint8_t*)malloc(streaming_buffer_size);
-    if (streaming_buffer) {
-        ESP_LOGI(TAG, "✓ 流式播放缓冲区分配成功，大小: %zu 字节", streaming_buffer_size);
-    } else {
-        ESP_LOGE(TAG, "❌ 流式播放缓冲区分配失败");
+    // 每条下行消息都要解码到这里，8KB超过了ALWAYSINTERNAL阈值，普通malloc会落到PSRAM
+    downlink_decode_buffer = (int16_t*)BufferPlacement::alloc("downlink_decode", DOWNLINK_DECODE_SAMPLES * sizeof(int16_t),
+                                                              Placement::INTERNAL);
+    if (!downlink_decode_buffer) {
+        ESP_LOGE(TAG, "❌ 下行解码缓冲区分配失败");
     }
+
+    size_t internal_after = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    size_t psram_after = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    footprint.internal_bytes = s_free_internal_before > internal_after ? s_free_internal_before - internal_after : 0;
+    footprint.psram_bytes = s_free_psram_before > psram_after ? s_free_psram_before - psram_after : 0;
+    ESP_LOGI(TAG, "📊 音频管理器内存占用: 内部RAM %zu 字节, PSRAM %zu 字节",
+             footprint.internal_bytes, footprint.psram_bytes);
 }
 
 AudioManager::~AudioManager() {
-    free(recording_buffer);
-    free(response_buffer);
-    free(streaming_buffer);
+    BufferPlacement::free(capture_arena);
+    if (playback_task_handle) {
+        vTaskDelete(playback_task_handle);
+    }
+    cancel_prompts();
+    for (int v = 0; v < AudioMixer::VOICE_COUNT; v++) {
+        if (prompt_queues[v]) {
+            vQueueDelete(prompt_queues[v]);
+        }
+    }
+    BufferPlacement::free(downlink_decode_buffer);
 }
 
 void AudioManager::start_recording() {
     if (!is_recording) {
         ESP_LOGI(TAG, "开始录音...");
-        recording_length = 0;
+        capture_arena_length = 0;
+        capture_arena_read_pos = 0;
+        preroll_replay_pending = true;  // 音频前端回调会先回放会话预录
         is_recording = true;
+        // 不用叫醒录音任务：下一个AFE块（音频前端回调）回放完预录就会通知它
         // 注释了未定义的函数调用
         // bsp_record_start();
     }
@@ -78,15 +190,42 @@ void AudioManager::start_recording() {
 void AudioManager::stop_recording() {
     if (is_recording) {
         is_recording = false;
+        // 录音任务只等通知（没有轮询），叫醒它丢掉不足一帧的尾巴
+        if (record_task_handle) {
+            xTaskNotifyGive(record_task_handle);
+        }
         // 注释了未定义的函数调用
         // bsp_record_stop();
-        ESP_LOGI(TAG, "停止录音，当前长度: %zu 样本 (%.2f 秒)", recording_length, (float)recording_length / sample_rate);
+        ESP_LOGI(TAG, "停止录音");
+        if (capture_arena) {
+            size_t length = capture_arena_length;
+            ESP_LOGI(TAG, "会话录音存档: %zu 样本 (%.2f 秒)", length, (float)length / sample_rate);
+        }
+        // 通知发送任务冲刷已合并的音频
+        queue_marker(AUDIO_MARKER_FLUSH);
+        if (s_audio_frame_pool) {
+            s_audio_frame_pool->logStats();
+        }
     }
 }
 
 esp_err_t AudioManager::play_audio(const uint8_t* data, size_t len) {
     ESP_LOGI(TAG, "播放音频...");
-    esp_err_t ret = bsp_play_audio(data, len);
+
+    // 和提示音走同一条混音通路，等待播放完成（I2S不再单独启停）
+    StaticSemaphore_t done_struct;      // 一直等到回调，放在栈上就行
+    SemaphoreHandle_t done = xSemaphoreCreateBinaryStatic(&done_struct);
+    std::atomic<bool> completed(false);
+    esp_err_t ret = play_audio_async(data, len, [done, &completed](bool ok) {
+        completed = ok;
+        xSemaphoreGive(done);
+    });
+    if (ret == ESP_OK) {
+        xSemaphoreTake(done, portMAX_DELAY);
+        ret = completed ? ESP_OK : ESP_FAIL;
+    }
+    vSemaphoreDelete(done);
+
     if (ret == ESP_OK) {
         ESP_LOGI(TAG, "✓ 音频播放成功");
     } else {
@@ -95,440 +234,1471 @@ esp_err_t AudioManager::play_audio(const uint8_t* data, size_t len) {
     return ret;
 }
 
+esp_err_t AudioManager::play_audio_async(const uint8_t* data, size_t len, PromptDoneCallback callback,
+                                         AudioMixer::Voice voice) {
+    if (!data || len < sizeof(int16_t) || ((uintptr_t)data & 1) != 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    PromptClip* clip = prompt_arena.create<PromptClip>();
+    if (!clip) {
+        return ESP_ERR_NO_MEM;
+    }
+    clip->samples = (const int16_t*)data;
+    clip->count = len / sizeof(int16_t);
+    clip->done = callback;
+    stage_prompt(clip, data, clip->count * sizeof(int16_t), sample_rate * PLAYBACK_CHUNK_MS / 1000 * sizeof(int16_t));
+    return queue_prompt(clip, voice);
+}
+
+esp_err_t AudioManager::play_prompt_async(const PromptAsset* asset, PromptDoneCallback callback,
+                                          AudioMixer::Voice voice) {
+    if (!asset || asset->samples == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (asset->codec == PromptCodec::PCM16) {
+        return play_audio_async(asset->data, asset->size, callback, voice);
+    }
+    if (asset->codec != PromptCodec::IMA_ADPCM) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    PromptClip* clip = prompt_arena.create<PromptClip>();
+    if (!clip) {
+        return ESP_ERR_NO_MEM;
+    }
+    size_t capacity = sample_rate * PLAYBACK_CHUNK_MS / 1000 + ImaAdpcmDecoder::samplesInBlock(asset->block_bytes);
+    clip->decoded = (int16_t*)prompt_arena.alloc(capacity * sizeof(int16_t), 16);
+    if (!clip->decoded) {
+        prompt_arena.destroy(clip);
+        return ESP_ERR_NO_MEM;
+    }
+    clip->count = asset->samples;
+    clip->done = callback;
+    clip->adpcm = asset->data;
+    clip->adpcm_size = asset->size;
+    clip->block_bytes = asset->block_bytes;
+    clip->decoded_capacity = capacity;
+    stage_prompt(clip, asset->data, asset->size, asset->block_bytes);
+    return queue_prompt(clip, voice);
+}
+
+/**
+ * @brief 数据在Flash上时改成按块拷贝读取（见FlashStream），不挤占WakeNet用的数据缓存
+ *
+ * 缓冲区申请不到时退回直接读映射地址，只是缓存不那么友好。
+ */
+void AudioManager::stage_prompt(PromptClip* clip, const uint8_t* data, size_t size, size_t max_peek) {
+    if (!FlashStream::isFlashMapped(data)) {
+        return;
+    }
+    size_t capacity = FlashStream::bufferSize(max_peek, PROMPT_STREAM_BLOCK_BYTES);
+    clip->staging = (uint8_t*)prompt_arena.alloc(capacity, 16);
+    if (clip->staging) {
+        clip->flash.begin(data, size, clip->staging, capacity);
+        clip->samples = nullptr;
+    }
+}
+
+void AudioManager::release_prompt(PromptClip* clip) {
+    prompt_arena.release(clip->decoded);
+    prompt_arena.release(clip->staging);
+    prompt_arena.destroy(clip);
+}
+
+esp_err_t AudioManager::queue_prompt(PromptClip* clip, AudioMixer::Voice voice) {
+    esp_err_t ret = ESP_OK;
+    if (voice == AudioMixer::VOICE_TTS || voice >= AudioMixer::VOICE_COUNT) {
+        ret = ESP_ERR_INVALID_ARG;
+    } else if (!prompt_queues[voice] || !playback_task_handle) {
+        ret = ESP_ERR_INVALID_STATE;
+    } else if (xQueueSend(prompt_queues[voice], &clip, 0) != pdTRUE) {
+        HOT_LOGW(TAG, "提示音队列已满，丢弃 %zu 个样本", clip->count);
+        ret = ESP_ERR_TIMEOUT;
+    }
+    if (ret != ESP_OK) {
+        release_prompt(clip);
+        return ret;
+    }
+    xTaskNotifyGive(playback_task_handle);
+    return ESP_OK;
+}
+
+void AudioManager::finish_prompt(PromptClip* clip, bool completed) {
+    if (clip->done) {
+        clip->done(completed);
+    }
+    release_prompt(clip);
+}
+
+void AudioManager::fade_out_prompts(AudioMixer::Voice voice) {
+    if (voice == AudioMixer::VOICE_TTS || voice >= AudioMixer::VOICE_COUNT) {
+        return;
+    }
+    fade_prompts_pending.fetch_or((uint8_t)(1u << voice));
+    if (playback_task_handle) {
+        xTaskNotifyGive(playback_task_handle);
+    }
+}
+
+void AudioManager::cancel_prompts() {
+    for (int v = AudioMixer::VOICE_EARCON; v < AudioMixer::VOICE_COUNT; v++) {
+        if (active_prompts[v]) {
+            finish_prompt(active_prompts[v], false);
+            active_prompts[v] = nullptr;
+        }
+        mixer.resetFade((AudioMixer::Voice)v);
+        PromptClip* clip = nullptr;
+        while (prompt_queues[v] && xQueueReceive(prompt_queues[v], &clip, 0) == pdTRUE) {
+            finish_prompt(clip, false);
+        }
+    }
+}
+
+size_t AudioManager::read_recorded_audio(int16_t* out, size_t max_samples) {
+    size_t length = capture_arena_length.load(std::memory_order_acquire);
+    size_t n = length - capture_arena_read_pos;
+    if (n > max_samples) {
+        n = max_samples;
+    }
+    memcpy(out, capture_arena + capture_arena_read_pos, n * sizeof(int16_t));
+    capture_arena_read_pos += n;
+    return n;
+}
+
+void AudioManager::append_capture_arena(const int16_t* samples, size_t count) {
+    size_t length = capture_arena_length.load(std::memory_order_relaxed);
+    if (length + count > capture_arena_capacity) {
+        if (length < capture_arena_capacity) {
+            ESP_LOGW(TAG, "会话录音存档已满（%zu 样本上限）", capture_arena_capacity);
+        }
+        count = length < capture_arena_capacity ? capture_arena_capacity - length : 0;
+    }
+    memcpy(capture_arena + length, samples, count * sizeof(int16_t));
+    capture_arena_length.store(length + count, std::memory_order_release);
+}
+
+void AudioManager::set_uplink_codec(UplinkCodec codec) {
+    if (codec == UplinkCodec::OPUS && opus_encoder.init(sample_rate, UPLINK_OPUS_BITRATE) != ESP_OK) {
+        ESP_LOGW(TAG, "⚠️ Opus编码器不可用，继续发送PCM");
+        codec = UplinkCodec::PCM;
+    }
+    // 默认复杂度已经是降级用的复杂度时CODEC这一级没有可降的
+    RtfGuard::setAvailable(RtfStage::CODEC,
+                           codec == UplinkCodec::OPUS && UPLINK_OPUS_COMPLEXITY > RTF_GUARD_OPUS_COMPLEXITY);
+    if (codec != uplink_codec) {
+        ESP_LOGI(TAG, "🗜️ 上行编码切换为: %s", codec == UplinkCodec::OPUS ? "Opus" : "PCM");
+        uplink_codec = codec;
+    }
+}
+
+void AudioManager::set_downlink_codec(DownlinkCodec codec) {
+    if (codec != DownlinkCodec::PCM && !downlink_decode_buffer) {
+        codec = DownlinkCodec::PCM;
+    }
+    // hello协商时还没有下行音频，WebSocket任务不会同时用到重采样器
+    if (codec == DownlinkCodec::F32_24K && !downlink_resampler.init()) {
+        codec = DownlinkCodec::PCM;
+    }
+    if (codec != downlink_codec) {
+        static const char* const names[] = { "PCM", "ADPCM", "24kHz float32（设备端重采样）" };
+        ESP_LOGI(TAG, "🗜️ 下行编码切换为: %s", names[(int)codec]);
+        downlink_resampler_reset = true;
+        downlink_codec = codec;
+    }
+}
+
+void AudioManager::set_audio_framing(bool enable) {
+    // hello协商和断开时还没有（或已经没有）下行音频，WebSocket任务不会同时用到
+    if (enable != downlink_framing) {
+        ESP_LOGI(TAG, "🧾 下行音频帧头: %s", enable ? "开启" : "关闭");
+    }
+    downlink_tracker.reset();
+    downlink_last_seq = 0;
+    downlink_framing = enable;
+}
+
+bool AudioManager::get_downlink_resume_point(uint16_t* seq, uint32_t* unplayed) const {
+    uint32_t last = downlink_last_seq.load();
+    if (!is_streaming || !downlink_framing || !(last & 0x10000)) {
+        return false;
+    }
+    *seq = (uint16_t)last;
+    *unplayed = (uint32_t)jitter_buffer.available();
+    return true;
+}
+
+void AUDIO_HOT_IRAM AudioManager::feed_capture_audio(const int16_t* samples, size_t count, bool is_speech) {
+    if (talk_press_pending.exchange(false)) {
+        session_preroll.keepLatest(sample_rate * PUSH_TO_TALK_PREROLL_MS / 1000);
+    }
+    if (!is_recording) {
+        vad_gate.reset();   // 丢掉上一次会话留下的预录内容
+        user_speaking = false;
+        session_preroll.push(samples, count, is_speech);
+        return;
+    }
+
+    // ⏪ 录音刚开始：先把唤醒之后缓存的音频按原顺序送进VAD门控
+    if (preroll_replay_pending.exchange(false)) {
+        replay_session_preroll();
+    }
+
+    // ✂️ 触发之后的唤醒词尾音（回放预录时没用完的部分），不管半双工静音与否都按时间消耗掉
+    if (wake_head_left > 0) {
+        size_t head = consume_wake_head(samples, count);
+        samples += head;
+        count -= head;
+    }
+    if (count == 0 || (half_duplex.load(std::memory_order_relaxed) && mute_for_playback())) {
+        return;
+    }
+    gate_capture_audio(samples, count, is_speech);
+
+    if (record_task_handle) {
+        xTaskNotifyGive(record_task_handle);
+    }
+}
+
+void AudioManager::set_talk_button(bool held) {
+    if (held) {
+        wake_clip_samples = 0;      // 这次不是唤醒词触发的，预录开头没有唤醒词要跳过
+        wake_tail_samples = 0;
+        talk_press_pending = true;
+        talk_release_pending = false;
+    } else {
+        talk_release_pending = true;
+    }
+    talk_held = held;
+}
+
+void AudioManager::mark_wake_word_end(uint32_t wake_samples) {
+    wake_tail_samples = sample_rate * WAKE_TRIM_TAIL_MS / 1000;
+    if (!WAKE_VERIFY_ENABLE) {
+        session_preroll.clear();
+        return;
+    }
+    // AFE知道唤醒词多长时复核片段只留唤醒词本身，少上传一些
+    size_t keep = sample_rate * WAKE_VERIFY_MS / 1000;
+    if (wake_samples > 0) {
+        keep = std::min(keep, (size_t)wake_samples + sample_rate * WAKE_CLIP_LEAD_MS / 1000);
+    }
+    session_preroll.keepLatest(keep);
+    wake_clip_dropped = session_preroll.dropped();
+    wake_clip_samples = (uint32_t)session_preroll.size();
+}
+
+uint32_t AudioManager::take_wake_clip(bool verify, uint32_t* wake_end) {
+    uint32_t clip = wake_clip_samples.exchange(0);
+    uint32_t tail = wake_tail_samples.exchange(0);
+    uint32_t lost = session_preroll.dropped() - wake_clip_dropped.load();
+    uint32_t padded = 0;
+    if (verify && clip > 0) {
+        if (lost == 0) {
+            const uint32_t frame_samples = sample_rate * AUDIO_FRAME_MS / 1000;
+            padded = (clip + frame_samples - 1) / frame_samples * frame_samples;
+        } else {
+            ESP_LOGW(TAG, "🛡️ 唤醒词音频已被挤掉%lu样本，这次不复核", (unsigned long)lost);
+        }
+    }
+    replay_clip_samples = clip;
+    replay_clip_padded = padded;
+    replay_tail_samples = tail;
+    *wake_end = padded > 0 ? padded + tail : 0;
+    return padded;
+}
+
+void AudioManager::replay_session_preroll() {
+    ESP_LOGI(TAG, "⏪ 回放会话预录: %zu 样本 (%.2f 秒)",
+             session_preroll.size(), (float)session_preroll.size() / sample_rate);
+
+    // 🛡️ 唤醒词音频在最前面：要复核时前面补静音、不经过门控直接进采集缓冲区，否则跳过
+    uint32_t clip = replay_clip_samples.exchange(0);
+    uint32_t padded = replay_clip_padded.exchange(0);
+    uint32_t lost = session_preroll.dropped() - wake_clip_dropped.load();
+    size_t clip_left = clip > lost ? clip - lost : 0;
+    if (padded > 0) {
+        static const int16_t zeros[256] = {};
+        size_t pad = padded > clip_left ? padded - clip_left : 0;
+        while (pad > 0) {
+            size_t n = pad < 256 ? pad : 256;
+            capture_ring.write(zeros, n);
+            pad -= n;
+        }
+    }
+
+    // ✂️ 唤醒词之后是触发后的尾音，和唤醒词一样处理（预录里不够时延续到实时音频）
+    size_t tail = replay_tail_samples.exchange(0);
+    size_t tail_lost = lost > clip ? lost - clip : 0;
+    wake_head_left = clip_left + (tail > tail_lost ? tail - tail_lost : 0);
+    wake_head_upload = padded > 0;
+    session_preroll.replay([this](const int16_t* s, size_t n, bool speech) {
+        size_t head = consume_wake_head(s, n);
+        if (head < n) {
+            gate_capture_audio(s + head, n - head, speech);
+        }
+    });
+}
+
+size_t AudioManager::consume_wake_head(const int16_t* samples, size_t count) {
+    size_t head = count < wake_head_left ? count : wake_head_left;
+    if (head > 0 && wake_head_upload) {
+        size_t written = capture_ring.write(samples, head);
+        if (written < head) {
+            PerfCounters::add(PerfCounter::CAPTURE_RING_DROPS, (uint32_t)(head - written));
+            HOT_LOGW(TAG, "采集缓冲区已满，录音任务处理不过来");
+        }
+    }
+    wake_head_left -= head;
+    return head;
+}
+
+void AudioManager::gate_capture_audio(const int16_t* samples, size_t count, bool is_speech) {
+    bool speech = UPLINK_VAD_GATE_ENABLE ? is_speech : true;
+    if (push_to_talk.load(std::memory_order_relaxed)) {
+        // 🔘 按住就是在说话；松开时不等拖尾，这一块起就不再上传
+        if (talk_release_pending.exchange(false) && vad_gate.isOpen()) {
+            vad_gate.reset();
+            ESP_LOGI(TAG, "🔘 松开按键，停止上传");
+            user_speaking = false;
+            speech_end_pending = true;
+        }
+        speech = talk_held.load(std::memory_order_relaxed);
+    }
+    VadGate::Event event = vad_gate.process(samples, count, speech,
+                                            [this](const int16_t* out, size_t n) {
+        size_t written = capture_ring.write(out, n);
+        if (written < n) {
+            PerfCounters::add(PerfCounter::CAPTURE_RING_DROPS, (uint32_t)(n - written));
+            HOT_LOGW(TAG, "采集缓冲区已满，录音任务处理不过来");
+        }
+    });
+
+    if (event == VadGate::Event::SPEECH_START) {
+        ESP_LOGI(TAG, "🗣️ 检测到说话，开始上传");
+        user_speaking = true;
+        if (BARGE_IN_ENABLE && playback_active) {
+            barge_in();
+        }
+    } else if (event == VadGate::Event::SPEECH_END) {
+        ESP_LOGI(TAG, "🤫 说话结束，停止上传");
+        user_speaking = false;
+        speech_end_pending = true;
+    }
+}
+
+/**
+ * @brief 🔇 半双工：I2S在播放（回复或提示音）时和停止后HALF_DUPLEX_TAIL_MS内，这块不上传
+ *
+ * 刚开始静音时如果还在上传一句话，就当这句话说完了（发speech_end），不让VAD拖尾把回声也传上去。
+ * 不上传的块不唤醒录音任务，编码和发送都省掉；I2S接收和AFE照常运行（重启接收通道会丢块，
+ * 采集的看门狗也靠它的心跳）。
+ */
+bool AudioManager::mute_for_playback() {
+    int64_t now = esp_timer_get_time();
+    if (playback_active) {
+        duplex_hold_until_us = now + (int64_t)HALF_DUPLEX_TAIL_MS * 1000;
+    } else if (now >= duplex_hold_until_us) {
+        if (duplex_muted) {
+            duplex_muted = false;
+            ESP_LOGI(TAG, "🔇 播放结束，恢复上传");
+        }
+        return false;
+    }
+    if (!duplex_muted) {
+        duplex_muted = true;
+        ESP_LOGI(TAG, "🔇 半双工：播放期间暂停上传");
+        if (vad_gate.isOpen()) {
+            vad_gate.reset();
+            user_speaking = false;
+            speech_end_pending = true;
+            if (record_task_handle) {
+                xTaskNotifyGive(record_task_handle);
+            }
+        }
+    }
+    PerfCounters::add(PerfCounter::DUPLEX_MUTED_BLOCKS, 1);
+    return true;
+}
+
+void AudioManager::barge_in() {
+    ESP_LOGI(TAG, "✋ 播放中检测到用户说话，打断当前回复");
+    // 先通知服务器（排在这句话的音频前面），再让播放任务清空缓冲区
+    discard_downlink = true;
+    reply_cache.invalidate();   // 用户打断了这一轮，接下来说的话就是下一轮
+    queue_marker(AUDIO_MARKER_INTERRUPT);
+    request_flush(true);
+}
+
+/**
+ * @brief 播放卡住时由子系统看门狗调用：重建I2S发送通道，再让播放任务丢掉排队的回复重新预缓冲
+ */
+esp_err_t AudioManager::recover_playback() {
+    esp_err_t ret = bsp_audio_sink_reset();
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    request_flush(false);
+    return ESP_OK;
+}
+
+/**
+ * @brief 让播放任务丢掉排队的回复并清空DMA（正在等的写入最多I2S_SINK_WRITE_SLICE_MS后放弃）
+ */
+void AudioManager::request_flush(bool cancel_prompts) {
+    if (cancel_prompts) {
+        flush_prompts_pending = true;
+    }
+    flush_playback_pending = true;
+    if (playback_task_handle) {
+        xTaskNotifyGive(playback_task_handle);
+    }
+}
+
+void AudioManager::resume_downlink() {
+    if (discard_downlink) {
+        ESP_LOGI(TAG, "✅ 服务器已确认打断，恢复接收下行音频");
+        discard_downlink = false;
+    }
+}
+
+void AudioManager::queue_marker(AudioQueueMarker marker) {
+    if (s_audio_send_queue) {
+        AudioQueueItem item = { marker, 0, 0, 0, UplinkCodec::PCM };
+        xQueueSend(s_audio_send_queue, &item, 0);
+    }
+}
+
+void AudioManager::queue_uplink_frame(const int16_t* pcm, size_t pcm_bytes, uint32_t timestamp) {
+    // 从帧池申请槽位，避免每帧malloc
+    int slot = s_audio_frame_pool->acquire();
+    if (slot < 0) {
+        PerfCounters::add(PerfCounter::UPLINK_POOL_DROPS);
+        FLIGHT_RECORD(UPLINK_POOL_DROP);
+        HOT_LOGW(TAG, "音频帧池已耗尽，丢弃数据");
+        return;
+    }
+
+    uint8_t* frame = s_audio_frame_pool->data(slot);
+    size_t frame_len = pcm_bytes;
+    UplinkCodec codec = uplink_codec;   // WebSocket任务可能同时切换
+    if (codec == UplinkCodec::OPUS) {
+        uint32_t bitrate = uplink_bitrate_request.exchange(0);
+        if (bitrate != 0) {
+            opus_encoder.setBitrate((int)bitrate);
+        }
+        int complexity = RtfGuard::degraded(RtfStage::CODEC) ? RTF_GUARD_OPUS_COMPLEXITY : UPLINK_OPUS_COMPLEXITY;
+        if (complexity != opus_encoder.complexity()) {
+            opus_encoder.setComplexity(complexity);
+        }
+        int64_t encode_start_us = esp_timer_get_time();
+        int encoded = opus_encoder.encode(pcm, pcm_bytes, frame, s_audio_frame_pool->slotSize());
+        RtfGuard::addBusy((uint32_t)(esp_timer_get_time() - encode_start_us));
+        if (encoded < 0) {
+            s_audio_frame_pool->release(slot);
+            return;
+        }
+        frame_len = encoded;
+    } else {
+        memcpy(frame, pcm, pcm_bytes);
+    }
+    AudioQueueItem item = { (uint16_t)slot, (uint16_t)(pcm_bytes / sizeof(int16_t)), timestamp, frame_len, codec };
+    if (xQueueSend(s_audio_send_queue, &item, 0) != pdTRUE) {
+        SCHED_TRACE_MARK(UPLINK_PUSH, 1);
+        PerfCounters::add(PerfCounter::UPLINK_QUEUE_DROPS);
+        FLIGHT_RECORD(UPLINK_QUEUE_DROP);
+        HOT_LOGW(TAG, "音频发送队列已满，丢弃数据");
+        s_audio_frame_pool->release(slot);
+        return;
+    }
+    SCHED_TRACE_MARK(UPLINK_PUSH, 0);
+    PerfCounters::add(PerfCounter::UPLINK_FRAMES);
+    PerfCounters::noteMax(PerfGauge::SEND_QUEUE_DEPTH, uxQueueMessagesWaiting(s_audio_send_queue));
+}
+
+/**
+ * @brief 上行第一级：需要时做轻量谱减降噪（存档和上传的都是降噪后的）
+ */
+struct AudioManager::LightNsStage {
+    static constexpr const char* NAME = "light_ns";
+    AudioManager* self;
+    bool active = false;
+    bool failed = false;
+
+    bool process(AudioFrame& frame) {
+        if (!self->light_ns_wanted.load(std::memory_order_relaxed) || failed) {
+            active = false;
+            return true;
+        }
+        if (!self->light_ns.isReady() && self->light_ns.init(self->sample_rate) != ESP_OK) {
+            failed = true;
+            return true;
+        }
+        // 新一次录音或刚打开：延迟线里是别的音频，从静音开始（噪声估计保留）
+        if (!active || frame.timestamp == 0) {
+            self->light_ns.resetStream();
+            active = true;
+        }
+        int64_t start_us = esp_timer_get_time();
+        self->light_ns.process(frame.samples, frame.count);
+        RtfGuard::addBusy((uint32_t)(esp_timer_get_time() - start_us));
+        return true;
+    }
+};
+
+/**
+ * @brief 上行第二级：录音存档开着时追加一份（存档和上传的是同一帧）
+ */
+struct AudioManager::ArenaTapStage {
+    static constexpr const char* NAME = "arena";
+    AudioManager* self;
+
+    bool process(AudioFrame& frame) {
+        if (self->capture_arena) {
+            self->append_capture_arena(frame.samples, frame.count);
+        }
+        return true;
+    }
+};
+
+/**
+ * @brief 上行最后一级：按当前编码放进帧池槽位，交给发送任务
+ */
+struct AudioManager::UplinkSinkStage {
+    static constexpr const char* NAME = "uplink";
+    AudioManager* self;
+
+    bool process(AudioFrame& frame) {
+        self->queue_uplink_frame(frame.samples, frame.count * sizeof(int16_t), frame.timestamp);
+        return true;
+    }
+};
+
 void AudioManager::audio_record_task(void *arg) {
     AudioManager *self = (AudioManager *)arg;
-    size_t pcm_data_size = self->sample_rate * 20 / 1000 * 2;
-    int16_t *pcm_data = (int16_t *)malloc(pcm_data_size);
+    const size_t frame_samples = self->sample_rate * AUDIO_FRAME_MS / 1000;
+    const size_t pcm_data_size = frame_samples * sizeof(int16_t);
+    int16_t *pcm_data = (int16_t *)BufferPlacement::alloc("record_frame", pcm_data_size, Placement::INTERNAL);
+    // 每帧读进pcm_data后在原地依次经过各级，新的上行处理（增益等）加在UplinkSinkStage前面
+    AudioPipeline<LightNsStage, ArenaTapStage, UplinkSinkStage> uplink(LightNsStage{ self }, ArenaTapStage{ self },
+                                                                       UplinkSinkStage{ self });
+    int64_t report_us = esp_timer_get_time();
+
+    self->record_task_handle = xTaskGetCurrentTaskHandle();
 
+    bool backlog = false;
+    uint32_t timestamp = 0;     // 上行帧头的时间戳：本次录音读出的样本数，丢弃的帧也算
     while (true) {
-        if (!self->is_recording) {
-            vTaskDelay(pdMS_TO_TICKS(100));
-            continue;
-        }
+        // 等音频前端送来新数据（每个AFE块通知一次）或stop_recording()，AFE的块大小和帧时钟（AUDIO_FRAME_MS）
+        // 不一致，只在这里重新分帧。回放预录时一次会积压很多帧，帧池用完就先让发送任务消化一下
+        ulTaskNotifyTake(pdTRUE, backlog ? pdMS_TO_TICKS(5) : portMAX_DELAY);
 
-        bsp_get_feed_data(false, pcm_data, pcm_data_size);
+        // 先取标志再读数据：标志置位前写入的样本一定都能读到
+        bool speech_end = self->speech_end_pending.exchange(false);
 
-        if (pcm_data_size > 0) {
-            if (self->recording_length + pcm_data_size / sizeof(int16_t) <= self->recording_buffer_size / sizeof(int16_t)) {
-                memcpy(self->recording_buffer + self->recording_length, pcm_data, pcm_data_size);
-                self->recording_length += pcm_data_size / sizeof(int16_t);
-            } else {
-                ESP_LOGW(TAG, "录音缓冲区已满（超过%d秒上限）", self->recording_duration_sec);
+        backlog = false;
+        while (self->is_recording && self->capture_ring.size() >= frame_samples) {
+            if (s_audio_frame_pool->freeCount() == 0) {
+                backlog = true;
+                break;
             }
+            self->capture_ring.read(pcm_data, frame_samples);
+            AudioFrame frame = { pcm_data, frame_samples, timestamp };
+            uplink.process(frame);
+            timestamp += frame_samples;
+        }
 
-            // 为了发送到队列，我们需要为数据单独分配内存
-            uint8_t* data_to_send = (uint8_t*)malloc(pcm_data_size);
-            if (data_to_send) {
-                memcpy(data_to_send, pcm_data, pcm_data_size);
-                AudioQueueItem item = { data_to_send, pcm_data_size };
-                // 添加检查，确保队列未满
-                if (uxQueueSpacesAvailable(s_audio_send_queue) > 0) {
-                    xQueueSend(s_audio_send_queue, &item, 0);
-                } else {
-                    ESP_LOGW(TAG, "音频发送队列已满，丢弃数据");
-                    free(data_to_send);
-                }
+        if (backlog && speech_end) {
+            self->speech_end_pending = true;   // 积压的数据发完再结束这句话
+        } else if (speech_end && self->is_recording) {
+            // 不足一帧的尾巴补静音发出去，然后通知发送任务结束这句话
+            size_t tail = self->capture_ring.read(pcm_data, frame_samples);
+            if (tail > 0) {
+                memset(pcm_data + tail, 0, (frame_samples - tail) * sizeof(int16_t));
+                AudioFrame frame = { pcm_data, frame_samples, timestamp };
+                uplink.process(frame);
+                timestamp += frame_samples;
             }
+            self->queue_marker(AUDIO_MARKER_SPEECH_END);
+        }
+
+        // 录音结束后丢掉不足一帧的尾巴，免得混进下一次录音
+        if (!self->is_recording) {
+            self->capture_ring.clear();
+            timestamp = 0;
+        }
+
+        int64_t now_us = esp_timer_get_time();
+        if (now_us - report_us >= (int64_t)AUDIO_PIPELINE_REPORT_MS * 1000) {
+            uplink.logReport(TAG, "上行");
+            report_us = now_us;
         }
-        // 添加延迟以控制录音速率
-        vTaskDelay(pdMS_TO_TICKS(20));
     }
-    free(pcm_data);
+    BufferPlacement::free(pcm_data);
     vTaskDelete(NULL);
 }
 
 
-void AudioManager::start_streaming_playback() {
+uint32_t AudioManager::start_streaming_playback() {
     // 🔑 关键修复：先停止旧的流式播放，再启动新的
     stop_streaming_playback();
-    
-    // 🎯 采用千问项目的同步播放方法，不创建异步任务
-    ESP_LOGI(TAG, "🎵 启动同步流式音频播放模式");
+
+    ESP_LOGI(TAG, "🎵 启动流式音频播放（抖动缓冲 + 独立播放任务）");
+    jitter_buffer.clear();
+    jitter_buffer.resetStats();
+    is_draining = false;
+    discard_downlink = false;
+    downlink_resampler_reset = true;
+    reply_cache_restart = true;
     is_streaming = true;
-    
-    // 清空缓冲区
-    if (streaming_buffer) {
-        memset(streaming_buffer, 0, streaming_buffer_size);
+
+    if (playback_task_handle) {
+        xTaskNotifyGive(playback_task_handle);
     }
-    streaming_write_pos = 0;
-    streaming_read_pos = 0;
-    
-    ESP_LOGI(TAG, "✅ 流式播放已就绪，采用即时播放模式");
+    ESP_LOGI(TAG, "✅ 流式播放已就绪，预缓冲 %lu ms", (unsigned long)prebuffer_ms.load());
+    return stream_generation.load();
 }
 
-void AudioManager::stop_streaming_playback() {
-    if (is_streaming) {
-        ESP_LOGI(TAG, "📍 停止流式播放，等待任务退出...");
+void AudioManager::stop_streaming_playback(bool cancel_prompts) {
+    if (is_streaming || cancel_prompts) {
+        int64_t start = esp_timer_get_time();
         is_streaming = false;
-        
-        // 🔇 立即停止I2S以防止重复播放
-        bsp_audio_stop();
-        
-        // 🔇 关键修复（参考千问项目）：处理最后的尾巴数据
-        size_t remaining_data;
-        if (streaming_write_pos >= streaming_read_pos) {
-            remaining_data = streaming_write_pos - streaming_read_pos;
-        } else {
-            remaining_data = streaming_buffer_size - streaming_read_pos + streaming_write_pos;
-        }
-        
-        if (remaining_data > 0 && remaining_data <= 16384) { // 只处理小于16KB的尾巴数据
-            ESP_LOGI(TAG, "🎹 播放尾巴数据: %zu 字节", remaining_data);
-            // 分配临时缓冲区
-            uint8_t* remaining_buffer = (uint8_t*)malloc(remaining_data);
-            if (remaining_buffer) {
-                // 读取所有尾巴数据
-                if (streaming_write_pos >= streaming_read_pos) {
-                    memcpy(remaining_buffer, streaming_buffer + streaming_read_pos, remaining_data);
-                } else {
-                    size_t bytes_to_end = streaming_buffer_size - streaming_read_pos;
-                    memcpy(remaining_buffer, streaming_buffer + streaming_read_pos, bytes_to_end);
-                    memcpy(remaining_buffer + bytes_to_end, streaming_buffer, streaming_write_pos);
-                }
-                
-                // 🔇 关键：使用bsp_play_audio（普通版本，会自动停止I2S）
-                esp_err_t ret = bsp_play_audio(remaining_buffer, remaining_data);
-                if (ret == ESP_OK) {
-                    ESP_LOGI(TAG, "✅ 尾巴音频播放完成并自动停止I2S，解决重复问题");
-                } else {
-                    ESP_LOGW(TAG, "⚠️ 尾巴音频播放失败: %s", esp_err_to_name(ret));
-                    // 如果播放失败，手动停止I2S
-                    bsp_audio_stop();
-                }
-                free(remaining_buffer);
-            }
-        } else if (remaining_data > 16384) {
-            ESP_LOGW(TAG, "跳过过大的尾巴数据: %zu 字节", remaining_data);
-            // 手动停止I2S
-            bsp_audio_stop();
-        } else {
-            // 没有尾巴数据，直接停止I2S
-            bsp_audio_stop();
+        is_draining = false;
+        replaying = false;
+        if (stream_generation.fetch_add(1) + 1 == 0) {
+            stream_generation = 1;      // 0留给feed_local_audio()表示不检查
         }
-        
-        // 等待流式播放任务退出
-        vTaskDelay(pdMS_TO_TICKS(200));
-        
-        // 🧹 清空软件缓冲区
-        if (streaming_buffer) {
-            memset(streaming_buffer, 0, streaming_buffer_size);
-            streaming_write_pos = 0;
-            streaming_read_pos = 0;
-            ESP_LOGI(TAG, "✅ 流式播放缓冲区已清空");
+        if (reply_cache.isRecording()) {
+            reply_cache.invalidate();   // 没收完的回复不能重放
+        }
+
+        // 🧹 播放任务丢掉缓冲区里的回复（只移动读写位置）、清空DMA并淡出，提示音照常播放（除非cancel_prompts）
+        request_flush(cancel_prompts);
+        for (int i = 0; i < PLAYBACK_ABORT_WAIT_MS && (flush_playback_pending || !playback_idle); i++) {
+            vTaskDelay(1);
         }
-        
-        ESP_LOGI(TAG, "✅ 流式播放已完全停止，重复音频已消除");
+        ESP_LOGI(TAG, "✅ 流式播放已停止（%lu us）", (unsigned long)(esp_timer_get_time() - start));
     }
 }
 
 void AudioManager::feed_streaming_audio(const uint8_t* data, size_t len) {
+    feed_streaming_fragment(data, len, true, true);
+}
+
+void AudioManager::get_downlink_credit(uint32_t* received_bytes, uint32_t* free_bytes) const {
+    size_t free_samples = JitterBuffer::capacity() - jitter_buffer.available();
+    // ADPCM每个样本4位，每块另有4字节头；按4位折算会略微高估，留一个播放块的余量
+    size_t margin = PLAYBACK_CHUNK_MS * (sample_rate / 1000);
+    free_samples = free_samples > margin ? free_samples - margin : 0;
+    *received_bytes = downlink_rx_bytes.load();
+    switch (downlink_codec) {
+    case DownlinkCodec::ADPCM:
+        *free_bytes = free_samples / 2;
+        break;
+    case DownlinkCodec::F32_24K:
+        *free_bytes = free_samples * DownlinkResampler::INPUT_BYTES_PER_OUTPUT;
+        break;
+    default:
+        *free_bytes = free_samples * sizeof(int16_t);
+        break;
+    }
+}
+
+void AudioManager::feed_streaming_fragment(const uint8_t* data, size_t len, bool message_start, bool message_end) {
+    SCOPE_TIMER(FEED_STREAM);
+    downlink_rx_bytes += len;
+    PerfCounters::add(PerfCounter::DOWNLINK_BYTES, len);   // 无论是否丢弃都算已收到，否则服务器那边的额度会一直少
+    if (message_start) {
+        downlink_skip_message = false;
+        downlink_has_carry = false;
+        downlink_end_of_stream = false;
+        downlink_adpcm.reset();
+        if (downlink_resampler_reset.exchange(false)) {
+            downlink_resampler.reset();
+            jitter_buffer.resetConcealment();
+            playout_delay.startStream();
+        }
+    }
+
+    // 🧾 帧头在消息的第一个片段里：不管这条消息要不要播放都先过序号检查，位置才不会乱
+    uint32_t missing_samples = 0;
+    if (message_start && downlink_framing) {
+        AudioFraming::Header header;
+        if (!AudioFraming::parse(data, len, &header)) {
+            HOT_LOGW(TAG, "下行音频缺少帧头，丢弃: %zu 字节", len);
+            downlink_skip_message = true;
+            return;
+        }
+        data += AudioFraming::HEADER_BYTES;
+        len -= AudioFraming::HEADER_BYTES;
+        if (header.flags & AudioFraming::FLAG_START) {
+            jitter_buffer.resetConcealment();
+            playout_delay.startStream();
+        }
+        downlink_end_of_stream = (header.flags & AudioFraming::FLAG_END) != 0;
+        uint32_t lost_before = downlink_tracker.stats().lost_messages;
+        AudioFraming::Tracker::Verdict verdict = downlink_tracker.accept(header, &missing_samples);
+        if (verdict == AudioFraming::Tracker::Verdict::LATE) {
+            PerfCounters::add(PerfCounter::DOWNLINK_LATE_MESSAGES);
+            HOT_LOGW(TAG, "丢弃迟到的下行音频: seq=%u", (unsigned)header.seq);
+            downlink_skip_message = true;
+            return;
+        }
+        downlink_last_seq = 0x10000 | header.seq;
+        if (verdict == AudioFraming::Tracker::Verdict::GAP) {
+            PerfCounters::add(PerfCounter::DOWNLINK_LOST_MESSAGES, downlink_tracker.stats().lost_messages - lost_before);
+            HOT_LOGW(TAG, "下行音频缺口: seq=%u, 缺 %lu 样本", (unsigned)header.seq, (unsigned long)missing_samples);
+        }
+    }
+    // 丢弃时整条消息一起丢，中途恢复也不会从半条消息开始写
     if (!is_streaming) {
-        ESP_LOGW(TAG, "流式播放未启动，丢弃音频数据: %zu 字节", len);
+        if (message_start) {
+            HOT_LOGW(TAG, "流式播放未启动，丢弃音频数据: %zu 字节", len);
+        }
+        downlink_skip_message = true;
         return;
     }
+    if (discard_downlink) {
+        HOT_LOGD(TAG, "已打断，丢弃旧回复的音频: %zu 字节", len);
+        downlink_skip_message = true;
+        return;
+    }
+    if (replaying) {
+        // 播放任务正在从缓存往抖动缓冲区里填，不能再有第二个生产者
+        HOT_LOGD(TAG, "正在本地重放，丢弃下行音频: %zu 字节", len);
+        downlink_skip_message = true;
+        return;
+    }
+
+    if (message_start) {
+        // 完整的一条消息（没有分片）才做小包/静音过滤，片段的长度和内容说明不了什么
+        // 带帧头的消息已经确认是音频，不需要再猜
+        if (message_end && !downlink_framing && downlink_codec == DownlinkCodec::PCM && !accept_pcm_message(data, len)) {
+            return;
+        }
+        if (missing_samples > 0) {
+            conceal_downlink_gap(missing_samples);
+        }
+        // ⏳ 到达时间对照写入位置（丢了的消息已经补上，位置和媒体时钟一致）估计下行抖动
+        if (playout_delay.onArrival(esp_timer_get_time(), jitter_buffer.writePosition(), jitter_buffer.available())) {
+            prebuffer_base_ms = playout_delay.targetMs();
+            update_prebuffer_target();
+        }
+        // 🔁 一轮回复的第一条音频：从头录，ADPCM存原始块，其余存16kHz PCM
+        if (reply_cache_restart.exchange(false)) {
+            reply_cache.begin(downlink_codec == DownlinkCodec::ADPCM ? ReplyCache::Format::ADPCM
+                                                                     : ReplyCache::Format::PCM);
+        }
+    }
+    if (downlink_skip_message || len == 0) {
+        if (message_end && downlink_end_of_stream && !downlink_skip_message) {
+            finish_streaming_playback();    // 🏁 空负载的结束标记
+        }
+        return;
+    }
+
+    if (downlink_codec == DownlinkCodec::ADPCM) {
+        reply_cache.append(data, len);
+        if (message_end) {
+            reply_cache.endBlock();
+        }
+        // 一个ADPCM块可能跨多个片段，解码器在片段之间保留预测值和步长索引
+        while (len > 0) {
+            size_t consumed = 0;
+            size_t samples = downlink_adpcm.decode(data, len, downlink_decode_buffer, DOWNLINK_DECODE_SAMPLES, &consumed);
+            if (downlink_adpcm.isCorrupt()) {
+                HOT_LOGW(TAG, "跳过无效的ADPCM块");
+                reply_cache.dropBlock();
+                downlink_skip_message = true;
+                return;
+            }
+            write_jitter_samples(downlink_decode_buffer, samples);
+            data += consumed;
+            len -= consumed;
+        }
+    } else if (downlink_codec == DownlinkCodec::F32_24K) {
+        // 🎚️ 不足4字节的尾巴和滤波历史都留在重采样器里，消息边界不影响输出
+        while (len > 0) {
+            size_t consumed = 0;
+            size_t samples = downlink_resampler.process(data, len, downlink_decode_buffer, DOWNLINK_DECODE_SAMPLES, &consumed);
+            write_jitter_samples(downlink_decode_buffer, samples);
+            reply_cache.append((const uint8_t*)downlink_decode_buffer, samples * sizeof(int16_t));
+            data += consumed;
+            len -= consumed;
+        }
+    } else {
+        write_pcm_fragment(data, len);
+        if (message_end && downlink_has_carry) {
+            HOT_LOGW(TAG, "下行PCM消息长度为奇数，丢弃最后1字节");
+            downlink_has_carry = false;
+        }
+    }
+
+    if (message_end && downlink_end_of_stream) {
+        // 🏁 服务器标记了本段回复的最后一条：播完缓冲区里剩下的就停，不等tts_end
+        finish_streaming_playback();
+    } else if (playback_task_handle) {
+        xTaskNotifyGive(playback_task_handle);
+    }
+}
+
+bool AudioManager::feed_local_audio(const int16_t* samples, size_t count, uint32_t generation) {
+    while (count > 0) {
+        if (!is_streaming || discard_downlink || (generation != 0 && stream_generation.load() != generation)) {
+            return false;
+        }
+        size_t written = jitter_buffer.write(samples, count);
+        samples += written;
+        count -= written;
+        if (playback_task_handle) {
+            xTaskNotifyGive(playback_task_handle);
+        }
+        if (count > 0) {
+            vTaskDelay(pdMS_TO_TICKS(PLAYBACK_CHUNK_MS));   // 合成比播放快，等播放任务腾出空间
+        }
+    }
+    return true;
+}
 
+/**
+ * @brief 未分片的PCM消息过滤：太小或奇数长度的数据包不是有效音频
+ *
+ * 内容不在这里检查：安静的段落也是回复的一部分，静音段由播放任务的SilenceGate按帧能量处理。
+ */
+bool AudioManager::accept_pcm_message(const uint8_t* data, size_t len) {
     // 🔍 加强无效数据过滤：太小或奇数长度的数据包
     if (len < 128) {  // 提高到128字节，过滤更多小数据包
-        ESP_LOGD(TAG, "过滤小数据包: %zu 字节（可能是控制消息）", len);
-        return;
+        HOT_LOGD(TAG, "过滤小数据包: %zu 字节（可能是控制消息）", len);
+        return false;
     }
     
     // 验证数据长度是否为偶数（因16位PCM）
     if (len % 2 != 0) {
-        ESP_LOGW(TAG, "跳过奇数长度的数据包: %zu 字节（不是有效的PCM数据）", len);
-        return;
+        HOT_LOGW(TAG, "跳过奇数长度的数据包: %zu 字节（不是有效的PCM数据）", len);
+        return false;
     }
-    
-    // 🎯 新增：检查数据内容的有效性，过滤全零或全相同的数据
-    if (len >= sizeof(int16_t) * 4) { // 至少检查4个样本
-        int16_t* samples = (int16_t*)data;
-        size_t sample_count = len / sizeof(int16_t);
-        bool has_variation = false;
-        
-        // 检查是否有变化（相邻样本差值大于阈值）
-        for (size_t i = 1; i < sample_count && !has_variation; i++) {
-            if (abs(samples[i] - samples[i-1]) > 30) {
-                has_variation = true;
-            }
+    return true;
+}
+
+/**
+ * @brief 把一个PCM片段直接写进抖动缓冲区（不经过中间缓冲）
+ *
+ * 片段边界不保证落在样本边界上：上一片段多出的1字节和本片段第1字节拼成一个样本，
+ * 本片段多出的1字节留到下一片段，后面的样本就不会错位。
+ */
+void AudioManager::write_pcm_fragment(const uint8_t* data, size_t len) {
+    size_t requested = 0;
+    size_t written = 0;
+    if (downlink_has_carry) {
+        uint8_t sample[2] = { downlink_carry, data[0] };
+        requested++;
+        written += jitter_buffer.writeBytes(sample, 1);
+        reply_cache.append(sample, sizeof(sample));
+        downlink_has_carry = false;
+        data++;
+        len--;
+    }
+
+    size_t samples = len / sizeof(int16_t);
+    requested += samples;
+    written += jitter_buffer.writeBytes(data, samples);
+    reply_cache.append(data, samples * sizeof(int16_t));
+    if (len % 2 != 0) {
+        downlink_carry = data[len - 1];
+        downlink_has_carry = true;
+    }
+
+    HOT_LOGD(TAG, "接收到流式音频数据: %zu 样本", written);
+    if (written < requested) {
+        HOT_LOGW(TAG, "抖动缓冲区已满，丢弃 %zu 样本", requested - written);
+    }
+}
+
+/**
+ * @brief 🩹 下行缺了一段：在新消息之前补上同样的时长，后面的音频不会提前播放
+ *
+ * 重复最后10ms并在AUDIO_PLC_FADE_MS内淡出，其余补静音；缺口太长（重连、服务器侧丢弃）时
+ * 最多补AUDIO_PLC_MAX_MS，不为一段已经听不出来的空白占满缓冲区。
+ */
+void AudioManager::conceal_downlink_gap(uint32_t missing_samples) {
+    const size_t samples_per_ms = sample_rate / 1000;
+    size_t count = std::min<size_t>(missing_samples, AUDIO_PLC_MAX_MS * samples_per_ms);
+    size_t written = jitter_buffer.conceal(count, AUDIO_PLC_FADE_MS * samples_per_ms);
+    if (written < count) {
+        HOT_LOGW(TAG, "抖动缓冲区已满，丢包补偿少写 %zu 样本", count - written);
+    }
+}
+
+void AudioManager::write_jitter_samples(const int16_t* samples, size_t count) {
+    // 🌊 只写入抖动缓冲区，立即返回，不在WebSocket回调里阻塞I2S
+    size_t written = jitter_buffer.write(samples, count);
+    if (written < count) {
+        HOT_LOGW(TAG, "抖动缓冲区已满，丢弃 %zu 样本", count - written);
+    }
+}
+
+// 欠载时的淡出曲线（编译时算好，见dsp_tables.h）
+static constexpr size_t kUnderrunFadeSamples = 64;
+static constexpr auto kUnderrunFade = DspTables::fadeOutQ15<kUnderrunFadeSamples>();
+
+/**
+ * @brief 欠载补偿：已有数据末尾做短淡出（升余弦），其余填舒适噪声（还没测到底噪时是静音）
+ *
+ * 这样I2S时钟不中断，DMA也不会重复播放旧数据，听起来只是一个短暂停顿。
+ */
+static void conceal_underrun(SilenceGate& gate, int16_t* samples, size_t valid, size_t chunk_samples) {
+    const size_t fade = valid < kUnderrunFadeSamples ? valid : kUnderrunFadeSamples;
+    for (size_t i = 0; i < fade; i++) {
+        size_t idx = valid - fade + i;
+        int32_t gain = kUnderrunFade[i * kUnderrunFadeSamples / fade];
+        samples[idx] = (int16_t)(((int32_t)samples[idx] * gain) >> 15);
+    }
+    gate.fillComfortNoise(samples + valid, chunk_samples - valid);
+}
+
+/**
+ * @brief 按阻塞时间记进I2S写入的直方图
+ */
+static void note_write_latency(uint32_t blocked_us) {
+    PerfCounter bucket = blocked_us <= 5000     ? PerfCounter::I2S_WRITE_LE_5MS
+                         : blocked_us <= 25000  ? PerfCounter::I2S_WRITE_LE_25MS
+                         : blocked_us <= 100000 ? PerfCounter::I2S_WRITE_LE_100MS
+                                                : PerfCounter::I2S_WRITE_SLOW;
+    PerfCounters::add(bucket);
+}
+
+/**
+ * @brief 写入I2S，同时把同一份数据交给播放旁路（回声消除参考）
+ *
+ * 最多阻塞I2S_SINK_WRITE_TIMEOUT_MS，DMA卡住时不会把播放任务永远挂住；有打断请求时
+ * 最多I2S_SINK_WRITE_SLICE_MS就返回ESP_ERR_INVALID_STATE，由播放任务清空DMA。
+ * 连续I2S_SINK_STALL_MS没写进去一个字节时记一次卡死（每块最多一次）。
+ */
+esp_err_t AUDIO_HOT_IRAM AudioManager::write_playback(const int16_t* samples, size_t count) {
+    int64_t start = esp_timer_get_time();
+    const uint8_t* data = (const uint8_t*)samples;
+    size_t len = count * sizeof(int16_t);
+    size_t total = 0;
+    esp_err_t ret = ESP_OK;
+    uint32_t idle_ms = 0;
+    bool stalled = false;
+    Supervisor::enter(Watch::PLAYBACK);
+    // 按I2S_SINK_WRITE_SLICE_MS分几次等DMA腾出空间，中间有打断请求就丢掉剩下的部分
+    for (uint32_t waited_ms = 0; total < len; waited_ms += I2S_SINK_WRITE_SLICE_MS) {
+        size_t written = 0;
+        ret = bsp_audio_sink_write(data + total, len - total, &written, I2S_SINK_WRITE_SLICE_MS);
+        total += written;
+        if (ret != ESP_ERR_TIMEOUT) {
+            break;
         }
-        
-        if (!has_variation) {
-            ESP_LOGD(TAG, "过滤静音/无效数据包: %zu 字节（无音频变化）", len);
-            return;
+        idle_ms = written > 0 ? 0 : idle_ms + I2S_SINK_WRITE_SLICE_MS;
+        if (!stalled && idle_ms >= I2S_SINK_STALL_MS) {
+            stalled = true;
+            PerfCounters::add(PerfCounter::I2S_WRITE_STALLS);
+            FLIGHT_RECORD(I2S_STALL, len - total);
+            HOT_LOGW(TAG, "I2S写入卡住 %lu ms: %zu/%zu 字节", (unsigned long)idle_ms, total, len);
+        }
+        if (flush_playback_pending.load(std::memory_order_relaxed)) {
+            ret = ESP_ERR_INVALID_STATE;
+            break;
+        }
+        if (waited_ms + I2S_SINK_WRITE_SLICE_MS >= I2S_SINK_WRITE_TIMEOUT_MS) {
+            PerfCounters::add(PerfCounter::I2S_PARTIAL_WRITES);
+            HOT_LOGW(TAG, "I2S写入超时: %zu/%zu 字节", total, len);
+            break;
+        }
+    }
+    if (total > 0) {
+        Supervisor::beat(Watch::PLAYBACK);
+    }
+    uint32_t blocked_us = (uint32_t)(esp_timer_get_time() - start);
+    PerfCounters::add(PerfCounter::I2S_WRITES);
+    PerfCounters::add(PerfCounter::I2S_WRITE_US, blocked_us);
+    PerfCounters::noteMax(PerfGauge::I2S_WRITE_MAX_US, blocked_us);
+    note_write_latency(blocked_us);
+    // 只写进去一部分时，回声参考也只给实际播出的部分，剩下的丢掉
+    if (total > 0 && playback_tap) {
+        playback_tap(samples, total / sizeof(int16_t));
+    }
+    return ret;
+}
+
+/**
+ * @brief 从抖动缓冲区直接把count个样本写入I2S（零拷贝，回绕时分两段写）
+ *
+ * 漂移补偿打开时改为重采样后整块写入，调用方按playout_drift.inputNeeded()检查样本是否足够。
+ */
+esp_err_t AUDIO_HOT_IRAM AudioManager::play_from_jitter_buffer(size_t count) {
+    if (playout_drift.resampling()) {
+        const int16_t* resampled = playout_drift.process(jitter_buffer, count);
+        const int16_t* samples = silence_gate.process(resampled, count);
+        if (samples != resampled) {
+            PerfCounters::add(PerfCounter::COMFORT_NOISE_CHUNKS);
+        }
+        return output_chunk(samples, count);
+    }
+    while (count > 0) {
+        JitterBuffer::Ring::Span<const int16_t> span = jitter_buffer.readSpan();
+        size_t n = span.count < count ? span.count : count;
+        if (n == 0) {
+            return ESP_ERR_INVALID_SIZE;
+        }
+        // 🤫 静音段换成舒适噪声（有声时仍是环形缓冲区里的原数据，不拷贝）
+        const int16_t* samples = silence_gate.process(span.data, n);
+        if (samples != span.data) {
+            PerfCounters::add(PerfCounter::COMFORT_NOISE_CHUNKS);
+        }
+        esp_err_t ret = output_chunk(samples, n);
+        jitter_buffer.commitRead(n);
+        if (ret != ESP_OK) {
+            return ret;
         }
+        count -= n;
     }
+    return ESP_OK;
+}
 
-    ESP_LOGD(TAG, "接收到流式音频数据: %zu 字节", len);
+/**
+ * @brief 取出提示音接下来的最多count个样本，并推进播放位置
+ *
+ * PCM直接返回原地址（在Flash上时返回拷进staging的那一段）；ADPCM按块解码到clip->decoded，
+ * 凑够一个播放块为止。数据用完（或遇到坏块）时把pos推到末尾，让调用方结束这条提示音。
+ */
+size_t AudioManager::next_prompt_samples(PromptClip* clip, size_t count, const int16_t** out) {
+    size_t n = clip->count - clip->pos;
+    if (n > count) {
+        n = count;
+    }
+    if (clip->samples) {
+        *out = clip->samples + clip->pos;
+        clip->pos += n;
+        return n;
+    }
+    if (!clip->adpcm) {
+        size_t got = 0;
+        *out = (const int16_t*)clip->flash.peek(n * sizeof(int16_t), &got);
+        n = got / sizeof(int16_t);
+        clip->flash.consume(n * sizeof(int16_t));
+        clip->pos = n > 0 ? clip->pos + n : clip->count;
+        return n;
+    }
 
-    // 🔇 关键修复（采用千问项目方法）：直接同步播放，不使用异步任务
-    // 🔍 检查是否有足够的数据可以播放（累积25ms数据）
-    const size_t chunk_size = 25 * (sample_rate / 1000) * sizeof(int16_t); // 25ms数据
-    
-    // 直接播放音频数据块，不缓存
-    if (len >= chunk_size) {
-        // 大块数据，分块播放
-        size_t offset = 0;
-        while (offset + chunk_size <= len && is_streaming) {
-            esp_err_t ret = bsp_play_audio_stream(data + offset, chunk_size);
-            if (ret != ESP_OK) {
-                ESP_LOGW(TAG, "流式音频播放失败: %s", esp_err_to_name(ret));
-                break;
-            }
-            offset += chunk_size;
-            ESP_LOGD(TAG, "播放音频块: %zu 字节", chunk_size);
-        }
-        
-        // 处理剩余的小块数据
-        size_t remaining = len - offset;
-        if (remaining > 0 && is_streaming) {
-            // 将小块数据存入缓冲区等待下次合并
-            if (streaming_buffer && remaining < streaming_buffer_size) {
-                memcpy(streaming_buffer, data + offset, remaining);
-                streaming_write_pos = remaining;
-                streaming_read_pos = 0;
-                ESP_LOGD(TAG, "缓存小块数据: %zu 字节", remaining);
-            }
+    // 上一块多解出来的样本挪到开头，保持对齐
+    if (clip->decoded_pos > 0) {
+        clip->decoded_len -= clip->decoded_pos;
+        memmove(clip->decoded, clip->decoded + clip->decoded_pos, clip->decoded_len * sizeof(int16_t));
+        clip->decoded_pos = 0;
+    }
+    while (clip->decoded_len < n && clip->adpcm_pos < clip->adpcm_size) {
+        size_t len = clip->adpcm_size - clip->adpcm_pos;
+        if (len > clip->block_bytes) {
+            len = clip->block_bytes;
         }
-    } else {
-        // 小块数据，与缓冲区中的数据合并
-        if (streaming_buffer) {
-            size_t buffered_data = streaming_write_pos - streaming_read_pos;
-            if (buffered_data + len >= chunk_size) {
-                // 合并后足够播放
-                uint8_t* combined_buffer = (uint8_t*)malloc(buffered_data + len);
-                if (combined_buffer) {
-                    memcpy(combined_buffer, streaming_buffer + streaming_read_pos, buffered_data);
-                    memcpy(combined_buffer + buffered_data, data, len);
-                    
-                    // 播放合并后的数据
-                    esp_err_t ret = bsp_play_audio_stream(combined_buffer, buffered_data + len);
-                    if (ret == ESP_OK) {
-                        ESP_LOGD(TAG, "播放合并音频: %zu 字节", buffered_data + len);
-                        // 清空缓冲区
-                        streaming_write_pos = 0;
-                        streaming_read_pos = 0;
-                    } else {
-                        ESP_LOGW(TAG, "合并音频播放失败: %s", esp_err_to_name(ret));
-                    }
-                    free(combined_buffer);
-                }
-            } else {
-                // 数据仍不足，继续缓存
-                if (streaming_write_pos + len < streaming_buffer_size) {
-                    memcpy(streaming_buffer + streaming_write_pos, data, len);
-                    streaming_write_pos += len;
-                    ESP_LOGD(TAG, "继续缓存数据: %zu 字节，总计: %zu 字节", 
-                            len, streaming_write_pos - streaming_read_pos);
-                }
-            }
+        const uint8_t* block = clip->adpcm + clip->adpcm_pos;
+        if (clip->staging) {
+            block = clip->flash.peek(len, &len);
+            clip->flash.consume(len);
         }
+        size_t got = ImaAdpcmDecoder::decodeBlock(block, len, clip->decoded + clip->decoded_len,
+                                                  clip->decoded_capacity - clip->decoded_len);
+        clip->adpcm_pos += len;
+        if (got == 0) {
+            ESP_LOGW(TAG, "提示音ADPCM块损坏，提前结束");
+            clip->adpcm_pos = clip->adpcm_size;
+            break;
+        }
+        clip->decoded_len += got;
+    }
+
+    if (n > clip->decoded_len) {
+        n = clip->decoded_len;
+    }
+    clip->decoded_pos = n;
+    clip->pos += n;
+    if (n == 0 || (clip->adpcm_pos >= clip->adpcm_size && clip->decoded_pos >= clip->decoded_len)) {
+        clip->pos = clip->count;
+    }
+    *out = clip->decoded;
+    return n;
+}
+
+/**
+ * @brief 取出各声部排队的提示音，返回是否有提示音在播
+ */
+bool AudioManager::prompts_active() {
+    bool active = false;
+    for (int v = AudioMixer::VOICE_EARCON; v < AudioMixer::VOICE_COUNT; v++) {
+        if (!active_prompts[v]) {
+            xQueueReceive(prompt_queues[v], &active_prompts[v], 0);
+        }
+        active = active || active_prompts[v] != nullptr;
     }
+    if (!active) {
+        fade_prompts_pending.store(0, std::memory_order_relaxed);  // 要淡出的已经播完了，不留给下一条提示音
+    }
+    return active;
+}
+
+/**
+ * @brief 🎛️ 输出一块音频：回复语音（可以为空）和所有在播的提示音混音后写入I2S
+ *
+ * 只有回复语音且增益为1.0时直接写原数据（不拷贝），否则经过混音器。
+ * stream为nullptr时只输出提示音，没有提示音时输出静音，保持I2S时钟连续。
+ */
+esp_err_t AudioManager::output_chunk(const int16_t* stream, size_t count) {
+    bool prompting = prompts_active();
+    if (!prompting && stream && mixer.isPassthrough(AudioMixer::VOICE_TTS)) {
+        // 舒适噪声、补偿块和重采样结果也走这里，原地的只有指向抖动缓冲区的那部分
+        bool direct = jitter_buffer.contains(stream);
+        PerfCounters::add(direct ? PerfCounter::PLAY_DIRECT_BYTES : PerfCounter::PLAY_MIXED_BYTES,
+                          (uint32_t)(count * sizeof(int16_t)));
+        return write_playback(stream, count);
+    }
+    PerfCounters::add(PerfCounter::PLAY_MIXED_BYTES, (uint32_t)(count * sizeof(int16_t)));
+
+    // ⏳ 淡出的提示音不再压低回复语音：提示音淡出的同时回复语音升回来
+    uint8_t fade = fade_prompts_pending.exchange(0);
+    bool ducked = false;
+    for (int v = AudioMixer::VOICE_EARCON; v < AudioMixer::VOICE_COUNT; v++) {
+        if (!(fade & (1u << v))) {
+            ducked = ducked || (active_prompts[v] && !mixer.fading((AudioMixer::Voice)v));
+            continue;
+        }
+        PromptClip* clip = nullptr;
+        while (prompt_queues[v] && xQueueReceive(prompt_queues[v], &clip, 0) == pdTRUE) {
+            finish_prompt(clip, false);
+        }
+        if (active_prompts[v]) {
+            mixer.fadeOut((AudioMixer::Voice)v);
+        }
+    }
+
+    mixer.begin(count, ducked);
+    if (stream) {
+        mixer.add(AudioMixer::VOICE_TTS, stream, count);
+    }
+    for (int v = AudioMixer::VOICE_EARCON; v < AudioMixer::VOICE_COUNT; v++) {
+        PromptClip* clip = active_prompts[v];
+        if (!clip) {
+            continue;
+        }
+        const int16_t* samples = nullptr;
+        size_t n = next_prompt_samples(clip, count, &samples);
+        if (n > 0) {
+            mixer.add((AudioMixer::Voice)v, samples, n);
+        }
+    }
+
+    esp_err_t ret = write_playback(mixer.result(), count);
+
+    for (int v = AudioMixer::VOICE_EARCON; v < AudioMixer::VOICE_COUNT; v++) {
+        PromptClip* clip = active_prompts[v];
+        bool faded = mixer.faded((AudioMixer::Voice)v);
+        if (clip && (clip->pos >= clip->count || faded)) {
+            finish_prompt(clip, ret == ESP_OK && !faded);
+            active_prompts[v] = nullptr;
+            mixer.resetFade((AudioMixer::Voice)v);
+        }
+    }
+    return ret;
+}
+
+void AudioManager::set_prebuffer_ms(uint32_t ms) {
+    prebuffer_fixed_ms = ms;
+    update_prebuffer_target();
+}
+
+void AudioManager::set_prebuffer_boost_ms(uint32_t ms) {
+    if (prebuffer_boost_ms.exchange(ms) != ms) {
+        update_prebuffer_target();
+    }
+}
+
+void AudioManager::set_downlink_chunk_ms(uint32_t ms) {
+    if (downlink_chunk_ms.exchange(ms) != ms) {
+        update_prebuffer_target();
+    }
+}
+
+void AudioManager::update_prebuffer_target() {
+    uint32_t fixed = prebuffer_fixed_ms.load();
+    uint32_t ms = (fixed ? fixed : prebuffer_base_ms.load()) + prebuffer_boost_ms.load();
+    uint32_t floor = std::max<uint32_t>(PLAYBACK_PREBUFFER_MS, std::min<uint32_t>(downlink_chunk_ms.load(),
+                                                                                  PLAYBACK_PREBUFFER_MAX_MS));
+    ms = std::clamp<uint32_t>(ms, floor, PLAYBACK_PREBUFFER_MAX_MS);
+    uint32_t old = prebuffer_ms.exchange(ms);
+    if (old != ms) {
+        // 自适应时随下行消息调整，可能在WebSocket任务里频繁变化
+        HOT_LOGI(TAG, "⏳ 预缓冲目标 %lu -> %lu ms", (unsigned long)old, (unsigned long)ms);
+    }
+}
+
+void AudioManager::set_output_rate(uint32_t rate) {
+    if (rate == 0 || output_rate.exchange(rate) == rate) {
+        return;
+    }
+    ESP_LOGI(TAG, "🔁 请求播放采样率 %lu Hz", (unsigned long)rate);
+    if (playback_task_handle) {
+        xTaskNotifyGive(playback_task_handle);
+    }
+}
+
+void AudioManager::apply_output_rate(uint32_t* applied_rate) {
+    uint32_t rate = output_rate.load();
+    if (rate == *applied_rate) {
+        return;
+    }
+    // 失败时保持原来的格式，记下请求的值避免每块都重试
+    if (bsp_audio_set_format(rate, 16, 1) != ESP_OK) {
+        ESP_LOGW(TAG, "切换播放采样率 %lu Hz 失败，继续使用 %lu Hz",
+                 (unsigned long)rate, (unsigned long)bsp_get_play_sample_rate());
+    }
+    *applied_rate = rate;
 }
 
 void AudioManager::streaming_playback_task(void* arg) {
     AudioManager* self = (AudioManager*)arg;
-    // 🎯 减小播放块大小到25ms，提高音频流的实时性和稳定性
-    const size_t play_chunk_size = 25 * (self->sample_rate / 1000) * sizeof(int16_t); // 25ms 的数据
-    uint8_t* play_buffer = (uint8_t*)malloc(play_chunk_size);
-    
-    if (!play_buffer) {
+    const size_t samples_per_ms = self->sample_rate / 1000;
+    const size_t chunk_samples = PLAYBACK_CHUNK_MS * samples_per_ms;
+    const size_t stretch_samples = chunk_samples * PLAYBACK_STRETCH_PERCENT / 100;
+    // 只在欠载补偿和拉长静音时使用，正常播放直接从环形缓冲区写I2S
+    int16_t* conceal_buffer = (int16_t*)BufferPlacement::alloc("conceal_chunk", chunk_samples * sizeof(int16_t),
+                                                               Placement::DMA);
+
+    if (!conceal_buffer) {
         ESP_LOGE(TAG, "❌ 无法分配播放缓冲区");
+        self->playback_task_handle = nullptr;
         vTaskDelete(NULL);
         return;
     }
 
-    ESP_LOGI(TAG, "🎵 开始流式网络音频播放，块大小: %zu 字节 (25ms)", play_chunk_size);
-    
-    // 🔧 播放开始前先发送一小段静音，确保I2S通道稳定
-    const size_t init_silence_size = 320; // 10ms的静音数据 
-    uint8_t* silence_buffer = (uint8_t*)calloc(init_silence_size, 1);
-    if (silence_buffer) {
-        bsp_play_audio_stream(silence_buffer, init_silence_size);
-        free(silence_buffer);
-        ESP_LOGD(TAG, "✅ 已发送初始化静音数据");
-    }
+    ESP_LOGI(TAG, "🎵 流式播放任务已启动，块大小: %zu 样本 (%d ms)", chunk_samples, PLAYBACK_CHUNK_MS);
+
+    bool prebuffering = true;
+    bool i2s_running = false;
+    uint32_t applied_rate = self->sample_rate;
+
+    while (true) {
+        self->playback_active = i2s_running;
+        // 🔁 I2S空闲时切换采样率，DMA里没有要播的数据
+        if (!i2s_running) {
+            Supervisor::leave(Watch::PLAYBACK);
+            self->apply_output_rate(&applied_rate);
+        }
+
+        // ✋ 打断/停止：丢掉缓冲区里的旧回复（只移动读位置，不清内容），清空DMA并淡出
+        if (self->flush_playback_pending.exchange(false)) {
+            if (self->flush_prompts_pending.exchange(false)) {
+                self->cancel_prompts();
+            }
+            self->replaying = false;
+            self->jitter_buffer.clear();
+            if (i2s_running) {
+                bsp_audio_sink_abort(PLAYBACK_ABORT_FADE_MS);
+                i2s_running = false;
+            }
+            self->playback_active = false;
+            prebuffering = true;
+            self->is_draining = false;
+            self->silence_gate.reset();
+            self->playout_drift.startStream();
+            continue;
+        }
+
+        bool prompting = self->prompts_active();
 
-    while (self->is_streaming) {
-        // 🔍 首先检查是否仍在流式播放状态
         if (!self->is_streaming) {
-            ESP_LOGI(TAG, "📍 检测到停止信号，立即退出播放循环");
-            break;
+            // 🔔 没有回复时单独播放提示音
+            if (prompting) {
+                self->playback_idle = true;
+                self->output_chunk(nullptr, chunk_samples);
+                i2s_running = true;
+                continue;
+            }
+            if (i2s_running) {
+                bsp_audio_sink_drain(0);
+                i2s_running = false;
+            }
+            self->playback_active = false;
+            prebuffering = true;
+            self->playback_idle = true;
+            Supervisor::leave(Watch::PLAYBACK);
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            self->playback_idle = false;
+            continue;
         }
-        
-        size_t data_available;
-        if (self->streaming_write_pos >= self->streaming_read_pos) {
-            data_available = self->streaming_write_pos - self->streaming_read_pos;
-        } else {
-            data_available = self->streaming_buffer_size - self->streaming_read_pos + self->streaming_write_pos;
-        }
-
-        if (data_available >= play_chunk_size) {
-            // 🔧 确保读指针对齐到16位边界，防止数据错位
-            if (self->streaming_read_pos % 2 != 0) {
-                ESP_LOGW(TAG, "修复读指针对齐: %zu -> %zu", 
-                        self->streaming_read_pos, (self->streaming_read_pos + 1) % self->streaming_buffer_size);
-                self->streaming_read_pos = (self->streaming_read_pos + 1) % self->streaming_buffer_size;
-                // 重新计算可用数据
-                if (self->streaming_write_pos >= self->streaming_read_pos) {
-                    data_available = self->streaming_write_pos - self->streaming_read_pos;
+        self->playback_idle = false;
+
+        // 🔁 本地重放：从缓存往抖动缓冲区里填，后面和网络来的回复走同一条路
+        if (self->replaying) {
+            self->refill_from_reply_cache(conceal_buffer, chunk_samples);
+        }
+
+        // ⏳ 预缓冲：攒够目标时长再开始播放，吸收网络抖动
+        if (prebuffering) {
+            size_t prebuffer_samples = self->prebuffer_ms.load() * samples_per_ms;
+            if (self->jitter_buffer.available() < prebuffer_samples && !self->is_draining) {
+                if (i2s_running || prompting) {
+                    // I2S已在运行时继续输出（提示音或静音）保持时钟，防止DMA重复播放旧数据
+                    self->output_chunk(nullptr, chunk_samples);
+                    i2s_running = true;
                 } else {
-                    data_available = self->streaming_buffer_size - self->streaming_read_pos + self->streaming_write_pos;
-                }
-                if (data_available < play_chunk_size) {
-                    continue; // 对齐后数据不足，继续等待
+                    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(PLAYBACK_CHUNK_MS));
                 }
+                continue;
             }
-            
-            // 从环形缓冲区读取数据
-            if (self->streaming_read_pos + play_chunk_size <= self->streaming_buffer_size) {
-                memcpy(play_buffer, self->streaming_buffer + self->streaming_read_pos, play_chunk_size);
-                self->streaming_read_pos = (self->streaming_read_pos + play_chunk_size) % self->streaming_buffer_size;
-            } else {
-                size_t first_chunk_size = self->streaming_buffer_size - self->streaming_read_pos;
-                memcpy(play_buffer, self->streaming_buffer + self->streaming_read_pos, first_chunk_size);
-                size_t second_chunk_size = play_chunk_size - first_chunk_size;
-                memcpy(play_buffer + first_chunk_size, self->streaming_buffer, second_chunk_size);
-                self->streaming_read_pos = second_chunk_size;
+            prebuffering = false;
+            self->playout_drift.startStream();
+            // 回复的第一块写入前切换（此前I2S里只有静音或提示音）
+            self->apply_output_rate(&applied_rate);
+            HOT_LOGD(TAG, "预缓冲完成: %zu 样本", self->jitter_buffer.available());
+            if (self->playback_start_cb) {
+                self->playback_start_cb();
             }
-            
-            // 🎯 验证音频数据的有效性，过滤异常数据
-            bool is_valid_audio = false;
-            int16_t* samples = (int16_t*)play_buffer;
-            size_t sample_count = play_chunk_size / sizeof(int16_t);
-            
-            // 检查是否包含有效的音频信号（非全零或全相同）
-            for (size_t i = 1; i < sample_count && !is_valid_audio; i++) {
-                if (abs(samples[i] - samples[i-1]) > 50) { // 相邻样本差值大于50认为是有效信号
-                    is_valid_audio = true;
-                }
+        }
+
+        size_t available = self->jitter_buffer.available();
+        size_t target_samples = self->prebuffer_ms.load() * samples_per_ms;
+        // 🕰️ 按水位估计I2S和服务器的时钟偏差，接下来这块按补偿后的速度读（重放时水位是本地填的，不算）
+        if (!self->is_draining && !self->replaying) {
+            self->playout_drift.update(available, PLAYBACK_CHUNK_MS);
+        }
+        // 🐢 缓冲比目标少了一块以上、回复正处在静音段：先插几毫秒舒适噪声再少读一点，
+        // 句间停顿稍微变长，缓冲区慢慢涨回目标，不用等到欠载才补
+        size_t stretch = 0;
+        if (stretch_samples > 0 && self->silence_gate.isSilent() && !self->is_draining &&
+            available + chunk_samples < target_samples) {
+            stretch = stretch_samples;
+        }
+        size_t needed = self->playout_drift.resampling() ? self->playout_drift.inputNeeded(chunk_samples - stretch)
+                                                         : chunk_samples - stretch;
+        if (available >= needed) {
+            if (stretch > 0) {
+                self->silence_gate.fillComfortNoise(conceal_buffer, stretch);
+                self->output_chunk(conceal_buffer, stretch);
+                PerfCounters::add(PerfCounter::PLAYOUT_STRETCH_SAMPLES, stretch);
             }
-            
-            // 🔧 关键修复：确保音频数据16位对齐，防止数据错位导致杂音
-            if (is_valid_audio && self->is_streaming) { // 播放前再次检查状态
-                // 播放音频数据
-                esp_err_t ret = bsp_play_audio_stream(play_buffer, play_chunk_size);
-                if (ret != ESP_OK) {
-                    ESP_LOGW(TAG, "流式音频播放失败: %s", esp_err_to_name(ret));
-                    // 播放失败时重置I2S状态，防止累积错误
-                    bsp_audio_stop();
-                    vTaskDelay(pdMS_TO_TICKS(50));
-                } else {
-                    ESP_LOGD(TAG, "播放网络音频块: %zu 字节 (有效信号)", play_chunk_size);
+            esp_err_t ret = self->play_from_jitter_buffer(chunk_samples - stretch);
+            if (ret != ESP_OK && !self->flush_playback_pending) {
+                HOT_LOGW(TAG, "流式音频播放失败: %s", esp_err_to_name(ret));
+            }
+            i2s_running = true;
+            continue;
+        }
+
+        // 🎬 回复结束：播放尾巴数据后释放I2S，等待下一段回复
+        if (self->is_draining) {
+            // 尾巴按标称速度播完，不再为最后不到一块的数据重采样
+            self->playout_drift.startStream();
+            if (available > 0) {
+                self->play_from_jitter_buffer(available);
+            }
+            if (i2s_running || available > 0) {
+                // 等DMA里的尾巴播完再算播放结束（is_playing()在这之前一直为true），之后功放保持余温
+                if (bsp_audio_sink_drain(PLAYBACK_DRAIN_TIMEOUT_MS) != ESP_OK) {
+                    HOT_LOGW(TAG, "等待播放尾巴超时");
                 }
-            } else if (!self->is_streaming) {
-                ESP_LOGI(TAG, "📍 检测到停止信号，跳过播放");
-                break;
-            } else {
-                // 跳过无效音频数据，避免播放杂音
-                ESP_LOGD(TAG, "跳过无效音频块: %zu 字节 (静音/噪音)", play_chunk_size);
             }
-        } else if (data_available > 0) {
-            // 有数据但不足一个完整块，等待更多数据
-            ESP_LOGD(TAG, "等待更多网络音频数据，当前: %zu 字节，需要: %zu 字节", 
-                    data_available, play_chunk_size);
-            vTaskDelay(pdMS_TO_TICKS(3)); // 更短的等待时间提高响应性
-        } else {
-            // 没有数据，等待稍久
-            vTaskDelay(pdMS_TO_TICKS(8));
+            i2s_running = false;
+            prebuffering = true;
+            self->is_draining = false;
+            self->silence_gate.reset();
+
+            JitterBuffer::Stats stats = self->jitter_buffer.getStats();
+            ESP_LOGI(TAG, "📊 播放统计: 收到=%lu 样本, 丢弃=%lu 样本, 补偿=%lu 样本, 欠载=%lu 次, 最高水位=%zu 样本, 预缓冲目标=%lu ms, 时钟偏差=%ld ppm",
+                     (unsigned long)stats.samples_in, (unsigned long)stats.samples_dropped,
+                     (unsigned long)stats.samples_concealed, (unsigned long)stats.underruns, stats.max_fill,
+                     (unsigned long)self->prebuffer_ms.load(), (long)self->playout_drift.driftPpm());
+            // 抖动缓冲区自己的统计按段清零，清零前并入全局计数器
+            PerfCounters::add(PerfCounter::JITTER_DROPPED_SAMPLES, stats.samples_dropped);
+            PerfCounters::add(PerfCounter::JITTER_UNDERRUNS, stats.underruns);
+            if (stats.underruns > 0) {
+                FLIGHT_RECORD(JITTER_UNDERRUN, stats.underruns);
+            }
+            PerfCounters::add(PerfCounter::PLC_SAMPLES, stats.samples_concealed);
+            PerfCounters::noteMax(PerfGauge::JITTER_FILL, stats.max_fill);
+            self->jitter_buffer.resetStats();
+            continue;
         }
+
+        // 🩹 欠载：补偿这一块，然后重新预缓冲
+        size_t got = self->jitter_buffer.read(conceal_buffer, chunk_samples);
+        self->jitter_buffer.noteUnderrun();
+        conceal_underrun(self->silence_gate, conceal_buffer, got, chunk_samples);
+        self->output_chunk(conceal_buffer, chunk_samples);
+        i2s_running = true;
+        prebuffering = true;
+        HOT_LOGD(TAG, "播放欠载，已补偿 %zu 样本", chunk_samples - got);
     }
-    
-    ESP_LOGI(TAG, "结束流式网络音频播放");
-    
-    // 🔇 关键修复：播放结束时立即停止I2S，防止重复最后一个字
-    bsp_audio_stop();
-    ESP_LOGI(TAG, "✅ 已停止I2S输出，防止重复播放最后音频");
-    
-    // 播放剩余的音频数据（如果有）
-    size_t remaining_data;
-    if (self->streaming_write_pos >= self->streaming_read_pos) {
-        remaining_data = self->streaming_write_pos - self->streaming_read_pos;
-    } else {
-        remaining_data = self->streaming_buffer_size - self->streaming_read_pos + self->streaming_write_pos;
+}
+
+/**
+ * @brief 🔁 重放上一轮回复：开一段新的流式播放，由播放任务从缓存里取数据
+ */
+bool AudioManager::replay_last_reply() {
+    if (!reply_cache.ready()) {
+        return false;
     }
-    
-    if (remaining_data > 0 && remaining_data <= 16384) { // 只播放小于16KB的剩余数据
-        ESP_LOGI(TAG, "播放剩余的网络音频数据: %zu 字节", remaining_data);
-        uint8_t* remaining_buffer = (uint8_t*)malloc(remaining_data);
-        if (remaining_buffer) {
-            if (self->streaming_write_pos >= self->streaming_read_pos) {
-                memcpy(remaining_buffer, self->streaming_buffer + self->streaming_read_pos, remaining_data);
-            } else {
-                size_t bytes_to_end = self->streaming_buffer_size - self->streaming_read_pos;
-                memcpy(remaining_buffer, self->streaming_buffer + self->streaming_read_pos, bytes_to_end);
-                memcpy(remaining_buffer + bytes_to_end, self->streaming_buffer, self->streaming_write_pos);
+    start_streaming_playback();
+    if (!reply_cache.rewind()) {
+        return false;       // 刚好被作废了（新一轮的下行音频到了）
+    }
+    replay_adpcm.reset();
+    replay_block_left = 0;
+    ESP_LOGI(TAG, "🔁 本地重放上一轮回复（%lu ms）", (unsigned long)reply_cache.durationMs());
+    replaying = true;
+    if (playback_task_handle) {
+        xTaskNotifyGive(playback_task_handle);
+    }
+    return true;
+}
+
+/**
+ * @brief 从缓存里取数据填进抖动缓冲区（播放任务中调用），填到一半容量为止；取完了就按回复结束收尾
+ *
+ * PCM直接从缓存按字节写进环形缓冲区，ADPCM按块解码到decode_buffer再写入。
+ */
+void AudioManager::refill_from_reply_cache(int16_t* decode_buffer, size_t decode_samples) {
+    while (replaying && jitter_buffer.available() + decode_samples <= JitterBuffer::capacity() / 2) {
+        size_t written = 0;
+        if (reply_cache.format() == ReplyCache::Format::PCM) {
+            const uint8_t* data = nullptr;
+            size_t len = reply_cache.nextPcm(&data, decode_samples * sizeof(int16_t));
+            written = jitter_buffer.writeBytes(data, len / sizeof(int16_t));
+        } else {
+            if (replay_block_left == 0) {
+                replay_block_left = reply_cache.nextBlock(&replay_block);
+                replay_adpcm.reset();
             }
-            
-            esp_err_t ret = bsp_play_audio(remaining_buffer, remaining_data);
-            if (ret == ESP_OK) {
-                // 🔇 播放完剩余数据后立即停止I2S
-                bsp_audio_stop();
-                ESP_LOGI(TAG, "✅ 剩余音频播放完成并已停止I2S");
-            } else {
-                ESP_LOGW(TAG, "播放剩余音频失败: %s", esp_err_to_name(ret));
+            size_t consumed = 0;
+            size_t samples = replay_adpcm.decode(replay_block, replay_block_left, decode_buffer, decode_samples, &consumed);
+            replay_block += consumed;
+            replay_block_left -= consumed;
+            if (replay_adpcm.isCorrupt()) {
+                replay_block_left = 0;
+                continue;
             }
-            free(remaining_buffer);
+            written = jitter_buffer.write(decode_buffer, samples);
+        }
+        if (written == 0 && replay_block_left == 0) {
+            replaying = false;
+            finish_streaming_playback();
         }
-    } else if (remaining_data > 16384) {
-        ESP_LOGW(TAG, "跳过过大的剩余数据: %zu 字节", remaining_data);
     }
-    
-    // 🧹 清理任务结束前的状态
-    ESP_LOGI(TAG, "🧹 清理流式播放任务状态");
-    memset(self->streaming_buffer, 0, self->streaming_buffer_size);
-    self->streaming_write_pos = 0;
-    self->streaming_read_pos = 0;
-    
-    // 🎯 任务退出时停止I2S硬件，确保没有残留音频
-    bsp_audio_stop();
-    ESP_LOGI(TAG, "🔧 流式播放任务退出时已停止I2S硬件");
-
-    free(play_buffer);
-    ESP_LOGI(TAG, "✅ 流式播放任务已完全退出");
-    vTaskDelete(NULL);
 }
 
 void AudioManager::finish_streaming_playback() {
-    if (!is_streaming) {
-        return;
+    if (!is_streaming || is_draining) {
+        return;     // 下行结束标记已经开始收尾时，随后的tts_end不用再做一遍
     }
-    
-    ESP_LOGI(TAG, "🎬 结束流式音频播放（千问方法）");
-    
-    // 🔇 立即停止I2S以防止重复播放
-    bsp_audio_stop();
-    
-    // 🎬 处理最后的尾巴数据（不足一个块的部分）
-    size_t remaining_data = streaming_write_pos - streaming_read_pos;
-    
-    if (remaining_data > 0) {
-        ESP_LOGI(TAG, "🎹 播放尾巴数据: %zu 字节", remaining_data);
-        // 分配临时缓冲区
-        uint8_t* remaining_buffer = (uint8_t*)malloc(remaining_data);
-        if (remaining_buffer) {
-            // 读取所有尾巴数据
-            memcpy(remaining_buffer, streaming_buffer + streaming_read_pos, remaining_data);
-            
-            // 🔇 关键：使用bsp_play_audio（普通版本，会自动停止I2S）
-            esp_err_t ret = bsp_play_audio(remaining_buffer, remaining_data);
-            if (ret == ESP_OK) {
-                ESP_LOGI(TAG, "✅ 尾巴音频播放完成并自动停止I2S，解决重复问题");
-            } else {
-                ESP_LOGE(TAG, "❌ 尾巴音频播放失败: %s", esp_err_to_name(ret));
-                // 如果播放失败，手动停止I2S
-                bsp_audio_stop();
-            }
-            
-            free(remaining_buffer);
-        }
-    } else {
-        // 没有尾巴数据，直接停止I2S
-        bsp_audio_stop();
+
+    // 🎬 只做标记，由播放任务播完缓冲区里剩余的数据后停止I2S，不阻塞WebSocket回调
+    ESP_LOGI(TAG, "🎬 回复结束，播放剩余 %zu 样本后停止", jitter_buffer.available());
+    is_draining = true;
+    reply_cache.commit();
+    reply_cache_restart = true;
+    prompt_arena.endTurn();
+    if (playback_task_handle) {
+        xTaskNotifyGive(playback_task_handle);
     }
-    
-    is_streaming = false;
-    streaming_write_pos = 0;
-    streaming_read_pos = 0;
-    
-    ESP_LOGI(TAG, "✅ 流式播放已完全结束，重复音频问题已解决");
-}
\ No newline at end of file
+}
@@ -10,60 +10,351 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
 #include "freertos/task.h"
+#include "audio_frame_pool.h"
+#include "audio_codec.h"
+#include "jitter_buffer.h"
+#include "spsc_ring.h"
+#include "vad_gate.h"
+#include "preroll_buffer.h"
+#include "audio_mixer.h"
+#include "silence_gate.h"
+#include "downlink_resampler.h"
+#include "audio_framing.h"
+#include "playout_delay.h"
+#include "playout_drift.h"
+#include "prompt_store.h"
+#include "flash_stream.h"
+#include "session_arena.h"
+#include "reply_cache.h"
+#include "spectral_ns.h"
+#include <atomic>
+#include <functional>
 
-// 定义音频发送队列的结构体
+// 定义音频发送队列的结构体（携带帧池槽位索引，而不是malloc出来的指针）
+// len为0的条目是控制标记，此时slot表示标记类型（见AudioQueueMarker）
 struct AudioQueueItem {
-    uint8_t* data;
+    uint16_t slot;
+    uint16_t samples;       // 这一帧的16kHz样本数（帧头的samples字段）
+    uint32_t timestamp;     // 第一个样本在录音时钟上的位置，丢掉的帧也占位置
     size_t len;
+    UplinkCodec codec;      // 编码这一帧时的格式（断开期间缓存的帧重连后要按它判断能不能补发）
 };
 
-// 声明全局音频发送队列
+enum AudioQueueMarker : uint16_t {
+    AUDIO_MARKER_FLUSH = 0,         // 录音停止，立即发出已合并的数据
+    AUDIO_MARKER_SPEECH_END = 1,    // VAD判定一句话说完：冲刷后通知服务器结束本轮识别
+    AUDIO_MARKER_INTERRUPT = 2,     // 用户打断了正在播放的回复，通知服务器停止下发
+};
+
+// 声明全局音频发送队列和帧池
 extern QueueHandle_t s_audio_send_queue;
+extern AudioFramePool* s_audio_frame_pool;
 
 class AudioManager {
 public:
-    AudioManager(uint32_t sample_rate, uint32_t recording_duration_sec, uint32_t response_duration_sec);
+    // 播放数据旁路：每次写入I2S的PCM都会交给它（用作回声消除的参考信号）
+    using PlaybackTap = std::function<void(const int16_t* samples, size_t count)>;
+    // 回复开始出声：预缓冲完成、即将把第一块回复写入I2S时调用（在播放任务中执行）
+    using PlaybackStartCallback = std::function<void()>;
+
+    /**
+     * @param sample_rate 采样率
+     * @param capture_duration_sec 会话录音存档时长，0=不存档（不分配内存）
+     */
+    AudioManager(uint32_t sample_rate, uint32_t capture_duration_sec);
     ~AudioManager();
 
     // 录音控制
     void start_recording();
     void stop_recording();
 
+    // 麦克风音频入口（由音频前端的回调调用，经过VAD门控后拷贝，不阻塞）
+    // 空闲时写入会话预录缓冲区，start_recording()后先回放预录内容
+    void feed_capture_audio(const int16_t* samples, size_t count, bool is_speech);
+
+    // 唤醒词结束：清空会话预录，只上传唤醒词之后的音频（在音频前端的唤醒回调中调用）
+    // WAKE_VERIFY_ENABLE时留下唤醒词音频（AFE给出的wake_samples再往前WAKE_CLIP_LEAD_MS，没给时按WAKE_VERIFY_MS），
+    // 由take_wake_clip()决定上传还是丢掉；之后的WAKE_TRIM_TAIL_MS是唤醒词的尾音，和唤醒词一起处理
+    void mark_wake_word_end(uint32_t wake_samples);
+
+    // 🔘 按键说话（见push_to_talk.h）：打开后上传只看按键，不看VAD（start_recording()之前设置，会话内保持）
+    void set_push_to_talk(bool enable) { push_to_talk = enable; }
+    // 按键按下/松开（主任务中调用）：按下时会话预录只留最近PUSH_TO_TALK_PREROLL_MS，
+    // 松开时立即结束这句话（不等VAD拖尾）
+    void set_talk_button(bool held);
+
+    // 🔇 半双工（见HALF_DUPLEX_MODE）：I2S在播放时和停止后HALF_DUPLEX_TAIL_MS内不上传（音频前端启动前设置）
+    void set_half_duplex(bool enable) { half_duplex = enable; }
+
+    // 🔉 轻量谱减降噪（见spectral_ns.h、UPLINK_LIGHT_NS）：打开后录音任务在上传前对每帧降噪（任意任务调用，下一帧生效）
+    void set_light_ns(bool enable) { light_ns_wanted.store(enable, std::memory_order_relaxed); }
+
+    // 🌙 播放时钟偏差估计（ppm）：深度睡眠前存下，醒来在第一次播放之前seed，第一段流不用重新收敛
+    int32_t get_drift_ppm() const { return playout_drift.driftPpm(); }
+    void seed_drift_ppm(float ppm) { playout_drift.seedDriftPpm(ppm); }
+
+    /**
+     * @brief 🛡️ 会话开始前（start_recording()之前）取出唤醒词音频（主任务中调用）
+     *
+     * @param verify 服务器要复核：唤醒词音频不经过VAD门控、前面补静音到整20ms帧，作为本次录音最前面的样本上传；
+     *               false时回放预录时跳过它
+     * @param wake_end 复核时写入唤醒词连同尾音在本次录音里结束的位置（session_start的wake_end字段，
+     *                 服务器从这里开始转给豆包），不复核时写0（尾音在设备上跳过）
+     * @return 本次录音开头属于唤醒词的样本数（session_start的verify字段），0=这次不复核
+     *         （没有唤醒词音频、或者本地命令词等待期间已经被挤掉了一部分）
+     */
+    uint32_t take_wake_clip(bool verify, uint32_t* wake_end);
+
+    // 读取本次录音的存档（可在其他任务中调用，未开启存档时返回0）
+    size_t read_recorded_audio(int16_t* out, size_t max_samples);
+
+    // 构造时实际占用的堆内存（含各缓冲区和播放任务栈）
+    struct Footprint {
+        size_t internal_bytes;
+        size_t psram_bytes;
+    };
+    Footprint get_footprint() const { return footprint; }
+
+    // 提示音播放结束回调（在播放任务中执行）：completed=false表示被打断或被丢弃
+    using PromptDoneCallback = std::function<void(bool completed)>;
+
     // 播放控制
     esp_err_t play_audio(const uint8_t* data, size_t len);
+    // 异步播放一段PCM提示音：加入播放任务的混音队列后立即返回，不需要先启动流式播放。
+    // 数据直接从原地址（通常是Flash里的常量数组）读取，回调之前必须保持有效（需2字节对齐）
+    // voice为混音声部（提示音/闹铃），同一声部的提示音按顺序播放，不同声部叠加
+    esp_err_t play_audio_async(const uint8_t* data, size_t len, PromptDoneCallback callback = nullptr,
+                               AudioMixer::Voice voice = AudioMixer::VOICE_EARCON);
+    // 异步播放提示音分区里的一条提示音（ADPCM在播放任务中逐块解码，不整段解压）
+    esp_err_t play_prompt_async(const PromptAsset* asset, PromptDoneCallback callback = nullptr,
+                                AudioMixer::Voice voice = AudioMixer::VOICE_EARCON);
+    // 淡出一个声部上在播的提示音（MIXER_CROSSFADE_MS，回调completed=false），排队的一起丢掉；任意任务调用
+    void fade_out_prompts(AudioMixer::Voice voice);
+    AudioMixer& get_mixer() { return mixer; }
 
     // 流式播放控制
-    void start_streaming_playback();
-    void stop_streaming_playback();
-    void finish_streaming_playback();  // 新增：完成流式播放（千问方法）
-    void feed_streaming_audio(const uint8_t* data, size_t len);
+    uint32_t start_streaming_playback();    // 返回这次播放的get_stream_generation()
+    void stop_streaming_playback(bool cancel_prompts = false);   // cancel_prompts=同时取消提示音（误唤醒）
+    void finish_streaming_playback();  // 回复结束：播完缓冲区剩余数据后停止I2S（不阻塞）
+    void feed_streaming_audio(const uint8_t* data, size_t len);   // 一条完整的下行消息
+    // 下行消息的一个片段（超过WebSocket接收缓冲区的帧会分多次到达，在WebSocket事件任务中调用）
+    void feed_streaming_fragment(const uint8_t* data, size_t len, bool message_start, bool message_end);
+    // 本地生成的回复（离线语音合成、📻 长音频），缓冲区满时阻塞等待播放；流式播放被停止或打断时返回false
+    // generation非0时还要求流式播放还是get_stream_generation()当时的那一次（中间被别的播放顶掉也返回false）
+    bool feed_local_audio(const int16_t* samples, size_t count, uint32_t generation = 0);
+    // 每次停止流式播放加一（从1开始），本地音频源用它判断自己开的那次播放是不是还在
+    uint32_t get_stream_generation() const { return stream_generation.load(); }
+    // 抖动缓冲区里还没播的样本数
+    size_t get_unplayed_samples() const { return jitter_buffer.available(); }
+    // 🔁 "再说一遍"（见reply_cache.h）：上一轮回复完整缓存着时在本地重放并返回true，没有时返回false（主任务中调用）
+    bool replay_last_reply();
+    bool has_cached_reply() const { return reply_cache.ready(); }
+    // 新的一轮开始，上一轮的回复不能再重放（任意任务）
+    void invalidate_reply_cache() { reply_cache.invalidate(); }
+    void set_playback_tap(PlaybackTap tap) { playback_tap = tap; }
+    void set_playback_start_callback(PlaybackStartCallback cb) { playback_start_cb = cb; }
+
+    // 预缓冲目标默认按测得的下行到达抖动自适应（PlayoutDelay），限制在PLAYBACK_PREBUFFER_MS~PLAYBACK_PREBUFFER_MAX_MS，
+    // 下次预缓冲时生效；set_prebuffer_ms()固定一个目标（调试和基准测试用），0=恢复自适应
+    void set_prebuffer_ms(uint32_t ms);
+    // 链路变差时额外加的预缓冲（WiFi信号监测设置，叠加在目标上，不等抖动真的变大）
+    void set_prebuffer_boost_ms(uint32_t ms);
+    // ⚡ 服务器hello里协商的下行稳定块时长：数据一块一块到，预缓冲不能少于一块（0=服务器没给）
+    void set_downlink_chunk_ms(uint32_t ms);
+    uint32_t get_prebuffer_ms() const { return prebuffer_ms.load(); }
+
+    // 🔁 播放输出采样率：提示音或回复按原始采样率播放时设置，由播放任务在I2S空闲或新回复开始前切换
+    // （bsp_audio_set_format，不重建通道）；缓冲区的时长仍按构造时的sample_rate折算
+    void set_output_rate(uint32_t rate);
+    uint32_t get_output_rate() const { return output_rate.load(); }
+
+    // 📬 下行流控：已收到的下行字节数（按线上字节计，丢弃的也算）和抖动缓冲区按当前下行编码折算的剩余字节数
+    // 服务器只在 已发送 < 已收到 + 剩余 时继续发送
+    void get_downlink_credit(uint32_t* received_bytes, uint32_t* free_bytes) const;
+    void reset_downlink_credit() { downlink_rx_bytes = 0; }   // 新连接建立时调用，与服务器的计数同时从0开始
+
+    // 服务器确认打断后调用，恢复接收下行音频
+    void resume_downlink();
+
+    // 🩺 播放卡住时由子系统看门狗调用（见supervisor.h）：重建I2S发送通道并清空排队的回复
+    esp_err_t recover_playback();
+
+    // 💬 对话状态（主循环轮询）：VAD门控打开（用户在说话）；回复还没播完（含提示音和tts_end后的剩余数据）
+    bool is_user_speaking() const { return user_speaking.load(); }
+    bool is_playing() const { return playback_active || is_draining; }
+
+    // 上行编码格式（由服务器hello消息确认后切换）
+    void set_uplink_codec(UplinkCodec codec);
+    UplinkCodec get_uplink_codec() const { return uplink_codec; }
+    // Opus目标码率（上行码率自适应从发送任务调用，录音任务编码下一帧前应用）
+    void set_uplink_bitrate(uint32_t bitrate) { uplink_bitrate_request = bitrate; }
+
+    // 下行编码格式（服务器hello消息确认后切换）
+    void set_downlink_codec(DownlinkCodec codec);
+
+    // 🧾 下行音频消息带帧头（服务器hello确认后打开，断开时关闭），缺口做丢包补偿
+    void set_audio_framing(bool enable);
+    // 🔌 回复播到了哪里（断开时、stop_streaming_playback之前调用）：最后收到的下行消息seq和缓冲区里还没播的样本数，
+    // 没在播回复或没有帧头时返回false
+    bool get_downlink_resume_point(uint16_t* seq, uint32_t* unplayed) const;
 
     // 静态任务函数
     static void audio_record_task(void *arg);
 
 private:
     static const char* TAG;
-    static const size_t STREAMING_BUFFER_SIZE = 64 * 1024; // 64KB 增大缓冲区防止溢出
+    using CaptureRing = SpscRing<int16_t, CAPTURE_RING_SAMPLES>;   // 音频前端 → 录音任务，能容纳整段预录回放
+    static const size_t DOWNLINK_DECODE_SAMPLES = 4096;    // ADPCM解码缓冲区（256ms）
+    static const int PROMPT_QUEUE_DEPTH = 4;               // 最多排队的提示音数量
+
+    // 排队中的提示音，只有播放任务会修改pos和解码状态
+    struct PromptClip {
+        const int16_t* samples;     // PCM：直接从原地址读取；ADPCM：为空
+        size_t count;               // 总样本数
+        size_t pos;                 // 已输出的样本数
+        PromptDoneCallback done;
+
+        // ADPCM：每块输出前解码，多解出来的样本留到下一块
+        const uint8_t* adpcm;
+        size_t adpcm_size;
+        size_t adpcm_pos;
+        uint16_t block_bytes;
+        int16_t* decoded;           // 16字节对齐，容量为一个播放块+一个ADPCM块
+        size_t decoded_capacity;
+        size_t decoded_len;
+        size_t decoded_pos;
+
+        // 数据在Flash上时按块拷进staging再读（PCM和ADPCM都是），为空时直接读原地址
+        FlashStream flash;
+        uint8_t* staging;
+    };
+
+    // 🧩 上行流水线的各级（见audio_pipeline.h），在audio_manager.cc中定义
+    struct LightNsStage;
+    struct ArenaTapStage;
+    struct UplinkSinkStage;
+
+    bool accept_pcm_message(const uint8_t* data, size_t len);
+    void write_pcm_fragment(const uint8_t* data, size_t len);
+    void write_jitter_samples(const int16_t* samples, size_t count);
+    void queue_uplink_frame(const int16_t* pcm, size_t pcm_bytes, uint32_t timestamp);
+    void conceal_downlink_gap(uint32_t missing_samples);
+    void update_prebuffer_target();
+    void queue_marker(AudioQueueMarker marker);
+    void append_capture_arena(const int16_t* samples, size_t count);
+    void gate_capture_audio(const int16_t* samples, size_t count, bool is_speech);
+    bool mute_for_playback();
+    void replay_session_preroll();
+    void barge_in();
+    void request_flush(bool cancel_prompts);
+    esp_err_t write_playback(const int16_t* samples, size_t count);
+    esp_err_t play_from_jitter_buffer(size_t count);
+    void refill_from_reply_cache(int16_t* decode_buffer, size_t decode_samples);
+    esp_err_t output_chunk(const int16_t* stream, size_t count);
+    void apply_output_rate(uint32_t* applied_rate);
+    esp_err_t queue_prompt(PromptClip* clip, AudioMixer::Voice voice);
+    void stage_prompt(PromptClip* clip, const uint8_t* data, size_t size, size_t max_peek);
+    void release_prompt(PromptClip* clip);
+    size_t next_prompt_samples(PromptClip* clip, size_t count, const int16_t** out);
+    bool prompts_active();
+    void finish_prompt(PromptClip* clip, bool completed);
+    void cancel_prompts();
 
     uint32_t sample_rate;
-    uint32_t recording_duration_sec;
-    uint32_t response_duration_sec;
-
-    int16_t* recording_buffer;
-    size_t recording_buffer_size;
-    size_t recording_length;
-    bool is_recording;
-
-    int16_t* response_buffer;
-    size_t response_buffer_size;
-    size_t response_length;
-    bool response_played;
-
-    bool is_streaming;
-    uint8_t* streaming_buffer;
-    size_t streaming_buffer_size;
-    volatile size_t streaming_write_pos;
-    volatile size_t streaming_read_pos;
+    Footprint footprint;
+
+    // 会话录音存档：录音任务追加写入，read_recorded_audio()顺序读出，start_recording()时清空
+    int16_t* capture_arena;
+    size_t capture_arena_capacity;
+    std::atomic<size_t> capture_arena_length;
+    size_t capture_arena_read_pos;
+    std::atomic<bool> is_recording;     // 主任务写入，音频前端回调和录音任务读取（不同核心）
+    CaptureRing capture_ring;       // 音频前端按AFE块大小写入，录音任务按20ms帧读取
+    TaskHandle_t record_task_handle;
+    VadGate vad_gate;               // 只在音频前端的回调中使用
+    std::atomic<bool> speech_end_pending;
+    std::atomic<bool> user_speaking;    // 音频前端的回调写入，主任务读取
+    PrerollBuffer session_preroll;  // 只在音频前端的回调中使用
+    std::atomic<bool> preroll_replay_pending;
+    std::atomic<bool> push_to_talk;
+    std::atomic<bool> talk_held;
+    std::atomic<bool> talk_press_pending;       // 按下：音频前端的回调裁掉会话预录里更早的音频
+    std::atomic<bool> talk_release_pending;     // 松开：音频前端的回调关掉VAD门控
+    // 🛡️ 唤醒词音频：唤醒回调记下长度和当时预录的丢弃计数，take_wake_clip()决定回放时怎么处理
+    std::atomic<uint32_t> wake_clip_samples;    // 0=没有
+    std::atomic<uint32_t> wake_clip_dropped;
+    std::atomic<uint32_t> replay_clip_samples;  // 回放预录时开头属于唤醒词的样本数
+    std::atomic<uint32_t> replay_clip_padded;   // 直接写进采集缓冲区的总长（含补的静音），0=跳过
+    std::atomic<uint32_t> wake_tail_samples;    // 唤醒词之后的尾音，0=没有（按键触发）
+    std::atomic<uint32_t> replay_tail_samples;
+    // 录音开头还没处理完的唤醒词和尾音（回放预录时设置，尾音可能延续到实时音频里；只在音频前端的回调中使用）
+    size_t wake_head_left;
+    bool wake_head_upload;                      // true=不经过门控直接进采集缓冲区（复核），false=跳过
+    size_t consume_wake_head(const int16_t* samples, size_t count);
+
+    std::atomic<bool> is_streaming;
+    std::atomic<bool> is_draining;      // 收到tts_end，播完缓冲区后停止I2S
+    std::atomic<bool> playback_idle;    // 播放任务没有在处理流式回复（可能仍在播提示音）
+    std::atomic<uint32_t> stream_generation;
+    JitterBuffer jitter_buffer;     // WebSocket回调写入，播放任务读取
+    TaskHandle_t playback_task_handle;
+    QueueHandle_t prompt_queues[AudioMixer::VOICE_COUNT];   // PromptClip*，任意任务写入，播放任务读取（TTS不用）
+    StaticQueue_t prompt_queue_structs[AudioMixer::VOICE_COUNT];
+    PromptClip* prompt_queue_storage[AudioMixer::VOICE_COUNT][PROMPT_QUEUE_DEPTH];
+    PromptClip* active_prompts[AudioMixer::VOICE_COUNT];    // 只在播放任务中访问
+    AudioMixer mixer;               // 只在播放任务中使用
+    SilenceGate silence_gate;       // 只在播放任务中使用
+    PlayoutDrift playout_drift;     // 只在播放任务中使用
+    SessionArena prompt_arena;      // PromptClip和ADPCM解码缓冲区，每轮对话复用
+    PlaybackTap playback_tap;
+    PlaybackStartCallback playback_start_cb;
+    std::atomic<bool> playback_active;  // I2S正在输出回复（或提示音）
+    std::atomic<bool> half_duplex;
+    bool duplex_muted;              // 只在采集回调中访问
+    int64_t duplex_hold_until_us;   // 只在采集回调中访问：播放停止后到这个时间才恢复上传
+    std::atomic<bool> flush_playback_pending;   // 打断或停止：播放任务尽快清空缓冲区和DMA
+    std::atomic<bool> flush_prompts_pending;    // 这次清空连提示音一起取消（打断时）
+    std::atomic<uint8_t> fade_prompts_pending;  // 按声部的位：播放任务下一块开始淡出这个声部
+    std::atomic<uint32_t> prebuffer_ms;     // 预缓冲目标，WebSocket任务写入，播放任务读取
+    std::atomic<uint32_t> prebuffer_base_ms;    // 按下行到达抖动算出的部分
+    std::atomic<uint32_t> prebuffer_boost_ms;   // WiFi链路变差时额外加的部分
+    std::atomic<uint32_t> prebuffer_fixed_ms;   // set_prebuffer_ms()固定的目标，0=自适应
+    std::atomic<uint32_t> downlink_chunk_ms;    // 服务器的下行块时长，预缓冲目标的下限之一
+    std::atomic<uint32_t> output_rate;      // 请求的I2S输出采样率，任意任务写入，播放任务应用
+    std::atomic<bool> discard_downlink; // 已打断，丢弃旧回复剩余的下行音频直到服务器确认
+
+    std::atomic<bool> light_ns_wanted;
+    SpectralNoiseSuppressor light_ns;   // 只在录音任务中使用（第一次用到时初始化）
+
+    std::atomic<UplinkCodec> uplink_codec;
+    OpusUplinkEncoder opus_encoder;
+    std::atomic<uint32_t> uplink_bitrate_request;   // 0=没有待应用的
+
+    std::atomic<DownlinkCodec> downlink_codec;
+    int16_t* downlink_decode_buffer;
+
+    // 以下只在WebSocket事件任务中访问
+    ImaAdpcmStreamDecoder downlink_adpcm;
+    DownlinkResampler downlink_resampler;   // 滤波状态跨消息保留
+    std::atomic<bool> downlink_resampler_reset; // 新回复开始，下一条消息前清空滤波历史
+    bool downlink_skip_message;     // 当前消息已判定无效，丢弃剩余片段
+    std::atomic<bool> downlink_framing; // 每条下行音频消息开头是AudioFraming帧头
+    AudioFraming::Tracker downlink_tracker;
+    std::atomic<uint32_t> downlink_last_seq;    // 最后收到的下行消息seq，位16=有效（WebSocket任务写入，事件任务读取）
+    PlayoutDelay playout_delay;     // 按下行消息的到达时间估计预缓冲目标
+    bool downlink_has_carry;        // 上一片段末尾多出1字节，等下一片段拼成完整样本
+    bool downlink_end_of_stream;    // 当前消息带FLAG_END，最后一个片段写完后开始收尾
+    uint8_t downlink_carry;
+    std::atomic<uint32_t> downlink_rx_bytes;    // WebSocket任务写入，主任务读取
+
+    // 🔁 上一轮回复的缓存：WebSocket事件任务录制，播放任务重放（重放期间下行音频一律丢弃）
+    ReplyCache reply_cache;
+    std::atomic<bool> reply_cache_restart;  // 下一条下行音频是新一轮回复的开头，从头录
+    std::atomic<bool> replaying;            // 播放任务正在从缓存往抖动缓冲区里填
+    // 以下只在播放任务中访问
+    ImaAdpcmStreamDecoder replay_adpcm;
+    const uint8_t* replay_block;
+    size_t replay_block_left;
 
     static void streaming_playback_task(void* arg);
 };
@@ -0,0 +1,185 @@
+/**
+ * @file audio_mixer.cc
+ * @brief 🎛️ 播放混音器实现
+ */
+
+#include "audio_mixer.h"
+#include <string.h>
+#include "esp_log.h"
+#include "buffer_placement.h"
+#include "dsps_add.h"
+#include "dsps_mul.h"
+#include "project_config.h"
+
+const char* AudioMixer::TAG = "AudioMixer";
+
+static inline size_t round_up8(size_t n) {
+    return (n + 7) & ~(size_t)7;
+}
+
+AudioMixer::AudioMixer(size_t max_samples)
+    : capacity_(round_up8(max_samples))
+    , count_(0)
+    , accum_(nullptr)
+    , scratch_(nullptr)
+    , gain_vec_{}
+    , gain_vec_value_{}
+    , duck_gain_(toQ15(MIXER_DUCK_GAIN))
+    , ramp_step_(UNITY)
+    , fade_step_(UNITY)
+{
+    // vld.128要求16字节对齐（BufferPlacement保证）；混音结果直接交给I2S写入
+    const size_t bytes = capacity_ * sizeof(int16_t);
+    accum_ = (int16_t*)BufferPlacement::alloc("mixer_out", bytes, Placement::DMA);
+    scratch_ = (int16_t*)BufferPlacement::alloc("mixer_scratch", bytes, Placement::INTERNAL);
+    bool ok = accum_ && scratch_;
+    for (int v = 0; v < VOICE_COUNT; v++) {
+        gain_vec_[v] = (int16_t*)BufferPlacement::alloc("mixer_gain", bytes, Placement::INTERNAL);
+        ok = ok && gain_vec_[v];
+        gain_vec_value_[v] = -1;
+    }
+    if (!ok) {
+        ESP_LOGE(TAG, "❌ 混音缓冲区分配失败");
+        BufferPlacement::free(accum_);
+        accum_ = nullptr;
+    }
+
+    target_gain_[VOICE_TTS] = toQ15(MIXER_TTS_GAIN);
+    target_gain_[VOICE_EARCON] = toQ15(MIXER_EARCON_GAIN);
+    target_gain_[VOICE_ALARM] = toQ15(MIXER_ALARM_GAIN);
+    for (int v = 0; v < VOICE_COUNT; v++) {
+        current_gain_[v] = target_gain_[v];
+        fade_[v] = UNITY;
+        fading_[v] = false;
+    }
+
+    // 每块推进一步，MIXER_DUCK_RAMP_MS内从1.0渐变到0
+    int steps = MIXER_DUCK_RAMP_MS / PLAYBACK_CHUNK_MS;
+    if (steps > 1) {
+        ramp_step_ = UNITY / steps;
+    }
+    steps = MIXER_CROSSFADE_MS / PLAYBACK_CHUNK_MS;
+    if (steps > 1) {
+        fade_step_ = UNITY / steps;
+    }
+}
+
+AudioMixer::~AudioMixer() {
+    BufferPlacement::free(accum_);
+    BufferPlacement::free(scratch_);
+    for (int v = 0; v < VOICE_COUNT; v++) {
+        BufferPlacement::free(gain_vec_[v]);
+    }
+}
+
+int32_t AudioMixer::toQ15(float gain) {
+    if (!(gain > 0.0f)) {
+        return 0;
+    }
+    if (gain >= 1.0f) {
+        return UNITY;
+    }
+    return (int32_t)(gain * 32768.0f + 0.5f);
+}
+
+void AudioMixer::setGain(Voice voice, float gain) {
+    if (voice < VOICE_COUNT) {
+        target_gain_[voice] = toQ15(gain);
+    }
+}
+
+void AudioMixer::setDuckGain(float gain) {
+    duck_gain_ = toQ15(gain);
+}
+
+void AudioMixer::fillGain(Voice voice, int32_t gain) {
+    int16_t* vec = gain_vec_[voice];
+    for (size_t i = 0; i < capacity_; i++) {
+        vec[i] = (int16_t)gain;
+    }
+    gain_vec_value_[voice] = gain;
+}
+
+bool AudioMixer::isPassthrough(Voice voice) const {
+    return current_gain_[voice] == UNITY && target_gain_[voice].load() == UNITY && fade_[voice] == UNITY;
+}
+
+void AudioMixer::fadeOut(Voice voice) {
+    if (voice < VOICE_COUNT) {
+        fading_[voice] = true;
+    }
+}
+
+void AudioMixer::resetFade(Voice voice) {
+    if (voice < VOICE_COUNT) {
+        fading_[voice] = false;
+        fade_[voice] = UNITY;
+    }
+}
+
+void AudioMixer::begin(size_t count, bool ducked) {
+    if (!isValid()) {
+        return;
+    }
+    count_ = count < capacity_ ? count : capacity_;
+    memset(accum_, 0, round_up8(count_) * sizeof(int16_t));
+
+    for (int v = 0; v < VOICE_COUNT; v++) {
+        int32_t want = target_gain_[v];
+        if (v == VOICE_TTS && ducked) {
+            int32_t duck = duck_gain_;
+            if (duck < want) {
+                want = duck;
+            }
+        }
+        int32_t cur = current_gain_[v];
+        if (cur < want) {
+            cur = (want - cur > ramp_step_) ? cur + ramp_step_ : want;
+        } else if (cur > want) {
+            cur = (cur - want > ramp_step_) ? cur - ramp_step_ : want;
+        }
+        current_gain_[v] = cur;
+        if (fading_[v]) {
+            fade_[v] = fade_[v] > fade_step_ ? fade_[v] - fade_step_ : 0;
+        }
+    }
+}
+
+void AudioMixer::accumulate(Voice voice, const int16_t* src) {
+    const size_t padded = round_up8(count_);
+    int32_t gain = effectiveGain(voice);
+    if (gain <= 0) {
+        return;
+    }
+    if (gain < UNITY) {
+        if (gain_vec_value_[voice] != gain) {
+            fillGain(voice, gain);
+        }
+        dsps_mul_s16(src, gain_vec_[voice], scratch_, (int)padded, 1, 1, 1, 15);
+        src = scratch_;
+    }
+    // aes3版本在对齐且长度为8的倍数时使用饱和加法
+    dsps_add_s16(accum_, src, accum_, (int)padded, 1, 1, 1, 0);
+}
+
+void AudioMixer::add(Voice voice, const int16_t* samples, size_t count) {
+    if (!isValid() || voice >= VOICE_COUNT || count == 0) {
+        return;
+    }
+    if (count > count_) {
+        count = count_;
+    }
+
+    // 一整块、已对齐：直接从源数据累加，不拷贝
+    if (count == count_ && ((uintptr_t)samples & 15) == 0 && (count_ & 7) == 0) {
+        accumulate(voice, samples);
+        return;
+    }
+
+    const size_t padded = round_up8(count_);
+    memcpy(scratch_, samples, count * sizeof(int16_t));
+    if (count < padded) {
+        memset(scratch_ + count, 0, (padded - count) * sizeof(int16_t));
+    }
+    accumulate(voice, scratch_);
+}
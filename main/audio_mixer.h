@@ -0,0 +1,116 @@
+/**
+ * @file audio_mixer.h
+ * @brief 🎛️ 播放混音器 - 回复语音、提示音、闹铃叠加成一路I2S输出
+ *
+ * 每个声部有自己的增益（Q15），提示音或闹铃在播时回复语音自动压低（ducking），
+ * 增益按块渐变，避免突然跳变带来的咔哒声。累加使用esp-dsp的S3向量指令：
+ * dsps_mul_s16做增益，dsps_add_s16做饱和相加，每条指令处理8个样本。
+ *
+ * 声部还可以单独淡出（fadeOut），MIXER_CROSSFADE_MS内降到0，用于回复语音到达时让"思考中"提示音让位，
+ * 同时回复语音的ducking恢复，两边正好交叉淡变。
+ *
+ * 内部缓冲区16字节对齐并补齐到8的倍数，保证始终走饱和的向量路径。
+ * 只在播放任务中使用（setGain除外），内部不加锁。
+ */
+
+#ifndef AUDIO_MIXER_H
+#define AUDIO_MIXER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+class AudioMixer {
+public:
+    enum Voice : uint8_t {
+        VOICE_TTS = 0,  // 服务器下发的回复语音（流式）
+        VOICE_EARCON,   // 提示音
+        VOICE_ALARM,    // 闹铃/告警
+        VOICE_COUNT,
+    };
+
+    /**
+     * @brief 创建混音器
+     *
+     * @param max_samples 每次混音的最大样本数
+     */
+    explicit AudioMixer(size_t max_samples);
+    ~AudioMixer();
+
+    bool isValid() const { return accum_ != nullptr; }
+
+    /**
+     * @brief 设置声部增益（0.0~1.0，可在任意任务调用，下一块生效）
+     */
+    void setGain(Voice voice, float gain);
+
+    /**
+     * @brief 设置提示音/闹铃播放时回复语音的增益
+     */
+    void setDuckGain(float gain);
+
+    /**
+     * @brief 开始一块混音：清空累加器，并把各声部增益向目标推进一步
+     *
+     * @param count 本块样本数（不超过max_samples）
+     * @param ducked 本块是否有提示音/闹铃在播
+     */
+    void begin(size_t count, bool ducked);
+
+    /**
+     * @brief 把一个声部的数据叠加到累加器
+     *
+     * count可以小于本块样本数（如提示音结尾），不足部分按静音处理。
+     * 源数据16字节对齐且是一整块时直接从原地址累加，否则先拷贝到内部对齐缓冲区。
+     */
+    void add(Voice voice, const int16_t* samples, size_t count);
+
+    const int16_t* result() const { return accum_; }
+
+    /**
+     * @brief 开始淡出一个声部（从下一块起，MIXER_CROSSFADE_MS内降到0）
+     */
+    void fadeOut(Voice voice);
+
+    /**
+     * @brief 淡出是否已经结束（调用方这时结束声部上的提示音，再resetFade）
+     */
+    bool faded(Voice voice) const { return voice < VOICE_COUNT && fade_[voice] == 0; }
+    bool fading(Voice voice) const { return voice < VOICE_COUNT && fading_[voice]; }
+
+    /**
+     * @brief 取消淡出，声部回到原来的增益
+     */
+    void resetFade(Voice voice);
+
+    /**
+     * @brief 在不需要混音时，这个声部能否直接输出（当前增益正好为1.0且没有在渐变）
+     */
+    bool isPassthrough(Voice voice) const;
+
+private:
+    static const char* TAG;
+    static const int32_t UNITY = 32768;
+
+    static int32_t toQ15(float gain);
+    void fillGain(Voice voice, int32_t gain);
+    int32_t effectiveGain(Voice voice) const { return (int32_t)(((int64_t)current_gain_[voice] * fade_[voice]) >> 15); }
+    void accumulate(Voice voice, const int16_t* src);
+
+    size_t capacity_;               // 补齐到8的倍数后的样本数
+    size_t count_;
+    int16_t* accum_;
+    int16_t* scratch_;
+    int16_t* gain_vec_[VOICE_COUNT];
+    int32_t gain_vec_value_[VOICE_COUNT];   // gain_vec_中当前填充的值
+
+    std::atomic<int32_t> target_gain_[VOICE_COUNT];
+    std::atomic<int32_t> duck_gain_;
+    int32_t current_gain_[VOICE_COUNT];
+    int32_t fade_[VOICE_COUNT];     // 淡出系数（Q15），UNITY=没有在淡出
+    bool fading_[VOICE_COUNT];
+    int32_t ramp_step_;
+    int32_t fade_step_;
+};
+
+#endif // AUDIO_MIXER_H
@@ -0,0 +1,152 @@
+/**
+ * @file audio_pipeline.h
+ * @brief 🧩 编译期拼接的音频处理流水线 - 各级在同一块缓冲区上原地处理，没有虚函数分发
+ *
+ * 用法：AudioPipeline<DcBlock, Vad, OpusEnc, WsSink> pipeline(DcBlock(...), Vad(...), ...);
+ * 每一级是一个普通类，只需要：
+ * - static constexpr const char* NAME：计时日志里的名字
+ * - bool process(AudioFrame& frame)：原地改frame.samples指向的数据，或者把frame.samples换成
+ *   自己的输出缓冲区（零拷贝地交给下一级）；返回false表示这一帧到此为止（被丢弃或已经交出去），后面的级不再执行
+ *
+ * 各级按模板参数的顺序展开成直接调用，编译器可以整条内联，和手写的调用序列一样快；
+ * 新加一级DSP只要多写一个模板参数。计时策略也是模板参数：默认NoStageTiming什么都不做，
+ * 换成StageTiming后每级记录累计和最长耗时（esp_timer，微秒），用logReport()打出来再清零。
+ *
+ * 流水线只在一个任务里使用，内部不加锁。
+ */
+
+#ifndef AUDIO_PIPELINE_H
+#define AUDIO_PIPELINE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <tuple>
+#include <utility>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "project_config.h"
+
+/**
+ * @brief 在流水线里传递的一帧：samples可以被某一级换成别的缓冲区，之后的级看到的就是新的
+ */
+struct AudioFrame {
+    int16_t* samples;
+    size_t count;
+    uint32_t timestamp;     // 按采样率计的样本时间戳（上行帧头用）
+};
+
+/**
+ * @brief 不计时（默认）：调用全部内联成空操作
+ */
+struct NoStageTiming {
+    static constexpr bool ENABLED = false;
+    int64_t begin() const { return 0; }
+    void end(size_t, int64_t) {}
+};
+
+/**
+ * @brief 每级记录累计耗时、最长耗时和帧数
+ */
+template <size_t N>
+class StageTiming {
+public:
+    static constexpr bool ENABLED = true;
+
+    int64_t begin() const { return esp_timer_get_time(); }
+
+    void end(size_t stage, int64_t start) {
+        uint32_t us = (uint32_t)(esp_timer_get_time() - start);
+        total_us_[stage] += us;
+        if (us > max_us_[stage]) {
+            max_us_[stage] = us;
+        }
+        calls_[stage]++;
+    }
+
+    uint32_t totalUs(size_t stage) const { return total_us_[stage]; }
+    uint32_t maxUs(size_t stage) const { return max_us_[stage]; }
+    uint32_t calls(size_t stage) const { return calls_[stage]; }
+
+    void reset() {
+        for (size_t i = 0; i < N; i++) {
+            total_us_[i] = 0;
+            max_us_[i] = 0;
+            calls_[i] = 0;
+        }
+    }
+
+private:
+    uint32_t total_us_[N] = {};
+    uint32_t max_us_[N] = {};
+    uint32_t calls_[N] = {};
+};
+
+template <typename Timing, typename... Stages>
+class BasicAudioPipeline {
+public:
+    static constexpr size_t STAGE_COUNT = sizeof...(Stages);
+
+    explicit BasicAudioPipeline(Stages... stages) : stages_(std::move(stages)...) {}
+
+    /**
+     * @brief 让这一帧依次经过各级
+     *
+     * @return 是否走完了全部的级（有一级返回false时为false）
+     */
+    bool process(AudioFrame& frame) { return run<0>(frame); }
+
+    template <size_t I>
+    auto& stage() { return std::get<I>(stages_); }
+
+    const Timing& timing() const { return timing_; }
+
+    /**
+     * @brief 打出每级的平均/最长耗时并清零（只有计时策略打开时才有内容）
+     */
+    void logReport(const char* tag, const char* label) {
+        if constexpr (Timing::ENABLED) {
+            logStage<0>(tag, label);
+            timing_.reset();
+        }
+    }
+
+private:
+    template <size_t I>
+    bool run(AudioFrame& frame) {
+        if constexpr (I == STAGE_COUNT) {
+            return true;
+        } else {
+            int64_t start = timing_.begin();
+            bool keep = std::get<I>(stages_).process(frame);
+            timing_.end(I, start);
+            return keep && run<I + 1>(frame);
+        }
+    }
+
+    template <size_t I>
+    void logStage(const char* tag, const char* label) {
+        if constexpr (I < STAGE_COUNT) {
+            using Stage = std::tuple_element_t<I, std::tuple<Stages...>>;
+            uint32_t calls = timing_.calls(I);
+            ESP_LOGI(tag, "🧩 %s[%s]: %lu 帧，平均 %lu us，最长 %lu us", label, Stage::NAME, (unsigned long)calls,
+                     (unsigned long)(calls > 0 ? timing_.totalUs(I) / calls : 0), (unsigned long)timing_.maxUs(I));
+            logStage<I + 1>(tag, label);
+        }
+    }
+
+    std::tuple<Stages...> stages_;
+    Timing timing_;
+};
+
+/**
+ * @brief 按AUDIO_PIPELINE_TIMING选择计时策略的流水线（见project_config.h）
+ */
+#if AUDIO_PIPELINE_TIMING
+template <typename... Stages>
+using AudioPipeline = BasicAudioPipeline<StageTiming<sizeof...(Stages)>, Stages...>;
+#else
+template <typename... Stages>
+using AudioPipeline = BasicAudioPipeline<NoStageTiming, Stages...>;
+#endif
+
+#endif // AUDIO_PIPELINE_H
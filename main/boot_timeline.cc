@@ -0,0 +1,68 @@
+/**
+ * @file boot_timeline.cc
+ * @brief 🚀 启动时间线实现
+ */
+
+#include "boot_timeline.h"
+#include <stdio.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+
+const char* BootTimeline::TAG = "BootTimeline";
+
+// 日志和JSON里的阶段名，和BootStage一一对应
+static const char* const kStageNames[(size_t)BootStage::COUNT] = {
+    "nvs", "board", "audio", "models", "wake_ready", "wifi", "server",
+};
+
+BootTimeline::BootTimeline()
+    : resumed_(false)
+    , slept_ms_(0)
+    , cold_wake_ready_ms_(-1)
+{
+    for (auto& mark : marks_) {
+        mark = 0;
+    }
+}
+
+void BootTimeline::mark(BootStage stage) {
+    int64_t expected = 0;
+    marks_[(size_t)stage].compare_exchange_strong(expected, esp_timer_get_time());
+}
+
+void BootTimeline::setResumed(uint32_t slept_ms, int32_t cold_wake_ready_ms) {
+    resumed_ = true;
+    slept_ms_ = slept_ms;
+    cold_wake_ready_ms_ = cold_wake_ready_ms;
+}
+
+int32_t BootTimeline::ms(BootStage stage) const {
+    int64_t t = marks_[(size_t)stage].load();
+    return t == 0 ? -1 : (int32_t)(t / 1000);
+}
+
+void BootTimeline::log() const {
+    ESP_LOGI(TAG, "🚀 启动时间线(ms): NVS %ld → 音频硬件 %ld → 音频管理 %ld → 模型 %ld → 唤醒就绪 %ld | WiFi %ld → 服务器 %ld",
+             (long)ms(BootStage::NVS), (long)ms(BootStage::BOARD), (long)ms(BootStage::AUDIO),
+             (long)ms(BootStage::MODELS), (long)ms(BootStage::WAKE_READY),
+             (long)ms(BootStage::WIFI_UP), (long)ms(BootStage::SERVER_UP));
+    if (resumed_) {
+        ESP_LOGI(TAG, "🌙 深度睡眠快速恢复（睡了 %lu ms），上次冷启动唤醒就绪 %ld ms",
+                 (unsigned long)slept_ms_, (long)cold_wake_ready_ms_);
+    }
+}
+
+size_t BootTimeline::format(char* buf, size_t size) const {
+    int len = snprintf(buf, size, "{\"type\":\"boot\"");
+    for (size_t i = 0; i < (size_t)BootStage::COUNT && len > 0 && (size_t)len < size; i++) {
+        len += snprintf(buf + len, size - len, ",\"%s\":%ld", kStageNames[i], (long)ms((BootStage)i));
+    }
+    if (resumed_ && len > 0 && (size_t)len < size) {
+        len += snprintf(buf + len, size - len, ",\"resume\":true,\"slept_ms\":%lu,\"cold_wake_ready\":%ld",
+                        (unsigned long)slept_ms_, (long)cold_wake_ready_ms_);
+    }
+    if (len > 0 && (size_t)len < size) {
+        len += snprintf(buf + len, size - len, "}");
+    }
+    return (len > 0 && (size_t)len < size) ? (size_t)len : 0;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file boot_timeline.h
+ * @brief 🚀 启动时间线 - 记录上电到各模块就绪的时间，找出启动慢在哪一步
+ *
+ * 启动分成两条并行的线：
+ * - 主任务：硬件和I2S → 提示音/音频管理器 → 模型映射和AFE → 开始采集（唤醒就绪）
+ * - 网络任务：WiFi关联和拿到IP → WebSocket连上服务器
+ * 两条线各自mark()，时间取esp_timer（从上电算起，微秒）。两条线都结束后log()输出一行，
+ * 连上服务器后format()成{"type":"boot",...}发给服务器，便于对比不同设备和固件版本。
+ * 从深度睡眠快速恢复（见fast_resume.h）时另外带上resume、睡了多久和上次冷启动的唤醒就绪时间。
+ */
+
+#ifndef BOOT_TIMELINE_H
+#define BOOT_TIMELINE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+/**
+ * @brief 启动阶段（按主任务、网络任务分组，不要调整顺序）
+ */
+enum class BootStage : uint8_t {
+    NVS = 0,            // NVS和默认事件循环
+    BOARD,              // I2S采集/播放初始化（含丢弃上电数据）
+    AUDIO,              // 音频管理器、提示音、上行任务
+    MODELS,             // 模型分区映射
+    WAKE_READY,         // AFE启动、开始采集，可以唤醒
+    WIFI_UP,            // WiFi拿到IP
+    SERVER_UP,          // WebSocket连上服务器（连不上时不记）
+    COUNT
+};
+
+class BootTimeline {
+public:
+    BootTimeline();
+
+    /**
+     * @brief 记录一个阶段完成（可以在任意任务中调用，重复调用只记第一次）
+     */
+    void mark(BootStage stage);
+
+    /**
+     * @brief 🌙 这次是深度睡眠快速恢复（app_main开头调用）
+     *
+     * @param cold_wake_ready_ms 上次冷启动的唤醒就绪时间，用来对比（-1=没有）
+     */
+    void setResumed(uint32_t slept_ms, int32_t cold_wake_ready_ms);
+
+    /**
+     * @brief 阶段完成时刻（上电起的毫秒数），没有记录时返回-1
+     */
+    int32_t ms(BootStage stage) const;
+
+    /**
+     * @brief 在日志中输出时间线
+     */
+    void log() const;
+
+    /**
+     * @brief 格式化成发给服务器的JSON（缺失的阶段为-1）
+     *
+     * @return 写入的字符数（不含结尾'\0'），缓冲区不够时返回0
+     */
+    size_t format(char* buf, size_t size) const;
+
+private:
+    static const char* TAG;
+
+    std::atomic<int64_t> marks_[(size_t)BootStage::COUNT];
+    bool resumed_;
+    uint32_t slept_ms_;
+    int32_t cold_wake_ready_ms_;
+};
+
+#endif // BOOT_TIMELINE_H
@@ -17,16 +17,33 @@
  *      limitations under the License.
  */
 
+#include <math.h>
+#include <stdlib.h>
 #include <string.h>
 #include "bsp_board.h"
+#include "task_factory.h"
 #include "driver/i2s_std.h"
 #include "soc/soc_caps.h"
 #include "driver/gpio.h"
 #include "esp_err.h"
 #include "esp_log.h"
+#include "log_throttle.h"
 #include "esp_check.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "esp_attr.h"
+#include "project_config.h"
+#include "mic_conditioner.h"
+#include "sample_format.h"
+#include "flight_recorder.h"
+#include "perf_counters.h"
+#include "sched_trace.h"
+#include "scope_timer.h"
+#include "supervisor.h"
+#include "realtime_audio.h"
 
 // INMP441 I2S 引脚配置
 // INMP441 是一个数字 MEMS 麦克风，通过 I2S 接口与 ESP32-S3 通信
@@ -40,13 +57,13 @@
 #define I2S_OUT_LRC_PIN GPIO_NUM_16  // 左右声道时钟信号 (LR Clock)
 #define I2S_OUT_DIN_PIN GPIO_NUM_7   // 数据输入信号 (Data Input)
 #define I2S_OUT_SD_PIN GPIO_NUM_8    // Shutdown引脚 (可选，用于关闭功放)
+// 全双工（I2S_FULL_DUPLEX）时功放的BCLK/LRC改接麦克风的SCK/WS（GPIO5/GPIO4），DIN和SD不变，GPIO15/16空出来
 
 // I2S 配置参数
 #define I2S_PORT_RX I2S_NUM_0 // 使用 I2S 端口 0 用于录音
 #define I2S_PORT_TX I2S_NUM_1 // 使用 I2S 端口 1 用于播放
 #define SAMPLE_RATE 16000     // 采样率 16kHz，适合语音识别
 #define BITS_PER_SAMPLE 16    // 每个采样点 16 位
-#define CHANNELS 1            // 单声道配置
 
 static const char *TAG = "bsp_board";
 
@@ -56,28 +73,216 @@ static i2s_chan_handle_t rx_handle = nullptr;
 static i2s_chan_handle_t tx_handle = nullptr;
 // I2S 发送通道状态标志
 static bool tx_channel_enabled = false;
+// 发送通道当前的格式（amp_lock保护），bsp_audio_set_format()据此跳过不需要的重新配置
+static uint32_t tx_sample_rate = 0;
+static int tx_bits_per_chan = 16;
+static int tx_channel_format = 1;
+// 🔌 功放电源管理：播放结束后保持余温，定时器到期再分步断电（以下状态由amp_lock保护）
+static SemaphoreHandle_t amp_lock = nullptr;
+static StaticSemaphore_t amp_lock_struct;
+static esp_timer_handle_t amp_timer = nullptr;
+static bool amp_powered = false;
+static volatile bool amp_release_pending = false;
+static void bsp_amp_timer_cb(void *arg);
+static void bsp_sink_close_locked(uint32_t delay_ms);
+static bool IRAM_ATTR bsp_on_sent(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx);
+static bool IRAM_ATTR bsp_on_send_q_ovf(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx);
+static esp_err_t bsp_tx_channel_setup(uint32_t sample_rate, int channel_format, int bits_per_chan);
+
+// 播放输出（bsp_audio_sink_*），除中断计数外都在amp_lock下访问
+static bool tx_sink_open = false;
+static int tx_dma_desc_num = 0;
+static uint32_t tx_dma_frame_num = 0;
+static SemaphoreHandle_t tx_sent_sem = nullptr;     // 发送完成中断 → 等待drain的任务
+static StaticSemaphore_t tx_sent_sem_struct;
+static volatile uint32_t tx_descs_sent = 0;         // 发送完成中断里累加
+static volatile uint32_t tx_last_write_descs = 0;   // 最后一次写入返回时的tx_descs_sent
+static volatile bool tx_drain_waiting = false;
+// DMA欠载：写过数据、还没drain/abort（tx_fed）时DMA把描述符全部送完，之后auto_clear输出静音，记一次
+static volatile bool tx_fed = false;
+static volatile uint32_t tx_dma_underruns = 0;      // 中断里累加
+static uint32_t tx_dma_underruns_seen = 0;          // 已经记进PerfCounters的部分（amp_lock下）
+// 打断时估计正在播的样本：按DMA的回转顺序记下描述符缓冲区，中断里记下刚送完的是哪一个
+#define BSP_TX_MAX_DESC 12      // 全双工时播放跟着采集的DMA配置，最多12个描述符
+static void *tx_desc_bufs[BSP_TX_MAX_DESC];
+static volatile int tx_desc_known = 0;
+static void *volatile tx_last_sent_buf = nullptr;
+static volatile int64_t tx_last_sent_us = 0;
+static volatile int32_t tx_last_sent_sample = 0;   // 刚送完的描述符的最后一个样本（auto_clear清零之前）
+static portMUX_TYPE tx_sent_lock = portMUX_INITIALIZER_UNLOCKED;    // 中断可能在另一个核上
+// 麦克风输入调理（只在feed任务中使用）
+static MicConditioner mic_conditioner;
+// 麦克风I2S槽位宽（16或32），32位时读取后原地收窄为16位
+static int rx_bits_per_chan = 16;
+static int rx_narrow_shift = 16;
+// 麦克风数（1=左声道，2=左右声道交织）
+static int rx_channels = 1;
+static int rx_dma_desc_num = 0;
+
+// 🎙️ 事件驱动采集：DMA每填满一个描述符，ISR把缓冲区指针交给采集任务，
+// 采集任务原地收窄/调理后依次交给所有注册的回调（不拷贝）
+#define BSP_CAPTURE_MAX_SINKS 4
+typedef struct {
+    bsp_capture_sink_t func;
+    void *ctx;
+} bsp_capture_sink_entry_t;
+typedef struct {
+    void *dma_buf;
+    size_t size;
+} bsp_capture_block_t;
+static bsp_capture_sink_entry_t capture_sinks[BSP_CAPTURE_MAX_SINKS];
+static int capture_sink_count = 0;
+static QueueHandle_t capture_queue = nullptr;
+static StaticQueue_t capture_queue_struct;
+static bsp_capture_block_t capture_queue_storage[I2S_RX_DMA_DESC_NUM];  // 深度是DMA描述符数-2，按配置的上限预留
+static TaskHandle_t capture_task_handle = nullptr;
+static volatile uint32_t capture_overruns = 0;
+// 📏 采集连续性：中断间隔超过一块的1.5倍说明中断被挡住了（关中断、写Flash时cache关闭），
+// 驱动每次中断只交出最新完成的一个描述符，中间完成的块没有交出来就被DMA覆盖了
+static uint32_t rx_block_us = 0;                // 一个DMA块的时长
+static volatile int64_t rx_last_isr_us = 0;     // 0=刚启动或刚重启，不算间隔
+static volatile uint32_t capture_gap_blocks = 0;
+
+/**
+ * @brief 按调用方给定的DMA参数修改通道配置
+ *
+ * 单个DMA描述符最多4092字节，frame_num超出时自动缩小。
+ * 参数为0时保留驱动默认值。
+ *
+ * @param chan_cfg 通道配置
+ * @param dma_desc_num DMA描述符数量
+ * @param dma_frame_num 每个描述符的帧数
+ * @param frame_bytes 每帧字节数（槽位宽 × 声道数）
+ * @param name 日志中的通道名称
+ */
+static void bsp_apply_dma_config(i2s_chan_config_t *chan_cfg, int dma_desc_num, int dma_frame_num,
+                                 int frame_bytes, const char *name)
+{
+    if (dma_desc_num > 0)
+    {
+        chan_cfg->dma_desc_num = dma_desc_num;
+    }
+    if (dma_frame_num > 0)
+    {
+        if (dma_frame_num * frame_bytes > 4092)
+        {
+            int max_frames = 4092 / frame_bytes;
+            ESP_LOGW(TAG, "⚠️ %s DMA帧数%d超过单个描述符上限，改为%d", name, dma_frame_num, max_frames);
+            dma_frame_num = max_frames;
+        }
+        chan_cfg->dma_frame_num = dma_frame_num;
+    }
+    ESP_LOGI(TAG, "🔧 %s DMA: %lu个描述符 × %lu帧", name,
+             (unsigned long)chan_cfg->dma_desc_num, (unsigned long)chan_cfg->dma_frame_num);
+}
+
+/**
+ * @brief 🎙️ 丢弃麦克风上电的数据，直到直流和能量收敛
+ *
+ * INMP441时钟起来后先输出一段全零，然后是衰减的直流冲击。以前固定丢弃24KB（约375ms），
+ * 每次启动都要等满；现在逐块（栈上512字节，8~16ms）算直流和去直流后的能量，
+ * 连续MIC_SETTLE_STABLE_BLOCKS块相邻变化都在阈值内、且过了MIC_SETTLE_MIN_MS就返回，
+ * 最多等MIC_SETTLE_MAX_MS。样本统一换算成24位计数（SampleTraits::toS24），16位和32位采集用同一套阈值。
+ */
+template <typename Format>
+static void bsp_mic_settle(uint32_t sample_rate)
+{
+    using Sample = typename Format::Sample;
+    Sample block[512 / sizeof(Sample)];
+    constexpr size_t sample_bytes = Format::sample_bytes;
+    const int64_t start_us = esp_timer_get_time();
+    const uint32_t bytes_per_ms = sample_rate / 1000 * Format::frame_bytes;
+    uint32_t discarded = 0;
+    int stable = 0;
+    bool have_prev = false;
+    int32_t prev_dc = 0;
+    float prev_energy = 0.0f;
+    float energy = 0.0f;
+    int32_t dc = 0;
+    while (discarded < MIC_SETTLE_MAX_MS * bytes_per_ms)
+    {
+        size_t bytes_read = 0;
+        if (i2s_channel_read(rx_handle, block, sizeof(block), &bytes_read, pdMS_TO_TICKS(100)) != ESP_OK ||
+            bytes_read < sample_bytes)
+        {
+            break;
+        }
+        discarded += bytes_read;
+
+        size_t count = bytes_read / sample_bytes;
+        int64_t sum = 0;
+        bool all_zero = true;
+        for (size_t i = 0; i < count; i++)
+        {
+            int32_t s = SampleTraits<Sample>::toS24(block[i]);
+            sum += s;
+            all_zero = all_zero && s == 0;
+        }
+        dc = (int32_t)(sum / (int64_t)count);
+        int64_t acc = 0;    // 24位样本的平方和，一块最多128个样本，不会溢出
+        for (size_t i = 0; i < count; i++)
+        {
+            int64_t d = SampleTraits<Sample>::toS24(block[i]) - dc;
+            acc += d * d;
+        }
+        energy = (float)(acc / (int64_t)count) + 1.0f;  // +1：静音时比值不会除以0
+
+        // 全零是麦克风还没开始输出，不算稳定
+        bool block_stable = !all_zero && have_prev && abs(dc - prev_dc) <= MIC_SETTLE_DC_DELTA &&
+                            energy <= prev_energy * MIC_SETTLE_ENERGY_RATIO &&
+                            prev_energy <= energy * MIC_SETTLE_ENERGY_RATIO;
+        stable = block_stable ? stable + 1 : 0;
+        have_prev = true;
+        prev_dc = dc;
+        prev_energy = energy;
+        if (stable >= MIC_SETTLE_STABLE_BLOCKS && discarded >= MIC_SETTLE_MIN_MS * bytes_per_ms)
+        {
+            ESP_LOGI(TAG, "🎙️ 麦克风已稳定：丢弃%lu ms（%lu 字节，用时%lld ms），直流%ld，RMS %.0f",
+                     (unsigned long)(discarded / bytes_per_ms), (unsigned long)discarded,
+                     (esp_timer_get_time() - start_us) / 1000, (long)dc, sqrtf(energy));
+            return;
+        }
+    }
+    ESP_LOGW(TAG, "⚠️ 麦克风%lu ms内没有稳定（直流%ld，RMS %.0f），照常开始采集",
+             (unsigned long)(discarded / bytes_per_ms), (long)dc, sqrtf(energy));
+}
 
 /**
  * @brief 初始化 I2S 接口用于 INMP441 麦克风
  *
  * INMP441 是一个数字 MEMS 麦克风，需要特定的 I2S 配置：
  * - 使用标准 I2S 协议 (Philips 格式)
- * - 单声道模式，只使用左声道
- * - 16 位数据宽度
+ * - 单麦克风只使用左声道；双麦克风时第二个INMP441的L/R脚接高电平，占右声道，立体声交织读取
+ * - 16 位数据宽度（只取高16位），或32位数据宽度（保留完整的24位有效数据）
  *
  * @param sample_rate 采样率 (Hz)
  * @param channel_format 声道数 (1=单声道, 2=立体声)
  * @param bits_per_chan 每个采样点的位数 (16 或 32)
+ * @param dma_desc_num DMA描述符数量（0=驱动默认）
+ * @param dma_frame_num 每个DMA描述符的帧数（0=驱动默认）
  * @return esp_err_t 初始化结果
  */
-static esp_err_t bsp_i2s_init(uint32_t sample_rate, int channel_format, int bits_per_chan)
+static esp_err_t bsp_i2s_init(uint32_t sample_rate, int channel_format, int bits_per_chan,
+                              int dma_desc_num, int dma_frame_num)
 {
     esp_err_t ret = ESP_OK;
 
     // 创建 I2S 通道配置
     // 设置为主模式，ESP32-S3 作为时钟源
     i2s_chan_config_t chan_cfg = I2S_CHANNEL_DEFAULT_CONFIG(I2S_PORT_RX, I2S_ROLE_MASTER);
+    bsp_apply_dma_config(&chan_cfg, dma_desc_num, dma_frame_num, bits_per_chan / 8 * channel_format, "录音");
+    rx_dma_desc_num = chan_cfg.dma_desc_num;
+    rx_block_us = (uint32_t)((uint64_t)chan_cfg.dma_frame_num * 1000000 / sample_rate);
+#if I2S_FULL_DUPLEX
+    // 🔗 全双工：同一个端口上一次创建收发两个通道，共用BCLK/WS和DMA配置，
+    // 播放和采集按同一个时钟逐样本对齐。auto_clear是发送通道用的（见bsp_tx_channel_create）
+    chan_cfg.auto_clear = true;
+    ret = i2s_new_channel(&chan_cfg, &tx_handle, &rx_handle);
+    tx_dma_desc_num = (int)chan_cfg.dma_desc_num;
+    tx_dma_frame_num = chan_cfg.dma_frame_num;
+#else
     ret = i2s_new_channel(&chan_cfg, nullptr, &rx_handle);
+#endif
     if (ret != ESP_OK)
     {
         ESP_LOGE(TAG, "创建 I2S 通道失败: %s", esp_err_to_name(ret));
@@ -101,7 +306,11 @@ static esp_err_t bsp_i2s_init(uint32_t sample_rate, int channel_format, int bits
             .mclk = I2S_GPIO_UNUSED, // INMP441 不需要主时钟
             .bclk = I2S_SCK_PIN,     // 位时钟引脚
             .ws = I2S_WS_PIN,        // 字选择引脚
+#if I2S_FULL_DUPLEX
+            .dout = I2S_OUT_DIN_PIN, // 全双工：功放的DIN，两个通道的GPIO配置相同
+#else
             .dout = I2S_GPIO_UNUSED, // 不需要数据输出（仅录音）
+#endif
             .din = I2S_SD_PIN,       // 数据输入引脚
             .invert_flags = {
                 .mclk_inv = false,
@@ -112,9 +321,17 @@ static esp_err_t bsp_i2s_init(uint32_t sample_rate, int channel_format, int bits
     };
 
     // INMP441 特定配置调整
-    // INMP441 输出左对齐数据，我们只使用左声道
-    std_cfg.slot_cfg.slot_mode = I2S_SLOT_MODE_MONO;
-    std_cfg.slot_cfg.slot_mask = I2S_STD_SLOT_LEFT;
+    // INMP441 输出左对齐数据，单麦克风只使用左声道，双麦克风左右声道交织（L0 R0 L1 R1 ...）
+    if (channel_format == 2)
+    {
+        std_cfg.slot_cfg.slot_mode = I2S_SLOT_MODE_STEREO;
+        std_cfg.slot_cfg.slot_mask = I2S_STD_SLOT_BOTH;
+    }
+    else
+    {
+        std_cfg.slot_cfg.slot_mode = I2S_SLOT_MODE_MONO;
+        std_cfg.slot_cfg.slot_mask = I2S_STD_SLOT_LEFT;
+    }
 
     // 初始化 I2S 标准模式
     ret = i2s_channel_init_std_mode(rx_handle, &std_cfg);
@@ -124,6 +341,21 @@ static esp_err_t bsp_i2s_init(uint32_t sample_rate, int channel_format, int bits
         return ret;
     }
 
+#if I2S_FULL_DUPLEX
+    // 发送通道先按默认的播放格式（16kHz单声道16位）配好并启用，采集依赖它输出的BCLK/WS；
+    // bsp_audio_init只打开功放，格式不同时原地改槽位
+    ret = bsp_tx_channel_setup(sample_rate, 1, 16);
+    if (ret != ESP_OK)
+    {
+        return ret;
+    }
+    tx_channel_enabled = true;
+    tx_sample_rate = sample_rate;
+    tx_bits_per_chan = 16;
+    tx_channel_format = 1;
+    ESP_LOGI(TAG, "🔗 I2S全双工：采集和播放共用I2S%d的BCLK/WS", (int)I2S_PORT_RX);
+#endif
+
     // 启用 I2S 通道开始接收数据
     ret = i2s_channel_enable(rx_handle);
     if (ret != ESP_OK)
@@ -132,18 +364,8 @@ static esp_err_t bsp_i2s_init(uint32_t sample_rate, int channel_format, int bits
         return ret;
     }
 
-    // 清理初始噪音：读取并丢弃前几帧数据
-    const size_t discard_samples = 8192; // 丢弃前8KB数据
-    uint8_t *discard_buffer = (uint8_t *)malloc(discard_samples);
-    if (discard_buffer) {
-        size_t bytes_read;
-        for (int i = 0; i < 3; i++) { // 读取3次
-            i2s_channel_read(rx_handle, discard_buffer, discard_samples, &bytes_read, pdMS_TO_TICKS(100));
-            vTaskDelay(pdMS_TO_TICKS(10));
-        }
-        free(discard_buffer);
-        ESP_LOGD(TAG, "已清理I2S输入缓冲区初始数据");
-    }
+    SampleFormats::visit(bits_per_chan, channel_format,
+                         [&](auto format) { bsp_mic_settle<decltype(format)>(sample_rate); });
 
     ESP_LOGI(TAG, "I2S 初始化成功");
     return ESP_OK;
@@ -158,43 +380,58 @@ static esp_err_t bsp_i2s_init(uint32_t sample_rate, int channel_format, int bits
  * - 准备好录音功能
  *
  * @param sample_rate 采样率（Hz），推荐16000
- * @param channel_format 声道格式，1=单声道
- * @param bits_per_chan 每个采样点的位数，推荐16
+ * @param channel_format 麦克风数，1=单麦克风（左声道），2=双麦克风（左右声道交织）
+ * @param bits_per_chan 麦克风采集位宽，16或32（推荐32，见MIC_CAPTURE_SHIFT）
+ * @param dma_desc_num DMA描述符数量（0=驱动默认）
+ * @param dma_frame_num 每个DMA描述符的帧数，推荐等于（或整除）AFE的feed块大小（0=驱动默认）
  * @return esp_err_t 初始化结果
  */
-esp_err_t bsp_board_init(uint32_t sample_rate, int channel_format, int bits_per_chan)
+esp_err_t bsp_board_init(uint32_t sample_rate, int channel_format, int bits_per_chan,
+                         int dma_desc_num, int dma_frame_num)
 {
     ESP_LOGI(TAG, "🚀 正在初始化ESP32-S3-DevKitC-1 + INMP441麦克风");
     ESP_LOGI(TAG, "🎵 音频参数: 采样率=%ldHz, 声道数=%d, 位深=%d位",
              sample_rate, channel_format, bits_per_chan);
 
-    return bsp_i2s_init(sample_rate, channel_format, bits_per_chan);
+    if (bits_per_chan != 16 && bits_per_chan != 32)
+    {
+        ESP_LOGE(TAG, "❌ 不支持的采集位宽: %d", bits_per_chan);
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (channel_format != 1 && channel_format != 2)
+    {
+        ESP_LOGE(TAG, "❌ 不支持的麦克风数: %d", channel_format);
+        return ESP_ERR_INVALID_ARG;
+    }
+    rx_channels = channel_format;
+    rx_bits_per_chan = bits_per_chan;
+    rx_narrow_shift = MIC_CAPTURE_SHIFT;
+    if (rx_narrow_shift < 0 || rx_narrow_shift > 16)
+    {
+        ESP_LOGW(TAG, "⚠️ MIC_CAPTURE_SHIFT=%d超出范围，改用16", rx_narrow_shift);
+        rx_narrow_shift = 16;
+    }
+    if (bits_per_chan == 32)
+    {
+        ESP_LOGI(TAG, "🎚️ 32位采集，右移%d位收窄为16位（相对16位采集+%ddB）",
+                 rx_narrow_shift, (16 - rx_narrow_shift) * 6);
+    }
+
+    mic_conditioner.configure(MIC_DC_BLOCK_ENABLE, MIC_INPUT_GAIN, channel_format);
+    return bsp_i2s_init(sample_rate, channel_format, bits_per_chan, dma_desc_num, dma_frame_num);
 }
 
+// 输出不是16位或采集是32位时，bsp_get_feed_data在栈上按块读取（32位采集时1KB）
+static constexpr size_t BSP_FEED_CHUNK_SAMPLES = 256;
+
 /**
- * @brief 🎤 从麦克风获取音频数据
- *
- * 这个函数就像“录音师”，它会：
- * 
- * 🎯 工作流程：
- * 1. 从I2S接口读取原始数据
- * 2. 对INMP441的输出进行格式转换
- * 3. 可选择性应用增益调整
- * 4. 确保数据适合语音识别
- *
- * @param is_get_raw_channel 是否获取原始数据（true=不处理）
- * @param buffer 存储音频数据的缓冲区
- * @param buffer_len 缓冲区长度（字节）
- * @return esp_err_t 读取结果
+ * @brief 阻塞读取一块原始样本，原地收窄成16位并调理（结果按int16_t读取data）
  */
-esp_err_t bsp_get_feed_data(bool is_get_raw_channel, int16_t *buffer, int buffer_len)
+template <typename Raw>
+static esp_err_t bsp_feed_chunk(bool is_get_raw_channel, Raw *data, size_t want, size_t *count)
 {
-    esp_err_t ret = ESP_OK;
     size_t bytes_read = 0;
-
-    // 🎤 从I2S通道读取音频数据
-    ret = i2s_channel_read(rx_handle, buffer, buffer_len, &bytes_read, portMAX_DELAY);
-
+    esp_err_t ret = i2s_channel_read(rx_handle, data, want * sizeof(Raw), &bytes_read, portMAX_DELAY);
     if (ret != ESP_OK)
     {
         ESP_LOGE(TAG, "❌ 读取I2S数据失败: %s", esp_err_to_name(ret));
@@ -202,58 +439,330 @@ esp_err_t bsp_get_feed_data(bool is_get_raw_channel, int16_t *buffer, int buffer
     }
 
     // 🔍 检查读取的数据长度是否符合预期
-    if (bytes_read != buffer_len)
+    if (bytes_read != want * sizeof(Raw))
     {
-        ESP_LOGW(TAG, "⚠️ 预期读取%d字节，实际读取%d字节", buffer_len, bytes_read);
+        HOT_LOGW(TAG, "⚠️ 预期读取%d字节，实际读取%d字节", (int)(want * sizeof(Raw)), (int)bytes_read);
     }
 
-    // 🎯 INMP441特定的数据处理
-    // INMP441输出24位数据在 32位帧中，左对齐
-    // 我们需要提取最高有效的16位用于语音识别
+    // 🎯 32位采集：INMP441的24位数据左对齐，原地移位并饱和成16位（16位采集时什么都不做）
+    *count = bytes_read / sizeof(Raw);
+    int16_t *samples = reinterpret_cast<int16_t *>(data);
+    SampleConvert<Raw, int16_t>::run(data, samples, *count, rx_narrow_shift);
+
+    // 🎚️ 可选的去直流/增益调理（配置全部关闭时直接返回）
     if (!is_get_raw_channel)
     {
-        int samples = buffer_len / sizeof(int16_t);
+        mic_conditioner.process(samples, *count);
+    }
+    return ESP_OK;
+}
 
-        // 🎶 对INMP441的数据进行处理
-        // 麦克风输出左对齐数据，进行信号电平调整
-        for (int i = 0; i < samples; i++)
+/**
+ * @brief 按采集格式Raw读出samples个Out样本
+ */
+template <typename Raw, typename Out>
+static esp_err_t bsp_feed_read(bool is_get_raw_channel, Out *buffer, size_t samples)
+{
+    if constexpr (std::is_same_v<Raw, int16_t> && std::is_same_v<Out, int16_t>)
+    {
+        // 16位采集、16位输出：直接读进调用方的缓冲区
+        size_t count = 0;
+        return bsp_feed_chunk(is_get_raw_channel, buffer, samples, &count);
+    }
+    else
+    {
+        alignas(16) Raw chunk[BSP_FEED_CHUNK_SAMPLES];
+        size_t done = 0;
+        while (done < samples)
         {
-            // 当前使用原始信号电平（无增益）
-            // 测试表明原始电平已足够满足唤醒词检测需求
-            int32_t sample = static_cast<int32_t>(buffer[i]);
-
-            // 🔊 可选：应用2倍增益以提升信号强度（当前已禁用）
-            // 如果发现声音太小，可以取消下面这行的注释
-            // sample = sample * 2;
-
-            // 📦 限制在16位有符号整数范围内
-            if (sample > 32767)
+            size_t want = samples - done < BSP_FEED_CHUNK_SAMPLES ? samples - done : BSP_FEED_CHUNK_SAMPLES;
+            size_t count = 0;
+            esp_err_t ret = bsp_feed_chunk(is_get_raw_channel, chunk, want, &count);
+            if (ret != ESP_OK)
             {
-                sample = 32767;
+                return ret;
             }
-            if (sample < -32768)
+            SampleConvert<int16_t, Out>::run(reinterpret_cast<const int16_t *>(chunk), buffer + done, count);
+            done += count;
+            if (count < want)
             {
-                sample = -32768;
+                break;
             }
+        }
+        return ESP_OK;
+    }
+}
 
-            buffer[i] = static_cast<int16_t>(sample);
+/**
+ * @brief 🎤 从麦克风获取音频数据
+ *
+ * 这个函数就像“录音师”，它会：
+ *
+ * 🎯 工作流程：
+ * 1. 从I2S接口读取原始数据（16位或32位槽）
+ * 2. 收窄为16位
+ * 3. 可选择性应用去直流和增益调整（esp-dsp向量指令，见mic_conditioner.h）
+ * 4. 转换成调用方要的格式（int16_t或float）
+ *
+ * 16位输出时buffer需要16字节对齐才能走向量路径，否则esp-dsp退回标量实现。
+ *
+ * @param is_get_raw_channel 是否获取原始数据（true=不处理）
+ * @param buffer 存储音频数据的缓冲区
+ * @param samples 样本数（双麦克风时两个声道的总数）
+ * @return esp_err_t 读取结果
+ */
+template <typename T>
+esp_err_t bsp_get_feed_data(bool is_get_raw_channel, T *buffer, size_t samples)
+{
+    SCOPE_TIMER(FEED_DATA);
+
+    // 采集任务运行后DMA缓冲区由它独占，不能再阻塞读取
+    if (capture_task_handle != nullptr)
+    {
+        ESP_LOGE(TAG, "❌ 采集任务已启动，请通过bsp_capture_add_sink获取数据");
+        return ESP_ERR_INVALID_STATE;
+    }
+    return rx_bits_per_chan == 32 ? bsp_feed_read<int32_t>(is_get_raw_channel, buffer, samples)
+                                  : bsp_feed_read<int16_t>(is_get_raw_channel, buffer, samples);
+}
+
+template esp_err_t bsp_get_feed_data<int16_t>(bool is_get_raw_channel, int16_t *buffer, size_t samples);
+template esp_err_t bsp_get_feed_data<float>(bool is_get_raw_channel, float *buffer, size_t samples);
+
+/**
+ * @brief I2S接收完成中断回调：只把DMA缓冲区指针交给采集任务
+ */
+static bool IRAM_ATTR bsp_on_recv(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx)
+{
+    bsp_capture_block_t block = { event->dma_buf, event->size };
+    BaseType_t need_yield = pdFALSE;
+    int64_t now_us = esp_timer_get_time();
+    int64_t last_us = rx_last_isr_us;
+    rx_last_isr_us = now_us;
+    if (last_us != 0 && rx_block_us > 0 && now_us - last_us > (int64_t)(rx_block_us + rx_block_us / 2))
+    {
+        capture_gap_blocks = capture_gap_blocks + (uint32_t)((now_us - last_us + rx_block_us / 2) / rx_block_us) - 1;
+    }
+    if (xQueueSendFromISR(capture_queue, &block, &need_yield) != pdTRUE)
+    {
+        // 采集任务落后太多，这一块会被DMA覆盖，直接丢弃
+        capture_overruns = capture_overruns + 1;
+    }
+    return need_yield == pdTRUE;
+}
+
+/**
+ * @brief 🎙️ 采集任务：处理每个DMA块并分发给所有回调
+ *
+ * 每种槽位宽一个实例（bsp_capture_start按rx_bits_per_chan选），循环里没有格式判断；
+ * 声道数只影响调理（MicConditioner按声道估计直流），不用再多编译一份。
+ */
+template <typename Raw>
+static void AUDIO_HOT_IRAM bsp_capture_task(void *arg)
+{
+    bsp_capture_block_t block;
+    uint32_t reported_overruns = 0;
+    uint32_t reported_gaps = 0;
+
+    while (true)
+    {
+        if (xQueueReceive(capture_queue, &block, portMAX_DELAY) != pdTRUE)
+        {
+            continue;
+        }
+
+        SCOPE_TIMER(CAPTURE);   // 到这一轮循环结束
+        SCHED_TRACE_BEGIN(CAPTURE, block.size);
+        // 直接在DMA缓冲区里处理：队列深度比描述符数少2，DMA回绕到这块之前一定已经处理完
+        int16_t *samples = static_cast<int16_t *>(block.dma_buf);
+        size_t count = block.size / sizeof(Raw);
+        SampleConvert<Raw, int16_t>::run(static_cast<const Raw *>(block.dma_buf), samples, count, rx_narrow_shift);
+        mic_conditioner.process(samples, count);
+
+        for (int i = 0; i < capture_sink_count; i++)
+        {
+            capture_sinks[i].func(samples, count, capture_sinks[i].ctx);
+        }
+        SCHED_TRACE_END(CAPTURE, block.size);
+
+        PerfCounters::add(PerfCounter::CAPTURE_BLOCKS);
+        Supervisor::beat(Watch::CAPTURE);
+
+        uint32_t overruns = capture_overruns;
+        if (overruns != reported_overruns)
+        {
+            PerfCounters::add(PerfCounter::CAPTURE_OVERRUNS, overruns - reported_overruns);
+            FLIGHT_RECORD(CAPTURE_OVERRUN, overruns - reported_overruns);
+            HOT_LOGW(TAG, "⚠️ 采集任务处理不及时，累计丢弃%lu个DMA块", (unsigned long)overruns);
+            reported_overruns = overruns;
+        }
+        uint32_t gaps = capture_gap_blocks;
+        if (gaps != reported_gaps)
+        {
+            PerfCounters::add(PerfCounter::CAPTURE_GAPS, gaps - reported_gaps);
+            FLIGHT_RECORD(CAPTURE_GAP, gaps - reported_gaps);
+            HOT_LOGW(TAG, "⚠️ I2S接收中断来晚了，累计漏掉%lu个DMA块", (unsigned long)gaps);
+            reported_gaps = gaps;
         }
     }
+}
 
+esp_err_t bsp_capture_add_sink(bsp_capture_sink_t sink, void *ctx)
+{
+    if (sink == nullptr)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    // 回调表只在启动前修改，采集任务读取时不需要加锁
+    if (capture_task_handle != nullptr)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (capture_sink_count >= BSP_CAPTURE_MAX_SINKS)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+    capture_sinks[capture_sink_count].func = sink;
+    capture_sinks[capture_sink_count].ctx = ctx;
+    capture_sink_count++;
+    return ESP_OK;
+}
+
+esp_err_t bsp_capture_start(int core, int priority)
+{
+    if (rx_handle == nullptr)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (capture_task_handle != nullptr)
+    {
+        return ESP_OK;
+    }
+
+    int depth = rx_dma_desc_num - 2;
+    if (depth < 1)
+    {
+        depth = 1;
+    }
+    if (depth > (int)(sizeof(capture_queue_storage) / sizeof(capture_queue_storage[0])))
+    {
+        depth = sizeof(capture_queue_storage) / sizeof(capture_queue_storage[0]);
+    }
+    capture_queue = xQueueCreateStatic(depth, sizeof(bsp_capture_block_t), (uint8_t*)capture_queue_storage,
+                                       &capture_queue_struct);
+
+    // 回调只能在通道停止时注册
+    esp_err_t ret = i2s_channel_disable(rx_handle);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "❌ 停止I2S接收通道失败: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    i2s_event_callbacks_t cbs = {};
+    cbs.on_recv = bsp_on_recv;
+    ret = i2s_channel_register_event_callback(rx_handle, &cbs, nullptr);
+    rx_last_isr_us = 0;
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "❌ 注册I2S接收回调失败: %s", esp_err_to_name(ret));
+        i2s_channel_enable(rx_handle);
+        return ret;
+    }
+
+    TaskFunction_t capture_task = SampleFormats::visit(rx_bits_per_chan, rx_channels, [](auto format) -> TaskFunction_t {
+        return bsp_capture_task<typename decltype(format)::Sample>;
+    });
+    if (TaskFactory::create(capture_task, "i2s_capture", I2S_CAPTURE_TASK_STACK, nullptr, priority,
+                            &capture_task_handle, core, TaskStack::INTERNAL) != pdPASS)
+    {
+        ESP_LOGE(TAG, "❌ 创建采集任务失败");
+        return ESP_ERR_NO_MEM;
+    }
+
+    ret = i2s_channel_enable(rx_handle);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "❌ 重新启用I2S接收通道失败: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    Supervisor::enter(Watch::CAPTURE);
+    ESP_LOGI(TAG, "🎙️ 采集任务已启动: %d个回调, 队列深度%d", capture_sink_count, depth);
+    return ESP_OK;
+}
+
+/**
+ * @brief 重启接收通道：停住DMA、清掉队列里的旧块，再重新启用（中断回调和采集任务不变）
+ */
+esp_err_t bsp_capture_restart(void)
+{
+    if (rx_handle == nullptr || capture_task_handle == nullptr)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    // 队列是满的说明中断还在送块、是采集任务自己卡在回调里，重启通道没有用
+    if (uxQueueSpacesAvailable(capture_queue) == 0)
+    {
+        ESP_LOGE(TAG, "❌ 采集任务没有在取DMA块");
+        return ESP_ERR_INVALID_STATE;
+    }
+    int64_t start_us = esp_timer_get_time();
+    i2s_channel_disable(rx_handle);
+    xQueueReset(capture_queue);
+    rx_last_isr_us = 0;     // 停住的这段不算漏块
+    esp_err_t ret = i2s_channel_enable(rx_handle);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "❌ 重新启用I2S接收通道失败: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    ESP_LOGW(TAG, "🔁 I2S接收通道已重启（%lu us）", (unsigned long)(esp_timer_get_time() - start_us));
     return ESP_OK;
 }
 
 /**
  * @brief 🎵 获取音频输入通道数
  *
- * 返回当前麦克风的声道数。
- * 我们使用单声道，节省资源且足够语音识别使用。
+ * 返回当前麦克风的声道数。双麦克风时采集回调收到的是左右交织的样本，
+ * count是两个声道的样本总数。
  *
- * @return int 通道数（1=单声道）
+ * @return int 通道数（1=单麦克风，2=双麦克风）
  */
 int bsp_get_feed_channel(void)
 {
-    return CHANNELS;
+    return rx_channels;
+}
+
+/**
+ * @brief 📏 获取每个麦克风样本在I2S中占用的字节数
+ *
+ * @return int 2（16位采集）或4（32位采集）
+ */
+int bsp_get_feed_sample_bytes(void)
+{
+    return rx_bits_per_chan / 8;
+}
+
+/**
+ * @brief 发送通道的槽位配置（初始化和运行时切换格式共用）
+ *
+ * 单声道时数据只发到左声道（修复杂音问题）。全双工时槽位宽和WS宽度固定为采集的槽位宽，
+ * BCLK才和采集一致，16位数据左对齐放在32位槽里。
+ */
+static i2s_std_slot_config_t bsp_tx_slot_config(int bits_per_chan, int channel_format)
+{
+    i2s_data_bit_width_t bit_width = (bits_per_chan == 32) ? I2S_DATA_BIT_WIDTH_32BIT : I2S_DATA_BIT_WIDTH_16BIT;
+    i2s_std_slot_config_t slot_cfg = I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(bit_width, (channel_format == 1) ? I2S_SLOT_MODE_MONO : I2S_SLOT_MODE_STEREO);
+    if (channel_format == 1)
+    {
+        slot_cfg.slot_mode = I2S_SLOT_MODE_MONO;
+        slot_cfg.slot_mask = I2S_STD_SLOT_LEFT;
+    }
+#if I2S_FULL_DUPLEX
+    slot_cfg.slot_bit_width = (i2s_slot_bit_width_t)rx_bits_per_chan;
+    slot_cfg.ws_width = (uint32_t)rx_bits_per_chan;
+#endif
+    return slot_cfg;
 }
 
 /**
@@ -270,36 +779,41 @@ int bsp_get_feed_channel(void)
  * @param sample_rate 采样率（Hz）
  * @param channel_format 声道数（1=单声道，2=立体声）
  * @param bits_per_chan 每个采样点的位数（16或32）
+ * @param dma_desc_num DMA描述符数量（0=驱动默认）
+ * @param dma_frame_num 每个DMA描述符的帧数，推荐等于（或整除）播放块大小（0=驱动默认）
  * @return esp_err_t 初始化结果
  */
-esp_err_t bsp_audio_init(uint32_t sample_rate, int channel_format, int bits_per_chan)
+/**
+ * @brief 创建、配置并启用I2S发送通道（初始化和热重启共用，调用方负责功放和锁）
+ */
+static esp_err_t bsp_tx_channel_create(uint32_t sample_rate, int channel_format, int bits_per_chan,
+                                       int dma_desc_num, int dma_frame_num)
 {
     esp_err_t ret = ESP_OK;
 
-    // 🔌 初始化MAX98357A的SD引脚（控制功放开关）
-    gpio_config_t io_conf = {
-        .pin_bit_mask = (1ULL << I2S_OUT_SD_PIN),
-        .mode = GPIO_MODE_OUTPUT,
-        .pull_up_en = GPIO_PULLUP_DISABLE,
-        .pull_down_en = GPIO_PULLDOWN_DISABLE,
-        .intr_type = GPIO_INTR_DISABLE
-    };
-    gpio_config(&io_conf);
-    gpio_set_level(I2S_OUT_SD_PIN, 1); // 高电平启用功放
-    ESP_LOGI(TAG, "✅ MAX98357A SD引脚已初始化（GPIO%d）", I2S_OUT_SD_PIN);
-
     // 🔧 创建I2S发送通道配置
     // ESP32作为主机（Master），提供时钟信号给功放
     i2s_chan_config_t chan_cfg = I2S_CHANNEL_DEFAULT_CONFIG(I2S_PORT_TX, I2S_ROLE_MASTER);
+    bsp_apply_dma_config(&chan_cfg, dma_desc_num, dma_frame_num, bits_per_chan / 8 * channel_format, "播放");
+    // 没有数据可发时DMA自动输出静音，功放保持余温期间不需要手动喂零
+    chan_cfg.auto_clear = true;
     ret = i2s_new_channel(&chan_cfg, &tx_handle, nullptr);
     if (ret != ESP_OK)
     {
         ESP_LOGE(TAG, "❌ 创建I2S发送通道失败: %s", esp_err_to_name(ret));
         return ret;
     }
+    tx_dma_desc_num = (int)chan_cfg.dma_desc_num;
+    tx_dma_frame_num = chan_cfg.dma_frame_num;
+    return bsp_tx_channel_setup(sample_rate, channel_format, bits_per_chan);
+}
 
-    // 🎯 确定数据位宽度
-    i2s_data_bit_width_t bit_width = (bits_per_chan == 32) ? I2S_DATA_BIT_WIDTH_32BIT : I2S_DATA_BIT_WIDTH_16BIT;
+/**
+ * @brief 配置并启用已经创建的I2S发送通道（单独创建或全双工时和接收通道一起创建）
+ */
+static esp_err_t bsp_tx_channel_setup(uint32_t sample_rate, int channel_format, int bits_per_chan)
+{
+    esp_err_t ret = ESP_OK;
 
     // 🎶 配置I2S标准模式（专门为MAX98357A优化）
     i2s_std_config_t std_cfg = {
@@ -310,13 +824,20 @@ esp_err_t bsp_audio_init(uint32_t sample_rate, int channel_format, int bits_per_
             .mclk_multiple = I2S_MCLK_MULTIPLE_256,
             .bclk_div = 0,  // 自动计算
         },
-        .slot_cfg = I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(bit_width, (channel_format == 1) ? I2S_SLOT_MODE_MONO : I2S_SLOT_MODE_STEREO),
+        .slot_cfg = bsp_tx_slot_config(bits_per_chan, channel_format),
         .gpio_cfg = {
             .mclk = I2S_GPIO_UNUSED,   // MCLK：MAX98357A不需要主时钟
+#if I2S_FULL_DUPLEX
+            .bclk = I2S_SCK_PIN,       // BCLK：和麦克风的SCK共用→ GPIO5
+            .ws = I2S_WS_PIN,          // LRC：和麦克风的WS共用→ GPIO4
+            .dout = I2S_OUT_DIN_PIN,   // DIN：数据输出→ GPIO7
+            .din = I2S_SD_PIN,         // 麦克风数据，和接收通道的GPIO配置相同
+#else
             .bclk = I2S_OUT_BCLK_PIN,  // BCLK：位时钟→ GPIO15
             .ws = I2S_OUT_LRC_PIN,     // LRC：左右声道时钟→ GPIO16
             .dout = I2S_OUT_DIN_PIN,   // DIN：数据输出→ GPIO7
             .din = I2S_GPIO_UNUSED,    // DIN：不需要（只播放不录音）
+#endif
             .invert_flags = {
                 .mclk_inv = false,     // 不反转主时钟
                 .bclk_inv = false,     // 不反转位时钟
@@ -325,11 +846,7 @@ esp_err_t bsp_audio_init(uint32_t sample_rate, int channel_format, int bits_per_
         },
     };
     
-    // 🔧 针对单声道的特殊配置（修复杂音问题）
     if (channel_format == 1) {
-        // 单声道配置：确保数据发送到正确的声道
-        std_cfg.slot_cfg.slot_mode = I2S_SLOT_MODE_MONO;
-        std_cfg.slot_cfg.slot_mask = I2S_STD_SLOT_LEFT;  // 使用左声道
         ESP_LOGI(TAG, "✅ 配置为单声道模式（左声道输出）");
     } else {
         ESP_LOGI(TAG, "✅ 配置为立体声模式");
@@ -343,6 +860,17 @@ esp_err_t bsp_audio_init(uint32_t sample_rate, int channel_format, int bits_per_
         return ret;
     }
 
+    // 发送完成中断只用来判断drain时DMA是否已经放空；发送队列溢出（应用没跟上，DMA开始送auto_clear的静音）记欠载
+    i2s_event_callbacks_t cbs = {};
+    cbs.on_sent = bsp_on_sent;
+    cbs.on_send_q_ovf = bsp_on_send_q_ovf;
+    ret = i2s_channel_register_event_callback(tx_handle, &cbs, nullptr);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "❌ 注册I2S发送回调失败: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
     // ▶️ 启用I2S发送通道开始播放数据
     ret = i2s_channel_enable(tx_handle);
     if (ret != ESP_OK)
@@ -351,248 +879,704 @@ esp_err_t bsp_audio_init(uint32_t sample_rate, int channel_format, int bits_per_
         return ret;
     }
 
+    return ESP_OK;
+}
+
+esp_err_t bsp_audio_init(uint32_t sample_rate, int channel_format, int bits_per_chan,
+                         int dma_desc_num, int dma_frame_num)
+{
+    esp_err_t ret = ESP_OK;
+
+    // 🔌 初始化MAX98357A的SD引脚（控制功放开关）
+    gpio_config_t io_conf = {
+        .pin_bit_mask = (1ULL << I2S_OUT_SD_PIN),
+        .mode = GPIO_MODE_OUTPUT,
+        .pull_up_en = GPIO_PULLUP_DISABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .intr_type = GPIO_INTR_DISABLE
+    };
+    gpio_config(&io_conf);
+    gpio_set_level(I2S_OUT_SD_PIN, 1); // 高电平启用功放
+    amp_powered = true;
+    ESP_LOGI(TAG, "✅ MAX98357A SD引脚已初始化（GPIO%d）", I2S_OUT_SD_PIN);
+
+    // 🔌 功放电源管理用的锁和定时器
+    amp_lock = xSemaphoreCreateMutexStatic(&amp_lock_struct);
+    tx_sent_sem = xSemaphoreCreateBinaryStatic(&tx_sent_sem_struct);
+    const esp_timer_create_args_t amp_timer_args = {
+        .callback = bsp_amp_timer_cb,
+        .arg = nullptr,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "amp_idle",
+        .skip_unhandled_events = true,
+    };
+    if (amp_lock == nullptr || tx_sent_sem == nullptr || esp_timer_create(&amp_timer_args, &amp_timer) != ESP_OK)
+    {
+        ESP_LOGE(TAG, "❌ 创建功放电源管理定时器失败");
+        return ESP_ERR_NO_MEM;
+    }
+
+#if I2S_FULL_DUPLEX
+    // 🔗 发送通道已经在bsp_board_init里和接收通道一起创建并启用，DMA配置跟着采集走
+    if (tx_handle == nullptr)
+    {
+        ESP_LOGE(TAG, "❌ 全双工模式要先调用bsp_board_init");
+        return ESP_ERR_INVALID_STATE;
+    }
+    if ((dma_desc_num > 0 && dma_desc_num != tx_dma_desc_num) ||
+        (dma_frame_num > 0 && (uint32_t)dma_frame_num != tx_dma_frame_num))
+    {
+        ESP_LOGW(TAG, "⚠️ 全双工时收发共用DMA配置，忽略播放的%d×%d，沿用%d个描述符 × %lu帧",
+                 dma_desc_num, dma_frame_num, tx_dma_desc_num, (unsigned long)tx_dma_frame_num);
+    }
+    // 采样率和采集不同时返回ESP_ERR_NOT_SUPPORTED；位宽/声道数不同时原地改槽位
+    ret = bsp_audio_set_format(sample_rate, bits_per_chan, channel_format);
+    if (ret != ESP_OK)
+    {
+        return ret;
+    }
+#else
+    ret = bsp_tx_channel_create(sample_rate, channel_format, bits_per_chan, dma_desc_num, dma_frame_num);
+    if (ret != ESP_OK)
+    {
+        return ret;
+    }
+
     // 🟢 设置通道状态标志
     tx_channel_enabled = true;
+    tx_sample_rate = sample_rate;
+    tx_bits_per_chan = bits_per_chan;
+    tx_channel_format = channel_format;
+#endif
+    // 启动后一直不播放的话，余温期过后自动断电
+    xSemaphoreTake(amp_lock, portMAX_DELAY);
+    bsp_sink_close_locked(AMP_LINGER_MS);
+    xSemaphoreGive(amp_lock);
 
     ESP_LOGI(TAG, "✅ I2S音频播放初始化成功");
     return ESP_OK;
 }
 
 /**
- * @brief 通过 I2S 播放音频数据
+ * @brief I2S发送队列溢出中断回调：全部描述符都送完了还没有新数据，DMA开始重复送清零的缓冲区
  *
- * 这个函数将音频数据发送到 MAX98357A 功放进行播放：
- * 1. 将音频数据写入 I2S 发送通道
- * 2. 确保数据完全发送
- *
- * @param audio_data 指向音频数据的指针
- * @param data_len 音频数据长度（字节）
- * @return esp_err_t 播放结果
+ * 通道在整个余温期都启用着，空闲时每个描述符都会溢出一次，所以只在写入期间的第一次记欠载。
  */
-esp_err_t bsp_play_audio(const uint8_t *audio_data, size_t data_len)
+static bool IRAM_ATTR bsp_on_send_q_ovf(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx)
 {
-    esp_err_t ret = ESP_OK;
-    size_t bytes_written = 0;
-    size_t total_written = 0;
-
-    if (tx_handle == nullptr)
+    if (tx_fed)
     {
-        ESP_LOGE(TAG, "❌ I2S发送通道未初始化");
-        return ESP_ERR_INVALID_STATE;
+        tx_fed = false;
+        tx_dma_underruns = tx_dma_underruns + 1;
     }
+    return false;
+}
 
-    if (audio_data == nullptr || data_len == 0)
+/**
+ * @brief I2S发送完成中断回调：数一数DMA送出去的描述符，drain靠它判断数据已经播完；
+ * 同时记下刚送完的描述符，打断时据此估计正在播的样本
+ *
+ * auto_clear在回调之后才清零缓冲区，这里还能读到刚送完的数据。
+ */
+static bool IRAM_ATTR bsp_on_sent(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx)
+{
+    tx_descs_sent = tx_descs_sent + 1;
+    void *buf = event->dma_buf;
+    if (buf != nullptr && event->size >= 4)
     {
-        ESP_LOGE(TAG, "❌ 无效的音频数据");
-        return ESP_ERR_INVALID_ARG;
+        // 第一声道的最后一个样本，统一成16位
+        int32_t sample;
+        if (tx_bits_per_chan == 32)
+        {
+            sample = ((const int32_t *)((const uint8_t *)buf + event->size) - tx_channel_format)[0] >> 16;
+        }
+        else
+        {
+            sample = ((const int16_t *)((const uint8_t *)buf + event->size) - tx_channel_format)[0];
+        }
+        int known = tx_desc_known;
+        if (known < tx_dma_desc_num && known < BSP_TX_MAX_DESC)
+        {
+            bool seen = false;
+            for (int i = 0; i < known; i++)
+            {
+                seen = seen || tx_desc_bufs[i] == buf;
+            }
+            if (!seen)
+            {
+                tx_desc_bufs[known] = buf;
+                tx_desc_known = known + 1;
+            }
+        }
+        portENTER_CRITICAL_ISR(&tx_sent_lock);
+        tx_last_sent_sample = sample;
+        tx_last_sent_buf = buf;
+        tx_last_sent_us = esp_timer_get_time();
+        portEXIT_CRITICAL_ISR(&tx_sent_lock);
     }
+    BaseType_t need_yield = pdFALSE;
+    if (tx_drain_waiting)
+    {
+        xSemaphoreGiveFromISR(tx_sent_sem, &need_yield);
+    }
+    return need_yield == pdTRUE;
+}
 
-    // 确保 I2S 发送通道已启用（如果之前被停止了）
-    if (!tx_channel_enabled)
+/**
+ * @brief 估计DMA正在播的样本（调用方持有amp_lock，通道启用着）
+ *
+ * 刚送完的描述符的下一个就是正在播的，按距离中断的时间算出播到了第几帧。
+ * 描述符的回转顺序还没记全时退回刚送完的最后一个样本（最多差一个描述符的时长）。
+ */
+static int32_t bsp_tx_current_sample(void)
+{
+    int64_t now_us = esp_timer_get_time();
+    portENTER_CRITICAL(&tx_sent_lock);
+    void *last = tx_last_sent_buf;
+    int64_t sent_us = tx_last_sent_us;
+    int32_t fallback = tx_last_sent_sample;
+    portEXIT_CRITICAL(&tx_sent_lock);
+
+    int known = tx_desc_known;
+    if (last == nullptr || known < tx_dma_desc_num)
     {
-        // 先启用功放
-        gpio_set_level(I2S_OUT_SD_PIN, 1); // 高电平启用功放
-        vTaskDelay(pdMS_TO_TICKS(10)); // 等待功放启动
-        ESP_LOGD(TAG, "✅ MAX98357A功放已启用");
-        
-        ret = i2s_channel_enable(tx_handle);
-        if (ret != ESP_OK)
+        return fallback;
+    }
+    const uint8_t *current = nullptr;
+    for (int i = 0; i < known; i++)
+    {
+        if (tx_desc_bufs[i] == last)
         {
-            ESP_LOGE(TAG, "❌ 启用I2S发送通道失败: %s", esp_err_to_name(ret));
-            return ret;
+            current = (const uint8_t *)tx_desc_bufs[(i + 1) % known];
+            break;
         }
-        tx_channel_enabled = true;
-        ESP_LOGD(TAG, "✅ I2S发送通道已重新启用");
-        
-        // 发送一小段静音数据来初始化通道
-        const size_t init_silence_size = 256; // 减小到256字节，避免大量内存分配
-        static uint8_t init_silence[256] = {0}; // 使用静态数组，避免动态分配
-        size_t silence_written = 0;
-        i2s_channel_write(tx_handle, init_silence, init_silence_size, &silence_written, pdMS_TO_TICKS(10));
     }
-
-    // 循环写入音频数据，确保所有数据都被发送
-    while (total_written < data_len)
+    if (current == nullptr)
+    {
+        return fallback;
+    }
+    uint64_t frame = (uint64_t)(now_us - sent_us) * tx_sample_rate / 1000000;
+    if (frame >= tx_dma_frame_num)
     {
-        size_t bytes_to_write = data_len - total_written;
-        
-        // 将音频数据写入 I2S 发送通道
-        ret = i2s_channel_write(tx_handle, audio_data + total_written, bytes_to_write, &bytes_written, portMAX_DELAY);
+        frame = tx_dma_frame_num - 1;
+    }
+    return SampleFormats::visit(tx_bits_per_chan, tx_channel_format, [&](auto format) -> int32_t {
+        using Format = decltype(format);
+        using Sample = typename Format::Sample;
+        return SampleTraits<Sample>::toS16(*(const Sample *)(current + frame * Format::frame_bytes));
+    });
+}
 
-        if (ret != ESP_OK)
+/**
+ * @brief 打断淡出的一块：每个声道同样的值，从level线性降到0，之后全是0
+ *
+ * @param frame 整个淡出里的帧序号，写完这一块后前移
+ * @return 写入的字节数（整帧）
+ */
+template <typename Format>
+static size_t bsp_fill_fade(void *block, size_t block_bytes, int32_t level, uint32_t *frame, uint32_t fade_frames)
+{
+    using Sample = typename Format::Sample;
+    Sample *out = static_cast<Sample *>(block);
+    const size_t frames = block_bytes / Format::frame_bytes;
+    for (size_t i = 0; i < frames; i++, (*frame)++)
+    {
+        int32_t value = *frame < fade_frames ? (int32_t)((int64_t)level * (fade_frames - *frame) / fade_frames) : 0;
+        for (int c = 0; c < Format::channels; c++)
         {
-            ESP_LOGE(TAG, "❌ 写入I2S音频数据失败: %s", esp_err_to_name(ret));
-            break;
+            out[i * Format::channels + c] = SampleTraits<Sample>::fromS16((int16_t)value);
         }
+    }
+    return frames * Format::frame_bytes;
+}
 
-        total_written += bytes_written;
+/**
+ * @brief 🔌 功放电源管理定时器回调（在esp_timer任务中运行，不阻塞）
+ *
+ * 分两步断电：先拉低SD关闭功放，等功放完全静音后再禁用I2S发送通道。
+ * 写入正在进行时拿不到锁，稍后重试。
+ */
+static void bsp_amp_timer_cb(void *arg)
+{
+    if (!amp_release_pending)
+    {
+        return;
+    }
+    if (xSemaphoreTake(amp_lock, 0) != pdTRUE)
+    {
+        esp_timer_start_once(amp_timer, 10 * 1000);
+        return;
+    }
 
-        // 显示播放进度（每10KB显示一次）
-        if ((total_written % 10240) < bytes_written)
+    if (amp_release_pending)
+    {
+        if (amp_powered)
+        {
+            // 🔇 第一步：关闭功放，I2S继续输出静音，等功放完全关闭
+            gpio_set_level(I2S_OUT_SD_PIN, 0);
+            amp_powered = false;
+            ESP_LOGI(TAG, "🔇 MAX98357A功放已关闭");
+            esp_timer_start_once(amp_timer, AMP_OFF_SETTLE_MS * 1000);
+        }
+        else if (tx_channel_enabled && !I2S_FULL_DUPLEX)
+        {
+            // 🛑️ 第二步：禁用I2S发送通道（全双工时采集靠它的BCLK/WS，一直开着输出静音）
+            esp_err_t ret = i2s_channel_disable(tx_handle);
+            if (ret == ESP_OK)
+            {
+                tx_channel_enabled = false;
+                ESP_LOGI(TAG, "✅ I2S音频输出已停止");
+            }
+            else
+            {
+                ESP_LOGE(TAG, "❌ 禁用I2S发送通道失败: %s", esp_err_to_name(ret));
+            }
+            amp_release_pending = false;
+        }
+        else
         {
-            ESP_LOGD(TAG, "音频播放进度: %zu/%zu 字节 (%.1f%%)", 
-                     total_written, data_len, (float)total_written * 100.0f / data_len);
+            amp_release_pending = false;
         }
     }
 
-    if (total_written != data_len)
+    xSemaphoreGive(amp_lock);
+}
+
+/**
+ * @brief 打开播放输出（调用方持有amp_lock）
+ *
+ * 通道停着但功放开着（切换格式后）时不启用通道，由下一次写入预加载后启用。
+ */
+static esp_err_t bsp_sink_open_locked(void)
+{
+    // 取消正在进行的断电流程
+    amp_release_pending = false;
+    esp_timer_stop(amp_timer);
+    if (tx_sink_open)
     {
-        ESP_LOGW(TAG, "音频数据写入不完整: 预期 %zu 字节，实际写入 %zu 字节", data_len, total_written);
-        return ESP_FAIL;
+        return ESP_OK;
     }
 
-    // 播放完成后停止I2S输出以防止噪音
-    // 注意：增加延迟确保音频完全播放完成
-    vTaskDelay(pdMS_TO_TICKS(10));
-    esp_err_t stop_ret = bsp_audio_stop();
-    if (stop_ret != ESP_OK)
+    int64_t start_us = esp_timer_get_time();
+    bool cold = !amp_powered;
+    if (!tx_channel_enabled && cold)
     {
-        ESP_LOGW(TAG, "停止音频输出时出现警告: %s", esp_err_to_name(stop_ret));
+        esp_err_t ret = i2s_channel_enable(tx_handle);
+        if (ret != ESP_OK)
+        {
+            ESP_LOGE(TAG, "❌ 启用I2S发送通道失败: %s", esp_err_to_name(ret));
+            return ret;
+        }
+        tx_channel_enabled = true;
+        ESP_LOGD(TAG, "✅ I2S发送通道已重新启用");
     }
 
-    ESP_LOGI(TAG, "音频播放完成，播放了 %zu 字节", total_written);
+    if (cold)
+    {
+        // 冷启动：先让I2S输出静音（auto_clear），再打开功放等它稳定
+        gpio_set_level(I2S_OUT_SD_PIN, 1);
+        amp_powered = true;
+        vTaskDelay(pdMS_TO_TICKS(AMP_WAKEUP_MS));
+        uint32_t open_us = (uint32_t)(esp_timer_get_time() - start_us);
+        PerfCounters::noteMax(PerfGauge::AMP_WAKE_MAX_US, open_us);
+        ESP_LOGD(TAG, "✅ MAX98357A功放已启用（%lu us）", (unsigned long)open_us);
+    }
+    tx_sink_open = true;
     return ESP_OK;
 }
 
 /**
- * @brief 通过 I2S 播放音频数据（流式版本，不停止I2S）
- *
- * 这个函数与 bsp_play_audio 类似，但不会在播放完成后停止I2S，
- * 适用于连续播放多个音频块的流式场景。
- *
- * @param audio_data 指向音频数据的指针
- * @param data_len 音频数据长度（字节）
- * @return esp_err_t 播放结果
+ * @brief 关闭播放输出，delay_ms后开始断电流程（调用方持有amp_lock）
  */
-esp_err_t bsp_play_audio_stream(const uint8_t *audio_data, size_t data_len)
+static void bsp_sink_close_locked(uint32_t delay_ms)
 {
-    esp_err_t ret = ESP_OK;
-    size_t bytes_written = 0;
-    size_t total_written = 0;
+    tx_sink_open = false;
+    if (tx_channel_enabled || amp_powered)
+    {
+        amp_release_pending = true;
+        esp_timer_stop(amp_timer);
+        esp_timer_start_once(amp_timer, (uint64_t)delay_ms * 1000);
+    }
+}
 
-    if (tx_handle == nullptr)
+esp_err_t bsp_audio_sink_open(void)
+{
+    if (tx_handle == nullptr || amp_lock == nullptr)
     {
-        ESP_LOGE(TAG, "❌ I2S发送通道未初始化");
         return ESP_ERR_INVALID_STATE;
     }
+    xSemaphoreTake(amp_lock, portMAX_DELAY);
+    esp_err_t ret = bsp_sink_open_locked();
+    xSemaphoreGive(amp_lock);
+    return ret;
+}
 
-    if (audio_data == nullptr || data_len == 0)
+/**
+ * @brief 写入播放数据：通道停着时先预加载再启用，其余部分按timeout_ms阻塞写入
+ */
+esp_err_t AUDIO_HOT_IRAM bsp_audio_sink_write(const void *data, size_t len, size_t *written, uint32_t timeout_ms)
+{
+    if (written != nullptr)
+    {
+        *written = 0;
+    }
+    if (tx_handle == nullptr || amp_lock == nullptr)
+    {
+        ESP_LOGE(TAG, "❌ I2S发送通道未初始化");
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (data == nullptr || len == 0)
     {
         ESP_LOGE(TAG, "❌ 无效的音频数据");
         return ESP_ERR_INVALID_ARG;
     }
 
-    // 确保 I2S 发送通道已启用（如果之前被停止了）
+    // 锁也只等timeout_ms：打断或切换格式正占着时按超时返回，由调用方决定重试还是丢掉
+    TickType_t lock_wait = timeout_ms == portMAX_DELAY ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    if (xSemaphoreTake(amp_lock, lock_wait) != pdTRUE)
+    {
+        PerfCounters::add(PerfCounter::I2S_LOCK_TIMEOUTS);
+        FLIGHT_RECORD(I2S_LOCK_TIMEOUT);
+        return ESP_ERR_TIMEOUT;
+    }
+    esp_err_t ret = bsp_sink_open_locked();
+    if (ret != ESP_OK)
+    {
+        xSemaphoreGive(amp_lock);
+        return ret;
+    }
+
+    const uint8_t *src = (const uint8_t *)data;
+    size_t total = 0;
     if (!tx_channel_enabled)
     {
-        // 先启用功放
-        gpio_set_level(I2S_OUT_SD_PIN, 1); // 高电平启用功放
-        vTaskDelay(pdMS_TO_TICKS(10)); // 等待功放启动
-        ESP_LOGD(TAG, "✅ MAX98357A功放已启用");
-        
-        ret = i2s_channel_enable(tx_handle);
+        // ▶️ 数据先装进DMA再启用，第一块从DMA开头播出
+        size_t loaded = 0;
+        ret = i2s_channel_preload_data(tx_handle, src, len, &loaded);
+        if (ret == ESP_OK)
+        {
+            total = loaded;
+            PerfCounters::add(PerfCounter::I2S_PRELOAD_BYTES, (uint32_t)loaded);
+            ret = i2s_channel_enable(tx_handle);
+        }
         if (ret != ESP_OK)
         {
-            ESP_LOGE(TAG, "❌ 启用I2S发送通道失败: %s", esp_err_to_name(ret));
+            ESP_LOGE(TAG, "❌ 预加载并启用I2S发送通道失败: %s", esp_err_to_name(ret));
+            xSemaphoreGive(amp_lock);
             return ret;
         }
         tx_channel_enabled = true;
-        ESP_LOGD(TAG, "✅ I2S发送通道已重新启用");
-        
-        // 发送一小段静音数据来初始化通道
-        const size_t init_silence_size = 256; // 减小到256字节，避免大量内存分配
-        static uint8_t init_silence[256] = {0}; // 使用静态数组，避免动态分配
-        size_t silence_written = 0;
-        i2s_channel_write(tx_handle, init_silence, init_silence_size, &silence_written, pdMS_TO_TICKS(10));
     }
 
-    // 循环写入音频数据，确保所有数据都被发送
-    while (total_written < data_len)
+    if (total < len)
+    {
+        size_t bytes_written = 0;
+        SCHED_TRACE_BEGIN(I2S_WRITE, len - total);
+        {
+            SCOPE_TIMER(I2S_WRITE);
+            ret = i2s_channel_write(tx_handle, src + total, len - total, &bytes_written, timeout_ms);
+        }
+        SCHED_TRACE_END(I2S_WRITE, bytes_written);
+        total += bytes_written;
+    }
+    tx_last_write_descs = tx_descs_sent;
+    if (total > 0)
+    {
+        tx_fed = true;
+    }
+    uint32_t underruns = tx_dma_underruns;
+    if (underruns != tx_dma_underruns_seen)
+    {
+        PerfCounters::add(PerfCounter::I2S_DMA_UNDERRUNS, underruns - tx_dma_underruns_seen);
+        FLIGHT_RECORD(I2S_DMA_UNDERRUN, underruns - tx_dma_underruns_seen);
+        tx_dma_underruns_seen = underruns;
+    }
+    xSemaphoreGive(amp_lock);
+
+    if (written != nullptr)
+    {
+        *written = total;
+    }
+    if (ret != ESP_OK && ret != ESP_ERR_TIMEOUT)
     {
-        size_t bytes_to_write = data_len - total_written;
-        
-        // 将音频数据写入 I2S 发送通道
-        ret = i2s_channel_write(tx_handle, audio_data + total_written, bytes_to_write, &bytes_written, portMAX_DELAY);
+        HOT_LOGW(TAG, "I2S写入失败: %zu/%zu 字节 (%s)", total, len, esp_err_to_name(ret));
+    }
+    return ret;
+}
 
+/**
+ * @brief 等DMA放空后进入余温期
+ *
+ * 最后一次写入返回时数据最多占满全部描述符，之后再送出tx_dma_desc_num个描述符就一定播完了。
+ */
+esp_err_t bsp_audio_sink_drain(uint32_t timeout_ms)
+{
+    if (tx_handle == nullptr || amp_lock == nullptr)
+    {
+        return ESP_OK;
+    }
+
+    esp_err_t ret = ESP_OK;
+    tx_fed = false;     // 回复结束，DMA接下来放空是正常的
+    if (tx_sink_open && tx_channel_enabled && timeout_ms > 0)
+    {
+        int64_t start_us = esp_timer_get_time();
+        int64_t deadline_us = timeout_ms == portMAX_DELAY ? INT64_MAX : start_us + (int64_t)timeout_ms * 1000;
+        xSemaphoreTake(tx_sent_sem, 0);
+        tx_drain_waiting = true;
+        while (tx_descs_sent - tx_last_write_descs < (uint32_t)tx_dma_desc_num)
+        {
+            int64_t now_us = esp_timer_get_time();
+            if (now_us >= deadline_us)
+            {
+                ret = ESP_ERR_TIMEOUT;
+                break;
+            }
+            TickType_t wait = deadline_us == INT64_MAX ? portMAX_DELAY
+                                                       : pdMS_TO_TICKS((deadline_us - now_us) / 1000) + 1;
+            xSemaphoreTake(tx_sent_sem, wait);
+        }
+        tx_drain_waiting = false;
+        PerfCounters::noteMax(PerfGauge::I2S_DRAIN_MAX_US, (uint32_t)(esp_timer_get_time() - start_us));
+    }
+
+    // 功放保持余温，下一段回复（或下一轮对话）可以立即开始
+    xSemaphoreTake(amp_lock, portMAX_DELAY);
+    bsp_sink_close_locked(AMP_LINGER_MS);
+    xSemaphoreGive(amp_lock);
+    return ret;
+}
+
+/**
+ * @brief 清空DMA并淡出：禁用通道 → 预加载淡出和静音盖住全部描述符 → 重新启用
+ *
+ * 禁用只是停住DMA，描述符里没播的旧数据还在，不盖掉的话重新启用后会接着播出来。
+ * 淡出按块生成，不占额外的缓冲区。
+ */
+esp_err_t bsp_audio_sink_abort(uint32_t fade_ms)
+{
+    if (tx_handle == nullptr || amp_lock == nullptr)
+    {
+        ESP_LOGW(TAG, "⚠️ I2S发送通道未初始化，无需停止");
+        return ESP_OK;
+    }
+
+    xSemaphoreTake(amp_lock, portMAX_DELAY);
+    int64_t start_us = esp_timer_get_time();
+    esp_err_t ret = ESP_OK;
+    tx_fed = false;
+    if (tx_channel_enabled)
+    {
+        int32_t level = amp_powered && fade_ms > 0 ? bsp_tx_current_sample() : 0;
+        ret = i2s_channel_disable(tx_handle);
         if (ret != ESP_OK)
         {
-            ESP_LOGE(TAG, "❌ 写入I2S音频数据失败: %s", esp_err_to_name(ret));
-            break;
+            ESP_LOGE(TAG, "❌ 禁用I2S发送通道失败: %s", esp_err_to_name(ret));
+            xSemaphoreGive(amp_lock);
+            return ret;
         }
+        tx_channel_enabled = false;
 
-        total_written += bytes_written;
+        // 每块64帧（立体声32位时512字节），淡出之后全是0，直到DMA装满
+        static int32_t block[64 * 2];
+        auto fill = SampleFormats::visit(tx_bits_per_chan, tx_channel_format,
+                                         [](auto format) { return &bsp_fill_fade<decltype(format)>; });
+        uint32_t fade_frames = (uint32_t)((uint64_t)tx_sample_rate * fade_ms / 1000);
+        uint32_t frame = 0;
+        size_t loaded = 0;
+        size_t bytes = 0;
+        do
+        {
+            bytes = fill(block, sizeof(block), level, &frame, fade_frames);
+            loaded = 0;
+            ret = i2s_channel_preload_data(tx_handle, block, bytes, &loaded);
+        } while (ret == ESP_OK && loaded == bytes);
 
-        // 显示播放进度（每10KB显示一次）
-        if ((total_written % 10240) < bytes_written)
+        if (ret == ESP_OK)
+        {
+            ret = i2s_channel_enable(tx_handle);
+        }
+        if (ret == ESP_OK)
         {
-            ESP_LOGD(TAG, "音频播放进度: %zu/%zu 字节 (%.1f%%)", 
-                     total_written, data_len, (float)total_written * 100.0f / data_len);
+            tx_channel_enabled = true;
+        }
+        else
+        {
+            ESP_LOGE(TAG, "❌ 清空后重新启用I2S发送通道失败: %s", esp_err_to_name(ret));
         }
     }
+    // 淡出之后DMA一直输出静音，功放保持余温
+    bsp_sink_close_locked(AMP_LINGER_MS);
+    uint32_t abort_us = (uint32_t)(esp_timer_get_time() - start_us);
+    xSemaphoreGive(amp_lock);
+
+    PerfCounters::noteMax(PerfGauge::I2S_ABORT_MAX_US, abort_us);
+    ESP_LOGI(TAG, "🛑️ 播放已清空（%lu us，淡出 %lu ms）", (unsigned long)abort_us, (unsigned long)fade_ms);
+    return ret;
+}
 
-    if (total_written != data_len)
+/**
+ * @brief 删掉发送通道按当前格式重新创建：DMA卡住时i2s_channel_disable/enable也救不回来，
+ *        重新分配描述符和中断最干净。GPIO、功放和格式都保持原样
+ */
+esp_err_t bsp_audio_sink_reset(void)
+{
+    if (tx_handle == nullptr || amp_lock == nullptr)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    // 写入每次只等一小段就放锁，拿不到说明持有者自己卡死了，这里救不了
+    if (xSemaphoreTake(amp_lock, pdMS_TO_TICKS(SUPERVISOR_LOCK_TIMEOUT_MS)) != pdTRUE)
     {
-        ESP_LOGW(TAG, "音频数据写入不完整: 预期 %zu 字节，实际写入 %zu 字节", data_len, total_written);
-        return ESP_FAIL;
+        ESP_LOGE(TAG, "❌ 热重启播放通道时拿不到锁");
+        return ESP_ERR_TIMEOUT;
     }
+    int64_t start_us = esp_timer_get_time();
+    if (tx_channel_enabled)
+    {
+        i2s_channel_disable(tx_handle);
+        tx_channel_enabled = false;
+    }
+#if !I2S_FULL_DUPLEX
+    i2s_del_channel(tx_handle);
+    tx_handle = nullptr;
+#endif
+    tx_fed = false;
+    tx_drain_waiting = false;
+    tx_desc_known = 0;
+    portENTER_CRITICAL(&tx_sent_lock);
+    tx_last_sent_buf = nullptr;
+    tx_last_sent_sample = 0;
+    portEXIT_CRITICAL(&tx_sent_lock);
 
-    // 注意：这里不调用 bsp_audio_stop()，保持I2S继续运行
-    ESP_LOGD(TAG, "流式音频块播放完成，播放了 %zu 字节", total_written);
-    return ESP_OK;
+#if I2S_FULL_DUPLEX
+    // 发送通道和接收通道是一起创建的，不能单独重建，只能停下再启用（DMA重新从第一个描述符开始）
+    esp_err_t ret = i2s_channel_enable(tx_handle);
+#else
+    esp_err_t ret = bsp_tx_channel_create(tx_sample_rate, tx_channel_format, tx_bits_per_chan,
+                                          tx_dma_desc_num, (int)tx_dma_frame_num);
+#endif
+    if (ret == ESP_OK)
+    {
+        tx_channel_enabled = true;
+    }
+    bsp_sink_close_locked(AMP_LINGER_MS);
+    uint32_t reset_us = (uint32_t)(esp_timer_get_time() - start_us);
+    xSemaphoreGive(amp_lock);
+
+    if (ret == ESP_OK)
+    {
+        ESP_LOGW(TAG, "🔁 I2S发送通道已重建（%lu us）", (unsigned long)reset_us);
+    }
+    else
+    {
+        ESP_LOGE(TAG, "❌ 重建I2S发送通道失败: %s", esp_err_to_name(ret));
+    }
+    return ret;
+}
+
+uint32_t bsp_audio_sink_latency_us(void)
+{
+    if (tx_sample_rate == 0)
+    {
+        return 0;
+    }
+    return (uint32_t)((uint64_t)tx_dma_desc_num * tx_dma_frame_num * 1000000 / tx_sample_rate);
 }
 
 /**
- * @brief 停止 I2S 音频输出以防止噪音
+ * @brief 运行时切换发送通道的采样率/位宽/声道数
  *
- * 这个函数会暂时禁用 I2S 发送通道，停止向 MAX98357A 发送数据，
- * 从而消除播放完成后的噪音。当需要再次播放音频时，
- * 可以重新启用通道。
+ * 拿amp_lock等正在进行的写入结束，通道启用时先禁用，原地调用
+ * i2s_channel_reconfig_std_clock/slot，再恢复原来的启用状态（播放输出打开着时留给下一次写入预加载后启用）。
+ * GPIO、DMA描述符和功放电源状态都不动，DMA里还没播完的数据会被丢弃。
  *
- * @return esp_err_t 停止结果
+ * @return esp_err_t 切换结果（格式没变时直接返回ESP_OK）
  */
-esp_err_t bsp_audio_stop(void)
+esp_err_t bsp_audio_set_format(uint32_t sample_rate, int bits_per_chan, int channel_format)
 {
-    esp_err_t ret = ESP_OK;
+    if (tx_handle == nullptr || amp_lock == nullptr)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (sample_rate == 0 || (bits_per_chan != 16 && bits_per_chan != 32) ||
+        (channel_format != 1 && channel_format != 2))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+#if I2S_FULL_DUPLEX
+    // 时钟是和采集共用的，只能改槽位；数据位宽不能超过采集的槽位宽
+    if (sample_rate != tx_sample_rate || bits_per_chan > rx_bits_per_chan)
+    {
+        ESP_LOGW(TAG, "⚠️ 全双工时播放只能用%luHz、不超过%d位，不支持%luHz/%d位",
+                 (unsigned long)tx_sample_rate, rx_bits_per_chan, (unsigned long)sample_rate, bits_per_chan);
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+#endif
 
-    if (tx_handle == nullptr)
+    xSemaphoreTake(amp_lock, portMAX_DELAY);
+    if (sample_rate == tx_sample_rate && bits_per_chan == tx_bits_per_chan && channel_format == tx_channel_format)
     {
-        ESP_LOGW(TAG, "⚠️ I2S发送通道未初始化，无需停止");
+        xSemaphoreGive(amp_lock);
         return ESP_OK;
     }
 
-    // 🟢 只有在通道启用时才禁用它
-    if (tx_channel_enabled)
+    bool was_enabled = tx_channel_enabled;
+    esp_err_t ret = ESP_OK;
+    if (was_enabled)
     {
-        // 🔇 立即发送一段静音数据来清空I2S缓冲区
-        const size_t silence_size = 512;
-        static uint8_t silence_data[512] = {0};
-        size_t bytes_written = 0;
-        i2s_channel_write(tx_handle, silence_data, silence_size, &bytes_written, pdMS_TO_TICKS(10));
-        
-        // 等待静音数据播放完成
-        vTaskDelay(pdMS_TO_TICKS(20));
-        
-        // 🔇 立即关闭功放，停止音频输出
-        gpio_set_level(I2S_OUT_SD_PIN, 0); // 低电平关闭功放
-        ESP_LOGI(TAG, "🔇 MAX98357A功放已关闭，停止音频输出");
-        
-        // 等待功放完全关闭
-        vTaskDelay(pdMS_TO_TICKS(100));
-        
-        // 🛑️ 禁用I2S发送通道
         ret = i2s_channel_disable(tx_handle);
         if (ret != ESP_OK)
         {
             ESP_LOGE(TAG, "❌ 禁用I2S发送通道失败: %s", esp_err_to_name(ret));
+            xSemaphoreGive(amp_lock);
             return ret;
         }
         tx_channel_enabled = false;
-        ESP_LOGI(TAG, "✅ I2S音频输出已停止");
+    }
+
+    i2s_std_clk_config_t clk_cfg = I2S_STD_CLK_DEFAULT_CONFIG(sample_rate);
+    i2s_std_slot_config_t slot_cfg = bsp_tx_slot_config(bits_per_chan, channel_format);
+    // 先改槽位再改时钟：BCLK分频按新的槽位宽计算（全双工时采样率和槽位宽都不变，不动时钟）
+    ret = i2s_channel_reconfig_std_slot(tx_handle, &slot_cfg);
+    if (ret == ESP_OK && !I2S_FULL_DUPLEX)
+    {
+        ret = i2s_channel_reconfig_std_clock(tx_handle, &clk_cfg);
+    }
+    if (ret == ESP_OK)
+    {
+        ESP_LOGI(TAG, "🔁 播放格式 %luHz/%d位/%d声道 → %luHz/%d位/%d声道",
+                 (unsigned long)tx_sample_rate, tx_bits_per_chan, tx_channel_format,
+                 (unsigned long)sample_rate, bits_per_chan, channel_format);
+        tx_sample_rate = sample_rate;
+        tx_bits_per_chan = bits_per_chan;
+        tx_channel_format = channel_format;
     }
     else
     {
-        ESP_LOGD(TAG, "ℹ️ I2S发送通道已经是禁用状态");
+        ESP_LOGE(TAG, "❌ 切换播放格式失败: %s", esp_err_to_name(ret));
     }
 
-    return ESP_OK;
+    // 播放输出打开着、功放开着时先停着，下一次写入预加载后再启用，新格式的第一块从DMA开头播出；
+    // 全双工时采集靠发送通道的时钟，马上启用
+    if (was_enabled && (I2S_FULL_DUPLEX || !(tx_sink_open && amp_powered)))
+    {
+        esp_err_t en = i2s_channel_enable(tx_handle);
+        if (en == ESP_OK)
+        {
+            tx_channel_enabled = true;
+        }
+        else
+        {
+            ESP_LOGE(TAG, "❌ 启用I2S发送通道失败: %s", esp_err_to_name(en));
+            ret = ret == ESP_OK ? en : ret;
+        }
+    }
+    xSemaphoreGive(amp_lock);
+    return ret;
+}
+
+uint32_t bsp_get_play_sample_rate(void)
+{
+    return tx_sample_rate;
 }
@@ -22,6 +22,8 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include "esp_err.h"
 #include "freertos/FreeRTOS.h"
 
@@ -39,40 +41,76 @@ extern "C" {
  *
  * @param sample_rate 采样率（推荐16000Hz，适合语音识别）
  * @param channel_format 声道数（1=单声道，2=立体声）
- * @param bits_per_chan 采样位数（16位=CD音质，32位=更高精度）
+ * @param bits_per_chan 采样位数（16位=只取高16位，32位=保留INMP441完整24位后收窄）
+ * @param dma_desc_num DMA描述符数量（0=使用驱动默认值）
+ * @param dma_frame_num 每个DMA描述符的帧数，与AFE的feed块对齐可以减少中断和不完整读取（0=默认）
  * @return
  *    - ESP_OK: ✅ 初始化成功
  *    - 其他值: ❌ 初始化失败
  */
-esp_err_t bsp_board_init(uint32_t sample_rate, int channel_format, int bits_per_chan);
+esp_err_t bsp_board_init(uint32_t sample_rate, int channel_format, int bits_per_chan,
+                         int dma_desc_num, int dma_frame_num);
 
 /**
- * @brief 🎤 从麦克风获取声音数据
+ * @brief 🎙️ 采集回调：每个DMA块调用一次
  *
- * 这个函数就像“录音”，让您能够：
- * - 读取麦克风捕捉到的声音
- * - 获得可以用于语音识别的数据
- * - 按照需要的长度读取数据
+ * samples直接指向DMA缓冲区（已收窄为16位并经过调理），只在回调期间有效，
+ * 需要保存的数据请自行拷贝。回调在采集任务中执行，不要长时间阻塞。
+ * 双麦克风时样本按左右声道交织，count是两个声道的样本总数（见bsp_get_feed_channel）。
+ */
+typedef void (*bsp_capture_sink_t)(const int16_t *samples, size_t count, void *ctx);
+
+/**
+ * @brief ➕ 注册采集回调（最多4个，必须在bsp_capture_start之前调用）
  *
- * @param is_get_raw_channel 是否获取原始数据（true=不处理，false=经过优化）
- * @param buffer 存储音频数据的数组（您提供的“录音带”）
- * @param buffer_len 数组大小（字节数）
  * @return
- *    - ESP_OK: ✅ 读取成功
- *    - 其他值: ❌ 读取失败
+ *    - ESP_OK: ✅ 注册成功
+ *    - ESP_ERR_INVALID_STATE: 采集已经启动
+ *    - ESP_ERR_NO_MEM: 回调数量已满
+ */
+esp_err_t bsp_capture_add_sink(bsp_capture_sink_t sink, void *ctx);
+
+/**
+ * @brief ▶️ 启动事件驱动采集
+ *
+ * 注册I2S接收完成回调并创建采集任务。此后麦克风只由采集任务读取，
+ * bsp_get_feed_data会返回ESP_ERR_INVALID_STATE。
+ *
+ * @param core 采集任务运行的核心
+ * @param priority 采集任务优先级
  */
-esp_err_t bsp_get_feed_data(bool is_get_raw_channel, int16_t *buffer, int buffer_len);
+esp_err_t bsp_capture_start(int core, int priority);
+
+/**
+ * @brief 🔁 重启接收通道（子系统看门狗在采集卡住时调用，见supervisor.h）
+ *
+ * 停住DMA、丢掉队列里没处理的块后重新启用，采集任务和回调不变。
+ *
+ * @return esp_err_t
+ *    - ESP_OK: ✅ 已重启
+ *    - ESP_ERR_INVALID_STATE: 没有启动采集，或者采集任务自己卡住了（队列是满的）
+ */
+esp_err_t bsp_capture_restart(void);
 
 /**
  * @brief 🎵 获取音频输入的声道数
  *
- * 告诉您麦克风是单声道还是立体声。
- * 目前我们使用单声道，节省内存和处理时间。
+ * 告诉您麦克风是单声道还是立体声（MIC_CHANNELS，见project_config.h）。
  *
  * @return 声道数（1=单声道，2=立体声）
  */
 int bsp_get_feed_channel(void);
 
+/**
+ * @brief 📏 获取每个麦克风样本在I2S中占用的字节数
+ *
+ * 采集任务的DMA块按这个宽度存放，收窄成16位后才交给回调；
+ * bsp_get_feed_data的缓冲区只按输出格式分配，和这个值无关。
+ *
+ * @return 2（16位采集）或4（32位采集）
+ */
+int bsp_get_feed_sample_bytes(void);
+
 /**
  * @brief 🔊 初始化音频播放功能
  *
@@ -84,58 +122,141 @@ int bsp_get_feed_channel(void);
  * @param sample_rate 采样率（推荐16000Hz，与录音保持一致）
  * @param channel_format 声道数（1=单声道，2=立体声）
  * @param bits_per_chan 采样位数（16位=标准音质）
+ * @param dma_desc_num DMA描述符数量（0=使用驱动默认值）
+ * @param dma_frame_num 每个DMA描述符的帧数，与播放块对齐（0=默认）
  * @return
  *    - ESP_OK: ✅ 初始化成功
  *    - 其他值: ❌ 初始化失败
  */
-esp_err_t bsp_audio_init(uint32_t sample_rate, int channel_format, int bits_per_chan);
+esp_err_t bsp_audio_init(uint32_t sample_rate, int channel_format, int bits_per_chan,
+                         int dma_desc_num, int dma_frame_num);
+
+/**
+ * @brief 🔊 打开播放输出
+ *
+ * 余温期内直接继续（没有任何等待）；功放已断电时启用I2S发送通道，DMA先输出静音，
+ * 再打开功放等AMP_WAKEUP_MS稳定。切换格式后通道停着、功放开着时，留到第一次写入：
+ * 先用i2s_channel_preload_data把数据装进DMA再启用通道，第一块从DMA开头播出，前面没有残留或静音。
+ * 重复调用无效果；bsp_audio_sink_write在没有打开时会自动打开。
+ *
+ * @return
+ *    - ESP_OK: ✅ 已打开
+ *    - ESP_ERR_INVALID_STATE: 播放还没有初始化
+ *    - 其他值: ❌ 启用通道失败
+ */
+esp_err_t bsp_audio_sink_open(void);
 
 /**
- * @brief 🎵 播放音频数据
+ * @brief 🌊 写入播放数据（PCM，格式见bsp_audio_set_format）
  *
- * 这个函数就像“播放器”，它会：
- * - 把您提供的音频数据发送给扬声器
- * - 播放完后自动停止（避免噪音）
- * - 适合播放完整的音频文件
+ * DMA描述符写满时阻塞，最多等timeout_ms（等播放输出的锁也算在内）；超时返回ESP_ERR_TIMEOUT，已写入的部分照常播放，
+ * 调用方按written决定剩下的数据是接着写还是丢弃（可以用很短的timeout_ms分几次写，中间检查打断请求）。
+ * 冷启动耗时、预加载字节、drain和abort耗时记在PerfCounters里（amp_wake_max_us等）。
+ * 发送通道配置了auto_clear，整个余温期都保持启用：写入跟不上时DMA输出静音而不是重复旧数据，
+ * 这种欠载记为i2s_dma_under（和抖动缓冲区没数据的underruns分开）。
  *
- * @param audio_data 音频数据的内存地址（PCM格式）
- * @param data_len 音频数据的大小（字节数）
+ * @param data PCM数据
+ * @param len 字节数
+ * @param written 实际写入的字节数（可以为NULL）
+ * @param timeout_ms 最多等待的毫秒数（portMAX_DELAY=一直等）
  * @return
- *    - ESP_OK: ✅ 播放成功
- *    - 其他值: ❌ 播放失败
+ *    - ESP_OK: ✅ 全部写入
+ *    - ESP_ERR_TIMEOUT: 只写入了一部分
+ *    - ESP_ERR_INVALID_ARG / ESP_ERR_INVALID_STATE: 参数无效或播放未初始化
  */
-esp_err_t bsp_play_audio(const uint8_t *audio_data, size_t data_len);
+esp_err_t bsp_audio_sink_write(const void *data, size_t len, size_t *written, uint32_t timeout_ms);
 
 /**
- * @brief 🌊 流式播放音频数据
+ * @brief 🌡️ 播放暂时结束：等已写入的数据播完，然后进入余温期
  *
- * 这个函数特别为“边下载边播放”设计：
- * - 播放完后不会停止I2S
- * - 可以连续播放多个音频片段
- * - 适合实时流媒体场景
+ * 最多等timeout_ms（0=不等），按发送完成中断计数判断DMA已经放空（最多多等一个DMA深度的静音）。
+ * 之后功放和I2S通道继续工作（DMA自动输出静音），AMP_LINGER_MS内没有新的播放才断电。
  *
- * @param audio_data 音频数据的内存地址（PCM格式）
- * @param data_len 音频数据的大小（字节数）
  * @return
- *    - ESP_OK: ✅ 播放成功
- *    - 其他值: ❌ 播放失败
+ *    - ESP_OK: ✅ 数据已经播完（或没有在等）
+ *    - ESP_ERR_TIMEOUT: 超时，余温期照常开始
  */
-esp_err_t bsp_play_audio_stream(const uint8_t *audio_data, size_t data_len);
+esp_err_t bsp_audio_sink_drain(uint32_t timeout_ms);
 
 /**
- * @brief 🛑️ 停止音频输出
+ * @brief 🛑️ 立即停止输出（打断、停止命令时使用），DMA里还没播的数据不再播出
  *
- * 这个函数可以：
- * - 立即停止音频播放
- * - 消除扬声器的噪音
- * - 关闭功放节省电量
+ * 禁用发送通道清掉DMA里排队的数据，按发送完成中断估计正在播的样本，预加载一段fade_ms长的
+ * 淡出（从这个电平线性降到0）和静音覆盖全部描述符后重新启用，整个过程不到1ms。
+ * 功放保持开着进入余温期，下一段回复不用重新唤醒。通道或功放没开着时不做淡出。
  *
+ * @param fade_ms 淡出时长（0=不淡出，直接静音）
+ * @return esp_err_t
+ *    - ESP_OK: ✅ 已停止
+ *    - 其他: 重新启用通道失败，通道保持禁用，下一次写入时重新启用
+ */
+esp_err_t bsp_audio_sink_abort(uint32_t fade_ms);
+
+/**
+ * @brief 🔁 重建I2S发送通道（子系统看门狗在播放卡住时调用，见supervisor.h）
+ *
+ * 按当前的采样率、位宽和DMA配置删掉再重新创建发送通道，排队的数据全部丢弃，功放进入余温期。
+ *
+ * @return esp_err_t
+ *    - ESP_OK: ✅ 已重建
+ *    - ESP_ERR_TIMEOUT: 写入方一直占着通道，重建不了
+ *    - 其他: 重新创建通道失败
+ */
+esp_err_t bsp_audio_sink_reset(void);
+
+/**
+ * @brief ⏱️ 播放输出的缓冲时延：写进去的数据最多要这么久才从扬声器出来（DMA深度，微秒）
+ */
+uint32_t bsp_audio_sink_latency_us(void);
+
+/**
+ * @brief 🔁 运行时切换播放格式（不重建I2S通道）
+ *
+ * 原地重新配置发送通道的时钟和槽位，GPIO和DMA描述符保持不变，
+ * 提示音或TTS可以按原始采样率直接播放，不需要重采样，也不需要重新bsp_audio_init()。
+ * 会等正在进行的写入结束；DMA里还没播完的数据被丢弃，应在两段音频之间调用
+ * （流式播放由AudioManager的播放任务统一切换）。播放输出打开着时通道先停着，
+ * 下一次bsp_audio_sink_write预加载后再启用。
+ *
+ * @param sample_rate 采样率（Hz）
+ * @param bits_per_chan 采样位数（16或32）
+ * @param channel_format 声道数（1=单声道，2=立体声）
  * @return
- *    - ESP_OK: ✅ 停止成功
- *    - 其他值: ❌ 停止失败
+ *    - ESP_OK: ✅ 切换成功（格式没有变化时什么都不做）
+ *    - ESP_ERR_INVALID_STATE: 播放还没有初始化
+ *    - ESP_ERR_INVALID_ARG: 参数不支持
+ *    - ESP_ERR_NOT_SUPPORTED: 全双工（I2S_FULL_DUPLEX）时采样率和采集不同，或位宽超过采集的槽位宽
  */
-esp_err_t bsp_audio_stop(void);
+esp_err_t bsp_audio_set_format(uint32_t sample_rate, int bits_per_chan, int channel_format);
+
+/**
+ * @brief 📏 获取播放通道当前的采样率（未初始化时为0）
+ */
+uint32_t bsp_get_play_sample_rate(void);
 
 #ifdef __cplusplus
 }
+
+/**
+ * @brief 🎤 从麦克风获取声音数据
+ *
+ * 这个函数就像“录音”，让您能够：
+ * - 读取麦克风捕捉到的声音
+ * - 获得可以用于语音识别的数据
+ * - 按照需要的格式和长度读取数据
+ *
+ * 采集的槽位宽（16或32位）在bsp_board_init时定下，这里按它选一个编译好的读取内核（见sample_format.h），
+ * 32位采集也只需要按输出格式分配buffer。采集任务启动后返回ESP_ERR_INVALID_STATE。
+ *
+ * @tparam T 输出格式：int16_t，或float（±1.0，在16位调理之后转换）
+ * @param is_get_raw_channel 是否获取原始数据（true=不处理，false=经过优化）
+ * @param buffer 存储音频数据的数组（您提供的“录音带”），至少 samples × sizeof(T) 字节
+ * @param samples 样本数（双麦克风时是两个声道的总数）
+ * @return
+ *    - ESP_OK: ✅ 读取成功
+ *    - 其他值: ❌ 读取失败
+ */
+// 有的调用方把这个头文件包在extern "C"里，模板要显式切回C++链接
+extern "C++" template <typename T>
+esp_err_t bsp_get_feed_data(bool is_get_raw_channel, T *buffer, size_t samples);
 #endif
@@ -0,0 +1,245 @@
+/**
+ * @file buffer_placement.cc
+ * @brief 🗺️ 缓冲区放置策略实现
+ */
+
+#include "buffer_placement.h"
+#include <string.h>
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "sdkconfig.h"
+
+static const char* TAG = "BufferPlacement";
+
+#ifdef CONFIG_ESP32S3_DATA_CACHE_LINE_SIZE
+static const size_t kCacheLine = CONFIG_ESP32S3_DATA_CACHE_LINE_SIZE;
+#else
+static const size_t kCacheLine = 64;
+#endif
+static const size_t kVectorAlign = 16;     // vld.128/vst.128
+
+// 登记表：长期存在的缓冲区只有二三十个，满了照常分配，只是不出现在报告里
+static const size_t kMaxEntries = 48;
+
+struct PlacementEntry {
+    const char* name;
+    void* ptr;
+    uint32_t bytes;
+    Placement placement;
+    bool fell_back;             // 首选区域不够，退回了下一档
+};
+
+static PlacementEntry s_entries[kMaxEntries];
+static size_t s_untracked = 0;
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+const char* BufferPlacement::placementName(Placement placement) {
+    switch (placement) {
+        case Placement::DMA: return "DMA";
+        case Placement::INTERNAL: return "内部RAM";
+        case Placement::PSRAM: return "PSRAM";
+    }
+    return "?";
+}
+
+const char* BufferPlacement::regionName(const void* ptr) {
+    if (esp_ptr_external_ram(ptr)) {
+        return "PSRAM";
+    }
+    return esp_ptr_dma_capable(ptr) ? "内部RAM(DMA)" : "内部RAM";
+}
+
+static size_t address_alignment(const void* ptr) {
+    uintptr_t addr = (uintptr_t)ptr;
+    size_t align = 1;
+    while (align < kCacheLine && (addr & align) == 0) {
+        align <<= 1;
+    }
+    return align;
+}
+
+void* BufferPlacement::allocate(size_t bytes, Placement placement, bool* fell_back) {
+    void* ptr = nullptr;
+    *fell_back = false;
+    switch (placement) {
+        case Placement::DMA:
+            ptr = heap_caps_aligned_alloc(kVectorAlign, bytes, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+            break;
+        case Placement::INTERNAL:
+            ptr = heap_caps_aligned_alloc(kVectorAlign, bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+            break;
+        case Placement::PSRAM: {
+#if !CONFIG_SPIRAM
+            // 没有PSRAM的模组：本来就只有内部RAM，不算退回
+            ptr = heap_caps_aligned_alloc(kVectorAlign, bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+            break;
+#endif
+            // 大小补齐到整行，末尾那一行不和后面的分配共用
+            size_t padded = (bytes + kCacheLine - 1) & ~(kCacheLine - 1);
+            ptr = heap_caps_aligned_alloc(kCacheLine, padded, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+            if (!ptr) {
+                *fell_back = true;
+                ptr = heap_caps_aligned_alloc(kVectorAlign, bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+            }
+            return ptr;
+        }
+    }
+    if (!ptr) {
+        *fell_back = true;
+        ptr = heap_caps_aligned_alloc(kVectorAlign, bytes, MALLOC_CAP_8BIT);
+    }
+    return ptr;
+}
+
+void* BufferPlacement::alloc(const char* name, size_t bytes, Placement placement) {
+    if (bytes == 0) {
+        return nullptr;
+    }
+    bool fell_back = false;
+    void* ptr = allocate(bytes, placement, &fell_back);
+    if (!ptr) {
+        ESP_LOGE(TAG, "❌ %s 分配失败 (%zu 字节, %s)", name, bytes, placementName(placement));
+        return nullptr;
+    }
+    if (fell_back) {
+        ESP_LOGW(TAG, "⚠️ %s: %s不够，退回%s (%zu 字节)", name, placementName(placement), regionName(ptr), bytes);
+    }
+
+    bool tracked = false;
+    portENTER_CRITICAL(&s_lock);
+    for (size_t i = 0; i < kMaxEntries; i++) {
+        if (!s_entries[i].ptr) {
+            s_entries[i] = { name, ptr, (uint32_t)bytes, placement, fell_back };
+            tracked = true;
+            break;
+        }
+    }
+    if (!tracked) {
+        s_untracked++;
+    }
+    portEXIT_CRITICAL(&s_lock);
+    return ptr;
+}
+
+void BufferPlacement::free(void* ptr) {
+    if (!ptr) {
+        return;
+    }
+    portENTER_CRITICAL(&s_lock);
+    for (size_t i = 0; i < kMaxEntries; i++) {
+        if (s_entries[i].ptr == ptr) {
+            s_entries[i].ptr = nullptr;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&s_lock);
+    heap_caps_free(ptr);
+}
+
+void BufferPlacement::logReport() {
+    PlacementEntry entries[kMaxEntries];
+    portENTER_CRITICAL(&s_lock);
+    memcpy(entries, s_entries, sizeof(entries));
+    size_t untracked = s_untracked;
+    portEXIT_CRITICAL(&s_lock);
+
+    size_t total_internal = 0;
+    size_t total_psram = 0;
+    size_t fallbacks = 0;
+    ESP_LOGI(TAG, "🗺️ 缓冲区放置:");
+    for (size_t i = 0; i < kMaxEntries; i++) {
+        const PlacementEntry& e = entries[i];
+        if (!e.ptr) {
+            continue;
+        }
+        const char* region = regionName(e.ptr);
+        ESP_LOGI(TAG, "  %-16s %7lu 字节  要求%-7s 实际%-7s 对齐%2zu%s",
+                 e.name, (unsigned long)e.bytes, placementName(e.placement), region,
+                 address_alignment(e.ptr), e.fell_back ? "  ⚠️退回" : "");
+        if (esp_ptr_external_ram(e.ptr)) {
+            total_psram += e.bytes;
+        } else {
+            total_internal += e.bytes;
+        }
+        fallbacks += e.fell_back ? 1 : 0;
+    }
+    ESP_LOGI(TAG, "🗺️ 合计: 内部RAM %zu 字节, PSRAM %zu 字节, 退回 %zu 个%s",
+             total_internal, total_psram, fallbacks, untracked ? "（登记表已满，部分缓冲区未列出）" : "");
+}
+
+// ===== memcpy吞吐测试 =====
+
+static const size_t kBenchChunk = 4096;                 // 每次拷贝的字节数（约一个上行包/几个播放块）
+static const size_t kBenchInternalSpan = 16 * 1024;
+static const size_t kBenchPsramSpan = 256 * 1024;       // 大于64KB的数据cache，避免全部命中
+static const size_t kBenchTotal = 2 * 1024 * 1024;
+
+/**
+ * @brief 在src/dst两个区域里滚动拷贝kBenchTotal字节，返回MB/s
+ *
+ * offset让源地址偏离对齐边界，模拟从环形缓冲区中间按样本取数据。
+ */
+static uint32_t bench_copy(uint8_t* dst, size_t dst_span, const uint8_t* src, size_t src_span, size_t offset) {
+    size_t src_pos = 0;
+    size_t dst_pos = 0;
+    int64_t start = esp_timer_get_time();
+    for (size_t done = 0; done < kBenchTotal; done += kBenchChunk) {
+        memcpy(dst + dst_pos, src + src_pos + offset, kBenchChunk);
+        src_pos = (src_pos + kBenchChunk) % (src_span - kBenchChunk);
+        dst_pos = (dst_pos + kBenchChunk) % dst_span;
+    }
+    int64_t elapsed_us = esp_timer_get_time() - start;
+    // 字节/微秒 = MB/s
+    return elapsed_us > 0 ? (uint32_t)(kBenchTotal / (size_t)elapsed_us) : 0;
+}
+
+void BufferPlacement::runBenchmark() {
+    bool fell_back = false;
+    uint8_t* dma = (uint8_t*)allocate(kBenchInternalSpan, Placement::DMA, &fell_back);
+    uint8_t* internal = (uint8_t*)allocate(kBenchInternalSpan, Placement::INTERNAL, &fell_back);
+    uint8_t* psram_a = (uint8_t*)allocate(kBenchPsramSpan, Placement::PSRAM, &fell_back);
+    bool have_psram = !fell_back;
+    uint8_t* psram_b = (uint8_t*)allocate(kBenchPsramSpan, Placement::PSRAM, &fell_back);
+    have_psram = have_psram && !fell_back;
+    if (!dma || !internal || !psram_a || !psram_b || !have_psram) {
+        ESP_LOGW(TAG, "⚠️ memcpy测试跳过：测试缓冲区分配失败或没有PSRAM");
+        heap_caps_free(dma);
+        heap_caps_free(internal);
+        heap_caps_free(psram_a);
+        heap_caps_free(psram_b);
+        return;
+    }
+    memset(dma, 0x5a, kBenchInternalSpan);
+    memset(internal, 0xa5, kBenchInternalSpan);
+    memset(psram_a, 0x5a, kBenchPsramSpan);
+
+    struct Case {
+        const char* name;
+        uint8_t* dst;
+        size_t dst_span;
+        const uint8_t* src;
+        size_t src_span;
+        size_t offset;
+    };
+    const Case cases[] = {
+        { "内部RAM → DMA",         dma,     kBenchInternalSpan, internal, kBenchInternalSpan, 0 },
+        { "PSRAM → DMA",           dma,     kBenchInternalSpan, psram_a,  kBenchPsramSpan,    0 },
+        { "PSRAM → DMA (错开2B)",  dma,     kBenchInternalSpan, psram_a,  kBenchPsramSpan,    2 },
+        { "内部RAM → PSRAM",       psram_b, kBenchPsramSpan,    internal, kBenchInternalSpan, 0 },
+        { "PSRAM → PSRAM",         psram_b, kBenchPsramSpan,    psram_a,  kBenchPsramSpan,    0 },
+        { "PSRAM → PSRAM (错开2B)", psram_b, kBenchPsramSpan,   psram_a,  kBenchPsramSpan,    2 },
+    };
+    ESP_LOGI(TAG, "🏁 memcpy吞吐（每次%zu字节，共%zu KB）:", kBenchChunk, kBenchTotal / 1024);
+    for (const Case& c : cases) {
+        uint32_t mbps = bench_copy(c.dst, c.dst_span, c.src, c.src_span, c.offset);
+        ESP_LOGI(TAG, "  %-24s %4lu MB/s", c.name, (unsigned long)mbps);
+    }
+
+    heap_caps_free(dma);
+    heap_caps_free(internal);
+    heap_caps_free(psram_a);
+    heap_caps_free(psram_b);
+}
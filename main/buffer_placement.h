@@ -0,0 +1,73 @@
+/**
+ * @file buffer_placement.h
+ * @brief 🗺️ 缓冲区放置策略 - 按用途决定放在哪块内存、按什么对齐，并记录每个缓冲区实际落在哪里
+ *
+ * 以前各模块各自调用malloc/heap_caps_malloc，放在哪里要靠caps和堆的默认规则推断：
+ * CONFIG_SPIRAM_MALLOC_ALWAYSINTERNAL=4096，超过4KB的普通malloc会落到PSRAM，
+ * 每块都要解码的下行缓冲区就这样悄悄跑到了PSRAM上；PSRAM里的环形缓冲区也没有按cache行对齐，
+ * 开头和结尾的cache行和别的分配共用，两个核心写相邻数据时互相把对方的行刷出去。
+ * 现在按用途分三类，统一从这里分配：
+ *
+ * - DMA：内部RAM里DMA可达的区域，16字节对齐。直接交给i2s_channel_write的小块数据
+ *   （混音输出、欠载补偿块、舒适噪声），驱动从这里拷进DMA描述符
+ * - INTERNAL：内部RAM，16字节对齐（esp-dsp的vld.128要求）。每个20ms块都要处理的小缓冲区
+ * - PSRAM：按数据cache行（64字节）对齐，大小也补齐到整行。顺序读写的大块环形缓冲区
+ *   （抖动缓冲区、采集环、预录和存储转发缓冲区）
+ *
+ * 首选区域不够时退回下一档（PSRAM→内部RAM，DMA/INTERNAL→任意8位可访问内存），并打警告；
+ * logReport()列出每个缓冲区要求的和实际的区域、对齐，runBenchmark()测各种组合的memcpy吞吐。
+ *
+ * I2S的DMA缓冲区本身由驱动分配（采集直接把DMA缓冲区交给回调，见bsp_board.h），不经过这里。
+ */
+
+#ifndef BUFFER_PLACEMENT_H
+#define BUFFER_PLACEMENT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum class Placement : uint8_t {
+    DMA,            // 内部RAM、DMA可达：直接写入I2S的缓冲区
+    INTERNAL,       // 内部RAM：热路径上的小缓冲区
+    PSRAM,          // PSRAM、cache行对齐：大块顺序读写的缓冲区
+};
+
+class BufferPlacement {
+public:
+    /**
+     * @brief 按用途分配并登记一块缓冲区（内容未初始化）
+     *
+     * @param name 缓冲区名字（logReport()中显示），必须是静态字符串
+     * @return 所有区域都分配失败时返回nullptr
+     */
+    static void* alloc(const char* name, size_t bytes, Placement placement);
+
+    /**
+     * @brief 释放alloc()分配的缓冲区，nullptr直接返回
+     */
+    static void free(void* ptr);
+
+    /**
+     * @brief 打印每个登记的缓冲区：大小、要求的区域、实际区域和对齐，以及各区域合计
+     */
+    static void logReport();
+
+    /**
+     * @brief 测量内部RAM/PSRAM之间各种组合的memcpy吞吐（MB/s）并打印
+     *
+     * 临时分配测试缓冲区，测完释放；PSRAM的测试区大于数据cache，测到的是真实的PSRAM带宽。
+     */
+    static void runBenchmark();
+
+    static const char* placementName(Placement placement);
+
+    /**
+     * @brief 地址实际所在的区域（"内部RAM(DMA)"/"内部RAM"/"PSRAM"）
+     */
+    static const char* regionName(const void* ptr);
+
+private:
+    static void* allocate(size_t bytes, Placement placement, bool* fell_back);
+};
+
+#endif // BUFFER_PLACEMENT_H
@@ -0,0 +1,50 @@
+/**
+ * @file control_protocol.cc
+ * @brief 📦 二进制控制帧编解码
+ */
+
+#include "control_protocol.h"
+#include <string.h>
+#include "esp_timer.h"
+
+// 日志里的类型名，和Type一一对应
+static const char* const kTypeNames[(size_t)ControlProtocol::Type::COUNT] = {
+    "none", "ready", "tts_end", "credit", "ping", "pong", "interrupt", "interrupt_ack", "stats",
+    "capture",
+    "sched_trace",
+};
+
+size_t ControlProtocol::encode(Type type, const void* payload, size_t payload_len, uint8_t* out, size_t size) {
+    if (payload_len > UINT16_MAX || sizeof(Header) + payload_len > size) {
+        return 0;
+    }
+    Header header;
+    header.magic = MAGIC;
+    header.type = (uint8_t)type;
+    header.seq = seq_.fetch_add(1, std::memory_order_relaxed);
+    header.t_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    header.len = (uint16_t)payload_len;
+    header.flags = 0;
+    memcpy(out, &header, sizeof(header));
+    if (payload_len > 0) {
+        memcpy(out + sizeof(header), payload, payload_len);
+    }
+    return sizeof(header) + payload_len;
+}
+
+bool ControlProtocol::parse(const uint8_t* data, size_t len, Header* header, const uint8_t** payload) {
+    if (len < sizeof(Header) || data[0] != MAGIC) {
+        return false;
+    }
+    memcpy(header, data, sizeof(Header));   // 接收缓冲区不保证对齐
+    if (header->type == (uint8_t)Type::NONE || header->type >= (uint8_t)Type::COUNT ||
+        sizeof(Header) + header->len != len) {
+        return false;
+    }
+    *payload = data + sizeof(Header);
+    return true;
+}
+
+const char* ControlProtocol::typeName(Type type) {
+    return (size_t)type < (size_t)Type::COUNT ? kTypeNames[(size_t)type] : "unknown";
+}
@@ -0,0 +1,90 @@
+/**
+ * @file control_protocol.h
+ * @brief 📦 二进制控制帧 - 高频控制消息不再用JSON文本，收发两端按类型查表分发
+ *
+ * credit每收几KB就发一次，ping每几秒一次，每条都要snprintf、在接收端逐个strstr匹配，
+ * 还会把整条文本打进日志。协商成功后（hello里"control":"binary"）这些消息改成
+ * 二进制WebSocket帧：12字节头 + 定长负载，小端，和server/server.py里的CTRL_*保持一致。
+ *
+ *   magic(u8)=0xC7 | type(u8) | seq(u16) | t_ms(u32) | len(u16) | flags(u16) | payload[len]
+ *
+ * - seq：本端发出的控制帧序号，回绕无妨，只用于对日志
+ * - t_ms：发送时本端的单调时钟（毫秒，低32位）
+ * - 下行音频也是二进制帧，控制帧靠magic + len等于实际负载长度 + 已知类型三项一起区分，
+ *   而且只有完整的单帧消息才会检查（控制帧很短，不会被分片）
+ *
+ * 没有协商（旧服务器、或服务器设置RELAY_CONTROL=json）时仍用原来的JSON文本，方便调试。
+ */
+
+#ifndef CONTROL_PROTOCOL_H
+#define CONTROL_PROTOCOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+class ControlProtocol {
+public:
+    static constexpr uint8_t MAGIC = 0xC7;
+
+    /**
+     * @brief 消息类型（数值写进帧里，只能在末尾追加）
+     */
+    enum class Type : uint8_t {
+        NONE = 0,
+        READY,          // 服务器→设备：豆包会话就绪
+        TTS_END,        // 服务器→设备：本轮回复音频已发完
+        CREDIT,         // 设备→服务器：下行额度（CreditPayload）
+        PING,           // 设备→服务器：心跳，头里的seq和t_ms由服务器原样带回
+        PONG,           // 服务器→设备：心跳回应（PongPayload）
+        INTERRUPT,      // 设备→服务器：用户打断
+        INTERRUPT_ACK,  // 服务器→设备：已停止下发被打断的回复
+        STATS,          // 设备→服务器：性能计数器（u32数组，顺序见PerfCounters::formatBinary）
+        CAPTURE,        // 设备→服务器：会话录制的一批设备端时间戳（格式见session_capture.h）
+        SCHED_TRACE,    // 设备→服务器：一批调度追踪事件（格式见sched_trace.h）
+        FLIGHT_RECORD,  // 设备→服务器：复位前的黑匣子记录（格式见flight_recorder.h）
+        COUNT
+    };
+
+    struct __attribute__((packed)) Header {
+        uint8_t magic;
+        uint8_t type;
+        uint16_t seq;
+        uint32_t t_ms;
+        uint16_t len;       // 负载字节数
+        uint16_t flags;     // 保留，写0
+    };
+    static_assert(sizeof(Header) == 12, "Header必须是12字节");
+
+    struct __attribute__((packed)) CreditPayload {
+        uint32_t received;
+        uint32_t free;
+    };
+
+    struct __attribute__((packed)) PongPayload {
+        uint16_t ping_seq;
+        uint16_t reserved;
+        uint32_t ping_t_ms;
+    };
+
+    static constexpr size_t MAX_FRAME = 256;
+
+    /**
+     * @brief 组一条控制帧（序号自动递增，可以在任意任务中调用）
+     *
+     * @return 帧长度，缓冲区不够时返回0
+     */
+    static size_t encode(Type type, const void* payload, size_t payload_len, uint8_t* out, size_t size);
+
+    /**
+     * @brief 判断一条完整的二进制消息是不是控制帧，是则取出头和负载
+     */
+    static bool parse(const uint8_t* data, size_t len, Header* header, const uint8_t** payload);
+
+    static const char* typeName(Type type);
+
+private:
+    static inline std::atomic<uint16_t> seq_{0};
+};
+
+#endif // CONTROL_PROTOCOL_H
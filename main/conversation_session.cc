@@ -0,0 +1,110 @@
+/**
+ * @file conversation_session.cc
+ * @brief 💬 对话会话的阶段切换和超时
+ */
+
+#include "conversation_session.h"
+#include "esp_log.h"
+#include "perf_counters.h"
+
+static const char* TAG = "Conversation";
+
+ConversationSession::ConversationSession(uint32_t follow_up_ms, uint32_t idle_timeout_ms)
+    : follow_up_us_((int64_t)follow_up_ms * 1000)
+    , idle_timeout_us_((int64_t)idle_timeout_ms * 1000)
+    , phase_(Phase::ENDED)
+    , phase_start_us_(0)
+    , last_activity_us_(0)
+    , last_downlink_us_(0)
+    , reply_end_(false)
+    , turns_(0)
+{
+}
+
+const char* ConversationSession::phaseName(Phase phase) {
+    switch (phase) {
+        case Phase::ENDED: return "ENDED";
+        case Phase::LISTENING: return "LISTENING";
+        case Phase::SPEAKING: return "SPEAKING";
+        case Phase::REPLYING: return "REPLYING";
+        case Phase::FOLLOW_UP: return "FOLLOW_UP";
+    }
+    return "?";
+}
+
+void ConversationSession::begin(int64_t now_us) {
+    turns_ = 0;
+    reply_end_ = false;
+    last_downlink_us_ = now_us;
+    enter(Phase::LISTENING, now_us);
+}
+
+void ConversationSession::enter(Phase phase, int64_t now_us) {
+    ESP_LOGD(TAG, "💬 %s → %s", phaseName(phase_), phaseName(phase));
+    phase_ = phase;
+    phase_start_us_ = now_us;
+    last_activity_us_ = now_us;
+}
+
+bool ConversationSession::update(int64_t now_us, bool speaking, bool playing) {
+    switch (phase_) {
+        case Phase::ENDED:
+            return false;
+
+        case Phase::LISTENING:
+        case Phase::FOLLOW_UP:
+            if (speaking) {
+                if (phase_ == Phase::FOLLOW_UP) {
+                    PerfCounters::add(PerfCounter::FOLLOW_UP_TURNS);
+                    ESP_LOGI(TAG, "💬 追问窗口内继续说话，第%lu句（不用再唤醒）", (unsigned long)turns_ + 1);
+                }
+                turns_++;
+                reply_end_ = false;
+                enter(Phase::SPEAKING, now_us);
+                return false;
+            }
+            // 又来了一段回复（被打断的回复的剩余部分、"再说一遍"）
+            if (last_downlink_us_.load() > phase_start_us_) {
+                enter(Phase::REPLYING, now_us);
+                return false;
+            }
+            // 提示音或回复的尾巴还在播放时窗口不开始计时
+            if (playing) {
+                last_activity_us_ = now_us;
+                return false;
+            }
+            return now_us - last_activity_us_ >= follow_up_us_;
+
+        case Phase::SPEAKING:
+            if (!speaking) {
+                reply_end_ = false;     // 之前的tts_end属于被打断的回复
+                enter(Phase::REPLYING, now_us);
+            }
+            return false;
+
+        case Phase::REPLYING: {
+            if (speaking) {
+                turns_++;
+                reply_end_ = false;
+                enter(Phase::SPEAKING, now_us);
+                return false;
+            }
+            if (reply_end_ && !playing) {
+                reply_end_ = false;
+                enter(Phase::FOLLOW_UP, now_us);
+                return false;
+            }
+            int64_t last_downlink_us = last_downlink_us_.load();
+            if (playing || last_downlink_us > last_activity_us_) {
+                last_activity_us_ = playing ? now_us : last_downlink_us;
+                return false;
+            }
+            if (now_us - last_activity_us_ >= idle_timeout_us_) {
+                ESP_LOGW(TAG, "⚠️ %lu ms没有等到回复", (unsigned long)(idle_timeout_us_ / 1000));
+                return true;
+            }
+            return false;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file conversation_session.h
+ * @brief 💬 对话会话状态机 - 回复后留一段追问窗口，长时间没人说话就结束会话
+ *
+ * 以前唤醒后SESSION_ACTIVE一直保持到WebSocket断开：豆包会话和上行带宽一直占着，
+ * 真断开了又得重新唤醒。现在会话内部分成几个阶段，由主循环每10ms调用update()推进：
+ *
+ * - LISTENING：唤醒后等用户开口，CONVERSATION_FOLLOW_UP_MS内没说话就结束
+ * - SPEAKING：VAD门控打开（用户在说话，包括打断回复）
+ * - REPLYING：说完了，等回复或正在播放回复；CONVERSATION_IDLE_TIMEOUT_MS没有任何下行音频
+ *   （服务器或豆包卡住了）也结束
+ * - FOLLOW_UP：回复播完，追问窗口，CONVERSATION_FOLLOW_UP_MS内开口就直接进入下一轮，不用再唤醒
+ *
+ * 结束会话只是释放服务器上的豆包会话（session_end），WebSocket保持连接，
+ * 下次唤醒直接开始上传，不用重新握手。
+ *
+ * onDownlink()和onReplyEnd()在WebSocket任务中调用，其余只在主任务中调用。
+ */
+
+#ifndef CONVERSATION_SESSION_H
+#define CONVERSATION_SESSION_H
+
+#include <stdint.h>
+#include <atomic>
+
+class ConversationSession {
+public:
+    enum class Phase : uint8_t {
+        ENDED,          // 不在会话中
+        LISTENING,      // 唤醒后等用户开口
+        SPEAKING,       // 用户在说话
+        REPLYING,       // 等待或正在播放回复
+        FOLLOW_UP,      // 回复播完，追问窗口
+    };
+
+    /**
+     * @param follow_up_ms 唤醒后和每轮回复播完后等用户开口的时长
+     * @param idle_timeout_ms 等回复时最长多久没有下行音频
+     */
+    ConversationSession(uint32_t follow_up_ms, uint32_t idle_timeout_ms);
+
+    /**
+     * @brief 修改两个超时（主循环调用，和update()在同一个任务里），正在计时的阶段按新值判断
+     */
+    void setTimeouts(uint32_t follow_up_ms, uint32_t idle_timeout_ms) {
+        follow_up_us_ = (int64_t)follow_up_ms * 1000;
+        idle_timeout_us_ = (int64_t)idle_timeout_ms * 1000;
+    }
+
+    /**
+     * @brief 唤醒后进入会话
+     */
+    void begin(int64_t now_us);
+
+    /**
+     * @brief 会话结束（超时或连接断开后回到空闲）
+     */
+    void end() { phase_ = Phase::ENDED; }
+
+    /**
+     * @brief 收到一条下行音频（WebSocket任务）
+     */
+    void onDownlink(int64_t now_us) { last_downlink_us_ = now_us; }
+
+    /**
+     * @brief 服务器发完了本轮回复（WebSocket任务），播放结束后进入追问窗口
+     */
+    void onReplyEnd() { reply_end_ = true; }
+
+    /**
+     * @brief 推进状态机
+     *
+     * @param speaking VAD门控打开
+     * @param playing 回复（或提示音）还在播放
+     * @return 会话超时，调用方应结束会话
+     */
+    bool update(int64_t now_us, bool speaking, bool playing);
+
+    Phase phase() const { return phase_; }
+    uint32_t turns() const { return turns_; }
+
+    static const char* phaseName(Phase phase);
+
+private:
+    void enter(Phase phase, int64_t now_us);
+
+    int64_t follow_up_us_;
+    int64_t idle_timeout_us_;
+    Phase phase_;
+    int64_t phase_start_us_;
+    int64_t last_activity_us_;
+    std::atomic<int64_t> last_downlink_us_;
+    std::atomic<bool> reply_end_;
+    uint32_t turns_;            // 本次唤醒后用户说了几句话
+};
+
+#endif // CONVERSATION_SESSION_H
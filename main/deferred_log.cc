@@ -0,0 +1,103 @@
+/**
+ * @file deferred_log.cc
+ * @brief 📮 延迟日志实现（排空任务和输出）
+ */
+
+#include "deferred_log.h"
+#include "esp_system.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "perf_counters.h"
+#include "task_factory.h"
+
+const char* DeferredLog::TAG = "DeferredLog";
+
+DeferredLog::Slot DeferredLog::slots_[DEFERRED_LOG_SLOTS];
+
+esp_err_t DeferredLog::start() {
+#if DEFERRED_LOG_ENABLE
+    // 只往串口写，不碰Flash，栈放PSRAM
+    if (TaskFactory::create(task, "deferred_log", DEFERRED_LOG_TASK_STACK, nullptr, DEFERRED_LOG_TASK_PRIORITY,
+                            nullptr, DEFERRED_LOG_TASK_CORE, TaskStack::PSRAM) != pdPASS) {
+        ESP_LOGE(TAG, "❌ 创建延迟日志任务失败，热路径日志会积在环里");
+        return ESP_ERR_NO_MEM;
+    }
+    esp_register_shutdown_handler(on_shutdown);
+    ESP_LOGI(TAG, "📮 延迟日志: %d 个槽位，每 %d ms 排空一次", DEFERRED_LOG_SLOTS, DEFERRED_LOG_POLL_MS);
+#endif
+    return ESP_OK;
+}
+
+void DeferredLog::dropped(esp_log_level_t level) {
+    size_t i = level <= ESP_LOG_WARN ? 0 : (level == ESP_LOG_INFO ? 1 : 2);
+    dropped_[i].fetch_add(1, std::memory_order_relaxed);
+    PerfCounters::add(PerfCounter::LOG_DROPS);
+}
+
+void DeferredLog::emit(const Record& r) {
+    esp_log_write((esp_log_level_t)r.level, r.tag, r.format, r.timestamp_ms, r.tag,
+                  r.args[0], r.args[1], r.args[2], r.args[3]);
+}
+
+size_t DeferredLog::drain() {
+    if (draining_.exchange(true, std::memory_order_acquire)) {
+        return 0;
+    }
+    uint32_t depth = head_.load(std::memory_order_relaxed) - tail_;
+    if (depth > max_depth_) {
+        max_depth_ = depth;
+    }
+    size_t count = 0;
+    for (;;) {
+        Slot& slot = slots_[tail_ & (DEFERRED_LOG_SLOTS - 1)];
+        if (slot.turn.load(std::memory_order_acquire) != turn(tail_) + 1) {
+            break;      // 空了，或者这一条的写入方还没写完
+        }
+        emit(slot.record);
+        slot.turn.store(turn(tail_ + DEFERRED_LOG_SLOTS), std::memory_order_release);
+        tail_++;
+        count++;
+    }
+    draining_.store(false, std::memory_order_release);
+    if (count > 0) {
+        PerfCounters::add(PerfCounter::LOG_DEFERRED, count);
+    }
+    return count;
+}
+
+void DeferredLog::flush() {
+    drain();
+}
+
+void DeferredLog::on_shutdown() {
+    // esp_restart()之前把环里剩下的输出（排空任务正在输出时跳过，不和它抢）
+    drain();
+}
+
+void DeferredLog::task(void* arg) {
+    uint32_t reported = 0;
+    int64_t last_report_us = 0;
+    for (;;) {
+        vTaskDelay(pdMS_TO_TICKS(DEFERRED_LOG_POLL_MS));
+        drain();
+        Stats s = stats();
+        uint32_t lost = s.dropped[0] + s.dropped[1] + s.dropped[2];
+        int64_t now = esp_timer_get_time();
+        if (lost != reported && now - last_report_us >= (int64_t)LOG_RATE_LIMIT_MS * 1000) {
+            ESP_LOGW(TAG, "⚠️ 延迟日志环满，又丢了 %lu 条（累计告警 %lu、信息 %lu、调试 %lu，最多积压 %lu 条）",
+                     (unsigned long)(lost - reported), (unsigned long)s.dropped[0], (unsigned long)s.dropped[1],
+                     (unsigned long)s.dropped[2], (unsigned long)s.max_depth);
+            reported = lost;
+            last_report_us = now;
+        }
+    }
+}
+
+DeferredLog::Stats DeferredLog::stats() {
+    Stats s;
+    for (size_t i = 0; i < 3; i++) {
+        s.dropped[i] = dropped_[i].load(std::memory_order_relaxed);
+    }
+    s.max_depth = max_depth_;
+    return s;
+}
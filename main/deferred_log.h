@@ -0,0 +1,165 @@
+/**
+ * @file deferred_log.h
+ * @brief 📮 延迟日志 - 热路径只把格式串指针、时间戳和几个整数参数写进无锁环，低优先级任务在网络核心上格式化输出
+ *
+ * 限频之后ESP_LOGx仍然在调用它的任务里格式化、同步写串口：115200波特率一行就是几毫秒，
+ * WebSocket事件任务、采集和播放任务里的一条告警就能让这一块晚几毫秒。这里把输出挪走：
+ *
+ * - DLOGW / DLOGI / DLOGD：和ESP_LOGx一样的写法，调用方只写一条定长记录（格式串指针、tag、毫秒时间戳、级别、
+ *   最多MAX_ARGS个参数），不格式化、不加锁、不通知任务，几十个周期。只存指针、不读格式串，
+ *   Flash写入期间（cache关闭）IRAM里的热路径也能记
+ * - 环是DEFERRED_LOG_SLOTS个槽位的多生产者环（每个槽位带轮次，两个核心、任意任务都能写），放在内部RAM
+ * - 排空任务（DEFERRED_LOG_TASK_CORE，优先级最低的一档）每DEFERRED_LOG_POLL_MS取空一次，
+ *   按记录里的时间戳拼出和ESP_LOGx一样的前缀，经esp_log_write输出（运行时的级别过滤在这时生效）
+ * - 环满时丢新记录，按级别计数（PerfCounter::LOG_DROPS也加一），排空任务每LOG_RATE_LIMIT_MS最多报一次丢了多少
+ *
+ * 参数只能是整数、枚举和指针（编译时检查，64位整数和浮点数不行），%s必须指向常驻的字符串
+ * （字面量、esp_err_to_name()的返回值），输出时才去读。esp_restart()时关机回调把环里剩下的同步输出；
+ * 崩溃时还没排空的几条会丢，崩溃现场看黑匣子（flight_recorder.h）。
+ *
+ * UART输出一次会阻塞几毫秒，放在工作队列（work_queue.h）里会拖住心跳，所以单独一个任务。
+ * log_throttle.h的HOT_LOGx在DEFERRED_LOG_ENABLE时走这里；DEFERRED_LOG_ENABLE为0时DLOGx就是ESP_LOGx。
+ */
+
+#ifndef DEFERRED_LOG_H
+#define DEFERRED_LOG_H
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <atomic>
+#include <type_traits>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "project_config.h"
+
+class DeferredLog {
+public:
+    static constexpr size_t MAX_ARGS = 4;
+
+    struct Stats {
+        uint32_t dropped[3];    // 环满丢掉的记录：告警、信息、调试
+        uint32_t max_depth;     // 排空时看到的最多积压
+    };
+
+    /**
+     * @brief 创建排空任务并注册关机回调（之前写进环的记录在任务起来后输出）
+     */
+    static esp_err_t start();
+
+    /**
+     * @brief 在调用方的任务里把环里现有的记录全部输出（排空任务正在输出时直接返回）
+     */
+    static void flush();
+
+    static Stats stats();
+
+    /**
+     * @brief 写一条记录，环满时丢掉并计数（用DLOGx宏调用，format是拼好前缀的完整格式）
+     */
+    template <typename... Args>
+    static void push(esp_log_level_t level, const char* tag, const char* format, Args... args) {
+        static_assert(sizeof...(Args) <= MAX_ARGS, "延迟日志最多MAX_ARGS个参数");
+        uint32_t pos = head_.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;) {
+            slot = &slots_[pos & (DEFERRED_LOG_SLOTS - 1)];
+            int32_t diff = (int32_t)(slot->turn.load(std::memory_order_acquire) - turn(pos));
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                dropped(level);     // 上一圈写的这条还没输出：环满了
+                return;
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+        const uintptr_t packed[MAX_ARGS] = { word(args)... };
+        Record& r = slot->record;
+        r.format = format;
+        r.tag = tag;
+        r.timestamp_ms = (uint32_t)(esp_timer_get_time() / 1000);
+        r.level = (uint8_t)level;
+        for (size_t i = 0; i < MAX_ARGS; i++) {
+            r.args[i] = packed[i];
+        }
+        slot->turn.store(turn(pos) + 1, std::memory_order_release);
+    }
+
+private:
+    static const char* TAG;
+
+    struct Record {
+        const char* format;
+        const char* tag;
+        uint32_t timestamp_ms;
+        uint8_t level;
+        uintptr_t args[MAX_ARGS];
+    };
+
+    // 有界多生产者环，每个槽位自带轮次：turn == turn(位置)时空着可以写，turn(位置) + 1时写好了可以读，
+    // 读完改成turn(位置 + SLOTS)。第一圈的轮次是0，零初始化的环在start()之前就能写
+    struct Slot {
+        std::atomic<uint32_t> turn;
+        Record record;
+    };
+
+    static constexpr uint32_t turn(uint32_t pos) { return pos / DEFERRED_LOG_SLOTS * 2; }
+
+    template <typename T>
+    static uintptr_t word(T v) {
+        static_assert(std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>,
+                      "延迟日志的参数只能是整数、枚举或指针（%s要指向常驻的字符串）");
+        static_assert(sizeof(T) <= sizeof(uintptr_t), "延迟日志不支持比指针宽的参数");
+        if constexpr (std::is_pointer_v<T>) {
+            return (uintptr_t)v;
+        } else {
+            return (uintptr_t)(intptr_t)v;      // 有符号数按符号扩展，%d照样打出负数
+        }
+    }
+
+    static void dropped(esp_log_level_t level);
+    static void task(void* arg);
+    static size_t drain();
+    static void emit(const Record& r);
+    static void on_shutdown();
+
+    static_assert((DEFERRED_LOG_SLOTS & (DEFERRED_LOG_SLOTS - 1)) == 0, "DEFERRED_LOG_SLOTS必须是2的幂");
+    static Slot slots_[DEFERRED_LOG_SLOTS];
+    static inline std::atomic<uint32_t> head_{0};
+    static inline uint32_t tail_ = 0;            // 只有排空的一方读写
+    static inline std::atomic<uint32_t> dropped_[3] = {};
+    static inline std::atomic<bool> draining_{false};   // 排空任务和flush()不同时读环
+    static inline uint32_t max_depth_ = 0;
+};
+
+// 和ESP_LOGx输出的前缀一样："W (毫秒) tag: "加颜色，末尾换行
+#define DEFERRED_LOG_FORMAT(letter, format) LOG_COLOR_ ## letter #letter " (%" PRIu32 ") %s: " format LOG_RESET_COLOR "\n"
+
+#if DEFERRED_LOG_ENABLE
+
+// if (0)里的printf只用来让编译器检查格式串和参数
+#define DEFERRED_LOG(level, letter, tag, format, ...) do { \
+        if (LOG_LOCAL_LEVEL >= (level)) { \
+            DeferredLog::push((level), (tag), DEFERRED_LOG_FORMAT(letter, format), ##__VA_ARGS__); \
+        } \
+        if (0) { printf(format, ##__VA_ARGS__); } \
+    } while (0)
+
+#define DLOGW(tag, format, ...) DEFERRED_LOG(ESP_LOG_WARN, W, tag, format, ##__VA_ARGS__)
+#define DLOGI(tag, format, ...) DEFERRED_LOG(ESP_LOG_INFO, I, tag, format, ##__VA_ARGS__)
+#define DLOGD(tag, format, ...) DEFERRED_LOG(ESP_LOG_DEBUG, D, tag, format, ##__VA_ARGS__)
+
+#else
+
+#define DLOGW(tag, format, ...) ESP_LOGW(tag, format, ##__VA_ARGS__)
+#define DLOGI(tag, format, ...) ESP_LOGI(tag, format, ##__VA_ARGS__)
+#define DLOGD(tag, format, ...) ESP_LOGD(tag, format, ##__VA_ARGS__)
+
+#endif // DEFERRED_LOG_ENABLE
+
+#endif // DEFERRED_LOG_H
@@ -0,0 +1,222 @@
+/**
+ * @file delta_patch.cc
+ * @brief 🧩 差分补丁的流式解压和应用
+ */
+
+#include "delta_patch.h"
+#include <string.h>
+#include <algorithm>
+#include "esp_log.h"
+#include "esp32s3/rom/miniz.h"
+#include "buffer_placement.h"
+
+static const char* TAG = "DeltaPatch";
+
+static const uint8_t kMagic[4] = { 'E', 'D', 'P', '1' };
+static const size_t kOldChunk = 512;     // diff段每次从旧固件读的字节数（栈上）
+
+static uint32_t read_u32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+DeltaPatch::DeltaPatch(ReadOld read_old, WriteNew write_new)
+    : read_old_(std::move(read_old))
+    , write_new_(std::move(write_new))
+    , header_{}
+    , inflator_(nullptr)
+    , dict_(nullptr)
+    , dict_pos_(0)
+    , out_(nullptr)
+    , out_len_(0)
+    , control_{}
+    , control_len_(0)
+    , stage_(Stage::CONTROL)
+    , remaining_(0)
+    , extra_len_(0)
+    , seek_(0)
+    , old_pos_(0)
+    , written_(0)
+    , stream_done_(false)
+    , failed_(false)
+{
+}
+
+DeltaPatch::~DeltaPatch() {
+    BufferPlacement::free(inflator_);
+    BufferPlacement::free(dict_);
+    BufferPlacement::free(out_);
+}
+
+esp_err_t DeltaPatch::parseHeader(const uint8_t* data, size_t len, Header* out) {
+    if (len < HEADER_SIZE) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (memcmp(data, kMagic, sizeof(kMagic)) != 0) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    out->old_size = read_u32(data + 4);
+    out->new_size = read_u32(data + 8);
+    memcpy(out->old_sha256, data + 16, SHA256_LEN);
+    memcpy(out->new_sha256, data + 16 + SHA256_LEN, SHA256_LEN);
+    return ESP_OK;
+}
+
+esp_err_t DeltaPatch::begin(const Header& header) {
+    header_ = header;
+    // 解压状态约11KB、字典32KB，只在升级期间存在，放PSRAM
+    inflator_ = (tinfl_decompressor*)BufferPlacement::alloc("delta_inflate", sizeof(tinfl_decompressor),
+                                                           Placement::PSRAM);
+    dict_ = (uint8_t*)BufferPlacement::alloc("delta_dict", TINFL_LZ_DICT_SIZE, Placement::PSRAM);
+    out_ = (uint8_t*)BufferPlacement::alloc("delta_out", OUT_BUFFER_SIZE, Placement::INTERNAL);
+    if (!inflator_ || !dict_ || !out_) {
+        ESP_LOGE(TAG, "❌ 补丁解压缓冲区分配失败");
+        failed_ = true;
+        return ESP_ERR_NO_MEM;
+    }
+    tinfl_init(inflator_);
+    ESP_LOGI(TAG, "🧩 开始应用补丁: %lu -> %lu 字节",
+             (unsigned long)header_.old_size, (unsigned long)header_.new_size);
+    return ESP_OK;
+}
+
+esp_err_t DeltaPatch::feed(const uint8_t* data, size_t len) {
+    if (failed_ || !inflator_) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (stream_done_) {
+        return len == 0 ? ESP_OK : ESP_ERR_INVALID_SIZE;   // 压缩流结束后不应再有数据
+    }
+    while (true) {
+        size_t in_bytes = len;
+        size_t out_bytes = TINFL_LZ_DICT_SIZE - dict_pos_;
+        tinfl_status status = tinfl_decompress(inflator_, data, &in_bytes, dict_, dict_ + dict_pos_, &out_bytes,
+                                               TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_HAS_MORE_INPUT);
+        data += in_bytes;
+        len -= in_bytes;
+        if (out_bytes > 0) {
+            esp_err_t ret = consume(dict_ + dict_pos_, out_bytes);
+            if (ret != ESP_OK) {
+                failed_ = true;
+                return ret;
+            }
+            dict_pos_ = (dict_pos_ + out_bytes) & (TINFL_LZ_DICT_SIZE - 1);
+        }
+        if (status < TINFL_STATUS_DONE) {
+            ESP_LOGE(TAG, "❌ 补丁解压失败: %d", (int)status);
+            failed_ = true;
+            return ESP_ERR_INVALID_CRC;
+        }
+        if (status == TINFL_STATUS_DONE) {
+            stream_done_ = true;
+            esp_err_t ret = flush();
+            if (ret == ESP_OK && (stage_ != Stage::CONTROL || control_len_ != 0 || written_ != header_.new_size)) {
+                ESP_LOGE(TAG, "❌ 补丁提前结束: 输出 %u / %lu 字节",
+                         (unsigned)written_, (unsigned long)header_.new_size);
+                ret = ESP_ERR_INVALID_SIZE;
+            }
+            failed_ = ret != ESP_OK;
+            return ret;
+        }
+        // 还有输出没取完时继续；否则这段输入已经用完
+        if (status != TINFL_STATUS_HAS_MORE_OUTPUT && len == 0) {
+            return ESP_OK;
+        }
+    }
+}
+
+esp_err_t DeltaPatch::consume(const uint8_t* data, size_t len) {
+    while (len > 0) {
+        if (stage_ == Stage::CONTROL) {
+            size_t n = std::min(len, CONTROL_SIZE - control_len_);
+            memcpy(control_ + control_len_, data, n);
+            control_len_ += n;
+            data += n;
+            len -= n;
+            if (control_len_ < CONTROL_SIZE) {
+                continue;
+            }
+            control_len_ = 0;
+            remaining_ = read_u32(control_);
+            extra_len_ = read_u32(control_ + 4);
+            seek_ = (int32_t)read_u32(control_ + 8);
+            if (written_ + (uint64_t)remaining_ + extra_len_ > header_.new_size) {
+                ESP_LOGE(TAG, "❌ 补丁记录超出新固件大小");
+                return ESP_ERR_INVALID_SIZE;
+            }
+            stage_ = Stage::DIFF;
+        }
+        if (stage_ == Stage::DIFF) {
+            while (remaining_ > 0 && len > 0) {
+                size_t n = std::min({ (size_t)remaining_, len, kOldChunk });
+                if (old_pos_ < 0 || old_pos_ + (int64_t)n > header_.old_size) {
+                    ESP_LOGE(TAG, "❌ 补丁引用了旧固件范围之外的数据");
+                    return ESP_ERR_INVALID_ARG;
+                }
+                uint8_t old[kOldChunk];
+                esp_err_t ret = read_old_((size_t)old_pos_, old, n);
+                if (ret != ESP_OK) {
+                    return ret;
+                }
+                for (size_t i = 0; i < n; i++) {
+                    old[i] = (uint8_t)(old[i] + data[i]);
+                }
+                ret = emit(old, n);
+                if (ret != ESP_OK) {
+                    return ret;
+                }
+                old_pos_ += n;
+                remaining_ -= n;
+                data += n;
+                len -= n;
+            }
+            if (remaining_ > 0) {
+                return ESP_OK;
+            }
+            remaining_ = extra_len_;
+            stage_ = Stage::EXTRA;
+        }
+        if (stage_ == Stage::EXTRA) {
+            size_t n = std::min((size_t)remaining_, len);
+            esp_err_t ret = emit(data, n);
+            if (ret != ESP_OK) {
+                return ret;
+            }
+            remaining_ -= n;
+            data += n;
+            len -= n;
+            if (remaining_ > 0) {
+                return ESP_OK;
+            }
+            old_pos_ += seek_;
+            stage_ = Stage::CONTROL;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t DeltaPatch::emit(const uint8_t* data, size_t len) {
+    written_ += len;
+    while (len > 0) {
+        size_t n = std::min(len, OUT_BUFFER_SIZE - out_len_);
+        memcpy(out_ + out_len_, data, n);
+        out_len_ += n;
+        data += n;
+        len -= n;
+        if (out_len_ == OUT_BUFFER_SIZE) {
+            esp_err_t ret = flush();
+            if (ret != ESP_OK) {
+                return ret;
+            }
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t DeltaPatch::flush() {
+    if (out_len_ == 0) {
+        return ESP_OK;
+    }
+    esp_err_t ret = write_new_(out_, out_len_);
+    out_len_ = 0;
+    return ret;
+}
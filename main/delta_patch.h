@@ -0,0 +1,106 @@
+/**
+ * @file delta_patch.h
+ * @brief 🧩 固件差分补丁 - 边下载边解压边应用，用正在运行的固件加补丁还原出新固件
+ *
+ * 补丁由tools/make_delta.py生成（bsdiff式），格式（小端）：
+ *
+ *   magic "EDP1" | old_size(u32) | new_size(u32) | reserved(u32) | old_sha256[32] | new_sha256[32]
+ *   然后是zlib压缩的记录流，每条记录：
+ *   diff_len(u32) | extra_len(u32) | seek(i32) | diff[diff_len] | extra[extra_len]
+ *
+ * 每条记录先输出diff_len字节 new = old[pos+i] + diff[i]（按字节模256），pos前进diff_len；
+ * 再原样输出extra_len字节；最后pos += seek。代码移动后大部分地址只差一个常数，
+ * diff里几乎全是0和少数几种值，压缩后通常只有整个镜像的几个百分点。
+ *
+ * 只顺序读旧固件、顺序写新固件，内存占用固定（解压状态+32KB字典，放在PSRAM）：
+ * 旧固件从正在运行的OTA分区读，新固件写进另一个分区（见ota_updater.h），写坏了也不影响当前固件。
+ * 读写都通过回调，不关心数据来自哪里、写到哪里。
+ */
+
+#ifndef DELTA_PATCH_H
+#define DELTA_PATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <functional>
+#include "esp_err.h"
+
+struct tinfl_decompressor_tag;
+
+class DeltaPatch {
+public:
+    static constexpr size_t HEADER_SIZE = 80;
+    static constexpr size_t SHA256_LEN = 32;
+
+    struct Header {
+        uint32_t old_size;
+        uint32_t new_size;
+        uint8_t old_sha256[SHA256_LEN];
+        uint8_t new_sha256[SHA256_LEN];
+    };
+
+    // 从旧固件offset处读len字节
+    using ReadOld = std::function<esp_err_t(size_t offset, uint8_t* out, size_t len)>;
+    // 新固件的下一段（按顺序）
+    using WriteNew = std::function<esp_err_t(const uint8_t* data, size_t len)>;
+
+    DeltaPatch(ReadOld read_old, WriteNew write_new);
+    ~DeltaPatch();
+
+    /**
+     * @brief 解析补丁开头的HEADER_SIZE字节
+     *
+     * @return 不是补丁（magic不对，例如完整固件镜像）时返回ESP_ERR_NOT_SUPPORTED
+     */
+    static esp_err_t parseHeader(const uint8_t* data, size_t len, Header* out);
+
+    /**
+     * @brief 分配解压缓冲区，准备应用补丁
+     */
+    esp_err_t begin(const Header& header);
+
+    /**
+     * @brief 喂入一段压缩的记录流（头部之后的数据，分段大小任意）
+     *
+     * @return 记录越界、解压失败或写入失败时返回错误，之后不能再继续
+     */
+    esp_err_t feed(const uint8_t* data, size_t len);
+
+    /**
+     * @brief 压缩流已结束，且恰好输出了new_size字节
+     */
+    bool done() const { return stream_done_ && written_ == header_.new_size; }
+
+    size_t written() const { return written_; }
+
+private:
+    static constexpr size_t CONTROL_SIZE = 12;
+    static constexpr size_t OUT_BUFFER_SIZE = 4096;
+
+    enum class Stage : uint8_t { CONTROL, DIFF, EXTRA };
+
+    esp_err_t consume(const uint8_t* data, size_t len);
+    esp_err_t emit(const uint8_t* data, size_t len);
+    esp_err_t flush();
+
+    ReadOld read_old_;
+    WriteNew write_new_;
+    Header header_;
+    tinfl_decompressor_tag* inflator_;
+    uint8_t* dict_;             // TINFL_LZ_DICT_SIZE，环形输出窗口
+    size_t dict_pos_;
+    uint8_t* out_;              // 攒满OUT_BUFFER_SIZE再交给write_new_
+    size_t out_len_;
+    uint8_t control_[CONTROL_SIZE];
+    size_t control_len_;
+    Stage stage_;
+    uint32_t remaining_;        // 当前diff/extra段还剩的字节
+    uint32_t extra_len_;
+    int32_t seek_;
+    int64_t old_pos_;
+    size_t written_;
+    bool stream_done_;
+    bool failed_;
+};
+
+#endif // DELTA_PATCH_H
@@ -0,0 +1,149 @@
+/**
+ * @file downlink_resampler.cc
+ * @brief 🎚️ 下行24kHz float32 → 16kHz int16 多相重采样
+ */
+
+#include "downlink_resampler.h"
+#include <math.h>
+#include <string.h>
+#include "buffer_placement.h"
+#include "dsp_tables.h"
+#include "esp_log.h"
+
+static const char* TAG = "DownlinkResampler";
+
+static constexpr size_t kUp = 2;
+static constexpr size_t kDown = 3;
+static constexpr double kCutoffHz = 7200.0;     // 和server.py的StreamingResampler.CUTOFF_HZ一致
+
+// Blackman窗sinc低通，在48kHz（插值后）上设计，增益乘2补偿插值补零后的幅度损失，int16的满幅并进系数。
+// 编译时算好放在rodata（见dsp_tables.h），init()只拷进内部RAM
+static constexpr auto kCoeffs = DspTables::polyphase<kUp, DownlinkResampler::TAPS_PER_PHASE>(
+    DspTables::lowpass<kUp * DownlinkResampler::TAPS_PER_PHASE>(kCutoffHz / (DownlinkResampler::INPUT_RATE * kUp)),
+    kUp * 32767.0);
+
+static inline int16_t to_s16(float v) {
+    if (v >= 32767.0f) {
+        return 32767;
+    }
+    if (v <= -32768.0f) {
+        return -32768;
+    }
+    return (int16_t)lrintf(v);
+}
+
+DownlinkResampler::DownlinkResampler()
+    : stage_(nullptr)
+    , stage_len_(0)
+    , coeffs_{}
+    , delay_{}
+    , phase_out_{}
+    , fir_{}
+    , carry_{}
+    , carry_len_(0)
+{
+}
+
+DownlinkResampler::~DownlinkResampler() {
+    BufferPlacement::free(stage_);
+}
+
+bool DownlinkResampler::init() {
+    if (stage_) {
+        return true;
+    }
+    // 所有数组放在一块16字节对齐的内存里，每段长度都是4的倍数，各自也是对齐的
+    const size_t total = STAGE_CAPACITY + kUp * (2 * TAPS_PER_PHASE + BLOCK_OUTPUTS);
+    float* block = (float*)BufferPlacement::alloc("resampler", total * sizeof(float), Placement::INTERNAL);
+    if (!block) {
+        ESP_LOGE(TAG, "❌ 重采样缓冲区分配失败");
+        return false;
+    }
+    float* p = block + STAGE_CAPACITY;
+    for (size_t phase = 0; phase < kUp; phase++) {
+        coeffs_[phase] = p;
+        delay_[phase] = p + TAPS_PER_PHASE;
+        phase_out_[phase] = p + 2 * TAPS_PER_PHASE;
+        p += 2 * TAPS_PER_PHASE + BLOCK_OUTPUTS;
+    }
+
+    // 每个相位倒序存放（dsps_fird_f32用coeffs[0]乘最早的样本），SIMD内核每块都要读，放内部RAM
+    for (size_t phase = 0; phase < kUp; phase++) {
+        memcpy(coeffs_[phase], kCoeffs[phase].data(), TAPS_PER_PHASE * sizeof(float));
+    }
+
+    stage_ = block;
+    reset();
+    ESP_LOGI(TAG, "✓ 下行重采样就绪: %u阶×%u相位, %zu 字节",
+             (unsigned)TAPS_PER_PHASE, (unsigned)kUp, total * sizeof(float));
+    return true;
+}
+
+void DownlinkResampler::reset() {
+    if (!stage_) {
+        return;
+    }
+    for (size_t phase = 0; phase < kUp; phase++) {
+        dsps_fird_init_f32(&fir_[phase], coeffs_[phase], delay_[phase], TAPS_PER_PHASE, kDown);
+    }
+    memset(stage_, 0, PRIME_SAMPLES * sizeof(float));
+    stage_len_ = PRIME_SAMPLES;
+    carry_len_ = 0;
+}
+
+size_t DownlinkResampler::process(const uint8_t* in, size_t len, int16_t* out, size_t out_samples, size_t* consumed) {
+    size_t used = 0;
+    size_t produced = 0;
+    if (!stage_) {
+        *consumed = len;
+        return 0;
+    }
+
+    while (true) {
+        // 先补齐上一段留下的半个float32，再整块拷贝
+        while (carry_len_ > 0 && used < len && stage_len_ < STAGE_CAPACITY) {
+            carry_[carry_len_++] = in[used++];
+            if (carry_len_ == sizeof(float)) {
+                memcpy(&stage_[stage_len_++], carry_, sizeof(float));
+                carry_len_ = 0;
+            }
+        }
+        if (carry_len_ == 0) {
+            size_t n = (len - used) / sizeof(float);
+            if (n > STAGE_CAPACITY - stage_len_) {
+                n = STAGE_CAPACITY - stage_len_;
+            }
+            memcpy(stage_ + stage_len_, in + used, n * sizeof(float));
+            stage_len_ += n;
+            used += n * sizeof(float);
+            if (stage_len_ < STAGE_CAPACITY && used < len) {
+                carry_len_ = len - used;    // 不到4字节
+                memcpy(carry_, in + used, carry_len_);
+                used = len;
+            }
+        }
+
+        // 相位1比相位0多读一个样本
+        size_t m = stage_len_ > 1 ? (stage_len_ - 1) / kDown : 0;
+        if (m > BLOCK_OUTPUTS) {
+            m = BLOCK_OUTPUTS;
+        }
+        if (m > (out_samples - produced) / kUp) {
+            m = (out_samples - produced) / kUp;
+        }
+        if (m == 0) {
+            break;
+        }
+        dsps_fird_f32(&fir_[0], stage_, phase_out_[0], (int)m);
+        dsps_fird_f32(&fir_[1], stage_ + 1, phase_out_[1], (int)m);
+        for (size_t i = 0; i < m; i++) {
+            out[produced++] = to_s16(phase_out_[0][i]);
+            out[produced++] = to_s16(phase_out_[1][i]);
+        }
+        stage_len_ -= m * kDown;
+        memmove(stage_, stage_ + m * kDown, stage_len_ * sizeof(float));
+    }
+
+    *consumed = used;
+    return produced;
+}
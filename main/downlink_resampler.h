@@ -0,0 +1,78 @@
+/**
+ * @file downlink_resampler.h
+ * @brief 🎚️ 下行重采样 - 豆包的24kHz float32 PCM在设备上转成16kHz int16
+ *
+ * 默认由服务器把每个TTS包重采样成16kHz再发下来，所有设备的重采样都压在一台服务器上。
+ * hello里下行带"f32_24k"、服务器也同意时，豆包的音频原样透传，由播放前的这一级处理：
+ * 3:2多相FIR（先2倍插值再3倍抽取，96阶低通拆成2个48阶相位），系数和server/server.py的
+ * StreamingResampler完全一样，输出和在服务器上重采样一致。
+ *
+ * 16kHz的第2m个输出只用相位0，对应24kHz输入3m；第2m+1个只用相位1，对应输入3m+1。
+ * 所以两个相位各是一个3倍抽取FIR，用dsps_fird_f32（ESP32-S3上是SIMD版本）跑在同一段输入上，
+ * 相位1的输入错开一个样本，输出交织起来就是结果，没有乘以插值补零的无用乘加。
+ * 32767的缩放并进系数里，float→int16只剩取整和饱和。
+ *
+ * 输入是任意切分的字节流（WebSocket片段不保证落在4字节边界上），滤波状态跨消息保留，
+ * 只在一段新回复开始时reset()。只在一个任务中调用（WebSocket事件任务），内部不加锁。
+ * 缓冲区（约4KB内部RAM）在第一次协商到这个格式时才分配。
+ */
+
+#ifndef DOWNLINK_RESAMPLER_H
+#define DOWNLINK_RESAMPLER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "dsps_fir.h"
+
+class DownlinkResampler {
+public:
+    static constexpr uint32_t INPUT_RATE = 24000;
+    static constexpr size_t TAPS_PER_PHASE = 48;
+    static constexpr size_t BLOCK_OUTPUTS = 160;              // 每个相位每次最多输出的样本数（合计20ms）
+    static constexpr size_t INPUT_BYTES_PER_OUTPUT = 6;       // 每个16kHz样本对应1.5个float32输入
+
+    DownlinkResampler();
+    ~DownlinkResampler();
+
+    DownlinkResampler(const DownlinkResampler&) = delete;
+    DownlinkResampler& operator=(const DownlinkResampler&) = delete;
+
+    /**
+     * @brief 分配缓冲区并算好系数（已分配时直接返回true）
+     */
+    bool init();
+
+    bool isValid() const { return stage_ != nullptr; }
+
+    /**
+     * @brief 清空滤波历史（新回复开始时调用，旧回复的尾巴不混进来）
+     */
+    void reset();
+
+    /**
+     * @brief 处理下一段输入
+     *
+     * @param in 24kHz float32小端PCM（任意长度，不足4字节的部分留到下一段）
+     * @param len 字节数
+     * @param out 输出16kHz int16 PCM
+     * @param out_samples 输出缓冲区能容纳的样本数（至少2；比一块小时已经收下的输入留到下次调用再输出）
+     * @param consumed 输出：本次消耗的字节数（输出缓冲区满时小于len）
+     * @return 输出的样本数
+     */
+    size_t process(const uint8_t* in, size_t len, int16_t* out, size_t out_samples, size_t* consumed);
+
+private:
+    static constexpr size_t STAGE_CAPACITY = 3 * BLOCK_OUTPUTS + 4;
+    static constexpr size_t PRIME_SAMPLES = 2;      // 相位0的输入前面垫2个0、相位1垫1个，对齐输出位置
+
+    float* stage_;              // 攒够整块的输入，两个相位共用（16字节对齐）
+    size_t stage_len_;
+    float* coeffs_[2];
+    float* delay_[2];
+    float* phase_out_[2];
+    fir_f32_t fir_[2];
+    uint8_t carry_[4];          // 上一段末尾不足一个float32的字节
+    size_t carry_len_;
+};
+
+#endif // DOWNLINK_RESAMPLER_H
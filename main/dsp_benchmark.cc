@@ -0,0 +1,508 @@
+/**
+ * @file dsp_benchmark.cc
+ * @brief 🏁 DSP基准测试实现
+ */
+
+#include "dsp_benchmark.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_cpu.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_wn_iface.h"
+#include "esp_wn_models.h"
+#include "esp_ns.h"
+#include "esp_nsn_models.h"
+#include "audio_front_end.h"
+#include "audio_codec.h"
+#include "buffer_placement.h"
+#include "downlink_resampler.h"
+#include "mic_conditioner.h"
+#include "sample_format.h"
+#include "spectral_ns.h"
+#include "project_config.h"
+
+static const char* TAG = "DspBenchmark";
+
+static const uint32_t kSampleRate = 16000;
+static const size_t kFrameSamples = kSampleRate * 20 / 1000;   // 上行/下行20ms帧
+static const size_t kMaxCases = 24;
+static const UBaseType_t kCasePriority = 5;                     // 基准模式下没有其他音频/网络任务
+
+struct BenchInput {
+    const int16_t* pcm;             // 16kHz单声道，PSRAM
+    size_t samples;
+    const PromptAsset* prompt;
+    srmodel_list_t* models;
+    const WakeSettings* wake;
+};
+
+struct BenchResult {
+    bool ok;
+    uint32_t units;                 // 处理了多少块
+    uint64_t cycles;
+    uint32_t max_cycles;
+    int64_t elapsed_us;
+    int64_t audio_us;               // 这些块对应的音频时长
+    size_t internal_bytes;          // 实例常驻的内部RAM
+    size_t psram_bytes;
+    uint32_t detections;            // WakeNet/AFE报告的唤醒次数
+    uint32_t stack_free;            // 测试任务栈的最小剩余（字节）
+};
+
+struct BenchCase;
+using BenchFn = bool (*)(const BenchCase& c, const BenchInput& in, BenchResult* r);
+
+struct BenchCase {
+    char label[40];
+    int core;
+    bool pipeline;                  // 计入上线流水线的核心占用（单独的WakeNet项已经包含在AFE里）
+    BenchFn run;
+    const char* model;              // 只有WakeNet项使用
+    det_mode_t mode;
+};
+
+/**
+ * @brief 记录实例创建前的空闲堆，创建后算出常驻占用
+ */
+struct HeapMark {
+    size_t internal = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    size_t psram = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+
+    void take(BenchResult* r) const {
+        size_t internal_now = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+        size_t psram_now = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+        r->internal_bytes = internal > internal_now ? internal - internal_now : 0;
+        r->psram_bytes = psram > psram_now ? psram - psram_now : 0;
+    }
+};
+
+template <typename F>
+static void measure(BenchResult* r, F&& body) {
+    int64_t start_us = esp_timer_get_time();
+    esp_cpu_cycle_count_t start = esp_cpu_get_cycle_count();
+    body();
+    uint32_t cycles = esp_cpu_get_cycle_count() - start;
+    r->elapsed_us += esp_timer_get_time() - start_us;
+    r->cycles += cycles;
+    if (cycles > r->max_cycles) {
+        r->max_cycles = cycles;
+    }
+    r->units++;
+}
+
+// ===== 测试项 =====
+
+static bool bench_wakenet(const BenchCase& c, const BenchInput& in, BenchResult* r) {
+    const esp_wn_iface_t* wakenet = (const esp_wn_iface_t*)esp_wn_handle_from_name(c.model);
+    if (!wakenet) {
+        return false;
+    }
+    HeapMark mark;
+    model_iface_data_t* data = wakenet->create(c.model, c.mode);
+    if (!data) {
+        return false;
+    }
+    mark.take(r);
+    size_t chunk = wakenet->get_samp_chunksize(data);
+    int rate = wakenet->get_samp_rate(data);
+    int16_t* buf = (int16_t*)BufferPlacement::alloc("bench_wakenet", chunk * sizeof(int16_t), Placement::INTERNAL);
+    bool ok = buf && wakenet->get_channel_num(data) == 1 && rate > 0;
+    if (ok) {
+        for (size_t offset = 0; offset + chunk <= in.samples; offset += chunk) {
+            memcpy(buf, in.pcm + offset, chunk * sizeof(int16_t));
+            wakenet_state_t state = WAKENET_NO_DETECT;
+            measure(r, [&]() { state = wakenet->detect(data, buf); });
+            r->detections += state > 0 ? 1 : 0;
+        }
+        r->audio_us = (int64_t)r->units * chunk * 1000000 / rate;
+    }
+    BufferPlacement::free(buf);
+    wakenet->destroy(data);
+    return ok;
+}
+
+static bool bench_afe(const BenchCase& c, const BenchInput& in, BenchResult* r) {
+    const WakeSettings& wake = *in.wake;
+    char* wakenet_model[WakeSettings::MAX_MODELS] = {};
+    wakenet_model[0] = AudioFrontEnd::pickWakeModel(in.models, wake.model[0], nullptr);
+    if (wakenet_model[0] && wake.model[1][0] != '\0') {
+        wakenet_model[1] = AudioFrontEnd::pickWakeModel(in.models, wake.model[1], wakenet_model[0]);
+    }
+
+    HeapMark mark;
+    bool use_aec = AFE_AEC_ENABLE;
+    afe_config_t* cfg = AudioFrontEnd::buildConfig(in.models, kSampleRate, MIC_CHANNELS, use_aec, wakenet_model, wake.mode);
+    esp_afe_sr_iface_t* afe = cfg ? esp_afe_handle_from_config(cfg) : nullptr;
+    esp_afe_sr_data_t* data = afe ? afe->create_from_config(cfg) : nullptr;
+    if (cfg) {
+        afe_config_free(cfg);
+    }
+    if (!data) {
+        return false;
+    }
+    mark.take(r);
+
+    size_t chunk = afe->get_feed_chunksize(data);
+    size_t channels = MIC_CHANNELS + (use_aec ? 1 : 0);
+    int16_t* feed = (int16_t*)BufferPlacement::alloc("bench_afe", chunk * channels * sizeof(int16_t), Placement::INTERNAL);
+    if (feed) {
+        // 参考通道用静音：AEC每块的计算量和参考信号内容无关；双麦克风时两路用同一段录音
+        memset(feed, 0, chunk * channels * sizeof(int16_t));
+        for (size_t offset = 0; offset + chunk <= in.samples; offset += chunk) {
+            for (size_t i = 0; i < chunk; i++) {
+                for (size_t m = 0; m < MIC_CHANNELS; m++) {
+                    feed[i * channels + m] = in.pcm[offset + i];
+                }
+            }
+            measure(r, [&]() {
+                afe->feed(data, feed);
+                // 同一个任务里feed和fetch交替进行，把这一块的处理结果全部取完
+                while (true) {
+                    afe_fetch_result_t* res = afe->fetch_with_delay(data, 0);
+                    if (!res || res->ret_value == ESP_FAIL) {
+                        break;
+                    }
+                    r->detections += res->wakeup_state == WAKENET_DETECTED ? 1 : 0;
+                }
+            });
+        }
+        r->audio_us = (int64_t)r->units * chunk * 1000000 / kSampleRate;
+    }
+    BufferPlacement::free(feed);
+    afe->destroy(data);
+    return feed != nullptr;
+}
+
+static bool bench_conditioner(const BenchCase& c, const BenchInput& in, BenchResult* r) {
+    const size_t chunk = I2S_RX_DMA_FRAME_NUM;
+    HeapMark mark;
+    MicConditioner conditioner;
+    if (conditioner.configure(true, 2.0f) != ESP_OK) {
+        return false;
+    }
+    int32_t* buf = (int32_t*)BufferPlacement::alloc("bench_capture", chunk * sizeof(int32_t), Placement::INTERNAL);
+    if (!buf) {
+        return false;
+    }
+    mark.take(r);
+    for (size_t offset = 0; offset + chunk <= in.samples; offset += chunk) {
+        // 模拟32位I2S数据：有效位在高位
+        for (size_t i = 0; i < chunk; i++) {
+            buf[i] = (int32_t)in.pcm[offset + i] << MIC_CAPTURE_SHIFT;
+        }
+        measure(r, [&]() {
+            MicConditioner::narrow32(buf, chunk, MIC_CAPTURE_SHIFT);
+            conditioner.process((int16_t*)buf, chunk);
+        });
+    }
+    r->audio_us = (int64_t)r->units * chunk * 1000000 / kSampleRate;
+    BufferPlacement::free(buf);
+    return true;
+}
+
+static bool bench_opus(const BenchCase& c, const BenchInput& in, BenchResult* r) {
+    static const size_t kOutCapacity = 512;
+    HeapMark mark;
+    OpusUplinkEncoder encoder;
+    if (encoder.init(kSampleRate, UPLINK_OPUS_BITRATE) != ESP_OK) {
+        return false;
+    }
+    uint8_t* out = (uint8_t*)BufferPlacement::alloc("bench_opus", kOutCapacity, Placement::INTERNAL);
+    if (!out) {
+        return false;
+    }
+    mark.take(r);
+    bool ok = true;
+    for (size_t offset = 0; ok && offset + kFrameSamples <= in.samples; offset += kFrameSamples) {
+        int len = 0;
+        measure(r, [&]() { len = encoder.encode(in.pcm + offset, kFrameSamples * sizeof(int16_t), out, kOutCapacity); });
+        ok = len > 0;
+    }
+    r->audio_us = (int64_t)r->units * kFrameSamples * 1000000 / kSampleRate;
+    BufferPlacement::free(out);
+    return ok;
+}
+
+static bool bench_adpcm(const BenchCase& c, const BenchInput& in, BenchResult* r) {
+    const PromptAsset* prompt = in.prompt;
+    if (!prompt || prompt->codec != PromptCodec::IMA_ADPCM || prompt->block_bytes <= ImaAdpcmDecoder::BLOCK_HEADER_SIZE) {
+        return false;
+    }
+    size_t block_samples = ImaAdpcmDecoder::samplesInBlock(prompt->block_bytes);
+    int16_t* out = (int16_t*)BufferPlacement::alloc("bench_adpcm", block_samples * sizeof(int16_t), Placement::INTERNAL);
+    if (!out) {
+        return false;
+    }
+    size_t decoded = 0;
+    for (size_t offset = 0; offset + prompt->block_bytes <= prompt->size; offset += prompt->block_bytes) {
+        size_t n = 0;
+        measure(r, [&]() { n = ImaAdpcmDecoder::decodeBlock(prompt->data + offset, prompt->block_bytes, out, block_samples); });
+        decoded += n;
+    }
+    r->audio_us = (int64_t)decoded * 1000000 / kSampleRate;
+    BufferPlacement::free(out);
+    return r->units > 0;
+}
+
+static bool bench_resampler(const BenchCase& c, const BenchInput& in, BenchResult* r) {
+    // 20ms的24kHz float32输入，内容用16kHz录音直接当24kHz，只影响音调不影响计算量
+    static const size_t kInputSamples = DownlinkResampler::INPUT_RATE * 20 / 1000;
+    HeapMark mark;
+    DownlinkResampler* resampler = new DownlinkResampler();
+    float* input = (float*)BufferPlacement::alloc("bench_f32", kInputSamples * sizeof(float), Placement::INTERNAL);
+    int16_t* out = (int16_t*)BufferPlacement::alloc("bench_resampled", kFrameSamples * 2 * sizeof(int16_t), Placement::INTERNAL);
+    bool ok = input && out && resampler->init();
+    if (ok) {
+        mark.take(r);
+        size_t produced = 0;
+        for (size_t offset = 0; offset + kInputSamples <= in.samples; offset += kInputSamples) {
+            SampleConvert<int16_t, float>::run(in.pcm + offset, input, kInputSamples);
+            size_t consumed = 0;
+            size_t n = 0;
+            measure(r, [&]() {
+                n = resampler->process((const uint8_t*)input, kInputSamples * sizeof(float), out, kFrameSamples * 2, &consumed);
+            });
+            produced += n;
+        }
+        r->audio_us = (int64_t)produced * 1000000 / kSampleRate;
+    }
+    BufferPlacement::free(input);
+    BufferPlacement::free(out);
+    delete resampler;
+    return ok && r->units > 0;
+}
+
+static bool bench_spectral_ns(const BenchCase& c, const BenchInput& in, BenchResult* r) {
+    HeapMark mark;
+    SpectralNoiseSuppressor* ns = new SpectralNoiseSuppressor();
+    int16_t* buf = (int16_t*)BufferPlacement::alloc("bench_ns", kFrameSamples * sizeof(int16_t), Placement::INTERNAL);
+    bool ok = buf && ns->init(kSampleRate) == ESP_OK;
+    if (ok) {
+        mark.take(r);
+        for (size_t offset = 0; offset + kFrameSamples <= in.samples; offset += kFrameSamples) {
+            memcpy(buf, in.pcm + offset, kFrameSamples * sizeof(int16_t));
+            measure(r, [&]() { ns->process(buf, kFrameSamples); });
+        }
+        r->audio_us = (int64_t)r->units * kFrameSamples * 1000000 / kSampleRate;
+    }
+    BufferPlacement::free(buf);
+    delete ns;
+    return ok;
+}
+
+static bool bench_webrtc_ns(const BenchCase& c, const BenchInput& in, BenchResult* r) {
+    // ns_pro只支持10ms块；模式1（中等）
+    static const size_t kChunk = kSampleRate * 10 / 1000;
+    HeapMark mark;
+    ns_handle_t ns = ns_pro_create(10, 1, kSampleRate);
+    int16_t* buf = (int16_t*)BufferPlacement::alloc("bench_webrtc_ns", kChunk * 2 * sizeof(int16_t), Placement::INTERNAL);
+    bool ok = ns && buf;
+    if (ok) {
+        mark.take(r);
+        for (size_t offset = 0; offset + kChunk <= in.samples; offset += kChunk) {
+            memcpy(buf, in.pcm + offset, kChunk * sizeof(int16_t));
+            measure(r, [&]() { ns_process(ns, buf, buf + kChunk); });
+        }
+        r->audio_us = (int64_t)r->units * kChunk * 1000000 / kSampleRate;
+    }
+    BufferPlacement::free(buf);
+    if (ns) {
+        ns_destroy(ns);
+    }
+    return ok;
+}
+
+static bool bench_nsnet(const BenchCase& c, const BenchInput& in, BenchResult* r) {
+    esp_nsn_iface_t* nsnet = esp_nsnet_handle_from_name((char*)c.model);
+    if (!nsnet) {
+        return false;
+    }
+    HeapMark mark;
+    esp_nsn_data_t* data = nsnet->create((char*)c.model);
+    if (!data) {
+        return false;
+    }
+    mark.take(r);
+    size_t chunk = nsnet->get_samp_chunksize(data);
+    int rate = nsnet->get_samp_rate(data);
+    int16_t* buf = (int16_t*)BufferPlacement::alloc("bench_nsnet", chunk * 2 * sizeof(int16_t), Placement::INTERNAL);
+    bool ok = buf && rate > 0;
+    if (ok) {
+        for (size_t offset = 0; offset + chunk <= in.samples; offset += chunk) {
+            memcpy(buf, in.pcm + offset, chunk * sizeof(int16_t));
+            measure(r, [&]() { nsnet->process(data, buf, buf + chunk); });
+        }
+        r->audio_us = (int64_t)r->units * chunk * 1000000 / rate;
+    }
+    BufferPlacement::free(buf);
+    nsnet->destroy(data);
+    return ok;
+}
+
+// ===== 输入音频 =====
+
+/**
+ * @brief 把提示音解码成PCM，循环填满buf；没有提示音时生成噪声+扫频
+ */
+static void fill_input(int16_t* buf, size_t samples, const PromptAsset* prompt) {
+    size_t filled = 0;
+    if (prompt && prompt->codec == PromptCodec::IMA_ADPCM && prompt->block_bytes > 0) {
+        for (size_t offset = 0; offset < prompt->size && filled < samples; offset += prompt->block_bytes) {
+            size_t len = prompt->size - offset < prompt->block_bytes ? prompt->size - offset : prompt->block_bytes;
+            filled += ImaAdpcmDecoder::decodeBlock(prompt->data + offset, len, buf + filled, samples - filled);
+        }
+    } else if (prompt && prompt->codec == PromptCodec::PCM16) {
+        filled = prompt->samples < samples ? prompt->samples : samples;
+        memcpy(buf, prompt->data, filled * sizeof(int16_t));
+    }
+
+    if (filled == 0) {
+        uint32_t seed = 0x12345678;
+        float phase = 0.0f;
+        for (size_t i = 0; i < samples; i++) {
+            // 200Hz→3kHz线性扫频，每秒一轮，叠加白噪声
+            float t = (float)(i % kSampleRate) / kSampleRate;
+            phase += 2.0f * (float)M_PI * (200.0f + 2800.0f * t) / kSampleRate;
+            seed = seed * 1664525u + 1013904223u;
+            int noise = (int)(seed >> 20) - 2048;
+            buf[i] = (int16_t)(6000.0f * sinf(phase) + noise);
+        }
+        return;
+    }
+    for (size_t i = filled; i < samples; i++) {
+        buf[i] = buf[i % filled];
+    }
+}
+
+// ===== 运行和汇总 =====
+
+struct CaseRun {
+    const BenchCase* c;
+    const BenchInput* in;
+    BenchResult result;
+    TaskHandle_t waiter;
+};
+
+static void case_task(void* arg) {
+    CaseRun* run = (CaseRun*)arg;
+    run->result.ok = run->c->run(*run->c, *run->in, &run->result);
+    run->result.stack_free = uxTaskGetStackHighWaterMark(NULL);
+    xTaskNotifyGive(run->waiter);
+    vTaskDelete(NULL);
+}
+
+static uint32_t permille_of(const BenchResult& r) {
+    return r.audio_us > 0 ? (uint32_t)(r.elapsed_us * 1000 / r.audio_us) : 0;
+}
+
+static void add_case(BenchCase* cases, size_t* count, const char* label, int core, bool pipeline, BenchFn run,
+                     const char* model = nullptr, det_mode_t mode = DET_MODE_90) {
+    if (*count >= kMaxCases) {
+        return;
+    }
+    BenchCase& c = cases[(*count)++];
+    snprintf(c.label, sizeof(c.label), "%s", label);
+    c.core = core;
+    c.pipeline = pipeline;
+    c.run = run;
+    c.model = model;
+    c.mode = mode;
+}
+
+void DspBenchmark::run(srmodel_list_t* models, const PromptAsset* prompt, const WakeSettings& wake) {
+    size_t samples = (size_t)DSP_BENCHMARK_SEC * kSampleRate;
+    int16_t* pcm = (int16_t*)BufferPlacement::alloc("bench_input", samples * sizeof(int16_t), Placement::PSRAM);
+    if (!pcm) {
+        ESP_LOGE(TAG, "❌ 基准测试输入缓冲区分配失败");
+        return;
+    }
+    fill_input(pcm, samples, prompt);
+    BenchInput input = { pcm, samples, prompt, models, &wake };
+
+    BenchCase* cases = new BenchCase[kMaxCases];
+    size_t count = 0;
+    for (int i = 0; models && i < models->num; i++) {
+        const char* name = models->model_name[i];
+        if (strstr(name, ESP_WN_PREFIX) == nullptr) {
+            continue;
+        }
+        char label[40];
+        snprintf(label, sizeof(label), "%s 模式90", name);
+        add_case(cases, &count, label, AFE_FETCH_TASK_CORE, false, bench_wakenet, name, DET_MODE_90);
+        snprintf(label, sizeof(label), "%s 模式95", name);
+        add_case(cases, &count, label, AFE_FETCH_TASK_CORE, false, bench_wakenet, name, DET_MODE_95);
+    }
+    if (models) {
+        add_case(cases, &count, "AFE feed+fetch", AFE_FETCH_TASK_CORE, true, bench_afe);
+    }
+    add_case(cases, &count, "麦克风收窄+调理", AFE_FEED_TASK_CORE, true, bench_conditioner);
+    add_case(cases, &count, "Opus编码", AUDIO_RECORD_TASK_CORE, true, bench_opus);
+    add_case(cases, &count, "ADPCM解码", AUDIO_SEND_TASK_CORE, false, bench_adpcm);
+    add_case(cases, &count, "f32 24k重采样", AUDIO_SEND_TASK_CORE, true, bench_resampler);
+    // 降噪对比：AFE里的WebRTC NS/NSNet已经算在AFE项里，轻量谱减只在AFE降噪不运行时替代它，都不计入流水线
+    add_case(cases, &count, "谱减降噪(dl_fft)", AUDIO_RECORD_TASK_CORE, false, bench_spectral_ns);
+    add_case(cases, &count, "WebRTC NS", AFE_FETCH_TASK_CORE, false, bench_webrtc_ns);
+    for (int i = 0; models && i < models->num; i++) {
+        const char* name = models->model_name[i];
+        if (strstr(name, ESP_NSNET_PREFIX) != nullptr) {
+            add_case(cases, &count, name, AFE_FETCH_TASK_CORE, false, bench_nsnet, name);
+        }
+    }
+
+    ESP_LOGI(TAG, "🏁 DSP基准测试: 输入%s %u秒, %u项, 每项任务栈%u字节",
+             prompt ? prompt->name : "合成信号", (unsigned)DSP_BENCHMARK_SEC, (unsigned)count,
+             (unsigned)DSP_BENCHMARK_STACK);
+    ESP_LOGI(TAG, "  %-26s 核心  周期/块(平均/最长)   us/块    占用  唤醒  内部RAM    PSRAM   栈使用",
+             "测试项");
+
+    uint32_t core_permille[portNUM_PROCESSORS] = {};
+    uint32_t core_stack[portNUM_PROCESSORS] = {};
+    for (size_t i = 0; i < count; i++) {
+        CaseRun run = { &cases[i], &input, {}, xTaskGetCurrentTaskHandle() };
+        if (xTaskCreatePinnedToCore(case_task, "dsp_bench", DSP_BENCHMARK_STACK, &run, kCasePriority,
+                                    nullptr, cases[i].core) != pdPASS) {
+            ESP_LOGE(TAG, "❌ %s: 创建测试任务失败", cases[i].label);
+            continue;
+        }
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        const BenchResult& r = run.result;
+        if (!r.ok || r.units == 0) {
+            ESP_LOGW(TAG, "  %-26s 核心%d  跳过（不可用或初始化失败）", cases[i].label, cases[i].core);
+            continue;
+        }
+        uint32_t permille = permille_of(r);
+        uint32_t stack_used = DSP_BENCHMARK_STACK - r.stack_free;
+        ESP_LOGI(TAG, "  %-26s 核心%d  %8lu/%-8lu %7lu  %5lu‰  %4lu  %7u  %7u  %6lu",
+                 cases[i].label, cases[i].core, (unsigned long)(r.cycles / r.units), (unsigned long)r.max_cycles,
+                 (unsigned long)(r.elapsed_us / r.units), (unsigned long)permille, (unsigned long)r.detections,
+                 (unsigned)r.internal_bytes, (unsigned)r.psram_bytes, (unsigned long)stack_used);
+        if (cases[i].pipeline) {
+            core_permille[cases[i].core] += permille;
+        }
+        if (stack_used > core_stack[cases[i].core]) {
+            core_stack[cases[i].core] = stack_used;
+        }
+    }
+
+    // 流水线：AFE（含WakeNet/AEC/NS）+ 麦克风调理 + Opus编码 + 下行重采样
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+        uint32_t used = core_permille[core];
+        ESP_LOGI(TAG, "🏁 核心%d: 流水线合计 %lu‰，剩余 %lu‰，测试任务最大栈使用 %lu 字节", core,
+                 (unsigned long)used, (unsigned long)(used < 1000 ? 1000 - used : 0),
+                 (unsigned long)core_stack[core]);
+    }
+    ESP_LOGI(TAG, "🏁 堆: 内部RAM空闲 %u（最低 %u），PSRAM空闲 %u（最低 %u）",
+             (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+             (unsigned)heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL),
+             (unsigned)heap_caps_get_free_size(MALLOC_CAP_SPIRAM),
+             (unsigned)heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM));
+
+    delete[] cases;
+    BufferPlacement::free(pcm);
+}
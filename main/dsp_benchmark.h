@@ -0,0 +1,40 @@
+/**
+ * @file dsp_benchmark.h
+ * @brief 🏁 DSP基准测试模式 - 用固定的录音跑一遍WakeNet、AFE、麦克风调理和编解码，报告每块耗时和余量
+ *
+ * DSP_BENCHMARK打开时固件启动后只做这一件事：不连WiFi、不启动I2S和音频任务，
+ * 每一项都在它上线时所在的核心上单独建一个任务运行（见project_config.h任务拓扑），互不干扰。
+ * 输入是提示音分区里的一条提示音（DSP_BENCHMARK_PROMPT，循环到DSP_BENCHMARK_SEC秒），
+ * 分区没有烧录时用合成信号（噪声+扫频）；WakeNet每块计算量固定，结果和内容基本无关。
+ *
+ * 测试项：
+ * - 分区里每个WakeNet模型分别在DET_MODE_90和DET_MODE_95下单独运行（每个get_samp_chunksize块）
+ * - 按当前唤醒词设置创建的完整AFE（AEC/NS/VAD/AGC/WakeNet），每个feed块的feed+fetch
+ * - 麦克风调理：32位收窄 + 去直流 + 增益（全部打开），每个I2S DMA块
+ * - Opus上行编码（每20ms帧）、ADPCM下行解码（每块）、24kHz float32下行重采样（每20ms）
+ * - 降噪对比：轻量谱减（spectral_ns.h，每20ms帧）、WebRTC NS（每10ms）、分区里的每个NSNet模型（每块）
+ *
+ * 每项报告：每块CPU周期（平均/最长）、每块耗时、实时系数（占一个核心的千分比）、
+ * 实例常驻的内部RAM/PSRAM、测试任务栈的最大使用量；最后按核心汇总上线流水线的占用和剩余余量。
+ */
+
+#ifndef DSP_BENCHMARK_H
+#define DSP_BENCHMARK_H
+
+#include "model_path.h"
+#include "prompt_store.h"
+#include "wake_settings.h"
+
+class DspBenchmark {
+public:
+    /**
+     * @brief 依次运行全部测试项并打印结果（阻塞，约十几秒）
+     *
+     * @param models 模型列表（nullptr时跳过WakeNet和AFE）
+     * @param prompt 输入音频（nullptr时用合成信号）
+     * @param wake 当前唤醒词设置（AFE测试项按它选择模型和检测模式）
+     */
+    static void run(srmodel_list_t* models, const PromptAsset* prompt, const WakeSettings& wake);
+};
+
+#endif // DSP_BENCHMARK_H
@@ -0,0 +1,146 @@
+/**
+ * @file dsp_tables.h
+ * @brief 📐 编译期DSP系数表 - FIR低通、窗函数和淡入淡出曲线在编译时算好，作为constexpr数组放进Flash的rodata
+ *
+ * 运行时按公式算系数要在启动时跑几百次双精度sin/cos（ESP32-S3没有双精度FPU，全是软件浮点），
+ * 还要占一块RAM放结果。这里的函数全部是constexpr，用在static constexpr变量上时整张表由编译器算出，
+ * 启动时什么都不做；表的长度、相位数都是模板参数，用它的内核也可以按同样的常量展开
+ * （比如DownlinkResampler的TAPS_PER_PHASE和3倍抽取）。
+ *
+ * 三角函数用自己的constexpr实现（归约到[-π/2, π/2]后泰勒展开），和libm的双精度结果差在最后一两位，
+ * 转成float/Q15/Q31之后没有区别。表本身在Flash里，热路径上反复读的系数由使用者拷到内部RAM
+ * （一次memcpy，不再有浮点运算），只读几次的（淡出曲线）直接从Flash读。
+ */
+
+#ifndef DSP_TABLES_H
+#define DSP_TABLES_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <array>
+
+class DspTables {
+public:
+    static constexpr double PI = 3.14159265358979323846;
+
+    static constexpr double sin(double x) {
+        // 归约到[-π, π]，再折到[-π/2, π/2]，泰勒展开到x^25（误差远小于double的精度）
+        const double two_pi = 2 * PI;
+        long long k = (long long)(x / two_pi);
+        x -= (double)k * two_pi;
+        if (x > PI) {
+            x -= two_pi;
+        } else if (x < -PI) {
+            x += two_pi;
+        }
+        if (x > PI / 2) {
+            x = PI - x;
+        } else if (x < -PI / 2) {
+            x = -PI - x;
+        }
+        double term = x;
+        double sum = x;
+        for (int n = 1; n <= 12; n++) {
+            term *= -x * x / ((2 * n) * (2 * n + 1));
+            sum += term;
+        }
+        return sum;
+    }
+
+    static constexpr double cos(double x) { return sin(x + PI / 2); }
+
+    /**
+     * @brief Blackman窗（对称，两端为0）
+     */
+    template <size_t N>
+    static constexpr std::array<double, N> blackman() {
+        std::array<double, N> w{};
+        for (size_t n = 0; n < N; n++) {
+            w[n] = 0.42 - 0.5 * cos(2 * PI * n / (N - 1)) + 0.08 * cos(4 * PI * n / (N - 1));
+        }
+        return w;
+    }
+
+    /**
+     * @brief Blackman窗sinc低通，直流增益归一化为1
+     *
+     * @param cutoff 截止频率 / 采样率（0~0.5）
+     */
+    template <size_t N>
+    static constexpr std::array<double, N> lowpass(double cutoff) {
+        std::array<double, N> taps{};
+        const std::array<double, N> window = blackman<N>();
+        const double center = (N - 1) / 2.0;
+        double sum = 0.0;
+        for (size_t n = 0; n < N; n++) {
+            double x = n - center;
+            double sinc = x == 0 ? 2 * cutoff : sin(2 * PI * cutoff * x) / (PI * x);
+            taps[n] = sinc * window[n];
+            sum += taps[n];
+        }
+        for (size_t n = 0; n < N; n++) {
+            taps[n] /= sum;
+        }
+        return taps;
+    }
+
+    /**
+     * @brief 拆成PHASES个多相分支，每个分支倒序存放（dsps_fird_f32用coeffs[0]乘最早的样本），乘上gain
+     */
+    template <size_t PHASES, size_t TAPS>
+    static constexpr std::array<std::array<float, TAPS>, PHASES> polyphase(const std::array<double, PHASES * TAPS>& taps,
+                                                                          double gain) {
+        std::array<std::array<float, TAPS>, PHASES> out{};
+        for (size_t phase = 0; phase < PHASES; phase++) {
+            for (size_t i = 0; i < TAPS; i++) {
+                out[phase][TAPS - 1 - i] = (float)(taps[phase + i * PHASES] * gain);
+            }
+        }
+        return out;
+    }
+
+    /**
+     * @brief 升余弦淡出曲线（Q15）：第0个是32767，之后平滑降到接近0，没有线性淡出末端的折角
+     */
+    template <size_t N>
+    static constexpr std::array<int16_t, N> fadeOutQ15() {
+        std::array<double, N> curve{};
+        for (size_t i = 0; i < N; i++) {
+            curve[i] = 0.5 * (1.0 + cos(PI * i / N));
+        }
+        return toQ15(curve);
+    }
+
+    template <size_t N>
+    static constexpr std::array<int16_t, N> toQ15(const std::array<double, N>& values) {
+        std::array<int16_t, N> out{};
+        for (size_t i = 0; i < N; i++) {
+            out[i] = (int16_t)quantize(values[i], 32767.0, -32768.0);
+        }
+        return out;
+    }
+
+    template <size_t N>
+    static constexpr std::array<int32_t, N> toQ31(const std::array<double, N>& values) {
+        std::array<int32_t, N> out{};
+        for (size_t i = 0; i < N; i++) {
+            out[i] = (int32_t)quantize(values[i], 2147483647.0, -2147483648.0);
+        }
+        return out;
+    }
+
+private:
+    // 按满幅缩放后四舍五入并饱和
+    static constexpr long long quantize(double value, double max, double min) {
+        double scaled = value * max;
+        if (scaled >= max) {
+            return (long long)max;
+        }
+        if (scaled <= min) {
+            return (long long)min;
+        }
+        return (long long)(scaled < 0 ? scaled - 0.5 : scaled + 0.5);
+    }
+};
+
+#endif // DSP_TABLES_H
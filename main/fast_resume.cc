@@ -0,0 +1,217 @@
+/**
+ * @file fast_resume.cc
+ * @brief 🌙 深度睡眠快速恢复实现
+ */
+
+#include "fast_resume.h"
+#include <string.h>
+#include <sys/time.h>
+#include "driver/rtc_io.h"
+#include "esp_app_desc.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_rom_crc.h"
+#include "esp_sleep.h"
+#include "esp_system.h"
+#include "esp_wifi.h"
+
+const char* FastResume::TAG = "FastResume";
+
+static const uint32_t kMagic = 0x46525331;     // "FRS1"，布局变了就换一个
+
+/**
+ * @brief 留在RTC内存里的状态（睡前算CRC，醒来核对）
+ */
+struct ResumeState {
+    uint32_t magic;
+    uint32_t crc;               // 从magic、crc之后算起
+    int64_t sleep_start_us;     // gettimeofday（RTC定时器，深度睡眠时照常走）
+    uint8_t ap_bssid[6];
+    uint8_t ap_channel;         // 0=没有
+    uint8_t reserved;
+    char session[48];
+    uint32_t wake_gate_floor;
+    float drift_ppm;
+    uint8_t app_elf_sha[8];     // 下面的镜像哈希属于哪个固件
+    char image_sha[17];
+    FastResume::WakeNetCost wakenet[FastResume::MAX_WAKENETS];
+    int32_t cold_wake_ready_ms; // 最近一次冷启动到唤醒就绪（-1=没有）
+};
+
+RTC_DATA_ATTR static ResumeState s_state;
+
+static uint32_t state_crc() {
+    const uint8_t* start = (const uint8_t*)&s_state + offsetof(ResumeState, sleep_start_us);
+    return esp_rom_crc32_le(0, start, sizeof(ResumeState) - offsetof(ResumeState, sleep_start_us));
+}
+
+static int64_t rtc_now_us() {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+FastResume::FastResume()
+    : resumed_(false)
+    , slept_ms_(0)
+{
+}
+
+void FastResume::init() {
+    bool from_sleep = esp_reset_reason() == ESP_RST_DEEPSLEEP;
+    if (from_sleep && s_state.magic == kMagic && s_state.crc == state_crc()) {
+        resumed_ = true;
+        int64_t slept_us = rtc_now_us() - s_state.sleep_start_us;
+        slept_ms_ = slept_us > 0 ? (uint32_t)(slept_us / 1000) : 0;
+        ESP_LOGI(TAG, "🌙 从深度睡眠醒来（睡了 %lu ms，唤醒原因%d），使用上次保留的状态",
+                 (unsigned long)slept_ms_, (int)esp_sleep_get_wakeup_cause());
+    } else {
+        if (from_sleep) {
+            ESP_LOGW(TAG, "⚠️ RTC里的恢复状态校验不过，按冷启动处理");
+        }
+        memset(&s_state, 0, sizeof(s_state));
+        s_state.magic = kMagic;
+        s_state.cold_wake_ready_ms = -1;
+    }
+    // 醒来之后状态接着用（镜像哈希、模型测量、冷启动耗时），下次睡前重新算CRC
+    s_state.crc = 0;
+
+    // 镜像哈希只对同一个固件有效
+    const esp_app_desc_t* app = esp_app_get_description();
+    if (memcmp(s_state.app_elf_sha, app->app_elf_sha256, sizeof(s_state.app_elf_sha)) != 0) {
+        memcpy(s_state.app_elf_sha, app->app_elf_sha256, sizeof(s_state.app_elf_sha));
+        s_state.image_sha[0] = '\0';
+    }
+}
+
+bool FastResume::ap(uint8_t bssid[6], uint8_t* channel) const {
+    if (!resumed_ || s_state.ap_channel == 0) {
+        return false;
+    }
+    memcpy(bssid, s_state.ap_bssid, 6);
+    *channel = s_state.ap_channel;
+    return true;
+}
+
+const char* FastResume::sessionToken() const {
+    return resumed_ ? s_state.session : "";
+}
+
+void FastResume::setSessionToken(const char* token, size_t len) {
+    if (len >= sizeof(s_state.session)) {
+        len = 0;    // 太长的不存，醒来就按新会话
+    }
+    memcpy(s_state.session, token, len);
+    s_state.session[len] = '\0';
+}
+
+bool FastResume::calibration(Calibration* out) const {
+    if (!resumed_) {
+        return false;
+    }
+    out->wake_gate_floor = s_state.wake_gate_floor;
+    out->drift_ppm = s_state.drift_ppm;
+    return true;
+}
+
+bool FastResume::wakeNetCost(int index, WakeNetCost* out) const {
+    if (index < 0 || index >= MAX_WAKENETS) {
+        return false;
+    }
+    const WakeNetCost& cost = s_state.wakenet[index];
+    if (cost.detect_avg_us == 0 || cost.model[0] == '\0') {
+        return false;
+    }
+    *out = cost;
+    return true;
+}
+
+void FastResume::setWakeNetCost(int index, const char* model, uint32_t permille, uint32_t detect_avg_us,
+                                uint32_t detect_max_us) {
+    if (index < 0 || index >= MAX_WAKENETS || !model || strlen(model) >= sizeof(s_state.wakenet[0].model)) {
+        return;
+    }
+    WakeNetCost& cost = s_state.wakenet[index];
+    strcpy(cost.model, model);
+    cost.permille = permille;
+    cost.detect_avg_us = detect_avg_us;
+    cost.detect_max_us = detect_max_us;
+}
+
+const char* FastResume::imageSha() const {
+    return s_state.image_sha;
+}
+
+void FastResume::setImageSha(const char* sha) {
+    if (sha && strlen(sha) < sizeof(s_state.image_sha)) {
+        strcpy(s_state.image_sha, sha);
+    }
+}
+
+void FastResume::noteWakeReady(int32_t ms) {
+    if (!resumed_) {
+        s_state.cold_wake_ready_ms = ms;
+        return;
+    }
+    int32_t cold = s_state.cold_wake_ready_ms;
+    if (cold > 0) {
+        ESP_LOGI(TAG, "⏱️ 快速恢复到唤醒就绪 %ld ms（冷启动 %ld ms，快了 %ld ms）", (long)ms, (long)cold,
+                 (long)(cold - ms));
+    } else {
+        ESP_LOGI(TAG, "⏱️ 快速恢复到唤醒就绪 %ld ms", (long)ms);
+    }
+}
+
+int32_t FastResume::coldWakeReadyMs() const {
+    return s_state.cold_wake_ready_ms;
+}
+
+esp_err_t FastResume::armWake(uint32_t timer_ms, int wake_gpio, int wake_level) {
+    if (timer_ms == 0 && wake_gpio < 0) {
+        ESP_LOGE(TAG, "❌ 没有唤醒源，不进深度睡眠");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (wake_gpio >= 0) {
+        gpio_num_t gpio = (gpio_num_t)wake_gpio;
+        if (!rtc_gpio_is_valid_gpio(gpio)) {
+            ESP_LOGE(TAG, "❌ GPIO%d不是RTC GPIO，不能唤醒深度睡眠", wake_gpio);
+            return ESP_ERR_INVALID_ARG;
+        }
+        esp_err_t ret = esp_sleep_enable_ext0_wakeup(gpio, wake_level);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "❌ 配置按键唤醒失败: %s", esp_err_to_name(ret));
+            return ret;
+        }
+        // 睡眠时数字GPIO的上下拉不生效，改用RTC的
+        if (wake_level == 0) {
+            rtc_gpio_pullup_en(gpio);
+            rtc_gpio_pulldown_dis(gpio);
+        } else {
+            rtc_gpio_pulldown_en(gpio);
+            rtc_gpio_pullup_dis(gpio);
+        }
+    }
+    if (timer_ms > 0) {
+        esp_sleep_enable_timer_wakeup((uint64_t)timer_ms * 1000);
+    }
+    ESP_LOGI(TAG, "🌙 唤醒源:%s%s", wake_gpio >= 0 ? " 按键" : "", timer_ms > 0 ? " 定时" : "");
+    return ESP_OK;
+}
+
+void FastResume::sleep(const Calibration& calibration) {
+    wifi_ap_record_t ap = {};
+    if (esp_wifi_sta_get_ap_info(&ap) == ESP_OK) {
+        memcpy(s_state.ap_bssid, ap.bssid, sizeof(s_state.ap_bssid));
+        s_state.ap_channel = ap.primary;
+    } else {
+        s_state.ap_channel = 0;
+    }
+    s_state.wake_gate_floor = calibration.wake_gate_floor;
+    s_state.drift_ppm = calibration.drift_ppm;
+    s_state.sleep_start_us = rtc_now_us();
+    s_state.crc = state_crc();
+
+    ESP_LOGI(TAG, "🌙 进入深度睡眠");
+    esp_wifi_stop();
+    esp_deep_sleep_start();
+}
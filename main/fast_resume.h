@@ -0,0 +1,114 @@
+/**
+ * @file fast_resume.h
+ * @brief 🌙 深度睡眠快速恢复 - 睡前把重新启动要花时间算/测/协商的东西留在RTC内存里，醒来直接用
+ *
+ * 电池供电时两次使用之间进深度睡眠，醒来是一次完整的app_main。冷启动慢在这几步：
+ * - WiFi：从NVS读上次的AP再连（fast_connect），DHCP走lwIP的CONFIG_LWIP_DHCP_RESTORE_LAST_IP
+ *   （NVS里的上次租约，直接REQUEST不DISCOVER）。RTC里再留一份AP的BSSID和信道（睡前从驱动读出当前的AP，
+ *   漫游过也是最新的），醒来不读NVS；租约照样交给lwIP续用，设备不自己当静态IP用（续租还要靠DHCP）
+ * - 唤醒词模型的CPU测量（WAKENET_COST_PROBE，每个模型几十毫秒）：模型没变时直接用上次的结果
+ * - 固件镜像哈希（hello要带，读整个镜像几十毫秒）：固件没变时（ELF哈希相同）直接用
+ * - 校准值：唤醒词能量门的底噪估计、播放时钟偏差估计，醒来不用重新收敛
+ * - 服务器会话：睡前发{"type":"sleep"}，服务器把豆包会话多暂存一会儿；醒来hello带上次的session作为
+ *   resume，服务器核对后直接接上，第一轮不用等开新会话
+ *
+ * RTC_DATA_ATTR的内容深度睡眠时保留，其他复位（上电、软件复位、看门狗）都会清掉；
+ * 另外加了魔数和CRC，固件升级后布局变了也不会误用。启动时间线和hello里报告这次是不是快速恢复、
+ * 睡了多久、和上次冷启动相比唤醒就绪快了多少。
+ */
+
+#ifndef FAST_RESUME_H
+#define FAST_RESUME_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+class FastResume {
+public:
+    /**
+     * @brief 唤醒词模型的CPU测量结果（和AudioFrontEnd::WakeNetCost同样的字段）
+     */
+    struct WakeNetCost {
+        char model[24];
+        uint32_t permille;
+        uint32_t detect_avg_us;
+        uint32_t detect_max_us;
+    };
+
+    /**
+     * @brief 睡前交给sleep()的校准值
+     */
+    struct Calibration {
+        uint32_t wake_gate_floor;   // 0=没有
+        float drift_ppm;
+    };
+
+    static constexpr int MAX_WAKENETS = 2;
+
+    FastResume();
+
+    /**
+     * @brief app_main最开始调用：是不是从深度睡眠醒来、RTC里的状态能不能用
+     */
+    void init();
+
+    bool resumed() const { return resumed_; }
+
+    /**
+     * @brief 在深度睡眠里待了多久（只有resumed()时有意义）
+     */
+    uint32_t sleptMs() const { return slept_ms_; }
+
+    /**
+     * @brief 睡前连着的AP（resumed()时才有）
+     */
+    bool ap(uint8_t bssid[6], uint8_t* channel) const;
+
+    /**
+     * @brief 服务器hello回复里的session，醒来放进hello的resume（空串=没有）
+     */
+    const char* sessionToken() const;
+    void setSessionToken(const char* token, size_t len);
+
+    bool calibration(Calibration* out) const;
+
+    /**
+     * @brief 第index个唤醒词模型上次的测量结果（带模型名，用之前要和这次选中的模型核对）
+     */
+    bool wakeNetCost(int index, WakeNetCost* out) const;
+    void setWakeNetCost(int index, const char* model, uint32_t permille, uint32_t detect_avg_us,
+                        uint32_t detect_max_us);
+
+    /**
+     * @brief 固件镜像哈希（hello里的sha，固件没变时才有）
+     */
+    const char* imageSha() const;
+    void setImageSha(const char* sha);
+
+    /**
+     * @brief 唤醒就绪：记下这次的耗时，冷启动的留着和以后的快速恢复比较
+     */
+    void noteWakeReady(int32_t ms);
+    int32_t coldWakeReadyMs() const;
+
+    /**
+     * @brief 配置唤醒源（断开服务器之前调用，失败时照常运行、不要睡）
+     *
+     * @param timer_ms 定时醒来（0=不定时）
+     * @param wake_gpio 按键醒来的RTC GPIO（-1=没有），按下电平为wake_level
+     */
+    esp_err_t armWake(uint32_t timer_ms, int wake_gpio, int wake_level);
+
+    /**
+     * @brief 存下睡前的AP和校准值，进入深度睡眠（不返回）
+     */
+    void sleep(const Calibration& calibration);
+
+private:
+    static const char* TAG;
+    bool resumed_;
+    uint32_t slept_ms_;
+};
+
+#endif // FAST_RESUME_H
@@ -0,0 +1,143 @@
+/**
+ * @file flash_scheduler.cc
+ * @brief 💾 Flash写入调度实现
+ */
+
+#include "flash_scheduler.h"
+#include <string.h>
+#include <atomic>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "flight_recorder.h"
+#include "freertos/FreeRTOS.h"
+#include "perf_counters.h"
+#include "project_config.h"
+
+static const char* TAG = "FlashScheduler";
+
+struct PendingJob {
+    const char* name;       // nullptr=空槽位
+    FlashScheduler::Job job;
+    void* ctx;
+};
+
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static PendingJob s_pending[FlashScheduler::MAX_PENDING] = {};
+static std::atomic<bool> s_idle{true};      // 启动时音频任务还没起来，算空闲
+static int64_t s_idle_since_us = 0;         // 只在主任务里读写
+
+esp_err_t FlashScheduler::defer(const char* name, Job job, void* ctx) {
+#if FLASH_SCHEDULER_ENABLE
+    bool queued = false;
+    portENTER_CRITICAL(&s_lock);
+    PendingJob* free_slot = nullptr;
+    for (PendingJob& slot : s_pending) {
+        if (slot.name && strcmp(slot.name, name) == 0) {
+            slot.job = job;
+            slot.ctx = ctx;
+            queued = true;
+            break;
+        }
+        if (!slot.name && !free_slot) {
+            free_slot = &slot;
+        }
+    }
+    if (!queued && free_slot) {
+        *free_slot = {name, job, ctx};
+        queued = true;
+    }
+    portEXIT_CRITICAL(&s_lock);
+    if (queued) {
+        PerfCounters::add(PerfCounter::FLASH_DEFERRED);
+        ESP_LOGD(TAG, "💾 %s 等空闲时再写", name);
+        return ESP_OK;
+    }
+    ESP_LOGW(TAG, "⚠️ 排队的写入满了（%u个），%s 直接写", (unsigned)MAX_PENDING, name);
+#endif
+    return run(name, job, ctx);
+}
+
+esp_err_t FlashScheduler::run(const char* name, Job job, void* ctx) {
+    int64_t start = esp_timer_get_time();
+    esp_err_t ret = job(ctx);
+    noteOp(name, esp_timer_get_time() - start);
+    return ret;
+}
+
+void FlashScheduler::noteOp(const char* name, int64_t us) {
+    uint32_t stall_us = us > 0 ? (uint32_t)us : 0;
+    bool live = !s_idle.load(std::memory_order_relaxed);
+    PerfCounters::add(PerfCounter::FLASH_OPS);
+    PerfCounters::add(PerfCounter::FLASH_STALL_US, stall_us);
+    PerfCounters::noteMax(PerfGauge::FLASH_STALL_MAX_US, stall_us);
+    if (live) {
+        PerfCounters::add(PerfCounter::FLASH_LIVE_OPS);
+    }
+    if (stall_us >= FLASH_STALL_WARN_US) {
+        uint32_t ms = stall_us / 1000;
+        FLIGHT_RECORD(FLASH_STALL, ms > 0xFFFF ? 0xFFFF : ms, live ? 1 : 0);
+        if (live) {
+            ESP_LOGW(TAG, "⚠️ 会话期间写Flash（%s）停顿 %lu us", name, (unsigned long)stall_us);
+            return;
+        }
+    }
+    ESP_LOGD(TAG, "💾 %s 写Flash %lu us%s", name, (unsigned long)stall_us, live ? "（会话期间）" : "");
+}
+
+void FlashScheduler::setIdle(bool idle) {
+    if (idle && !s_idle.load(std::memory_order_relaxed)) {
+        s_idle_since_us = esp_timer_get_time();
+    }
+    s_idle.store(idle, std::memory_order_relaxed);
+}
+
+bool FlashScheduler::isIdle() {
+    return s_idle.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief 取出一份排着的写入（没有时返回false）
+ */
+static bool take_pending(PendingJob* out) {
+    bool found = false;
+    portENTER_CRITICAL(&s_lock);
+    for (PendingJob& slot : s_pending) {
+        if (slot.name) {
+            *out = slot;
+            slot = {};
+            found = true;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&s_lock);
+    return found;
+}
+
+void FlashScheduler::poll() {
+    if (!s_idle.load(std::memory_order_relaxed) ||
+        esp_timer_get_time() - s_idle_since_us < (int64_t)FLASH_SCHEDULER_SETTLE_MS * 1000) {
+        return;
+    }
+    // 一次循环只写一份，几份排在一起时中间还能照常处理唤醒和服务器消息
+    PendingJob job;
+    if (take_pending(&job)) {
+        run(job.name, job.job, job.ctx);
+    }
+}
+
+void FlashScheduler::flush() {
+    PendingJob job;
+    while (take_pending(&job)) {
+        run(job.name, job.job, job.ctx);
+    }
+}
+
+size_t FlashScheduler::pending() {
+    size_t count = 0;
+    portENTER_CRITICAL(&s_lock);
+    for (const PendingJob& slot : s_pending) {
+        count += slot.name ? 1 : 0;
+    }
+    portEXIT_CRITICAL(&s_lock);
+    return count;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file flash_scheduler.h
+ * @brief 💾 Flash写入调度 - 不急的NVS写入攒到空闲时再写，写Flash造成的停顿单独计数
+ *
+ * 擦写Flash期间两个核心的cache都关闭：不在IRAM里的代码、Flash里的常量（WakeNet/AFE模型、
+ * 提示音、esp-dsp系数表）全都访问不了，普通任务一律停住，只有IRAM里的中断（CONFIG_I2S_ISR_IRAM_SAFE）
+ * 还在跑。一次NVS提交少则几毫秒，碰上整页擦除能到几十毫秒——会话里发生就是一段上行空洞、一次播放欠载。
+ *
+ * 会话期间的写入大多不急：服务器下发的唤醒词参数/运行时参数（新值已经在内存里生效）、
+ * 连上WiFi后记住AP。这些改成defer()：按名字只保留最新的一份，主循环在空闲（没有会话、没在播放）
+ * 持续FLASH_SCHEDULER_SETTLE_MS之后每次循环写一份；重启、深度睡眠之前flush()全部写掉。
+ * 必须马上写的（启动时的NVS修复、OTA、确认新固件）照常写，只是用noteOp()记下耗时。
+ *
+ * 每次写入都计入FLASH_OPS/FLASH_STALL_US和最长一次FLASH_STALL_MAX_US；不在空闲时写的另计FLASH_LIVE_OPS，
+ * 超过FLASH_STALL_WARN_US的记一条FLASH_STALL进黑匣子。写的时候还要继续跑的只有I2S中断和DMA描述符环，
+ * 实时音频配置下它们在IRAM/内部RAM里，写完后采集任务和播放写入路径（也在IRAM里）一次处理完积压，见realtime_audio.h。
+ */
+
+#ifndef FLASH_SCHEDULER_H
+#define FLASH_SCHEDULER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+class FlashScheduler {
+public:
+    /**
+     * @brief 一次写入（在主任务里执行，返回写NVS的结果）
+     */
+    using Job = esp_err_t (*)(void* ctx);
+
+    static constexpr size_t MAX_PENDING = 6;
+
+    /**
+     * @brief 排一个不急的写入，空闲时执行；同名的还没写就替换掉（ctx指向的内容要一直有效）
+     *
+     * 任意任务都可以调用。排队满了、或者FLASH_SCHEDULER_ENABLE关闭时直接执行。
+     * @return 排上了或者直接写成功返回ESP_OK
+     */
+    static esp_err_t defer(const char* name, Job job, void* ctx);
+
+    /**
+     * @brief 马上执行一个写入并计时
+     */
+    static esp_err_t run(const char* name, Job job, void* ctx);
+
+    /**
+     * @brief 记下一次在别处直接完成的Flash操作的耗时
+     */
+    static void noteOp(const char* name, int64_t us);
+
+    /**
+     * @brief 主循环每次告诉调度器现在是不是空闲（没有会话、没在播放）
+     */
+    static void setIdle(bool idle);
+    static bool isIdle();
+
+    /**
+     * @brief 主循环调用：空闲持续够久时写一份排着的
+     */
+    static void poll();
+
+    /**
+     * @brief 把排着的全部写掉（重启、深度睡眠之前）
+     */
+    static void flush();
+
+    static size_t pending();
+};
+
+#endif // FLASH_SCHEDULER_H
@@ -0,0 +1,87 @@
+/**
+ * @file flash_stream.cc
+ * @brief 📼 Flash数据的块读取和缓存行回收
+ */
+
+#include "flash_stream.h"
+#include <string.h>
+#include "esp_cache.h"
+#include "esp_memory_utils.h"
+#include "perf_counters.h"
+
+bool FlashStream::isFlashMapped(const void* ptr) {
+    return esp_ptr_in_drom(ptr) && !esp_ptr_external_ram(ptr);
+}
+
+size_t FlashStream::bufferSize(size_t max_peek, size_t block_bytes) {
+    // 块尾对齐时最多少拷一行，多留一行才能保证一次凑够max_peek
+    size_t need = max_peek + LINE_BYTES;
+    return need > block_bytes ? need : block_bytes;
+}
+
+FlashStream::FlashStream()
+    : src_(nullptr)
+    , size_(0)
+    , pos_(0)
+    , buffer_(nullptr)
+    , capacity_(0)
+    , head_(0)
+    , tail_(0)
+{
+}
+
+void FlashStream::begin(const uint8_t* src, size_t size, uint8_t* buffer, size_t capacity) {
+    src_ = src;
+    size_ = size;
+    pos_ = 0;
+    buffer_ = buffer;
+    capacity_ = capacity;
+    head_ = 0;
+    tail_ = 0;
+}
+
+const uint8_t* FlashStream::peek(size_t len, size_t* available) {
+    if (tail_ - head_ < len && pos_ < size_) {
+        refill();
+    }
+    size_t n = tail_ - head_;
+    *available = n < len ? n : len;
+    return buffer_ + head_;
+}
+
+void FlashStream::refill() {
+    // 没用完的部分挪到开头（最多一次peek的长度），后面接着拷
+    size_t remain = tail_ - head_;
+    if (head_ > 0 && remain > 0) {
+        memmove(buffer_, buffer_ + head_, remain);
+    }
+    head_ = 0;
+    tail_ = remain;
+
+    size_t n = capacity_ - tail_;
+    if (n > size_ - pos_) {
+        n = size_ - pos_;
+    }
+    // 不是最后一块时块尾对齐到缓存行，下一块从行首开始，每行只缺失一次
+    const uint8_t* from = src_ + pos_;
+    if (pos_ + n < size_) {
+        uintptr_t end = ((uintptr_t)from + n) & ~(uintptr_t)(LINE_BYTES - 1);
+        if (end > (uintptr_t)from) {
+            n = end - (uintptr_t)from;
+        }
+    }
+    memcpy(buffer_ + tail_, from, n);
+    dropLines(from, n);
+    PerfCounters::add(PerfCounter::PROMPT_FLASH_BYTES, (uint32_t)n);
+    pos_ += n;
+    tail_ += n;
+}
+
+void FlashStream::dropLines(const uint8_t* start, size_t len) {
+    // 只作废整行都在这一块里的行：首尾不满一行的可能还装着相邻的数据，保留
+    uintptr_t first = ((uintptr_t)start + LINE_BYTES - 1) & ~(uintptr_t)(LINE_BYTES - 1);
+    uintptr_t last = ((uintptr_t)start + len) & ~(uintptr_t)(LINE_BYTES - 1);
+    if (last > first) {
+        esp_cache_msync((void*)first, last - first, ESP_CACHE_MSYNC_FLAG_DIR_M2C | ESP_CACHE_MSYNC_FLAG_TYPE_DATA);
+    }
+}
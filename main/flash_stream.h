@@ -0,0 +1,77 @@
+/**
+ * @file flash_stream.h
+ * @brief 📼 Flash数据流式读取 - 按缓存行对齐的块把内存映射的Flash数据拷进内部RAM，拷完就让出缓存行
+ *
+ * 提示音（prompts分区、编进固件的PCM数组）都经过数据缓存映射在Flash上。混音器每块直接读映射地址的话，
+ * 一条长提示音读过的缓存行会一直留在64KB的数据缓存里，把WakeNet/AFE的模型和PSRAM里的热数据挤出去，
+ * 唤醒词检测每帧的耗时跟着抖。这里改成由播放任务按块读：
+ *
+ * - 每次顺序拷PROMPT_STREAM_BLOCK_BYTES左右到内部RAM，块尾对齐到缓存行，每行Flash只读一次
+ * - 拷完把整行落在这一块里的缓存行作废（esp_cache_msync），这些行变成空闲行，之后的缓存缺失先用它们，
+ *   不用替换别人的行；只对Flash映射作废，PSRAM里可能有没写回的数据
+ *
+ * 不在Flash里的数据（RAM里的数组）不需要这个类，调用方直接读。只在一个任务中使用，不加锁。
+ */
+
+#ifndef FLASH_STREAM_H
+#define FLASH_STREAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+class FlashStream {
+public:
+    // S3的数据缓存行是16/32/64字节（sdkconfig里是64），按64对齐对更小的行也成立
+    static constexpr size_t LINE_BYTES = 64;
+
+    /**
+     * @brief 这个地址是否是通过数据缓存映射的Flash（不含PSRAM）
+     */
+    static bool isFlashMapped(const void* ptr);
+
+    /**
+     * @brief 至少要多大的缓冲区，peek(max_peek)才总能拿到max_peek字节
+     */
+    static size_t bufferSize(size_t max_peek, size_t block_bytes);
+
+    FlashStream();
+
+    /**
+     * @param src 内存映射的数据
+     * @param size 字节数
+     * @param buffer 内部RAM缓冲区（按bufferSize()分配，至少2字节对齐）
+     * @param capacity 缓冲区字节数
+     */
+    void begin(const uint8_t* src, size_t size, uint8_t* buffer, size_t capacity);
+
+    /**
+     * @brief 取接下来最多len个连续字节（不够时从Flash再拷一块），下一次peek()之前有效
+     *
+     * @param available 实际拿到的字节数，只有数据快读完时才小于len
+     */
+    const uint8_t* peek(size_t len, size_t* available);
+
+    /**
+     * @brief 读位置前进len字节（不超过上次peek拿到的字节数）
+     */
+    void consume(size_t len) { head_ += len; }
+
+    /**
+     * @brief 从Flash拷进来的总字节数
+     */
+    size_t loaded() const { return pos_; }
+
+private:
+    void refill();
+    static void dropLines(const uint8_t* start, size_t len);
+
+    const uint8_t* src_;
+    size_t size_;
+    size_t pos_;            // 下一次从src_拷贝的位置
+    uint8_t* buffer_;
+    size_t capacity_;
+    size_t head_;           // 缓冲区里已经消费到的位置
+    size_t tail_;           // 缓冲区里有效数据的末尾
+};
+
+#endif // FLASH_STREAM_H
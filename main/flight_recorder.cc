@@ -0,0 +1,128 @@
+/**
+ * @file flight_recorder.cc
+ * @brief 🛩️ 黑匣子的RTC环形数组和上传
+ */
+
+#include "flight_recorder.h"
+#include <string.h>
+#include <atomic>
+#include "buffer_placement.h"
+#include "esp_attr.h"
+#include "esp_cpu.h"
+#include "esp_log.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+
+static const char* TAG = "FlightRecorder";
+
+static const uint32_t kMagic = 0x464C5231;      // "FLR1"，事件布局变了就换一个
+
+struct FlightSlot {
+    uint32_t t_us;
+    uint32_t word;      // event | aux << 8 | arg << 16
+};
+
+/**
+ * @brief RTC里的记录：magic和它的反码都对上才认为是上一次写的（上电时是随机内容）
+ */
+struct FlightRing {
+    uint32_t magic;
+    uint32_t magic_inv;
+    uint32_t head;      // 已经追加的事件总数（下一条写到head % CAPACITY）
+    FlightSlot slots[FlightRecorder::CAPACITY];
+};
+
+RTC_NOINIT_ATTR static FlightRing s_ring;
+static std::atomic<uint32_t> s_next{0};
+static bool s_recording = false;
+
+// 上一次的记录（从旧到新），上传完释放
+static FlightSlot* s_pending = nullptr;
+static size_t s_pending_count = 0;
+static size_t s_pending_sent = 0;
+static uint8_t s_pending_reason = 0;
+
+#if FLIGHT_RECORDER_ENABLE
+static void on_shutdown() {
+    FlightRecorder::record(FlightEvent::RESTART);
+}
+#endif
+
+void FlightRecorder::init() {
+#if FLIGHT_RECORDER_ENABLE
+    esp_reset_reason_t reason = esp_reset_reason();
+    bool upload = reason == ESP_RST_SW || reason == ESP_RST_PANIC || reason == ESP_RST_INT_WDT ||
+                  reason == ESP_RST_TASK_WDT || reason == ESP_RST_WDT || reason == ESP_RST_BROWNOUT;
+    if (upload && s_ring.magic == kMagic && s_ring.magic_inv == ~kMagic && s_ring.head > 0) {
+        size_t count = s_ring.head < CAPACITY ? s_ring.head : CAPACITY;
+        s_pending = (FlightSlot*)BufferPlacement::alloc("flight_record", count * sizeof(FlightSlot), Placement::PSRAM);
+        if (s_pending) {
+            uint32_t first = s_ring.head - (uint32_t)count;
+            for (size_t i = 0; i < count; i++) {
+                s_pending[i] = s_ring.slots[(first + i) & (CAPACITY - 1)];
+            }
+            s_pending_count = count;
+            s_pending_reason = (uint8_t)reason;
+            ESP_LOGW(TAG, "🛩️ 上次复位（原因%d）前记下了%u个事件，连上服务器后上传", (int)reason, (unsigned)count);
+        }
+    }
+    s_ring.magic = kMagic;
+    s_ring.magic_inv = ~kMagic;
+    s_ring.head = 0;
+    s_next.store(0, std::memory_order_relaxed);
+    s_recording = true;
+    esp_register_shutdown_handler(on_shutdown);
+    record(FlightEvent::BOOT, (uint32_t)reason);
+#endif
+}
+
+IRAM_ATTR void FlightRecorder::record(FlightEvent event, uint32_t arg, uint8_t aux) {
+    if (!s_recording) {
+        return;
+    }
+    uint32_t index = s_next.fetch_add(1, std::memory_order_relaxed);
+    FlightSlot& slot = s_ring.slots[index & (CAPACITY - 1)];
+    slot.t_us = (uint32_t)esp_timer_get_time();
+    uint32_t info = (aux & 0x7F) | (uint32_t)esp_cpu_get_core_id() << 7;
+    slot.word = (uint32_t)event | info << 8 | (arg > 0xFFFF ? 0xFFFFu : arg) << 16;
+    s_ring.head = index + 1;
+}
+
+bool FlightRecorder::hasPending() {
+    return s_pending != nullptr;
+}
+
+void FlightRecorder::rewind() {
+    s_pending_sent = 0;
+}
+
+size_t FlightRecorder::takeBatch(uint8_t* out) {
+    if (!s_pending) {
+        return 0;
+    }
+    if (s_pending_sent == s_pending_count) {
+        // 最后一批上一轮已经发出去了
+        BufferPlacement::free(s_pending);
+        s_pending = nullptr;
+        s_pending_count = 0;
+        s_pending_sent = 0;
+        return 0;
+    }
+    size_t first = s_pending_sent;
+    size_t n = s_pending_count - first;
+    if (n > MAX_BATCH_EVENTS) {
+        n = MAX_BATCH_EVENTS;
+    }
+    bool last = first + n == s_pending_count;
+    uint16_t total = (uint16_t)s_pending_count;
+    uint16_t start = (uint16_t)first;
+    uint16_t zero = 0;
+    out[0] = s_pending_reason;
+    out[1] = last ? 1 : 0;
+    memcpy(out + 2, &total, 2);
+    memcpy(out + 4, &start, 2);
+    memcpy(out + 6, &zero, 2);
+    memcpy(out + BATCH_HEADER_BYTES, s_pending + first, n * EVENT_BYTES);
+    s_pending_sent = first + n;
+    return BATCH_HEADER_BYTES + n * EVENT_BYTES;
+}
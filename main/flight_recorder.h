@@ -0,0 +1,104 @@
+/**
+ * @file flight_recorder.h
+ * @brief 🛩️ 黑匣子 - 最近一段时间的关键事件记在复位后还保留的RTC内存里，软件复位/崩溃后下次连上服务器时上传
+ *
+ * 设备卡一下或者重启之后，串口日志早就没了，PerfCounters也从0开始。这里在RTC慢速内存
+ * （RTC_NOINIT_ATTR，软件复位、异常、看门狗、掉电复位都不清）放一个固定大小的环形数组，
+ * 采集（漏块/覆盖）、上行队列（帧池耗尽/队列满）、WebSocket（连接/断开/发送过期）、I2S（写卡住/锁超时/DMA欠载、
+ * 抖动缓冲区欠载）、看门狗热重启、会话开始/结束各记一条，主循环每FLIGHT_RECORDER_TICK_MS再记一条心跳
+ * （内部RAM空闲和发送队列深度；心跳停了说明主循环停了）。CAPACITY条心跳大约是几分钟，事件多时相应缩短。
+ *
+ * 追加是无锁的：fetch_add领一个槽位，写两个字，再记下写到了哪里；两个核心、中断里都可以调用，
+ * 只有几十个周期，热路径上直接调用不用攒。两个核心同时追加时RTC里记的位置可能落后一条，
+ * 复位时正在写的那条可能只写了一半，服务器按时间戳排序，坏的一条自己能看出来。
+ * 没有放PSRAM：崩溃时cache里还没写回的数据会丢，RTC内存是直接写的。
+ *
+ * 启动时init()看复位原因：软件复位（含看门狗升级的整机重启、升级重启）、异常、看门狗、掉电时把上一次的
+ * 记录拷出来等着上传，然后清空重新记；上电、深度睡眠醒来不上传。hello确认之后takeBatch()把拷贝
+ * 分成几个FLIGHT_RECORD控制帧发给服务器（需要二进制控制帧），格式（小端）：
+ *
+ *     reason(u8，esp_reset_reason_t) | flags(u8，bit0=最后一批) | total(u16，整份记录的事件数) | first(u16，这批第一条的序号) | 0(u16) |
+ *     事件 × N：t_us(u32，启动后的微秒，约71分钟回绕) | event(u8，FlightEvent) | aux(u8，bit7=核心，低7位按事件) | arg(u16)
+ *
+ * 事件从旧到新；server.py把时间换算成"复位前多少毫秒"，写成JSON文件并打一行"🛩️ FLIGHT"汇总。
+ */
+
+#ifndef FLIGHT_RECORDER_H
+#define FLIGHT_RECORDER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "control_protocol.h"
+#include "project_config.h"
+
+/**
+ * @brief 事件（数值和server.py的FLIGHT_EVENTS一致，只能在末尾追加）
+ */
+enum class FlightEvent : uint8_t {
+    BOOT,               // 开始记录（arg=这次的复位原因）
+    TICK,               // 主循环心跳（arg=内部RAM空闲KB，aux=上行发送队列深度）
+    CAPTURE_OVERRUN,    // 采集任务来不及、被DMA覆盖的块（arg=新增块数）
+    CAPTURE_GAP,        // 接收中断来晚了漏掉的块（arg=新增块数）
+    UPLINK_POOL_DROP,   // 帧池耗尽丢掉的上行帧
+    UPLINK_QUEUE_DROP,  // 发送队列满丢掉的上行帧
+    WS_CONNECT,
+    WS_DISCONNECT,
+    WS_STALE_DROP,      // 上行音频在WebSocket发送队列里过期（arg=等了多少ms）
+    I2S_STALL,          // 写I2S连续I2S_SINK_STALL_MS没有进展（arg=待写字节数）
+    I2S_LOCK_TIMEOUT,   // 写I2S时等播放输出的锁超时
+    I2S_DMA_UNDERRUN,   // 写入期间DMA送空（arg=新增次数）
+    JITTER_UNDERRUN,    // 一段播放里的抖动缓冲区欠载（arg=次数）
+    WATCHDOG,           // 子系统卡住（arg=卡了多少ms，aux=Watch）
+    SESSION_START,
+    SESSION_END,
+    RESTART,            // esp_restart()（arg=0）
+    FLASH_STALL,        // 一次写Flash超过FLASH_STALL_WARN_US（arg=ms，aux=1表示不在空闲时，见flash_scheduler.h）
+    UDP_FALLBACK,       // UDP音频通道的一个方向退回WebSocket（arg=丢失率%，aux=0上行/1下行/2探测不通，见udp_audio.h）
+    COUNT
+};
+
+class FlightRecorder {
+public:
+    static constexpr size_t CAPACITY = FLIGHT_RECORDER_EVENTS;
+    static constexpr size_t BATCH_HEADER_BYTES = 8;
+    static constexpr size_t EVENT_BYTES = 8;
+    static constexpr size_t MAX_BATCH_BYTES = ControlProtocol::MAX_FRAME - sizeof(ControlProtocol::Header);
+    static constexpr size_t MAX_BATCH_EVENTS = (MAX_BATCH_BYTES - BATCH_HEADER_BYTES) / EVENT_BYTES;
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0 && CAPACITY <= 65535, "FLIGHT_RECORDER_EVENTS必须是2的幂");
+
+    /**
+     * @brief app_main开头调用一次：需要上传时拷出上一次的记录，然后清空开始记录
+     */
+    static void init();
+
+    /**
+     * @brief 追加一个事件（任意任务、任意核心、中断里都可以调用；init()之前调用不记）
+     */
+    static void record(FlightEvent event, uint32_t arg = 0, uint8_t aux = 0);
+
+    /**
+     * @brief 还有没有上一次的记录等着上传
+     */
+    static bool hasPending();
+
+    /**
+     * @brief 从头重新上传（发送失败、连接断开时调用，下次hello之后整份重发）
+     */
+    static void rewind();
+
+    /**
+     * @brief 取一批编码成FLIGHT_RECORD帧的负载（主任务中调用），最后一批发出之后的下一次调用释放拷贝
+     *
+     * @param out 至少MAX_BATCH_BYTES字节
+     * @return 负载字节数，没有要上传的（或已经全部取走）时返回0
+     */
+    static size_t takeBatch(uint8_t* out);
+};
+
+#if FLIGHT_RECORDER_ENABLE
+#define FLIGHT_RECORD(event, ...) FlightRecorder::record(FlightEvent::event, ##__VA_ARGS__)
+#else
+#define FLIGHT_RECORD(event, ...) do { } while (0)
+#endif
+
+#endif // FLIGHT_RECORDER_H
@@ -0,0 +1,296 @@
+/**
+ * @file heap_monitor.cc
+ * @brief 🧱 堆监控实现
+ */
+
+#include "heap_monitor.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_memory_utils.h"
+#include "freertos/FreeRTOS.h"
+#include "project_config.h"
+#include "sdkconfig.h"
+
+// 分配点统计挂在分配钩子上，没有钩子时不编译
+#define HEAP_SITES_ENABLED (HEAP_MONITOR_SITES && CONFIG_HEAP_USE_HOOKS)
+#if HEAP_SITES_ENABLED
+#include "esp_debug_helpers.h"
+#endif
+
+const char* HeapMonitor::TAG = "HeapMonitor";
+
+static const uint32_t kRegionCaps[(size_t)HeapRegion::COUNT] = {
+    MALLOC_CAP_INTERNAL,
+    MALLOC_CAP_SPIRAM,
+};
+static const char* const kRegionNames[(size_t)HeapRegion::COUNT] = { "内部RAM", "PSRAM" };
+
+static HeapMonitor::Sample s_samples[(size_t)HeapRegion::COUNT];
+static portMUX_TYPE s_sample_lock = portMUX_INITIALIZER_UNLOCKED;
+
+#if CONFIG_HEAP_USE_HOOKS
+// 堆组件的弱符号钩子：每次分配成功后调用，可能在cache关闭期间运行，必须在IRAM且不能再分配内存
+extern "C" IRAM_ATTR void esp_heap_trace_alloc_hook(void* ptr, size_t size, uint32_t caps) {
+    (void)caps;
+    HeapMonitor::noteAlloc(ptr, size);
+}
+
+extern "C" IRAM_ATTR void esp_heap_trace_free_hook(void* ptr) {
+    (void)ptr;
+}
+#endif
+
+#if HEAP_SITES_ENABLED
+/**
+ * @brief 分配点：跳过堆内部的HEAP_MONITOR_SITE_SKIP层后连续HEAP_MONITOR_SITE_FRAMES层的PC
+ *
+ * malloc、heap_caps_malloc、operator new进到钩子的层数不同，只取一层PC会把同一个调用点拆开或把
+ * 不同调用点合并到堆内部的同一个函数，所以用几层PC一起当键，上报时整串给addr2line。
+ */
+struct AllocSite {
+    uint32_t pc[HEAP_MONITOR_SITE_FRAMES];
+    uint32_t count;
+    uint32_t bytes;
+};
+
+static AllocSite s_sites[HEAP_MONITOR_SITE_SLOTS];
+static uint32_t s_site_overflow = 0;        // 表满了没记上的分配次数
+static portMUX_TYPE s_site_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static IRAM_ATTR void note_site(size_t size) {
+    uint32_t pc[HEAP_MONITOR_SITE_FRAMES] = {};
+    esp_backtrace_frame_t frame = {};
+    esp_backtrace_get_start(&frame.pc, &frame.sp, &frame.next_pc);
+    for (int depth = 0; depth < HEAP_MONITOR_SITE_SKIP + HEAP_MONITOR_SITE_FRAMES; depth++) {
+        if (depth >= HEAP_MONITOR_SITE_SKIP) {
+            pc[depth - HEAP_MONITOR_SITE_SKIP] = esp_cpu_process_stack_pc(frame.pc);
+        }
+        if (frame.next_pc == 0 || !esp_backtrace_get_next_frame(&frame)) {
+            break;
+        }
+    }
+
+    portENTER_CRITICAL_SAFE(&s_site_lock);
+    AllocSite* hit = nullptr;
+    for (AllocSite& site : s_sites) {
+        if (site.count == 0) {
+            memcpy(site.pc, pc, sizeof(pc));
+            hit = &site;
+            break;
+        }
+        if (memcmp(site.pc, pc, sizeof(pc)) == 0) {
+            hit = &site;
+            break;
+        }
+    }
+    if (hit != nullptr) {
+        hit->count++;
+        hit->bytes += size;
+    } else {
+        s_site_overflow++;
+    }
+    portEXIT_CRITICAL_SAFE(&s_site_lock);
+}
+#endif
+
+/**
+ * @brief 分配失败回调（在分配失败的任务里调用）
+ */
+static void on_alloc_failed(size_t size, uint32_t caps, const char* function_name) {
+    (void)caps;
+    (void)function_name;
+    HeapMonitor::noteFailed(size);
+}
+
+IRAM_ATTR void HeapMonitor::noteAlloc(void* ptr, size_t size) {
+    HeapRegion region = esp_ptr_external_ram(ptr) ? HeapRegion::PSRAM : HeapRegion::INTERNAL;
+    alloc_count_[(size_t)region].fetch_add(1, std::memory_order_relaxed);
+    alloc_bytes_[(size_t)region].fetch_add((uint32_t)size, std::memory_order_relaxed);
+    if (tripwire_armed_.load(std::memory_order_relaxed) &&
+        late_allocs_.fetch_add(1, std::memory_order_relaxed) == 0) {
+        first_late_size_.store((uint32_t)size, std::memory_order_relaxed);
+    }
+#if HEAP_SITES_ENABLED
+    note_site(size);
+#endif
+}
+
+void HeapMonitor::armTripwire() {
+#if HEAP_TRIPWIRE_ENABLE
+#if HEAP_SITES_ENABLED
+    // 启动期间的分配点不再关心，表里只留运行中的
+    portENTER_CRITICAL(&s_site_lock);
+    memset(s_sites, 0, sizeof(s_sites));
+    s_site_overflow = 0;
+    portEXIT_CRITICAL(&s_site_lock);
+#endif
+    tripwire_armed_.store(true, std::memory_order_relaxed);
+#if CONFIG_HEAP_USE_HOOKS
+    ESP_LOGI(TAG, "🪤 启动完成，之后的内存分配都会计入late_allocs");
+#else
+    ESP_LOGI(TAG, "🪤 没有打开CONFIG_HEAP_USE_HOOKS，运行中分配无法计数");
+#endif
+#endif
+}
+
+void HeapMonitor::noteFailed(size_t size) {
+    failed_allocs_.fetch_add(1, std::memory_order_relaxed);
+    last_failed_size_.store((uint32_t)size, std::memory_order_relaxed);
+}
+
+void HeapMonitor::sample(void* arg) {
+    (void)arg;
+    static int64_t last_us = 0;
+    static uint32_t last_count[(size_t)HeapRegion::COUNT] = {};
+    static uint32_t last_bytes[(size_t)HeapRegion::COUNT] = {};
+    static uint32_t last_failed = 0;
+    static bool warned = false;
+    static bool late_warned = false;
+
+    int64_t now = esp_timer_get_time();
+    uint32_t elapsed_ms = last_us > 0 ? (uint32_t)((now - last_us) / 1000) : 0;
+    for (size_t i = 0; i < (size_t)HeapRegion::COUNT; i++) {
+        multi_heap_info_t info = {};
+        heap_caps_get_info(&info, kRegionCaps[i]);
+        uint32_t count = alloc_count_[i].load(std::memory_order_relaxed);
+        uint32_t bytes = alloc_bytes_[i].load(std::memory_order_relaxed);
+
+        portENTER_CRITICAL(&s_sample_lock);
+        Sample& s = s_samples[i];
+        s.free_bytes = (uint32_t)info.total_free_bytes;
+        s.largest_block = (uint32_t)info.largest_free_block;
+        if (s.min_largest == 0 || s.largest_block < s.min_largest) {
+            s.min_largest = s.largest_block;
+        }
+        s.free_blocks = (uint32_t)info.free_blocks;
+        if (elapsed_ms > 0) {
+            s.allocs_per_s = (uint32_t)((uint64_t)(count - last_count[i]) * 1000 / elapsed_ms);
+            s.bytes_per_s = (uint32_t)((uint64_t)(bytes - last_bytes[i]) * 1000 / elapsed_ms);
+        }
+        portEXIT_CRITICAL(&s_sample_lock);
+        last_count[i] = count;
+        last_bytes[i] = bytes;
+    }
+    last_us = now;
+
+    // 内部RAM最大连续块是WiFi/lwIP和DMA缓冲区的上限，掉到阈值以下时提示一次（回升后重新计）
+    uint32_t largest = s_samples[(size_t)HeapRegion::INTERNAL].largest_block;
+    if (largest < HEAP_MONITOR_LARGEST_WARN_BYTES && !warned) {
+        ESP_LOGW(TAG, "⚠️ 内部RAM最大连续块只剩 %lu 字节（空闲 %lu，%lu个空闲块），堆已经很碎",
+                 (unsigned long)largest, (unsigned long)s_samples[(size_t)HeapRegion::INTERNAL].free_bytes,
+                 (unsigned long)s_samples[(size_t)HeapRegion::INTERNAL].free_blocks);
+        warned = true;
+    } else if (largest >= HEAP_MONITOR_LARGEST_WARN_BYTES * 2) {
+        warned = false;
+    }
+    uint32_t failed = failed_allocs_.load(std::memory_order_relaxed);
+    if (failed != last_failed) {
+        ESP_LOGW(TAG, "❌ %lu次内存分配失败（累计%lu次，最近一次 %lu 字节）",
+                 (unsigned long)(failed - last_failed), (unsigned long)failed,
+                 (unsigned long)last_failed_size_.load(std::memory_order_relaxed));
+        last_failed = failed;
+    }
+    uint32_t late = late_allocs_.load(std::memory_order_relaxed);
+    if (late > 0 && !late_warned) {
+        ESP_LOGW(TAG, "🪤 启动完成后出现了内存分配（已有%lu次，第一次 %lu 字节），打开HEAP_MONITOR_SITES查分配点",
+                 (unsigned long)late, (unsigned long)first_late_size_.load(std::memory_order_relaxed));
+        late_warned = true;
+    }
+}
+
+esp_err_t HeapMonitor::start(uint32_t interval_ms) {
+    if (timer_ != nullptr) {
+        return ESP_OK;
+    }
+    heap_caps_register_failed_alloc_callback(on_alloc_failed);
+    sample(nullptr);
+
+    esp_timer_create_args_t args = {};
+    args.callback = sample;
+    args.name = "heap_monitor";
+    esp_err_t err = esp_timer_create(&args, &timer_);
+    if (err == ESP_OK) {
+        err = esp_timer_start_periodic(timer_, (uint64_t)interval_ms * 1000);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "❌ 定时采样启动失败: %s", esp_err_to_name(err));
+        return err;
+    }
+#if !CONFIG_HEAP_USE_HOOKS
+    ESP_LOGI(TAG, "🧱 没有打开CONFIG_HEAP_USE_HOOKS，只采样空闲量和最大连续块，不统计分配速率");
+#endif
+    for (size_t i = 0; i < (size_t)HeapRegion::COUNT; i++) {
+        Sample s = get((HeapRegion)i);
+        ESP_LOGI(TAG, "🧱 %s: 空闲 %lu 字节，最大连续块 %lu，%lu个空闲块", kRegionNames[i],
+                 (unsigned long)s.free_bytes, (unsigned long)s.largest_block, (unsigned long)s.free_blocks);
+    }
+    return ESP_OK;
+}
+
+HeapMonitor::Sample HeapMonitor::get(HeapRegion region) {
+    portENTER_CRITICAL(&s_sample_lock);
+    Sample s = s_samples[(size_t)region];
+    portEXIT_CRITICAL(&s_sample_lock);
+    return s;
+}
+
+#if HEAP_SITES_ENABLED
+/**
+ * @brief 追加格式化内容，空间不够时把pos置为size
+ */
+static void append(char* buf, size_t size, size_t* pos, const char* fmt, ...) __attribute__((format(printf, 4, 5)));
+static void append(char* buf, size_t size, size_t* pos, const char* fmt, ...) {
+    if (*pos >= size) {
+        return;
+    }
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buf + *pos, size - *pos, fmt, args);
+    va_end(args);
+    *pos = (n < 0 || (size_t)n >= size - *pos) ? size : *pos + n;
+}
+#endif
+
+size_t HeapMonitor::formatSites(char* buf, size_t size) {
+#if HEAP_SITES_ENABLED
+    static AllocSite sites[HEAP_MONITOR_SITE_SLOTS];     // 只在主任务中调用，放在静态区不占栈
+    portENTER_CRITICAL(&s_site_lock);
+    memcpy(sites, s_sites, sizeof(sites));
+    uint32_t overflow = s_site_overflow;
+    portEXIT_CRITICAL(&s_site_lock);
+    if (sites[0].count == 0) {
+        return 0;
+    }
+
+    size_t pos = 0;
+    append(buf, size, &pos, "{\"type\":\"heap_sites\",\"overflow\":%lu,\"sites\":[", (unsigned long)overflow);
+    // 每次挑出剩下的里面次数最多的一个，只报前HEAP_MONITOR_SITE_REPORT个
+    for (int rank = 0; rank < HEAP_MONITOR_SITE_REPORT; rank++) {
+        AllocSite* best = nullptr;
+        for (AllocSite& site : sites) {
+            if (site.count > 0 && (best == nullptr || site.count > best->count)) {
+                best = &site;
+            }
+        }
+        if (best == nullptr) {
+            break;
+        }
+        append(buf, size, &pos, "%s[\"", rank == 0 ? "" : ",");
+        for (int f = 0; f < HEAP_MONITOR_SITE_FRAMES && best->pc[f] != 0; f++) {
+            append(buf, size, &pos, "%s0x%08lx", f == 0 ? "" : ":", (unsigned long)best->pc[f]);
+        }
+        append(buf, size, &pos, "\",%lu,%lu]", (unsigned long)best->count, (unsigned long)best->bytes);
+        best->count = 0;
+    }
+    append(buf, size, &pos, "]}");
+    return pos < size ? pos : 0;
+#else
+    (void)buf;
+    (void)size;
+    return 0;
+#endif
+}
@@ -0,0 +1,99 @@
+/**
+ * @file heap_monitor.h
+ * @brief 🧱 堆监控 - 长时间运行时跟踪内部RAM/PSRAM的碎片化和分配速率
+ *
+ * 设备一开就是几周，每帧、每包的malloc/free让堆慢慢变碎：空闲总量还很多，最大连续块却越来越小，
+ * 直到某次分配一块稍大的缓冲区时失败。heap_min/heap_free只能看到总量，这里补上：
+ *
+ * - 定时（HEAP_MONITOR_SAMPLE_MS，esp_timer）采样每类堆的空闲字节、最大连续块、空闲块数，
+ *   记录启动以来最大连续块的最小值（碎片化趋势看它）
+ * - 打开CONFIG_HEAP_USE_HOOKS时用堆的分配钩子统计每类堆的分配次数和字节数，换算成每秒分配次数
+ * - 注册分配失败回调，统计失败次数和最近一次失败的大小
+ * - 调试构建（HEAP_MONITOR_SITES=1）按调用栈统计分配点，get_stats时以heap_sites消息上报，
+ *   PC用addr2line对照固件ELF就能找到是哪里在频繁分配
+ *
+ * - 分配绊线（HEAP_TRIPWIRE_ENABLE）：启动完成后armTripwire()，之后的每次分配都计数（late_allocs），
+ *   第一次出现时打一条警告；队列、事件组、信号量都用静态API从预留的内存创建，稳态下这个数应该不再增长，
+ *   增长了就是有模块在运行中分配。打开HEAP_MONITOR_SITES时分配点统计也从这一刻重新开始，直接看是谁
+ *
+ * 采样结果通过PerfCounters的stats上报（JSON和二进制STATS都带），服务器日志按设备看趋势。
+ * 钩子在每次分配时运行（可能在cache关闭期间），只做原子计数，整个钩子路径放在IRAM。
+ */
+
+#ifndef HEAP_MONITOR_H
+#define HEAP_MONITOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include "esp_err.h"
+#include "esp_timer.h"
+
+enum class HeapRegion : uint8_t {
+    INTERNAL,       // MALLOC_CAP_INTERNAL
+    PSRAM,          // MALLOC_CAP_SPIRAM
+    COUNT
+};
+
+class HeapMonitor {
+public:
+    /**
+     * @brief 一类堆最近一次采样的结果
+     */
+    struct Sample {
+        uint32_t free_bytes;        // 空闲总量
+        uint32_t largest_block;     // 最大连续空闲块
+        uint32_t min_largest;       // 启动以来最大连续块的最小值
+        uint32_t free_blocks;       // 空闲块数（越多越碎）
+        uint32_t allocs_per_s;      // 上一个采样周期的平均分配次数/秒（没有分配钩子时为0）
+        uint32_t bytes_per_s;       // 上一个采样周期的平均分配字节数/秒
+    };
+
+    /**
+     * @brief 立即采样一次并启动定时采样（重复调用无效果）
+     */
+    static esp_err_t start(uint32_t interval_ms);
+
+    static Sample get(HeapRegion region);
+
+    /**
+     * @brief 启动以来分配失败的次数
+     */
+    static uint32_t failedAllocs() { return failed_allocs_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 启动完成（两条启动线都结束后调用一次）：之后的分配都算"运行中分配"
+     */
+    static void armTripwire();
+
+    /**
+     * @brief armTripwire()之后的分配次数（没有分配钩子时恒为0）
+     */
+    static uint32_t lateAllocs() { return late_allocs_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 分配点统计格式化成{"type":"heap_sites",...}，按分配次数从多到少
+     *
+     * @return 写入的字符数，没有打开HEAP_MONITOR_SITES或还没有数据时返回0
+     */
+    static size_t formatSites(char* buf, size_t size);
+
+    // 以下由堆钩子调用（heap_monitor.cc），其他地方不要调用
+    static void noteAlloc(void* ptr, size_t size);
+    static void noteFailed(size_t size);
+
+private:
+    static void sample(void* arg);
+
+    static const char* TAG;
+    static inline esp_timer_handle_t timer_ = nullptr;
+    static inline std::atomic<uint32_t> alloc_count_[(size_t)HeapRegion::COUNT] = {};
+    static inline std::atomic<uint32_t> alloc_bytes_[(size_t)HeapRegion::COUNT] = {};
+    static inline std::atomic<uint32_t> failed_allocs_{0};
+    static inline std::atomic<uint32_t> last_failed_size_{0};
+    static inline std::atomic<bool> tripwire_armed_{false};
+    static inline std::atomic<uint32_t> late_allocs_{0};
+    static inline std::atomic<uint32_t> first_late_size_{0};
+};
+
+#endif // HEAP_MONITOR_H
@@ -0,0 +1,124 @@
+/**
+ * @file jitter_buffer.cc
+ * @brief 🌊 下行音频抖动缓冲区实现
+ */
+
+#include "jitter_buffer.h"
+#include <string.h>
+#include "realtime_audio.h"
+
+JitterBuffer::JitterBuffer(bool use_psram)
+    : ring_("jitter_buffer", use_psram ? Placement::PSRAM : Placement::INTERNAL)
+    , history_len_(0)
+    , history_end_(0)
+    , fade_in_total_(0)
+    , fade_in_remaining_(0)
+    , samples_in_(0)
+    , samples_dropped_(0)
+    , underruns_(0)
+    , samples_concealed_(0)
+    , max_fill_(0)
+{
+}
+
+size_t AUDIO_HOT_IRAM JitterBuffer::write(const int16_t* samples, size_t count) {
+    return writeBytes((const uint8_t*)samples, count);
+}
+
+size_t AUDIO_HOT_IRAM JitterBuffer::writeBytes(const uint8_t* data, size_t count) {
+    size_t written = 0;
+    while (written < count) {
+        Ring::Span<int16_t> span = ring_.writeSpan();
+        if (span.count == 0) {
+            break;
+        }
+        size_t n = count - written < span.count ? count - written : span.count;
+        memcpy(span.data, data + written * sizeof(int16_t), n * sizeof(int16_t));
+        if (fade_in_remaining_ > 0) {
+            applyFadeIn(span.data, n);
+        }
+        ring_.commitWrite(n);
+        written += n;
+    }
+    noteWrite(count, written);
+    noteHistory(written);
+    return written;
+}
+
+size_t JitterBuffer::conceal(size_t count, size_t fade_samples) {
+    size_t written = 0;
+    // 连续补偿太多次、历史已经被绕回覆盖时不再重复
+    size_t start = history_end_ - history_len_;
+    size_t history = ring_.writePosition() + count - start <= Ring::capacity() ? history_len_ : 0;
+    // 缺口比淡出时长短时在缺口内淡完，后面的真实数据再淡入，两端都不会突变
+    size_t fade = history > 0 ? (fade_samples < count ? fade_samples : count) : 0;
+    while (written < count) {
+        Ring::Span<int16_t> span = ring_.writeSpan();
+        if (span.count == 0) {
+            break;
+        }
+        size_t n = count - written < span.count ? count - written : span.count;
+        for (size_t i = 0; i < n; i++) {
+            size_t pos = written + i;
+            if (pos < fade) {
+                int32_t sample = ring_.at(start + pos % history);
+                span.data[i] = (int16_t)(sample * (int32_t)(fade - pos) / (int32_t)fade);
+            } else {
+                span.data[i] = 0;
+            }
+        }
+        ring_.commitWrite(n);
+        written += n;
+    }
+    noteWrite(count, written);
+    samples_concealed_ += written;
+    if (written > 0) {
+        fade_in_total_ = fade_samples;
+        fade_in_remaining_ = fade_samples;
+    }
+    return written;
+}
+
+void AUDIO_HOT_IRAM JitterBuffer::applyFadeIn(int16_t* samples, size_t count) {
+    size_t n = count < fade_in_remaining_ ? count : fade_in_remaining_;
+    for (size_t i = 0; i < n; i++) {
+        int32_t gain = (int32_t)(fade_in_total_ - fade_in_remaining_ + i);
+        samples[i] = (int16_t)((int32_t)samples[i] * gain / (int32_t)fade_in_total_);
+    }
+    fade_in_remaining_ -= n;
+}
+
+void AUDIO_HOT_IRAM JitterBuffer::noteHistory(size_t written) {
+    history_len_ = history_len_ + written < PLC_HISTORY_SAMPLES ? history_len_ + written : PLC_HISTORY_SAMPLES;
+    history_end_ = ring_.writePosition();
+}
+
+void AUDIO_HOT_IRAM JitterBuffer::noteWrite(size_t requested, size_t written) {
+    if (written < requested) {
+        samples_dropped_ += requested - written;
+    }
+    samples_in_ += written;
+
+    size_t fill = ring_.size();
+    if (fill > max_fill_.load(std::memory_order_relaxed)) {
+        max_fill_.store(fill, std::memory_order_relaxed);
+    }
+}
+
+JitterBuffer::Stats JitterBuffer::getStats() const {
+    Stats stats;
+    stats.samples_in = samples_in_.load();
+    stats.samples_dropped = samples_dropped_.load();
+    stats.underruns = underruns_.load();
+    stats.samples_concealed = samples_concealed_.load();
+    stats.max_fill = max_fill_.load();
+    return stats;
+}
+
+void JitterBuffer::resetStats() {
+    samples_in_ = 0;
+    samples_dropped_ = 0;
+    underruns_ = 0;
+    samples_concealed_ = 0;
+    max_fill_ = 0;
+}
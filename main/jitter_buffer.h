@@ -0,0 +1,135 @@
+/**
+ * @file jitter_buffer.h
+ * @brief 🌊 下行音频抖动缓冲区 - 基于SpscRing的单生产者/单消费者无锁缓冲
+ *
+ * WebSocket回调（生产者）只负责把收到的PCM写进来，立即返回；
+ * 播放任务（消费者）按固定节拍直接从环形缓冲区的连续区间写入I2S，
+ * 不需要加锁，也不会因为I2S反压卡住WebSocket接收任务。
+ * 所有长度都以16位样本为单位，从根本上避免了字节错位。
+ *
+ * 丢包补偿（PLC）也在生产者一侧完成：发现下行缺了一段时（见audio_framing.h），
+ * conceal()直接从环形缓冲区读回最近写入的PLC_HISTORY_SAMPLES个样本（不额外拷贝），循环重复并淡出，之后补静音，
+ * 缺口之后的真实数据再淡入，
+ * 播放任务看到的仍然是连续的数据，时间轴不会错位。
+ */
+
+#ifndef JITTER_BUFFER_H
+#define JITTER_BUFFER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include "spsc_ring.h"
+#include "project_config.h"
+
+class JitterBuffer {
+public:
+    static constexpr size_t CAPACITY_SAMPLES = JITTER_BUFFER_SAMPLES;   // 默认约2秒@16kHz
+    static constexpr size_t PLC_HISTORY_SAMPLES = 160;     // 丢包补偿重复的长度（10ms）
+    using Ring = SpscRing<int16_t, CAPACITY_SAMPLES>;
+
+    /**
+     * @brief 抖动缓冲统计信息（单位：样本）
+     */
+    struct Stats {
+        uint32_t samples_in;        // 累计写入样本数
+        uint32_t samples_dropped;   // 缓冲区满时丢弃的样本数
+        uint32_t underruns;         // 播放时数据不足的次数
+        uint32_t samples_concealed; // 丢包补偿写入的样本数
+        size_t max_fill;            // 最高水位
+    };
+
+    /**
+     * @brief 创建抖动缓冲区
+     *
+     * @param use_psram true=优先放在PSRAM
+     */
+    explicit JitterBuffer(bool use_psram);
+
+    bool isValid() const { return ring_.isValid(); }
+    static constexpr size_t capacity() { return CAPACITY_SAMPLES; }
+
+    /**
+     * @brief 写入样本（仅生产者调用）
+     * @return 实际写入的样本数，空间不足时多余部分被丢弃
+     */
+    size_t write(const int16_t* samples, size_t count);
+
+    /**
+     * @brief 从任意对齐的字节流写入count个小端16位样本（仅生产者调用）
+     *
+     * WebSocket片段的起始地址不一定是2字节对齐的，这里直接按字节拷进环形缓冲区，不经过中间缓冲。
+     */
+    size_t writeBytes(const uint8_t* data, size_t count);
+
+    /**
+     * @brief 丢包补偿：补count个样本（仅生产者调用）
+     *
+     * 循环重复最近写入的PLC_HISTORY_SAMPLES个样本，fade_samples内（缺口更短时在缺口内）线性淡出到0，
+     * 其余补静音；之后写入的前fade_samples个样本线性淡入。
+     * 还没有写入过数据（或刚resetConcealment）时全部补静音。
+     *
+     * @return 实际写入的样本数
+     */
+    size_t conceal(size_t count, size_t fade_samples);
+
+    /**
+     * @brief 忘掉补偿用的历史（新回复开始时由生产者调用，旧回复的尾巴不会被重复）
+     */
+    void resetConcealment() { history_len_ = 0; history_end_ = ring_.writePosition(); fade_in_remaining_ = 0; }
+
+    /**
+     * @brief 累计写入的样本数（包括补偿写入的，回绕无妨，只用来算两次之间的差）
+     */
+    size_t writePosition() const { return ring_.writePosition(); }
+
+    /**
+     * @brief 可直接交给I2S的连续可读区间（仅消费者调用）
+     */
+    Ring::Span<const int16_t> readSpan() const { return ring_.readSpan(); }
+    void commitRead(size_t count) { ring_.commitRead(count); }
+    bool contains(const int16_t* p) const { return ring_.contains(p); }
+
+    /**
+     * @brief 拷贝读取（仅消费者调用）
+     */
+    size_t read(int16_t* out, size_t count) { return ring_.read(out, count); }
+
+    /**
+     * @brief 当前可读样本数
+     */
+    size_t available() const { return ring_.size(); }
+
+    /**
+     * @brief 清空缓冲区（仅消费者调用，或两端都空闲时调用）
+     */
+    void clear() { ring_.clear(); }
+
+    /**
+     * @brief 记录一次欠载（由消费者调用）
+     */
+    void noteUnderrun() { underruns_++; }
+
+    Stats getStats() const;
+    void resetStats();
+
+private:
+    void noteWrite(size_t requested, size_t written);
+    void noteHistory(size_t written);
+    void applyFadeIn(int16_t* samples, size_t count);
+
+    Ring ring_;
+    // 补偿用的历史：写位置history_end_之前的history_len_个样本是真实数据（只有生产者访问）
+    size_t history_len_;
+    size_t history_end_;
+    size_t fade_in_total_;          // 补偿之后真实数据的淡入
+    size_t fade_in_remaining_;
+
+    std::atomic<uint32_t> samples_in_;
+    std::atomic<uint32_t> samples_dropped_;
+    std::atomic<uint32_t> underruns_;
+    std::atomic<uint32_t> samples_concealed_;
+    std::atomic<size_t> max_fill_;
+};
+
+#endif // JITTER_BUFFER_H
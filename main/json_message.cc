@@ -0,0 +1,115 @@
+/**
+ * @file json_message.cc
+ * @brief 🧾 定长缓冲区上拼JSON控制消息
+ */
+
+#include "json_message.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+JsonWriter::JsonWriter(char* buffer, size_t size, const char* type)
+    : buffer_(buffer)
+    , size_(size)
+    , len_(0)
+    , first_(true)
+    , overflow_(false)
+{
+    append("{");
+    if (type) {
+        str("type", type);
+    }
+}
+
+bool JsonWriter::append(std::string_view text) {
+    // 留一个字节给结尾的'\0'
+    if (overflow_ || len_ + text.size() + 1 > size_) {
+        overflow_ = true;
+        return false;
+    }
+    memcpy(buffer_ + len_, text.data(), text.size());
+    len_ += text.size();
+    buffer_[len_] = '\0';
+    return true;
+}
+
+bool JsonWriter::appendf(const char* format, ...) {
+    if (overflow_) {
+        return false;
+    }
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(buffer_ + len_, size_ - len_, format, args);
+    va_end(args);
+    if (n < 0 || len_ + (size_t)n + 1 > size_) {
+        overflow_ = true;
+        return false;
+    }
+    len_ += (size_t)n;
+    return true;
+}
+
+bool JsonWriter::key(const char* name) {
+    bool ok = append(first_ ? "\"" : ",\"") && append(name) && append("\":");
+    first_ = false;
+    return ok;
+}
+
+JsonWriter& JsonWriter::str(const char* name, std::string_view value) {
+    if (!key(name) || !append("\"")) {
+        return *this;
+    }
+    size_t start = 0;
+    for (size_t i = 0; i < value.size(); i++) {
+        unsigned char c = (unsigned char)value[i];
+        if (c != '"' && c != '\\' && c >= 0x20) {
+            continue;
+        }
+        append(value.substr(start, i - start));
+        if (c == '"' || c == '\\') {
+            char escaped[2] = { '\\', (char)c };
+            append(std::string_view(escaped, 2));
+        } else {
+            appendf("\\u%04x", c);
+        }
+        start = i + 1;
+    }
+    append(value.substr(start));
+    append("\"");
+    return *this;
+}
+
+JsonWriter& JsonWriter::num(const char* name, int64_t value) {
+    if (key(name)) {
+        appendf("%lld", (long long)value);
+    }
+    return *this;
+}
+
+JsonWriter& JsonWriter::real(const char* name, float value, int decimals) {
+    if (key(name)) {
+        appendf("%.*f", decimals, value);
+    }
+    return *this;
+}
+
+JsonWriter& JsonWriter::flag(const char* name, bool value) {
+    if (key(name)) {
+        append(value ? "true" : "false");
+    }
+    return *this;
+}
+
+JsonWriter& JsonWriter::raw(const char* name, std::string_view json) {
+    if (key(name)) {
+        append(json);
+    }
+    return *this;
+}
+
+std::string_view JsonWriter::finish() {
+    if (!append("}")) {
+        return {};
+    }
+    return std::string_view(buffer_, len_);
+}
@@ -0,0 +1,76 @@
+/**
+ * @file json_message.h
+ * @brief 🧾 定长缓冲区上拼JSON控制消息 - 栈上一块数组，不碰堆
+ *
+ * 发给服务器的JSON文本（credit、ping、session_start、本地命令、网络自检……）原来各自
+ * snprintf并手工累加长度，可选字段多了很容易写错。这里按字段追加：
+ *
+ *   JsonMessage<96> msg("credit");        // {"type":"credit"
+ *   msg.num("recv", received).num("free", free_bytes);
+ *   ws_client->sendText(msg.finish(), 100);
+ *
+ * 字符串值按JSON转义；放不下时后面的字段全部忽略，finish()返回空串（sendText会当成失败，不会发半条消息）。
+ * 只在一个任务里使用，不加锁。
+ */
+
+#ifndef JSON_MESSAGE_H
+#define JSON_MESSAGE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string_view>
+
+/**
+ * @brief 在调用方给的缓冲区里拼一个JSON对象
+ */
+class JsonWriter {
+public:
+    /**
+     * @param type 非空时第一个字段是"type":type
+     */
+    JsonWriter(char* buffer, size_t size, const char* type = nullptr);
+
+    JsonWriter(const JsonWriter&) = delete;
+    JsonWriter& operator=(const JsonWriter&) = delete;
+
+    JsonWriter& str(const char* key, std::string_view value);
+    JsonWriter& num(const char* key, int64_t value);
+    JsonWriter& real(const char* key, float value, int decimals = 1);
+    JsonWriter& flag(const char* key, bool value);
+    /**
+     * @brief 原样写入已经是JSON的值（嵌套对象、数组）
+     */
+    JsonWriter& raw(const char* key, std::string_view json);
+
+    /**
+     * @brief 补上右括号，返回整条消息（溢出时为空；之后不能再追加）
+     */
+    std::string_view finish();
+
+    bool overflowed() const { return overflow_; }
+
+private:
+    bool key(const char* name);
+    bool append(std::string_view text);
+    bool appendf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+    char* buffer_;
+    size_t size_;
+    size_t len_;
+    bool first_;
+    bool overflow_;
+};
+
+/**
+ * @brief 自带N字节存储的JsonWriter，放在栈上用
+ */
+template <size_t N>
+class JsonMessage : public JsonWriter {
+public:
+    explicit JsonMessage(const char* type = nullptr) : JsonWriter(storage_, N, type) {}
+
+private:
+    char storage_[N];
+};
+
+#endif // JSON_MESSAGE_H
@@ -0,0 +1,93 @@
+/**
+ * @file latency_trace.cc
+ * @brief ⏱️ 端到端延迟追踪实现
+ */
+
+#include "latency_trace.h"
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include "esp_log.h"
+#include "esp_timer.h"
+
+const char* LatencyTrace::TAG = "LatencyTrace";
+
+LatencyTrace::LatencyTrace()
+    : turn_(0)
+    , uplink_kbps_(0)
+    , speaker_delay_ms_(-1)
+    , ring_{}
+    , head_(0)
+    , session_{}
+{
+    for (auto& mark : marks_) {
+        mark = 0;
+    }
+}
+
+void LatencyTrace::setSession(std::string_view session_id) {
+    size_t len = std::min(session_id.size(), sizeof(session_) - 1);
+    memcpy(session_, session_id.data(), len);
+    session_[len] = '\0';
+    turn_ = 0;
+}
+
+void LatencyTrace::beginTurn() {
+    for (auto& mark : marks_) {
+        mark = 0;
+    }
+    uplink_kbps_ = 0;
+    turn_++;
+}
+
+void LatencyTrace::mark(TracePoint point) {
+    int64_t now = esp_timer_get_time();
+    int64_t expected = 0;
+    if (!marks_[(size_t)point].compare_exchange_strong(expected, now)) {
+        return;  // 本轮已记录
+    }
+    uint32_t slot = head_.fetch_add(1) % CAPACITY;
+    ring_[slot] = Record{ (uint32_t)now, (uint8_t)point, (uint8_t)turn_.load(), 0 };
+}
+
+int32_t LatencyTrace::spanMs(TracePoint from, TracePoint to) const {
+    int64_t a = at(from);
+    int64_t b = at(to);
+    if (a == 0 || b == 0 || b < a) {
+        return -1;
+    }
+    return (int32_t)((b - a) / 1000);
+}
+
+size_t LatencyTrace::formatTurn(char* buf, size_t size) const {
+    int len = snprintf(buf, size,
+                       "{\"type\":\"trace\",\"session\":\"%s\",\"turn\":%lu,"
+                       "\"wake_to_uplink\":%ld,\"eos_to_downlink\":%ld,\"downlink_to_playback\":%ld,"
+                       "\"eos_to_playback\":%ld,\"eos_to_tts_end\":%ld,\"up_kbps\":%ld,\"spk_ms\":%ld}",
+                       session_, (unsigned long)turn_.load(),
+                       (long)spanMs(TracePoint::WAKE, TracePoint::FIRST_UPLINK),
+                       (long)spanMs(TracePoint::SPEECH_END, TracePoint::FIRST_DOWNLINK),
+                       (long)spanMs(TracePoint::FIRST_DOWNLINK, TracePoint::FIRST_PLAYBACK),
+                       (long)spanMs(TracePoint::SPEECH_END, TracePoint::FIRST_PLAYBACK),
+                       (long)spanMs(TracePoint::SPEECH_END, TracePoint::TTS_END),
+                       uplink_kbps_.load() > 0 ? (long)uplink_kbps_.load() : -1L, (long)speaker_delay_ms_.load());
+    return (len > 0 && (size_t)len < size) ? (size_t)len : 0;
+}
+
+void LatencyTrace::logTurn() const {
+    ESP_LOGI(TAG, "⏱️ 会话%.8s 第%lu轮: 唤醒→上行 %ld ms, 说完→首包下行 %ld ms, 下行→出声 %ld ms, 说完→出声 %ld ms",
+             session_, (unsigned long)turn_.load(),
+             (long)spanMs(TracePoint::WAKE, TracePoint::FIRST_UPLINK),
+             (long)spanMs(TracePoint::SPEECH_END, TracePoint::FIRST_DOWNLINK),
+             (long)spanMs(TracePoint::FIRST_DOWNLINK, TracePoint::FIRST_PLAYBACK),
+             (long)spanMs(TracePoint::SPEECH_END, TracePoint::FIRST_PLAYBACK));
+}
+
+size_t LatencyTrace::snapshot(Record* out, size_t max) const {
+    uint32_t head = head_.load();
+    size_t count = std::min<size_t>(std::min<size_t>(head, CAPACITY), max);
+    for (size_t i = 0; i < count; i++) {
+        out[i] = ring_[(head - count + i) % CAPACITY];
+    }
+    return count;
+}
@@ -0,0 +1,116 @@
+/**
+ * @file latency_trace.h
+ * @brief ⏱️ 端到端延迟追踪 - 记录每轮对话关键节点的时间，找出"说完到听到回复"的时间花在哪里
+ *
+ * 各任务在关键节点调用mark()：唤醒（fetch任务）、第一帧上行（发送任务）、说话结束、
+ * 第一段下行音频（WebSocket任务）、第一次写I2S（播放任务）、tts_end。
+ * 每个节点每轮只记第一次，时间取esp_timer（微秒，单调）。
+ *
+ * 所有mark同时写入一个8字节记录的环形缓冲区（最近CAPACITY条），需要时可以整体导出；
+ * 写入只有一次原子自增和一次结构体赋值，可以在任意任务中调用。
+ *
+ * 会话ID由服务器在hello回复中下发，每轮结束时把本轮各阶段耗时格式化成
+ * {"type":"trace","session":...,"turn":n,...}发给服务器，和服务器端日志按(session, turn)对齐。
+ */
+
+#ifndef LATENCY_TRACE_H
+#define LATENCY_TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <string_view>
+
+/**
+ * @brief 追踪点（数值写入记录，不要调整顺序）
+ */
+enum class TracePoint : uint8_t {
+    WAKE = 0,           // 检测到唤醒词
+    FIRST_UPLINK,       // 本轮第一条上行音频
+    SPEECH_END,         // 发送speech_end
+    FIRST_DOWNLINK,     // 本轮第一段下行音频到达
+    FIRST_PLAYBACK,     // 预缓冲完成，回复开始写入I2S
+    TTS_END,            // 收到tts_end
+    COUNT
+};
+
+class LatencyTrace {
+public:
+    /**
+     * @brief 环形缓冲区中的一条记录（时间戳取esp_timer的低32位，约71分钟回绕，差值计算不受影响）
+     */
+    struct Record {
+        uint32_t t_us;
+        uint8_t point;
+        uint8_t turn;
+        uint16_t reserved;
+    };
+    static_assert(sizeof(Record) == 8, "Record必须是8字节");
+
+    static constexpr size_t CAPACITY = 64;
+
+    LatencyTrace();
+
+    /**
+     * @brief 设置服务器下发的会话ID，轮次从头计数
+     */
+    void setSession(std::string_view session_id);
+
+    /**
+     * @brief 开始新一轮：清空本轮各节点的时间
+     */
+    void beginTurn();
+
+    /**
+     * @brief 记录一个节点（本轮已记录过则忽略）
+     */
+    void mark(TracePoint point);
+
+    /**
+     * @brief 本轮上行的平均码率（kbit/s，0=PCM或没有数据，上报时为-1），formatTurn之前设置
+     */
+    void setUplinkKbps(uint32_t kbps) { uplink_kbps_ = kbps; }
+    // 🔊 标定出的扬声器→麦克风延迟（写进I2S到真正出声的上限），随每轮带给服务器
+    void setSpeakerDelayMs(int32_t ms) { speaker_delay_ms_ = ms; }
+
+    /**
+     * @brief 把本轮各阶段耗时格式化成发给服务器的JSON（缺失的阶段为-1）
+     *
+     * @return 写入的字符数（不含结尾'\0'），缓冲区不够时返回0
+     */
+    size_t formatTurn(char* buf, size_t size) const;
+
+    /**
+     * @brief 在日志中输出本轮各阶段耗时
+     */
+    void logTurn() const;
+
+    /**
+     * @brief 导出环形缓冲区中的记录（从旧到新）
+     *
+     * @return 导出的条数
+     */
+    size_t snapshot(Record* out, size_t max) const;
+
+    uint32_t turn() const { return turn_.load(); }
+    // 本轮说完到开始播放的毫秒数（缺一个节点时为-1）
+    int32_t eosToPlaybackMs() const { return spanMs(TracePoint::SPEECH_END, TracePoint::FIRST_PLAYBACK); }
+    // 服务器下发的会话ID（只在WebSocket任务中读）
+    const char* session() const { return session_; }
+
+private:
+    static const char* TAG;
+
+    int64_t at(TracePoint point) const { return marks_[(size_t)point].load(); }
+    int32_t spanMs(TracePoint from, TracePoint to) const;
+
+    std::atomic<int64_t> marks_[(size_t)TracePoint::COUNT];   // 本轮各节点时间，0=未记录
+    std::atomic<uint32_t> turn_;
+    std::atomic<uint32_t> uplink_kbps_;
+    std::atomic<int32_t> speaker_delay_ms_;     // -1=没有标定
+    Record ring_[CAPACITY];
+    std::atomic<uint32_t> head_;
+    char session_[40];      // 只在WebSocket任务中读写
+};
+
+#endif // LATENCY_TRACE_H
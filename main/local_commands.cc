@@ -0,0 +1,145 @@
+/**
+ * @file local_commands.cc
+ * @brief 📍 本地命令词实现
+ */
+
+#include "local_commands.h"
+#include <string.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "buffer_placement.h"
+#include "command_table.h"      // 构建时由local_commands.csv生成
+#include "esp_mn_models.h"
+
+const char* LocalCommands::TAG = "LocalCommands";
+
+static_assert(CommandTable::COUNT <= ESP_MN_MAX_PHRASE_NUM, "命令词超过MultiNet上限");
+
+// 注册给MultiNet的链表直接指向生成的表，不经过esp_mn_commands_*的逐条分配和查重
+static esp_mn_phrase_t s_phrases[CommandTable::COUNT];
+static esp_mn_node_t s_nodes[CommandTable::COUNT];
+
+LocalCommands::LocalCommands()
+    : multinet_(nullptr)
+    , model_data_(nullptr)
+    , stage_(nullptr)
+    , chunk_samples_(0)
+    , stage_fill_(0)
+    , armed_(false)
+    , reset_pending_(false)
+{
+}
+
+LocalCommands::~LocalCommands() {
+    if (model_data_) {
+        multinet_->destroy(model_data_);
+    }
+    BufferPlacement::free(stage_);
+}
+
+esp_err_t LocalCommands::init(srmodel_list_t* models, uint32_t window_ms) {
+    char* model_name = models ? esp_srmodel_filter(models, ESP_MN_PREFIX, ESP_MN_CHINESE) : nullptr;
+    if (!model_name) {
+        ESP_LOGW(TAG, "⚠️ 没有MultiNet中文模型，本地命令词不可用");
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    multinet_ = esp_mn_handle_from_name(model_name);
+    model_data_ = multinet_ ? multinet_->create(model_name, (int)window_ms) : nullptr;
+    if (!model_data_) {
+        ESP_LOGE(TAG, "❌ 创建MultiNet失败: %s", model_name);
+        return ESP_FAIL;
+    }
+
+    chunk_samples_ = multinet_->get_samp_chunksize(model_data_);
+    stage_ = (int16_t*)BufferPlacement::alloc("command_stage", chunk_samples_ * sizeof(int16_t), Placement::INTERNAL);
+    if (!stage_) {
+        multinet_->destroy(model_data_);
+        model_data_ = nullptr;
+        return ESP_ERR_NO_MEM;
+    }
+
+    // 命令ID就是表下标，识别结果直接查表得到意图
+    for (size_t i = 0; i < CommandTable::COUNT; i++) {
+        s_phrases[i] = {};
+        s_phrases[i].string = CommandTable::kPinyin + CommandTable::kEntries[i].pinyin;
+        s_phrases[i].command_id = (int16_t)i;
+        s_nodes[i].phrase = &s_phrases[i];
+        s_nodes[i].next = i + 1 < CommandTable::COUNT ? &s_nodes[i + 1] : nullptr;
+    }
+    int64_t start_us = esp_timer_get_time();
+    esp_mn_error_t* errors = multinet_->set_speech_commands(model_data_, s_nodes);
+    if (errors && errors->num > 0) {
+        for (int i = 0; i < errors->num; i++) {
+            ESP_LOGW(TAG, "⚠️ 命令词没有通过检查: %s", errors->phrases[i]->string);
+        }
+    }
+
+    ESP_LOGI(TAG, "✓ 本地命令词已就绪: %s, %zu条（注册%lld us）, 窗口%lu ms, 每块%zu样本",
+             model_name, CommandTable::COUNT, (esp_timer_get_time() - start_us), (unsigned long)window_ms,
+             chunk_samples_);
+    return ESP_OK;
+}
+
+void LocalCommands::arm() {
+    if (!model_data_) {
+        return;
+    }
+    reset_pending_ = true;
+    armed_ = true;
+}
+
+void LocalCommands::feed(const int16_t* samples, size_t count) {
+    if (!armed_.load()) {
+        return;
+    }
+    if (reset_pending_.exchange(false)) {
+        multinet_->clean(model_data_);
+        stage_fill_ = 0;
+    }
+
+    while (count > 0 && armed_.load()) {
+        size_t n = chunk_samples_ - stage_fill_;
+        if (n > count) {
+            n = count;
+        }
+        memcpy(stage_ + stage_fill_, samples, n * sizeof(int16_t));
+        stage_fill_ += n;
+        samples += n;
+        count -= n;
+        if (stage_fill_ < chunk_samples_) {
+            break;
+        }
+        stage_fill_ = 0;
+
+        esp_mn_state_t state = multinet_->detect(model_data_, stage_);
+        if (state == ESP_MN_STATE_DETECTED) {
+            esp_mn_results_t* results = multinet_->get_results(model_data_);
+            int id = results && results->num > 0 ? results->command_id[0] : -1;
+            if (id >= 0 && (size_t)id < CommandTable::COUNT) {
+                ESP_LOGI(TAG, "📍 命中命令词: %s (%.2f)", CommandTable::kEntries[id].text, results->prob[0]);
+                finish(CommandTable::kEntries[id].intent, results->prob[0], CommandTable::kEntries[id].text);
+            }
+        } else if (state == ESP_MN_STATE_TIMEOUT) {
+            finish(Intent::NONE, 0.0f, nullptr);
+        }
+    }
+}
+
+void LocalCommands::finish(Intent intent, float prob, const char* text) {
+    armed_ = false;
+    if (result_callback_) {
+        result_callback_(intent, prob, text);
+    }
+}
+
+const char* LocalCommands::intentName(Intent intent) {
+    switch (intent) {
+        case Intent::VOLUME_UP:   return "volume_up";
+        case Intent::VOLUME_DOWN: return "volume_down";
+        case Intent::STOP:        return "stop";
+        case Intent::REPEAT:      return "repeat";
+        case Intent::ASK:         return "ask";
+        default:                  return "none";
+    }
+}
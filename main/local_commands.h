@@ -0,0 +1,94 @@
+/**
+ * @file local_commands.h
+ * @brief 📍 本地命令词 - 唤醒后先用MultiNet识别几条简单命令，命中就在设备上处理，不走云端
+ *
+ * 调音量、停止、再说一遍这类请求占了不少对话，走一趟服务器和豆包要一两秒，还占上行和API额度。
+ * 唤醒后arm()，音频前端处理后的音频同时喂给MultiNet，最多LOCAL_COMMAND_WINDOW_MS：
+ * - 命中命令词：回调Intent，这一轮不上传任何音频
+ * - 命中问句（ask意图，例如"今天天气怎么样"）：还要云端回答，但问题已经听懂了，
+ *   回调带上这条的中文说法，主循环把文字发给服务器开一轮文字对话（不上传音频、不等云端识别和说完判定）
+ * - 超时没有命中：回调Intent::NONE，主循环再开始录音上传；这段时间的音频在会话预录里，
+ *   从唤醒词结束处完整补发，云端识别不丢字（所以窗口不能超过SESSION_PREROLL_MS）
+ *
+ * 命令词表在local_commands.csv里（意图,中文说法,拼音），构建时tools/gen_command_table.py生成
+ * constexpr的command_table.h（拼音空着时用tools/multinet_pinyin.py转换），init()把整张表作为一个链表
+ * 一次交给MultiNet，命令ID就是表下标，识别结果直接查表得到意图。
+ * 模型分区里没有MultiNet模型时isAvailable()为false，唤醒后直接走云端，和原来一样。
+ */
+
+#ifndef LOCAL_COMMANDS_H
+#define LOCAL_COMMANDS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <functional>
+#include "esp_err.h"
+#include "esp_mn_iface.h"
+#include "model_path.h"
+
+class LocalCommands {
+public:
+    // local_commands.csv里的意图名是这里的小写形式
+    enum class Intent : uint8_t {
+        NONE = 0,       // 没有命中，交给云端
+        VOLUME_UP,
+        VOLUME_DOWN,
+        STOP,
+        REPEAT,         // 重放上一轮回复（服务器缓存，不经过豆包）
+        ASK,            // 整句问题：把中文说法作为文字问题交给云端
+    };
+
+    // 识别结束回调（在音频前端的fetch任务中执行，不要阻塞）；text是命中的中文说法（静态存储，NONE时为nullptr）
+    using ResultCallback = std::function<void(Intent intent, float prob, const char* text)>;
+
+    LocalCommands();
+    ~LocalCommands();
+
+    /**
+     * @brief 加载MultiNet模型并注册命令词
+     *
+     * @param models 模型列表（为nullptr或没有MultiNet模型时返回ESP_ERR_NOT_FOUND）
+     * @param window_ms 唤醒后最多等待命令词的时长
+     */
+    esp_err_t init(srmodel_list_t* models, uint32_t window_ms);
+
+    bool isAvailable() const { return model_data_ != nullptr; }
+    void setResultCallback(ResultCallback cb) { result_callback_ = cb; }
+
+    /**
+     * @brief 开始一次识别（唤醒后在主任务中调用，下一块音频开始生效）
+     */
+    void arm();
+
+    /**
+     * @brief 取消正在进行的识别，不触发回调
+     */
+    void disarm() { armed_ = false; }
+
+    bool isArmed() const { return armed_.load(); }
+
+    /**
+     * @brief 送入音频前端处理后的音频（在fetch任务中调用，未arm时直接返回）
+     */
+    void feed(const int16_t* samples, size_t count);
+
+    static const char* intentName(Intent intent);
+
+private:
+    static const char* TAG;
+
+    void finish(Intent intent, float prob, const char* text);
+
+    esp_mn_iface_t* multinet_;
+    model_iface_data_t* model_data_;
+    int16_t* stage_;            // AFE输出块和MultiNet块大小不一致时凑块
+    size_t chunk_samples_;
+    size_t stage_fill_;         // 只在fetch任务中访问
+
+    std::atomic<bool> armed_;
+    std::atomic<bool> reset_pending_;   // arm()置位，fetch任务在下一块开始前清空模型状态
+    ResultCallback result_callback_;
+};
+
+#endif // LOCAL_COMMANDS_H
@@ -0,0 +1,143 @@
+/**
+ * @file local_tts.cc
+ * @brief 🗣️ 离线语音合成实现
+ */
+
+#include "local_tts.h"
+#include "task_factory.h"
+#include <stdio.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_tts.h"
+#include "esp_tts_voice_template.h"
+#include "audio_manager.h"
+#include "project_config.h"
+
+const char* LocalTts::TAG = "LocalTts";
+
+LocalTts::LocalTts()
+    : audio_(nullptr)
+    , partition_(nullptr)
+    , mmap_handle_(0)
+    , voice_data_(nullptr)
+    , voice_(nullptr)
+    , tts_(nullptr)
+    , queue_(nullptr)
+    , task_(nullptr)
+{
+}
+
+LocalTts::~LocalTts() {
+    if (task_) {
+        vTaskDelete(task_);
+    }
+    if (queue_) {
+        vQueueDelete(queue_);
+    }
+    if (tts_) {
+        esp_tts_destroy(tts_);
+    }
+    if (voice_) {
+        esp_tts_voice_set_free((esp_tts_voice_t*)voice_);
+    }
+    if (voice_data_) {
+        esp_partition_munmap(mmap_handle_);
+    }
+}
+
+esp_err_t LocalTts::init(AudioManager* audio, const char* partition_label) {
+    partition_ = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, partition_label);
+    if (!partition_) {
+        ESP_LOGW(TAG, "⚠️ 没有'%s'分区，离线语音合成不可用", partition_label);
+        return ESP_ERR_NOT_FOUND;
+    }
+    audio_ = audio;
+    queue_ = xQueueCreateStatic(QUEUE_DEPTH, sizeof(Request), (uint8_t*)queue_storage_, &queue_struct_);
+    // 首次播报时在这个任务里映射音色分区，栈留在内部RAM
+    if (TaskFactory::create(synth_task, "local_tts", 8 * 1024, this, LOCAL_TTS_TASK_PRIORITY,
+                            &task_, LOCAL_TTS_TASK_CORE, TaskStack::INTERNAL) != pdPASS) {
+        task_ = nullptr;
+        vQueueDelete(queue_);
+        queue_ = nullptr;
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "✓ 离线语音合成已就绪（音色%lu KB，首次播报时加载）",
+             (unsigned long)(partition_->size / 1024));
+    return ESP_OK;
+}
+
+esp_err_t LocalTts::speak(const char* text) {
+    if (!queue_) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    Request req;
+    snprintf(req.text, sizeof(req.text), "%s", text);
+    return xQueueSend(queue_, &req, 0) == pdTRUE ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+esp_err_t LocalTts::load() {
+    int64_t start = esp_timer_get_time();
+    esp_err_t ret = esp_partition_mmap(partition_, 0, partition_->size, ESP_PARTITION_MMAP_DATA,
+                                       &voice_data_, &mmap_handle_);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ 映射音色分区失败: %s", esp_err_to_name(ret));
+        voice_data_ = nullptr;
+        return ret;
+    }
+    esp_tts_voice_t* voice = esp_tts_voice_set_init(&esp_tts_voice_template, (void*)voice_data_);
+    if (!voice) {
+        ESP_LOGE(TAG, "❌ 音色数据无效，请烧录esp_tts_voice_data_xiaole.dat");
+        esp_partition_munmap(mmap_handle_);
+        voice_data_ = nullptr;
+        return ESP_ERR_INVALID_STATE;
+    }
+    voice_ = voice;
+    tts_ = esp_tts_create(voice);
+    if (!tts_) {
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "⏱️ 加载离线语音合成: %lld ms", (esp_timer_get_time() - start) / 1000);
+    return ESP_OK;
+}
+
+void LocalTts::render(const char* text) {
+    if (!esp_tts_parse_chinese(tts_, text)) {
+        ESP_LOGW(TAG, "⚠️ 无法合成: %s", text);
+        return;
+    }
+
+    int64_t start = esp_timer_get_time();
+    audio_->start_streaming_playback();
+    size_t total = 0;
+    bool completed = true;
+    int len = 0;
+    do {
+        short* pcm = esp_tts_stream_play(tts_, &len, LOCAL_TTS_SPEED);
+        if (len > 0 && !audio_->feed_local_audio(pcm, len)) {
+            completed = false;      // 被打断或播放已停止
+            break;
+        }
+        total += len > 0 ? len : 0;
+    } while (len > 0);
+    esp_tts_stream_reset(tts_);
+
+    if (completed) {
+        audio_->finish_streaming_playback();
+    }
+    ESP_LOGI(TAG, "🗣️ %s: %s（%.2f 秒音频，合成%lld ms）", completed ? "已播报" : "播报中断", text,
+             total / 16000.0f, (esp_timer_get_time() - start) / 1000);
+}
+
+void LocalTts::synth_task(void* arg) {
+    LocalTts* self = (LocalTts*)arg;
+    Request req;
+    while (true) {
+        if (xQueueReceive(self->queue_, &req, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        if (!self->tts_ && self->load() != ESP_OK) {
+            continue;
+        }
+        self->render(req.text);
+    }
+}
@@ -0,0 +1,73 @@
+/**
+ * @file local_tts.h
+ * @brief 🗣️ 离线语音合成 - 连不上服务器时用esp-tts在设备上播报状态和命令结果
+ *
+ * 原来唤醒后连不上服务器只打一行日志就回到空闲，用户以为设备没听见。
+ * 这里用esp-sr自带的中文TTS（voice_data分区里的xiaole音色）合成简短的提示：
+ * - speak()只把文本放进队列，主循环不等合成
+ * - 合成任务每次取出一小段PCM（esp_tts_stream_play）写进播放的抖动缓冲区，
+ *   缓冲区满了就等播放任务消费，不会先把整句渲染到一块大内存里
+ * - 音色数据约3MB，第一次播报时才映射进地址空间并创建引擎，网络正常时不占MMU页和内存
+ *
+ * 播放走和服务器回复相同的流式通道，用户打断、stop_streaming_playback()都会让合成提前结束。
+ */
+
+#ifndef LOCAL_TTS_H
+#define LOCAL_TTS_H
+
+#include <stddef.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "esp_err.h"
+#include "esp_partition.h"
+
+class AudioManager;
+
+class LocalTts {
+public:
+    static constexpr size_t MAX_TEXT_BYTES = 96;    // 一条提示最多约30个汉字
+    static constexpr int QUEUE_DEPTH = 2;
+
+    LocalTts();
+    ~LocalTts();
+
+    /**
+     * @brief 检查音色分区并创建合成任务（不加载音色）
+     *
+     * @param audio 播放输出
+     * @param partition_label 音色数据分区名，找不到时返回ESP_ERR_NOT_FOUND
+     */
+    esp_err_t init(AudioManager* audio, const char* partition_label);
+
+    bool isAvailable() const { return task_ != nullptr; }
+
+    /**
+     * @brief 排队播报一句中文（可以在任意任务中调用，不阻塞；队列满时返回ESP_ERR_TIMEOUT）
+     */
+    esp_err_t speak(const char* text);
+
+private:
+    static const char* TAG;
+
+    struct Request {
+        char text[MAX_TEXT_BYTES];
+    };
+
+    static void synth_task(void* arg);
+    esp_err_t load();
+    void render(const char* text);
+
+    AudioManager* audio_;
+    const esp_partition_t* partition_;
+    esp_partition_mmap_handle_t mmap_handle_;
+    const void* voice_data_;
+    void* voice_;               // esp_tts_voice_t*
+    void* tts_;                 // esp_tts_handle_t
+    QueueHandle_t queue_;
+    StaticQueue_t queue_struct_;
+    Request queue_storage_[QUEUE_DEPTH];
+    TaskHandle_t task_;
+};
+
+#endif // LOCAL_TTS_H
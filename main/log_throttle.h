@@ -0,0 +1,92 @@
+/**
+ * @file log_throttle.h
+ * @brief 🔇 热路径日志 - 限频输出，发布配置下整体编译掉
+ *
+ * 丢帧、队列满这类告警在出问题时每帧都会触发，115200波特率的串口一行就是几毫秒，
+ * ESP_LOGW本身就会拖慢音频任务，越丢越多。热路径上的日志统一改用这里的宏：
+ * - HOT_LOGW / HOT_LOGI：同一调用点每LOG_RATE_LIMIT_MS最多输出一行，
+ *   期间被抑制的条数附在下一行后面
+ * - HOT_LOGD：不限频（调试级别默认不编译进固件，打开时就是想看每一条）
+ *
+ * DEFERRED_LOG_ENABLE时输出走延迟日志（deferred_log.h）：调用方只写一条记录，格式化和写串口在排空任务里，
+ * 参数因此只能是整数和常驻的字符串，加上"期间另有"那一个最多4个。
+ *
+ * LOG_RELEASE_PROFILE为1时这几个宏展开成if (0)，参数仍参与编译（不会产生未使用变量告警），
+ * 格式字符串和调用都被优化掉。丢弃数量在perf_counters里另有计数，不依赖日志。
+ */
+
+#ifndef LOG_THROTTLE_H
+#define LOG_THROTTLE_H
+
+#include <stdint.h>
+#include <atomic>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "project_config.h"
+
+#if DEFERRED_LOG_ENABLE
+#include "deferred_log.h"
+#define HOT_LOG_EMIT_W DLOGW
+#define HOT_LOG_EMIT_I DLOGI
+#define HOT_LOG_EMIT_D DLOGD
+#else
+#define HOT_LOG_EMIT_W ESP_LOGW
+#define HOT_LOG_EMIT_I ESP_LOGI
+#define HOT_LOG_EMIT_D ESP_LOGD
+#endif
+
+/**
+ * @brief 单个调用点的限频状态（宏里以静态变量定义，可以在任意任务中调用）
+ */
+class LogThrottle {
+public:
+    /**
+     * @brief 判断这次是否输出
+     *
+     * @param interval_ms 最小输出间隔
+     * @param suppressed 允许输出时返回上次输出之后被抑制的条数
+     */
+    bool allow(uint32_t interval_ms, uint32_t* suppressed) {
+        int64_t now = esp_timer_get_time();
+        int64_t last = last_us_.load(std::memory_order_relaxed);
+        if ((last != 0 && now - last < (int64_t)interval_ms * 1000) ||
+            !last_us_.compare_exchange_strong(last, now, std::memory_order_relaxed)) {
+            suppressed_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        *suppressed = suppressed_.exchange(0, std::memory_order_relaxed);
+        return true;
+    }
+
+private:
+    std::atomic<int64_t> last_us_{0};
+    std::atomic<uint32_t> suppressed_{0};
+};
+
+#if LOG_RELEASE_PROFILE
+
+#define HOT_LOGW(tag, format, ...) do { if (0) { ESP_LOGW(tag, format, ##__VA_ARGS__); } } while (0)
+#define HOT_LOGI(tag, format, ...) do { if (0) { ESP_LOGI(tag, format, ##__VA_ARGS__); } } while (0)
+#define HOT_LOGD(tag, format, ...) do { if (0) { ESP_LOGD(tag, format, ##__VA_ARGS__); } } while (0)
+
+#else
+
+#define HOT_LOG_LIMITED(log_macro, tag, format, ...) do { \
+        static LogThrottle hot_log_throttle_; \
+        uint32_t hot_log_suppressed_ = 0; \
+        if (hot_log_throttle_.allow(LOG_RATE_LIMIT_MS, &hot_log_suppressed_)) { \
+            if (hot_log_suppressed_ > 0) { \
+                log_macro(tag, format "（期间另有%lu条）", ##__VA_ARGS__, (unsigned long)hot_log_suppressed_); \
+            } else { \
+                log_macro(tag, format, ##__VA_ARGS__); \
+            } \
+        } \
+    } while (0)
+
+#define HOT_LOGW(tag, format, ...) HOT_LOG_LIMITED(HOT_LOG_EMIT_W, tag, format, ##__VA_ARGS__)
+#define HOT_LOGI(tag, format, ...) HOT_LOG_LIMITED(HOT_LOG_EMIT_I, tag, format, ##__VA_ARGS__)
+#define HOT_LOGD(tag, format, ...) HOT_LOG_EMIT_D(tag, format, ##__VA_ARGS__)
+
+#endif // LOG_RELEASE_PROFILE
+
+#endif // LOG_THROTTLE_H
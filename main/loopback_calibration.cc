@@ -0,0 +1,264 @@
+/**
+ * @file loopback_calibration.cc
+ * @brief 🔊 扬声器→麦克风延迟标定实现
+ */
+
+#include "loopback_calibration.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "audio_manager.h"
+#include "bsp_board.h"
+#include "buffer_placement.h"
+#include "dsps_corr.h"
+#include "dsps_dotprod.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "flash_scheduler.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "nvs.h"
+#include "project_config.h"
+#include "sample_format.h"
+
+const char* LoopbackCalibration::TAG = "Loopback";
+
+static const char* NVS_NAMESPACE = "loopback";
+static const uint32_t kRate = 16000;        // 采集和标定时的播放采样率
+static const size_t kChirpSamples = kRate * LOOPBACK_CAL_CHIRP_MS / 1000;
+static const size_t kLeadSamples = kRate * LOOPBACK_CAL_LEAD_MS / 1000;
+static const uint32_t kSlackMs = 200;       // 开始录音到播放任务真正开始写入的余量
+
+LoopbackCalibration::LoopbackCalibration()
+    : armed_(false)
+    , mic_{}
+    , ref_{}
+    , mic_channels_(1)
+{
+}
+
+esp_err_t LoopbackCalibration::init() {
+    mic_channels_ = bsp_get_feed_channel();
+    esp_err_t ret = bsp_capture_add_sink(capture_sink, this);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ 注册采集回调失败: %s", esp_err_to_name(ret));
+    }
+    return ret;
+}
+
+const char* LoopbackCalibration::profileKey() {
+    // NVS键名最多15个字符
+    static char key[16];
+    if (key[0] == '\0') {
+        snprintf(key, sizeof(key), "p%x_%x_%x_%x", (unsigned)I2S_RX_DMA_FRAME_NUM, (unsigned)I2S_RX_DMA_DESC_NUM,
+                 (unsigned)I2S_TX_DMA_FRAME_NUM, (unsigned)I2S_TX_DMA_DESC_NUM);
+    }
+    return key;
+}
+
+esp_err_t LoopbackCalibration::load(uint32_t* delay_us) {
+    nvs_handle_t nvs;
+    esp_err_t ret = nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs);
+    if (ret != ESP_OK) {
+        return ESP_ERR_NOT_FOUND;   // 从没标定过时命名空间不存在
+    }
+    ret = nvs_get_u32(nvs, profileKey(), delay_us);
+    nvs_close(nvs);
+    if (ret != ESP_OK) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    ESP_LOGI(TAG, "✓ DMA配置%s的扬声器→麦克风延迟 %.1f ms", profileKey(), *delay_us / 1000.0f);
+    return ESP_OK;
+}
+
+esp_err_t LoopbackCalibration::save(uint32_t delay_us) {
+    nvs_handle_t nvs;
+    esp_err_t ret = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ 打开NVS失败: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    int64_t start_us = esp_timer_get_time();
+    ret = nvs_set_u32(nvs, profileKey(), delay_us);
+    if (ret == ESP_OK) {
+        ret = nvs_commit(nvs);
+    }
+    nvs_close(nvs);
+    FlashScheduler::noteOp("loopback", esp_timer_get_time() - start_us);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ 保存标定结果失败: %s", esp_err_to_name(ret));
+    }
+    return ret;
+}
+
+void LoopbackCalibration::append(Recording& rec, const int16_t* samples, size_t frames, int stride) {
+    size_t fill = rec.fill.load(std::memory_order_relaxed);
+    if (fill >= rec.capacity || rec.blocks >= MAX_BLOCKS) {
+        return;
+    }
+    size_t n = frames < rec.capacity - fill ? frames : rec.capacity - fill;
+    for (size_t i = 0; i < n; i++) {
+        rec.samples[fill + i] = SampleTraits<int16_t>::toFloat(samples[i * stride]);
+    }
+    rec.block_end[rec.blocks] = (uint32_t)(fill + n);
+    // 这一块的最后一个样本刚到：DMA块刚收完，或者刚写进了发送DMA
+    rec.block_us[rec.blocks] = esp_timer_get_time() - (int64_t)(frames - n) * 1000000 / kRate;
+    rec.blocks++;
+    rec.fill.store(fill + n, std::memory_order_release);
+}
+
+void LoopbackCalibration::capture_sink(const int16_t* samples, size_t count, void* ctx) {
+    LoopbackCalibration* self = (LoopbackCalibration*)ctx;
+    if (!self->armed_.load(std::memory_order_acquire)) {
+        return;
+    }
+    // 双麦克风时只用第一个
+    append(self->mic_, samples, count / self->mic_channels_, self->mic_channels_);
+}
+
+void LoopbackCalibration::feedReference(const int16_t* samples, size_t count) {
+    if (!armed_.load(std::memory_order_acquire)) {
+        return;
+    }
+    append(ref_, samples, count, 1);
+}
+
+int64_t LoopbackCalibration::timeAt(const Recording& rec, size_t index) {
+    for (size_t b = 0; b < rec.blocks; b++) {
+        if (index < rec.block_end[b]) {
+            return rec.block_us[b] - (int64_t)(rec.block_end[b] - 1 - index) * 1000000 / kRate;
+        }
+    }
+    return 0;
+}
+
+bool LoopbackCalibration::findChirp(const Recording& rec, const float* pattern, size_t len, float* corr,
+                                    size_t* peak, float* score) {
+    size_t fill = rec.fill.load(std::memory_order_acquire);
+    if (fill <= len) {
+        return false;
+    }
+    size_t lags = fill - len + 1;
+    if (dsps_corr_f32(rec.samples, (int)fill, pattern, (int)len, corr) != ESP_OK) {
+        return false;
+    }
+    // 喇叭或麦克风可能反相，按绝对值找峰
+    size_t best = 0;
+    for (size_t i = 1; i < lags; i++) {
+        if (fabsf(corr[i]) > fabsf(corr[best])) {
+            best = i;
+        }
+    }
+    float pattern_energy = 0.0f;
+    float window_energy = 0.0f;
+    dsps_dotprod_f32(pattern, pattern, &pattern_energy, (int)len);
+    dsps_dotprod_f32(rec.samples + best, rec.samples + best, &window_energy, (int)len);
+    *peak = best;
+    *score = pattern_energy > 0.0f && window_energy > 0.0f ? fabsf(corr[best]) / sqrtf(pattern_energy * window_energy)
+                                                            : 0.0f;
+    return true;
+}
+
+esp_err_t LoopbackCalibration::run(AudioManager* audio, Result* out) {
+    const size_t mic_capacity = kRate * (LOOPBACK_CAL_LEAD_MS + LOOPBACK_CAL_CHIRP_MS + LOOPBACK_CAL_MAX_MS + kSlackMs) / 1000;
+    const size_t ref_capacity = kRate * (LOOPBACK_CAL_LEAD_MS + LOOPBACK_CAL_CHIRP_MS + kSlackMs) / 1000;
+    const size_t clip_samples = kLeadSamples + kChirpSamples;
+    mic_.samples = (float*)BufferPlacement::alloc("loopback_mic", mic_capacity * sizeof(float), Placement::PSRAM);
+    ref_.samples = (float*)BufferPlacement::alloc("loopback_ref", ref_capacity * sizeof(float), Placement::PSRAM);
+    float* pattern = (float*)BufferPlacement::alloc("loopback_chirp", kChirpSamples * sizeof(float), Placement::PSRAM);
+    float* corr = (float*)BufferPlacement::alloc("loopback_corr", mic_capacity * sizeof(float), Placement::PSRAM);
+    int16_t* clip = (int16_t*)BufferPlacement::alloc("loopback_clip", clip_samples * sizeof(int16_t), Placement::PSRAM);
+    SemaphoreHandle_t done = xSemaphoreCreateBinary();
+    esp_err_t ret = ESP_OK;
+    if (!mic_.samples || !ref_.samples || !pattern || !corr || !clip || !done) {
+        ret = ESP_ERR_NO_MEM;
+    }
+
+    if (ret == ESP_OK) {
+        // 线性扫频，两端各LOOPBACK_CAL_CHIRP_MS/10升余弦渐变，前面垫静音让发送DMA先满起来
+        const float duration = (float)kChirpSamples / kRate;
+        const float sweep = (LOOPBACK_CAL_F1_HZ - LOOPBACK_CAL_F0_HZ) / duration;
+        const size_t taper = kChirpSamples / 10;
+        for (size_t i = 0; i < kChirpSamples; i++) {
+            float t = (float)i / kRate;
+            float phase = 2.0f * (float)M_PI * (LOOPBACK_CAL_F0_HZ * t + 0.5f * sweep * t * t);
+            float window = 1.0f;
+            size_t edge = i < kChirpSamples - 1 - i ? i : kChirpSamples - 1 - i;
+            if (edge < taper) {
+                window = 0.5f * (1.0f - cosf((float)M_PI * edge / taper));
+            }
+            pattern[i] = sinf(phase) * window;
+        }
+        memset(clip, 0, kLeadSamples * sizeof(int16_t));
+        for (size_t i = 0; i < kChirpSamples; i++) {
+            clip[kLeadSamples + i] = (int16_t)(pattern[i] * LOOPBACK_CAL_LEVEL * 32767.0f);
+        }
+
+        mic_.capacity = mic_capacity;
+        mic_.blocks = 0;
+        mic_.fill.store(0, std::memory_order_relaxed);
+        ref_.capacity = ref_capacity;
+        ref_.blocks = 0;
+        ref_.fill.store(0, std::memory_order_relaxed);
+        audio->set_output_rate(kRate);
+        armed_.store(true, std::memory_order_release);
+        ret = audio->play_audio_async((const uint8_t*)clip, clip_samples * sizeof(int16_t),
+                                      [done](bool) { xSemaphoreGive(done); }, AudioMixer::VOICE_EARCON);
+        if (ret == ESP_OK) {
+            // 和play_audio()一样等到放完（回调里还要用done和clip）
+            xSemaphoreTake(done, portMAX_DELAY);
+            // 放完之后再录LOOPBACK_CAL_MAX_MS，回声最晚这时候也到了
+            vTaskDelay(pdMS_TO_TICKS(LOOPBACK_CAL_MAX_MS));
+        }
+        armed_.store(false, std::memory_order_release);
+        vTaskDelay(pdMS_TO_TICKS(20));      // 等正在追加的一块写完
+    }
+
+    size_t ref_peak = 0;
+    size_t mic_peak = 0;
+    float ref_score = 0.0f;
+    float mic_score = 0.0f;
+    if (ret == ESP_OK) {
+        int64_t start_us = esp_timer_get_time();
+        if (!findChirp(ref_, pattern, kChirpSamples, corr, &ref_peak, &ref_score) ||
+            !findChirp(mic_, pattern, kChirpSamples, corr, &mic_peak, &mic_score)) {
+            ESP_LOGW(TAG, "⚠️ 录音不够长（旁路%u个样本，麦克风%u个样本）", (unsigned)ref_.fill.load(),
+                     (unsigned)mic_.fill.load());
+            ret = ESP_ERR_NOT_FOUND;
+        } else {
+            ESP_LOGI(TAG, "🔊 互相关耗时 %lld ms，旁路峰值%.2f，麦克风峰值%.2f", (esp_timer_get_time() - start_us) / 1000,
+                     ref_score, mic_score);
+        }
+    }
+    if (ret == ESP_OK && mic_score < LOOPBACK_CAL_MIN_SCORE) {
+        ESP_LOGW(TAG, "⚠️ 麦克风里没找到扫频（峰值%.2f < %.2f），喇叭没声音或环境太吵", mic_score, LOOPBACK_CAL_MIN_SCORE);
+        ret = ESP_ERR_NOT_FOUND;
+    }
+    int64_t delay_us = 0;
+    if (ret == ESP_OK) {
+        delay_us = timeAt(mic_, mic_peak) - timeAt(ref_, ref_peak);
+        if (delay_us <= 0 || delay_us > (int64_t)LOOPBACK_CAL_MAX_MS * 1000) {
+            ESP_LOGW(TAG, "⚠️ 测得的延迟 %lld us 不在 0~%d ms 之内，不保存", delay_us, LOOPBACK_CAL_MAX_MS);
+            ret = ESP_ERR_INVALID_RESPONSE;
+        }
+    }
+    if (ret == ESP_OK) {
+        out->delay_us = (uint32_t)delay_us;
+        out->score = mic_score;
+        ESP_LOGI(TAG, "✅ DMA配置%s: 扬声器→麦克风延迟 %.1f ms（发送DMA深度 %.1f ms）", profileKey(), delay_us / 1000.0f,
+                 bsp_audio_sink_latency_us() / 1000.0f);
+        save((uint32_t)delay_us);
+    }
+
+    if (done) {
+        vSemaphoreDelete(done);
+    }
+    BufferPlacement::free(clip);
+    BufferPlacement::free(corr);
+    BufferPlacement::free(pattern);
+    BufferPlacement::free(mic_.samples);
+    BufferPlacement::free(ref_.samples);
+    mic_.samples = nullptr;
+    ref_.samples = nullptr;
+    return ret;
+}
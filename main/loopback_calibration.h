@@ -0,0 +1,95 @@
+/**
+ * @file loopback_calibration.h
+ * @brief 🔊 扬声器→麦克风延迟标定 - 播一段扫频，在播放旁路和麦克风里各找一次，两个时间差就是回声的真实延迟
+ *
+ * 回声消除要参考信号和麦克风里的回声大致对齐，端到端延迟统计也要知道"写进I2S"到"真正出声"之间有多久；
+ * 这段延迟主要是发送DMA的深度（I2S_TX_DMA_*），再加上喇叭到麦克风的声学路径和接收端的块大小，
+ * 换一个DMA配置（I2S_DMA_PROFILE）就不一样。以前只能按AFE_AEC_MAX_REF_LEAD_MS估一个上限。
+ *
+ * run()播一段提示音通路上的线性扫频（LOOPBACK_CAL_F0_HZ~F1_HZ，两端升余弦渐变），前面垫LOOPBACK_CAL_LEAD_MS静音，
+ * 扫频写进I2S时发送DMA已经是满的、写入在阻塞，旁路拿到的时间就是稳态下的写入时间：
+ * - 播放旁路（feedReference，和回声消除的参考信号同一个点）和采集回调各录一段，每块按到达时刻打时间戳
+ * - 用esp-dsp的dsps_corr_f32把扫频分别和两段录音做互相关，峰值的位置换算成时间，相减得到延迟
+ * - 麦克风那边的峰值要按窗口能量归一化后不低于LOOPBACK_CAL_MIN_SCORE（喇叭没接、音量太小时不存）
+ *
+ * 结果按DMA配置（profileKey()，接收/发送的帧长和描述符数）存进NVS，换配置后重新标定，
+ * 同一配置以后启动直接读出来。时间戳来自esp_timer，精度受采集任务的调度影响，约1毫秒。
+ */
+
+#ifndef LOOPBACK_CALIBRATION_H
+#define LOOPBACK_CALIBRATION_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include "esp_err.h"
+
+class AudioManager;
+
+class LoopbackCalibration {
+public:
+    struct Result {
+        uint32_t delay_us;      // 播放旁路拿到一个样本到它从麦克风回来
+        float score;            // 麦克风那边互相关峰值的归一化值（0~1）
+    };
+
+    LoopbackCalibration();
+
+    /**
+     * @brief 注册采集回调（必须在bsp_capture_start之前调用）
+     */
+    esp_err_t init();
+
+    /**
+     * @brief 当前DMA配置的NVS键名
+     */
+    static const char* profileKey();
+
+    /**
+     * @brief 读出当前DMA配置上次标定的延迟
+     *
+     * @return ESP_ERR_NOT_FOUND表示这个配置还没有标定过
+     */
+    esp_err_t load(uint32_t* delay_us);
+
+    /**
+     * @brief 播放旁路（在播放任务中调用，没在标定时直接返回）
+     */
+    void feedReference(const int16_t* samples, size_t count);
+
+    /**
+     * @brief 播扫频并测量，成功时存进NVS（主任务中调用，阻塞不到一秒；需要空闲、没有在播放）
+     *
+     * @return ESP_ERR_NOT_FOUND表示麦克风里没找到扫频（喇叭没声音或太吵），ESP_ERR_INVALID_RESPONSE表示延迟超出范围
+     */
+    esp_err_t run(AudioManager* audio, Result* out);
+
+private:
+    static constexpr size_t MAX_BLOCKS = 96;
+
+    // 一段录音：采集任务/播放任务（各自唯一的写入方）写入，主任务在停止录音之后读取
+    // 每块记下结束位置和到达时间：播放旁路开头预加载DMA的几块是一下子到的，不能按第一块推算后面的时间
+    struct Recording {
+        float* samples;
+        size_t capacity;
+        std::atomic<size_t> fill;
+        size_t blocks;
+        uint32_t block_end[MAX_BLOCKS];
+        int64_t block_us[MAX_BLOCKS];
+    };
+
+    static void capture_sink(const int16_t* samples, size_t count, void* ctx);
+    static void append(Recording& rec, const int16_t* samples, size_t frames, int stride);
+    static int64_t timeAt(const Recording& rec, size_t index);
+    static bool findChirp(const Recording& rec, const float* pattern, size_t len, float* corr, size_t* peak,
+                          float* score);
+    esp_err_t save(uint32_t delay_us);
+
+    static const char* TAG;
+    std::atomic<bool> armed_;
+    Recording mic_;
+    Recording ref_;
+    int mic_channels_;
+};
+
+#endif // LOOPBACK_CALIBRATION_H
@@ -10,9 +10,16 @@
 #include "freertos/task.h"
 #include "freertos/queue.h"
 #include "esp_log.h"
+#include "log_throttle.h"
 #include "nvs_flash.h"
 #include "esp_event.h"
-#include "esp_afe_sr_models.h"
+#include "esp_timer.h"
+#include "esp_mac.h"
+#include "esp_system.h"
+#include "esp_heap_caps.h"
+#include <algorithm>
+#include <atomic>
+#include <string_view>
 #include "esp_process_sdkconfig.h"
 #include "esp_wn_iface.h"
 #include "esp_wn_models.h"
@@ -20,9 +27,53 @@
 #include "bsp_board.h"
 #include "wifi_manager.h"
 #include "websocket_client.h"
+#include "work_queue.h"
 #include "audio_manager.h"
+#include "audio_front_end.h"
+#include "uplink_coalescer.h"
+#include "uplink_backlog.h"
+#include "uplink_rate_controller.h"
 #include "project_config.h"  // 添加配置文件
-#include "mock_voices/hi.h" // 导入提示音
+#include "prompt_store.h"
+#include "asset_cache.h"
+#include "model_loader.h"
+#include "memory_budget.h"
+#include "latency_trace.h"
+#include "perf_counters.h"
+#include "scope_timer.h"
+#include "heap_monitor.h"
+#include "wake_settings.h"
+#include "runtime_config.h"
+#include "ota_updater.h"
+#include "local_commands.h"
+#include "local_tts.h"
+#include "media_stream.h"
+#include "power_policy.h"
+#include "boot_timeline.h"
+#include "control_protocol.h"
+#include "json_message.h"
+#include "session_capture.h"
+#include "sched_trace.h"
+#include "net_self_test.h"
+#include "conversation_session.h"
+#include "buffer_placement.h"
+#include "task_factory.h"
+#include "realtime_audio.h"
+#include "dsp_benchmark.h"
+#include "supervisor.h"
+#include "push_to_talk.h"
+#include "fast_resume.h"
+#include "perf_history.h"
+#include "flight_recorder.h"
+#include "deferred_log.h"
+#include "loopback_calibration.h"
+#include "flash_scheduler.h"
+#include "udp_audio.h"
+#include "relay_selector.h"
+#include "thinking_filler.h"
+#include "upload_scheduler.h"
+#include "turn_cost.h"
+#include "soak_test.h"
 
 static const char* TAG = "语音识别";
 
@@ -30,323 +81,2442 @@ static const char* TAG = "语音识别";
 static WiFiManager* wifi_manager = nullptr;
 static WebSocketClient* ws_client = nullptr;
 static AudioManager* audio_manager = nullptr;
+static AudioFrontEnd* front_end = nullptr;
+static PromptStore prompt_store;
+static AssetCache asset_cache;
+static ModelLoader model_loader;
+static LatencyTrace latency_trace;
+static WakeSettings wake_settings;
+static RuntimeConfig runtime_config;
+static OtaUpdater ota_updater;
+static NetSelfTest* net_self_test = nullptr;
+static UdpAudio* udp_audio = nullptr;
+static RelaySelector* relay_selector = nullptr;
+static LocalCommands local_commands;
+static LocalTts local_tts;
+static MediaStream media_stream;
+static PowerPolicy power_policy;
+static BootTimeline boot_timeline;
+static SessionCapture session_capture;    // 服务器录制会话时记录设备端时间戳
+static ConversationSession conversation(CONVERSATION_FOLLOW_UP_MS, CONVERSATION_IDLE_TIMEOUT_MS);
+static ThinkingFiller thinking_filler;
+static UploadScheduler upload_scheduler;  // 统计、黑匣子等维护上传的限速和唤醒暂停
+static TurnCost turn_cost;                // 每轮的流量、CPU和缓冲区峰值，和trace一起发给服务器
+static SoakTest soak_test;                // 🔥 浸泡测试（SOAK_TEST构建）：自动唤醒、随机断线、定时报告
+static PushToTalk push_to_talk;
+#if REPLY_REPEAT_GPIO >= 0
+static PushToTalk repeat_button;     // 只用按下事件（见handle_repeat_button）
+#endif
+static FastResume fast_resume;
+static PerfHistory perf_history;        // 🗄️ 跨重启的性能累计（见perf_history.h）
+static LoopbackCalibration loopback_cal;    // 🔊 扬声器→麦克风延迟标定
+static bool s_resume_hello = false;     // 🌙 深度睡眠醒来后第一次hello带上resume
+static TaskHandle_t main_task_handle = nullptr;
+static TaskHandle_t network_task_handle = nullptr;
 QueueHandle_t s_audio_send_queue = nullptr;
+// 📌 队列用静态API从预留的内存创建，启动后不再碰堆（见heap_monitor.h的分配绊线）
+static StaticQueue_t s_audio_send_queue_struct;
+static uint8_t s_audio_send_queue_storage[AUDIO_SEND_QUEUE_DEPTH * sizeof(AudioQueueItem)];
+AudioFramePool* s_audio_frame_pool = nullptr;
 
 // 语音识别状态
 enum class SpeechState {
     IDLE,               // 空闲，等待唤醒
-    SESSION_ACTIVE,     // 唤醒后，会话激活直到断开连接
+    LOCAL_COMMAND,      // 唤醒后先在本地识别命令词，没命中再进入会话
+    SESSION_ACTIVE,     // 云端会话，阶段见ConversationSession，没人说话超时后回到空闲
 };
 static SpeechState current_state = SpeechState::IDLE;
 
 // 全局变量：唤醒状态控制
-static int wake_up_counter = 0;
-static bool wake_up_triggered = false;
+// 唤醒回调置位、主循环取走（按键中断也会唤醒主循环，不能只看通知）
+static std::atomic<bool> s_wake_detected{false};
+// 🔘 按键说话时不跑WakeNet（PUSH_TO_TALK_WAKE_WORD=0）
+static constexpr bool kWakeWordActive = !PUSH_TO_TALK_ENABLE || PUSH_TO_TALK_WAKE_WORD;
+
+// 会话期间连接断开：事件任务只置位，由主循环负责等待重连（事件任务阻塞等待连接事件，连接事件本身就排在它后面）
+static std::atomic<bool> session_reconnect_pending{false};
+
+// 上行合包延迟预算，心跳测得RTT后更新，发送任务读取
+static std::atomic<uint32_t> s_uplink_delay_ms{UPLINK_COALESCE_MAX_DELAY_MS};
+static std::atomic<uint32_t> s_uplink_delay_cap_ms{UPLINK_COALESCE_MAX_DELAY_MS};   // 运行时参数uplink_delay_ms
+
+// 上行码率自适应（发送任务评估；本轮平均码率由WebSocket事件任务在tts_end时取走），心跳测得的平滑RTT
+static UplinkRateController s_uplink_rate;
+static std::atomic<uint32_t> s_link_srtt_ms{0};
+
+// 上行音频消息带帧头（服务器hello确认后打开，断开时关闭），发送任务读取
+static std::atomic<bool> s_uplink_framing{false};
+
+// 服务器hello已确认编码格式，可以发上行音频（断开时清除，之前的帧留在存储转发缓冲区），发送任务读取
+static std::atomic<bool> s_uplink_ready{false};
+
+// 📡 上行音频在走UDP（只在发送任务中访问）：UDP通了之后等WebSocket音频通道排空再切，两条路上的消息不会乱序
+static bool s_uplink_on_udp = false;
+
+// 📡 谁正在往抖动缓冲区交下行音频：WebSocket的一条消息可能分几个片段回调，UDP接收任务不能插在中间
+enum : uint8_t { DOWNLINK_FEEDER_NONE = 0, DOWNLINK_FEEDER_WS, DOWNLINK_FEEDER_UDP };
+static std::atomic<uint8_t> s_downlink_feeder{DOWNLINK_FEEDER_NONE};
+
+// 设备ID（WiFi STA MAC），hello里带给服务器用于多进程路由
+static char s_device_id[13] = "";
+
+// 服务器请求性能统计：WebSocket任务只置位，由主循环汇总发送
+static std::atomic<bool> s_stats_requested{false};
+static std::atomic<bool> s_history_pending{false};     // 🗄️ hello确认后上报一次性能累计
+static std::atomic<bool> s_flight_upload{false};       // 🛩️ hello确认后上传复位前的黑匣子记录
+
+// 服务器下发的唤醒词参数：WebSocket任务拷贝后置位，由主循环解析、写NVS并回复
+static char s_wake_config[256];
+static std::atomic<bool> s_wake_config_pending{false};
+
+// 服务器下发的运行时参数：同上，由主循环解析、生效、写NVS并回复
+static char s_runtime_config[512];
+static std::atomic<bool> s_runtime_config_pending{false};
+
+// 服务器下发的升级请求：同上，由主循环启动下载任务
+static char s_ota_request[384];
+static std::atomic<bool> s_ota_request_pending{false};
+// 📻 服务器发的长音频控制：同上，由主循环交给下载任务
+static char s_media_request[384];
+static std::atomic<bool> s_media_request_pending{false};
+// 📦 服务器要播一条推送的提示音（按哈希）：同上，由主循环播放
+static char s_asset_play[AssetCache::ID_BYTES * 2 + 1];
+static std::atomic<bool> s_asset_play_pending{false};
+// 完成hello，新固件可以标记为有效（事件任务的栈在PSRAM，写Flash的操作都交给主循环）
+static std::atomic<bool> s_firmware_confirm{false};
+
+// 🛰️ 服务器要求网络自检：同上，由主循环在空闲时启动
+static char s_net_test_request[160];
+static std::atomic<bool> s_net_test_pending{false};
+static std::atomic<bool> s_loopback_pending{false};  // 🔊 空闲时标定扬声器→麦克风延迟（启动时没标定过，或服务器要求）
+
+// 🚦 服务器上游满载、拒绝了这次会话：WebSocket任务置位，由主循环结束会话并播报
+static std::atomic<bool> s_server_busy{false};
+
+// 🛡️ 服务器会复核唤醒词（hello协商，断开时清除）；复核没通过时WebSocket任务置位，由主循环取消这次唤醒
+// 🏠 同一房间的另一台设备离得更近（服务器仲裁输了）时也走同一条路，只是计数和日志不同
+static std::atomic<bool> s_wake_verify{false};
+static std::atomic<bool> s_wake_rejected{false};
+static std::atomic<bool> s_wake_lost{false};
+
+// 🔌 回复播到一半断开时的播放位置，重连的hello带给服务器续播（事件任务读写）；
+// 服务器同意续播时hello处理里直接开始流式播放，主循环的重连流程不再重开（会清掉已经到的续播音频）
+static bool s_playback_resume = false;
+static uint16_t s_playback_seq = 0;
+static uint32_t s_playback_unplayed = 0;
+static std::atomic<bool> s_playback_resumed{false};
+
+// 本地命令词结果：fetch任务写入，主循环10ms内取走（-1=还没有结果）
+static std::atomic<int> s_local_result{-1};
+static std::atomic<float> s_local_prob{0.0f};
+static std::atomic<const char*> s_local_text{nullptr};  // 命中的中文说法（ask意图发给服务器）
+// 服务器hello同意了文字问题（"text_query"），断开后按新连接的hello重新确定
+static std::atomic<bool> s_text_query{false};
+static int64_t s_local_armed_us = 0;
+static float s_volume = 1.0f;              // 本地调音量的比例，乘在MIXER_*_GAIN上
+
+// 🚀 网络任务完成WiFi和首次WebSocket连接后置位；之前主循环不碰连接（本地命令词照常可用）
+static std::atomic<bool> s_network_ready{false};
 
 // 函数声明
-void on_websocket_event(const WebSocketClient::EventData& event);
+static void on_ws_connected(const WebSocketClient::EventData& event, void* ctx);
+static void on_ws_disconnected(const WebSocketClient::EventData& event, void* ctx);
+static void on_ws_error(const WebSocketClient::EventData& event, void* ctx);
+static void on_ws_binary(const WebSocketClient::EventData& event, void* ctx);
+static void on_ws_control(const WebSocketClient::EventData& event, void* ctx);
+static void on_ws_text(const WebSocketClient::EventData& event, void* ctx);
+static void on_udp_audio(const uint8_t* data, size_t len);
+static void audio_send_task(void* arg);
+static void network_task(void* arg);
+static void play_greeting();
+static void update_thinking_filler();
+static bool ensure_ws_connected(int timeout_ms);
+static void report_downlink_credit();
+static void report_perf_stats();
+static void report_perf_history();
+static void report_flight_record();
+static void report_session_capture();
+static void report_sched_trace();
+static void apply_wake_config();
+static void apply_runtime_config();
+static void apply_ota_request();
+static void report_ota_status();
+static void apply_media_request();
+static void report_media_status();
+static void apply_asset_play();
+static void apply_net_test();
+static void apply_loopback_cal();
+static void handle_server_busy();
+static void handle_wake_rejected();
+static bool start_cloud_session(int timeout_ms, bool push_to_talk = false);
+static void handle_push_to_talk();
+#if SOAK_TEST
+static void handle_soak_test();
+#endif
+#if REPLY_REPEAT_GPIO >= 0
+static void handle_repeat_button();
+#endif
+static void maybe_deep_sleep();
+static void maybe_warm_up();
+static void end_cloud_session();
+static void handle_local_command(LocalCommands::Intent intent);
+static void on_tts_end();
+static uint32_t ws_write_us();
+static void on_interrupt_ack();
+static void dispatch_control(const ControlProtocol::Header& header, const uint8_t* payload);
 
 /**
  * @brief 主程序入口
  */
 extern "C" void app_main(void) {
     ESP_LOGI(TAG, "系统启动...");
+    // 🌙 从深度睡眠醒来时沿用睡前留在RTC内存里的状态（见fast_resume.h）
+    fast_resume.init();
+    // 🛩️ 软件复位/崩溃前的黑匣子记录先拷出来，然后开始记这一次的
+    FlightRecorder::init();
+    // 📮 热路径日志的排空任务（见deferred_log.h）
+    DeferredLog::start();
+    if (fast_resume.resumed()) {
+        boot_timeline.setResumed(fast_resume.sleptMs(), fast_resume.coldWakeReadyMs());
+        s_resume_hello = fast_resume.sessionToken()[0] != '\0';
+    }
 
     // 初始化NVS
     esp_err_t ret = nvs_flash_init();
     if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+        int64_t repair_start = esp_timer_get_time();
         ESP_ERROR_CHECK(nvs_flash_erase());
         ret = nvs_flash_init();
+        FlashScheduler::noteOp("nvs_repair", esp_timer_get_time() - repair_start);
     }
     ESP_ERROR_CHECK(ret);
+#if PERF_HISTORY_ENABLE
+    perf_history.init();
+#endif
     
     ESP_ERROR_CHECK(esp_event_loop_create_default());
+    boot_timeline.mark(BootStage::NVS);
+    main_task_handle = xTaskGetCurrentTaskHandle();
+#if PUSH_TO_TALK_ENABLE
+    push_to_talk.init((gpio_num_t)PUSH_TO_TALK_GPIO, PUSH_TO_TALK_ACTIVE_LEVEL, main_task_handle);
+#endif
+#if REPLY_REPEAT_GPIO >= 0
+    repeat_button.init((gpio_num_t)REPLY_REPEAT_GPIO, PUSH_TO_TALK_ACTIVE_LEVEL, main_task_handle);
+#endif
+    HeapMonitor::start(HEAP_MONITOR_SAMPLE_MS);
+    SchedTrace::init();
+    // 📦 刚升级的固件从这里开始回滚计时（见ota_updater.h）
+    ota_updater.init();
+
+#if DSP_BENCHMARK
+    // 🏁 基准测试模式：不连网络、不启动I2S和音频任务，测完停在这里（见dsp_benchmark.h）
+    prompt_store.init(PROMPT_PARTITION_LABEL);
+    wake_settings.load();
+    DspBenchmark::run(model_loader.load("model"), prompt_store.find(DSP_BENCHMARK_PROMPT), wake_settings);
+    ESP_LOGI(TAG, "🏁 基准测试结束，把project_config.h里的DSP_BENCHMARK改回0恢复正常固件");
+    vTaskSuspend(NULL);
+#endif
+
+    // 🎚️ 运行时参数要在创建WebSocket客户端之前读出来
+    runtime_config.load();
+    conversation.setTimeouts(runtime_config.get(RuntimeParam::FOLLOW_UP_MS),
+                             runtime_config.get(RuntimeParam::IDLE_TIMEOUT_MS));
+    s_uplink_delay_ms = s_uplink_delay_cap_ms = runtime_config.get(RuntimeParam::UPLINK_DELAY_MS);
+
+    // 🚀 WiFi关联和拿IP要一两秒，放到网络任务里，和下面的I2S、模型加载同时进行
+    // 对象先在这里建好，主循环可以随时访问（连上之前isConnected()为false）
+    MemoryBudget::begin(MemSubsystem::NETWORK);
+    wifi_manager = new WiFiManager(CONFIG_EXAMPLE_WIFI_SSID, CONFIG_EXAMPLE_WIFI_PASSWORD);
+    WiFiManager::ConnectOptions wifi_options;
+    wifi_options.fast_connect = WIFI_FAST_CONNECT;
+    wifi_options.static_ip = WIFI_STATIC_IP;
+    wifi_options.netmask = WIFI_STATIC_NETMASK;
+    wifi_options.gateway = WIFI_STATIC_GATEWAY;
+    wifi_options.dns = WIFI_STATIC_DNS;
+    wifi_options.perf_profile = (WiFiManager::PerfProfile)runtime_config.get(RuntimeParam::WIFI_PROFILE);
+    wifi_options.good_rssi_dbm = WIFI_GOOD_RSSI_DBM;
+    wifi_options.roam_rssi_dbm = WIFI_ROAM_RSSI_DBM;
+    wifi_options.roam_hysteresis_db = WIFI_ROAM_HYSTERESIS_DB;
+    wifi_options.monitor_task_priority = WIFI_MONITOR_TASK_PRIORITY;
+    wifi_options.monitor_task_core = WIFI_MONITOR_TASK_CORE;
+    fast_resume.ap(wifi_options.resume_bssid, &wifi_options.resume_channel);
+    wifi_manager->setConnectOptions(wifi_options);
+    // 📡 链路变差时加大播放预缓冲，恢复后还原
+    wifi_manager->setLinkCallback([](const WiFiManager::LinkQuality& quality) {
+        uint32_t boost_ms = 0;
+        if (quality.level == WiFiManager::LinkQuality::Level::FAIR) {
+            boost_ms = WIFI_FAIR_PREBUFFER_BOOST_MS;
+        } else if (quality.level != WiFiManager::LinkQuality::Level::GOOD) {
+            boost_ms = WIFI_POOR_PREBUFFER_BOOST_MS;
+        }
+        audio_manager->set_prebuffer_boost_ms(boost_ms);
+    });
+
+    // WebSocket客户端（在网络任务中连接）
+    ws_client = new WebSocketClient(CONFIG_EXAMPLE_WEBSOCKET_URI, true,
+                                    (int)runtime_config.get(RuntimeParam::BACKOFF_MS),
+                                    (int)runtime_config.get(RuntimeParam::BACKOFF_MAX_MS));
+    // 📡 下行音频在WebSocket任务里直接进抖动缓冲区；连接状态和文本消息转到事件任务，收包不等应用逻辑
+    ws_client->setInlineHandler(WebSocketClient::EventType::DATA_BINARY, on_ws_binary);
+    ws_client->setDeferredHandler(WebSocketClient::EventType::DATA_BINARY, on_ws_control);
+    ws_client->setDeferredHandler(WebSocketClient::EventType::CONNECTED, on_ws_connected);
+    ws_client->setDeferredHandler(WebSocketClient::EventType::DISCONNECTED, on_ws_disconnected);
+    ws_client->setDeferredHandler(WebSocketClient::EventType::ERROR, on_ws_error);
+    ws_client->setDeferredHandler(WebSocketClient::EventType::DATA_TEXT, on_ws_text);
+    // 🧭 连不上当前中继时立即换下一个候选（见relay_selector.h）
+    relay_selector = new RelaySelector(CONFIG_EXAMPLE_WEBSOCKET_URI);
+    ws_client->setFailover([](std::string* next_uri) { return relay_selector->next(next_uri); });
+    net_self_test = new NetSelfTest(ws_client, CONFIG_EXAMPLE_WEBSOCKET_URI);
+    if (UDP_AUDIO_ENABLE && AUDIO_FRAMING_ENABLE) {
+        udp_audio = new UdpAudio(ws_client, on_udp_audio);
+        if (udp_audio->init() != ESP_OK) {
+            delete udp_audio;
+            udp_audio = nullptr;
+        }
+    }
+    WebSocketClient::TransportProfile profile;
+    profile.no_delay = WS_TCP_NODELAY;
+    profile.dscp = WS_DSCP;
+    profile.tls_session_resume = WS_TLS_SESSION_RESUME;
+    profile.native_transport = WS_NATIVE_TRANSPORT;
+    profile.keepalive_idle_sec = WS_KEEPALIVE_IDLE_SEC;
+    profile.keepalive_interval_sec = WS_KEEPALIVE_INTERVAL_SEC;
+    profile.keepalive_count = WS_KEEPALIVE_COUNT;
+    profile.ping_interval_sec = WS_PING_INTERVAL_SEC;
+    profile.pingpong_timeout_sec = WS_PINGPONG_TIMEOUT_SEC;
+    profile.task_priority = WS_TASK_PRIORITY;
+    profile.send_task_priority = WS_SEND_TASK_PRIORITY;
+    profile.send_task_core = WS_SEND_TASK_CORE;
+    profile.event_task_priority = WS_EVENT_TASK_PRIORITY;
+    profile.event_task_core = WS_EVENT_TASK_CORE;
+    profile.control_slots = WS_SEND_CONTROL_SLOTS;
+    profile.control_slot_bytes = WS_SEND_CONTROL_SLOT_BYTES;
+    profile.audio_slots = WS_SEND_AUDIO_SLOTS;
+    profile.audio_slot_bytes = UPLINK_COALESCE_FRAMES * AUDIO_FRAME_SAMPLES * sizeof(int16_t) + AudioFraming::HEADER_BYTES;
+    profile.audio_deadline_ms = WS_SEND_AUDIO_DEADLINE_MS;
+    profile.bulk_slots = WS_SEND_BULK_SLOTS;
+    profile.bulk_slot_bytes = WS_SEND_BULK_SLOT_BYTES;
+    ws_client->setTransportProfile(profile);
+    WebSocketClient::checkNetworkBuffers(WS_MIN_TCP_WND, WS_MIN_TCP_SND_BUF);
+
+    // 💓 心跳测得的RTT用来调整上行合包的延迟预算（播放预缓冲由AudioManager按下行到达时间自适应）
+    ws_client->setHeartbeat((int)runtime_config.get(RuntimeParam::HEARTBEAT_MS),
+                            (int)runtime_config.get(RuntimeParam::HEARTBEAT_TIMEOUT_MS));
+    ws_client->setLinkQualityCallback([](const WebSocketClient::LinkQuality& q) {
+        // RTT越大，合包多等一会儿对体感的影响越小；局域网里尽量少等
+        s_uplink_delay_ms = std::clamp<uint32_t>(q.srtt_ms / 2, 20, s_uplink_delay_cap_ms.load());
+        s_link_srtt_ms = q.srtt_ms;
+    });
+    // 🧰 重连、心跳等后台杂活共用的工作任务（见work_queue.h）
+    WorkQueue::start();
+    // WiFi连接会把AP信息写进NVS，栈留在内部RAM（见task_factory.h）
+    TaskFactory::create(network_task, "network_task", NETWORK_TASK_STACK, NULL,
+                        NETWORK_TASK_PRIORITY, &network_task_handle, NETWORK_TASK_CORE, TaskStack::INTERNAL);
+    MemoryBudget::end(MemSubsystem::NETWORK);
 
     // 初始化硬件 (需要提供参数)
-    bsp_board_init(16000, 1, 16);
+    MemoryBudget::begin(MemSubsystem::BOARD);
+    bsp_board_init(16000, MIC_CHANNELS, MIC_CAPTURE_BITS, I2S_RX_DMA_DESC_NUM, I2S_RX_DMA_FRAME_NUM);
     
     // 初始化音频播放功能
     ESP_LOGI(TAG, "初始化音频播放功能...");
-    esp_err_t audio_init_ret = bsp_audio_init(16000, 1, 16);
+    esp_err_t audio_init_ret = bsp_audio_init(16000, 1, 16, I2S_TX_DMA_DESC_NUM, I2S_TX_DMA_FRAME_NUM);
     if (audio_init_ret != ESP_OK) {
         ESP_LOGE(TAG, "❌ 音频播放初始化失败: %s", esp_err_to_name(audio_init_ret));
     } else {
         ESP_LOGI(TAG, "✅ 音频播放初始化成功");
     }
+    MemoryBudget::end(MemSubsystem::BOARD);
+    boot_timeline.mark(BootStage::BOARD);
+#if BUFFER_PLACEMENT_BENCHMARK
+    // 音频任务还没启动，测到的是不受干扰的带宽
+    BufferPlacement::runBenchmark();
+#endif
+#if REALTIME_AUDIO_BENCHMARK
+    RealtimeAudio::runBenchmark();
+#endif
 
-    // 初始化WiFi (需要提供参数)
-    wifi_manager = new WiFiManager(CONFIG_EXAMPLE_WIFI_SSID, CONFIG_EXAMPLE_WIFI_PASSWORD);
-    esp_err_t wifi_ret = wifi_manager->connect();
-    if (wifi_ret != ESP_OK) {
-        ESP_LOGE(TAG, "❌ WiFi连接失败，无法继续");
-        // 这里可以选择重启或者进入離线模式
-        while(1) {
-            vTaskDelay(pdMS_TO_TICKS(5000));
-            ESP_LOGE(TAG, "请检查WiFi配置: SSID=%s", CONFIG_EXAMPLE_WIFI_SSID);
-        }
-    }
-    
-    // 检查WiFi连接状态
-    if (wifi_manager->isConnected()) {
-        ESP_LOGI(TAG, "✅ WiFi连接成功，IP地址: %s", wifi_manager->getIpAddress().c_str());
-    } else {
-        ESP_LOGE(TAG, "❌ WiFi连接失败");
+    // 初始化音频管理器（本地语音链路先于网络启动，唤醒不用等WiFi和WebSocket）
+    MemoryBudget::begin(MemSubsystem::AUDIO);
+    audio_manager = new AudioManager(16000, SESSION_CAPTURE_SEC);
+    audio_manager->set_prebuffer_ms(runtime_config.get(RuntimeParam::PREBUFFER_MS));    // 0=自适应
+
+    // 提示音直接从Flash映射，播放时解码，不占RAM
+    if (prompt_store.init(PROMPT_PARTITION_LABEL) != ESP_OK) {
+        ESP_LOGW(TAG, "⚠️ 提示音不可用，请用 idf.py flash 烧录prompts分区");
     }
+#if ASSET_CACHE_ENABLE
+    // 📦 服务器推送的提示音（上次缓存的离线也能用，连上后按清单补齐）
+    asset_cache.init(ASSET_PARTITION_LABEL);
+#endif
+#if LOCAL_TTS_ENABLE
+    // 连不上服务器时的本地播报（音色第一次用到时才加载）
+    local_tts.init(audio_manager, LOCAL_TTS_PARTITION_LABEL);
+#endif
+#if MEDIA_STREAM_ENABLE
+    // 📻 服务器指定地址的长音频（预取环在PSRAM）
+    media_stream.init(audio_manager);
+#endif
 
-    // 初始化WebSocket客户端并立即连接
-    ws_client = new WebSocketClient(CONFIG_EXAMPLE_WEBSOCKET_URI);
-    ws_client->setEventCallback(on_websocket_event);
-    
-    // 立即尝试连接WebSocket，避免唤醒时才连接导致音频丢失
-    ESP_LOGI(TAG, "🌐 正在连接WebSocket服务器...");
-    esp_err_t ws_ret = ws_client->connect();
-    if (ws_ret != ESP_OK) {
-        ESP_LOGW(TAG, "⚠️ 初始WebSocket连接失败，将在唤醒时重试");
-    } else {
-        // 等待连接建立
-        int connect_wait = 0;
-        while (!ws_client->isConnected() && connect_wait < 150) {  // 增加等待时间到15秒
-            vTaskDelay(pdMS_TO_TICKS(100));
-            connect_wait++;
+    // 初始化音频帧池和发送队列（每帧AUDIO_FRAME_MS）
+    s_audio_frame_pool = new AudioFramePool(AUDIO_FRAME_POOL_SLOTS, AUDIO_FRAME_SAMPLES * sizeof(int16_t),
+                                            AUDIO_FRAME_POOL_USE_PSRAM);
+    s_audio_send_queue = xQueueCreateStatic(AUDIO_SEND_QUEUE_DEPTH, sizeof(AudioQueueItem), s_audio_send_queue_storage,
+                                            &s_audio_send_queue_struct);
+
+    // 创建音频录制任务和上行发送任务（编码在音频核心，发送在网络核心，见project_config.h任务拓扑）
+    TaskFactory::create(AudioManager::audio_record_task, "audio_record_task", AUDIO_RECORD_TASK_STACK,
+                        audio_manager, AUDIO_RECORD_TASK_PRIORITY, NULL, AUDIO_RECORD_TASK_CORE, TaskStack::INTERNAL);
+    TaskFactory::create(audio_send_task, "audio_send_task", AUDIO_SEND_TASK_STACK,
+                        NULL, AUDIO_SEND_TASK_PRIORITY, NULL, AUDIO_SEND_TASK_CORE, TaskStack::INTERNAL);
+    MemoryBudget::end(MemSubsystem::AUDIO);
+    boot_timeline.mark(BootStage::AUDIO);
+
+    // 🎛️ 初始化音频前端：AFE负责降噪/VAD/AGC/唤醒词，feed和fetch任务都在音频核心上
+    // 模型只映射分区中实际用到的部分（见model_loader.h）
+    ESP_LOGI(TAG, "正在初始化音频前端和唤醒词检测...");
+    MemoryBudget::begin(MemSubsystem::MODELS);
+    srmodel_list_t *models = model_loader.load("model");
+    boot_timeline.mark(BootStage::MODELS);
+    wake_settings.load();
+    front_end = new AudioFrontEnd();
+    for (int i = 0; i < FastResume::MAX_WAKENETS; i++) {
+        FastResume::WakeNetCost saved;
+        if (fast_resume.wakeNetCost(i, &saved)) {
+            front_end->presetWakeNetCost(i, saved.model, {saved.permille, saved.detect_avg_us, saved.detect_max_us});
         }
-        if (ws_client->isConnected()) {
-            ESP_LOGI(TAG, "✅ WebSocket连接成功，准备就绪");
+    }
+    front_end->init(models, 16000, wake_settings);
+    for (int i = 0; i < FastResume::MAX_WAKENETS; i++) {
+        const AudioFrontEnd::WakeNetCost& cost = front_end->wakeWordCost(i);
+        if (front_end->wakeWordModel(i) && cost.detect_avg_us > 0) {
+            fast_resume.setWakeNetCost(i, front_end->wakeWordModel(i), cost.permille, cost.detect_avg_us,
+                                       cost.detect_max_us);
+        }
+    }
+    // 🔇 没有回声消除时播放期间不上传，麦克风里只有喇叭的声音
+    audio_manager->set_half_duplex(HALF_DUPLEX_MODE == 2 || (HALF_DUPLEX_MODE == 1 && !front_end->hasAec()));
+    front_end->setWakeCallback([](int wake_word_index, uint32_t wake_samples) {
+        // 在fetch任务中执行，只通知主循环，连接和提示音都在主任务里处理
+        audio_manager->mark_wake_word_end(wake_samples);
+        latency_trace.beginTurn();
+        latency_trace.mark(TracePoint::WAKE);
+        turn_cost.begin(ws_write_us());
+        s_wake_detected = true;
+        xTaskNotifyGive(main_task_handle);
+    });
+    front_end->setAudioCallback([](const int16_t* samples, size_t count, bool is_speech) {
+        local_commands.feed(samples, count);    // 未arm时直接返回
+        audio_manager->feed_capture_audio(samples, count, is_speech);
+    });
+#if LOCAL_COMMAND_ENABLE
+    if (local_commands.init(models, runtime_config.get(RuntimeParam::COMMAND_MS)) == ESP_OK) {
+        local_commands.setResultCallback([](LocalCommands::Intent intent, float prob, const char* text) {
+            // 不通知主任务：主循环的通知只用于唤醒，这里由10ms轮询取走
+            s_local_prob = prob;
+            s_local_text = text;
+            s_local_result = (int)intent;
+        });
+    }
+#endif
+    // 播放任务写入I2S的数据同时作为回声消除的参考信号
+    audio_manager->set_playback_tap([](const int16_t* samples, size_t count) {
+        front_end->feedReference(samples, count);
+        loopback_cal.feedReference(samples, count);
+    });
+#if LOOPBACK_CAL_ENABLE
+    // 🔊 这个DMA配置标定过就直接用，没有时等空闲了播一次扫频
+    if (loopback_cal.init() == ESP_OK) {
+        uint32_t delay_us = 0;
+        if (loopback_cal.load(&delay_us) == ESP_OK) {
+            front_end->setEchoDelayMs(delay_us / 1000);
+            latency_trace.setSpeakerDelayMs((int32_t)(delay_us / 1000));
         } else {
-            ESP_LOGW(TAG, "⚠️ WebSocket连接超时，将在唤醒时重试");
+            s_loopback_pending = true;
         }
     }
+#endif
+    audio_manager->set_playback_start_callback([]() {
+        latency_trace.mark(TracePoint::FIRST_PLAYBACK);
+    });
+    FastResume::Calibration calibration;
+    if (fast_resume.calibration(&calibration)) {
+        // 🌙 能量门底噪和播放时钟偏差接着睡前的估计，不用重新收敛
+        if (calibration.wake_gate_floor > 0) {
+            front_end->seedWakeGateFloor(calibration.wake_gate_floor);
+        }
+        audio_manager->seed_drift_ppm(calibration.drift_ppm);
+    }
+    front_end->start();
+    MemoryBudget::end(MemSubsystem::MODELS);
+    // 所有采集回调注册完后再启动采集
+    MemoryBudget::begin(MemSubsystem::BOARD);
+    bsp_capture_start(AFE_FEED_TASK_CORE, AFE_FEED_TASK_PRIORITY);
+    MemoryBudget::end(MemSubsystem::BOARD);
+    // 🩺 I2S通道和WebSocket卡住时只重建那一部分，模型和WiFi不动
+    Supervisor::watch(Watch::CAPTURE, "采集", SUPERVISOR_CAPTURE_TIMEOUT_MS,
+                      [](void*) { return bsp_capture_restart(); }, nullptr);
+    Supervisor::watch(Watch::PLAYBACK, "播放", SUPERVISOR_PLAYBACK_TIMEOUT_MS,
+                      [](void* ctx) { return static_cast<AudioManager*>(ctx)->recover_playback(); }, audio_manager);
+    Supervisor::watch(Watch::WS_SEND, "WebSocket发送", SUPERVISOR_WS_TIMEOUT_MS,
+                      [](void* ctx) { return static_cast<WebSocketClient*>(ctx)->restart(); }, ws_client);
+    Supervisor::start();
+    boot_timeline.mark(BootStage::WAKE_READY);
+    ESP_LOGI(TAG, "⏱️ 上电到唤醒就绪: %ld ms", (long)boot_timeline.ms(BootStage::WAKE_READY));
+    fast_resume.noteWakeReady(boot_timeline.ms(BootStage::WAKE_READY));
+#if BUFFER_PLACEMENT_REPORT
+    BufferPlacement::logReport();
+#endif
+    // 音频前端和回调都就绪了，网络任务可以连服务器（连接事件和下行消息要用到它们）
+    xTaskNotifyGive(network_task_handle);
 
-    // 初始化音频管理器
-    audio_manager = new AudioManager(16000, 10, 32);
-
-    // 初始化音频发送队列
-    s_audio_send_queue = xQueueCreate(20, sizeof(AudioQueueItem));
-
-    // 创建音频录制任务
-    xTaskCreate(AudioManager::audio_record_task, "audio_record_task", 4 * 1024, audio_manager, 5, NULL);
-
-    // 加载唤醒词模型
-    ESP_LOGI(TAG, "正在初始化唤醒词检测...");
-    srmodel_list_t *models = esp_srmodel_init("model");
-    char *model_name = esp_srmodel_filter(models, ESP_WN_PREFIX, NULL);
-    const esp_wn_iface_t *wakenet = esp_wn_handle_from_name(model_name);
-    
-    if (wakenet && model_name) {
-        ESP_LOGI(TAG, "✅ 唤醒词模型加载成功: %s", model_name);
-        char *wake_word = esp_wn_wakeword_from_name(model_name);
+    if (front_end->hasWakeWord()) {
+        ESP_LOGI(TAG, "✅ 唤醒词模型加载成功: %s", front_end->wakeWordModel());
+        char *wake_word = esp_wn_wakeword_from_name(front_end->wakeWordModel());
         if (wake_word) {
             ESP_LOGI(TAG, "✅ 支持的唤醒词: %s", wake_word);
         }
     } else {
-        ESP_LOGW(TAG, "⚠️ 唤醒词模型未找到，使用测试模式");
-        wakenet = nullptr;
+        ESP_LOGW(TAG, "⚠️ 唤醒词模型未找到，%s", SOAK_TEST ? "浸泡测试自动唤醒" : "只能按键唤醒");
     }
-    
+
     ESP_LOGI(TAG, "系统初始化完成，等待唤醒...");
     ESP_LOGI(TAG, "💡 调试信息:");
     ESP_LOGI(TAG, "   - WiFi SSID: %s", CONFIG_EXAMPLE_WIFI_SSID);
     ESP_LOGI(TAG, "   - WebSocket URI: %s", CONFIG_EXAMPLE_WEBSOCKET_URI);
-    ESP_LOGI(TAG, "   - 自动唤醒间隔: 30秒（仅用于测试）");
+    if (SOAK_TEST) {
+        ESP_LOGI(TAG, "   - 🔥 浸泡测试: 每%d~%d秒自动唤醒（需要中继开RELAY_SOAK_PROFILE）", SOAK_WAKE_INTERVAL_MS / 1000,
+                 (SOAK_WAKE_INTERVAL_MS + SOAK_WAKE_JITTER_MS) / 1000);
+        soak_test.start();
+    }
     ESP_LOGI(TAG, "   - 如需修改配置，请编辑 main/project_config.h");
 
-    // 主循环 - 支持真正的唤醒词检测
-    model_iface_data_t *model_data = nullptr;
-    int16_t *audio_buffer = nullptr;
-    int audio_chunksize = 0;
-    
-    // 初始化唤醒词检测模型
-    if (wakenet) {
-        model_data = wakenet->create(model_name, DET_MODE_90);
-        if (model_data) {
-            audio_chunksize = wakenet->get_samp_chunksize(model_data);
-            audio_buffer = (int16_t*)malloc(audio_chunksize * sizeof(int16_t));
-            ESP_LOGI(TAG, "✅ 唤醒词检测初始化成功，缓冲区大小: %d", audio_chunksize);
-        }
-    }
-    
+    // 主循环 - 等待音频前端的唤醒通知（每10ms检查一次状态）
     while (true) {
+        // 会话期间暂停唤醒词检测，把CPU留给编码和网络
+        front_end->setWakeWordEnabled(kWakeWordActive && current_state == SpeechState::IDLE &&
+                                      !net_self_test->isRunning());
+        if (s_network_ready) {
+            power_policy.setActive(current_state != SpeechState::IDLE);
+        }
+        wifi_manager->setBusy(current_state != SpeechState::IDLE);
+        FlashScheduler::setIdle(current_state == SpeechState::IDLE && !audio_manager->is_playing());
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10));
+        bool woke = s_wake_detected.exchange(false);
+        if (woke) {
+            upload_scheduler.onWake(esp_timer_get_time());
+        }
+        upload_scheduler.setSessionActive(current_state != SpeechState::IDLE);
+        ws_client->setBulkPaused(upload_scheduler.paused(esp_timer_get_time()));
+        if (current_state != SpeechState::IDLE || audio_manager->is_playing()) {
+            turn_cost.notePeaks(audio_manager->get_unplayed_samples() * AUDIO_FRAME_MS / AUDIO_FRAME_SAMPLES,
+                                WS_SEND_AUDIO_SLOTS - ws_client->sendQueueSpace(WebSocketClient::SendLane::AUDIO),
+                                uxQueueMessagesWaiting(s_audio_send_queue));
+        }
+        handle_push_to_talk();
+#if SOAK_TEST
+        handle_soak_test();
+#endif
+#if REPLY_REPEAT_GPIO >= 0
+        handle_repeat_button();
+#endif
+        report_downlink_credit();
+        report_perf_stats();
+        report_perf_history();
+        report_flight_record();
+        report_session_capture();
+        report_sched_trace();
+        apply_wake_config();
+        apply_runtime_config();
+        apply_ota_request();
+        report_ota_status();
+        apply_media_request();
+        report_media_status();
+        apply_asset_play();
+        apply_net_test();
+        apply_loopback_cal();
+        FlashScheduler::poll();
+        if (s_firmware_confirm.exchange(false)) {
+            ota_updater.confirm();
+        }
+        handle_server_busy();
+        handle_wake_rejected();
+        ota_updater.setPaused(current_state != SpeechState::IDLE);
+        media_stream.setHold(current_state != SpeechState::IDLE);
+        maybe_deep_sleep();
+        maybe_warm_up();
+        update_thinking_filler();
+#if UPLINK_LIGHT_NS
+        audio_manager->set_light_ns(UPLINK_LIGHT_NS == 2 || !front_end->nsActive());
+#endif
+
         if (current_state == SpeechState::IDLE) {
-            if (wakenet && model_data && audio_buffer) {
-                // 真正的唤醒词检测
-                esp_err_t ret = bsp_get_feed_data(false, audio_buffer, audio_chunksize * sizeof(int16_t));
-                if (ret == ESP_OK) {
-                    wakenet_state_t wake_state = wakenet->detect(model_data, audio_buffer);
-                    if (wake_state == WAKENET_DETECTED) {
-                        current_state = SpeechState::SESSION_ACTIVE;
-                        ESP_LOGI(TAG, "🎉 检测到唤醒词！");
-                        
-                        // 停止可能存在的录音任务
-                        audio_manager->stop_recording();
-                        
-                        // 确保WebSocket连接
-                        if (!ws_client->isConnected()) {
-                            ESP_LOGI(TAG, "WebSocket未连接，正在重新连接...");
-                            ws_client->disconnect();  // 清理可能存在的旧连接
-                            vTaskDelay(pdMS_TO_TICKS(100));
-                            esp_err_t conn_ret = ws_client->connect();
-                            
-                            if (conn_ret != ESP_OK) {
-                                ESP_LOGE(TAG, "❌ WebSocket连接初始化失败: %s", esp_err_to_name(conn_ret));
-                            } else {
-                                // 等待连接建立，增加等待时间
-                                int connect_retry = 0;
-                                while (!ws_client->isConnected() && connect_retry < 50) {  // 等待最多5秒
-                                    vTaskDelay(pdMS_TO_TICKS(100));
-                                    connect_retry++;
-                                }
-                            }
-                        }
-                        
-                        if (ws_client->isConnected()) {
-                            audio_manager->play_audio(hi_mp3, hi_mp3_len);
-                            vTaskDelay(pdMS_TO_TICKS(500)); // 等待提示音播放完成
-                            audio_manager->start_recording();
-                            audio_manager->start_streaming_playback();
-                        } else {
-                            ESP_LOGE(TAG, "❌ WebSocket连接失败，返回空闲状态");
-                            current_state = SpeechState::IDLE;
-                        }
-                    }
-                }
-            } else {
-                // 备用测试模式 - 每30秒自动唤醒
-                wake_up_counter++;
-                if (wake_up_counter >= 3000 && !wake_up_triggered) { // 30秒 (3000 * 10ms)
-                    wake_up_triggered = true;
-                    current_state = SpeechState::SESSION_ACTIVE;
-                    ESP_LOGI(TAG, "🎉 测试模式自动唤醒！");
+#if MODEL_RESIDENCY == MODEL_RESIDENCY_PSRAM_DEFERRED
+            // 权重拷完了，趁空闲让AFE改用PSRAM里的副本
+            if (!woke && model_loader.takePsramSwitch()) {
+                front_end->requestRebuild();
+            }
+#endif
+            // 🛡️ 实时系数保护改了AEC尾长，趁空闲重建AFE
+            if (!woke && front_end->aecTailPending()) {
+                front_end->requestRebuild();
+            }
+            if (front_end->hasWakeWord()) {
+                if (woke) {
+                    ESP_LOGI(TAG, "🎉 检测到唤醒词！");
+                    power_policy.setActive(true);   // 连接服务器之前就切到会话策略
                     
-                    // 确保WebSocket连接
-                    if (!ws_client->isConnected()) {
-                        ESP_LOGI(TAG, "WebSocket未连接，正在重新连接...");
-                        ws_client->disconnect();  // 清理可能存在的旧连接
-                        vTaskDelay(pdMS_TO_TICKS(100));
-                        ws_client->connect();
-                        
-                        // 等待连接建立，但不要等太久
-                        int connect_retry = 0;
-                        while (!ws_client->isConnected() && connect_retry < 30) {
-                            vTaskDelay(pdMS_TO_TICKS(100));
-                            connect_retry++;
-                        }
-                    }
+                    // 停止可能存在的录音任务
+                    audio_manager->stop_recording();
                     
-                    if (ws_client->isConnected()) {
-                        audio_manager->play_audio(hi_mp3, hi_mp3_len);
-                        vTaskDelay(pdMS_TO_TICKS(500)); // 等待提示音播放完成
-                        audio_manager->start_recording();
-                        audio_manager->start_streaming_playback();
+                    if (local_commands.isAvailable()) {
+                        // 📍 先在本地听命令词，这段时间的音频继续进会话预录，没命中时再补发
+                        s_local_result = -1;
+                        s_local_armed_us = esp_timer_get_time();
+                        local_commands.arm();
+                        current_state = SpeechState::LOCAL_COMMAND;
+                        play_greeting();
                     } else {
-                        ESP_LOGE(TAG, "❌ WebSocket连接失败，返回空闲状态");
-                        current_state = SpeechState::IDLE;
-                        wake_up_triggered = false;
-                        wake_up_counter = 0;
+                        current_state = SpeechState::SESSION_ACTIVE;
+                        if (start_cloud_session(5000)) {
+                            play_greeting();
+                        }
                     }
                 }
             }
-        }
-
-        // 检查音频队列并发送
-        AudioQueueItem item;
-        if (xQueueReceive(s_audio_send_queue, &item, 0) == pdTRUE) {
-            if (ws_client->isConnected()) {
-                int sent = ws_client->sendBinary(item.data, item.len);
-                if (sent < 0) {
-                    ESP_LOGW(TAG, "⚠️ 发送音频数据失败");
+        } else if (current_state == SpeechState::LOCAL_COMMAND) {
+            int result = s_local_result.exchange(-1);
+            if (result >= 0) {
+                handle_local_command((LocalCommands::Intent)result);
+            }
+        } else if (session_reconnect_pending.exchange(false)) {
+            // 🔄 会话期间连接断开，等待重连一次
+            ESP_LOGI(TAG, "🔄 会话期间连接断开，尝试重连...");
+            vTaskDelay(pdMS_TO_TICKS(1000));
+            if (ensure_ws_connected(5000)) {
+                ESP_LOGI(TAG, "✅ 重连成功，继续会话");
+                audio_manager->start_recording();
+                if (!s_playback_resumed.exchange(false)) {
+                    audio_manager->start_streaming_playback();
                 }
             } else {
-                ESP_LOGW(TAG, "⚠️ WebSocket未连接，丢弃音频数据");
+                ESP_LOGE(TAG, "❌ 重连失败，返回空闲状态");
+                local_tts.speak(LOCAL_TTS_TEXT_OFFLINE);
+                conversation.end();
+                current_state = SpeechState::IDLE;
+                audio_manager->stop_recording();
             }
-            free(item.data); // 释放内存
+        } else if (conversation.update(esp_timer_get_time(), audio_manager->is_user_speaking(),
+                                       audio_manager->is_playing())) {
+            // 💤 唤醒后或上一轮回复播完后没人说话：释放豆包会话，WebSocket保持连接
+            end_cloud_session();
         }
+    }
+}
 
-        vTaskDelay(pdMS_TO_TICKS(10));
+/**
+ * @brief 向服务器上报下行额度（已收到字节数 + 抖动缓冲区剩余字节数）
+ *
+ * 服务器按额度尽快发送，不再固定间隔。额度变化不到DOWNLINK_CREDIT_STEP_BYTES时不发，
+ * 空闲时缓冲区不变化，也就不产生消息。
+ */
+static void report_downlink_credit() {
+    static uint32_t last_limit = 0;
+    if (!ws_client->isConnected()) {
+        last_limit = 0;     // 重连后计数从0开始，第一时间上报
+        return;
+    }
+    uint32_t received = 0;
+    uint32_t free_bytes = 0;
+    audio_manager->get_downlink_credit(&received, &free_bytes);
+    uint32_t limit = received + free_bytes;
+    if (last_limit != 0 && limit - last_limit < DOWNLINK_CREDIT_STEP_BYTES) {
+        return;
+    }
+    int sent;
+    if (ws_client->binaryControl()) {
+        ControlProtocol::CreditPayload credit = { received, free_bytes };
+        sent = ws_client->sendControl(ControlProtocol::Type::CREDIT, &credit, sizeof(credit), 100);
+    } else {
+        JsonMessage<64> msg("credit");
+        msg.num("recv", received).num("free", free_bytes);
+        sent = ws_client->sendText(msg.finish(), 100);
+    }
+    if (sent >= 0) {
+        last_limit = limit;
     }
 }
 
+#if SCOPE_TIMERS
 /**
- * @brief WebSocket事件回调
+ * @brief ⏱️ 作用域计时直方图（SCOPE_TIMERS构建），跟着每次stats上报
  */
-void on_websocket_event(const WebSocketClient::EventData& event) {
-    switch (event.type) {
-        case WebSocketClient::EventType::CONNECTED:
-            ESP_LOGI(TAG, "🔗 WebSocket已连接");
-            break;
-        case WebSocketClient::EventType::DISCONNECTED:
-            ESP_LOGI(TAG, "🔌 WebSocket已断开");
-            if (audio_manager) {
-                audio_manager->stop_recording();
-                audio_manager->stop_streaming_playback();
-            }
-            
-            // 如果是在会话活跃状态下断开，尝试重连一次
-            if (current_state == SpeechState::SESSION_ACTIVE) {
-                ESP_LOGI(TAG, "🔄 会话期间连接断开，尝试重连...");
-                vTaskDelay(pdMS_TO_TICKS(1000)); // 等待1秒后重试
-                ws_client->disconnect();  // 确保清理旧连接
-                vTaskDelay(pdMS_TO_TICKS(100));
-                esp_err_t conn_ret = ws_client->connect();
-                
-                if (conn_ret != ESP_OK) {
-                    ESP_LOGE(TAG, "❌ WebSocket重连初始化失败: %s", esp_err_to_name(conn_ret));
-                } else {
-                    // 等待重连结果
-                    int reconnect_retry = 0;
-                    while (!ws_client->isConnected() && reconnect_retry < 50) {  // 等待最多5秒
-                        vTaskDelay(pdMS_TO_TICKS(100));
-                        reconnect_retry++;
-                    }
-                }
-                
-                if (!ws_client->isConnected()) {
-                    ESP_LOGE(TAG, "❌ 重连失败，返回空闲状态");
-                    current_state = SpeechState::IDLE;
-                    wake_up_triggered = false;
-                    wake_up_counter = 0;
-                    // 停止录音
-                    audio_manager->stop_recording();
-                } else {
-                    ESP_LOGI(TAG, "✅ 重连成功，继续会话");
-                    // 重新开始录音和播放
-                    audio_manager->start_recording();
-                    audio_manager->start_streaming_playback();
-                }
-            } else {
-                current_state = SpeechState::IDLE;
-                ESP_LOGI(TAG, "重置状态为空闲");
-                wake_up_triggered = false;
-                wake_up_counter = 0;
-                // 停止录音
-                audio_manager->stop_recording();
-            }
-            break;
-        case WebSocketClient::EventType::ERROR:
-            ESP_LOGE(TAG, "❌ WebSocket错误");
-            break;
-        case WebSocketClient::EventType::DATA_BINARY:
-            if (audio_manager) {
-                audio_manager->feed_streaming_audio(event.data, event.data_len);
-            }
-            break;
-        case WebSocketClient::EventType::DATA_TEXT:
-            ESP_LOGI(TAG, "💬 收到WebSocket文本数据: %s", (char*)event.data);
-            // 🔇 检测是否是明确的TTS结束信号
-            if (strstr((char*)event.data, "\"type\":\"tts_end\"")) {
-                ESP_LOGI(TAG, "🔇 检测到TTS结束信号，调用千问方法结束播放");
-                if (audio_manager) {
-                    ESP_LOGI(TAG, "🎬 调用finish_streaming_playback()结束流式播放...");
-                    // 增加一个小延迟确保所有音频数据处理完成
-                    vTaskDelay(pdMS_TO_TICKS(50));
-                    audio_manager->finish_streaming_playback();
-                    ESP_LOGI(TAG, "✅ 流式播放已结束");
-                }
+static void report_scope_timers(WebSocketClient::SendLane lane) {
+    static char msg[1280];     // 8个计时点×16个桶，只在主任务中使用
+    size_t len = ScopeTimers::formatJson(msg, sizeof(msg));
+    if (len > 0 && ws_client->sendText(msg, 100, lane) > 0 && lane == WebSocketClient::SendLane::BULK) {
+        upload_scheduler.charge(len);
+    }
+}
+#endif
+
+/**
+ * @brief 📈 向服务器上报性能计数器（每stats_ms一次，默认PERF_REPORT_INTERVAL_MS，服务器请求时立即发送）
+ */
+static void report_perf_stats() {
+    static int64_t last_report_us = 0;
+    int64_t now = esp_timer_get_time();
+    bool requested = s_stats_requested.exchange(false);
+    if (!requested && now - last_report_us < (int64_t)runtime_config.get(RuntimeParam::STATS_MS) * 1000) {
+        return;
+    }
+    if (!ws_client->isConnected()) {
+        return;
+    }
+    // 🚚 定时上报是维护流量：走后台通道，限速或唤醒暂停时留到下一轮；服务器主动请求的照常走控制通道
+    if (!requested && !upload_scheduler.ready(now)) {
+        return;
+    }
+    const WebSocketClient::SendLane lane = requested ? WebSocketClient::SendLane::CONTROL
+                                                     : WebSocketClient::SendLane::BULK;
+#if SCOPE_TIMERS
+    report_scope_timers(lane);
+#endif
+    // 定时上报走二进制控制帧：只有计数器和内存；服务器主动请求时回复带任务CPU占用的完整JSON
+    if (!requested && ws_client->binaryControl()) {
+        uint32_t values[96];
+        size_t count = PerfCounters::formatBinary(values, sizeof(values) / sizeof(values[0]));
+        if (count > 0) {
+            int sent = ws_client->sendControl(ControlProtocol::Type::STATS, values, count * sizeof(uint32_t), 100, lane);
+            if (sent > 0) {
+                upload_scheduler.charge(sent);
             }
+        }
+        last_report_us = now;
+        return;
+    }
+    static char msg[2048];     // 只在主任务中使用，放在静态区不占栈（计数器和任务占用加起来超过1KB）
+    if (PerfCounters::formatJson(msg, sizeof(msg)) == 0) {
+        ESP_LOGW(TAG, "⚠️ 性能统计超出缓冲区");
+    } else {
+        int sent = ws_client->sendText(msg, 100, lane);
+        if (sent > 0 && !requested) {
+            upload_scheduler.charge(sent);
+        }
+    }
+    // 🧱 调试构建里服务器请求时附带分配点统计（HEAP_MONITOR_SITES）
+    if (requested && HeapMonitor::formatSites(msg, sizeof(msg)) > 0) {
+        ws_client->sendText(msg, 100);
+    }
+    last_report_us = now;
+}
+
+/**
+ * @brief 🗄️ hello确认后上报跨重启的性能累计，空闲时按间隔存进NVS
+ */
+static void report_perf_history() {
+    perf_history.maybeSave(current_state == SpeechState::IDLE && !audio_manager->is_playing() &&
+                           !ota_updater.isDownloading());
+    if (!s_history_pending || !ws_client->isConnected() || !upload_scheduler.ready(esp_timer_get_time())) {
+        return;
+    }
+    s_history_pending = false;
+    char msg[384];
+    if (perf_history.formatReport(msg, sizeof(msg)) > 0) {
+        int sent = ws_client->sendText(msg, 100, WebSocketClient::SendLane::BULK);
+        if (sent > 0) {
+            upload_scheduler.charge(sent);
+        }
+    }
+}
+
+/**
+ * @brief 🛩️ 主循环心跳记进黑匣子；hello确认后把复位前的记录分批发给服务器
+ */
+static void report_flight_record() {
+    static int64_t last_tick_us = 0;
+    int64_t now = esp_timer_get_time();
+    if (now - last_tick_us >= (int64_t)FLIGHT_RECORDER_TICK_MS * 1000) {
+        last_tick_us = now;
+        UBaseType_t depth = uxQueueMessagesWaiting(s_audio_send_queue);
+        FLIGHT_RECORD(TICK, heap_caps_get_free_size(MALLOC_CAP_INTERNAL) / 1024, (uint8_t)(depth > 127 ? 127 : depth));
+    }
+    if (!s_flight_upload || !ws_client->isConnected()) {
+        return;
+    }
+    if (!ws_client->binaryControl()) {
+        ESP_LOGW(TAG, "⚠️ 服务器没有同意二进制控制帧，黑匣子记录留到下次连接再传");
+        s_flight_upload = false;
+        return;
+    }
+    // 每轮最多发两批，不把后台通道占满；限速或唤醒暂停时留到下一轮
+    uint8_t batch[FlightRecorder::MAX_BATCH_BYTES];
+    for (int i = 0; i < 2 && upload_scheduler.ready(now); i++) {
+        size_t len = FlightRecorder::takeBatch(batch);
+        if (len == 0) {
+            s_flight_upload = false;
+            ESP_LOGI(TAG, "🛩️ 黑匣子记录已上传");
             break;
-        case WebSocketClient::EventType::PING:
-            ESP_LOGI(TAG, "收到WebSocket ping");
+        }
+        int sent = ws_client->sendControl(ControlProtocol::Type::FLIGHT_RECORD, batch, len, 100,
+                                          WebSocketClient::SendLane::BULK);
+        if (sent < 0) {
+            FlightRecorder::rewind();   // 下次hello之后整份重发
+            s_flight_upload = false;
             break;
-        case WebSocketClient::EventType::PONG:
-            ESP_LOGI(TAG, "收到WebSocket pong");
+        }
+        upload_scheduler.charge(sent);
+    }
+}
+
+/**
+ * @brief 🎙️ 把攒下的设备端时间戳发给服务器（只在服务器录制会话时打开）
+ */
+static void report_session_capture() {
+    if (!session_capture.isEnabled() || !ws_client->isConnected()) {
+        return;
+    }
+    uint8_t batch[SessionCapture::MAX_BATCH_BYTES];
+    size_t len = session_capture.takeBatch(batch, SESSION_CAPTURE_FLUSH_MS);
+    if (len > 0) {
+        ws_client->sendControl(ControlProtocol::Type::CAPTURE, batch, len, 100);
+    }
+}
+
+/**
+ * @brief 🔬 把调度追踪的任务表和事件发给服务器（只有SCHED_TRACE_MODE=2并且服务器开了记录窗口时才有数据）
+ */
+static void report_sched_trace() {
+    if (SCHED_TRACE_MODE != 2 || !ws_client->isConnected() || !ws_client->binaryControl()) {
+        return;
+    }
+    static char tasks[512];     // 只在主任务中使用
+    if (SchedTrace::formatTasks(tasks, sizeof(tasks)) > 0) {
+        ws_client->sendText(tasks, 100);
+    }
+    // 每轮最多发两批：追踪本身不能把控制通道占满
+    uint8_t batch[SchedTrace::MAX_BATCH_BYTES];
+    for (int i = 0; i < 2; i++) {
+        size_t len = SchedTrace::takeBatch(batch);
+        if (len == 0) {
             break;
+        }
+        ws_client->sendControl(ControlProtocol::Type::SCHED_TRACE, batch, len, 100);
+    }
+}
+
+/**
+ * @brief 在紧凑JSON中查找数字字段（key含引号和冒号，如"\"mode\":"）
+ */
+static bool json_number(std::string_view text, const char* key, float* out) {
+    size_t pos = text.find(key);
+    if (pos == std::string_view::npos) {
+        return false;
+    }
+    char* end = nullptr;
+    const char* start = text.data() + pos + strlen(key);
+    float value = strtof(start, &end);
+    if (end == start) {
+        return false;
+    }
+    *out = value;
+    return true;
+}
+
+/**
+ * @brief 在紧凑JSON中查找字符串字段，超长时截断
+ */
+static bool json_string(std::string_view text, const char* key, char* out, size_t size) {
+    size_t pos = text.find(key);
+    if (pos == std::string_view::npos) {
+        return false;
+    }
+    std::string_view value = text.substr(pos + strlen(key));
+    if (value.empty() || value[0] != '"') {
+        return false;
+    }
+    value = value.substr(1, value.find('"', 1) - 1);
+    size_t len = std::min(value.size(), size - 1);
+    memcpy(out, value.data(), len);
+    out[len] = '\0';
+    return true;
+}
+
+/**
+ * @brief 🎯 处理服务器下发的唤醒词参数（见wake_settings.h），回复当前生效的参数和各模型CPU占用
+ *
+ * 阈值立即生效；模式和模型写进NVS，下次启动创建AFE时生效。
+ */
+static void apply_wake_config() {
+    if (!s_wake_config_pending.load()) {
+        return;
+    }
+    std::string_view text(s_wake_config);
+    WakeSettings next = wake_settings;
+    float value = 0;
+    if (json_number(text, "\"threshold\":", &value) && WakeSettings::validThreshold(value)) {
+        next.threshold[0] = value;
+    }
+    if (json_number(text, "\"threshold2\":", &value) && WakeSettings::validThreshold(value)) {
+        next.threshold[1] = value;
+    }
+    if (json_number(text, "\"mode\":", &value)) {
+        next.mode = value >= 95 ? DET_MODE_95 : DET_MODE_90;
+    }
+    json_string(text, "\"model\":", next.model[0], sizeof(next.model[0]));
+    json_string(text, "\"model2\":", next.model[1], sizeof(next.model[1]));
+    s_wake_config_pending = false;
+
+    for (int i = 0; i < WakeSettings::MAX_MODELS; i++) {
+        if (next.threshold[i] != wake_settings.threshold[i]) {
+            front_end->setWakeThreshold(i, next.threshold[i]);
+        }
+    }
+    bool restart_required = next.mode != wake_settings.mode ||
+                            strcmp(next.model[0], wake_settings.model[0]) != 0 ||
+                            strcmp(next.model[1], wake_settings.model[1]) != 0;
+    wake_settings = next;
+    // 新阈值已经生效，写NVS等空闲时再做（会话期间写Flash会让采集和播放停顿）
+    esp_err_t saved = FlashScheduler::defer("wake_settings", [](void* ctx) {
+        return ((const WakeSettings*)ctx)->save();
+    }, &wake_settings);
+    ESP_LOGI(TAG, "🎯 唤醒词参数已更新%s", restart_required ? "（模式/模型下次启动生效）" : "");
+
+    char reply[384];
+    int len = snprintf(reply, sizeof(reply),
+                       "{\"type\":\"wake_config\",\"mode\":%d,\"saved\":%s,\"restart_required\":%s,\"models\":[",
+                       wake_settings.modePercent(), saved == ESP_OK ? "true" : "false",
+                       restart_required ? "true" : "false");
+    for (int i = 0; i < WakeSettings::MAX_MODELS && len > 0 && (size_t)len < sizeof(reply); i++) {
+        const char* model = front_end->wakeWordModel(i);
+        if (!model) {
+            continue;
+        }
+        len += snprintf(reply + len, sizeof(reply) - len, "%s{\"name\":\"%s\",\"threshold\":%.4f,\"cpu\":%lu,"
+                        "\"detect_us\":%lu,\"weights\":\"%s\"}",
+                        i == 0 ? "" : ",", model, wake_settings.threshold[i],
+                        (unsigned long)front_end->wakeWordCostPermille(i),
+                        (unsigned long)front_end->wakeWordDetectUs(i), front_end->wakeWordWeights(i));
+    }
+    if (len > 0 && (size_t)len + 2 < sizeof(reply)) {
+        memcpy(reply + len, "]}", 3);
+        ws_client->sendText(reply, 100);
+    }
+}
+
+/**
+ * @brief 🎚️ 处理服务器下发的运行时参数（见runtime_config.h），回复当前生效的全部参数
+ *
+ * 超出范围的参数忽略；重连退避或心跳的组合不成立时整条消息都不生效。
+ */
+static void apply_runtime_config() {
+    if (!s_runtime_config_pending.load()) {
+        return;
+    }
+    std::string_view text(s_runtime_config);
+    RuntimeConfig next = runtime_config;
+    char rejected[160] = "";
+    size_t rejected_len = 0;
+    for (size_t i = 0; i < (size_t)RuntimeParam::COUNT; i++) {
+        const RuntimeConfig::Field& field = RuntimeConfig::field((RuntimeParam)i);
+        char key[24];
+        snprintf(key, sizeof(key), "\"%s\":", field.name);
+        float value = 0;
+        if (json_number(text, key, &value) && !(value >= 0.0f && next.set((RuntimeParam)i, (uint32_t)value))) {
+            rejected_len += snprintf(rejected + rejected_len, sizeof(rejected) - rejected_len, "%s\"%s\"",
+                                     rejected_len ? "," : "", field.name);
+            rejected_len = std::min(rejected_len, sizeof(rejected) - 1);
+        }
+    }
+    json_string(text, "\"experiment\":", next.experiment, sizeof(next.experiment));
+    s_runtime_config_pending = false;
+
+    bool accepted = next.consistent();
+    bool restart_required = false;
+    esp_err_t saved = ESP_FAIL;
+    if (accepted) {
+        for (size_t i = 0; i < (size_t)RuntimeParam::COUNT; i++) {
+            restart_required |= RuntimeConfig::field((RuntimeParam)i).next_boot && next.value[i] != runtime_config.value[i];
+        }
+        audio_manager->set_prebuffer_ms(next.get(RuntimeParam::PREBUFFER_MS));
+        s_uplink_delay_cap_ms = next.get(RuntimeParam::UPLINK_DELAY_MS);
+        s_uplink_delay_ms = std::min(s_uplink_delay_ms.load(), s_uplink_delay_cap_ms.load());
+        conversation.setTimeouts(next.get(RuntimeParam::FOLLOW_UP_MS), next.get(RuntimeParam::IDLE_TIMEOUT_MS));
+        ws_client->setReconnectBackoff((int)next.get(RuntimeParam::BACKOFF_MS), (int)next.get(RuntimeParam::BACKOFF_MAX_MS));
+        ws_client->setHeartbeat((int)next.get(RuntimeParam::HEARTBEAT_MS), (int)next.get(RuntimeParam::HEARTBEAT_TIMEOUT_MS));
+        runtime_config = next;
+        saved = FlashScheduler::defer("runtime_config", [](void* ctx) {
+            return ((const RuntimeConfig*)ctx)->save();
+        }, &runtime_config);
+        ESP_LOGI(TAG, "🎚️ 运行时参数已更新, 实验组='%s'%s", runtime_config.experiment,
+                 restart_required ? "（部分参数下次启动生效）" : "");
+    } else {
+        ESP_LOGW(TAG, "⚠️ 运行时参数组合不成立（重连退避或心跳超时），忽略这次修改");
+    }
+
+    char reply[640];
+    int len = snprintf(reply, sizeof(reply),
+                       "{\"type\":\"runtime_config\",\"experiment\":\"%s\",\"accepted\":%s,\"saved\":%s,"
+                       "\"restart_required\":%s,\"rejected\":[%s],\"values\":{",
+                       runtime_config.experiment, accepted ? "true" : "false", saved == ESP_OK ? "true" : "false",
+                       restart_required ? "true" : "false", rejected);
+    for (size_t i = 0; i < (size_t)RuntimeParam::COUNT && len > 0 && (size_t)len < sizeof(reply); i++) {
+        len += snprintf(reply + len, sizeof(reply) - len, "%s\"%s\":%lu", i == 0 ? "" : ",",
+                        RuntimeConfig::field((RuntimeParam)i).name, (unsigned long)runtime_config.value[i]);
+    }
+    if (len > 0 && (size_t)len + 2 < sizeof(reply)) {
+        memcpy(reply + len, "}}", 3);
+        ws_client->sendText(reply, 100);
+    }
+}
+
+/**
+ * @brief 📦 处理服务器的升级请求：{"type":"ota","url":...,"sha256":...}开始下载，{"action":"rollback"}退回上一个固件
+ */
+static void apply_ota_request() {
+    if (!s_ota_request_pending.load()) {
+        return;
+    }
+    std::string_view text(s_ota_request);
+    char url[OtaUpdater::URL_LEN] = "";
+    char sha256[72] = "";
+    bool rollback = text.find("\"action\":\"rollback\"") != std::string_view::npos;
+    json_string(text, "\"url\":", url, sizeof(url));
+    json_string(text, "\"sha256\":", sha256, sizeof(sha256));
+    s_ota_request_pending = false;
+
+    if (!OTA_ENABLE) {
+        ESP_LOGW(TAG, "⚠️ 固件升级已关闭（OTA_ENABLE=0），忽略服务器的升级请求");
+        return;
+    }
+    if (rollback) {
+        ota_updater.rollback();
+        return;
+    }
+    ota_updater.start(url, sha256);
+}
+
+/**
+ * @brief 📻 处理服务器的长音频控制：{"type":"media","action":"play","url":...,"offset_ms":N}，以及pause/resume/stop
+ */
+static void apply_media_request() {
+    if (!s_media_request_pending.load()) {
+        return;
+    }
+    std::string_view text(s_media_request);
+    char url[MediaStream::URL_LEN] = "";
+    float offset_ms = 0.0f;
+    json_string(text, "\"url\":", url, sizeof(url));
+    json_number(text, "\"offset_ms\":", &offset_ms);
+    bool play = text.find("\"action\":\"play\"") != std::string_view::npos;
+    bool pause = text.find("\"action\":\"pause\"") != std::string_view::npos;
+    bool resume = text.find("\"action\":\"resume\"") != std::string_view::npos;
+    s_media_request_pending = false;
+
+    if (!media_stream.isAvailable()) {
+        ESP_LOGW(TAG, "⚠️ 长音频直连不可用（MEDIA_STREAM_ENABLE=0或预取环分配失败），忽略");
+        return;
+    }
+    if (play) {
+        media_stream.play(url, offset_ms > 0 ? (uint32_t)offset_ms : 0);
+    } else if (pause) {
+        media_stream.pause();
+    } else if (resume) {
+        media_stream.resume();
+    } else {
+        media_stream.stop();
+    }
+}
+
+/**
+ * @brief 按名字找提示音：服务器推送的（见asset_cache.h）优先，再找随固件烧录的
+ */
+static const PromptAsset* find_prompt(const char* name) {
+    const PromptAsset* asset = asset_cache.find(name);
+    return asset ? asset : prompt_store.find(name);
+}
+
+/**
+ * @brief 📦 播放服务器指定的推送提示音：{"type":"play_asset","id":"<哈希>"}（会话中忽略，不打断回复）
+ */
+static void apply_asset_play() {
+    if (!s_asset_play_pending.load()) {
+        return;
+    }
+    const PromptAsset* asset = asset_cache.findById(s_asset_play);
+    s_asset_play_pending = false;
+    if (!asset) {
+        ESP_LOGW(TAG, "⚠️ 没有缓存提示音 %s（还没下载完？）", s_asset_play);
+        return;
+    }
+    if (current_state != SpeechState::IDLE) {
+        ESP_LOGI(TAG, "📦 会话中，不播放提示音 %s", asset->name);
+        return;
+    }
+    audio_manager->play_prompt_async(asset);
+}
+
+/**
+ * @brief 📻 把长音频的状态变化发给服务器（暂停/播完时带着位置，服务器据此续播）
+ */
+static void report_media_status() {
+    MediaStream::Status status;
+    if (!media_stream.takeStatus(&status) || !ws_client->isConnected()) {
+        return;
+    }
+    JsonMessage<192> msg("media_status");
+    msg.str("state", MediaStream::stateName(status.state))
+       .num("offset", status.offset)
+       .num("total", status.total)
+       .num("played_ms", status.played_ms)
+       .num("rebuffers", status.rebuffers);
+    if (status.reason[0] != '\0') {
+        msg.str("reason", status.reason);
+    }
+    ws_client->sendText(msg.finish(), 100);
+}
+
+/**
+ * @brief 🛰️ 启动服务器要求的网络自检（只在空闲时，会话中回复busy）
+ */
+static void apply_net_test() {
+    if (!s_net_test_pending.load()) {
+        return;
+    }
+    std::string_view text(s_net_test_request);
+    NetSelfTest::Params params = {};
+    params.mode = text.find("\"mode\":\"tcp\"") != std::string_view::npos ? NetSelfTest::Mode::TCP
+                                                                          : NetSelfTest::Mode::WS;
+    float value = 0.0f;
+    params.duration_ms = json_number(text, "\"ms\":", &value) && value > 0 && value <= NET_TEST_MAX_MS
+                             ? (uint32_t)value : NET_TEST_DEFAULT_MS;
+    // ws模式的测试消息走上行音频通道，不能超过它的槽位
+    uint32_t max_size = params.mode == NetSelfTest::Mode::WS ? UPLINK_COALESCE_FRAMES * 640 : 4096;
+    params.size = json_number(text, "\"size\":", &value) && value > 0 ? (uint32_t)value : NET_TEST_DEFAULT_SIZE;
+    params.size = std::min(params.size, max_size);
+    params.tcp_port = json_number(text, "\"port\":", &value) && value > 0 && value < 65536 ? (uint16_t)value : 0;
+    params.need_up_kbps = audio_manager->get_uplink_codec() == UplinkCodec::OPUS ? UPLINK_OPUS_BITRATE / 1000 : 256;
+    params.wifi_profile = WiFiManager::profileName(wifi_manager->perfProfile());
+    params.dscp = json_number(text, "\"dscp\":", &value) && value >= 0 && value < 64 ? (int)value : -1;
+    s_net_test_pending = false;
+
+    const char* error = nullptr;
+    if (current_state != SpeechState::IDLE || audio_manager->is_playing()) {
+        error = "busy";
+    } else if (params.mode == NetSelfTest::Mode::TCP && params.tcp_port == 0) {
+        error = "no_port";
+    } else if (net_self_test->start(params) != ESP_OK) {
+        error = "running";
+    }
+    if (error != nullptr) {
+        ESP_LOGW(TAG, "⚠️ 网络自检没有启动: %s", error);
+        char reply[96];
+        snprintf(reply, sizeof(reply), "{\"type\":\"net_test_result\",\"error\":\"%s\"}", error);
+        ws_client->sendText(reply, 100);
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief 🔊 空闲时标定扬声器→麦克风延迟，结果用于回声消除对齐，连着服务器时把结果发过去
+ */
+static void apply_loopback_cal() {
+    if (!s_loopback_pending.load() || current_state != SpeechState::IDLE || audio_manager->is_playing() ||
+        net_self_test->isRunning()) {
+        return;
+    }
+    s_loopback_pending = false;
+    LoopbackCalibration::Result result = {};
+    esp_err_t ret = loopback_cal.run(audio_manager, &result);
+    if (ret == ESP_OK) {
+        front_end->setEchoDelayMs(result.delay_us / 1000);
+        latency_trace.setSpeakerDelayMs((int32_t)(result.delay_us / 1000));
+    }
+    if (ws_client->isConnected()) {
+        JsonMessage<160> msg("loopback_cal");
+        msg.str("profile", LoopbackCalibration::profileKey()).num("sink_us", bsp_audio_sink_latency_us());
+        if (ret == ESP_OK) {
+            msg.num("delay_us", result.delay_us).real("score", result.score, 2);
+        } else {
+            msg.str("error", esp_err_to_name(ret));
+        }
+        ws_client->sendText(msg.finish(), 100);
+    }
+}
+
+/**
+ * @brief 📦 把升级进度发给服务器，新固件就绪后在空闲时重启
+ */
+static void report_ota_status() {
+    static bool ready_reported = false;     // 先把"ready"发出去再重启
+    OtaUpdater::Status status;
+    if (!ota_updater.takeStatus(&status)) {
+        if (ready_reported && current_state == SpeechState::IDLE && !audio_manager->is_playing()) {
+            ESP_LOGI(TAG, "📦 重启进入新固件...");
+            ws_client->disconnect();
+            perf_history.save();
+            FlashScheduler::flush();
+            esp_restart();
+        }
+        return;
+    }
+    ready_reported = status.state == OtaUpdater::State::READY;
+    if (ws_client->isConnected()) {
+        char report[192];
+        snprintf(report, sizeof(report),
+                 "{\"type\":\"ota_status\",\"state\":\"%s\",\"delta\":%s,\"received\":%lu,\"total\":%lu,"
+                 "\"written\":%lu,\"reason\":\"%s\"}",
+                 OtaUpdater::stateName(status.state), status.delta ? "true" : "false",
+                 (unsigned long)status.received, (unsigned long)status.total,
+                 (unsigned long)status.written, status.reason);
+        ws_client->sendText(report, 100);
+    }
+}
+
+/**
+ * @brief 确保WebSocket已连接，必要时重新发起连接
+ *
+ * 正在握手时直接等待；重连正在退避时让它立即重试（用户在等，不必等退避结束）；
+ * 未启动时重新连接。等待基于连接事件，连上立即返回。
+ */
+static bool ensure_ws_connected(int timeout_ms) {
+    if (ws_client->isConnected()) {
+        return true;
+    }
+    if (!s_network_ready) {
+        ESP_LOGW(TAG, "⚠️ 网络还在启动，这次不连接服务器");
+        return false;
+    }
+    WebSocketClient::State state = ws_client->getState();
+    if (state == WebSocketClient::State::DISCONNECTED) {
+        ESP_LOGI(TAG, "WebSocket未连接，立即重连...");
+        ws_client->reconnectNow();
+    } else if (state == WebSocketClient::State::STOPPED) {
+        ESP_LOGI(TAG, "WebSocket未连接，正在重新连接...");
+        ws_client->disconnect();  // 清理可能存在的旧连接
+        esp_err_t conn_ret = ws_client->connect();
+        if (conn_ret != ESP_OK) {
+            ESP_LOGE(TAG, "❌ WebSocket连接初始化失败: %s", esp_err_to_name(conn_ret));
+            return false;
+        }
+    }
+    if (!ws_client->waitConnected(timeout_ms)) {
+        return false;
+    }
+    // disconnect()清理旧连接时也会触发断开事件，连上后不需要再重连
+    session_reconnect_pending = false;
+    return true;
+}
+
+/**
+ * @brief 🚀 网络启动任务
+ *
+ * WiFi关联和主任务的I2S初始化、模型加载同时进行；连服务器要等主任务的音频链路就绪。
+ * 首次连接结束（成功或超时）后置位s_network_ready，输出启动时间线后退出，
+ * 之后的断线重连由WiFiManager和WebSocketClient自己负责。
+ */
+static void network_task(void* arg) {
+    MemoryBudget::begin(MemSubsystem::WIFI);
+    esp_err_t wifi_ret = wifi_manager->connect();
+    MemoryBudget::end(MemSubsystem::WIFI);
+    if (wifi_ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ WiFi连接失败，只能离线使用（本地命令词仍然可用）");
+        while(1) {
+            vTaskDelay(pdMS_TO_TICKS(5000));
+            ESP_LOGE(TAG, "请检查WiFi配置: SSID=%s", CONFIG_EXAMPLE_WIFI_SSID);
+        }
+    }
+
+    // 检查WiFi连接状态
+    if (wifi_manager->isConnected()) {
+        ESP_LOGI(TAG, "✅ WiFi连接成功，IP地址: %s", wifi_manager->getIpAddress().c_str());
+        boot_timeline.mark(BootStage::WIFI_UP);
+    } else {
+        ESP_LOGE(TAG, "❌ WiFi连接失败");
+    }
+
+    // 📦 hello里要带固件镜像的哈希，连接前先算好（读整个镜像，几十毫秒）；深度睡眠醒来、固件没变时用睡前算好的
+    if (fast_resume.imageSha()[0] != '\0') {
+        ota_updater.seedImageSha(fast_resume.imageSha());
+    } else {
+        fast_resume.setImageSha(ota_updater.imageSha());
+    }
+
+    // 等主任务的音频链路就绪：链路回调、WebSocket事件和下行消息都要用到音频管理器和音频前端
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    MemoryBudget::begin(MemSubsystem::WIFI);
+    wifi_manager->startLinkMonitor();
+    MemoryBudget::end(MemSubsystem::WIFI);
+    // 🔋 WiFi启动后才能设置省电模式
+    power_policy.init(POWER_MAX_CPU_MHZ, POWER_IDLE_MIN_CPU_MHZ, POWER_IDLE_LIGHT_SLEEP);
+
+    // 🧭 在配置的和局域网里发现的中继之间挑建连最快的，解析好的地址直接用
+    MemoryBudget::begin(MemSubsystem::NETWORK);
+    ws_client->setUri(relay_selector->pick());
+
+    // 立即尝试连接WebSocket，避免唤醒时才连接导致音频丢失
+    ESP_LOGI(TAG, "🌐 正在连接WebSocket服务器...");
+    esp_err_t ws_ret = ws_client->connect();
+    if (ws_ret != ESP_OK) {
+        ESP_LOGW(TAG, "⚠️ 初始WebSocket连接失败，将在唤醒时重试");
+    } else {
+        // 等待连接建立（连接事件到达即返回，最多15秒）
+        if (ws_client->waitConnected(15000)) {
+            ESP_LOGI(TAG, "✅ WebSocket连接成功，准备就绪");
+            boot_timeline.mark(BootStage::SERVER_UP);
+        } else {
+            ESP_LOGW(TAG, "⚠️ WebSocket连接超时，将在唤醒时重试");
+        }
+    }
+
+    MemoryBudget::end(MemSubsystem::NETWORK);
+
+    s_network_ready = true;
+#if MODEL_RESIDENCY == MODEL_RESIDENCY_PSRAM_DEFERRED
+    // 网络已经就绪，剩下的CPU用来把模型权重拷进PSRAM（见model_loader.h）
+    model_loader.startBackgroundCopy();
+#endif
+    boot_timeline.log();
+    // 🧵 WiFi、WebSocket和音频任务都起来了，这时的内部RAM余量才是运行时能指望的
+    TaskFactory::logReport();
+#if MEM_BUDGET_REPORT
+    MemoryBudget::logReport();
+#endif
+    // 🪤 两条启动线都结束了，之后再有分配就是运行中分配
+    HeapMonitor::armTripwire();
+    if (ws_client->isConnected()) {
+        char report[192];
+        if (boot_timeline.format(report, sizeof(report)) > 0) {
+            ws_client->sendText(report, 1000);
+        }
+    }
+    vTaskDelete(NULL);
+}
+
+static void send_speech_end() {
+    if (THINKING_EARCON_ENABLE) {
+        thinking_filler.arm(esp_timer_get_time());  // 先开始计时，服务器的reply_eta紧跟着就到
+    }
+    // 🤫 让服务器立即结束本轮识别，不必等ASR的静音平滑窗口
+    ws_client->sendText("{\"type\":\"speech_end\"}", 1000);
+    latency_trace.mark(TracePoint::SPEECH_END);
+}
+
+/**
+ * @brief 📼 发出存储转发缓冲区里还没发的记录（发送任务中调用）
+ *
+ * 音频交给合包器；编码格式和当前协商结果不一致的帧（重连后换了格式）放弃。
+ * WebSocket音频发送队列快满时先停下，剩下的等发送任务腾出位置后（下一轮，最多20ms）再补。
+ * 遇到speech_end标记时冲刷合包器、通知服务器，这句话已经完整送达，从缓冲区里丢掉。
+ *
+ * @return 交给合包器的音频帧数
+ */
+static uint32_t drain_uplink_backlog(UplinkCoalescer& coalescer, UplinkBacklog& backlog) {
+    UplinkCodec codec = audio_manager->get_uplink_codec();
+    uint32_t frames = 0;
+    UplinkBacklog::Entry entry;
+    while (s_uplink_ready.load() && ws_client->sendQueueSpace(WebSocketClient::SendLane::AUDIO) > 1 &&
+           backlog.next(&entry)) {
+        if (entry.kind == UplinkBacklog::Kind::SPEECH_END) {
+            coalescer.flush();
+            send_speech_end();
+            backlog.discardSent();
+            continue;
+        }
+        if (entry.codec != codec) {
+            backlog.noteSkipped();
+            continue;
+        }
+        coalescer.push(entry.data, entry.len, entry.timestamp, entry.samples);
+        frames++;
+    }
+    return frames;
+}
+
+/**
+ * @brief 📶 把当前档位交给编码器和合包器（发送任务中调用）
+ */
+static void apply_uplink_rate(UplinkCoalescer& coalescer) {
+#if UPLINK_RATE_ADAPT_ENABLE
+    const UplinkRateController::Level& level = s_uplink_rate.level();
+    audio_manager->set_uplink_bitrate(level.bitrate);
+    coalescer.setMaxFrames(level.frames);
+#else
+    (void)coalescer;
+#endif
+}
+
+/**
+ * @brief 📶 每UPLINK_RATE_CHECK_MS按RTT和发送积压评估一次上行档位（只对Opus，发送任务中调用）
+ */
+static void adapt_uplink_rate(UplinkCoalescer& coalescer, TickType_t* next_check) {
+#if UPLINK_RATE_ADAPT_ENABLE
+    TickType_t now = xTaskGetTickCount();
+    if ((int32_t)(now - *next_check) < 0 || audio_manager->get_uplink_codec() != UplinkCodec::OPUS) {
+        return;
+    }
+    *next_check = now + pdMS_TO_TICKS(UPLINK_RATE_CHECK_MS);
+    UBaseType_t waiting = uxQueueMessagesWaiting(s_audio_send_queue);
+    uint32_t send_queue_pct = waiting * 100 / (waiting + uxQueueSpacesAvailable(s_audio_send_queue));
+    size_t ws_free = ws_client->sendQueueSpace(WebSocketClient::SendLane::AUDIO);
+    uint32_t ws_queue_pct = ws_free < WS_SEND_AUDIO_SLOTS ? (WS_SEND_AUDIO_SLOTS - ws_free) * 100 / WS_SEND_AUDIO_SLOTS : 0;
+    UplinkRateController::Sample sample = {};
+    sample.srtt_ms = s_link_srtt_ms.load();
+    sample.queue_pct = std::max(send_queue_pct, ws_queue_pct);
+    sample.send_wait_ms = ws_client->getSendStats(WebSocketClient::SendLane::AUDIO).last_wait_ms;
+    sample.loss_pct = udp_audio ? udp_audio->uplinkLossPct() : 0;
+    if (s_uplink_rate.update(sample)) {
+        apply_uplink_rate(coalescer);
+    }
+#else
+    (void)coalescer;
+    (void)next_check;
+#endif
+}
+
+/**
+ * @brief 上行音频发送任务
+ *
+ * 阻塞等待音频发送队列，一有数据就立即交给合包器，
+ * 不再受主循环唤醒词检测和10ms延迟的影响。
+ * 合包器攒够帧数或延迟预算到期时才调用sendAudio放进WebSocket发送队列。
+ *
+ * 每一帧先经过存储转发缓冲区：连接正常时立即发出并保留到这句话结束，
+ * 断开期间只存不发，重连（服务器hello确认）后从这句话开头一次补发完。
+ *
+ * 上行是Opus时按链路压力调整码率和合包帧数（见uplink_rate_controller.h），断开后回到默认档位。
+ */
+static void audio_send_task(void* arg) {
+    UplinkCoalescer coalescer(UPLINK_COALESCE_FRAMES * s_audio_frame_pool->slotSize(),
+                              UPLINK_COALESCE_MAX_DELAY_MS,
+                              [](const uint8_t* data, size_t len) {
+                                  // 📡 UDP通了之后等WebSocket音频通道排空再切过去；UDP发不出时这一条走WebSocket
+                                  s_uplink_on_udp = udp_audio && udp_audio->uplinkReady() &&
+                                                    (s_uplink_on_udp || ws_client->sendQueueSpace(
+                                                        WebSocketClient::SendLane::AUDIO) >= WS_SEND_AUDIO_SLOTS);
+                                  int sent = s_uplink_on_udp ? udp_audio->send(data, len) : -1;
+                                  if (sent < 0) {
+                                      sent = ws_client->sendAudio(data, len);
+                                  }
+                                  if (sent >= 0) {
+                                      session_capture.record(SessionCapture::Kind::UPLINK_AUDIO, len);
+                                      latency_trace.mark(TracePoint::FIRST_UPLINK);
+                                      PerfCounters::add(PerfCounter::UPLINK_MESSAGES);
+                                      PerfCounters::add(PerfCounter::UPLINK_BYTES, len);
+                                  }
+                                  return sent;
+                              });
+    UplinkBacklog backlog(s_audio_frame_pool->slotSize(), UPLINK_BACKLOG_MS / AUDIO_FRAME_MS);
+    AudioQueueItem item;
+    uint32_t delay_ms = UPLINK_COALESCE_MAX_DELAY_MS;
+    bool was_ready = false;
+    TickType_t next_rate_check = xTaskGetTickCount();
+    apply_uplink_rate(coalescer);
+    while (true) {
+        uint32_t target_delay_ms = s_uplink_delay_ms.load();
+        if (target_delay_ms != delay_ms) {
+            coalescer.setMaxDelay(target_delay_ms);
+            delay_ms = target_delay_ms;
+        }
+        bool ready = s_uplink_ready.load();
+        if (was_ready && !ready) {
+            // 🔌 断开：合包器里没发出去的不要了，这句话在缓冲区里都有，重连后从头补发
+            coalescer.reset();
+            backlog.rewind();
+            s_uplink_rate.reset();
+            apply_uplink_rate(coalescer);
+        }
+        was_ready = ready;
+        coalescer.setFraming(s_uplink_framing.load(),
+                             audio_manager->get_uplink_codec() == UplinkCodec::OPUS ? AudioFraming::Codec::OPUS
+                                                                                   : AudioFraming::Codec::PCM);
+        if (ready && backlog.hasPending()) {
+            uint32_t pending_ms = backlog.pendingSamples() / 16;
+            UplinkBacklog::Stats before = backlog.getStats();
+            uint32_t frames = drain_uplink_backlog(coalescer, backlog);
+            const UplinkBacklog::Stats& after = backlog.getStats();
+            PerfCounters::add(PerfCounter::UPLINK_REPLAYED_FRAMES, frames);
+            ESP_LOGI(TAG, "📼 连接就绪，补发缓存的 %lu 帧（%lu ms），累计被挤掉 %lu 帧，编码不符放弃 %lu 帧",
+                     (unsigned long)frames, (unsigned long)pending_ms, (unsigned long)after.dropped,
+                     (unsigned long)(after.skipped - before.skipped));
+        }
+        // 有没发出的记录时隔20ms看一眼连接恢复了没有（说完话之后队列里可能不会再有新帧）
+        TickType_t wait = coalescer.ticksUntilDeadline();
+        if (backlog.hasPending()) {
+            wait = std::min(wait, pdMS_TO_TICKS(20));
+        }
+        if (xQueueReceive(s_audio_send_queue, &item, wait) != pdTRUE) {
+            coalescer.poll();
+            continue;
+        }
+        SCHED_TRACE_MARK(UPLINK_POP, item.len);
+        if (item.len > 0 && item.codec == UplinkCodec::OPUS) {
+            s_uplink_rate.noteFrame();
+            adapt_uplink_rate(coalescer, &next_rate_check);
+        }
+
+        // 控制标记：一句话结束，立即发出已合并的数据
+        if (item.len == 0) {
+            if (item.slot == AUDIO_MARKER_SPEECH_END) {
+                if (backlog.isValid()) {
+                    // 排在这句话的音频后面，补发到这里才结束识别
+                    backlog.pushSpeechEnd();
+                    if (ready) {
+                        drain_uplink_backlog(coalescer, backlog);
+                    }
+                } else if (ready) {
+                    coalescer.flush();
+                    send_speech_end();
+                }
+            } else if (item.slot == AUDIO_MARKER_INTERRUPT) {
+                // ✋ 用户打断，让服务器停止下发当前回复（断开时旧回复已经没了，不用补发）
+                if (ready) {
+                    coalescer.flush();
+                    if (ws_client->binaryControl()) {
+                        ws_client->sendControl(ControlProtocol::Type::INTERRUPT, nullptr, 0, 1000);
+                    } else {
+                        ws_client->sendText("{\"type\":\"interrupt\"}", 1000);
+                    }
+                }
+            } else {
+                // 录音停止：发出已合并的数据，还没补发的也不再需要
+                if (ready) {
+                    coalescer.flush();
+                } else {
+                    coalescer.reset();
+                }
+                backlog.clear();
+            }
+            continue;
+        }
+
+        if (backlog.isValid()) {
+            backlog.push(s_audio_frame_pool->data(item.slot), item.len, item.timestamp, item.samples, item.codec);
+            if (ready) {
+                drain_uplink_backlog(coalescer, backlog);   // 连接正常时就是刚存进去的这一帧
+            }
+        } else if (ready) {
+            coalescer.push(s_audio_frame_pool->data(item.slot), item.len, item.timestamp, item.samples);
+        } else {
+            HOT_LOGW(TAG, "⚠️ WebSocket未连接，丢弃音频数据");
+            coalescer.reset();
+        }
+        s_audio_frame_pool->release(item.slot); // 归还帧池槽位
+        coalescer.poll();
+    }
+}
+
+/**
+ * @brief 🔗 WebSocket已连接：发hello协商编码格式（事件任务）
+ */
+static void on_ws_connected(const WebSocketClient::EventData& event, void* ctx) {
+    ESP_LOGI(TAG, "🔗 WebSocket已连接");
+    perf_history.noteConnect();
+    FLIGHT_RECORD(WS_CONNECT);
+    audio_manager->reset_downlink_credit();
+    WebSocketClient::ReconnectStats rs = ws_client->getReconnectStats();
+    if (rs.attempts > 0) {
+        ESP_LOGI(TAG, "📊 重连统计: 尝试%lu次, 成功%lu次, 立即重试%lu次, 重建任务%lu次, 最近退避%lu ms, 最长退避%lu ms",
+                 (unsigned long)rs.attempts, (unsigned long)rs.successes, (unsigned long)rs.fast_retries,
+                 (unsigned long)rs.task_restarts,
+                 (unsigned long)rs.last_backoff_ms, (unsigned long)rs.max_backoff_ms);
+    }
+    // 🤝 告诉服务器我们支持的编码格式，等服务器确认后再切换
+    if (s_device_id[0] == '\0') {
+        uint8_t mac[6] = {};
+        esp_read_mac(mac, ESP_MAC_WIFI_STA);
+        snprintf(s_device_id, sizeof(s_device_id), "%02x%02x%02x%02x%02x%02x",
+                 mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+    }
+    {
+        // ⚡ jitter_ms：当前的预缓冲目标，服务器按它选下行稳定块的时长
+        // 🌙 深度睡眠醒来的第一次连接带上睡前的服务器会话，服务器核对后接上暂存的豆包会话
+        char resume[96] = "";
+        if (s_resume_hello) {
+            s_resume_hello = false;
+            snprintf(resume, sizeof(resume), ",\"resume\":{\"session\":\"%s\",\"slept_ms\":%lu}",
+                     fast_resume.sessionToken(), (unsigned long)fast_resume.sleptMs());
+        }
+        char playback[64] = "";
+        if (s_playback_resume) {
+            s_playback_resume = false;
+            snprintf(playback, sizeof(playback), ",\"playback\":{\"seq\":%u,\"unplayed\":%lu}",
+                     (unsigned)s_playback_seq, (unsigned long)s_playback_unplayed);
+        }
+        char hello[672];
+        snprintf(hello, sizeof(hello),
+                 "{\"type\":\"hello\",\"v\":%d,\"device_id\":\"%s\",\"audio\":{\"uplink\":[%s\"pcm\"],"
+                 "\"downlink\":[\"adpcm\",%s\"pcm\"],\"sample_rate\":16000,\"frame_ms\":%d,\"jitter_ms\":%lu}%s%s%s%s%s%s%s,"
+                 "\"features\":[\"credit\",\"move\"%s%s%s%s%s%s%s],"
+                 "\"fw\":{\"version\":\"%s\",\"sha\":\"%s\",\"ota\":%s,\"pending\":%s}}",
+                 HELLO_PROTOCOL_VERSION, s_device_id, UPLINK_OPUS_ENABLE ? "\"opus\"," : "",
+                 DOWNLINK_RESAMPLE_ENABLE ? "\"f32_24k\"," : "", AUDIO_FRAME_MS,
+                 (unsigned long)(audio_manager ? audio_manager->get_prebuffer_ms() : PLAYOUT_DELAY_INITIAL_MS),
+                 CONTROL_BINARY_ENABLE ? ",\"control\":\"binary\"" : "",
+                 SESSION_CAPTURE_ENABLE ? ",\"capture\":true" : "",
+                 AUDIO_FRAMING_ENABLE ? ",\"framing\":\"seq\"" : "",
+                 WAKE_VERIFY_ENABLE && AUDIO_FRAMING_ENABLE ? ",\"wake_verify\":true" : "",
+                 UPLINK_VAD_GATE_ENABLE ? ",\"vad\":true" : "", resume, playback,
+                 DOWNLINK_RESUME_ENABLE && AUDIO_FRAMING_ENABLE ? ",\"playback_resume\"" : "",
+                 LOCAL_COMMAND_ENABLE ? ",\"text_query\"" : "",
+                 udp_audio && (UDP_AUDIO_ALLOW_WITH_TLS || !ws_client->isSecure()) ? ",\"udp\"" : "",
+                 THINKING_EARCON_ENABLE ? ",\"reply_eta\"" : "",
+                 media_stream.isAvailable() ? ",\"media\"" : "",
+                 SOAK_TEST ? ",\"soak\"" : "",
+                 ASSET_CACHE_ENABLE && asset_cache.isReady() ? ",\"assets\"" : "",
+                 ota_updater.version(), ota_updater.imageSha(), OTA_ENABLE ? "true" : "false",
+                 ota_updater.pendingVerify() ? "true" : "false");
+        ws_client->sendText(hello, 1000);
+    }
+}
+
+/**
+ * @brief 🔌 WebSocket已断开（事件任务）
+ */
+static void on_ws_disconnected(const WebSocketClient::EventData& event, void* ctx) {
+    ESP_LOGI(TAG, "🔌 WebSocket已断开");
+    FLIGHT_RECORD(WS_DISCONNECT);
+    s_flight_upload = false;
+    WebSocketClient::SendStats ss = ws_client->getSendStats(WebSocketClient::SendLane::AUDIO);
+    ESP_LOGI(TAG, "📊 上行音频发送: 入队%lu条, 发出%lu条, 队列满%lu条, 过期%lu条, 断开丢弃%lu条, 最长等待%lu ms",
+             (unsigned long)ss.queued, (unsigned long)ss.completed, (unsigned long)ss.dropped_full,
+             (unsigned long)ss.dropped_stale, (unsigned long)ss.dropped_offline, (unsigned long)ss.max_wait_ms);
+    session_capture.setEnabled(false);
+    SchedTrace::stop();
+    s_uplink_ready = false;
+    if (udp_audio) {
+        udp_audio->stop();
+    }
+    s_downlink_feeder = DOWNLINK_FEEDER_NONE;     // 断在一条消息中间时WebSocket任务不会再交message_end
+    if (audio_manager) {
+        // 📼 会话中继续录音，这段时间的音频进存储转发缓冲区，重连后补发
+        if (UPLINK_BACKLOG_MS == 0 || current_state != SpeechState::SESSION_ACTIVE) {
+            audio_manager->stop_recording();
+        }
+        // 🔌 会话中断开：记下回复播到了哪里，重连后服务器从那里接着发
+        s_playback_resume = DOWNLINK_RESUME_ENABLE && current_state == SpeechState::SESSION_ACTIVE &&
+                            audio_manager->get_downlink_resume_point(&s_playback_seq, &s_playback_unplayed);
+        if (s_playback_resume) {
+            ESP_LOGI(TAG, "🔌 回复播到一半断开: 最后收到seq=%u，还有 %lu 样本没播",
+                     (unsigned)s_playback_seq, (unsigned long)s_playback_unplayed);
+        }
+        s_playback_resumed = false;
+        audio_manager->stop_streaming_playback();
+        // 上行编码保持不变：缓存的帧按断开前的格式编码，重连后的hello再重新协商
+        audio_manager->set_downlink_codec(DownlinkCodec::PCM);
+        audio_manager->set_audio_framing(false);
+    }
+    s_uplink_framing = false;
+    s_wake_verify = false;
+    
+    // 会话活跃状态下断开：交给主循环重连（这里运行在事件任务中，不能阻塞等待连接事件）
+    if (current_state == SpeechState::SESSION_ACTIVE) {
+        session_reconnect_pending = true;
+        xTaskNotifyGive(main_task_handle);
+    } else if (current_state == SpeechState::LOCAL_COMMAND) {
+        // 本地命令词不依赖网络，等结果出来后由主循环决定是否重连
+    } else {
+        current_state = SpeechState::IDLE;
+        ESP_LOGI(TAG, "重置状态为空闲");
+        // 停止录音
+        audio_manager->stop_recording();
+    }
+}
+
+static void on_ws_error(const WebSocketClient::EventData& event, void* ctx) {
+    ESP_LOGE(TAG, "❌ WebSocket错误");
+}
+
+/**
+ * @brief 📦 下行二进制消息：音频和控制帧（WebSocket任务，直接处理，不能阻塞）
+ */
+static void on_ws_binary(const WebSocketClient::EventData& event, void* ctx) {
+    // 📦 控制帧很短，只会是完整的单帧消息
+    if (event.message_start && event.message_end && ws_client->binaryControl()) {
+        ControlProtocol::Header header;
+        const uint8_t* payload = nullptr;
+        if (ControlProtocol::parse(event.data, event.data_len, &header, &payload)) {
+            // ✋ 打断确认要排在新回复的音频前面，直接处理；其余控制帧转到事件任务（队列满时就地处理）
+            if (header.type == (uint8_t)ControlProtocol::Type::INTERRUPT_ACK || !ws_client->defer(event)) {
+                dispatch_control(header, payload);
+            }
+            return;
+        }
+    }
+    // 🛰️ 网络自检的测试消息只计数，不进播放
+    if (net_self_test->onDownlink(event)) {
+        return;
+    }
+    if (event.message_start) {
+        // 📡 UDP接收任务正在交一条时等它交完（几微秒；服务器只在一段回复的开头换通道，平时碰不上）
+        uint8_t feeder = DOWNLINK_FEEDER_NONE;
+        while (!s_downlink_feeder.compare_exchange_weak(feeder, DOWNLINK_FEEDER_WS) && feeder != DOWNLINK_FEEDER_WS) {
+            feeder = DOWNLINK_FEEDER_NONE;
+            taskYIELD();
+        }
+        session_capture.record(SessionCapture::Kind::DOWNLINK_AUDIO, event.payload_len);
+    }
+    latency_trace.mark(TracePoint::FIRST_DOWNLINK);
+    conversation.onDownlink(esp_timer_get_time());
+    thinking_filler.onDownlink();
+    upload_scheduler.onReplyStart();
+    if (audio_manager) {
+        audio_manager->feed_streaming_fragment(event.data, event.data_len,
+                                               event.message_start, event.message_end);
+    }
+    if (event.message_end) {
+        s_downlink_feeder = DOWNLINK_FEEDER_NONE;
+    }
+}
+
+/**
+ * @brief 📡 UDP收到的一条完整下行音频（UDP接收任务，不能阻塞）
+ */
+static void on_udp_audio(const uint8_t* data, size_t len) {
+    uint8_t feeder = DOWNLINK_FEEDER_NONE;
+    if (!s_downlink_feeder.compare_exchange_strong(feeder, DOWNLINK_FEEDER_UDP)) {
+        return;     // WebSocket正在交一条分片的消息：这条按丢包处理，由帧头序号补偿
+    }
+    session_capture.record(SessionCapture::Kind::DOWNLINK_AUDIO, len);
+    latency_trace.mark(TracePoint::FIRST_DOWNLINK);
+    conversation.onDownlink(esp_timer_get_time());
+    thinking_filler.onDownlink();
+    upload_scheduler.onReplyStart();
+    if (audio_manager) {
+        audio_manager->feed_streaming_fragment(data, len, true, true);
+    }
+    s_downlink_feeder = DOWNLINK_FEEDER_NONE;
+}
+
+/**
+ * @brief 📦 on_ws_binary转过来的控制帧（事件任务）
+ */
+static void on_ws_control(const WebSocketClient::EventData& event, void* ctx) {
+    ControlProtocol::Header header;
+    const uint8_t* payload = nullptr;
+    if (ControlProtocol::parse(event.data, event.data_len, &header, &payload)) {
+        dispatch_control(header, payload);
+    }
+}
+
+/**
+ * @brief 💬 下行文本消息（事件任务；数据是事件队列里的拷贝）
+ */
+static void on_ws_text(const WebSocketClient::EventData& event, void* ctx) {
+    // 文本帧不保证以'\0'结尾，用string_view直接在事件的数据上查找
+    std::string_view text((const char*)event.data, event.data_len);
+    ESP_LOGI(TAG, "💬 收到WebSocket文本数据: %.*s", (int)text.size(), text.data());
+    // 🤝 服务器hello：确认上下行编码格式
+    if (text.find("\"type\":\"hello\"") != std::string_view::npos) {
+        // 📦 和服务器握手成功说明新固件的网络链路正常，由主循环取消回滚（要写otadata分区）
+        s_firmware_confirm = true;
+        // 🤝 服务器选定的协议版本（旧服务器不带，按1）；下面每一项都是服务器明确同意了才用
+        float version = 1.0f;
+        json_number(text, "\"v\":", &version);
+        ESP_LOGI(TAG, "🤝 hello协议版本: 设备%d，服务器选定%d", HELLO_PROTOCOL_VERSION, (int)version);
+        s_text_query = text.find("\"text_query\"") != std::string_view::npos;
+        // 🔥 中继打开了浸泡配置（回复是合成的）才开始自动唤醒
+        soak_test.setAccepted(SOAK_TEST && text.find("\"soak\"") != std::string_view::npos);
+        if (audio_manager) {
+            bool use_opus = text.find("\"uplink\":\"opus\"") != std::string_view::npos;
+            DownlinkCodec downlink = DownlinkCodec::PCM;
+            if (text.find("\"downlink\":\"adpcm\"") != std::string_view::npos) {
+                downlink = DownlinkCodec::ADPCM;
+            } else if (text.find("\"downlink\":\"f32_24k\"") != std::string_view::npos) {
+                downlink = DownlinkCodec::F32_24K;
+            }
+            audio_manager->set_uplink_codec(use_opus ? UplinkCodec::OPUS : UplinkCodec::PCM);
+            audio_manager->set_downlink_codec(downlink);
+            // ⚡ 服务器的下行块时长（旧服务器不给时为0）
+            size_t chunk = text.find("\"chunk_ms\":");
+            audio_manager->set_downlink_chunk_ms(
+                chunk != std::string_view::npos ? (uint32_t)strtoul(text.data() + chunk + 11, nullptr, 10) : 0);
+            // 🕐 服务器确认的帧时钟（旧服务器不给）：对不上时下行消息不按帧对齐，能播，只是播放任务要多分一次块
+            size_t frame = text.find("\"frame_ms\":");
+            if (frame != std::string_view::npos) {
+                unsigned long frame_ms = strtoul(text.data() + frame + 11, nullptr, 10);
+                if (frame_ms != AUDIO_FRAME_MS) {
+                    ESP_LOGW(TAG, "⚠️ 服务器按 %lu ms帧下发，本机帧时钟是 %d ms", frame_ms, AUDIO_FRAME_MS);
+                }
+            }
+        }
+        // 🧾 服务器同意后两个方向的音频消息都带帧头
+        bool framing = AUDIO_FRAMING_ENABLE && text.find("\"framing\":\"seq\"") != std::string_view::npos;
+        if (audio_manager) {
+            audio_manager->set_audio_framing(framing);
+        }
+        s_uplink_framing = framing;
+        // 🔌 服务器接着断开前的位置续播：先开好流式播放，续播的音频紧跟着hello回复到
+        if (audio_manager && framing && text.find("\"playback_resume\":true") != std::string_view::npos) {
+            audio_manager->start_streaming_playback();
+            s_playback_resumed = true;
+        }
+        // 🛡️ 服务器按帧头的时间戳切出唤醒词音频，所以复核要求帧头
+        s_wake_verify = WAKE_VERIFY_ENABLE && framing && text.find("\"wake_verify\":true") != std::string_view::npos;
+        // 📦 服务器同意后，高频控制消息改用二进制帧
+        ws_client->setBinaryControl(CONTROL_BINARY_ENABLE &&
+                                    text.find("\"control\":\"binary\"") != std::string_view::npos);
+        // 🎙️ 服务器在录制这个会话：时间戳走CAPTURE控制帧，所以也要求二进制控制帧
+        session_capture.setEnabled(SESSION_CAPTURE_ENABLE && ws_client->binaryControl() &&
+                                   text.find("\"capture\":true") != std::string_view::npos);
+        // ⏱️ 服务器的会话ID，用来和服务器端的延迟日志对齐
+        size_t session = text.find("\"session\":\"");
+        if (session != std::string_view::npos) {
+            std::string_view id = text.substr(session + 11);
+            id = id.substr(0, id.find('"'));
+            latency_trace.setSession(id);
+            fast_resume.setSessionToken(id.data(), id.size());
+        }
+        // 🧭 多进程服务器的路由提示：以后重连直接连到负责本设备的worker
+        size_t route = text.find("\"route_port\":");
+        if (route != std::string_view::npos) {
+            int port = (int)strtol(text.data() + route + 13, nullptr, 10);
+            if (port > 0 && port < 65536) {
+                ws_client->setRouteHint(port);
+            }
+        }
+        // 📡 服务器同意了UDP音频通道："udp":{"port":P,"token":T}，探测通了之后音频改走UDP
+        if (udp_audio) {
+            size_t udp = framing ? text.find("\"udp\":{") : std::string_view::npos;
+            std::string_view offer = udp != std::string_view::npos ? text.substr(udp) : std::string_view();
+            size_t port = offer.find("\"port\":");
+            size_t token = offer.find("\"token\":");
+            if (port != std::string_view::npos && token != std::string_view::npos) {
+                udp_audio->start((uint16_t)strtoul(offer.data() + port + 7, nullptr, 10),
+                                 (uint32_t)strtoul(offer.data() + token + 8, nullptr, 10));
+            } else {
+                udp_audio->stop();
+            }
+        }
+        s_history_pending = PERF_HISTORY_ENABLE;
+        s_flight_upload = FlightRecorder::hasPending();
+        s_uplink_ready = true;  // 编码格式和帧头都定了，发送任务开始发（先补发断开期间的）
+    }
+    // ⏱️ 会话超时后重新开始的豆包会话有新的ID
+    else if (text.find("\"type\":\"session\"") != std::string_view::npos) {
+        size_t session = text.find("\"session\":\"");
+        if (session != std::string_view::npos) {
+            std::string_view id = text.substr(session + 11);
+            id = id.substr(0, id.find('"'));
+            latency_trace.setSession(id);
+            fast_resume.setSessionToken(id.data(), id.size());
+        }
+    }
+    // 📡 服务器的UDP接收报告：上行丢失太多时退回WebSocket
+    else if (text.find("\"type\":\"udp_report\"") != std::string_view::npos) {
+        if (udp_audio) {
+            udp_audio->onReport(text);
+        }
+    }
+    // ⏳ 服务器对这一轮回复的预估：慢的时候提前播思考提示音
+    else if (text.find("\"type\":\"reply_eta\"") != std::string_view::npos) {
+        float ms = 0.0f;
+        if (json_number(text, "\"ms\":", &ms) && ms >= 0.0f) {
+            thinking_filler.setEta((uint32_t)ms);
+        }
+    }
+    // 📈 服务器请求性能统计
+    else if (text.find("\"type\":\"get_stats\"") != std::string_view::npos) {
+        s_stats_requested = true;    // 主循环10ms内发出
+    }
+    // 🛰️ 网络自检的RTT回应
+    else if (text.find("\"type\":\"net_test_pong\"") != std::string_view::npos) {
+        float seq = 0.0f;
+        if (json_number(text, "\"seq\":", &seq)) {
+            net_self_test->onPong((uint32_t)seq);
+        }
+    }
+    // 🛰️ 服务器要求网络自检
+    else if (text.find("\"type\":\"net_test\"") != std::string_view::npos) {
+        if (!s_net_test_pending.load() && text.size() < sizeof(s_net_test_request)) {
+            memcpy(s_net_test_request, text.data(), text.size());
+            s_net_test_request[text.size()] = '\0';
+            s_net_test_pending = true;
+        }
+    }
+    // 🔊 服务器要求重新标定扬声器→麦克风延迟
+    else if (text.find("\"type\":\"loopback_cal\"") != std::string_view::npos) {
+        s_loopback_pending = LOOPBACK_CAL_ENABLE;
+    }
+    // 🔬 服务器开始一个调度追踪窗口（需要用SCHED_TRACE_MODE=2构建）
+    else if (text.find("\"type\":\"sched_trace\"") != std::string_view::npos) {
+        float ms = SCHED_TRACE_DEFAULT_MS;
+        json_number(text, "\"ms\":", &ms);
+        SchedTrace::start(ms > 0 && ms <= SCHED_TRACE_MAX_MS ? (uint32_t)ms : SCHED_TRACE_DEFAULT_MS);
+    }
+    // 🎯 服务器调整唤醒词参数
+    else if (text.find("\"type\":\"wake_config\"") != std::string_view::npos) {
+        if (!s_wake_config_pending.load() && text.size() < sizeof(s_wake_config)) {
+            memcpy(s_wake_config, text.data(), text.size());
+            s_wake_config[text.size()] = '\0';
+            s_wake_config_pending = true;
+        } else {
+            ESP_LOGW(TAG, "⚠️ 唤醒词参数过长或上一条还没处理，忽略");
+        }
+    }
+    // 🎚️ 服务器调整运行时参数
+    else if (text.find("\"type\":\"runtime_config\"") != std::string_view::npos) {
+        if (!s_runtime_config_pending.load() && text.size() < sizeof(s_runtime_config)) {
+            memcpy(s_runtime_config, text.data(), text.size());
+            s_runtime_config[text.size()] = '\0';
+            s_runtime_config_pending = true;
+        } else {
+            ESP_LOGW(TAG, "⚠️ 运行时参数过长或上一条还没处理，忽略");
+        }
+    }
+    // 📦 服务器下发固件升级（或要求回滚）
+    else if (text.find("\"type\":\"ota\"") != std::string_view::npos) {
+        if (!s_ota_request_pending.load() && text.size() < sizeof(s_ota_request)) {
+            memcpy(s_ota_request, text.data(), text.size());
+            s_ota_request[text.size()] = '\0';
+            s_ota_request_pending = true;
+        } else {
+            ESP_LOGW(TAG, "⚠️ 升级请求过长或上一条还没处理，忽略");
+        }
+    }
+    // 📻 服务器要设备直接下载播放一段长音频（或暂停/恢复/停止）
+    else if (text.find("\"type\":\"media\"") != std::string_view::npos) {
+        if (!s_media_request_pending.load() && text.size() < sizeof(s_media_request)) {
+            memcpy(s_media_request, text.data(), text.size());
+            s_media_request[text.size()] = '\0';
+            s_media_request_pending = true;
+        } else {
+            ESP_LOGW(TAG, "⚠️ 长音频请求过长或上一条还没处理，忽略");
+        }
+    }
+    // 📦 推送提示音的清单（分页），缺的由下载任务在后台取
+    else if (text.find("\"type\":\"assets\"") != std::string_view::npos) {
+        asset_cache.onManifest(text);
+    }
+    // 📦 服务器要播一条推送的提示音
+    else if (text.find("\"type\":\"play_asset\"") != std::string_view::npos) {
+        if (!s_asset_play_pending.load() && json_string(text, "\"id\":", s_asset_play, sizeof(s_asset_play))) {
+            s_asset_play_pending = true;
+        }
+    }
+    // ✋ 服务器已停止下发被打断的回复，之后收到的音频属于新回复
+    else if (text.find("\"type\":\"interrupt_ack\"") != std::string_view::npos) {
+        on_interrupt_ack();
+    }
+    // 🔇 检测是否是明确的TTS结束信号
+    else if (text.find("\"type\":\"tts_end\"") != std::string_view::npos) {
+        on_tts_end();
+    }
+    // 🚦 服务器上游满载，这次会话开不了
+    else if (text.find("\"type\":\"busy\"") != std::string_view::npos) {
+        s_server_busy = true;
+    }
+    // 🚚 服务器要重启：马上会断开，按给的时间错开重连到新进程
+    else if (text.find("\"type\":\"move\"") != std::string_view::npos) {
+        float delay_ms = 0.0f;
+        uint32_t delay = json_number(text, "\"delay_ms\":", &delay_ms) && delay_ms > 0 ? (uint32_t)delay_ms : 0;
+        ESP_LOGI(TAG, "🚚 服务器要重启，断开后 %lu ms 重连", (unsigned long)delay);
+        ws_client->deferReconnect(delay);
+    }
+    // 🛡️ 服务器复核唤醒词的结果（通过时只记日志），🏠 或者多设备仲裁输了
+    else if (text.find("\"type\":\"wake_verdict\"") != std::string_view::npos) {
+        if (text.find("\"ok\":false") != std::string_view::npos) {
+            if (text.find("\"reason\":\"arbitration\"") != std::string_view::npos) {
+                s_wake_lost = true;
+            }
+            s_wake_rejected = true;
+        }
+    }
+}
+
+/**
+ * @brief 🔇 服务器发完了本轮回复：结束流式播放，输出并上报本轮延迟
+ */
+static void on_tts_end() {
+    ESP_LOGI(TAG, "🔇 检测到TTS结束信号，调用千问方法结束播放");
+    latency_trace.mark(TracePoint::TTS_END);
+    latency_trace.logTurn();
+#if LATENCY_TRACE_REPORT
+    latency_trace.setUplinkKbps(s_uplink_rate.takeTurnKbps());
+    char trace[320];
+    if (latency_trace.formatTurn(trace, sizeof(trace)) > 0) {
+        ws_client->sendText(trace, 100);
+    }
+    // 💰 本轮账单，服务器按会话ID和它那一侧的合并
+    if (turn_cost.formatTurn(trace, sizeof(trace), latency_trace.session(), latency_trace.turn(), ws_write_us()) > 0) {
+        ws_client->sendText(trace, 100);
+    }
+#endif
+    soak_test.noteTurn(latency_trace.eosToPlaybackMs());
+    latency_trace.beginTurn();  // 同一会话里的下一句话
+    turn_cost.begin(ws_write_us());
+    thinking_filler.cancel();   // 没有音频的回复（或者音频走在tts_end后面）也不再等了
+    if (audio_manager) {
+        ESP_LOGI(TAG, "🎬 调用finish_streaming_playback()结束流式播放...");
+        audio_manager->finish_streaming_playback();
+    }
+    conversation.onReplyEnd();  // 播完进入追问窗口
+}
+
+/**
+ * @brief 💰 WebSocket各发送通道写socket的累计耗时（每轮账单取增量）
+ */
+static uint32_t ws_write_us() {
+    if (!ws_client) {
+        return 0;
+    }
+    uint32_t total = 0;
+    for (size_t lane = 0; lane < (size_t)WebSocketClient::SendLane::COUNT; lane++) {
+        total += ws_client->getSendStats((WebSocketClient::SendLane)lane).write_us;
+    }
+    return total;
+}
+
+/**
+ * @brief ✋ 服务器已停止下发被打断的回复，之后收到的音频属于新回复
+ */
+static void on_interrupt_ack() {
+    if (audio_manager) {
+        audio_manager->resume_downlink();
+    }
+}
+
+static void on_control_ready(const ControlProtocol::Header& header, const uint8_t* payload) {
+    ESP_LOGI(TAG, "✅ 服务器已就绪");
+}
+
+static void on_control_tts_end(const ControlProtocol::Header& header, const uint8_t* payload) {
+    on_tts_end();
+}
+
+static void on_control_interrupt_ack(const ControlProtocol::Header& header, const uint8_t* payload) {
+    on_interrupt_ack();
+}
+
+// 📦 下行控制帧按类型直接查表（PONG在WebSocketClient里处理，上行类型在这里为空）
+using ControlHandler = void (*)(const ControlProtocol::Header& header, const uint8_t* payload);
+static const ControlHandler kControlHandlers[(size_t)ControlProtocol::Type::COUNT] = {
+    nullptr,                    // NONE
+    on_control_ready,           // READY
+    on_control_tts_end,         // TTS_END
+    nullptr,                    // CREDIT
+    nullptr,                    // PING
+    nullptr,                    // PONG
+    nullptr,                    // INTERRUPT
+    on_control_interrupt_ack,   // INTERRUPT_ACK
+    nullptr,                    // STATS
+    nullptr,                    // CAPTURE
+    nullptr,                    // SCHED_TRACE
+};
+
+/**
+ * @brief 分发一条下行控制帧（INTERRUPT_ACK在WebSocket任务中，其余在事件任务中执行）
+ */
+static void dispatch_control(const ControlProtocol::Header& header, const uint8_t* payload) {
+    ControlHandler handler = kControlHandlers[header.type];
+    ESP_LOGD(TAG, "📦 控制帧 %s seq=%u", ControlProtocol::typeName((ControlProtocol::Type)header.type), header.seq);
+    if (handler) {
+        handler(header, payload);
+    }
+}
+
+/**
+ * @brief 进入云端会话：连接服务器，开始上传（从会话预录里唤醒词结束处补发）
+ */
+static bool start_cloud_session(int timeout_ms, bool push_to_talk) {
+    audio_manager->set_push_to_talk(push_to_talk);
+    if (!ensure_ws_connected(timeout_ms)) {
+        ESP_LOGE(TAG, "❌ WebSocket连接失败，返回空闲状态");
+        local_tts.speak(LOCAL_TTS_TEXT_OFFLINE);     // 不再静默回到空闲
+        current_state = SpeechState::IDLE;
+        return false;
+    }
+    perf_history.noteSession();
+    FLIGHT_RECORD(SESSION_START, push_to_talk ? 1 : 0);
+    // 上次超时释放了豆包会话时服务器重新开始一个（会话还在时忽略），排在这次的音频前面
+    // 双麦克风时附上唤醒时的说话人方向
+    // 🛡️ 服务器要复核时附上录音开头属于唤醒词的样本数（verify给复核模型），和唤醒词连同触发后尾音结束的位置
+    //    （wake_end，服务器从这里开始转给豆包）；不复核时唤醒词和尾音在设备上就跳过了
+    // 🏠 唤醒词音量给服务器在同一房间的几台设备之间选离得最近的
+    // 📈 触发的模型和它的阈值给服务器按现场统计误唤醒、推荐阈值
+    // 🔘 按键触发的不复核也不参加仲裁，唤醒词的方向和音量都不是这一次的
+    JsonMessage<160> start_msg("session_start");
+    uint32_t wake_end = 0;
+    uint32_t verify = audio_manager->take_wake_clip(s_wake_verify.load() && !push_to_talk, &wake_end);
+    if (push_to_talk) {
+        start_msg.flag("ptt", true);
+    } else {
+        int direction = front_end->wakeDirection();
+        if (direction >= 0) {
+            start_msg.num("doa", direction);
+        }
+        if (verify > 0) {
+            start_msg.num("verify", verify).num("wake_end", wake_end);
+        }
+        start_msg.real("wake_db", front_end->wakeVolume());
+        start_msg.num("wake_model", front_end->wakeModelIndex() + 1)
+                 .real("wake_thr", front_end->wakeModelThreshold(), 4);
+    }
+    ws_client->sendText(start_msg.finish(), 1000);
+    audio_manager->invalidate_reply_cache();    // 新的一轮，上一轮的回复不再是"上一轮"
+    conversation.begin(esp_timer_get_time());
+    // 唤醒之后说的话已经在会话预录里，提示音不阻塞录音
+    session_capture.record(SessionCapture::Kind::SESSION, 0);
+    audio_manager->start_streaming_playback();
+    audio_manager->start_recording();
+    return true;
+}
+
+/**
+ * @brief 🔘 处理按键说话（主任务中调用）
+ *
+ * 空闲时按下直接进入云端会话（不经过WakeNet和本地命令词，不播唤醒提示音），会话中按下开始下一句
+ * （回复还在播就是打断）；松开时录音任务立即发speech_end。
+ */
+static void handle_push_to_talk() {
+    PushToTalk::Event event = push_to_talk.takeEvent();
+    if (event == PushToTalk::Event::RELEASE) {
+        audio_manager->set_talk_button(false);
+        return;
+    }
+    if (event != PushToTalk::Event::PRESS) {
+        return;
+    }
+    if (current_state == SpeechState::SESSION_ACTIVE) {
+        audio_manager->set_push_to_talk(true);
+        audio_manager->set_talk_button(true);
+        return;
+    }
+    if (current_state != SpeechState::IDLE || !s_network_ready) {
+        ESP_LOGW(TAG, "🔘 按键按下，但现在不能开始会话");
+        return;
+    }
+    ESP_LOGI(TAG, "🔘 按键按下，开始会话");
+    latency_trace.beginTurn();
+    latency_trace.mark(TracePoint::WAKE);
+    turn_cost.begin(ws_write_us());
+    upload_scheduler.onWake(esp_timer_get_time());
+    power_policy.setActive(true);
+    audio_manager->stop_recording();
+    audio_manager->set_talk_button(true);
+    current_state = SpeechState::SESSION_ACTIVE;
+    start_cloud_session(PUSH_TO_TALK_CONNECT_MS, true);
+}
+
+#if SOAK_TEST
+/**
+ * @brief 🔥 按浸泡测试的安排自动唤醒、假装说完、断开连接，定时发报告（主任务中调用）
+ *
+ * 自动唤醒和唤醒词走同样的路径（延迟追踪、账单、上传暂停、提示音），只是不经过本地命令词。
+ */
+static void handle_soak_test() {
+    int64_t now = esp_timer_get_time();
+    switch (soak_test.poll(now, current_state == SpeechState::IDLE && s_network_ready,
+                           current_state == SpeechState::SESSION_ACTIVE)) {
+        case SoakTest::Action::WAKE:
+            ESP_LOGI(TAG, "🔥 浸泡测试自动唤醒");
+            latency_trace.beginTurn();
+            latency_trace.mark(TracePoint::WAKE);
+            turn_cost.begin(ws_write_us());
+            upload_scheduler.onWake(now);
+            power_policy.setActive(true);
+            audio_manager->stop_recording();
+            current_state = SpeechState::SESSION_ACTIVE;
+            if (start_cloud_session(3000)) {
+                play_greeting();
+            }
+            break;
+        case SoakTest::Action::SPEECH_END:
+            send_speech_end();
+            break;
+        case SoakTest::Action::DISCONNECT:
+            ESP_LOGW(TAG, "🔥 浸泡测试主动断开WebSocket");
+            ws_client->reconnect();
+            break;
+        case SoakTest::Action::NONE:
+            break;
+    }
+    if (!ws_client->isConnected() || !upload_scheduler.ready(now)) {
+        return;
+    }
+    char report[512];
+    size_t len = soak_test.takeReport(report, sizeof(report), now);
+    if (len > 0 && ws_client->sendText(report, 100, WebSocketClient::SendLane::BULK) > 0) {
+        upload_scheduler.charge(len);
+    }
+}
+#endif
+
+/**
+ * @brief 🌙 连续空闲DEEP_SLEEP_IDLE_MS后进深度睡眠（主任务中调用，睡下去就不返回）
+ *
+ * 先告诉服务器要睡多久（它把豆包会话多暂存一会儿），断开WebSocket，再把AP和校准值存进RTC内存。
+ * 唤醒源配置不了（按键不是RTC GPIO、也没有定时）时这次运行不再尝试。
+ */
+static void maybe_deep_sleep() {
+    static int64_t idle_since_us = 0;
+    static bool unavailable = false;
+    int64_t now = esp_timer_get_time();
+    if (!DEEP_SLEEP_ENABLE || unavailable || current_state != SpeechState::IDLE || audio_manager->is_playing() ||
+        push_to_talk.isHeld() || net_self_test->isRunning() || ota_updater.isDownloading() ||
+        ota_updater.pendingVerify() || media_stream.isActive()) {
+        idle_since_us = now;
+        return;
+    }
+    if (now - idle_since_us < (int64_t)DEEP_SLEEP_IDLE_MS * 1000) {
+        return;
+    }
+    if (fast_resume.armWake(DEEP_SLEEP_TIMER_MS, PUSH_TO_TALK_ENABLE ? PUSH_TO_TALK_GPIO : -1,
+                            PUSH_TO_TALK_ACTIVE_LEVEL) != ESP_OK) {
+        unavailable = true;
+        return;
+    }
+    ESP_LOGI(TAG, "🌙 空闲%lu秒，进入深度睡眠", (unsigned long)(DEEP_SLEEP_IDLE_MS / 1000));
+    if (ws_client->isConnected()) {
+        JsonMessage<48> msg("sleep");
+        msg.num("ms", DEEP_SLEEP_TIMER_MS);
+        ws_client->sendText(msg.finish(), 200);
+        vTaskDelay(pdMS_TO_TICKS(100));     // 发送任务把它写出去再断开
+        ws_client->disconnect();
+    }
+    perf_history.save();
+    FlashScheduler::flush();
+    FastResume::Calibration calibration = { front_end->wakeGateFloor(), (float)audio_manager->get_drift_ppm() };
+    fast_resume.sleep(calibration);
+}
+
+/**
+ * @brief 🔥 空闲时能量门打开（可能是唤醒词的开头）：让服务器先开好豆包会话，断线时提前重连
+ *
+ * 能量门比WakeNet确认早一个唤醒词的时长（几百毫秒），这段时间里服务器做完StartSession，
+ * 唤醒后的session_start直接用上预热的会话；没有唤醒时服务器RELAY_WARMUP_S秒后释放。
+ * WebSocket断开时不等唤醒就让重连跳过退避，唤醒分支的ensure_ws_connected()接着等同一次连接。
+ */
+static void maybe_warm_up() {
+    static uint32_t seen_onsets = 0;
+    static int64_t last_us = 0;
+    uint32_t onsets = front_end->gateOnsets();
+    if (onsets == seen_onsets) {
+        return;
+    }
+    seen_onsets = onsets;
+    if (!WARMUP_ENABLE || !kWakeWordActive || !s_network_ready || current_state != SpeechState::IDLE ||
+        net_self_test->isRunning()) {
+        return;
+    }
+    int64_t now = esp_timer_get_time();
+    if (last_us != 0 && now - last_us < (int64_t)WARMUP_MIN_INTERVAL_MS * 1000) {
+        return;
+    }
+    last_us = now;
+    if (ws_client->isConnected()) {
+        ws_client->sendText("{\"type\":\"warmup\"}", 100);
+    } else if (ws_client->getState() == WebSocketClient::State::DISCONNECTED) {
+        ESP_LOGI(TAG, "🔥 可能要唤醒了，提前重连服务器");
+        ws_client->reconnectNow();
+    }
+}
+
+/**
+ * @brief 💤 会话超时：停止上传和播放，请服务器释放豆包会话，回到空闲等唤醒
+ *
+ * WebSocket不断开，下次唤醒直接开始上传；唤醒词检测立即恢复，不等下一轮主循环。
+ */
+static void end_cloud_session() {
+    ConversationSession::Phase phase = conversation.phase();
+    ESP_LOGI(TAG, "💤 会话结束（%s超时，本次唤醒说了%lu句），WebSocket保持连接",
+             ConversationSession::phaseName(phase), (unsigned long)conversation.turns());
+    PerfCounters::add(PerfCounter::SESSION_TIMEOUTS);
+    FLIGHT_RECORD(SESSION_END, conversation.turns());
+    conversation.end();
+    current_state = SpeechState::IDLE;
+    front_end->setWakeWordEnabled(kWakeWordActive);
+    audio_manager->stop_recording();
+    audio_manager->stop_streaming_playback();
+    if (ws_client->isConnected()) {
+        ws_client->sendText("{\"type\":\"session_end\"}", 1000);
+    }
+}
+
+/**
+ * @brief 🛡️ 服务器复核唤醒词没通过（误唤醒）或🏠 同一房间另一台设备接了这次唤醒：
+ *        不开豆包会话，本地立即结束这次唤醒，提示音也停掉
+ */
+static void handle_wake_rejected() {
+    if (!s_wake_rejected.exchange(false)) {
+        return;
+    }
+    bool lost = s_wake_lost.exchange(false);
+    PerfCounters::add(lost ? PerfCounter::WAKE_ARBITRATION_LOSSES : PerfCounter::WAKE_VERIFY_REJECTS);
+    if (current_state != SpeechState::SESSION_ACTIVE) {
+        return;
+    }
+    if (lost) {
+        ESP_LOGI(TAG, "🏠 附近另一台设备接了这次唤醒，回到空闲");
+    } else {
+        ESP_LOGW(TAG, "🛡️ 服务器复核唤醒词没通过，取消这次唤醒");
+    }
+    conversation.end();
+    current_state = SpeechState::IDLE;
+    front_end->setWakeWordEnabled(kWakeWordActive);
+    audio_manager->stop_recording();
+    audio_manager->stop_streaming_playback(true);
+}
+
+/**
+ * @brief 🚦 服务器回复busy：结束这次会话（服务器已丢弃上传的音频），本地播报稍后再试
+ */
+static void handle_server_busy() {
+    if (!s_server_busy.exchange(false)) {
+        return;
+    }
+    PerfCounters::add(PerfCounter::SERVER_BUSY);
+    if (current_state != SpeechState::SESSION_ACTIVE) {
+        ESP_LOGW(TAG, "🚦 服务器繁忙（当前没有会话）");
+        return;
+    }
+    ESP_LOGW(TAG, "🚦 服务器繁忙，本次唤醒结束");
+    conversation.end();
+    current_state = SpeechState::IDLE;
+    front_end->setWakeWordEnabled(kWakeWordActive);
+    audio_manager->stop_recording();
+    audio_manager->stop_streaming_playback();
+    local_tts.speak(LOCAL_TTS_TEXT_BUSY);
+}
+
+static void set_volume(float volume) {
+    s_volume = std::clamp(volume, LOCAL_VOLUME_MIN, 1.0f);
+    AudioMixer& mixer = audio_manager->get_mixer();
+    mixer.setGain(AudioMixer::VOICE_TTS, MIXER_TTS_GAIN * s_volume);
+    mixer.setGain(AudioMixer::VOICE_EARCON, MIXER_EARCON_GAIN * s_volume);
+    ESP_LOGI(TAG, "🔊 音量: %d%%", (int)(s_volume * 100.0f + 0.5f));
+}
+
+/**
+ * @brief 🔁 再说一遍（主任务中调用）：上一轮回复还缓存在本地就直接重放，不走网络；
+ *        没有（被打断、太长、已经开始了新一轮）时让服务器重放它缓存的，tts_end照常结束播放
+ */
+static void repeat_last_reply() {
+    if (audio_manager->replay_last_reply()) {
+        return;
+    }
+    if (ensure_ws_connected(3000)) {
+        audio_manager->start_streaming_playback();
+        ws_client->sendText("{\"type\":\"repeat\"}", 1000);
+    } else {
+        ESP_LOGW(TAG, "⚠️ 服务器未连接，无法重放上一轮回复");
+        local_tts.speak(LOCAL_TTS_TEXT_NO_REPLY);
+    }
+}
+
+#if REPLY_REPEAT_GPIO >= 0
+/**
+ * @brief 🔁 重放按键（主任务中调用）：空闲时按下就重放上一轮回复
+ */
+static void handle_repeat_button() {
+    if (repeat_button.takeEvent() != PushToTalk::Event::PRESS) {
+        return;
+    }
+    if (current_state != SpeechState::IDLE) {
+        ESP_LOGW(TAG, "🔁 重放按键按下，但现在不是空闲状态");
+        return;
+    }
+    ESP_LOGI(TAG, "🔁 重放按键按下");
+    repeat_last_reply();
+}
+#endif
+
+/**
+ * @brief 📍 处理本地命令词的识别结果（主任务中调用）
+ *
+ * 没命中就转云端会话，命中的命令在本地执行后回到空闲；已连接时顺便告诉服务器，便于统计。
+ */
+static void handle_local_command(LocalCommands::Intent intent) {
+    uint32_t elapsed_ms = (uint32_t)((esp_timer_get_time() - s_local_armed_us) / 1000);
+    const char* text = s_local_text.exchange(nullptr);
+    if (intent == LocalCommands::Intent::ASK && !(text && s_text_query.load() && ws_client->isConnected())) {
+        // 旧服务器不接受文字问题（或者没连着）：照常上传这句话的音频，预录里是完整的
+        ESP_LOGI(TAG, "📍 问句\"%s\"不能以文字发送，转交云端识别", text ? text : "");
+        intent = LocalCommands::Intent::NONE;
+    }
+    if (intent == LocalCommands::Intent::NONE) {
+        PerfCounters::add(PerfCounter::LOCAL_COMMAND_MISSES);
+        ESP_LOGI(TAG, "📍 %lu ms内没有命令词，转交云端", (unsigned long)elapsed_ms);
+        current_state = SpeechState::SESSION_ACTIVE;
+        start_cloud_session(5000);
+        return;
+    }
+
+    PerfCounters::add(PerfCounter::LOCAL_COMMAND_HITS);
+    ESP_LOGI(TAG, "📍 本地命令: %s (置信度%.2f, 唤醒后%lu ms)",
+             LocalCommands::intentName(intent), s_local_prob.load(), (unsigned long)elapsed_ms);
+    current_state = SpeechState::IDLE;
+
+    switch (intent) {
+        case LocalCommands::Intent::VOLUME_UP:
+            set_volume(s_volume + LOCAL_VOLUME_STEP);
+            break;
+        case LocalCommands::Intent::VOLUME_DOWN:
+            set_volume(s_volume - LOCAL_VOLUME_STEP);
+            break;
+        case LocalCommands::Intent::STOP:
+            audio_manager->stop_streaming_playback();
+            break;
+        case LocalCommands::Intent::REPEAT:
+            repeat_last_reply();
+            break;
+        case LocalCommands::Intent::ASK: {
+            // 💬 问题已经听懂了：文字交给服务器开一轮对话，不上传音频、不等云端识别和说完判定，tts_end照常结束播放
+            latency_trace.mark(TracePoint::SPEECH_END);
+            if (THINKING_EARCON_ENABLE) {
+                thinking_filler.arm(esp_timer_get_time());
+            }
+            audio_manager->start_streaming_playback();
+            JsonMessage<192> query("text_query");
+            query.str("text", text).str("intent", LocalCommands::intentName(intent));
+            ws_client->sendText(query.finish(), 1000);
+            break;
+        }
+        default:
+            break;
+    }
+
+    if (intent != LocalCommands::Intent::REPEAT && intent != LocalCommands::Intent::ASK) {
+        const PromptAsset* ack = find_prompt(PROMPT_LOCAL_ACK);
+        if (ack) {
+            audio_manager->play_prompt_async(ack);
+        }
+    }
+    if (ws_client->isConnected()) {
+        JsonMessage<96> msg("local_command");
+        msg.str("intent", LocalCommands::intentName(intent)).num("ms", elapsed_ms);
+        ws_client->sendText(msg.finish(), 100);
+    }
+}
+
+/**
+ * @brief ⏳ 说完后迟迟没有回复音频：播"思考中"提示音，回复到了（或这一轮结束了）淡出（主循环）
+ */
+static void update_thinking_filler() {
+    bool waiting = current_state == SpeechState::SESSION_ACTIVE && !audio_manager->is_user_speaking();
+    switch (thinking_filler.update(esp_timer_get_time(), waiting)) {
+        case ThinkingFiller::Action::PLAY: {
+            const PromptAsset* thinking = find_prompt(PROMPT_THINKING);
+            if (!thinking || audio_manager->play_prompt_async(thinking, [](bool) { thinking_filler.onPlayed(); }) != ESP_OK) {
+                thinking_filler.onPlayed();     // 没有这条提示音（分区是旧的）：只计数
+            }
+            break;
+        }
+        case ThinkingFiller::Action::FADE:
+            audio_manager->fade_out_prompts(AudioMixer::VOICE_EARCON);
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief 🔔 播放唤醒提示音（不阻塞）
+ */
+static void play_greeting() {
+    const PromptAsset* greeting = find_prompt(PROMPT_GREETING);
+    if (!greeting) {
+        ESP_LOGW(TAG, "⚠️ 没有提示音 '%s'", PROMPT_GREETING);
+        return;
+    }
+    audio_manager->play_prompt_async(greeting);
+}
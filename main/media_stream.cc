@@ -0,0 +1,604 @@
+/**
+ * @file media_stream.cc
+ * @brief 📻 服务器指定地址的长音频实现
+ */
+
+#include "media_stream.h"
+#include <stdio.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_http_client.h"
+#include "esp_crt_bundle.h"
+#include "audio_codec.h"
+#include "audio_manager.h"
+#include "task_factory.h"
+
+const char* MediaStream::TAG = "MediaStream";
+
+static const uint32_t kSampleRate = 16000;     // 和播放的采样率一致，文件不是这个采样率时不播
+static const size_t kReadChunk = 2048;         // 每次从HTTP读的字节数（也是esp_http_client的接收缓冲区）
+static const size_t kHeaderBytes = 512;        // "data"块要出现在文件的前这么多字节里
+static const size_t kDecodeSamples = 320;      // 播放任务每次解码后写进抖动缓冲区的样本数（20ms）
+static const int kQueueDepth = 4;
+
+static inline uint16_t le16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+static inline uint32_t le32(const uint8_t* p) { return (uint32_t)p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+MediaStream::MediaStream()
+    : audio_(nullptr)
+    , control_task_(nullptr)
+    , play_task_(nullptr)
+    , queue_(nullptr)
+    , ring_(nullptr)
+    , client_(nullptr)
+    , url_{}
+    , file_pos_(0)
+    , retries_(0)
+    , fetching_(false)
+    , header_ok_(false)
+    , format_(Format::PCM)
+    , data_start_(0)
+    , data_end_(UINT32_MAX)
+    , block_align_(2)
+    , hold_(false)
+    , play_run_(false)
+    , play_idle_(true)
+    , fetch_done_(false)
+    , interrupted_(false)
+    , finished_(false)
+    , ring_base_(0)
+    , fed_samples_(0)
+    , unplayed_(0)
+    , state_(State::IDLE)
+    , changed_(false)
+    , offset_(0)
+    , total_(0)
+    , rebuffers_(0)
+    , reason_("")
+{
+}
+
+esp_err_t MediaStream::init(AudioManager* audio) {
+    audio_ = audio;
+    ring_ = new SpscRing<uint8_t, MEDIA_PREFETCH_BYTES>("media_prefetch", Placement::PSRAM);
+    queue_ = xQueueCreate(kQueueDepth, sizeof(Request));
+    if (!ring_->isValid() || !queue_) {
+        ESP_LOGE(TAG, "❌ 长音频预取环分配失败（%u KB）", (unsigned)(MEDIA_PREFETCH_BYTES / 1024));
+        return ESP_ERR_NO_MEM;
+    }
+    // 两个任务都不碰Flash，栈放PSRAM
+    if (TaskFactory::create(control_task, "media_fetch", MEDIA_TASK_STACK, this, MEDIA_FETCH_TASK_PRIORITY,
+                            &control_task_, MEDIA_TASK_CORE, TaskStack::PSRAM) != pdPASS ||
+        TaskFactory::create(play_task, "media_play", 4 * 1024, this, MEDIA_PLAY_TASK_PRIORITY,
+                            &play_task_, MEDIA_TASK_CORE, TaskStack::PSRAM) != pdPASS) {
+        if (control_task_) {
+            TaskFactory::destroy(control_task_);
+            control_task_ = nullptr;
+        }
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "✓ 长音频直连已就绪（预取%u KB，攒够%d ms开始播）",
+             (unsigned)(MEDIA_PREFETCH_BYTES / 1024), MEDIA_PREFETCH_START_MS);
+    return ESP_OK;
+}
+
+bool MediaStream::play(const char* url, uint32_t offset_ms) {
+    if (!queue_ || !url || (strncmp(url, "http://", 7) != 0 && strncmp(url, "https://", 8) != 0) ||
+        strlen(url) >= URL_LEN) {
+        ESP_LOGW(TAG, "⚠️ 长音频地址不对，忽略");
+        return false;
+    }
+    Request req = {};
+    req.command = Command::PLAY;
+    req.offset_ms = offset_ms;
+    snprintf(req.url, sizeof(req.url), "%s", url);
+    return xQueueSend(queue_, &req, 0) == pdTRUE;
+}
+
+void MediaStream::pause() {
+    Request req = {};
+    req.command = Command::PAUSE;
+    if (queue_) {
+        xQueueSend(queue_, &req, 0);
+    }
+}
+
+void MediaStream::resume() {
+    Request req = {};
+    req.command = Command::RESUME;
+    if (queue_) {
+        xQueueSend(queue_, &req, 0);
+    }
+}
+
+void MediaStream::stop() {
+    Request req = {};
+    req.command = Command::STOP;
+    if (queue_) {
+        xQueueSend(queue_, &req, 0);
+    }
+}
+
+bool MediaStream::takeStatus(Status* out) {
+    if (!changed_.exchange(false)) {
+        return false;
+    }
+    out->state = state_.load();
+    out->offset = offset_.load();
+    out->total = total_.load();
+    out->played_ms = out->offset > data_start_
+                         ? (uint32_t)((uint64_t)(out->offset - data_start_) * 1000 / bytesPerSecond()) : 0;
+    out->rebuffers = rebuffers_.load();
+    out->reason = reason_.load();
+    return true;
+}
+
+const char* MediaStream::stateName(State state) {
+    switch (state) {
+        case State::IDLE: return "idle";
+        case State::BUFFERING: return "buffering";
+        case State::PLAYING: return "playing";
+        case State::PAUSED: return "paused";
+        case State::DONE: return "done";
+        case State::FAILED: return "failed";
+    }
+    return "?";
+}
+
+void MediaStream::publish(State state, const char* reason) {
+    reason_ = reason;
+    state_ = state;
+    changed_ = true;
+}
+
+/**
+ * @brief 每秒的文件字节数（ADPCM按解码器每块输出的样本数算，块头那个样本不输出）
+ */
+uint32_t MediaStream::bytesPerSecond() const {
+    if (format_ == Format::PCM) {
+        return kSampleRate * sizeof(int16_t);
+    }
+    return (uint32_t)((uint64_t)block_align_ * kSampleRate / ImaAdpcmDecoder::samplesInBlock(block_align_));
+}
+
+/**
+ * @brief 数据区内的偏移向下对齐到样本（PCM）或块（ADPCM）边界
+ */
+uint32_t MediaStream::alignOffset(uint32_t data_bytes) const {
+    uint32_t unit = format_ == Format::PCM ? sizeof(int16_t) : block_align_;
+    return data_bytes - data_bytes % unit;
+}
+
+/**
+ * @brief 已经播出的文件位置：写进抖动缓冲区的样本减去还没播的（ADPCM退到所在块的开头）
+ */
+uint32_t MediaStream::playedBytes() const {
+    uint32_t fed = fed_samples_.load();
+    uint32_t unplayed = unplayed_.load();
+    uint32_t played = fed > unplayed ? fed - unplayed : 0;
+    uint32_t bytes = format_ == Format::PCM
+                         ? played * sizeof(int16_t)
+                         : played / ImaAdpcmDecoder::samplesInBlock(block_align_) * block_align_;
+    return ring_base_.load() + bytes;
+}
+
+// ===== 下载任务 =====
+
+void MediaStream::control_task(void* arg) {
+    MediaStream* self = (MediaStream*)arg;
+    Request req;
+    TickType_t wait = portMAX_DELAY;
+    while (true) {
+        if (xQueueReceive(self->queue_, &req, wait) == pdTRUE) {
+            self->handle(req);
+        }
+        self->checkPlayback();
+        if (self->fetching_) {
+            wait = self->fetch();
+        } else {
+            // 只剩播放任务在跑时定时看一眼它是不是停了
+            wait = self->play_run_.load() ? pdMS_TO_TICKS(50) : portMAX_DELAY;
+        }
+    }
+}
+
+void MediaStream::handle(const Request& req) {
+    State state = state_.load();
+    switch (req.command) {
+        case Command::PLAY: {
+            haltPlayback();
+            closeConnection();
+            fetching_ = false;
+            snprintf(url_, sizeof(url_), "%s", req.url);
+            header_ok_ = false;
+            total_ = 0;
+            offset_ = 0;
+            rebuffers_ = 0;
+            ESP_LOGI(TAG, "📻 开始播放: %s（从%lu ms）", url_, (unsigned long)req.offset_ms);
+            esp_err_t ret = openAt(0);
+            const char* reason = ret == ESP_OK ? parseHeader() : "http";
+            if (reason) {
+                closeConnection();
+                publish(State::FAILED, reason);
+                ESP_LOGE(TAG, "❌ 长音频打不开: %s", reason);
+                break;
+            }
+            header_ok_ = true;
+            uint32_t target = data_start_ + alignOffset((uint32_t)((uint64_t)req.offset_ms * bytesPerSecond() / 1000));
+            if (target > data_end_) {
+                target = data_end_;
+            }
+            // 从头播时文件头后面读多的部分已经在预取环里，接着用这个连接
+            startFetch(target, target == data_start_);
+            break;
+        }
+        case Command::PAUSE:
+            if (state != State::BUFFERING && state != State::PLAYING) {
+                break;
+            }
+            haltPlayback();
+            closeConnection();      // 暂停可能很久，不占着连接，恢复时按位置重新请求
+            fetching_ = false;
+            offset_ = playedBytes();
+            publish(State::PAUSED, "server");
+            ESP_LOGI(TAG, "⏸️ 暂停在 %lu 字节", (unsigned long)offset_.load());
+            break;
+        case Command::RESUME:
+            if (state != State::PAUSED || !header_ok_) {
+                ESP_LOGW(TAG, "⚠️ 没有暂停着的长音频，忽略恢复");
+                break;
+            }
+            ESP_LOGI(TAG, "▶️ 从 %lu 字节恢复", (unsigned long)offset_.load());
+            startFetch(offset_.load(), false);
+            break;
+        case Command::STOP:
+            haltPlayback();
+            closeConnection();
+            fetching_ = false;
+            header_ok_ = false;
+            if (state != State::IDLE) {
+                offset_ = state == State::BUFFERING || state == State::PLAYING ? playedBytes() : offset_.load();
+                publish(State::IDLE);
+                ESP_LOGI(TAG, "⏹️ 停止播放");
+            }
+            break;
+    }
+}
+
+/**
+ * @brief 从文件偏移offset开始下载，连接由fetch()按Range建立
+ *
+ * 调用时播放任务是停着的。keep_prefetch=true时预取环里的数据和现在的连接正好从offset接上（文件头后面读多的部分）。
+ */
+void MediaStream::startFetch(uint32_t offset, bool keep_prefetch) {
+    if (!keep_prefetch) {
+        closeConnection();
+        ring_->clear();
+        file_pos_ = offset;
+    }
+    ring_base_ = offset;
+    fed_samples_ = 0;
+    unplayed_ = 0;
+    fetch_done_ = false;
+    retries_ = 0;
+    fetching_ = true;
+    publish(State::BUFFERING);
+}
+
+/**
+ * @brief 打开连接，offset>0时带Range；服务器不支持Range（回200）时读掉offset之前的部分
+ */
+esp_err_t MediaStream::openAt(uint32_t offset) {
+    esp_http_client_config_t config = {};
+    config.url = url_;
+    config.timeout_ms = MEDIA_HTTP_TIMEOUT_MS;
+    config.crt_bundle_attach = esp_crt_bundle_attach;
+    config.buffer_size = kReadChunk;
+    esp_http_client_handle_t client = esp_http_client_init(&config);
+    if (!client) {
+        return ESP_ERR_NO_MEM;
+    }
+    if (offset > 0) {
+        char range[32];
+        snprintf(range, sizeof(range), "bytes=%lu-", (unsigned long)offset);
+        esp_http_client_set_header(client, "Range", range);
+    }
+    esp_err_t ret = esp_http_client_open(client, 0);
+    int64_t length = ret == ESP_OK ? esp_http_client_fetch_headers(client) : -1;
+    int http_status = ret == ESP_OK ? esp_http_client_get_status_code(client) : 0;
+    if (ret != ESP_OK || (http_status != 200 && http_status != 206)) {
+        ESP_LOGW(TAG, "⚠️ 请求失败: %s, HTTP %d", esp_err_to_name(ret), http_status);
+        esp_http_client_cleanup(client);
+        return ret != ESP_OK ? ret : ESP_FAIL;
+    }
+    client_ = client;
+    file_pos_ = http_status == 206 ? offset : 0;
+    if (length > 0 && total_.load() == 0) {
+        total_ = file_pos_ + (uint32_t)length;
+    }
+    uint8_t skip[256];
+    while (file_pos_ < offset) {
+        uint32_t want = offset - file_pos_ < sizeof(skip) ? offset - file_pos_ : sizeof(skip);
+        int n = esp_http_client_read(client, (char*)skip, want);
+        if (n <= 0) {
+            closeConnection();
+            return ESP_FAIL;
+        }
+        file_pos_ += n;
+    }
+    return ESP_OK;
+}
+
+void MediaStream::closeConnection() {
+    if (client_) {
+        esp_http_client_close((esp_http_client_handle_t)client_);
+        esp_http_client_cleanup((esp_http_client_handle_t)client_);
+        client_ = nullptr;
+    }
+}
+
+/**
+ * @brief 读WAV文件头，定下格式和数据区；文件头后面已经读到的数据写进预取环（从头播时直接用）
+ *
+ * @return 出错原因，成功时为nullptr
+ */
+const char* MediaStream::parseHeader() {
+    uint8_t head[kHeaderBytes];
+    size_t len = 0;
+    while (len < sizeof(head)) {
+        int n = esp_http_client_read((esp_http_client_handle_t)client_, (char*)head + len, sizeof(head) - len);
+        if (n <= 0) {
+            break;
+        }
+        len += n;
+    }
+    file_pos_ = len;
+    if (len < 12 || memcmp(head, "RIFF", 4) != 0 || memcmp(head + 8, "WAVE", 4) != 0) {
+        return "format";
+    }
+    bool have_fmt = false;
+    size_t pos = 12;
+    while (pos + 8 <= len) {
+        const uint8_t* id = head + pos;
+        uint32_t size = le32(head + pos + 4);
+        size_t body = pos + 8;
+        if (memcmp(id, "fmt ", 4) == 0) {
+            if (body + 16 > len) {
+                return "format";
+            }
+            uint16_t tag = le16(head + body);
+            uint16_t channels = le16(head + body + 2);
+            uint32_t rate = le32(head + body + 4);
+            uint16_t align = le16(head + body + 12);
+            uint16_t bits = le16(head + body + 14);
+            if (channels != 1 || rate != kSampleRate) {
+                ESP_LOGE(TAG, "❌ 只支持%lu Hz单声道（文件是%lu Hz %u声道）",
+                         (unsigned long)kSampleRate, (unsigned long)rate, channels);
+                return "format";
+            }
+            if (tag == 1 && bits == 16) {
+                format_ = Format::PCM;
+                block_align_ = sizeof(int16_t);
+            } else if (tag == 0x11 && bits == 4 && align > ImaAdpcmDecoder::BLOCK_HEADER_SIZE) {
+                format_ = Format::ADPCM;
+                block_align_ = align;
+            } else {
+                ESP_LOGE(TAG, "❌ 不支持的WAV编码 0x%04x（%u位）", tag, bits);
+                return "format";
+            }
+            have_fmt = true;
+        } else if (memcmp(id, "data", 4) == 0) {
+            if (!have_fmt) {
+                return "format";
+            }
+            data_start_ = body;
+            // 边录边传的文件数据块长度写的是0或0xFFFFFFFF，一直读到连接结束
+            data_end_ = size == 0 || size == UINT32_MAX ? UINT32_MAX : body + size;
+            ESP_LOGI(TAG, "📻 %s，数据从%lu字节开始，%lu字节",
+                     format_ == Format::PCM ? "PCM16" : "IMA-ADPCM", (unsigned long)data_start_,
+                     (unsigned long)(data_end_ != UINT32_MAX ? size : 0));
+            // 读多了的那部分放进预取环，从头播时省一次请求（不从头播时startFetch()清掉重新请求）
+            ring_->clear();
+            if (len > body) {
+                size_t keep = len - body;
+                if (data_end_ != UINT32_MAX && keep > size) {
+                    keep = size;
+                }
+                ring_->write(head + body, keep);
+                file_pos_ = body + keep;
+            }
+            return nullptr;
+        }
+        pos = body + size + (size & 1);
+    }
+    return have_fmt ? "header" : "format";
+}
+
+/**
+ * @brief 读一段数据进预取环
+ *
+ * @return 下一次调用前最多等多久（预取环满了或者在退避时不为0，等待期间照常处理命令）
+ */
+TickType_t MediaStream::fetch() {
+    if (file_pos_ < data_end_) {
+        if (!client_ && openAt(file_pos_) != ESP_OK) {
+            if (++retries_ > MEDIA_RETRY_MAX) {
+                haltPlayback();
+                offset_ = playedBytes();
+                fetching_ = false;
+                publish(State::FAILED, "http");
+                ESP_LOGE(TAG, "❌ 重连%d次还是失败，放弃", MEDIA_RETRY_MAX);
+                return portMAX_DELAY;
+            }
+            return pdMS_TO_TICKS(MEDIA_RETRY_DELAY_MS * retries_);
+        }
+        auto span = ring_->writeSpan();
+        if (span.count == 0) {
+            return pdMS_TO_TICKS(20);       // 预取满了，等播放任务取走
+        }
+        size_t want = span.count < kReadChunk ? span.count : kReadChunk;
+        if (data_end_ != UINT32_MAX && want > data_end_ - file_pos_) {
+            want = data_end_ - file_pos_;   // 数据块后面的元数据不进预取环
+        }
+        int n = esp_http_client_read((esp_http_client_handle_t)client_, (char*)span.data, want);
+        if (n > 0) {
+            ring_->commitWrite(n);
+            file_pos_ += n;
+            retries_ = 0;
+            if (file_pos_ < data_end_) {
+                return 0;
+            }
+        } else if (n < 0 || !esp_http_client_is_complete_data_received((esp_http_client_handle_t)client_)) {
+            // 断线或读超时：从已收到的位置带Range重连
+            ESP_LOGW(TAG, "⚠️ 下载在 %lu 字节中断，重连", (unsigned long)file_pos_);
+            closeConnection();
+            return pdMS_TO_TICKS(MEDIA_RETRY_DELAY_MS);
+        }
+    }
+    closeConnection();
+    fetching_ = false;
+    fetch_done_ = true;
+    ESP_LOGI(TAG, "📻 下载完成（%lu 字节）", (unsigned long)file_pos_);
+    return pdMS_TO_TICKS(50);
+}
+
+/**
+ * @brief 预取够了让播放任务开始；播放任务自己停下（播完或被打断）时更新状态
+ */
+void MediaStream::checkPlayback() {
+    State state = state_.load();
+    if (state == State::BUFFERING && !play_run_.load()) {
+        size_t threshold = (size_t)bytesPerSecond() * MEDIA_PREFETCH_START_MS / 1000;
+        if (threshold > MEDIA_PREFETCH_BYTES * 3 / 4) {
+            threshold = MEDIA_PREFETCH_BYTES * 3 / 4;
+        }
+        if (ring_->size() >= threshold || fetch_done_.load()) {
+            interrupted_ = false;
+            finished_ = false;
+            play_idle_ = false;
+            play_run_ = true;
+            xTaskNotifyGive(play_task_);
+        }
+        return;
+    }
+    if (!play_run_.load() || !play_idle_.load()) {
+        return;
+    }
+    play_run_ = false;
+    if (finished_.load()) {
+        offset_ = file_pos_;
+        publish(State::DONE);
+        ESP_LOGI(TAG, "📻 播放完成（预取播空%lu次）", (unsigned long)rebuffers_.load());
+    } else if (interrupted_.load()) {
+        closeConnection();
+        fetching_ = false;
+        offset_ = playedBytes();
+        publish(State::PAUSED, "interrupted");
+        ESP_LOGI(TAG, "⏸️ 播放被打断，停在 %lu 字节", (unsigned long)offset_.load());
+    }
+}
+
+/**
+ * @brief 让播放任务停下并等它停好（它自己停掉这次流式播放）
+ */
+void MediaStream::haltPlayback() {
+    play_run_ = false;
+    while (!play_idle_.load()) {
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+}
+
+// ===== 播放任务 =====
+
+void MediaStream::play_task(void* arg) {
+    MediaStream* self = (MediaStream*)arg;
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (self->play_run_.load()) {
+            self->playLoop();
+        }
+        self->play_idle_ = true;
+    }
+}
+
+void MediaStream::playLoop() {
+    // 会话进行中或者服务器回复还在播：等它们结束再出声，预取照常进行
+    while (play_run_.load() && (hold_.load() || audio_->is_playing())) {
+        vTaskDelay(pdMS_TO_TICKS(50));
+    }
+    if (!play_run_.load()) {
+        return;
+    }
+    uint32_t generation = audio_->start_streaming_playback();
+    publish(State::PLAYING);
+
+    int16_t pcm[kDecodeSamples];
+    uint8_t in[kDecodeSamples / 2];     // ADPCM每字节两个样本，解码结果一定放得下
+    ImaAdpcmStreamDecoder adpcm;
+    size_t block_left = 0;              // 当前ADPCM块还剩的字节（起点总是对齐到块）
+    bool starved = false;
+    while (play_run_.load()) {
+        size_t avail = ring_->size();
+        if (avail < (format_ == Format::PCM ? sizeof(int16_t) : 1)) {
+            if (fetch_done_.load()) {
+                finished_ = true;
+                break;
+            }
+            if (!starved) {
+                starved = true;
+                rebuffers_++;
+                ESP_LOGW(TAG, "⚠️ 预取播空，等网络");
+            }
+            vTaskDelay(pdMS_TO_TICKS(20));
+            continue;
+        }
+        starved = false;
+
+        size_t samples = 0;
+        if (format_ == Format::PCM) {
+            size_t take = avail < sizeof(pcm) ? avail & ~(size_t)1 : sizeof(pcm);
+            ring_->read((uint8_t*)pcm, take);
+            samples = take / sizeof(int16_t);
+        } else {
+            size_t take = avail < sizeof(in) ? avail : sizeof(in);
+            ring_->read(in, take);
+            size_t pos = 0;
+            while (pos < take) {
+                if (block_left == 0) {
+                    adpcm.reset();
+                    block_left = block_align_;
+                }
+                size_t n = take - pos < block_left ? take - pos : block_left;
+                size_t used = 0;
+                samples += adpcm.decode(in + pos, n, pcm + samples, kDecodeSamples - samples, &used);
+                pos += used;
+                block_left -= used;
+            }
+        }
+
+        // 抖动缓冲区快满时在这里等，不在feed_local_audio()里等，暂停时能马上停下
+        while (play_run_.load() && audio_->get_unplayed_samples() + samples > JitterBuffer::capacity()) {
+            vTaskDelay(pdMS_TO_TICKS(PLAYBACK_CHUNK_MS));
+        }
+        if (!play_run_.load()) {
+            break;
+        }
+        unplayed_ = audio_->get_unplayed_samples();
+        if (samples > 0 && !audio_->feed_local_audio(pcm, samples, generation)) {
+            interrupted_ = true;    // 唤醒词、服务器回复顶掉了这次播放
+            break;
+        }
+        fed_samples_ += samples;
+    }
+
+    if (audio_->get_stream_generation() != generation) {
+        return;
+    }
+    if (finished_.load()) {
+        unplayed_ = 0;
+        audio_->finish_streaming_playback();
+    } else if (!interrupted_.load()) {
+        unplayed_ = audio_->get_unplayed_samples();
+        audio_->stop_streaming_playback();
+    }
+}
@@ -0,0 +1,165 @@
+/**
+ * @file media_stream.h
+ * @brief 📻 服务器指定地址的长音频 - 设备用HTTP(S)直接拉取、本地解码进播放的抖动缓冲区，中继只发控制消息
+ *
+ * 新闻、故事、音乐这类长音频原来也要由server.py按PCM一路转发，占中继的带宽和CPU。
+ * 服务器改发{"type":"media","action":"play","url":...}，设备自己下载：
+ *
+ * - 下载任务：esp_http_client按Range请求读进PSRAM里的预取环（MEDIA_PREFETCH_BYTES），
+ *   断线、读超时后从已收到的位置带Range重连（最多MEDIA_RETRY_MAX次），服务器不支持Range（回200）时跳过已收的部分
+ * - 播放任务：预取够MEDIA_PREFETCH_START_MS才开始出声，从预取环取数据解码后写进抖动缓冲区（feed_local_audio），
+ *   缓冲区满了就等播放任务消费；网络跟不上时预取环先顶着，空了记一次rebuffer
+ * - 格式：WAV里的16kHz单声道PCM16或IMA-ADPCM（和下行ADPCM同一个解码器），其它格式回报"format"失败
+ * - 暂停：停掉播放、断开HTTP，记下已经播出的位置（减去抖动缓冲区里还没播的样本）；恢复时按这个位置重新发Range请求
+ *
+ * 唤醒词、服务器回复打断播放时按暂停处理（reason=interrupted），要不要接着播由服务器决定。
+ * 会话进行中或服务器回复还在播时收到play，先预取，等回到空闲、回复播完再出声。
+ * 状态变化由主循环takeStatus()取出，发给服务器{"type":"media_status",...}。
+ */
+
+#ifndef MEDIA_STREAM_H
+#define MEDIA_STREAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "esp_err.h"
+#include "project_config.h"
+#include "spsc_ring.h"
+
+class AudioManager;
+
+class MediaStream {
+public:
+    static constexpr size_t URL_LEN = 256;
+
+    enum class State : uint8_t {
+        IDLE,           // 没有在播
+        BUFFERING,      // 已开始下载，预取还不够（或者在等服务器回复播完）
+        PLAYING,        // 正在出声
+        PAUSED,         // 暂停（服务器要求或被打断），记着位置
+        DONE,           // 播完
+        FAILED,         // 下载或格式出错
+    };
+
+    struct Status {
+        State state;
+        uint32_t offset;        // 已播出的位置（文件字节偏移，恢复时从这里请求）
+        uint32_t total;         // 文件总字节（不知道时为0）
+        uint32_t played_ms;     // 已播出的音频时长
+        uint32_t rebuffers;     // 预取环播空的次数
+        const char* reason;     // 暂停/失败原因（静态字符串），其余状态为""
+    };
+
+    MediaStream();
+
+    /**
+     * @brief 分配预取环、创建下载和播放任务
+     */
+    esp_err_t init(AudioManager* audio);
+
+    bool isAvailable() const { return control_task_ != nullptr; }
+
+    /**
+     * @brief 开始播放一个地址（正在播的先停掉）；主循环调用，不阻塞
+     *
+     * @param url HTTP(S)地址
+     * @param offset_ms 从这么多毫秒处开始（0=从头）
+     */
+    bool play(const char* url, uint32_t offset_ms);
+    void pause();
+    void resume();
+    void stop();
+
+    /**
+     * @brief 会话进行中先不出声（主循环调用）：预取照常，回到空闲后再开始
+     */
+    void setHold(bool hold) { hold_ = hold; }
+
+    /**
+     * @brief 正在下载或出声（这时不能进深度睡眠）
+     */
+    bool isActive() const {
+        State state = state_.load();
+        return state == State::BUFFERING || state == State::PLAYING;
+    }
+
+    /**
+     * @brief 取出变化了的状态，没有变化时返回false
+     */
+    bool takeStatus(Status* out);
+
+    static const char* stateName(State state);
+
+private:
+    static const char* TAG;
+
+    enum class Command : uint8_t { PLAY, PAUSE, RESUME, STOP };
+
+    struct Request {
+        Command command;
+        uint32_t offset_ms;
+        char url[URL_LEN];
+    };
+
+    enum class Format : uint8_t { PCM, ADPCM };
+
+    static void control_task(void* arg);
+    static void play_task(void* arg);
+    void handle(const Request& req);
+    TickType_t fetch();
+    esp_err_t openAt(uint32_t offset);
+    void closeConnection();
+    const char* parseHeader();
+    void startFetch(uint32_t offset, bool keep_prefetch);
+    void haltPlayback();
+    void checkPlayback();
+    uint32_t bytesPerSecond() const;
+    uint32_t alignOffset(uint32_t data_bytes) const;
+    uint32_t playedBytes() const;
+    void playLoop();
+    void publish(State state, const char* reason = "");
+
+    AudioManager* audio_;
+    TaskHandle_t control_task_;
+    TaskHandle_t play_task_;
+    QueueHandle_t queue_;
+    SpscRing<uint8_t, MEDIA_PREFETCH_BYTES>* ring_;    // 下载任务写，播放任务读；两边都停着时下载任务清空
+
+    // 以下只在下载任务中访问
+    void* client_;              // esp_http_client_handle_t
+    char url_[URL_LEN];
+    uint32_t file_pos_;         // 下一个要从网络读的文件偏移
+    uint32_t retries_;
+    bool fetching_;
+    bool header_ok_;            // 这个地址的文件头已经解析过（恢复时直接按偏移请求）
+
+    // 文件格式（下载任务解析文件头后写入，播放任务开始前已经定了）
+    Format format_;
+    uint32_t data_start_;       // 音频数据在文件里的起点
+    uint32_t data_end_;         // 音频数据的终点（不知道时为UINT32_MAX）
+    uint32_t block_align_;      // ADPCM每块字节数
+
+    // 两个任务之间的握手
+    std::atomic<bool> hold_;
+    std::atomic<bool> play_run_;        // 下载任务让播放任务开始/停止
+    std::atomic<bool> play_idle_;       // 播放任务已经停下
+    std::atomic<bool> fetch_done_;      // 数据已经全部进了预取环（下载任务写，播放任务读）
+    std::atomic<bool> interrupted_;     // 播放被别的播放打断（播放任务写）
+    std::atomic<bool> finished_;        // 播到了结尾（播放任务写）
+    std::atomic<uint32_t> ring_base_;   // 预取环读位置0对应的文件偏移
+    std::atomic<uint32_t> fed_samples_; // 已写进抖动缓冲区的样本数（从ring_base_算起）
+    std::atomic<uint32_t> unplayed_;    // 最近一次看到的抖动缓冲区里还没播的样本数
+
+    std::atomic<State> state_;
+    std::atomic<bool> changed_;
+    std::atomic<uint32_t> offset_;
+    std::atomic<uint32_t> total_;
+    std::atomic<uint32_t> rebuffers_;
+    std::atomic<const char*> reason_;
+};
+
+#endif // MEDIA_STREAM_H
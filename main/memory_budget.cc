@@ -0,0 +1,217 @@
+/**
+ * @file memory_budget.cc
+ * @brief 📐 内存预算实现（计划用量表和编译时检查）
+ */
+
+#include "memory_budget.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "sdkconfig.h"
+#include "project_config.h"
+#include "audio_manager.h"
+#include "udp_audio.h"
+#include "websocket_client.h"
+#include "wifi_manager.h"
+
+const char* MemoryBudget::TAG = "MemoryBudget";
+
+static constexpr size_t kInternal = (size_t)HeapRegion::INTERNAL;
+static constexpr size_t kPsram = (size_t)HeapRegion::PSRAM;
+
+#if !CONFIG_SPIRAM && !LOW_MEMORY_PROFILE
+#error "没有PSRAM的构建需要 -DLOW_MEMORY_PROFILE=1（见project_config.h的低内存配置和sdkconfig.defaults.nopsram）"
+#endif
+
+// 没有PSRAM时计划放在PSRAM的分配都落到内部RAM，计划用量表按实际去处算
+#if CONFIG_SPIRAM
+static constexpr bool kPsramPresent = true;
+#else
+static constexpr bool kPsramPresent = false;
+#endif
+
+static constexpr uint32_t on_internal(uint32_t internal, uint32_t psram) {
+    return kPsramPresent ? internal : internal + psram;
+}
+
+static constexpr uint32_t on_psram(uint32_t psram) {
+    return kPsramPresent ? psram : 0;
+}
+
+// 🧮 计划用量：只算能从常量推出来的分配，驱动和库内部的部分由预算的余量兜住
+// 超过4KB的new/malloc按CONFIG_SPIRAM_MALLOC_ALWAYSINTERNAL落到PSRAM，各类的成员缓冲区随对象算在PSRAM
+
+#ifdef CONFIG_LWIP_TCPIP_TASK_STACK_SIZE
+static constexpr uint32_t kTcpipStack = CONFIG_LWIP_TCPIP_TASK_STACK_SIZE;
+#else
+static constexpr uint32_t kTcpipStack = 3072;
+#endif
+// 低内存构建只能用LOW_MEMORY配置（runtime_config不让切到更大的）
+static constexpr uint32_t kProfileStaticRx = LOW_MEMORY_PROFILE ? WiFiManager::LOW_MEMORY_STATIC_RX_BUFFERS
+                                                                : WiFiManager::MAX_STATIC_RX_BUFFERS;
+#ifdef CONFIG_ESP_WIFI_STATIC_RX_BUFFER_NUM
+static constexpr uint32_t kStaticRxBuffers = CONFIG_ESP_WIFI_STATIC_RX_BUFFER_NUM > kProfileStaticRx
+                                                 ? CONFIG_ESP_WIFI_STATIC_RX_BUFFER_NUM : kProfileStaticRx;
+#else
+static constexpr uint32_t kStaticRxBuffers = kProfileStaticRx;
+#endif
+
+// 收发突发时驱动和lwIP的动态缓冲区：一个TCP接收窗口加一个发送缓冲区的包，再加几个管理帧
+static constexpr uint32_t kWifiDynamicPeak = ((CONFIG_LWIP_TCP_WND_DEFAULT + CONFIG_LWIP_TCP_SND_BUF_DEFAULT)
+                                              / CONFIG_LWIP_TCP_MSS + 4) * WiFiManager::STATIC_RX_BUFFER_BYTES;
+
+// WiFi：静态接收缓冲区按最大的性能配置算（运行时可以切到HIGH_THROUGHPUT）
+static constexpr uint32_t kWifiInternal = kStaticRxBuffers * WiFiManager::STATIC_RX_BUFFER_BYTES
+                                        + kTcpipStack + WiFiManager::MONITOR_TASK_STACK;
+
+// 网络：WebSocket任务（wss://时栈更大）、发送任务、网络任务、UDP接收任务的栈在内部RAM
+static constexpr uint32_t kWsTaskStack = WebSocketClient::TLS_TASK_STACK_SIZE > WebSocketClient::TASK_STACK_SIZE
+                                             ? WebSocketClient::TLS_TASK_STACK_SIZE : WebSocketClient::TASK_STACK_SIZE;
+static constexpr uint32_t kNetworkInternal = kWsTaskStack + WebSocketClient::SEND_TASK_STACK_SIZE + NETWORK_TASK_STACK
+                                           + (UDP_AUDIO_ENABLE ? UDP_AUDIO_TASK_STACK : 0)
+                                           + (SOAK_TEST && SOAK_LOAD_KBPS > 0 ? SOAK_LOAD_TASK_STACK : 0);
+static constexpr uint32_t kAudioSlotBytes = UPLINK_COALESCE_FRAMES * AUDIO_FRAME_SAMPLES * sizeof(int16_t)
+                                          + AudioFraming::HEADER_BYTES;
+static constexpr uint32_t kNetworkPsram = sizeof(WebSocketClient) + 2 * WebSocketClient::BUFFER_SIZE
+                                        + WS_SEND_CONTROL_SLOTS * WS_SEND_CONTROL_SLOT_BYTES
+                                        + WS_SEND_AUDIO_SLOTS * kAudioSlotBytes
+                                        + WS_SEND_BULK_SLOTS * WS_SEND_BULK_SLOT_BYTES
+                                        + WebSocketClient::EVENT_QUEUE_LEN * WebSocketClient::EVENT_DATA_BYTES
+                                        + WebSocketClient::EVENT_TASK_STACK_SIZE
+                                        + WORK_QUEUE_WORKERS * WORK_QUEUE_TASK_STACK
+                                        + (DEFERRED_LOG_ENABLE ? DEFERRED_LOG_TASK_STACK : 0)
+                                        + (UDP_AUDIO_ENABLE ? sizeof(UdpAudio) : 0);
+
+// 板级：I2S的DMA缓冲区由驱动分配在内部RAM
+static constexpr uint32_t kBoardInternal = I2S_RX_DMA_DESC_NUM * I2S_RX_DMA_FRAME_NUM * MIC_CHANNELS * MIC_CAPTURE_BITS / 8
+                                         + I2S_TX_DMA_DESC_NUM * I2S_TX_DMA_FRAME_NUM * sizeof(int16_t)
+                                         + I2S_CAPTURE_TASK_STACK;
+
+// 音频：三个音频任务栈、上行发送队列、帧池（放在内部RAM时）、提示音内存池
+static constexpr uint32_t kFramePoolBytes = AUDIO_FRAME_POOL_SLOTS * AUDIO_FRAME_SAMPLES * sizeof(int16_t);
+static constexpr uint32_t kAudioInternal = PLAYBACK_TASK_STACK + AUDIO_RECORD_TASK_STACK + AUDIO_SEND_TASK_STACK
+                                         + AUDIO_SEND_QUEUE_DEPTH * sizeof(AudioQueueItem)
+                                         + (AUDIO_FRAME_POOL_USE_PSRAM ? 0 : kFramePoolBytes)
+                                         + SESSION_ARENA_BYTES;
+// AudioManager对象本身带着采集环、抖动缓冲区和会话预录；上行补发缓存每帧一个帧池槽位；上一轮回复的缓存
+static constexpr uint32_t kAudioPsram = sizeof(AudioManager)
+                                      + (AUDIO_FRAME_POOL_USE_PSRAM ? kFramePoolBytes : 0)
+                                      + UPLINK_BACKLOG_MS / AUDIO_FRAME_MS * AUDIO_FRAME_SAMPLES * sizeof(int16_t)
+                                      + SESSION_CAPTURE_SEC * 16000 * sizeof(int16_t)
+                                      + (REPLY_CACHE_ENABLE ? REPLY_CACHE_BYTES : 0);
+
+// 模型：AFE和模型库内部的分配看不到，只算取数任务栈
+static constexpr uint32_t kModelsInternal = AFE_FETCH_TASK_STACK;
+
+static constexpr MemoryBudget::Entry kEntries[(size_t)MemSubsystem::COUNT] = {
+    { "wifi",    { kWifiInternal, 0 },
+                 { MEM_BUDGET_WIFI_INTERNAL,    MEM_BUDGET_WIFI_PSRAM } },
+    { "network", { on_internal(kNetworkInternal, kNetworkPsram), on_psram(kNetworkPsram) },
+                 { MEM_BUDGET_NETWORK_INTERNAL, MEM_BUDGET_NETWORK_PSRAM } },
+    { "board",   { kBoardInternal, 0 },
+                 { MEM_BUDGET_BOARD_INTERNAL,   MEM_BUDGET_BOARD_PSRAM } },
+    { "audio",   { on_internal(kAudioInternal, kAudioPsram), on_psram(kAudioPsram) },
+                 { MEM_BUDGET_AUDIO_INTERNAL,   MEM_BUDGET_AUDIO_PSRAM } },
+    { "models",  { kModelsInternal, 0 },
+                 { MEM_BUDGET_MODELS_INTERNAL,  MEM_BUDGET_MODELS_PSRAM } },
+};
+
+static constexpr bool plans_fit() {
+    for (const MemoryBudget::Entry& e : kEntries) {
+        if (e.planned[kInternal] > e.budget[kInternal] || e.planned[kPsram] > e.budget[kPsram]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static constexpr uint32_t budget_total(size_t region) {
+    uint32_t total = 0;
+    for (const MemoryBudget::Entry& e : kEntries) {
+        total += e.budget[region];
+    }
+    return total;
+}
+
+static_assert(plans_fit(), "某个子系统的计划用量超过了MEM_BUDGET_*，见memory_budget.cc的计划用量表");
+static_assert(budget_total(kInternal) + TASK_INTERNAL_HEAP_WARN_BYTES <= MEM_INTERNAL_HEAP_BYTES,
+              "内部RAM预算之和加上TASK_INTERNAL_HEAP_WARN_BYTES的余量超过了MEM_INTERNAL_HEAP_BYTES");
+static_assert(kPsramPresent || budget_total(kInternal) + kWifiDynamicPeak + TASK_INTERNAL_HEAP_WARN_BYTES
+                                    <= MEM_INTERNAL_HEAP_BYTES,
+              "没有PSRAM时内部RAM预算之和加上WiFi突发和余量超过了MEM_INTERNAL_HEAP_BYTES，调小lwIP窗口或各MEM_BUDGET_*");
+static_assert(budget_total(kPsram) <= MEM_PSRAM_HEAP_BYTES, "PSRAM预算之和超过了MEM_PSRAM_HEAP_BYTES");
+static_assert(AUDIO_FRAME_POOL_SLOTS > AUDIO_SEND_QUEUE_DEPTH, "AUDIO_FRAME_POOL_SLOTS需大于发送队列深度");
+
+static constexpr uint32_t kCaps[(size_t)HeapRegion::COUNT] = { MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT, MALLOC_CAP_SPIRAM };
+
+// 每个子系统只在一个任务里begin/end，不用加锁
+static uint32_t s_free_before[(size_t)MemSubsystem::COUNT][(size_t)HeapRegion::COUNT];
+static uint32_t s_used[(size_t)MemSubsystem::COUNT][(size_t)HeapRegion::COUNT];
+
+void MemoryBudget::begin(MemSubsystem subsystem) {
+    for (size_t r = 0; r < (size_t)HeapRegion::COUNT; r++) {
+        s_free_before[(size_t)subsystem][r] = heap_caps_get_free_size(kCaps[r]);
+    }
+}
+
+void MemoryBudget::end(MemSubsystem subsystem) {
+    for (size_t r = 0; r < (size_t)HeapRegion::COUNT; r++) {
+        uint32_t before = s_free_before[(size_t)subsystem][r];
+        uint32_t after = heap_caps_get_free_size(kCaps[r]);
+        s_used[(size_t)subsystem][r] += before > after ? before - after : 0;
+    }
+}
+
+const MemoryBudget::Entry& MemoryBudget::entry(MemSubsystem subsystem) {
+    return kEntries[(size_t)subsystem];
+}
+
+uint32_t MemoryBudget::used(MemSubsystem subsystem, HeapRegion region) {
+    return s_used[(size_t)subsystem][(size_t)region];
+}
+
+void MemoryBudget::logReport() {
+    static const char* const kRegionNames[(size_t)HeapRegion::COUNT] = { "内部RAM", "PSRAM" };
+    uint32_t used_total[(size_t)HeapRegion::COUNT] = {};
+    ESP_LOGI(TAG, "📐 内存预算（计划/实测/预算，KB）:");
+    for (size_t i = 0; i < (size_t)MemSubsystem::COUNT; i++) {
+        const Entry& e = kEntries[i];
+        ESP_LOGI(TAG, "   %-8s 内部RAM %4lu/%4lu/%4lu  PSRAM %5lu/%5lu/%5lu", e.name,
+                 (unsigned long)e.planned[kInternal] / 1024, (unsigned long)s_used[i][kInternal] / 1024,
+                 (unsigned long)e.budget[kInternal] / 1024, (unsigned long)e.planned[kPsram] / 1024,
+                 (unsigned long)s_used[i][kPsram] / 1024, (unsigned long)e.budget[kPsram] / 1024);
+        for (size_t r = 0; r < (size_t)HeapRegion::COUNT; r++) {
+            used_total[r] += s_used[i][r];
+            if (s_used[i][r] > e.budget[r]) {
+                ESP_LOGW(TAG, "⚠️ %s在%s上实测占用 %lu 字节，超过预算 %lu", e.name, kRegionNames[r],
+                         (unsigned long)s_used[i][r], (unsigned long)e.budget[r]);
+            }
+        }
+    }
+    static constexpr uint32_t kAssumed[(size_t)HeapRegion::COUNT] = { MEM_INTERNAL_HEAP_BYTES, MEM_PSRAM_HEAP_BYTES };
+    for (size_t r = 0; r < (size_t)HeapRegion::COUNT; r++) {
+        uint32_t total = heap_caps_get_total_size(kCaps[r]);
+        ESP_LOGI(TAG, "   %s: 堆容量 %lu KB（预算按 %lu KB），子系统合计 %lu KB，预算合计 %lu KB，现在空闲 %lu KB",
+                 kRegionNames[r], (unsigned long)total / 1024, (unsigned long)kAssumed[r] / 1024,
+                 (unsigned long)used_total[r] / 1024, (unsigned long)budget_total(r) / 1024,
+                 (unsigned long)heap_caps_get_free_size(kCaps[r]) / 1024);
+        if (total < kAssumed[r]) {
+            ESP_LOGW(TAG, "⚠️ %s的堆比预算假定的小 %lu 字节，编译时的检查不再可靠，请调小MEM_*_HEAP_BYTES",
+                     kRegionNames[r], (unsigned long)(kAssumed[r] - total));
+        }
+        if (!kPsramPresent) {
+            break;
+        }
+    }
+    if (!kPsramPresent) {
+        // 没有PSRAM时WiFi突发的动态缓冲区也从这里面出，剩下的要够它加上余量
+        uint32_t free_bytes = heap_caps_get_free_size(kCaps[kInternal]);
+        uint32_t headroom = free_bytes > kWifiDynamicPeak ? free_bytes - kWifiDynamicPeak : 0;
+        ESP_LOGI(TAG, "🪶 没有PSRAM：内部RAM空闲 %lu KB，最大块 %lu KB，WiFi突发约 %lu KB，余下 %lu KB",
+                 (unsigned long)free_bytes / 1024,
+                 (unsigned long)heap_caps_get_largest_free_block(kCaps[kInternal]) / 1024,
+                 (unsigned long)kWifiDynamicPeak / 1024, (unsigned long)headroom / 1024);
+        if (headroom < TASK_INTERNAL_HEAP_WARN_BYTES) {
+            ESP_LOGW(TAG, "⚠️ 扣掉WiFi突发后内部RAM只剩 %lu 字节，低于TASK_INTERNAL_HEAP_WARN_BYTES", (unsigned long)headroom);
+        }
+    }
+}
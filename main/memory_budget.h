@@ -0,0 +1,71 @@
+/**
+ * @file memory_budget.h
+ * @brief 📐 内存预算 - 每个子系统在内部RAM/PSRAM上的预算，编译时检查计划用量，启动后对照实测
+ *
+ * 内部RAM只有三百多KB，WiFi、I2S DMA、音频任务栈和模型运行时状态都要从里面分。以前哪个改动
+ * 多占了十几KB，要等到WiFi动态缓冲区分配失败、吞吐塌掉才发现。现在分两层看：
+ *
+ * - 编译时（memory_budget.cc）：按project_config.h和各模块的常量（任务栈、DMA描述符、队列深度、
+ *   缓冲区容量）算出每个子系统的计划用量，static_assert计划不超过MEM_BUDGET_*，
+ *   所有子系统的内部RAM预算加上TASK_INTERNAL_HEAP_WARN_BYTES的余量不超过MEM_INTERNAL_HEAP_BYTES。
+ *   改大一个栈或缓冲区超了预算就编译不过，要么改回去，要么明确地调整预算
+ * - 运行时：app_main和网络任务在每个子系统初始化前后调用begin()/end()，按两类堆的空闲量之差
+ *   记下实测占用，启动完成后logReport()列出计划、实测、预算和堆的实际容量，超预算的打警告
+ *
+ * 计划用量只算能从常量推出来的部分（驱动和模型库内部的分配看不到），预算要留出这部分余量；
+ * 报告里实测和计划差得多的子系统就是有没登记的分配。
+ * 主任务和网络任务的初始化同时进行，两边的分配会互相计入对方的区间，
+ * 单个子系统的实测可能偏几KB，所有子系统的合计是准的。
+ */
+
+#ifndef MEMORY_BUDGET_H
+#define MEMORY_BUDGET_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "heap_monitor.h"
+
+enum class MemSubsystem : uint8_t {
+    WIFI,           // WiFi驱动、lwIP、链路监测（网络任务中初始化）
+    NETWORK,        // WebSocket客户端、中继选择、UDP音频通道、网络任务
+    BOARD,          // I2S采集/播放
+    AUDIO,          // 音频管理器、提示音、帧池、上行任务
+    MODELS,         // 模型映射、AFE和唤醒词
+    COUNT
+};
+
+class MemoryBudget {
+public:
+    struct Entry {
+        const char* name;
+        uint32_t planned[(size_t)HeapRegion::COUNT];    // 按常量算出的计划用量
+        uint32_t budget[(size_t)HeapRegion::COUNT];     // MEM_BUDGET_*
+    };
+
+    /**
+     * @brief 子系统开始初始化（同一个子系统可以分几段begin/end，实测累加）
+     */
+    static void begin(MemSubsystem subsystem);
+
+    /**
+     * @brief 子系统这一段初始化结束，累加两类堆的空闲量之差
+     */
+    static void end(MemSubsystem subsystem);
+
+    static const Entry& entry(MemSubsystem subsystem);
+
+    /**
+     * @brief 实测占用（字节）
+     */
+    static uint32_t used(MemSubsystem subsystem, HeapRegion region);
+
+    /**
+     * @brief 在日志中列出每个子系统的计划/实测/预算和堆的容量，超预算时告警
+     */
+    static void logReport();
+
+private:
+    static const char* TAG;
+};
+
+#endif // MEMORY_BUDGET_H
@@ -0,0 +1,245 @@
+/**
+ * @file mic_conditioner.cc
+ * @brief 🎚️ 麦克风输入调理实现
+ */
+
+#include "mic_conditioner.h"
+#include "esp_log.h"
+#include "buffer_placement.h"
+#include "realtime_audio.h"
+#include "sample_format.h"
+#include "esp_cpu.h"
+#include "dsps_add.h"
+#include "dsps_mul.h"
+#include "dsps_dotprod.h"
+
+const char* MicConditioner::TAG = "MicConditioner";
+
+// 直流估计的平滑系数：每块向块均值靠近1/8（右移3位）
+static const int kDcSmoothShift = 3;
+// 统计多少块打印一次耗时
+static const uint32_t kProfileBlocks = 500;
+
+MicConditioner::MicConditioner()
+    : dc_block_(false)
+    , channels_(1)
+    , gain_shift_(0)
+    , gain_frac_q15_(32768)
+    , mean_coef_(nullptr)
+    , mean_coef_left_(nullptr)
+    , dc_offset_(nullptr)
+    , gain_frac_(nullptr)
+    , capacity_(0)
+    , mean_count_(0)
+    , dc_estimate_q4_{}
+    , dc_applied_{}
+#if MIC_CONDITIONER_PROFILE
+    , profile_cycles_(0)
+    , profile_blocks_(0)
+#endif
+{
+}
+
+MicConditioner::~MicConditioner() {
+    BufferPlacement::free(mean_coef_);
+    BufferPlacement::free(mean_coef_left_);
+    BufferPlacement::free(dc_offset_);
+    BufferPlacement::free(gain_frac_);
+}
+
+esp_err_t MicConditioner::configure(bool dc_block, float gain, int channels) {
+    if (!(gain > 0.0f && gain <= 64.0f)) {
+        ESP_LOGE(TAG, "❌ 增益超出范围: %.2f", gain);
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (channels != 1 && channels != 2) {
+        ESP_LOGE(TAG, "❌ 不支持的声道数: %d", channels);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // 拆成 2^k × frac，frac落在(0.5, 1]，1.0时不需要乘法
+    int shift = 0;
+    while (gain > 1.0f) {
+        gain *= 0.5f;
+        shift++;
+    }
+    int32_t frac = (int32_t)(gain * 32768.0f + 0.5f);
+    if (frac >= 32768) {
+        frac = 32768;
+    }
+
+    if (channels != channels_) {
+        // 左声道系数向量只在双声道时分配
+        mean_count_ = 0;
+    }
+    dc_block_ = dc_block;
+    channels_ = channels;
+    gain_shift_ = shift;
+    gain_frac_q15_ = frac;
+    for (int ch = 0; ch < 2; ch++) {
+        dc_estimate_q4_[ch] = 0;
+        dc_applied_[ch] = 0;
+    }
+    if (gain_frac_ && frac < 32768) {
+        fillVector(gain_frac_, (int16_t)frac, capacity_);
+    }
+    if (dc_offset_) {
+        fillVector(dc_offset_, 0, capacity_);
+    }
+
+    ESP_LOGI(TAG, "🎚️ 麦克风调理: 去直流=%s, 增益=2^%d×%.3f, %d声道",
+             dc_block ? "开" : "关", shift, frac / 32768.0f, channels);
+    return ESP_OK;
+}
+
+void AUDIO_HOT_IRAM MicConditioner::fillVector(int16_t* vec, int16_t value, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        vec[i] = value;
+    }
+}
+
+void AUDIO_HOT_IRAM MicConditioner::fillInterleaved(int16_t* vec, int16_t even, int16_t odd, size_t count) {
+    for (size_t i = 0; i + 1 < count; i += 2) {
+        vec[i] = even;
+        vec[i + 1] = odd;
+    }
+}
+
+void AUDIO_HOT_IRAM MicConditioner::fillDcOffset() {
+    if (channels_ == 2) {
+        fillInterleaved(dc_offset_, (int16_t)-dc_applied_[0], (int16_t)-dc_applied_[1], capacity_);
+    } else {
+        fillVector(dc_offset_, (int16_t)-dc_applied_[0], capacity_);
+    }
+}
+
+static inline int32_t saturate16(int32_t v) {
+    return SampleTraits<int16_t>::saturate(v);
+}
+
+void AUDIO_HOT_IRAM MicConditioner::narrow32(int32_t* data, size_t count, int shift) {
+    SampleConvert<int32_t, int16_t>::run(data, reinterpret_cast<int16_t*>(data), count, shift);
+}
+
+bool MicConditioner::ensureCapacity(size_t count) {
+    if (count <= capacity_ && (channels_ == 1 || mean_coef_left_)) {
+        return true;
+    }
+
+    // vld.128要求16字节对齐（BufferPlacement保证）
+    size_t bytes = ((count + 7) & ~(size_t)7) * sizeof(int16_t);
+    int16_t* mean_coef = (int16_t*)BufferPlacement::alloc("mic_mean_coef", bytes, Placement::INTERNAL);
+    int16_t* mean_coef_left = channels_ == 2
+        ? (int16_t*)BufferPlacement::alloc("mic_mean_left", bytes, Placement::INTERNAL) : nullptr;
+    int16_t* dc_offset = (int16_t*)BufferPlacement::alloc("mic_dc_offset", bytes, Placement::INTERNAL);
+    int16_t* gain_frac = (int16_t*)BufferPlacement::alloc("mic_gain_frac", bytes, Placement::INTERNAL);
+    if (!mean_coef || (channels_ == 2 && !mean_coef_left) || !dc_offset || !gain_frac) {
+        ESP_LOGE(TAG, "❌ 无法分配调理向量 (%u字节×%d)", (unsigned)bytes, channels_ == 2 ? 4 : 3);
+        BufferPlacement::free(mean_coef);
+        BufferPlacement::free(mean_coef_left);
+        BufferPlacement::free(dc_offset);
+        BufferPlacement::free(gain_frac);
+        return false;
+    }
+
+    BufferPlacement::free(mean_coef_);
+    BufferPlacement::free(mean_coef_left_);
+    BufferPlacement::free(dc_offset_);
+    BufferPlacement::free(gain_frac_);
+    mean_coef_ = mean_coef;
+    mean_coef_left_ = mean_coef_left;
+    dc_offset_ = dc_offset;
+    gain_frac_ = gain_frac;
+    capacity_ = bytes / sizeof(int16_t);
+    mean_count_ = 0;
+
+    fillDcOffset();
+    fillVector(gain_frac_, (int16_t)(gain_frac_q15_ < 32768 ? gain_frac_q15_ : 32767), capacity_);
+    return true;
+}
+
+void AUDIO_HOT_IRAM MicConditioner::processScalar(int16_t* samples, size_t count) {
+    int32_t dc[2] = { dc_block_ ? dc_applied_[0] : 0, dc_block_ ? dc_applied_[channels_ - 1] : 0 };
+    size_t channel_mask = channels_ - 1;
+    for (size_t i = 0; i < count; i++) {
+        int32_t v = saturate16((int32_t)samples[i] - dc[i & channel_mask]);
+        if (gain_frac_q15_ < 32768) {
+            v = (v * gain_frac_q15_) >> 15;
+        }
+        v = saturate16(v << gain_shift_);
+        samples[i] = (int16_t)v;
+    }
+}
+
+void AUDIO_HOT_IRAM MicConditioner::process(int16_t* samples, size_t count) {
+    if (!isActive() || count < 8) {
+        return;
+    }
+    if (!ensureCapacity(count) || (count % channels_) != 0) {
+        return;
+    }
+
+#if MIC_CONDITIONER_PROFILE
+    esp_cpu_cycle_count_t start = esp_cpu_get_cycle_count();
+#endif
+
+    if (dc_block_) {
+        if (mean_count_ != count) {
+            // 点积 Σx·(32768/n) >> 15 就是块均值
+            fillVector(mean_coef_, (int16_t)(32768 / count), count);
+            if (channels_ == 2) {
+                fillInterleaved(mean_coef_left_, (int16_t)(32768 / (count / 2)), 0, count);
+            }
+            mean_count_ = count;
+        }
+        int16_t mean = 0;
+        dsps_dotprod_s16(samples, mean_coef_, &mean, (int)count, 0);
+        int32_t means[2] = { mean, mean };
+        if (channels_ == 2) {
+            // 整体均值是两个声道均值的平均
+            int16_t left = 0;
+            dsps_dotprod_s16(samples, mean_coef_left_, &left, (int)count, 0);
+            means[0] = left;
+            means[1] = saturate16(2 * (int32_t)mean - left);
+        }
+
+        // 直流变化很慢，估计值偏离超过1 LSB才重写偏置向量（1 LSB的残留可以忽略）
+        bool changed = false;
+        for (int ch = 0; ch < channels_; ch++) {
+            dc_estimate_q4_[ch] += ((means[ch] << 4) - dc_estimate_q4_[ch]) >> kDcSmoothShift;
+            int16_t dc = (int16_t)((dc_estimate_q4_[ch] + 8) >> 4);
+            if (dc - dc_applied_[ch] > 1 || dc_applied_[ch] - dc > 1) {
+                dc_applied_[ch] = dc;
+                changed = true;
+            }
+        }
+        if (changed) {
+            fillDcOffset();
+        }
+    }
+
+    if (((uintptr_t)samples & 15) != 0 || (count & 7) != 0) {
+        processScalar(samples, count);
+    } else {
+        if (dc_block_ && (dc_applied_[0] != 0 || dc_applied_[1] != 0)) {
+            dsps_add_s16(samples, dc_offset_, samples, (int)count, 1, 1, 1, 0);
+        }
+        // 先乘小数再放大，避免提前饱和
+        if (gain_frac_q15_ < 32768) {
+            dsps_mul_s16(samples, gain_frac_, samples, (int)count, 1, 1, 1, 15);
+        }
+        for (int i = 0; i < gain_shift_; i++) {
+            dsps_add_s16(samples, samples, samples, (int)count, 1, 1, 1, 0);
+        }
+    }
+
+#if MIC_CONDITIONER_PROFILE
+    profile_cycles_ += esp_cpu_get_cycle_count() - start;
+    if (++profile_blocks_ >= kProfileBlocks) {
+        ESP_LOGI(TAG, "⏱️ 平均每块%lu个CPU周期（%u样本）",
+                 (unsigned long)(profile_cycles_ / profile_blocks_), (unsigned)count);
+        profile_cycles_ = 0;
+        profile_blocks_ = 0;
+    }
+#endif
+}
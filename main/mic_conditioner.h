@@ -0,0 +1,92 @@
+/**
+ * @file mic_conditioner.h
+ * @brief 🎚️ 麦克风输入调理 - 基于esp-dsp向量指令的去直流和增益
+ *
+ * 原来bsp_get_feed_data对每个样本做一次int32钳位循环，对16位数据其实什么都没做。
+ * 这里把真正有用的处理换成esp-dsp的S3向量内核，每条指令处理8个样本：
+ * - 去直流：dsps_dotprod_s16求块均值并平滑，dsps_add_s16（饱和）减去偏置
+ * - 增益：拆成2^k × 小数，2^k部分用饱和自加，小数部分用dsps_mul_s16（Q15）
+ * 两项都关闭时process()直接返回，没有任何逐样本开销。
+ * 32位采集时先用narrow32()原地移位并饱和成16位（SampleConvert<int32_t, int16_t>，见sample_format.h），再交给process()。
+ * 双麦克风时数据左右交织，两个麦克风的直流偏置各自估计：偏置向量按声道交替填充，
+ * 左声道均值用隔位系数的点积求出，右声道由整体均值反推，仍然每块只有两次点积。
+ *
+ * 向量路径要求缓冲区16字节对齐且长度为8的倍数。esp-dsp的非对齐回退实现不做饱和，
+ * 所以不满足条件时改用本类自己的标量循环。
+ * 只在feed任务中调用，内部不加锁。
+ */
+
+#ifndef MIC_CONDITIONER_H
+#define MIC_CONDITIONER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "project_config.h"
+
+class MicConditioner {
+public:
+    MicConditioner();
+    ~MicConditioner();
+
+    /**
+     * @brief 配置调理参数
+     *
+     * @param dc_block 是否去除直流偏置
+     * @param gain 输入增益（0 < gain <= 64），1.0表示不调整
+     * @param channels 交织的声道数（1或2）
+     * @return ESP_OK成功；参数非法时返回ESP_ERR_INVALID_ARG
+     */
+    esp_err_t configure(bool dc_block, float gain, int channels = 1);
+
+    /**
+     * @brief 原地处理一块16位样本（双声道时左右交织，count为样本总数，块从左声道开始）
+     */
+    void process(int16_t* samples, size_t count);
+
+    /**
+     * @brief 把32位I2S样本原地收窄为16位：右移shift位后饱和
+     *
+     * INMP441的24位数据左对齐在32位槽里，shift=16等价于16位采集，
+     * 每少移1位相当于+6dB增益。输出写在同一块内存的前半部分。
+     *
+     * @param data 32位样本（处理后按int16_t读取）
+     * @param count 样本数
+     * @param shift 右移位数（0~16）
+     */
+    static void narrow32(int32_t* data, size_t count, int shift);
+
+    bool isActive() const { return dc_block_ || gain_shift_ > 0 || gain_frac_q15_ < 32768; }
+
+private:
+    static const char* TAG;
+
+    bool ensureCapacity(size_t count);
+    void fillVector(int16_t* vec, int16_t value, size_t count);
+    void fillInterleaved(int16_t* vec, int16_t even, int16_t odd, size_t count);
+    void fillDcOffset();
+    void processScalar(int16_t* samples, size_t count);
+
+    bool dc_block_;
+    int channels_;
+    int gain_shift_;        // 2^k部分，用饱和自加实现
+    int32_t gain_frac_q15_; // 小数部分（Q15，32768表示1.0）
+
+    // 向量常量（16字节对齐，长度为capacity_）
+    int16_t* mean_coef_;    // 每个元素为32768/count，点积结果即块均值
+    int16_t* mean_coef_left_;  // 双声道：偶数位为32768/(count/2)，奇数位为0，点积结果即左声道均值
+    int16_t* dc_offset_;    // 每个元素为-dc
+    int16_t* gain_frac_;    // 每个元素为gain_frac_q15_
+    size_t capacity_;
+    size_t mean_count_;     // mean_coef_对应的块长度
+
+    int32_t dc_estimate_q4_[2];   // 每个声道平滑后的直流估计（Q4，减少平滑时的截断误差）
+    int16_t dc_applied_[2];       // dc_offset_中当前的偏置
+
+#if MIC_CONDITIONER_PROFILE
+    uint32_t profile_cycles_;
+    uint32_t profile_blocks_;
+#endif
+};
+
+#endif // MIC_CONDITIONER_H
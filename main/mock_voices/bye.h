@@ -1,2441 +0,0 @@
-#include <stdio.h>
-const unsigned char bye[] = {
-0x34, 0x00, 0x48, 0x00, 0x45, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x49, 0x00, 0x52, 0x00, 0x55, 0x00, 
-0x4e, 0x00, 0x4d, 0x00, 0x49, 0x00, 0x45, 0x00, 0x4a, 0x00, 0x4e, 0x00, 0x48, 0x00, 0x45, 0x00, 
-0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x49, 0x00, 0x46, 0x00, 0x46, 0x00, 0x49, 0x00, 0x45, 0x00, 
-0x40, 0x00, 0x47, 0x00, 0x4e, 0x00, 0x4c, 0x00, 0x4b, 0x00, 0x4b, 0x00, 0x4b, 0x00, 0x4b, 0x00, 
-0x47, 0x00, 0x46, 0x00, 0x4a, 0x00, 0x47, 0x00, 0x41, 0x00, 0x45, 0x00, 0x48, 0x00, 0x47, 0x00, 
-0x49, 0x00, 0x4a, 0x00, 0x4d, 0x00, 0x50, 0x00, 0x4b, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 
-0x48, 0x00, 0x49, 0x00, 0x48, 0x00, 0x45, 0x00, 0x46, 0x00, 0x45, 0x00, 0x41, 0x00, 0x44, 0x00, 
-0x49, 0x00, 0x49, 0x00, 0x47, 0x00, 0x46, 0x00, 0x44, 0x00, 0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 
-0x41, 0x00, 0x41, 0x00, 0x42, 0x00, 0x44, 0x00, 0x46, 0x00, 0x45, 0x00, 0x42, 0x00, 0x41, 0x00, 
-0x43, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x43, 0x00, 0x43, 0x00, 0x3f, 0x00, 0x42, 0x00, 0x45, 0x00, 
-0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x41, 0x00, 0x42, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 
-0x45, 0x00, 0x44, 0x00, 0x45, 0x00, 0x43, 0x00, 0x41, 0x00, 0x42, 0x00, 0x41, 0x00, 0x41, 0x00, 
-0x43, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x43, 0x00, 0x46, 0x00, 0x45, 0x00, 0x41, 0x00, 
-0x41, 0x00, 0x42, 0x00, 0x41, 0x00, 0x40, 0x00, 0x3e, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3a, 0x00, 
-0x3c, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x42, 0x00, 0x45, 0x00, 0x42, 0x00, 0x40, 0x00, 0x40, 0x00, 
-0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x40, 0x00, 
-0x3d, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x38, 0x00, 0x36, 0x00, 0x3b, 0x00, 0x3e, 0x00, 
-0x3b, 0x00, 0x37, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x3d, 0x00, 
-0x3c, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x3c, 0x00, 
-0x3b, 0x00, 0x3c, 0x00, 0x39, 0x00, 0x37, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3a, 0x00, 
-0x39, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 
-0x38, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3b, 0x00, 
-0x3c, 0x00, 0x3c, 0x00, 0x39, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 
-0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x37, 0x00, 0x39, 0x00, 
-0x3b, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x39, 0x00, 
-0x39, 0x00, 0x37, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x38, 0x00, 
-0x37, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 
-0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x38, 0x00, 0x38, 0x00, 
-0x38, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x37, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 
-0x37, 0x00, 0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 0x37, 0x00, 0x36, 0x00, 
-0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x36, 0x00, 0x35, 0x00, 
-0x36, 0x00, 0x34, 0x00, 0x36, 0x00, 0x38, 0x00, 0x36, 0x00, 0x36, 0x00, 0x38, 0x00, 0x37, 0x00, 
-0x37, 0x00, 0x38, 0x00, 0x35, 0x00, 0x36, 0x00, 0x38, 0x00, 0x37, 0x00, 0x36, 0x00, 0x37, 0x00, 
-0x36, 0x00, 0x34, 0x00, 0x34, 0x00, 0x36, 0x00, 0x37, 0x00, 0x36, 0x00, 0x34, 0x00, 0x34, 0x00, 
-0x35, 0x00, 0x36, 0x00, 0x36, 0x00, 0x35, 0x00, 0x34, 0x00, 0x34, 0x00, 0x36, 0x00, 0x36, 0x00, 
-0x35, 0x00, 0x34, 0x00, 0x33, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x34, 0x00, 0x34, 0x00, 
-0x34, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x34, 0x00, 
-0x34, 0x00, 0x34, 0x00, 0x34, 0x00, 0x35, 0x00, 0x38, 0x00, 0x38, 0x00, 0x35, 0x00, 0x35, 0x00, 
-0x36, 0x00, 0x36, 0x00, 0x35, 0x00, 0x34, 0x00, 0x34, 0x00, 0x37, 0x00, 0x35, 0x00, 0x34, 0x00, 
-0x36, 0x00, 0x35, 0x00, 0x33, 0x00, 0x34, 0x00, 0x34, 0x00, 0x35, 0x00, 0x37, 0x00, 0x36, 0x00, 
-0x35, 0x00, 0x36, 0x00, 0x35, 0x00, 0x35, 0x00, 0x36, 0x00, 0x33, 0x00, 0x33, 0x00, 0x35, 0x00, 
-0x34, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x34, 0x00, 0x33, 0x00, 0x34, 0x00, 0x36, 0x00, 
-0x36, 0x00, 0x35, 0x00, 0x35, 0x00, 0x32, 0x00, 0x32, 0x00, 0x35, 0x00, 0x36, 0x00, 0x34, 0x00, 
-0x33, 0x00, 0x33, 0x00, 0x32, 0x00, 0x32, 0x00, 0x34, 0x00, 0x35, 0x00, 0x32, 0x00, 0x31, 0x00, 
-0x33, 0x00, 0x31, 0x00, 0x31, 0x00, 0x33, 0x00, 0x32, 0x00, 0x32, 0x00, 0x33, 0x00, 0x32, 0x00, 
-0x31, 0x00, 0x33, 0x00, 0x32, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x34, 0x00, 0x33, 0x00, 
-0x33, 0x00, 0x35, 0x00, 0x34, 0x00, 0x33, 0x00, 0x33, 0x00, 0x31, 0x00, 0x31, 0x00, 0x35, 0x00, 
-0x34, 0x00, 0x32, 0x00, 0x33, 0x00, 0x36, 0x00, 0x36, 0x00, 0x34, 0x00, 0x32, 0x00, 0x32, 0x00, 
-0x33, 0x00, 0x34, 0x00, 0x33, 0x00, 0x33, 0x00, 0x35, 0x00, 0x35, 0x00, 0x33, 0x00, 0x32, 0x00, 
-0x33, 0x00, 0x34, 0x00, 0x33, 0x00, 0x32, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x32, 0x00, 
-0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x34, 0x00, 0x34, 0x00, 0x35, 0x00, 0x33, 0x00, 0x32, 0x00, 
-0x32, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x33, 0x00, 0x33, 0x00, 0x30, 0x00, 0x31, 0x00, 
-0x34, 0x00, 0x35, 0x00, 0x34, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x30, 0x00, 
-0x30, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x33, 0x00, 0x32, 0x00, 0x31, 0x00, 0x31, 0x00, 
-0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x31, 0x00, 0x31, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 
-0x31, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x33, 0x00, 0x32, 0x00, 0x33, 0x00, 0x33, 0x00, 
-0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x31, 0x00, 0x33, 0x00, 0x33, 0x00, 0x30, 0x00, 0x33, 0x00, 
-0x34, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x31, 0x00, 0x33, 0x00, 0x33, 0x00, 0x32, 0x00, 
-0x34, 0x00, 0x34, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x34, 0x00, 0x33, 0x00, 
-0x30, 0x00, 0x32, 0x00, 0x33, 0x00, 0x33, 0x00, 0x34, 0x00, 0x32, 0x00, 0x31, 0x00, 0x32, 0x00, 
-0x32, 0x00, 0x31, 0x00, 0x31, 0x00, 0x32, 0x00, 0x32, 0x00, 0x31, 0x00, 0x31, 0x00, 0x33, 0x00, 
-0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x34, 0x00, 0x34, 0x00, 0x32, 0x00, 0x32, 0x00, 
-0x33, 0x00, 0x33, 0x00, 0x31, 0x00, 0x30, 0x00, 0x30, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 
-0x35, 0x00, 0x35, 0x00, 0x34, 0x00, 0x33, 0x00, 0x34, 0x00, 0x34, 0x00, 0x33, 0x00, 0x33, 0x00, 
-0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x32, 0x00, 0x33, 0x00, 0x35, 0x00, 0x35, 0x00, 0x34, 0x00, 
-0x34, 0x00, 0x34, 0x00, 0x35, 0x00, 0x35, 0x00, 0x33, 0x00, 0x31, 0x00, 0x33, 0x00, 0x34, 0x00, 
-0x33, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x35, 0x00, 0x34, 0x00, 0x35, 0x00, 
-0x35, 0x00, 0x34, 0x00, 0x33, 0x00, 0x34, 0x00, 0x34, 0x00, 0x33, 0x00, 0x32, 0x00, 0x32, 0x00, 
-0x34, 0x00, 0x35, 0x00, 0x33, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x34, 0x00, 0x34, 0x00, 
-0x32, 0x00, 0x34, 0x00, 0x35, 0x00, 0x32, 0x00, 0x31, 0x00, 0x33, 0x00, 0x32, 0x00, 0x31, 0x00, 
-0x34, 0x00, 0x34, 0x00, 0x35, 0x00, 0x34, 0x00, 0x32, 0x00, 0x34, 0x00, 0x35, 0x00, 0x33, 0x00, 
-0x34, 0x00, 0x36, 0x00, 0x35, 0x00, 0x34, 0x00, 0x33, 0x00, 0x32, 0x00, 0x32, 0x00, 0x33, 0x00, 
-0x34, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x34, 0x00, 0x33, 0x00, 0x35, 0x00, 0x36, 0x00, 
-0x34, 0x00, 0x33, 0x00, 0x33, 0x00, 0x34, 0x00, 0x33, 0x00, 0x33, 0x00, 0x35, 0x00, 0x35, 0x00, 
-0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 
-0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x35, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x36, 0x00, 
-0x35, 0x00, 0x33, 0x00, 0x35, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x36, 0x00, 0x34, 0x00, 
-0x34, 0x00, 0x34, 0x00, 0x34, 0x00, 0x37, 0x00, 0x35, 0x00, 0x31, 0x00, 0x32, 0x00, 0x35, 0x00, 
-0x36, 0x00, 0x37, 0x00, 0x35, 0x00, 0x34, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x36, 0x00, 
-0x35, 0x00, 0x34, 0x00, 0x34, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x36, 0x00, 
-0x36, 0x00, 0x35, 0x00, 0x35, 0x00, 0x36, 0x00, 0x34, 0x00, 0x34, 0x00, 0x36, 0x00, 0x37, 0x00, 
-0x34, 0x00, 0x33, 0x00, 0x36, 0x00, 0x36, 0x00, 0x35, 0x00, 0x35, 0x00, 0x36, 0x00, 0x36, 0x00, 
-0x35, 0x00, 0x35, 0x00, 0x36, 0x00, 0x36, 0x00, 0x35, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 
-0x36, 0x00, 0x35, 0x00, 0x35, 0x00, 0x37, 0x00, 0x37, 0x00, 0x35, 0x00, 0x35, 0x00, 0x38, 0x00, 
-0x38, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 
-0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x36, 0x00, 0x34, 0x00, 0x36, 0x00, 0x39, 0x00, 0x39, 0x00, 
-0x38, 0x00, 0x36, 0x00, 0x34, 0x00, 0x35, 0x00, 0x37, 0x00, 0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 
-0x35, 0x00, 0x35, 0x00, 0x38, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 
-0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x35, 0x00, 0x35, 0x00, 0x37, 0x00, 
-0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 
-0x37, 0x00, 0x37, 0x00, 0x39, 0x00, 0x38, 0x00, 0x36, 0x00, 0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 
-0x38, 0x00, 0x36, 0x00, 0x37, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 
-0x37, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x37, 0x00, 0x37, 0x00, 0x39, 0x00, 0x39, 0x00, 
-0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x36, 0x00, 
-0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 
-0x38, 0x00, 0x36, 0x00, 0x38, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 
-0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 
-0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x38, 0x00, 
-0x36, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x38, 0x00, 0x37, 0x00, 0x38, 0x00, 
-0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x37, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 
-0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 
-0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x37, 0x00, 
-0x38, 0x00, 0x39, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 0x39, 0x00, 
-0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x38, 0x00, 0x37, 0x00, 
-0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 0x39, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x3c, 0x00, 0x3b, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 
-0x3b, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 
-0x3b, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x37, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x3b, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 
-0x39, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3b, 0x00, 
-0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x39, 0x00, 
-0x3c, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 
-0x3b, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 
-0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3a, 0x00, 
-0x38, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 
-0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3c, 0x00, 
-0x3c, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 
-0x3c, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x3b, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3d, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3e, 0x00, 
-0x3f, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3e, 0x00, 
-0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 
-0x40, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3d, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3c, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 
-0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3c, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 
-0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3c, 0x00, 
-0x3e, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3c, 0x00, 
-0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x41, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 
-0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 
-0x3f, 0x00, 0x41, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x40, 0x00, 0x3f, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 
-0x40, 0x00, 0x40, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3c, 0x00, 
-0x3e, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 
-0x3c, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3d, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3e, 0x00, 
-0x3f, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3c, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3c, 0x00, 
-0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3b, 0x00, 0x3c, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 
-0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 
-0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 
-0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 
-0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 
-0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3e, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3c, 0x00, 0x3d, 0x00, 
-0x3f, 0x00, 0x40, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x40, 0x00, 
-0x3f, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 
-0x3d, 0x00, 0x3d, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 
-0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x40, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3e, 0x00, 0x3f, 0x00, 
-0x41, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x42, 0x00, 0x43, 0x00, 0x41, 0x00, 0x41, 0x00, 0x40, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x41, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 
-0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x41, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 
-0x41, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x41, 0x00, 0x40, 0x00, 0x40, 0x00, 
-0x41, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x41, 0x00, 0x40, 0x00, 
-0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3e, 0x00, 
-0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3e, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x40, 0x00, 0x40, 0x00, 
-0x3f, 0x00, 0x3e, 0x00, 0x40, 0x00, 0x42, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 
-0x41, 0x00, 0x42, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x40, 0x00, 0x40, 0x00, 
-0x3d, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 
-0x41, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3d, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x40, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x42, 0x00, 0x3f, 0x00, 
-0x3e, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x41, 0x00, 
-0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x41, 0x00, 0x41, 0x00, 
-0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x3f, 0x00, 
-0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x40, 0x00, 0x41, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 
-0x41, 0x00, 0x41, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x40, 0x00, 0x41, 0x00, 
-0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x40, 0x00, 
-0x40, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x41, 0x00, 0x3f, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 
-0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x40, 0x00, 0x41, 0x00, 
-0x41, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 
-0x40, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x40, 0x00, 
-0x3f, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 
-0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 
-0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3d, 0x00, 
-0x3f, 0x00, 0x40, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3f, 0x00, 0x41, 0x00, 0x3f, 0x00, 0x3c, 0x00, 
-0x3d, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x3e, 0x00, 0x3d, 0x00, 
-0x3f, 0x00, 0x40, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x3d, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x41, 0x00, 0x41, 0x00, 0x40, 0x00, 
-0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x3e, 0x00, 0x3c, 0x00, 
-0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x40, 0x00, 
-0x3f, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3c, 0x00, 
-0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3f, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3c, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 
-0x3b, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3c, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3b, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x3c, 0x00, 
-0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3c, 0x00, 
-0x3d, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x3b, 0x00, 
-0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3c, 0x00, 
-0x3c, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3d, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 
-0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 
-0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3c, 0x00, 
-0x3c, 0x00, 0x3a, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3b, 0x00, 
-0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 
-0x3c, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x39, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x39, 0x00, 0x39, 0x00, 
-0x3a, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 
-0x3a, 0x00, 0x3b, 0x00, 0x39, 0x00, 0x37, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 
-0x3a, 0x00, 0x3b, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3a, 0x00, 
-0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 
-0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x38, 0x00, 0x38, 0x00, 
-0x39, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 
-0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x39, 0x00, 
-0x38, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x39, 0x00, 
-0x3a, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 
-0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x39, 0x00, 0x38, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 
-0x39, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x39, 0x00, 
-0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x36, 0x00, 0x38, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 
-0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 
-0x38, 0x00, 0x37, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x37, 0x00, 
-0x39, 0x00, 0x38, 0x00, 0x37, 0x00, 0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 
-0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 0x37, 0x00, 
-0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x36, 0x00, 0x38, 0x00, 0x39, 0x00, 
-0x36, 0x00, 0x37, 0x00, 0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 
-0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x39, 0x00, 0x37, 0x00, 0x37, 0x00, 0x39, 0x00, 0x37, 0x00, 
-0x36, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x37, 0x00, 0x38, 0x00, 
-0x39, 0x00, 0x38, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 
-0x39, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 0x38, 0x00, 0x37, 0x00, 
-0x37, 0x00, 0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 
-0x38, 0x00, 0x38, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x36, 0x00, 0x36, 0x00, 0x38, 0x00, 
-0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x38, 0x00, 
-0x38, 0x00, 0x37, 0x00, 0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x38, 0x00, 0x37, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x38, 0x00, 
-0x35, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x38, 0x00, 
-0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x38, 0x00, 
-0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 
-0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x37, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 
-0x37, 0x00, 0x37, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x38, 0x00, 0x36, 0x00, 0x38, 0x00, 
-0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x39, 0x00, 0x39, 0x00, 0x37, 0x00, 
-0x36, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3a, 0x00, 
-0x39, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 0x38, 0x00, 
-0x38, 0x00, 0x39, 0x00, 0x38, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 
-0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x39, 0x00, 
-0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x37, 0x00, 0x39, 0x00, 0x39, 0x00, 0x36, 0x00, 0x37, 0x00, 
-0x3a, 0x00, 0x38, 0x00, 0x37, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x38, 0x00, 0x37, 0x00, 0x39, 0x00, 
-0x39, 0x00, 0x38, 0x00, 0x39, 0x00, 0x38, 0x00, 0x37, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x39, 0x00, 
-0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x37, 0x00, 0x37, 0x00, 0x39, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x37, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x39, 0x00, 
-0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3a, 0x00, 
-0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3b, 0x00, 
-0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 
-0x3b, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 
-0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3b, 0x00, 
-0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x39, 0x00, 0x3b, 0x00, 
-0x3d, 0x00, 0x3b, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3c, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3b, 0x00, 
-0x3d, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3e, 0x00, 0x3d, 0x00, 
-0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x3b, 0x00, 
-0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 
-0x3d, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x3d, 0x00, 
-0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 
-0x3b, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 
-0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 
-0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x41, 0x00, 0x41, 0x00, 
-0x40, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x00, 
-0x40, 0x00, 0x41, 0x00, 0x41, 0x00, 0x40, 0x00, 0x40, 0x00, 0x42, 0x00, 0x43, 0x00, 0x41, 0x00, 
-0x42, 0x00, 0x44, 0x00, 0x42, 0x00, 0x40, 0x00, 0x41, 0x00, 0x43, 0x00, 0x43, 0x00, 0x44, 0x00, 
-0x43, 0x00, 0x42, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x42, 0x00, 0x42, 0x00, 
-0x42, 0x00, 0x43, 0x00, 0x43, 0x00, 0x42, 0x00, 0x42, 0x00, 0x43, 0x00, 0x43, 0x00, 0x42, 0x00, 
-0x44, 0x00, 0x45, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x43, 0x00, 0x43, 0x00, 
-0x43, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 
-0x45, 0x00, 0x43, 0x00, 0x43, 0x00, 0x44, 0x00, 0x43, 0x00, 0x43, 0x00, 0x44, 0x00, 0x44, 0x00, 
-0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x44, 0x00, 0x46, 0x00, 0x44, 0x00, 0x44, 0x00, 0x46, 0x00, 
-0x47, 0x00, 0x46, 0x00, 0x45, 0x00, 0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 
-0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x45, 0x00, 0x44, 0x00, 0x44, 0x00, 0x46, 0x00, 
-0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x45, 0x00, 0x46, 0x00, 
-0x48, 0x00, 0x47, 0x00, 0x47, 0x00, 0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x48, 0x00, 0x47, 0x00, 
-0x46, 0x00, 0x46, 0x00, 0x45, 0x00, 0x46, 0x00, 0x48, 0x00, 0x48, 0x00, 0x48, 0x00, 0x46, 0x00, 
-0x45, 0x00, 0x48, 0x00, 0x4a, 0x00, 0x49, 0x00, 0x48, 0x00, 0x47, 0x00, 0x47, 0x00, 0x48, 0x00, 
-0x4a, 0x00, 0x49, 0x00, 0x47, 0x00, 0x47, 0x00, 0x48, 0x00, 0x48, 0x00, 0x48, 0x00, 0x48, 0x00, 
-0x46, 0x00, 0x48, 0x00, 0x4a, 0x00, 0x49, 0x00, 0x48, 0x00, 0x49, 0x00, 0x47, 0x00, 0x48, 0x00, 
-0x4a, 0x00, 0x4a, 0x00, 0x48, 0x00, 0x48, 0x00, 0x48, 0x00, 0x4a, 0x00, 0x4a, 0x00, 0x49, 0x00, 
-0x48, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x48, 0x00, 0x47, 0x00, 0x48, 0x00, 0x48, 0x00, 
-0x4a, 0x00, 0x4b, 0x00, 0x48, 0x00, 0x47, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x49, 0x00, 0x49, 0x00, 
-0x48, 0x00, 0x48, 0x00, 0x48, 0x00, 0x4a, 0x00, 0x4a, 0x00, 0x49, 0x00, 0x49, 0x00, 0x4a, 0x00, 
-0x4a, 0x00, 0x4b, 0x00, 0x4b, 0x00, 0x48, 0x00, 0x48, 0x00, 0x4a, 0x00, 0x4a, 0x00, 0x4a, 0x00, 
-0x4b, 0x00, 0x4b, 0x00, 0x4b, 0x00, 0x4b, 0x00, 0x4b, 0x00, 0x4b, 0x00, 0x4a, 0x00, 0x49, 0x00, 
-0x4b, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4b, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4d, 0x00, 
-0x4c, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4c, 0x00, 0x4b, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4b, 0x00, 
-0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4b, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 
-0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4d, 0x00, 0x4c, 0x00, 0x4b, 0x00, 
-0x4c, 0x00, 0x4d, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4e, 0x00, 
-0x4d, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4f, 0x00, 0x4f, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 
-0x50, 0x00, 0x4f, 0x00, 0x4d, 0x00, 0x4d, 0x00, 0x50, 0x00, 0x50, 0x00, 0x4f, 0x00, 0x4e, 0x00, 
-0x4d, 0x00, 0x4d, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4f, 0x00, 
-0x4f, 0x00, 0x50, 0x00, 0x50, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x50, 0x00, 0x4f, 0x00, 0x50, 0x00, 
-0x51, 0x00, 0x50, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x52, 0x00, 0x51, 0x00, 0x51, 0x00, 
-0x51, 0x00, 0x51, 0x00, 0x51, 0x00, 0x51, 0x00, 0x51, 0x00, 0x51, 0x00, 0x50, 0x00, 0x4f, 0x00, 
-0x51, 0x00, 0x52, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 
-0x53, 0x00, 0x52, 0x00, 0x52, 0x00, 0x53, 0x00, 0x52, 0x00, 0x50, 0x00, 0x4f, 0x00, 0x50, 0x00, 
-0x53, 0x00, 0x52, 0x00, 0x51, 0x00, 0x52, 0x00, 0x51, 0x00, 0x52, 0x00, 0x52, 0x00, 0x51, 0x00, 
-0x51, 0x00, 0x53, 0x00, 0x54, 0x00, 0x54, 0x00, 0x52, 0x00, 0x52, 0x00, 0x53, 0x00, 0x53, 0x00, 
-0x52, 0x00, 0x53, 0x00, 0x52, 0x00, 0x53, 0x00, 0x55, 0x00, 0x53, 0x00, 0x53, 0x00, 0x55, 0x00, 
-0x53, 0x00, 0x53, 0x00, 0x56, 0x00, 0x54, 0x00, 0x53, 0x00, 0x55, 0x00, 0x55, 0x00, 0x54, 0x00, 
-0x53, 0x00, 0x53, 0x00, 0x53, 0x00, 0x55, 0x00, 0x55, 0x00, 0x56, 0x00, 0x54, 0x00, 0x53, 0x00, 
-0x54, 0x00, 0x55, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x55, 0x00, 0x56, 0x00, 0x56, 0x00, 
-0x54, 0x00, 0x54, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 
-0x55, 0x00, 0x55, 0x00, 0x57, 0x00, 0x57, 0x00, 0x56, 0x00, 0x55, 0x00, 0x56, 0x00, 0x56, 0x00, 
-0x56, 0x00, 0x55, 0x00, 0x57, 0x00, 0x57, 0x00, 0x54, 0x00, 0x55, 0x00, 0x58, 0x00, 0x57, 0x00, 
-0x56, 0x00, 0x58, 0x00, 0x58, 0x00, 0x56, 0x00, 0x55, 0x00, 0x56, 0x00, 0x58, 0x00, 0x58, 0x00, 
-0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x59, 0x00, 0x58, 0x00, 0x57, 0x00, 
-0x56, 0x00, 0x57, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x56, 0x00, 0x56, 0x00, 0x59, 0x00, 
-0x59, 0x00, 0x58, 0x00, 0x59, 0x00, 0x59, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x58, 0x00, 
-0x58, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x59, 0x00, 0x5b, 0x00, 
-0x5a, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x59, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x59, 0x00, 
-0x5a, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x5b, 0x00, 0x5d, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5b, 0x00, 
-0x5b, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x58, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 
-0x5a, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 
-0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5a, 0x00, 
-0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5c, 0x00, 
-0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5c, 0x00, 
-0x5c, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 
-0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5c, 0x00, 
-0x5d, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5d, 0x00, 
-0x5e, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5c, 0x00, 
-0x5c, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5c, 0x00, 
-0x5c, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5f, 0x00, 0x5e, 0x00, 
-0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5e, 0x00, 
-0x5f, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 
-0x5e, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 
-0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 0x61, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x61, 0x00, 
-0x5f, 0x00, 0x5d, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5d, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x5d, 0x00, 
-0x5e, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5f, 0x00, 
-0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 
-0x60, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 
-0x5f, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5e, 0x00, 
-0x5e, 0x00, 0x61, 0x00, 0x61, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x61, 0x00, 0x60, 0x00, 0x5f, 0x00, 
-0x5f, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x60, 0x00, 
-0x61, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x61, 0x00, 0x5f, 0x00, 0x5f, 0x00, 
-0x61, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x61, 0x00, 0x61, 0x00, 0x60, 0x00, 0x61, 0x00, 0x60, 0x00, 
-0x60, 0x00, 0x61, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 
-0x61, 0x00, 0x62, 0x00, 0x61, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 
-0x60, 0x00, 0x61, 0x00, 0x5f, 0x00, 0x62, 0x00, 0x63, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x61, 0x00, 
-0x5f, 0x00, 0x60, 0x00, 0x62, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x5e, 0x00, 0x60, 0x00, 
-0x61, 0x00, 0x60, 0x00, 0x61, 0x00, 0x60, 0x00, 0x5e, 0x00, 0x60, 0x00, 0x61, 0x00, 0x61, 0x00, 
-0x60, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 
-0x61, 0x00, 0x61, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x60, 0x00, 
-0x61, 0x00, 0x61, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x61, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 
-0x5f, 0x00, 0x60, 0x00, 0x61, 0x00, 0x61, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x61, 0x00, 0x62, 0x00, 
-0x61, 0x00, 0x61, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5f, 0x00, 
-0x60, 0x00, 0x61, 0x00, 0x61, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x60, 0x00, 
-0x61, 0x00, 0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 0x61, 0x00, 0x60, 0x00, 0x60, 0x00, 0x61, 0x00, 
-0x60, 0x00, 0x60, 0x00, 0x62, 0x00, 0x62, 0x00, 0x61, 0x00, 0x61, 0x00, 0x60, 0x00, 0x5f, 0x00, 
-0x60, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 
-0x60, 0x00, 0x61, 0x00, 0x60, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 
-0x61, 0x00, 0x61, 0x00, 0x60, 0x00, 0x61, 0x00, 0x60, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 
-0x61, 0x00, 0x62, 0x00, 0x61, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x61, 0x00, 0x60, 0x00, 0x60, 0x00, 
-0x60, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x61, 0x00, 0x61, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x60, 0x00, 
-0x60, 0x00, 0x61, 0x00, 0x61, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x61, 0x00, 0x60, 0x00, 
-0x5f, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5f, 0x00, 
-0x5f, 0x00, 0x61, 0x00, 0x62, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x61, 0x00, 0x5f, 0x00, 0x5f, 0x00, 
-0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5e, 0x00, 
-0x60, 0x00, 0x61, 0x00, 0x60, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x61, 0x00, 0x61, 0x00, 0x60, 0x00, 
-0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x61, 0x00, 0x61, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x5f, 0x00, 
-0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x60, 0x00, 0x60, 0x00, 
-0x5e, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5e, 0x00, 
-0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5c, 0x00, 
-0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x60, 0x00, 
-0x5f, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5e, 0x00, 
-0x5f, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5e, 0x00, 
-0x5f, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5f, 0x00, 
-0x5e, 0x00, 0x5d, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5e, 0x00, 
-0x5f, 0x00, 0x5f, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5d, 0x00, 0x5d, 0x00, 
-0x5e, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5f, 0x00, 0x5f, 0x00, 
-0x5d, 0x00, 0x5c, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5e, 0x00, 
-0x5e, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5b, 0x00, 
-0x5b, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 
-0x5c, 0x00, 0x5a, 0x00, 0x5c, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5c, 0x00, 
-0x5c, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5c, 0x00, 
-0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5a, 0x00, 
-0x5c, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5c, 0x00, 
-0x5b, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5c, 0x00, 
-0x5c, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x5b, 0x00, 
-0x5b, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5a, 0x00, 
-0x5b, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 
-0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5a, 0x00, 
-0x5c, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5a, 0x00, 
-0x59, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x59, 0x00, 0x5a, 0x00, 
-0x5b, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5a, 0x00, 
-0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5c, 0x00, 
-0x5b, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5b, 0x00, 
-0x5c, 0x00, 0x5b, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5b, 0x00, 
-0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x59, 0x00, 0x5a, 0x00, 
-0x5a, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x59, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5b, 0x00, 0x5b, 0x00, 
-0x5b, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x59, 0x00, 0x59, 0x00, 
-0x59, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x59, 0x00, 0x5c, 0x00, 0x5b, 0x00, 
-0x5a, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x58, 0x00, 
-0x5b, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5c, 0x00, 0x5b, 0x00, 
-0x59, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 
-0x5b, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5b, 0x00, 
-0x59, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5a, 0x00, 
-0x5a, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5a, 0x00, 
-0x5b, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 
-0x5a, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5a, 0x00, 
-0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x59, 0x00, 0x59, 0x00, 
-0x59, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5b, 0x00, 
-0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x59, 0x00, 0x58, 0x00, 0x5a, 0x00, 
-0x5c, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5b, 0x00, 
-0x5a, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 
-0x5b, 0x00, 0x5b, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5c, 0x00, 
-0x5c, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5e, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5d, 0x00, 
-0x5c, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5d, 0x00, 
-0x5c, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5d, 0x00, 
-0x5e, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5d, 0x00, 
-0x5d, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x5e, 0x00, 0x5e, 0x00, 
-0x5d, 0x00, 0x5d, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x5e, 0x00, 0x5e, 0x00, 
-0x5c, 0x00, 0x5b, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5d, 0x00, 
-0x5d, 0x00, 0x5d, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5e, 0x00, 
-0x60, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5e, 0x00, 
-0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x60, 0x00, 
-0x5f, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 
-0x5f, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x61, 0x00, 0x60, 0x00, 
-0x5d, 0x00, 0x5f, 0x00, 0x62, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x61, 0x00, 0x60, 0x00, 0x5f, 0x00, 
-0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 
-0x60, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 
-0x60, 0x00, 0x61, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x61, 0x00, 0x61, 0x00, 
-0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 0x62, 0x00, 0x61, 0x00, 0x60, 0x00, 0x60, 0x00, 0x61, 0x00, 
-0x61, 0x00, 0x62, 0x00, 0x62, 0x00, 0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 0x61, 0x00, 0x60, 0x00, 
-0x60, 0x00, 0x62, 0x00, 0x62, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 
-0x61, 0x00, 0x61, 0x00, 0x63, 0x00, 0x62, 0x00, 0x61, 0x00, 0x62, 0x00, 0x61, 0x00, 0x61, 0x00, 
-0x62, 0x00, 0x61, 0x00, 0x61, 0x00, 0x63, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x61, 0x00, 
-0x62, 0x00, 0x63, 0x00, 0x62, 0x00, 0x63, 0x00, 0x61, 0x00, 0x60, 0x00, 0x62, 0x00, 0x62, 0x00, 
-0x63, 0x00, 0x63, 0x00, 0x60, 0x00, 0x61, 0x00, 0x63, 0x00, 0x62, 0x00, 0x61, 0x00, 0x62, 0x00, 
-0x63, 0x00, 0x64, 0x00, 0x63, 0x00, 0x61, 0x00, 0x62, 0x00, 0x64, 0x00, 0x63, 0x00, 0x62, 0x00, 
-0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x62, 0x00, 0x62, 0x00, 
-0x63, 0x00, 0x62, 0x00, 0x64, 0x00, 0x64, 0x00, 0x63, 0x00, 0x62, 0x00, 0x63, 0x00, 0x63, 0x00, 
-0x63, 0x00, 0x64, 0x00, 0x64, 0x00, 0x62, 0x00, 0x62, 0x00, 0x63, 0x00, 0x63, 0x00, 0x62, 0x00, 
-0x64, 0x00, 0x64, 0x00, 0x63, 0x00, 0x63, 0x00, 0x62, 0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 
-0x65, 0x00, 0x64, 0x00, 0x64, 0x00, 0x65, 0x00, 0x64, 0x00, 0x63, 0x00, 0x64, 0x00, 0x64, 0x00, 
-0x63, 0x00, 0x65, 0x00, 0x65, 0x00, 0x63, 0x00, 0x64, 0x00, 0x64, 0x00, 0x63, 0x00, 0x64, 0x00, 
-0x64, 0x00, 0x63, 0x00, 0x64, 0x00, 0x64, 0x00, 0x63, 0x00, 0x64, 0x00, 0x63, 0x00, 0x63, 0x00, 
-0x64, 0x00, 0x64, 0x00, 0x63, 0x00, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x63, 0x00, 
-0x63, 0x00, 0x64, 0x00, 0x64, 0x00, 0x62, 0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0x64, 0x00, 
-0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x64, 0x00, 0x63, 0x00, 0x61, 0x00, 
-0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0x63, 0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0x63, 0x00, 
-0x62, 0x00, 0x61, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x61, 0x00, 0x62, 0x00, 0x63, 0x00, 
-0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x63, 0x00, 0x63, 0x00, 0x61, 0x00, 0x60, 0x00, 
-0x61, 0x00, 0x62, 0x00, 0x61, 0x00, 0x62, 0x00, 0x62, 0x00, 0x61, 0x00, 0x60, 0x00, 0x61, 0x00, 
-0x62, 0x00, 0x61, 0x00, 0x60, 0x00, 0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 0x61, 0x00, 0x61, 0x00, 
-0x61, 0x00, 0x61, 0x00, 0x62, 0x00, 0x61, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x61, 0x00, 0x60, 0x00, 
-0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 
-0x5f, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 
-0x5e, 0x00, 0x5c, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5f, 0x00, 
-0x5f, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5f, 0x00, 0x5d, 0x00, 0x5a, 0x00, 0x5c, 0x00, 
-0x5e, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5c, 0x00, 
-0x5c, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5a, 0x00, 
-0x59, 0x00, 0x5b, 0x00, 0x59, 0x00, 0x58, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5a, 0x00, 
-0x5a, 0x00, 0x59, 0x00, 0x58, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x59, 0x00, 0x58, 0x00, 
-0x57, 0x00, 0x58, 0x00, 0x5a, 0x00, 0x57, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x57, 0x00, 
-0x57, 0x00, 0x57, 0x00, 0x55, 0x00, 0x56, 0x00, 0x58, 0x00, 0x56, 0x00, 0x54, 0x00, 0x56, 0x00, 
-0x57, 0x00, 0x56, 0x00, 0x56, 0x00, 0x56, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x54, 0x00, 
-0x55, 0x00, 0x54, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x54, 0x00, 0x53, 0x00, 0x53, 0x00, 
-0x53, 0x00, 0x54, 0x00, 0x53, 0x00, 0x52, 0x00, 0x51, 0x00, 0x51, 0x00, 0x52, 0x00, 0x52, 0x00, 
-0x52, 0x00, 0x51, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x51, 0x00, 0x51, 0x00, 0x52, 0x00, 
-0x50, 0x00, 0x4f, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x4d, 0x00, 0x4d, 0x00, 
-0x4e, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x4d, 0x00, 0x4d, 0x00, 0x4c, 0x00, 0x4b, 0x00, 
-0x4b, 0x00, 0x4d, 0x00, 0x4d, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4b, 0x00, 0x4a, 0x00, 
-0x4c, 0x00, 0x4b, 0x00, 0x4a, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4b, 0x00, 0x4b, 0x00, 0x4a, 0x00, 
-0x49, 0x00, 0x48, 0x00, 0x48, 0x00, 0x4a, 0x00, 0x4a, 0x00, 0x48, 0x00, 0x48, 0x00, 0x47, 0x00, 
-0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x45, 0x00, 
-0x44, 0x00, 0x44, 0x00, 0x45, 0x00, 0x45, 0x00, 0x45, 0x00, 0x44, 0x00, 0x42, 0x00, 0x42, 0x00, 
-0x43, 0x00, 0x41, 0x00, 0x42, 0x00, 0x44, 0x00, 0x43, 0x00, 0x42, 0x00, 0x42, 0x00, 0x41, 0x00, 
-0x41, 0x00, 0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x00, 0x3e, 0x00, 0x40, 0x00, 0x40, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 
-0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 
-0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 
-0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x35, 0x00, 0x37, 0x00, 0x37, 0x00, 0x36, 0x00, 
-0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x35, 0x00, 0x34, 0x00, 
-0x34, 0x00, 0x34, 0x00, 0x34, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x34, 0x00, 0x33, 0x00, 
-0x32, 0x00, 0x32, 0x00, 0x31, 0x00, 0x31, 0x00, 0x32, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x31, 0x00, 
-0x2f, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x2d, 0x00, 0x2c, 0x00, 
-0x2d, 0x00, 0x2d, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2d, 0x00, 
-0x2d, 0x00, 0x2c, 0x00, 0x2b, 0x00, 0x2d, 0x00, 0x2b, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2a, 0x00, 
-0x2a, 0x00, 0x2a, 0x00, 0x29, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x28, 0x00, 0x28, 0x00, 0x29, 0x00, 
-0x26, 0x00, 0x27, 0x00, 0x29, 0x00, 0x27, 0x00, 0x27, 0x00, 0x28, 0x00, 0x26, 0x00, 0x25, 0x00, 
-0x26, 0x00, 0x25, 0x00, 0x24, 0x00, 0x26, 0x00, 0x26, 0x00, 0x26, 0x00, 0x25, 0x00, 0x23, 0x00, 
-0x23, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x23, 0x00, 0x20, 0x00, 0x21, 0x00, 0x23, 0x00, 
-0x22, 0x00, 0x21, 0x00, 0x21, 0x00, 0x20, 0x00, 0x21, 0x00, 0x20, 0x00, 0x1e, 0x00, 0x20, 0x00, 
-0x21, 0x00, 0x20, 0x00, 0x20, 0x00, 0x1f, 0x00, 0x1d, 0x00, 0x1f, 0x00, 0x21, 0x00, 0x20, 0x00, 
-0x1f, 0x00, 0x1e, 0x00, 0x1c, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1d, 0x00, 
-0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x1a, 0x00, 0x1b, 0x00, 
-0x1b, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x19, 0x00, 0x18, 0x00, 0x1a, 0x00, 0x19, 0x00, 0x18, 0x00, 
-0x19, 0x00, 0x19, 0x00, 0x18, 0x00, 0x19, 0x00, 0x18, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 
-0x18, 0x00, 0x19, 0x00, 0x16, 0x00, 0x15, 0x00, 0x16, 0x00, 0x16, 0x00, 0x17, 0x00, 0x16, 0x00, 
-0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x15, 0x00, 0x13, 0x00, 0x14, 0x00, 
-0x14, 0x00, 0x13, 0x00, 0x13, 0x00, 0x12, 0x00, 0x14, 0x00, 0x15, 0x00, 0x13, 0x00, 0x12, 0x00, 
-0x13, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x12, 0x00, 
-0x11, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x0d, 0x00, 
-0x0d, 0x00, 0x0d, 0x00, 0x0c, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0d, 0x00, 
-0x0b, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x0c, 0x00, 0x0c, 0x00, 
-0x0a, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x09, 0x00, 0x09, 0x00, 
-0x0a, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x09, 0x00, 0x08, 0x00, 0x09, 0x00, 0x07, 0x00, 
-0x07, 0x00, 0x08, 0x00, 0x08, 0x00, 0x09, 0x00, 0x08, 0x00, 0x05, 0x00, 0x06, 0x00, 0x06, 0x00, 
-0x05, 0x00, 0x06, 0x00, 0x06, 0x00, 0x05, 0x00, 0x07, 0x00, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00, 
-0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x03, 0x00, 0x04, 0x00, 
-0x06, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x04, 0x00, 
-0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x03, 0x00, 0x03, 0x00, 
-0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 
-0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 
-0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 
-0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 
-0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 0x03, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x04, 0x00, 
-0x06, 0x00, 0x05, 0x00, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 
-0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x05, 0x00, 
-0x05, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 
-0x08, 0x00, 0x09, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x09, 0x00, 0x09, 0x00, 0x08, 0x00, 
-0x08, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x0a, 0x00, 
-0x0b, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0c, 0x00, 0x0c, 0x00, 
-0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0d, 0x00, 
-0x0d, 0x00, 0x0e, 0x00, 0x10, 0x00, 0x10, 0x00, 0x0e, 0x00, 0x0d, 0x00, 0x0f, 0x00, 0x11, 0x00, 
-0x10, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x10, 0x00, 0x11, 0x00, 0x11, 0x00, 0x12, 0x00, 0x12, 0x00, 
-0x12, 0x00, 0x12, 0x00, 0x11, 0x00, 0x11, 0x00, 0x14, 0x00, 0x15, 0x00, 0x13, 0x00, 0x12, 0x00, 
-0x14, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x12, 0x00, 0x12, 0x00, 0x14, 0x00, 0x14, 0x00, 
-0x14, 0x00, 0x15, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x16, 0x00, 0x13, 0x00, 0x14, 0x00, 
-0x17, 0x00, 0x17, 0x00, 0x15, 0x00, 0x17, 0x00, 0x17, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 
-0x17, 0x00, 0x17, 0x00, 0x18, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x18, 0x00, 0x19, 0x00, 
-0x19, 0x00, 0x18, 0x00, 0x18, 0x00, 0x19, 0x00, 0x19, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1c, 0x00, 
-0x1d, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x1d, 0x00, 0x1c, 0x00, 0x1b, 0x00, 
-0x1e, 0x00, 0x1e, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1d, 0x00, 
-0x1e, 0x00, 0x20, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 
-0x20, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x22, 0x00, 0x21, 0x00, 0x20, 0x00, 0x20, 0x00, 0x21, 0x00, 
-0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x21, 0x00, 0x21, 0x00, 0x23, 0x00, 
-0x24, 0x00, 0x25, 0x00, 0x25, 0x00, 0x23, 0x00, 0x24, 0x00, 0x26, 0x00, 0x25, 0x00, 0x24, 0x00, 
-0x25, 0x00, 0x24, 0x00, 0x25, 0x00, 0x27, 0x00, 0x25, 0x00, 0x24, 0x00, 0x25, 0x00, 0x27, 0x00, 
-0x27, 0x00, 0x27, 0x00, 0x26, 0x00, 0x27, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x29, 0x00, 0x28, 0x00, 
-0x29, 0x00, 0x2b, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x29, 0x00, 0x29, 0x00, 0x2a, 0x00, 
-0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2b, 0x00, 0x2b, 0x00, 0x2b, 0x00, 0x2b, 0x00, 0x2c, 0x00, 
-0x2c, 0x00, 0x2b, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2c, 0x00, 
-0x2d, 0x00, 0x2e, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x2f, 0x00, 0x2e, 0x00, 0x2f, 0x00, 
-0x2e, 0x00, 0x2f, 0x00, 0x31, 0x00, 0x30, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x32, 0x00, 0x31, 0x00, 
-0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x32, 0x00, 0x32, 0x00, 0x31, 0x00, 0x31, 0x00, 0x33, 0x00, 
-0x34, 0x00, 0x34, 0x00, 0x33, 0x00, 0x32, 0x00, 0x32, 0x00, 0x33, 0x00, 0x33, 0x00, 0x34, 0x00, 
-0x33, 0x00, 0x33, 0x00, 0x35, 0x00, 0x34, 0x00, 0x33, 0x00, 0x35, 0x00, 0x36, 0x00, 0x35, 0x00, 
-0x35, 0x00, 0x34, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x36, 0x00, 
-0x36, 0x00, 0x35, 0x00, 0x34, 0x00, 0x34, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x36, 0x00, 
-0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x36, 0x00, 0x35, 0x00, 0x39, 0x00, 0x39, 0x00, 
-0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 
-0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x38, 0x00, 0x39, 0x00, 
-0x3b, 0x00, 0x38, 0x00, 0x36, 0x00, 0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3c, 0x00, 
-0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3d, 0x00, 
-0x3c, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3c, 0x00, 
-0x3c, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 
-0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 
-0x3d, 0x00, 0x41, 0x00, 0x41, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3f, 0x00, 0x41, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 
-0x41, 0x00, 0x42, 0x00, 0x41, 0x00, 0x40, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x40, 0x00, 
-0x3f, 0x00, 0x40, 0x00, 0x42, 0x00, 0x42, 0x00, 0x40, 0x00, 0x40, 0x00, 0x41, 0x00, 0x41, 0x00, 
-0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 0x43, 0x00, 0x43, 0x00, 0x41, 0x00, 0x40, 0x00, 0x40, 0x00, 
-0x42, 0x00, 0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x42, 0x00, 0x41, 0x00, 0x41, 0x00, 
-0x42, 0x00, 0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 
-0x42, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x41, 0x00, 0x42, 0x00, 0x41, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 
-0x42, 0x00, 0x41, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 
-0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x41, 0x00, 
-0x41, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x41, 0x00, 0x41, 0x00, 0x40, 0x00, 0x3f, 0x00, 
-0x3e, 0x00, 0x40, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 
-0x40, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3f, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3c, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3d, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3a, 0x00, 
-0x3c, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3b, 0x00, 
-0x3b, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x3b, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 
-0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x37, 0x00, 
-0x38, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x38, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 
-0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x39, 0x00, 0x3b, 0x00, 
-0x38, 0x00, 0x36, 0x00, 0x38, 0x00, 0x39, 0x00, 0x38, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 
-0x37, 0x00, 0x39, 0x00, 0x39, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x36, 0x00, 0x35, 0x00, 
-0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x35, 0x00, 0x36, 0x00, 0x38, 0x00, 0x37, 0x00, 
-0x35, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x35, 0x00, 0x36, 0x00, 0x36, 0x00, 0x35, 0x00, 
-0x36, 0x00, 0x36, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x36, 0x00, 0x35, 0x00, 0x34, 0x00, 
-0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x34, 0x00, 0x34, 0x00, 0x33, 0x00, 0x33, 0x00, 0x35, 0x00, 
-0x34, 0x00, 0x34, 0x00, 0x35, 0x00, 0x34, 0x00, 0x33, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 
-0x35, 0x00, 0x34, 0x00, 0x34, 0x00, 0x34, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 
-0x34, 0x00, 0x33, 0x00, 0x32, 0x00, 0x33, 0x00, 0x33, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 
-0x35, 0x00, 0x33, 0x00, 0x32, 0x00, 0x34, 0x00, 0x34, 0x00, 0x34, 0x00, 0x32, 0x00, 0x32, 0x00, 
-0x33, 0x00, 0x34, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x31, 0x00, 0x32, 0x00, 
-0x32, 0x00, 0x32, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x32, 0x00, 0x31, 0x00, 
-0x2f, 0x00, 0x30, 0x00, 0x32, 0x00, 0x32, 0x00, 0x33, 0x00, 0x32, 0x00, 0x30, 0x00, 0x2f, 0x00, 
-0x31, 0x00, 0x31, 0x00, 0x30, 0x00, 0x30, 0x00, 0x31, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
-0x30, 0x00, 0x2f, 0x00, 0x30, 0x00, 0x32, 0x00, 0x31, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x30, 0x00, 
-0x30, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x30, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x30, 0x00, 
-0x30, 0x00, 0x2f, 0x00, 0x30, 0x00, 0x30, 0x00, 0x2f, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2d, 0x00, 
-0x2e, 0x00, 0x30, 0x00, 0x2f, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x2e, 0x00, 0x2d, 0x00, 0x2d, 0x00, 
-0x2d, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x2d, 0x00, 0x2c, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x2f, 0x00, 
-0x2e, 0x00, 0x2e, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x00, 
-0x2e, 0x00, 0x2d, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2e, 0x00, 
-0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 
-0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x2d, 0x00, 0x2d, 0x00, 
-0x2f, 0x00, 0x2e, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2f, 0x00, 0x2e, 0x00, 0x2d, 0x00, 0x2c, 0x00, 
-0x2d, 0x00, 0x2e, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2b, 0x00, 
-0x2b, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x2f, 0x00, 0x2e, 0x00, 0x2f, 0x00, 
-0x2e, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2b, 0x00, 0x2d, 0x00, 0x2f, 0x00, 0x2e, 0x00, 0x2c, 0x00, 
-0x2d, 0x00, 0x2f, 0x00, 0x2e, 0x00, 0x2c, 0x00, 0x2b, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2c, 0x00, 
-0x2d, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x2d, 0x00, 0x2c, 0x00, 0x2c, 0x00, 
-0x2e, 0x00, 0x2e, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2d, 0x00, 
-0x2b, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2b, 0x00, 
-0x2b, 0x00, 0x2b, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2d, 0x00, 0x2c, 0x00, 
-0x2c, 0x00, 0x2b, 0x00, 0x2a, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2b, 0x00, 0x2d, 0x00, 0x2e, 0x00, 
-0x2b, 0x00, 0x2a, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2c, 0x00, 0x2a, 0x00, 0x28, 0x00, 0x2b, 0x00, 
-0x2d, 0x00, 0x2b, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2a, 0x00, 0x29, 0x00, 0x29, 0x00, 0x29, 0x00, 
-0x2a, 0x00, 0x2c, 0x00, 0x2b, 0x00, 0x29, 0x00, 0x27, 0x00, 0x28, 0x00, 0x2a, 0x00, 0x29, 0x00, 
-0x28, 0x00, 0x29, 0x00, 0x28, 0x00, 0x27, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x28, 0x00, 0x26, 0x00, 
-0x27, 0x00, 0x2b, 0x00, 0x2b, 0x00, 0x29, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x29, 0x00, 0x2a, 0x00, 
-0x2b, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x29, 0x00, 0x2b, 0x00, 0x2b, 0x00, 0x2a, 0x00, 
-0x29, 0x00, 0x28, 0x00, 0x27, 0x00, 0x28, 0x00, 0x26, 0x00, 0x26, 0x00, 0x29, 0x00, 0x28, 0x00, 
-0x25, 0x00, 0x25, 0x00, 0x26, 0x00, 0x26, 0x00, 0x28, 0x00, 0x27, 0x00, 0x27, 0x00, 0x2a, 0x00, 
-0x29, 0x00, 0x26, 0x00, 0x26, 0x00, 0x25, 0x00, 0x25, 0x00, 0x26, 0x00, 0x25, 0x00, 0x26, 0x00, 
-0x27, 0x00, 0x24, 0x00, 0x24, 0x00, 0x28, 0x00, 0x26, 0x00, 0x25, 0x00, 0x25, 0x00, 0x25, 0x00, 
-0x26, 0x00, 0x25, 0x00, 0x21, 0x00, 0x24, 0x00, 0x26, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 
-0x25, 0x00, 0x24, 0x00, 0x23, 0x00, 0x22, 0x00, 0x24, 0x00, 0x25, 0x00, 0x25, 0x00, 0x26, 0x00, 
-0x25, 0x00, 0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 0x24, 0x00, 0x26, 0x00, 0x27, 0x00, 0x26, 0x00, 
-0x25, 0x00, 0x23, 0x00, 0x22, 0x00, 0x22, 0x00, 0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 0x22, 0x00, 
-0x20, 0x00, 0x20, 0x00, 0x21, 0x00, 0x20, 0x00, 0x20, 0x00, 0x21, 0x00, 0x21, 0x00, 0x1f, 0x00, 
-0x20, 0x00, 0x22, 0x00, 0x20, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x20, 0x00, 
-0x21, 0x00, 0x1f, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1d, 0x00, 
-0x1d, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1c, 0x00, 0x1a, 0x00, 
-0x1b, 0x00, 0x1c, 0x00, 0x1b, 0x00, 0x1a, 0x00, 0x19, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1a, 0x00, 
-0x1b, 0x00, 0x1b, 0x00, 0x19, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x19, 0x00, 0x18, 0x00, 0x19, 0x00, 
-0x1a, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1c, 0x00, 0x1b, 0x00, 0x19, 0x00, 0x19, 0x00, 0x19, 0x00, 
-0x17, 0x00, 0x16, 0x00, 0x18, 0x00, 0x19, 0x00, 0x19, 0x00, 0x17, 0x00, 0x15, 0x00, 0x16, 0x00, 
-0x15, 0x00, 0x14, 0x00, 0x17, 0x00, 0x16, 0x00, 0x13, 0x00, 0x15, 0x00, 0x16, 0x00, 0x13, 0x00, 
-0x14, 0x00, 0x14, 0x00, 0x12, 0x00, 0x12, 0x00, 0x13, 0x00, 0x12, 0x00, 0x11, 0x00, 0x11, 0x00, 
-0x10, 0x00, 0x11, 0x00, 0x11, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x10, 0x00, 
-0x0f, 0x00, 0x0f, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x0f, 0x00, 0x11, 0x00, 0x0f, 0x00, 0x0e, 0x00, 
-0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0e, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f, 0x00, 
-0x0e, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x0f, 0x00, 0x0e, 0x00, 0x0d, 0x00, 
-0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0d, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0d, 0x00, 
-0x0d, 0x00, 0x0c, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x07, 0x00, 
-0x07, 0x00, 0x08, 0x00, 0x07, 0x00, 0x07, 0x00, 0x09, 0x00, 0x08, 0x00, 0x06, 0x00, 0x07, 0x00, 
-0x07, 0x00, 0x06, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x06, 0x00, 
-0x06, 0x00, 0x07, 0x00, 0x06, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x05, 0x00, 0x04, 0x00, 
-0x04, 0x00, 0x04, 0x00, 0x07, 0x00, 0x08, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 
-0x06, 0x00, 0x07, 0x00, 0x07, 0x00, 0x06, 0x00, 0x04, 0x00, 0x02, 0x00, 0x05, 0x00, 0x07, 0x00, 
-0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 
-0x03, 0x00, 0x04, 0x00, 0x03, 0x00, 0x02, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x03, 0x00, 
-0x02, 0x00, 0xfe, 0xff, 0xfd, 0xff, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x02, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xff, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 
-0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 
-0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xfe, 0xff, 0xfc, 0xff, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 
-0x00, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 
-0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xff, 
-0xfe, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 
-0xfa, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x00, 0x00, 0xfc, 0xff, 0xfe, 0xff, 0x02, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0xff, 0xff, 
-0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xfe, 0xff, 
-0xfe, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf9, 0xff, 0xfb, 0xff, 
-0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0xfe, 0xff, 0x02, 0x00, 0x05, 0x00, 0x01, 0x00, 0xfc, 0xff, 
-0xfc, 0xff, 0xfc, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xf7, 0xff, 
-0xf4, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xf0, 0xff, 0xec, 0xff, 
-0xf2, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xf6, 0xff, 0xf6, 0xff, 
-0xf5, 0xff, 0xf7, 0xff, 0xf4, 0xff, 0xef, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf9, 0xff, 
-0xfa, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 
-0x01, 0x00, 0x01, 0x00, 0xf8, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xf5, 0xff, 
-0xf0, 0xff, 0xf0, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0x04, 0x00, 0x02, 0x00, 
-0xfa, 0xff, 0xfd, 0xff, 0x04, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 
-0x06, 0x00, 0x02, 0x00, 0x02, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x11, 0x00, 0x12, 0x00, 0x16, 0x00, 
-0x15, 0x00, 0x0f, 0x00, 0x12, 0x00, 0x13, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x0f, 0x00, 
-0x08, 0x00, 0x08, 0x00, 0x05, 0x00, 0x04, 0x00, 0x09, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 
-0x05, 0x00, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xff, 
-0x01, 0x00, 0x0a, 0x00, 0x03, 0x00, 0xfb, 0xff, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x09, 0x00, 
-0x03, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0x00, 0x00, 0xfc, 0xff, 0xf5, 0xff, 
-0xf6, 0xff, 0xf4, 0xff, 0xf6, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf9, 0xff, 0xf5, 0xff, 
-0xf7, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0x03, 0x00, 0x00, 0x00, 
-0xfc, 0xff, 0xf7, 0xff, 0xf6, 0xff, 0x01, 0x00, 0x07, 0x00, 0x01, 0x00, 0xfc, 0xff, 0xf6, 0xff, 
-0xf2, 0xff, 0xfb, 0xff, 0xf8, 0xff, 0xf2, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xf2, 0xff, 0xf7, 0xff, 
-0xfa, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf5, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xea, 0xff, 0xea, 0xff, 
-0xea, 0xff, 0xea, 0xff, 0xf2, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xf4, 0xff, 0xec, 0xff, 0xe2, 0xff, 
-0xdb, 0xff, 0xdc, 0xff, 0xe3, 0xff, 0xea, 0xff, 0xec, 0xff, 0xe4, 0xff, 0xdf, 0xff, 0xdf, 0xff, 
-0xde, 0xff, 0xe3, 0xff, 0xea, 0xff, 0xee, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xec, 0xff, 0xed, 0xff, 
-0xf8, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf6, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0x03, 0x00, 0x05, 0x00, 
-0x05, 0x00, 0x01, 0x00, 0xfd, 0xff, 0x00, 0x00, 0x07, 0x00, 0x11, 0x00, 0x19, 0x00, 0x1d, 0x00, 
-0x19, 0x00, 0x13, 0x00, 0x14, 0x00, 0x14, 0x00, 0x0d, 0x00, 0x0a, 0x00, 0x06, 0x00, 0xfa, 0xff, 
-0xef, 0xff, 0xed, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00, 
-0x0c, 0x00, 0x0a, 0x00, 0x06, 0x00, 0x02, 0x00, 0xfc, 0xff, 0xf7, 0xff, 0xf6, 0xff, 0xee, 0xff, 
-0xe3, 0xff, 0xe2, 0xff, 0xe0, 0xff, 0xdd, 0xff, 0xe6, 0xff, 0xf1, 0xff, 0xf4, 0xff, 0xf9, 0xff, 
-0xf9, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf3, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf6, 0xff, 
-0xf9, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xff, 
-0xfa, 0xff, 0xfc, 0xff, 0x03, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0c, 0x00, 
-0x0a, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x24, 0x00, 0x34, 0x00, 0x3f, 0x00, 0x34, 0x00, 
-0x20, 0x00, 0x1a, 0x00, 0x11, 0x00, 0x03, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x07, 0x00, 0x01, 0x00, 
-0xf8, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xf4, 0xff, 0xfd, 0xff, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0x01, 0x00, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x02, 0x00, 
-0x03, 0x00, 0x02, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x13, 0x00, 0x09, 0x00, 0x03, 0x00, 
-0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x12, 0x00, 0x11, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0b, 0x00, 
-0x08, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x06, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfd, 0xff, 
-0xfd, 0xff, 0x03, 0x00, 0x02, 0x00, 0xf6, 0xff, 0xf4, 0xff, 0xf6, 0xff, 0xf2, 0xff, 0xf2, 0xff, 
-0xf3, 0xff, 0xeb, 0xff, 0xe3, 0xff, 0xde, 0xff, 0xdc, 0xff, 0xe5, 0xff, 0xef, 0xff, 0xee, 0xff, 
-0xec, 0xff, 0xf1, 0xff, 0xf2, 0xff, 0xef, 0xff, 0xf0, 0xff, 0xef, 0xff, 0xe9, 0xff, 0xe7, 0xff, 
-0xea, 0xff, 0xe8, 0xff, 0xe3, 0xff, 0xe2, 0xff, 0xe6, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xea, 0xff, 
-0xf1, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x02, 0x00, 0xfe, 0xff, 0xf9, 0xff, 0xef, 0xff, 0xe4, 0xff, 
-0xe0, 0xff, 0xe1, 0xff, 0xe6, 0xff, 0xee, 0xff, 0xf5, 0xff, 0xfe, 0xff, 0x05, 0x00, 0x04, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xf8, 0xff, 
-0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xef, 0xff, 0xf2, 0xff, 0xf9, 0xff, 0xfd, 0xff, 
-0x00, 0x00, 0xff, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
-0xf6, 0xff, 0xf7, 0xff, 0xf6, 0xff, 0xee, 0xff, 0xec, 0xff, 0xea, 0xff, 0xe6, 0xff, 0xed, 0xff, 
-0xf1, 0xff, 0xeb, 0xff, 0xe9, 0xff, 0xeb, 0xff, 0xee, 0xff, 0xf1, 0xff, 0xf6, 0xff, 0xfb, 0xff, 
-0xff, 0xff, 0x03, 0x00, 0x04, 0x00, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0x03, 0x00, 0x03, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xf5, 0xff, 0xf8, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0x04, 0x00, 0x09, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x16, 0x00, 0x16, 0x00, 0x18, 0x00, 0x15, 0x00, 
-0x0f, 0x00, 0x11, 0x00, 0x13, 0x00, 0x0f, 0x00, 0x11, 0x00, 0x16, 0x00, 0x13, 0x00, 0x0d, 0x00, 
-0x0d, 0x00, 0x10, 0x00, 0x14, 0x00, 0x1b, 0x00, 0x20, 0x00, 0x18, 0x00, 0x0f, 0x00, 0x0e, 0x00, 
-0x0a, 0x00, 0x05, 0x00, 0x06, 0x00, 0x03, 0x00, 0xfd, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf4, 0xff, 
-0xfb, 0xff, 0x01, 0x00, 0x09, 0x00, 0x13, 0x00, 0x12, 0x00, 0x0d, 0x00, 0x0f, 0x00, 0x0c, 0x00, 
-0x0a, 0x00, 0x0e, 0x00, 0x0d, 0x00, 0x04, 0x00, 0xfd, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xf5, 0xff, 
-0xf4, 0xff, 0xf7, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xfe, 0xff, 0x01, 0x00, 0xfe, 0xff, 0xfd, 0xff, 
-0xf9, 0xff, 0xf1, 0xff, 0xeb, 0xff, 0xec, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xf2, 0xff, 0xf6, 0xff, 
-0xf4, 0xff, 0xf8, 0xff, 0x05, 0x00, 0x02, 0x00, 0xf8, 0xff, 0x01, 0x00, 0x06, 0x00, 0x02, 0x00, 
-0x09, 0x00, 0x0d, 0x00, 0x07, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0b, 0x00, 
-0x08, 0x00, 0x08, 0x00, 0x06, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x10, 0x00, 0x0b, 0x00, 0x02, 0x00, 
-0x02, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x15, 0x00, 0x0e, 0x00, 0x08, 0x00, 
-0x0c, 0x00, 0x15, 0x00, 0x17, 0x00, 0x16, 0x00, 0x19, 0x00, 0x12, 0x00, 0x05, 0x00, 0x01, 0x00, 
-0xf8, 0xff, 0xee, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xec, 0xff, 0xeb, 0xff, 0xe0, 0xff, 0xd6, 0xff, 
-0xdd, 0xff, 0xe5, 0xff, 0xe9, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xf0, 0xff, 0xec, 0xff, 0xed, 0xff, 
-0xe7, 0xff, 0xe1, 0xff, 0xea, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0xea, 0xff, 0xe6, 0xff, 0xdd, 0xff, 
-0xdf, 0xff, 0xe8, 0xff, 0xe6, 0xff, 0xe9, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xf2, 0xff, 
-0xef, 0xff, 0xfb, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x0c, 0x00, 0x16, 0x00, 0x10, 0x00, 0x0e, 0x00, 
-0x0e, 0x00, 0x08, 0x00, 0x05, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x0f, 0x00, 0x06, 0x00, 0xfc, 0xff, 
-0xf4, 0xff, 0xee, 0xff, 0xf4, 0xff, 0xf9, 0xff, 0xf3, 0xff, 0xea, 0xff, 0xe0, 0xff, 0xd7, 0xff, 
-0xdd, 0xff, 0xed, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xf6, 0xff, 0xf6, 0xff, 
-0xff, 0xff, 0x00, 0x00, 0xee, 0xff, 0xe4, 0xff, 0xe7, 0xff, 0xe1, 0xff, 0xe5, 0xff, 0xf4, 0xff, 
-0xf5, 0xff, 0xf2, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0x05, 0x00, 0x06, 0x00, 0x06, 0x00, 
-0x06, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x03, 0x00, 
-0x0f, 0x00, 0x17, 0x00, 0x18, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x16, 0x00, 0x0a, 0x00, 
-0x07, 0x00, 0x0a, 0x00, 0x02, 0x00, 0xff, 0xff, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0b, 0x00, 
-0x0c, 0x00, 0x0d, 0x00, 0x10, 0x00, 0x17, 0x00, 0x1d, 0x00, 0x19, 0x00, 0x16, 0x00, 0x16, 0x00, 
-0x0b, 0x00, 0x02, 0x00, 0x03, 0x00, 0x05, 0x00, 0x10, 0x00, 0x19, 0x00, 0x0e, 0x00, 0x04, 0x00, 
-0x04, 0x00, 0x02, 0x00, 0x07, 0x00, 0x10, 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x03, 0x00, 
-0xfe, 0xff, 0xfc, 0xff, 0xf3, 0xff, 0xed, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xf5, 0xff, 
-0xfb, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x07, 0x00, 0x0a, 0x00, 0x07, 0x00, 0x03, 0x00, 0xfc, 0xff, 
-0xf8, 0xff, 0xff, 0xff, 0x08, 0x00, 0x07, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x01, 0x00, 
-0x05, 0x00, 0x0b, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x09, 0x00, 0x02, 0x00, 0x07, 0x00, 0x0c, 0x00, 
-0x08, 0x00, 0x0a, 0x00, 0x0e, 0x00, 0x06, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xf6, 0xff, 0xf3, 0xff, 
-0xf3, 0xff, 0xf4, 0xff, 0xf6, 0xff, 0xf3, 0xff, 0xef, 0xff, 0xed, 0xff, 0xed, 0xff, 0xef, 0xff, 
-0xf4, 0xff, 0xfa, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0xf2, 0xff, 0xea, 0xff, 0xe5, 0xff, 0xec, 0xff, 
-0xf4, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xe8, 0xff, 0xde, 0xff, 0xde, 0xff, 0xe3, 0xff, 
-0xe0, 0xff, 0xd5, 0xff, 0xd3, 0xff, 0xdb, 0xff, 0xe3, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe6, 0xff, 
-0xe5, 0xff, 0xda, 0xff, 0xcb, 0xff, 0xcb, 0xff, 0xd0, 0xff, 0xd2, 0xff, 0xd8, 0xff, 0xdd, 0xff, 
-0xda, 0xff, 0xda, 0xff, 0xde, 0xff, 0xe8, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0x00, 0x00, 0x01, 0x00, 
-0x02, 0x00, 0xff, 0xff, 0xfe, 0xff, 0x01, 0x00, 0xfc, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf7, 0xff, 
-0xf6, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0xee, 0xff, 0xf2, 0xff, 0xfb, 0xff, 0xf8, 0xff, 0xf5, 0xff, 
-0xf0, 0xff, 0xe7, 0xff, 0xe8, 0xff, 0xed, 0xff, 0xf4, 0xff, 0xfe, 0xff, 0x03, 0x00, 0x06, 0x00, 
-0x0a, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x11, 0x00, 0x0b, 0x00, 0x05, 0x00, 0xfe, 0xff, 
-0x01, 0x00, 0x03, 0x00, 0xff, 0xff, 0x07, 0x00, 0x0b, 0x00, 0x02, 0x00, 0x02, 0x00, 0x0d, 0x00, 
-0x0e, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x12, 0x00, 0x17, 0x00, 
-0x1d, 0x00, 0x1f, 0x00, 0x1a, 0x00, 0x16, 0x00, 0x18, 0x00, 0x18, 0x00, 0x16, 0x00, 0x11, 0x00, 
-0x0d, 0x00, 0x11, 0x00, 0x10, 0x00, 0x06, 0x00, 0xfe, 0xff, 0xf8, 0xff, 0xee, 0xff, 0xe8, 0xff, 
-0xe7, 0xff, 0xef, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xf3, 0xff, 0xf4, 0xff, 0xf7, 0xff, 0xf9, 0xff, 
-0xfc, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0x03, 0x00, 0x05, 0x00, 0x05, 0x00, 
-0x09, 0x00, 0x05, 0x00, 0xfc, 0xff, 0x01, 0x00, 0x06, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x0e, 0x00, 
-0x03, 0x00, 0xf7, 0xff, 0xf0, 0xff, 0xed, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0x07, 0x00, 0x0e, 0x00, 
-0x17, 0x00, 0x19, 0x00, 0x0f, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x10, 0x00, 0x1e, 0x00, 
-0x15, 0x00, 0x0b, 0x00, 0x10, 0x00, 0x07, 0x00, 0xf9, 0xff, 0xf7, 0xff, 0xf2, 0xff, 0xec, 0xff, 
-0xee, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf7, 0xff, 
-0x02, 0x00, 0x02, 0x00, 0xf9, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf1, 0xff, 
-0xe0, 0xff, 0xdf, 0xff, 0xe2, 0xff, 0xde, 0xff, 0xdd, 0xff, 0xdb, 0xff, 0xd9, 0xff, 0xe6, 0xff, 
-0xea, 0xff, 0xe3, 0xff, 0xe9, 0xff, 0xef, 0xff, 0xec, 0xff, 0xf2, 0xff, 0xf6, 0xff, 0xef, 0xff, 
-0xf4, 0xff, 0xf4, 0xff, 0xe5, 0xff, 0xe9, 0xff, 0xf5, 0xff, 0xf3, 0xff, 0xf4, 0xff, 0xfc, 0xff, 
-0xfd, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x0c, 0x00, 0x22, 0x00, 0x25, 0x00, 0x18, 0x00, 0x08, 0x00, 
-0xf6, 0xff, 0xf3, 0xff, 0x02, 0x00, 0x05, 0x00, 0x01, 0x00, 0x02, 0x00, 0xfa, 0xff, 0xed, 0xff, 
-0xe8, 0xff, 0xe8, 0xff, 0xf1, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xed, 0xff, 
-0xed, 0xff, 0xeb, 0xff, 0xde, 0xff, 0xd4, 0xff, 0xd6, 0xff, 0xde, 0xff, 0xe1, 0xff, 0xdc, 0xff, 
-0xe0, 0xff, 0xed, 0xff, 0xf8, 0xff, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0xfe, 0xff, 
-0xfb, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf6, 0xff, 0xee, 0xff, 0xf2, 0xff, 0xfc, 0xff, 0xfc, 0xff, 
-0xf9, 0xff, 0x02, 0x00, 0x01, 0x00, 0xf8, 0xff, 0x00, 0x00, 0x05, 0x00, 0xfb, 0xff, 0xfa, 0xff, 
-0xfa, 0xff, 0xee, 0xff, 0xf2, 0xff, 0x05, 0x00, 0x0a, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x1f, 0x00, 
-0x22, 0x00, 0x17, 0x00, 0x19, 0x00, 0x25, 0x00, 0x25, 0x00, 0x22, 0x00, 0x26, 0x00, 0x27, 0x00, 
-0x1f, 0x00, 0x1d, 0x00, 0x24, 0x00, 0x23, 0x00, 0x26, 0x00, 0x37, 0x00, 0x3b, 0x00, 0x35, 0x00, 
-0x38, 0x00, 0x31, 0x00, 0x25, 0x00, 0x2d, 0x00, 0x2c, 0x00, 0x1d, 0x00, 0x20, 0x00, 0x21, 0x00, 
-0x16, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x2d, 0x00, 0x34, 0x00, 0x30, 0x00, 0x29, 0x00, 0x29, 0x00, 
-0x21, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x14, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x06, 0x00, 0x06, 0x00, 
-0x09, 0x00, 0x08, 0x00, 0x08, 0x00, 0x07, 0x00, 0x07, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x15, 0x00, 
-0x0f, 0x00, 0x09, 0x00, 0x04, 0x00, 0x07, 0x00, 0x09, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x18, 0x00, 
-0x0a, 0x00, 0x02, 0x00, 0xfb, 0xff, 0xf0, 0xff, 0xf4, 0xff, 0x02, 0x00, 0xfb, 0xff, 0xef, 0xff, 
-0xf9, 0xff, 0x03, 0x00, 0xff, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 
-0xf2, 0xff, 0xf3, 0xff, 0xed, 0xff, 0xd9, 0xff, 0xd4, 0xff, 0xda, 0xff, 0xd4, 0xff, 0xd1, 0xff, 
-0xda, 0xff, 0xe0, 0xff, 0xe3, 0xff, 0xec, 0xff, 0xf6, 0xff, 0xf7, 0xff, 0xf2, 0xff, 0xf2, 0xff, 
-0xf6, 0xff, 0xfe, 0xff, 0x07, 0x00, 0x03, 0x00, 0xf5, 0xff, 0xf3, 0xff, 0xf8, 0xff, 0xf8, 0xff, 
-0xfc, 0xff, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x06, 0x00, 0xff, 0xff, 0xfc, 0xff, 0x02, 0x00, 
-0x00, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xfc, 0xff, 0xf9, 0xff, 0xf1, 0xff, 0xf6, 0xff, 
-0xfe, 0xff, 0xfc, 0xff, 0x00, 0x00, 0x05, 0x00, 0xfd, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf1, 0xff, 
-0xef, 0xff, 0xf5, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xf7, 0xff, 0xe7, 0xff, 0xd9, 0xff, 0xd0, 0xff, 
-0xd4, 0xff, 0xde, 0xff, 0xe1, 0xff, 0xe6, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xe7, 0xff, 
-0xe4, 0xff, 0xe6, 0xff, 0xec, 0xff, 0xf3, 0xff, 0xf5, 0xff, 0xf0, 0xff, 0xef, 0xff, 0xf1, 0xff, 
-0xeb, 0xff, 0xe4, 0xff, 0xe7, 0xff, 0xed, 0xff, 0xf5, 0xff, 0x00, 0x00, 0x02, 0x00, 0xfe, 0xff, 
-0x01, 0x00, 0x03, 0x00, 0xf7, 0xff, 0xe9, 0xff, 0xe7, 0xff, 0xea, 0xff, 0xea, 0xff, 0xf0, 0xff, 
-0xf8, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x00, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x17, 0x00, 
-0x11, 0x00, 0x05, 0x00, 0xfa, 0xff, 0xf8, 0xff, 0xf3, 0xff, 0xee, 0xff, 0xee, 0xff, 0xea, 0xff, 
-0xe9, 0xff, 0xee, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0xf8, 0xff, 0xf0, 0xff, 0xed, 0xff, 0xed, 0xff, 
-0xe7, 0xff, 0xeb, 0xff, 0xf3, 0xff, 0xf2, 0xff, 0xf9, 0xff, 0x01, 0x00, 0xfb, 0xff, 0xf3, 0xff, 
-0xf0, 0xff, 0xef, 0xff, 0xf7, 0xff, 0x05, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x0d, 0x00, 0x10, 0x00, 
-0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x1c, 0x00, 0x17, 0x00, 0x19, 0x00, 0x17, 0x00, 0x11, 0x00, 
-0x17, 0x00, 0x1a, 0x00, 0x14, 0x00, 0x11, 0x00, 0x0f, 0x00, 0x0c, 0x00, 0x11, 0x00, 0x1d, 0x00, 
-0x27, 0x00, 0x2c, 0x00, 0x30, 0x00, 0x32, 0x00, 0x25, 0x00, 0x14, 0x00, 0x0b, 0x00, 0x04, 0x00, 
-0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x05, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0xfc, 0xff, 0x00, 0x00, 0x0d, 0x00, 0x0c, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x12, 0x00, 0x0a, 0x00, 
-0x04, 0x00, 0x03, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xf9, 0xff, 0xf5, 0xff, 0xf9, 0xff, 
-0xff, 0xff, 0x03, 0x00, 0x04, 0x00, 0x03, 0x00, 0xff, 0xff, 0xf6, 0xff, 0xf1, 0xff, 0xf9, 0xff, 
-0xfa, 0xff, 0xf2, 0xff, 0xf4, 0xff, 0xf1, 0xff, 0xe4, 0xff, 0xdf, 0xff, 0xd7, 0xff, 0xc7, 0xff, 
-0xcf, 0xff, 0xe5, 0xff, 0xec, 0xff, 0xeb, 0xff, 0xeb, 0xff, 0xf1, 0xff, 0xf7, 0xff, 0xfb, 0xff, 
-0x03, 0x00, 0x0d, 0x00, 0x0a, 0x00, 0x04, 0x00, 0xfd, 0xff, 0xf4, 0xff, 0xfc, 0xff, 0x06, 0x00, 
-0xf7, 0xff, 0xe5, 0xff, 0xe2, 0xff, 0xdf, 0xff, 0xe1, 0xff, 0xec, 0xff, 0xed, 0xff, 0xea, 0xff, 
-0xef, 0xff, 0xf0, 0xff, 0xee, 0xff, 0xf9, 0xff, 0x00, 0x00, 0xfb, 0xff, 0xfd, 0xff, 0xfd, 0xff, 
-0xf7, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xef, 0xff, 0xeb, 0xff, 0xe1, 0xff, 0xd4, 0xff, 0xdb, 0xff, 
-0xe0, 0xff, 0xd4, 0xff, 0xd4, 0xff, 0xd7, 0xff, 0xd2, 0xff, 0xd7, 0xff, 0xe0, 0xff, 0xe3, 0xff, 
-0xea, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xed, 0xff, 0xe7, 0xff, 0xe6, 0xff, 0xe6, 0xff, 0xe6, 0xff, 
-0xf3, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xfd, 0xff, 0xfc, 0xff, 
-0xf6, 0xff, 0xff, 0xff, 0x03, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xf4, 0xff, 0xf6, 0xff, 
-0xf9, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0x07, 0x00, 0x0d, 0x00, 0x0b, 0x00, 0x13, 0x00, 
-0x20, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x11, 0x00, 
-0x0e, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x11, 0x00, 0x0e, 0x00, 0x13, 0x00, 0x1a, 0x00, 0x18, 0x00, 
-0x19, 0x00, 0x19, 0x00, 0x17, 0x00, 0x17, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x15, 0x00, 
-0x17, 0x00, 0x16, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x08, 0x00, 0x0b, 0x00, 0x0b, 0x00, 
-0x07, 0x00, 0x0b, 0x00, 0x05, 0x00, 0xfe, 0xff, 0x09, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x17, 0x00, 
-0x18, 0x00, 0x15, 0x00, 0x12, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0b, 0x00, 
-0x10, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x19, 0x00, 0x15, 0x00, 0x16, 0x00, 0x10, 0x00, 0x0d, 0x00, 
-0x17, 0x00, 0x12, 0x00, 0x02, 0x00, 0xfd, 0xff, 0xf8, 0xff, 0xf0, 0xff, 0xf2, 0xff, 0xf5, 0xff, 
-0xf5, 0xff, 0xfa, 0xff, 0x05, 0x00, 0x0e, 0x00, 0x0b, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x14, 0x00, 
-0x11, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x09, 0x00, 0xfe, 0xff, 0xfb, 0xff, 0x00, 0x00, 0xff, 0xff, 
-0x02, 0x00, 0x0a, 0x00, 0x0d, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x08, 0x00, 0x07, 0x00, 0x08, 0x00, 
-0x01, 0x00, 0x04, 0x00, 0x04, 0x00, 0xfa, 0xff, 0x01, 0x00, 0x07, 0x00, 0xff, 0xff, 0x07, 0x00, 
-0x14, 0x00, 0x0f, 0x00, 0x0d, 0x00, 0x10, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x06, 0x00, 0xf9, 0xff, 
-0xf7, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xf7, 0xff, 0xee, 0xff, 0xed, 0xff, 0xf3, 0xff, 0xf8, 0xff, 
-0xfe, 0xff, 0xfd, 0xff, 0xf3, 0xff, 0xf2, 0xff, 0xf5, 0xff, 0xec, 0xff, 0xe3, 0xff, 0xe1, 0xff, 
-0xe0, 0xff, 0xe2, 0xff, 0xeb, 0xff, 0xf7, 0xff, 0xf5, 0xff, 0xf1, 0xff, 0xf2, 0xff, 0xed, 0xff, 
-0xe7, 0xff, 0xee, 0xff, 0xf1, 0xff, 0xee, 0xff, 0xf0, 0xff, 0xee, 0xff, 0xe7, 0xff, 0xe3, 0xff, 
-0xde, 0xff, 0xda, 0xff, 0xd6, 0xff, 0xd3, 0xff, 0xd8, 0xff, 0xdf, 0xff, 0xe1, 0xff, 0xe7, 0xff, 
-0xe9, 0xff, 0xe9, 0xff, 0xea, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xf2, 0xff, 0xea, 0xff, 0xea, 0xff, 
-0xeb, 0xff, 0xdc, 0xff, 0xd6, 0xff, 0xd9, 0xff, 0xd1, 0xff, 0xd5, 0xff, 0xe4, 0xff, 0xe5, 0xff, 
-0xe2, 0xff, 0xe2, 0xff, 0xe1, 0xff, 0xe3, 0xff, 0xe1, 0xff, 0xdd, 0xff, 0xe2, 0xff, 0xe5, 0xff, 
-0xe2, 0xff, 0xe4, 0xff, 0xe8, 0xff, 0xea, 0xff, 0xeb, 0xff, 0xee, 0xff, 0xf9, 0xff, 0x02, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfa, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfa, 0xff, 
-0xf3, 0xff, 0xf5, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xfd, 0xff, 
-0xf3, 0xff, 0xe8, 0xff, 0xef, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf5, 0xff, 
-0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0x02, 0x00, 0xfd, 0xff, 
-0xfb, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x02, 0x00, 0x02, 0x00, 0xf9, 0xff, 0xf7, 0xff, 0xf7, 0xff, 
-0xf5, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0x02, 0x00, 0x06, 0x00, 0x09, 0x00, 0x11, 0x00, 0x14, 0x00, 
-0x13, 0x00, 0x19, 0x00, 0x1e, 0x00, 0x19, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x2a, 0x00, 0x28, 0x00, 
-0x26, 0x00, 0x24, 0x00, 0x1e, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x17, 0x00, 0x15, 0x00, 
-0x18, 0x00, 0x10, 0x00, 0x0a, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x21, 0x00, 0x27, 0x00, 
-0x2b, 0x00, 0x24, 0x00, 0x25, 0x00, 0x2c, 0x00, 0x2a, 0x00, 0x25, 0x00, 0x1d, 0x00, 0x12, 0x00, 
-0x13, 0x00, 0x16, 0x00, 0x17, 0x00, 0x1c, 0x00, 0x1a, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x16, 0x00, 
-0x16, 0x00, 0x1d, 0x00, 0x12, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x04, 0x00, 0xff, 0xff, 0x08, 0x00, 
-0x0b, 0x00, 0x0a, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x17, 0x00, 
-0x16, 0x00, 0x0e, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0d, 0x00, 0x0c, 0x00, 0x09, 0x00, 0x08, 0x00, 
-0x08, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x11, 0x00, 0x19, 0x00, 0x15, 0x00, 0x12, 0x00, 
-0x18, 0x00, 0x1a, 0x00, 0x19, 0x00, 0x15, 0x00, 0x0e, 0x00, 0x12, 0x00, 0x18, 0x00, 0x16, 0x00, 
-0x1b, 0x00, 0x1d, 0x00, 0x14, 0x00, 0x17, 0x00, 0x1c, 0x00, 0x15, 0x00, 0x11, 0x00, 0x0d, 0x00, 
-0x0e, 0x00, 0x16, 0x00, 0x16, 0x00, 0x0f, 0x00, 0x0b, 0x00, 0x07, 0x00, 0x09, 0x00, 0x0d, 0x00, 
-0x09, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x12, 0x00, 0x10, 0x00, 0x0a, 0x00, 0x07, 0x00, 0x0d, 0x00, 
-0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0a, 0x00, 
-0x0d, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x14, 0x00, 0x11, 0x00, 0x0f, 0x00, 
-0x11, 0x00, 0x10, 0x00, 0x12, 0x00, 0x13, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x07, 0x00, 
-0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x20, 0x00, 0x21, 0x00, 0x1a, 0x00, 
-0x22, 0x00, 0x2a, 0x00, 0x20, 0x00, 0x1c, 0x00, 0x20, 0x00, 0x1a, 0x00, 0x1c, 0x00, 0x24, 0x00, 
-0x21, 0x00, 0x20, 0x00, 0x21, 0x00, 0x20, 0x00, 0x27, 0x00, 0x28, 0x00, 0x26, 0x00, 0x2f, 0x00, 
-0x34, 0x00, 0x32, 0x00, 0x32, 0x00, 0x26, 0x00, 0x1a, 0x00, 0x18, 0x00, 0x17, 0x00, 0x16, 0x00, 
-0x12, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0b, 0x00, 0x08, 0x00, 0x0d, 0x00, 0x09, 0x00, 0xfe, 0xff, 
-0xff, 0xff, 0x02, 0x00, 0xff, 0xff, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0xff, 
-0xfb, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfc, 0xff, 0xf9, 0xff, 0xf6, 0xff, 0x01, 0x00, 0x04, 0x00, 
-0xfe, 0xff, 0x01, 0x00, 0x00, 0x00, 0xfb, 0xff, 0x01, 0x00, 0x06, 0x00, 0x02, 0x00, 0x03, 0x00, 
-0x0d, 0x00, 0x14, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x26, 0x00, 0x21, 0x00, 0x26, 0x00, 0x27, 0x00, 
-0x20, 0x00, 0x27, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x2c, 0x00, 0x28, 0x00, 0x20, 0x00, 0x22, 0x00, 
-0x27, 0x00, 0x27, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2a, 0x00, 0x2f, 0x00, 0x2e, 0x00, 0x24, 0x00, 
-0x1d, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x1c, 0x00, 0x1b, 0x00, 0x19, 0x00, 0x18, 0x00, 0x19, 0x00, 
-0x18, 0x00, 0x16, 0x00, 0x14, 0x00, 0x12, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x08, 0x00, 0x08, 0x00, 
-0x03, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x06, 0x00, 0x09, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x13, 0x00, 
-0x0e, 0x00, 0x0d, 0x00, 0x0a, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x0f, 0x00, 
-0x0d, 0x00, 0x03, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x08, 0x00, 
-0x06, 0x00, 0x05, 0x00, 0x04, 0x00, 0x04, 0x00, 0x02, 0x00, 0x05, 0x00, 0x08, 0x00, 0x02, 0x00, 
-0xff, 0xff, 0x05, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x03, 0x00, 0x06, 0x00, 0x0e, 0x00, 
-0x0b, 0x00, 0x08, 0x00, 0x0d, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x12, 0x00, 0x0f, 0x00, 0x06, 0x00, 
-0x06, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x15, 0x00, 0x0f, 0x00, 0x11, 0x00, 
-0x18, 0x00, 0x17, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x17, 0x00, 
-0x19, 0x00, 0x19, 0x00, 0x17, 0x00, 0x15, 0x00, 0x16, 0x00, 0x16, 0x00, 0x13, 0x00, 0x14, 0x00, 
-0x12, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x11, 0x00, 0x0b, 0x00, 0x03, 0x00, 
-0x0d, 0x00, 0x10, 0x00, 0x06, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x08, 0x00, 
-0x0a, 0x00, 0x13, 0x00, 0x12, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x0e, 0x00, 
-0x09, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x0a, 0x00, 0xfd, 0xff, 0x00, 0x00, 
-0x01, 0x00, 0x02, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x09, 0x00, 0xfe, 0xff, 0xfe, 0xff, 
-0x09, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x0b, 0x00, 0x08, 0x00, 0x06, 0x00, 0x07, 0x00, 0x0c, 0x00, 
-0x0e, 0x00, 0x06, 0x00, 0x08, 0x00, 0x11, 0x00, 0x0d, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x19, 0x00, 
-0x18, 0x00, 0x1c, 0x00, 0x15, 0x00, 0x0d, 0x00, 0x0b, 0x00, 0x08, 0x00, 0x02, 0x00, 0xf9, 0xff, 
-0xf8, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfe, 0xff, 0xf6, 0xff, 0xf1, 0xff, 0xf8, 0xff, 0xfa, 0xff, 
-0xfa, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xeb, 0xff, 0xeb, 0xff, 0xe8, 0xff, 0xe7, 0xff, 0xe8, 0xff, 
-0xdf, 0xff, 0xe0, 0xff, 0xeb, 0xff, 0xe9, 0xff, 0xe3, 0xff, 0xe4, 0xff, 0xe3, 0xff, 0xea, 0xff, 
-0xf2, 0xff, 0xf2, 0xff, 0xf1, 0xff, 0xee, 0xff, 0xed, 0xff, 0xec, 0xff, 0xe8, 0xff, 0xeb, 0xff, 
-0xee, 0xff, 0xec, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xec, 0xff, 0xf2, 0xff, 0xee, 0xff, 0xe6, 0xff, 
-0xf0, 0xff, 0xf0, 0xff, 0xe6, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xdf, 0xff, 0xe6, 0xff, 0xea, 0xff, 
-0xec, 0xff, 0xf1, 0xff, 0xe9, 0xff, 0xe8, 0xff, 0xf7, 0xff, 0xf5, 0xff, 0xeb, 0xff, 0xf1, 0xff, 
-0xf7, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0xf6, 0xff, 0xf3, 0xff, 0xf5, 0xff, 0xfd, 0xff, 
-0xff, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xf2, 0xff, 0xf3, 0xff, 0xf9, 0xff, 0xf7, 0xff, 
-0xed, 0xff, 0xeb, 0xff, 0xea, 0xff, 0xe3, 0xff, 0xe4, 0xff, 0xe7, 0xff, 0xe9, 0xff, 0xe8, 0xff, 
-0xe5, 0xff, 0xeb, 0xff, 0xf4, 0xff, 0xed, 0xff, 0xea, 0xff, 0xf4, 0xff, 0xf1, 0xff, 0xea, 0xff, 
-0xee, 0xff, 0xf3, 0xff, 0xf5, 0xff, 0xee, 0xff, 0xe6, 0xff, 0xee, 0xff, 0xf7, 0xff, 0xf2, 0xff, 
-0xef, 0xff, 0xf3, 0xff, 0xf5, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xf9, 0xff, 
-0xf6, 0xff, 0xf4, 0xff, 0xf7, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0x04, 0x00, 0x0a, 0x00, 
-0x0d, 0x00, 0x0a, 0x00, 0x04, 0x00, 0x02, 0x00, 0x04, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x08, 0x00, 
-0x07, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x09, 0x00, 0x05, 0x00, 0x06, 0x00, 0x03, 0x00, 0xfe, 0xff, 
-0x02, 0x00, 0x0a, 0x00, 0x04, 0x00, 0xfd, 0xff, 0x01, 0x00, 0x05, 0x00, 0x08, 0x00, 0x09, 0x00, 
-0x02, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0x00, 0x00, 
-0x02, 0x00, 0xff, 0xff, 0x06, 0x00, 0x07, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x0c, 0x00, 
-0x10, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x08, 0x00, 0x06, 0x00, 0x05, 0x00, 
-0x10, 0x00, 0x0e, 0x00, 0x09, 0x00, 0x13, 0x00, 0x0c, 0x00, 0xfd, 0xff, 0x06, 0x00, 0x09, 0x00, 
-0xfd, 0xff, 0xfe, 0xff, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xf7, 0xff, 0xfa, 0xff, 
-0x02, 0x00, 0x07, 0x00, 0x04, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xf3, 0xff, 0xf7, 0xff, 
-0xfb, 0xff, 0xf5, 0xff, 0xf1, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xfc, 0xff, 0xfd, 0xff, 
-0xfd, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf9, 0xff, 
-0xfa, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfc, 0xff, 
-0xfb, 0xff, 0xfc, 0xff, 0x05, 0x00, 0x03, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x08, 0x00, 0xff, 0xff, 
-0x02, 0x00, 0x06, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x0b, 0x00, 
-0x0c, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x10, 0x00, 
-0x16, 0x00, 0x19, 0x00, 0x17, 0x00, 0x15, 0x00, 0x0f, 0x00, 0x09, 0x00, 0x07, 0x00, 0x06, 0x00, 
-0x0a, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 
-0xfe, 0xff, 0x02, 0x00, 0x06, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 
-0xf9, 0xff, 0xf8, 0xff, 0x01, 0x00, 0x03, 0x00, 0xfd, 0xff, 0x03, 0x00, 0x02, 0x00, 0xf9, 0xff, 
-0xfd, 0xff, 0x06, 0x00, 0x02, 0x00, 0x01, 0x00, 0x05, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 
-0xfb, 0xff, 0xf6, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x02, 0x00, 0x02, 0x00, 
-0x00, 0x00, 0x04, 0x00, 0x06, 0x00, 0x01, 0x00, 0x01, 0x00, 0x07, 0x00, 0x02, 0x00, 0xfa, 0xff, 
-0xfe, 0xff, 0x01, 0x00, 0xff, 0xff, 0x04, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x01, 0x00, 0x01, 0x00, 
-0x03, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0xfe, 0xff, 
-0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0xfc, 0xff, 
-0xfa, 0xff, 0xf1, 0xff, 0xeb, 0xff, 0xec, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xee, 0xff, 0xef, 0xff, 
-0xee, 0xff, 0xea, 0xff, 0xef, 0xff, 0xed, 0xff, 0xe3, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xe5, 0xff, 
-0xe4, 0xff, 0xe9, 0xff, 0xe6, 0xff, 0xe2, 0xff, 0xe0, 0xff, 0xe3, 0xff, 0xe8, 0xff, 0xe6, 0xff, 
-0xe6, 0xff, 0xe3, 0xff, 0xd9, 0xff, 0xdb, 0xff, 0xe3, 0xff, 0xda, 0xff, 0xd5, 0xff, 0xda, 0xff, 
-0xd7, 0xff, 0xd8, 0xff, 0xdd, 0xff, 0xdb, 0xff, 0xe0, 0xff, 0xe9, 0xff, 0xe2, 0xff, 0xdb, 0xff, 
-0xe2, 0xff, 0xe6, 0xff, 0xe3, 0xff, 0xdf, 0xff, 0xdc, 0xff, 0xe2, 0xff, 0xe7, 0xff, 0xe1, 0xff, 
-0xdd, 0xff, 0xdc, 0xff, 0xdb, 0xff, 0xe3, 0xff, 0xea, 0xff, 0xe7, 0xff, 0xe8, 0xff, 0xea, 0xff, 
-0xe5, 0xff, 0xe2, 0xff, 0xe3, 0xff, 0xe8, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xe6, 0xff, 0xe9, 0xff, 
-0xe3, 0xff, 0xe1, 0xff, 0xe6, 0xff, 0xe0, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xdd, 0xff, 0xdd, 0xff, 
-0xdd, 0xff, 0xd9, 0xff, 0xdd, 0xff, 0xe0, 0xff, 0xdf, 0xff, 0xe5, 0xff, 0xe3, 0xff, 0xda, 0xff, 
-0xdf, 0xff, 0xe2, 0xff, 0xdd, 0xff, 0xdf, 0xff, 0xde, 0xff, 0xd9, 0xff, 0xe2, 0xff, 0xeb, 0xff, 
-0xec, 0xff, 0xea, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xeb, 0xff, 0xed, 0xff, 0xeb, 0xff, 0xe9, 0xff, 
-0xe6, 0xff, 0xec, 0xff, 0xed, 0xff, 0xe5, 0xff, 0xeb, 0xff, 0xec, 0xff, 0xdd, 0xff, 0xdf, 0xff, 
-0xeb, 0xff, 0xea, 0xff, 0xeb, 0xff, 0xef, 0xff, 0xe8, 0xff, 0xe7, 0xff, 0xed, 0xff, 0xe2, 0xff, 
-0xd6, 0xff, 0xdb, 0xff, 0xe2, 0xff, 0xe0, 0xff, 0xe1, 0xff, 0xe3, 0xff, 0xe0, 0xff, 0xe4, 0xff, 
-0xea, 0xff, 0xe8, 0xff, 0xe9, 0xff, 0xef, 0xff, 0xe8, 0xff, 0xe0, 0xff, 0xe8, 0xff, 0xec, 0xff, 
-0xe7, 0xff, 0xe9, 0xff, 0xe7, 0xff, 0xe2, 0xff, 0xe8, 0xff, 0xec, 0xff, 0xeb, 0xff, 0xef, 0xff, 
-0xf1, 0xff, 0xed, 0xff, 0xef, 0xff, 0xf2, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xea, 0xff, 0xe8, 0xff, 
-0xed, 0xff, 0xeb, 0xff, 0xe8, 0xff, 0xee, 0xff, 0xf0, 0xff, 0xf2, 0xff, 0xfe, 0xff, 0xff, 0xff, 
-0xf6, 0xff, 0xfb, 0xff, 0x05, 0x00, 0xfe, 0xff, 0xf5, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xf9, 0xff, 
-0x02, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x07, 0x00, 0x09, 0x00, 
-0x0d, 0x00, 0x08, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 
-0xfa, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xff, 0xff, 
-0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfb, 0xff, 
-0x03, 0x00, 0xff, 0xff, 0xf9, 0xff, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 
-0xfd, 0xff, 0x03, 0x00, 0x07, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x04, 0x00, 
-0x0b, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x09, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x16, 0x00, 
-0x18, 0x00, 0x1a, 0x00, 0x16, 0x00, 0x11, 0x00, 0x14, 0x00, 0x15, 0x00, 0x13, 0x00, 0x16, 0x00, 
-0x16, 0x00, 0x15, 0x00, 0x15, 0x00, 0x10, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x12, 0x00, 0x0e, 0x00, 
-0x14, 0x00, 0x1c, 0x00, 0x1b, 0x00, 0x16, 0x00, 0x14, 0x00, 0x16, 0x00, 0x19, 0x00, 0x1b, 0x00, 
-0x1c, 0x00, 0x15, 0x00, 0x12, 0x00, 0x17, 0x00, 0x13, 0x00, 0x0f, 0x00, 0x12, 0x00, 0x0f, 0x00, 
-0x0b, 0x00, 0x0e, 0x00, 0x0d, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x10, 0x00, 0x0d, 0x00, 0x12, 0x00, 
-0x0c, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x0d, 0x00, 0x06, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x06, 0x00, 
-0x07, 0x00, 0x0b, 0x00, 0x08, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0xfc, 0xff, 
-0xfc, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 0xfe, 0xff, 0x00, 0x00, 
-0x04, 0x00, 0x01, 0x00, 0xfe, 0xff, 0x01, 0x00, 0xfe, 0xff, 0xfc, 0xff, 0x01, 0x00, 0x00, 0x00, 
-0xfc, 0xff, 0xff, 0xff, 0x02, 0x00, 0x02, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x05, 0x00, 0xfd, 0xff, 
-0xfd, 0xff, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x06, 0x00, 0xfe, 0xff, 0x05, 0x00, 0x0e, 0x00, 
-0x06, 0x00, 0x03, 0x00, 0x07, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x00, 0xfd, 0xff, 0xf7, 0xff, 
-0xf7, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xef, 0xff, 0xf0, 0xff, 0xf9, 0xff, 0xf6, 0xff, 0xee, 0xff, 
-0xef, 0xff, 0xf2, 0xff, 0xee, 0xff, 0xef, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xf9, 0xff, 
-0xfc, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xf6, 0xff, 
-0xfb, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf9, 0xff, 0xff, 0xff, 
-0xf9, 0xff, 0xf6, 0xff, 0xf4, 0xff, 0xf1, 0xff, 0xf3, 0xff, 0xf2, 0xff, 0xf1, 0xff, 0xf8, 0xff, 
-0xf4, 0xff, 0xed, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0xf5, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 
-0x00, 0x00, 0xff, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0xf3, 0xff, 0xf4, 0xff, 0xf6, 0xff, 0xf1, 0xff, 
-0xf3, 0xff, 0xf8, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf3, 0xff, 0xf2, 0xff, 0xf8, 0xff, 
-0xfa, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0xf7, 0xff, 0xf3, 0xff, 0xf3, 0xff, 
-0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf3, 0xff, 0xf3, 0xff, 0xf3, 0xff, 0xf0, 0xff, 0xf1, 0xff, 
-0xf2, 0xff, 0xef, 0xff, 0xf2, 0xff, 0xf6, 0xff, 0xf3, 0xff, 0xef, 0xff, 0xed, 0xff, 0xe9, 0xff, 
-0xe6, 0xff, 0xe6, 0xff, 0xe6, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe6, 0xff, 0xe7, 0xff, 
-0xe8, 0xff, 0xe3, 0xff, 0xe0, 0xff, 0xe3, 0xff, 0xe1, 0xff, 0xdf, 0xff, 0xe1, 0xff, 0xe1, 0xff, 
-0xdf, 0xff, 0xde, 0xff, 0xd9, 0xff, 0xd4, 0xff, 0xd0, 0xff, 0xcf, 0xff, 0xd4, 0xff, 0xd5, 0xff, 
-0xd2, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd0, 0xff, 0xd5, 0xff, 0xdb, 0xff, 0xd9, 0xff, 0xe0, 0xff, 
-0xe6, 0xff, 0xe6, 0xff, 0xeb, 0xff, 0xec, 0xff, 0xe8, 0xff, 0xec, 0xff, 0xed, 0xff, 0xec, 0xff, 
-0xf0, 0xff, 0xec, 0xff, 0xe8, 0xff, 0xec, 0xff, 0xee, 0xff, 0xf1, 0xff, 0xfa, 0xff, 0xf7, 0xff, 
-0xee, 0xff, 0xf0, 0xff, 0xf3, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xfa, 0xff, 
-0xf9, 0xff, 0xf5, 0xff, 0xf6, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xf1, 0xff, 
-0xf1, 0xff, 0xf2, 0xff, 0xee, 0xff, 0xf2, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xed, 0xff, 0xf4, 0xff, 
-0xf3, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xeb, 0xff, 0xea, 0xff, 0xed, 0xff, 0xed, 0xff, 0xee, 0xff, 
-0xee, 0xff, 0xe7, 0xff, 0xea, 0xff, 0xf2, 0xff, 0xef, 0xff, 0xeb, 0xff, 0xec, 0xff, 0xee, 0xff, 
-0xef, 0xff, 0xeb, 0xff, 0xea, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xec, 0xff, 0xf0, 0xff, 0xee, 0xff, 
-0xea, 0xff, 0xec, 0xff, 0xeb, 0xff, 0xec, 0xff, 0xf2, 0xff, 0xf4, 0xff, 0xf6, 0xff, 0xfb, 0xff, 
-0xfa, 0xff, 0xf3, 0xff, 0xee, 0xff, 0xef, 0xff, 0xf1, 0xff, 0xef, 0xff, 0xf0, 0xff, 0xfa, 0xff, 
-0xff, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 0xfd, 0xff, 
-0xfc, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfe, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0x02, 0x00, 
-0x06, 0x00, 0xfb, 0xff, 0xf9, 0xff, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfd, 0xff, 
-0x01, 0x00, 0x02, 0x00, 0xfd, 0xff, 0x00, 0x00, 0x01, 0x00, 0xfb, 0xff, 0xfa, 0xff, 0xfb, 0xff, 
-0xfe, 0xff, 0x04, 0x00, 0xff, 0xff, 0xf6, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 
-0xf9, 0xff, 0xfd, 0xff, 0x08, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x06, 0x00, 0x09, 0x00, 
-0x0c, 0x00, 0x09, 0x00, 0x09, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0f, 0x00, 0x0b, 0x00, 0x07, 0x00, 
-0x0c, 0x00, 0x10, 0x00, 0x10, 0x00, 0x12, 0x00, 0x10, 0x00, 0x13, 0x00, 0x20, 0x00, 0x24, 0x00, 
-0x1f, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x21, 0x00, 0x24, 0x00, 0x22, 0x00, 0x1f, 0x00, 0x21, 0x00, 
-0x20, 0x00, 0x1d, 0x00, 0x21, 0x00, 0x26, 0x00, 0x26, 0x00, 0x27, 0x00, 0x27, 0x00, 0x1d, 0x00, 
-0x17, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x16, 0x00, 0x17, 0x00, 0x13, 0x00, 0x0e, 0x00, 0x17, 0x00, 
-0x1b, 0x00, 0x18, 0x00, 0x1a, 0x00, 0x17, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x19, 0x00, 0x1b, 0x00, 
-0x1f, 0x00, 0x12, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x14, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x18, 0x00, 
-0x13, 0x00, 0x10, 0x00, 0x0a, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x0f, 0x00, 
-0x09, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0xff, 0xff, 0x06, 0x00, 0x06, 0x00, 
-0x02, 0x00, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0x09, 0x00, 0x03, 0x00, 0xfc, 0xff, 0x03, 0x00, 
-0x04, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 
-0x06, 0x00, 0xff, 0xff, 0xfe, 0xff, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x00, 0x02, 0x00, 
-0x00, 0x00, 0xfc, 0xff, 0xfb, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xfe, 0xff, 
-0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x07, 0x00, 0x02, 0x00, 0xfd, 0xff, 0x08, 0x00, 0x08, 0x00, 
-0x02, 0x00, 0x08, 0x00, 0x04, 0x00, 0xfa, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfe, 0xff, 
-0xfa, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf4, 0xff, 
-0xf9, 0xff, 0xf6, 0xff, 0xf0, 0xff, 0xef, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xf1, 0xff, 
-0xf1, 0xff, 0xf0, 0xff, 0xee, 0xff, 0xea, 0xff, 0xe5, 0xff, 0xe6, 0xff, 0xe9, 0xff, 0xed, 0xff, 
-0xef, 0xff, 0xe9, 0xff, 0xe4, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe6, 0xff, 0xeb, 0xff, 0xee, 0xff, 
-0xeb, 0xff, 0xeb, 0xff, 0xee, 0xff, 0xef, 0xff, 0xee, 0xff, 0xef, 0xff, 0xf3, 0xff, 0xf4, 0xff, 
-0xf0, 0xff, 0xef, 0xff, 0xec, 0xff, 0xed, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xed, 0xff, 0xe8, 0xff, 
-0xe1, 0xff, 0xe2, 0xff, 0xe8, 0xff, 0xea, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xe6, 0xff, 0xe6, 0xff, 
-0xea, 0xff, 0xe4, 0xff, 0xe5, 0xff, 0xea, 0xff, 0xe2, 0xff, 0xdc, 0xff, 0xdf, 0xff, 0xdc, 0xff, 
-0xdd, 0xff, 0xe2, 0xff, 0xde, 0xff, 0xdb, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xdc, 0xff, 0xdd, 0xff, 
-0xdd, 0xff, 0xdc, 0xff, 0xd7, 0xff, 0xd5, 0xff, 0xdb, 0xff, 0xdd, 0xff, 0xda, 0xff, 0xdb, 0xff, 
-0xdd, 0xff, 0xdc, 0xff, 0xdf, 0xff, 0xe3, 0xff, 0xe3, 0xff, 0xe1, 0xff, 0xe3, 0xff, 0xe9, 0xff, 
-0xe3, 0xff, 0xdb, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xd9, 0xff, 0xe0, 0xff, 0xe6, 0xff, 0xe2, 0xff, 
-0xe4, 0xff, 0xe4, 0xff, 0xe1, 0xff, 0xe6, 0xff, 0xe2, 0xff, 0xdb, 0xff, 0xe1, 0xff, 0xe1, 0xff, 
-0xdd, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xdc, 0xff, 0xe1, 0xff, 0xe9, 0xff, 0xea, 0xff, 0xeb, 0xff, 
-0xe9, 0xff, 0xe7, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe7, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe8, 0xff, 
-0xeb, 0xff, 0xef, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xea, 0xff, 0xee, 0xff, 
-0xea, 0xff, 0xe7, 0xff, 0xe8, 0xff, 0xe7, 0xff, 0xe9, 0xff, 0xea, 0xff, 0xe7, 0xff, 0xea, 0xff, 
-0xeb, 0xff, 0xe5, 0xff, 0xe3, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe1, 0xff, 0xdf, 0xff, 0xe4, 0xff, 
-0xe9, 0xff, 0xea, 0xff, 0xee, 0xff, 0xf0, 0xff, 0xec, 0xff, 0xed, 0xff, 0xf0, 0xff, 0xf2, 0xff, 
-0xf4, 0xff, 0xf2, 0xff, 0xf1, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf3, 0xff, 
-0xf2, 0xff, 0xf4, 0xff, 0xf3, 0xff, 0xf5, 0xff, 0xf8, 0xff, 0xf2, 0xff, 0xf1, 0xff, 0xf5, 0xff, 
-0xf2, 0xff, 0xf1, 0xff, 0xf6, 0xff, 0xf9, 0xff, 0xf6, 0xff, 0xf2, 0xff, 0xf1, 0xff, 0xf1, 0xff, 
-0xf4, 0xff, 0xfc, 0xff, 0xfa, 0xff, 0xf0, 0xff, 0xf2, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xf7, 0xff, 
-0xf8, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf1, 0xff, 0xf3, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xf2, 0xff, 
-0xfd, 0xff, 0xf5, 0xff, 0xf0, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xf1, 0xff, 0xf2, 0xff, 0xf0, 0xff, 
-0xef, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xf6, 0xff, 
-0xf4, 0xff, 0xf2, 0xff, 0xef, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 
-0xfb, 0xff, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x04, 0x00, 0xff, 0xff, 0x03, 0x00, 0x0c, 0x00, 
-0x08, 0x00, 0x05, 0x00, 0x04, 0x00, 0x02, 0x00, 0x06, 0x00, 0x08, 0x00, 0x03, 0x00, 0x03, 0x00, 
-0x04, 0x00, 0x08, 0x00, 0x12, 0x00, 0x11, 0x00, 0x0c, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x0e, 0x00, 
-0x15, 0x00, 0x14, 0x00, 0x13, 0x00, 0x14, 0x00, 0x11, 0x00, 0x14, 0x00, 0x19, 0x00, 0x12, 0x00, 
-0x10, 0x00, 0x14, 0x00, 0x17, 0x00, 0x17, 0x00, 0x12, 0x00, 0x10, 0x00, 0x15, 0x00, 0x19, 0x00, 
-0x16, 0x00, 0x16, 0x00, 0x1d, 0x00, 0x20, 0x00, 0x1a, 0x00, 0x1c, 0x00, 0x21, 0x00, 0x1b, 0x00, 
-0x19, 0x00, 0x1e, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x25, 0x00, 0x1d, 0x00, 0x19, 0x00, 0x1d, 0x00, 
-0x1a, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x15, 0x00, 0x0b, 0x00, 0x13, 0x00, 
-0x1b, 0x00, 0x17, 0x00, 0x15, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x17, 0x00, 
-0x18, 0x00, 0x11, 0x00, 0x0f, 0x00, 0x12, 0x00, 0x10, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0c, 0x00, 
-0x0b, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0c, 0x00, 0x09, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x08, 0x00, 
-0x07, 0x00, 0x06, 0x00, 0x05, 0x00, 0x08, 0x00, 0x09, 0x00, 0x07, 0x00, 0x04, 0x00, 0x02, 0x00, 
-0x04, 0x00, 0x07, 0x00, 0x03, 0x00, 0x05, 0x00, 0x09, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0x00, 0xff, 0xff, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 
-0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0xfc, 0xff, 0xfd, 0xff, 0x00, 0x00, 0xfa, 0xff, 
-0xf8, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xfc, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xf6, 0xff, 
-0xf3, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xf3, 0xff, 0xf2, 0xff, 0xef, 0xff, 0xec, 0xff, 0xf1, 0xff, 
-0xee, 0xff, 0xee, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xeb, 0xff, 0xef, 0xff, 0xf0, 0xff, 0xf2, 0xff, 
-0xf7, 0xff, 0xf0, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xec, 0xff, 0xf1, 0xff, 0xfd, 0xff, 0xfc, 0xff, 
-0xf7, 0xff, 0xf5, 0xff, 0xee, 0xff, 0xee, 0xff, 0xf4, 0xff, 0xef, 0xff, 0xeb, 0xff, 0xf1, 0xff, 
-0xf5, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xf8, 0xff, 
-0xf6, 0xff, 0xf5, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf3, 0xff, 0xf7, 0xff, 
-0xfa, 0xff, 0xf7, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf8, 0xff, 
-0xfb, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0xfd, 0xff, 
-0xff, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xfc, 0xff, 
-0xfd, 0xff, 0x00, 0x00, 0xff, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xfe, 0xff, 0x01, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 
-0x05, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x0b, 0x00, 0x07, 0x00, 0x02, 0x00, 0x0c, 0x00, 
-0x14, 0x00, 0x0b, 0x00, 0x08, 0x00, 0x09, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x08, 0x00, 
-0x0e, 0x00, 0x14, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x0d, 0x00, 0x0e, 0x00, 
-0x0d, 0x00, 0x11, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x09, 0x00, 
-0x0a, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x05, 0x00, 0x0c, 0x00, 
-0x0c, 0x00, 0x05, 0x00, 0x07, 0x00, 0x06, 0x00, 0x04, 0x00, 0x07, 0x00, 0x05, 0x00, 0x03, 0x00, 
-0x05, 0x00, 0x03, 0x00, 0x04, 0x00, 0x06, 0x00, 0x01, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x06, 0x00, 
-0x09, 0x00, 0x04, 0x00, 0x01, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x07, 0x00, 0x05, 0x00, 0x08, 0x00, 
-0x0a, 0x00, 0x05, 0x00, 0x05, 0x00, 0x09, 0x00, 0x05, 0x00, 0x01, 0x00, 0x05, 0x00, 0x06, 0x00, 
-0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 
-0x05, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x08, 0x00, 
-0x06, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x06, 0x00, 0x05, 0x00, 0x07, 0x00, 0x02, 0x00, 0x06, 0x00, 
-0x0c, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x0a, 0x00, 0x03, 0x00, 0x05, 0x00, 0x05, 0x00, 0x02, 0x00, 
-0x05, 0x00, 0x04, 0x00, 0x02, 0x00, 0x07, 0x00, 0x09, 0x00, 0x08, 0x00, 0x05, 0x00, 0x02, 0x00, 
-0x08, 0x00, 0x06, 0x00, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x08, 0x00, 0x06, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0x02, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xf8, 0xff, 
-0xf8, 0xff, 0xfc, 0xff, 0x00, 0x00, 0xfb, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xf6, 0xff, 0xfe, 0xff, 
-0x00, 0x00, 0xf9, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xf2, 0xff, 
-0xf0, 0xff, 0xf2, 0xff, 0xf7, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xfb, 0xff, 
-0xfb, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xf3, 0xff, 
-0xf2, 0xff, 0xf2, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xf4, 0xff, 0xf3, 0xff, 0xf5, 0xff, 0xf0, 0xff, 
-0xf1, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xed, 0xff, 0xf3, 0xff, 0xee, 0xff, 0xee, 0xff, 0xf2, 0xff, 
-0xef, 0xff, 0xf5, 0xff, 0xf3, 0xff, 0xe7, 0xff, 0xed, 0xff, 0xf3, 0xff, 0xee, 0xff, 0xf5, 0xff, 
-0xf6, 0xff, 0xf1, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf0, 0xff, 
-0xf3, 0xff, 0xf2, 0xff, 0xf5, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf9, 0xff, 
-0xf2, 0xff, 0xf6, 0xff, 0xf7, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf5, 0xff, 
-0xf7, 0xff, 0xf5, 0xff, 0xf2, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf9, 0xff, 
-0xf8, 0xff, 0xf6, 0xff, 0xf3, 0xff, 0xf3, 0xff, 0xf8, 0xff, 0xf5, 0xff, 0xed, 0xff, 0xf1, 0xff, 
-0xf8, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xf7, 0xff, 0xf2, 0xff, 
-0xf1, 0xff, 0xf1, 0xff, 0xf3, 0xff, 0xf1, 0xff, 0xee, 0xff, 0xf3, 0xff, 0xf8, 0xff, 0xf3, 0xff, 
-0xf0, 0xff, 0xf3, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf3, 0xff, 0xf3, 0xff, 0xf2, 0xff, 0xf6, 0xff, 
-0xf5, 0xff, 0xef, 0xff, 0xf0, 0xff, 0xf8, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xf7, 0xff, 0xf6, 0xff, 
-0xf4, 0xff, 0xf3, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xf8, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf6, 0xff, 
-0xfd, 0xff, 0x00, 0x00, 0xfa, 0xff, 0xf3, 0xff, 0xf3, 0xff, 0xf5, 0xff, 0xf2, 0xff, 0xf1, 0xff, 
-0xf4, 0xff, 0xf4, 0xff, 0xf2, 0xff, 0xef, 0xff, 0xec, 0xff, 0xef, 0xff, 0xef, 0xff, 0xeb, 0xff, 
-0xee, 0xff, 0xf2, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf3, 0xff, 0xf0, 0xff, 0xee, 0xff, 0xef, 0xff, 
-0xef, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xec, 0xff, 0xed, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf0, 0xff, 
-0xef, 0xff, 0xf1, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0x01, 0x00, 0xfe, 0xff, 0xf5, 0xff, 0xfa, 0xff, 
-0xfc, 0xff, 0xf3, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0xff, 0xfb, 0xff, 0x01, 0x00, 0x02, 0x00, 
-0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 
-0x00, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x05, 0x00, 0x08, 0x00, 0x06, 0x00, 
-0x03, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x0b, 0x00, 0x0d, 0x00, 
-0x09, 0x00, 0x0b, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x07, 0x00, 0x09, 0x00, 
-0x0a, 0x00, 0x04, 0x00, 0x03, 0x00, 0x05, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x06, 0x00, 
-0x06, 0x00, 0x06, 0x00, 0x08, 0x00, 0x0d, 0x00, 0x0b, 0x00, 0x08, 0x00, 0x0b, 0x00, 0x08, 0x00, 
-0x07, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x0c, 0x00, 0x0f, 0x00, 0x0e, 0x00, 0x07, 0x00, 
-0x03, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x18, 0x00, 
-0x0f, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x0f, 0x00, 0x0e, 0x00, 0x13, 0x00, 0x0a, 0x00, 0x07, 0x00, 
-0x11, 0x00, 0x0f, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x0f, 0x00, 0x0c, 0x00, 0x05, 0x00, 
-0x07, 0x00, 0x0b, 0x00, 0x09, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x05, 0x00, 0xff, 0xff, 0x02, 0x00, 
-0x09, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x04, 0x00, 0x06, 0x00, 0x03, 0x00, 
-0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x06, 0x00, 0x04, 0x00, 0xff, 0xff, 0x05, 0x00, 0x08, 0x00, 
-0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x01, 0x00, 0x06, 0x00, 0x05, 0x00, 0x01, 0x00, 0x06, 0x00, 
-0xff, 0xff, 0xf6, 0xff, 0x01, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfc, 0xff, 
-0x02, 0x00, 0x01, 0x00, 0xfd, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xf9, 0xff, 
-0xfa, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfa, 0xff, 0xfc, 0xff, 0xfc, 0xff, 
-0xfb, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xf2, 0xff, 0xf9, 0xff, 
-0xfb, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0xf6, 0xff, 0xf7, 0xff, 0xf8, 0xff, 
-0xf1, 0xff, 0xec, 0xff, 0xf2, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 
-0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xef, 0xff, 0xeb, 0xff, 0xea, 0xff, 0xed, 0xff, 0xeb, 0xff, 
-0xed, 0xff, 0xef, 0xff, 0xeb, 0xff, 0xed, 0xff, 0xef, 0xff, 0xec, 0xff, 0xef, 0xff, 0xf0, 0xff, 
-0xee, 0xff, 0xf0, 0xff, 0xee, 0xff, 0xec, 0xff, 0xee, 0xff, 0xea, 0xff, 0xe8, 0xff, 0xed, 0xff, 
-0xed, 0xff, 0xe7, 0xff, 0xe5, 0xff, 0xe4, 0xff, 0xe6, 0xff, 0xe6, 0xff, 0xe3, 0xff, 0xe8, 0xff, 
-0xee, 0xff, 0xeb, 0xff, 0xe8, 0xff, 0xe3, 0xff, 0xe0, 0xff, 0xe6, 0xff, 0xe6, 0xff, 0xe2, 0xff, 
-0xe6, 0xff, 0xea, 0xff, 0xe7, 0xff, 0xe6, 0xff, 0xe7, 0xff, 0xea, 0xff, 0xed, 0xff, 0xec, 0xff, 
-0xeb, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xe6, 0xff, 0xe8, 0xff, 0xf2, 0xff, 0xf4, 0xff, 
-0xef, 0xff, 0xf0, 0xff, 0xef, 0xff, 0xee, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xed, 0xff, 0xef, 0xff, 
-0xef, 0xff, 0xeb, 0xff, 0xeb, 0xff, 0xef, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xec, 0xff, 0xf1, 0xff, 
-0xf0, 0xff, 0xef, 0xff, 0xf1, 0xff, 0xef, 0xff, 0xeb, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xea, 0xff, 
-0xe9, 0xff, 0xe8, 0xff, 0xee, 0xff, 0xf2, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xe9, 0xff, 0xee, 0xff, 
-0xee, 0xff, 0xea, 0xff, 0xee, 0xff, 0xf0, 0xff, 0xea, 0xff, 0xeb, 0xff, 0xee, 0xff, 0xeb, 0xff, 
-0xe8, 0xff, 0xea, 0xff, 0xeb, 0xff, 0xef, 0xff, 0xf2, 0xff, 0xf1, 0xff, 0xf4, 0xff, 0xf8, 0xff, 
-0xf5, 0xff, 0xec, 0xff, 0xe9, 0xff, 0xeb, 0xff, 0xea, 0xff, 0xe7, 0xff, 0xeb, 0xff, 0xf4, 0xff, 
-0xf7, 0xff, 0xf2, 0xff, 0xee, 0xff, 0xf3, 0xff, 0xf5, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf5, 0xff, 
-0xf3, 0xff, 0xf3, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf3, 0xff, 0xf1, 0xff, 0xef, 0xff, 0xf5, 0xff, 
-0xfa, 0xff, 0xf6, 0xff, 0xf4, 0xff, 0xf6, 0xff, 0xf3, 0xff, 0xf1, 0xff, 0xf5, 0xff, 0xf4, 0xff, 
-0xf3, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf9, 0xff, 0xf6, 0xff, 0xf0, 0xff, 0xf1, 0xff, 
-0xf4, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf0, 0xff, 0xee, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xef, 0xff, 
-0xf2, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0xfc, 0xff, 
-0xfb, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfe, 0xff, 0xfc, 0xff, 0xfd, 0xff, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0xfe, 0xff, 0xfc, 0xff, 0x04, 0x00, 0x07, 0x00, 
-0x04, 0x00, 0x04, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x08, 0x00, 
-0x0b, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x10, 0x00, 0x0e, 0x00, 
-0x0a, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x08, 0x00, 0x03, 0x00, 0x09, 0x00, 
-0x0a, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x0e, 0x00, 0x0e, 0x00, 
-0x13, 0x00, 0x0b, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x11, 0x00, 0x0d, 0x00, 0x14, 0x00, 0x10, 0x00, 
-0x0f, 0x00, 0x0f, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x12, 0x00, 0x10, 0x00, 0x17, 0x00, 0x1a, 0x00, 
-0x16, 0x00, 0x13, 0x00, 0x0f, 0x00, 0x0e, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x0e, 0x00, 0x0a, 0x00, 
-0x04, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x0b, 0x00, 0xff, 0xff, 0x0c, 0x00, 
-0x0e, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x0a, 0x00, 0x0b, 0x00, 
-0x12, 0x00, 0x0d, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x11, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x0e, 0x00, 
-0x0c, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x09, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x0e, 0x00, 
-0x11, 0x00, 0x10, 0x00, 0x0b, 0x00, 0x12, 0x00, 0x12, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x13, 0x00, 
-0x0b, 0x00, 0x13, 0x00, 0x10, 0x00, 0x09, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x10, 0x00, 0x16, 0x00, 
-0x0a, 0x00, 0x06, 0x00, 0x0f, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x13, 0x00, 0x10, 0x00, 0x0d, 0x00, 
-0x0d, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x14, 0x00, 0x12, 0x00, 0x09, 0x00, 
-0x09, 0x00, 0x08, 0x00, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xff, 0xff, 0x01, 0x00, 
-0xfd, 0xff, 0xff, 0xff, 0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 
-0x02, 0x00, 0xfe, 0xff, 0xfc, 0xff, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0xfe, 0xff, 0xf8, 0xff, 
-0xf4, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf4, 0xff, 0xf8, 0xff, 
-0xfc, 0xff, 0xf6, 0xff, 0xf4, 0xff, 0xf7, 0xff, 0xf2, 0xff, 0xed, 0xff, 0xf0, 0xff, 0xee, 0xff, 
-0xee, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xed, 0xff, 0xed, 0xff, 
-0xef, 0xff, 0xed, 0xff, 0xea, 0xff, 0xe9, 0xff, 0xe7, 0xff, 0xe3, 0xff, 0xe5, 0xff, 0xec, 0xff, 
-0xee, 0xff, 0xed, 0xff, 0xef, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe9, 0xff, 0xe8, 0xff, 
-0xe4, 0xff, 0xe2, 0xff, 0xe4, 0xff, 0xe5, 0xff, 0xe4, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xea, 0xff, 
-0xe9, 0xff, 0xeb, 0xff, 0xeb, 0xff, 0xe6, 0xff, 0xe0, 0xff, 0xe4, 0xff, 0xe7, 0xff, 0xe5, 0xff, 
-0xe9, 0xff, 0xe9, 0xff, 0xe1, 0xff, 0xe3, 0xff, 0xe7, 0xff, 0xe4, 0xff, 0xea, 0xff, 0xf0, 0xff, 
-0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xe6, 0xff, 0xe6, 0xff, 0xea, 0xff, 0xe8, 0xff, 0xe9, 0xff, 
-0xec, 0xff, 0xec, 0xff, 0xeb, 0xff, 0xeb, 0xff, 0xeb, 0xff, 0xea, 0xff, 0xed, 0xff, 0xef, 0xff, 
-0xed, 0xff, 0xea, 0xff, 0xed, 0xff, 0xec, 0xff, 0xe9, 0xff, 0xeb, 0xff, 0xef, 0xff, 0xee, 0xff, 
-0xe7, 0xff, 0xe2, 0xff, 0xe6, 0xff, 0xec, 0xff, 0xeb, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xeb, 0xff, 
-0xed, 0xff, 0xeb, 0xff, 0xee, 0xff, 0xee, 0xff, 0xea, 0xff, 0xec, 0xff, 0xed, 0xff, 0xec, 0xff, 
-0xee, 0xff, 0xec, 0xff, 0xee, 0xff, 0xf6, 0xff, 0xf7, 0xff, 0xf5, 0xff, 0xf7, 0xff, 0xf5, 0xff, 
-0xf3, 0xff, 0xf3, 0xff, 0xf1, 0xff, 0xf4, 0xff, 0xf7, 0xff, 0xf4, 0xff, 0xf7, 0xff, 0xfd, 0xff, 
-0xfa, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xf6, 0xff, 
-0xf6, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xf1, 0xff, 0xf2, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xf5, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 
-0xff, 0xff, 0xfa, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0xf3, 0xff, 0xf0, 0xff, 0xf2, 0xff, 0xf1, 0xff, 
-0xf3, 0xff, 0xf6, 0xff, 0xf7, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xf9, 0xff, 
-0xf8, 0xff, 0xf3, 0xff, 0xee, 0xff, 0xf3, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xf4, 0xff, 0xf4, 0xff, 
-0xfa, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x01, 0x00, 
-0xff, 0xff, 0xfe, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xf8, 0xff, 0xfa, 0xff, 
-0xfd, 0xff, 0xfd, 0xff, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0xff, 
-0x06, 0x00, 0x08, 0x00, 0x05, 0x00, 0x05, 0x00, 0x06, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x09, 0x00, 
-0x03, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x03, 0x00, 0x01, 0x00, 0x06, 0x00, 0x0a, 0x00, 
-0x0a, 0x00, 0x0a, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x0e, 0x00, 
-0x0e, 0x00, 0x10, 0x00, 0x10, 0x00, 0x14, 0x00, 0x17, 0x00, 0x13, 0x00, 0x10, 0x00, 0x17, 0x00, 
-0x1b, 0x00, 0x14, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0f, 0x00, 
-0x15, 0x00, 0x12, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x0e, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x10, 0x00, 
-0x10, 0x00, 0x12, 0x00, 0x13, 0x00, 0x0f, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0b, 0x00, 
-0x0e, 0x00, 0x13, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x09, 0x00, 0x09, 0x00, 0x05, 0x00, 0x08, 0x00, 
-0x0c, 0x00, 0x09, 0x00, 0x08, 0x00, 0x08, 0x00, 0x05, 0x00, 0x06, 0x00, 0x05, 0x00, 0x00, 0x00, 
-0x05, 0x00, 0x09, 0x00, 0x04, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x09, 0x00, 0x0b, 0x00, 0x0e, 0x00, 
-0x08, 0x00, 0x05, 0x00, 0x09, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x0a, 0x00, 
-0x05, 0x00, 0x07, 0x00, 0x08, 0x00, 0x06, 0x00, 0x06, 0x00, 0x08, 0x00, 0x06, 0x00, 0x04, 0x00, 
-0x04, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x05, 0x00, 0x09, 0x00, 0x04, 0x00, 0xfc, 0xff, 
-0xfd, 0xff, 0x06, 0x00, 0x06, 0x00, 0xfc, 0xff, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xfe, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf9, 0xff, 0xf7, 0xff, 
-0xf4, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfa, 0xff, 
-0xf8, 0xff, 0xf4, 0xff, 0xef, 0xff, 0xf2, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xea, 0xff, 0xf3, 0xff, 
-0xf7, 0xff, 0xf1, 0xff, 0xef, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf2, 0xff, 0xf5, 0xff, 
-0xef, 0xff, 0xe8, 0xff, 0xec, 0xff, 0xf2, 0xff, 0xef, 0xff, 0xe9, 0xff, 0xe7, 0xff, 0xed, 0xff, 
-0xf1, 0xff, 0xeb, 0xff, 0xea, 0xff, 0xf1, 0xff, 0xf3, 0xff, 0xf1, 0xff, 0xef, 0xff, 0xed, 0xff, 
-0xf2, 0xff, 0xf4, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xf8, 0xff, 0xf1, 0xff, 0xef, 0xff, 0xf9, 0xff, 
-0xf9, 0xff, 0xf3, 0xff, 0xf4, 0xff, 0xf3, 0xff, 0xe7, 0xff, 0xe4, 0xff, 0xee, 0xff, 0xf2, 0xff, 
-0xee, 0xff, 0xee, 0xff, 0xf0, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xea, 0xff, 0xee, 0xff, 0xeb, 0xff, 
-0xe8, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xe6, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xec, 0xff, 
-0xf1, 0xff, 0xf0, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xef, 0xff, 0xf6, 0xff, 
-0xfe, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0xf6, 0xff, 0xf2, 0xff, 0xf4, 0xff, 0xfc, 0xff, 0xf6, 0xff, 
-0xf5, 0xff, 0xf9, 0xff, 0xf4, 0xff, 0xf1, 0xff, 0xf2, 0xff, 0xf4, 0xff, 0xfc, 0xff, 0xf8, 0xff, 
-0xf3, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xf3, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xef, 0xff, 0xeb, 0xff, 
-0xf1, 0xff, 0xf5, 0xff, 0xf2, 0xff, 0xf1, 0xff, 0xf4, 0xff, 0xf2, 0xff, 0xec, 0xff, 0xf1, 0xff, 
-0xf7, 0xff, 0xf4, 0xff, 0xec, 0xff, 0xeb, 0xff, 0xf2, 0xff, 0xf3, 0xff, 0xef, 0xff, 0xef, 0xff, 
-0xf0, 0xff, 0xf2, 0xff, 0xf1, 0xff, 0xec, 0xff, 0xec, 0xff, 0xee, 0xff, 0xed, 0xff, 0xf4, 0xff, 
-0xf3, 0xff, 0xe7, 0xff, 0xee, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xf1, 0xff, 0xf3, 0xff, 0xf2, 0xff, 
-0xf9, 0xff, 0xf9, 0xff, 0xf2, 0xff, 0xf6, 0xff, 0xf7, 0xff, 0xf4, 0xff, 0xfd, 0xff, 0xfd, 0xff, 
-0xf3, 0xff, 0xf3, 0xff, 0xf2, 0xff, 0xf1, 0xff, 0xf6, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xfc, 0xff, 
-0xfa, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0x03, 0x00, 0x05, 0x00, 0xff, 0xff, 0xfd, 0xff, 0x02, 0x00, 
-0x01, 0x00, 0xfe, 0xff, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x04, 0x00, 0x08, 0x00, 
-0x0d, 0x00, 0x0a, 0x00, 0x08, 0x00, 0x07, 0x00, 0x04, 0x00, 0x06, 0x00, 0x08, 0x00, 0x06, 0x00, 
-0x06, 0x00, 0x08, 0x00, 0x05, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x07, 0x00, 
-0x0a, 0x00, 0x04, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x05, 0x00, 0x09, 0x00, 0x04, 0x00, 
-0x03, 0x00, 0x06, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x08, 0x00, 
-0x05, 0x00, 0x0a, 0x00, 0x06, 0x00, 0xfe, 0xff, 0x03, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x05, 0x00, 0x0a, 0x00, 0x07, 0x00, 0x02, 0x00, 0x04, 0x00, 0x06, 0x00, 0x06, 0x00, 0x08, 0x00, 
-0x09, 0x00, 0x06, 0x00, 0x03, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x07, 0x00, 0xff, 0xff, 0xfe, 0xff, 
-0x00, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x05, 0x00, 0x02, 0x00, 0x06, 0x00, 0x09, 0x00, 
-0x08, 0x00, 0x09, 0x00, 0x09, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x11, 0x00, 0x0d, 0x00, 0x0c, 0x00, 
-0x0d, 0x00, 0x09, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x0d, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x0e, 0x00, 
-0x0d, 0x00, 0x11, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x0f, 0x00, 0x11, 0x00, 0x14, 0x00, 0x16, 0x00, 
-0x15, 0x00, 0x13, 0x00, 0x11, 0x00, 0x0e, 0x00, 0x0d, 0x00, 0x0f, 0x00, 0x12, 0x00, 0x12, 0x00, 
-0x12, 0x00, 0x13, 0x00, 0x15, 0x00, 0x19, 0x00, 0x1b, 0x00, 0x1a, 0x00, 0x19, 0x00, 0x17, 0x00, 
-0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x19, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x17, 0x00, 0x1a, 0x00, 
-0x18, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x15, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x19, 0x00, 
-0x1a, 0x00, 0x19, 0x00, 0x17, 0x00, 0x18, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1b, 0x00, 0x1a, 0x00, 
-0x19, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x19, 0x00, 0x16, 0x00, 0x16, 0x00, 0x19, 0x00, 
-0x1d, 0x00, 0x1c, 0x00, 0x19, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x19, 0x00, 0x16, 0x00, 
-0x14, 0x00, 0x14, 0x00, 0x16, 0x00, 0x17, 0x00, 0x16, 0x00, 0x14, 0x00, 0x13, 0x00, 0x13, 0x00, 
-0x14, 0x00, 0x15, 0x00, 0x12, 0x00, 0x12, 0x00, 0x13, 0x00, 0x10, 0x00, 0x0e, 0x00, 0x10, 0x00, 
-0x0d, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x0d, 0x00, 0x10, 0x00, 0x10, 0x00, 0x0d, 0x00, 0x0d, 0x00, 
-0x0d, 0x00, 0x08, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x02, 0x00, 0x04, 0x00, 
-0x06, 0x00, 0x04, 0x00, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 
-0xf8, 0xff, 0xfc, 0xff, 0x07, 0x00, 0xfe, 0xff, 0xf3, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf8, 0xff, 
-0xfc, 0xff, 0xf3, 0xff, 0xe2, 0xff, 0xea, 0xff, 0xf4, 0xff, 0xe7, 0xff, 0xdf, 0xff, 0xe8, 0xff, 
-0xf0, 0xff, 0xec, 0xff, 0xe6, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xed, 0xff, 0xf4, 0xff, 0xe7, 0xff, 
-0xd9, 0xff, 0xe2, 0xff, 0xef, 0xff, 0xef, 0xff, 0xe5, 0xff, 0xe7, 0xff, 0xf1, 0xff, 0xeb, 0xff, 
-0xeb, 0xff, 0xf8, 0xff, 0xf0, 0xff, 0xdf, 0xff, 0xd4, 0xff, 0xcc, 0xff, 0xda, 0xff, 0xe1, 0xff, 
-0xcd, 0xff, 0xcf, 0xff, 0xdb, 0xff, 0xda, 0xff, 0xec, 0xff, 0xf5, 0xff, 0xe1, 0xff, 0xdf, 0xff, 
-0xe0, 0xff, 0xd0, 0xff, 0xd5, 0xff, 0xf0, 0xff, 0xfb, 0xff, 0xe6, 0xff, 0xd6, 0xff, 0xe7, 0xff, 
-0xe3, 0xff, 0xca, 0xff, 0xcd, 0xff, 0xd1, 0xff, 0xcc, 0xff, 0xd5, 0xff, 0xcf, 0xff, 0xbe, 0xff, 
-0xb8, 0xff, 0xc3, 0xff, 0xdd, 0xff, 0xcb, 0xff, 0xb1, 0xff, 0xdc, 0xff, 0xf3, 0xff, 0xe5, 0xff, 
-0x02, 0x00, 0x03, 0x00, 0xf9, 0xff, 0x2c, 0x00, 0x25, 0x00, 0xec, 0xff, 0xeb, 0xff, 0xd9, 0xff, 
-0xca, 0xff, 0xee, 0xff, 0xe7, 0xff, 0xd2, 0xff, 0xdc, 0xff, 0xcb, 0xff, 0xd5, 0xff, 0x04, 0x00, 
-0xff, 0xff, 0xf9, 0xff, 0x01, 0x00, 0xd7, 0xff, 0xbb, 0xff, 0xd7, 0xff, 0xe6, 0xff, 0xe3, 0xff, 
-0xe7, 0xff, 0xdd, 0xff, 0xd5, 0xff, 0xe6, 0xff, 0xe8, 0xff, 0xcb, 0xff, 0xd6, 0xff, 0x09, 0x00, 
-0x08, 0x00, 0xdd, 0xff, 0xdc, 0xff, 0xf8, 0xff, 0xf3, 0xff, 0xe0, 0xff, 0xe6, 0xff, 0xed, 0xff, 
-0xf3, 0xff, 0x00, 0x00, 0xe0, 0xff, 0xb6, 0xff, 0xd0, 0xff, 0xe3, 0xff, 0xe9, 0xff, 0x1e, 0x00, 
-0x19, 0x00, 0xe3, 0xff, 0xe6, 0xff, 0xda, 0xff, 0xd7, 0xff, 0x09, 0x00, 0xe6, 0xff, 0xb3, 0xff, 
-0xcd, 0xff, 0xc3, 0xff, 0xd9, 0xff, 0x38, 0x00, 0x43, 0x00, 0x3f, 0x00, 0x64, 0x00, 0x54, 0x00, 
-0x5c, 0x00, 0x76, 0x00, 0x42, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x17, 0x00, 0xff, 0xff, 0xe4, 0xff, 
-0xeb, 0xff, 0x0d, 0x00, 0xf8, 0xff, 0xed, 0xff, 0x06, 0x00, 0xe4, 0xff, 0xdd, 0xff, 0x0c, 0x00, 
-0xfb, 0xff, 0xe6, 0xff, 0x10, 0x00, 0x40, 0x00, 0x4d, 0x00, 0x25, 0x00, 0x06, 0x00, 0x0e, 0x00, 
-0xf7, 0xff, 0x01, 0x00, 0x39, 0x00, 0x28, 0x00, 0x21, 0x00, 0x46, 0x00, 0x13, 0x00, 0xf2, 0xff, 
-0x2a, 0x00, 0x19, 0x00, 0xd6, 0xff, 0xc1, 0xff, 0xc9, 0xff, 0xfc, 0xff, 0x1b, 0x00, 0x06, 0x00, 
-0x27, 0x00, 0x57, 0x00, 0x38, 0x00, 0x28, 0x00, 0x4b, 0x00, 0x55, 0x00, 0x2b, 0x00, 0xf5, 0xff, 
-0x0c, 0x00, 0x4e, 0x00, 0x31, 0x00, 0x05, 0x00, 0x27, 0x00, 0x2e, 0x00, 0x27, 0x00, 0x41, 0x00, 
-0x06, 0x00, 0xd9, 0xff, 0x54, 0x00, 0x85, 0x00, 0x0a, 0x00, 0xe7, 0xff, 0x0a, 0x00, 0xeb, 0xff, 
-0xf6, 0xff, 0x06, 0x00, 0xcb, 0xff, 0xe9, 0xff, 0x41, 0x00, 0x14, 0x00, 0xc4, 0xff, 0xdc, 0xff, 
-0x27, 0x00, 0x6b, 0x00, 0x5b, 0x00, 0xfc, 0xff, 0xe9, 0xff, 0x3b, 0x00, 0x72, 0x00, 0x6e, 0x00, 
-0x4e, 0x00, 0x0e, 0x00, 0xd2, 0xff, 0xe7, 0xff, 0x1d, 0x00, 0x06, 0x00, 0xd5, 0xff, 0xdd, 0xff, 
-0xe6, 0xff, 0xe0, 0xff, 0xdc, 0xff, 0xca, 0xff, 0xe5, 0xff, 0x0a, 0x00, 0xc6, 0xff, 0x90, 0xff, 
-0xcd, 0xff, 0x00, 0x00, 0xea, 0xff, 0xb4, 0xff, 0x9e, 0xff, 0xdd, 0xff, 0x09, 0x00, 0xe3, 0xff, 
-0xd5, 0xff, 0xf8, 0xff, 0x26, 0x00, 0x3a, 0x00, 0x04, 0x00, 0xf4, 0xff, 0x38, 0x00, 0x39, 0x00, 
-0x11, 0x00, 0x19, 0x00, 0x1e, 0x00, 0x3a, 0x00, 0x5f, 0x00, 0x50, 0x00, 0x38, 0x00, 0xf6, 0xff, 
-0xb4, 0xff, 0x15, 0x00, 0x7c, 0x00, 0x3f, 0x00, 0x0d, 0x00, 0x3e, 0x00, 0x74, 0x00, 0x67, 0x00, 
-0x23, 0x00, 0x38, 0x00, 0x72, 0x00, 0x36, 0x00, 0x29, 0x00, 0x5f, 0x00, 0x12, 0x00, 0xea, 0xff, 
-0x4a, 0x00, 0x64, 0x00, 0x43, 0x00, 0x23, 0x00, 0xf6, 0xff, 0x1e, 0x00, 0x5e, 0x00, 0x44, 0x00, 
-0x07, 0x00, 0xbb, 0xff, 0x8b, 0xff, 0xc3, 0xff, 0x20, 0x00, 0x3a, 0x00, 0xf7, 0xff, 0xf0, 0xff, 
-0x5f, 0x00, 0x34, 0x00, 0xad, 0xff, 0x04, 0x00, 0x76, 0x00, 0x66, 0x00, 0x52, 0x00, 0x07, 0x00, 
-0xff, 0xff, 0x85, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0xca, 0x00, 0x77, 0x00, 0x5b, 0x00, 0x95, 0x00, 
-0x87, 0x00, 0xa9, 0x00, 0xa0, 0x00, 0x65, 0x00, 0xaa, 0x00, 0x93, 0x00, 0x51, 0x00, 0xa6, 0x00, 
-0x9b, 0x00, 0xc9, 0x00, 0x84, 0x01, 0x73, 0x01, 0x62, 0x01, 0x7b, 0x01, 0x48, 0x01, 0xc0, 0x01, 
-0x9b, 0x01, 0x5b, 0x01, 0xc5, 0x02, 0x71, 0x02, 0xf2, 0x01, 0x8f, 0x04, 0x5a, 0x03, 0x7c, 0x01, 
-0x30, 0x0a, 0x36, 0x13, 0xf1, 0x10, 0xf8, 0x0a, 0xf1, 0x04, 0xe8, 0xfe, 0x28, 0xfe, 0x5c, 0xff, 
-0xf7, 0xfd, 0x13, 0xfe, 0x0a, 0x00, 0x4c, 0x00, 0x2d, 0xfd, 0x8a, 0xf7, 0x26, 0xf5, 0x49, 0xf7, 
-0x57, 0xf8, 0x9d, 0xf8, 0x50, 0xfa, 0x70, 0xfb, 0xeb, 0xfc, 0xb5, 0xfe, 0x1b, 0xfd, 0x54, 0xf9, 
-0x85, 0xf7, 0xbd, 0xf8, 0x80, 0xfb, 0x0b, 0xfd, 0x8b, 0xfc, 0x0e, 0xfc, 0x1f, 0xfd, 0x83, 0xff, 
-0x4f, 0x01, 0x61, 0x01, 0xee, 0x00, 0xc5, 0xff, 0x42, 0xfd, 0x9c, 0xfa, 0xe5, 0xf7, 0xd1, 0xf5, 
-0x0d, 0xf6, 0x8c, 0xf6, 0x39, 0xf6, 0xbe, 0xf7, 0x39, 0xfb, 0x58, 0xff, 0xaa, 0x02, 0x1f, 0x01, 
-0x9b, 0xfb, 0x99, 0xfa, 0x2d, 0x01, 0xe3, 0x07, 0xa4, 0x07, 0xa5, 0x01, 0x78, 0xfa, 0x3b, 0xf4, 
-0x52, 0xf0, 0xc9, 0xef, 0xda, 0xf1, 0xc9, 0xf5, 0x1a, 0xfa, 0xb1, 0xfb, 0x97, 0xf9, 0x64, 0xf6, 
-0xf8, 0xf5, 0x75, 0xf9, 0xd8, 0xfd, 0x84, 0x00, 0xe1, 0xff, 0x1d, 0xfc, 0xb1, 0xfa, 0xe8, 0xfc, 
-0x78, 0xfc, 0x6f, 0xfa, 0xf3, 0xfc, 0x0f, 0x03, 0xa1, 0x08, 0x2e, 0x09, 0x65, 0x03, 0x08, 0xff, 
-0x3a, 0x01, 0xcb, 0x04, 0x48, 0x05, 0x2f, 0x04, 0x79, 0x05, 0x02, 0x0a, 0xfc, 0x0a, 0xd2, 0x01, 
-0xd5, 0xf2, 0x83, 0xea, 0x23, 0xef, 0x90, 0xf7, 0x0f, 0xf9, 0x5b, 0xf6, 0x45, 0xf5, 0xe3, 0xf4, 
-0x1d, 0xf4, 0x23, 0xf4, 0x82, 0xf5, 0xff, 0xf8, 0xd3, 0xfe, 0xef, 0x02, 0x58, 0x01, 0x57, 0xfe, 
-0xbf, 0xfe, 0x7b, 0xff, 0xda, 0xfe, 0xb9, 0xfe, 0x30, 0xff, 0x6e, 0x01, 0x3e, 0x04, 0x6b, 0x03, 
-0xf5, 0xff, 0xfe, 0xfb, 0xc6, 0xf8, 0x64, 0xf9, 0xa7, 0xfb, 0x82, 0xfc, 0xb2, 0xfd, 0x37, 0xfd, 
-0x43, 0xfa, 0x52, 0xf9, 0x09, 0xfa, 0x30, 0xfb, 0x41, 0xff, 0xc6, 0x05, 0x67, 0x0b, 0xe6, 0x0b, 
-0x69, 0x07, 0xcb, 0x04, 0x0d, 0x05, 0x1b, 0x04, 0x58, 0x04, 0x1f, 0x08, 0x32, 0x0c, 0x51, 0x0d, 
-0xa6, 0x0b, 0xde, 0x0a, 0x53, 0x0c, 0x07, 0x0e, 0x72, 0x10, 0x3a, 0x13, 0x5d, 0x14, 0x45, 0x14, 
-0xae, 0x12, 0xf4, 0x0f, 0x7d, 0x0d, 0xd1, 0x09, 0x61, 0x05, 0x98, 0x02, 0x72, 0x01, 0x75, 0x01, 
-0xa8, 0x00, 0xe2, 0xff, 0xeb, 0x02, 0x96, 0x04, 0xa1, 0x01, 0xdd, 0x01, 0xf6, 0x04, 0xb9, 0x05, 
-0xb4, 0x05, 0xe8, 0x02, 0xd3, 0xfe, 0xf0, 0xff, 0x89, 0xff, 0x55, 0xf8, 0x49, 0xf3, 0xc3, 0xf2, 
-0x5f, 0xf2, 0xdc, 0xf2, 0x3f, 0xf3, 0x8d, 0xf2, 0xee, 0xf3, 0x43, 0xf5, 0x99, 0xf2, 0x2d, 0xf1, 
-0xd4, 0xf4, 0xf3, 0xf6, 0x7b, 0xf5, 0x77, 0xf5, 0xd0, 0xf4, 0x02, 0xf1, 0x39, 0xef, 0xea, 0xf1, 
-0x61, 0xf6, 0x02, 0xf8, 0x19, 0xf5, 0x60, 0xf4, 0x18, 0xf8, 0x98, 0xfa, 0x0f, 0xfb, 0xa0, 0xf7, 
-0x17, 0xf1, 0x67, 0xf0, 0x1b, 0xf2, 0x7e, 0xf2, 0x8f, 0xfb, 0x9f, 0x05, 0x1b, 0x05, 0xf8, 0x07, 
-0x97, 0x13, 0x72, 0x1d, 0x49, 0x24, 0x2f, 0x26, 0xa0, 0x21, 0xdf, 0x1c, 0xa5, 0x18, 0x6f, 0x14, 
-0xaa, 0x12, 0x0c, 0x13, 0x09, 0x15, 0xf3, 0x12, 0x8e, 0x0b, 0x8a, 0x09, 0xa2, 0x0a, 0x9c, 0x08, 
-0x39, 0x0e, 0x3c, 0x1a, 0x89, 0x1e, 0xe3, 0x1c, 0x9b, 0x19, 0x20, 0x11, 0x75, 0x05, 0xbc, 0xfd, 
-0x68, 0xfd, 0x32, 0x00, 0x0d, 0x03, 0x7b, 0x07, 0xad, 0x06, 0x15, 0xfe, 0x6d, 0xfa, 0x69, 0xff, 
-0x19, 0x06, 0xdb, 0x0a, 0xd9, 0x09, 0xf0, 0x04, 0xfd, 0xfe, 0xfe, 0xf3, 0xa6, 0xeb, 0xf4, 0xee, 
-0x8d, 0xf2, 0xa2, 0xf0, 0x28, 0xf2, 0x96, 0xf5, 0x5e, 0xf3, 0x84, 0xed, 0x23, 0xe9, 0x04, 0xe9, 
-0xf9, 0xef, 0x40, 0xfb, 0x9f, 0x01, 0xf2, 0x00, 0x2b, 0xfc, 0x7b, 0xf3, 0x4f, 0xee, 0x8b, 0xef, 
-0x95, 0xec, 0xcf, 0xea, 0x17, 0xf5, 0xd7, 0xfd, 0x70, 0xfa, 0xd1, 0xf1, 0x7f, 0xea, 0x73, 0xe8, 
-0x96, 0xea, 0xfa, 0xee, 0xdf, 0xf1, 0x6f, 0xe9, 0xf7, 0xe1, 0x6b, 0xe7, 0xff, 0xe3, 0x46, 0xe4, 
-0x27, 0x0a, 0x37, 0x2f, 0xcf, 0x2a, 0x25, 0x19, 0xd1, 0x12, 0x45, 0x17, 0x4a, 0x1f, 0x14, 0x1a, 
-0x24, 0x0e, 0x81, 0x0e, 0xe7, 0x13, 0x6d, 0x10, 0xf1, 0xff, 0x07, 0xf1, 0x21, 0xfc, 0x47, 0x14, 
-0x07, 0x1e, 0x6d, 0x1e, 0xf1, 0x1e, 0xdb, 0x21, 0xd8, 0x26, 0xe4, 0x20, 0xb5, 0x11, 0x35, 0x09, 
-0xa5, 0x07, 0x26, 0x0a, 0xcb, 0x09, 0xc0, 0xfd, 0xf9, 0xf5, 0x1d, 0xfd, 0xcd, 0x03, 0x6e, 0x06, 
-0x26, 0x0c, 0xd2, 0x12, 0x96, 0x16, 0x1f, 0x13, 0x4e, 0x08, 0x89, 0xfe, 0xfd, 0xfa, 0xda, 0xfa, 
-0xce, 0xf7, 0x45, 0xf2, 0x8c, 0xf2, 0x74, 0xf7, 0xf1, 0xf7, 0x5d, 0xf2, 0xdd, 0xeb, 0xd7, 0xeb, 
-0x44, 0xf3, 0xcb, 0xf9, 0xf5, 0xf9, 0x0f, 0xf5, 0x1e, 0xf1, 0x98, 0xf1, 0xe8, 0xf0, 0x85, 0xee, 
-0xb8, 0xee, 0x7f, 0xf1, 0xa6, 0xf9, 0xcb, 0xff, 0xdc, 0xfa, 0x87, 0xf9, 0x27, 0xfc, 0x88, 0xf3, 
-0xdc, 0xed, 0xaf, 0xef, 0x94, 0xe9, 0x08, 0xe8, 0xf6, 0xf1, 0x2a, 0xf9, 0xc7, 0xfc, 0x52, 0xf7, 
-0x13, 0xe7, 0x6a, 0xdf, 0xd4, 0xe0, 0xa5, 0xde, 0xc7, 0xdc, 0x88, 0xe6, 0x4a, 0x04, 0xd7, 0x24, 
-0x43, 0x2b, 0x3b, 0x1d, 0x1c, 0x0d, 0x68, 0x08, 0x05, 0x19, 0x0a, 0x24, 0xc6, 0x15, 0x03, 0x0b, 
-0x81, 0x0b, 0x80, 0x08, 0xd3, 0x05, 0x3f, 0xff, 0xd1, 0xf9, 0x95, 0x08, 0x94, 0x1a, 0xb0, 0x1a, 
-0xc0, 0x11, 0x10, 0x0a, 0x18, 0x0e, 0x73, 0x1d, 0x41, 0x25, 0xb6, 0x23, 0xff, 0x20, 0x4a, 0x1a, 
-0xce, 0x0f, 0x48, 0x02, 0x5b, 0xf5, 0xcf, 0xf3, 0xaf, 0xfa, 0xec, 0xff, 0x34, 0x04, 0x4d, 0x0a, 
-0x76, 0x10, 0x87, 0x10, 0x9e, 0x09, 0x4b, 0x04, 0x71, 0x01, 0x1c, 0xfe, 0x61, 0xfc, 0xdc, 0xf8, 
-0x1d, 0xf4, 0x0b, 0xf4, 0xf7, 0xf3, 0x4e, 0xf1, 0x29, 0xf1, 0x26, 0xf3, 0x5d, 0xf4, 0xe8, 0xf1, 
-0xcb, 0xec, 0x8e, 0xec, 0xdf, 0xf2, 0x27, 0xfb, 0x86, 0xff, 0xf2, 0xfb, 0xcb, 0xf4, 0x0f, 0xec, 
-0x79, 0xe5, 0x79, 0xf0, 0xdd, 0x06, 0xdf, 0x0d, 0x18, 0x01, 0x0a, 0xf0, 0xbd, 0xeb, 0xe2, 0xf1, 
-0x6a, 0xea, 0xc9, 0xde, 0x77, 0xeb, 0x3b, 0xfd, 0x0f, 0xfd, 0x40, 0xf5, 0xb2, 0xe8, 0xc5, 0xd9, 
-0x84, 0xd4, 0x87, 0xd9, 0xb1, 0xe3, 0x5d, 0xf0, 0x37, 0x07, 0xe7, 0x26, 0xd6, 0x2b, 0x5b, 0x13, 
-0x0f, 0x0a, 0x38, 0x0f, 0x35, 0x0f, 0x29, 0x17, 0x14, 0x1c, 0xb5, 0x0f, 0x08, 0x09, 0x6b, 0x07, 
-0xb3, 0xf8, 0xbf, 0xed, 0xb8, 0xf8, 0x20, 0x0d, 0xe7, 0x18, 0xe9, 0x1d, 0x82, 0x26, 0x28, 0x2d, 
-0x59, 0x2b, 0xd8, 0x23, 0x84, 0x14, 0x6a, 0x07, 0x8e, 0x0a, 0xdb, 0x0d, 0x47, 0x02, 0x5f, 0xf4, 
-0xf8, 0xef, 0xa1, 0xf2, 0x28, 0xf3, 0x2d, 0xf4, 0xfc, 0x03, 0x15, 0x19, 0x39, 0x1f, 0x94, 0x19, 
-0xdf, 0x0d, 0x12, 0x00, 0x1e, 0xfb, 0x9d, 0xfb, 0x39, 0xfb, 0xb4, 0xfd, 0xc8, 0xfc, 0xb9, 0xf3, 
-0x3d, 0xe9, 0xfa, 0xde, 0x1b, 0xdb, 0xa9, 0xe7, 0x3c, 0xfc, 0x16, 0x09, 0x17, 0x09, 0x3a, 0xfd, 
-0x81, 0xeb, 0xee, 0xe0, 0x9d, 0xe6, 0x3e, 0xf5, 0x26, 0x00, 0xc6, 0x04, 0x12, 0x00, 0x30, 0xf1, 
-0x36, 0xe9, 0x1c, 0xf1, 0x21, 0xf7, 0x78, 0xf1, 0x24, 0xed, 0x00, 0xf3, 0x47, 0xfb, 0xc0, 0xf8, 
-0x70, 0xe8, 0x5f, 0xdb, 0x1d, 0xe5, 0x2d, 0xf9, 0xf7, 0xf9, 0x51, 0xec, 0x6e, 0xe7, 0x4e, 0xe9, 
-0x2f, 0xee, 0x44, 0xfc, 0xe4, 0x0c, 0xa5, 0x1b, 0x36, 0x23, 0x04, 0x13, 0xb2, 0xf9, 0xb8, 0xf6, 
-0x16, 0x06, 0x39, 0x19, 0x79, 0x24, 0xa5, 0x1b, 0x11, 0x12, 0x82, 0x13, 0xb4, 0x05, 0x0e, 0xf5, 
-0x66, 0x07, 0xd8, 0x25, 0xe0, 0x28, 0x13, 0x18, 0x2c, 0x0a, 0x01, 0x05, 0x34, 0x01, 0x05, 0xfe, 
-0x23, 0x06, 0x84, 0x14, 0xf1, 0x19, 0xe0, 0x16, 0x8c, 0x0e, 0x74, 0x03, 0x8c, 0xff, 0x3f, 0x02, 
-0x5c, 0x02, 0xea, 0x01, 0x09, 0x06, 0x48, 0x0a, 0xe1, 0x07, 0x5d, 0x01, 0x8e, 0xfd, 0x8a, 0xfc, 
-0xba, 0xfe, 0x7c, 0x03, 0xe1, 0x01, 0x6a, 0xfb, 0x16, 0xf8, 0x5d, 0xf2, 0x84, 0xeb, 0x88, 0xeb, 
-0x25, 0xec, 0xd3, 0xec, 0x8c, 0xf1, 0x91, 0xf2, 0x4b, 0xf3, 0x02, 0xfb, 0x00, 0x02, 0x6d, 0x03, 
-0xdd, 0xfa, 0xd1, 0xec, 0x81, 0xed, 0xba, 0xf2, 0xae, 0xf0, 0x11, 0x04, 0xe8, 0x1a, 0x56, 0x02, 
-0x73, 0xdc, 0x05, 0xdb, 0x40, 0xeb, 0x0d, 0xfc, 0x04, 0x08, 0x9d, 0xff, 0x22, 0xf0, 0x4b, 0xea, 
-0x3e, 0xe7, 0x7a, 0xeb, 0x5d, 0xf8, 0x61, 0xfb, 0x81, 0xed, 0xe2, 0xd8, 0xec, 0xcf, 0x68, 0xe0, 
-0xf1, 0x00, 0x18, 0x23, 0x5f, 0x3d, 0xaf, 0x3d, 0x8e, 0x23, 0xcc, 0x0b, 0x7a, 0x04, 0xa7, 0x03, 
-0xb8, 0x06, 0x52, 0x0d, 0xda, 0x08, 0x91, 0xf4, 0x9d, 0xe4, 0x58, 0xe9, 0x37, 0xff, 0x91, 0x19, 
-0xb8, 0x2b, 0x46, 0x32, 0x97, 0x2e, 0x21, 0x21, 0x28, 0x16, 0x6f, 0x15, 0xfc, 0x13, 0xc3, 0x12, 
-0x47, 0x14, 0x70, 0x06, 0x18, 0xee, 0xfc, 0xe6, 0x6c, 0xef, 0xe0, 0xf6, 0x64, 0xfe, 0x4d, 0x0a, 
-0x43, 0x14, 0xe3, 0x12, 0x75, 0x08, 0xed, 0x00, 0x00, 0x02, 0xdc, 0x07, 0xc6, 0x07, 0x69, 0xfe, 
-0x08, 0xf9, 0x72, 0xfa, 0x36, 0xfa, 0x70, 0xfa, 0x5f, 0xf6, 0x90, 0xeb, 0x72, 0xec, 0xa4, 0xf6, 
-0xc5, 0xf4, 0xcc, 0xeb, 0xf3, 0xe9, 0x34, 0xef, 0xbc, 0xf5, 0xac, 0xf8, 0x93, 0xfa, 0xca, 0xfb, 
-0x9e, 0xfa, 0x78, 0xfd, 0x2e, 0xfe, 0x27, 0xf7, 0x4a, 0xf7, 0x7d, 0xfa, 0x45, 0xf6, 0x53, 0xf7, 
-0xd1, 0xfa, 0xf1, 0xfa, 0xb3, 0xff, 0xa0, 0xfc, 0x3c, 0xf4, 0x31, 0xf6, 0x09, 0xec, 0xc4, 0xda, 
-0xfc, 0xe3, 0x9e, 0xf0, 0x20, 0xf1, 0x7a, 0xf8, 0x5f, 0xf1, 0x97, 0xdc, 0x54, 0xeb, 0x46, 0x17, 
-0xd8, 0x33, 0xd0, 0x2f, 0x25, 0x0e, 0x98, 0xf3, 0x2d, 0x04, 0x74, 0x1f, 0x3e, 0x1b, 0x48, 0x0a, 
-0xaa, 0x08, 0xb4, 0x0b, 0x39, 0x02, 0xc9, 0xf3, 0xc0, 0xf1, 0x2a, 0x01, 0x94, 0x17, 0x7d, 0x22, 
-0xf9, 0x19, 0x93, 0x0d, 0x03, 0x11, 0x26, 0x20, 0xa5, 0x24, 0x75, 0x19, 0x92, 0x10, 0xd7, 0x0e, 
-0x6c, 0x09, 0x25, 0x00, 0xa0, 0xf9, 0x68, 0xfb, 0xdd, 0x02, 0xd6, 0xff, 0x31, 0xf4, 0x91, 0xf4, 
-0xe1, 0xff, 0x3f, 0x0a, 0xb8, 0x0d, 0x7c, 0x04, 0xcf, 0xfc, 0x46, 0x07, 0xb7, 0x13, 0x7d, 0x10, 
-0x1f, 0x02, 0xc6, 0xf5, 0x96, 0xf3, 0x15, 0xef, 0x55, 0xe2, 0x45, 0xe3, 0xfb, 0xf1, 0xbd, 0xf6, 
-0xec, 0xf2, 0xa3, 0xf2, 0x03, 0xf6, 0x49, 0xfc, 0xa1, 0x04, 0x25, 0x0a, 0xcd, 0x04, 0x09, 0xf8, 
-0x25, 0xf3, 0xc6, 0xf1, 0x87, 0xeb, 0xd5, 0xec, 0x9f, 0xf3, 0xc0, 0xf6, 0x7b, 0xfe, 0x30, 0x01, 
-0xb8, 0xf3, 0x03, 0xea, 0xa4, 0xeb, 0xda, 0xee, 0xd9, 0xf4, 0x34, 0xf9, 0x9c, 0xf7, 0xf8, 0xf6, 
-0x5e, 0xf3, 0x8b, 0xe6, 0x17, 0xdc, 0xa0, 0xe6, 0x0b, 0x0a, 0x17, 0x2c, 0x24, 0x2d, 0x6c, 0x14, 
-0x7a, 0x03, 0xaa, 0x05, 0x0c, 0x09, 0x9a, 0x04, 0x47, 0x04, 0x2b, 0x09, 0x22, 0x0a, 0xee, 0x07, 
-0xcc, 0x00, 0x13, 0xf9, 0x50, 0x02, 0x26, 0x1a, 0xf3, 0x31, 0x27, 0x40, 0x18, 0x33, 0x39, 0x12, 
-0x91, 0x01, 0xf4, 0x01, 0x1e, 0x00, 0xe8, 0xff, 0xeb, 0xff, 0x54, 0xf7, 0xfa, 0xee, 0x9d, 0xf0, 
-0xaf, 0xfa, 0x8a, 0x08, 0x6e, 0x14, 0x4d, 0x1a, 0x0a, 0x1c, 0x12, 0x1e, 0x22, 0x1d, 0xcb, 0x14, 
-0x7e, 0x09, 0x58, 0xf8, 0x2c, 0xe1, 0xf6, 0xd9, 0x40, 0xe5, 0x45, 0xea, 0x3a, 0xe6, 0x2c, 0xe6, 
-0x0e, 0xf2, 0x7f, 0x0a, 0x6d, 0x19, 0x6e, 0x0f, 0xa5, 0xfe, 0x8c, 0xf8, 0x96, 0xff, 0xd3, 0x01, 
-0x11, 0xe6, 0x3c, 0xc9, 0x99, 0xd8, 0xbd, 0xfa, 0xf5, 0x03, 0x0d, 0xf8, 0xe7, 0xee, 0xdc, 0xf4, 
-0xcc, 0xfb, 0x60, 0xf4, 0x1e, 0xf1, 0x70, 0x01, 0x08, 0x16, 0xf2, 0x1a, 0x92, 0x08, 0x2d, 0xeb, 
-0xfb, 0xd4, 0xff, 0xd0, 0x98, 0xe7, 0x2f, 0x01, 0xb4, 0xfb, 0x6f, 0xea, 0x48, 0xe3, 0x61, 0xdd, 
-0x31, 0xea, 0x1a, 0x13, 0x94, 0x34, 0xe1, 0x36, 0xbf, 0x1c, 0x32, 0xfe, 0x98, 0xfc, 0xdf, 0x0c, 
-0x0c, 0x0f, 0x9f, 0x06, 0xba, 0x01, 0x98, 0x02, 0x5b, 0x02, 0x72, 0xf9, 0x41, 0xf5, 0x0d, 0x05, 
-0x3d, 0x23, 0xef, 0x3b, 0x9a, 0x32, 0xd6, 0x10, 0xff, 0x08, 0x66, 0x1c, 0x4f, 0x22, 0xfb, 0x11, 
-0xcf, 0xfa, 0x66, 0xf0, 0xd7, 0xf6, 0x07, 0xf6, 0x63, 0xeb, 0x6e, 0xec, 0xcb, 0xfa, 0x4e, 0x0f, 
-0x1f, 0x1e, 0xe1, 0x18, 0xea, 0x09, 0x03, 0x03, 0x79, 0x06, 0xba, 0x09, 0x96, 0x02, 0x90, 0x01, 
-0x59, 0x0c, 0xdc, 0x00, 0xe5, 0xe1, 0xe7, 0xd5, 0xc7, 0xdc, 0x8b, 0xea, 0x80, 0xfc, 0x6c, 0x03, 
-0x61, 0xfc, 0xd5, 0xf6, 0x6b, 0xfc, 0xe9, 0x02, 0x38, 0xf9, 0x81, 0xf1, 0x2c, 0xfc, 0xdc, 0xfa, 
-0x6c, 0xeb, 0x84, 0xeb, 0x58, 0xf5, 0xac, 0xfe, 0xdb, 0xff, 0xe6, 0xf0, 0x95, 0xee, 0xa6, 0xfc, 
-0xa4, 0xfb, 0x1b, 0xf6, 0xc6, 0xf2, 0xb6, 0xeb, 0xfc, 0xf6, 0x27, 0xfd, 0x8d, 0xe3, 0x90, 0xdd, 
-0xab, 0xf5, 0xf5, 0xfa, 0x88, 0xef, 0x8c, 0xeb, 0xd0, 0xf6, 0xa9, 0x12, 0xfe, 0x28, 0xda, 0x26, 
-0x3a, 0x12, 0xac, 0x00, 0xc3, 0x0a, 0xd0, 0x1c, 0x7e, 0x12, 0xcf, 0xfd, 0xd4, 0xf8, 0x64, 0xfe, 
-0x70, 0x04, 0xc1, 0x01, 0xc2, 0x01, 0x9b, 0x12, 0xf7, 0x1d, 0x23, 0x17, 0xee, 0x0b, 0x34, 0x06, 
-0x65, 0x11, 0xbd, 0x25, 0x13, 0x2c, 0x2b, 0x23, 0x54, 0x0e, 0x98, 0xfb, 0xba, 0xfb, 0x17, 0xf9, 
-0x86, 0xf2, 0x5d, 0xfd, 0xc0, 0xfd, 0xd3, 0xee, 0xc6, 0xf2, 0xce, 0xfa, 0x77, 0xfc, 0x6f, 0x09, 
-0xd2, 0x10, 0x4e, 0x09, 0xbf, 0x02, 0x78, 0x01, 0x82, 0x08, 0x60, 0x0c, 0xb3, 0x02, 0xcd, 0xfd, 
-0x4b, 0xfa, 0x17, 0xeb, 0xc4, 0xe1, 0xd0, 0xe3, 0xc1, 0xe9, 0xa8, 0xf2, 0xc2, 0xf6, 0xca, 0xf7, 
-0x92, 0xf7, 0x01, 0xf3, 0xf1, 0xf7, 0x6e, 0x02, 0x41, 0x06, 0xe1, 0x0d, 0xe5, 0x07, 0xde, 0xe6, 
-0xcb, 0xd3, 0x80, 0xe0, 0xc1, 0xf7, 0xfb, 0x06, 0xaa, 0xfc, 0x47, 0xe8, 0x45, 0xe6, 0x4b, 0xec, 
-0x8c, 0xf2, 0xfd, 0xf9, 0x09, 0xfa, 0x64, 0xfc, 0x5f, 0xfd, 0x22, 0xeb, 0x57, 0xde, 0xb0, 0xf3, 
-0x8a, 0x1b, 0xe4, 0x2c, 0xb9, 0x14, 0x76, 0xfb, 0x1a, 0xfc, 0xc2, 0xfc, 0x2d, 0x07, 0x5f, 0x24, 
-0x9d, 0x28, 0x22, 0x16, 0x68, 0x0a, 0x5d, 0xfc, 0xb3, 0xf8, 0x46, 0x0e, 0x84, 0x22, 0x1e, 0x24, 
-0xa9, 0x15, 0xbd, 0x07, 0xa1, 0x09, 0x01, 0x0d, 0x5c, 0x15, 0x92, 0x2a, 0x23, 0x27, 0x7c, 0x0a, 
-0x6a, 0xfd, 0x67, 0xfb, 0x8e, 0xf7, 0xc2, 0xf4, 0xbf, 0xf0, 0x57, 0xf8, 0x11, 0x06, 0x8c, 0x03, 
-0x75, 0x01, 0xfd, 0x0b, 0xee, 0x12, 0x48, 0x13, 0xfd, 0x0e, 0x84, 0x09, 0x9f, 0x02, 0x6c, 0xef, 
-0x30, 0xe0, 0x39, 0xe2, 0x91, 0xe1, 0x16, 0xe2, 0x32, 0xea, 0xee, 0xe8, 0x20, 0xeb, 0x15, 0xfa, 
-0x02, 0x01, 0x55, 0x00, 0x73, 0xff, 0x2f, 0x03, 0xfc, 0x13, 0x0f, 0x1a, 0x04, 0x08, 0x62, 0xf9, 
-0x6e, 0xf2, 0x8f, 0xe9, 0x8f, 0xe3, 0xe5, 0xdb, 0x57, 0xd7, 0x60, 0xde, 0x16, 0xe7, 0x23, 0xf1, 
-0x39, 0xfa, 0x4e, 0xfb, 0x18, 0x02, 0x89, 0x06, 0x53, 0xf6, 0x23, 0xec, 0x2a, 0xf0, 0xd2, 0xe1, 
-0x08, 0xd0, 0xad, 0xe8, 0x02, 0x1c, 0xe4, 0x31, 0x95, 0x24, 0xf7, 0x16, 0x60, 0x10, 0xbd, 0x14, 
-0x85, 0x2b, 0x73, 0x2c, 0x8d, 0x0b, 0x5d, 0x03, 0xb3, 0x11, 0xdb, 0xfe, 0x08, 0xdd, 0xed, 0xde, 
-0x99, 0xff, 0x7c, 0x19, 0xda, 0x1c, 0xf9, 0x16, 0xa6, 0x0f, 0x18, 0x11, 0x99, 0x28, 0xae, 0x33, 
-0x02, 0x1d, 0x7e, 0x13, 0x80, 0x1a, 0x81, 0x07, 0xcd, 0xeb, 0xdc, 0xe8, 0x99, 0xf9, 0x2d, 0x09, 
-0x7d, 0x03, 0xf4, 0xf4, 0x7a, 0xf3, 0x53, 0xf6, 0xac, 0xfe, 0x4f, 0x0c, 0x92, 0x0a, 0x48, 0x05, 
-0x15, 0x08, 0x1d, 0xff, 0xfc, 0xf0, 0x4a, 0xee, 0xf1, 0xf1, 0x1d, 0xf6, 0x11, 0xf2, 0x13, 0xed, 
-0xca, 0xf3, 0x92, 0xf1, 0xe8, 0xe7, 0x25, 0xf0, 0x31, 0xfa, 0x9d, 0xff, 0xe9, 0x0d, 0x94, 0x09, 
-0xa4, 0xed, 0x15, 0xe7, 0x5c, 0xf7, 0xc1, 0xf9, 0xf4, 0xed, 0xd8, 0xea, 0xf2, 0xed, 0xae, 0xe7, 
-0xfe, 0xdd, 0x78, 0xdb, 0x7e, 0xe2, 0x95, 0xf8, 0xd0, 0x0c, 0x6d, 0x07, 0x6e, 0xf5, 0x3d, 0xde, 
-0x7b, 0xc2, 0xd4, 0xcc, 0xd1, 0x0b, 0xfc, 0x41, 0xa2, 0x3e, 0x98, 0x14, 0xf9, 0xf6, 0x5e, 0xfe, 
-0x76, 0x16, 0xc6, 0x26, 0x96, 0x25, 0xa8, 0x1a, 0x2e, 0x1a, 0x07, 0x10, 0x3e, 0xe6, 0x86, 0xd6, 
-0xfa, 0x03, 0x9b, 0x30, 0xd8, 0x31, 0xe4, 0x17, 0x6e, 0xf9, 0xf3, 0xf2, 0xf1, 0x0b, 0x17, 0x26, 
-0x1a, 0x30, 0xcb, 0x2f, 0x90, 0x25, 0xd5, 0x0c, 0x66, 0xeb, 0x39, 0xda, 0xdb, 0xec, 0xb0, 0x0e, 
-0x41, 0x19, 0x42, 0x08, 0x5c, 0xf9, 0xa4, 0xfa, 0x0a, 0xff, 0x99, 0x02, 0xfe, 0x08, 0xab, 0x0c, 
-0x53, 0x0d, 0x1c, 0x07, 0xc1, 0xf0, 0x5c, 0xda, 0xc8, 0xd8, 0x15, 0xe8, 0xae, 0xfc, 0xa1, 0x04, 
-0x50, 0xf4, 0x76, 0xe2, 0xbe, 0xe5, 0x75, 0xf5, 0xa4, 0x04, 0x26, 0x0f, 0xf4, 0x10, 0x2e, 0x08, 
-0xe0, 0xf8, 0x12, 0xe9, 0x23, 0xdd, 0x5b, 0xdf, 0xa5, 0xf1, 0x8d, 0xf9, 0xcf, 0xeb, 0xba, 0xe0, 
-0xd4, 0xe0, 0x0d, 0xe7, 0xc4, 0xf2, 0x91, 0xf5, 0xaf, 0xf3, 0xf2, 0xf7, 0xf6, 0xe1, 0x19, 0xbc, 
-0x6c, 0xcb, 0x2d, 0x04, 0xee, 0x2a, 0x7b, 0x3a, 0x72, 0x2c, 0xbc, 0x07, 0x31, 0x07, 0xe6, 0x28, 
-0xcc, 0x31, 0x79, 0x25, 0x2d, 0x1f, 0x92, 0x18, 0xc7, 0x0c, 0xd4, 0xf7, 0xb7, 0xe1, 0x0d, 0xeb, 
-0xb3, 0x0e, 0x08, 0x20, 0x50, 0x13, 0x8e, 0x00, 0x56, 0xfe, 0xae, 0x0f, 0xe1, 0x22, 0x67, 0x2c, 
-0x77, 0x2d, 0x38, 0x22, 0xe4, 0x0d, 0x88, 0xfc, 0xf3, 0xf0, 0xb5, 0xed, 0x0e, 0xf4, 0x00, 0xf8, 
-0x5e, 0xf4, 0xbc, 0xf1, 0x72, 0xf4, 0x18, 0xfe, 0x4c, 0x0c, 0xbe, 0x13, 0x09, 0x15, 0xd9, 0x1a, 
-0xa7, 0x1b, 0xa6, 0x0a, 0xe4, 0xf7, 0x3e, 0xf5, 0x4f, 0xf9, 0x59, 0xf5, 0x4c, 0xe9, 0x0a, 0xdc, 
-0x33, 0xd5, 0x67, 0xdb, 0xd5, 0xe9, 0x5e, 0xf2, 0xf2, 0xf6, 0xd4, 0x02, 0x2d, 0x09, 0xe3, 0xfd, 
-0xfb, 0xf4, 0x68, 0xfb, 0xaa, 0x04, 0x4d, 0x05, 0xc8, 0xf5, 0x36, 0xdc, 0x6c, 0xd1, 0x77, 0xdb, 
-0x02, 0xe7, 0x16, 0xe9, 0x6a, 0xe6, 0x2d, 0xe2, 0xe7, 0xd5, 0x02, 0xc9, 0x09, 0xd8, 0x6f, 0x02, 
-0xd0, 0x23, 0x9e, 0x2c, 0x42, 0x27, 0x3c, 0x1c, 0x7c, 0x17, 0xad, 0x26, 0x01, 0x3c, 0x06, 0x37, 
-0x58, 0x20, 0x65, 0x16, 0xcd, 0x05, 0xee, 0xe8, 0x16, 0xef, 0xe1, 0x09, 0xf0, 0x07, 0xdc, 0xfe, 
-0xa4, 0xfd, 0x47, 0xf4, 0x0c, 0xfb, 0xac, 0x16, 0x94, 0x24, 0x6e, 0x26, 0x3b, 0x29, 0xa9, 0x24, 
-0x2e, 0x1a, 0x0a, 0x11, 0x5b, 0x07, 0x1f, 0xfb, 0x24, 0xf3, 0x89, 0xf4, 0xc8, 0xf3, 0xbb, 0xec, 
-0xe0, 0xec, 0xab, 0xf7, 0xaf, 0x05, 0x7b, 0x0a, 0x65, 0x05, 0xdf, 0x0c, 0x18, 0x18, 0x0d, 0x0c, 
-0xe6, 0xfc, 0xf1, 0xf7, 0x31, 0xee, 0x5c, 0xe9, 0x3a, 0xeb, 0x3b, 0xe9, 0xe5, 0xea, 0xc5, 0xeb, 
-0x86, 0xea, 0xf7, 0xee, 0x71, 0xf0, 0xbf, 0xf8, 0x38, 0x09, 0xa5, 0x06, 0x93, 0xff, 0x38, 0xff, 
-0x9c, 0xed, 0xb5, 0xdc, 0x2b, 0xdb, 0xe8, 0xda, 0xf3, 0xe5, 0xfa, 0xea, 0x7c, 0xda, 0x50, 0xdb, 
-0x68, 0xe2, 0xd3, 0xd4, 0xd1, 0xe1, 0x2c, 0x11, 0xeb, 0x2c, 0xd4, 0x2b, 0x19, 0x23, 0x19, 0x1b, 
-0x55, 0x17, 0x76, 0x1f, 0x81, 0x31, 0xa2, 0x2f, 0xac, 0x16, 0x18, 0x0a, 0x55, 0x03, 0x06, 0xf3, 
-0xe7, 0xf0, 0x27, 0xfd, 0xb6, 0x0a, 0xfc, 0x17, 0x7e, 0x10, 0x9c, 0xf8, 0xbe, 0xf5, 0x78, 0x0b, 
-0xa6, 0x1f, 0x19, 0x21, 0x0f, 0x1a, 0x57, 0x1a, 0x53, 0x13, 0x33, 0x05, 0x0a, 0x08, 0xd4, 0x0f, 
-0x65, 0x0e, 0x45, 0x09, 0xb4, 0xf8, 0xb6, 0xe8, 0xe2, 0xeb, 0xff, 0xf5, 0xae, 0x00, 0x7f, 0x03, 
-0x20, 0xf8, 0xa0, 0xf9, 0x13, 0x05, 0xc6, 0xff, 0xe8, 0xfa, 0xa1, 0xfe, 0x0a, 0xfe, 0x5f, 0x00, 
-0x7b, 0xfc, 0x95, 0xea, 0x3f, 0xe2, 0x3c, 0xe6, 0xbe, 0xea, 0x85, 0xf0, 0x07, 0xf0, 0x7d, 0xea, 
-0x17, 0xee, 0x55, 0xf7, 0x21, 0xfc, 0xe7, 0xf9, 0xb0, 0xef, 0x83, 0xe5, 0x7e, 0xe9, 0x3a, 0xf3, 
-0xca, 0xe6, 0x8b, 0xcd, 0x2a, 0xc8, 0xb2, 0xc7, 0xe4, 0xc6, 0x57, 0xee, 0x33, 0x22, 0xe7, 0x23, 
-0x4d, 0x13, 0x0b, 0x1d, 0x62, 0x2c, 0x59, 0x35, 0x53, 0x3b, 0xc5, 0x32, 0x5b, 0x24, 0xf4, 0x23, 
-0xbb, 0x1e, 0xbc, 0xf9, 0x97, 0xd8, 0x73, 0xeb, 0xcf, 0x0d, 0xbb, 0x0c, 0x48, 0xff, 0xfe, 0xfc, 
-0x03, 0xff, 0xcc, 0x0d, 0x79, 0x22, 0x80, 0x26, 0xf5, 0x22, 0xd4, 0x21, 0x4b, 0x17, 0x5c, 0x04, 
-0xe4, 0xf8, 0x65, 0xfb, 0x57, 0x02, 0xa0, 0x03, 0x21, 0xff, 0xae, 0xf3, 0x04, 0xe8, 0xca, 0xed, 
-0x50, 0xff, 0x60, 0x09, 0xb6, 0x0c, 0x7d, 0x0e, 0x12, 0x0e, 0xe4, 0x08, 0xc8, 0xfb, 0x0e, 0xf5, 
-0x45, 0xfd, 0xe9, 0xfc, 0x5f, 0xee, 0x35, 0xe6, 0xf7, 0xe3, 0xc7, 0xe3, 0x0e, 0xeb, 0x61, 0xef, 
-0x45, 0xeb, 0x70, 0xea, 0xcd, 0xef, 0x89, 0xf5, 0x06, 0xf8, 0x1a, 0xf5, 0xf2, 0xec, 0x83, 0xe7, 
-0x19, 0xf0, 0xbf, 0xf9, 0xba, 0xed, 0x70, 0xd9, 0xbf, 0xcd, 0x47, 0xc9, 0xd5, 0xdc, 0x17, 0x02, 
-0xea, 0x10, 0x5f, 0x0e, 0x3f, 0x10, 0x1f, 0x11, 0xe0, 0x1d, 0xa8, 0x39, 0xe4, 0x43, 0x69, 0x36, 
-0x04, 0x27, 0x6a, 0x20, 0xe6, 0x19, 0x76, 0x05, 0x99, 0xf4, 0x5d, 0xf9, 0x21, 0xfe, 0x64, 0xfc, 
-0x7d, 0xfa, 0x3f, 0xed, 0x6d, 0xe8, 0x3a, 0xff, 0x10, 0x15, 0x77, 0x1b, 0xef, 0x1b, 0xa1, 0x1a, 
-0x5b, 0x1d, 0x38, 0x1c, 0xd8, 0x13, 0xf8, 0x11, 0x6e, 0x0e, 0x83, 0x04, 0xe3, 0x00, 0x23, 0xfb, 
-0x2f, 0xf1, 0x2b, 0xef, 0x56, 0xf1, 0xc7, 0xf5, 0x49, 0xf8, 0x2a, 0xf4, 0x2d, 0xf8, 0xb3, 0x01, 
-0x22, 0x03, 0xcc, 0x04, 0xc8, 0x05, 0x9f, 0x02, 0x61, 0x01, 0xef, 0xf8, 0xf8, 0xec, 0xa2, 0xed, 
-0xb2, 0xf3, 0x84, 0xf5, 0xfa, 0xef, 0x22, 0xe8, 0x9c, 0xeb, 0x44, 0xec, 0xaf, 0xde, 0x67, 0xd8, 
-0x88, 0xdd, 0xac, 0xe8, 0x77, 0xf6, 0xa2, 0xf3, 0x78, 0xe7, 0xb5, 0xdd, 0x25, 0xce, 0xfb, 0xd9, 
-0x04, 0x08, 0x5d, 0x1b, 0xe6, 0x14, 0x09, 0x18, 0xf0, 0x14, 0x8c, 0x12, 0x31, 0x22, 0x17, 0x2b, 
-0x10, 0x2b, 0xf2, 0x30, 0xe6, 0x2c, 0x52, 0x15, 0x2a, 0xfb, 0xb2, 0xf2, 0x59, 0xfd, 0xf2, 0x09, 
-0xa5, 0x0e, 0x8f, 0x07, 0xb4, 0xf4, 0x25, 0xeb, 0x4d, 0xf8, 0x9b, 0x0c, 0x95, 0x1a, 0x98, 0x21, 
-0x53, 0x20, 0xbe, 0x14, 0x24, 0x07, 0x71, 0x05, 0x6a, 0x0b, 0x86, 0x0d, 0xf8, 0x0c, 0x6b, 0x07, 
-0x64, 0xfb, 0x1b, 0xf1, 0x4a, 0xeb, 0xe1, 0xed, 0x8c, 0xf8, 0x93, 0xff, 0xe1, 0x02, 0x76, 0x00, 
-0xf0, 0xf4, 0x78, 0xf5, 0x63, 0x02, 0x61, 0x03, 0x53, 0x00, 0x1b, 0x01, 0xf8, 0xf8, 0xbf, 0xed, 
-0x17, 0xe7, 0x54, 0xe4, 0x74, 0xea, 0x3b, 0xf1, 0xf6, 0xec, 0x83, 0xe2, 0x4b, 0xdc, 0xf3, 0xe1, 
-0x79, 0xeb, 0x86, 0xeb, 0xc3, 0xea, 0x19, 0xf0, 0x9a, 0xec, 0xf7, 0xd9, 0xf2, 0xd0, 0x66, 0xeb, 
-0x2d, 0x11, 0x3a, 0x1b, 0x30, 0x16, 0x33, 0x16, 0xf1, 0x17, 0x12, 0x21, 0x21, 0x28, 0x76, 0x21, 
-0xf3, 0x23, 0xde, 0x2d, 0xba, 0x23, 0x3b, 0x0c, 0xa8, 0xf8, 0x9c, 0xf4, 0x0f, 0x04, 0x20, 0x0d, 
-0xd9, 0x02, 0x14, 0xf9, 0x72, 0xf9, 0xf2, 0x02, 0xc0, 0x0c, 0xc4, 0x0b, 0xe1, 0x0e, 0xef, 0x1c, 
-0xac, 0x1e, 0xb4, 0x0f, 0x71, 0x03, 0xdd, 0x04, 0xe3, 0x0d, 0x1b, 0x0e, 0xc7, 0x02, 0xb3, 0xf9, 
-0x6d, 0xf9, 0xaa, 0xfc, 0xe3, 0xf9, 0x01, 0xf5, 0x45, 0xfe, 0x17, 0x0c, 0x38, 0x06, 0x66, 0xf3, 
-0x6c, 0xeb, 0x5b, 0xf5, 0x10, 0x03, 0xf1, 0x03, 0xe1, 0xfa, 0x3f, 0xf2, 0x3e, 0xee, 0x72, 0xf0, 
-0x42, 0xef, 0x5d, 0xe7, 0x8f, 0xe8, 0x53, 0xf0, 0x59, 0xee, 0x85, 0xe4, 0xe0, 0xd9, 0x0b, 0xd9, 
-0x25, 0xe8, 0x0d, 0xf2, 0x0a, 0xeb, 0xd6, 0xde, 0x85, 0xd1, 0xd0, 0xd4, 0x25, 0xf7, 0xb6, 0x11, 
-0xd5, 0x0e, 0xf9, 0x11, 0xf7, 0x1e, 0xda, 0x1e, 0x39, 0x1f, 0xd6, 0x25, 0xbf, 0x26, 0xa3, 0x2f, 
-0x96, 0x3b, 0x2e, 0x2b, 0x6d, 0x0b, 0xd5, 0xfe, 0xee, 0x03, 0x94, 0x0a, 0x47, 0x0a, 0x67, 0x01, 
-0xe5, 0xf5, 0x32, 0xef, 0x12, 0xf3, 0xbd, 0xfa, 0xaa, 0xfc, 0xba, 0x06, 0x86, 0x19, 0xd3, 0x1a, 
-0xd8, 0x0f, 0x07, 0x0c, 0x60, 0x0a, 0x3b, 0x0e, 0x9e, 0x18, 0x7f, 0x17, 0xef, 0x0c, 0x12, 0x05, 
-0x0c, 0xfe, 0x1e, 0xf8, 0x73, 0xf4, 0x16, 0xf5, 0x5d, 0xfa, 0xbe, 0xf8, 0xe7, 0xf1, 0xf2, 0xf0, 
-0xff, 0xee, 0xaf, 0xec, 0x8b, 0xf3, 0x6b, 0xfa, 0xa6, 0xfa, 0xa3, 0xf9, 0x91, 0xf6, 0x8a, 0xf0, 
-0x30, 0xed, 0x33, 0xf0, 0xd9, 0xf2, 0x5f, 0xee, 0x52, 0xea, 0xf0, 0xe6, 0xd6, 0xdc, 0x4a, 0xd9, 
-0xaf, 0xe0, 0x99, 0xdf, 0x33, 0xd7, 0xce, 0xd8, 0x78, 0xe9, 0xa6, 0x02, 0x62, 0x12, 0x4f, 0x12, 
-0x60, 0x12, 0xc2, 0x18, 0x5e, 0x21, 0xa9, 0x29, 0x54, 0x2b, 0x37, 0x2b, 0x54, 0x30, 0x99, 0x2d, 
-0x14, 0x1d, 0xc8, 0x0d, 0xea, 0x08, 0x47, 0x09, 0xad, 0x07, 0xfd, 0x03, 0xeb, 0xfe, 0xa4, 0xf7, 
-0x41, 0xf6, 0xdb, 0xfb, 0x86, 0xfb, 0xaf, 0xf9, 0x1b, 0x02, 0x4d, 0x0b, 0xd8, 0x0c, 0xa0, 0x0a, 
-0x6e, 0x07, 0x24, 0x08, 0x2f, 0x0d, 0xc0, 0x0e, 0x3b, 0x0c, 0x71, 0x08, 0x50, 0x03, 0x60, 0x00, 
-0x74, 0xfe, 0x27, 0xf9, 0x56, 0xf7, 0xac, 0xfb, 0x0c, 0xfc, 0x60, 0xf9, 0x17, 0xfa, 0x82, 0xf8, 
-0x92, 0xf5, 0xed, 0xf6, 0xfb, 0xf3, 0x40, 0xed, 0x7c, 0xef, 0x04, 0xf4, 0x88, 0xef, 0xb4, 0xe9, 
-0xda, 0xe9, 0x0a, 0xeb, 0xb2, 0xe8, 0xce, 0xe6, 0x8f, 0xe7, 0x88, 0xe6, 0x15, 0xe8, 0xc3, 0xec, 
-0xb4, 0xe7, 0x7b, 0xe4, 0x83, 0xf5, 0x07, 0x08, 0x9d, 0x0e, 0x9d, 0x11, 0x32, 0x0e, 0xcd, 0x0a, 
-0x80, 0x10, 0xcf, 0x10, 0x47, 0x0c, 0xcc, 0x11, 0xf8, 0x19, 0x38, 0x1a, 0xea, 0x11, 0x31, 0x06, 
-0x09, 0x03, 0xf4, 0x07, 0xa4, 0x0b, 0xe3, 0x0c, 0x4c, 0x0a, 0xda, 0x06, 0x88, 0x06, 0x8c, 0x03, 
-0xb2, 0x01, 0x50, 0x06, 0xe7, 0x06, 0xf8, 0x02, 0xdf, 0x03, 0x43, 0x07, 0xba, 0x07, 0x17, 0x04, 
-0xf1, 0x00, 0x60, 0x03, 0x62, 0x05, 0x19, 0x04, 0x4c, 0x03, 0xa4, 0xff, 0xc6, 0xfc, 0x0a, 0x02, 
-0xf8, 0x05, 0x9c, 0x02, 0xfc, 0x00, 0x92, 0x03, 0x8e, 0x05, 0xf7, 0x05, 0xaf, 0x04, 0xeb, 0x00, 
-0x93, 0xfd, 0x11, 0xfd, 0xfc, 0xfb, 0xa9, 0xfa, 0x91, 0xfc, 0xd7, 0xfc, 0x2b, 0xfa, 0x1e, 0xfa, 
-0xc9, 0xfa, 0x1a, 0xfc, 0x5f, 0x00, 0x3e, 0x01, 0xa3, 0xfe, 0x63, 0xfe, 0xa9, 0xfe, 0xac, 0xfe, 
-0x4e, 0xfe, 0x1c, 0xfc, 0xab, 0xfb, 0x9c, 0xfc, 0x0c, 0xfc, 0x16, 0xfb, 0x2b, 0xf8, 0x08, 0xf5, 
-0xcf, 0xf5, 0xfd, 0xf7, 0x8c, 0xfa, 0x3a, 0xfb, 0xec, 0xf6, 0x81, 0xf5, 0x95, 0xf9, 0x87, 0xfb, 
-0x12, 0xfc, 0xd9, 0xfd, 0x62, 0xff, 0xd2, 0x00, 0xa2, 0x01, 0x75, 0x02, 0xe6, 0x02, 0xa9, 0x02, 
-0x5e, 0x06, 0xe8, 0x09, 0xed, 0x06, 0x00, 0x05, 0x0a, 0x07, 0x1a, 0x08, 0xd5, 0x08, 0x91, 0x09, 
-0x14, 0x0a, 0xf6, 0x07, 0xb0, 0x02, 0x97, 0x03, 0xab, 0x06, 0xf0, 0x02, 0xb5, 0x03, 0x80, 0x07, 
-0x2a, 0x04, 0x52, 0x04, 0xde, 0x05, 0xe9, 0x00, 0x03, 0x01, 0x96, 0x03, 0x58, 0x02, 0x19, 0x04, 
-0x80, 0x02, 0xca, 0xfd, 0xb5, 0xff, 0x20, 0x00, 0xd1, 0xfd, 0xc0, 0xfe, 0xc9, 0xfd, 0x7f, 0xfd, 
-0x5c, 0xfe, 0x83, 0xfb, 0x10, 0xfb, 0xc6, 0xfa, 0x66, 0xf8, 0x5a, 0xfc, 0x9f, 0xfe, 0x8d, 0xfa, 
-0xea, 0xf9, 0xca, 0xf8, 0x43, 0xf7, 0x74, 0xfa, 0xe1, 0xf9, 0x6c, 0xf8, 0x05, 0xfb, 0x06, 0xf9, 
-0x55, 0xf7, 0xef, 0xf9, 0x25, 0xf8, 0x03, 0xf7, 0x2a, 0xfb, 0x70, 0xfd, 0x08, 0xfd, 0xd8, 0xfb, 
-0x2e, 0xfb, 0xa0, 0xfb, 0x11, 0xfb, 0xa0, 0xfd, 0x30, 0x02, 0x3d, 0x00, 0xf7, 0xfd, 0x29, 0x01, 
-0x1e, 0x02, 0x78, 0x00, 0x02, 0x00, 0xe0, 0xff, 0x48, 0x01, 0x57, 0x03, 0xef, 0x03, 0x24, 0x03, 
-0x35, 0x01, 0x09, 0x02, 0x89, 0x05, 0x41, 0x05, 0xc7, 0x02, 0x57, 0x02, 0xd8, 0x02, 0x77, 0x04, 
-0x7f, 0x05, 0x00, 0x04, 0x1c, 0x03, 0x11, 0x03, 0xa6, 0x02, 0x25, 0x03, 0xa9, 0x02, 0x22, 0x00, 
-0x7c, 0xfe, 0xe2, 0xfe, 0x22, 0x00, 0xdc, 0xff, 0xd3, 0xfd, 0x12, 0xfd, 0x5e, 0xfd, 0x67, 0xfd, 
-0x83, 0xfe, 0x41, 0xff, 0xf6, 0xfe, 0x79, 0x00, 0x1b, 0x02, 0x80, 0x01, 0x8e, 0x01, 0x51, 0x02, 
-0xfc, 0x00, 0xf8, 0xfe, 0x98, 0xfd, 0x43, 0xfc, 0xa5, 0xfc, 0x37, 0xfd, 0xc6, 0xf9, 0xaa, 0xf6, 
-0x37, 0xf9, 0x86, 0xfc, 0xfd, 0xfc, 0xb5, 0xfc, 0x92, 0xfb, 0x07, 0xfb, 0xe0, 0xfc, 0x7b, 0xfd, 
-0xe1, 0xfb, 0x6d, 0xfb, 0x6c, 0xfd, 0x2b, 0x01, 0x7d, 0x02, 0x4d, 0xff, 0xab, 0xfe, 0x01, 0x03, 
-0x27, 0x05, 0x0b, 0x04, 0x2e, 0x03, 0xc4, 0x01, 0xd9, 0xff, 0xfd, 0xfe, 0x2c, 0xff, 0xad, 0x00, 
-0x05, 0x02, 0x84, 0x00, 0xc0, 0xfd, 0x87, 0xfd, 0x80, 0x00, 0xc3, 0x03, 0xb2, 0x04, 0x91, 0x04, 
-0xed, 0x04, 0x9a, 0x04, 0xd5, 0x03, 0x18, 0x03, 0xd2, 0x01, 0x77, 0x02, 0x6d, 0x04, 0xec, 0x02, 
-0x8d, 0x00, 0xa5, 0x00, 0x8d, 0xff, 0xf8, 0xfe, 0x7c, 0x01, 0x94, 0x01, 0xd6, 0xff, 0x57, 0x01, 
-0x4b, 0x02, 0x47, 0x00, 0xa5, 0xff, 0x5f, 0x01, 0xb5, 0x02, 0x4f, 0x02, 0x24, 0x01, 0x5d, 0xff, 
-0xa5, 0xfc, 0x60, 0xfc, 0x96, 0xfe, 0x5e, 0xfe, 0xc0, 0xfd, 0xde, 0xfe, 0xd6, 0xfd, 0xe1, 0xfc, 
-0x5c, 0xfe, 0x73, 0xfe, 0x17, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0x2a, 0xfe, 0x67, 0xfd, 0xf6, 0xfc, 
-0x7e, 0xfd, 0x0f, 0xfd, 0xd6, 0xfd, 0x65, 0x00, 0x69, 0xff, 0x01, 0xfe, 0x59, 0x00, 0xac, 0x01, 
-0xda, 0x01, 0x98, 0x02, 0xb2, 0x01, 0x06, 0x01, 0x81, 0x01, 0xf8, 0x01, 0x32, 0x03, 0xe4, 0x02, 
-0xf2, 0x00, 0xf3, 0xff, 0xbd, 0xfe, 0xdf, 0xfe, 0xae, 0x00, 0x7a, 0x00, 0x8e, 0x00, 0xd7, 0x00, 
-0x8b, 0xfe, 0x90, 0xfe, 0xb1, 0x00, 0x1e, 0x01, 0x6d, 0x02, 0x3d, 0x02, 0x2b, 0x00, 0x07, 0x02, 
-0x58, 0x03, 0x22, 0x01, 0x31, 0x01, 0xfd, 0x01, 0x88, 0x01, 0xd3, 0x01, 0x3f, 0x01, 0x88, 0x00, 
-0x48, 0x00, 0xfb, 0xfe, 0x6b, 0xff, 0x1a, 0x01, 0x60, 0x01, 0xb0, 0x01, 0xc3, 0x00, 0x65, 0xff, 
-0xc4, 0x00, 0x18, 0x01, 0x0a, 0x00, 0x00, 0x01, 0xfa, 0x00, 0x10, 0x00, 0x1f, 0x00, 0x7d, 0xfe, 
-0x7f, 0xfd, 0xf1, 0xfe, 0xb4, 0xfe, 0xac, 0xfd, 0xe2, 0xfd, 0xb4, 0xfd, 0xe6, 0xfd, 0x7c, 0xfe, 
-0x45, 0xfe, 0xb2, 0xfe, 0x98, 0xff, 0x97, 0xff, 0x1d, 0xff, 0x8c, 0xfe, 0xc6, 0xfe, 0x48, 0x00, 
-0x66, 0x01, 0x14, 0x01, 0xf8, 0xff, 0x67, 0xff, 0x19, 0x00, 0xa9, 0x00, 0xf5, 0xff, 0x1a, 0xff, 
-0x29, 0xff, 0x26, 0x00, 0x41, 0x01, 0xf8, 0x00, 0x7c, 0xff, 0x11, 0xff, 0xd6, 0xff, 0xde, 0xff, 
-0xab, 0xff, 0x44, 0x00, 0x6a, 0x00, 0x24, 0x00, 0x20, 0x00, 0xa9, 0xff, 0xbc, 0xff, 0xdb, 0x00, 
-0x1f, 0x01, 0xe9, 0x00, 0x27, 0x01, 0x07, 0x01, 0x4a, 0x01, 0x31, 0x02, 0x7e, 0x02, 0x9e, 0x02, 
-0xaf, 0x02, 0x40, 0x02, 0x24, 0x02, 0x2b, 0x02, 0x9e, 0x01, 0xd5, 0x00, 0x17, 0x00, 0xf7, 0xff, 
-0x80, 0x00, 0x93, 0x00, 0x14, 0x00, 0xa8, 0xff, 0xa5, 0xff, 0xfd, 0xff, 0xec, 0xff, 0x78, 0xff, 
-0x8a, 0xff, 0x23, 0x00, 0xc0, 0x00, 0xa2, 0x00, 0x77, 0xff, 0x8d, 0xfe, 0xd7, 0xfe, 0x90, 0xff, 
-0x9a, 0xff, 0xf5, 0xfe, 0xea, 0xfe, 0x63, 0xff, 0x14, 0xff, 0xc2, 0xfe, 0x00, 0xff, 0x41, 0xff, 
-0x3e, 0x00, 0x1d, 0x01, 0x4b, 0x00, 0x95, 0xff, 0x06, 0x00, 0x48, 0x00, 0x3e, 0x00, 0x0a, 0x00, 
-0xc6, 0xff, 0x0e, 0x00, 0x52, 0x00, 0x3c, 0x00, 0x16, 0x00, 0xa1, 0xff, 0x98, 0xff, 0x35, 0x00, 
-0x35, 0x00, 0xfb, 0xff, 0x65, 0x00, 0xc4, 0x00, 0xb8, 0x00, 0x6e, 0x00, 0x00, 0x00, 0xbe, 0xff, 
-0xdb, 0xff, 0x4b, 0x00, 0x60, 0x00, 0xf0, 0xff, 0x36, 0x00, 0xf0, 0x00, 0xd8, 0x00, 0x84, 0x00, 
-0x76, 0x00, 0xa1, 0x00, 0x8a, 0x01, 0x68, 0x02, 0x4b, 0x02, 0x98, 0x01, 0xb1, 0x00, 0x8e, 0x00, 
-0x62, 0x01, 0x9b, 0x01, 0x6a, 0x01, 0x46, 0x01, 0x09, 0x00, 0xe8, 0xfe, 0x58, 0xff, 0xbb, 0xff, 
-0xbd, 0xff, 0x3f, 0x00, 0x5d, 0x00, 0x13, 0x00, 0x5d, 0x00, 0xc7, 0x00, 0xc2, 0x00, 0xa9, 0x00, 
-0xfe, 0x00, 0x96, 0x01, 0x8d, 0x01, 0xef, 0x00, 0x74, 0x00, 0xba, 0xff, 0xea, 0xfe, 0xf6, 0xfe, 
-0x06, 0xff, 0x5e, 0xfe, 0x4c, 0xfe, 0xdd, 0xfe, 0x9e, 0xfe, 0xef, 0xfd, 0xcf, 0xfd, 0xef, 0xfd, 
-0x72, 0xfe, 0xbd, 0xff, 0x96, 0x00, 0x28, 0x00, 0xd3, 0xff, 0x4b, 0x00, 0x98, 0x00, 0xc1, 0x00, 
-0x3b, 0x01, 0x42, 0x01, 0xe2, 0x00, 0xc5, 0x00, 0x7c, 0x00, 0x20, 0x00, 0x27, 0x00, 0x1e, 0x00, 
-0x24, 0x00, 0x3a, 0x00, 0xa9, 0xff, 0xff, 0xfe, 0x9d, 0xfe, 0x51, 0xfe, 0x0f, 0xff, 0x43, 0x00, 
-0x39, 0x00, 0xb0, 0xff, 0x77, 0xff, 0x28, 0xff, 0x0c, 0xff, 0x2f, 0xff, 0x9c, 0xff, 0x82, 0x00, 
-0x02, 0x01, 0xb0, 0x00, 0xa7, 0xff, 0x5d, 0xfe, 0xa1, 0xfe, 0x0c, 0x00, 0x51, 0x00, 0x09, 0x00, 
-0x03, 0x00, 0xa0, 0xff, 0xab, 0xff, 0x2f, 0x00, 0x32, 0x00, 0x55, 0x00, 0xd7, 0x00, 0x10, 0x01, 
-0xbf, 0x00, 0x19, 0x00, 0x0d, 0x00, 0x93, 0x00, 0xc7, 0x00, 0xde, 0x00, 0x74, 0x00, 0x3a, 0xff, 
-0x8f, 0xfe, 0x97, 0xfe, 0xde, 0xfe, 0x86, 0xff, 0xc4, 0xff, 0xa7, 0xff, 0x9d, 0xff, 0x3b, 0xff, 
-0x7a, 0xff, 0x43, 0x00, 0x54, 0x00, 0xda, 0x00, 0x80, 0x01, 0xa5, 0x00, 0xda, 0xff, 0xab, 0xff, 
-0x69, 0xff, 0x36, 0x00, 0x1e, 0x01, 0x7b, 0x00, 0x4c, 0xff, 0x6b, 0xfe, 0x5a, 0xfe, 0x06, 0xff, 
-0x62, 0xff, 0xa5, 0xff, 0xb7, 0xff, 0x44, 0xff, 0x44, 0xff, 0x33, 0xff, 0x15, 0xff, 0x52, 0x00, 
-0x4c, 0x01, 0x15, 0x01, 0xfe, 0x00, 0x5c, 0x00, 0xc6, 0xff, 0x65, 0x00, 0x98, 0x00, 0xb3, 0x00, 
-0x73, 0x01, 0x24, 0x01, 0x63, 0x00, 0x35, 0x00, 0x07, 0x00, 0x77, 0x00, 0xf7, 0x00, 0xac, 0x00, 
-0xb4, 0x00, 0xbd, 0x00, 0x3d, 0x00, 0xe9, 0xff, 0x78, 0xff, 0x8c, 0xff, 0x93, 0x00, 0xd3, 0x00, 
-0x4c, 0x00, 0x14, 0x00, 0xdc, 0xff, 0xb8, 0xff, 0xaf, 0xff, 0xb5, 0xff, 0x2e, 0x00, 0x64, 0x00, 
-0xfb, 0xff, 0x95, 0xff, 0x77, 0xff, 0x1c, 0x00, 0xca, 0x00, 0x06, 0x00, 0xed, 0xfe, 0xdf, 0xfe, 
-0x45, 0xff, 0x7d, 0xff, 0x38, 0xff, 0xba, 0xfe, 0x86, 0xfe, 0x88, 0xfe, 0xe7, 0xfe, 0x4d, 0xff, 
-0x63, 0xff, 0xd9, 0xff, 0xe8, 0xff, 0x55, 0xff, 0xf5, 0xff, 0xdc, 0x00, 0x8d, 0x00, 0x4d, 0x00, 
-0x06, 0x00, 0x8e, 0xff, 0xe1, 0xff, 0xad, 0xff, 0xb2, 0xfe, 0xe3, 0xfe, 0xb8, 0xff, 0x09, 0x00, 
-0x27, 0x00, 0x19, 0x00, 0x28, 0x00, 0x9c, 0x00, 0x03, 0x01, 0x1b, 0x01, 0x00, 0x01, 0x28, 0x01, 
-0x4d, 0x01, 0xbb, 0x00, 0x80, 0x00, 0x11, 0x01, 0x05, 0x01, 0x78, 0x00, 0x05, 0x00, 0x52, 0xff, 
-0x12, 0xff, 0xa0, 0xff, 0xe6, 0xff, 0xa0, 0xff, 0x5a, 0xff, 0x4e, 0xff, 0x62, 0xff, 0x77, 0xff, 
-0x92, 0xff, 0x6e, 0xff, 0x46, 0xff, 0x04, 0x00, 0x19, 0x01, 0x13, 0x01, 0x02, 0x00, 0x16, 0xff, 
-0x42, 0xff, 0x23, 0x00, 0x9e, 0x00, 0x61, 0x00, 0x85, 0xff, 0xcf, 0xfe, 0x19, 0xff, 0x36, 0xff, 
-0x86, 0xfe, 0x98, 0xfe, 0x47, 0xff, 0x5e, 0xff, 0x62, 0xff, 0x7d, 0xff, 0x2e, 0xff, 0xf7, 0xfe, 
-0x62, 0xff, 0x19, 0x00, 0x84, 0x00, 0xa9, 0x00, 0x82, 0x00, 0xa4, 0xff, 0x0b, 0xff, 0xa7, 0xff, 
-0x1d, 0x00, 0xe9, 0xff, 0x13, 0x00, 0x48, 0x00, 0x07, 0x00, 0xcc, 0xff, 0xc2, 0xff, 0xde, 0xff, 
-0x16, 0x00, 0x56, 0x00, 0x6b, 0x00, 0x0d, 0x00, 0xcc, 0xff, 0xf8, 0xff, 0xbe, 0xff, 0x83, 0xff, 
-0x1b, 0x00, 0x93, 0x00, 0x48, 0x00, 0xc1, 0xff, 0x44, 0xff, 0xfc, 0xfe, 0x20, 0xff, 0xa9, 0xff, 
-0x25, 0x00, 0x18, 0x00, 0xf2, 0xff, 0xf4, 0xff, 0xd0, 0xff, 0x13, 0x00, 0xb9, 0x00, 0xb6, 0x00, 
-0x7c, 0x00, 0xdf, 0x00, 0x35, 0x01, 0xfc, 0x00, 0x63, 0x00, 0xd6, 0xff, 0xef, 0xff, 0x96, 0x00, 
-0xfb, 0x00, 0x96, 0x00, 0xcc, 0xff, 0x7b, 0xff, 0xb8, 0xff, 0xfa, 0xff, 0x16, 0x00, 0x1e, 0x00, 
-0x37, 0x00, 0x6e, 0x00, 0x8d, 0x00, 0x96, 0x00, 0x84, 0x00, 0x63, 0x00, 0x9c, 0x00, 0x03, 0x01, 
-0x25, 0x01, 0x17, 0x01, 0xce, 0x00, 0x72, 0x00, 0x70, 0x00, 0x7a, 0x00, 0x56, 0x00, 0x3d, 0x00, 
-0x25, 0x00, 0x16, 0x00, 0x01, 0x00, 0xd3, 0xff, 0xe5, 0xff, 0x26, 0x00, 0x36, 0x00, 0x2b, 0x00, 
-0x10, 0x00, 0x17, 0x00, 0x5f, 0x00, 0x6f, 0x00, 0x4f, 0x00, 0x57, 0x00, 0x57, 0x00, 0x4f, 0x00, 
-0x3c, 0x00, 0xf5, 0xff, 0xdd, 0xff, 0x03, 0x00, 0xfc, 0xff, 0xe0, 0xff, 0xe1, 0xff, 0xec, 0xff, 
-0x08, 0x00, 0x1f, 0x00, 0x22, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x32, 0x00, 
-0x3e, 0x00, 0x47, 0x00, 0x37, 0x00, 0x2f, 0x00, 0x2a, 0x00, 0x1d, 0x00, 0x1a, 0x00, 0x1d, 0x00, 
-0x23, 0x00, 0x26, 0x00, 0x23, 0x00, 0x1a, 0x00, 0x03, 0x00, 0xf4, 0xff, 0x01, 0x00, 0x0c, 0x00, 
-0x10, 0x00, 0x1c, 0x00, 0x20, 0x00, 0x23, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x28, 0x00, 0x28, 0x00, 
-0x30, 0x00, 0x3a, 0x00, 0x37, 0x00, 0x2f, 0x00, 0x28, 0x00, 0x15, 0x00, 0x08, 0x00, 0x0a, 0x00, 
-0x07, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0x0e, 0x00, 0x1b, 0x00, 0x13, 0x00, 
-0x02, 0x00, 0xf8, 0xff, 0x01, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x17, 0x00, 0x19, 0x00, 0x13, 0x00, 
-0x04, 0x00, 0xf8, 0xff, 0x01, 0x00, 0x15, 0x00, 0x16, 0x00, 0x00, 0x00, 0xe7, 0xff, 0xe0, 0xff, 
-0xef, 0xff, 0xff, 0xff, 0x05, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1b, 0x00, 0x10, 0x00, 0xf3, 0xff, 
-0xe1, 0xff, 0xec, 0xff, 0x0b, 0x00, 0x25, 0x00, 0x24, 0x00, 0x07, 0x00, 0xe7, 0xff, 0xdc, 0xff, 
-0xe8, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xea, 0xff, 0xe7, 0xff, 0xf9, 0xff, 0x14, 0x00, 0x1d, 0x00, 
-0x0f, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x21, 0x00, 0x26, 0x00, 0x17, 0x00, 0x06, 0x00, 0xfc, 0xff, 
-0xf4, 0xff, 0xf0, 0xff, 0xf6, 0xff, 0x0c, 0x00, 0x24, 0x00, 0x26, 0x00, 0x1a, 0x00, 0x19, 0x00, 
-0x26, 0x00, 0x2c, 0x00, 0x13, 0x00, 0xdf, 0xff, 0xb6, 0xff, 0xbb, 0xff, 0xe8, 0xff, 0x19, 0x00, 
-0x22, 0x00, 0xf9, 0xff, 0xbe, 0xff, 0x9f, 0xff, 0xb2, 0xff, 0xe3, 0xff, 0x02, 0x00, 0xfe, 0xff, 
-0xf6, 0xff, 0x08, 0x00, 0x27, 0x00, 0x2e, 0x00, 0x14, 0x00, 0xf3, 0xff, 0xe3, 0xff, 0xe5, 0xff, 
-0xe7, 0xff, 0xec, 0xff, 0x05, 0x00, 0x21, 0x00, 0x22, 0x00, 0x08, 0x00, 0xf4, 0xff, 0x07, 0x00, 
-0x39, 0x00, 0x57, 0x00, 0x40, 0x00, 0x16, 0x00, 0x02, 0x00, 0x07, 0x00, 0x04, 0x00, 0xe5, 0xff, 
-0xc3, 0xff, 0xc1, 0xff, 0xec, 0xff, 0x2f, 0x00, 0x5b, 0x00, 0x49, 0x00, 0x07, 0x00, 0xd0, 0xff, 
-0xd7, 0xff, 0x09, 0x00, 0x36, 0x00, 0x43, 0x00, 0x36, 0x00, 0x2a, 0x00, 0x1f, 0x00, 0xfc, 0xff, 
-0xd6, 0xff, 0xd8, 0xff, 0x01, 0x00, 0x34, 0x00, 0x41, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x1a, 0x00, 
-0x37, 0x00, 0x38, 0x00, 0x34, 0x00, 0x43, 0x00, 0x54, 0x00, 0x45, 0x00, 0x23, 0x00, 0x17, 0x00, 
-0x32, 0x00, 0x59, 0x00, 0x5d, 0x00, 0x31, 0x00, 0x06, 0x00, 0x12, 0x00, 0x39, 0x00, 0x3e, 0x00, 
-0x1f, 0x00, 0x0b, 0x00, 0x05, 0x00, 0x07, 0x00, 0x1e, 0x00, 0x30, 0x00, 0x2e, 0x00, 0x22, 0x00, 
-0x09, 0x00, 0x09, 0x00, 0x3e, 0x00, 0x5e, 0x00, 0x53, 0x00, 0x4b, 0x00, 0x3c, 0x00, 0x22, 0x00, 
-0x1a, 0x00, 0x0e, 0x00, 0xf9, 0xff, 0xef, 0xff, 0xeb, 0xff, 0xe0, 0xff, 0xce, 0xff, 0xd6, 0xff, 
-0x00, 0x00, 0x22, 0x00, 0x2a, 0x00, 0x30, 0x00, 0x38, 0x00, 0x1e, 0x00, 0xd6, 0xff, 0xbd, 0xff, 
-0xf7, 0xff, 0x0b, 0x00, 0xe3, 0xff, 0xce, 0xff, 0xd0, 0xff, 0x0f, 0x00, 0x70, 0x00, 0x71, 0x00, 
-0x4a, 0x00, 0x49, 0x00, 0x37, 0x00, 0x3f, 0x00, 0x6e, 0x00, 0x71, 0x00, 0x90, 0x00, 0xe3, 0x00, 
-0xcf, 0x00, 0x3c, 0x00, 0xd1, 0xff, 0xda, 0xff, 0xe7, 0xff, 0xc8, 0xff, 0xe7, 0xff, 0x33, 0x00, 
-0x42, 0x00, 0x28, 0x00, 0x06, 0x00, 0xe9, 0xff, 0xeb, 0xff, 0x18, 0x00, 0x75, 0x00, 0x7a, 0x00, 
-0x02, 0x00, 0xf5, 0xff, 0xfe, 0xff, 0x7a, 0xff, 0xa3, 0xff, 0x57, 0x00, 0x2e, 0x00, 0x0a, 0x00, 
-0x86, 0x00, 0x8f, 0x00, 0x36, 0x00, 0xef, 0xff, 0xaf, 0xff, 0xc4, 0xff, 0x05, 0x00, 0x1e, 0x00, 
-0x35, 0x00, 0x31, 0x00, 0x12, 0x00, 0x02, 0x00, 0xf6, 0xff, 0x12, 0x00, 0x55, 0x00, 0x81, 0x00, 
-0x78, 0x00, 0x3b, 0x00, 0x1c, 0x00, 0x39, 0x00, 0x4a, 0x00, 0x5f, 0x00, 0x4f, 0x00, 0x06, 0x00, 
-0x1a, 0x00, 0x47, 0x00, 0x14, 0x00, 0x04, 0x00, 0x0f, 0x00, 0xfd, 0xff, 0x15, 0x00, 0xfb, 0xff, 
-0xb6, 0xff, 0xb3, 0xff, 0xb1, 0xff, 0xba, 0xff, 0xd8, 0xff, 0xc8, 0xff, 0xf6, 0xff, 0x30, 0x00, 
-0xe9, 0xff, 0xc1, 0xff, 0xe0, 0xff, 0xe3, 0xff, 0x10, 0x00, 0x4c, 0x00, 0x4b, 0x00, 0x30, 0x00, 
-0x0b, 0x00, 0xf6, 0xff, 0xc4, 0xff, 0x69, 0xff, 0x82, 0xff, 0xda, 0xff, 0xea, 0xff, 0x02, 0x00, 
-0x0e, 0x00, 0xd8, 0xff, 0xa1, 0xff, 0x86, 0xff, 0xb2, 0xff, 0xd1, 0xff, 0xab, 0xff, 0xe3, 0xff, 
-0x05, 0x00, 0x9e, 0xff, 0xc2, 0xff, 0x28, 0x00, 0x16, 0x00, 0x5c, 0x00, 0xb2, 0x00, 0x97, 0x00, 
-0xcf, 0x00, 0x0c, 0x01, 0xf1, 0x00, 0x14, 0x01, 0x24, 0x01, 0xe4, 0x00, 0xec, 0x00, 0x43, 0x01, 
-0xa8, 0x01, 0x04, 0x02, 0x57, 0x02, 0xa7, 0x02, 0xca, 0x02, 0xf5, 0x02, 0x8c, 0x03, 0x8f, 0x04, 
-0x85, 0x05, 0x80, 0x05, 0x98, 0x04, 0xa5, 0x03, 0x99, 0x02, 0x38, 0x02, 0x91, 0x02, 0xff, 0x01, 
-0x27, 0x03, 0x9c, 0x08, 0xe6, 0x0c, 0x82, 0x0c, 0x93, 0x0a, 0x52, 0x07, 0x65, 0x02, 0xce, 0xfe, 
-0x9a, 0xfc, 0x56, 0xfa, 0x32, 0xf9, 0x23, 0xf9, 0xf4, 0xf7, 0x23, 0xf5, 0xaf, 0xf2, 0x0d, 0xf2, 
-0x48, 0xf2, 0xe6, 0xf2, 0xb9, 0xf4, 0xee, 0xf6, 0x54, 0xf8, 0x14, 0xf9, 0xec, 0xf8, 0x32, 0xf7, 
-0x02, 0xf5, 0xbf, 0xf5, 0x47, 0xfb, 0x93, 0x02, 0xe3, 0x06, 0x2e, 0x05, 0x46, 0xfe, 0x8f, 0xf8, 
-0x50, 0xf8, 0x4e, 0xfa, 0x41, 0xfc, 0x2c, 0xfe, 0xc4, 0xfd, 0x6c, 0xfb, 0x9b, 0xf9, 0x80, 0xf7, 
-0xd1, 0xf5, 0x81, 0xf7, 0x89, 0xfb, 0x0a, 0xfe, 0x3e, 0xfd, 0xa6, 0xfb, 0x4c, 0xfc, 0x43, 0xfd, 
-0x6b, 0xfc, 0xee, 0xfb, 0x99, 0xfc, 0x66, 0xfd, 0x5a, 0xfe, 0xec, 0xfd, 0x92, 0xfb, 0x6b, 0xfa, 
-0xc2, 0xfb, 0x48, 0xfd, 0xac, 0xfc, 0x4d, 0xfa, 0x68, 0xf9, 0xe7, 0xfa, 0xd7, 0xfb, 0x63, 0xfb, 
-0x8e, 0xfa, 0x40, 0xf9, 0x2b, 0xf8, 0x85, 0xf7, 0xe1, 0xf6, 0x70, 0xf7, 0xcf, 0xf8, 0x9e, 0xf9, 
-0x15, 0xfa, 0x5d, 0xf9, 0xb7, 0xf8, 0x98, 0xfa, 0xa1, 0xfb, 0x6e, 0xfb, 0x78, 0xfe, 0x03, 0x00, 
-0x52, 0xfc, 0xca, 0xfa, 0x84, 0xfb, 0xd5, 0xf8, 0x75, 0xf7, 0x3a, 0xfa, 0x2f, 0xfb, 0x82, 0xfa, 
-0xde, 0xfb, 0xc7, 0xfb, 0x03, 0xf9, 0xf7, 0xf8, 0x59, 0xfb, 0xe8, 0xfc, 0xf5, 0x00, 0xdf, 0x06, 
-0xb2, 0x08, 0xc2, 0x08, 0x51, 0x0a, 0x43, 0x0b, 0x15, 0x0e, 0x4d, 0x13, 0xea, 0x13, 0x32, 0x0f, 
-0xbd, 0x0b, 0x38, 0x0c, 0xa4, 0x0d, 0x9c, 0x0c, 0xf4, 0x08, 0x4b, 0x04, 0x4d, 0x02, 0xc9, 0x04, 
-0x60, 0x05, 0xf2, 0x03, 0xe6, 0x08, 0x36, 0x0d, 0x10, 0x08, 0xf6, 0x03, 0xa1, 0x04, 0x07, 0x02, 
-0xf4, 0xfe, 0xe2, 0xfe, 0x91, 0xfd, 0xae, 0xfa, 0x7c, 0xf7, 0xca, 0xf1, 0xf0, 0xe9, 0x95, 0xe5, 
-0x59, 0xe7, 0x3a, 0xea, 0xb1, 0xeb, 0xab, 0xec, 0x98, 0xec, 0xdc, 0xeb, 0xc3, 0xe5, 0xb0, 0xdb, 
-0xdf, 0xdb, 0x4a, 0xdc, 0xbd, 0xcf, 0x2e, 0xd4, 0xde, 0xf1, 0x33, 0x06, 0xb0, 0x12, 0x4e, 0x24, 
-0x09, 0x2a, 0x40, 0x2a, 0x69, 0x34, 0x99, 0x39, 0x1b, 0x39, 0x04, 0x42, 0x32, 0x48, 0xd6, 0x39, 
-0x00, 0x21, 0x93, 0x0f, 0xd7, 0x02, 0x9b, 0xf6, 0x69, 0xf6, 0x50, 0xfe, 0x55, 0x00, 0x37, 0x03, 
-0xf7, 0x07, 0x9e, 0x06, 0xc3, 0x06, 0x02, 0x0b, 0x53, 0x13, 0xcc, 0x23, 0xff, 0x2c, 0x99, 0x29, 
-0xa0, 0x26, 0x2d, 0x1c, 0xc2, 0x0d, 0xaa, 0x0e, 0xce, 0x0e, 0x14, 0x03, 0xad, 0xfe, 0x54, 0xfe, 
-0x33, 0xf5, 0xe9, 0xeb, 0x3c, 0xea, 0x09, 0xee, 0x3d, 0xf1, 0x94, 0xf1, 0xe9, 0xf1, 0x6a, 0xef, 
-0x67, 0xed, 0xd1, 0xf0, 0x3e, 0xed, 0x6e, 0xe2, 0x3d, 0xde, 0x7f, 0xdb, 0xc0, 0xd5, 0xdc, 0xd1, 
-0x26, 0xcb, 0x63, 0xc0, 0x5c, 0xb9, 0x4f, 0xc5, 0xa7, 0xee, 0x0b, 0x1b, 0xb7, 0x2e, 0xa6, 0x35, 
-0xf3, 0x39, 0xf4, 0x38, 0xd5, 0x36, 0x17, 0x32, 0x64, 0x2f, 0xc5, 0x35, 0x24, 0x36, 0x8e, 0x26, 
-0xc2, 0x0b, 0x78, 0xec, 0x4d, 0xdd, 0x32, 0xe6, 0x12, 0xf4, 0x8d, 0xff, 0x4c, 0x0a, 0x12, 0x12, 
-0xae, 0x1a, 0xa7, 0x1f, 0xc4, 0x1b, 0x63, 0x1c, 0x84, 0x28, 0xaf, 0x32, 0xcf, 0x2d, 0x3b, 0x1f, 
-0x1e, 0x13, 0x69, 0x05, 0x35, 0xf6, 0x3b, 0xf2, 0x8f, 0xf2, 0x22, 0xf2, 0x37, 0xf9, 0xa3, 0xf8, 
-0x1b, 0xed, 0xc4, 0xee, 0xe9, 0xf7, 0x7d, 0xfd, 0xb8, 0x09, 0x5e, 0x10, 0x20, 0x08, 0x66, 0x06, 
-0xaa, 0x0c, 0xd7, 0x05, 0x87, 0xf2, 0xb1, 0xe6, 0xb5, 0xe6, 0xf9, 0xe1, 0x50, 0xd6, 0x68, 0xcf, 
-0xec, 0xca, 0x2c, 0xcb, 0xad, 0xd3, 0x75, 0xd0, 0xf3, 0xbb, 0x41, 0xaf, 0x71, 0xbd, 0x53, 0xe4, 
-0xa2, 0x0b, 0x29, 0x21, 0xb9, 0x2f, 0x6d, 0x38, 0xeb, 0x32, 0x9f, 0x2b, 0xd9, 0x27, 0xc3, 0x25, 
-0x06, 0x2d, 0xa5, 0x30, 0xe8, 0x1c, 0xc5, 0xfa, 0x02, 0xe0, 0x00, 0xdb, 0x95, 0xe5, 0x95, 0xf0, 
-0xdd, 0xfd, 0xd0, 0x0a, 0x26, 0x0f, 0x5d, 0x15, 0x75, 0x1c, 0xca, 0x1b, 0xac, 0x24, 0xd6, 0x37, 
-0x18, 0x38, 0xb7, 0x22, 0xc6, 0x0f, 0x4c, 0x06, 0x72, 0xf9, 0xe2, 0xeb, 0xdf, 0xed, 0xe6, 0xf3, 
-0x55, 0xef, 0x55, 0xef, 0xb0, 0xf3, 0x56, 0xf2, 0x90, 0xfa, 0xc0, 0x0a, 0x63, 0x10, 0x46, 0x10, 
-0x38, 0x10, 0xeb, 0x0c, 0x31, 0x04, 0xde, 0xf5, 0x44, 0xf1, 0xc5, 0xf6, 0xbc, 0xeb, 0x44, 0xd8, 
-0x4a, 0xd5, 0xb5, 0xd5, 0xf6, 0xd1, 0x96, 0xd6, 0x3a, 0xda, 0x36, 0xd4, 0x8c, 0xd3, 0x1f, 0xd6, 
-0x45, 0xc8, 0x5f, 0xc1, 0xac, 0xe7, 0xc7, 0x16, 0xa9, 0x1e, 0x34, 0x1e, 0x19, 0x2c, 0x2d, 0x31, 
-0xe0, 0x31, 0xd5, 0x30, 0x39, 0x22, 0x89, 0x1e, 0x26, 0x27, 0x79, 0x13, 0xe2, 0xec, 0xf8, 0xdc, 
-0x42, 0xe3, 0x15, 0xe8, 0xb6, 0xe6, 0x17, 0xee, 0x3e, 0x01, 0xb9, 0x0e, 0x40, 0x13, 0x3e, 0x1a, 
-0xda, 0x24, 0xc0, 0x2e, 0xd6, 0x33, 0xed, 0x2f, 0xe1, 0x21, 0x25, 0x11, 0xb0, 0x0a, 0x5a, 0x03, 
-0xe3, 0xec, 0x62, 0xe4, 0x9a, 0xf2, 0x34, 0xf1, 0x9a, 0xe5, 0x18, 0xec, 0x78, 0xf6, 0x91, 0xfe, 
-0x1a, 0x0b, 0x9e, 0x0e, 0x76, 0x0c, 0xad, 0x10, 0x0a, 0x10, 0x7f, 0x06, 0x22, 0xfe, 0xc2, 0xf7, 
-0x23, 0xee, 0x01, 0xe3, 0x4b, 0xdf, 0x86, 0xe0, 0xcd, 0xdb, 0x03, 0xd6, 0xd7, 0xd5, 0x8d, 0xd7, 
-0x4b, 0xd9, 0xaf, 0xd7, 0x3d, 0xd2, 0x5e, 0xc9, 0xcd, 0xbc, 0xf7, 0xc6, 0xfb, 0xf2, 0x6b, 0x12, 
-0x6a, 0x15, 0x8e, 0x1d, 0x44, 0x27, 0xa8, 0x23, 0x5f, 0x21, 0x44, 0x21, 0x74, 0x1d, 0xd8, 0x1e, 
-0x92, 0x1f, 0xfe, 0x0c, 0x96, 0xed, 0xad, 0xe1, 0xc6, 0xef, 0x29, 0xf9, 0x3f, 0xf9, 0x1b, 0x05, 
-0x18, 0x16, 0xcc, 0x1e, 0x7b, 0x20, 0xfb, 0x1d, 0x9b, 0x22, 0x8e, 0x2e, 0x7d, 0x2f, 0x75, 0x25, 
-0x39, 0x1a, 0xb9, 0x0d, 0x2f, 0x00, 0x32, 0xf0, 0x5b, 0xe6, 0x00, 0xee, 0x86, 0xf5, 0x20, 0xf0, 
-0xb6, 0xee, 0x85, 0xf6, 0xfd, 0xfc, 0xa2, 0x00, 0xc9, 0x08, 0x91, 0x16, 0x5e, 0x19, 0x8b, 0x0c, 
-0x50, 0x03, 0x36, 0xfe, 0x23, 0xf6, 0xf4, 0xf2, 0x94, 0xee, 0x5a, 0xe6, 0xfc, 0xe5, 0x02, 0xe4, 
-0xb2, 0xdb, 0x17, 0xdb, 0x08, 0xdd, 0x67, 0xdc, 0xcd, 0xe0, 0x88, 0xe2, 0x69, 0xdb, 0x8f, 0xd1, 
-0x8d, 0xc5, 0x5b, 0xc1, 0x73, 0xdb, 0x9c, 0x0b, 0xfb, 0x25, 0x78, 0x22, 0x9f, 0x26, 0x40, 0x2e, 
-0xc1, 0x22, 0x4b, 0x23, 0xd5, 0x31, 0xe1, 0x26, 0xa2, 0x1b, 0xc0, 0x21, 0x74, 0x08, 0xe6, 0xdc, 
-0xea, 0xd7, 0x8f, 0xe8, 0x04, 0xf2, 0x62, 0x02, 0x2d, 0x17, 0x1a, 0x20, 0x6d, 0x24, 0x47, 0x29, 
-0x1d, 0x26, 0x52, 0x25, 0xbf, 0x31, 0x44, 0x32, 0x49, 0x1d, 0xbe, 0x0f, 0x24, 0x07, 0x32, 0xed, 
-0x95, 0xd3, 0x78, 0xd3, 0x2d, 0xea, 0xe8, 0xfe, 0x41, 0xfc, 0x63, 0xf8, 0x6d, 0x07, 0xa1, 0x0d, 
-0x71, 0x08, 0x93, 0x0e, 0x45, 0x10, 0x00, 0x0a, 0xfb, 0x0c, 0x41, 0x03, 0x74, 0xe6, 0xc7, 0xde, 
-0x65, 0xed, 0xf6, 0xed, 0x32, 0xe6, 0xe7, 0xed, 0xe8, 0xf3, 0x06, 0xea, 0x42, 0xe5, 0x45, 0xe6, 
-0xf1, 0xe1, 0x6e, 0xe5, 0x63, 0xe6, 0x3d, 0xd5, 0x76, 0xcb, 0x03, 0xc9, 0xdd, 0xbf, 0x27, 0xd3, 
-0x28, 0x01, 0xfe, 0x12, 0xbe, 0x0d, 0x37, 0x18, 0x8c, 0x29, 0x76, 0x2b, 0x9c, 0x23, 0x21, 0x22, 
-0xdc, 0x26, 0xd6, 0x24, 0xc8, 0x13, 0xe6, 0xf3, 0xea, 0xdb, 0xf2, 0xe3, 0x63, 0xf6, 0xe8, 0xff, 
-0x66, 0x12, 0x43, 0x25, 0x83, 0x23, 0xaf, 0x1b, 0xf8, 0x17, 0xff, 0x16, 0x18, 0x20, 0x39, 0x2c, 
-0x72, 0x28, 0x2e, 0x0f, 0xe7, 0xf3, 0xa6, 0xec, 0x3a, 0xe9, 0x1f, 0xdd, 0xa4, 0xe4, 0x15, 0x00, 
-0x49, 0x0e, 0x0b, 0x07, 0x37, 0xf4, 0xf1, 0xec, 0x62, 0x02, 0xf9, 0x18, 0xc8, 0x1a, 0x68, 0x18, 
-0xac, 0x17, 0x2f, 0x0c, 0x48, 0xf0, 0x45, 0xd5, 0xfe, 0xd7, 0x6d, 0xec, 0x46, 0xf1, 0x14, 0xeb, 
-0x29, 0xe7, 0x9c, 0xe5, 0x51, 0xe9, 0xbd, 0xed, 0x3a, 0xf2, 0x4d, 0xfa, 0x21, 0xf6, 0xab, 0xe0, 
-0x4a, 0xd0, 0xba, 0xce, 0x21, 0xc8, 0x3b, 0xb2, 0x51, 0xb7, 0x8f, 0xf1, 0xc8, 0x20, 0x77, 0x1f, 
-0x43, 0x21, 0xb1, 0x32, 0x38, 0x37, 0x33, 0x38, 0x4a, 0x36, 0xc3, 0x27, 0x96, 0x1f, 0xca, 0x1a, 
-0x5c, 0xff, 0xbf, 0xdb, 0x84, 0xd5, 0xf0, 0xe8, 0x66, 0xf3, 0x7d, 0xf6, 0xbc, 0x06, 0x8e, 0x14, 
-0xde, 0x1a, 0x03, 0x2c, 0xc9, 0x38, 0xda, 0x36, 0x5a, 0x37, 0x17, 0x2f, 0x77, 0x12, 0xbd, 0xf9, 
-0x04, 0xf3, 0x8c, 0xee, 0x76, 0xdf, 0x84, 0xda, 0xfe, 0xf0, 0x9d, 0x01, 0xe6, 0x00, 0xd5, 0x0f, 
-0xb1, 0x1c, 0x45, 0x0f, 0xf9, 0x0d, 0x0e, 0x1e, 0x74, 0x18, 0xa4, 0x04, 0xe9, 0xfc, 0x17, 0xfa, 
-0x7e, 0xf0, 0x96, 0xe9, 0xe4, 0xeb, 0x61, 0xe9, 0x82, 0xe5, 0xb8, 0xf2, 0x79, 0xfe, 0x6b, 0xf9, 
-0xc1, 0xf8, 0x92, 0xfb, 0x0f, 0xf6, 0x82, 0xf3, 0x27, 0xf0, 0x3e, 0xe1, 0x3e, 0xd2, 0x77, 0xcb, 
-0x7b, 0xc3, 0x5b, 0xb5, 0x4f, 0xbe, 0x6a, 0xf4, 0x8f, 0x24, 0x40, 0x26, 0xe5, 0x22, 0x30, 0x2d, 
-0x73, 0x2c, 0x0f, 0x2a, 0xc1, 0x2d, 0xa1, 0x27, 0xb0, 0x1b, 0xcc, 0x0c, 0x6b, 0xf1, 0xd9, 0xd8, 
-0x77, 0xdc, 0xd1, 0xf2, 0x86, 0xff, 0x26, 0x05, 0x7b, 0x11, 0x5c, 0x18, 0x55, 0x1b, 0x23, 0x2b, 
-0x4f, 0x3a, 0x64, 0x3b, 0xf6, 0x2f, 0x8d, 0x15, 0x71, 0xff, 0x49, 0xfb, 0xc9, 0xf2, 0xd0, 0xe5, 
-0x47, 0xe5, 0x83, 0xe8, 0x37, 0xec, 0x3a, 0xf6, 0x02, 0x04, 0x12, 0x14, 0xe6, 0x1b, 0x34, 0x17, 
-0xb5, 0x18, 0x44, 0x21, 0x45, 0x1b, 0x2d, 0x05, 0x24, 0xf4, 0xf8, 0xed, 0x41, 0xde, 0x22, 0xcd, 
-0xb5, 0xdb, 0x8e, 0xf3, 0x7d, 0xf3, 0x10, 0xf5, 0x1c, 0x02, 0xfa, 0x04, 0x2e, 0x02, 0x39, 0xfe, 
-0x6d, 0xf5, 0x10, 0xef, 0x0a, 0xe9, 0x89, 0xdf, 0x4e, 0xd2, 0xda, 0xc2, 0xbb, 0xc1, 0x16, 0xcb, 
-0xde, 0xcf, 0x0f, 0xe6, 0xba, 0x0b, 0xdc, 0x1a, 0xec, 0x1a, 0x5d, 0x21, 0x03, 0x27, 0x3e, 0x2c, 
-0x4c, 0x30, 0x4b, 0x2a, 0x56, 0x1d, 0xf6, 0x0e, 0x94, 0x01, 0x30, 0xee, 0x97, 0xd5, 0xae, 0xd7, 
-0x84, 0xf5, 0xa2, 0x05, 0x71, 0x05, 0x31, 0x0a, 0x1f, 0x18, 0xf5, 0x2f, 0x10, 0x3d, 0x85, 0x30, 
-0x12, 0x25, 0xa0, 0x26, 0xda, 0x26, 0xb0, 0x1a, 0x57, 0xf9, 0xb5, 0xdb, 0x69, 0xdd, 0xcc, 0xe1, 
-0xe2, 0xdd, 0x0f, 0xee, 0xbd, 0x04, 0xfe, 0x09, 0xd5, 0x0a, 0x62, 0x0f, 0x83, 0x12, 0xdb, 0x12, 
-0x64, 0x12, 0x78, 0x13, 0xf2, 0x0e, 0x23, 0x03, 0x6f, 0xf8, 0xb4, 0xeb, 0xcb, 0xe2, 0x4c, 0xe8, 
-0x12, 0xea, 0xb3, 0xe3, 0xcd, 0xea, 0x34, 0xfa, 0x98, 0x04, 0xed, 0x09, 0x11, 0x01, 0x76, 0xef, 
-0xae, 0xeb, 0x0c, 0xf3, 0xa0, 0xf1, 0x94, 0xe0, 0x34, 0xcd, 0x7f, 0xc4, 0xf4, 0xb8, 0x41, 0xac, 
-0x94, 0xc7, 0x0b, 0x07, 0x17, 0x2d, 0x94, 0x28, 0xe4, 0x1d, 0x99, 0x1f, 0x36, 0x26, 0x2b, 0x2d, 
-0xb9, 0x33, 0x67, 0x2e, 0xd1, 0x15, 0x7b, 0xfc, 0x3f, 0xee, 0x24, 0xdf, 0xf0, 0xd7, 0x26, 0xea, 
-0x82, 0x03, 0x13, 0x13, 0x5d, 0x1f, 0xa2, 0x22, 0x43, 0x1d, 0x65, 0x26, 0x32, 0x39, 0x98, 0x37, 
-0x1d, 0x24, 0x5b, 0x13, 0xda, 0x00, 0xfe, 0xe7, 0x28, 0xdc, 0x22, 0xe3, 0x6c, 0xea, 0xe7, 0xf1, 
-0xd6, 0x03, 0x56, 0x10, 0x07, 0x0e, 0xce, 0x0f, 0x1f, 0x19, 0x97, 0x1d, 0x6e, 0x1f, 0x92, 0x1c, 
-0x1e, 0x0b, 0xa2, 0xf3, 0xa1, 0xe4, 0x75, 0xdf, 0x72, 0xe0, 0xf4, 0xe5, 0x46, 0xf0, 0x9b, 0xfa, 
-0xef, 0xfc, 0xae, 0xfa, 0xae, 0xf7, 0xdb, 0xf1, 0x6c, 0xf6, 0xc4, 0x0a, 0xee, 0x11, 0x55, 0xff, 
-0x94, 0xec, 0x7e, 0xe2, 0xb0, 0xd2, 0x69, 0xc2, 0xb3, 0xc0, 0xb8, 0xc5, 0x90, 0xc5, 0xb2, 0xce, 
-0x4b, 0xf0, 0x98, 0x16, 0x71, 0x27, 0x7d, 0x28, 0x03, 0x2b, 0x5a, 0x32, 0xfe, 0x38, 0xcd, 0x32, 
-0xe2, 0x18, 0x44, 0xfe, 0xdf, 0xf4, 0x15, 0xec, 0xce, 0xd9, 0x31, 0xdb, 0xd7, 0xf8, 0x1b, 0x0b, 
-0x65, 0x06, 0xa2, 0x0d, 0x0c, 0x22, 0x96, 0x28, 0x84, 0x2e, 0xd6, 0x3d, 0x5e, 0x35, 0x4b, 0x18, 
-0x82, 0x0e, 0x19, 0x0c, 0x51, 0xf6, 0x5a, 0xe3, 0x0f, 0xe3, 0xe5, 0xe4, 0x69, 0xe7, 0x63, 0xf7, 
-0x06, 0x0f, 0xd9, 0x1b, 0x42, 0x1b, 0x39, 0x19, 0xe8, 0x13, 0xa3, 0x05, 0xee, 0xfc, 0x76, 0x02, 
-0x16, 0x08, 0x28, 0x00, 0x5e, 0xec, 0x99, 0xdf, 0x0b, 0xe8, 0xc6, 0xf6, 0xaf, 0xfb, 0x63, 0xfc, 
-0x2d, 0xff, 0xf2, 0x02, 0xb9, 0x02, 0xf5, 0xfb, 0xe1, 0xf8, 0x8c, 0xfc, 0x93, 0xf7, 0x36, 0xe5, 
-0x7f, 0xd5, 0xed, 0xd4, 0x55, 0xd6, 0x9e, 0xc9, 0x2f, 0xc6, 0x35, 0xde, 0x70, 0xed, 0xa3, 0xe8, 
-0xdc, 0xf9, 0x51, 0x1e, 0x19, 0x2b, 0x8a, 0x21, 0x65, 0x19, 0x34, 0x13, 0xaa, 0x0d, 0xe7, 0x0c, 
-0xd6, 0x0a, 0x75, 0x07, 0x1c, 0x09, 0x34, 0xfc, 0xcd, 0xd8, 0x65, 0xd1, 0xbc, 0xf9, 0x17, 0x16, 
-0xa2, 0x11, 0xe9, 0x16, 0x7a, 0x29, 0x2e, 0x31, 0x0d, 0x30, 0x0c, 0x28, 0xcc, 0x18, 0x8e, 0x0f, 
-0x77, 0x0b, 0xcb, 0xfd, 0xf7, 0xeb, 0x75, 0xe4, 0xdf, 0xe2, 0x9e, 0xe4, 0x4b, 0xf5, 0x21, 0x0d, 
-0xaf, 0x1b, 0x0b, 0x27, 0x1b, 0x2b, 0xb6, 0x1a, 0xd7, 0x08, 0xaf, 0x05, 0x41, 0x06, 0x09, 0x04, 
-0x0b, 0xf8, 0xfe, 0xe2, 0x82, 0xda, 0xe2, 0xdc, 0xa5, 0xdc, 0xe3, 0xe9, 0x05, 0x06, 0x1a, 0x18, 
-0x50, 0x1b, 0x21, 0x14, 0x46, 0x04, 0xa6, 0xfc, 0x03, 0x04, 0xcf, 0x01, 0x30, 0xe8, 0xf3, 0xcd, 
-0x7a, 0xc2, 0xed, 0xbc, 0x3f, 0xc3, 0x45, 0xd6, 0x37, 0xde, 0x6e, 0xe1, 0xaa, 0xeb, 0x35, 0xe9, 
-0x2e, 0xf2, 0xd6, 0x1f, 0x10, 0x35, 0x28, 0x1e, 0x87, 0x17, 0xa3, 0x1b, 0x22, 0x0d, 0xe5, 0x0a, 
-0xce, 0x0f, 0x8e, 0xfa, 0xa9, 0xe8, 0xc3, 0xee, 0xbc, 0xed, 0x21, 0xed, 0x81, 0x0c, 0x7d, 0x2c, 
-0x1b, 0x27, 0x67, 0x1a, 0x53, 0x20, 0x8a, 0x24, 0xc7, 0x24, 0x92, 0x28, 0x97, 0x1e, 0xca, 0x0a, 
-0xc3, 0xff, 0xf8, 0xf4, 0x45, 0xe9, 0xbf, 0xe7, 0x33, 0xf0, 0xc9, 0x08, 0x93, 0x20, 0x0d, 0x14, 
-0x97, 0x01, 0x41, 0x10, 0xdd, 0x18, 0xb1, 0x0b, 0x95, 0x0c, 0x13, 0x0c, 0x24, 0xf5, 0x2d, 0xe7, 
-0xde, 0xe8, 0xe5, 0xe9, 0xb9, 0xf5, 0x4d, 0x09, 0x04, 0x0d, 0xb3, 0x05, 0x84, 0x04, 0xb3, 0x04, 
-0x45, 0xfe, 0x62, 0xfb, 0x33, 0xfe, 0xbb, 0xf4, 0xe2, 0xe2, 0xba, 0xdc, 0x14, 0xdc, 0x86, 0xda, 
-0x44, 0xde, 0xa8, 0xe3, 0xb3, 0xed, 0x87, 0xf5, 0xb4, 0xe6, 0x4d, 0xd8, 0xfd, 0xdf, 0x30, 0xe4, 
-0x99, 0xea, 0x81, 0x06, 0xb1, 0x19, 0x49, 0x13, 0x9f, 0x02, 0xd1, 0xf5, 0x5d, 0xff, 0x02, 0x15, 
-0x62, 0x1c, 0x3a, 0x1f, 0x4e, 0x1d, 0xed, 0x07, 0xf2, 0xf2, 0x82, 0xea, 0x85, 0xea, 0x5d, 0x00, 
-0x0f, 0x23, 0x38, 0x30, 0xa8, 0x20, 0xc9, 0x0e, 0xd9, 0x11, 0x10, 0x1c, 0x64, 0x1e, 0x54, 0x24, 
-0xfb, 0x1e, 0x1b, 0x05, 0x9c, 0xfb, 0x2f, 0xfb, 0xab, 0xe9, 0x0f, 0xea, 0x60, 0xfd, 0x70, 0xfc, 
-0x13, 0xfc, 0xf1, 0x10, 0x47, 0x20, 0x54, 0x1d, 0x9d, 0x0f, 0x57, 0x05, 0xb4, 0x07, 0xb7, 0x08, 
-0xb2, 0xff, 0x5a, 0xf1, 0xe0, 0xe4, 0x99, 0xe9, 0x67, 0xf7, 0x09, 0xf9, 0x59, 0xfa, 0xb6, 0x02, 
-0x59, 0x05, 0x42, 0x04, 0xe0, 0xff, 0xa9, 0xf8, 0x15, 0xfb, 0x9b, 0x00, 0xd8, 0xfa, 0x12, 0xec, 
-0xa9, 0xdb, 0x9a, 0xd4, 0x85, 0xd9, 0xe5, 0xde, 0x98, 0xe0, 0x94, 0xdf, 0x6c, 0xde, 0xb1, 0xde, 
-0xe9, 0xd9, 0x55, 0xe0, 0x72, 0x05, 0xf5, 0x26, 0xb3, 0x24, 0xd9, 0x12, 0x14, 0x02, 0x41, 0xf7, 
-0xb5, 0x02, 0x8c, 0x19, 0x11, 0x19, 0xf7, 0x09, 0xba, 0x0e, 0x99, 0x13, 0x68, 0xfb, 0xca, 0xed, 
-0xc1, 0x01, 0x2a, 0x0f, 0x1c, 0x10, 0x65, 0x14, 0xc0, 0x0d, 0x26, 0x09, 0xd7, 0x1b, 0x8d, 0x2c, 
-0x02, 0x29, 0xa7, 0x1f, 0xb9, 0x18, 0x34, 0x07, 0xcc, 0xe5, 0xd0, 0xd9, 0x40, 0xf8, 0x7f, 0x13, 
-0x62, 0x13, 0x3d, 0x0f, 0x6e, 0x08, 0x0c, 0xfc, 0x4c, 0xfe, 0x47, 0x14, 0x0d, 0x1e, 0xd3, 0x01, 
-0x7d, 0xe8, 0x6f, 0xf6, 0x1c, 0xff, 0x99, 0xf4, 0x69, 0xf8, 0x42, 0xf8, 0xda, 0xf6, 0x5b, 0x10, 
-0xf4, 0x17, 0xb0, 0xff, 0x06, 0xfe, 0xa0, 0x0a, 0x15, 0x01, 0xbb, 0xee, 0xc3, 0xe7, 0xe5, 0xea, 
-0xd3, 0xe6, 0xf1, 0xd9, 0x48, 0xd6, 0xc1, 0xd5, 0xe2, 0xd5, 0xe3, 0xdf, 0x00, 0xe3, 0xce, 0xe3, 
-0x6d, 0xf0, 0x0d, 0xf3, 0x83, 0xf4, 0x44, 0x06, 0x96, 0x0d, 0x55, 0x0b, 0x1a, 0x0c, 0xf2, 0x00, 
-0xef, 0xf7, 0x9e, 0xfe, 0x13, 0x04, 0xbc, 0x05, 0xc8, 0x04, 0xa0, 0x05, 0x65, 0x0f, 0x4a, 0x10, 
-0x68, 0x09, 0xc7, 0x0d, 0x30, 0x13, 0x5b, 0x15, 0x7f, 0x14, 0xe3, 0x09, 0xfa, 0x0b, 0x02, 0x1f, 
-0xa6, 0x24, 0x09, 0x17, 0xe4, 0xfd, 0x61, 0xef, 0xf0, 0x01, 0x25, 0x11, 0x40, 0x06, 0x7e, 0x06, 
-0x51, 0x14, 0xab, 0x14, 0xbe, 0x0a, 0xba, 0x07, 0x13, 0x15, 0x70, 0x1f, 0x0e, 0x12, 0x9b, 0xfd, 
-0x46, 0xec, 0xbc, 0xe1, 0xaa, 0xe9, 0xe9, 0xee, 0xd8, 0xec, 0x35, 0xfe, 0x85, 0x0b, 0x58, 0x00, 
-0x18, 0xff, 0xb9, 0x10, 0x83, 0x1c, 0x9b, 0x14, 0x59, 0x00, 0x85, 0xf6, 0x15, 0xf4, 0x1b, 0xe9, 
-0x30, 0xe0, 0x2d, 0xdc, 0xe1, 0xda, 0x9e, 0xe1, 0xc0, 0xe2, 0x75, 0xe1, 0x42, 0xea, 0x9f, 0xe8, 
-0x3b, 0xde, 0x3d, 0xdd, 0x14, 0xdd, 0x94, 0xe6, 0x5d, 0xfd, 0x47, 0x0b, 0xa5, 0x14, 0x90, 0x13, 
-0x10, 0xfc, 0x00, 0xf8, 0x80, 0x13, 0x01, 0x20, 0x46, 0x14, 0x90, 0x05, 0x03, 0x00, 0x38, 0x06, 
-0xce, 0x05, 0xa9, 0xfa, 0x52, 0xfc, 0x6f, 0x0b, 0x86, 0x12, 0xf9, 0x09, 0x82, 0x04, 0xaa, 0x16, 
-0xdd, 0x2e, 0x7b, 0x34, 0x62, 0x2d, 0x3a, 0x20, 0x24, 0x11, 0x8e, 0x04, 0xc6, 0xf6, 0x51, 0xf5, 
-0x11, 0xff, 0x2f, 0xf4, 0xb2, 0xe5, 0x93, 0xf3, 0x65, 0x02, 0xbd, 0x09, 0xd0, 0x1e, 0x35, 0x28, 
-0x94, 0x18, 0xfd, 0x0f, 0xf4, 0x09, 0x5a, 0xf4, 0xdc, 0xed, 0x89, 0xff, 0x88, 0xfd, 0xd3, 0xe6, 
-0xc0, 0xe5, 0xde, 0xf5, 0x1a, 0x00, 0xe3, 0x0a, 0xb4, 0x0e, 0x62, 0x04, 0xdc, 0x02, 0x18, 0x04, 
-0x83, 0xf1, 0x34, 0xe4, 0x65, 0xed, 0x76, 0xee, 0xfe, 0xde, 0x45, 0xd5, 0x43, 0xd3, 0x52, 0xd7, 
-0x93, 0xe5, 0xc4, 0xeb, 0x18, 0xe8, 0x7f, 0xf3, 0xfd, 0xf8, 0xf7, 0xe3, 0x41, 0xe5, 0xd6, 0x05, 
-0xb1, 0x0f, 0xa2, 0x03, 0x8c, 0xf8, 0xc0, 0xec, 0x8e, 0xf8, 0xfb, 0x18, 0xdf, 0x1d, 0x7a, 0x0d, 
-0xc4, 0x07, 0xb2, 0x04, 0x48, 0x02, 0x50, 0x0a, 0xa1, 0x15, 0x96, 0x1e, 0xa3, 0x22, 0x29, 0x1c, 
-0x3a, 0x13, 0xdd, 0x16, 0x73, 0x1d, 0x1b, 0x12, 0xa4, 0x05, 0x2a, 0x0b, 0x6e, 0x08, 0xd8, 0xfc, 
-0xec, 0x06, 0xbe, 0x12, 0x4a, 0x0c, 0xc7, 0x04, 0xa1, 0xf8, 0x0d, 0xf3, 0xd6, 0x0d, 0xe9, 0x25, 
-0x74, 0x1d, 0x4c, 0x10, 0xdc, 0x09, 0x96, 0x03, 0x0a, 0x03, 0x83, 0x04, 0x5c, 0x02, 0xda, 0xfc, 
-0xc1, 0xf3, 0x57, 0xeb, 0x17, 0xe7, 0xbb, 0xec, 0xfd, 0xf9, 0x4b, 0xfb, 0xda, 0xf6, 0xa5, 0xff, 
-0x7a, 0x02, 0x36, 0xf7, 0x66, 0xf6, 0x52, 0xfe, 0x08, 0xfe, 0x63, 0xf4, 0xa7, 0xe4, 0x23, 0xdb, 
-0xda, 0xdf, 0x88, 0xe3, 0xd8, 0xda, 0x10, 0xce, 0x5c, 0xcb, 0x1a, 0xd8, 0x9e, 0xe6, 0x27, 0xeb, 
-0x49, 0xf2, 0x3b, 0x07, 0xc4, 0x1b, 0xaf, 0x1f, 0xea, 0x18, 0xe3, 0x11, 0xe5, 0x09, 0xd1, 0x03, 
-0xfe, 0x00, 0x95, 0xf7, 0x99, 0xec, 0x22, 0xf2, 0x22, 0x04, 0x5e, 0x0e, 0xb4, 0x0e, 0xce, 0x17, 
-0xd1, 0x2a, 0x9c, 0x2f, 0x2b, 0x27, 0x70, 0x23, 0x05, 0x19, 0x06, 0x08, 0x56, 0x09, 0xd2, 0x0f, 
-0x78, 0x03, 0x35, 0xf7, 0xa3, 0xf8, 0x61, 0xf6, 0x0f, 0xf3, 0xdc, 0x04, 0xa7, 0x1e, 0xea, 0x23, 
-0x8a, 0x1f, 0x84, 0x1c, 0x0d, 0x0e, 0x03, 0x02, 0x74, 0x01, 0xed, 0xf7, 0x91, 0xf4, 0x46, 0x04, 
-0x24, 0x01, 0xbc, 0xe5, 0x99, 0xd8, 0x76, 0xea, 0x97, 0x0d, 0x87, 0x1f, 0x9c, 0x15, 0x61, 0x0b, 
-0x3e, 0x01, 0xc9, 0xef, 0xfd, 0xea, 0x3c, 0xed, 0xb1, 0xea, 0x02, 0xee, 0xe5, 0xea, 0x32, 0xdb, 
-0x1a, 0xd9, 0xb0, 0xe6, 0x69, 0xf0, 0x72, 0xf3, 0x2f, 0xf6, 0xd9, 0xf6, 0x66, 0xee, 0x8d, 0xe6, 
-0x03, 0xe9, 0x45, 0xe6, 0xb6, 0xe0, 0xec, 0xe9, 0x84, 0xf3, 0x65, 0xf5, 0x59, 0xfe, 0x86, 0x0b, 
-0xf6, 0x14, 0x51, 0x18, 0x9b, 0x13, 0x4c, 0x11, 0x7e, 0x15, 0xc3, 0x17, 0x2e, 0x13, 0x0e, 0x02, 
-0xa2, 0xf1, 0x71, 0xfa, 0x18, 0x0e, 0x8e, 0x13, 0x6a, 0x14, 0x93, 0x1c, 0x91, 0x21, 0x1a, 0x19, 
-0xcf, 0x0f, 0x79, 0x14, 0x0e, 0x19, 0x96, 0x13, 0x71, 0x0e, 0x95, 0x03, 0xd2, 0xf4, 0x48, 0xf9, 
-0x4c, 0x05, 0xba, 0x01, 0x9e, 0xff, 0x31, 0x0b, 0x01, 0x15, 0xbb, 0x18, 0x42, 0x17, 0x61, 0x08, 
-0x0c, 0xf7, 0x30, 0xf6, 0xc8, 0xf7, 0xf4, 0xee, 0xcb, 0xf0, 0xdb, 0xff, 0x56, 0x05, 0xdd, 0x03, 
-0x82, 0x06, 0x59, 0x07, 0xf3, 0x01, 0xff, 0xf9, 0xa9, 0xfc, 0xfb, 0x09, 0x50, 0x03, 0x3b, 0xe7, 
-0xcf, 0xda, 0x00, 0xde, 0x91, 0xdc, 0xc6, 0xdd, 0x9b, 0xe0, 0x03, 0xdf, 0x54, 0xe9, 0xc1, 0xf7, 
-0x90, 0xf0, 0xeb, 0xe9, 0x35, 0xf8, 0x03, 0xf7, 0x84, 0xe1, 0x70, 0xe5, 0xe5, 0xfb, 0x75, 0x00, 
-0x42, 0xfd, 0xc7, 0xfc, 0xdb, 0xf7, 0x9a, 0xfc, 0xf9, 0x0c, 0x87, 0x0f, 0x4b, 0x03, 0x4d, 0x00, 
-0x42, 0x09, 0x43, 0x0b, 0xbf, 0x06, 0xf8, 0x0e, 0x4f, 0x20, 0x2e, 0x27, 0x6b, 0x21, 0xe0, 0x18, 
-0x71, 0x16, 0x57, 0x18, 0xdc, 0x13, 0xea, 0x0a, 0x1f, 0x02, 0xc2, 0xf7, 0x35, 0xf6, 0x16, 0xff, 
-0x9d, 0x03, 0x0d, 0x07, 0x62, 0x0e, 0x9c, 0x0e, 0x17, 0x0b, 0xab, 0x0f, 0x04, 0x16, 0x81, 0x13, 
-0xdd, 0x0c, 0x2c, 0x09, 0x08, 0x04, 0x06, 0x03, 0x4b, 0x0e, 0x04, 0x0f, 0x13, 0xfb, 0xd8, 0xeb, 
-0xb3, 0xe3, 0x17, 0xdf, 0x7a, 0xee, 0x62, 0x05, 0x98, 0x10, 0xbb, 0x13, 0x01, 0x08, 0x97, 0xf6, 
-0xe0, 0xf7, 0x66, 0xfd, 0x62, 0xf9, 0xa0, 0xf6, 0x22, 0xee, 0x82, 0xe0, 0x3e, 0xe0, 0xbf, 0xe5, 
-0x3c, 0xe5, 0x4b, 0xe8, 0x5c, 0xeb, 0x98, 0xe0, 0x31, 0xd4, 0x2b, 0xd5, 0xd0, 0xd6, 0x44, 0xda, 
-0xcf, 0xf3, 0xa5, 0x10, 0x0d, 0x17, 0xa4, 0x15, 0x6f, 0x10, 0xbb, 0x03, 0xe3, 0x04, 0xbd, 0x0e, 
-0x9f, 0x0a, 0x80, 0x06, 0xfc, 0x09, 0xdf, 0x01, 0xb3, 0xf3, 0x62, 0xf9, 0xd5, 0x11, 0x69, 0x22, 
-0xd0, 0x23, 0xe6, 0x23, 0x42, 0x1e, 0x72, 0x0e, 0xa7, 0x06, 0xcd, 0x09, 0xd5, 0x0b, 0x8e, 0x0a, 
-0xf1, 0x01, 0x40, 0xf6, 0x8d, 0xf6, 0x15, 0xff, 0x98, 0x05, 0x66, 0x0d, 0xbe, 0x17, 0xb5, 0x1e, 
-0xde, 0x1d, 0x5b, 0x18, 0x0b, 0x15, 0xbc, 0x10, 0x55, 0x04, 0xeb, 0xf5, 0xd4, 0xf1, 0x53, 0xf5, 
-0x0b, 0xf4, 0x95, 0xf4, 0x3d, 0xfd, 0x2f, 0xfc, 0x33, 0xf8, 0xdc, 0x06, 0xc7, 0x0e, 0xc0, 0x02, 
-0xef, 0x01, 0xa3, 0x07, 0x57, 0x00, 0x4a, 0xfa, 0xb5, 0xf4, 0xfc, 0xe9, 0x65, 0xeb, 0xb0, 0xef, 
-0x2e, 0xe3, 0x02, 0xdb, 0xf8, 0xe8, 0x0b, 0xf7, 0x03, 0xf3, 0xda, 0xe6, 0xdf, 0xdc, 0xec, 0xd4, 
-0x69, 0xd1, 0x3b, 0xd2, 0x85, 0xd6, 0x28, 0xe8, 0x88, 0x07, 0x81, 0x20, 0x51, 0x23, 0x29, 0x15, 
-0xe2, 0x0a, 0x57, 0x0d, 0xce, 0x0d, 0x28, 0x08, 0x42, 0x05, 0x94, 0x02, 0xc1, 0x00, 0x25, 0x01, 
-0xfa, 0xfd, 0x90, 0x04, 0x57, 0x1c, 0x35, 0x28, 0x7f, 0x1a, 0x71, 0x0a, 0x4d, 0x07, 0xd0, 0x0d, 
-0x91, 0x16, 0xe9, 0x17, 0x02, 0x0f, 0x27, 0x04, 0x1e, 0xfb, 0x68, 0xf0, 0x19, 0xee, 0xab, 0x01, 
-0x6e, 0x19, 0xd1, 0x1c, 0x8d, 0x17, 0xbf, 0x1c, 0x7d, 0x23, 0xcc, 0x1e, 0x69, 0x11, 0x5a, 0x01, 
-0xb1, 0xf4, 0x6f, 0xef, 0x10, 0xe8, 0x2d, 0xdd, 0xec, 0xe4, 0x9a, 0xfd, 0x9a, 0x0a, 0x18, 0x0e, 
-0xbf, 0x12, 0x87, 0x0e, 0x99, 0x0d, 0x85, 0x18, 0x8a, 0x10, 0xa5, 0xf5, 0x48, 0xea, 0x45, 0xe9, 
-0x9e, 0xe0, 0x1b, 0xdc, 0x0f, 0xe1, 0x65, 0xe8, 0xd1, 0xf1, 0x0a, 0xf3, 0xca, 0xe7, 0xdd, 0xe9, 
-0xe2, 0xfa, 0x18, 0xf6, 0xb9, 0xdc, 0x09, 0xce, 0x0f, 0xca, 0x30, 0xcc, 0xbf, 0xd9, 0x7f, 0xeb, 
-0xfa, 0x00, 0x71, 0x16, 0xb7, 0x1b, 0xd9, 0x1c, 0x96, 0x26, 0x12, 0x26, 0x0f, 0x1b, 0xb7, 0x13, 
-0xc5, 0x07, 0x33, 0xf6, 0x41, 0xec, 0x9c, 0xeb, 0x96, 0xf3, 0x8a, 0x07, 0x97, 0x1b, 0x24, 0x1a, 
-0x90, 0x0c, 0x2c, 0x10, 0xd0, 0x1b, 0x12, 0x1c, 0xc9, 0x1e, 0xa9, 0x21, 0x1a, 0x15, 0xf7, 0x08, 
-0xc5, 0x01, 0x2d, 0xf2, 0x99, 0xec, 0x7b, 0xff, 0x1b, 0x10, 0x40, 0x0e, 0xd3, 0x0d, 0x89, 0x14, 
-0x3c, 0x11, 0xd6, 0x0f, 0x8a, 0x1d, 0xeb, 0x1d, 0xb7, 0x0f, 0x88, 0x0b, 0x38, 0xfb, 0xc0, 0xda, 
-0xdb, 0xd4, 0x3a, 0xe8, 0x2b, 0xfa, 0xdf, 0x05, 0x94, 0x02, 0x8d, 0xf8, 0x98, 0xff, 0x42, 0x0f, 
-0x44, 0x15, 0xd9, 0x11, 0x7f, 0x09, 0x7f, 0xfd, 0x07, 0xeb, 0xec, 0xd8, 0x86, 0xd5, 0x09, 0xdb, 
-0x59, 0xdc, 0xfc, 0xda, 0x34, 0xdc, 0xaf, 0xdf, 0x4e, 0xde, 0xb1, 0xd6, 0x5e, 0xd3, 0x38, 0xda, 
-0xf7, 0xed, 0x1d, 0x09, 0x60, 0x17, 0x8c, 0x16, 0xf2, 0x11, 0xcd, 0x09, 0x24, 0x06, 0xec, 0x07, 
-0xb0, 0x02, 0xce, 0x00, 0x94, 0x05, 0xad, 0xff, 0xd8, 0xf7, 0xd7, 0xf9, 0x03, 0x01, 0xc4, 0x14, 
-0x01, 0x2d, 0x90, 0x2d, 0x6c, 0x1a, 0xf0, 0x0d, 0x02, 0x0e, 0x40, 0x0f, 0xc5, 0x0d, 0x53, 0x0e, 
-0x0b, 0x0d, 0x54, 0x05, 0xad, 0xfc, 0x85, 0xf7, 0x34, 0xfc, 0x1b, 0x0c, 0xbe, 0x17, 0x5f, 0x1a, 
-0x18, 0x1e, 0xdd, 0x20, 0xdf, 0x1a, 0xd4, 0x0c, 0x08, 0x01, 0xa1, 0xfe, 0xf8, 0xfb, 0x8a, 0xf6, 
-0x8d, 0xf6, 0x15, 0xf4, 0x74, 0xec, 0x32, 0xee, 0x26, 0xfd, 0xbd, 0x0f, 0x92, 0x16, 0x17, 0x10, 
-0x8d, 0x0e, 0xf1, 0x0d, 0xe1, 0x02, 0x5e, 0xfd, 0xfa, 0xfa, 0xea, 0xeb, 0x80, 0xdf, 0x62, 0xdc, 
-0x74, 0xd7, 0xb4, 0xda, 0x2d, 0xe8, 0x35, 0xea, 0xd6, 0xe2, 0xfe, 0xe6, 0x9a, 0xeb, 0x86, 0xe0, 
-0xd4, 0xdb, 0x79, 0xe0, 0xb2, 0xd7, 0x33, 0xdb, 0xbc, 0xfa, 0x26, 0x0b, 0x92, 0x08, 0x09, 0x0d, 
-0xd1, 0x0f, 0xee, 0x14, 0x22, 0x1f, 0x55, 0x15, 0x93, 0x02, 0xea, 0xff, 0x81, 0xff, 0x75, 0xf4, 
-0x19, 0xea, 0xa8, 0xf3, 0x83, 0x13, 0xec, 0x2c, 0x19, 0x2a, 0x59, 0x16, 0x90, 0x0e, 0x10, 0x21, 
-0x55, 0x2f, 0xa8, 0x20, 0xc1, 0x0c, 0x4d, 0xfe, 0xd1, 0xee, 0xde, 0xea, 0xb6, 0xf1, 0x4c, 0xfc, 
-0x40, 0x0c, 0xb0, 0x11, 0x3d, 0x08, 0xdb, 0x04, 0x3d, 0x11, 0xc3, 0x26, 0x53, 0x32, 0x92, 0x28, 
-0xca, 0x13, 0xe4, 0xf9, 0x01, 0xe9, 0x57, 0xef, 0xa6, 0xf3, 0xfa, 0xea, 0xee, 0xeb, 0x2e, 0xf5, 
-0x29, 0xff, 0x05, 0x08, 0x53, 0x07, 0xe1, 0x07, 0x34, 0x0b, 0x81, 0x03, 0x0f, 0xff, 0xce, 0xff, 
-0x53, 0xf7, 0x8e, 0xf2, 0x40, 0xed, 0xd1, 0xdb, 0x26, 0xdb, 0x76, 0xee, 0x4d, 0xf0, 0xbc, 0xdf, 
-0xa7, 0xd7, 0x0d, 0xd8, 0xb9, 0xd2, 0x8f, 0xce, 0xa6, 0xd4, 0x0b, 0xe0, 0xcb, 0xfa, 0x8e, 0x1e, 
-0x26, 0x20, 0xaf, 0x07, 0x7a, 0x03, 0x01, 0x0d, 0xfe, 0x13, 0xab, 0x19, 0x76, 0x0e, 0x4c, 0xf9, 
-0x71, 0xf2, 0x51, 0xf3, 0x8d, 0xf3, 0x4f, 0xf8, 0x90, 0x06, 0x3a, 0x1f, 0xfb, 0x2b, 0xa6, 0x1e, 
-0xf5, 0x13, 0xfd, 0x1b, 0x1b, 0x22, 0x86, 0x1d, 0x9e, 0x18, 0xc9, 0x11, 0x4f, 0xfe, 0x5d, 0xe8, 
-0xe6, 0xe3, 0x57, 0xee, 0xc4, 0xff, 0xdb, 0x11, 0x5b, 0x15, 0x73, 0x15, 0x83, 0x26, 0x56, 0x2f, 
-0xd1, 0x1e, 0x9b, 0x13, 0x4c, 0x15, 0x9e, 0x09, 0x1b, 0xf3, 0x37, 0xe7, 0x2f, 0xe3, 0x41, 0xe2, 
-0x2c, 0xee, 0x26, 0xfc, 0x27, 0xfe, 0xdf, 0x04, 0xbd, 0x10, 0x71, 0x0e, 0xbf, 0x09, 0x2e, 0x0b, 
-0x94, 0x06, 0xa1, 0x03, 0x2b, 0x00, 0x70, 0xea, 0xe8, 0xd5, 0x75, 0xd7, 0x15, 0xdf, 0xee, 0xe5, 
-0xf5, 0xed, 0x79, 0xe7, 0xe8, 0xd7, 0x6b, 0xd9, 0xa5, 0xe1, 0x3f, 0xdd, 0xaf, 0xdd, 0x3b, 0xe5, 
-0x45, 0xe6, 0xab, 0xf8, 0x5e, 0x1a, 0x3f, 0x1e, 0x32, 0x10, 0xb6, 0x0f, 0x8a, 0x09, 0x0b, 0xfe, 
-0x3e, 0x01, 0xb2, 0x03, 0x5a, 0x00, 0x06, 0x04, 0x84, 0x04, 0x68, 0xfe, 0xab, 0x03, 0x3d, 0x15, 
-0x64, 0x1e, 0x8f, 0x17, 0x1e, 0x10, 0x18, 0x10, 0xf5, 0x13, 0x62, 0x1b, 0x6d, 0x1c, 0x9a, 0x10, 
-0x3f, 0x02, 0xcd, 0xf3, 0x2c, 0xee, 0x8a, 0xfd, 0xe2, 0x0a, 0x7b, 0x09, 0x7c, 0x0b, 0x40, 0x0c, 
-0xab, 0x0b, 0xb1, 0x1b, 0x65, 0x27, 0x56, 0x19, 0x07, 0x0b, 0xaf, 0x0a, 0x71, 0x05, 0x65, 0xf6, 
-0x73, 0xeb, 0x9f, 0xe6, 0x39, 0xe8, 0x6b, 0xf8, 0xed, 0x00, 0xef, 0xf1, 0x21, 0xfa, 0x9e, 0x1d, 
-0x7e, 0x1c, 0x7b, 0x04, 0x86, 0x06, 0x9e, 0x08, 0x30, 0xfd, 0xbb, 0xf6, 0xc9, 0xe8, 0x6d, 0xdb, 
-0x51, 0xe2, 0x5a, 0xe3, 0x08, 0xd6, 0x78, 0xd6, 0xb7, 0xe0, 0x32, 0xdf, 0x34, 0xda, 0x78, 0xde, 
-0xad, 0xe1, 0x66, 0xe3, 0x17, 0xf5, 0x9e, 0x0c, 0x30, 0x14, 0x0c, 0x12, 0x0a, 0x0e, 0x5f, 0x0d, 
-0x92, 0x14, 0xea, 0x0e, 0xe1, 0xfe, 0x93, 0x04, 0x5f, 0x0c, 0xac, 0xfa, 0x51, 0xec, 0xf6, 0xf2, 
-0x68, 0x04, 0x00, 0x1a, 0x36, 0x1f, 0xdd, 0x11, 0x49, 0x13, 0xe4, 0x22, 0xfd, 0x1e, 0x5e, 0x0b, 
-0xfe, 0x05, 0x2a, 0x0a, 0xac, 0x01, 0xaf, 0xf8, 0x5e, 0xfb, 0x11, 0xfb, 0x19, 0x01, 0x64, 0x13, 
-0x1d, 0x11, 0x7d, 0x04, 0xb0, 0x11, 0x91, 0x20, 0xc2, 0x20, 0x18, 0x24, 0x6a, 0x15, 0x67, 0xf0, 
-0xb4, 0xe3, 0xf2, 0xef, 0xe1, 0xf4, 0xb0, 0xfb, 0x9c, 0x09, 0x81, 0x06, 0x2f, 0xf8, 0x38, 0xfa, 
-0x0c, 0x06, 0x93, 0x0a, 0x37, 0x0d, 0x46, 0x09, 0x8e, 0xf8, 0xd6, 0xf0, 0xf1, 0xf1, 0x16, 0xe7, 
-0x1d, 0xe3, 0x6d, 0xef, 0x21, 0xf0, 0x93, 0xeb, 0x8f, 0xf2, 0xfe, 0xf2, 0xe3, 0xe9, 0xca, 0xe0, 
-0xae, 0xd4, 0x52, 0xd1, 0x15, 0xd9, 0x50, 0xda, 0x59, 0xe2, 0x34, 0x01, 0xdc, 0x1a, 0x3b, 0x1a, 
-0x6e, 0x13, 0x63, 0x17, 0x3a, 0x1b, 0xcb, 0x16, 0xae, 0x0e, 0x82, 0x00, 0x8f, 0xf4, 0x51, 0xf8, 
-0xca, 0xf5, 0x9e, 0xe9, 0x1d, 0xfb, 0x83, 0x17, 0x35, 0x12, 0xba, 0x09, 0x2d, 0x16, 0x59, 0x1e, 
-0xf3, 0x25, 0x13, 0x2e, 0x35, 0x1c, 0xa3, 0x02, 0x27, 0x01, 0x03, 0x01, 0xb8, 0xee, 0x20, 0xe5, 
-0x39, 0xef, 0x18, 0xf7, 0xcd, 0x00, 0x03, 0x17, 0x32, 0x1f, 0x9d, 0x19, 0xf7, 0x24, 0xd3, 0x2d, 
-0x12, 0x20, 0xb9, 0x11, 0xe6, 0xfe, 0x6d, 0xe5, 0x75, 0xe1, 0xf1, 0xe6, 0x57, 0xe1, 0x2a, 0xe6, 
-0x18, 0xfa, 0xf3, 0x0b, 0x08, 0x16, 0x62, 0x13, 0xb1, 0x0b, 0x2b, 0x0d, 0x41, 0x0d, 0xd4, 0xff, 
-0x5e, 0xf1, 0x05, 0xf0, 0xe7, 0xef, 0x04, 0xe0, 0xb5, 0xcf, 0xf3, 0xcd, 0x0e, 0xd1, 0xdd, 0xdc, 
-0xf4, 0xeb, 0x45, 0xe7, 0xb8, 0xe0, 0x7b, 0xe4, 0xc5, 0xdc, 0xce, 0xe5, 0xbc, 0x15, 0xe9, 0x30, 
-0x24, 0x1e, 0x2f, 0x0a, 0xe4, 0x03, 0xce, 0x00, 0xa8, 0x04, 0x2c, 0x08, 0x2d, 0xff, 0xe8, 0xf7, 
-0x0d, 0xfe, 0x1f, 0xfb, 0x2d, 0xef, 0x28, 0xff, 0xaa, 0x1b, 0xfe, 0x1f, 0xc4, 0x25, 0xef, 0x31, 
-0x93, 0x21, 0x7c, 0x0b, 0xfd, 0x09, 0x09, 0x07, 0x6d, 0x04, 0xe5, 0x08, 0x12, 0x00, 0x29, 0xf1, 
-0x39, 0xf2, 0x4f, 0xff, 0xf8, 0x0c, 0x29, 0x15, 0xd7, 0x16, 0x26, 0x14, 0x20, 0x12, 0xdd, 0x17, 
-0x42, 0x1b, 0x8c, 0x11, 0x7d, 0x07, 0xf8, 0xfd, 0x9d, 0xec, 0xa7, 0xdf, 0xcb, 0xdd, 0x9f, 0xe8, 
-0xa2, 0x00, 0x69, 0x0e, 0xf9, 0x0d, 0xbd, 0x13, 0x00, 0x12, 0xd5, 0x01, 0x32, 0xfd, 0x2b, 0x01, 
-0xb0, 0xfd, 0xdb, 0xf7, 0xce, 0xee, 0x6a, 0xe2, 0xba, 0xde, 0xc7, 0xe4, 0xad, 0xe7, 0x17, 0xe1, 
-0x7a, 0xdd, 0x1a, 0xe1, 0xa6, 0xde, 0xe7, 0xdf, 0x5f, 0xe8, 0xf2, 0xda, 0x67, 0xcd, 0x97, 0xef, 
-0x78, 0x20, 0xaa, 0x2d, 0x0a, 0x1f, 0x99, 0x09, 0x22, 0x00, 0xd0, 0x0b, 0xa4, 0x14, 0x6f, 0x09, 
-0x2b, 0xfc, 0x45, 0xfc, 0x5c, 0xfa, 0x12, 0xeb, 0xc7, 0xed, 0xc8, 0x0f, 0x22, 0x24, 0x40, 0x1e, 
-0xe0, 0x1d, 0x0e, 0x21, 0x53, 0x1f, 0x16, 0x20, 0x79, 0x19, 0xb1, 0x0e, 0xee, 0x0e, 0xf6, 0x09, 
-0x33, 0xf3, 0x09, 0xe0, 0xc8, 0xe4, 0xca, 0xf8, 0x68, 0x05, 0x45, 0x0c, 0xa3, 0x19, 0xde, 0x21, 
-0xb7, 0x20, 0x5a, 0x1d, 0xed, 0x0e, 0x1d, 0xfd, 0xc9, 0xf9, 0xfe, 0xfa, 0x3a, 0xf9, 0xa6, 0xf5, 
-0x21, 0xec, 0x2a, 0xea, 0x9b, 0xf8, 0x07, 0x09, 0xcb, 0x12, 0x46, 0x0f, 0xc1, 0x01, 0x67, 0x01, 
-0xa9, 0x09, 0x1d, 0x02, 0x6a, 0xf1, 0xbd, 0xe5, 0x80, 0xdb, 0xe5, 0xd2, 0x20, 0xd7, 0xf4, 0xe9, 
-0x29, 0xf7, 0x2f, 0xf4, 0x92, 0xed, 0x05, 0xe5, 0xa8, 0xde, 0xaf, 0xe2, 0xcf, 0xd8, 0x4c, 0xc7, 
-0x6a, 0xe2, 0x8a, 0x14, 0x1b, 0x1f, 0xfb, 0x10, 0xe9, 0x0c, 0x16, 0x10, 0xcd, 0x18, 0x89, 0x1e, 
-0x00, 0x12, 0x89, 0x02, 0xec, 0x03, 0xa1, 0x05, 0xdf, 0xf6, 0x62, 0xef, 0xcc, 0xfd, 0xc8, 0x04, 
-0xef, 0xff, 0xa5, 0x09, 0x16, 0x18, 0x56, 0x1f, 0x9b, 0x2a, 0x25, 0x2c, 0x68, 0x1d, 0x72, 0x15, 
-0x09, 0x12, 0x94, 0x06, 0x7c, 0xfa, 0x8b, 0xf1, 0xb1, 0xef, 0x9c, 0xf7, 0xa0, 0xfd, 0x82, 0xff, 
-0xca, 0x06, 0x1d, 0x16, 0x2f, 0x27, 0x6f, 0x2a, 0x06, 0x1c, 0xd5, 0x0c, 0xc5, 0x03, 0x37, 0xfa, 
-0x07, 0xed, 0xd9, 0xe1, 0x53, 0xe4, 0xd9, 0xed, 0xf8, 0xf0, 0x88, 0xfa, 0x7f, 0x0b, 0x1a, 0x0e, 
-0x0a, 0x09, 0x6a, 0x09, 0x84, 0x06, 0x1d, 0x01, 0x72, 0xfa, 0x6b, 0xea, 0x21, 0xdb, 0x26, 0xda, 
-0xf2, 0xdf, 0xe3, 0xdf, 0xb6, 0xdb, 0x60, 0xdc, 0x8c, 0xdc, 0x39, 0xd8, 0xa4, 0xdb, 0x22, 0xdf, 
-0x47, 0xdb, 0x3c, 0xf1, 0x64, 0x22, 0x92, 0x38, 0x92, 0x25, 0xf9, 0x0c, 0xad, 0x05, 0x84, 0x0e, 
-0x04, 0x13, 0xde, 0x01, 0x08, 0xef, 0xd8, 0xf6, 0xc4, 0x08, 0x1b, 0xff, 0x4a, 0xe9, 0x9e, 0xf8, 
-0xae, 0x1f, 0x7a, 0x2b, 0x3d, 0x1f, 0x67, 0x15, 0x53, 0x12, 0x55, 0x19, 0x61, 0x21, 0x1d, 0x1b, 
-0xef, 0x12, 0xcc, 0x0f, 0x7a, 0x00, 0x30, 0xe9, 0x5e, 0xe4, 0xca, 0xf4, 0x44, 0x02, 0x75, 0x05, 
-0xdb, 0x0f, 0x2f, 0x20, 0xe3, 0x26, 0xeb, 0x25, 0x29, 0x1b, 0xe6, 0x03, 0x1f, 0xf5, 0x4c, 0xf5, 
-0x0b, 0xf4, 0x84, 0xf0, 0xfe, 0xec, 0x77, 0xe6, 0xc6, 0xe7, 0xcc, 0xf6, 0x70, 0x06, 0x91, 0x0c, 
-0x7c, 0x0e, 0x6c, 0x14, 0x19, 0x16, 0xe7, 0x06, 0xee, 0xf0, 0xaf, 0xe5, 0xb7, 0xe5, 0x62, 0xe4, 
-0x93, 0xd7, 0xb6, 0xca, 0xb3, 0xcf, 0x7c, 0xde, 0xa2, 0xe5, 0xa1, 0xe1, 0x30, 0xda, 0x9c, 0xdd, 
-0xe6, 0xe8, 0x88, 0xee, 0xe5, 0xfd, 0x15, 0x1d, 0x78, 0x29, 0x15, 0x1a, 0x94, 0x09, 0x56, 0x00, 
-0x15, 0xff, 0xe2, 0x08, 0xb9, 0x0e, 0x49, 0x08, 0x49, 0x01, 0x9f, 0xf8, 0xf5, 0xeb, 0xcf, 0xf4, 
-0x95, 0x18, 0x6c, 0x2c, 0xc2, 0x22, 0xe0, 0x1c, 0xb8, 0x1b, 0x99, 0x10, 0x59, 0x0e, 0xaa, 0x16, 
-0xfc, 0x17, 0x66, 0x18, 0xc2, 0x0f, 0x89, 0xf2, 0x83, 0xe5, 0x3a, 0xfa, 0x71, 0x0a, 0x62, 0x0b, 
-0x78, 0x12, 0xf9, 0x18, 0xaf, 0x13, 0xb4, 0x0f, 0x91, 0x0f, 0xae, 0x08, 0xee, 0x03, 0x02, 0x08, 
-0xdd, 0x02, 0xc8, 0xf2, 0x46, 0xeb, 0xf7, 0xeb, 0xc4, 0xef, 0x0d, 0xfb, 0xc6, 0x01, 0x80, 0xfd, 
-0x96, 0x00, 0x60, 0x0b, 0x59, 0x08, 0x04, 0xf9, 0x43, 0xf5, 0x3b, 0x00, 0xd1, 0xff, 0x68, 0xeb, 
-0x29, 0xda, 0x83, 0xd5, 0xb1, 0xd5, 0xc9, 0xda, 0x6e, 0xdd, 0xde, 0xd6, 0x73, 0xd3, 0x2d, 0xd3, 
-0x91, 0xce, 0x64, 0xda, 0xf5, 0xff, 0xfc, 0x1c, 0xf9, 0x1e, 0x13, 0x1e, 0xf7, 0x23, 0xf8, 0x1f, 
-0x02, 0x15, 0x90, 0x0d, 0x23, 0x02, 0xd1, 0xfa, 0x75, 0x03, 0xac, 0x03, 0x86, 0xf2, 0xde, 0xee, 
-0x6d, 0xfd, 0xd9, 0x0b, 0x02, 0x1b, 0xb9, 0x26, 0x55, 0x24, 0x1a, 0x20, 0xb0, 0x22, 0x4d, 0x1c, 
-0x85, 0x09, 0x4f, 0xff, 0xa8, 0x02, 0xb1, 0x01, 0x71, 0xfb, 0xe7, 0xfb, 0xc4, 0xfd, 0x60, 0xfe, 
-0xaf, 0x08, 0x2c, 0x19, 0x9c, 0x23, 0x5d, 0x25, 0x80, 0x1d, 0x9f, 0x0e, 0xa2, 0x01, 0x19, 0xfa, 
-0x90, 0xf2, 0x9b, 0xe5, 0x53, 0xdc, 0x12, 0xe4, 0x4f, 0xf3, 0x1a, 0xfc, 0xd4, 0x02, 0xac, 0x06, 
-0x78, 0x05, 0xfa, 0x0d, 0x97, 0x1c, 0xcc, 0x14, 0xd6, 0xf8, 0x60, 0xe9, 0xb7, 0xe9, 0x73, 0xe3, 
-0x89, 0xd8, 0x83, 0xd4, 0x33, 0xd1, 0x1c, 0xd5, 0xc6, 0xe6, 0xd3, 0xea, 0x5b, 0xdb, 0xf5, 0xd3, 
-0x2c, 0xd1, 0x6b, 0xd4, 0x61, 0xfd, 0xfa, 0x2e, 0xb2, 0x2c, 0x6f, 0x0f, 0xd2, 0x0b, 0x82, 0x16, 
-0x79, 0x19, 0xfa, 0x16, 0x41, 0x0b, 0x8e, 0xfe, 0xd8, 0x00, 0x6d, 0xfa, 0x2f, 0xdf, 0x2b, 0xe0, 
-0x1f, 0x09, 0x68, 0x22, 0x14, 0x21, 0x65, 0x20, 0x95, 0x19, 0x6e, 0x0f, 0x0d, 0x15, 0x25, 0x1d, 
-0x92, 0x20, 0xe3, 0x26, 0x03, 0x1b, 0x20, 0xf9, 0xc5, 0xe5, 0xdf, 0xea, 0xc7, 0xf6, 0x29, 0x05, 
-0xaf, 0x0f, 0xb8, 0x0d, 0xe3, 0x0a, 0xdf, 0x10, 0xbe, 0x16, 0x97, 0x18, 0xc0, 0x16, 0x40, 0x09, 
-0xf6, 0xf5, 0x6d, 0xec, 0x1a, 0xe8, 0x18, 0xe6, 0x11, 0xef, 0x59, 0xf8, 0x8e, 0xfa, 0x21, 0x02, 
-0xa9, 0x07, 0x29, 0x02, 0xc1, 0x01, 0x3f, 0x05, 0xea, 0x00, 0xe9, 0xfe, 0x57, 0xfd, 0xbf, 0xef, 
-0xf4, 0xe1, 0x73, 0xdc, 0xf8, 0xd7, 0x6e, 0xd9, 0x46, 0xe2, 0x16, 0xe2, 0x97, 0xd5, 0xd5, 0xca, 
-0x27, 0xc9, 0xde, 0xd7, 0x11, 0xff, 0xc6, 0x28, 0x9e, 0x32, 0xb1, 0x22, 0x38, 0x16, 0x84, 0x16, 
-0xf6, 0x1c, 0xdf, 0x19, 0x16, 0x06, 0x97, 0xf8, 0xea, 0xfa, 0x8d, 0xf2, 0xf4, 0xdd, 0x42, 0xde, 
-0x7f, 0xfd, 0x09, 0x22, 0x24, 0x2e, 0x00, 0x20, 0xbb, 0x12, 0x30, 0x15, 0xd3, 0x1a, 0x35, 0x1a, 
-0x3b, 0x18, 0xee, 0x17, 0x2f, 0x11, 0x9e, 0xfd, 0xc7, 0xea, 0xda, 0xea, 0xb9, 0xfa, 0xd3, 0x0a, 
-0xc8, 0x11, 0x13, 0x10, 0xca, 0x0c, 0x6d, 0x0d, 0xbb, 0x10, 0x09, 0x10, 0xc4, 0x08, 0xee, 0x04, 
-0xa2, 0x07, 0x65, 0x00, 0x1b, 0xea, 0x30, 0xd8, 0x7f, 0xdc, 0x33, 0xf5, 0x29, 0x0b, 0xe7, 0x0b, 
-0x4a, 0x06, 0xac, 0x0b, 0xe3, 0x0f, 0xaa, 0x07, 0xa7, 0xfc, 0x64, 0xf7, 0x24, 0xf2, 0x8b, 0xe4, 
-0x81, 0xd5, 0x2a, 0xd3, 0x0b, 0xda, 0x3c, 0xde, 0x16, 0xe0, 0xb4, 0xe1, 0xd9, 0xdc, 0x4c, 0xd0, 
-0x3d, 0xce, 0xe1, 0xec, 0xf5, 0x1e, 0xe4, 0x38, 0xcb, 0x2a, 0x01, 0x11, 0xdc, 0x06, 0xf3, 0x08, 
-0x2b, 0x09, 0x71, 0x09, 0xc8, 0x0e, 0xf8, 0x0b, 0x27, 0xf6, 0x59, 0xde, 0xbb, 0xe0, 0x98, 0x00, 
-0xc4, 0x20, 0x75, 0x29, 0xcb, 0x21, 0x08, 0x16, 0xcb, 0x0b, 0xa6, 0x0d, 0x61, 0x19, 0x4f, 0x1d, 
-0x88, 0x15, 0xbe, 0x09, 0x46, 0xff, 0x6d, 0xfb, 0x70, 0xfa, 0xb9, 0xf5, 0xe6, 0xf8, 0x25, 0x0b, 
-0x5f, 0x17, 0xe0, 0x10, 0xfb, 0x0a, 0x3c, 0x10, 0x92, 0x0f, 0x7d, 0x03, 0xa0, 0xfb, 0x7a, 0xfc, 
-0x1e, 0xfe, 0x7b, 0xfb, 0x8c, 0xf1, 0x16, 0xe9, 0x73, 0xf2, 0x9b, 0x05, 0xf8, 0x0b, 0xfa, 0x06, 
-0x0f, 0x03, 0xa6, 0xfc, 0x49, 0xf4, 0x13, 0xf8, 0x82, 0x01, 0x0f, 0xfa, 0xf9, 0xe9, 0x8d, 0xe6, 
-0xe5, 0xe4, 0x30, 0xdb, 0xde, 0xd9, 0x64, 0xe1, 0x6e, 0xe5, 0x87, 0xe6, 0x0c, 0xd9, 0x73, 0xbe, 
-0x0b, 0xca, 0x30, 0x08, 0xf3, 0x33, 0xd1, 0x2d, 0x22, 0x1d, 0x3a, 0x14, 0x7b, 0x0f, 0x37, 0x15, 
-0x09, 0x15, 0xf4, 0x04, 0x89, 0x02, 0xbe, 0x06, 0xd5, 0xec, 0x98, 0xd7, 0x7c, 0xf3, 0xa4, 0x15, 
-0x6c, 0x17, 0x88, 0x11, 0x5f, 0x11, 0x07, 0x16, 0x49, 0x25, 0x27, 0x26, 0xe8, 0x0d, 0xb9, 0x08, 
-0x61, 0x1a, 0x1b, 0x12, 0x7c, 0xf7, 0x88, 0xf2, 0x46, 0xf8, 0x80, 0xf7, 0xcb, 0xfc, 0x79, 0x08, 
-0x99, 0x13, 0x63, 0x20, 0x3b, 0x22, 0x5b, 0x12, 0x05, 0x08, 0xa5, 0x08, 0x06, 0xfd, 0xb5, 0xe9, 
-0x77, 0xe7, 0x8e, 0xf0, 0xe6, 0xf2, 0xd2, 0xf3, 0x7f, 0xfc, 0xe6, 0x06, 0xba, 0x0b, 0x08, 0x09, 
-0x1d, 0x00, 0x3b, 0xfb, 0x9e, 0x02, 0x01, 0x08, 0xae, 0xf9, 0x72, 0xe3, 0xd8, 0xd9, 0x29, 0xd9, 
-0xa9, 0xd8, 0x15, 0xda, 0x6b, 0xd8, 0x60, 0xd3, 0x80, 0xd7, 0xf9, 0xdc, 0xeb, 0xd8, 0xba, 0xe6, 
-0xe3, 0x11, 0xfd, 0x2f, 0x12, 0x2b, 0xb2, 0x1a, 0x62, 0x0e, 0x52, 0x0c, 0x8c, 0x15, 0x03, 0x14, 
-0x56, 0x04, 0xba, 0x00, 0x74, 0xff, 0xbd, 0xe8, 0x8c, 0xda, 0x82, 0xf1, 0xad, 0x10, 0x09, 0x1d, 
-0xce, 0x1c, 0x69, 0x16, 0x42, 0x13, 0x50, 0x1d, 0x7e, 0x24, 0x1a, 0x1e, 0x83, 0x1c, 0x61, 0x1c, 
-0x42, 0x07, 0xa0, 0xee, 0xd1, 0xed, 0x82, 0xf8, 0x53, 0x00, 0x9d, 0x07, 0x13, 0x08, 0x92, 0x03, 
-0xb7, 0x08, 0x88, 0x10, 0x46, 0x0e, 0x7c, 0x0c, 0xe0, 0x0f, 0x18, 0x0a, 0x36, 0xfa, 0x59, 0xee, 
-0xf3, 0xea, 0x03, 0xee, 0x08, 0xf7, 0x5e, 0xfe, 0x57, 0xfe, 0x39, 0xff, 0xb7, 0x01, 0xc4, 0xfb, 
-0x41, 0xf7, 0x67, 0x01, 0x07, 0x08, 0x0f, 0xfa, 0x67, 0xe4, 0x41, 0xd5, 0x75, 0xd0, 0xcd, 0xd5, 
-0x49, 0xda, 0xba, 0xd8, 0xda, 0xd9, 0xf9, 0xd9, 0xb3, 0xd6, 0x2b, 0xe7, 0x0a, 0x10, 0x61, 0x2d, 
-0x0c, 0x2b, 0x75, 0x1a, 0x02, 0x0d, 0xbc, 0x07, 0xce, 0x09, 0x5f, 0x0b, 0x58, 0x0b, 0xa1, 0x0c, 
-0xbb, 0xff, 0x94, 0xe2, 0x6f, 0xdc, 0x10, 0xfb, 0xc3, 0x15, 0xbd, 0x1a, 0xf1, 0x1d, 0x89, 0x21, 
-0x3c, 0x1f, 0x57, 0x1b, 0x55, 0x14, 0xff, 0x10, 0xf2, 0x19, 0x68, 0x18, 0x04, 0x00, 0x02, 0xf0, 
-0x57, 0xf5, 0x09, 0xfa, 0x70, 0xfc, 0x4f, 0x08, 0xe8, 0x13, 0xee, 0x15, 0xd3, 0x14, 0x40, 0x12, 
-0x92, 0x0c, 0x68, 0x08, 0x3c, 0x03, 0xe0, 0xf8, 0x1d, 0xf4, 0xf9, 0xf6, 0x2e, 0xf1, 0x7f, 0xe7, 
-0x5a, 0xed, 0x40, 0xfa, 0xc5, 0x00, 0xe4, 0x08, 0x26, 0x0f, 0x39, 0x07, 0x86, 0xfd, 0x19, 0xfe, 
-0xbd, 0xfc, 0x0b, 0xf3, 0x40, 0xe7, 0x9c, 0xd8, 0xe7, 0xcc, 0xa5, 0xd2, 0x52, 0xe0, 0x82, 0xe1, 
-0x35, 0xdd, 0x6c, 0xdb, 0xb0, 0xd4, 0xd3, 0xdc, 0x8e, 0x07, 0x75, 0x2d, 0xaf, 0x2a, 0xb6, 0x17, 
-0x88, 0x0c, 0x24, 0x0a, 0xc5, 0x14, 0x48, 0x1d, 0x2e, 0x11, 0xb6, 0x02, 0xc5, 0xfa, 0xce, 0xe8, 
-0x0d, 0xde, 0x58, 0xf4, 0x7a, 0x12, 0x03, 0x19, 0x9b, 0x10, 0xf2, 0x0a, 0x82, 0x0e, 0xa7, 0x1a, 
-0xf0, 0x22, 0x23, 0x20, 0xa5, 0x1d, 0x09, 0x1c, 0x1a, 0x0d, 0xd6, 0xf7, 0xf3, 0xee, 0xfb, 0xf2, 
-0x71, 0xfe, 0x0d, 0x0a, 0x14, 0x09, 0xfb, 0x01, 0xe9, 0x03, 0x7a, 0x09, 0x5f, 0x10, 0x5e, 0x1b, 
-0x64, 0x18, 0xc6, 0x04, 0x14, 0xf9, 0xe9, 0xf3, 0xaa, 0xe8, 0x54, 0xe6, 0x56, 0xf2, 0xb2, 0xfc, 
-0x44, 0x02, 0xcc, 0x02, 0x8e, 0xfa, 0xd2, 0xf8, 0x39, 0x07, 0x93, 0x0d, 0xaa, 0xfc, 0x5d, 0xeb, 
-0x33, 0xe8, 0xf9, 0xe2, 0x4b, 0xd8, 0xd5, 0xd7, 0x3b, 0xde, 0x5a, 0xdd, 0xdb, 0xd3, 0x80, 0xc7, 
-0xf6, 0xcb, 0xf0, 0xf3, 0x98, 0x22, 0xbc, 0x2b, 0x42, 0x1a, 0x5c, 0x12, 0x9c, 0x15, 0x89, 0x15, 
-0x34, 0x12, 0x89, 0x0e, 0x6c, 0x07, 0x2f, 0xfb, 0x45, 0xea, 0x65, 0xdc, 0x39, 0xe5, 0x62, 0x05, 
-0x35, 0x1b, 0x9c, 0x18, 0x46, 0x15, 0x38, 0x19, 0x2e, 0x1c, 0x79, 0x21, 0xc9, 0x22, 0x90, 0x1a, 
-0x35, 0x18, 0xc4, 0x15, 0x5b, 0x00, 0xd5, 0xec, 0xfb, 0xf1, 0x44, 0x01, 0xc0, 0x0a, 0xbd, 0x07, 
-0x0c, 0xf9, 0x9d, 0xf7, 0xaa, 0x0f, 0x6b, 0x22, 0x01, 0x1b, 0x77, 0x0b, 0xf2, 0x02, 0x0a, 0xfd, 
-0x24, 0xf7, 0xcf, 0xf2, 0x7b, 0xf0, 0x9c, 0xf3, 0x93, 0xf9, 0x3f, 0xf8, 0x24, 0xf4, 0xb2, 0xf8, 
-0x5a, 0x01, 0xf5, 0x09, 0xa7, 0x10, 0x71, 0x06, 0x4a, 0xee, 0x37, 0xe0, 0xb1, 0xdb, 0xf1, 0xd6, 
-0xa0, 0xd7, 0x1e, 0xda, 0xa3, 0xdb, 0xf9, 0xde, 0x56, 0xd3, 0x3b, 0xc3, 0xa2, 0xe0, 0x94, 0x1f, 
-0x4f, 0x3a, 0x22, 0x25, 0x95, 0x0c, 0x68, 0x0a, 0x1f, 0x19, 0x03, 0x20, 0xf2, 0x0d, 0x4f, 0xfa, 
-0xca, 0xfc, 0xc8, 0xfa, 0xba, 0xe0, 0x8c, 0xd8, 0x26, 0xfc, 0x17, 0x1e, 0xb1, 0x1c, 0xa2, 0x0f, 
-0xd9, 0x0d, 0x95, 0x1a, 0x3e, 0x2e, 0xd3, 0x2f, 0x82, 0x1d, 0xd1, 0x14, 0xd0, 0x12, 0x3c, 0x03, 
-0xdc, 0xf5, 0xe3, 0xf8, 0xfa, 0xfe, 0x26, 0x00, 0x6c, 0xfc, 0x64, 0xf6, 0xb9, 0xf8, 0xab, 0x04, 
-0xf8, 0x0e, 0x46, 0x12, 0xf8, 0x0f, 0xed, 0x0a, 0x8a, 0x05, 0xe1, 0xfe, 0x94, 0xf6, 0x05, 0xf1, 
-0x71, 0xf5, 0x16, 0x02, 0xe7, 0x06, 0xf8, 0xfd, 0x63, 0xf4, 0xd3, 0xf1, 0x5e, 0xf6, 0xf7, 0xfc, 
-0xf9, 0xf6, 0x20, 0xe9, 0x7a, 0xe8, 0xa1, 0xed, 0x03, 0xe9, 0x3a, 0xe2, 0x26, 0xde, 0x77, 0xdc, 
-0x6d, 0xdd, 0x7c, 0xd5, 0xfb, 0xcd, 0xe7, 0xe6, 0x43, 0x15, 0x65, 0x2d, 0xf2, 0x23, 0x30, 0x0d, 
-0x0d, 0x03, 0x01, 0x10, 0x12, 0x1c, 0x81, 0x11, 0x1c, 0x03, 0x9c, 0x00, 0x20, 0xf7, 0xf4, 0xe4, 
-0x75, 0xea, 0x3c, 0x0a, 0x63, 0x20, 0x11, 0x1f, 0x2d, 0x11, 0xfe, 0x03, 0xc4, 0x0c, 0x63, 0x22, 
-0xb8, 0x1c, 0xa3, 0x09, 0xe8, 0x0e, 0x6a, 0x13, 0xfc, 0x03, 0xd0, 0xfd, 0x5a, 0x00, 0xc3, 0xfd, 
-0x26, 0x04, 0x53, 0x0a, 0xcd, 0x00, 0x16, 0xfe, 0x6d, 0x08, 0x7b, 0x0b, 0x02, 0x0a, 0x04, 0x09, 
-0x28, 0xff, 0x63, 0xf6, 0x01, 0xfc, 0x21, 0x01, 0x4e, 0xf9, 0x6d, 0xf1, 0x33, 0xf3, 0xcc, 0xfa, 
-0xed, 0x04, 0x80, 0x07, 0xed, 0xfb, 0x1e, 0xf4, 0xf9, 0xf6, 0xc3, 0xf3, 0xcf, 0xef, 0x03, 0xf2, 
-0xe8, 0xe7, 0x2a, 0xdb, 0x0c, 0xe2, 0xc7, 0xe7, 0xba, 0xdf, 0x0c, 0xda, 0x0b, 0xd5, 0x37, 0xda, 
-0xb6, 0xff, 0x1b, 0x28, 0x65, 0x2c, 0xc8, 0x1c, 0x31, 0x12, 0x09, 0x0e, 0x29, 0x11, 0xee, 0x16, 
-0xed, 0x11, 0x5f, 0x02, 0x9a, 0xf4, 0xe4, 0xe9, 0xda, 0xde, 0xff, 0xe2, 0x3c, 0x00, 0x21, 0x1c, 
-0x76, 0x20, 0x85, 0x19, 0xc6, 0x14, 0x45, 0x15, 0x97, 0x1b, 0x47, 0x1f, 0xf7, 0x1c, 0x1d, 0x19, 
-0x45, 0x0c, 0x7b, 0xf3, 0x17, 0xe1, 0x47, 0xe7, 0x82, 0x01, 0xc5, 0x11, 0xe8, 0x05, 0xb2, 0xf8, 
-0xae, 0x02, 0x22, 0x14, 0xf6, 0x1a, 0x64, 0x15, 0xf6, 0x09, 0x93, 0x05, 0x48, 0x03, 0x33, 0xf4, 
-0x08, 0xe6, 0x24, 0xea, 0xc2, 0xf5, 0xd7, 0xf9, 0x49, 0xf3, 0x61, 0xec, 0x0d, 0xf5, 0x59, 0x05, 
-0x5a, 0x07, 0xc2, 0xfd, 0x59, 0xf8, 0x14, 0xf7, 0xe2, 0xf0, 0x2c, 0xe7, 0x7a, 0xe4, 0xb1, 0xe7, 
-0x10, 0xe4, 0xdb, 0xd4, 0x1e, 0xc3, 0xc3, 0xc9, 0xa1, 0xf9, 0x33, 0x28, 0x90, 0x27, 0x65, 0x14, 
-0x95, 0x12, 0xdf, 0x15, 0x20, 0x18, 0x05, 0x1b, 0xb4, 0x13, 0xd3, 0x0a, 0xea, 0x04, 0x94, 0xec, 
-0xab, 0xd1, 0xd3, 0xdf, 0x8f, 0x06, 0x94, 0x11, 0x1b, 0x03, 0x9b, 0x02, 0x45, 0x14, 0x25, 0x22, 
-0x74, 0x25, 0x49, 0x1f, 0x45, 0x18, 0x77, 0x1e, 0x12, 0x1d, 0x6c, 0xfd, 0x54, 0xe6, 0x04, 0xf5, 
-0x43, 0x05, 0x16, 0x03, 0xd6, 0x00, 0x3c, 0x02, 0x35, 0x06, 0xfc, 0x0d, 0x2c, 0x0f, 0xd0, 0x0b, 
-0x8e, 0x0d, 0xd4, 0x0a, 0x72, 0xfc, 0x7c, 0xee, 0x7c, 0xec, 0x6d, 0xf2, 0x0d, 0xf3, 0x53, 0xed, 
-0x61, 0xec, 0x98, 0xf2, 0x0e, 0xfd, 0x56, 0x06, 0x17, 0x02, 0xe7, 0xf4, 0x31, 0xf3, 0xb9, 0xfc, 
-0xa8, 0xff, 0xaa, 0xf2, 0x1c, 0xde, 0x43, 0xd5, 0xed, 0xd8, 0x41, 0xd5, 0x4a, 0xcb, 0x4f, 0xd4, 
-0x71, 0xfa, 0x35, 0x23, 0xf8, 0x27, 0xc5, 0x10, 0x22, 0x0c, 0x9b, 0x1d, 0xe6, 0x23, 0xc6, 0x1a, 
-0x0a, 0x0f, 0x54, 0x05, 0x82, 0xfd, 0xec, 0xec, 0x6b, 0xda, 0xe4, 0xe5, 0x43, 0x08, 0x1c, 0x17, 
-0xef, 0x0d, 0x20, 0x08, 0xf6, 0x0e, 0x8c, 0x18, 0xf9, 0x1d, 0x90, 0x21, 0x92, 0x22, 0xcd, 0x1a, 
-0xaf, 0x0b, 0x39, 0xfb, 0x86, 0xf0, 0xb6, 0xf4, 0xa5, 0x02, 0xa6, 0x0c, 0x8b, 0x0f, 0xfe, 0x07, 
-0xff, 0xf8, 0xfd, 0xf6, 0x71, 0x07, 0x56, 0x18, 0x16, 0x1a, 0x36, 0x09, 0x1b, 0xf6, 0xee, 0xf0, 
-0xf8, 0xed, 0x84, 0xeb, 0xb8, 0xf8, 0xe0, 0x02, 0x52, 0xf7, 0x32, 0xed, 0x08, 0xef, 0x72, 0xf0, 
-0x6e, 0xf6, 0x4e, 0x00, 0x19, 0xfd, 0xc2, 0xf0, 0x1e, 0xe9, 0x8d, 0xe1, 0xb6, 0xda, 0x8e, 0xe1, 
-0x7a, 0xe6, 0xe8, 0xd2, 0x08, 0xcb, 0x28, 0xf3, 0xc2, 0x1b, 0x03, 0x1a, 0xaf, 0x0e, 0x48, 0x10, 
-0xb3, 0x15, 0xa7, 0x21, 0xc7, 0x23, 0xbc, 0x0d, 0x9d, 0x02, 0x0e, 0x0b, 0xc4, 0xfd, 0x5f, 0xe2, 
-0x4c, 0xe7, 0x0d, 0x06, 0xae, 0x17, 0xe3, 0x15, 0x1c, 0x0f, 0xcc, 0x08, 0xf1, 0x0a, 0x5a, 0x1b, 
-0xd1, 0x25, 0x70, 0x1c, 0x63, 0x12, 0x25, 0x0d, 0x4e, 0x01, 0xc3, 0xfb, 0x51, 0x02, 0x37, 0x02, 
-0x2f, 0xfc, 0xc9, 0xfa, 0xd8, 0xfa, 0xe2, 0xff, 0xc6, 0x0b, 0xdc, 0x12, 0xad, 0x10, 0xeb, 0x08, 
-0x93, 0x01, 0x01, 0x00, 0x48, 0xfc, 0x0f, 0xf2, 0xe3, 0xec, 0x37, 0xed, 0x26, 0xeb, 0xe5, 0xeb, 
-0x71, 0xf3, 0xc4, 0xf9, 0x23, 0xf7, 0xcd, 0xf0, 0x81, 0xf3, 0xba, 0xf9, 0xf9, 0xf3, 0xe5, 0xe7, 
-0x53, 0xe0, 0xec, 0xde, 0x9f, 0xe3, 0xdb, 0xde, 0xcd, 0xce, 0xd3, 0xdb, 0x85, 0x0b, 0xc2, 0x28, 
-0xbc, 0x21, 0x9f, 0x13, 0x72, 0x0e, 0x33, 0x13, 0xbb, 0x1a, 0xc6, 0x17, 0x9f, 0x0d, 0x1b, 0x06, 
-0x72, 0xfb, 0x13, 0xea, 0x11, 0xe2, 0xb6, 0xf1, 0xeb, 0x09, 0x36, 0x13, 0xff, 0x11, 0xfa, 0x12, 
-0x03, 0x16, 0x4e, 0x1d, 0x80, 0x25, 0x88, 0x24, 0x59, 0x1e, 0xbd, 0x14, 0x83, 0x04, 0xc8, 0xf9, 
-0xc7, 0xf7, 0xbe, 0xf5, 0xed, 0xf8, 0x00, 0xfe, 0x1a, 0xfa, 0x5b, 0xfa, 0xb6, 0x05, 0xbd, 0x0d, 
-0x6c, 0x10, 0xd8, 0x0e, 0xff, 0x03, 0x07, 0xfc, 0x5f, 0xff, 0xfd, 0xfc, 0xb0, 0xf0, 0xef, 0xed, 
-0x45, 0xf3, 0x89, 0xee, 0x82, 0xe9, 0x93, 0xf1, 0xcd, 0xf4, 0x9c, 0xed, 0x76, 0xed, 0x97, 0xf1, 
-0x0f, 0xf6, 0x95, 0xfe, 0xf2, 0xf5, 0xd5, 0xdc, 0x53, 0xda, 0x29, 0xe6, 0xba, 0xde, 0x63, 0xdb, 
-0x4f, 0xf3, 0x0b, 0x0c, 0xa8, 0x14, 0x32, 0x14, 0xaf, 0x10, 0x11, 0x15, 0xbe, 0x1e, 0x0d, 0x17, 
-0xce, 0x04, 0x93, 0x06, 0x7b, 0x11, 0xd4, 0x03, 0x19, 0xeb, 0xa6, 0xeb, 0x8d, 0x01, 0xb6, 0x13, 
-0x2c, 0x19, 0x6f, 0x11, 0x96, 0x07, 0x12, 0x0e, 0x82, 0x1b, 0x6e, 0x1c, 0x1a, 0x1a, 0xd3, 0x19, 
-0x8d, 0x0e, 0x3d, 0x01, 0xdb, 0xff, 0xf8, 0xff, 0x97, 0xfe, 0xf6, 0x02, 0x8b, 0x06, 0x03, 0x05, 
-0x6a, 0x01, 0x5d, 0xff, 0x5c, 0x07, 0x4d, 0x11, 0x43, 0x0b, 0xae, 0xfe, 0x94, 0xf6, 0x98, 0xee, 
-0xfa, 0xef, 0x37, 0xf8, 0x28, 0xf2, 0xeb, 0xe8, 0xfe, 0xed, 0x5b, 0xf1, 0x01, 0xee, 0x5b, 0xf3, 
-0xc3, 0xfa, 0x2f, 0xf3, 0xeb, 0xe5, 0x8e, 0xe5, 0x55, 0xe8, 0x47, 0xe1, 0xbb, 0xdd, 0x68, 0xd9, 
-0x13, 0xcb, 0x36, 0xdb, 0x38, 0x11, 0x38, 0x2b, 0xb7, 0x1b, 0xfd, 0x0e, 0x9f, 0x0c, 0x41, 0x13, 
-0xab, 0x25, 0x65, 0x26, 0x53, 0x0d, 0xaf, 0xfe, 0xd6, 0x02, 0x17, 0xfb, 0x72, 0xe4, 0xa6, 0xe5, 
-0xd5, 0x06, 0xae, 0x1b, 0xb1, 0x13, 0xbb, 0x09, 0x04, 0x0a, 0x29, 0x15, 0x5b, 0x26, 0x77, 0x28, 
-0x5a, 0x1b, 0xaf, 0x14, 0x98, 0x13, 0x57, 0x07, 0xf2, 0xf1, 0xfb, 0xee, 0x5f, 0x04, 0xc7, 0x09, 
-0xf8, 0xf9, 0x7f, 0xfc, 0x82, 0x06, 0x77, 0x02, 0x8e, 0x08, 0x99, 0x12, 0x22, 0x0b, 0x43, 0x07, 
-0xfd, 0x05, 0xec, 0xf2, 0x4d, 0xe6, 0x73, 0xef, 0x77, 0xf1, 0x59, 0xe4, 0x29, 0xe2, 0xcd, 0xed, 
-0x0b, 0xf0, 0x6a, 0xed, 0x70, 0xf4, 0x59, 0xf2, 0x1d, 0xea, 0x1d, 0xf5, 0x13, 0xf9, 0x1d, 0xe5, 
-0x69, 0xd9, 0x96, 0xd2, 0x9d, 0xce, 0xd9, 0xef, 0xb0, 0x19, 0x73, 0x1c, 0x33, 0x11, 0xe8, 0x0a, 
-0x57, 0x03, 0x35, 0x0d, 0x4e, 0x21, 0xb4, 0x20, 0x7d, 0x13, 0xe6, 0x07, 0x45, 0xf6, 0xab, 0xe6, 
-0xe2, 0xee, 0x3c, 0x0b, 0x99, 0x1e, 0x0c, 0x1a, 0xef, 0x08, 0x37, 0xfd, 0x41, 0x08, 0x9e, 0x22, 
-0xb3, 0x29, 0xba, 0x1e, 0x50, 0x1a, 0x9f, 0x0f, 0xd2, 0xfb, 0x28, 0xf8, 0x83, 0xfe, 0x49, 0x04, 
-0xcb, 0x0c, 0xaa, 0x04, 0x58, 0xf1, 0xc5, 0xf7, 0x47, 0x0b, 0x17, 0x0f, 0x02, 0x0f, 0xbc, 0x0b, 
-0x61, 0xfa, 0xfd, 0xf0, 0xc1, 0xfc, 0x44, 0x04, 0x1d, 0xf9, 0xc6, 0xea, 0x51, 0xe3, 0x8b, 0xe1, 
-0x38, 0xe9, 0xd9, 0xf2, 0xaa, 0xf0, 0x2f, 0xf0, 0xfb, 0xf8, 0x07, 0xf4, 0x62, 0xe7, 0x08, 0xec, 
-0x77, 0xf1, 0xbb, 0xe7, 0xae, 0xdb, 0xb2, 0xd2, 0x4c, 0xda, 0x3f, 0xfe, 0x2a, 0x1c, 0x8b, 0x18, 
-0x25, 0x0b, 0x19, 0x0b, 0x25, 0x16, 0x90, 0x1f, 0x40, 0x1a, 0xbd, 0x0c, 0x64, 0x07, 0x3d, 0x06, 
-0x52, 0xfb, 0x3f, 0xea, 0x39, 0xea, 0xdc, 0x03, 0x0d, 0x19, 0xa0, 0x11, 0x8c, 0x00, 0x3f, 0xff, 
-0x7e, 0x0e, 0xc8, 0x1f, 0x06, 0x27, 0x48, 0x25, 0x9a, 0x1d, 0x59, 0x11, 0xfb, 0x07, 0xda, 0x00, 
-0xcf, 0xfb, 0x2d, 0x03, 0x25, 0x08, 0xea, 0xf8, 0x37, 0xef, 0x90, 0xfa, 0x1f, 0x06, 0x1a, 0x0c, 
-0xbf, 0x0d, 0xe1, 0x03, 0x97, 0xfa, 0xd9, 0xfd, 0x46, 0x01, 0xed, 0xfb, 0xc5, 0xf5, 0x84, 0xf3, 
-0x1a, 0xee, 0x8a, 0xe7, 0x64, 0xed, 0x1e, 0xf8, 0x71, 0xf6, 0xc4, 0xed, 0x46, 0xe7, 0x30, 0xe8, 
-0xe8, 0xf2, 0xd9, 0xf4, 0xe9, 0xe6, 0xd5, 0xda, 0x5f, 0xd2, 0x1c, 0xd6, 0x6f, 0xf6, 0x24, 0x14, 
-0x01, 0x14, 0x80, 0x0c, 0x9f, 0x07, 0xd5, 0x06, 0x97, 0x19, 0xd9, 0x2b, 0x15, 0x21, 0xb8, 0x0c, 
-0xb3, 0x02, 0x14, 0xf8, 0xf7, 0xec, 0x0e, 0xf1, 0x07, 0xff, 0xdb, 0x04, 0xc6, 0x04, 0xdb, 0x04, 
-0xb4, 0x01, 0x49, 0x07, 0xf5, 0x1a, 0xa7, 0x26, 0xfd, 0x24, 0x1e, 0x20, 0xb9, 0x14, 0x4a, 0x08, 
-0x43, 0x03, 0x2b, 0x00, 0xc7, 0x01, 0x7a, 0x07, 0x30, 0x03, 0xb2, 0xf8, 0x7d, 0xf7, 0x64, 0x00, 
-0xfd, 0x08, 0xea, 0x09, 0x9b, 0x07, 0xa2, 0x05, 0x2e, 0x03, 0xde, 0x05, 0xfb, 0x05, 0x9f, 0xf8, 
-0xd1, 0xed, 0x6b, 0xeb, 0xf5, 0xe6, 0x7e, 0xe8, 0x95, 0xed, 0x4b, 0xea, 0xd9, 0xe8, 0xbb, 0xeb, 
-0xf7, 0xed, 0xa9, 0xf1, 0x13, 0xee, 0xad, 0xe9, 0xf3, 0xeb, 0x47, 0xe0, 0x03, 0xdc, 0x35, 0x00, 
-0xac, 0x1d, 0x31, 0x12, 0xc8, 0xff, 0xa2, 0xf8, 0x7a, 0x03, 0x8f, 0x1f, 0xcb, 0x24, 0x1b, 0x0c, 
-0xb5, 0xff, 0x1e, 0x04, 0xb4, 0xfe, 0xbb, 0xf0, 0x46, 0xf2, 0xeb, 0x06, 0xa6, 0x11, 0x31, 0x07, 
-0xbb, 0xfd, 0x7d, 0x00, 0xb5, 0x0d, 0x9c, 0x1d, 0x9c, 0x1f, 0xaf, 0x18, 0xe0, 0x15, 0xf3, 0x10, 
-0x88, 0x0c, 0x85, 0x0b, 0xfd, 0x02, 0xa4, 0xfa, 0x98, 0xfb, 0x39, 0xfd, 0x63, 0x00, 0xfa, 0x03, 
-0xab, 0x00, 0x34, 0x01, 0xd3, 0x0a, 0xa9, 0x0e, 0x71, 0x06, 0xa4, 0xfc, 0x58, 0xfc, 0xcb, 0x00, 
-0x5a, 0xfd, 0x43, 0xf3, 0x95, 0xea, 0x81, 0xe9, 0xc6, 0xef, 0x24, 0xef, 0x2a, 0xe9, 0xd6, 0xee, 
-0xaf, 0xf5, 0x23, 0xf2, 0xf8, 0xed, 0xf6, 0xe8, 0x93, 0xe6, 0x2c, 0xea, 0x90, 0xe4, 0x5b, 0xe6, 
-0x34, 0x04, 0x7a, 0x14, 0x81, 0x01, 0x9e, 0xf4, 0x3e, 0x00, 0xeb, 0x14, 0x88, 0x21, 0x21, 0x17, 
-0xaa, 0x05, 0xa0, 0x06, 0x8c, 0x0b, 0xff, 0x02, 0xc3, 0xf9, 0xd7, 0xfa, 0xd6, 0x00, 0x72, 0x02, 
-0x94, 0xfe, 0x99, 0xfe, 0xbf, 0x06, 0x49, 0x10, 0x03, 0x15, 0xd3, 0x15, 0x3f, 0x17, 0x6d, 0x17, 
-0xda, 0x11, 0xcf, 0x0b, 0x78, 0x09, 0xde, 0x06, 0xf2, 0x04, 0x21, 0x04, 0xe1, 0xff, 0x49, 0xfe, 
-0x48, 0x04, 0xe2, 0x03, 0x2e, 0xf9, 0x20, 0xf8, 0x20, 0x04, 0xc6, 0x09, 0x87, 0x05, 0x73, 0x00, 
-0xb0, 0xfb, 0xf6, 0xf8, 0x33, 0xf6, 0x8a, 0xee, 0xb8, 0xec, 0x3e, 0xf4, 0xaf, 0xf4, 0xec, 0xed, 
-0x78, 0xeb, 0x38, 0xeb, 0x66, 0xec, 0xba, 0xef, 0x84, 0xee, 0x0d, 0xe8, 0x1c, 0xe2, 0x17, 0xe7, 
-0xab, 0xfd, 0x0b, 0x11, 0xbf, 0x0b, 0xca, 0xfd, 0x01, 0xfd, 0x0d, 0x08, 0xe5, 0x12, 0xd6, 0x11, 
-0xf6, 0x09, 0x0c, 0x0b, 0x16, 0x0d, 0xb5, 0x01, 0x4b, 0xf8, 0x13, 0x00, 0xb2, 0x0a, 0x63, 0x0a, 
-0x23, 0x05, 0x79, 0x00, 0xfb, 0xfd, 0x5c, 0x04, 0x7b, 0x10, 0x52, 0x15, 0xf2, 0x13, 0x1a, 0x12, 
-0x8d, 0x0b, 0x15, 0x05, 0x39, 0x08, 0xb6, 0x0d, 0x05, 0x0d, 0x1a, 0x09, 0x67, 0x04, 0xbe, 0x01, 
-0x09, 0x05, 0x5f, 0x08, 0x0d, 0x04, 0x87, 0xfd, 0x90, 0xfc, 0xb9, 0xfd, 0x50, 0xfd, 0x3d, 0xfd, 
-0x57, 0xfa, 0xc8, 0xf2, 0x58, 0xee, 0xc1, 0xef, 0x1d, 0xf2, 0x2b, 0xf3, 0x32, 0xf0, 0xd6, 0xea, 
-0xb2, 0xec, 0xc2, 0xf3, 0x6f, 0xf3, 0x56, 0xed, 0x07, 0xeb, 0x60, 0xe9, 0x13, 0xe5, 0xac, 0xea, 
-0xe3, 0xff, 0xbd, 0x10, 0x7c, 0x0d, 0xb2, 0x02, 0x92, 0x00, 0x1e, 0x07, 0x5e, 0x10, 0x04, 0x16, 
-0x6b, 0x12, 0x5f, 0x08, 0x06, 0x00, 0x39, 0xfb, 0x3e, 0xfa, 0x64, 0x02, 0x39, 0x0d, 0x5b, 0x09, 
-0x2f, 0xfc, 0x96, 0xfa, 0x00, 0x03, 0x5e, 0x0a, 0x60, 0x12, 0x36, 0x18, 0x6e, 0x14, 0xa3, 0x0c, 
-0xbe, 0x08, 0x34, 0x07, 0x40, 0x08, 0x19, 0x0f, 0x19, 0x13, 0x22, 0x09, 0x8b, 0xfb, 0x1b, 0xfa, 
-0x90, 0x00, 0x3f, 0x05, 0x7c, 0x05, 0x0c, 0x01, 0xb2, 0xfc, 0xe1, 0xfa, 0x95, 0xf9, 0x2c, 0xfb, 
-0x68, 0xfc, 0x11, 0xf8, 0xc8, 0xf4, 0x30, 0xf4, 0x99, 0xf1, 0x30, 0xf0, 0xe7, 0xef, 0x4f, 0xef, 
-0x04, 0xf1, 0xc1, 0xf0, 0xa0, 0xed, 0x67, 0xec, 0xf7, 0xeb, 0x10, 0xed, 0x6f, 0xee, 0xf3, 0xf1, 
-0x08, 0x04, 0x6e, 0x14, 0xcf, 0x09, 0xfc, 0xfc, 0x4d, 0x03, 0x14, 0x0b, 0xd7, 0x11, 0xd1, 0x15, 
-0x9c, 0x08, 0xe9, 0xfa, 0x79, 0xfc, 0xa7, 0xfe, 0x7b, 0xff, 0xa0, 0x06, 0xbf, 0x0c, 0xfb, 0x0a, 
-0x79, 0x04, 0x10, 0x02, 0x3e, 0x06, 0xde, 0x0a, 0x32, 0x0f, 0xa4, 0x0f, 0x75, 0x09, 0x4b, 0x09, 
-0x0e, 0x0d, 0x88, 0x06, 0xe8, 0x00, 0xae, 0x05, 0x9c, 0x09, 0x99, 0x08, 0xa8, 0x04, 0xc4, 0x01, 
-0x18, 0x05, 0xd5, 0x06, 0x36, 0x02, 0xe8, 0xfe, 0xd9, 0xfe, 0x99, 0xff, 0xa8, 0xfc, 0x89, 0xf4, 
-0xc6, 0xf1, 0xf2, 0xf5, 0x32, 0xf8, 0x62, 0xf7, 0x6b, 0xf2, 0xff, 0xee, 0xd2, 0xf4, 0xb9, 0xf6, 
-0x85, 0xef, 0x55, 0xeb, 0x79, 0xeb, 0x8c, 0xf1, 0x32, 0xf7, 0x97, 0xed, 0xcc, 0xe8, 0xcf, 0xf9, 
-0x0a, 0x09, 0x1b, 0x0d, 0x2f, 0x0b, 0x22, 0x05, 0xec, 0x0a, 0xd4, 0x13, 0x0d, 0x0b, 0x1f, 0x06, 
-0x8a, 0x0c, 0xa5, 0x07, 0xa1, 0xfd, 0xc7, 0xf7, 0xd4, 0xf4, 0x8e, 0xfe, 0x9b, 0x09, 0xfc, 0x05, 
-0x4f, 0x02, 0xa4, 0x06, 0x8f, 0x0c, 0x4d, 0x11, 0xf8, 0x0f, 0x36, 0x0d, 0x53, 0x0f, 0xd2, 0x0e, 
-0x94, 0x0a, 0xf9, 0x04, 0xed, 0xfe, 0x8f, 0x01, 0x6d, 0x06, 0x53, 0x00, 0x12, 0xfb, 0x4a, 0xfe, 
-0x37, 0x01, 0x47, 0x03, 0xd5, 0x02, 0x4e, 0xfd, 0xcc, 0xfa, 0xc2, 0xfc, 0x0d, 0xfc, 0x56, 0xf8, 
-0x17, 0xf6, 0xaa, 0xf5, 0x02, 0xf3, 0x47, 0xf0, 0x65, 0xf1, 0xc1, 0xf0, 0x0f, 0xf0, 0x44, 0xf5, 
-0x37, 0xf6, 0xb6, 0xf0, 0x81, 0xf0, 0x45, 0xf3, 0xb7, 0xf4, 0x46, 0xf9, 0xda, 0x00, 0xcf, 0x08, 
-0x1d, 0x0a, 0xd2, 0x02, 0x2a, 0x01, 0x77, 0x07, 0xc0, 0x0c, 0x1d, 0x12, 0x73, 0x10, 0xb5, 0x05, 
-0x50, 0x03, 0xf2, 0x04, 0x57, 0xff, 0x53, 0x01, 0xae, 0x09, 0xf6, 0x06, 0xd3, 0xff, 0xc2, 0xfe, 
-0x4a, 0x03, 0x0c, 0x0c, 0xb8, 0x10, 0x01, 0x0e, 0xa6, 0x0a, 0xc6, 0x07, 0xd3, 0x07, 0x17, 0x0b, 
-0xc1, 0x07, 0x22, 0x01, 0x95, 0x00, 0xd2, 0xfe, 0xfc, 0xfa, 0xb3, 0xfd, 0xc5, 0x00, 0x7e, 0xff, 
-0x8e, 0x00, 0x61, 0x01, 0xee, 0xfd, 0x18, 0xfc, 0x14, 0xfc, 0xdf, 0xf9, 0x26, 0xf8, 0x0f, 0xf8, 
-0xc4, 0xf6, 0x89, 0xf3, 0x38, 0xef, 0x1e, 0xed, 0x39, 0xef, 0xbb, 0xf1, 0xfb, 0xf2, 0xab, 0xf3, 
-0xc5, 0xf1, 0x3b, 0xf0, 0xcc, 0xf4, 0xf3, 0xfd, 0xc3, 0x06, 0x75, 0x09, 0x42, 0x03, 0xfd, 0xfc, 
-0x27, 0x00, 0xfe, 0x09, 0xe4, 0x10, 0x79, 0x0d, 0xb0, 0x04, 0x41, 0x02, 0x46, 0x05, 0xbe, 0x07, 
-0x4b, 0x0a, 0x57, 0x0a, 0x30, 0x06, 0xbd, 0x01, 0xc3, 0xfc, 0x14, 0xfb, 0x28, 0x04, 0x11, 0x0f, 
-0xa7, 0x0e, 0xa0, 0x07, 0x0a, 0x04, 0xa0, 0x05, 0xe4, 0x0a, 0x0e, 0x10, 0x6d, 0x0e, 0x7d, 0x07, 
-0x75, 0x04, 0xb0, 0x03, 0x1f, 0xff, 0x16, 0xfd, 0xa6, 0xff, 0x0b, 0x00, 0x14, 0xff, 0x0f, 0xfc, 
-0x32, 0xf7, 0x0e, 0xfa, 0x91, 0xfe, 0x45, 0xf9, 0x9a, 0xf4, 0x2a, 0xf5, 0xa4, 0xf4, 0xff, 0xf6, 
-0x48, 0xf7, 0xaf, 0xef, 0x2a, 0xee, 0xd0, 0xf2, 0xdd, 0xef, 0xbc, 0xec, 0xb0, 0xf1, 0xf8, 0xf4, 
-0x01, 0xf4, 0x44, 0xf8, 0x7c, 0x01, 0xd4, 0x05, 0xb0, 0x06, 0x5d, 0x09, 0x26, 0x07, 0x51, 0x04, 
-0xd6, 0x0b, 0x69, 0x0f, 0x56, 0x08, 0x43, 0x07, 0x90, 0x07, 0xe5, 0x00, 0x1e, 0x00, 0x66, 0x02, 
-0x38, 0xff, 0x9e, 0x00, 0xbb, 0x05, 0xa8, 0x05, 0xf0, 0x04, 0x8f, 0x06, 0xfa, 0x08, 0x66, 0x0c, 
-0x9b, 0x0e, 0x5b, 0x0e, 0x1f, 0x0b, 0x88, 0x06, 0x6a, 0x05, 0x54, 0x05, 0xca, 0x03, 0x5e, 0x04, 
-0xb7, 0x03, 0x4d, 0x00, 0x2f, 0xff, 0xeb, 0xfd, 0x9b, 0xfc, 0x58, 0xff, 0xd3, 0xff, 0x27, 0xfb, 
-0xca, 0xf6, 0x43, 0xf4, 0x75, 0xf4, 0xca, 0xf4, 0xf6, 0xf1, 0x44, 0xf2, 0x2d, 0xf5, 0x6f, 0xf3, 
-0xc0, 0xf1, 0x2c, 0xf2, 0x1a, 0xf1, 0xe4, 0xf3, 0xb7, 0xf8, 0x64, 0xf8, 0x02, 0xfb, 0xba, 0x03, 
-0x49, 0x06, 0x70, 0x01, 0xce, 0xfe, 0xab, 0x00, 0xf0, 0x05, 0x36, 0x0d, 0x71, 0x0e, 0xc1, 0x05, 
-0xd2, 0xfe, 0x13, 0x02, 0xe0, 0x07, 0xa5, 0x0a, 0xf2, 0x0a, 0xba, 0x06, 0x86, 0x02, 0x30, 0x04, 
-0x07, 0x05, 0x89, 0x02, 0x27, 0x05, 0xcb, 0x0b, 0xb8, 0x0c, 0x64, 0x06, 0x73, 0x00, 0x16, 0x02, 
-0xbc, 0x09, 0x25, 0x0e, 0x6f, 0x08, 0xaf, 0xfd, 0xb1, 0xfb, 0xb3, 0x03, 0xfc, 0x06, 0xcb, 0x02, 
-0xa7, 0x00, 0x09, 0xfe, 0x5d, 0xf7, 0x11, 0xf5, 0xcc, 0xf8, 0xaf, 0xfb, 0xd2, 0xfb, 0x4e, 0xf7, 
-0x8f, 0xee, 0xf0, 0xeb, 0xd6, 0xf2, 0xf9, 0xf7, 0x48, 0xf6, 0xf1, 0xf3, 0xe0, 0xf2, 0xc3, 0xf0, 
-0x1e, 0xf0, 0xd0, 0xf3, 0x93, 0xf8, 0xff, 0xfb, 0xf6, 0x00, 0x33, 0x05, 0x25, 0x03, 0xa7, 0x00, 
-0x55, 0x04, 0x32, 0x09, 0xed, 0x0c, 0xb8, 0x0e, 0x7f, 0x09, 0xbe, 0x04, 0x41, 0x08, 0x23, 0x09, 
-0xa2, 0x04, 0x30, 0x04, 0xc4, 0x04, 0x3a, 0x03, 0x2d, 0x03, 0x78, 0x02, 0x3d, 0x03, 0x0f, 0x08, 
-0x76, 0x08, 0x3f, 0x04, 0x77, 0x04, 0x00, 0x08, 0xf5, 0x08, 0xd2, 0x05, 0x9f, 0x02, 0xd8, 0x04, 
-0x50, 0x07, 0x8e, 0x03, 0x88, 0xff, 0x36, 0xff, 0x62, 0xff, 0x6b, 0xfe, 0xcc, 0xfa, 0x29, 0xf7, 
-0x80, 0xf8, 0xa9, 0xfa, 0x16, 0xf9, 0x52, 0xf7, 0x43, 0xf7, 0xda, 0xf6, 0x40, 0xf5, 0x55, 0xf4, 
-0x70, 0xf5, 0x4d, 0xf5, 0x91, 0xf2, 0x46, 0xf1, 0x7d, 0xf2, 0xaf, 0xf4, 0x53, 0xf7, 0x7b, 0xfa, 
-0xeb, 0xff, 0xf1, 0x04, 0x47, 0x04, 0xdf, 0x01, 0xf5, 0x02, 0xa1, 0x06, 0xb0, 0x0b, 0x74, 0x0d, 
-0x1d, 0x09, 0x45, 0x05, 0xb5, 0x04, 0xe7, 0x04, 0x91, 0x05, 0x95, 0x04, 0xb1, 0x02, 0x51, 0x02, 
-0x80, 0x00, 0x72, 0xff, 0x6f, 0x02, 0x91, 0x04, 0x3b, 0x06, 0x5f, 0x08, 0x22, 0x06, 0x95, 0x04, 
-0x75, 0x07, 0x52, 0x07, 0x49, 0x05, 0x8b, 0x05, 0x29, 0x05, 0x1a, 0x05, 0xfa, 0x04, 0xce, 0x01, 
-0xec, 0xfe, 0xe6, 0xfc, 0xe8, 0xfa, 0xda, 0xfb, 0xf9, 0xfb, 0x2e, 0xf9, 0x75, 0xf8, 0x07, 0xf7, 
-0xf9, 0xf2, 0x78, 0xf3, 0xe8, 0xf7, 0x28, 0xf9, 0x19, 0xf6, 0xbe, 0xf1, 0xe5, 0xf0, 0x9d, 0xf5, 
-0x4f, 0xfa, 0xde, 0xf9, 0x87, 0xf8, 0xea, 0xfd, 0x56, 0x06, 0x3e, 0x06, 0x6b, 0x00, 0xba, 0x01, 
-0x59, 0x09, 0x9f, 0x0d, 0x64, 0x0b, 0xc5, 0x05, 0x6d, 0x03, 0xd9, 0x06, 0xe0, 0x08, 0xfe, 0x04, 
-0x53, 0x00, 0x56, 0xff, 0x8e, 0xff, 0x77, 0xfe, 0x19, 0xff, 0xbb, 0x02, 0x05, 0x05, 0xf0, 0x04, 
-0x6b, 0x04, 0xb5, 0x03, 0x4c, 0x05, 0xb4, 0x08, 0x1b, 0x08, 0x11, 0x05, 0x09, 0x05, 0xaa, 0x05, 
-0x8c, 0x03, 0x85, 0xff, 0xd1, 0xfb, 0x0e, 0xfb, 0xea, 0xfb, 0xec, 0xfa, 0x31, 0xf9, 0x99, 0xf8, 
-0x34, 0xf8, 0x5f, 0xf7, 0xa1, 0xf6, 0xbf, 0xf7, 0x80, 0xfa, 0xc8, 0xfa, 0xef, 0xf7, 0xfc, 0xf5, 
-0xa0, 0xf6, 0x88, 0xf8, 0x6a, 0xf9, 0x19, 0xf9, 0x4e, 0xfb, 0x06, 0x00, 0x18, 0x02, 0x16, 0x01, 
-0x84, 0x00, 0xa6, 0x01, 0x16, 0x05, 0x19, 0x09, 0xf6, 0x08, 0x9a, 0x05, 0x12, 0x05, 0x8f, 0x07, 
-0xb7, 0x08, 0x1e, 0x08, 0x9a, 0x06, 0x87, 0x03, 0x3e, 0x01, 0x9c, 0x01, 0x8c, 0x01, 0xfc, 0x00, 
-0x44, 0x03, 0xd8, 0x04, 0x3f, 0x01, 0x7a, 0xfd, 0xc4, 0xfe, 0xe7, 0x02, 0x8c, 0x06, 0xaf, 0x06, 
-0x98, 0x01, 0x2a, 0xfd, 0x69, 0xff, 0x27, 0x03, 0x52, 0x02, 0x11, 0x00, 0xd4, 0xfe, 0x1e, 0xfc, 
-0xa7, 0xf8, 0x89, 0xf7, 0xf4, 0xf8, 0x53, 0xfb, 0xd3, 0xfb, 0x40, 0xf8, 0x54, 0xf4, 0xac, 0xf5, 
-0x73, 0xfa, 0x9a, 0xfc, 0x10, 0xfb, 0xfe, 0xf8, 0xa0, 0xf8, 0x6e, 0xfa, 0x4e, 0xfd, 0xc9, 0xff, 
-0xe0, 0x01, 0x33, 0x03, 0x95, 0x02, 0xb2, 0x01, 0x88, 0x03, 0x45, 0x07, 0x61, 0x09, 0xab, 0x07, 
-0xa0, 0x03, 0xec, 0x01, 0x5d, 0x04, 0x6d, 0x06, 0xdf, 0x04, 0x9d, 0x02, 0x18, 0x02, 0x03, 0x02, 
-0xee, 0x01, 0xce, 0x02, 0x1c, 0x04, 0x6b, 0x04, 0x00, 0x03, 0xcc, 0x00, 0x5d, 0x00, 0x35, 0x02, 
-0x16, 0x03, 0x41, 0x01, 0x43, 0xff, 0x3f, 0xff, 0xe2, 0xff, 0x5a, 0xff, 0x26, 0xfe, 0x8e, 0xfd, 
-0x07, 0xfd, 0xce, 0xfb, 0x87, 0xfb, 0xd8, 0xfc, 0xca, 0xfc, 0x5f, 0xfa, 0x96, 0xf8, 0x5e, 0xf8, 
-0x99, 0xf8, 0xcf, 0xf9, 0x19, 0xfb, 0xd0, 0xfa, 0x59, 0xfb, 0x5b, 0xfd, 0xf7, 0xfc, 0xe4, 0xfb, 
-0x48, 0xff, 0x18, 0x04, 0xa6, 0x05, 0x9c, 0x05, 0x3d, 0x04, 0xad, 0x01, 0x89, 0x03, 0x9d, 0x08, 
-0x6c, 0x07, 0x97, 0x01, 0x89, 0x00, 0xa3, 0x02, 0x7f, 0x02, 0x2b, 0x02, 0x88, 0x02, 0x6d, 0x02, 
-0xcd, 0x03, 0x2a, 0x04, 0x24, 0x00, 0x00, 0xff, 0x90, 0x04, 0x89, 0x06, 0x99, 0x01, 0x41, 0xff, 
-0x2e, 0x01, 0xc0, 0x01, 0x66, 0x01, 0x4b, 0x01, 0xfb, 0xff, 0xe8, 0xfe, 0xe5, 0xfd, 0x55, 0xfb, 
-0xcd, 0xfb, 0x81, 0x00, 0x84, 0x00, 0x12, 0xfa, 0xe0, 0xf6, 0xc9, 0xf9, 0x13, 0xfd, 0xe2, 0xfd, 
-0xfd, 0xfb, 0x13, 0xf9, 0x7c, 0xf9, 0xc5, 0xfc, 0x7f, 0xfe, 0x56, 0xff, 0x9a, 0x00, 0xa8, 0xff, 
-0x31, 0xfe, 0x4c, 0x00, 0x53, 0x03, 0x07, 0x04, 0xea, 0x03, 0xf4, 0x02, 0x4e, 0x01, 0x60, 0x02, 
-0xcc, 0x04, 0xf7, 0x03, 0xc6, 0x01, 0x70, 0x01, 0x7b, 0x01, 0xd6, 0x01, 0x00, 0x03, 0x2b, 0x02, 
-0x66, 0x00, 0x9f, 0x01, 0xf1, 0x02, 0x14, 0x01, 0x67, 0x00, 0xdc, 0x02, 0xea, 0x03, 0x69, 0x02, 
-0xd3, 0x00, 0xd1, 0xff, 0x00, 0x00, 0xf4, 0x00, 0xdf, 0xff, 0xc2, 0xfd, 0x55, 0xfe, 0xb4, 0xff, 
-0x55, 0xfe, 0x65, 0xfc, 0xa5, 0xfc, 0xf5, 0xfd, 0xe6, 0xfe, 0x9a, 0xfe, 0xb4, 0xfc, 0x82, 0xfb, 
-0x35, 0xfd, 0x1c, 0x00, 0x42, 0x01, 0xa0, 0xff, 0xe1, 0xfc, 0x9b, 0xfc, 0xa6, 0xff, 0x19, 0x02, 
-0xc4, 0x01, 0xf8, 0x00, 0xeb, 0x00, 0xa6, 0x00, 0x75, 0x00, 0x3d, 0x01, 0xbb, 0x02, 0x87, 0x03, 
-0x9e, 0x01, 0x22, 0xfe, 0x11, 0xfe, 0x05, 0x02, 0x32, 0x04, 0x87, 0x02, 0x12, 0x01, 0x89, 0x01, 
-0x19, 0x02, 0x33, 0x02, 0x4e, 0x02, 0x67, 0x02, 0x2d, 0x02, 0xaf, 0x00, 0x5d, 0xfe, 0xfd, 0xfd, 
-0xd5, 0xff, 0x73, 0x00, 0xaa, 0xfe, 0xd5, 0xfc, 0x8d, 0xfc, 0xe1, 0xfd, 0x3e, 0x00, 0xfb, 0x01, 
-0x9f, 0x01, 0x8b, 0xff, 0xd4, 0xfd, 0xb2, 0xfe, 0x3f, 0x01, 0xb7, 0x01, 0x45, 0xff, 0xfc, 0xfc, 
-0x6e, 0xfc, 0x15, 0xfd, 0xb7, 0xfe, 0xf2, 0xff, 0x05, 0xff, 0x29, 0xfd, 0x87, 0xfc, 0xaa, 0xfd, 
-0x8a, 0x00, 0x01, 0x03, 0xa2, 0x01, 0x93, 0xfe, 0x20, 0xff, 0xf1, 0x01, 0xa0, 0x02, 0x0c, 0x02, 
-0xd4, 0x01, 0xd5, 0x00, 0xd1, 0xff, 0xf3, 0xff, 0x1c, 0x00, 0xe7, 0x00, 0xdf, 0x02, 0x86, 0x02, 
-0x62, 0xff, 0x63, 0xfe, 0x5f, 0x00, 0xd4, 0x01, 0x54, 0x02, 0x2d, 0x02, 0x5f, 0x00, 0xfc, 0xfe, 
-0xfa, 0xff, 0xd3, 0x00, 0x88, 0x00, 0x0a, 0x01, 0x07, 0x01, 0xcd, 0xfe, 0x14, 0xfd, 0xb6, 0xfd, 
-0x3b, 0xff, 0xb8, 0x00, 0x00, 0x01, 0xe5, 0xfe, 0x77, 0xfd, 0x89, 0xff, 0xda, 0x01, 0x68, 0x01, 
-0x0e, 0x00, 0x5b, 0xff, 0x4c, 0xff, 0x40, 0x00, 0x10, 0x01, 0x7a, 0x00, 0xeb, 0xff, 0x1f, 0x00, 
-0xd5, 0xff, 0x93, 0xff, 0x85, 0x00, 0x62, 0x01, 0xf1, 0x00, 0x12, 0x00, 0xb1, 0xff, 0x10, 0x00, 
-0x14, 0x01, 0x52, 0x01, 0x02, 0x00, 0x55, 0xff, 0x8d, 0x00, 0x49, 0x01, 0x43, 0x00, 0x55, 0xff, 
-0xb1, 0xff, 0xbe, 0x00, 0x56, 0x01, 0xa8, 0x00, 0xba, 0xff, 0x27, 0x00, 0x26, 0x01, 0x27, 0x01, 
-0x9d, 0x00, 0x90, 0x00, 0xb9, 0x00, 0x58, 0x00, 0xb5, 0xff, 0x99, 0xff, 0xe5, 0xff, 0xf3, 0xff, 
-0xaf, 0xff, 0x48, 0xff, 0x13, 0xff, 0x7f, 0xff, 0x4b, 0x00, 0xbe, 0x00, 0x9f, 0x00, 0x0a, 0x00, 
-0x74, 0xff, 0xab, 0xff, 0x6d, 0x00, 0x7d, 0x00, 0xd2, 0xff, 0x5f, 0xff, 0x6a, 0xff, 0xd9, 0xff, 
-0x84, 0x00, 0xf2, 0x00, 0x00, 0x01, 0xc3, 0x00, 0x3c, 0x00, 0x22, 0x00, 0xb6, 0x00, 0xa9, 0x00, 
-0xc0, 0xff, 0x6c, 0xff, 0xe1, 0xff, 0x1c, 0x00, 0xc4, 0xff, 0x21, 0xff, 0x01, 0xff, 0xe8, 0xff, 
-0xc1, 0x00, 0x54, 0x00, 0xa1, 0xff, 0x20, 0x00, 0xf9, 0x00, 0xce, 0x00, 0x50, 0x00, 0x6f, 0x00, 
-0xc5, 0x00, 0x04, 0x01, 0xd8, 0x00, 0xd0, 0xff, 0x14, 0xff, 0x91, 0xff, 0xe7, 0xff, 0xa1, 0xff, 
-0xdc, 0xff, 0xfe, 0xff, 0x29, 0xff, 0xb2, 0xfe, 0x73, 0xff, 0x5e, 0x00, 0xab, 0x00, 0x4a, 0x00, 
-0x5e, 0xff, 0xf9, 0xfe, 0xf6, 0xff, 0xfa, 0x00, 0x9d, 0x00, 0xdb, 0xff, 0xbc, 0xff, 0xec, 0xff, 
-0x69, 0x00, 0x05, 0x01, 0xe5, 0x00, 0x76, 0x00, 0x7e, 0x00, 0x45, 0x00, 0xc7, 0xff, 0x0e, 0x00, 
-0x83, 0x00, 0x22, 0x00, 0xab, 0xff, 0xa2, 0xff, 0x99, 0xff, 0xe8, 0xff, 0x92, 0x00, 0x7a, 0x00, 
-0xe8, 0xff, 0x10, 0x00, 0x78, 0x00, 0x82, 0x00, 0xca, 0x00, 0xfe, 0x00, 0x5d, 0x00, 0xd2, 0xff, 
-0x18, 0x00, 0x77, 0x00, 0x94, 0x00, 0x6f, 0x00, 0xbc, 0xff, 0x3b, 0xff, 0xce, 0xff, 0x59, 0x00, 
-0xf2, 0xff, 0xb8, 0xff, 0xfa, 0xff, 0xdb, 0xff, 0xaf, 0xff, 0xd1, 0xff, 0xda, 0xff, 0x07, 0x00, 
-0x20, 0x00, 0x90, 0xff, 0x63, 0xff, 0x31, 0x00, 0xb5, 0x00, 0x89, 0x00, 0x3f, 0x00, 0x1d, 0x00, 
-0x6e, 0x00, 0xd0, 0x00, 0xb0, 0x00, 0x91, 0x00, 0x97, 0x00, 0x4c, 0x00, 0x1e, 0x00, 0x54, 0x00, 
-0x74, 0x00, 0x5b, 0x00, 0x29, 0x00, 0xf7, 0xff, 0xf0, 0xff, 0x00, 0x00, 0x03, 0x00, 0xf8, 0xff, 
-0xd6, 0xff, 0xcd, 0xff, 0x14, 0x00, 0x70, 0x00, 0x84, 0x00, 0x36, 0x00, 0xea, 0xff, 0x0b, 0x00, 
-0x64, 0x00, 0x92, 0x00, 0x81, 0x00, 0x3a, 0x00, 0xfd, 0xff, 0x0c, 0x00, 0x21, 0x00, 0x09, 0x00, 
-0x13, 0x00, 0x40, 0x00, 0x0e, 0x00, 0x78, 0xff, 0x3b, 0xff, 0x9a, 0xff, 0xf9, 0xff, 0x05, 0x00, 
-0xeb, 0xff, 0xbb, 0xff, 0x9a, 0xff, 0xc7, 0xff, 0x0a, 0x00, 0x18, 0x00, 0x27, 0x00, 0x4b, 0x00, 
-0x37, 0x00, 0x1a, 0x00, 0x51, 0x00, 0x8a, 0x00, 0x82, 0x00, 0x6b, 0x00, 0x2b, 0x00, 0xe4, 0xff, 
-0x0c, 0x00, 0x3d, 0x00, 0xf8, 0xff, 0xcd, 0xff, 0xfe, 0xff, 0x0b, 0x00, 0xe9, 0xff, 0xe3, 0xff, 
-0xea, 0xff, 0xe0, 0xff, 0xe5, 0xff, 0xfa, 0xff, 0xe4, 0xff, 0xc9, 0xff, 0xf6, 0xff, 0x1e, 0x00, 
-0x11, 0x00, 0x0b, 0x00, 0xf1, 0xff, 0xd6, 0xff, 0x0a, 0x00, 0x2e, 0x00, 0x09, 0x00, 0xf9, 0xff, 
-0xf5, 0xff, 0xe3, 0xff, 0xfe, 0xff, 0x30, 0x00, 0x40, 0x00, 0x13, 0x00, 0xb1, 0xff, 0x90, 0xff, 
-0xd6, 0xff, 0x12, 0x00, 0x1d, 0x00, 0xf8, 0xff, 0x90, 0xff, 0x5a, 0xff, 0x9c, 0xff, 0xde, 0xff, 
-0xf0, 0xff, 0x03, 0x00, 0xed, 0xff, 0xb7, 0xff, 0xc6, 0xff, 0x0f, 0x00, 0x40, 0x00, 0x5b, 0x00, 
-0x4b, 0x00, 0xf9, 0xff, 0xe8, 0xff, 0x47, 0x00, 0x58, 0x00, 0xf7, 0xff, 0xd7, 0xff, 0xf4, 0xff, 
-0xda, 0xff, 0xb8, 0xff, 0xbb, 0xff, 0xc0, 0xff, 0xd0, 0xff, 0xe0, 0xff, 0xbc, 0xff, 0x90, 0xff, 
-0xb3, 0xff, 0x04, 0x00, 0x0c, 0x00, 0xcc, 0xff, 0xb8, 0xff, 0xe9, 0xff, 0x20, 0x00, 0x37, 0x00, 
-0x22, 0x00, 0xfd, 0xff, 0x06, 0x00, 0x1e, 0x00, 0x0a, 0x00, 0xfc, 0xff, 0x0f, 0x00, 0xfc, 0xff, 
-0xc2, 0xff, 0xb6, 0xff, 0xe1, 0xff, 0x18, 0x00, 0x46, 0x00, 0x46, 0x00, 0xf7, 0xff, 0xb7, 0xff, 
-0xe8, 0xff, 0x3b, 0x00, 0x36, 0x00, 0xf3, 0xff, 0xcd, 0xff, 0xdc, 0xff, 0xfc, 0xff, 0x08, 0x00, 
-0xe8, 0xff, 0xbc, 0xff, 0xd1, 0xff, 0x1b, 0x00, 0x20, 0x00, 0xe5, 0xff, 0xe8, 0xff, 0x0b, 0x00, 
-0xf4, 0xff, 0xe4, 0xff, 0xfe, 0xff, 0x0a, 0x00, 0x22, 0x00, 0x3b, 0x00, 0x0c, 0x00, 0xe8, 0xff, 
-0xff, 0xff, 0xdb, 0xff, 0x9a, 0xff, 0xab, 0xff, 0xb4, 0xff, 0x9d, 0xff, 0xc3, 0xff, 0xd9, 0xff, 
-0xa4, 0xff, 0x9d, 0xff, 0xd2, 0xff, 0xf1, 0xff, 0x0a, 0x00, 0x33, 0x00, 0x4f, 0x00, 0x41, 0x00, 
-0x00, 0x00, 0xce, 0xff, 0xe5, 0xff, 0x11, 0x00, 0x18, 0x00, 0xf5, 0xff, 0xbb, 0xff, 0xb0, 0xff, 
-0xed, 0xff, 0x18, 0x00, 0x03, 0x00, 0xe3, 0xff, 0xdf, 0xff, 0xeb, 0xff, 0xfa, 0xff, 0x1d, 0x00, 
-0x44, 0x00, 0x28, 0x00, 0xd5, 0xff, 0x9b, 0xff, 0x8f, 0xff, 0xad, 0xff, 0xd4, 0xff, 0xce, 0xff, 
-0xc6, 0xff, 0xfa, 0xff, 0x27, 0x00, 0x20, 0x00, 0x18, 0x00, 0x25, 0x00, 0x37, 0x00, 0x41, 0x00, 
-0x30, 0x00, 0x14, 0x00, 0x06, 0x00, 0x00, 0x00, 0xee, 0xff, 0xc5, 0xff, 0xa5, 0xff, 0xbd, 0xff, 
-0xde, 0xff, 0xd3, 0xff, 0xcf, 0xff, 0xe3, 0xff, 0xf2, 0xff, 0x0e, 0x00, 0x22, 0x00, 0x0c, 0x00, 
-0x04, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x06, 0x00, 0xfb, 0xff, 0x2d, 0x00, 0x65, 0x00, 0x2b, 0x00, 
-0xbf, 0xff, 0xc6, 0xff, 0x07, 0x00, 0x19, 0x00, 0x18, 0x00, 0xf0, 0xff, 0xac, 0xff, 0xc0, 0xff, 
-0x07, 0x00, 0x14, 0x00, 0x21, 0x00, 0x43, 0x00, 0x36, 0x00, 0x18, 0x00, 0x19, 0x00, 0x32, 0x00, 
-0x59, 0x00, 0x64, 0x00, 0x2f, 0x00, 0xee, 0xff, 0xe1, 0xff, 0x08, 0x00, 0x2e, 0x00, 0x2e, 0x00, 
-0x27, 0x00, 0x2e, 0x00, 0x27, 0x00, 0x33, 0x00, 0x57, 0x00, 0x47, 0x00, 0x21, 0x00, 0x27, 0x00, 
-0x07, 0x00, 0xb1, 0xff, 0xa9, 0xff, 0xdf, 0xff, 0xf5, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xee, 0xff, 
-0x04, 0x00, 0x2d, 0x00, 0x24, 0x00, 0x09, 0x00, 0x19, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x17, 0x00, 
-0xf9, 0xff, 0x07, 0x00, 0x12, 0x00, 0xfb, 0xff, 0xf3, 0xff, 0x07, 0x00, 0x19, 0x00, 0x1f, 0x00, 
-0x20, 0x00, 0x27, 0x00, 0x36, 0x00, 0x3b, 0x00, 0x36, 0x00, 0x37, 0x00, 0x2c, 0x00, 0x15, 0x00, 
-0x0b, 0x00, 0x0e, 0x00, 0x16, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x22, 0x00, 0x12, 0x00, 0x08, 0x00, 
-0x1c, 0x00, 0x40, 0x00, 0x31, 0x00, 0x07, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x07, 0x00, 0x21, 0x00, 
-0x23, 0x00, 0xe1, 0xff, 0xcf, 0xff, 0x10, 0x00, 0x2e, 0x00, 0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 
-0x00, 0x00, 0xe9, 0xff, 0xf3, 0xff, 0x2b, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xd3, 0xff, 0xe4, 0xff, 
-0x09, 0x00, 0x14, 0x00, 0xf3, 0xff, 0xc7, 0xff, 0xd5, 0xff, 0x18, 0x00, 0x4d, 0x00, 0x54, 0x00, 
-0x2c, 0x00, 0xfe, 0xff, 0xfa, 0xff, 0x10, 0x00, 0x30, 0x00, 0x53, 0x00, 0x42, 0x00, 0x07, 0x00, 
-0x04, 0x00, 0x1f, 0x00, 0x1c, 0x00, 0x33, 0x00, 0x56, 0x00, 0x31, 0x00, 0xee, 0xff, 0xd8, 0xff, 
-0xe0, 0xff, 0xe8, 0xff, 0xcf, 0xff, 0xa0, 0xff, 0xad, 0xff, 0xe1, 0xff, 0xf1, 0xff, 0x10, 0x00, 
-0x5b, 0x00, 0x69, 0x00, 0x33, 0x00, 0x0f, 0x00, 0xf8, 0xff, 0xcc, 0xff, 0xb3, 0xff, 0xd5, 0xff, 
-0x02, 0x00 
-};
-const unsigned int bye_len = 38978;
@@ -1,1812 +0,0 @@
-#include <stdio.h>
-const unsigned char hi_mp3[] = {
-0x30, 0x00, 0x48, 0x00, 0x4c, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x4a, 0x00, 
-0x4d, 0x00, 0x50, 0x00, 0x51, 0x00, 0x50, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x4c, 0x00, 0x4d, 0x00, 
-0x4f, 0x00, 0x4d, 0x00, 0x4a, 0x00, 0x48, 0x00, 0x48, 0x00, 0x46, 0x00, 0x45, 0x00, 0x46, 0x00, 
-0x45, 0x00, 0x41, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x43, 0x00, 0x43, 0x00, 0x3f, 0x00, 0x3e, 0x00, 
-0x40, 0x00, 0x3e, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3b, 0x00, 
-0x3c, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x41, 0x00, 
-0x41, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x43, 0x00, 0x43, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x42, 0x00, 
-0x45, 0x00, 0x44, 0x00, 0x40, 0x00, 0x42, 0x00, 0x45, 0x00, 0x44, 0x00, 0x42, 0x00, 0x46, 0x00, 
-0x48, 0x00, 0x45, 0x00, 0x42, 0x00, 0x42, 0x00, 0x46, 0x00, 0x4a, 0x00, 0x48, 0x00, 0x44, 0x00, 
-0x42, 0x00, 0x42, 0x00, 0x44, 0x00, 0x48, 0x00, 0x46, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x42, 0x00, 
-0x44, 0x00, 0x45, 0x00, 0x42, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x42, 0x00, 0x44, 0x00, 
-0x42, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 0x44, 0x00, 
-0x45, 0x00, 0x42, 0x00, 0x42, 0x00, 0x44, 0x00, 0x45, 0x00, 0x44, 0x00, 0x43, 0x00, 0x42, 0x00, 
-0x42, 0x00, 0x42, 0x00, 0x43, 0x00, 0x43, 0x00, 0x41, 0x00, 0x41, 0x00, 0x43, 0x00, 0x43, 0x00, 
-0x42, 0x00, 0x41, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x3c, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x39, 0x00, 0x38, 0x00, 0x37, 0x00, 
-0x37, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 
-0x39, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3d, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3a, 0x00, 
-0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x34, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 
-0x33, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x34, 0x00, 0x36, 0x00, 0x36, 0x00, 
-0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x35, 0x00, 0x34, 0x00, 0x32, 0x00, 0x30, 0x00, 
-0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x33, 0x00, 0x32, 0x00, 
-0x31, 0x00, 0x33, 0x00, 0x33, 0x00, 0x32, 0x00, 0x32, 0x00, 0x31, 0x00, 0x31, 0x00, 0x32, 0x00, 
-0x32, 0x00, 0x2f, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2f, 0x00, 0x31, 0x00, 0x32, 0x00, 0x32, 0x00, 
-0x32, 0x00, 0x32, 0x00, 0x31, 0x00, 0x32, 0x00, 0x35, 0x00, 0x35, 0x00, 0x34, 0x00, 0x33, 0x00, 
-0x35, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x38, 0x00, 0x37, 0x00, 0x36, 0x00, 
-0x36, 0x00, 0x35, 0x00, 0x34, 0x00, 0x34, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x31, 0x00, 
-0x31, 0x00, 0x32, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x32, 0x00, 0x32, 0x00, 0x34, 0x00, 
-0x33, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x33, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x30, 0x00, 
-0x31, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x34, 0x00, 0x32, 0x00, 0x32, 0x00, 
-0x34, 0x00, 0x34, 0x00, 0x33, 0x00, 0x34, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x34, 0x00, 
-0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 
-0x34, 0x00, 0x34, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x34, 0x00, 0x32, 0x00, 0x33, 0x00, 
-0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 
-0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x36, 0x00, 0x35, 0x00, 
-0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x31, 0x00, 0x30, 0x00, 0x32, 0x00, 0x34, 0x00, 
-0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x38, 0x00, 0x39, 0x00, 0x38, 0x00, 0x37, 0x00, 0x35, 0x00, 
-0x35, 0x00, 0x35, 0x00, 0x34, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x31, 0x00, 0x31, 0x00, 
-0x2f, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x2d, 0x00, 0x2c, 0x00, 0x2f, 0x00, 0x30, 0x00, 0x30, 0x00, 
-0x2f, 0x00, 0x2f, 0x00, 0x31, 0x00, 0x32, 0x00, 0x31, 0x00, 0x31, 0x00, 0x32, 0x00, 0x32, 0x00, 
-0x34, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x35, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 
-0x35, 0x00, 0x36, 0x00, 0x36, 0x00, 0x34, 0x00, 0x34, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 
-0x36, 0x00, 0x35, 0x00, 0x35, 0x00, 0x34, 0x00, 0x35, 0x00, 0x34, 0x00, 0x32, 0x00, 0x31, 0x00, 
-0x31, 0x00, 0x32, 0x00, 0x32, 0x00, 0x30, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x2e, 0x00, 
-0x30, 0x00, 0x30, 0x00, 0x2f, 0x00, 0x2e, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2c, 0x00, 
-0x2b, 0x00, 0x2b, 0x00, 0x2d, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x30, 0x00, 0x30, 0x00, 0x31, 0x00, 
-0x33, 0x00, 0x33, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 
-0x32, 0x00, 0x32, 0x00, 0x31, 0x00, 0x30, 0x00, 0x31, 0x00, 0x31, 0x00, 0x30, 0x00, 0x30, 0x00, 
-0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x2f, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x30, 0x00, 0x30, 0x00, 
-0x31, 0x00, 0x30, 0x00, 0x2f, 0x00, 0x31, 0x00, 0x32, 0x00, 0x32, 0x00, 0x31, 0x00, 0x2e, 0x00, 
-0x2c, 0x00, 0x2d, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2f, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x30, 0x00, 
-0x31, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x34, 0x00, 0x33, 0x00, 0x33, 0x00, 
-0x31, 0x00, 0x30, 0x00, 0x30, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x2f, 0x00, 
-0x2f, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x2e, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2d, 0x00, 
-0x2e, 0x00, 0x2f, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2d, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2f, 0x00, 
-0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x32, 0x00, 0x31, 0x00, 
-0x31, 0x00, 0x34, 0x00, 0x34, 0x00, 0x33, 0x00, 0x33, 0x00, 0x32, 0x00, 0x33, 0x00, 0x35, 0x00, 
-0x33, 0x00, 0x31, 0x00, 0x31, 0x00, 0x30, 0x00, 0x30, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 
-0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x33, 0x00, 0x32, 0x00, 0x34, 0x00, 0x34, 0x00, 
-0x32, 0x00, 0x32, 0x00, 0x33, 0x00, 0x33, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x34, 0x00, 
-0x32, 0x00, 0x31, 0x00, 0x31, 0x00, 0x32, 0x00, 0x32, 0x00, 0x31, 0x00, 0x30, 0x00, 0x30, 0x00, 
-0x2f, 0x00, 0x2f, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x30, 0x00, 0x2e, 0x00, 0x2e, 0x00, 
-0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x30, 0x00, 0x30, 0x00, 0x32, 0x00, 0x33, 0x00, 0x31, 0x00, 
-0x33, 0x00, 0x35, 0x00, 0x35, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x36, 0x00, 0x37, 0x00, 
-0x39, 0x00, 0x3a, 0x00, 0x37, 0x00, 0x35, 0x00, 0x36, 0x00, 0x36, 0x00, 0x35, 0x00, 0x34, 0x00, 
-0x33, 0x00, 0x35, 0x00, 0x35, 0x00, 0x32, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x32, 0x00, 
-0x31, 0x00, 0x31, 0x00, 0x32, 0x00, 0x30, 0x00, 0x30, 0x00, 0x34, 0x00, 0x36, 0x00, 0x37, 0x00, 
-0x38, 0x00, 0x35, 0x00, 0x34, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 
-0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 0x37, 0x00, 
-0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x36, 0x00, 0x35, 0x00, 0x36, 0x00, 
-0x36, 0x00, 0x35, 0x00, 0x35, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 
-0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3c, 0x00, 
-0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3b, 0x00, 
-0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 
-0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 
-0x36, 0x00, 0x35, 0x00, 0x36, 0x00, 0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3a, 0x00, 
-0x38, 0x00, 0x37, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3c, 0x00, 0x3c, 0x00, 
-0x3c, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3b, 0x00, 0x3c, 0x00, 
-0x3e, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x39, 0x00, 
-0x3c, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x3f, 0x00, 
-0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3a, 0x00, 
-0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 
-0x3c, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3e, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x00, 0x40, 0x00, 0x41, 0x00, 0x41, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x41, 0x00, 0x40, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x41, 0x00, 0x41, 0x00, 0x40, 0x00, 
-0x40, 0x00, 0x42, 0x00, 0x41, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x41, 0x00, 0x40, 0x00, 0x3f, 0x00, 
-0x40, 0x00, 0x41, 0x00, 0x41, 0x00, 0x42, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x41, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x41, 0x00, 0x42, 0x00, 0x42, 0x00, 0x41, 0x00, 
-0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x00, 0x40, 0x00, 
-0x40, 0x00, 0x41, 0x00, 0x40, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x00, 0x40, 0x00, 0x43, 0x00, 
-0x44, 0x00, 0x43, 0x00, 0x44, 0x00, 0x44, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x42, 0x00, 
-0x43, 0x00, 0x43, 0x00, 0x41, 0x00, 0x42, 0x00, 0x42, 0x00, 0x41, 0x00, 0x41, 0x00, 0x43, 0x00, 
-0x44, 0x00, 0x43, 0x00, 0x43, 0x00, 0x42, 0x00, 0x41, 0x00, 0x42, 0x00, 0x42, 0x00, 0x43, 0x00, 
-0x44, 0x00, 0x43, 0x00, 0x43, 0x00, 0x42, 0x00, 0x42, 0x00, 0x43, 0x00, 0x43, 0x00, 0x42, 0x00, 
-0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x40, 0x00, 
-0x41, 0x00, 0x43, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 
-0x42, 0x00, 0x43, 0x00, 0x42, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x42, 0x00, 0x43, 0x00, 
-0x43, 0x00, 0x43, 0x00, 0x44, 0x00, 0x43, 0x00, 0x43, 0x00, 0x42, 0x00, 0x42, 0x00, 0x44, 0x00, 
-0x45, 0x00, 0x43, 0x00, 0x43, 0x00, 0x44, 0x00, 0x44, 0x00, 0x43, 0x00, 0x43, 0x00, 0x42, 0x00, 
-0x41, 0x00, 0x42, 0x00, 0x44, 0x00, 0x44, 0x00, 0x43, 0x00, 0x42, 0x00, 0x42, 0x00, 0x43, 0x00, 
-0x45, 0x00, 0x43, 0x00, 0x43, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x45, 0x00, 0x42, 0x00, 
-0x41, 0x00, 0x41, 0x00, 0x43, 0x00, 0x44, 0x00, 0x43, 0x00, 0x42, 0x00, 0x43, 0x00, 0x43, 0x00, 
-0x43, 0x00, 0x43, 0x00, 0x42, 0x00, 0x43, 0x00, 0x43, 0x00, 0x44, 0x00, 0x46, 0x00, 0x45, 0x00, 
-0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x44, 0x00, 0x43, 0x00, 0x43, 0x00, 0x44, 0x00, 
-0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 
-0x44, 0x00, 0x43, 0x00, 0x44, 0x00, 0x43, 0x00, 0x44, 0x00, 0x44, 0x00, 0x42, 0x00, 0x43, 0x00, 
-0x45, 0x00, 0x44, 0x00, 0x44, 0x00, 0x43, 0x00, 0x42, 0x00, 0x43, 0x00, 0x42, 0x00, 0x42, 0x00, 
-0x43, 0x00, 0x42, 0x00, 0x42, 0x00, 0x44, 0x00, 0x44, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 
-0x44, 0x00, 0x43, 0x00, 0x43, 0x00, 0x45, 0x00, 0x46, 0x00, 0x45, 0x00, 0x44, 0x00, 0x44, 0x00, 
-0x45, 0x00, 0x44, 0x00, 0x42, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x42, 0x00, 
-0x43, 0x00, 0x45, 0x00, 0x43, 0x00, 0x41, 0x00, 0x44, 0x00, 0x44, 0x00, 0x43, 0x00, 0x44, 0x00, 
-0x44, 0x00, 0x43, 0x00, 0x45, 0x00, 0x46, 0x00, 0x44, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 
-0x43, 0x00, 0x43, 0x00, 0x42, 0x00, 0x41, 0x00, 0x43, 0x00, 0x44, 0x00, 0x43, 0x00, 0x42, 0x00, 
-0x41, 0x00, 0x41, 0x00, 0x44, 0x00, 0x46, 0x00, 0x45, 0x00, 0x44, 0x00, 0x42, 0x00, 0x42, 0x00, 
-0x45, 0x00, 0x46, 0x00, 0x45, 0x00, 0x43, 0x00, 0x42, 0x00, 0x44, 0x00, 0x45, 0x00, 0x42, 0x00, 
-0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x44, 0x00, 0x44, 0x00, 0x42, 0x00, 0x40, 0x00, 0x41, 0x00, 
-0x44, 0x00, 0x44, 0x00, 0x43, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x43, 0x00, 
-0x41, 0x00, 0x42, 0x00, 0x42, 0x00, 0x43, 0x00, 0x45, 0x00, 0x43, 0x00, 0x40, 0x00, 0x41, 0x00, 
-0x44, 0x00, 0x46, 0x00, 0x44, 0x00, 0x40, 0x00, 0x40, 0x00, 0x43, 0x00, 0x44, 0x00, 0x42, 0x00, 
-0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x42, 0x00, 0x41, 0x00, 0x3e, 0x00, 0x40, 0x00, 
-0x43, 0x00, 0x42, 0x00, 0x43, 0x00, 0x42, 0x00, 0x40, 0x00, 0x42, 0x00, 0x44, 0x00, 0x43, 0x00, 
-0x42, 0x00, 0x41, 0x00, 0x42, 0x00, 0x41, 0x00, 0x40, 0x00, 0x42, 0x00, 0x42, 0x00, 0x40, 0x00, 
-0x42, 0x00, 0x44, 0x00, 0x42, 0x00, 0x43, 0x00, 0x43, 0x00, 0x42, 0x00, 0x44, 0x00, 0x44, 0x00, 
-0x42, 0x00, 0x41, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x42, 0x00, 0x41, 0x00, 0x41, 0x00, 
-0x42, 0x00, 0x42, 0x00, 0x41, 0x00, 0x42, 0x00, 0x42, 0x00, 0x40, 0x00, 0x40, 0x00, 0x43, 0x00, 
-0x43, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x43, 0x00, 0x43, 0x00, 0x42, 0x00, 0x42, 0x00, 
-0x42, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x43, 0x00, 
-0x44, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x41, 0x00, 0x42, 0x00, 
-0x43, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x42, 0x00, 0x41, 0x00, 0x43, 0x00, 0x42, 0x00, 
-0x42, 0x00, 0x42, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 0x41, 0x00, 
-0x41, 0x00, 0x43, 0x00, 0x43, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x42, 0x00, 
-0x42, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 
-0x42, 0x00, 0x40, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x42, 0x00, 0x40, 0x00, 0x3f, 0x00, 
-0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x41, 0x00, 
-0x41, 0x00, 0x41, 0x00, 0x40, 0x00, 0x42, 0x00, 0x43, 0x00, 0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 
-0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x3f, 0x00, 
-0x3e, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x00, 0x40, 0x00, 
-0x41, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x41, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x40, 0x00, 
-0x40, 0x00, 0x3f, 0x00, 0x41, 0x00, 0x41, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x42, 0x00, 0x41, 0x00, 
-0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x41, 0x00, 0x43, 0x00, 0x42, 0x00, 0x3f, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x40, 0x00, 
-0x41, 0x00, 0x40, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x41, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x40, 0x00, 
-0x41, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3f, 0x00, 
-0x40, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 
-0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x3e, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3e, 0x00, 0x3f, 0x00, 
-0x41, 0x00, 0x40, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3d, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3e, 0x00, 
-0x40, 0x00, 0x3f, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 
-0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3c, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3c, 0x00, 
-0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x3d, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 
-0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3c, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 
-0x3d, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 
-0x3d, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3d, 0x00, 
-0x3d, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3a, 0x00, 
-0x3c, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 
-0x3b, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3c, 0x00, 
-0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 
-0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3b, 0x00, 
-0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x3d, 0x00, 
-0x3b, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3b, 0x00, 
-0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 
-0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 
-0x3c, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3c, 0x00, 
-0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 
-0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 
-0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 
-0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 
-0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3c, 0x00, 
-0x3c, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3a, 0x00, 
-0x3b, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x39, 0x00, 0x3a, 0x00, 
-0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x39, 0x00, 
-0x3a, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x39, 0x00, 0x3a, 0x00, 
-0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x38, 0x00, 
-0x38, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3b, 0x00, 
-0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 
-0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x3c, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 
-0x39, 0x00, 0x3a, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x3b, 0x00, 0x3b, 0x00, 0x39, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3a, 0x00, 
-0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x39, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3b, 0x00, 
-0x3b, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x39, 0x00, 
-0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 
-0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 
-0x39, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 
-0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x37, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 
-0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x37, 0x00, 0x36, 0x00, 0x37, 0x00, 
-0x3a, 0x00, 0x39, 0x00, 0x36, 0x00, 0x36, 0x00, 0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 
-0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 
-0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x36, 0x00, 0x36, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x38, 0x00, 
-0x37, 0x00, 0x37, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 
-0x37, 0x00, 0x39, 0x00, 0x38, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 
-0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x39, 0x00, 
-0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x38, 0x00, 
-0x37, 0x00, 0x37, 0x00, 0x39, 0x00, 0x39, 0x00, 0x37, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 
-0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x39, 0x00, 0x38, 0x00, 
-0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 0x37, 0x00, 0x36, 0x00, 0x38, 0x00, 
-0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x37, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 
-0x37, 0x00, 0x37, 0x00, 0x39, 0x00, 0x38, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 
-0x38, 0x00, 0x38, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x36, 0x00, 
-0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x35, 0x00, 0x35, 0x00, 0x37, 0x00, 
-0x38, 0x00, 0x38, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x35, 0x00, 0x36, 0x00, 
-0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x38, 0x00, 0x37, 0x00, 0x36, 0x00, 0x37, 0x00, 
-0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x37, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 
-0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 
-0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x36, 0x00, 
-0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 
-0x38, 0x00, 0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x36, 0x00, 
-0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 
-0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x36, 0x00, 
-0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 
-0x38, 0x00, 0x37, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x37, 0x00, 0x37, 0x00, 
-0x35, 0x00, 0x35, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x34, 0x00, 0x34, 0x00, 
-0x37, 0x00, 0x38, 0x00, 0x36, 0x00, 0x34, 0x00, 0x35, 0x00, 0x37, 0x00, 0x37, 0x00, 0x35, 0x00, 
-0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x37, 0x00, 0x37, 0x00, 0x35, 0x00, 0x34, 0x00, 0x36, 0x00, 
-0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 0x35, 0x00, 0x34, 0x00, 0x34, 0x00, 0x36, 0x00, 0x36, 0x00, 
-0x35, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 
-0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 0x35, 0x00, 0x37, 0x00, 0x38, 0x00, 0x36, 0x00, 0x36, 0x00, 
-0x38, 0x00, 0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 
-0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x38, 0x00, 
-0x38, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x35, 0x00, 0x36, 0x00, 0x36, 0x00, 
-0x37, 0x00, 0x38, 0x00, 0x37, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 
-0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 
-0x37, 0x00, 0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 0x35, 0x00, 0x36, 0x00, 0x38, 0x00, 0x37, 0x00, 
-0x35, 0x00, 0x35, 0x00, 0x38, 0x00, 0x38, 0x00, 0x36, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 
-0x37, 0x00, 0x38, 0x00, 0x37, 0x00, 0x35, 0x00, 0x35, 0x00, 0x37, 0x00, 0x38, 0x00, 0x37, 0x00, 
-0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 
-0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 
-0x37, 0x00, 0x35, 0x00, 0x35, 0x00, 0x37, 0x00, 0x38, 0x00, 0x36, 0x00, 0x35, 0x00, 0x37, 0x00, 
-0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 0x38, 0x00, 0x38, 0x00, 
-0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x35, 0x00, 
-0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x35, 0x00, 
-0x36, 0x00, 0x38, 0x00, 0x37, 0x00, 0x36, 0x00, 0x38, 0x00, 0x38, 0x00, 0x35, 0x00, 0x35, 0x00, 
-0x37, 0x00, 0x36, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 
-0x35, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x35, 0x00, 0x34, 0x00, 0x35, 0x00, 
-0x37, 0x00, 0x38, 0x00, 0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 
-0x36, 0x00, 0x35, 0x00, 0x35, 0x00, 0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 0x35, 0x00, 0x35, 0x00, 
-0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x37, 0x00, 
-0x34, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x36, 0x00, 0x35, 0x00, 0x35, 0x00, 0x36, 0x00, 
-0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 
-0x35, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x36, 0x00, 0x35, 0x00, 0x35, 0x00, 
-0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 
-0x36, 0x00, 0x35, 0x00, 0x36, 0x00, 0x38, 0x00, 0x38, 0x00, 0x36, 0x00, 0x35, 0x00, 0x37, 0x00, 
-0x38, 0x00, 0x38, 0x00, 0x36, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x36, 0x00, 0x35, 0x00, 
-0x35, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x35, 0x00, 0x34, 0x00, 0x35, 0x00, 
-0x39, 0x00, 0x39, 0x00, 0x37, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x37, 0x00, 0x36, 0x00, 
-0x36, 0x00, 0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x37, 0x00, 0x35, 0x00, 0x36, 0x00, 0x38, 0x00, 
-0x38, 0x00, 0x38, 0x00, 0x35, 0x00, 0x35, 0x00, 0x38, 0x00, 0x38, 0x00, 0x36, 0x00, 0x36, 0x00, 
-0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x36, 0x00, 0x37, 0x00, 
-0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x36, 0x00, 0x36, 0x00, 0x38, 0x00, 0x37, 0x00, 
-0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x36, 0x00, 0x34, 0x00, 0x36, 0x00, 
-0x38, 0x00, 0x38, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 
-0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x36, 0x00, 0x38, 0x00, 0x39, 0x00, 
-0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x36, 0x00, 0x37, 0x00, 0x39, 0x00, 0x37, 0x00, 0x35, 0x00, 
-0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 
-0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 
-0x38, 0x00, 0x37, 0x00, 0x36, 0x00, 0x38, 0x00, 0x39, 0x00, 0x38, 0x00, 0x36, 0x00, 0x36, 0x00, 
-0x38, 0x00, 0x39, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 
-0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x36, 0x00, 0x37, 0x00, 
-0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 
-0x38, 0x00, 0x36, 0x00, 0x37, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 
-0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x38, 0x00, 
-0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x39, 0x00, 
-0x39, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x37, 0x00, 0x36, 0x00, 0x38, 0x00, 
-0x38, 0x00, 0x36, 0x00, 0x36, 0x00, 0x38, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 
-0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3a, 0x00, 
-0x39, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x37, 0x00, 0x37, 0x00, 0x39, 0x00, 0x38, 0x00, 
-0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3a, 0x00, 
-0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3b, 0x00, 
-0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 
-0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x39, 0x00, 
-0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x39, 0x00, 0x37, 0x00, 0x38, 0x00, 
-0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 
-0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 
-0x3b, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x38, 0x00, 0x3a, 0x00, 
-0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3b, 0x00, 
-0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3b, 0x00, 
-0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3b, 0x00, 
-0x3b, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 
-0x39, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 
-0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 
-0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 
-0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3d, 0x00, 0x3b, 0x00, 
-0x38, 0x00, 0x39, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x39, 0x00, 0x3a, 0x00, 
-0x3c, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3e, 0x00, 0x3d, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 
-0x3c, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 
-0x3b, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x3c, 0x00, 
-0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 
-0x3c, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3d, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x3c, 0x00, 
-0x3c, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 
-0x3d, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x3d, 0x00, 
-0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 
-0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3d, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 
-0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3e, 0x00, 0x3d, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x3f, 0x00, 
-0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 
-0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-0x3e, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x40, 0x00, 
-0x41, 0x00, 0x40, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x41, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 
-0x3d, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x41, 0x00, 0x40, 0x00, 0x40, 0x00, 
-0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x41, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x41, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x40, 0x00, 
-0x40, 0x00, 0x3f, 0x00, 0x3e, 0x00, 0x40, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 
-0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 
-0x42, 0x00, 0x42, 0x00, 0x40, 0x00, 0x40, 0x00, 0x42, 0x00, 0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 
-0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x3f, 0x00, 0x41, 0x00, 0x43, 0x00, 0x42, 0x00, 0x42, 0x00, 
-0x43, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x42, 0x00, 
-0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x42, 0x00, 
-0x41, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x43, 0x00, 0x43, 0x00, 0x42, 0x00, 0x43, 0x00, 
-0x44, 0x00, 0x43, 0x00, 0x43, 0x00, 0x44, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 
-0x45, 0x00, 0x44, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x44, 0x00, 0x44, 0x00, 
-0x44, 0x00, 0x43, 0x00, 0x43, 0x00, 0x44, 0x00, 0x44, 0x00, 0x43, 0x00, 0x43, 0x00, 0x44, 0x00, 
-0x45, 0x00, 0x44, 0x00, 0x44, 0x00, 0x45, 0x00, 0x44, 0x00, 0x44, 0x00, 0x46, 0x00, 0x45, 0x00, 
-0x44, 0x00, 0x46, 0x00, 0x45, 0x00, 0x44, 0x00, 0x46, 0x00, 0x46, 0x00, 0x44, 0x00, 0x45, 0x00, 
-0x46, 0x00, 0x46, 0x00, 0x45, 0x00, 0x43, 0x00, 0x45, 0x00, 0x48, 0x00, 0x47, 0x00, 0x45, 0x00, 
-0x44, 0x00, 0x44, 0x00, 0x46, 0x00, 0x47, 0x00, 0x46, 0x00, 0x46, 0x00, 0x44, 0x00, 0x44, 0x00, 
-0x47, 0x00, 0x46, 0x00, 0x44, 0x00, 0x45, 0x00, 0x45, 0x00, 0x45, 0x00, 0x47, 0x00, 0x47, 0x00, 
-0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x47, 0x00, 0x46, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 
-0x47, 0x00, 0x48, 0x00, 0x48, 0x00, 0x44, 0x00, 0x44, 0x00, 0x46, 0x00, 0x47, 0x00, 0x47, 0x00, 
-0x46, 0x00, 0x45, 0x00, 0x46, 0x00, 0x48, 0x00, 0x48, 0x00, 0x47, 0x00, 0x47, 0x00, 0x47, 0x00, 
-0x47, 0x00, 0x46, 0x00, 0x46, 0x00, 0x47, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x48, 0x00, 
-0x47, 0x00, 0x48, 0x00, 0x47, 0x00, 0x47, 0x00, 0x49, 0x00, 0x48, 0x00, 0x48, 0x00, 0x49, 0x00, 
-0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4a, 0x00, 0x48, 0x00, 0x48, 0x00, 
-0x49, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x49, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4a, 0x00, 0x49, 0x00, 
-0x49, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x49, 0x00, 
-0x48, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4a, 0x00, 0x49, 0x00, 0x4b, 0x00, 0x4c, 0x00, 
-0x4b, 0x00, 0x4a, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4b, 0x00, 0x4a, 0x00, 0x4c, 0x00, 
-0x4c, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4b, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4c, 0x00, 
-0x4c, 0x00, 0x4c, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4e, 0x00, 
-0x4d, 0x00, 0x4d, 0x00, 0x4d, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4e, 0x00, 
-0x4f, 0x00, 0x4e, 0x00, 0x4d, 0x00, 0x4d, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4d, 0x00, 0x4d, 0x00, 
-0x4f, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x4d, 0x00, 0x4b, 0x00, 0x4e, 0x00, 0x50, 0x00, 
-0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4d, 0x00, 0x4f, 0x00, 0x4f, 0x00, 0x4f, 0x00, 0x4e, 0x00, 
-0x4e, 0x00, 0x50, 0x00, 0x51, 0x00, 0x50, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x4f, 0x00, 0x50, 0x00, 
-0x51, 0x00, 0x50, 0x00, 0x4e, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x4f, 0x00, 
-0x4f, 0x00, 0x51, 0x00, 0x52, 0x00, 0x51, 0x00, 0x50, 0x00, 0x50, 0x00, 0x51, 0x00, 0x50, 0x00, 
-0x4f, 0x00, 0x50, 0x00, 0x51, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x52, 0x00, 0x51, 0x00, 
-0x51, 0x00, 0x50, 0x00, 0x52, 0x00, 0x52, 0x00, 0x50, 0x00, 0x50, 0x00, 0x51, 0x00, 0x51, 0x00, 
-0x51, 0x00, 0x53, 0x00, 0x53, 0x00, 0x53, 0x00, 0x52, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 
-0x52, 0x00, 0x52, 0x00, 0x54, 0x00, 0x55, 0x00, 0x54, 0x00, 0x53, 0x00, 0x53, 0x00, 0x53, 0x00, 
-0x54, 0x00, 0x55, 0x00, 0x53, 0x00, 0x53, 0x00, 0x54, 0x00, 0x54, 0x00, 0x54, 0x00, 0x54, 0x00, 
-0x55, 0x00, 0x55, 0x00, 0x54, 0x00, 0x55, 0x00, 0x55, 0x00, 0x54, 0x00, 0x54, 0x00, 0x54, 0x00, 
-0x54, 0x00, 0x54, 0x00, 0x56, 0x00, 0x56, 0x00, 0x55, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 
-0x56, 0x00, 0x56, 0x00, 0x55, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x54, 0x00, 0x54, 0x00, 
-0x55, 0x00, 0x55, 0x00, 0x56, 0x00, 0x56, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 
-0x56, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x56, 0x00, 0x55, 0x00, 0x57, 0x00, 0x58, 0x00, 
-0x58, 0x00, 0x58, 0x00, 0x56, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 
-0x57, 0x00, 0x58, 0x00, 0x58, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x58, 0x00, 0x58, 0x00, 
-0x58, 0x00, 0x58, 0x00, 0x56, 0x00, 0x56, 0x00, 0x58, 0x00, 0x57, 0x00, 0x58, 0x00, 0x5b, 0x00, 
-0x59, 0x00, 0x58, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x5a, 0x00, 
-0x5b, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 
-0x59, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5b, 0x00, 
-0x5a, 0x00, 0x59, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5a, 0x00, 0x5a, 0x00, 
-0x5b, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5b, 0x00, 
-0x5c, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5d, 0x00, 
-0x5c, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5c, 0x00, 0x5d, 0x00, 
-0x5c, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x5c, 0x00, 
-0x5d, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5e, 0x00, 
-0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5e, 0x00, 
-0x5e, 0x00, 0x5d, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5e, 0x00, 
-0x5f, 0x00, 0x5f, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5e, 0x00, 
-0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 
-0x60, 0x00, 0x60, 0x00, 0x61, 0x00, 0x61, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x60, 0x00, 
-0x5f, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x62, 0x00, 0x61, 0x00, 
-0x61, 0x00, 0x62, 0x00, 0x60, 0x00, 0x60, 0x00, 0x61, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5f, 0x00, 
-0x60, 0x00, 0x61, 0x00, 0x61, 0x00, 0x5e, 0x00, 0x60, 0x00, 0x61, 0x00, 0x60, 0x00, 0x61, 0x00, 
-0x63, 0x00, 0x62, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 
-0x61, 0x00, 0x61, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x61, 0x00, 0x60, 0x00, 0x60, 0x00, 
-0x5f, 0x00, 0x60, 0x00, 0x61, 0x00, 0x60, 0x00, 0x60, 0x00, 0x62, 0x00, 0x61, 0x00, 0x61, 0x00, 
-0x63, 0x00, 0x62, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x63, 0x00, 0x63, 0x00, 0x60, 0x00, 
-0x61, 0x00, 0x63, 0x00, 0x61, 0x00, 0x62, 0x00, 0x63, 0x00, 0x60, 0x00, 0x60, 0x00, 0x62, 0x00, 
-0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x64, 0x00, 
-0x62, 0x00, 0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 0x62, 0x00, 0x61, 0x00, 0x60, 0x00, 0x61, 0x00, 
-0x62, 0x00, 0x63, 0x00, 0x62, 0x00, 0x60, 0x00, 0x60, 0x00, 0x63, 0x00, 0x63, 0x00, 0x62, 0x00, 
-0x62, 0x00, 0x62, 0x00, 0x61, 0x00, 0x62, 0x00, 0x61, 0x00, 0x61, 0x00, 0x63, 0x00, 0x63, 0x00, 
-0x61, 0x00, 0x62, 0x00, 0x64, 0x00, 0x63, 0x00, 0x62, 0x00, 0x61, 0x00, 0x61, 0x00, 0x62, 0x00, 
-0x63, 0x00, 0x63, 0x00, 0x62, 0x00, 0x63, 0x00, 0x63, 0x00, 0x64, 0x00, 0x63, 0x00, 0x62, 0x00, 
-0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x63, 0x00, 0x62, 0x00, 0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 
-0x62, 0x00, 0x62, 0x00, 0x63, 0x00, 0x63, 0x00, 0x62, 0x00, 0x62, 0x00, 0x63, 0x00, 0x63, 0x00, 
-0x61, 0x00, 0x60, 0x00, 0x62, 0x00, 0x62, 0x00, 0x61, 0x00, 0x61, 0x00, 0x62, 0x00, 0x62, 0x00, 
-0x62, 0x00, 0x63, 0x00, 0x63, 0x00, 0x62, 0x00, 0x62, 0x00, 0x63, 0x00, 0x63, 0x00, 0x62, 0x00, 
-0x62, 0x00, 0x62, 0x00, 0x63, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 
-0x64, 0x00, 0x64, 0x00, 0x62, 0x00, 0x62, 0x00, 0x61, 0x00, 0x62, 0x00, 0x65, 0x00, 0x63, 0x00, 
-0x61, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x61, 0x00, 0x62, 0x00, 0x63, 0x00, 
-0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x61, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 
-0x61, 0x00, 0x62, 0x00, 0x64, 0x00, 0x63, 0x00, 0x62, 0x00, 0x63, 0x00, 0x61, 0x00, 0x61, 0x00, 
-0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x61, 0x00, 0x61, 0x00, 0x62, 0x00, 0x62, 0x00, 
-0x62, 0x00, 0x61, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x63, 0x00, 
-0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x61, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x62, 0x00, 0x62, 0x00, 
-0x62, 0x00, 0x61, 0x00, 0x61, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x61, 0x00, 0x61, 0x00, 
-0x63, 0x00, 0x65, 0x00, 0x63, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x63, 0x00, 0x62, 0x00, 
-0x62, 0x00, 0x62, 0x00, 0x61, 0x00, 0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 
-0x62, 0x00, 0x63, 0x00, 0x63, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 
-0x61, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x61, 0x00, 0x62, 0x00, 
-0x62, 0x00, 0x61, 0x00, 0x61, 0x00, 0x62, 0x00, 0x61, 0x00, 0x63, 0x00, 0x63, 0x00, 0x62, 0x00, 
-0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x63, 0x00, 0x61, 0x00, 0x60, 0x00, 0x62, 0x00, 0x62, 0x00, 
-0x61, 0x00, 0x62, 0x00, 0x62, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x62, 0x00, 0x63, 0x00, 
-0x62, 0x00, 0x61, 0x00, 0x63, 0x00, 0x62, 0x00, 0x61, 0x00, 0x62, 0x00, 0x61, 0x00, 0x61, 0x00, 
-0x62, 0x00, 0x61, 0x00, 0x60, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x62, 0x00, 0x61, 0x00, 
-0x60, 0x00, 0x61, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 
-0x61, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x62, 0x00, 0x61, 0x00, 0x5f, 0x00, 0x5f, 0x00, 
-0x60, 0x00, 0x61, 0x00, 0x60, 0x00, 0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 
-0x61, 0x00, 0x61, 0x00, 0x62, 0x00, 0x61, 0x00, 0x60, 0x00, 0x60, 0x00, 0x61, 0x00, 0x60, 0x00, 
-0x60, 0x00, 0x60, 0x00, 0x61, 0x00, 0x61, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x61, 0x00, 0x60, 0x00, 
-0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 
-0x60, 0x00, 0x61, 0x00, 0x60, 0x00, 0x60, 0x00, 0x61, 0x00, 0x61, 0x00, 0x5f, 0x00, 0x5f, 0x00, 
-0x61, 0x00, 0x61, 0x00, 0x60, 0x00, 0x61, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 
-0x5f, 0x00, 0x60, 0x00, 0x61, 0x00, 0x61, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x5f, 0x00, 
-0x60, 0x00, 0x61, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 
-0x5f, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x60, 0x00, 
-0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x61, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x61, 0x00, 0x61, 0x00, 
-0x5f, 0x00, 0x5e, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 
-0x5f, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5e, 0x00, 0x5e, 0x00, 
-0x5f, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x60, 0x00, 0x60, 0x00, 
-0x5e, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5d, 0x00, 
-0x5c, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5d, 0x00, 
-0x5e, 0x00, 0x5d, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5d, 0x00, 
-0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5c, 0x00, 
-0x5d, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5d, 0x00, 
-0x5c, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5c, 0x00, 
-0x5d, 0x00, 0x5d, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5d, 0x00, 
-0x5d, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 
-0x5d, 0x00, 0x5b, 0x00, 0x59, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5c, 0x00, 
-0x5a, 0x00, 0x5b, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5b, 0x00, 
-0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5a, 0x00, 
-0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5b, 0x00, 
-0x5c, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5b, 0x00, 
-0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 
-0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5c, 0x00, 
-0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5c, 0x00, 
-0x59, 0x00, 0x58, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x59, 0x00, 
-0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x59, 0x00, 
-0x58, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x58, 0x00, 0x58, 0x00, 0x59, 0x00, 
-0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x58, 0x00, 0x57, 0x00, 0x59, 0x00, 0x59, 0x00, 
-0x58, 0x00, 0x59, 0x00, 0x59, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x58, 0x00, 
-0x58, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x59, 0x00, 0x59, 0x00, 
-0x59, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x58, 0x00, 
-0x58, 0x00, 0x58, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x58, 0x00, 0x57, 0x00, 0x57, 0x00, 
-0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x57, 0x00, 0x57, 0x00, 
-0x57, 0x00, 0x57, 0x00, 0x59, 0x00, 0x59, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5a, 0x00, 
-0x59, 0x00, 0x57, 0x00, 0x56, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 
-0x57, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x57, 0x00, 0x58, 0x00, 0x57, 0x00, 0x56, 0x00, 
-0x59, 0x00, 0x59, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x57, 0x00, 0x59, 0x00, 0x5a, 0x00, 
-0x58, 0x00, 0x57, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x57, 0x00, 0x57, 0x00, 0x58, 0x00, 
-0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x57, 0x00, 0x57, 0x00, 0x59, 0x00, 0x59, 0x00, 
-0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x57, 0x00, 0x57, 0x00, 0x58, 0x00, 0x58, 0x00, 0x57, 0x00, 
-0x57, 0x00, 0x58, 0x00, 0x58, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x58, 0x00, 0x57, 0x00, 
-0x58, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x58, 0x00, 0x58, 0x00, 0x57, 0x00, 0x55, 0x00, 
-0x56, 0x00, 0x58, 0x00, 0x57, 0x00, 0x56, 0x00, 0x56, 0x00, 0x57, 0x00, 0x57, 0x00, 0x58, 0x00, 
-0x58, 0x00, 0x58, 0x00, 0x57, 0x00, 0x57, 0x00, 0x58, 0x00, 0x58, 0x00, 0x57, 0x00, 0x56, 0x00, 
-0x57, 0x00, 0x57, 0x00, 0x56, 0x00, 0x56, 0x00, 0x56, 0x00, 0x56, 0x00, 0x57, 0x00, 0x57, 0x00, 
-0x55, 0x00, 0x55, 0x00, 0x57, 0x00, 0x56, 0x00, 0x56, 0x00, 0x56, 0x00, 0x56, 0x00, 0x56, 0x00, 
-0x57, 0x00, 0x57, 0x00, 0x55, 0x00, 0x56, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x57, 0x00, 
-0x56, 0x00, 0x56, 0x00, 0x57, 0x00, 0x56, 0x00, 0x55, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 
-0x57, 0x00, 0x56, 0x00, 0x56, 0x00, 0x56, 0x00, 0x57, 0x00, 0x56, 0x00, 0x56, 0x00, 0x57, 0x00, 
-0x55, 0x00, 0x55, 0x00, 0x57, 0x00, 0x57, 0x00, 0x56, 0x00, 0x56, 0x00, 0x56, 0x00, 0x57, 0x00, 
-0x57, 0x00, 0x57, 0x00, 0x58, 0x00, 0x57, 0x00, 0x57, 0x00, 0x58, 0x00, 0x57, 0x00, 0x56, 0x00, 
-0x57, 0x00, 0x56, 0x00, 0x58, 0x00, 0x59, 0x00, 0x56, 0x00, 0x56, 0x00, 0x58, 0x00, 0x57, 0x00, 
-0x56, 0x00, 0x56, 0x00, 0x54, 0x00, 0x55, 0x00, 0x57, 0x00, 0x56, 0x00, 0x56, 0x00, 0x56, 0x00, 
-0x55, 0x00, 0x55, 0x00, 0x56, 0x00, 0x56, 0x00, 0x56, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 
-0x57, 0x00, 0x57, 0x00, 0x56, 0x00, 0x56, 0x00, 0x57, 0x00, 0x57, 0x00, 0x56, 0x00, 0x55, 0x00, 
-0x55, 0x00, 0x56, 0x00, 0x56, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 0x56, 0x00, 
-0x56, 0x00, 0x57, 0x00, 0x56, 0x00, 0x56, 0x00, 0x57, 0x00, 0x57, 0x00, 0x56, 0x00, 0x56, 0x00, 
-0x57, 0x00, 0x57, 0x00, 0x58, 0x00, 0x58, 0x00, 0x57, 0x00, 0x56, 0x00, 0x55, 0x00, 0x55, 0x00, 
-0x56, 0x00, 0x56, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x58, 0x00, 0x57, 0x00, 0x56, 0x00, 
-0x55, 0x00, 0x57, 0x00, 0x57, 0x00, 0x56, 0x00, 0x56, 0x00, 0x56, 0x00, 0x56, 0x00, 0x56, 0x00, 
-0x56, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x57, 0x00, 0x56, 0x00, 0x55, 0x00, 0x55, 0x00, 
-0x56, 0x00, 0x57, 0x00, 0x57, 0x00, 0x56, 0x00, 0x56, 0x00, 0x55, 0x00, 0x55, 0x00, 0x57, 0x00, 
-0x58, 0x00, 0x57, 0x00, 0x57, 0x00, 0x56, 0x00, 0x56, 0x00, 0x56, 0x00, 0x57, 0x00, 0x57, 0x00, 
-0x57, 0x00, 0x57, 0x00, 0x56, 0x00, 0x56, 0x00, 0x56, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 
-0x57, 0x00, 0x57, 0x00, 0x56, 0x00, 0x56, 0x00, 0x57, 0x00, 0x56, 0x00, 0x56, 0x00, 0x57, 0x00, 
-0x58, 0x00, 0x57, 0x00, 0x56, 0x00, 0x56, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x56, 0x00, 
-0x55, 0x00, 0x57, 0x00, 0x58, 0x00, 0x56, 0x00, 0x56, 0x00, 0x57, 0x00, 0x57, 0x00, 0x56, 0x00, 
-0x55, 0x00, 0x57, 0x00, 0x59, 0x00, 0x57, 0x00, 0x56, 0x00, 0x58, 0x00, 0x58, 0x00, 0x57, 0x00, 
-0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x57, 0x00, 0x55, 0x00, 0x57, 0x00, 0x59, 0x00, 0x57, 0x00, 
-0x57, 0x00, 0x59, 0x00, 0x59, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x57, 0x00, 
-0x58, 0x00, 0x59, 0x00, 0x59, 0x00, 0x57, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x58, 0x00, 
-0x58, 0x00, 0x58, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x58, 0x00, 0x57, 0x00, 0x57, 0x00, 
-0x57, 0x00, 0x59, 0x00, 0x58, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x59, 0x00, 0x5a, 0x00, 
-0x58, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x57, 0x00, 0x57, 0x00, 
-0x59, 0x00, 0x59, 0x00, 0x58, 0x00, 0x59, 0x00, 0x59, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5a, 0x00, 
-0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x58, 0x00, 0x59, 0x00, 
-0x5a, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x58, 0x00, 0x58, 0x00, 0x5a, 0x00, 0x59, 0x00, 
-0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 
-0x59, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5a, 0x00, 
-0x59, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x58, 0x00, 0x58, 0x00, 
-0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5a, 0x00, 
-0x59, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5b, 0x00, 
-0x5c, 0x00, 0x5b, 0x00, 0x59, 0x00, 0x59, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5c, 0x00, 
-0x5c, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 
-0x5c, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5d, 0x00, 
-0x5d, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5e, 0x00, 
-0x5d, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5e, 0x00, 
-0x5d, 0x00, 0x5c, 0x00, 0x5c, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5f, 0x00, 
-0x5f, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 
-0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5d, 0x00, 
-0x5d, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5e, 0x00, 
-0x5e, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00, 
-0x5e, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5d, 0x00, 
-0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5f, 0x00, 
-0x60, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x61, 0x00, 
-0x60, 0x00, 0x5e, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5f, 0x00, 
-0x61, 0x00, 0x61, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x60, 0x00, 
-0x60, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x61, 0x00, 0x63, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x60, 0x00, 
-0x61, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x60, 0x00, 
-0x5f, 0x00, 0x5f, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x62, 0x00, 
-0x62, 0x00, 0x61, 0x00, 0x61, 0x00, 0x62, 0x00, 0x60, 0x00, 0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 
-0x61, 0x00, 0x61, 0x00, 0x62, 0x00, 0x62, 0x00, 0x61, 0x00, 0x60, 0x00, 0x61, 0x00, 0x61, 0x00, 
-0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x60, 0x00, 0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 0x62, 0x00, 
-0x60, 0x00, 0x60, 0x00, 0x62, 0x00, 0x62, 0x00, 0x62, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 
-0x61, 0x00, 0x62, 0x00, 0x63, 0x00, 0x61, 0x00, 0x61, 0x00, 0x62, 0x00, 0x62, 0x00, 0x5f, 0x00, 
-0x60, 0x00, 0x61, 0x00, 0x61, 0x00, 0x62, 0x00, 0x61, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x60, 0x00, 
-0x61, 0x00, 0x62, 0x00, 0x61, 0x00, 0x62, 0x00, 0x62, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 
-0x61, 0x00, 0x63, 0x00, 0x63, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x61, 0x00, 0x61, 0x00, 
-0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x60, 0x00, 0x60, 0x00, 
-0x5f, 0x00, 0x60, 0x00, 0x61, 0x00, 0x61, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5f, 0x00, 
-0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x61, 0x00, 0x5f, 0x00, 0x5e, 0x00, 
-0x5f, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5f, 0x00, 
-0x5e, 0x00, 0x5d, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5e, 0x00, 
-0x5f, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x60, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x5f, 0x00, 
-0x5e, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5e, 0x00, 
-0x5f, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5d, 0x00, 
-0x5d, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x5d, 0x00, 
-0x5b, 0x00, 0x5c, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5c, 0x00, 
-0x5c, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x5b, 0x00, 
-0x5c, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x59, 0x00, 
-0x5a, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x58, 0x00, 
-0x57, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x57, 0x00, 0x57, 0x00, 0x57, 0x00, 
-0x57, 0x00, 0x58, 0x00, 0x58, 0x00, 0x57, 0x00, 0x57, 0x00, 0x58, 0x00, 0x57, 0x00, 0x55, 0x00, 
-0x56, 0x00, 0x57, 0x00, 0x56, 0x00, 0x56, 0x00, 0x56, 0x00, 0x54, 0x00, 0x54, 0x00, 0x56, 0x00, 
-0x55, 0x00, 0x53, 0x00, 0x54, 0x00, 0x54, 0x00, 0x55, 0x00, 0x54, 0x00, 0x51, 0x00, 0x52, 0x00, 
-0x54, 0x00, 0x53, 0x00, 0x52, 0x00, 0x52, 0x00, 0x53, 0x00, 0x55, 0x00, 0x54, 0x00, 0x51, 0x00, 
-0x52, 0x00, 0x53, 0x00, 0x52, 0x00, 0x52, 0x00, 0x52, 0x00, 0x52, 0x00, 0x52, 0x00, 0x52, 0x00, 
-0x51, 0x00, 0x51, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x4f, 0x00, 0x4f, 0x00, 0x4f, 0x00, 
-0x4f, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x4e, 0x00, 0x4d, 0x00, 0x4e, 0x00, 
-0x4c, 0x00, 0x4d, 0x00, 0x4f, 0x00, 0x4f, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x4c, 0x00, 0x4d, 0x00, 
-0x4d, 0x00, 0x4d, 0x00, 0x4c, 0x00, 0x4b, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x49, 0x00, 0x4a, 0x00, 
-0x4c, 0x00, 0x4b, 0x00, 0x4a, 0x00, 0x4a, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x48, 0x00, 
-0x49, 0x00, 0x4a, 0x00, 0x48, 0x00, 0x48, 0x00, 0x47, 0x00, 0x47, 0x00, 0x47, 0x00, 0x47, 0x00, 
-0x46, 0x00, 0x46, 0x00, 0x46, 0x00, 0x45, 0x00, 0x46, 0x00, 0x46, 0x00, 0x45, 0x00, 0x44, 0x00, 
-0x45, 0x00, 0x45, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x45, 0x00, 0x44, 0x00, 0x45, 0x00, 
-0x44, 0x00, 0x43, 0x00, 0x44, 0x00, 0x43, 0x00, 0x42, 0x00, 0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 
-0x41, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
-0x3e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x37, 0x00, 0x38, 0x00, 0x3b, 0x00, 0x39, 0x00, 0x37, 0x00, 0x39, 0x00, 
-0x38, 0x00, 0x36, 0x00, 0x38, 0x00, 0x36, 0x00, 0x35, 0x00, 0x37, 0x00, 0x36, 0x00, 0x34, 0x00, 
-0x38, 0x00, 0x36, 0x00, 0x34, 0x00, 0x36, 0x00, 0x36, 0x00, 0x32, 0x00, 0x34, 0x00, 0x35, 0x00, 
-0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x32, 0x00, 0x31, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 
-0x2f, 0x00, 0x2f, 0x00, 0x31, 0x00, 0x30, 0x00, 0x30, 0x00, 0x32, 0x00, 0x31, 0x00, 0x2e, 0x00, 
-0x2e, 0x00, 0x30, 0x00, 0x2f, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2d, 0x00, 0x2e, 0x00, 
-0x2d, 0x00, 0x2c, 0x00, 0x2b, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2b, 0x00, 0x2a, 0x00, 
-0x2a, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x29, 0x00, 0x28, 0x00, 0x28, 0x00, 0x29, 0x00, 0x28, 0x00, 
-0x27, 0x00, 0x27, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x27, 0x00, 0x25, 0x00, 0x25, 0x00, 
-0x26, 0x00, 0x27, 0x00, 0x27, 0x00, 0x25, 0x00, 0x25, 0x00, 0x27, 0x00, 0x27, 0x00, 0x24, 0x00, 
-0x24, 0x00, 0x25, 0x00, 0x24, 0x00, 0x26, 0x00, 0x25, 0x00, 0x23, 0x00, 0x24, 0x00, 0x23, 0x00, 
-0x22, 0x00, 0x23, 0x00, 0x22, 0x00, 0x20, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 
-0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x1d, 0x00, 0x1c, 0x00, 
-0x1d, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1c, 0x00, 0x1b, 0x00, 
-0x1c, 0x00, 0x1b, 0x00, 0x1a, 0x00, 0x1c, 0x00, 0x1b, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 
-0x1b, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x19, 0x00, 0x18, 0x00, 0x19, 0x00, 0x19, 0x00, 0x17, 0x00, 
-0x16, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x16, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x14, 0x00, 0x14, 0x00, 0x15, 0x00, 0x15, 0x00, 
-0x14, 0x00, 0x13, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 
-0x12, 0x00, 0x12, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 
-0x0e, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0d, 0x00, 0x0d, 0x00, 
-0x0e, 0x00, 0x0d, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0c, 0x00, 
-0x0c, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x09, 0x00, 0x0a, 0x00, 
-0x0a, 0x00, 0x08, 0x00, 0x09, 0x00, 0x09, 0x00, 0x08, 0x00, 0x09, 0x00, 0x09, 0x00, 0x06, 0x00, 
-0x07, 0x00, 0x09, 0x00, 0x08, 0x00, 0x08, 0x00, 0x06, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 
-0x05, 0x00, 0x04, 0x00, 0x05, 0x00, 0x05, 0x00, 0x06, 0x00, 0x05, 0x00, 0x04, 0x00, 0x03, 0x00, 
-0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x04, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 
-0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 
-0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfd, 0xff, 
-0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xff, 
-0xfd, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfc, 0xff, 
-0xfb, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfc, 0xff, 
-0xfd, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfb, 0xff, 
-0xfb, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xf9, 0xff, 
-0xfb, 0xff, 0xfb, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xfc, 0xff, 
-0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xfb, 0xff, 
-0xfb, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xf9, 0xff, 
-0xf9, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 
-0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 
-0xf9, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 
-0xf8, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xfa, 0xff, 
-0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfa, 0xff, 
-0xfb, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfb, 0xff, 
-0xfc, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfd, 0xff, 
-0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 
-0xfd, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 
-0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 
-0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x02, 0x00, 
-0x02, 0x00, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 0x04, 0x00, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 
-0x03, 0x00, 0x03, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x04, 0x00, 0x04, 0x00, 
-0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05, 0x00, 0x07, 0x00, 0x07, 0x00, 
-0x06, 0x00, 0x07, 0x00, 0x09, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x09, 0x00, 0x09, 0x00, 
-0x08, 0x00, 0x07, 0x00, 0x07, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x09, 0x00, 
-0x0a, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x0c, 0x00, 
-0x0b, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0c, 0x00, 
-0x0e, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0d, 0x00, 
-0x0c, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x10, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 
-0x10, 0x00, 0x12, 0x00, 0x13, 0x00, 0x13, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x13, 0x00, 
-0x15, 0x00, 0x13, 0x00, 0x12, 0x00, 0x14, 0x00, 0x15, 0x00, 0x14, 0x00, 0x14, 0x00, 0x15, 0x00, 
-0x16, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-0x17, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x19, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x19, 0x00, 
-0x1a, 0x00, 0x1b, 0x00, 0x1a, 0x00, 0x19, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1b, 0x00, 
-0x1a, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1b, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 
-0x1b, 0x00, 0x1b, 0x00, 0x1e, 0x00, 0x1d, 0x00, 0x1c, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1d, 0x00, 
-0x1d, 0x00, 0x1e, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x20, 0x00, 0x1f, 0x00, 0x1d, 0x00, 0x1f, 0x00, 
-0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x22, 0x00, 0x22, 0x00, 0x23, 0x00, 
-0x24, 0x00, 0x22, 0x00, 0x20, 0x00, 0x23, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x23, 0x00, 
-0x22, 0x00, 0x24, 0x00, 0x24, 0x00, 0x23, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x25, 0x00, 
-0x25, 0x00, 0x26, 0x00, 0x26, 0x00, 0x25, 0x00, 0x27, 0x00, 0x27, 0x00, 0x25, 0x00, 0x27, 0x00, 
-0x28, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x28, 0x00, 0x27, 0x00, 0x29, 0x00, 0x29, 0x00, 
-0x29, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x29, 0x00, 0x29, 0x00, 0x2b, 0x00, 0x2b, 0x00, 0x2a, 0x00, 
-0x2a, 0x00, 0x2b, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 
-0x2c, 0x00, 0x2b, 0x00, 0x2b, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2d, 0x00, 
-0x2c, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x2f, 0x00, 
-0x2f, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x2e, 0x00, 0x2d, 0x00, 0x31, 0x00, 0x31, 0x00, 0x2e, 0x00, 
-0x2f, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x30, 0x00, 0x31, 0x00, 0x31, 0x00, 
-0x31, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 
-0x31, 0x00, 0x33, 0x00, 0x34, 0x00, 0x32, 0x00, 0x32, 0x00, 0x33, 0x00, 0x32, 0x00, 0x34, 0x00, 
-0x34, 0x00, 0x33, 0x00, 0x35, 0x00, 0x35, 0x00, 0x32, 0x00, 0x33, 0x00, 0x35, 0x00, 0x35, 0x00, 
-0x34, 0x00, 0x34, 0x00, 0x35, 0x00, 0x35, 0x00, 0x34, 0x00, 0x36, 0x00, 0x37, 0x00, 0x35, 0x00, 
-0x34, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x36, 0x00, 0x34, 0x00, 0x35, 0x00, 
-0x37, 0x00, 0x38, 0x00, 0x36, 0x00, 0x35, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x36, 0x00, 
-0x35, 0x00, 0x36, 0x00, 0x38, 0x00, 0x37, 0x00, 0x35, 0x00, 0x37, 0x00, 0x38, 0x00, 0x36, 0x00, 
-0x37, 0x00, 0x39, 0x00, 0x37, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 0x39, 0x00, 0x3a, 0x00, 
-0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 
-0x3c, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 
-0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 
-0x3b, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 
-0x39, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 
-0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3c, 0x00, 
-0x3d, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3c, 0x00, 
-0x3f, 0x00, 0x3d, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 
-0x3d, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 
-0x3b, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 
-0x3d, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3d, 0x00, 
-0x3d, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3b, 0x00, 
-0x39, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 
-0x3d, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3b, 0x00, 
-0x3c, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 
-0x3a, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x39, 0x00, 0x39, 0x00, 
-0x3c, 0x00, 0x3d, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 
-0x3b, 0x00, 0x39, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 
-0x3a, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x39, 0x00, 
-0x3a, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x37, 0x00, 0x39, 0x00, 0x3a, 0x00, 
-0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x38, 0x00, 0x39, 0x00, 0x39, 0x00, 0x37, 0x00, 0x39, 0x00, 
-0x39, 0x00, 0x37, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x37, 0x00, 
-0x38, 0x00, 0x37, 0x00, 0x36, 0x00, 0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 0x37, 0x00, 
-0x37, 0x00, 0x37, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x38, 0x00, 
-0x38, 0x00, 0x38, 0x00, 0x39, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x37, 0x00, 
-0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 0x35, 0x00, 0x35, 0x00, 0x37, 0x00, 0x36, 0x00, 0x36, 0x00, 
-0x38, 0x00, 0x37, 0x00, 0x35, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x37, 0x00, 0x37, 0x00, 
-0x36, 0x00, 0x35, 0x00, 0x36, 0x00, 0x34, 0x00, 0x34, 0x00, 0x36, 0x00, 0x34, 0x00, 0x34, 0x00, 
-0x35, 0x00, 0x35, 0x00, 0x34, 0x00, 0x35, 0x00, 0x35, 0x00, 0x34, 0x00, 0x34, 0x00, 0x35, 0x00, 
-0x36, 0x00, 0x36, 0x00, 0x33, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x34, 0x00, 
-0x31, 0x00, 0x32, 0x00, 0x35, 0x00, 0x36, 0x00, 0x36, 0x00, 0x35, 0x00, 0x34, 0x00, 0x33, 0x00, 
-0x33, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x33, 0x00, 0x32, 0x00, 0x32, 0x00, 0x33, 0x00, 
-0x34, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x32, 0x00, 0x31, 0x00, 0x32, 0x00, 
-0x33, 0x00, 0x32, 0x00, 0x32, 0x00, 0x33, 0x00, 0x32, 0x00, 0x32, 0x00, 0x31, 0x00, 0x32, 0x00, 
-0x33, 0x00, 0x34, 0x00, 0x32, 0x00, 0x30, 0x00, 0x30, 0x00, 0x31, 0x00, 0x33, 0x00, 0x34, 0x00, 
-0x32, 0x00, 0x31, 0x00, 0x31, 0x00, 0x30, 0x00, 0x31, 0x00, 0x33, 0x00, 0x32, 0x00, 0x31, 0x00, 
-0x30, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x31, 0x00, 0x32, 0x00, 0x31, 0x00, 0x2f, 0x00, 
-0x31, 0x00, 0x31, 0x00, 0x2f, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2f, 0x00, 
-0x2f, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x30, 0x00, 0x2d, 0x00, 0x2e, 0x00, 
-0x30, 0x00, 0x30, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x30, 0x00, 0x30, 0x00, 0x2f, 0x00, 0x30, 0x00, 
-0x2f, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x2f, 0x00, 0x2d, 0x00, 
-0x2d, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x2e, 0x00, 0x2d, 0x00, 0x2d, 0x00, 
-0x2e, 0x00, 0x2f, 0x00, 0x2e, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2c, 0x00, 0x2d, 0x00, 
-0x2d, 0x00, 0x2d, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2d, 0x00, 
-0x2d, 0x00, 0x2d, 0x00, 0x2c, 0x00, 0x2b, 0x00, 0x2d, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2d, 0x00, 
-0x2b, 0x00, 0x2a, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2e, 0x00, 
-0x2c, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2c, 0x00, 0x2c, 0x00, 
-0x2c, 0x00, 0x2b, 0x00, 0x2a, 0x00, 0x2d, 0x00, 0x2c, 0x00, 0x2b, 0x00, 0x2b, 0x00, 0x2a, 0x00, 
-0x2a, 0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2a, 0x00, 0x28, 0x00, 0x2c, 0x00, 0x2c, 0x00, 
-0x29, 0x00, 0x2a, 0x00, 0x2c, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x2b, 0x00, 
-0x2a, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2a, 0x00, 0x29, 0x00, 0x29, 0x00, 0x29, 0x00, 0x29, 0x00, 
-0x2a, 0x00, 0x29, 0x00, 0x29, 0x00, 0x28, 0x00, 0x27, 0x00, 0x29, 0x00, 0x2b, 0x00, 0x2a, 0x00, 
-0x28, 0x00, 0x27, 0x00, 0x28, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x2b, 0x00, 
-0x2b, 0x00, 0x29, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x28, 0x00, 
-0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x29, 0x00, 0x29, 0x00, 0x28, 0x00, 0x29, 0x00, 0x28, 0x00, 
-0x28, 0x00, 0x29, 0x00, 0x29, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 
-0x28, 0x00, 0x28, 0x00, 0x29, 0x00, 0x29, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x29, 0x00, 0x28, 0x00, 
-0x28, 0x00, 0x29, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x28, 0x00, 0x27, 0x00, 0x29, 0x00, 
-0x29, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 
-0x29, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x27, 0x00, 
-0x26, 0x00, 0x27, 0x00, 0x26, 0x00, 0x27, 0x00, 0x27, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 
-0x26, 0x00, 0x26, 0x00, 0x26, 0x00, 0x27, 0x00, 0x29, 0x00, 0x27, 0x00, 0x27, 0x00, 0x28, 0x00, 
-0x27, 0x00, 0x26, 0x00, 0x27, 0x00, 0x27, 0x00, 0x26, 0x00, 0x26, 0x00, 0x26, 0x00, 0x27, 0x00, 
-0x26, 0x00, 0x26, 0x00, 0x27, 0x00, 0x25, 0x00, 0x25, 0x00, 0x28, 0x00, 0x28, 0x00, 0x27, 0x00, 
-0x26, 0x00, 0x26, 0x00, 0x26, 0x00, 0x26, 0x00, 0x24, 0x00, 0x25, 0x00, 0x28, 0x00, 0x27, 0x00, 
-0x26, 0x00, 0x27, 0x00, 0x26, 0x00, 0x25, 0x00, 0x25, 0x00, 0x24, 0x00, 0x24, 0x00, 0x25, 0x00, 
-0x25, 0x00, 0x25, 0x00, 0x25, 0x00, 0x25, 0x00, 0x24, 0x00, 0x25, 0x00, 0x25, 0x00, 0x24, 0x00, 
-0x25, 0x00, 0x26, 0x00, 0x24, 0x00, 0x24, 0x00, 0x27, 0x00, 0x27, 0x00, 0x26, 0x00, 0x25, 0x00, 
-0x25, 0x00, 0x26, 0x00, 0x25, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x26, 0x00, 
-0x26, 0x00, 0x23, 0x00, 0x23, 0x00, 0x25, 0x00, 0x26, 0x00, 0x25, 0x00, 0x25, 0x00, 0x25, 0x00, 
-0x25, 0x00, 0x25, 0x00, 0x25, 0x00, 0x25, 0x00, 0x23, 0x00, 0x23, 0x00, 0x25, 0x00, 0x25, 0x00, 
-0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 0x22, 0x00, 0x22, 0x00, 0x24, 0x00, 0x25, 0x00, 0x25, 0x00, 
-0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 0x22, 0x00, 0x22, 0x00, 0x23, 0x00, 0x23, 0x00, 0x21, 0x00, 
-0x23, 0x00, 0x22, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22, 0x00, 0x21, 0x00, 0x22, 0x00, 0x22, 0x00, 
-0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x21, 0x00, 0x20, 0x00, 0x21, 0x00, 
-0x20, 0x00, 0x20, 0x00, 0x21, 0x00, 0x20, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22, 0x00, 
-0x21, 0x00, 0x20, 0x00, 0x21, 0x00, 0x20, 0x00, 0x1f, 0x00, 0x21, 0x00, 0x20, 0x00, 0x1e, 0x00, 
-0x1f, 0x00, 0x1f, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x1f, 0x00, 0x1c, 0x00, 
-0x1c, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x1e, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x1e, 0x00, 
-0x1e, 0x00, 0x1d, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1d, 0x00, 
-0x1c, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1c, 0x00, 
-0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1b, 0x00, 0x19, 0x00, 0x19, 0x00, 
-0x1c, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x1a, 0x00, 0x18, 0x00, 
-0x18, 0x00, 0x19, 0x00, 0x18, 0x00, 0x18, 0x00, 0x19, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 
-0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x18, 0x00, 0x17, 0x00, 0x16, 0x00, 0x18, 0x00, 0x18, 0x00, 
-0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x14, 0x00, 0x15, 0x00, 0x19, 0x00, 0x17, 0x00, 0x15, 0x00, 
-0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x17, 0x00, 0x16, 0x00, 0x15, 0x00, 0x15, 0x00, 0x16, 0x00, 
-0x16, 0x00, 0x15, 0x00, 0x14, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x14, 0x00, 0x13, 0x00, 
-0x13, 0x00, 0x14, 0x00, 0x14, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 
-0x11, 0x00, 0x12, 0x00, 0x14, 0x00, 0x15, 0x00, 0x13, 0x00, 0x12, 0x00, 0x12, 0x00, 0x10, 0x00, 
-0x10, 0x00, 0x12, 0x00, 0x12, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 
-0x10, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x10, 0x00, 0x11, 0x00, 0x0f, 0x00, 
-0x0e, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x0e, 0x00, 0x0d, 0x00, 
-0x0e, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x0b, 0x00, 
-0x0c, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x0d, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x0b, 0x00, 
-0x0c, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 
-0x0b, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x08, 0x00, 0x0a, 0x00, 
-0x0a, 0x00, 0x07, 0x00, 0x08, 0x00, 0x08, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x08, 0x00, 
-0x08, 0x00, 0x07, 0x00, 0x05, 0x00, 0x07, 0x00, 0x08, 0x00, 0x07, 0x00, 0x08, 0x00, 0x08, 0x00, 
-0x06, 0x00, 0x06, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 
-0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x05, 0x00, 0x06, 0x00, 
-0x06, 0x00, 0x05, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05, 0x00, 0x07, 0x00, 0x05, 0x00, 0x03, 0x00, 
-0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x03, 0x00, 0x03, 0x00, 0x05, 0x00, 0x05, 0x00, 
-0x04, 0x00, 0x03, 0x00, 0x03, 0x00, 0x05, 0x00, 0x05, 0x00, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 
-0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x02, 0x00, 
-0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x04, 0x00, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 
-0x03, 0x00, 0x02, 0x00, 0x04, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05, 0x00, 0x05, 0x00, 0x02, 0x00, 
-0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 0x04, 0x00, 
-0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 
-0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x05, 0x00, 0x02, 0x00, 
-0x02, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 
-0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x05, 0x00, 0x02, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 
-0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x00, 0x03, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 
-0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x01, 0x00, 0x01, 0x00, 
-0x05, 0x00, 0x03, 0x00, 0x02, 0x00, 0x05, 0x00, 0x03, 0x00, 0x01, 0x00, 0x05, 0x00, 0x06, 0x00, 
-0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x02, 0x00, 
-0x02, 0x00, 0x04, 0x00, 0x05, 0x00, 0x05, 0x00, 0x04, 0x00, 0x02, 0x00, 0x05, 0x00, 0x06, 0x00, 
-0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0xff, 0x03, 0x00, 0x06, 0x00, 0x03, 0x00, 0x04, 0x00, 
-0x06, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 
-0x05, 0x00, 0x09, 0x00, 0x05, 0x00, 0x03, 0x00, 0x04, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 
-0x05, 0x00, 0x04, 0x00, 0x07, 0x00, 0x08, 0x00, 0x07, 0x00, 0x07, 0x00, 0x06, 0x00, 0x09, 0x00, 
-0x10, 0x00, 0x11, 0x00, 0x0b, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x16, 0x00, 0x11, 0x00, 
-0x0e, 0x00, 0x11, 0x00, 0x10, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0f, 0x00, 0x11, 0x00, 0x0d, 0x00, 
-0x06, 0x00, 0x06, 0x00, 0x04, 0x00, 0xff, 0xff, 0x04, 0x00, 0x07, 0x00, 0x01, 0x00, 0x06, 0x00, 
-0x0c, 0x00, 0x03, 0x00, 0x01, 0x00, 0x09, 0x00, 0x08, 0x00, 0x06, 0x00, 0x08, 0x00, 0x08, 0x00, 
-0x08, 0x00, 0x08, 0x00, 0x06, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x08, 0x00, 
-0x0e, 0x00, 0x0e, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0b, 0x00, 
-0x0b, 0x00, 0x0e, 0x00, 0x0d, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x09, 0x00, 0x06, 0x00, 
-0x03, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x08, 0x00, 0x07, 0x00, 0x05, 0x00, 0x04, 0x00, 0x06, 0x00, 
-0x04, 0x00, 0x02, 0x00, 0x06, 0x00, 0x02, 0x00, 0xfe, 0xff, 0x06, 0x00, 0x09, 0x00, 0x02, 0x00, 
-0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0xfe, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xf4, 0xff, 0xf3, 0xff, 
-0xfb, 0xff, 0xfd, 0xff, 0xf6, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xf1, 0xff, 0xf2, 0xff, 
-0xf4, 0xff, 0xf3, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xf6, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xf0, 0xff, 
-0xee, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf3, 0xff, 0xf5, 0xff, 0xf1, 0xff, 0xf5, 0xff, 0xf6, 0xff, 
-0xf1, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf3, 0xff, 0xf6, 0xff, 0xf3, 0xff, 0xeb, 0xff, 0xed, 0xff, 
-0xf1, 0xff, 0xef, 0xff, 0xef, 0xff, 0xed, 0xff, 0xeb, 0xff, 0xf1, 0xff, 0xf3, 0xff, 0xf1, 0xff, 
-0xf1, 0xff, 0xf1, 0xff, 0xf2, 0xff, 0xf4, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf6, 0xff, 0xf6, 0xff, 
-0xf5, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xef, 0xff, 0xef, 0xff, 0xec, 0xff, 0xe8, 0xff, 0xec, 0xff, 
-0xf1, 0xff, 0xee, 0xff, 0xeb, 0xff, 0xed, 0xff, 0xed, 0xff, 0xea, 0xff, 0xec, 0xff, 0xee, 0xff, 
-0xeb, 0xff, 0xec, 0xff, 0xf1, 0xff, 0xef, 0xff, 0xec, 0xff, 0xee, 0xff, 0xec, 0xff, 0xea, 0xff, 
-0xee, 0xff, 0xef, 0xff, 0xf1, 0xff, 0xf4, 0xff, 0xee, 0xff, 0xea, 0xff, 0xf1, 0xff, 0xf0, 0xff, 
-0xee, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xfa, 0xff, 
-0xfa, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xfd, 0xff, 0x01, 0x00, 0xfd, 0xff, 
-0xfb, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 
-0xfa, 0xff, 0xf5, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xf7, 0xff, 
-0xf8, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfa, 0xff, 
-0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0xfe, 0xff, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x05, 0x00, 0x04, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xfe, 0xff, 
-0xfd, 0xff, 0xfb, 0xff, 0x01, 0x00, 0x00, 0x00, 0xf7, 0xff, 0xfd, 0xff, 0x03, 0x00, 0xfe, 0xff, 
-0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0xfe, 0xff, 0x04, 0x00, 0x05, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 0x06, 0x00, 0x05, 0x00, 0xff, 0xff, 
-0xff, 0xff, 0x06, 0x00, 0x05, 0x00, 0x02, 0x00, 0x07, 0x00, 0x07, 0x00, 0x04, 0x00, 0x06, 0x00, 
-0x08, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0a, 0x00, 0x0a, 0x00, 
-0x0a, 0x00, 0x07, 0x00, 0x08, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x02, 0x00, 
-0x08, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x09, 0x00, 0x08, 0x00, 0x0b, 0x00, 
-0x06, 0x00, 0x01, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x09, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 
-0x03, 0x00, 0x04, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x06, 0x00, 0x02, 0x00, 
-0x01, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09, 0x00, 0x04, 0x00, 0x05, 0x00, 
-0x06, 0x00, 0x04, 0x00, 0x05, 0x00, 0x08, 0x00, 0x08, 0x00, 0x06, 0x00, 0x06, 0x00, 0x04, 0x00, 
-0xff, 0xff, 0x02, 0x00, 0x0a, 0x00, 0x07, 0x00, 0x03, 0x00, 0x02, 0x00, 0xfe, 0xff, 0xfe, 0xff, 
-0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x04, 0x00, 0x03, 0x00, 0x02, 0x00, 0xff, 0xff, 
-0x04, 0x00, 0x07, 0x00, 0xff, 0xff, 0x00, 0x00, 0x03, 0x00, 0xff, 0xff, 0x01, 0x00, 0x08, 0x00, 
-0x02, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x04, 0x00, 0x00, 0x00, 0xfb, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x00, 0x00, 0xfe, 0xff, 
-0xff, 0xff, 0x00, 0x00, 0xfd, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x00, 0x00, 0xfc, 0xff, 0xf9, 0xff, 
-0xfa, 0xff, 0xfe, 0xff, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0xfc, 0xff, 
-0xfa, 0xff, 0xfc, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfa, 0xff, 0xfe, 0xff, 
-0xfb, 0xff, 0xf6, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0x01, 0x00, 0xfc, 0xff, 0xf9, 0xff, 
-0xfd, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0x02, 0x00, 0xfd, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xfa, 0xff, 0x03, 0x00, 0x01, 0x00, 0xfc, 0xff, 0x01, 0x00, 
-0x05, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfa, 0xff, 
-0xf9, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xf6, 0xff, 0xf2, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xfb, 0xff, 
-0xfc, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xfe, 0xff, 
-0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfa, 0xff, 
-0xfc, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0x00, 0x00, 0xfc, 0xff, 
-0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0xfb, 0xff, 
-0xfb, 0xff, 0xf4, 0xff, 0xf6, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xf5, 0xff, 0xf7, 0xff, 0xfe, 0xff, 
-0xfc, 0xff, 0xf5, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xf6, 0xff, 
-0xf5, 0xff, 0xf4, 0xff, 0xec, 0xff, 0xea, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf1, 0xff, 0xf4, 0xff, 
-0xf3, 0xff, 0xf2, 0xff, 0xf6, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf5, 0xff, 0xf0, 0xff, 0xed, 0xff, 
-0xee, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf0, 0xff, 0xec, 0xff, 0xf8, 0xff, 0xfd, 0xff, 
-0xf5, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xf3, 0xff, 0xf1, 0xff, 0xf6, 0xff, 0xf8, 0xff, 0xf8, 0xff, 
-0xf5, 0xff, 0xf3, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xf3, 0xff, 0xf3, 0xff, 0xf2, 0xff, 0xf5, 0xff, 
-0xf8, 0xff, 0xf5, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0xf9, 0xff, 
-0xfc, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfc, 0xff, 
-0xfd, 0xff, 0xfb, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0x00, 0x00, 0xff, 0xff, 
-0x03, 0x00, 0x05, 0x00, 0x01, 0x00, 0x03, 0x00, 0x09, 0x00, 0x07, 0x00, 0x02, 0x00, 0x03, 0x00, 
-0x05, 0x00, 0x0a, 0x00, 0x0d, 0x00, 0x08, 0x00, 0x08, 0x00, 0x09, 0x00, 0x07, 0x00, 0x06, 0x00, 
-0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0xfe, 0xff, 0x03, 0x00, 0x08, 0x00, 0x03, 0x00, 
-0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0xff, 0xff, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x05, 0x00, 
-0x07, 0x00, 0x07, 0x00, 0x02, 0x00, 0x03, 0x00, 0x05, 0x00, 0x02, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x03, 0x00, 0x03, 0x00, 
-0x05, 0x00, 0x06, 0x00, 0x04, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x00, 
-0x02, 0x00, 0x03, 0x00, 0x09, 0x00, 0x09, 0x00, 0x06, 0x00, 0x05, 0x00, 0x01, 0x00, 0xfe, 0xff, 
-0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 
-0xf9, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0x02, 0x00, 0x01, 0x00, 0xf9, 0xff, 0xf8, 0xff, 0xfe, 0xff, 
-0xfb, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 
-0xf9, 0xff, 0xf5, 0xff, 0xf1, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 
-0xf6, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0x01, 0x00, 0xfd, 0xff, 0xf5, 0xff, 0xf3, 0xff, 
-0xee, 0xff, 0xef, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xee, 0xff, 0xf3, 0xff, 0xf5, 0xff, 0xf3, 0xff, 
-0xf5, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf2, 0xff, 0xf1, 0xff, 0xef, 0xff, 
-0xef, 0xff, 0xf3, 0xff, 0xf1, 0xff, 0xed, 0xff, 0xed, 0xff, 0xef, 0xff, 0xf3, 0xff, 0xf2, 0xff, 
-0xee, 0xff, 0xf1, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf2, 0xff, 0xed, 0xff, 0xf1, 0xff, 0xf6, 0xff, 
-0xf4, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfc, 0xff, 
-0xf8, 0xff, 0xf5, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf0, 0xff, 0xee, 0xff, 
-0xf1, 0xff, 0xf2, 0xff, 0xf3, 0xff, 0xf5, 0xff, 0xf6, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0xff, 
-0xfb, 0xff, 0xf6, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0x02, 0x00, 0x02, 0x00, 
-0x02, 0x00, 0x03, 0x00, 0x06, 0x00, 0x04, 0x00, 0xff, 0xff, 0x04, 0x00, 0x0a, 0x00, 0x05, 0x00, 
-0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x01, 0x00, 0x04, 0x00, 0x08, 0x00, 
-0x02, 0x00, 0x04, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0b, 0x00, 
-0x08, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0xfe, 0xff, 0x02, 0x00, 0x03, 0x00, 0x02, 0x00, 
-0x06, 0x00, 0x09, 0x00, 0x08, 0x00, 0x03, 0x00, 0xff, 0xff, 0x03, 0x00, 0x08, 0x00, 0x08, 0x00, 
-0x06, 0x00, 0x05, 0x00, 0x06, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x05, 0x00, 0x04, 0x00, 
-0x05, 0x00, 0x05, 0x00, 0x02, 0x00, 0x02, 0x00, 0x05, 0x00, 0x09, 0x00, 0x07, 0x00, 0x01, 0x00, 
-0x04, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x07, 0x00, 0x05, 0x00, 0x08, 0x00, 0x0b, 0x00, 0x06, 0x00, 
-0x05, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x01, 0x00, 0x05, 0x00, 0x05, 0x00, 0xff, 0xff, 0xfe, 0xff, 
-0x00, 0x00, 0x04, 0x00, 0x06, 0x00, 0x01, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x04, 0x00, 
-0x07, 0x00, 0x08, 0x00, 0x08, 0x00, 0x06, 0x00, 0x06, 0x00, 0x09, 0x00, 0x08, 0x00, 0x04, 0x00, 
-0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x09, 0x00, 
-0x06, 0x00, 0x05, 0x00, 0x06, 0x00, 0x08, 0x00, 0x09, 0x00, 0x05, 0x00, 0x02, 0x00, 0x06, 0x00, 
-0x09, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x0f, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0xfd, 0xff, 0xfd, 0xff, 0x00, 0x00, 
-0xfe, 0xff, 0xfe, 0xff, 0x01, 0x00, 0x03, 0x00, 0x06, 0x00, 0x03, 0x00, 0xff, 0xff, 0xfc, 0xff, 
-0xfb, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0x03, 0x00, 
-0x01, 0x00, 0xfc, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 
-0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0xf6, 0xff, 
-0xfc, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xff, 
-0xfa, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xf5, 0xff, 
-0xf6, 0xff, 0x00, 0x00, 0xfa, 0xff, 0xf8, 0xff, 0x00, 0x00, 0xf9, 0xff, 0xf5, 0xff, 0xfa, 0xff, 
-0xf5, 0xff, 0xf4, 0xff, 0xf9, 0xff, 0xf6, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf5, 0xff, 
-0xf5, 0xff, 0xf1, 0xff, 0xf3, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfd, 0xff, 
-0xff, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfa, 0xff, 
-0xfd, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfc, 0xff, 
-0x00, 0x00, 0xfd, 0xff, 0xfc, 0xff, 0x03, 0x00, 0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 
-0xfc, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xfe, 0xff, 0xfc, 0xff, 0xfc, 0xff, 
-0xf9, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xf7, 0xff, 0xfa, 0xff, 0x02, 0x00, 0x00, 0x00, 
-0xfb, 0xff, 0x01, 0x00, 0x03, 0x00, 0xfc, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xfa, 0xff, 
-0xff, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0x00, 0x00, 0xfc, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xf6, 0xff, 
-0xf5, 0xff, 0xf4, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xee, 0xff, 
-0xf4, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfc, 0xff, 
-0xfd, 0xff, 0xfc, 0xff, 0xfa, 0xff, 0xfc, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0x01, 0x00, 
-0xfd, 0xff, 0xf6, 0xff, 0xf0, 0xff, 0xf2, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf4, 0xff, 
-0xf2, 0xff, 0xf3, 0xff, 0xf2, 0xff, 0xf8, 0xff, 0x00, 0x00, 0xf9, 0xff, 0xf4, 0xff, 0xfa, 0xff, 
-0xfb, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xf3, 0xff, 0xef, 0xff, 0xe8, 0xff, 0xe7, 0xff, 0xf2, 0xff, 
-0xf1, 0xff, 0xe7, 0xff, 0xea, 0xff, 0xee, 0xff, 0xea, 0xff, 0xec, 0xff, 0xed, 0xff, 0xee, 0xff, 
-0xf1, 0xff, 0xf3, 0xff, 0xf5, 0xff, 0xf2, 0xff, 0xee, 0xff, 0xf0, 0xff, 0xef, 0xff, 0xed, 0xff, 
-0xf5, 0xff, 0xf9, 0xff, 0xf4, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf2, 0xff, 0xf6, 0xff, 0xf9, 0xff, 
-0xf6, 0xff, 0xfa, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 
-0x01, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 
-0x0a, 0x00, 0x04, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x04, 0x00, 0x03, 0x00, 0x04, 0x00, 0x06, 0x00, 
-0x03, 0x00, 0x02, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x0f, 0x00, 
-0x10, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0b, 0x00, 0x10, 0x00, 0x12, 0x00, 0x0f, 0x00, 
-0x11, 0x00, 0x11, 0x00, 0x0a, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0a, 0x00, 
-0x10, 0x00, 0x11, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x14, 0x00, 0x12, 0x00, 0x14, 0x00, 
-0x16, 0x00, 0x17, 0x00, 0x13, 0x00, 0x10, 0x00, 0x11, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x13, 0x00, 
-0x18, 0x00, 0x16, 0x00, 0x15, 0x00, 0x14, 0x00, 0x17, 0x00, 0x17, 0x00, 0x0e, 0x00, 0x0e, 0x00, 
-0x16, 0x00, 0x12, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x0a, 0x00, 0x07, 0x00, 0x09, 0x00, 0x07, 0x00, 
-0x02, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x16, 0x00, 0x0d, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x12, 0x00, 
-0x10, 0x00, 0x13, 0x00, 0x16, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x0d, 0x00, 0x08, 0x00, 
-0x06, 0x00, 0x0a, 0x00, 0x0d, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x0b, 0x00, 0x08, 0x00, 0x0b, 0x00, 
-0x0c, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x05, 0x00, 0x08, 0x00, 0x0d, 0x00, 0x08, 0x00, 0x08, 0x00, 
-0x0b, 0x00, 0x08, 0x00, 0x08, 0x00, 0x09, 0x00, 0x08, 0x00, 0x0b, 0x00, 0x08, 0x00, 0x06, 0x00, 
-0x09, 0x00, 0x07, 0x00, 0x09, 0x00, 0x0c, 0x00, 0x01, 0x00, 0xfe, 0xff, 0x06, 0x00, 0x02, 0x00, 
-0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 
-0xfd, 0xff, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xff, 
-0xf5, 0xff, 0xf6, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfc, 0xff, 0xfb, 0xff, 
-0xf2, 0xff, 0xee, 0xff, 0xf2, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xef, 0xff, 0xf3, 0xff, 0xf5, 0xff, 
-0xf9, 0xff, 0xf7, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf2, 0xff, 0xf3, 0xff, 0xf3, 0xff, 0xf0, 0xff, 
-0xf0, 0xff, 0xeb, 0xff, 0xe7, 0xff, 0xea, 0xff, 0xe5, 0xff, 0xe2, 0xff, 0xeb, 0xff, 0xeb, 0xff, 
-0xe3, 0xff, 0xe4, 0xff, 0xe7, 0xff, 0xe8, 0xff, 0xe9, 0xff, 0xe7, 0xff, 0xe5, 0xff, 0xe8, 0xff, 
-0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xeb, 0xff, 0xef, 0xff, 0xf2, 0xff, 0xf3, 0xff, 0xf3, 0xff, 
-0xf3, 0xff, 0xf5, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xf6, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xfd, 0xff, 
-0xf9, 0xff, 0xf3, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf2, 0xff, 0xf1, 0xff, 0xf2, 0xff, 
-0xed, 0xff, 0xe5, 0xff, 0xe7, 0xff, 0xec, 0xff, 0xea, 0xff, 0xeb, 0xff, 0xec, 0xff, 0xeb, 0xff, 
-0xed, 0xff, 0xee, 0xff, 0xed, 0xff, 0xf1, 0xff, 0xf3, 0xff, 0xef, 0xff, 0xf1, 0xff, 0xf3, 0xff, 
-0xf2, 0xff, 0xf3, 0xff, 0xf4, 0xff, 0xf3, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xef, 0xff, 0xef, 0xff, 
-0xf0, 0xff, 0xf2, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf3, 0xff, 0xf2, 0xff, 0xf3, 0xff, 
-0xf3, 0xff, 0xf2, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xfa, 0xff, 
-0xfb, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0x02, 0x00, 
-0x0a, 0x00, 0x06, 0x00, 0x02, 0x00, 0x04, 0x00, 0x05, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05, 0x00, 
-0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0xfd, 0xff, 
-0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x04, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0b, 0x00, 
-0x09, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0d, 0x00, 0x0a, 0x00, 0x0c, 0x00, 
-0x0d, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0a, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0e, 0x00, 0x0c, 0x00, 
-0x10, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x11, 0x00, 0x12, 0x00, 0x1a, 0x00, 
-0x1e, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x1e, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x24, 0x00, 
-0x22, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x28, 0x00, 0x2c, 0x00, 0x33, 0x00, 0x32, 0x00, 0x33, 0x00, 
-0x34, 0x00, 0x34, 0x00, 0x36, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x35, 0x00, 
-0x32, 0x00, 0x31, 0x00, 0x35, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x00, 
-0x3f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x40, 0x00, 0x3c, 0x00, 0x37, 0x00, 0x37, 0x00, 0x35, 0x00, 
-0x33, 0x00, 0x32, 0x00, 0x2c, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x22, 0x00, 0x1e, 0x00, 0x1f, 0x00, 
-0x18, 0x00, 0x13, 0x00, 0x15, 0x00, 0x12, 0x00, 0x10, 0x00, 0x11, 0x00, 0x0e, 0x00, 0x0e, 0x00, 
-0x13, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x15, 0x00, 0x15, 0x00, 0x18, 0x00, 0x0f, 0x00, 
-0x0f, 0x00, 0x17, 0x00, 0x12, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x18, 0x00, 0x11, 0x00, 0x17, 0x00, 
-0x1a, 0x00, 0x15, 0x00, 0x16, 0x00, 0x1d, 0x00, 0x22, 0x00, 0x25, 0x00, 0x24, 0x00, 0x1c, 0x00, 
-0x16, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x23, 0x00, 0x26, 0x00, 0x24, 0x00, 0x24, 0x00, 0x2d, 0x00, 
-0x33, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3c, 0x00, 0x3b, 0x00, 0x37, 0x00, 0x36, 0x00, 0x3a, 0x00, 
-0x39, 0x00, 0x35, 0x00, 0x35, 0x00, 0x32, 0x00, 0x32, 0x00, 0x3a, 0x00, 0x34, 0x00, 0x2a, 0x00, 
-0x2e, 0x00, 0x2e, 0x00, 0x29, 0x00, 0x2e, 0x00, 0x33, 0x00, 0x34, 0x00, 0x32, 0x00, 0x2b, 0x00, 
-0x26, 0x00, 0x20, 0x00, 0x1b, 0x00, 0x1d, 0x00, 0x18, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x25, 0x00, 
-0x28, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x28, 0x00, 0x29, 0x00, 0x37, 0x00, 0x38, 0x00, 0x34, 0x00, 
-0x34, 0x00, 0x32, 0x00, 0x2d, 0x00, 0x2b, 0x00, 0x31, 0x00, 0x32, 0x00, 0x2c, 0x00, 0x27, 0x00, 
-0x1d, 0x00, 0x17, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x26, 0x00, 0x23, 0x00, 0x21, 0x00, 0x1f, 0x00, 
-0x1b, 0x00, 0x15, 0x00, 0x13, 0x00, 0x13, 0x00, 0x11, 0x00, 0x14, 0x00, 0x14, 0x00, 0x0e, 0x00, 
-0x0c, 0x00, 0x11, 0x00, 0x12, 0x00, 0x0f, 0x00, 0x02, 0x00, 0xf2, 0xff, 0xf1, 0xff, 0xf8, 0xff, 
-0xf4, 0xff, 0xf0, 0xff, 0xf6, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xfe, 0xff, 
-0xfc, 0xff, 0xf6, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xef, 0xff, 0xe6, 0xff, 0xe6, 0xff, 0xeb, 0xff, 
-0xe5, 0xff, 0xe4, 0xff, 0xed, 0xff, 0xdf, 0xff, 0xc8, 0xff, 0xcb, 0xff, 0xd0, 0xff, 0xc4, 0xff, 
-0xbe, 0xff, 0xbc, 0xff, 0xb2, 0xff, 0xad, 0xff, 0xaf, 0xff, 0xad, 0xff, 0xa6, 0xff, 0xa1, 0xff, 
-0x9f, 0xff, 0x9a, 0xff, 0x9d, 0xff, 0xb1, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0xc1, 0xff, 0xc6, 0xff, 
-0xc1, 0xff, 0xcb, 0xff, 0xce, 0xff, 0xc5, 0xff, 0xd1, 0xff, 0xde, 0xff, 0xda, 0xff, 0xe3, 0xff, 
-0xe9, 0xff, 0xe3, 0xff, 0xea, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 
-0x02, 0x00, 0x0a, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2b, 0x00, 0x2e, 0x00, 0x31, 0x00, 0x35, 0x00, 
-0x31, 0x00, 0x28, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x24, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x32, 0x00, 
-0x31, 0x00, 0x3e, 0x00, 0x43, 0x00, 0x36, 0x00, 0x34, 0x00, 0x3c, 0x00, 0x34, 0x00, 0x28, 0x00, 
-0x2b, 0x00, 0x2d, 0x00, 0x24, 0x00, 0x22, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x36, 0x00, 0x35, 0x00, 
-0x37, 0x00, 0x26, 0x00, 0x10, 0x00, 0x12, 0x00, 0x11, 0x00, 0xf9, 0xff, 0xe9, 0xff, 0xe3, 0xff, 
-0xd1, 0xff, 0xc9, 0xff, 0xc8, 0xff, 0xb5, 0xff, 0xa5, 0xff, 0xa6, 0xff, 0x9c, 0xff, 0x8c, 0xff, 
-0x87, 0xff, 0x7b, 0xff, 0x70, 0xff, 0x76, 0xff, 0x79, 0xff, 0x6a, 0xff, 0x5c, 0xff, 0x56, 0xff, 
-0x50, 0xff, 0x4c, 0xff, 0x50, 0xff, 0x4e, 0xff, 0x40, 0xff, 0x3f, 0xff, 0x4e, 0xff, 0x59, 0xff, 
-0x60, 0xff, 0x66, 0xff, 0x66, 0xff, 0x6b, 0xff, 0x73, 0xff, 0x74, 0xff, 0x7e, 0xff, 0x87, 0xff, 
-0x83, 0xff, 0x96, 0xff, 0xb6, 0xff, 0xb1, 0xff, 0xaf, 0xff, 0xd7, 0xff, 0xf3, 0xff, 0xf8, 0xff, 
-0x0e, 0x00, 0x25, 0x00, 0x23, 0x00, 0x26, 0x00, 0x43, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x5f, 0x00, 
-0x75, 0x00, 0x79, 0x00, 0x6c, 0x00, 0x71, 0x00, 0x82, 0x00, 0x86, 0x00, 0x81, 0x00, 0x81, 0x00, 
-0x7c, 0x00, 0x67, 0x00, 0x66, 0x00, 0x75, 0x00, 0x63, 0x00, 0x46, 0x00, 0x3c, 0x00, 0x21, 0x00, 
-0x03, 0x00, 0x04, 0x00, 0xf1, 0xff, 0xcd, 0xff, 0xcd, 0xff, 0xc1, 0xff, 0x96, 0xff, 0x7e, 0xff, 
-0x6a, 0xff, 0x41, 0xff, 0x2f, 0xff, 0x19, 0xff, 0xd0, 0xfe, 0x96, 0xfe, 0x8e, 0xfe, 0x7c, 0xfe, 
-0x5c, 0xfe, 0x48, 0xfe, 0x2c, 0xfe, 0x0f, 0xfe, 0x0d, 0xfe, 0x11, 0xfe, 0x0b, 0xfe, 0x00, 0xfe, 
-0xff, 0xfd, 0x1a, 0xfe, 0x3f, 0xfe, 0x57, 0xfe, 0x7a, 0xfe, 0xa8, 0xfe, 0xd3, 0xfe, 0xfa, 0xfe, 
-0x28, 0xff, 0x6b, 0xff, 0x92, 0xff, 0x88, 0xff, 0xba, 0xff, 0x1d, 0x00, 0x4d, 0x00, 0x8e, 0x00, 
-0xf1, 0x00, 0x18, 0x01, 0x40, 0x01, 0xa7, 0x01, 0x02, 0x02, 0x35, 0x02, 0x4a, 0x02, 0x5c, 0x02, 
-0x8d, 0x02, 0xa2, 0x02, 0x8f, 0x02, 0xa2, 0x02, 0xc2, 0x02, 0xcd, 0x02, 0xdc, 0x02, 0xe5, 0x02, 
-0xec, 0x02, 0xe8, 0x02, 0xd3, 0x02, 0xd7, 0x02, 0xda, 0x02, 0xae, 0x02, 0x84, 0x02, 0x66, 0x02, 
-0x38, 0x02, 0xfc, 0x01, 0xb4, 0x01, 0x6d, 0x01, 0x15, 0x01, 0x98, 0x00, 0x32, 0x00, 0xf5, 0xff, 
-0xb1, 0xff, 0x65, 0xff, 0x0e, 0xff, 0xa5, 0xfe, 0x51, 0xfe, 0x13, 0xfe, 0xd5, 0xfd, 0x7e, 0xfd, 
-0x02, 0xfd, 0x8d, 0xfc, 0x2b, 0xfc, 0xbf, 0xfb, 0x5f, 0xfb, 0x02, 0xfb, 0x8d, 0xfa, 0x28, 0xfa, 
-0xe8, 0xf9, 0xbb, 0xf9, 0xb4, 0xf9, 0xe4, 0xf9, 0x1d, 0xfa, 0x35, 0xfa, 0x74, 0xfa, 0x17, 0xfb, 
-0xa8, 0xfb, 0x03, 0xfc, 0x97, 0xfc, 0x50, 0xfd, 0xf6, 0xfd, 0xb7, 0xfe, 0x96, 0xff, 0x7b, 0x00, 
-0x5c, 0x01, 0x48, 0x02, 0x4f, 0x03, 0x1b, 0x04, 0xb9, 0x04, 0xae, 0x05, 0x91, 0x06, 0x11, 0x07, 
-0xbd, 0x07, 0x63, 0x08, 0x99, 0x08, 0xe5, 0x08, 0x73, 0x09, 0xc8, 0x09, 0xb5, 0x09, 0x7a, 0x09, 
-0x44, 0x09, 0xd6, 0x08, 0x47, 0x08, 0xec, 0x07, 0x40, 0x07, 0x1d, 0x06, 0x57, 0x05, 0xc2, 0x04, 
-0xbb, 0x03, 0x96, 0x02, 0xb5, 0x01, 0x00, 0x01, 0x1b, 0x00, 0xd5, 0xfe, 0xad, 0xfd, 0xbe, 0xfc, 
-0x63, 0xfb, 0xb9, 0xf9, 0x6c, 0xf8, 0x39, 0xf7, 0x6d, 0xf5, 0x68, 0xf3, 0xf9, 0xf1, 0xc9, 0xf0, 
-0xb6, 0xef, 0x81, 0xef, 0x63, 0xef, 0x7b, 0xee, 0x42, 0xee, 0x43, 0xef, 0xfe, 0xef, 0x61, 0xf0, 
-0x30, 0xf1, 0x07, 0xf2, 0xde, 0xf2, 0x58, 0xf4, 0x0d, 0xf6, 0x66, 0xf7, 0x07, 0xf9, 0x2e, 0xfb, 
-0xf9, 0xfc, 0x9e, 0xfe, 0xc0, 0x00, 0xab, 0x02, 0x21, 0x04, 0xc4, 0x05, 0xa4, 0x07, 0x6c, 0x09, 
-0xab, 0x0a, 0x98, 0x0b, 0xe2, 0x0c, 0xce, 0x0d, 0x20, 0x0e, 0xf7, 0x0e, 0xa7, 0x0f, 0x7d, 0x0f, 
-0x77, 0x0f, 0x68, 0x0f, 0x2a, 0x0f, 0x58, 0x0f, 0x10, 0x0f, 0x41, 0x0e, 0x1b, 0x0e, 0x1a, 0x0e, 
-0xbe, 0x0d, 0x7d, 0x0d, 0x41, 0x0d, 0x0f, 0x0d, 0xbb, 0x0c, 0x1a, 0x0c, 0xc4, 0x0b, 0x64, 0x0b, 
-0x5d, 0x0a, 0x59, 0x09, 0x71, 0x08, 0x36, 0x07, 0xdc, 0x05, 0x45, 0x04, 0x60, 0x02, 0x69, 0x00, 
-0x26, 0xfe, 0xda, 0xfb, 0xf2, 0xf9, 0x90, 0xf7, 0x83, 0xf4, 0x1f, 0xf2, 0x30, 0xf0, 0x1a, 0xee, 
-0x9f, 0xed, 0x39, 0xee, 0x69, 0xec, 0xf6, 0xe9, 0xe8, 0xea, 0xd2, 0xec, 0xd9, 0xec, 0x79, 0xec, 
-0x5b, 0xec, 0xe0, 0xec, 0xfc, 0xee, 0x17, 0xf1, 0x05, 0xf2, 0x10, 0xf3, 0xf0, 0xf4, 0x3b, 0xf7, 
-0x65, 0xf9, 0x82, 0xfb, 0xcd, 0xfd, 0x7f, 0xff, 0xde, 0x00, 0xe9, 0x02, 0xdd, 0x04, 0x5b, 0x06, 
-0xc0, 0x07, 0x92, 0x08, 0x28, 0x09, 0xe8, 0x09, 0xb4, 0x0a, 0xca, 0x0b, 0xd7, 0x0b, 0xdc, 0x0a, 
-0x79, 0x0b, 0x7c, 0x0c, 0xe6, 0x0b, 0xa6, 0x0b, 0x9f, 0x0b, 0x26, 0x0b, 0x44, 0x0c, 0x2e, 0x0d, 
-0xba, 0x0b, 0x9d, 0x0b, 0xde, 0x0d, 0x8c, 0x0e, 0xb7, 0x0d, 0x2f, 0x0e, 0x1e, 0x0f, 0xdd, 0x0e, 
-0xb1, 0x0e, 0x38, 0x0f, 0xa2, 0x0e, 0x45, 0x0d, 0x20, 0x0d, 0xd8, 0x0c, 0xc7, 0x0a, 0x08, 0x09, 
-0x4f, 0x08, 0x35, 0x06, 0x04, 0x03, 0xa7, 0x00, 0x76, 0xfe, 0xb5, 0xfb, 0x40, 0xf8, 0xcb, 0xf3, 
-0x5a, 0xf0, 0x5c, 0xee, 0x4b, 0xeb, 0x7b, 0xe9, 0x82, 0xea, 0x5b, 0xe8, 0x9e, 0xe3, 0x8c, 0xe4, 
-0x35, 0xe9, 0xbc, 0xe9, 0xd7, 0xe6, 0xe4, 0xe5, 0x8b, 0xe8, 0x22, 0xec, 0xba, 0xed, 0x8a, 0xed, 
-0xc0, 0xed, 0xa6, 0xf0, 0x6a, 0xf5, 0x8d, 0xf7, 0x87, 0xf7, 0x38, 0xfa, 0x53, 0xfe, 0x5d, 0x00, 
-0xaa, 0x01, 0x85, 0x03, 0xb3, 0x05, 0x0e, 0x08, 0x4f, 0x09, 0x69, 0x09, 0x83, 0x0a, 0xe6, 0x0c, 
-0xd7, 0x0d, 0x66, 0x0c, 0x1a, 0x0c, 0x70, 0x0e, 0x61, 0x0f, 0x94, 0x0d, 0x77, 0x0c, 0x17, 0x0d, 
-0xe9, 0x0d, 0x49, 0x0e, 0xe8, 0x0d, 0xee, 0x0c, 0x3b, 0x0d, 0x84, 0x0f, 0x6c, 0x10, 0x9f, 0x0e, 
-0x8b, 0x0e, 0xd7, 0x10, 0x14, 0x11, 0xd7, 0x0f, 0xd6, 0x0f, 0xad, 0x0f, 0xad, 0x0e, 0xf8, 0x0d, 
-0x39, 0x0d, 0x94, 0x0b, 0x75, 0x09, 0x05, 0x08, 0x65, 0x06, 0x4e, 0x03, 0x45, 0x00, 0x96, 0xfd, 
-0x58, 0xfa, 0x8b, 0xf7, 0xef, 0xf3, 0xe2, 0xee, 0x52, 0xeb, 0x05, 0xe9, 0xf5, 0xe7, 0xae, 0xe8, 
-0x7f, 0xe5, 0x00, 0xe0, 0x10, 0xe2, 0x8c, 0xe7, 0x3a, 0xe7, 0xb9, 0xe4, 0x81, 0xe4, 0x63, 0xe6, 
-0x88, 0xea, 0x8c, 0xed, 0x99, 0xec, 0xfd, 0xeb, 0x35, 0xf0, 0x09, 0xf6, 0x83, 0xf7, 0x4c, 0xf7, 
-0x47, 0xfb, 0x87, 0xff, 0x5f, 0x00, 0x6c, 0x02, 0xf6, 0x05, 0xe2, 0x07, 0x54, 0x09, 0x40, 0x0a, 
-0xb1, 0x0a, 0x04, 0x0d, 0xae, 0x0f, 0xd0, 0x0f, 0x1c, 0x0e, 0x65, 0x0d, 0x15, 0x10, 0xad, 0x12, 
-0x45, 0x10, 0x5d, 0x0d, 0x83, 0x0e, 0xab, 0x0f, 0x7e, 0x0f, 0xfc, 0x0f, 0x0e, 0x0f, 0x7b, 0x0d, 
-0xee, 0x0e, 0xd1, 0x10, 0x54, 0x10, 0x4b, 0x10, 0xce, 0x10, 0x6c, 0x0f, 0xbb, 0x0e, 0x7a, 0x10, 
-0x6d, 0x10, 0x9c, 0x0d, 0x47, 0x0c, 0x24, 0x0c, 0x4f, 0x0a, 0x90, 0x08, 0x85, 0x07, 0x60, 0x04, 
-0xaa, 0x00, 0xe2, 0xfe, 0xc5, 0xfc, 0x53, 0xf9, 0x26, 0xf5, 0x41, 0xf0, 0x7d, 0xed, 0x92, 0xeb, 
-0xf7, 0xe5, 0x8a, 0xe3, 0xa0, 0xe7, 0xd1, 0xe4, 0x4f, 0xdc, 0x15, 0xdf, 0x35, 0xe7, 0x74, 0xe5, 
-0x23, 0xe1, 0x74, 0xe3, 0x5a, 0xe7, 0xe7, 0xe9, 0x20, 0xec, 0x7d, 0xec, 0xf3, 0xec, 0xaa, 0xf1, 
-0x87, 0xf7, 0xe0, 0xf8, 0xda, 0xf8, 0xa4, 0xfc, 0x2d, 0x01, 0xbe, 0x03, 0x02, 0x06, 0x50, 0x07, 
-0xcf, 0x08, 0x29, 0x0c, 0x6f, 0x0d, 0xb2, 0x0d, 0xdd, 0x10, 0xe3, 0x11, 0xe6, 0x0f, 0xb7, 0x10, 
-0x35, 0x12, 0xa2, 0x12, 0xcf, 0x13, 0x2a, 0x12, 0x3d, 0x0f, 0x85, 0x10, 0xb4, 0x12, 0x3b, 0x13, 
-0xac, 0x12, 0x8d, 0x0f, 0xee, 0x0e, 0xa0, 0x13, 0x1c, 0x15, 0xef, 0x11, 0xd6, 0x10, 0x71, 0x11, 
-0x5c, 0x11, 0x9f, 0x11, 0xb9, 0x11, 0x19, 0x10, 0xb5, 0x0d, 0xda, 0x0c, 0x97, 0x0b, 0xf6, 0x07, 
-0x7a, 0x06, 0xe6, 0x05, 0x10, 0x00, 0xae, 0xfa, 0x37, 0xfa, 0x9f, 0xf7, 0xd5, 0xf1, 0x29, 0xec, 
-0x9a, 0xe6, 0x63, 0xe3, 0x6b, 0xe2, 0x79, 0xe2, 0xd4, 0xe2, 0x06, 0xdd, 0xcc, 0xd5, 0xe2, 0xda, 
-0x8b, 0xe3, 0xa8, 0xe2, 0x60, 0xdf, 0x8c, 0xde, 0xef, 0xe0, 0x09, 0xea, 0x42, 0xf0, 0xab, 0xec, 
-0x48, 0xeb, 0x4d, 0xf2, 0x52, 0xfa, 0xcd, 0xfd, 0x27, 0xfd, 0x2c, 0xfd, 0x1b, 0x01, 0xb0, 0x06, 
-0x90, 0x0a, 0x25, 0x0b, 0x9c, 0x0b, 0x1f, 0x0f, 0xdf, 0x11, 0x4c, 0x13, 0x5b, 0x16, 0xc1, 0x17, 
-0xe1, 0x16, 0xfc, 0x15, 0x3c, 0x14, 0xee, 0x15, 0x95, 0x19, 0xdc, 0x14, 0x5b, 0x0e, 0x23, 0x11, 
-0xcc, 0x14, 0xf5, 0x12, 0x83, 0x10, 0xbc, 0x0f, 0x71, 0x11, 0x85, 0x13, 0x37, 0x12, 0x7a, 0x10, 
-0x05, 0x10, 0x1e, 0x0f, 0xc1, 0x0e, 0xb9, 0x0d, 0xf3, 0x0b, 0x00, 0x0c, 0xe5, 0x09, 0xbc, 0x04, 
-0x9d, 0x03, 0xda, 0x04, 0x92, 0x01, 0x16, 0xfc, 0x7b, 0xf8, 0xee, 0xf5, 0xee, 0xf3, 0x3e, 0xf1, 
-0x8f, 0xea, 0xad, 0xe2, 0x0d, 0xe0, 0x4d, 0xe0, 0xbd, 0xdf, 0x54, 0xe0, 0x65, 0xdd, 0xda, 0xd6, 
-0x1d, 0xda, 0xbd, 0xe3, 0xcd, 0xe4, 0x1c, 0xe3, 0x95, 0xe4, 0x64, 0xe4, 0xa4, 0xe9, 0x1d, 0xf4, 
-0xe7, 0xf3, 0xa6, 0xee, 0xf0, 0xf4, 0x90, 0xfe, 0xfc, 0xff, 0xe1, 0x00, 0xaf, 0x05, 0xf7, 0x07, 
-0xd2, 0x09, 0x19, 0x10, 0x02, 0x14, 0x8a, 0x13, 0x21, 0x16, 0xfc, 0x18, 0x6d, 0x17, 0x18, 0x18, 
-0x12, 0x1c, 0x7d, 0x1b, 0x02, 0x16, 0x77, 0x13, 0x97, 0x16, 0x44, 0x17, 0x4e, 0x12, 0x40, 0x10, 
-0x12, 0x10, 0x42, 0x0c, 0xc0, 0x0c, 0x2a, 0x10, 0xc8, 0x0b, 0xa5, 0x08, 0x9e, 0x0d, 0x5f, 0x0e, 
-0x87, 0x0a, 0x6f, 0x0b, 0x89, 0x0d, 0x0b, 0x0d, 0xc6, 0x0c, 0xf5, 0x0b, 0x80, 0x09, 0xbd, 0x07, 
-0xd6, 0x07, 0xef, 0x06, 0xad, 0x01, 0xef, 0xfb, 0x15, 0xfb, 0x28, 0xfa, 0xb4, 0xf4, 0x43, 0xf0, 
-0xfb, 0xed, 0xf7, 0xe8, 0xe9, 0xe2, 0x00, 0xdf, 0xae, 0xdd, 0x39, 0xe0, 0x64, 0xe0, 0x8f, 0xd7, 
-0xa7, 0xd1, 0x35, 0xd9, 0x36, 0xe2, 0x3c, 0xe2, 0x72, 0xde, 0x32, 0xdd, 0xf3, 0xe2, 0x50, 0xee, 
-0x10, 0xf3, 0xb4, 0xee, 0x02, 0xf0, 0x5e, 0xfa, 0x70, 0x00, 0x73, 0x00, 0x65, 0x03, 0xac, 0x07, 
-0xff, 0x09, 0x26, 0x0e, 0xc4, 0x11, 0x98, 0x12, 0xda, 0x15, 0x82, 0x18, 0x8b, 0x16, 0x36, 0x17, 
-0xf6, 0x19, 0xcb, 0x17, 0x8c, 0x14, 0xf8, 0x12, 0x98, 0x11, 0x51, 0x13, 0x77, 0x14, 0x63, 0x10, 
-0x9f, 0x0e, 0x23, 0x11, 0xc7, 0x10, 0xee, 0x0f, 0xf3, 0x11, 0x05, 0x11, 0x5b, 0x0d, 0xd9, 0x0d, 
-0x62, 0x11, 0xcf, 0x12, 0x6a, 0x12, 0x89, 0x11, 0x82, 0x0f, 0xee, 0x0d, 0xfe, 0x0e, 0x61, 0x0f, 
-0xaa, 0x0a, 0xac, 0x04, 0x0b, 0x03, 0x8b, 0x01, 0x5c, 0xfb, 0xd5, 0xf5, 0x02, 0xf4, 0x83, 0xef, 
-0x76, 0xe6, 0x79, 0xdf, 0xc4, 0xdc, 0x6d, 0xdb, 0x39, 0xdd, 0x65, 0xdf, 0x14, 0xd7, 0xf3, 0xcd, 
-0x6a, 0xd8, 0x24, 0xe7, 0x0c, 0xe4, 0x36, 0xde, 0xd8, 0xe0, 0x87, 0xe4, 0x4d, 0xee, 0xa7, 0xf8, 
-0x7a, 0xf3, 0x41, 0xee, 0x34, 0xf9, 0x4f, 0x03, 0x1e, 0x02, 0xfe, 0x00, 0x19, 0x06, 0x11, 0x0c, 
-0xac, 0x0d, 0xd5, 0x0d, 0x0f, 0x10, 0x31, 0x12, 0x2f, 0x15, 0x05, 0x18, 0x51, 0x15, 0x03, 0x13, 
-0xcc, 0x16, 0xd3, 0x17, 0xb4, 0x13, 0xc2, 0x12, 0xa7, 0x14, 0xb2, 0x13, 0xc6, 0x11, 0x81, 0x12, 
-0xf7, 0x11, 0x82, 0x0e, 0x90, 0x0e, 0x18, 0x11, 0xbb, 0x10, 0xc0, 0x10, 0x35, 0x10, 0xe2, 0x0c, 
-0x74, 0x0e, 0x21, 0x12, 0xb0, 0x0e, 0xf7, 0x0a, 0xa8, 0x0b, 0xc6, 0x0a, 0xb1, 0x07, 0x49, 0x03, 
-0x68, 0xff, 0x88, 0xff, 0x06, 0xfd, 0x3d, 0xf4, 0x8d, 0xee, 0x2f, 0xed, 0x66, 0xe9, 0xa6, 0xe3, 
-0xf5, 0xdc, 0x31, 0xd8, 0x2f, 0xdd, 0xd1, 0xe3, 0xa5, 0xdb, 0x9f, 0xd1, 0x8b, 0xda, 0xce, 0xe7, 
-0xa5, 0xe8, 0xdb, 0xe6, 0x85, 0xe5, 0xbb, 0xe4, 0x6d, 0xf0, 0x36, 0xfd, 0x8b, 0xf7, 0x45, 0xf0, 
-0xa7, 0xf7, 0xe3, 0xff, 0xca, 0x01, 0x06, 0x04, 0x3b, 0x06, 0x16, 0x06, 0x63, 0x08, 0xd4, 0x10, 
-0x92, 0x16, 0x5f, 0x12, 0xbc, 0x10, 0xab, 0x17, 0x98, 0x19, 0x85, 0x17, 0xfa, 0x19, 0xcf, 0x17, 
-0x07, 0x13, 0xd9, 0x18, 0x8a, 0x1c, 0x04, 0x13, 0xc2, 0x0e, 0x5d, 0x15, 0xac, 0x15, 0xe4, 0x0e, 
-0xeb, 0x0b, 0x56, 0x0c, 0x3b, 0x0d, 0xd9, 0x0d, 0xdc, 0x0a, 0xe4, 0x06, 0x3a, 0x09, 0xac, 0x0e, 
-0x8e, 0x0d, 0x56, 0x07, 0x75, 0x05, 0x29, 0x08, 0x5d, 0x07, 0xfd, 0x00, 0xb9, 0xfb, 0x68, 0xfb, 
-0xa9, 0xf9, 0xd4, 0xf2, 0x17, 0xee, 0xad, 0xeb, 0xe3, 0xe4, 0x45, 0xde, 0xb5, 0xdc, 0xaa, 0xde, 
-0x4d, 0xe4, 0xb6, 0xe3, 0x97, 0xd7, 0xac, 0xd4, 0x09, 0xe2, 0x6d, 0xeb, 0xea, 0xe9, 0x22, 0xe4, 
-0xca, 0xe1, 0xeb, 0xeb, 0x32, 0xf9, 0xf5, 0xf9, 0x43, 0xf5, 0x5b, 0xf6, 0x63, 0xfc, 0xc4, 0x02, 
-0xb0, 0x05, 0xe5, 0x06, 0x93, 0x07, 0xe0, 0x06, 0x38, 0x0b, 0x81, 0x13, 0x36, 0x16, 0x4b, 0x16, 
-0x09, 0x17, 0xdc, 0x15, 0x3b, 0x17, 0x01, 0x1b, 0x2e, 0x1b, 0x16, 0x19, 0x6b, 0x17, 0x51, 0x16, 
-0x6e, 0x14, 0x5c, 0x12, 0xee, 0x13, 0x29, 0x13, 0x6d, 0x0c, 0x85, 0x0b, 0xdf, 0x0e, 0x94, 0x0c, 
-0x51, 0x0a, 0xb2, 0x09, 0xdf, 0x09, 0xea, 0x0e, 0x8b, 0x0e, 0x63, 0x06, 0xbf, 0x05, 0x71, 0x0a, 
-0x7e, 0x0a, 0x9f, 0x06, 0xb4, 0xff, 0xe8, 0xfa, 0x48, 0xfb, 0x70, 0xfa, 0x33, 0xf5, 0xc4, 0xea, 
-0x1f, 0xe1, 0xc3, 0xdf, 0x95, 0xdd, 0x7f, 0xdb, 0x2a, 0xe2, 0x92, 0xde, 0xa2, 0xcf, 0x56, 0xd3, 
-0x8e, 0xe2, 0x72, 0xe6, 0xbf, 0xe6, 0x35, 0xe7, 0xd3, 0xe5, 0x40, 0xee, 0x01, 0xfc, 0x25, 0xfc, 
-0xad, 0xf4, 0x27, 0xfa, 0x90, 0x06, 0x87, 0x06, 0x04, 0x02, 0x13, 0x06, 0xef, 0x08, 0x7d, 0x09, 
-0xee, 0x0f, 0x36, 0x14, 0xc4, 0x12, 0x8e, 0x12, 0x66, 0x13, 0x9a, 0x15, 0x05, 0x19, 0x19, 0x19, 
-0x8d, 0x16, 0xfe, 0x12, 0x08, 0x11, 0x1d, 0x14, 0x87, 0x14, 0xb9, 0x0f, 0xea, 0x10, 0xb7, 0x14, 
-0x3c, 0x0f, 0x1f, 0x08, 0x56, 0x0a, 0x49, 0x0f, 0xf6, 0x0e, 0xf9, 0x0b, 0x38, 0x08, 0x4d, 0x05, 
-0xdd, 0x08, 0x67, 0x0d, 0xad, 0x09, 0xe9, 0x04, 0xd6, 0x03, 0xaf, 0x00, 0x71, 0xfd, 0xef, 0xfb, 
-0x94, 0xf9, 0x51, 0xf5, 0x5a, 0xea, 0x05, 0xde, 0x6b, 0xdb, 0xbe, 0xdb, 0x0e, 0xdc, 0xa2, 0xdf, 
-0x6a, 0xda, 0xd0, 0xd0, 0x4c, 0xd5, 0x34, 0xe0, 0xcd, 0xe8, 0xa7, 0xef, 0xea, 0xea, 0x25, 0xe4, 
-0xc5, 0xf0, 0xd9, 0x03, 0x17, 0x07, 0x4c, 0xff, 0x2d, 0xfd, 0x37, 0x06, 0x81, 0x0f, 0xf0, 0x11, 
-0x66, 0x12, 0xf0, 0x0f, 0x16, 0x0d, 0x93, 0x12, 0xf1, 0x17, 0x46, 0x17, 0x96, 0x19, 0x76, 0x17, 
-0x10, 0x0c, 0xea, 0x0c, 0xdd, 0x1a, 0xe2, 0x1b, 0x4c, 0x11, 0x34, 0x0f, 0xf3, 0x11, 0x1c, 0x0f, 
-0x26, 0x0e, 0xea, 0x11, 0xf8, 0x0f, 0x07, 0x0a, 0x62, 0x08, 0xf0, 0x05, 0x2a, 0x04, 0x3b, 0x0c, 
-0xa0, 0x10, 0xa8, 0x05, 0xf8, 0xfd, 0x16, 0x02, 0x2e, 0x04, 0x2d, 0x02, 0xab, 0xff, 0xd1, 0xfb, 
-0x40, 0xf9, 0xc4, 0xf4, 0xe5, 0xee, 0x36, 0xef, 0xfc, 0xea, 0x61, 0xdd, 0x09, 0xd7, 0x00, 0xd5, 
-0xf7, 0xd2, 0x95, 0xdd, 0xff, 0xe2, 0x40, 0xd4, 0xfc, 0xcf, 0xdf, 0xdc, 0xcf, 0xe4, 0x58, 0xee, 
-0x45, 0xf8, 0x2b, 0xf0, 0x96, 0xe7, 0xd5, 0xf5, 0x5e, 0x0b, 0xff, 0x12, 0x83, 0x0d, 0x43, 0x07, 
-0x95, 0x09, 0x7e, 0x12, 0x43, 0x18, 0x50, 0x15, 0xe7, 0x12, 0x28, 0x1b, 0x5a, 0x1f, 0xa2, 0x13, 
-0xe4, 0x0e, 0xf2, 0x1c, 0x2a, 0x26, 0x33, 0x1f, 0xe3, 0x12, 0xc2, 0x0b, 0xd0, 0x12, 0x43, 0x1f, 
-0xda, 0x1b, 0x15, 0x0f, 0x04, 0x0b, 0x84, 0x0d, 0x13, 0x12, 0xf4, 0x13, 0x4f, 0x0d, 0xe1, 0x08, 
-0xcc, 0x0a, 0xae, 0x08, 0xcd, 0x06, 0x8d, 0x06, 0xfd, 0x00, 0x31, 0x00, 0x0a, 0x03, 0x70, 0xfa, 
-0xed, 0xf1, 0x83, 0xf5, 0x4b, 0xf8, 0xef, 0xf2, 0xdd, 0xea, 0x5a, 0xe5, 0x60, 0xe1, 0x93, 0xdb, 
-0xa8, 0xd6, 0xe7, 0xce, 0x1f, 0xc9, 0x84, 0xda, 0x0b, 0xec, 0xdb, 0xda, 0x0d, 0xca, 0x0f, 0xd5, 
-0x90, 0xe5, 0x10, 0xf9, 0xe5, 0x02, 0x97, 0xef, 0xe5, 0xe6, 0x7d, 0xfc, 0x3b, 0x0b, 0xa3, 0x0d, 
-0x63, 0x0f, 0x37, 0x0c, 0x0e, 0x0b, 0x9d, 0x0b, 0xad, 0x0a, 0x7d, 0x12, 0x03, 0x1b, 0x05, 0x1a, 
-0x08, 0x17, 0x72, 0x12, 0x19, 0x11, 0x4a, 0x1a, 0xa6, 0x21, 0xa1, 0x1f, 0x1a, 0x18, 0xf2, 0x0f, 
-0x9e, 0x12, 0x1d, 0x1d, 0x71, 0x21, 0x64, 0x20, 0xd9, 0x18, 0x49, 0x0d, 0x11, 0x0e, 0xe6, 0x14, 
-0x03, 0x12, 0xd6, 0x0c, 0xf5, 0x07, 0xcf, 0x00, 0x2d, 0x01, 0x0c, 0x04, 0x89, 0xfd, 0xfe, 0xf7, 
-0xb0, 0xf9, 0x03, 0xf8, 0xdf, 0xf2, 0xe3, 0xf1, 0x1c, 0xf3, 0x6d, 0xf1, 0x73, 0xea, 0x94, 0xdf, 
-0xd9, 0xd8, 0x08, 0xda, 0x1b, 0xdb, 0x66, 0xd8, 0x69, 0xda, 0x1e, 0xe2, 0x2b, 0xe2, 0x57, 0xda, 
-0xcc, 0xdd, 0x93, 0xed, 0x6b, 0xf6, 0xb7, 0xf5, 0xff, 0xf2, 0xfb, 0xf1, 0x86, 0xfc, 0xbb, 0x0b, 
-0x83, 0x0b, 0xdd, 0x06, 0x2d, 0x0b, 0xe3, 0x0a, 0x95, 0x07, 0x80, 0x0b, 0xcf, 0x0e, 0xb0, 0x10, 
-0x59, 0x12, 0x6d, 0x0e, 0x4a, 0x0e, 0xb8, 0x15, 0x9a, 0x18, 0x27, 0x16, 0xb7, 0x12, 0xec, 0x11, 
-0xbb, 0x18, 0x8d, 0x1c, 0x67, 0x16, 0xdd, 0x13, 0x04, 0x18, 0x7f, 0x1a, 0x47, 0x1a, 0xe7, 0x15, 
-0x97, 0x0e, 0x02, 0x0a, 0xb2, 0x06, 0x09, 0x03, 0x41, 0x01, 0x01, 0xff, 0xb7, 0xf8, 0xfa, 0xf1, 
-0x15, 0xf3, 0xe4, 0xf8, 0xce, 0xf6, 0x0c, 0xf1, 0x1a, 0xf2, 0x67, 0xf2, 0xe7, 0xed, 0x4a, 0xeb, 
-0x03, 0xe7, 0x68, 0xdf, 0xba, 0xdc, 0x2c, 0xde, 0x27, 0xdf, 0x26, 0xe3, 0x61, 0xe8, 0xd2, 0xe5, 
-0x17, 0xdf, 0x7d, 0xe1, 0xfb, 0xeb, 0x50, 0xf6, 0x4d, 0x01, 0x89, 0x06, 0x96, 0xfe, 0xed, 0xfa, 
-0xfd, 0x08, 0x30, 0x17, 0xe7, 0x15, 0x91, 0x0b, 0x00, 0x05, 0xa8, 0x08, 0x8f, 0x11, 0xd5, 0x16, 
-0x1d, 0x16, 0x29, 0x12, 0xc5, 0x10, 0x0b, 0x14, 0x36, 0x16, 0x8a, 0x14, 0x60, 0x11, 0xb4, 0x0e, 
-0x4f, 0x0f, 0xd6, 0x12, 0x6a, 0x16, 0xf8, 0x18, 0x6a, 0x19, 0x39, 0x1a, 0x96, 0x19, 0xe4, 0x0e, 
-0x13, 0x05, 0xdd, 0x09, 0x25, 0x0c, 0x75, 0x04, 0x01, 0x02, 0x04, 0xfe, 0xab, 0xf3, 0x52, 0xf4, 
-0xbe, 0xf9, 0xbb, 0xf5, 0x97, 0xf4, 0xda, 0xf7, 0x54, 0xf2, 0xb7, 0xea, 0x65, 0xea, 0x86, 0xea, 
-0xe0, 0xe6, 0x1f, 0xe4, 0x56, 0xe0, 0x14, 0xd5, 0x55, 0xcd, 0x1a, 0xd6, 0x5c, 0xe0, 0x6d, 0xe3, 
-0x95, 0xec, 0x6e, 0xf1, 0x43, 0xe9, 0x5c, 0xee, 0x80, 0xfe, 0x78, 0xfe, 0xd2, 0xfc, 0x88, 0x07, 
-0x96, 0x09, 0x61, 0x03, 0x94, 0x06, 0x70, 0x0d, 0xb0, 0x10, 0x7a, 0x14, 0xc8, 0x14, 0x72, 0x0f, 
-0xc5, 0x12, 0x12, 0x20, 0x8d, 0x1e, 0xec, 0x0f, 0x9f, 0x13, 0x1b, 0x1f, 0xff, 0x14, 0x01, 0x08, 
-0x37, 0x0b, 0xa0, 0x12, 0x92, 0x1c, 0xf8, 0x22, 0xc2, 0x17, 0x53, 0x0c, 0xe4, 0x10, 0x8a, 0x16, 
-0xb0, 0x13, 0xaa, 0x0b, 0xc8, 0x02, 0xb2, 0xff, 0xc1, 0x00, 0xd7, 0xfe, 0xa2, 0xf7, 0x7f, 0xed, 
-0x94, 0xeb, 0x45, 0xf4, 0xf6, 0xf7, 0xab, 0xf5, 0x6c, 0xf8, 0x2c, 0xfb, 0xac, 0xf7, 0x03, 0xf0, 
-0x21, 0xe5, 0x5c, 0xdc, 0xfd, 0xd9, 0x57, 0xda, 0x7a, 0xda, 0x66, 0xd9, 0x6f, 0xda, 0x95, 0xe2, 
-0xdf, 0xeb, 0xbf, 0xf0, 0x54, 0xf4, 0x9a, 0xf5, 0x4a, 0xf6, 0x72, 0xfb, 0x9a, 0xff, 0x80, 0x02, 
-0x3e, 0x0a, 0x33, 0x0c, 0xd3, 0x02, 0x6f, 0x00, 0x1f, 0x0c, 0xac, 0x16, 0xbf, 0x16, 0x3b, 0x0f, 
-0x59, 0x07, 0xad, 0x08, 0xfa, 0x14, 0xf6, 0x1e, 0xff, 0x1a, 0xc6, 0x10, 0xd0, 0x0c, 0xdf, 0x0e, 
-0x9e, 0x14, 0xc5, 0x19, 0x17, 0x13, 0x98, 0x09, 0x8d, 0x12, 0xb7, 0x20, 0xa3, 0x1c, 0x10, 0x10, 
-0xcb, 0x08, 0x62, 0x07, 0xfd, 0x0c, 0xf2, 0x0d, 0x2c, 0xfe, 0xb3, 0xee, 0x1b, 0xf1, 0xa6, 0xfa, 
-0x13, 0xfb, 0x63, 0xf3, 0xea, 0xf0, 0xe5, 0xf8, 0x3d, 0x00, 0xe5, 0xfb, 0x86, 0xee, 0xd8, 0xe7, 
-0x34, 0xf0, 0x4b, 0xf3, 0x72, 0xe2, 0x84, 0xd5, 0x3a, 0xdd, 0x9b, 0xe7, 0xe1, 0xe7, 0x9e, 0xe5, 
-0xb7, 0xe8, 0x79, 0xef, 0xac, 0xf3, 0xd1, 0xf6, 0xd4, 0xfd, 0x42, 0x06, 0x94, 0x0a, 0xc0, 0x02, 
-0x17, 0xf1, 0x4a, 0xec, 0x30, 0xfa, 0xbf, 0x08, 0x2a, 0x14, 0x72, 0x18, 0x88, 0x0a, 0x1c, 0xff, 
-0x67, 0x0d, 0xd2, 0x21, 0xed, 0x25, 0xfa, 0x1e, 0x60, 0x15, 0xc1, 0x0b, 0x81, 0x06, 0x1a, 0x07, 
-0x2e, 0x09, 0x7f, 0x0c, 0xfc, 0x13, 0x9e, 0x16, 0x6c, 0x0f, 0xb5, 0x0d, 0xa5, 0x12, 0xa1, 0x0f, 
-0x93, 0x0c, 0x50, 0x10, 0x85, 0x0b, 0x9b, 0xfc, 0x58, 0xed, 0x68, 0xe2, 0x84, 0xe8, 0x43, 0xfd, 
-0x7c, 0x05, 0xc6, 0xfc, 0x9a, 0xf6, 0xf2, 0xf7, 0xc6, 0xfa, 0x11, 0xfc, 0xde, 0xfb, 0xc4, 0xfd, 
-0x02, 0xff, 0x9e, 0xf4, 0x12, 0xe1, 0x4e, 0xd8, 0x79, 0xdf, 0x8e, 0xe3, 0xee, 0xe2, 0xeb, 0xf0, 
-0xe4, 0x02, 0x74, 0xff, 0xb2, 0xf0, 0x11, 0xea, 0x81, 0xef, 0x7b, 0x02, 0x22, 0x10, 0xd9, 0x02, 
-0x2e, 0xf1, 0x7e, 0xf1, 0x1e, 0xf4, 0x56, 0xf8, 0xa9, 0x0b, 0xdd, 0x1a, 0x10, 0x15, 0x45, 0x0e, 
-0xa3, 0x12, 0x99, 0x13, 0x10, 0x0f, 0x6d, 0x11, 0xec, 0x14, 0x97, 0x0f, 0x63, 0x09, 0x26, 0x03, 
-0x60, 0xf9, 0x62, 0xfd, 0xce, 0x0f, 0x0f, 0x15, 0x82, 0x0e, 0xa7, 0x0e, 0x31, 0x0d, 0x7c, 0x07, 
-0x42, 0x0b, 0x94, 0x11, 0x3a, 0x0e, 0x39, 0x09, 0x16, 0x09, 0xdd, 0x05, 0xcf, 0xfb, 0x53, 0xf4, 
-0x0d, 0xf2, 0xec, 0xec, 0x39, 0xeb, 0x3c, 0xf3, 0x23, 0xf5, 0xb5, 0xf0, 0x05, 0xf8, 0xea, 0x00, 
-0xf8, 0xfa, 0xaf, 0xf1, 0xb3, 0xee, 0xdd, 0xed, 0x11, 0xee, 0x45, 0xee, 0x5c, 0xed, 0x3c, 0xf1, 
-0x40, 0xfe, 0x25, 0x09, 0x58, 0x04, 0x65, 0xfc, 0xc2, 0xfe, 0xe7, 0xf8, 0x6f, 0xe7, 0x1e, 0xe6, 
-0x71, 0xf3, 0x15, 0xfb, 0x3b, 0x02, 0x5c, 0x0c, 0xb7, 0x11, 0xf1, 0x14, 0x9b, 0x13, 0x50, 0x07, 
-0xf3, 0xfb, 0xf8, 0xfd, 0x91, 0x05, 0x01, 0x08, 0x60, 0x0b, 0x5d, 0x18, 0x24, 0x25, 0x6a, 0x25, 
-0x7a, 0x19, 0xad, 0x03, 0xcc, 0xf1, 0x9e, 0xf7, 0xf7, 0x08, 0x8d, 0x0c, 0x3d, 0x06, 0xff, 0x02, 
-0x69, 0x03, 0x16, 0x05, 0x24, 0x05, 0xa7, 0x04, 0xdd, 0x05, 0x38, 0x02, 0x3c, 0xf8, 0xf7, 0xf0, 
-0x8a, 0xf0, 0xeb, 0xf5, 0x46, 0xfd, 0xe1, 0x01, 0x12, 0x06, 0x97, 0x07, 0x1a, 0xfd, 0x9d, 0xed, 
-0x4f, 0xe8, 0xbb, 0xeb, 0xea, 0xf0, 0x4e, 0xf8, 0x4f, 0xff, 0x84, 0xfe, 0xd9, 0xf7, 0x7d, 0xf7, 
-0xe2, 0xfd, 0x8b, 0xfc, 0x92, 0xf1, 0x18, 0xe9, 0xcf, 0xe7, 0xf5, 0xec, 0xf1, 0xf5, 0x35, 0xfe, 
-0x94, 0x0a, 0xde, 0x1a, 0x5e, 0x1c, 0xee, 0x0a, 0x05, 0xfa, 0x06, 0xf5, 0xba, 0xfb, 0x66, 0x07, 
-0x26, 0x0a, 0x69, 0x04, 0x80, 0x02, 0x7b, 0x03, 0xff, 0x04, 0xe6, 0x0b, 0x1c, 0x12, 0xa7, 0x0e, 
-0x0b, 0x06, 0x91, 0x00, 0x24, 0x01, 0xf4, 0x06, 0xb4, 0x0c, 0xb5, 0x09, 0x1a, 0x00, 0xf5, 0xfe, 
-0x11, 0x03, 0x51, 0xfb, 0x0e, 0xf5, 0x04, 0x01, 0xf8, 0x0a, 0x5a, 0x08, 0x2c, 0x08, 0x56, 0x0b, 
-0xeb, 0x0d, 0xb0, 0x0d, 0x67, 0xfe, 0xd5, 0xe6, 0x04, 0xde, 0xe9, 0xe5, 0xef, 0xf5, 0xdf, 0x08, 
-0x44, 0x13, 0x44, 0x0c, 0x2c, 0xfb, 0x2c, 0xf3, 0xc9, 0xfb, 0x90, 0x04, 0xe5, 0x00, 0x9a, 0xf6, 
-0xf6, 0xed, 0x5b, 0xec, 0x91, 0xef, 0x5d, 0xf4, 0xf9, 0x00, 0x6b, 0x0c, 0xef, 0x06, 0xb0, 0xff, 
-0x19, 0x04, 0x66, 0x06, 0x50, 0x01, 0x95, 0xf9, 0xd7, 0xf2, 0x5d, 0xf6, 0x44, 0xff, 0xc9, 0xff, 
-0x87, 0xff, 0xfc, 0x06, 0x48, 0x0d, 0x52, 0x10, 0xfb, 0x14, 0xfe, 0x11, 0x53, 0xfe, 0x37, 0xeb, 
-0x33, 0xed, 0x81, 0xfa, 0x6d, 0x03, 0x0e, 0x09, 0x2e, 0x09, 0x01, 0x04, 0x74, 0x05, 0x54, 0x09, 
-0x83, 0x03, 0x7b, 0xfd, 0x4e, 0x00, 0x4b, 0x04, 0x03, 0x07, 0xd0, 0x0a, 0x93, 0x09, 0x87, 0x00, 
-0x35, 0xf6, 0x4f, 0xee, 0x47, 0xea, 0xd1, 0xef, 0x7d, 0xff, 0x56, 0x0d, 0xec, 0x0e, 0x55, 0x0a, 
-0xfb, 0x07, 0x2f, 0x00, 0x3c, 0xf2, 0x49, 0xf1, 0x74, 0xfb, 0xa3, 0xf9, 0xe7, 0xf0, 0xe4, 0xf2, 
-0x13, 0xf8, 0x48, 0xfa, 0xd6, 0x03, 0x90, 0x12, 0x05, 0x19, 0xbd, 0x17, 0x9c, 0x13, 0xd6, 0x04, 
-0xbb, 0xee, 0x57, 0xe6, 0xd9, 0xec, 0x06, 0xf7, 0xbb, 0x05, 0xd4, 0x0b, 0x1b, 0xfe, 0x83, 0xf4, 
-0xca, 0xf7, 0xcb, 0xf5, 0x5f, 0xf7, 0xd7, 0x09, 0xc9, 0x1a, 0x75, 0x18, 0x8f, 0x06, 0xf1, 0xf4, 
-0x6c, 0xf1, 0x51, 0xf9, 0xa8, 0x00, 0xcf, 0x01, 0xb8, 0x02, 0x17, 0x0a, 0x90, 0x0d, 0x9d, 0x04, 
-0xfb, 0xfa, 0x44, 0xf7, 0x15, 0xf8, 0x92, 0xfd, 0xd3, 0xfd, 0xd2, 0xf8, 0x5d, 0xfc, 0xbb, 0x02, 
-0x60, 0x03, 0x31, 0x04, 0xc1, 0x03, 0xce, 0x02, 0xdc, 0x05, 0xce, 0x02, 0x80, 0xf8, 0x57, 0xf6, 
-0x17, 0xfe, 0x8f, 0x05, 0x07, 0x08, 0x6d, 0x06, 0x7a, 0x03, 0x52, 0x02, 0x14, 0x04, 0xf7, 0xff, 
-0x81, 0xef, 0x44, 0xe3, 0x62, 0xe8, 0x6d, 0xf5, 0x71, 0x06, 0xaa, 0x17, 0xb4, 0x19, 0x87, 0x0f, 
-0x23, 0x05, 0xf1, 0xf5, 0x9c, 0xe7, 0x42, 0xeb, 0xbe, 0xf9, 0xfd, 0x02, 0xdc, 0x0b, 0x4e, 0x18, 
-0xdc, 0x19, 0x24, 0x0c, 0xe4, 0xfe, 0x9c, 0xf8, 0xe1, 0xf2, 0x51, 0xee, 0x50, 0xef, 0x8c, 0xf6, 
-0xa6, 0x01, 0x4c, 0x08, 0xbb, 0x06, 0x0b, 0x07, 0x28, 0x0e, 0x3f, 0x11, 0xae, 0x0a, 0x0d, 0x03, 
-0x45, 0xfe, 0xb5, 0xf7, 0x5d, 0xf0, 0xbf, 0xec, 0x12, 0xf1, 0x95, 0x01, 0x9a, 0x14, 0xfa, 0x19, 
-0x08, 0x12, 0x0b, 0x03, 0x03, 0xf3, 0xf3, 0xed, 0x66, 0xf1, 0xe7, 0xef, 0x3a, 0xef, 0xcf, 0xfa, 
-0x1d, 0x0c, 0x2d, 0x16, 0x9f, 0x14, 0x90, 0x0a, 0xe0, 0xfb, 0xa8, 0xf1, 0xc4, 0xf6, 0xf2, 0x01, 
-0xd0, 0x04, 0xde, 0x04, 0x65, 0x04, 0x48, 0xff, 0x39, 0xfd, 0x0c, 0xff, 0xbd, 0xfe, 0x7b, 0xfe, 
-0x8f, 0xfb, 0x01, 0xf5, 0x4f, 0xf2, 0xf4, 0xf3, 0xec, 0xfb, 0x92, 0x0a, 0x5f, 0x11, 0x02, 0x0e, 
-0x70, 0x0d, 0xc1, 0x0d, 0xa2, 0x05, 0x03, 0xf7, 0xd6, 0xea, 0x23, 0xe6, 0x8e, 0xe9, 0x32, 0xfa, 
-0x15, 0x13, 0x52, 0x1f, 0x69, 0x1b, 0xd7, 0x0f, 0x0a, 0xfb, 0xa6, 0xe7, 0x24, 0xe2, 0x4a, 0xe4, 
-0xc3, 0xf1, 0xd4, 0x0b, 0x6d, 0x19, 0xa6, 0x12, 0x5f, 0x0a, 0xf3, 0x04, 0xe8, 0xfc, 0x4b, 0xf8, 
-0x02, 0xfb, 0x02, 0xfd, 0xc0, 0xfb, 0x96, 0xfd, 0x59, 0xfe, 0x87, 0xfa, 0x4a, 0xfd, 0x21, 0x05, 
-0x9f, 0x07, 0xab, 0x09, 0xee, 0x08, 0xcb, 0xff, 0xbc, 0xfe, 0x04, 0x07, 0x6f, 0x01, 0x0d, 0xf4, 
-0x65, 0xf7, 0x7b, 0x03, 0x79, 0x05, 0x6c, 0x04, 0xe6, 0x04, 0x29, 0xfa, 0x9d, 0xed, 0xad, 0xf3, 
-0x57, 0xfe, 0xca, 0xfd, 0x38, 0x00, 0xd3, 0x09, 0xb7, 0x0d, 0xef, 0x0a, 0xaf, 0x03, 0x60, 0xf7, 
-0x4d, 0xf0, 0x5d, 0xf6, 0xcc, 0xfd, 0x3b, 0xfe, 0xb2, 0x03, 0x9d, 0x0d, 0xf7, 0x09, 0x1d, 0x00, 
-0xff, 0x00, 0x00, 0x04, 0xdc, 0x03, 0x59, 0x04, 0x65, 0xfd, 0x25, 0xf4, 0x0b, 0xf8, 0xaf, 0xfe, 
-0xf8, 0xfa, 0xb8, 0xfa, 0xc8, 0x06, 0x15, 0x0d, 0xff, 0x03, 0x6e, 0xfa, 0x78, 0xf5, 0xc3, 0xf2, 
-0x8b, 0xfb, 0xfe, 0x04, 0xac, 0xfe, 0x3f, 0xfd, 0x47, 0x07, 0xa3, 0x03, 0x79, 0xfb, 0x6a, 0x03, 
-0x83, 0x09, 0xbc, 0x00, 0xcc, 0xf7, 0x2f, 0xf6, 0x8d, 0xf7, 0xaa, 0xfd, 0xa5, 0x08, 0x44, 0x0c, 
-0xfc, 0x06, 0x1e, 0x06, 0xe8, 0x03, 0x35, 0xf8, 0x95, 0xf3, 0xde, 0xf9, 0x1d, 0xfe, 0x6c, 0x01, 
-0xb9, 0x03, 0x03, 0x02, 0x09, 0x03, 0x0c, 0x07, 0x0e, 0x0b, 0xd8, 0x0d, 0x82, 0x08, 0x29, 0x00, 
-0xf3, 0xff, 0xbb, 0x00, 0x4f, 0xfc, 0x1a, 0xfa, 0x5f, 0xfc, 0x55, 0xfc, 0x1b, 0xf6, 0xff, 0xef, 
-0x07, 0xf1, 0xa1, 0xf9, 0x54, 0x0a, 0x38, 0x1a, 0xfb, 0x19, 0xe0, 0x0d, 0x8b, 0x00, 0x94, 0xf3, 
-0x09, 0xee, 0xfd, 0xf0, 0x2d, 0xf4, 0x18, 0xfa, 0x3f, 0x02, 0x02, 0x04, 0x41, 0x03, 0xc3, 0x05, 
-0x0f, 0x07, 0xda, 0x04, 0x43, 0x01, 0x50, 0xfc, 0x74, 0xf6, 0x08, 0xf6, 0x05, 0xfe, 0x0e, 0x04, 
-0xa0, 0x01, 0xab, 0xfc, 0x87, 0xf9, 0x00, 0xfb, 0x0c, 0x00, 0x29, 0x03, 0xcd, 0x08, 0x6f, 0x0f, 
-0x23, 0x08, 0x83, 0xf9, 0x2a, 0xf6, 0xda, 0xfa, 0x67, 0xff, 0x9d, 0x04, 0x01, 0x09, 0xac, 0x0a, 
-0xc8, 0x0a, 0xae, 0x09, 0xdf, 0x05, 0xe5, 0x00, 0x19, 0xfe, 0xf7, 0xf9, 0xbc, 0xf5, 0x9a, 0xf9, 
-0x4d, 0xfc, 0x20, 0xf7, 0x22, 0xfb, 0x9d, 0x08, 0xeb, 0x0e, 0x18, 0x10, 0x06, 0x0d, 0x54, 0xfe, 
-0x56, 0xef, 0x08, 0xf1, 0x1b, 0x00, 0x51, 0x0a, 0xfa, 0x06, 0x91, 0x00, 0x71, 0xfd, 0xc7, 0xf8, 
-0xb7, 0xf3, 0x00, 0xf2, 0xdf, 0xf5, 0x06, 0xff, 0x2a, 0x04, 0xea, 0x02, 0x54, 0x02, 0xd2, 0x00, 
-0x8d, 0xfe, 0x7e, 0x00, 0x07, 0x03, 0xa5, 0x02, 0xc3, 0xfe, 0x59, 0xf8, 0x7b, 0xf6, 0xb3, 0xf8, 
-0x6c, 0xf9, 0x51, 0xfd, 0x2c, 0x07, 0xec, 0x12, 0x3c, 0x1a, 0x48, 0x13, 0xa1, 0x00, 0x9e, 0xf1, 
-0xcf, 0xeb, 0x31, 0xeb, 0x7b, 0xed, 0x14, 0xf7, 0x9a, 0x09, 0x27, 0x14, 0xb4, 0x0c, 0xca, 0x04, 
-0xd1, 0x04, 0x73, 0x00, 0x57, 0xf6, 0xff, 0xf3, 0x72, 0xff, 0xf0, 0x0a, 0x7d, 0x08, 0xfd, 0xff, 
-0xf6, 0xfb, 0x7b, 0xfc, 0xcf, 0x00, 0x7b, 0x02, 0xb7, 0xff, 0xf7, 0x01, 0xeb, 0x03, 0xb2, 0xfc, 
-0xa6, 0xf7, 0x5d, 0xfb, 0x4e, 0x00, 0x86, 0x04, 0xd3, 0x08, 0xfa, 0x07, 0xee, 0xfe, 0x88, 0xf6, 
-0x60, 0xf6, 0x87, 0xf7, 0x04, 0xf9, 0xb2, 0x01, 0xd6, 0x09, 0xf2, 0x0a, 0xd2, 0x09, 0xbe, 0x06, 
-0x47, 0x03, 0xf7, 0xfd, 0x45, 0xf1, 0xc4, 0xeb, 0x42, 0xf7, 0x76, 0xff, 0x31, 0xfe, 0x44, 0x04, 
-0x1a, 0x0f, 0xa3, 0x0e, 0x60, 0x04, 0x49, 0xfb, 0x5b, 0xf4, 0xd2, 0xf0, 0xea, 0xf6, 0x71, 0xff, 
-0xb8, 0x04, 0xa2, 0x0d, 0xc9, 0x0c, 0x8d, 0xf8, 0xb9, 0xef, 0x55, 0xfe, 0xb6, 0x09, 0x6b, 0x0c, 
-0x1c, 0x10, 0x34, 0x0d, 0x12, 0x00, 0xd0, 0xf4, 0xa4, 0xf5, 0x4e, 0xfe, 0x79, 0x03, 0xd2, 0x02, 
-0x61, 0x01, 0xac, 0x01, 0x9b, 0xfe, 0xa3, 0xf3, 0x28, 0xf1, 0xfa, 0x02, 0xe3, 0x0f, 0xc5, 0x08, 
-0x50, 0x00, 0xa4, 0xfd, 0xc2, 0xfd, 0x5c, 0x04, 0xe4, 0x08, 0x70, 0x03, 0x26, 0xfe, 0xfd, 0xfe, 
-0x83, 0xfe, 0xf0, 0xf9, 0x25, 0xfa, 0x18, 0x00, 0xb3, 0xfe, 0x0f, 0xf6, 0x1d, 0xf2, 0x5d, 0xf3, 
-0x04, 0xf8, 0x32, 0xff, 0xa5, 0x03, 0x82, 0x07, 0x99, 0x0b, 0x86, 0x09, 0x23, 0x04, 0xfc, 0x00, 
-0x4a, 0x00, 0x67, 0x01, 0x69, 0x00, 0x81, 0x00, 0xc9, 0x07, 0x8d, 0x0b, 0xd9, 0x04, 0x17, 0xff, 
-0x24, 0xfe, 0xd9, 0xf8, 0x44, 0xee, 0xc5, 0xed, 0x16, 0xfe, 0xa2, 0x08, 0xf5, 0x01, 0x55, 0x02, 
-0xd8, 0x10, 0xbf, 0x13, 0x97, 0x03, 0x47, 0xf6, 0x27, 0xf8, 0x01, 0xfd, 0x6e, 0xfd, 0x63, 0x00, 
-0x66, 0x01, 0xea, 0xfb, 0xb3, 0xf9, 0x81, 0xf7, 0xdd, 0xf2, 0x87, 0xfc, 0x25, 0x0c, 0x0d, 0x07, 
-0x28, 0xf9, 0x72, 0xfc, 0x12, 0x05, 0x2b, 0xfe, 0x28, 0xf8, 0x85, 0x06, 0x67, 0x13, 0x8b, 0x0e, 
-0x7e, 0x0a, 0x75, 0x08, 0x5d, 0xfd, 0x8f, 0xf6, 0x51, 0xf8, 0x22, 0xf7, 0x03, 0xf8, 0x14, 0x00, 
-0x6a, 0x08, 0x40, 0x0e, 0xc3, 0x0e, 0x85, 0x05, 0xa8, 0xfa, 0x46, 0xfb, 0xa6, 0xff, 0x57, 0xf7, 
-0xb2, 0xee, 0xd5, 0xf5, 0x83, 0xfc, 0x4e, 0xfa, 0x12, 0xfe, 0x41, 0x07, 0x61, 0x0c, 0x68, 0x0b, 
-0xdf, 0x02, 0xd3, 0xfa, 0x1d, 0xfb, 0xc9, 0xf9, 0xbe, 0xf0, 0x5e, 0xed, 0xc3, 0xfa, 0xa1, 0x0b, 
-0xe4, 0x0e, 0x6e, 0x0e, 0x07, 0x10, 0xa9, 0x02, 0x31, 0xef, 0x80, 0xed, 0xc3, 0xf2, 0xf8, 0xf2, 
-0x20, 0xfa, 0x94, 0x06, 0xcd, 0x09, 0xc7, 0x06, 0x3d, 0x08, 0xa2, 0x09, 0xa6, 0x02, 0x25, 0xfa, 
-0x68, 0xf7, 0x9c, 0xf8, 0xaf, 0xfd, 0x3b, 0x02, 0xe1, 0x03, 0x6f, 0x0b, 0xfb, 0x11, 0x8e, 0x08, 
-0x0f, 0xfb, 0xa1, 0xfa, 0x85, 0x02, 0x70, 0x03, 0xf8, 0xf7, 0x56, 0xf0, 0x5c, 0xf6, 0x25, 0xfa, 
-0xdd, 0xf9, 0x68, 0x04, 0xa7, 0x11, 0x61, 0x11, 0xa6, 0x07, 0xcf, 0x00, 0x9f, 0xfe, 0xe6, 0xf7, 
-0x7a, 0xed, 0x2b, 0xef, 0x43, 0x00, 0x8c, 0x10, 0x8d, 0x13, 0xe0, 0x0d, 0x0e, 0x08, 0x05, 0x00, 
-0x5b, 0xf8, 0x0f, 0xfa, 0xa9, 0xfd, 0x02, 0xfd, 0xef, 0xfe, 0x8e, 0xfc, 0xda, 0xf3, 0xea, 0xf5, 
-0x17, 0xff, 0x92, 0x00, 0x60, 0x02, 0xaa, 0x0a, 0x0a, 0x0e, 0xb5, 0x06, 0xa7, 0xfc, 0x9d, 0xf8, 
-0x96, 0xf9, 0x57, 0xfa, 0x6c, 0xf9, 0x64, 0xf8, 0xd0, 0xfb, 0xf8, 0x03, 0x1a, 0x09, 0x88, 0x08, 
-0x08, 0x06, 0x27, 0x04, 0xf4, 0x01, 0x7f, 0xf9, 0xe8, 0xee, 0x3f, 0xf2, 0xa5, 0x00, 0x3b, 0x08, 
-0x61, 0x07, 0xcd, 0x05, 0xc3, 0x02, 0x35, 0xfb, 0xbe, 0xf4, 0x90, 0xf7, 0x1b, 0xfe, 0x84, 0xfd, 
-0xa9, 0xf9, 0x83, 0xfc, 0xe6, 0x05, 0xd2, 0x0c, 0xd2, 0x0d, 0x9f, 0x0f, 0x9f, 0x0f, 0x9d, 0x06, 
-0x07, 0xff, 0x39, 0xfe, 0x78, 0xfa, 0x6d, 0xf6, 0xf8, 0xf6, 0xed, 0xf6, 0xab, 0xf8, 0xd9, 0xff, 
-0xaf, 0x07, 0x99, 0x0b, 0x13, 0x0a, 0x48, 0x05, 0xa2, 0xff, 0x82, 0xfb, 0x37, 0xfc, 0x51, 0xfc, 
-0x6d, 0xfa, 0x23, 0xff, 0xcc, 0x02, 0x33, 0xfe, 0x8d, 0xfd, 0x6d, 0x00, 0x9a, 0xfe, 0x1b, 0xfc, 
-0xd4, 0xfb, 0x47, 0x04, 0x88, 0x14, 0xfd, 0x16, 0xd6, 0x0a, 0x79, 0x02, 0x57, 0xfa, 0x77, 0xec, 
-0x9b, 0xe2, 0x31, 0xe4, 0xee, 0xf0, 0x68, 0x01, 0xf8, 0x0c, 0x91, 0x10, 0xd6, 0x0f, 0xa4, 0x11, 
-0xed, 0x0a, 0x83, 0xf2, 0x16, 0xe7, 0x6c, 0xf5, 0xaa, 0xfb, 0x1c, 0xf7, 0xc1, 0xfe, 0x09, 0x0b, 
-0x83, 0x11, 0x29, 0x11, 0x49, 0x05, 0xa5, 0xf9, 0x5c, 0xfb, 0xa2, 0xff, 0xe7, 0xfc, 0x05, 0xfc, 
-0xcb, 0x03, 0xc8, 0x08, 0x86, 0x01, 0x07, 0xf8, 0x80, 0xf2, 0x32, 0xf1, 0xa5, 0xfc, 0x74, 0x0c, 
-0x6e, 0x0f, 0x64, 0x0f, 0xf0, 0x14, 0x1b, 0x10, 0xa5, 0xf8, 0x85, 0xe0, 0xe2, 0xe0, 0x96, 0xf5, 
-0x87, 0x01, 0x4c, 0x02, 0xe6, 0x07, 0x8e, 0x0b, 0x18, 0x07, 0xe2, 0x02, 0xa8, 0xfd, 0x96, 0xf7, 
-0xbe, 0xfa, 0xcc, 0x03, 0xec, 0x05, 0x0d, 0x01, 0x49, 0xfb, 0x39, 0xf3, 0x06, 0xeb, 0x5e, 0xed, 
-0x46, 0xfb, 0xab, 0x0c, 0x01, 0x1c, 0xf7, 0x1e, 0x90, 0x0f, 0x94, 0xfb, 0x61, 0xf0, 0x83, 0xec, 
-0xe6, 0xec, 0x31, 0xf2, 0x82, 0xfb, 0xd0, 0x03, 0xe0, 0x08, 0xd7, 0x0e, 0x2f, 0x12, 0xce, 0x0b, 
-0xa2, 0x02, 0x2b, 0xfc, 0x87, 0xf4, 0xa4, 0xf2, 0x00, 0xfe, 0x8d, 0x0a, 0xcb, 0x0a, 0xc1, 0x03, 
-0x9c, 0x02, 0xd3, 0x07, 0xd8, 0x07, 0xd3, 0x00, 0x08, 0xfc, 0xab, 0xfa, 0xe5, 0xf8, 0x7c, 0xfb, 
-0xce, 0x04, 0xa2, 0x09, 0x6b, 0x04, 0x72, 0xff, 0x51, 0xfd, 0x0f, 0xf8, 0xf0, 0xf5, 0x8a, 0xfa, 
-0x4e, 0xfd, 0x60, 0x00, 0x22, 0x09, 0x30, 0x0f, 0xec, 0x0b, 0x6e, 0x02, 0x2f, 0xfc, 0x2f, 0x00, 
-0xb9, 0x00, 0x35, 0xf4, 0x20, 0xf0, 0x91, 0xfa, 0x04, 0xfc, 0xcb, 0xf7, 0x78, 0x00, 0xc4, 0x08, 
-0x67, 0x04, 0x88, 0x00, 0xbf, 0xfe, 0xc0, 0xf7, 0x96, 0xf5, 0x5d, 0xfb, 0x17, 0xfc, 0x83, 0xfa, 
-0x50, 0x02, 0x01, 0x0f, 0x38, 0x17, 0xbe, 0x14, 0x82, 0x04, 0xfc, 0xf2, 0x22, 0xee, 0xf5, 0xf0, 
-0x69, 0xf6, 0xd6, 0x01, 0x7e, 0x0d, 0x2c, 0x11, 0x41, 0x0e, 0x6b, 0x05, 0x7e, 0xf5, 0xba, 0xe7, 
-0x68, 0xea, 0x20, 0xfc, 0x65, 0x0b, 0x43, 0x0f, 0x3b, 0x0d, 0x02, 0x07, 0xb2, 0xfb, 0x56, 0xf4, 
-0x64, 0xf8, 0x80, 0x01, 0xf4, 0x06, 0x20, 0x07, 0xf5, 0x02, 0xdd, 0xfc, 0x81, 0xf8, 0x5c, 0xf7, 
-0xd3, 0xfb, 0xf4, 0x04, 0x6e, 0x07, 0x35, 0x01, 0x94, 0x00, 0xdd, 0x04, 0xc7, 0x00, 0xc2, 0xfa, 
-0x58, 0xfe, 0x2a, 0x05, 0x03, 0x08, 0xe9, 0x07, 0x09, 0x04, 0x85, 0xfb, 0x74, 0xf3, 0xe6, 0xf1, 
-0x05, 0xf5, 0x67, 0xf9, 0x8c, 0x03, 0xcb, 0x10, 0xc8, 0x13, 0xbd, 0x0c, 0xaa, 0x03, 0x41, 0xf6, 
-0xa7, 0xe9, 0x74, 0xec, 0xbb, 0xfb, 0xba, 0x07, 0xaa, 0x0a, 0xc8, 0x07, 0x79, 0x02, 0xa7, 0xfd, 
-0x5c, 0xfb, 0xdf, 0xfb, 0x0f, 0x00, 0xa2, 0x06, 0x1e, 0x07, 0xf4, 0xfe, 0x8b, 0xfa, 0x32, 0xfd, 
-0x09, 0xfa, 0x76, 0xf2, 0x04, 0xf5, 0x73, 0xfe, 0x02, 0x02, 0x99, 0x03, 0x3f, 0x0b, 0x8a, 0x10, 
-0xea, 0x0a, 0xb1, 0x01, 0x7a, 0xfb, 0x5e, 0xf7, 0xa4, 0xf7, 0x04, 0xfa, 0x89, 0xf9, 0xbc, 0xfe, 
-0x64, 0x0c, 0xe6, 0x12, 0x0a, 0x0f, 0x24, 0x0b, 0x62, 0x05, 0xc1, 0xfa, 0x84, 0xf1, 0xea, 0xec, 
-0xc3, 0xee, 0x53, 0xf7, 0x4f, 0x00, 0xfb, 0x08, 0x64, 0x12, 0xb8, 0x12, 0x59, 0x08, 0x64, 0xfe, 
-0xe2, 0xf5, 0x73, 0xef, 0xe4, 0xf3, 0x89, 0xfd, 0x77, 0x03, 0x82, 0x0c, 0xd1, 0x14, 0x22, 0x0f, 
-0x51, 0x04, 0xb3, 0xff, 0x5e, 0xfa, 0xd5, 0xf4, 0x61, 0xf7, 0xe2, 0xfa, 0xc1, 0xf6, 0x83, 0xf3, 
-0xa1, 0xf9, 0xf1, 0x01, 0x2e, 0x05, 0x07, 0x08, 0x16, 0x0b, 0xee, 0x05, 0x15, 0xfc, 0xd3, 0xf9, 
-0x4c, 0xfb, 0xfd, 0xf6, 0xfe, 0xf5, 0x01, 0x00, 0xcc, 0x05, 0x88, 0xff, 0x32, 0xfc, 0x60, 0x00, 
-0xee, 0x03, 0x79, 0x07, 0x8c, 0x08, 0x7e, 0x03, 0xcb, 0xff, 0xb1, 0xfa, 0x8b, 0xef, 0xb4, 0xef, 
-0x23, 0x00, 0x06, 0x0e, 0xa3, 0x14, 0xed, 0x16, 0xbf, 0x0e, 0x7b, 0xfe, 0x7f, 0xef, 0xd0, 0xe6, 
-0x4f, 0xe8, 0x24, 0xf2, 0x71, 0xfc, 0x30, 0x03, 0x76, 0x07, 0xf2, 0x0a, 0x11, 0x0c, 0x05, 0x0a, 
-0x9a, 0x09, 0xd3, 0x0a, 0x68, 0x06, 0xd4, 0xfb, 0xab, 0xf3, 0xe5, 0xf5, 0x8f, 0xff, 0xc7, 0x03, 
-0xd7, 0x00, 0x41, 0x02, 0xa2, 0x05, 0xa9, 0xff, 0xd3, 0xf8, 0x54, 0xfd, 0x59, 0x00, 0x13, 0xf7, 
-0x3c, 0xf3, 0x69, 0xfe, 0x72, 0x06, 0x48, 0x05, 0xd5, 0x06, 0x00, 0x09, 0x69, 0x05, 0x67, 0x01, 
-0xd7, 0xfd, 0xcb, 0xf9, 0x09, 0xfd, 0x6e, 0x06, 0x5d, 0x0b, 0x80, 0x0b, 0xa2, 0x08, 0xba, 0xff, 
-0x7a, 0xf6, 0x0b, 0xf2, 0x0f, 0xef, 0x67, 0xf1, 0x93, 0xfa, 0x0e, 0x01, 0xf1, 0x05, 0x7b, 0x0c, 
-0x53, 0x0b, 0x2b, 0x02, 0x67, 0xf9, 0x22, 0xf4, 0xec, 0xf5, 0x45, 0xfb, 0x9e, 0xfc, 0x45, 0xfe, 
-0xe6, 0x00, 0xf9, 0xfd, 0xb3, 0xf9, 0x9b, 0xfa, 0x8d, 0x00, 0x05, 0x08, 0xe6, 0x0b, 0xcd, 0x0c, 
-0xb2, 0x0b, 0x65, 0x06, 0xee, 0x00, 0x30, 0xfc, 0x5b, 0xf7, 0x6a, 0xf9, 0xd7, 0xfc, 0xbc, 0xf8, 
-0x58, 0xf9, 0xa8, 0x04, 0xe6, 0x0d, 0x28, 0x0e, 0x6b, 0x0a, 0xb2, 0x0a, 0xc8, 0x09, 0x97, 0xfd, 
-0x87, 0xf4, 0xc4, 0xfb, 0xf5, 0x04, 0xd0, 0x04, 0xfe, 0xfd, 0x6b, 0xfa, 0x7e, 0x00, 0x51, 0xfe, 
-0x1c, 0xf0, 0xa2, 0xf3, 0x44, 0x05, 0x9a, 0x07, 0xd2, 0x00, 0x4c, 0xff, 0xd6, 0xff, 0x05, 0x02, 
-0xbf, 0x03, 0xb3, 0x00, 0xd3, 0xfc, 0xaa, 0xfb, 0x0c, 0xfa, 0x83, 0xf6, 0xe6, 0xf8, 0x82, 0x01, 
-0xdb, 0x02, 0x4d, 0x02, 0x56, 0x0a, 0xd6, 0x08, 0x72, 0xf9, 0xbe, 0xf2, 0xe2, 0xf6, 0xf9, 0xfa, 
-0x50, 0xfb, 0x5e, 0xf9, 0x30, 0x02, 0x8c, 0x11, 0x8b, 0x0d, 0x03, 0xff, 0xbd, 0x01, 0x88, 0x0b, 
-0xcc, 0x06, 0xe4, 0xf9, 0x32, 0xf5, 0x5e, 0xfa, 0x1d, 0xff, 0xb6, 0xfc, 0xbd, 0xf7, 0x87, 0xfc, 
-0x39, 0x0a, 0xa5, 0x0a, 0x58, 0xfd, 0x90, 0xfc, 0x42, 0x03, 0x84, 0xfd, 0x00, 0xf8, 0xc1, 0xfc, 
-0xb8, 0x00, 0x90, 0x00, 0x06, 0xfe, 0xd3, 0xfc, 0xa6, 0x03, 0x8a, 0x0b, 0x8c, 0x0a, 0x13, 0x05, 
-0x91, 0x01, 0x91, 0xfe, 0x6d, 0xf7, 0x5a, 0xf0, 0x43, 0xf5, 0x12, 0x03, 0xb0, 0x0b, 0x1b, 0x0e, 
-0x10, 0x0e, 0x07, 0x08, 0x9b, 0xfd, 0xf2, 0xf7, 0x33, 0xf8, 0xda, 0xf6, 0x60, 0xf6, 0x74, 0xfe, 
-0x5d, 0x07, 0x7c, 0x09, 0x52, 0x0a, 0x56, 0x08, 0x67, 0x00, 0x2e, 0xfa, 0xe1, 0xf6, 0xdc, 0xf3, 
-0x56, 0xf5, 0x3e, 0xfb, 0xbe, 0x03, 0x10, 0x0d, 0x37, 0x0f, 0xae, 0x0c, 0xd2, 0x0d, 0x17, 0x08, 
-0x2f, 0xf6, 0x7f, 0xeb, 0x34, 0xef, 0x79, 0xf3, 0xe2, 0xf4, 0xbd, 0xf8, 0x9d, 0xfe, 0x43, 0x07, 
-0x5e, 0x10, 0x3e, 0x10, 0x04, 0x09, 0x20, 0x07, 0xb6, 0x07, 0x03, 0xff, 0x9f, 0xf0, 0xd6, 0xe8, 
-0x5f, 0xea, 0x15, 0xf2, 0x43, 0x00, 0x96, 0x11, 0xfa, 0x1a, 0x55, 0x18, 0x4a, 0x10, 0x3c, 0x05, 
-0xe7, 0xf7, 0xc8, 0xf0, 0x01, 0xf1, 0xb1, 0xee, 0x9d, 0xec, 0xdf, 0xf5, 0x1a, 0x04, 0xb0, 0x0b, 
-0xdc, 0x0d, 0xa0, 0x09, 0xd2, 0xfe, 0x02, 0xfa, 0xe2, 0xfa, 0x80, 0xf5, 0x27, 0xf5, 0xd1, 0x04, 
-0x12, 0x10, 0x44, 0x09, 0xe5, 0xff, 0xd6, 0xff, 0x9a, 0x01, 0x22, 0xfd, 0xcd, 0xf9, 0x22, 0x00, 
-0x29, 0x05, 0x2e, 0xfe, 0xd3, 0xf4, 0xbc, 0xf1, 0x0f, 0xf4, 0x34, 0xfd, 0x3f, 0x09, 0xeb, 0x0e, 
-0x41, 0x0e, 0x1f, 0x0b, 0x0b, 0x04, 0xee, 0xfa, 0xbf, 0xf8, 0xe0, 0xff, 0x36, 0x06, 0x8e, 0x06, 
-0xd6, 0x08, 0x81, 0x0e, 0x08, 0x0d, 0x93, 0x02, 0x88, 0xf9, 0xd7, 0xf6, 0xa3, 0xf5, 0x64, 0xf3, 
-0xb6, 0xf4, 0x58, 0xfd, 0x7e, 0x0a, 0x0f, 0x15, 0x0f, 0x17, 0x46, 0x10, 0x21, 0x03, 0x6e, 0xf2, 
-0xd6, 0xe7, 0xb9, 0xeb, 0x5e, 0xf6, 0xbc, 0xfe, 0x58, 0x07, 0xff, 0x0c, 0xcf, 0x07, 0x35, 0xfe, 
-0xaf, 0xf9, 0x55, 0xf7, 0x56, 0xf3, 0xaa, 0xf1, 0xbe, 0xf7, 0x44, 0x03, 0xae, 0x09, 0x27, 0x08, 
-0x90, 0x05, 0x60, 0x00, 0xda, 0xf6, 0x71, 0xf2, 0xde, 0xf2, 0xe8, 0xf0, 0x8e, 0xf3, 0xa6, 0xfc, 
-0xfe, 0xff, 0x8f, 0xfe, 0xa7, 0x01, 0xfd, 0x05, 0xa2, 0x06, 0x83, 0x06, 0xe9, 0x08, 0x0c, 0x0d, 
-0x7d, 0x0d, 0x86, 0x06, 0xd5, 0xfd, 0xbb, 0xfa, 0x38, 0xfc, 0x96, 0xfe, 0x8e, 0x02, 0x6f, 0x07, 
-0xf0, 0x07, 0x1f, 0x04, 0xd0, 0x01, 0x8e, 0x02, 0x87, 0x05, 0xa8, 0x09, 0xff, 0x09, 0xd4, 0x04, 
-0x26, 0xfe, 0xa7, 0xf7, 0x7a, 0xf3, 0x96, 0xf6, 0x41, 0x00, 0x1b, 0x09, 0xb7, 0x0c, 0x37, 0x0f, 
-0xdb, 0x13, 0x51, 0x13, 0x93, 0x09, 0x7c, 0xff, 0x2b, 0xfa, 0x6f, 0xf6, 0x05, 0xf3, 0x33, 0xf0, 
-0x74, 0xf1, 0x0a, 0xf9, 0xfc, 0xfb, 0x8b, 0xf5, 0x09, 0xf6, 0xa3, 0x00, 0x06, 0x03, 0x55, 0xfc, 
-0x45, 0xfa, 0x1f, 0xf9, 0xd5, 0xf0, 0x31, 0xea, 0x2f, 0xef, 0x9f, 0xfc, 0xbf, 0x08, 0x99, 0x0b, 
-0x18, 0x05, 0xf8, 0xfc, 0x91, 0xf7, 0x8a, 0xf1, 0x26, 0xec, 0xc3, 0xef, 0xed, 0xfa, 0x7e, 0x02, 
-0x2f, 0x05, 0xa0, 0x08, 0x34, 0x0b, 0x9f, 0x09, 0xc0, 0x02, 0x3b, 0xf7, 0xf6, 0xf1, 0xe3, 0xfc, 
-0x0a, 0x0d, 0x3d, 0x13, 0x59, 0x12, 0xf6, 0x11, 0xa1, 0x0f, 0xbd, 0x08, 0xfe, 0x01, 0xf1, 0xff, 
-0xce, 0x03, 0x47, 0x0c, 0x80, 0x12, 0xd9, 0x12, 0x8e, 0x13, 0xf7, 0x13, 0x67, 0x0c, 0x3c, 0x02, 
-0x10, 0xfd, 0x93, 0xf8, 0x71, 0xf4, 0x32, 0xf6, 0x44, 0xfc, 0xd6, 0x02, 0xe8, 0x08, 0x33, 0x0d, 
-0x9a, 0x0e, 0xcd, 0x0c, 0xb1, 0x08, 0x68, 0x02, 0x13, 0xf9, 0x13, 0xf1, 0xc8, 0xed, 0x0c, 0xea, 
-0x4e, 0xe7, 0x56, 0xee, 0x43, 0xfa, 0xe3, 0xff, 0x82, 0xff, 0xd5, 0xfb, 0x32, 0xf6, 0x33, 0xf4, 
-0x3c, 0xf4, 0xe1, 0xef, 0xe8, 0xed, 0x0f, 0xf3, 0x60, 0xf3, 0xf1, 0xec, 0xce, 0xeb, 0x43, 0xed, 
-0x00, 0xe9, 0x17, 0xe6, 0xfa, 0xeb, 0x73, 0xf9, 0xb6, 0x0b, 0xbb, 0x1b, 0x22, 0x24, 0xb8, 0x25, 
-0xa9, 0x1a, 0x71, 0x01, 0x1e, 0xed, 0x7e, 0xe8, 0x31, 0xeb, 0x64, 0xfa, 0xdf, 0x1a, 0xff, 0x32, 
-0xb4, 0x31, 0x42, 0x24, 0xea, 0x10, 0xa8, 0xf9, 0xf9, 0xed, 0x80, 0xf0, 0x58, 0xf8, 0x13, 0x08, 
-0x02, 0x1b, 0x5f, 0x22, 0x90, 0x20, 0xb3, 0x1d, 0xb7, 0x14, 0x98, 0x05, 0xb0, 0xfa, 0xac, 0xf5, 
-0x3f, 0xf3, 0x4d, 0xf7, 0xce, 0x00, 0xe2, 0x06, 0x5f, 0x09, 0x79, 0x0a, 0x04, 0x04, 0xf7, 0xf6, 
-0x8a, 0xed, 0x82, 0xeb, 0x2f, 0xee, 0x80, 0xf1, 0x05, 0xf5, 0x70, 0xfd, 0xde, 0x04, 0xd3, 0xfe, 
-0xed, 0xf2, 0x12, 0xf0, 0xb6, 0xee, 0x42, 0xe3, 0x02, 0xd9, 0x16, 0xdd, 0x37, 0xe5, 0x36, 0xe5, 
-0xb3, 0xe4, 0xe0, 0xeb, 0xbb, 0xf6, 0x2e, 0x00, 0x9f, 0x04, 0xda, 0x04, 0x81, 0x07, 0x0b, 0x0b, 
-0x8f, 0x08, 0x49, 0x03, 0x75, 0x01, 0xa3, 0x02, 0xd0, 0x03, 0xf9, 0x03, 0x9e, 0x07, 0xff, 0x12, 
-0x2e, 0x1f, 0x21, 0x21, 0xf8, 0x18, 0x76, 0x0f, 0xab, 0x06, 0x41, 0xfb, 0x5e, 0xf5, 0xaa, 0xff, 
-0x1c, 0x10, 0x71, 0x16, 0x97, 0x14, 0x15, 0x14, 0xd7, 0x14, 0xaa, 0x11, 0x9e, 0x0c, 0x12, 0x0d, 
-0xc2, 0x11, 0xa8, 0x13, 0x34, 0x12, 0xa4, 0x0e, 0xd1, 0x08, 0x8b, 0x02, 0xaf, 0xfa, 0xd7, 0xf0, 
-0xb5, 0xeb, 0xc7, 0xee, 0x27, 0xf5, 0x25, 0xf9, 0x8a, 0xf9, 0x3a, 0xfa, 0x5f, 0xfc, 0xad, 0xfb, 
-0xad, 0xf9, 0x97, 0xfa, 0x5c, 0xf9, 0x2b, 0xf2, 0xe2, 0xeb, 0x81, 0xea, 0xb3, 0xe8, 0x73, 0xe4, 
-0x02, 0xe3, 0x44, 0xe5, 0x93, 0xe6, 0x58, 0xe6, 0x24, 0xe7, 0xe6, 0xeb, 0xe9, 0xf5, 0x6c, 0xfc, 
-0x4f, 0xf9, 0x41, 0xfa, 0x1d, 0x06, 0x02, 0x0c, 0x6f, 0x06, 0x0f, 0x03, 0x8a, 0x02, 0xa3, 0xfc, 
-0xd6, 0xf6, 0xc8, 0xf9, 0x0b, 0x04, 0xcc, 0x11, 0x38, 0x1f, 0x0b, 0x25, 0xa5, 0x21, 0x4c, 0x1d, 
-0xc5, 0x19, 0x86, 0x0d, 0x74, 0xfa, 0x81, 0xf2, 0xab, 0xf9, 0x2e, 0xfe, 0xfb, 0xfb, 0x74, 0x06, 
-0x0e, 0x1e, 0x35, 0x27, 0x3c, 0x1c, 0xe2, 0x15, 0x78, 0x1a, 0xe4, 0x17, 0x5c, 0x0a, 0x92, 0x00, 
-0x90, 0x01, 0x83, 0x04, 0x43, 0xff, 0xe7, 0xf5, 0x46, 0xf5, 0x71, 0xfe, 0xfb, 0x04, 0xff, 0x01, 
-0x59, 0xfc, 0xa2, 0xfc, 0x83, 0xff, 0xae, 0xfa, 0xd7, 0xf0, 0x62, 0xf0, 0xcd, 0xf7, 0x56, 0xf6, 
-0xf5, 0xeb, 0x6d, 0xe7, 0x38, 0xea, 0x6b, 0xec, 0x5c, 0xec, 0xdf, 0xea, 0x45, 0xea, 0x43, 0xec, 
-0xb7, 0xe9, 0x2f, 0xe1, 0xbc, 0xe1, 0x4e, 0xef, 0x18, 0xf9, 0x90, 0xfa, 0x9e, 0x01, 0x36, 0x10, 
-0x39, 0x17, 0x7a, 0x0e, 0x15, 0x00, 0x64, 0xf9, 0xf2, 0xf6, 0x40, 0xee, 0x1c, 0xe9, 0xe3, 0xf8, 
-0x90, 0x13, 0xef, 0x21, 0xb6, 0x23, 0x4b, 0x25, 0xf5, 0x24, 0x3f, 0x19, 0xe6, 0x03, 0x11, 0xf3, 
-0xe8, 0xf1, 0x39, 0xfb, 0x55, 0x04, 0x13, 0x0f, 0xa7, 0x1e, 0x95, 0x28, 0x65, 0x24, 0x93, 0x17, 
-0x19, 0x0a, 0xac, 0x00, 0x01, 0xfc, 0xc4, 0xf7, 0x71, 0xf6, 0x34, 0x00, 0x8c, 0x0e, 0x63, 0x14, 
-0x69, 0x14, 0xcb, 0x14, 0x02, 0x10, 0x14, 0x03, 0x5a, 0xf5, 0xef, 0xed, 0x0b, 0xef, 0xb9, 0xf4, 
-0xb6, 0xf6, 0x57, 0xf6, 0xce, 0xfc, 0xfa, 0x04, 0x6f, 0x02, 0xc5, 0xf9, 0xa7, 0xf3, 0x13, 0xec, 
-0xb1, 0xe2, 0x5c, 0xdf, 0x0b, 0xe3, 0xac, 0xe8, 0x3e, 0xec, 0x10, 0xeb, 0xac, 0xe4, 0xc0, 0xda, 
-0x56, 0xd4, 0x67, 0xdc, 0xd0, 0xef, 0x95, 0xfd, 0x4d, 0x04, 0x79, 0x10, 0x7b, 0x1a, 0xe0, 0x10, 
-0x25, 0xff, 0x74, 0xfa, 0xc0, 0xfa, 0xc4, 0xf4, 0xe0, 0xf5, 0x75, 0x04, 0xe4, 0x12, 0xcc, 0x1b, 
-0x47, 0x21, 0x76, 0x1e, 0x19, 0x14, 0xb3, 0x0b, 0xdd, 0x06, 0x76, 0x01, 0x24, 0xff, 0x76, 0x04, 
-0xf5, 0x0a, 0xc0, 0x0b, 0x03, 0x0c, 0x07, 0x11, 0xeb, 0x14, 0x8f, 0x12, 0x66, 0x0f, 0xd6, 0x10, 
-0x95, 0x12, 0x59, 0x10, 0xf8, 0x0e, 0x13, 0x11, 0xac, 0x10, 0x4f, 0x0c, 0x1f, 0x08, 0x20, 0x03, 
-0x44, 0xfd, 0xaf, 0xfb, 0xb3, 0xfc, 0x57, 0xfa, 0x18, 0xf8, 0xa0, 0xfa, 0x0c, 0xfc, 0x53, 0xf9, 
-0x1d, 0xf9, 0x80, 0xfb, 0xf7, 0xfa, 0x20, 0xfa, 0x84, 0xf9, 0xcf, 0xf2, 0x1b, 0xe9, 0x36, 0xe4, 
-0xa3, 0xe2, 0xf2, 0xe1, 0x0c, 0xe4, 0x63, 0xe9, 0x9d, 0xf0, 0xc2, 0xf5, 0x13, 0xf4, 0x48, 0xed, 
-0xdd, 0xe7, 0x9b, 0xe7, 0x41, 0xea, 0x82, 0xeb, 0xba, 0xee, 0x2f, 0xfb, 0x48, 0x0b, 0x6d, 0x10, 
-0xf4, 0x0a, 0xe6, 0x09, 0x05, 0x0d, 0x70, 0x04, 0x15, 0xf6, 0x60, 0xf7, 0x7a, 0x03, 0x1f, 0x0a, 
-0x99, 0x0f, 0x95, 0x18, 0x24, 0x1d, 0x05, 0x1a, 0xd3, 0x11, 0x77, 0x08, 0xf7, 0x02, 0x69, 0x01, 
-0x93, 0x02, 0xe9, 0x07, 0x79, 0x0f, 0x7d, 0x16, 0x88, 0x1b, 0x5c, 0x1a, 0x40, 0x12, 0x13, 0x0a, 
-0xcf, 0x06, 0x81, 0x05, 0x73, 0x02, 0x03, 0x03, 0x2b, 0x0c, 0x0e, 0x13, 0x44, 0x0e, 0x3e, 0x08, 
-0xc7, 0x08, 0xbf, 0x06, 0x09, 0xfe, 0x81, 0xf7, 0xf4, 0xf8, 0x5e, 0xff, 0xb4, 0x04, 0x6f, 0x04, 
-0x3c, 0xff, 0x90, 0xfa, 0xd2, 0xf8, 0xf9, 0xf6, 0x4d, 0xf6, 0xf7, 0xfb, 0xe7, 0x02, 0xac, 0xff, 
-0x8c, 0xf0, 0xa3, 0xdd, 0x5d, 0xd2, 0x8d, 0xd3, 0xfe, 0xd6, 0xe7, 0xd8, 0xf5, 0xe5, 0x52, 0xf6, 
-0x46, 0xf3, 0x08, 0xe9, 0x62, 0xed, 0xce, 0xf2, 0x1b, 0xee, 0xfb, 0xed, 0xdc, 0xf7, 0x2e, 0x04, 
-0xb1, 0x0d, 0x0c, 0x0e, 0x7e, 0x08, 0xd1, 0x08, 0x6c, 0x08, 0x0b, 0xfb, 0x5a, 0xf0, 0x9e, 0xfb, 
-0xfb, 0x0c, 0x54, 0x0f, 0x1a, 0x0f, 0x21, 0x19, 0xf7, 0x1d, 0xe8, 0x15, 0x73, 0x0d, 0x87, 0x08, 
-0x3f, 0x05, 0x04, 0x06, 0x0f, 0x07, 0x87, 0x05, 0x50, 0x07, 0x34, 0x0d, 0x05, 0x10, 0xd4, 0x0d, 
-0x43, 0x0e, 0x4a, 0x14, 0x4a, 0x16, 0xb7, 0x11, 0xe4, 0x0e, 0xa6, 0x0b, 0xb2, 0x04, 0x0f, 0x02, 
-0x08, 0x04, 0xdd, 0x05, 0x95, 0x0b, 0xc1, 0x13, 0x7b, 0x15, 0xc8, 0x0e, 0x3e, 0x04, 0x40, 0xfb, 
-0x4b, 0xf3, 0xd8, 0xe9, 0x14, 0xe8, 0xe8, 0xf3, 0x18, 0xff, 0x7a, 0x00, 0xea, 0x01, 0x65, 0x06, 
-0xef, 0x02, 0xf1, 0xf6, 0x02, 0xee, 0x0a, 0xe9, 0x23, 0xe3, 0x31, 0xe2, 0x1c, 0xe7, 0x51, 0xe9, 
-0x73, 0xea, 0x67, 0xec, 0x3d, 0xe8, 0x4e, 0xe0, 0x1c, 0xdb, 0xce, 0xd9, 0x35, 0xe2, 0x73, 0xf3, 
-0x61, 0xff, 0x9a, 0x04, 0xb2, 0x0e, 0x85, 0x18, 0xa8, 0x11, 0x13, 0x00, 0x76, 0xf9, 0xb7, 0xfc, 
-0xad, 0xf9, 0x42, 0xf4, 0xbe, 0xf9, 0x6e, 0x08, 0x9c, 0x14, 0xb7, 0x15, 0x3e, 0x12, 0xe0, 0x15, 
-0x28, 0x18, 0x0f, 0x0d, 0x9a, 0xff, 0x6c, 0xfd, 0xca, 0x02, 0x73, 0x06, 0x28, 0x08, 0xc0, 0x0f, 
-0xf1, 0x1b, 0xa4, 0x1f, 0x00, 0x18, 0x08, 0x10, 0x01, 0x0f, 0xf1, 0x0f, 0x85, 0x0a, 0x4a, 0x04, 
-0xbf, 0x07, 0xc2, 0x0d, 0xfe, 0x0b, 0x50, 0x06, 0x6b, 0x03, 0x76, 0x05, 0xf0, 0x06, 0xfd, 0x01, 
-0xe3, 0x00, 0xcf, 0x09, 0xe3, 0x0e, 0x40, 0x0b, 0x45, 0x05, 0x08, 0xfc, 0xd1, 0xf2, 0x7e, 0xee, 
-0x07, 0xea, 0xc6, 0xe7, 0x5a, 0xf0, 0xba, 0xfc, 0x7d, 0x00, 0x64, 0xfe, 0x08, 0xfe, 0x6f, 0xfb, 
-0xf4, 0xf0, 0xa2, 0xe4, 0x59, 0xdf, 0xf8, 0xe0, 0x67, 0xe0, 0x25, 0xda, 0xb3, 0xdb, 0xd4, 0xe5, 
-0x30, 0xe2, 0x8f, 0xd9, 0x74, 0xe8, 0xd7, 0xfb, 0x25, 0xfd, 0x20, 0x06, 0x89, 0x1c, 0xb0, 0x20, 
-0x7c, 0x13, 0x2b, 0x0b, 0x78, 0x01, 0x6c, 0xee, 0x29, 0xe3, 0x8b, 0xe9, 0xaf, 0xf6, 0xb2, 0x05, 
-0x17, 0x18, 0xea, 0x25, 0xdc, 0x28, 0x5d, 0x21, 0x0a, 0x11, 0x03, 0x01, 0x85, 0xf8, 0x87, 0xf5, 
-0x16, 0xfb, 0xd4, 0x08, 0xd3, 0x14, 0xd4, 0x1d, 0x99, 0x22, 0xa3, 0x1c, 0xde, 0x12, 0x41, 0x0d, 
-0x6f, 0x09, 0x00, 0x08, 0xea, 0x07, 0x8d, 0x07, 0xbb, 0x0a, 0x64, 0x0c, 0x15, 0x07, 0x4f, 0x02, 
-0x13, 0x01, 0x66, 0x01, 0x08, 0x05, 0x9f, 0x09, 0x97, 0x0e, 0x52, 0x15, 0x67, 0x15, 0x35, 0x0a, 
-0x48, 0xfc, 0x58, 0xf2, 0xa3, 0xeb, 0x04, 0xe7, 0xa0, 0xe8, 0x59, 0xf3, 0x34, 0xff, 0x30, 0x05, 
-0xad, 0x06, 0x1a, 0x03, 0x1a, 0xfb, 0x3c, 0xf1, 0xfd, 0xe3, 0xe4, 0xd8, 0x82, 0xd8, 0x27, 0xdf, 
-0x46, 0xe5, 0x51, 0xe5, 0x75, 0xe1, 0x85, 0xe6, 0xc0, 0xeb, 0xb5, 0xdd, 0x9c, 0xd5, 0xf6, 0xeb, 
-0x40, 0xfe, 0xd0, 0xfa, 0xd7, 0x03, 0xb0, 0x1a, 0xbf, 0x1d, 0x31, 0x0f, 0x91, 0x04, 0x9f, 0xfd, 
-0x28, 0xf6, 0x09, 0xf3, 0x6a, 0xf5, 0xe1, 0xfb, 0xcc, 0x07, 0x3e, 0x14, 0x22, 0x17, 0x41, 0x14, 
-0x0e, 0x17, 0x45, 0x19, 0x83, 0x10, 0x5b, 0x05, 0x5a, 0x01, 0x85, 0x01, 0x88, 0x01, 0x7f, 0x01, 
-0x5b, 0x08, 0x20, 0x18, 0xe7, 0x21, 0x60, 0x20, 0xce, 0x20, 0x34, 0x23, 0xb1, 0x1d, 0xdc, 0x11, 
-0x7b, 0x05, 0xe9, 0xfd, 0xf8, 0xfb, 0x00, 0xf9, 0x40, 0xf7, 0x9a, 0xfd, 0xce, 0x07, 0xc7, 0x0f, 
-0x1a, 0x12, 0xa8, 0x10, 0x9c, 0x13, 0x03, 0x14, 0x60, 0x07, 0xc9, 0xfa, 0x07, 0xf6, 0x3d, 0xef, 
-0x72, 0xe8, 0x97, 0xe8, 0x15, 0xee, 0x6b, 0xf6, 0x2d, 0xfc, 0xa8, 0xfe, 0xfe, 0x02, 0x0b, 0x04, 
-0x24, 0xfe, 0x1c, 0xf7, 0xd7, 0xee, 0xab, 0xe5, 0x0d, 0xe0, 0x33, 0xdc, 0x50, 0xd9, 0xa2, 0xd8, 
-0x21, 0xd8, 0x2a, 0xd8, 0x51, 0xd8, 0x59, 0xd9, 0x93, 0xe2, 0xf0, 0xf2, 0x6a, 0x01, 0x35, 0x0d, 
-0x56, 0x17, 0xa6, 0x1b, 0xc4, 0x16, 0xa0, 0x09, 0xfa, 0xfa, 0x07, 0xf1, 0x44, 0xed, 0xed, 0xf0, 
-0x7c, 0xf9, 0xca, 0x03, 0x3c, 0x12, 0x87, 0x1e, 0x5a, 0x1d, 0xba, 0x15, 0x68, 0x13, 0xb9, 0x10, 
-0xbf, 0x07, 0x2d, 0x01, 0x2b, 0x03, 0x1e, 0x07, 0x33, 0x08, 0xaa, 0x09, 0x84, 0x0d, 0xb4, 0x12, 
-0x65, 0x16, 0x30, 0x16, 0x63, 0x16, 0x85, 0x19, 0x44, 0x1a, 0xc3, 0x17, 0xe0, 0x13, 0xe1, 0x0d, 
-0xe7, 0x08, 0xfe, 0x04, 0xa9, 0xff, 0x13, 0xfe, 0x6c, 0x01, 0x46, 0x05, 0x26, 0x09, 0xed, 0x09, 
-0x37, 0x08, 0x77, 0x0a, 0xc2, 0x0a, 0x7b, 0x02, 0x75, 0xf9, 0x44, 0xf6, 0x17, 0xf7, 0x4e, 0xf5, 
-0xe3, 0xef, 0x48, 0xf2, 0xb5, 0xfa, 0x18, 0xfa, 0x2a, 0xf5, 0xf5, 0xf5, 0x47, 0xf8, 0xa3, 0xf8, 
-0x0f, 0xf3, 0xa8, 0xe7, 0x2e, 0xe2, 0x31, 0xe3, 0x03, 0xe1, 0x0c, 0xdc, 0x69, 0xda, 0x3a, 0xe0, 
-0x6d, 0xe4, 0xd4, 0xda, 0xea, 0xd4, 0xa9, 0xe3, 0xdc, 0xf2, 0x3c, 0xf6, 0x4e, 0xfe, 0x55, 0x11, 
-0x5a, 0x20, 0x77, 0x1d, 0x3b, 0x12, 0x3c, 0x10, 0xfa, 0x0c, 0x4b, 0xfc, 0xd8, 0xee, 0x1e, 0xef, 
-0x3c, 0xf6, 0x91, 0xff, 0xe4, 0x06, 0xd2, 0x0e, 0xe4, 0x1a, 0xae, 0x1e, 0xec, 0x15, 0x11, 0x0e, 
-0xbb, 0x0a, 0xb6, 0x06, 0xde, 0x02, 0x34, 0x03, 0x5b, 0x08, 0x50, 0x0e, 0x4f, 0x15, 0xbb, 0x1e, 
-0xc0, 0x22, 0xeb, 0x1f, 0xfb, 0x1c, 0xac, 0x16, 0xf8, 0x0b, 0xdb, 0x04, 0x07, 0x03, 0xfb, 0x04, 
-0x57, 0x07, 0x3b, 0x05, 0x29, 0x04, 0xb8, 0x07, 0xd9, 0x08, 0x85, 0x07, 0xbf, 0x07, 0x02, 0x08, 
-0xc8, 0x07, 0x9d, 0x05, 0xc6, 0x00, 0x54, 0xfd, 0x1c, 0xfb, 0xf5, 0xf6, 0x9c, 0xf1, 0xa6, 0xed, 
-0xad, 0xee, 0xcb, 0xf3, 0x8c, 0xf7, 0x70, 0xfa, 0x4c, 0xfe, 0x12, 0x00, 0x1c, 0xfd, 0xa4, 0xf3, 
-0x06, 0xe7, 0x49, 0xde, 0xa1, 0xd8, 0xc6, 0xd5, 0x09, 0xd9, 0xee, 0xdc, 0x4b, 0xdf, 0xac, 0xe3, 
-0x6f, 0xe2, 0xee, 0xdb, 0xed, 0xe0, 0x6d, 0xf0, 0xde, 0xfa, 0x78, 0x02, 0x3e, 0x11, 0x11, 0x20, 
-0x97, 0x20, 0x41, 0x15, 0x59, 0x0a, 0x0d, 0xff, 0xce, 0xef, 0xc2, 0xe6, 0xb7, 0xeb, 0xef, 0xfa, 
-0x28, 0x0e, 0x02, 0x1e, 0xc6, 0x25, 0x74, 0x25, 0xa4, 0x1c, 0xd7, 0x0e, 0xc6, 0x01, 0x31, 0xf6, 
-0x26, 0xf1, 0x77, 0xf9, 0x51, 0x07, 0xfb, 0x10, 0xec, 0x1a, 0x48, 0x27, 0x19, 0x2c, 0x77, 0x24, 
-0x18, 0x19, 0x69, 0x13, 0xb5, 0x10, 0xda, 0x08, 0x33, 0x00, 0x5d, 0x01, 0x58, 0x06, 0xe3, 0x02, 
-0xfc, 0xfb, 0xef, 0xfb, 0xb8, 0x01, 0x67, 0x07, 0x4c, 0x0a, 0xf8, 0x0d, 0xbe, 0x13, 0x54, 0x12, 
-0x24, 0x07, 0x1a, 0xfd, 0x6a, 0xf8, 0x35, 0xf5, 0xcf, 0xf1, 0xa8, 0xee, 0x73, 0xef, 0x0c, 0xf5, 
-0xcc, 0xf9, 0xd4, 0xfb, 0xa0, 0xfd, 0x6e, 0x00, 0x2f, 0x01, 0x04, 0xfb, 0xd6, 0xf4, 0x8c, 0xf4, 
-0x68, 0xed, 0xe6, 0xdd, 0x51, 0xd4, 0x13, 0xd0, 0x09, 0xcf, 0x34, 0xd4, 0x7b, 0xda, 0x8f, 0xe5, 
-0x25, 0xf4, 0xee, 0xf3, 0xc9, 0xef, 0xd7, 0xfc, 0x24, 0x05, 0x06, 0xfb, 0x42, 0xfb, 0xe7, 0x0b, 
-0x0f, 0x11, 0x83, 0x09, 0x9e, 0x0b, 0x7e, 0x11, 0xb8, 0x07, 0x0d, 0xf9, 0x8b, 0xf5, 0x15, 0xf8, 
-0x9c, 0xfe, 0xaf, 0x08, 0x8a, 0x0e, 0x02, 0x14, 0x32, 0x1b, 0x00, 0x18, 0xae, 0x0b, 0x61, 0x03, 
-0xc7, 0x01, 0x4e, 0x03, 0x9e, 0x05, 0xbe, 0x0a, 0x38, 0x16, 0xb9, 0x20, 0xf5, 0x1f, 0x67, 0x18, 
-0x1d, 0x15, 0x91, 0x15, 0xcb, 0x11, 0xc3, 0x0b, 0x6b, 0x0b, 0x52, 0x0f, 0xef, 0x10, 0x81, 0x0c, 
-0xe8, 0x03, 0x9d, 0xfe, 0xce, 0xfb, 0x07, 0xf6, 0x39, 0xf4, 0xb8, 0xfb, 0x81, 0x07, 0xdd, 0x11, 
-0x42, 0x13, 0xab, 0x0e, 0x99, 0x0e, 0xa9, 0x09, 0xbe, 0xf8, 0x97, 0xeb, 0x01, 0xe9, 0x2e, 0xeb, 
-0x56, 0xef, 0xde, 0xf3, 0x0b, 0xfc, 0x03, 0x04, 0xaa, 0x00, 0x7d, 0xf9, 0xaf, 0xf7, 0xfc, 0xf5, 
-0xde, 0xf3, 0x82, 0xee, 0xd3, 0xe2, 0x0d, 0xdb, 0xb5, 0xd8, 0x74, 0xd6, 0xe9, 0xd6, 0x6c, 0xd8, 
-0xcc, 0xdc, 0xd1, 0xe4, 0x30, 0xe5, 0x92, 0xe6, 0xd0, 0xf7, 0x82, 0x08, 0x15, 0x0d, 0x04, 0x10, 
-0x98, 0x15, 0x99, 0x18, 0x7c, 0x0f, 0x73, 0xff, 0xf5, 0xfa, 0x11, 0xf9, 0x38, 0xef, 0xef, 0xf0, 
-0xdf, 0xfe, 0xe2, 0x08, 0x95, 0x12, 0x73, 0x1a, 0x56, 0x1a, 0xd7, 0x18, 0xa1, 0x15, 0xe7, 0x0d, 
-0x10, 0x06, 0xd4, 0x00, 0x8e, 0x01, 0xcc, 0x04, 0x7d, 0x05, 0x02, 0x0c, 0xeb, 0x16, 0x6e, 0x1a, 
-0xf9, 0x1a, 0x74, 0x1d, 0xa6, 0x1d, 0xb0, 0x1b, 0xea, 0x16, 0xbc, 0x0f, 0x1a, 0x0a, 0x96, 0x04, 
-0x9a, 0xfd, 0xe8, 0xf6, 0xab, 0xf4, 0x11, 0xfb, 0xab, 0x02, 0x76, 0x05, 0x70, 0x0b, 0xac, 0x12, 
-0xab, 0x10, 0x88, 0x08, 0xf1, 0x01, 0x9d, 0xff, 0x05, 0xff, 0x3a, 0xfa, 0x9e, 0xf5, 0xfe, 0xf8, 
-0x8d, 0xfd, 0x2d, 0xfb, 0xb9, 0xf6, 0x9d, 0xf6, 0xeb, 0xf6, 0x03, 0xf2, 0xfb, 0xed, 0x69, 0xf1, 
-0x7c, 0xf7, 0xa3, 0xfa, 0x9b, 0xf8, 0xb8, 0xf1, 0xf4, 0xe9, 0x98, 0xe1, 0xbb, 0xd9, 0x2a, 0xd5, 
-0xdb, 0xd0, 0x8a, 0xd2, 0x64, 0xde, 0x73, 0xe2, 0xc4, 0xdf, 0x2c, 0xef, 0xab, 0x05, 0x88, 0x09, 
-0xa7, 0x08, 0xb7, 0x14, 0x25, 0x1d, 0xc3, 0x12, 0x96, 0x04, 0xf9, 0x00, 0xcc, 0xfd, 0xe1, 0xf4, 
-0x36, 0xf0, 0xfb, 0xf2, 0x10, 0xfb, 0xb3, 0x07, 0x4e, 0x12, 0xa5, 0x17, 0xf9, 0x1b, 0x67, 0x20, 
-0x3c, 0x1f, 0x13, 0x12, 0x1b, 0x03, 0x65, 0x02, 0x89, 0x04, 0xb4, 0xfc, 0xa8, 0xfc, 0xe5, 0x0c, 
-0xa3, 0x1a, 0x63, 0x1c, 0xd6, 0x1a, 0xb8, 0x1c, 0x91, 0x1d, 0x65, 0x17, 0x42, 0x0e, 0x7f, 0x08, 
-0xbb, 0x06, 0xed, 0x05, 0x76, 0x01, 0x7d, 0xfc, 0x00, 0xff, 0x3e, 0x05, 0x75, 0x06, 0xd8, 0x02, 
-0xdc, 0x01, 0xeb, 0x07, 0x9f, 0x0b, 0x87, 0x06, 0x4e, 0x04, 0xcd, 0x07, 0xfe, 0x05, 0x53, 0xfe, 
-0xa3, 0xf5, 0x9d, 0xef, 0x2e, 0xef, 0x2d, 0xef, 0x31, 0xef, 0x1d, 0xf5, 0x0a, 0xfc, 0xc5, 0xff, 
-0xaf, 0x01, 0x20, 0xfe, 0xf2, 0xf7, 0x9e, 0xf5, 0xc1, 0xf1, 0x06, 0xe7, 0xfc, 0xda, 0xd4, 0xd6, 
-0x00, 0xdb, 0x86, 0xdd, 0x90, 0xdd, 0x8c, 0xe3, 0xcb, 0xeb, 0xef, 0xec, 0xdc, 0xe7, 0xfb, 0xe6, 
-0x07, 0xf2, 0xb4, 0xfe, 0x5b, 0x02, 0xee, 0x06, 0x8d, 0x11, 0x5f, 0x18, 0xf5, 0x16, 0x44, 0x0f, 
-0xa4, 0x08, 0x08, 0x07, 0x1c, 0xff, 0x53, 0xf2, 0xa4, 0xf3, 0x84, 0xff, 0x32, 0x05, 0x1b, 0x08, 
-0x40, 0x10, 0x36, 0x16, 0x22, 0x13, 0x45, 0x0f, 0xac, 0x0f, 0xed, 0x0c, 0x04, 0x0a, 0xbd, 0x0d, 
-0xe4, 0x0e, 0xd0, 0x0b, 0x7b, 0x0e, 0xae, 0x13, 0x40, 0x15, 0xa4, 0x15, 0x75, 0x17, 0x48, 0x19, 
-0x07, 0x14, 0x32, 0x0a, 0xdf, 0x07, 0x8a, 0x06, 0xd7, 0xfe, 0x57, 0xfd, 0x9c, 0x01, 0x8f, 0x00, 
-0xd8, 0xff, 0xf9, 0x04, 0x5c, 0x0a, 0xba, 0x0a, 0xe9, 0x06, 0x35, 0x05, 0x6b, 0x04, 0x2d, 0x00, 
-0xc8, 0xfe, 0xcc, 0x00, 0x50, 0x00, 0x0c, 0xff, 0x81, 0xfa, 0x98, 0xf2, 0x3c, 0xf1, 0x31, 0xf3, 
-0x4c, 0xf0, 0x32, 0xef, 0x27, 0xf5, 0xfc, 0xfb, 0xed, 0xfa, 0xd3, 0xf4, 0xca, 0xf5, 0x01, 0xf6, 
-0x36, 0xe7, 0xd0, 0xd9, 0xf0, 0xdc, 0x00, 0xe1, 0xbd, 0xdb, 0xe0, 0xd8, 0x5c, 0xe0, 0xa6, 0xe6, 
-0x0b, 0xe0, 0xc7, 0xdb, 0x90, 0xeb, 0x16, 0x00, 0x3d, 0x08, 0x12, 0x10, 0x9d, 0x20, 0xb1, 0x28, 
-0x58, 0x1b, 0x67, 0x07, 0xb4, 0xfc, 0x89, 0xf4, 0xab, 0xe8, 0x86, 0xe3, 0x69, 0xed, 0x6f, 0x00, 
-0x1f, 0x11, 0xe2, 0x1a, 0xca, 0x20, 0x7c, 0x23, 0x3e, 0x1f, 0x01, 0x12, 0x3d, 0x02, 0xd4, 0xfc, 
-0x58, 0x01, 0xe9, 0x03, 0x3e, 0x06, 0x1e, 0x0f, 0xf2, 0x18, 0xd8, 0x1c, 0x12, 0x1a, 0x73, 0x15, 
-0xd3, 0x14, 0xb0, 0x15, 0x96, 0x14, 0x79, 0x12, 0x01, 0x10, 0x59, 0x10, 0x9e, 0x0f, 0x22, 0x04, 
-0x9a, 0xf6, 0x55, 0xf4, 0xc8, 0xf7, 0x0c, 0xf9, 0xee, 0xfa, 0xea, 0x05, 0x1e, 0x18, 0xdb, 0x1d, 
-0x09, 0x14, 0xe5, 0x0d, 0x0b, 0x0a, 0x7d, 0xfb, 0x21, 0xe9, 0xc8, 0xdf, 0xc8, 0xe2, 0x6b, 0xea, 
-0x44, 0xef, 0xc9, 0xf8, 0x9b, 0x07, 0x58, 0x0d, 0x31, 0x09, 0xf0, 0x02, 0x44, 0xfa, 0x7f, 0xef, 
-0x56, 0xe5, 0x52, 0xdf, 0x53, 0xde, 0xab, 0xdc, 0x8c, 0xdc, 0x55, 0xe4, 0x2c, 0xec, 0xc7, 0xeb, 
-0xe6, 0xe8, 0x01, 0xeb, 0xaa, 0xec, 0xf3, 0xe3, 0x7e, 0xdd, 0x70, 0xeb, 0xa3, 0xfd, 0xc8, 0x02, 
-0xb2, 0x09, 0x08, 0x18, 0xb7, 0x1c, 0xd8, 0x12, 0x4b, 0x06, 0x3a, 0xff, 0xba, 0xf9, 0x9d, 0xf2, 
-0x85, 0xf0, 0x8a, 0xf6, 0xd1, 0x01, 0x4f, 0x0f, 0xf1, 0x17, 0xb4, 0x19, 0x7e, 0x19, 0xb4, 0x16, 
-0x86, 0x10, 0x8b, 0x08, 0xf2, 0x01, 0x6d, 0x04, 0x43, 0x0b, 0x72, 0x0b, 0xfd, 0x0c, 0x04, 0x15, 
-0xa3, 0x17, 0x32, 0x12, 0xd2, 0x0c, 0x53, 0x0c, 0xd3, 0x0e, 0xe6, 0x0f, 0x1a, 0x13, 0x8d, 0x17, 
-0x5a, 0x12, 0x43, 0x08, 0x2d, 0x03, 0x95, 0xfd, 0x87, 0xf7, 0x8a, 0xf8, 0xcb, 0xff, 0x1f, 0x07, 
-0x7d, 0x08, 0xb4, 0x08, 0x38, 0x0f, 0x3c, 0x11, 0x50, 0x08, 0xa3, 0xff, 0x26, 0xfb, 0x5b, 0xf8, 
-0xab, 0xf5, 0x5e, 0xf1, 0xd6, 0xf1, 0xec, 0xf7, 0x72, 0xf9, 0x9a, 0xf6, 0xbc, 0xf5, 0x1e, 0xf9, 
-0xa1, 0xfe, 0xe9, 0xfc, 0xd3, 0xf5, 0xb8, 0xf5, 0x2c, 0xf7, 0x2b, 0xf0, 0x60, 0xe5, 0x2a, 0xde, 
-0xd7, 0xdd, 0x4c, 0xdf, 0xcf, 0xdc, 0xc6, 0xdd, 0x14, 0xe5, 0xa2, 0xea, 0x92, 0xeb, 0xcc, 0xe9, 
-0x06, 0xed, 0x42, 0xfa, 0x3e, 0x05, 0xce, 0x07, 0x3a, 0x0c, 0x5b, 0x14, 0x5a, 0x17, 0xf5, 0x0e, 
-0xad, 0x01, 0x12, 0xfd, 0xc3, 0xfb, 0xe2, 0xf2, 0x2a, 0xee, 0xe8, 0xf7, 0xb4, 0x07, 0xeb, 0x12, 
-0xb4, 0x16, 0x80, 0x19, 0x9c, 0x1b, 0x39, 0x13, 0x36, 0x05, 0xf7, 0xfd, 0x3f, 0xfe, 0xab, 0x04, 
-0x86, 0x0d, 0x9f, 0x14, 0x91, 0x1c, 0x82, 0x21, 0x73, 0x1d, 0xf6, 0x13, 0x68, 0x09, 0x89, 0x03, 
-0xc6, 0x03, 0x64, 0x02, 0x8a, 0x02, 0x02, 0x0a, 0xbc, 0x0f, 0x61, 0x0e, 0xbe, 0x09, 0xe0, 0x05, 
-0x48, 0x05, 0xcd, 0x03, 0x2a, 0x02, 0x1a, 0x07, 0x11, 0x0c, 0x2b, 0x0b, 0x07, 0x09, 0x1d, 0x04, 
-0xfc, 0xfb, 0xfa, 0xf5, 0x3f, 0xf3, 0xe8, 0xf3, 0x58, 0xf5, 0x39, 0xf7, 0x43, 0xff, 0x71, 0x06, 
-0xf2, 0x03, 0x37, 0x00, 0x7d, 0xfe, 0x04, 0xf8, 0xae, 0xed, 0x63, 0xe6, 0x9f, 0xe8, 0x0a, 0xf0, 
-0x50, 0xf2, 0xa9, 0xf2, 0xed, 0xf3, 0x22, 0xf0, 0x3b, 0xea, 0x3b, 0xe5, 0x70, 0xdf, 0xc1, 0xdd, 
-0x72, 0xe0, 0x80, 0xe1, 0xda, 0xe0, 0xd8, 0xe3, 0x1a, 0xf0, 0xba, 0xfd, 0x5a, 0x00, 0x36, 0x03, 
-0x49, 0x10, 0x95, 0x17, 0x1c, 0x11, 0x9d, 0x09, 0x28, 0x09, 0xa0, 0x07, 0xb2, 0xfb, 0xf7, 0xf1, 
-0xc2, 0xf8, 0x42, 0x02, 0x86, 0x03, 0x4d, 0x06, 0x1d, 0x0d, 0x76, 0x12, 0x48, 0x14, 0x7a, 0x13, 
-0xbb, 0x13, 0x4e, 0x13, 0x49, 0x10, 0x24, 0x0e, 0x88, 0x09, 0xf3, 0x03, 0xd8, 0x06, 0xb8, 0x0b, 
-0xfb, 0x0a, 0xb6, 0x0c, 0x27, 0x14, 0x20, 0x1b, 0x0f, 0x1b, 0xbf, 0x14, 0x9d, 0x11, 0x98, 0x0f, 
-0xa9, 0x06, 0x9e, 0xfd, 0x8b, 0xf9, 0x4d, 0xf8, 0xd2, 0xfa, 0xa7, 0xfd, 0x94, 0x00, 0x15, 0x08, 
-0x54, 0x0e, 0x82, 0x0e, 0x01, 0x0b, 0x0d, 0x06, 0x35, 0x04, 0x7d, 0x02, 0x41, 0xfb, 0x5a, 0xf6, 
-0xb1, 0xf6, 0x26, 0xf6, 0xb0, 0xf5, 0x0e, 0xf6, 0xe7, 0xf7, 0x4b, 0xfc, 0x5a, 0xfc, 0x4c, 0xf8, 
-0x5c, 0xf7, 0xd1, 0xf7, 0x11, 0xf7, 0xd7, 0xf3, 0xd9, 0xee, 0x24, 0xee, 0x63, 0xec, 0x4c, 0xe3, 
-0x6d, 0xde, 0x43, 0xe1, 0xa5, 0xe1, 0x72, 0xdf, 0xc4, 0xe1, 0x99, 0xea, 0x40, 0xf1, 0x07, 0xf0, 
-0x6e, 0xf4, 0x16, 0x02, 0xcc, 0x07, 0x90, 0x05, 0xf1, 0x08, 0x28, 0x10, 0xc4, 0x10, 0x2d, 0x08, 
-0x5b, 0x01, 0x71, 0x02, 0xe5, 0xfe, 0xfc, 0xf4, 0x87, 0xf3, 0xe8, 0xfb, 0x03, 0x06, 0x93, 0x0d, 
-0x8a, 0x11, 0xb0, 0x15, 0xba, 0x18, 0x9c, 0x14, 0xa8, 0x0b, 0xdb, 0x03, 0x8c, 0x02, 0xf9, 0x06, 
-0x76, 0x07, 0x17, 0x07, 0x8e, 0x10, 0x2b, 0x1b, 0x94, 0x1b, 0x6c, 0x16, 0x2e, 0x13, 0xb6, 0x12, 
-0x69, 0x0f, 0x91, 0x07, 0xf5, 0x01, 0x02, 0x01, 0xf4, 0x02, 0x59, 0x04, 0x7b, 0x00, 0xe9, 0xff, 
-0xb8, 0x09, 0x57, 0x0e, 0x47, 0x06, 0x69, 0x01, 0x16, 0x07, 0x7e, 0x0a, 0x1f, 0x02, 0x01, 0xfb, 
-0xd0, 0x01, 0x96, 0x07, 0xf6, 0x00, 0x52, 0xfb, 0x7b, 0xfc, 0x24, 0xfc, 0x91, 0xf6, 0xc2, 0xef, 
-0xf0, 0xef, 0xc4, 0xf5, 0x20, 0xf8, 0x90, 0xf8, 0x46, 0xfa, 0x47, 0xfb, 0x7e, 0xfb, 0x2b, 0xf7, 
-0xaa, 0xef, 0x87, 0xec, 0xa2, 0xe8, 0x32, 0xe1, 0x0a, 0xe0, 0xee, 0xe4, 0xf3, 0xe7, 0xd9, 0xe7, 
-0xa8, 0xe9, 0x45, 0xef, 0x2b, 0xed, 0x21, 0xe4, 0xb0, 0xea, 0x17, 0xfc, 0x78, 0x00, 0x50, 0x01, 
-0xb5, 0x0f, 0x2b, 0x1e, 0xa4, 0x19, 0xbc, 0x09, 0xb4, 0x04, 0x02, 0x05, 0x2f, 0xf6, 0xbd, 0xe7, 
-0xca, 0xee, 0x56, 0xfd, 0x7d, 0x06, 0x9c, 0x0e, 0xd1, 0x17, 0x57, 0x1f, 0x9f, 0x1e, 0x10, 0x16, 
-0x46, 0x0d, 0x33, 0x04, 0x5d, 0xfe, 0xc1, 0xff, 0x83, 0xff, 0x1c, 0x01, 0xc6, 0x0e, 0xf8, 0x1b, 
-0x30, 0x1c, 0x1f, 0x16, 0xee, 0x13, 0x66, 0x15, 0x71, 0x0f, 0xe7, 0x04, 0x0b, 0x06, 0xc0, 0x0b, 
-0x9e, 0x07, 0x20, 0x01, 0xee, 0xff, 0xa1, 0x02, 0x3e, 0x05, 0xf2, 0x02, 0x82, 0x01, 0xdf, 0x05, 
-0x60, 0x08, 0x9b, 0x06, 0x50, 0x04, 0x14, 0x04, 0x6e, 0x06, 0x8a, 0x03, 0x06, 0xfb, 0x07, 0xf8, 
-0xcd, 0xf7, 0xbc, 0xf3, 0xc6, 0xf1, 0x9b, 0xf4, 0xcf, 0xf8, 0xf3, 0xfa, 0x3e, 0xfa, 0xd2, 0xfa, 
-0x71, 0xfa, 0xa4, 0xf5, 0x11, 0xf3, 0x33, 0xf2, 0x8d, 0xed, 0xae, 0xea, 0xae, 0xeb, 0xee, 0xea, 
-0x87, 0xe8, 0xcd, 0xe8, 0x17, 0xec, 0x86, 0xeb, 0x9f, 0xe6, 0x05, 0xe8, 0x09, 0xec, 0x66, 0xe8, 
-0x0e, 0xe8, 0x9f, 0xf3, 0x6d, 0xff, 0x5c, 0x05, 0x88, 0x0c, 0xe2, 0x16, 0x40, 0x1a, 0x24, 0x12, 
-0x12, 0x0a, 0xf5, 0x05, 0xe4, 0xfd, 0xb8, 0xf4, 0x95, 0xf0, 0x9b, 0xf1, 0x1c, 0xf9, 0xf8, 0x02, 
-0x8a, 0x0a, 0xb5, 0x13, 0x1c, 0x1d, 0x78, 0x1f, 0xd7, 0x19, 0x16, 0x12, 0xba, 0x0d, 0x4e, 0x08, 
-0xee, 0xfe, 0xc5, 0xfc, 0xf9, 0x03, 0x60, 0x0a, 0xdb, 0x0f, 0x5d, 0x16, 0xc4, 0x1a, 0xf2, 0x1b, 
-0xb1, 0x17, 0x34, 0x10, 0xe0, 0x0a, 0x84, 0x05, 0x62, 0x00, 0x3a, 0xff, 0xc6, 0x00, 0x30, 0x05, 
-0x9a, 0x09, 0x83, 0x08, 0xe5, 0x05, 0x27, 0x04, 0x9c, 0x00, 0x03, 0xfe, 0xc4, 0xfd, 0x9b, 0x00, 
-0x85, 0x06, 0x79, 0x07, 0x2b, 0x04, 0xd8, 0x04, 0x47, 0x03, 0x0e, 0xfa, 0x1b, 0xf1, 0xa7, 0xed, 
-0x75, 0xee, 0x33, 0xef, 0xaf, 0xef, 0x11, 0xf6, 0xd5, 0xfd, 0x5c, 0xfe, 0xe6, 0xfb, 0x89, 0xf9, 
-0x06, 0xf6, 0xb3, 0xf2, 0xff, 0xeb, 0xfc, 0xe2, 0x8b, 0xe0, 0x22, 0xe3, 0x21, 0xe4, 0x36, 0xe4, 
-0xe6, 0xe7, 0xc0, 0xf0, 0x04, 0xf5, 0xdd, 0xee, 0xa9, 0xec, 0x31, 0xf4, 0xf7, 0xf7, 0x89, 0xf7, 
-0x36, 0xff, 0xfe, 0x0d, 0x5f, 0x16, 0x62, 0x13, 0x51, 0x0f, 0xf1, 0x0c, 0x35, 0x02, 0x32, 0xf4, 
-0x61, 0xf0, 0x24, 0xf3, 0x17, 0xf7, 0xb2, 0x00, 0x85, 0x0e, 0x6c, 0x18, 0x71, 0x1b, 0xf1, 0x1a, 
-0x10, 0x18, 0xdb, 0x0f, 0x43, 0x06, 0x1a, 0x03, 0x48, 0x04, 0x3e, 0x05, 0x75, 0x08, 0x27, 0x0f, 
-0x17, 0x15, 0x95, 0x16, 0x09, 0x15, 0xab, 0x13, 0x57, 0x11, 0xa6, 0x0c, 0x36, 0x09, 0xf7, 0x08, 
-0x6b, 0x08, 0xcf, 0x05, 0x57, 0x04, 0xd4, 0x04, 0x6f, 0x03, 0x90, 0x00, 0x20, 0x00, 0x2d, 0x01, 
-0x88, 0x01, 0xb3, 0x01, 0x90, 0x02, 0xe1, 0x04, 0xa4, 0x06, 0x64, 0x05, 0x8d, 0x03, 0x02, 0x03, 
-0x2d, 0x02, 0x14, 0xff, 0xee, 0xf8, 0x8d, 0xf3, 0x68, 0xf1, 0xf7, 0xee, 0x79, 0xed, 0x64, 0xf0, 
-0x06, 0xf5, 0x73, 0xf9, 0xdf, 0xfb, 0xde, 0xfa, 0x8c, 0xfa, 0xa9, 0xf9, 0xc0, 0xf3, 0x1b, 0xed, 
-0xc3, 0xe7, 0x39, 0xe2, 0x0f, 0xe1, 0x9e, 0xe5, 0x9b, 0xea, 0xd8, 0xec, 0x2f, 0xef, 0x2c, 0xf4, 
-0x9d, 0xf2, 0x80, 0xe8, 0xa1, 0xea, 0x46, 0xfb, 0xc7, 0x02, 0xff, 0x02, 0x66, 0x0e, 0xd9, 0x1b, 
-0x89, 0x17, 0x88, 0x06, 0xb3, 0xfd, 0x24, 0xfe, 0x18, 0xf7, 0x32, 0xed, 0x70, 0xf2, 0xfc, 0x01, 
-0x1b, 0x0e, 0x4f, 0x14, 0x45, 0x17, 0xd1, 0x1a, 0xf3, 0x1a, 0xe2, 0x10, 0x79, 0x05, 0xcf, 0x02, 
-0x45, 0x05, 0xd9, 0x07, 0xd8, 0x08, 0x9b, 0x0a, 0x82, 0x10, 0x7b, 0x14, 0xb0, 0x11, 0xed, 0x0d, 
-0x70, 0x0d, 0x5b, 0x0f, 0x6e, 0x0f, 0xc4, 0x0a, 0x4c, 0x08, 0x9b, 0x0a, 0xdd, 0x08, 0xba, 0x02, 
-0xf1, 0xfe, 0x45, 0xfe, 0xc7, 0xff, 0x55, 0x01, 0xd3, 0x01, 0x55, 0x05, 0x6e, 0x0b, 0x70, 0x0e, 
-0x2d, 0x0c, 0x62, 0x06, 0xe1, 0x01, 0x2a, 0xff, 0x60, 0xf8, 0xa4, 0xf0, 0xca, 0xef, 0xe5, 0xf1, 
-0x52, 0xf1, 0x36, 0xf1, 0x74, 0xf5, 0x16, 0xfc, 0x9e, 0xff, 0x03, 0x00, 0x20, 0x01, 0xca, 0xff, 
-0xb9, 0xf9, 0x1d, 0xf4, 0x0a, 0xef, 0x6a, 0xe7, 0xe2, 0xe0, 0x26, 0xdf, 0x61, 0xe1, 0x0a, 0xe6, 
-0x9b, 0xec, 0xb0, 0xf4, 0x85, 0xfb, 0x90, 0xfd, 0xdd, 0xf9, 0xf0, 0xf2, 0x62, 0xef, 0xf6, 0xf0, 
-0xf9, 0xf0, 0xb7, 0xf1, 0xb9, 0xfc, 0x71, 0x0b, 0xff, 0x0f, 0xf6, 0x0d, 0x13, 0x10, 0x17, 0x11, 
-0xb1, 0x06, 0x8b, 0xf9, 0x4b, 0xf7, 0x8f, 0xfa, 0xcf, 0xfa, 0xfd, 0xfc, 0x89, 0x05, 0xe0, 0x0f, 
-0x59, 0x15, 0x1f, 0x15, 0x49, 0x14, 0x16, 0x13, 0xc7, 0x0d, 0x10, 0x07, 0x3b, 0x03, 0x28, 0x03, 
-0x80, 0x06, 0x25, 0x0b, 0xfa, 0x0f, 0xe8, 0x13, 0x8d, 0x14, 0xbb, 0x13, 0x91, 0x11, 0x88, 0x0b, 
-0xe5, 0x06, 0x58, 0x06, 0x72, 0x04, 0xdb, 0x01, 0x7d, 0x01, 0x24, 0x02, 0x65, 0x03, 0x18, 0x03, 
-0x2a, 0x01, 0x8d, 0x01, 0x0e, 0x03, 0xd8, 0x03, 0xe5, 0x04, 0x81, 0x05, 0xad, 0x06, 0x9d, 0x06, 
-0x9a, 0x01, 0x9b, 0xfc, 0xe4, 0xf9, 0xbf, 0xf5, 0x38, 0xf3, 0xe1, 0xf2, 0x43, 0xf2, 0xe1, 0xf5, 
-0x0d, 0xfc, 0x03, 0xfe, 0x1c, 0xfe, 0xf6, 0xfe, 0xde, 0xfd, 0x1b, 0xf8, 0x10, 0xef, 0x1f, 0xea, 
-0x5d, 0xe9, 0xc8, 0xe5, 0x28, 0xe4, 0x3c, 0xea, 0x94, 0xf2, 0x2a, 0xf9, 0x0a, 0xfb, 0xc7, 0xf7, 
-0x9f, 0xf5, 0xee, 0xf1, 0x8a, 0xe8, 0xbd, 0xe4, 0xdc, 0xec, 0x5f, 0xf7, 0x94, 0xfd, 0xbd, 0x03, 
-0xa1, 0x0e, 0xe5, 0x15, 0x68, 0x10, 0x94, 0x08, 0x96, 0x06, 0xad, 0x01, 0x97, 0xf9, 0x02, 0xf7, 
-0x92, 0xfa, 0x04, 0x01, 0xd9, 0x05, 0x74, 0x07, 0x8f, 0x0a, 0x99, 0x0e, 0x81, 0x0f, 0xf4, 0x0e, 
-0x1e, 0x0f, 0x0b, 0x11, 0xc9, 0x12, 0x66, 0x0f, 0x49, 0x0a, 0x93, 0x08, 0x9e, 0x06, 0xd1, 0x03, 
-0xb6, 0x03, 0x11, 0x06, 0xb3, 0x0a, 0xb8, 0x0f, 0x09, 0x12, 0x30, 0x13, 0x89, 0x13, 0xff, 0x10, 
-0x3b, 0x0b, 0x5e, 0x02, 0x87, 0xfa, 0xfc, 0xf7, 0x65, 0xf7, 0x38, 0xf8, 0xc9, 0xfe, 0xac, 0x07, 
-0x91, 0x0c, 0xa7, 0x0d, 0xd6, 0x0c, 0x9d, 0x09, 0xa1, 0x03, 0xc1, 0xfd, 0x26, 0xfa, 0x72, 0xf6, 
-0x7c, 0xf3, 0xab, 0xf4, 0xf2, 0xf5, 0x6b, 0xf4, 0xb8, 0xf5, 0x32, 0xfa, 0x6e, 0xfb, 0x11, 0xfa, 
-0xed, 0xfa, 0x02, 0xfc, 0x01, 0xf9, 0xfe, 0xf3, 0xf8, 0xf0, 0xe7, 0xee, 0x9b, 0xeb, 0xe1, 0xe8, 
-0xb4, 0xe9, 0x48, 0xed, 0xbf, 0xef, 0x25, 0xf0, 0x36, 0xf1, 0x54, 0xf2, 0x42, 0xf0, 0x48, 0xee, 
-0xb4, 0xf2, 0x55, 0xfa, 0x5e, 0xfe, 0x43, 0x02, 0x28, 0x09, 0x27, 0x0b, 0xb7, 0x06, 0xd8, 0x04, 
-0xe7, 0x04, 0xb1, 0x00, 0xcb, 0xfc, 0x67, 0xfe, 0xd7, 0x00, 0x61, 0x01, 0x3a, 0x05, 0x1f, 0x0c, 
-0xae, 0x0d, 0x20, 0x0b, 0x7c, 0x0c, 0x15, 0x0d, 0x48, 0x07, 0x86, 0x03, 0x3c, 0x06, 0xae, 0x08, 
-0xd6, 0x08, 0x30, 0x0b, 0xbe, 0x10, 0x60, 0x14, 0xfd, 0x12, 0xc7, 0x10, 0x88, 0x0f, 0x55, 0x0c, 
-0x6b, 0x08, 0x7d, 0x05, 0x06, 0x03, 0x42, 0x03, 0x3a, 0x06, 0xe5, 0x07, 0xf7, 0x06, 0xb2, 0x05, 
-0xb0, 0x05, 0xb2, 0x03, 0x32, 0xfe, 0x71, 0xfd, 0xb6, 0x03, 0x7f, 0x06, 0x7c, 0x04, 0xdb, 0x05, 
-0xc3, 0x08, 0x9d, 0x06, 0x94, 0x01, 0x1f, 0xff, 0x9a, 0xfd, 0x02, 0xf9, 0x69, 0xf4, 0xad, 0xf2, 
-0x89, 0xf1, 0x61, 0xf2, 0xac, 0xf5, 0xc0, 0xf6, 0x5c, 0xf7, 0xe7, 0xfa, 0x59, 0xfc, 0x0f, 0xf9, 
-0xcc, 0xf5, 0xa2, 0xf4, 0xeb, 0xf1, 0x92, 0xec, 0x54, 0xea, 0xef, 0xec, 0x23, 0xee, 0x7f, 0xed, 
-0xe7, 0xef, 0x2b, 0xf3, 0xe8, 0xf2, 0x8f, 0xf1, 0x15, 0xf4, 0x00, 0xf9, 0xee, 0xfa, 0xa0, 0xfc, 
-0xf4, 0x02, 0xf7, 0x07, 0x2f, 0x07, 0xe6, 0x05, 0xed, 0x05, 0x48, 0x03, 0x33, 0xfd, 0x2e, 0xf8, 
-0x03, 0xf8, 0x03, 0xfa, 0xbf, 0xfc, 0x22, 0x04, 0xfe, 0x0d, 0x4d, 0x14, 0xe1, 0x16, 0x95, 0x16, 
-0x17, 0x13, 0xd9, 0x0c, 0x59, 0x05, 0xce, 0x00, 0x19, 0x00, 0xad, 0x00, 0xb9, 0x04, 0x11, 0x0c, 
-0x7c, 0x11, 0x49, 0x14, 0x8c, 0x14, 0x4e, 0x11, 0x45, 0x0d, 0x7f, 0x09, 0xbb, 0x05, 0xe3, 0x03, 
-0x26, 0x04, 0xc0, 0x05, 0xe9, 0x06, 0x58, 0x06, 0x6b, 0x07, 0xc8, 0x08, 0x1a, 0x05, 0x1b, 0x01, 
-0x8e, 0x01, 0x7a, 0x01, 0xee, 0xfe, 0xce, 0xfd, 0x49, 0xff, 0xce, 0xff, 0xa5, 0xfd, 0xcc, 0xfd, 
-0xde, 0xff, 0x41, 0xfd, 0x7b, 0xfa, 0xc0, 0xfb, 0x8b, 0xf9, 0x80, 0xf5, 0xf4, 0xf6, 0xa5, 0xf8, 
-0x79, 0xf6, 0x25, 0xf5, 0x84, 0xf5, 0x23, 0xf4, 0x07, 0xf1, 0xf9, 0xef, 0x0a, 0xf1, 0x29, 0xf1, 
-0xef, 0xf2, 0x01, 0xf7, 0xd3, 0xf7, 0x04, 0xf7, 0xff, 0xf6, 0xda, 0xf2, 0x8a, 0xec, 0xf6, 0xe9, 
-0x1e, 0xea, 0x44, 0xed, 0xd8, 0xf4, 0xb6, 0xfd, 0x96, 0x05, 0x4e, 0x0c, 0x83, 0x10, 0x79, 0x0f, 
-0x24, 0x09, 0x33, 0x03, 0x3a, 0xff, 0xda, 0xf8, 0xd4, 0xf3, 0x81, 0xf6, 0x44, 0xfd, 0x62, 0x03, 
-0x6a, 0x09, 0x7b, 0x10, 0x98, 0x16, 0xee, 0x16, 0x72, 0x12, 0x18, 0x0f, 0xbf, 0x0b, 0x52, 0x06, 
-0xe0, 0x02, 0x03, 0x02, 0xd1, 0x01, 0xb9, 0x03, 0x89, 0x07, 0x24, 0x0b, 0x04, 0x0e, 0xc4, 0x10, 
-0x16, 0x13, 0xf2, 0x11, 0x11, 0x0d, 0x48, 0x09, 0xb6, 0x06, 0x20, 0x02, 0x78, 0xfe, 0x17, 0xff, 
-0xc1, 0x01, 0x06, 0x04, 0xda, 0x05, 0xee, 0x06, 0xb0, 0x05, 0xb8, 0x02, 0x70, 0x00, 0x55, 0xfd, 
-0x34, 0xf9, 0x33, 0xfa, 0xe7, 0xff, 0x3a, 0x02, 0x58, 0x01, 0x49, 0x02, 0x48, 0x02, 0x21, 0xfc, 
-0x90, 0xf2, 0x8c, 0xed, 0x53, 0xee, 0xd8, 0xee, 0x40, 0xef, 0xaa, 0xf4, 0xf4, 0xfb, 0x0f, 0xfe, 
-0x62, 0xfb, 0x08, 0xf9, 0xba, 0xf7, 0x02, 0xf4, 0xc7, 0xef, 0x7e, 0xf0, 0x20, 0xf3, 0x8c, 0xf2, 
-0x8b, 0xf1, 0x77, 0xf1, 0x87, 0xef, 0x73, 0xed, 0xe4, 0xee, 0x24, 0xf4, 0x33, 0xfb, 0x38, 0x02, 
-0xa5, 0x09, 0xa7, 0x10, 0x7b, 0x12, 0xa8, 0x0d, 0xcf, 0x06, 0x4b, 0x01, 0x62, 0xfb, 0x85, 0xf4, 
-0x85, 0xf2, 0xc7, 0xf8, 0x7d, 0x01, 0x50, 0x08, 0xe9, 0x0e, 0xfb, 0x14, 0xa6, 0x17, 0x65, 0x14, 
-0x73, 0x0c, 0xb0, 0x06, 0x2d, 0x05, 0xb0, 0x02, 0x2c, 0x00, 0xc8, 0x02, 0x63, 0x08, 0xa5, 0x0b, 
-0xeb, 0x0b, 0x1d, 0x0c, 0xdd, 0x0c, 0xb2, 0x0b, 0xf2, 0x08, 0x98, 0x07, 0x67, 0x08, 0x50, 0x0a, 
-0xd6, 0x0a, 0x94, 0x08, 0x33, 0x06, 0x1d, 0x04, 0x7f, 0xff, 0x75, 0xfa, 0x4b, 0xf9, 0x40, 0xfb, 
-0x70, 0xfd, 0xdb, 0xff, 0xce, 0x03, 0x7d, 0x07, 0x60, 0x08, 0x91, 0x07, 0x6a, 0x05, 0x6e, 0x00, 
-0xa8, 0xfa, 0x9c, 0xf6, 0x70, 0xf3, 0x5f, 0xf1, 0xd7, 0xf2, 0x2b, 0xf7, 0x2a, 0xfa, 0xa0, 0xfb, 
-0x9e, 0xfe, 0x6f, 0xff, 0x1f, 0xfa, 0xcc, 0xf4, 0xa4, 0xf2, 0xa2, 0xee, 0x72, 0xea, 0x0f, 0xec, 
-0x0c, 0xf1, 0x27, 0xf4, 0x4c, 0xf6, 0xa7, 0xf9, 0x1e, 0xfb, 0xf8, 0xf7, 0x09, 0xf4, 0x65, 0xf3, 
-0x47, 0xf5, 0x7f, 0xf7, 0xfc, 0xf9, 0x20, 0xff, 0xc0, 0x05, 0x61, 0x08, 0xea, 0x07, 0x56, 0x08, 
-0xf3, 0x06, 0xa5, 0x02, 0x1c, 0xff, 0x37, 0xfd, 0x42, 0xfd, 0x08, 0x00, 0x1d, 0x04, 0x88, 0x08, 
-0xfc, 0x0c, 0x8a, 0x10, 0x62, 0x11, 0x1b, 0x0e, 0x01, 0x0a, 0x98, 0x07, 0xbb, 0x03, 0xb1, 0xff, 
-0x54, 0x00, 0x51, 0x04, 0xa3, 0x08, 0x45, 0x0c, 0x0b, 0x0f, 0x90, 0x11, 0xe3, 0x10, 0x55, 0x0b, 
-0x69, 0x06, 0x2d, 0x04, 0x5a, 0x01, 0xf4, 0xfe, 0x80, 0xff, 0xe1, 0x01, 0xc8, 0x03, 0xb7, 0x04, 
-0x62, 0x05, 0x76, 0x04, 0x02, 0x02, 0xf4, 0x00, 0x55, 0x00, 0x1d, 0xff, 0xac, 0xff, 0xed, 0xff, 
-0x02, 0xfe, 0xb4, 0xfc, 0xf7, 0xfa, 0xb6, 0xf7, 0x1c, 0xf6, 0x07, 0xf6, 0xd6, 0xf5, 0x5a, 0xf6, 
-0xcc, 0xf7, 0x74, 0xf9, 0x0c, 0xfa, 0x0d, 0xfa, 0x51, 0xfb, 0x54, 0xfb, 0x66, 0xf8, 0x3a, 0xf6, 
-0x47, 0xf5, 0x67, 0xf3, 0x25, 0xf2, 0xe0, 0xf2, 0x7a, 0xf4, 0x83, 0xf5, 0xe2, 0xf5, 0x61, 0xf6, 
-0xfc, 0xf5, 0x48, 0xf5, 0x68, 0xf7, 0xc7, 0xfa, 0x3b, 0xfd, 0x7a, 0x01, 0x29, 0x07, 0x4b, 0x0a, 
-0x18, 0x0a, 0x67, 0x08, 0x23, 0x06, 0x97, 0x01, 0x1d, 0xfb, 0x00, 0xf8, 0x71, 0xf9, 0x0a, 0xfc, 
-0x7e, 0x00, 0xc9, 0x07, 0x0f, 0x0f, 0x9a, 0x13, 0xb8, 0x14, 0x05, 0x14, 0x90, 0x11, 0x52, 0x0b, 
-0xb8, 0x04, 0xc2, 0x01, 0xdf, 0xff, 0x85, 0xfe, 0x49, 0x00, 0xbd, 0x03, 0xe8, 0x06, 0x0d, 0x0a, 
-0x04, 0x0d, 0x19, 0x0f, 0xbb, 0x0f, 0xcd, 0x0e, 0xf7, 0x0b, 0x92, 0x07, 0xc7, 0x03, 0x54, 0x00, 
-0x0e, 0xfc, 0xdf, 0xf9, 0xc8, 0xfa, 0x4c, 0xfc, 0xa0, 0xfe, 0xfa, 0x01, 0x01, 0x05, 0x26, 0x07, 
-0xc8, 0x06, 0xc9, 0x03, 0x64, 0x00, 0x85, 0xfc, 0x19, 0xf8, 0x99, 0xf4, 0xa7, 0xf2, 0x1c, 0xf3, 
-0x2a, 0xf5, 0xe9, 0xf6, 0x9d, 0xf9, 0x30, 0xfd, 0x95, 0xfe, 0x01, 0xfe, 0xec, 0xfc, 0xc3, 0xfa, 
-0xb9, 0xf7, 0x24, 0xf5, 0xd7, 0xf3, 0x55, 0xf3, 0x5a, 0xf3, 0x22, 0xf5, 0x56, 0xf7, 0x2b, 0xf7, 
-0x87, 0xf6, 0x6a, 0xf7, 0xb1, 0xf7, 0x43, 0xf7, 0xaa, 0xf8, 0xe6, 0xfb, 0x5d, 0xff, 0xc1, 0x02, 
-0xe9, 0x05, 0x29, 0x07, 0x15, 0x06, 0x7e, 0x04, 0x31, 0x02, 0xb0, 0xfe, 0x29, 0xfd, 0xdd, 0xfe, 
-0x0d, 0x01, 0x30, 0x03, 0x76, 0x06, 0x20, 0x0a, 0x42, 0x0c, 0x94, 0x0b, 0xc6, 0x09, 0x4f, 0x09, 
-0x4f, 0x08, 0x07, 0x05, 0xfa, 0x02, 0xe1, 0x03, 0x8e, 0x04, 0x8b, 0x04, 0x84, 0x06, 0xc0, 0x09, 
-0x93, 0x0b, 0xc4, 0x0b, 0x1f, 0x0b, 0xc9, 0x09, 0xf7, 0x07, 0xdb, 0x05, 0xa8, 0x03, 0xea, 0x01, 
-0x37, 0x01, 0x9f, 0x01, 0x4a, 0x02, 0x77, 0x02, 0x9d, 0x02, 0xd4, 0x02, 0xe6, 0x01, 0x84, 0xff, 
-0x32, 0xfd, 0x1b, 0xfc, 0x78, 0xfb, 0x7e, 0xfa, 0x4c, 0xfa, 0x6c, 0xfb, 0xf4, 0xfb, 0x07, 0xfb, 
-0x77, 0xfa, 0xeb, 0xfa, 0xa1, 0xfa, 0x77, 0xf9, 0x66, 0xf9, 0x26, 0xfa, 0x95, 0xf9, 0xc9, 0xf7, 
-0x79, 0xf6, 0x15, 0xf6, 0x7f, 0xf5, 0x6e, 0xf4, 0x04, 0xf5, 0x9f, 0xf7, 0xeb, 0xf8, 0x61, 0xf8, 
-0x85, 0xf8, 0xb9, 0xf8, 0xdf, 0xf7, 0x63, 0xf7, 0xdd, 0xf7, 0x73, 0xf9, 0xd0, 0xfc, 0xad, 0x00, 
-0x8d, 0x03, 0x21, 0x06, 0x18, 0x08, 0xdd, 0x06, 0x74, 0x02, 0x9c, 0xfe, 0xcd, 0xfc, 0xa2, 0xfb, 
-0x4f, 0xfc, 0xf0, 0x00, 0xf1, 0x07, 0x25, 0x0e, 0xea, 0x11, 0x23, 0x13, 0xc7, 0x11, 0x4c, 0x0d, 
-0xa6, 0x06, 0x22, 0x00, 0x90, 0xfb, 0xb1, 0xfa, 0x8a, 0xfd, 0x23, 0x02, 0x00, 0x08, 0x2e, 0x0e, 
-0x90, 0x11, 0x1f, 0x11, 0x27, 0x0e, 0x37, 0x0a, 0x90, 0x06, 0xcb, 0x02, 0x68, 0xff, 0xa5, 0xfe, 
-0x96, 0xff, 0x2f, 0x00, 0x5a, 0x01, 0xf8, 0x02, 0x29, 0x03, 0x64, 0x02, 0x23, 0x02, 0xbe, 0x01, 
-0x3f, 0x00, 0xd9, 0xfe, 0x13, 0xfe, 0x10, 0xfc, 0x1a, 0xf9, 0x6a, 0xf7, 0x66, 0xf6, 0x03, 0xf5, 
-0xc5, 0xf4, 0xcd, 0xf6, 0xf7, 0xf9, 0x2a, 0xfc, 0x34, 0xfd, 0x54, 0xfe, 0x5e, 0xfe, 0x0b, 0xfc, 
-0x0c, 0xf9, 0x62, 0xf6, 0x0b, 0xf4, 0xe2, 0xf2, 0x0e, 0xf3, 0xd1, 0xf4, 0x24, 0xf8, 0x03, 0xfb, 
-0xa9, 0xfc, 0xfa, 0xfd, 0x70, 0xfe, 0x8c, 0xfd, 0x13, 0xfc, 0x13, 0xfb, 0x35, 0xfb, 0xd7, 0xfb, 
-0xb6, 0xfc, 0x04, 0xff, 0x26, 0x02, 0x04, 0x04, 0xb4, 0x04, 0x94, 0x05, 0x26, 0x06, 0x26, 0x05, 
-0xb4, 0x03, 0x9f, 0x03, 0x58, 0x04, 0x09, 0x05, 0xb6, 0x05, 0x2d, 0x06, 0x2a, 0x07, 0x8e, 0x08, 
-0xb5, 0x08, 0xc4, 0x08, 0x38, 0x0a, 0xe8, 0x0a, 0xe3, 0x09, 0x01, 0x09, 0x8f, 0x08, 0x7d, 0x07, 
-0x7a, 0x05, 0x76, 0x03, 0xaf, 0x02, 0xdc, 0x02, 0x3f, 0x03, 0x1e, 0x04, 0x87, 0x05, 0xea, 0x06, 
-0x68, 0x07, 0x4c, 0x06, 0x30, 0x04, 0xec, 0x01, 0x54, 0xff, 0xa4, 0xfc, 0x09, 0xfb, 0xe5, 0xfa, 
-0x15, 0xfb, 0x11, 0xfb, 0xea, 0xfb, 0xa0, 0xfd, 0x8c, 0xfe, 0xe3, 0xfd, 0x6c, 0xfc, 0x59, 0xfb, 
-0x4e, 0xfa, 0x4e, 0xf8, 0x46, 0xf7, 0x74, 0xf8, 0xb9, 0xf8, 0x7c, 0xf7, 0xe3, 0xf7, 0x07, 0xf9, 
-0xff, 0xf7, 0x3f, 0xf6, 0x5d, 0xf6, 0xa4, 0xf7, 0x5e, 0xf8, 0x0d, 0xf9, 0xe2, 0xfa, 0x0a, 0xfd, 
-0x1c, 0xfe, 0x14, 0xfe, 0xa4, 0xfd, 0x55, 0xfd, 0x02, 0xfd, 0x48, 0xfc, 0xad, 0xfb, 0x62, 0xfc, 
-0xa5, 0xfe, 0xd5, 0x00, 0x0c, 0x02, 0x2b, 0x04, 0x26, 0x07, 0x21, 0x08, 0x84, 0x07, 0x5c, 0x07, 
-0xc5, 0x06, 0xf2, 0x04, 0xd6, 0x02, 0x95, 0x01, 0xe4, 0x01, 0xe5, 0x02, 0xe5, 0x03, 0xc8, 0x05, 
-0x27, 0x08, 0x86, 0x09, 0x4d, 0x09, 0xa4, 0x07, 0xdf, 0x05, 0xbf, 0x04, 0x2c, 0x03, 0x85, 0x01, 
-0x9c, 0x01, 0x31, 0x03, 0x6f, 0x04, 0xf7, 0x04, 0x02, 0x06, 0xff, 0x06, 0xf3, 0x05, 0xa2, 0x03, 
-0xa4, 0x01, 0x6b, 0xff, 0xec, 0xfc, 0x29, 0xfb, 0xef, 0xfa, 0x15, 0xfc, 0xc2, 0xfc, 0xba, 0xfc, 
-0x72, 0xfd, 0xe5, 0xfd, 0x41, 0xfd, 0x7f, 0xfc, 0x4c, 0xfb, 0x15, 0xfa, 0xcf, 0xf9, 0xa8, 0xf9, 
-0xe4, 0xf9, 0x3d, 0xfb, 0xea, 0xfc, 0x80, 0xfe, 0x37, 0xff, 0x81, 0xfe, 0x5e, 0xfd, 0x7f, 0xfb, 
-0xa9, 0xf8, 0xd7, 0xf6, 0x96, 0xf6, 0xd4, 0xf6, 0x99, 0xf7, 0xa5, 0xf9, 0xad, 0xfc, 0x38, 0xff, 
-0x18, 0x01, 0xe1, 0x02, 0x65, 0x03, 0xb1, 0x02, 0xe0, 0x01, 0x38, 0x00, 0xa6, 0xfe, 0x9a, 0xfe, 
-0xe5, 0xfe, 0x0c, 0x00, 0xc1, 0x02, 0x01, 0x05, 0xae, 0x06, 0x06, 0x08, 0x57, 0x07, 0x12, 0x05, 
-0xca, 0x02, 0xf4, 0x00, 0xd3, 0xff, 0xb0, 0xff, 0x8a, 0x01, 0x92, 0x04, 0xf2, 0x05, 0x90, 0x06, 
-0xd2, 0x07, 0x40, 0x07, 0xff, 0x04, 0xdd, 0x03, 0xbc, 0x03, 0xb2, 0x03, 0xe1, 0x03, 0x5b, 0x04, 
-0xe5, 0x04, 0x7e, 0x04, 0xc4, 0x02, 0x94, 0x00, 0xcf, 0xfe, 0x3f, 0xfe, 0xb7, 0xfe, 0x93, 0xff, 
-0xda, 0x00, 0xef, 0x01, 0x54, 0x02, 0xd3, 0x01, 0x7f, 0xff, 0xe6, 0xfc, 0xeb, 0xfb, 0xc6, 0xfa, 
-0xbb, 0xf9, 0x1c, 0xfb, 0x03, 0xfd, 0x71, 0xfd, 0xbb, 0xfd, 0x60, 0xfe, 0x5c, 0xfe, 0x16, 0xfd, 
-0xb5, 0xfb, 0xd2, 0xfb, 0x32, 0xfc, 0xa9, 0xfb, 0xbb, 0xfb, 0x74, 0xfc, 0x78, 0xfc, 0x2c, 0xfc, 
-0x40, 0xfc, 0xae, 0xfc, 0x3a, 0xfd, 0x9b, 0xfd, 0xf2, 0xfd, 0x48, 0xfe, 0x6e, 0xfe, 0x71, 0xfe, 
-0x36, 0xfe, 0x0c, 0xfe, 0x9f, 0xfe, 0xa7, 0xff, 0x6c, 0x00, 0xe2, 0x00, 0x61, 0x01, 0xc7, 0x01, 
-0x86, 0x01, 0x2f, 0x01, 0x7e, 0x01, 0xbd, 0x01, 0xee, 0x01, 0xa9, 0x02, 0x07, 0x03, 0xee, 0x02, 
-0x59, 0x03, 0x97, 0x03, 0xf0, 0x02, 0x43, 0x02, 0x1f, 0x02, 0x37, 0x02, 0x54, 0x02, 0xaf, 0x02, 
-0x47, 0x03, 0x84, 0x03, 0x59, 0x03, 0x29, 0x03, 0xb8, 0x02, 0x0d, 0x02, 0x7e, 0x01, 0xee, 0x00, 
-0x6d, 0x00, 0x2d, 0x00, 0x2b, 0x00, 0x8d, 0x00, 0x1d, 0x01, 0x63, 0x01, 0x60, 0x01, 0x1a, 0x01, 
-0x83, 0x00, 0xc0, 0xff, 0xea, 0xfe, 0x43, 0xfe, 0x0d, 0xfe, 0x1d, 0xfe, 0x47, 0xfe, 0x91, 0xfe, 
-0xf8, 0xfe, 0x59, 0xff, 0x53, 0xff, 0xd5, 0xfe, 0x5c, 0xfe, 0xd7, 0xfd, 0x12, 0xfd, 0xbd, 0xfc, 
-0x01, 0xfd, 0x10, 0xfd, 0xfd, 0xfc, 0x49, 0xfd, 0x9f, 0xfd, 0xb6, 0xfd, 0xbe, 0xfd, 0xe6, 0xfd, 
-0x38, 0xfe, 0x53, 0xfe, 0x37, 0xfe, 0xa5, 0xfe, 0x42, 0xff, 0x35, 0xff, 0x53, 0xff, 0x2a, 0x00, 
-0x8a, 0x00, 0x2d, 0x00, 0x10, 0x00, 0x49, 0x00, 0x57, 0x00, 0x5a, 0x00, 0xa9, 0x00, 0x46, 0x01, 
-0xf6, 0x01, 0x41, 0x02, 0x21, 0x02, 0x4a, 0x02, 0xae, 0x02, 0x6b, 0x02, 0xf0, 0x01, 0x11, 0x02, 
-0x1a, 0x02, 0xa3, 0x01, 0x69, 0x01, 0x5e, 0x01, 0x05, 0x01, 0x99, 0x00, 0x5b, 0x00, 0x5c, 0x00, 
-0x8f, 0x00, 0xbb, 0x00, 0x05, 0x01, 0x95, 0x01, 0x19, 0x02, 0x70, 0x02, 0x78, 0x02, 0xd8, 0x01, 
-0xe0, 0x00, 0x0a, 0x00, 0x2b, 0xff, 0x55, 0xfe, 0x18, 0xfe, 0x8a, 0xfe, 0x49, 0xff, 0x1c, 0x00, 
-0xe9, 0x00, 0x6c, 0x01, 0x47, 0x01, 0x6b, 0x00, 0x24, 0xff, 0xc4, 0xfd, 0xb0, 0xfc, 0x44, 0xfc, 
-0x89, 0xfc, 0x74, 0xfd, 0xe4, 0xfe, 0x4e, 0x00, 0x3b, 0x01, 0x8b, 0x01, 0x2c, 0x01, 0x30, 0x00, 
-0xe0, 0xfe, 0xa3, 0xfd, 0xf1, 0xfc, 0xf4, 0xfc, 0x78, 0xfd, 0x6e, 0xfe, 0xb8, 0xff, 0xca, 0x00, 
-0x27, 0x01, 0xf5, 0x00, 0x9e, 0x00, 0x1d, 0x00, 0x5b, 0xff, 0xe6, 0xfe, 0x20, 0xff, 0x8b, 0xff, 
-0xf7, 0xff, 0xa9, 0x00, 0x49, 0x01, 0x90, 0x01, 0xcc, 0x01, 0xce, 0x01, 0x51, 0x01, 0xea, 0x00, 
-0xf3, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x6d, 0x01, 0xf0, 0x01, 0xfa, 0x01, 0x8a, 0x01, 0x1d, 0x01, 
-0xe3, 0x00, 0xa9, 0x00, 0x79, 0x00, 0x9c, 0x00, 0x0b, 0x01, 0x55, 0x01, 0x2c, 0x01, 0xcf, 0x00, 
-0x82, 0x00, 0x12, 0x00, 0x80, 0xff, 0x65, 0xff, 0xe4, 0xff, 0x84, 0x00, 0x4c, 0x01, 0x61, 0x02, 
-0x30, 0x03, 0x44, 0x03, 0xd4, 0x02, 0xe9, 0x01, 0x5a, 0x00, 0x91, 0xfe, 0x41, 0xfd, 0x9b, 0xfc, 
-0x76, 0xfc, 0x09, 0xfd, 0x90, 0xfe, 0x69, 0x00, 0xbd, 0x01, 0x90, 0x02, 0xfd, 0x02, 0x81, 0x02, 
-0x20, 0x01, 0xb5, 0xff, 0xa8, 0xfe, 0xa9, 0xfd, 0xdd, 0xfc, 0xe8, 0xfc, 0xbd, 0xfd, 0xa2, 0xfe, 
-0x63, 0xff, 0x53, 0x00, 0x37, 0x01, 0x8d, 0x01, 0x72, 0x01, 0x2e, 0x01, 0xa5, 0x00, 0xc0, 0xff, 
-0xb8, 0xfe, 0xec, 0xfd, 0x91, 0xfd, 0x79, 0xfd, 0x94, 0xfd, 0x3e, 0xfe, 0x7e, 0xff, 0xc5, 0x00, 
-0xc5, 0x01, 0x8c, 0x02, 0xf0, 0x02, 0xcf, 0x02, 0x49, 0x02, 0x61, 0x01, 0x23, 0x00, 0x07, 0xff, 
-0x4d, 0xfe, 0xca, 0xfd, 0xbe, 0xfd, 0x82, 0xfe, 0xa2, 0xff, 0xa2, 0x00, 0x9f, 0x01, 0x80, 0x02, 
-0xc9, 0x02, 0x71, 0x02, 0xd7, 0x01, 0x3c, 0x01, 0xa7, 0x00, 0x0c, 0x00, 0x7a, 0xff, 0x2b, 0xff, 
-0x1d, 0xff, 0xfc, 0xfe, 0xcd, 0xfe, 0xf4, 0xfe, 0x73, 0xff, 0xe1, 0xff, 0x4b, 0x00, 0x04, 0x01, 
-0xb8, 0x01, 0xe1, 0x01, 0xa6, 0x01, 0x46, 0x01, 0x8a, 0x00, 0x73, 0xff, 0x72, 0xfe, 0xd0, 0xfd, 
-0xa1, 0xfd, 0xf9, 0xfd, 0xbd, 0xfe, 0xa2, 0xff, 0x7e, 0x00, 0x33, 0x01, 0x7c, 0x01, 0x2d, 0x01, 
-0x8f, 0x00, 0x00, 0x00, 0x81, 0xff, 0xfa, 0xfe, 0xac, 0xfe, 0xc3, 0xfe, 0xf1, 0xfe, 0xf4, 0xfe, 
-0xf7, 0xfe, 0x25, 0xff, 0x5b, 0xff, 0x82, 0xff, 0xd5, 0xff, 0x81, 0x00, 0x5a, 0x01, 0x03, 0x02, 
-0x40, 0x02, 0x0c, 0x02, 0x68, 0x01, 0x3a, 0x00, 0xb3, 0xfe, 0x87, 0xfd, 0x20, 0xfd, 0x49, 0xfd, 
-0x08, 0xfe, 0x89, 0xff, 0x3d, 0x01, 0x68, 0x02, 0xef, 0x02, 0xec, 0x02, 0x55, 0x02, 0x64, 0x01, 
-0x74, 0x00, 0xa8, 0xff, 0x39, 0xff, 0x5c, 0xff, 0xc8, 0xff, 0x14, 0x00, 0x4c, 0x00, 0x75, 0x00, 
-0x5b, 0x00, 0x1c, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x50, 0x00, 0xda, 0x00, 0x6f, 0x01, 0xd4, 0x01, 
-0xe6, 0x01, 0x7f, 0x01, 0x98, 0x00, 0x6a, 0xff, 0x55, 0xfe, 0xa4, 0xfd, 0x67, 0xfd, 0xc0, 0xfd, 
-0xd9, 0xfe, 0x5d, 0x00, 0xb9, 0x01, 0xae, 0x02, 0x32, 0x03, 0x17, 0x03, 0x2a, 0x02, 0xaa, 0x00, 
-0x36, 0xff, 0x1f, 0xfe, 0x65, 0xfd, 0x4a, 0xfd, 0xec, 0xfd, 0xe3, 0xfe, 0xd7, 0xff, 0xa8, 0x00, 
-0x2d, 0x01, 0x46, 0x01, 0xf0, 0x00, 0x67, 0x00, 0xff, 0xff, 0xaf, 0xff, 0x4d, 0xff, 0x1c, 0xff, 
-0x4d, 0xff, 0x87, 0xff, 0x81, 0xff, 0x75, 0xff, 0x98, 0xff, 0xaa, 0xff, 0xa6, 0xff, 0xf4, 0xff, 
-0x87, 0x00, 0xf7, 0x00, 0x41, 0x01, 0x61, 0x01, 0x11, 0x01, 0x6a, 0x00, 0xaa, 0xff, 0xd3, 0xfe, 
-0x23, 0xfe, 0x05, 0xfe, 0x8b, 0xfe, 0x7d, 0xff, 0xa8, 0x00, 0xdf, 0x01, 0xc7, 0x02, 0xff, 0x02, 
-0x7d, 0x02, 0x78, 0x01, 0x24, 0x00, 0xcc, 0xfe, 0xc6, 0xfd, 0x60, 0xfd, 0xca, 0xfd, 0xc6, 0xfe, 
-0x01, 0x00, 0x68, 0x01, 0x94, 0x02, 0x01, 0x03, 0xb8, 0x02, 0xd3, 0x01, 0x6a, 0x00, 0xf4, 0xfe, 
-0xda, 0xfd, 0x49, 0xfd, 0x6c, 0xfd, 0x3c, 0xfe, 0x7c, 0xff, 0xd0, 0x00, 0xc9, 0x01, 0x3d, 0x02, 
-0x21, 0x02, 0x4b, 0x01, 0x00, 0x00, 0xd9, 0xfe, 0x2d, 0xfe, 0x0f, 0xfe, 0x67, 0xfe, 0x2e, 0xff, 
-0x48, 0x00, 0x09, 0x01, 0x0a, 0x01, 0xc9, 0x00, 0x4e, 0x00, 0x54, 0xff, 0x84, 0xfe, 0x56, 0xfe, 
-0x68, 0xfe, 0xce, 0xfe, 0xc6, 0xff, 0xc7, 0x00, 0x4f, 0x01, 0x6e, 0x01, 0x36, 0x01, 0x91, 0x00, 
-0x9b, 0xff, 0xb5, 0xfe, 0x2d, 0xfe, 0x09, 0xfe, 0x53, 0xfe, 0xfc, 0xfe, 0xce, 0xff, 0xab, 0x00, 
-0x6e, 0x01, 0xe1, 0x01, 0xea, 0x01, 0x8a, 0x01, 0xdb, 0x00, 0xfe, 0xff, 0x07, 0xff, 0x42, 0xfe, 
-0xe8, 0xfd, 0xd8, 0xfd, 0x20, 0xfe, 0xdb, 0xfe, 0xce, 0xff, 0xdc, 0x00, 0xda, 0x01, 0x78, 0x02, 
-0xcd, 0x02, 0xbb, 0x02, 0xea, 0x01, 0xdc, 0x00, 0xe5, 0xff, 0xa6, 0xfe, 0x93, 0xfd, 0x52, 0xfd, 
-0x8b, 0xfd, 0x13, 0xfe, 0x29, 0xff, 0x8d, 0x00, 0xcf, 0x01, 0xa9, 0x02, 0xf3, 0x02, 0xc0, 0x02, 
-0x0b, 0x02, 0xe0, 0x00, 0xb5, 0xff, 0xcc, 0xfe, 0x13, 0xfe, 0xba, 0xfd, 0xf8, 0xfd, 0x86, 0xfe, 
-0x0e, 0xff, 0xa4, 0xff, 0x56, 0x00, 0xc4, 0x00, 0xc4, 0x00, 0xab, 0x00, 0x91, 0x00, 0x3f, 0x00, 
-0xc6, 0xff, 0x61, 0xff, 0x29, 0xff, 0x16, 0xff, 0x13, 0xff, 0x35, 0xff, 0x9f, 0xff, 0x1f, 0x00, 
-0x86, 0x00, 0xcc, 0x00, 0xd7, 0x00, 0xa9, 0x00, 0x4c, 0x00, 0xb4, 0xff, 0x21, 0xff, 0xdc, 0xfe, 
-0xc7, 0xfe, 0xe8, 0xfe, 0x53, 0xff, 0xb6, 0xff, 0xfc, 0xff, 0x4a, 0x00, 0x60, 0x00, 0x23, 0x00, 
-0xdc, 0xff, 0x8f, 0xff, 0x1e, 0xff, 0xcf, 0xfe, 0xef, 0xfe, 0x4b, 0xff, 0x92, 0xff, 0xf8, 0xff, 
-0x80, 0x00, 0xa3, 0x00, 0x74, 0x00, 0x5b, 0x00, 0x1a, 0x00, 0xba, 0xff, 0x80, 0xff, 0x34, 0xff, 
-0xff, 0xfe, 0x2d, 0xff, 0x75, 0xff, 0xe0, 0xff, 0x76, 0x00, 0xca, 0x00, 0xf5, 0x00, 0xf1, 0x00, 
-0x51, 0x00, 0x9a, 0xff, 0x42, 0xff, 0xdf, 0xfe, 0xaa, 0xfe, 0x36, 0xff, 0x3b, 0x00, 0x47, 0x01, 
-0x43, 0x02, 0x01, 0x03, 0x1a, 0x03, 0x54, 0x02, 0xfa, 0x00, 0x83, 0xff, 0x37, 0xfe, 0x52, 0xfd, 
-0x1c, 0xfd, 0xd3, 0xfd, 0x1a, 0xff, 0x31, 0x00, 0x2b, 0x01, 0x1e, 0x02, 0x36, 0x02, 0x81, 0x01, 
-0xe0, 0x00, 0x31, 0x00, 0x50, 0xff, 0xbf, 0xfe, 0x97, 0xfe, 0xc6, 0xfe, 0x3b, 0xff, 0xa7, 0xff, 
-0x1f, 0x00, 0x8d, 0x00, 0x92, 0x00, 0x91, 0x00, 0xd0, 0x00, 0xb0, 0x00, 0x31, 0x00, 0xe3, 0xff, 
-0x9b, 0xff, 0x11, 0xff, 0xb3, 0xfe, 0xc2, 0xfe, 0xef, 0xfe, 0x2e, 0xff, 0xbb, 0xff, 0x5f, 0x00, 
-0xcc, 0x00, 0x07, 0x01, 0x03, 0x01, 0x9d, 0x00, 0xfd, 0xff, 0x73, 0xff, 0x08, 0xff, 0xa5, 0xfe, 
-0x8c, 0xfe, 0xeb, 0xfe, 0x68, 0xff, 0xd9, 0xff, 0x59, 0x00, 0x9d, 0x00, 0x87, 0x00, 0x48, 0x00, 
-0xcd, 0xff, 0x51, 0xff, 0x3a, 0xff, 0x5c, 0xff, 0xad, 0xff, 0x57, 0x00, 0xf3, 0x00, 0x3c, 0x01, 
-0x5d, 0x01, 0x32, 0x01, 0x98, 0x00, 0xe7, 0xff, 0x61, 0xff, 0xe6, 0xfe, 0x83, 0xfe, 0x7f, 0xfe, 
-0xc1, 0xfe, 0x07, 0xff, 0x6d, 0xff, 0xfa, 0xff, 0x73, 0x00, 0xbc, 0x00, 0xd4, 0x00, 0xdc, 0x00, 
-0xe1, 0x00, 0x99, 0x00 
-};
-const unsigned int hi_mp3_len = 28916;
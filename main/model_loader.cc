@@ -0,0 +1,272 @@
+/**
+ * @file model_loader.cc
+ * @brief 🧠 语音模型加载器实现
+ */
+
+#include "model_loader.h"
+#include "task_factory.h"
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "buffer_placement.h"
+#include "project_config.h"
+
+const char* ModelLoader::TAG = "ModelLoader";
+
+// 与esp-sr model_path.c一致
+static const size_t kNameLen = SRMODEL_STRING_LENGTH;
+static const uint32_t kMaxModels = 32;
+static const uint32_t kMaxFiles = 64;
+
+// 后台拷贝每块的大小：每块之间让出CPU，WakeNet的Flash读取不会被长时间挤占
+static const size_t kCopyChunk = 32 * 1024;
+
+static uint32_t read_le32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+ModelLoader::ModelLoader()
+    : models_(nullptr)
+    , stats_{}
+    , root_(nullptr)
+    , residency_(Residency::FLASH)
+    , psram_switch_pending_(false)
+    , copy_task_started_(false)
+{
+}
+
+const char* ModelLoader::residencyName(Residency residency) {
+    return residency == Residency::PSRAM ? "PSRAM" : "Flash";
+}
+
+esp_err_t ModelLoader::scanUsedSize(const esp_partition_t* part, size_t* used) {
+    uint8_t buf[kNameLen + 8];
+    size_t offset = 0;
+
+    esp_err_t ret = esp_partition_read(part, offset, buf, 4);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    uint32_t model_num = read_le32(buf);
+    offset += 4;
+    // 没烧录的分区读出来是0xFFFFFFFF
+    if (model_num == 0 || model_num > kMaxModels) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    size_t end = 0;
+    for (uint32_t i = 0; i < model_num; i++) {
+        ret = esp_partition_read(part, offset, buf, kNameLen + 4);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        uint32_t file_num = read_le32(buf + kNameLen);
+        offset += kNameLen + 4;
+        if (file_num == 0 || file_num > kMaxFiles) {
+            return ESP_ERR_INVALID_SIZE;
+        }
+
+        for (uint32_t j = 0; j < file_num; j++) {
+            ret = esp_partition_read(part, offset, buf, kNameLen + 8);
+            if (ret != ESP_OK) {
+                return ret;
+            }
+            size_t file_start = read_le32(buf + kNameLen);
+            size_t file_size = read_le32(buf + kNameLen + 4);
+            offset += kNameLen + 8;
+            if (file_start > part->size || file_size > part->size - file_start) {
+                return ESP_ERR_INVALID_SIZE;
+            }
+            if (file_start + file_size > end) {
+                end = file_start + file_size;
+            }
+        }
+    }
+
+    *used = end > offset ? end : offset;
+    return ESP_OK;
+}
+
+srmodel_list_t* ModelLoader::mapAndParse(const esp_partition_t* part, size_t used) {
+    int64_t t0 = esp_timer_get_time();
+    const void* root = nullptr;
+    esp_partition_mmap_handle_t* handle = (esp_partition_mmap_handle_t*)malloc(sizeof(esp_partition_mmap_handle_t));
+    if (!handle) {
+        return nullptr;
+    }
+    esp_err_t ret = esp_partition_mmap(part, 0, used, ESP_PARTITION_MMAP_DATA, &root, handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ 模型分区映射失败: %s", esp_err_to_name(ret));
+        free(handle);
+        return nullptr;
+    }
+    int64_t t1 = esp_timer_get_time();
+
+    // 和srmodel_mmap_init()一样记录分区和映射句柄，esp_srmodel_deinit()可以正常释放
+    srmodel_list_t* models = srmodel_load(root);
+    models->partition = (esp_partition_t*)part;
+    models->mmap_handle = handle;
+    int64_t t2 = esp_timer_get_time();
+
+    stats_.map_us = t1 - t0;
+    stats_.parse_us = t2 - t1;
+    stats_.mapped_bytes = used;
+    root_ = (const uint8_t*)root;
+    return models;
+}
+
+/**
+ * @brief 把映射的模型数据整段拷进PSRAM，并把模型列表里的文件指针改到副本上
+ *
+ * srmodel_load()解析出的files/data指针都指向映射区内部，整体平移即可；
+ * 模型名和model_info是单独malloc的，不受影响。
+ *
+ * @param background true=每拷一块让出一次CPU（后台任务），false=一次拷完（启动阶段）
+ */
+esp_err_t ModelLoader::copyToPsram(bool background) {
+    if (!models_ || !root_ || residency_ == Residency::PSRAM) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    size_t bytes = stats_.mapped_bytes;
+    uint8_t* copy = (uint8_t*)BufferPlacement::alloc("model_weights", bytes, Placement::PSRAM);
+    // 退回内部RAM的副本没有意义（也放不下几MB），直接放弃
+    if (copy && !esp_ptr_external_ram(copy)) {
+        BufferPlacement::free(copy);
+        copy = nullptr;
+    }
+    if (!copy) {
+        ESP_LOGW(TAG, "⚠️ PSRAM不够放模型权重（需要%uKB），继续从Flash读取", (unsigned)(bytes / 1024));
+        return ESP_ERR_NO_MEM;
+    }
+
+    int64_t t0 = esp_timer_get_time();
+    for (size_t offset = 0; offset < bytes; offset += kCopyChunk) {
+        size_t n = bytes - offset < kCopyChunk ? bytes - offset : kCopyChunk;
+        memcpy(copy + offset, root_ + offset, n);
+        if (background) {
+            vTaskDelay(1);
+        }
+    }
+    stats_.copy_us = esp_timer_get_time() - t0;
+
+    ptrdiff_t delta = copy - root_;
+    for (int i = 0; i < models_->num; i++) {
+        srmodel_data_t* data = models_->model_data[i];
+        if (!data) {
+            continue;
+        }
+        for (int j = 0; j < data->num; j++) {
+            data->files[j] += delta;
+            data->data[j] += delta;
+        }
+    }
+    residency_ = Residency::PSRAM;
+    ESP_LOGI(TAG, "📦 模型权重已拷贝到PSRAM: %uKB, 耗时%lldms%s", (unsigned)(bytes / 1024),
+             stats_.copy_us / 1000, background ? "（后台）" : "");
+    return ESP_OK;
+}
+
+/**
+ * @brief 释放Flash映射（只在还没有模型实例引用它时调用）
+ */
+void ModelLoader::releaseFlashMapping() {
+    esp_partition_mmap_handle_t* handle = (esp_partition_mmap_handle_t*)models_->mmap_handle;
+    if (handle) {
+        esp_partition_munmap(*handle);
+        free(handle);
+        models_->mmap_handle = nullptr;
+    }
+    root_ = nullptr;
+}
+
+void ModelLoader::copy_task(void* arg) {
+    ModelLoader* self = (ModelLoader*)arg;
+    if (self->copyToPsram(true) == ESP_OK) {
+        self->psram_switch_pending_ = true;
+    }
+    vTaskDelete(NULL);
+}
+
+void ModelLoader::startBackgroundCopy() {
+    if (copy_task_started_ || !root_ || residency_ == Residency::PSRAM) {
+        return;
+    }
+    copy_task_started_ = true;
+    // 最低的普通优先级：只用网络核心上其他任务剩下的CPU
+    // 拷完自己退出（PSRAM栈的任务不能自己删除，见task_factory.h）
+    if (TaskFactory::create(copy_task, "model_copy", 3 * 1024, this, MODEL_COPY_TASK_PRIORITY, nullptr,
+                            MODEL_COPY_TASK_CORE, TaskStack::INTERNAL) != pdPASS) {
+        ESP_LOGW(TAG, "⚠️ 创建模型拷贝任务失败，权重继续从Flash读取");
+    }
+}
+
+srmodel_list_t* ModelLoader::load(const char* partition_label) {
+    if (models_) {
+        return models_;
+    }
+    // 其他地方已经调用过esp_srmodel_init()，直接复用esp-sr缓存的列表
+    srmodel_list_t* cached = get_static_srmodels();
+    if (cached) {
+        models_ = cached;
+        return models_;
+    }
+
+    const esp_partition_t* part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                           ESP_PARTITION_SUBTYPE_ANY, partition_label);
+    if (!part) {
+        ESP_LOGE(TAG, "❌ 分区表中没有 '%s'", partition_label);
+        return nullptr;
+    }
+
+    size_t internal_before = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    size_t psram_before = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    stats_.partition_bytes = part->size;
+
+    int64_t t0 = esp_timer_get_time();
+    size_t used = 0;
+    esp_err_t ret = scanUsedSize(part, &used);
+    stats_.scan_us = esp_timer_get_time() - t0;
+
+    if (ret == ESP_OK) {
+        models_ = mapAndParse(part, used);
+    } else if (ret == ESP_ERR_NOT_FOUND) {
+        ESP_LOGW(TAG, "⚠️ 模型分区 '%s' 为空，请先烧录模型", partition_label);
+        return nullptr;
+    } else {
+        ESP_LOGW(TAG, "⚠️ 模型目录无法解析(%s)，映射整个分区", esp_err_to_name(ret));
+    }
+    if (!models_) {
+        int64_t t1 = esp_timer_get_time();
+        models_ = esp_srmodel_init(partition_label);
+        stats_.parse_us = esp_timer_get_time() - t1;
+        stats_.mapped_bytes = part->size;
+    }
+    if (!models_) {
+        return nullptr;
+    }
+#if MODEL_RESIDENCY == MODEL_RESIDENCY_PSRAM_BOOT
+    // 还没有任何模型实例，拷完就可以释放Flash映射
+    if (copyToPsram(false) == ESP_OK) {
+        releaseFlashMapping();
+    }
+#endif
+
+    size_t internal_after = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    size_t psram_after = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    stats_.internal_used = internal_before > internal_after ? internal_before - internal_after : 0;
+    stats_.psram_used = psram_before > psram_after ? psram_before - psram_after : 0;
+
+    ESP_LOGI(TAG, "✅ 加载%d个模型: 映射%uKB/%uKB, 目录%lldus, 映射%lldus, 解析%lldus, 内部RAM %u字节, PSRAM %u字节, 权重在%s",
+             models_->num, (unsigned)(stats_.mapped_bytes / 1024), (unsigned)(stats_.partition_bytes / 1024),
+             stats_.scan_us, stats_.map_us, stats_.parse_us,
+             (unsigned)stats_.internal_used, (unsigned)stats_.psram_used, residencyName(residency_));
+    for (int i = 0; i < models_->num; i++) {
+        ESP_LOGI(TAG, "   - %s", models_->model_name[i]);
+    }
+    return models_;
+}
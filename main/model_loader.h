@@ -0,0 +1,101 @@
+/**
+ * @file model_loader.h
+ * @brief 🧠 语音模型加载器 - 只映射模型分区中实际用到的部分，并统计加载耗时
+ *
+ * esp_srmodel_init()会把整个model分区（6000K）映射进数据地址空间，
+ * 而打包后的WakeNet/MultiNet模型通常只占其中一小部分，多映射的部分白白占用MMU页。
+ * 这里先用esp_partition_read读出模型目录，算出数据实际结束的位置，
+ * 只映射这一段，再交给esp-sr的srmodel_load()解析（权重仍然直接从Flash读取，不拷贝）。
+ * 解析结果缓存在加载器里，重复调用load()直接返回。
+ *
+ * 目录格式（esp-sr的pack_model.py生成，小端）：
+ *   uint32模型数 | 每个模型：char名称[32] | uint32文件数 | 每个文件：char名称[32] | uint32偏移 | uint32大小
+ *
+ * 目录解析失败时退回esp_srmodel_init()，行为与原来一致。
+ *
+ * 权重驻留位置（MODEL_RESIDENCY，见project_config.h）：
+ * - FLASH：权重留在Flash里按需经cache读取（默认），WakeNet每块推理都在和音频热路径抢cache
+ * - PSRAM_BOOT：解析后立即把映射的这一段整体拷进PSRAM，改写模型列表里的指针，再释放Flash映射
+ * - PSRAM_DEFERRED：先从Flash运行，网络就绪后由低优先级任务分块拷贝（每块之间让出CPU），
+ *   拷完后takePsramSwitch()返回true一次，由主循环在空闲时让音频前端用新指针重建AFE。
+ *   已经创建的MultiNet实例仍然读Flash映射（映射保留），下次启动才会用到PSRAM里的副本
+ * 拷贝只支持自己映射的路径（退回esp_srmodel_init()时权重留在Flash）；PSRAM不够时同样留在Flash。
+ */
+
+#ifndef MODEL_LOADER_H
+#define MODEL_LOADER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include "esp_err.h"
+#include "esp_partition.h"
+#include "model_path.h"
+
+class ModelLoader {
+public:
+    /**
+     * @brief 加载耗时和内存统计
+     */
+    struct Stats {
+        int64_t scan_us;            // 读取目录
+        int64_t map_us;             // esp_partition_mmap
+        int64_t parse_us;           // srmodel_load
+        size_t mapped_bytes;        // 实际映射的字节数
+        size_t partition_bytes;     // 分区大小
+        size_t internal_used;       // 加载占用的内部RAM
+        size_t psram_used;          // 加载占用的PSRAM
+        int64_t copy_us;            // 拷贝到PSRAM的耗时（没有拷贝时为0）
+    };
+
+    enum class Residency : uint8_t {
+        FLASH,      // 权重经Flash映射读取
+        PSRAM,      // 权重在PSRAM副本里
+    };
+
+    ModelLoader();
+
+    /**
+     * @brief 加载模型分区（只在第一次调用时真正加载）
+     *
+     * @param partition_label 分区名
+     * @return 模型列表；分区不存在或没有模型时返回nullptr
+     */
+    srmodel_list_t* load(const char* partition_label);
+
+    srmodel_list_t* models() const { return models_; }
+    const Stats& stats() const { return stats_; }
+
+    Residency residency() const { return residency_.load(); }
+    static const char* residencyName(Residency residency);
+
+    /**
+     * @brief 启动后台拷贝任务（MODEL_RESIDENCY_PSRAM_DEFERRED时在网络就绪后调用）
+     *
+     * 权重已经在PSRAM里、没有自己映射的权重或任务已经启动过时什么都不做。
+     */
+    void startBackgroundCopy();
+
+    /**
+     * @brief 后台拷贝完成后返回true一次，调用者负责让已创建的模型实例改用新的权重
+     */
+    bool takePsramSwitch() { return psram_switch_pending_.exchange(false); }
+
+private:
+    static const char* TAG;
+
+    esp_err_t scanUsedSize(const esp_partition_t* part, size_t* used);
+    srmodel_list_t* mapAndParse(const esp_partition_t* part, size_t used);
+    esp_err_t copyToPsram(bool background);
+    void releaseFlashMapping();
+    static void copy_task(void* arg);
+
+    srmodel_list_t* models_;
+    Stats stats_;
+    const uint8_t* root_;           // 自己映射的模型数据起点（退回esp_srmodel_init()时为nullptr）
+    std::atomic<Residency> residency_;
+    std::atomic<bool> psram_switch_pending_;
+    bool copy_task_started_;
+};
+
+#endif // MODEL_LOADER_H
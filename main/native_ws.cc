@@ -0,0 +1,580 @@
+/**
+ * @file native_ws.cc
+ * @brief 🪶 精简的WebSocket传输实现
+ */
+
+#include "native_ws.h"
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <algorithm>
+#include "buffer_placement.h"
+#include "esp_log.h"
+#include "esp_random.h"
+#include "esp_timer.h"
+#include "lwip/netdb.h"
+#include "lwip/sockets.h"
+#include "log_throttle.h"
+#include "mbedtls/base64.h"
+#include "mbedtls/sha1.h"
+#include "task_factory.h"
+
+const char* NativeWs::TAG = "NativeWs";
+
+static constexpr char kAcceptGuid[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+static constexpr uint64_t kMaxFrameBytes = 16 * 1024 * 1024;   // 更长的帧当作协议错误
+
+// 加掩码时按32位异或：槽位不一定4字节对齐，对齐之前和之后的零头按字节做
+typedef uint32_t __attribute__((may_alias)) aliased_uint32_t;
+
+NativeWs::NativeWs()
+    : on_frame_(nullptr), on_link_(nullptr), ctx_(nullptr), port_(80), rx_(nullptr), pos_(0), fill_(0),
+      last_rx_us_(0), last_ping_us_(0), sock_(-1), opening_sock_(-1), send_timeout_ms_(0),
+      write_lock_(xSemaphoreCreateMutexStatic(&write_lock_struct_)), task_(nullptr), stopping_(false),
+      exited_(xSemaphoreCreateBinaryStatic(&exited_struct_)) {
+    host_[0] = '\0';
+    strcpy(path_, "/");
+}
+
+NativeWs::~NativeWs() {
+    stop();
+    vSemaphoreDelete(exited_);
+    vSemaphoreDelete(write_lock_);
+}
+
+esp_err_t NativeWs::setUri(std::string_view uri) {
+    if (uri.compare(0, 5, "ws://") != 0) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    std::string_view rest = uri.substr(5);
+    size_t slash = rest.find('/');
+    std::string_view authority = rest.substr(0, slash);
+    std::string_view path = slash == std::string_view::npos ? std::string_view("/") : rest.substr(slash);
+    size_t colon = authority.rfind(':');
+    std::string_view host = authority.substr(0, colon);
+    int port = 80;
+    if (colon != std::string_view::npos) {
+        port = atoi(std::string(authority.substr(colon + 1)).c_str());
+    }
+    if (host.empty() || host.size() >= HOST_LEN || path.size() >= PATH_LEN || port <= 0 || port > 65535) {
+        ESP_LOGE(TAG, "❌ 不支持的地址: %.*s", (int)uri.size(), uri.data());
+        return ESP_ERR_INVALID_ARG;
+    }
+    // 网络任务只在建连时读，setUri()只在没有连接（两次尝试之间）时调用
+    memcpy(host_, host.data(), host.size());
+    host_[host.size()] = '\0';
+    memcpy(path_, path.data(), path.size());
+    path_[path.size()] = '\0';
+    port_ = (uint16_t)port;
+    return ESP_OK;
+}
+
+esp_err_t NativeWs::start(const Config& config, FrameHandler on_frame, LinkHandler on_link, void* ctx) {
+    if (task_ != nullptr) {
+        return ESP_OK;
+    }
+    config_ = config;
+    config_.buffer_bytes = std::max(config_.buffer_bytes, MAX_HEADER_BYTES + MAX_CONTROL_BYTES + 128);
+    on_frame_ = on_frame;
+    on_link_ = on_link;
+    ctx_ = ctx;
+    // 和组件的收发缓冲区一样在PSRAM：lwIP从pbuf拷进来这一次省不掉，之后原地交给回调
+    rx_ = (uint8_t*)BufferPlacement::alloc("ws_rx", config_.buffer_bytes, Placement::PSRAM);
+    if (rx_ == nullptr) {
+        return ESP_ERR_NO_MEM;
+    }
+    pos_ = 0;
+    fill_ = 0;
+    stopping_ = false;
+    xSemaphoreTake(exited_, 0);
+    // 下行音频的处理函数在这个任务里直接执行，栈留在内部RAM
+    if (TaskFactory::create(task, "ws_native", config_.task_stack, this, config_.task_priority, &task_,
+                            config_.task_core, TaskStack::INTERNAL) != pdPASS) {
+        task_ = nullptr;
+        BufferPlacement::free(rx_);
+        rx_ = nullptr;
+        ESP_LOGE(TAG, "❌ 网络任务创建失败");
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "✅ 精简WebSocket传输: 接收缓冲区 %u 字节, 任务栈 %lu 字节",
+             (unsigned)config_.buffer_bytes, (unsigned long)config_.task_stack);
+    return ESP_OK;
+}
+
+void NativeWs::stop() {
+    if (task_ == nullptr) {
+        return;
+    }
+    stopping_ = true;
+    drop();
+    xTaskNotifyGive(task_);
+    // 任务卡在建连或握手里时最多等到那一步的超时（socket已经shutdown，一般立即返回）
+    xSemaphoreTake(exited_, portMAX_DELAY);
+    task_ = nullptr;
+    BufferPlacement::free(rx_);
+    rx_ = nullptr;
+}
+
+void NativeWs::open() {
+    if (task_ != nullptr) {
+        xTaskNotifyGive(task_);
+    }
+}
+
+void NativeWs::drop() {
+    int sock = sock_.load();
+    if (sock < 0) {
+        sock = opening_sock_.load();
+    }
+    if (sock >= 0) {
+        shutdown(sock, SHUT_RDWR);
+    }
+}
+
+void NativeWs::task(void* arg) {
+    static_cast<NativeWs*>(arg)->run();
+    vTaskDelete(NULL);
+}
+
+void NativeWs::run() {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (stopping_.load()) {
+            break;
+        }
+        int64_t start_us = esp_timer_get_time();
+        int sock = connectSocket();
+        if (sock >= 0 && !handshake(sock)) {
+            closeSocket(sock);
+            sock = -1;
+        }
+        opening_sock_ = -1;
+        if (sock < 0) {
+            if (!stopping_.load()) {
+                on_link_(Link::FAILED, ctx_);
+            }
+            continue;
+        }
+        ESP_LOGI(TAG, "🔗 已连接 %s:%u%s（%lld ms）", host_, (unsigned)port_, path_,
+                 (esp_timer_get_time() - start_us) / 1000);
+
+        xSemaphoreTake(write_lock_, portMAX_DELAY);
+        sock_ = sock;
+        send_timeout_ms_ = config_.network_timeout_ms;
+        xSemaphoreGive(write_lock_);
+        last_rx_us_ = esp_timer_get_time();
+        last_ping_us_ = last_rx_us_;
+        on_link_(Link::CONNECTED, ctx_);
+
+        Link reason = Link::DISCONNECTED;
+        readFrames(sock, &reason);
+
+        // 正在写的send()先返回（socket已经出错或被shutdown），再关socket，fd号不会被写到新连接上
+        xSemaphoreTake(write_lock_, portMAX_DELAY);
+        sock_ = -1;
+        xSemaphoreGive(write_lock_);
+        closeSocket(sock);
+        pos_ = 0;
+        fill_ = 0;
+        if (!stopping_.load()) {
+            on_link_(reason, ctx_);
+        }
+    }
+    xSemaphoreGive(exited_);
+}
+
+void NativeWs::closeSocket(int sock) {
+    shutdown(sock, SHUT_RDWR);
+    close(sock);
+}
+
+int NativeWs::connectSocket() {
+    struct addrinfo hints = {};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    char port[8];
+    snprintf(port, sizeof(port), "%u", (unsigned)port_);
+    struct addrinfo* res = nullptr;
+    if (getaddrinfo(host_, port, &hints, &res) != 0 || res == nullptr) {
+        ESP_LOGE(TAG, "❌ 解析 %s 失败", host_);
+        return -1;
+    }
+    int sock = ::socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+    if (sock < 0) {
+        freeaddrinfo(res);
+        ESP_LOGE(TAG, "❌ 创建socket失败: errno %d", errno);
+        return -1;
+    }
+
+    // 🔧 建连之前设好：SYN就带DSCP，不用等连上后再从传输层里取socket
+    int one = 1;
+    if (config_.no_delay) {
+        setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+    if (config_.dscp != 0) {
+        int tos = config_.dscp << 2;    // TOS的低2位是ECN
+        setsockopt(sock, IPPROTO_IP, IP_TOS, &tos, sizeof(tos));
+    }
+    if (config_.keepalive_idle_sec > 0) {
+        setsockopt(sock, SOL_SOCKET, SO_KEEPALIVE, &one, sizeof(one));
+        setsockopt(sock, IPPROTO_TCP, TCP_KEEPIDLE, &config_.keepalive_idle_sec, sizeof(int));
+        setsockopt(sock, IPPROTO_TCP, TCP_KEEPINTVL, &config_.keepalive_interval_sec, sizeof(int));
+        setsockopt(sock, IPPROTO_TCP, TCP_KEEPCNT, &config_.keepalive_count, sizeof(int));
+    }
+    struct timeval tv = { config_.network_timeout_ms / 1000, (config_.network_timeout_ms % 1000) * 1000 };
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+    opening_sock_ = sock;
+
+    // 非阻塞connect加select，建连超时和握手超时分开
+    int flags = fcntl(sock, F_GETFL, 0);
+    fcntl(sock, F_SETFL, flags | O_NONBLOCK);
+    int ret = connect(sock, res->ai_addr, res->ai_addrlen);
+    freeaddrinfo(res);
+    if (ret != 0 && errno != EINPROGRESS) {
+        ESP_LOGE(TAG, "❌ 连接 %s:%u 失败: errno %d", host_, (unsigned)port_, errno);
+        closeSocket(sock);
+        return -1;
+    }
+    if (ret != 0) {
+        fd_set writable;
+        FD_ZERO(&writable);
+        FD_SET(sock, &writable);
+        struct timeval ctv = { config_.connect_timeout_ms / 1000, (config_.connect_timeout_ms % 1000) * 1000 };
+        int error = 0;
+        socklen_t len = sizeof(error);
+        if (select(sock + 1, nullptr, &writable, nullptr, &ctv) <= 0 ||
+            getsockopt(sock, SOL_SOCKET, SO_ERROR, &error, &len) != 0 || error != 0) {
+            ESP_LOGE(TAG, "❌ 连接 %s:%u 超时或被拒绝: %d", host_, (unsigned)port_, error);
+            closeSocket(sock);
+            return -1;
+        }
+    }
+    fcntl(sock, F_SETFL, flags);
+    return sock;
+}
+
+bool NativeWs::handshake(int sock) {
+    uint8_t nonce[16];
+    esp_fill_random(nonce, sizeof(nonce));
+    unsigned char key[32];
+    size_t key_len = 0;
+    mbedtls_base64_encode(key, sizeof(key), &key_len, nonce, sizeof(nonce));
+
+    char request[192 + HOST_LEN + PATH_LEN];
+    int n = snprintf(request, sizeof(request),
+                     "GET %s HTTP/1.1\r\n"
+                     "Host: %s:%u\r\n"
+                     "Upgrade: websocket\r\n"
+                     "Connection: Upgrade\r\n"
+                     "Sec-WebSocket-Key: %s\r\n"
+                     "Sec-WebSocket-Version: 13\r\n"
+                     "\r\n",
+                     path_, host_, (unsigned)port_, (const char*)key);
+    for (int sent = 0; sent < n;) {
+        int r = ::send(sock, request + sent, n - sent, 0);
+        if (r <= 0) {
+            ESP_LOGE(TAG, "❌ 发送握手请求失败: errno %d", errno);
+            return false;
+        }
+        sent += r;
+    }
+
+    // 响应头收进接收缓冲区；头后面跟着的字节已经是第一帧，留给readFrames()
+    pos_ = 0;
+    fill_ = 0;
+    char* response = (char*)rx_;
+    char* end = nullptr;
+    while (end == nullptr) {
+        if (fill_ + 1 >= config_.buffer_bytes) {
+            ESP_LOGE(TAG, "❌ 握手响应头过长");
+            return false;
+        }
+        int r = recv(sock, rx_ + fill_, config_.buffer_bytes - 1 - fill_, 0);
+        if (r <= 0) {
+            ESP_LOGE(TAG, "❌ 等握手响应失败: errno %d", errno);
+            return false;
+        }
+        fill_ += r;
+        rx_[fill_] = '\0';
+        end = strstr(response, "\r\n\r\n");
+    }
+    if (strncmp(response, "HTTP/1.1 101", 12) != 0) {
+        const char* eol = strstr(response, "\r\n");
+        ESP_LOGE(TAG, "❌ 服务器拒绝升级: %.*s", (int)(eol - response), response);
+        return false;
+    }
+
+    // Sec-WebSocket-Accept = base64(SHA-1(key + GUID))
+    char digest_input[sizeof(key) + sizeof(kAcceptGuid)];
+    int input_len = snprintf(digest_input, sizeof(digest_input), "%s%s", (const char*)key, kAcceptGuid);
+    unsigned char digest[20];
+    mbedtls_sha1((const unsigned char*)digest_input, input_len, digest);
+    unsigned char expected[32];
+    size_t expected_len = 0;
+    mbedtls_base64_encode(expected, sizeof(expected), &expected_len, digest, sizeof(digest));
+
+    bool accepted = false;
+    static constexpr char kAcceptHeader[] = "Sec-WebSocket-Accept:";
+    for (char* line = strstr(response, "\r\n"); line != nullptr && line < end; line = strstr(line + 2, "\r\n")) {
+        char* field = line + 2;
+        if (strncasecmp(field, kAcceptHeader, sizeof(kAcceptHeader) - 1) != 0) {
+            continue;
+        }
+        field += sizeof(kAcceptHeader) - 1;
+        while (*field == ' ') {
+            field++;
+        }
+        accepted = strncmp(field, (const char*)expected, expected_len) == 0;
+        break;
+    }
+    if (!accepted) {
+        ESP_LOGE(TAG, "❌ Sec-WebSocket-Accept不匹配");
+        return false;
+    }
+    pos_ = (end + 4) - response;
+
+    // 之后的读超时用来按间隔发ping（见fill()）
+    int idle_ms = config_.ping_interval_sec > 0 ? config_.ping_interval_sec * 1000
+                : config_.pingpong_timeout_sec * 1000;
+    struct timeval tv = { idle_ms / 1000, (idle_ms % 1000) * 1000 };
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    return true;
+}
+
+bool NativeWs::fill(int sock, size_t need, Link* reason) {
+    if (pos_ == fill_) {
+        pos_ = 0;
+        fill_ = 0;
+    }
+    while (fill_ - pos_ < need) {
+        // 跨在缓冲区末尾的帧挪到开头（只挪这一帧已经收到的部分）
+        if (pos_ + need > config_.buffer_bytes) {
+            memmove(rx_, rx_ + pos_, fill_ - pos_);
+            fill_ -= pos_;
+            pos_ = 0;
+        }
+        int r = recv(sock, rx_ + fill_, config_.buffer_bytes - fill_, 0);
+        int64_t now = esp_timer_get_time();
+        if (r > 0) {
+            fill_ += r;
+            last_rx_us_ = now;
+            continue;
+        }
+        if (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK) && !stopping_.load()) {
+            // 💓 空闲：到间隔发一个ping，超时还什么都没收到就断开
+            if (config_.pingpong_timeout_sec > 0 && now - last_rx_us_ > (int64_t)config_.pingpong_timeout_sec * 1000000) {
+                ESP_LOGW(TAG, "💔 %d 秒没有收到任何数据，断开", config_.pingpong_timeout_sec);
+                *reason = Link::DISCONNECTED;
+                return false;
+            }
+            if (config_.ping_interval_sec > 0 && now - last_ping_us_ >= (int64_t)config_.ping_interval_sec * 1000000) {
+                last_ping_us_ = now;
+                writeFrame(sock, 0x09, nullptr, 0, config_.network_timeout_ms);
+            }
+            continue;
+        }
+        if (r == 0) {
+            ESP_LOGI(TAG, "🔌 TCP连接已关闭");
+        } else if (!stopping_.load()) {
+            HOT_LOGW(TAG, "⚠️ 接收出错: errno %d", errno);
+        }
+        *reason = Link::DISCONNECTED;
+        return false;
+    }
+    return true;
+}
+
+bool NativeWs::readFrames(int sock, Link* reason) {
+    const size_t capacity = config_.buffer_bytes;
+    while (true) {
+        if (!fill(sock, 2, reason)) {
+            return false;
+        }
+        const uint8_t* h = rx_ + pos_;
+        size_t header = 2 + ((h[1] & 0x7F) == 126 ? 2 : (h[1] & 0x7F) == 127 ? 8 : 0) + ((h[1] & 0x80) ? 4 : 0);
+        if (!fill(sock, header, reason)) {
+            return false;
+        }
+        h = rx_ + pos_;     // fill()可能把数据挪到了缓冲区开头
+        bool fin = (h[0] & 0x80) != 0;
+        uint8_t op_code = h[0] & 0x0F;
+        bool masked = (h[1] & 0x80) != 0;
+        uint64_t len = h[1] & 0x7F;
+        size_t at = 2;
+        if (len == 126) {
+            len = (uint64_t)h[2] << 8 | h[3];
+            at = 4;
+        } else if (len == 127) {
+            len = 0;
+            for (size_t i = 0; i < 8; i++) {
+                len = len << 8 | h[2 + i];
+            }
+            at = 10;
+        }
+        uint32_t key = 0;
+        if (masked) {
+            memcpy(&key, h + at, 4);
+        }
+        if (len > kMaxFrameBytes || (op_code >= 0x08 && (len > MAX_CONTROL_BYTES || !fin))) {
+            ESP_LOGE(TAG, "❌ 帧格式错误: op 0x%02x, %llu 字节", op_code, (unsigned long long)len);
+            *reason = Link::DISCONNECTED;
+            return false;
+        }
+
+        Frame frame;
+        frame.op_code = op_code;
+        frame.fin = fin;
+        frame.total = (size_t)len;
+        if (header + len <= capacity) {
+            // 整帧收齐后原地交出去：文本消息总是一个完整片段，事件任务能直接接住
+            if (!fill(sock, header + (size_t)len, reason)) {
+                return false;
+            }
+            uint8_t* payload = rx_ + pos_ + header;
+            if (masked) {
+                applyMask(payload, (size_t)len, key, 0);
+            }
+            frame.data = payload;
+            frame.len = (size_t)len;
+            frame.offset = 0;
+            if (op_code != 0x08) {
+                on_frame_(frame, ctx_);     // close只从LinkHandler报告
+            }
+            pos_ += header + (size_t)len;
+            if (op_code >= 0x08 && !handleControl(sock, op_code, payload, (size_t)len, reason)) {
+                return false;
+            }
+            continue;
+        }
+
+        // 超过缓冲区的帧：按缓冲区大小分段交出去
+        pos_ += header;
+        for (size_t offset = 0; offset < len;) {
+            size_t chunk = std::min<size_t>((size_t)len - offset, capacity);
+            if (!fill(sock, chunk, reason)) {
+                return false;
+            }
+            uint8_t* payload = rx_ + pos_;
+            if (masked) {
+                applyMask(payload, chunk, key, offset);
+            }
+            frame.data = payload;
+            frame.len = chunk;
+            frame.offset = offset;
+            on_frame_(frame, ctx_);
+            pos_ += chunk;
+            offset += chunk;
+        }
+    }
+}
+
+bool NativeWs::handleControl(int sock, uint8_t op_code, uint8_t* data, size_t len, Link* reason) {
+    switch (op_code) {
+        case 0x09:  // ping：原样回pong（负载已经交给回调，这里就地加掩码）
+            writeFrame(sock, 0x0A, data, len, config_.network_timeout_ms);
+            return true;
+        case 0x08:  // close：回同样的状态码后断开
+            ESP_LOGI(TAG, "🔌 服务器关闭连接（%u）", len >= 2 ? (unsigned)(data[0] << 8 | data[1]) : 0u);
+            writeFrame(sock, 0x08, data, std::min<size_t>(len, 2), 1000);
+            *reason = Link::CLOSED;
+            return false;
+        default:    // pong
+            return true;
+    }
+}
+
+int NativeWs::send(uint8_t op_code, uint8_t* payload, size_t len, int timeout_ms) {
+    int sock = sock_.load();
+    if (sock < 0) {
+        return -1;
+    }
+    return writeFrame(sock, op_code, payload, len, timeout_ms);
+}
+
+int NativeWs::writeFrame(int sock, uint8_t op_code, uint8_t* payload, size_t len, int timeout_ms) {
+    uint8_t header[MAX_HEADER_BYTES];
+    size_t n = 0;
+    header[n++] = 0x80 | op_code;
+    if (len < 126) {
+        header[n++] = 0x80 | (uint8_t)len;
+    } else if (len <= 0xFFFF) {
+        header[n++] = 0x80 | 126;
+        header[n++] = (uint8_t)(len >> 8);
+        header[n++] = (uint8_t)len;
+    } else {
+        header[n++] = 0x80 | 127;
+        for (int i = 7; i >= 0; i--) {
+            header[n++] = (uint8_t)((uint64_t)len >> (8 * i));
+        }
+    }
+    uint32_t key = esp_random();
+    memcpy(header + n, &key, 4);
+    n += 4;
+    if (len > 0) {
+        applyMask(payload, len, key, 0);
+    }
+
+    struct iovec iov[2] = { { header, n }, { payload, len } };
+    struct msghdr msg = {};
+    msg.msg_iov = iov;
+    msg.msg_iovlen = len > 0 ? 2 : 1;
+
+    xSemaphoreTake(write_lock_, portMAX_DELAY);
+    if (sock_.load() != sock) {
+        xSemaphoreGive(write_lock_);
+        return -1;      // 连接已经换了
+    }
+    if (timeout_ms != send_timeout_ms_) {
+        struct timeval tv = { timeout_ms / 1000, (timeout_ms % 1000) * 1000 };
+        setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+        send_timeout_ms_ = timeout_ms;
+    }
+    // 帧头和负载一次写进lwIP；发送缓冲区满时sendmsg只写进一部分，接着写剩下的
+    size_t left = n + len;
+    while (left > 0) {
+        ssize_t r = sendmsg(sock, &msg, 0);
+        if (r <= 0) {
+            xSemaphoreGive(write_lock_);
+            HOT_LOGW(TAG, "⚠️ 写socket失败: errno %d", errno);
+            return -1;
+        }
+        left -= r;
+        while (r > 0) {
+            size_t step = std::min<size_t>(r, msg.msg_iov->iov_len);
+            msg.msg_iov->iov_base = (uint8_t*)msg.msg_iov->iov_base + step;
+            msg.msg_iov->iov_len -= step;
+            r -= step;
+            if (msg.msg_iov->iov_len == 0 && msg.msg_iovlen > 1) {
+                msg.msg_iov++;
+                msg.msg_iovlen--;
+            }
+        }
+    }
+    xSemaphoreGive(write_lock_);
+    return (int)len;
+}
+
+void NativeWs::applyMask(uint8_t* data, size_t len, uint32_t key, size_t offset) {
+    uint8_t k[4];
+    memcpy(k, &key, 4);
+    size_t i = 0;
+    for (; i < len && ((uintptr_t)(data + i) & 3) != 0; i++) {
+        data[i] ^= k[(offset + i) & 3];
+    }
+    if (i + 4 <= len) {
+        // 对齐之后每个字的第j个字节对应掩码的第(offset+i+j)%4个
+        uint8_t rotated[4] = { k[(offset + i) & 3], k[(offset + i + 1) & 3], k[(offset + i + 2) & 3], k[(offset + i + 3) & 3] };
+        uint32_t word;
+        memcpy(&word, rotated, 4);
+        aliased_uint32_t* words = (aliased_uint32_t*)(data + i);
+        size_t count = (len - i) / 4;
+        for (size_t w = 0; w < count; w++) {
+            words[w] ^= word;
+        }
+        i += count * 4;
+    }
+    for (; i < len; i++) {
+        data[i] ^= k[(offset + i) & 3];
+    }
+}
@@ -0,0 +1,165 @@
+/**
+ * @file native_ws.h
+ * @brief 🪶 精简的WebSocket传输 - 直接在lwIP socket上做RFC 6455分帧，由自己的网络任务收包
+ *
+ * esp_websocket_client多一个8KB栈的任务、一收一发两块缓冲区，收到的数据先拷进组件的缓冲区，
+ * 再经esp_event分发；socket选项只能在连上之后从传输层里掏出socket补设。这里只实现设备用到的部分：
+ *
+ * - 建连：getaddrinfo + 非阻塞connect（有超时），connect之前就设好TCP_NODELAY、DSCP（IP_TOS）和keep-alive，
+ *   握手的SYN就带上DSCP；然后是HTTP Upgrade握手，校验Sec-WebSocket-Accept
+ * - 收：一块接收缓冲区，recv尽量多读，能放进缓冲区的帧收齐后原地交给回调（不再拷贝）；
+ *   更大的帧按缓冲区大小分段回调（offset/total，和组件的payload_offset/payload_len一样）。
+ *   服务器的帧不应带掩码，带了也原地解掉。ping原样回pong，close回close后断开
+ * - 发：帧头在栈上，负载就地加掩码（调用方交出的缓冲区会被改写），帧头和负载用一次sendmsg写出
+ * - 保活：读超时按ping_interval_sec发ping，pingpong_timeout_sec内什么都没收到就断开
+ *
+ * 只支持ws://：wss://的TLS仍然走esp_websocket_client + TlsTransport（会话复用在那边）。
+ *
+ * 网络任务平时阻塞在任务通知上，open()叫醒它建一次连，连上后一直收到断开为止，然后回去等下一次open()；
+ * 断线重连不重建任务、不重新分配缓冲区。回调都在网络任务中执行，send()可以在任意任务调用
+ * （和网络任务回pong之间用写锁串行）。
+ */
+
+#ifndef NATIVE_WS_H
+#define NATIVE_WS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <string_view>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+class NativeWs {
+public:
+    static constexpr size_t HOST_LEN = 64;
+    static constexpr size_t PATH_LEN = 96;
+    static constexpr size_t MAX_HEADER_BYTES = 14;      // 2字节 + 64位长度 + 掩码
+    static constexpr size_t MAX_CONTROL_BYTES = 125;    // 控制帧负载上限（RFC 6455 5.5）
+
+    enum class Link : uint8_t {
+        CONNECTED,      // 握手完成
+        FAILED,         // 这次open()没连上（解析、建连或握手失败）
+        DISCONNECTED,   // 连上之后断开（读写出错、保活超时或drop()）
+        CLOSED,         // 服务器发了close
+    };
+
+    /**
+     * @brief 收到的一段数据（帧不超过接收缓冲区时就是整个帧）
+     */
+    struct Frame {
+        uint8_t op_code;
+        bool fin;
+        const uint8_t* data;
+        size_t len;
+        size_t offset;      // 本段在帧内的偏移
+        size_t total;       // 帧的负载长度
+    };
+
+    using FrameHandler = void (*)(const Frame& frame, void* ctx);
+    using LinkHandler = void (*)(Link link, void* ctx);
+
+    struct Config {
+        bool no_delay = true;
+        uint8_t dscp = 0;
+        int keepalive_idle_sec = 0;         // 0=不启用TCP keep-alive
+        int keepalive_interval_sec = 2;
+        int keepalive_count = 3;
+        int ping_interval_sec = 10;
+        int pingpong_timeout_sec = 30;      // 0=不检测
+        int connect_timeout_ms = 5000;
+        int network_timeout_ms = 15000;     // 握手和单次写socket的上限
+        size_t buffer_bytes = 8192;
+        uint32_t task_stack = 6144;
+        int task_priority = 5;
+        int task_core = tskNO_AFFINITY;
+    };
+
+    NativeWs();
+    ~NativeWs();
+
+    NativeWs(const NativeWs&) = delete;
+    NativeWs& operator=(const NativeWs&) = delete;
+
+    /**
+     * @brief 分配接收缓冲区、创建网络任务（不建连，等open()）
+     */
+    esp_err_t start(const Config& config, FrameHandler on_frame, LinkHandler on_link, void* ctx);
+
+    /**
+     * @brief 停掉网络任务并释放缓冲区（关掉当前连接，等任务退出；之后不会再有回调）
+     */
+    void stop();
+
+    bool running() const { return task_ != nullptr; }
+
+    /**
+     * @brief 设置地址（ws://host[:port][/path]），下次open()生效
+     */
+    esp_err_t setUri(std::string_view uri);
+
+    /**
+     * @brief 叫醒网络任务建一次连，结果从LinkHandler回来（CONNECTED或FAILED）
+     */
+    void open();
+
+    /**
+     * @brief 关掉当前socket：网络任务的recv出错返回，报告DISCONNECTED后回去等open()
+     */
+    void drop();
+
+    /**
+     * @brief 当前连接的socket，没连上时是-1
+     */
+    int socket() const { return sock_.load(); }
+
+    /**
+     * @brief 发一帧：payload就地加掩码后写出
+     *
+     * @return 负载字节数，-1=未连接、超时或写出错
+     */
+    int send(uint8_t op_code, uint8_t* payload, size_t len, int timeout_ms);
+
+private:
+    static const char* TAG;
+
+    static void task(void* arg);
+    void run();
+    int connectSocket();
+    void closeSocket(int sock);
+    bool handshake(int sock);
+    bool readFrames(int sock, Link* reason);
+    bool fill(int sock, size_t need, Link* reason);
+    bool handleControl(int sock, uint8_t op_code, uint8_t* data, size_t len, Link* reason);
+    int writeFrame(int sock, uint8_t op_code, uint8_t* payload, size_t len, int timeout_ms);
+    static void applyMask(uint8_t* data, size_t len, uint32_t key, size_t offset);
+
+    Config config_;
+    FrameHandler on_frame_;
+    LinkHandler on_link_;
+    void* ctx_;
+
+    char host_[HOST_LEN];
+    char path_[PATH_LEN];
+    uint16_t port_;
+
+    uint8_t* rx_;               // 接收缓冲区：[pos_, fill_)是还没处理的数据
+    size_t pos_;
+    size_t fill_;
+    int64_t last_rx_us_;        // 最近一次收到数据（保活看这个）
+    int64_t last_ping_us_;
+
+    std::atomic<int> sock_;
+    std::atomic<int> opening_sock_;     // 建连和握手中的socket（drop()也要能打断它）
+    int send_timeout_ms_;       // socket当前的SO_SNDTIMEO，相同就不再设
+    StaticSemaphore_t write_lock_struct_;
+    SemaphoreHandle_t write_lock_;
+    TaskHandle_t task_;
+    std::atomic<bool> stopping_;
+    StaticSemaphore_t exited_struct_;
+    SemaphoreHandle_t exited_;          // 网络任务退出前给出，stop()等它
+};
+
+#endif // NATIVE_WS_H
@@ -0,0 +1,359 @@
+/**
+ * @file net_self_test.cc
+ * @brief 🛰️ 网络自检实现
+ */
+
+#include "net_self_test.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "lwip/sockets.h"
+#include "lwip/netdb.h"
+#include "json_message.h"
+#include "task_factory.h"
+#include "project_config.h"
+
+const char* NetSelfTest::TAG = "NetSelfTest";
+
+// 20次小包回显的RTT足够看出分布，tcp模式不和吞吐测试同时进行
+static constexpr int kTcpEchoCount = 20;
+static constexpr int kTcpTimeoutMs = 2000;
+
+NetSelfTest::NetSelfTest(WebSocketClient* ws, const char* server_uri)
+    : ws_(ws)
+    , host_{}
+    , params_{}
+    , dscp_(0)
+    , running_(false)
+    , receiving_(false)
+    , in_test_msg_(false)
+    , down_bytes_(0)
+    , down_msgs_(0)
+    , down_gaps_(0)
+    , down_next_seq_(0)
+    , rtt_lock_(portMUX_INITIALIZER_UNLOCKED)
+    , ping_sent_us_{}
+    , ping_seq_{}
+    , rtt_ms_{}
+    , rtt_count_(0)
+    , pings_sent_(0)
+    , up_dropped_(0)
+{
+    // ws://host:port/path → host（tcp模式连同一台服务器的另一个端口）
+    const char* p = strstr(server_uri, "://");
+    p = p ? p + 3 : server_uri;
+    size_t n = strcspn(p, ":/");
+    n = std::min(n, sizeof(host_) - 1);
+    memcpy(host_, p, n);
+    host_[n] = '\0';
+}
+
+esp_err_t NetSelfTest::start(const Params& params) {
+    bool expected = false;
+    if (!running_.compare_exchange_strong(expected, true)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    params_ = params;
+    params_.size = std::max<uint32_t>(params_.size, HEADER_BYTES);
+    if (TaskFactory::create(test_task, "net_test", NET_TEST_TASK_STACK, this,
+                            NET_TEST_TASK_PRIORITY, NULL, NET_TEST_TASK_CORE, TaskStack::INTERNAL) != pdPASS) {
+        running_ = false;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+void NetSelfTest::test_task(void* arg) {
+    NetSelfTest* self = (NetSelfTest*)arg;
+    ESP_LOGI(TAG, "🛰️ 开始%s自检 %lu ms，每条 %lu 字节", self->params_.mode == Mode::TCP ? "TCP" : "WebSocket",
+             (unsigned long)self->params_.duration_ms, (unsigned long)self->params_.size);
+    uint8_t connection_dscp = self->ws_->dscp();
+    self->dscp_ = self->params_.dscp >= 0 ? (uint8_t)self->params_.dscp : connection_dscp;
+    if (self->params_.mode == Mode::TCP) {
+        self->runTcp();
+    } else {
+        if (self->dscp_ != connection_dscp) {
+            self->ws_->setDscp(self->dscp_);
+        }
+        self->runWebSocket();
+        if (self->dscp_ != connection_dscp) {
+            self->ws_->setDscp(connection_dscp);
+        }
+    }
+    self->running_ = false;
+    vTaskDelete(NULL);
+}
+
+void NetSelfTest::buildFrame(uint8_t* frame, uint32_t seq) {
+    uint32_t t_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    frame[0] = MAGIC;
+    frame[1] = 'N';
+    memcpy(frame + 2, &seq, sizeof(seq));
+    memcpy(frame + 6, &t_ms, sizeof(t_ms));
+}
+
+void NetSelfTest::addRtt(uint32_t rtt_ms) {
+    portENTER_CRITICAL(&rtt_lock_);
+    if (rtt_count_ < MAX_RTT_SAMPLES) {
+        rtt_ms_[rtt_count_++] = (uint16_t)std::min<uint32_t>(rtt_ms, UINT16_MAX);
+    }
+    portEXIT_CRITICAL(&rtt_lock_);
+}
+
+bool NetSelfTest::onDownlink(const WebSocketClient::EventData& event) {
+    if (event.message_start) {
+        in_test_msg_ = running_.load(std::memory_order_relaxed) && event.data_len >= HEADER_BYTES &&
+                       event.data[0] == MAGIC && event.data[1] == 'N';
+        if (in_test_msg_ && receiving_.load(std::memory_order_relaxed)) {
+            uint32_t seq;
+            memcpy(&seq, event.data + 2, sizeof(seq));
+            uint32_t expected = down_next_seq_.load(std::memory_order_relaxed);
+            if (down_msgs_.load(std::memory_order_relaxed) > 0 && seq > expected) {
+                down_gaps_.fetch_add(seq - expected, std::memory_order_relaxed);
+            }
+            down_next_seq_.store(seq + 1, std::memory_order_relaxed);
+            down_msgs_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    if (!in_test_msg_) {
+        return false;
+    }
+    if (receiving_.load(std::memory_order_relaxed)) {
+        down_bytes_.fetch_add(event.data_len, std::memory_order_relaxed);
+    }
+    return true;
+}
+
+void NetSelfTest::onPong(uint32_t seq) {
+    int64_t now = esp_timer_get_time();
+    int64_t sent_us = 0;
+    portENTER_CRITICAL(&rtt_lock_);
+    size_t slot = seq % PING_SLOTS;
+    if (ping_seq_[slot] == seq && ping_sent_us_[slot] != 0) {
+        sent_us = ping_sent_us_[slot];
+        ping_sent_us_[slot] = 0;
+    }
+    portEXIT_CRITICAL(&rtt_lock_);
+    if (sent_us != 0) {
+        addRtt((uint32_t)((now - sent_us) / 1000));
+    }
+}
+
+void NetSelfTest::runWebSocket() {
+    uint8_t* frame = (uint8_t*)calloc(1, params_.size);
+    if (frame == nullptr) {
+        ESP_LOGE(TAG, "❌ 测试消息缓冲区分配失败");
+        return;
+    }
+    down_bytes_ = 0;
+    down_msgs_ = 0;
+    down_gaps_ = 0;
+    down_next_seq_ = 0;
+    rtt_count_ = 0;
+    pings_sent_ = 0;
+    up_dropped_ = 0;
+    memset(ping_sent_us_, 0, sizeof(ping_sent_us_));
+    WebSocketClient::SendStats before = ws_->getSendStats(WebSocketClient::SendLane::AUDIO);
+
+    // 服务器收到net_test_start才开始下发和计数
+    JsonMessage<112> start("net_test_start");
+    start.str("mode", "ws").num("ms", params_.duration_ms).num("size", params_.size).num("dscp", dscp_);
+    ws_->sendText(start.finish(), 100);
+    receiving_ = true;
+
+    int64_t start_us = esp_timer_get_time();
+    int64_t end_us = start_us + (int64_t)params_.duration_ms * 1000;
+    int64_t next_ping_us = start_us;
+    uint32_t seq = 0;
+    int64_t now = start_us;
+    while (now < end_us && ws_->isConnected()) {
+        if (now >= next_ping_us) {
+            uint32_t ping = pings_sent_++;
+            portENTER_CRITICAL(&rtt_lock_);
+            ping_seq_[ping % PING_SLOTS] = ping;
+            ping_sent_us_[ping % PING_SLOTS] = now;
+            portEXIT_CRITICAL(&rtt_lock_);
+            JsonMessage<48> msg("net_test_ping");
+            msg.num("seq", ping);
+            ws_->sendText(msg.finish(), 100);
+            next_ping_us += (int64_t)NET_TEST_PING_MS * 1000;
+        }
+        // 和补发缓存的音频一样留一个空位，控制消息和心跳不会因为测试被挤掉
+        if (ws_->sendQueueSpace(WebSocketClient::SendLane::AUDIO) > 1) {
+            buildFrame(frame, seq++);
+            if (ws_->sendAudio(frame, params_.size) < 0) {
+                up_dropped_++;
+            }
+        } else {
+            vTaskDelay(1);
+        }
+        now = esp_timer_get_time();
+    }
+    uint32_t elapsed_ms = (uint32_t)((now - start_us) / 1000);
+
+    // 等最后的pong和还在路上的下行
+    vTaskDelay(pdMS_TO_TICKS(NET_TEST_DRAIN_MS));
+    receiving_ = false;
+    free(frame);
+
+    WebSocketClient::SendStats after = ws_->getSendStats(WebSocketClient::SendLane::AUDIO);
+    up_dropped_ += (after.dropped_stale - before.dropped_stale) + (after.failed - before.failed);
+    uint64_t up_bytes = (uint64_t)(after.completed - before.completed) * params_.size;
+    uint32_t up_kbps = elapsed_ms > 0 ? (uint32_t)(up_bytes * 8 / elapsed_ms) : 0;
+    uint32_t down_kbps = elapsed_ms > 0 ? (uint32_t)((uint64_t)down_bytes_.load() * 8 / elapsed_ms) : 0;
+    sendResult(up_kbps, down_kbps, elapsed_ms);
+}
+
+int NetSelfTest::connectTcp(char command) {
+    // 🧭 连当前WebSocket连着的那台中继（可能是故障转移后的候选，不一定是配置的地址）
+    struct sockaddr_storage peer;
+    socklen_t peer_len = 0;
+    if (ws_->peerAddress(&peer, &peer_len) && peer.ss_family == AF_INET) {
+        inet_ntop(AF_INET, &((struct sockaddr_in*)&peer)->sin_addr, host_, sizeof(host_));
+    }
+    struct addrinfo hints = {};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    char port[8];
+    snprintf(port, sizeof(port), "%u", (unsigned)params_.tcp_port);
+    struct addrinfo* res = nullptr;
+    if (getaddrinfo(host_, port, &hints, &res) != 0 || res == nullptr) {
+        ESP_LOGE(TAG, "❌ 解析 %s 失败", host_);
+        return -1;
+    }
+    int fd = socket(res->ai_family, res->ai_socktype, 0);
+    if (fd >= 0) {
+        struct timeval tv = { kTcpTimeoutMs / 1000, (kTcpTimeoutMs % 1000) * 1000 };
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+        setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        int tos = dscp_ << 2;
+        setsockopt(fd, IPPROTO_IP, IP_TOS, &tos, sizeof(tos));
+        if (connect(fd, res->ai_addr, res->ai_addrlen) != 0 || send(fd, &command, 1, 0) != 1) {
+            ESP_LOGE(TAG, "❌ 连接 %s:%s 失败: errno %d", host_, port, errno);
+            close(fd);
+            fd = -1;
+        }
+    }
+    freeaddrinfo(res);
+    return fd;
+}
+
+void NetSelfTest::runTcp() {
+    rtt_count_ = 0;
+    pings_sent_ = 0;
+    up_dropped_ = 0;
+    down_msgs_ = 0;
+    down_gaps_ = 0;
+    int64_t start_us = esp_timer_get_time();
+
+    // 1. 小包回显：8字节发出去原样收回来
+    int fd = connectTcp('E');
+    if (fd >= 0) {
+        for (int i = 0; i < kTcpEchoCount; i++) {
+            int64_t sent_us = esp_timer_get_time();
+            uint8_t buf[8];
+            memcpy(buf, &sent_us, sizeof(buf));
+            pings_sent_++;
+            if (send(fd, buf, sizeof(buf), 0) != (int)sizeof(buf)) {
+                break;
+            }
+            size_t got = 0;
+            while (got < sizeof(buf)) {
+                int n = recv(fd, buf + got, sizeof(buf) - got, 0);
+                if (n <= 0) {
+                    break;
+                }
+                got += n;
+            }
+            if (got < sizeof(buf)) {
+                break;
+            }
+            addRtt((uint32_t)((esp_timer_get_time() - sent_us) / 1000));
+        }
+        close(fd);
+    }
+
+    uint8_t* buf = (uint8_t*)calloc(1, params_.size);
+    if (buf == nullptr) {
+        ESP_LOGE(TAG, "❌ 测试缓冲区分配失败");
+        sendResult(0, 0, 0);
+        return;
+    }
+    uint32_t half_ms = params_.duration_ms / 2;
+
+    // 2. 上传：前一半时间尽快写，服务器按收到的字节另算一遍
+    uint32_t up_kbps = 0;
+    fd = connectTcp('U');
+    if (fd >= 0) {
+        uint64_t bytes = 0;
+        int64_t t0 = esp_timer_get_time();
+        int64_t end_us = t0 + (int64_t)half_ms * 1000;
+        while (esp_timer_get_time() < end_us) {
+            int n = send(fd, buf, params_.size, 0);
+            if (n <= 0) {
+                up_dropped_++;
+                break;
+            }
+            bytes += n;
+        }
+        uint32_t ms = (uint32_t)((esp_timer_get_time() - t0) / 1000);
+        up_kbps = ms > 0 ? (uint32_t)(bytes * 8 / ms) : 0;
+        close(fd);
+    }
+
+    // 3. 下载：服务器写half_ms毫秒后关闭连接
+    uint32_t down_kbps = 0;
+    fd = connectTcp('D');
+    if (fd >= 0 && send(fd, &half_ms, sizeof(half_ms), 0) == (int)sizeof(half_ms)) {
+        uint64_t bytes = 0;
+        int64_t t0 = esp_timer_get_time();
+        int64_t deadline_us = t0 + (int64_t)(half_ms + NET_TEST_DRAIN_MS) * 1000;
+        while (esp_timer_get_time() < deadline_us) {
+            int n = recv(fd, buf, params_.size, 0);
+            if (n <= 0) {
+                break;
+            }
+            bytes += n;
+            down_msgs_++;
+        }
+        uint32_t ms = (uint32_t)((esp_timer_get_time() - t0) / 1000);
+        down_kbps = ms > 0 ? (uint32_t)(bytes * 8 / ms) : 0;
+    }
+    if (fd >= 0) {
+        close(fd);
+    }
+    free(buf);
+    sendResult(up_kbps, down_kbps, (uint32_t)((esp_timer_get_time() - start_us) / 1000));
+}
+
+void NetSelfTest::sendResult(uint32_t up_kbps, uint32_t down_kbps, uint32_t elapsed_ms) {
+    static uint16_t sorted[MAX_RTT_SAMPLES];   // 只在测试任务中使用
+    portENTER_CRITICAL(&rtt_lock_);
+    size_t count = rtt_count_;
+    memcpy(sorted, rtt_ms_, count * sizeof(sorted[0]));
+    portEXIT_CRITICAL(&rtt_lock_);
+    std::sort(sorted, sorted + count);
+    auto pct = [&](size_t p) { return count > 0 ? (unsigned)sorted[std::min(count - 1, count * p / 100)] : 0u; };
+
+    const char* mode = params_.mode == Mode::TCP ? "tcp" : "ws";
+    char msg[448];
+    snprintf(msg, sizeof(msg),
+             "{\"type\":\"net_test_result\",\"mode\":\"%s\",\"ms\":%lu,\"size\":%lu,\"up_kbps\":%lu,\"down_kbps\":%lu,"
+             "\"down_msgs\":%lu,\"down_gaps\":%lu,\"up_dropped\":%lu,\"pings\":%lu,\"pongs\":%u,"
+             "\"rtt_p50\":%u,\"rtt_p90\":%u,\"rtt_p99\":%u,\"rtt_max\":%u,\"need_up_kbps\":%lu,"
+             "\"wifi_profile\":\"%s\",\"dscp\":%u}",
+             mode, (unsigned long)elapsed_ms, (unsigned long)params_.size, (unsigned long)up_kbps,
+             (unsigned long)down_kbps, (unsigned long)down_msgs_.load(), (unsigned long)down_gaps_.load(),
+             (unsigned long)up_dropped_, (unsigned long)pings_sent_, (unsigned)count,
+             pct(50), pct(90), pct(99), count > 0 ? (unsigned)sorted[count - 1] : 0u,
+             (unsigned long)params_.need_up_kbps, params_.wifi_profile, (unsigned)dscp_);
+    ESP_LOGI(TAG, "🛰️ %s自检: 上行 %lu kbit/s，下行 %lu kbit/s，RTT p50/p90/max %u/%u/%u ms（%u/%lu个回应）",
+             mode, (unsigned long)up_kbps, (unsigned long)down_kbps, pct(50), pct(90),
+             count > 0 ? (unsigned)sorted[count - 1] : 0u, (unsigned)count, (unsigned long)pings_sent_);
+    ws_->sendText(msg, 100);
+}
@@ -0,0 +1,105 @@
+/**
+ * @file net_self_test.h
+ * @brief 🛰️ 网络自检 - 在现场测出设备到服务器的双向吞吐、RTT分位数和丢失，分清是AP、中继还是设备的问题
+ *
+ * 服务器发{"type":"net_test","mode":"ws"|"tcp","ms":N,"size":B,"port":P}，设备空闲时在独立任务里跑：
+ *
+ * - ws：走和音频完全相同的WebSocketClient路径。上行按发送队列的余量尽快发B字节的测试消息
+ *   （走音频通道，和上行音频一样受audio_deadline_ms约束），服务器同时尽快下发测试消息；
+ *   每NET_TEST_PING_MS发一个net_test_ping，服务器回net_test_pong，得到满载时的RTT
+ * - tcp：另开裸TCP连接到服务器的port（RELAY_NET_TEST_PORT），依次做20次小包回显、
+ *   前一半时间上传、后一半时间下载，和ws的结果对比就是WebSocket/发送队列本身的开销
+ *
+ * 请求带"dscp"时，测试期间WebSocket连接（tcp模式是测试连接）改用这个DSCP，服务器那一侧也跟着改，
+ * 测完恢复；连着测0和46两次就是WMM语音队列带来的RTT/抖动差别。
+ *
+ * 测试消息：magic(u8)=0xE7 | 'N' | seq(u32) | t_ms(u32) | 填充，和音频帧（0xA5）、控制帧（0xC7）区分开。
+ * 结束后发{"type":"net_test_result",...}：下行kbit/s和序号缺口由设备测，上行由服务器按收到的字节测，
+ * 服务器再和当前音频编码需要的码率比较后一起打进日志。
+ */
+
+#ifndef NET_SELF_TEST_H
+#define NET_SELF_TEST_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "websocket_client.h"
+
+class NetSelfTest {
+public:
+    static constexpr uint8_t MAGIC = 0xE7;
+    static constexpr size_t HEADER_BYTES = 10;
+    static constexpr size_t MAX_RTT_SAMPLES = 256;
+    static constexpr size_t PING_SLOTS = 64;         // 还没回来的ping最多这么多个
+
+    enum class Mode : uint8_t { WS, TCP };
+
+    struct Params {
+        Mode mode;
+        uint32_t duration_ms;
+        uint32_t size;              // 每条测试消息的字节数
+        uint16_t tcp_port;          // tcp模式连接的服务器端口
+        uint32_t need_up_kbps;      // 当前上行音频编码需要的码率，随结果上报
+        const char* wifi_profile;   // 当前的WiFi性能配置，随结果上报，方便对比不同配置
+        int dscp;                   // 测试期间用的DSCP（-1=沿用连接的），随结果上报，对比WMM标记前后的RTT
+    };
+
+    NetSelfTest(WebSocketClient* ws, const char* server_uri);
+
+    /**
+     * @brief 在后台任务里开始一次测试（已经在测时返回ESP_ERR_INVALID_STATE）
+     */
+    esp_err_t start(const Params& params);
+
+    bool isRunning() const { return running_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief WebSocket任务里收到的二进制消息片段：是测试消息时计数并返回true
+     */
+    bool onDownlink(const WebSocketClient::EventData& event);
+
+    /**
+     * @brief 收到服务器的net_test_pong（事件任务）
+     */
+    void onPong(uint32_t seq);
+
+private:
+    static void test_task(void* arg);
+    void runWebSocket();
+    void runTcp();
+    int connectTcp(char command);
+    void sendResult(uint32_t up_kbps, uint32_t down_kbps, uint32_t elapsed_ms);
+    void buildFrame(uint8_t* frame, uint32_t seq);
+    void addRtt(uint32_t rtt_ms);
+
+    static const char* TAG;
+    WebSocketClient* ws_;
+    char host_[64];
+    Params params_;
+    uint8_t dscp_;                      // 这次测试实际用的DSCP
+    std::atomic<bool> running_;
+    std::atomic<bool> receiving_;       // ws模式的窗口内，WebSocket任务才统计下行
+    bool in_test_msg_;                  // 当前这条下行消息是测试消息（只在WebSocket任务中访问）
+
+    // 下行（WebSocket任务写，测试任务读）
+    std::atomic<uint32_t> down_bytes_;
+    std::atomic<uint32_t> down_msgs_;
+    std::atomic<uint32_t> down_gaps_;
+    std::atomic<uint32_t> down_next_seq_;
+
+    // RTT（事件任务写，测试任务读）
+    portMUX_TYPE rtt_lock_;
+    int64_t ping_sent_us_[PING_SLOTS];
+    uint32_t ping_seq_[PING_SLOTS];
+    uint16_t rtt_ms_[MAX_RTT_SAMPLES];
+    size_t rtt_count_;
+    uint32_t pings_sent_;
+
+    // 上行
+    uint32_t up_dropped_;       // 发送队列满或在队列里过期丢掉的测试消息
+};
+
+#endif // NET_SELF_TEST_H
@@ -0,0 +1,388 @@
+/**
+ * @file ota_updater.cc
+ * @brief 📦 固件下载、差分还原、校验和回滚
+ */
+
+#include "ota_updater.h"
+#include "task_factory.h"
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_ota_ops.h"
+#include "esp_timer.h"
+#include "esp_app_desc.h"
+#include "esp_partition.h"
+#include "esp_http_client.h"
+#include "esp_crt_bundle.h"
+#include "buffer_placement.h"
+#include "delta_patch.h"
+#include "flash_scheduler.h"
+#include "project_config.h"
+
+static const char* TAG = "OtaUpdater";
+
+static const size_t kReadChunk = 4096;
+static const uint8_t kImageMagic = 0xE9;   // ESP应用镜像头的第一个字节
+
+/**
+ * @brief 写一块新固件（擦写Flash期间cache关闭，耗时计入FlashScheduler的停顿统计）
+ */
+static esp_err_t ota_write(esp_ota_handle_t handle, const void* data, size_t len) {
+    int64_t start_us = esp_timer_get_time();
+    esp_err_t ret = esp_ota_write(handle, data, len);
+    FlashScheduler::noteOp("ota_write", esp_timer_get_time() - start_us);
+    return ret;
+}
+
+static bool parse_sha256(const char* hex, uint8_t* out) {
+    if (!hex || strlen(hex) != 64) {
+        return false;
+    }
+    for (int i = 0; i < 32; i++) {
+        unsigned int byte = 0;
+        if (sscanf(hex + i * 2, "%2x", &byte) != 1) {
+            return false;
+        }
+        out[i] = (uint8_t)byte;
+    }
+    return true;
+}
+
+OtaUpdater::OtaUpdater()
+    : url_{}
+    , expected_sha_{}
+    , image_sha_{}
+    , pending_verify_(false)
+    , verify_timer_(nullptr)
+    , state_(State::IDLE)
+    , paused_(false)
+    , changed_(false)
+    , delta_(false)
+    , received_(0)
+    , total_(0)
+    , written_(0)
+    , reason_("")
+{
+}
+
+void OtaUpdater::init() {
+    const esp_partition_t* running = esp_ota_get_running_partition();
+    esp_ota_img_states_t state = ESP_OTA_IMG_UNDEFINED;
+    if (running && esp_ota_get_state_partition(running, &state) == ESP_OK && state == ESP_OTA_IMG_PENDING_VERIFY) {
+        pending_verify_ = true;
+        esp_timer_create_args_t args = {};
+        args.callback = verify_timeout;
+        args.arg = this;
+        args.name = "ota_verify";
+        if (esp_timer_create(&args, &verify_timer_) == ESP_OK) {
+            esp_timer_start_once(verify_timer_, (uint64_t)OTA_VERIFY_TIMEOUT_MS * 1000);
+        }
+        ESP_LOGW(TAG, "📦 新固件 %s 待验证（%s），%lu秒内没连上服务器就回滚",
+                 version(), running->label, (unsigned long)(OTA_VERIFY_TIMEOUT_MS / 1000));
+    } else {
+        ESP_LOGI(TAG, "📦 固件 %s，运行在 %s", version(), running ? running->label : "?");
+    }
+}
+
+void OtaUpdater::confirm() {
+    if (!pending_verify_) {
+        return;
+    }
+    if (verify_timer_) {
+        esp_timer_stop(verify_timer_);
+    }
+    int64_t start_us = esp_timer_get_time();
+    esp_err_t ret = esp_ota_mark_app_valid_cancel_rollback();
+    FlashScheduler::noteOp("ota_confirm", esp_timer_get_time() - start_us);
+    if (ret == ESP_OK) {
+        pending_verify_ = false;
+        ESP_LOGI(TAG, "✓ 新固件 %s 已确认，取消回滚", version());
+    } else {
+        ESP_LOGE(TAG, "❌ 确认新固件失败: %s", esp_err_to_name(ret));
+    }
+}
+
+void OtaUpdater::verify_timeout(void* arg) {
+    ESP_LOGE(TAG, "❌ 新固件验证超时，回滚到上一个固件");
+    esp_ota_mark_app_invalid_rollback_and_reboot();
+}
+
+esp_err_t OtaUpdater::rollback() {
+    if (!esp_ota_check_rollback_is_possible()) {
+        ESP_LOGW(TAG, "⚠️ 另一个分区里没有可用的固件，无法回滚");
+        return ESP_ERR_NOT_FOUND;
+    }
+    ESP_LOGW(TAG, "⏪ 服务器要求回滚到上一个固件");
+    return esp_ota_mark_app_invalid_rollback_and_reboot();     // 成功时不返回
+}
+
+const char* OtaUpdater::version() const {
+    return esp_app_get_description()->version;
+}
+
+const char* OtaUpdater::imageSha() {
+    if (image_sha_[0] == '\0') {
+        uint8_t sha[32];
+        const esp_partition_t* running = esp_ota_get_running_partition();
+        if (running && esp_partition_get_sha256(running, sha) == ESP_OK) {
+            for (int i = 0; i < 8; i++) {
+                snprintf(image_sha_ + i * 2, 3, "%02x", sha[i]);
+            }
+        }
+    }
+    return image_sha_;
+}
+
+void OtaUpdater::seedImageSha(const char* sha) {
+    if (sha && strlen(sha) == sizeof(image_sha_) - 1) {
+        memcpy(image_sha_, sha, sizeof(image_sha_));
+    }
+}
+
+bool OtaUpdater::start(const char* url, const char* sha256_hex) {
+    State state = state_.load();
+    if (state == State::DOWNLOADING || state == State::READY) {
+        ESP_LOGW(TAG, "⚠️ 已经在升级，忽略新的升级请求");
+        return false;
+    }
+    if (!url || strlen(url) >= URL_LEN || !parse_sha256(sha256_hex, expected_sha_)) {
+        ESP_LOGW(TAG, "⚠️ 升级请求的地址或SHA-256不对，忽略");
+        return false;
+    }
+    snprintf(url_, sizeof(url_), "%s", url);
+    received_ = 0;
+    total_ = 0;
+    written_ = 0;
+    delta_ = false;
+    publish(State::DOWNLOADING);
+    // 写Flash的任务栈必须在内部RAM（cache关闭期间还要运行）
+    if (TaskFactory::create(ota_task, "ota_task", OTA_TASK_STACK, this,
+                            OTA_TASK_PRIORITY, NULL, OTA_TASK_CORE, TaskStack::INTERNAL) != pdPASS) {
+        fail("no_task");
+        return false;
+    }
+    return true;
+}
+
+bool OtaUpdater::takeStatus(Status* out) {
+    if (!changed_.exchange(false)) {
+        return false;
+    }
+    out->state = state_.load();
+    out->delta = delta_.load();
+    out->received = received_.load();
+    out->total = total_.load();
+    out->written = written_.load();
+    out->reason = reason_.load();
+    return true;
+}
+
+const char* OtaUpdater::stateName(State state) {
+    switch (state) {
+        case State::IDLE: return "idle";
+        case State::DOWNLOADING: return "downloading";
+        case State::READY: return "ready";
+        case State::FAILED: return "failed";
+    }
+    return "?";
+}
+
+void OtaUpdater::publish(State state) {
+    if (state != State::FAILED) {
+        reason_ = "";
+    }
+    state_ = state;
+    changed_ = true;
+}
+
+void OtaUpdater::fail(const char* reason) {
+    reason_ = reason;
+    publish(State::FAILED);
+    ESP_LOGE(TAG, "❌ 升级失败: %s", reason);
+}
+
+void OtaUpdater::ota_task(void* arg) {
+    OtaUpdater* self = (OtaUpdater*)arg;
+    int64_t start_us = esp_timer_get_time();
+    if (self->run() == ESP_OK) {
+        ESP_LOGI(TAG, "✅ 新固件已写入（%s，下载 %lu 字节，用时 %lu ms），空闲时重启",
+                 self->delta_ ? "差分补丁" : "完整镜像", (unsigned long)self->received_.load(),
+                 (unsigned long)((esp_timer_get_time() - start_us) / 1000));
+        self->publish(State::READY);
+    }
+    vTaskDelete(NULL);
+}
+
+esp_err_t OtaUpdater::run() {
+    const esp_partition_t* running = esp_ota_get_running_partition();
+    const esp_partition_t* update = esp_ota_get_next_update_partition(nullptr);
+    if (!running || !update) {
+        fail("no_ota_partition");
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    esp_http_client_config_t config = {};
+    config.url = url_;
+    config.timeout_ms = OTA_HTTP_TIMEOUT_MS;
+    config.crt_bundle_attach = esp_crt_bundle_attach;
+    config.buffer_size = kReadChunk;
+    esp_http_client_handle_t client = esp_http_client_init(&config);
+    uint8_t* buffer = (uint8_t*)BufferPlacement::alloc("ota_read", kReadChunk, Placement::INTERNAL);
+    if (!client || !buffer) {
+        if (client) {
+            esp_http_client_cleanup(client);
+        }
+        BufferPlacement::free(buffer);
+        fail("no_mem");
+        return ESP_ERR_NO_MEM;
+    }
+
+    esp_err_t ret = esp_http_client_open(client, 0);
+    int64_t length = ret == ESP_OK ? esp_http_client_fetch_headers(client) : -1;
+    int http_status = ret == ESP_OK ? esp_http_client_get_status_code(client) : 0;
+    esp_ota_handle_t handle = 0;
+    bool ota_begun = false;
+    DeltaPatch* patch = nullptr;
+    const char* reason = nullptr;
+    uint32_t next_report = 0;
+
+    // 读满第一段：补丁头或镜像头
+    size_t head = 0;
+    if (ret != ESP_OK || http_status != 200) {
+        ESP_LOGE(TAG, "❌ 下载失败: %s, HTTP %d", esp_err_to_name(ret), http_status);
+        reason = "http";
+    } else {
+        total_ = length > 0 ? (uint32_t)length : 0;
+        while (head < DeltaPatch::HEADER_SIZE) {
+            int n = esp_http_client_read(client, (char*)buffer + head, kReadChunk - head);
+            if (n <= 0) {
+                break;
+            }
+            head += n;
+        }
+        received_ = head;
+    }
+
+    DeltaPatch::Header header = {};
+    if (!reason) {
+        esp_err_t parsed = DeltaPatch::parseHeader(buffer, head, &header);
+        if (parsed == ESP_OK) {
+            uint8_t running_sha[32];
+            delta_ = true;
+            if (esp_partition_get_sha256(running, running_sha) != ESP_OK ||
+                memcmp(running_sha, header.old_sha256, sizeof(running_sha)) != 0) {
+                reason = "base_mismatch";     // 补丁不是基于当前固件生成的
+            } else if (memcmp(header.new_sha256, expected_sha_, sizeof(expected_sha_)) != 0) {
+                reason = "sha_mismatch";
+            } else if (header.new_size > update->size) {
+                reason = "too_large";
+            }
+        } else if (head == 0 || buffer[0] != kImageMagic) {
+            reason = "bad_image";
+        } else if (total_ > update->size) {
+            reason = "too_large";
+        }
+    }
+
+    if (!reason) {
+        ret = esp_ota_begin(update, OTA_WITH_SEQUENTIAL_WRITES, &handle);     // 边写边擦，避免一次擦几MB
+        ota_begun = ret == ESP_OK;
+        if (!ota_begun) {
+            ESP_LOGE(TAG, "❌ esp_ota_begin失败: %s", esp_err_to_name(ret));
+            reason = "ota_begin";
+        }
+    }
+    if (!reason) {
+        ESP_LOGI(TAG, "📦 开始升级: %s -> %s（%s, %lu 字节）", running->label, update->label,
+                 delta_ ? "差分补丁" : "完整镜像", (unsigned long)total_.load());
+        if (delta_) {
+            patch = new DeltaPatch(
+                [running](size_t offset, uint8_t* out, size_t len) {
+                    return esp_partition_read(running, offset, out, len);
+                },
+                [this, handle](const uint8_t* data, size_t len) {
+                    written_ += len;
+                    return ota_write(handle, data, len);
+                });
+            ret = patch->begin(header);
+            if (ret == ESP_OK) {
+                ret = patch->feed(buffer + DeltaPatch::HEADER_SIZE, head - DeltaPatch::HEADER_SIZE);
+            }
+        } else {
+            ret = ota_write(handle, buffer, head);
+            written_ = head;
+        }
+        if (ret != ESP_OK) {
+            reason = "write";
+        }
+    }
+
+    // 剩下的部分：会话期间暂停读取（服务器端连接空闲到超时就算失败，下次再来）
+    while (!reason) {
+        while (paused_.load()) {
+            vTaskDelay(pdMS_TO_TICKS(100));
+        }
+        int n = esp_http_client_read(client, (char*)buffer, kReadChunk);
+        if (n < 0) {
+            reason = "http";
+            break;
+        }
+        if (n == 0) {
+            if (!esp_http_client_is_complete_data_received(client)) {
+                reason = "truncated";
+            }
+            break;
+        }
+        received_ += n;
+        if (patch) {
+            ret = patch->feed(buffer, n);
+        } else {
+            ret = ota_write(handle, buffer, n);
+            written_ += n;
+        }
+        if (ret != ESP_OK) {
+            reason = "write";
+            break;
+        }
+        if (total_ > 0 && received_ * 4ULL >= (uint64_t)total_ * (next_report + 1)) {
+            next_report = received_ * 4ULL / total_;
+            changed_ = true;    // 每完成约25%上报一次进度
+        }
+    }
+    if (!reason && patch && !patch->done()) {
+        reason = "patch_incomplete";
+    }
+    delete patch;
+    esp_http_client_close(client);
+    esp_http_client_cleanup(client);
+    BufferPlacement::free(buffer);
+
+    if (!reason) {
+        ota_begun = false;
+        ret = esp_ota_end(handle);         // 校验镜像格式和镜像自带的哈希
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "❌ 新固件校验失败: %s", esp_err_to_name(ret));
+            reason = "verify";
+        }
+    }
+    if (!reason) {
+        uint8_t sha[32];
+        if (esp_partition_get_sha256(update, sha) != ESP_OK || memcmp(sha, expected_sha_, sizeof(sha)) != 0) {
+            reason = "sha_mismatch";
+        } else if ((ret = esp_ota_set_boot_partition(update)) != ESP_OK) {
+            ESP_LOGE(TAG, "❌ 设置启动分区失败: %s", esp_err_to_name(ret));
+            reason = "set_boot";
+        }
+    }
+    if (ota_begun) {
+        esp_ota_abort(handle);
+    }
+    if (reason) {
+        fail(reason);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,136 @@
+/**
+ * @file ota_updater.h
+ * @brief 📦 固件升级 - 按服务器下发的地址用HTTP下载差分补丁或完整镜像，写进另一个OTA分区，重启后验证
+ *
+ * 分区表里有ota_0/ota_1两个应用分区（见partitions.csv），新固件总是写进没在运行的那个：
+ * - 差分补丁（见delta_patch.h）：从正在运行的分区读旧固件，边下载边还原，下载量通常只有完整镜像的几分之一；
+ *   补丁头里的旧固件SHA-256和正在运行的不一致时放弃（服务器改发完整镜像）
+ * - 完整镜像：不是补丁格式时按普通OTA镜像直接写入
+ *
+ * 写完由esp_ota_end()校验镜像，再核对服务器给的SHA-256，都通过才切换启动分区，空闲时重启。
+ * 新固件第一次启动处于待验证状态（CONFIG_BOOTLOADER_APP_ROLLBACK_ENABLE）：
+ * 和服务器完成hello后confirm()标记为有效；OTA_VERIFY_TIMEOUT_MS内没做到，或者启动过程中崩溃重启，
+ * 引导程序回到旧固件。服务器也可以发{"type":"ota","action":"rollback"}主动退回上一个固件。
+ *
+ * 会话进行中setPaused(true)，下载任务暂停读取，避免Flash擦写在对话时打断音频。
+ */
+
+#ifndef OTA_UPDATER_H
+#define OTA_UPDATER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include "esp_err.h"
+#include "esp_timer.h"
+
+class OtaUpdater {
+public:
+    static constexpr size_t URL_LEN = 256;
+
+    enum class State : uint8_t {
+        IDLE,           // 没有升级任务
+        DOWNLOADING,    // 正在下载并写入
+        READY,          // 新固件已写好并设为启动分区，等空闲时重启
+        FAILED,         // 这次升级失败，当前固件不受影响
+    };
+
+    struct Status {
+        State state;
+        bool delta;             // 差分补丁（false=完整镜像）
+        uint32_t received;      // 已下载字节
+        uint32_t total;         // 下载总字节（服务器没给Content-Length时为0）
+        uint32_t written;       // 已写入新分区的字节
+        const char* reason;     // 失败原因（静态字符串），其余状态为""
+    };
+
+    OtaUpdater();
+
+    /**
+     * @brief 启动时调用：新固件处于待验证状态时开始回滚计时
+     */
+    void init();
+
+    /**
+     * @brief 当前固件是否还在等待验证
+     */
+    bool pendingVerify() const { return pending_verify_; }
+
+    /**
+     * @brief 当前固件工作正常（已和服务器完成hello），取消回滚
+     */
+    void confirm();
+
+    /**
+     * @brief 退回上一个固件并重启（上一个分区里没有有效固件时返回错误）
+     */
+    esp_err_t rollback();
+
+    /**
+     * @brief 正在运行的固件版本号（esp_app_desc_t::version）
+     */
+    const char* version() const;
+
+    /**
+     * @brief 正在运行的固件镜像SHA-256的前16个十六进制字符（和tools/make_delta.py的manifest一致）
+     *
+     * 第一次调用时按整个镜像计算（约1MB，几十毫秒），在网络任务里调用。
+     */
+    const char* imageSha();
+
+    /**
+     * @brief 🌙 用上次算好的镜像哈希（深度睡眠醒来、固件没变时），imageSha()不再读整个镜像
+     */
+    void seedImageSha(const char* sha);
+
+    /**
+     * @brief 开始升级（在独立任务中下载）
+     *
+     * @param url 补丁或镜像的HTTP(S)地址
+     * @param sha256_hex 新固件镜像的SHA-256（64个十六进制字符）
+     * @return 已经在升级、已有待重启的新固件或参数不对时返回false
+     */
+    bool start(const char* url, const char* sha256_hex);
+
+    /**
+     * @brief 会话期间暂停下载（主循环调用）
+     */
+    void setPaused(bool paused) { paused_ = paused; }
+
+    /**
+     * @brief 正在下载新固件（这时不能进深度睡眠）
+     */
+    bool isDownloading() const { return state_.load() == State::DOWNLOADING; }
+
+    /**
+     * @brief 取出变化了的状态（开始、每完成约25%、结束各一次），没有变化时返回false
+     *
+     * 取到READY后新固件已设为启动分区，调用方在空闲时重启。
+     */
+    bool takeStatus(Status* out);
+
+    static const char* stateName(State state);
+
+private:
+    static void ota_task(void* arg);
+    static void verify_timeout(void* arg);
+    esp_err_t run();
+    void fail(const char* reason);
+    void publish(State state);
+
+    char url_[URL_LEN];
+    uint8_t expected_sha_[32];
+    char image_sha_[17];
+    bool pending_verify_;
+    esp_timer_handle_t verify_timer_;
+    std::atomic<State> state_;
+    std::atomic<bool> paused_;
+    std::atomic<bool> changed_;
+    std::atomic<bool> delta_;
+    std::atomic<uint32_t> received_;
+    std::atomic<uint32_t> total_;
+    std::atomic<uint32_t> written_;
+    std::atomic<const char*> reason_;
+};
+
+#endif // OTA_UPDATER_H
@@ -0,0 +1,184 @@
+/**
+ * @file perf_counters.cc
+ * @brief 📈 性能计数器汇总
+ */
+
+#include "perf_counters.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "heap_monitor.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "sdkconfig.h"
+#include "project_config.h"
+
+static const char* TAG = "PerfCounters";
+
+// 增减计数器时同步修改server/server.py的STATS_FIELDS（二进制STATS不带键名）
+static const char* const kCounterNames[] = {
+    "cap", "cap_ovr", "up_frames", "up_pool_drop", "up_queue_drop", "up_msgs", "up_bytes",
+    "down_bytes", "underruns", "jb_drop", "i2s_writes", "i2s_us",
+    "local_hits", "local_misses", "comfort", "down_lost", "down_late", "plc", "stretch",
+    "tls_full", "tls_full_ms", "tls_resumed", "tls_resumed_ms",
+    "follow_ups", "session_timeouts", "up_replay", "up_backlog_drop",
+    "server_busy", "ws_full", "ws_stale", "drift_ins", "drift_del",
+    "i2s_partial", "i2s_preload", "prompt_flash", "wake_rejects",
+    "i2s_le5ms", "i2s_le25ms", "i2s_le100ms", "i2s_slow", "i2s_stalls", "i2s_lock_to",
+    "i2s_dma_under",
+    "wake_gated", "wake_lost", "warm_restarts", "cap_gap", "cap_ring_drop", "duplex_muted",
+    "up_rate_down", "up_rate_up", "flash_ops", "flash_us", "flash_live", "flash_deferred",
+    "udp_up", "udp_down", "udp_down_lost", "udp_fec", "udp_fallback", "relay_failover",
+    "reply_waits", "thinking", "play_direct", "play_mixed", "rtf_down", "rtf_up",
+    "upload_bytes", "upload_deferred", "log_deferred", "log_drop",
+};
+static const char* const kGaugeNames[] = {
+    "send_q_max", "jb_max", "i2s_max_us", "ws_q_max", "ws_wait_max", "amp_wake_max_us", "drain_max_us",
+    "abort_max_us", "afe_backlog_max", "afe_cb_max_us", "flash_max_us", "rtf_max",
+};
+static_assert(sizeof(kCounterNames) / sizeof(kCounterNames[0]) == (size_t)PerfCounter::COUNT, "计数器名称不全");
+static_assert(sizeof(kGaugeNames) / sizeof(kGaugeNames[0]) == (size_t)PerfGauge::COUNT, "水位名称不全");
+
+/**
+ * @brief 追加格式化内容，空间不够时把pos置为size
+ */
+static void append(char* buf, size_t size, size_t* pos, const char* fmt, ...) __attribute__((format(printf, 4, 5)));
+static void append(char* buf, size_t size, size_t* pos, const char* fmt, ...) {
+    if (*pos >= size) {
+        return;
+    }
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buf + *pos, size - *pos, fmt, args);
+    va_end(args);
+    *pos = (n < 0 || (size_t)n >= size - *pos) ? size : *pos + n;
+}
+
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+/**
+ * @brief 各任务在两次汇总之间的CPU占用（千分比，双核总量为2000）和每个核心的占用
+ *
+ * 核心占用 = 1000 - 该核心空闲任务的占用，超过CPU_LOAD_WARN_PERMILLE时告警：
+ * 任务拓扑（project_config.h）分配不均时，先饿死的是同一核心上优先级最低的任务。
+ */
+static void append_task_load(char* buf, size_t size, size_t* pos) {
+    static constexpr UBaseType_t kMaxTasks = 32;
+    struct Sample { UBaseType_t number; uint64_t runtime; };
+    static Sample last[kMaxTasks];
+    static UBaseType_t last_count = 0;
+    static uint64_t last_total = 0;
+
+    TaskStatus_t* tasks = (TaskStatus_t*)malloc(sizeof(TaskStatus_t) * kMaxTasks);
+    if (!tasks) {
+        return;
+    }
+    uint32_t total_runtime = 0;
+    UBaseType_t count = uxTaskGetSystemState(tasks, kMaxTasks, &total_runtime);
+    uint64_t total = total_runtime;
+    uint64_t elapsed = total > last_total ? total - last_total : 0;
+
+    uint32_t idle[portNUM_PROCESSORS] = {};
+    append(buf, size, pos, ",\"tasks\":{");
+    bool first = true;
+    for (UBaseType_t i = 0; i < count; i++) {
+        uint64_t runtime = tasks[i].ulRunTimeCounter;
+        uint64_t previous = 0;
+        for (UBaseType_t j = 0; j < last_count; j++) {
+            if (last[j].number == tasks[i].xTaskNumber) {
+                previous = last[j].runtime;
+                break;
+            }
+        }
+        uint32_t permille = elapsed > 0 && runtime >= previous ? (uint32_t)((runtime - previous) * 1000 / elapsed) : 0;
+        for (int core = 0; core < portNUM_PROCESSORS; core++) {
+            if (tasks[i].xHandle == xTaskGetIdleTaskHandleForCore(core)) {
+                idle[core] = permille;
+            }
+        }
+        if (permille > 0) {
+            append(buf, size, pos, "%s\"%s\":%lu", first ? "" : ",", tasks[i].pcTaskName, (unsigned long)permille);
+            first = false;
+        }
+    }
+    append(buf, size, pos, "}");
+
+    if (elapsed > 0) {
+        append(buf, size, pos, ",\"cpu\":[");
+        for (int core = 0; core < portNUM_PROCESSORS; core++) {
+            uint32_t load = idle[core] < 1000 ? 1000 - idle[core] : 0;
+            append(buf, size, pos, "%s%lu", core == 0 ? "" : ",", (unsigned long)load);
+            if (load > CPU_LOAD_WARN_PERMILLE) {
+                ESP_LOGW(TAG, "⚠️ 核心%d占用%lu‰，检查project_config.h中的任务拓扑", core, (unsigned long)load);
+            }
+        }
+        append(buf, size, pos, "]");
+    }
+
+    last_count = count;
+    for (UBaseType_t i = 0; i < count; i++) {
+        last[i] = { tasks[i].xTaskNumber, (uint64_t)tasks[i].ulRunTimeCounter };
+    }
+    last_total = total;
+    free(tasks);
+}
+#endif
+
+size_t PerfCounters::formatJson(char* buf, size_t size) {
+    size_t pos = 0;
+    append(buf, size, &pos, "{\"type\":\"stats\",\"uptime_s\":%lld", esp_timer_get_time() / 1000000);
+    for (size_t i = 0; i < (size_t)PerfCounter::COUNT; i++) {
+        append(buf, size, &pos, ",\"%s\":%lu", kCounterNames[i], (unsigned long)get((PerfCounter)i));
+    }
+    for (size_t i = 0; i < (size_t)PerfGauge::COUNT; i++) {
+        append(buf, size, &pos, ",\"%s\":%lu", kGaugeNames[i], (unsigned long)get((PerfGauge)i));
+    }
+    append(buf, size, &pos, ",\"heap_min\":%u,\"heap_free\":%u,\"psram_min\":%u",
+           (unsigned)heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL),
+           (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+           (unsigned)heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM));
+    HeapMonitor::Sample internal = HeapMonitor::get(HeapRegion::INTERNAL);
+    HeapMonitor::Sample psram = HeapMonitor::get(HeapRegion::PSRAM);
+    append(buf, size, &pos, ",\"heap_largest\":%lu,\"heap_largest_min\":%lu,\"psram_free\":%lu,\"psram_largest\":%lu"
+           ",\"allocs_s\":%lu,\"psram_allocs_s\":%lu,\"alloc_fail\":%lu,\"late_allocs\":%lu",
+           (unsigned long)internal.largest_block, (unsigned long)internal.min_largest,
+           (unsigned long)psram.free_bytes, (unsigned long)psram.largest_block,
+           (unsigned long)internal.allocs_per_s, (unsigned long)psram.allocs_per_s,
+           (unsigned long)HeapMonitor::failedAllocs(), (unsigned long)HeapMonitor::lateAllocs());
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    append_task_load(buf, size, &pos);
+#endif
+    append(buf, size, &pos, "}");
+    return pos < size ? pos : 0;
+}
+
+size_t PerfCounters::formatBinary(uint32_t* out, size_t max) {
+    const size_t count = 1 + (size_t)PerfCounter::COUNT + (size_t)PerfGauge::COUNT + 3 + 8;
+    if (max < count) {
+        return 0;
+    }
+    size_t n = 0;
+    out[n++] = (uint32_t)(esp_timer_get_time() / 1000000);
+    for (size_t i = 0; i < (size_t)PerfCounter::COUNT; i++) {
+        out[n++] = get((PerfCounter)i);
+    }
+    for (size_t i = 0; i < (size_t)PerfGauge::COUNT; i++) {
+        out[n++] = get((PerfGauge)i);
+    }
+    out[n++] = (uint32_t)heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL);
+    out[n++] = (uint32_t)heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    out[n++] = (uint32_t)heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM);
+    HeapMonitor::Sample internal = HeapMonitor::get(HeapRegion::INTERNAL);
+    HeapMonitor::Sample psram = HeapMonitor::get(HeapRegion::PSRAM);
+    out[n++] = internal.largest_block;
+    out[n++] = internal.min_largest;
+    out[n++] = psram.free_bytes;
+    out[n++] = psram.largest_block;
+    out[n++] = internal.allocs_per_s;
+    out[n++] = psram.allocs_per_s;
+    out[n++] = HeapMonitor::failedAllocs();
+    out[n++] = HeapMonitor::lateAllocs();
+    return n;
+}
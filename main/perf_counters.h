@@ -0,0 +1,159 @@
+/**
+ * @file perf_counters.h
+ * @brief 📈 性能计数器 - 热路径只做一次原子加，需要时再汇总成一条紧凑的JSON
+ *
+ * 丢帧、欠载这类事件原来每次都打一行ESP_LOGW，日志本身就占CPU和串口时间，
+ * 事后也很难看出总量。这里改成固定的计数器表：
+ * - 计数器（PerfCounter）：单调递增，add()是一次relaxed原子加，可以在任意任务中调用
+ * - 水位（PerfGauge）：记录最大值，noteMax()只在超过历史值时才写
+ *
+ * formatJson()额外汇总内部RAM/PSRAM的历史最低空闲、最大连续块和分配速率（见heap_monitor.h）、各任务和每个核心的CPU占用
+ * （需要CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS，按两次汇总之间的增量计算）。
+ * 主循环每PERF_REPORT_INTERVAL_MS发给服务器一次，服务器发{"type":"get_stats"}时立即发送。
+ * 协商了二进制控制帧时定时上报改用formatBinary()，get_stats仍回复完整的JSON。
+ */
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+/**
+ * @brief 计数器（JSON里的键名见perf_counters.cc）
+ */
+enum class PerfCounter : uint8_t {
+    CAPTURE_BLOCKS = 0,     // 处理的I2S采集块
+    CAPTURE_OVERRUNS,       // 采集任务来不及处理、被DMA覆盖的块
+    UPLINK_FRAMES,          // 进入发送队列的上行帧
+    UPLINK_POOL_DROPS,      // 帧池耗尽丢弃的帧
+    UPLINK_QUEUE_DROPS,     // 发送队列满丢弃的帧
+    UPLINK_MESSAGES,        // 实际发出的上行消息（合包后）
+    UPLINK_BYTES,
+    DOWNLINK_BYTES,
+    JITTER_UNDERRUNS,       // 播放欠载次数
+    JITTER_DROPPED_SAMPLES, // 抖动缓冲区满丢弃的样本
+    I2S_WRITES,
+    I2S_WRITE_US,           // 写I2S累计阻塞时间
+    LOCAL_COMMAND_HITS,     // 唤醒后在设备上处理掉的命令词
+    LOCAL_COMMAND_MISSES,   // 没有命中、转交云端的唤醒
+    COMFORT_NOISE_CHUNKS,   // 回复静音段换成舒适噪声的播放块
+    DOWNLINK_LOST_MESSAGES, // 下行帧头seq跳过的消息（见audio_framing.h）
+    DOWNLINK_LATE_MESSAGES, // 迟到或重复、整条丢弃的下行消息
+    PLC_SAMPLES,            // 下行缺口用丢包补偿填上的样本
+    PLAYOUT_STRETCH_SAMPLES,    // 缓冲低于目标时在静音段插入的舒适噪声样本
+    TLS_FULL_HANDSHAKES,    // wss://完整握手次数（见tls_transport.h）
+    TLS_FULL_MS,            // 完整握手累计耗时
+    TLS_RESUMED_HANDSHAKES, // 复用会话的握手次数
+    TLS_RESUMED_MS,         // 复用会话的握手累计耗时
+    FOLLOW_UP_TURNS,        // 追问窗口内直接开口、没有重新唤醒的轮次（见conversation_session.h）
+    SESSION_TIMEOUTS,       // 没人说话超时结束、释放了豆包会话的次数
+    UPLINK_REPLAYED_FRAMES, // 连接就绪后从存储转发缓冲区补发的帧（见uplink_backlog.h）
+    UPLINK_BACKLOG_DROPS,   // 断开太久、存储转发缓冲区写满挤掉的帧
+    SERVER_BUSY,            // 服务器上游满载、回复busy的次数
+    WS_SEND_FULL_DROPS,     // WebSocket发送队列满、入队失败的消息（见websocket_client.h）
+    WS_SEND_STALE_DROPS,    // 上行音频在发送队列里过期丢弃的消息
+    PLAYOUT_DRIFT_INSERTED, // 时钟漂移补偿多插出来的样本（服务器时钟比I2S慢，见playout_drift.h）
+    PLAYOUT_DRIFT_REMOVED,  // 时钟漂移补偿少播的样本（服务器时钟比I2S快）
+    I2S_PARTIAL_WRITES,     // 超时、只写进去一部分的播放块（见AudioManager::write_playback）
+    I2S_PRELOAD_BYTES,      // 通道启用前预加载进DMA的字节（切换格式后的第一块）
+    PROMPT_FLASH_BYTES,     // 提示音按块从Flash拷进内部RAM的字节（见FlashStream）
+    WAKE_VERIFY_REJECTS,    // 服务器复核唤醒词没通过、取消的唤醒（误唤醒）
+    I2S_WRITE_LE_5MS,       // 写一块I2S的阻塞时间分布：≤5ms（DMA有空位）
+    I2S_WRITE_LE_25MS,      // ≤25ms（正常等一个描述符播完）
+    I2S_WRITE_LE_100MS,     // ≤100ms（播放任务被抢占或DMA变慢）
+    I2S_WRITE_SLOW,         // 超过100ms（接近I2S_SINK_WRITE_TIMEOUT_MS）
+    I2S_WRITE_STALLS,       // 写一块时连续I2S_SINK_STALL_MS没有任何进展（DMA卡住）
+    I2S_LOCK_TIMEOUTS,      // 写入时等播放输出的锁超时（打断/切换格式正占着）
+    I2S_DMA_UNDERRUNS,      // 写入期间DMA把描述符送空、开始输出auto_clear的静音（播放任务没跟上）
+    WAKE_GATED_BLOCKS,      // 空闲时能量门关着、WakeNet没有跑的AFE块
+    WAKE_ARBITRATION_LOSSES,    // 同一房间另一台设备离得更近、服务器让这台放弃的唤醒
+    WARM_RESTARTS,      // 子系统看门狗重建了卡住的I2S通道或WebSocket连接（见supervisor.h）
+    CAPTURE_GAPS,       // 接收中断来晚了、DMA已经写过去的采集块（按中断间隔推算，和CAPTURE_OVERRUNS互不重叠）
+    CAPTURE_RING_DROPS, // 录音任务跟不上、采集缓冲区满了丢掉的样本
+    DUPLEX_MUTED_BLOCKS,    // 半双工：播放回复期间没有上传的AFE块（见HALF_DUPLEX_MODE）
+    UPLINK_RATE_DOWN,   // 上行码率自适应降档（见uplink_rate_controller.h）
+    UPLINK_RATE_UP,     // 上行码率自适应升档
+    FLASH_OPS,          // 写Flash的次数（NVS提交、OTA写入等，见flash_scheduler.h）
+    FLASH_STALL_US,     // 写Flash累计耗时（期间cache关闭，不在IRAM里的任务都停住）
+    FLASH_LIVE_OPS,     // 不在空闲时（会话中、播放中）写Flash的次数
+    FLASH_DEFERRED,     // 推迟到空闲时再写的次数
+    UDP_UP_MESSAGES,    // 走UDP发出的上行音频消息（见udp_audio.h）
+    UDP_DOWN_MESSAGES,  // 从UDP收到的下行音频消息（含副本补回的）
+    UDP_DOWN_LOST,      // 按序号算出的下行UDP丢失消息（副本也没补回）
+    UDP_FEC_RECOVERED,  // 主数据报丢了、由下一个数据报里的副本补回的下行消息
+    UDP_FALLBACKS,      // 丢失太多、没有报告或探测不通，退回WebSocket的次数（每个方向各算一次）
+    RELAY_FAILOVERS,    // 连不上当前中继、立即换下一个候选的次数（见relay_selector.h）
+    REPLY_WAITS,        // 说完后开始等回复的轮次（见thinking_filler.h）
+    THINKING_EARCONS,   // 其中第一条下行音频慢到播了"思考中"提示音的轮次
+    PLAY_DIRECT_BYTES,  // 回复语音从抖动缓冲区原地交给I2S驱动的字节（CPU没有再拷贝，见AudioManager::output_chunk）
+    PLAY_MIXED_BYTES,   // 经过混音器、补偿或重采样缓冲区才交给I2S驱动的播放字节
+    RTF_DEGRADES,       // 上行处理持续超出帧时长、降一级的次数（见rtf_guard.h）
+    RTF_RESTORES,       // 压力消失后恢复一级的次数
+    UPLOAD_BYTES,       // 经后台上传调度发出的维护消息字节（见upload_scheduler.h）
+    UPLOAD_DEFERRALS,   // 维护上传因为限速、会话或唤醒暂停被推迟的次数
+    LOG_DEFERRED,       // 经延迟日志环输出的热路径日志（见deferred_log.h）
+    LOG_DROPS,          // 延迟日志环满丢掉的日志
+    COUNT
+};
+
+/**
+ * @brief 水位（只记录最大值）
+ */
+enum class PerfGauge : uint8_t {
+    SEND_QUEUE_DEPTH = 0,   // 上行发送队列最大深度
+    JITTER_FILL,            // 抖动缓冲区最高水位（样本）
+    I2S_WRITE_MAX_US,       // 单次写I2S最长阻塞时间
+    WS_SEND_QUEUE_DEPTH,    // WebSocket发送队列（单个通道）最大深度
+    WS_SEND_WAIT_MAX_MS,    // 消息在WebSocket发送队列里的最长等待
+    AMP_WAKE_MAX_US,        // 播放输出冷启动（启用通道 + 等功放稳定）的最长耗时
+    I2S_DRAIN_MAX_US,       // 回复结束时等DMA里的尾巴播完的最长耗时
+    I2S_ABORT_MAX_US,       // 打断时清空DMA（禁用、预加载淡出、重新启用）的最长耗时
+    AFE_BACKLOG_MAX_PCT,    // AFE feed→fetch缓冲区的最高占用（%），持续上涨说明fetch任务（WakeNet）跟不上采集
+    AFE_CALLBACK_MAX_US,    // fetch任务里唤醒/音频回调处理一块的最长耗时（占掉下一块检测的时间）
+    FLASH_STALL_MAX_US,     // 单次写Flash的最长耗时
+    RTF_MAX_PERMILLE,       // 上行处理时间占音频时长的最高窗口值（‰，见rtf_guard.h）
+    COUNT
+};
+
+class PerfCounters {
+public:
+    static void add(PerfCounter counter, uint32_t n = 1) {
+        counters_[(size_t)counter].fetch_add(n, std::memory_order_relaxed);
+    }
+
+    static void noteMax(PerfGauge gauge, uint32_t value) {
+        std::atomic<uint32_t>& slot = gauges_[(size_t)gauge];
+        uint32_t current = slot.load(std::memory_order_relaxed);
+        while (value > current && !slot.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    static uint32_t get(PerfCounter counter) { return counters_[(size_t)counter].load(std::memory_order_relaxed); }
+    static uint32_t get(PerfGauge gauge) { return gauges_[(size_t)gauge].load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 汇总成{"type":"stats",...}（只在主任务中调用，任务占用按上次调用以来的增量计算）
+     *
+     * @return 写入的字符数（不含结尾'\0'），缓冲区不够时返回0
+     */
+    static size_t formatJson(char* buf, size_t size);
+
+    /**
+     * @brief 汇总成二进制控制帧STATS的负载（见control_protocol.h），不含任务CPU占用
+     *
+     * u32数组：uptime_s、各计数器、各水位、heap_min、heap_free、psram_min，
+     * 然后是堆监控的heap_largest、heap_largest_min、psram_free、psram_largest、allocs_s、psram_allocs_s、alloc_fail，
+     * 顺序和server.py的STATS_FIELDS一致（增减计数器时两边一起改）
+     *
+     * @return 写入的个数，空间不够时返回0
+     */
+    static size_t formatBinary(uint32_t* out, size_t max);
+
+private:
+    static inline std::atomic<uint32_t> counters_[(size_t)PerfCounter::COUNT] = {};
+    static inline std::atomic<uint32_t> gauges_[(size_t)PerfGauge::COUNT] = {};
+};
+
+#endif // PERF_COUNTERS_H
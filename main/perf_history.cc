@@ -0,0 +1,184 @@
+/**
+ * @file perf_history.cc
+ * @brief 🗄️ 跨重启的性能累计实现
+ */
+
+#include "perf_history.h"
+#include <stdio.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "flash_scheduler.h"
+#include "nvs.h"
+#include "perf_counters.h"
+#include "project_config.h"
+
+const char* PerfHistory::TAG = "PerfHistory";
+
+static const char* NVS_NAMESPACE = "perf";
+static const char* NVS_KEY = "history";
+static const uint32_t kMagic = 0x50484931;  // "PHI1"，Totals的布局变了就换一个
+
+/**
+ * @brief NVS里的blob
+ */
+struct StoredHistory {
+    uint32_t magic;
+    PerfHistory::Totals totals;
+    PerfHistory::Totals reported;
+};
+
+PerfHistory::PerfHistory()
+    : base_{}
+    , saved_{}
+    , reported_{}
+    , saved_reported_{}
+    , initialized_(false)
+    , last_save_us_(0)
+    , run_resets_panic_(0)
+    , run_resets_brownout_(0)
+    , sessions_(0)
+    , connects_(0)
+{
+}
+
+void PerfHistory::init() {
+    nvs_handle_t nvs;
+    if (nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs) == ESP_OK) {
+        StoredHistory stored = {};
+        size_t len = sizeof(stored);
+        if (nvs_get_blob(nvs, NVS_KEY, &stored, &len) == ESP_OK && len == sizeof(stored) && stored.magic == kMagic) {
+            base_ = stored.totals;
+            reported_ = stored.reported;
+        }
+        nvs_close(nvs);
+    }
+    saved_ = base_;
+    saved_reported_ = reported_;
+
+    switch (esp_reset_reason()) {
+        case ESP_RST_PANIC:
+        case ESP_RST_INT_WDT:
+        case ESP_RST_TASK_WDT:
+        case ESP_RST_WDT:
+            run_resets_panic_ = 1;
+            break;
+        case ESP_RST_BROWNOUT:
+            run_resets_brownout_ = 1;
+            break;
+        default:
+            break;
+    }
+    initialized_ = true;
+    ESP_LOGI(TAG, "🗄️ 第%lu次启动，累计会话%lu次、异常复位%lu次、掉电复位%lu次、运行%lu小时",
+             (unsigned long)(base_.boots + 1), (unsigned long)base_.sessions,
+             (unsigned long)(base_.resets_panic + run_resets_panic_),
+             (unsigned long)(base_.resets_brownout + run_resets_brownout_), (unsigned long)(base_.uptime_s / 3600));
+}
+
+void PerfHistory::noteConnect() {
+    connects_.fetch_add(1, std::memory_order_relaxed);
+}
+
+PerfHistory::Totals PerfHistory::totals() const {
+    Totals t = base_;
+    uint32_t connects = connects_.load(std::memory_order_relaxed);
+    t.boots += 1;
+    t.resets_panic += run_resets_panic_;
+    t.resets_brownout += run_resets_brownout_;
+    t.sessions += sessions_.load(std::memory_order_relaxed);
+    t.uplink_drops += PerfCounters::get(PerfCounter::UPLINK_POOL_DROPS) + PerfCounters::get(PerfCounter::UPLINK_QUEUE_DROPS) +
+                      PerfCounters::get(PerfCounter::WS_SEND_STALE_DROPS);
+    t.underruns += PerfCounters::get(PerfCounter::JITTER_UNDERRUNS);
+    t.capture_drops += PerfCounters::get(PerfCounter::CAPTURE_OVERRUNS) + PerfCounters::get(PerfCounter::CAPTURE_GAPS);
+    t.reconnects += connects > 1 ? connects - 1 : 0;
+    t.uptime_s += (uint32_t)(esp_timer_get_time() / 1000000);
+    uint32_t heap_min = (uint32_t)heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL);
+    if (t.heap_min == 0 || heap_min < t.heap_min) {
+        t.heap_min = heap_min;
+    }
+    return t;
+}
+
+void PerfHistory::maybeSave(bool idle) {
+    if (!initialized_ || !idle) {
+        return;
+    }
+    int64_t now = esp_timer_get_time();
+    if (last_save_us_ != 0 && now - last_save_us_ < (int64_t)PERF_HISTORY_SAVE_MS * 1000) {
+        return;
+    }
+    save();
+}
+
+void PerfHistory::save() {
+    if (!initialized_) {
+        return;
+    }
+    Totals t = totals();
+    // 只有运行时间变了不写（空闲时每次都会变），其他计数或上报位置变了才写
+    Totals compare = t;
+    compare.uptime_s = saved_.uptime_s;
+    bool changed = memcmp(&compare, &saved_, sizeof(Totals)) != 0 ||
+                   memcmp(&reported_, &saved_reported_, sizeof(Totals)) != 0;
+    if (last_save_us_ != 0 && !changed) {
+        return;
+    }
+    last_save_us_ = esp_timer_get_time();
+    write(t);
+}
+
+bool PerfHistory::write(const Totals& totals) {
+    nvs_handle_t nvs;
+    esp_err_t ret = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ 打开NVS失败: %s", esp_err_to_name(ret));
+        return false;
+    }
+    StoredHistory stored = { kMagic, totals, reported_ };
+    int64_t start_us = esp_timer_get_time();
+    ret = nvs_set_blob(nvs, NVS_KEY, &stored, sizeof(stored));
+    if (ret == ESP_OK) {
+        ret = nvs_commit(nvs);
+    }
+    nvs_close(nvs);
+    FlashScheduler::noteOp("perf_history", esp_timer_get_time() - start_us);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ 保存性能累计失败: %s", esp_err_to_name(ret));
+        return false;
+    }
+    saved_ = totals;
+    saved_reported_ = reported_;
+    ESP_LOGD(TAG, "🗄️ 已保存性能累计（%lld us）", esp_timer_get_time() - start_us);
+    return true;
+}
+
+size_t PerfHistory::formatReport(char* buf, size_t size) {
+    if (!initialized_) {
+        return 0;
+    }
+    Totals t = totals();
+    const Totals& r = reported_;
+    int len = snprintf(buf, size,
+                       "{\"type\":\"perf_history\",\"boots\":%lu,\"uptime_s\":%lu,\"heap_min\":%lu,"
+                       "\"totals\":{\"resets_panic\":%lu,\"resets_brownout\":%lu,\"sessions\":%lu,\"uplink_drops\":%lu,"
+                       "\"underruns\":%lu,\"capture_drops\":%lu,\"reconnects\":%lu},"
+                       "\"delta\":{\"boots\":%lu,\"resets_panic\":%lu,\"resets_brownout\":%lu,\"sessions\":%lu,"
+                       "\"uplink_drops\":%lu,\"underruns\":%lu,\"capture_drops\":%lu,\"reconnects\":%lu,\"uptime_s\":%lu}}",
+                       (unsigned long)t.boots, (unsigned long)t.uptime_s, (unsigned long)t.heap_min,
+                       (unsigned long)t.resets_panic, (unsigned long)t.resets_brownout, (unsigned long)t.sessions,
+                       (unsigned long)t.uplink_drops, (unsigned long)t.underruns, (unsigned long)t.capture_drops,
+                       (unsigned long)t.reconnects,
+                       (unsigned long)(t.boots - r.boots), (unsigned long)(t.resets_panic - r.resets_panic),
+                       (unsigned long)(t.resets_brownout - r.resets_brownout), (unsigned long)(t.sessions - r.sessions),
+                       (unsigned long)(t.uplink_drops - r.uplink_drops), (unsigned long)(t.underruns - r.underruns),
+                       (unsigned long)(t.capture_drops - r.capture_drops), (unsigned long)(t.reconnects - r.reconnects),
+                       (unsigned long)(t.uptime_s - r.uptime_s));
+    if (len <= 0 || (size_t)len >= size) {
+        return 0;
+    }
+    reported_ = t;      // 下一次保存时写进NVS
+    return (size_t)len;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file perf_history.h
+ * @brief 🗄️ 跨重启的性能累计 - 几个关键计数器的累计值存在NVS里，重连时把上次上报之后的增量发给服务器
+ *
+ * PerfCounters每次启动从0开始，现场的问题又常常以一次重启结束，重启前的情况就没了。
+ * 这里在NVS里留一份很小的累计（一个blob）：启动次数和按原因分的异常复位、会话数、上行丢帧、
+ * 播放欠载、采集丢块、重连次数、历次启动里内部RAM的最低空闲、累计运行时间。
+ *
+ * 写Flash要擦写扇区，期间两个核心的cache都会停一下，所以：
+ * - 只在空闲时写（不在会话中、没有在播放），由主循环调用maybeSave()
+ * - 成批写：内存里的累计变了才写，两次之间至少隔PERF_HISTORY_SAVE_MS（启动后第一次空闲立即写，
+ *   启动次数和复位原因不会因为接着又重启而丢掉）
+ * - 深度睡眠、升级重启之前主动save()一次；崩溃时最多丢掉最近一个PERF_HISTORY_SAVE_MS的计数
+ *
+ * 每次服务器hello确认后formatReport()带上累计和"delta"（上次上报以来的增量，跨重启也连续），
+ * 服务器按delta累加成整个设备群的长期数据；上报位置跟着下一次保存写进NVS，没保存就重启时增量会再报一次。
+ */
+
+#ifndef PERF_HISTORY_H
+#define PERF_HISTORY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+class PerfHistory {
+public:
+    /**
+     * @brief 累计值（heap_min是历次启动的最小值，其余都是累加）
+     */
+    struct Totals {
+        uint32_t boots;
+        uint32_t resets_panic;      // 异常/看门狗复位
+        uint32_t resets_brownout;   // 掉电复位
+        uint32_t sessions;          // 云端会话
+        uint32_t uplink_drops;      // 帧池/发送队列满、WebSocket发送过期丢掉的上行
+        uint32_t underruns;         // 播放欠载
+        uint32_t capture_drops;     // 被DMA覆盖或中断来晚的采集块
+        uint32_t reconnects;        // 启动后第一次之外的WebSocket连接
+        uint32_t uptime_s;
+        uint32_t heap_min;          // 内部RAM最低空闲（0=还没有）
+    };
+
+    PerfHistory();
+
+    /**
+     * @brief 启动时调用：读NVS里的累计，记上这次启动和复位原因（NVS初始化之后）
+     */
+    void init();
+
+    // 可以在任意任务中调用
+    void noteSession() { sessions_.fetch_add(1, std::memory_order_relaxed); }
+    void noteConnect();
+
+    /**
+     * @brief 加上本次运行至今的计数（主任务中调用）
+     */
+    Totals totals() const;
+
+    /**
+     * @brief 空闲时按间隔保存（主任务中调用，每次主循环都可以调用）
+     *
+     * @param idle 现在能不能写Flash（没有会话、没有在播放、没有在写升级固件）
+     */
+    void maybeSave(bool idle);
+
+    /**
+     * @brief 立即保存（深度睡眠、重启之前，有变化才写）
+     */
+    void save();
+
+    /**
+     * @brief {"type":"perf_history",...}：累计和上次上报以来的增量，之后的增量从这里算起（主任务中调用）
+     *
+     * @return 写入的字符数，缓冲区不够时返回0（上报位置不变）
+     */
+    size_t formatReport(char* buf, size_t size);
+
+private:
+    static const char* TAG;
+
+    bool write(const Totals& totals);
+
+    Totals base_;               // NVS里读出的累计（不含本次运行）
+    Totals saved_;              // 最近一次写进NVS的累计
+    Totals reported_;           // 最近一次上报时的累计
+    Totals saved_reported_;
+    bool initialized_;
+    int64_t last_save_us_;      // 0=这次启动还没有写过
+    uint32_t run_resets_panic_;
+    uint32_t run_resets_brownout_;
+    std::atomic<uint32_t> sessions_;
+    std::atomic<uint32_t> connects_;
+};
+
+#endif // PERF_HISTORY_H
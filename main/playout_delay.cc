@@ -0,0 +1,91 @@
+/**
+ * @file playout_delay.cc
+ * @brief ⏳ 下行迟到量直方图和预缓冲目标
+ */
+
+#include "playout_delay.h"
+
+static const uint32_t kProbabilityOne = 1u << 30;           // 直方图是Q30
+static const uint32_t kForgetFactor = 32702;                // Q15，约0.998
+static const uint32_t kQuantilePercent = PLAYOUT_DELAY_QUANTILE_PERCENT;
+
+PlayoutDelay::PlayoutDelay(uint32_t sample_rate, uint32_t initial_ms)
+    : samples_per_ms_(sample_rate / 1000)
+    , histogram_{}
+    , updates_(0)
+    , last_arrival_us_(0)
+    , last_position_(0)
+    , lateness_us_(0)
+    , target_ms_(initial_ms)
+    , has_reference_(false)
+{
+    // 初始值作为一次"测量"放进直方图，目标 = 桶 + 一个播放块
+    uint32_t initial_bucket = initial_ms > PLAYBACK_CHUNK_MS ? (initial_ms - PLAYBACK_CHUNK_MS) / BUCKET_MS : 0;
+    histogram_[initial_bucket < BUCKETS ? initial_bucket : BUCKETS - 1] = kProbabilityOne;
+}
+
+bool PlayoutDelay::onArrival(int64_t arrival_us, size_t media_position, size_t buffered_samples) {
+    if (!has_reference_) {
+        last_arrival_us_ = arrival_us;
+        last_position_ = media_position;
+        lateness_us_ = 0;
+        has_reference_ = true;
+        return false;
+    }
+
+    int64_t arrival_delta_us = arrival_us - last_arrival_us_;
+    int64_t media_delta_us = (int64_t)(media_position - last_position_) * 1000 / samples_per_ms_;
+    last_arrival_us_ = arrival_us;
+    last_position_ = media_position;
+    lateness_us_ += arrival_delta_us - media_delta_us;
+    if (lateness_us_ < 0) {
+        lateness_us_ = 0;
+    }
+
+    // 缓冲区很满时到达节奏由下行额度决定；这时数据是提前到的，时刻表从这里重新算
+    if (buffered_samples >= (size_t)PLAYBACK_PREBUFFER_MAX_MS * samples_per_ms_) {
+        lateness_us_ = 0;
+        return false;
+    }
+
+    size_t bucket = (size_t)(lateness_us_ / 1000 / BUCKET_MS);
+    update(bucket < BUCKETS ? bucket : BUCKETS - 1);
+    uint32_t target = computeTarget();
+    if (target == target_ms_) {
+        return false;
+    }
+    target_ms_ = target;
+    return true;
+}
+
+void PlayoutDelay::update(size_t bucket) {
+    // 启动阶段遗忘因子是1 - 1/(n+2)，相当于对已有的测量取平均，爬到kForgetFactor后保持不变
+    uint32_t forget = 32768 - 32768 / (updates_ + 2);
+    if (forget > kForgetFactor) {
+        forget = kForgetFactor;
+    } else {
+        updates_++;
+    }
+    for (size_t i = 0; i < BUCKETS; i++) {
+        histogram_[i] = (uint32_t)(((uint64_t)histogram_[i] * forget) >> 15);
+    }
+    histogram_[bucket] += (32768 - forget) << 15;
+}
+
+uint32_t PlayoutDelay::computeTarget() const {
+    // 每次乘遗忘因子都向下取整，总和会略小于1，按实际总和算分位
+    uint64_t total = 0;
+    for (size_t i = 0; i < BUCKETS; i++) {
+        total += histogram_[i];
+    }
+    uint64_t limit = total * kQuantilePercent / 100;
+    uint64_t sum = 0;
+    size_t bucket = 0;
+    for (; bucket < BUCKETS - 1; bucket++) {
+        sum += histogram_[bucket];
+        if (sum >= limit) {
+            break;
+        }
+    }
+    return (uint32_t)bucket * BUCKET_MS + PLAYBACK_CHUNK_MS;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file playout_delay.h
+ * @brief ⏳ 播放延迟估计 - 按下行消息实际到达的迟到程度决定预缓冲目标
+ *
+ * 以前预缓冲取心跳RTT抖动的4倍：心跳几秒才一次，测的是往返时间，
+ * 下行音频在TCP里排队、豆包生成卡顿这些都看不到。现在和WebRTC NetEQ的DelayManager一样，
+ * 直接看每条下行消息的到达时间：
+ *
+ * - 迟到量：相对最近一条"准时"消息的时刻表晚到了多少
+ *   lateness = max(0, 上一条的lateness + 到达间隔 - 媒体时长间隔)
+ *   服务器一般比实时快（豆包生成比播放快），正常时一直是0；网络卡住再一股脑到达时，
+ *   卡住那一下记一次迟到，后面的消息赶上进度后回到0
+ * - 直方图：迟到量按BUCKET_MS分桶，遗忘因子约0.998（约500条消息的记忆），
+ *   刚开始时遗忘因子从0.5爬上去，头几条消息就能把初始值冲掉
+ * - 目标：覆盖QUANTILE_PERCENT的迟到量再加一个播放块，网络好的时候降到下限，差的时候自动加大
+ *
+ * 抖动缓冲区已经很满（超过PLAYBACK_PREBUFFER_MAX_MS）时到达的消息受下行额度限制，
+ * 到达间隔反映的是播放速度而不是网络，不计入统计。
+ * 只在WebSocket事件任务中调用，内部不加锁。
+ */
+
+#ifndef PLAYOUT_DELAY_H
+#define PLAYOUT_DELAY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "project_config.h"
+
+class PlayoutDelay {
+public:
+    static constexpr uint32_t BUCKET_MS = 10;
+    static constexpr size_t BUCKETS = PLAYBACK_PREBUFFER_MAX_MS / BUCKET_MS + 1;
+
+    /**
+     * @param sample_rate 媒体时钟（抖动缓冲区的采样率）
+     * @param initial_ms 还没有测量时的目标
+     */
+    PlayoutDelay(uint32_t sample_rate, uint32_t initial_ms);
+
+    /**
+     * @brief 一段新的流开始（新回复、欠载后重新预缓冲），下一条消息重新作为时刻表的起点
+     */
+    void startStream() { has_reference_ = false; }
+
+    /**
+     * @brief 一条下行消息到达
+     *
+     * @param arrival_us 到达时间
+     * @param media_position 这条消息第一个样本在媒体时钟上的位置（样本数，只要求同一段流内连续）
+     * @param buffered_samples 到达时抖动缓冲区里的样本数
+     * @return 目标发生了变化
+     */
+    bool onArrival(int64_t arrival_us, size_t media_position, size_t buffered_samples);
+
+    /**
+     * @brief 当前目标（毫秒，未经上下限裁剪）
+     */
+    uint32_t targetMs() const { return target_ms_; }
+
+private:
+    void update(size_t bucket);
+    uint32_t computeTarget() const;
+
+    uint32_t samples_per_ms_;
+    uint32_t histogram_[BUCKETS];   // Q30概率
+    uint32_t updates_;              // 已计入的消息数（决定启动阶段的遗忘因子）
+    int64_t last_arrival_us_;
+    size_t last_position_;
+    int64_t lateness_us_;
+    uint32_t target_ms_;
+    bool has_reference_;
+};
+
+#endif // PLAYOUT_DELAY_H
@@ -0,0 +1,162 @@
+/**
+ * @file playout_drift.cc
+ * @brief 🕰️ 播放时钟漂移估计和分数重采样
+ */
+
+#include "playout_drift.h"
+#include <math.h>
+#include "buffer_placement.h"
+#include "esp_log.h"
+#include "log_throttle.h"
+#include "perf_counters.h"
+#include "project_config.h"
+#include "realtime_audio.h"
+
+const char* PlayoutDrift::TAG = "PlayoutDrift";
+
+// 2^32 / 10^6：1ppm对应的Q32步长
+static const float kStepPerPpm = 4294.967296f;
+
+PlayoutDrift::PlayoutDrift(uint32_t sample_rate, size_t max_count)
+    : samples_per_ms_((float)sample_rate / 1000.0f)
+    , capacity_(max_count)
+    // 最快1 + PLAYOUT_DRIFT_MAX_PPM倍：一块多读不到max_count / 1000个，再加上一个样本和偷看的一个
+    , in_((int16_t*)BufferPlacement::alloc("drift_in", (max_count + max_count / 512 + 4) * sizeof(int16_t),
+                                           Placement::INTERNAL))
+    , out_((int16_t*)BufferPlacement::alloc("drift_out", max_count * sizeof(int16_t), Placement::DMA))
+    , fill_avg_(0)
+    , reference_(0)
+    , settle_ms_(0)
+    , filter_valid_(false)
+    , integral_(0)
+    , ppm_(0)
+    , step_(1ull << 32)
+    , phase_(0)
+    , last_(0)
+    , primed_(false)
+    , resampling_(false)
+{
+}
+
+PlayoutDrift::~PlayoutDrift() {
+    BufferPlacement::free(in_);
+    BufferPlacement::free(out_);
+}
+
+void PlayoutDrift::startStream() {
+    filter_valid_ = false;
+    settle_ms_ = 0;
+    primed_ = false;
+    phase_ = 0;
+    resampling_ = false;
+    setPpm(integral_);
+}
+
+void PlayoutDrift::seedDriftPpm(float ppm) {
+    if (ppm > PLAYOUT_DRIFT_MAX_PPM) {
+        ppm = PLAYOUT_DRIFT_MAX_PPM;
+    } else if (ppm < -PLAYOUT_DRIFT_MAX_PPM) {
+        ppm = -PLAYOUT_DRIFT_MAX_PPM;
+    }
+    integral_ = ppm;
+}
+
+void PlayoutDrift::setPpm(float ppm) {
+    if (ppm > PLAYOUT_DRIFT_MAX_PPM) {
+        ppm = PLAYOUT_DRIFT_MAX_PPM;
+    } else if (ppm < -PLAYOUT_DRIFT_MAX_PPM) {
+        ppm = -PLAYOUT_DRIFT_MAX_PPM;
+    }
+    ppm_ = ppm;
+    step_ = (uint64_t)((int64_t)(1ll << 32) + (int64_t)(ppm * kStepPerPpm));
+}
+
+void PlayoutDrift::update(size_t buffered, uint32_t elapsed_ms) {
+#if PLAYOUT_DRIFT_ENABLE
+    if (!isValid()) {
+        return;
+    }
+    if (!filter_valid_) {
+        fill_avg_ = (float)buffered;
+        filter_valid_ = true;
+    } else {
+        fill_avg_ += ((float)buffered - fill_avg_) * (float)elapsed_ms / PLAYOUT_DRIFT_FILTER_MS;
+    }
+    // 低通稳定之前只沿用已有的偏差估计
+    if (settle_ms_ < PLAYOUT_DRIFT_FILTER_MS) {
+        settle_ms_ += elapsed_ms;
+        reference_ = fill_avg_;
+        setPpm(integral_);
+    } else {
+        float error_ms = (fill_avg_ - reference_) / samples_per_ms_;
+        float proportional = 0;
+        if (error_ms < PLAYOUT_DRIFT_HOLD_MS) {
+            proportional = PLAYOUT_DRIFT_KP * error_ms;
+            if (fabsf(error_ms) < PLAYOUT_DRIFT_BAND_MS) {
+                integral_ += PLAYOUT_DRIFT_KI * error_ms * (float)elapsed_ms / 1000.0f;
+                if (integral_ > PLAYOUT_DRIFT_MAX_PPM) {
+                    integral_ = PLAYOUT_DRIFT_MAX_PPM;
+                } else if (integral_ < -PLAYOUT_DRIFT_MAX_PPM) {
+                    integral_ = -PLAYOUT_DRIFT_MAX_PPM;
+                }
+            }
+        }
+        setPpm(proportional + integral_);
+    }
+
+    if (!resampling_ && fabsf(ppm_) >= PLAYOUT_DRIFT_MIN_PPM) {
+        resampling_ = true;
+        HOT_LOGD(TAG, "开始漂移补偿: %ld ppm（估计偏差 %ld ppm）", (long)ppm(), (long)driftPpm());
+    }
+#else
+    (void)buffered;
+    (void)elapsed_ms;
+#endif
+}
+
+size_t PlayoutDrift::inputNeeded(size_t count) const {
+    uint64_t end = (uint64_t)phase_ + step_ * count;
+    return (size_t)(end >> 32) + 1 + (primed_ ? 0 : 1);
+}
+
+const int16_t* AUDIO_HOT_IRAM PlayoutDrift::process(JitterBuffer& jitter_buffer, size_t count) {
+    if (count > capacity_) {
+        count = capacity_;
+    }
+    if (!primed_) {
+        if (jitter_buffer.read(&last_, 1) == 0) {
+            last_ = 0;
+        }
+        primed_ = true;
+    }
+
+    // in_[0]是last_，in_[1..advance]本块取走，in_[advance + 1]只偷看（下一块的第一个插值端点）
+    uint64_t end = (uint64_t)phase_ + step_ * count;
+    size_t advance = (size_t)(end >> 32);
+    in_[0] = last_;
+    size_t got = jitter_buffer.read(in_ + 1, advance);
+    for (size_t i = got; i < advance; i++) {
+        in_[i + 1] = in_[i];
+    }
+    JitterBuffer::Ring::Span<const int16_t> next = jitter_buffer.readSpan();
+    in_[advance + 1] = next.count > 0 ? next.data[0] : in_[advance];
+
+    uint64_t pos = phase_;
+    for (size_t i = 0; i < count; i++) {
+        size_t index = (size_t)(pos >> 32);
+        int32_t frac = (int32_t)((pos >> 17) & 0x7FFF);     // 15位，乘积放得进int32
+        int32_t a = in_[index];
+        int32_t b = in_[index + 1];
+        out_[i] = (int16_t)(a + (((b - a) * frac) >> 15));
+        pos += step_;
+    }
+    last_ = in_[advance];
+    phase_ = (uint32_t)end;
+
+    if (advance > count) {
+        PerfCounters::add(PerfCounter::PLAYOUT_DRIFT_REMOVED, (uint32_t)(advance - count));
+    } else if (advance < count) {
+        PerfCounters::add(PerfCounter::PLAYOUT_DRIFT_INSERTED, (uint32_t)(count - advance));
+    }
+    return out_;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file playout_drift.h
+ * @brief 🕰️ 播放时钟漂移补偿 - 按抖动缓冲区水位估计服务器和I2S时钟的偏差，用分数重采样慢慢追回来
+ *
+ * I2S发送时钟由bsp_audio_init从默认时钟源分频得到（I2S_CLK_SRC_DEFAULT、MCLK 256倍），
+ * 和服务器的采样时钟没有锁在一起，差几十到几百ppm。服务器按实时节奏发音频时（旧固件没有额度、
+ * 豆包生成跟不上时），长回复里缓冲区就会慢慢涨到丢数据或者掉到欠载。ESP32-S3没有APLL可以微调，
+ * 所以在播放端补：
+ *
+ * - 估计：每个播放块取一次水位，一阶低通（PLAYOUT_DRIFT_FILTER_MS）滤掉网络抖动和消息粒度。
+ *   低通稳定后的水位记作这段流的参考点（预缓冲目标加上消息到达的平均余量，已经按抖动留够了），
+ *   之后和参考点的差（毫秒）进PI控制器：ppm = KP × 误差 + 积分。只追漂移的趋势，不把平均水位
+ *   压到预缓冲目标上（那样每条消息到达前的低点就掉到目标以下了）。积分只在误差小于
+ *   PLAYOUT_DRIFT_BAND_MS时累加（卡顿、突发不算漂移），它就是时钟偏差的估计，跨回复保留
+ * - 水位比参考点高出PLAYOUT_DRIFT_HOLD_MS以上时是服务器在按额度突发（比实时快），
+ *   这时只沿用已经估计出的偏差，不加比例项也不改积分
+ * - 补偿：ppm不为0后用线性插值的分数重采样按1 + ppm×10⁻⁶的速度读抖动缓冲区（Q32相位），
+ *   ±1000ppm的变速听不出来；一段流内一旦打开就不再关，避免来回切换时的相位跳变
+ *
+ * 重采样期间播放块要经过内部缓冲区（DMA可用），不再是零拷贝；没有偏差时保持零拷贝。
+ * 只在播放任务中调用，内部不加锁。
+ */
+
+#ifndef PLAYOUT_DRIFT_H
+#define PLAYOUT_DRIFT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "jitter_buffer.h"
+
+class PlayoutDrift {
+public:
+    /**
+     * @param sample_rate 抖动缓冲区的采样率
+     * @param max_count 每次最多输出的样本数（播放块大小），内部缓冲区按它分配
+     */
+    PlayoutDrift(uint32_t sample_rate, size_t max_count);
+    ~PlayoutDrift();
+
+    PlayoutDrift(const PlayoutDrift&) = delete;
+    PlayoutDrift& operator=(const PlayoutDrift&) = delete;
+
+    bool isValid() const { return in_ != nullptr && out_ != nullptr; }
+
+    /**
+     * @brief 新的一段流开始（预缓冲完成）或播放被打断：丢掉插值用的上一个样本，低通和参考点重新开始，
+     *        关掉重采样直到下一次update()；偏差估计保留
+     */
+    void startStream();
+
+    /**
+     * @brief 每个正常播放块调用一次，更新估计和当前的补偿量
+     *
+     * @param buffered 抖动缓冲区里的样本数
+     * @param elapsed_ms 距上次调用的媒体时长（一个播放块）
+     */
+    void update(size_t buffered, uint32_t elapsed_ms);
+
+    /**
+     * @brief 这段流是否在走重采样（否则直接从抖动缓冲区零拷贝播放）
+     */
+    bool resampling() const { return resampling_; }
+
+    /**
+     * @brief 输出count个样本要从抖动缓冲区读多少个（含插值要偷看的下一个样本）
+     */
+    size_t inputNeeded(size_t count) const;
+
+    /**
+     * @brief 从抖动缓冲区读inputNeeded(count)个样本（最后一个只偷看不取走），重采样成count个
+     *
+     * @return 内部缓冲区，下次调用前有效
+     */
+    const int16_t* process(JitterBuffer& jitter_buffer, size_t count);
+
+    /**
+     * @brief 当前补偿量（ppm，正数=比标称速度快地消耗缓冲区）
+     */
+    int32_t ppm() const { return (int32_t)ppm_; }
+
+    /**
+     * @brief 时钟偏差估计（PI的积分项，ppm）
+     */
+    int32_t driftPpm() const { return (int32_t)integral_; }
+
+    /**
+     * @brief 🌙 设置时钟偏差估计的初值（深度睡眠醒来沿用睡前的，第一段流不用重新收敛），播放任务启动前调用
+     */
+    void seedDriftPpm(float ppm);
+
+private:
+    void setPpm(float ppm);
+
+    static const char* TAG;
+    float samples_per_ms_;
+    size_t capacity_;
+    int16_t* in_;               // 上一个样本 + 本块读出的样本 + 偷看的下一个
+    int16_t* out_;              // 重采样结果，直接交给I2S（DMA可用）
+    float fill_avg_;            // 低通后的水位（样本）
+    float reference_;           // 这段流的参考水位（样本）
+    uint32_t settle_ms_;        // 这段流已经滤波的时长，到PLAYOUT_DRIFT_FILTER_MS时取参考点
+    bool filter_valid_;
+    float integral_;
+    float ppm_;
+    uint64_t step_;             // 每个输出样本前进的输入样本数（Q32）
+    uint32_t phase_;            // 在last_和下一个样本之间的位置（Q32小数部分）
+    int16_t last_;              // 已经从抖动缓冲区取走、还要参与插值的样本
+    bool primed_;               // last_有效
+    bool resampling_;
+};
+
+#endif // PLAYOUT_DRIFT_H
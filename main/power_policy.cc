@@ -0,0 +1,71 @@
+/**
+ * @file power_policy.cc
+ * @brief 🔋 功耗策略实现
+ */
+
+#include "power_policy.h"
+#include "esp_log.h"
+#include "esp_wifi.h"
+#include "sdkconfig.h"
+
+const char* PowerPolicy::TAG = "PowerPolicy";
+
+PowerPolicy::PowerPolicy()
+    : initialized_(false)
+    , active_(false)
+    , cpu_lock_(nullptr)
+    , sleep_lock_(nullptr)
+{
+}
+
+esp_err_t PowerPolicy::init(int max_cpu_mhz, int idle_min_cpu_mhz, bool idle_light_sleep) {
+#if CONFIG_PM_ENABLE
+    esp_pm_config_t pm_config = {
+        .max_freq_mhz = max_cpu_mhz,
+        .min_freq_mhz = idle_min_cpu_mhz,
+        .light_sleep_enable = idle_light_sleep,
+    };
+    esp_err_t ret = esp_pm_configure(&pm_config);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "⚠️ 配置调频失败: %s，只切换WiFi省电模式", esp_err_to_name(ret));
+    } else {
+        esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "session_cpu", &cpu_lock_);
+        esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "session_awake", &sleep_lock_);
+        ESP_LOGI(TAG, "✓ 调频: 空闲%d~%d MHz（light sleep %s），会话%d MHz",
+                 idle_min_cpu_mhz, max_cpu_mhz, idle_light_sleep ? "开" : "关", max_cpu_mhz);
+    }
+#else
+    ESP_LOGI(TAG, "CONFIG_PM_ENABLE未打开，只切换WiFi省电模式");
+#endif
+    initialized_ = true;
+    active_ = true;         // 让下面的setActive(false)真正执行一次
+    setActive(false);
+    return ESP_OK;
+}
+
+void PowerPolicy::setActive(bool active) {
+    if (!initialized_ || active == active_) {
+        return;
+    }
+    active_ = active;
+
+    if (active) {
+        // 先升频再关WiFi省电，唤醒后的第一批上行音频就不用等DTIM
+        if (cpu_lock_) {
+            esp_pm_lock_acquire(cpu_lock_);
+        }
+        if (sleep_lock_) {
+            esp_pm_lock_acquire(sleep_lock_);
+        }
+        esp_wifi_set_ps(WIFI_PS_NONE);
+    } else {
+        esp_wifi_set_ps(WIFI_PS_MIN_MODEM);
+        if (sleep_lock_) {
+            esp_pm_lock_release(sleep_lock_);
+        }
+        if (cpu_lock_) {
+            esp_pm_lock_release(cpu_lock_);
+        }
+    }
+    ESP_LOGI(TAG, "🔋 %s", active ? "会话策略：最高频率，WiFi不省电" : "空闲策略：允许降频，WiFi MIN_MODEM");
+}
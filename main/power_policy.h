@@ -0,0 +1,49 @@
+/**
+ * @file power_policy.h
+ * @brief 🔋 功耗策略 - 按对话状态切换CPU调频和WiFi省电模式
+ *
+ * 空闲等唤醒的时间远多于对话，但两者对延迟的要求完全不同：
+ * - 空闲：CPU允许降到POWER_IDLE_MIN_CPU_MHZ（AFE和唤醒词仍要跑，不能降到底），
+ *   WiFi用WIFI_PS_MIN_MODEM，每个DTIM醒来一次收包
+ * - 会话（含唤醒后的本地命令词窗口）：持有CPU最高频率和禁止light sleep的锁，
+ *   WiFi关闭省电（WIFI_PS_NONE），上下行音频不再等DTIM
+ *
+ * light sleep：麦克风I2S在空闲时也一直采集（唤醒词要用），I2S驱动自己持有APB锁，
+ * 实际上进不了light sleep；这里照样打开，I2S停下时（如以后加按键唤醒模式）自动生效。
+ * sdkconfig没有打开CONFIG_PM_ENABLE时只切换WiFi省电模式。
+ */
+
+#ifndef POWER_POLICY_H
+#define POWER_POLICY_H
+
+#include "esp_err.h"
+#include "esp_pm.h"
+
+class PowerPolicy {
+public:
+    PowerPolicy();
+
+    /**
+     * @brief 配置调频范围并创建锁（WiFi启动之后调用），初始为空闲策略
+     */
+    esp_err_t init(int max_cpu_mhz, int idle_min_cpu_mhz, bool idle_light_sleep);
+
+    /**
+     * @brief 切换策略（主循环每次都可以调用，状态没变时直接返回）
+     *
+     * @param active true=会话中，false=空闲
+     */
+    void setActive(bool active);
+
+    bool isActive() const { return active_; }
+
+private:
+    static const char* TAG;
+
+    bool initialized_;
+    bool active_;
+    esp_pm_lock_handle_t cpu_lock_;
+    esp_pm_lock_handle_t sleep_lock_;
+};
+
+#endif // POWER_POLICY_H
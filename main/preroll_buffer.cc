@@ -0,0 +1,80 @@
+/**
+ * @file preroll_buffer.cc
+ * @brief ⏪ 会话预录缓冲区实现
+ */
+
+#include "preroll_buffer.h"
+#include "realtime_audio.h"
+
+// 单个块记录最多覆盖的样本数（块记录里的count是16位）
+static const size_t kMaxChunkSamples = 4096;
+
+PrerollBuffer::PrerollBuffer(size_t max_samples, Placement placement)
+    : samples_("session_preroll", placement)
+    , chunks_("preroll_chunks", Placement::INTERNAL)
+    , max_samples_(max_samples < CAPACITY_SAMPLES ? max_samples : CAPACITY_SAMPLES)
+    , dropped_(0)
+{
+}
+
+void AUDIO_HOT_IRAM PrerollBuffer::dropOldest() {
+    Chunk chunk;
+    if (chunks_.read(&chunk, 1) == 1) {
+        samples_.commitRead(chunk.count);
+        dropped_.fetch_add(chunk.count, std::memory_order_release);
+    }
+}
+
+void AUDIO_HOT_IRAM PrerollBuffer::push(const int16_t* samples, size_t count, bool is_speech) {
+    if (!isValid() || max_samples_ == 0) {
+        return;
+    }
+    if (count > max_samples_) {
+        samples += count - max_samples_;
+        count = max_samples_;
+    }
+
+    while (count > 0) {
+        size_t n = count < kMaxChunkSamples ? count : kMaxChunkSamples;
+        // 读写都在同一个任务里，直接丢掉最旧的块腾出空间
+        while (samples_.size() > 0 && (samples_.size() + n > max_samples_ || chunks_.freeSpace() == 0)) {
+            dropOldest();
+        }
+        Chunk chunk = { (uint16_t)n, is_speech };
+        samples_.write(samples, n);
+        chunks_.write(&chunk, 1);
+        samples += n;
+        count -= n;
+    }
+}
+
+void PrerollBuffer::replay(const ReplayFunc& func) {
+    Chunk chunk;
+    while (chunks_.read(&chunk, 1) == 1) {
+        size_t left = chunk.count;
+        // 块可能跨越环形缓冲区末尾，分两段回放
+        while (left > 0) {
+            SpscRing<int16_t, CAPACITY_SAMPLES>::Span<const int16_t> span = samples_.readSpan();
+            size_t n = span.count < left ? span.count : left;
+            if (n == 0) {
+                break;
+            }
+            func(span.data, n, chunk.is_speech);
+            samples_.commitRead(n);
+            left -= n;
+        }
+    }
+    samples_.clear();
+}
+
+void PrerollBuffer::clear() {
+    dropped_.fetch_add((uint32_t)samples_.size(), std::memory_order_release);
+    chunks_.clear();
+    samples_.clear();
+}
+
+void PrerollBuffer::keepLatest(size_t count) {
+    while (samples_.size() > count && chunks_.size() > 0) {
+        dropOldest();
+    }
+}
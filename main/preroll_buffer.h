@@ -0,0 +1,80 @@
+/**
+ * @file preroll_buffer.h
+ * @brief ⏪ 会话预录缓冲区 - 唤醒到开始录音之间的音频不再丢失
+ *
+ * 空闲时持续写入音频前端的输出，满了就丢弃最旧的块，始终保留最近一段时间的音频；
+ * 检测到唤醒词后清空（唤醒词本身不上传；要服务器复核时只留下最近的一段，见keepLatest），
+ * 录音开始时按原顺序连同每块的VAD结果一起回放。
+ * 这样“你好小智，今天天气怎么样”可以一口气说完，不用等提示音。
+ *
+ * 样本和块记录分别存放在两个SpscRing里，读写都在音频前端的fetch任务中进行，不加锁；
+ * 只有dropped()可以在其他任务中读。
+ */
+
+#ifndef PREROLL_BUFFER_H
+#define PREROLL_BUFFER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <functional>
+#include "spsc_ring.h"
+#include "project_config.h"
+
+class PrerollBuffer {
+public:
+    static constexpr size_t CAPACITY_SAMPLES = SESSION_PREROLL_CAPACITY_SAMPLES;   // 默认约4秒@16kHz
+    static constexpr size_t MAX_CHUNKS = 256;
+
+    // 回放函数，参数与音频前端的音频回调一致
+    using ReplayFunc = std::function<void(const int16_t* samples, size_t count, bool is_speech)>;
+
+    /**
+     * @brief 创建预录缓冲区
+     *
+     * @param max_samples 最多保留的样本数（超过CAPACITY_SAMPLES时截断）
+     * @param placement 样本存储区放在哪里（见buffer_placement.h）
+     */
+    PrerollBuffer(size_t max_samples, Placement placement);
+
+    bool isValid() const { return samples_.isValid() && chunks_.isValid(); }
+
+    /**
+     * @brief 写入一块音频，超出上限时丢弃最旧的块
+     */
+    void push(const int16_t* samples, size_t count, bool is_speech);
+
+    /**
+     * @brief 按写入顺序回放所有音频并清空
+     */
+    void replay(const ReplayFunc& func);
+
+    void clear();
+
+    /**
+     * @brief 丢弃最旧的块，只留下最近的count个样本以内
+     */
+    void keepLatest(size_t count);
+
+    size_t size() const { return samples_.size(); }
+
+    /**
+     * @brief 累计丢弃（没有回放就被挤掉或清空）的样本数，两次读数之差说明中间丢过多少
+     */
+    uint32_t dropped() const { return dropped_.load(std::memory_order_acquire); }
+
+private:
+    struct Chunk {
+        uint16_t count;
+        bool is_speech;
+    };
+
+    void dropOldest();
+
+    SpscRing<int16_t, CAPACITY_SAMPLES> samples_;
+    SpscRing<Chunk, MAX_CHUNKS> chunks_;
+    size_t max_samples_;
+    std::atomic<uint32_t> dropped_;
+};
+
+#endif // PREROLL_BUFFER_H
@@ -12,8 +12,714 @@
 #define CONFIG_EXAMPLE_WIFI_SSID "WiFi名称"
 #define CONFIG_EXAMPLE_WIFI_PASSWORD "WiFi密码"
 
+// WiFi快速连接（见WiFiManager::ConnectOptions）- 记住上次的AP和信道，上电不做全信道扫描
+#define WIFI_FAST_CONNECT 1              // 0=每次都完整扫描
+#define WIFI_STATIC_IP ""                // 非空时使用静态IP，省掉DHCP（如"192.168.1.50"）
+#define WIFI_STATIC_NETMASK "255.255.255.0"
+#define WIFI_STATIC_GATEWAY ""           // 空=同网段的.1
+#define WIFI_STATIC_DNS ""               // 空=网关
+
+// WiFi链路监测和漫游（见WiFiManager::startLinkMonitor）
+#define WIFI_GOOD_RSSI_DBM -65           // 平均RSSI高于此值为GOOD
+#define WIFI_ROAM_RSSI_DBM -75           // 低于此值为POOR，持续几秒后尝试漫游
+#define WIFI_ROAM_HYSTERESIS_DB 8        // 新AP至少强这么多才切换，避免在两个AP之间来回跳
+#define WIFI_FAIR_PREBUFFER_BOOST_MS 40  // 链路变差时加大播放预缓冲，多扛一点抖动
+#define WIFI_POOR_PREBUFFER_BOOST_MS 120
+
+// WiFi性能配置（见WiFiManager::PerfProfile）- 驱动收发缓冲区、AMPDU和HT40，运行时参数wifi_profile可按设备覆盖
+#define WIFI_PERF_PROFILE 1              // 0=省内存，1=均衡（IDF默认），2=高吞吐（配合sdkconfig.defaults.throughput）
+
+// 功耗策略（见power_policy.h）- 空闲时允许降频、WiFi modem sleep；会话中锁最高频率、WiFi不省电
+#define POWER_MAX_CPU_MHZ 240
+#define POWER_IDLE_MIN_CPU_MHZ 160       // 空闲时AFE和唤醒词照常运行，80MHz跑不过来
+#define POWER_IDLE_LIGHT_SLEEP 1         // 需要CONFIG_FREERTOS_USE_TICKLESS_IDLE；I2S采集期间实际不会进入
+
 // WebSocket服务器配置 - 请根据您的服务器地址修改
 // 根据网络诊断工具建议，使用以下配置：
+// 不可信网络用wss://域名:端口（服务器设置RELAY_TLS_CERT/RELAY_TLS_KEY），证书用ESP-IDF证书包验证
 #define CONFIG_EXAMPLE_WEBSOCKET_URI "ws://IP地址:8888"
 
+// 中继选择（见relay_selector.h）- 启动时在下面这些候选里按建连RTT挑最近的，连不上时立即换下一个
+#define RELAY_FALLBACK_URIS ""           // 备用中继，逗号分隔，如"ws://192.168.1.20:8888,ws://relay.example.com:8888"
+#define RELAY_MDNS_ENABLE 1              // 1=启动时用mDNS查找局域网里的中继（服务器RELAY_MDNS=1时广播）
+#define RELAY_MDNS_SERVICE "_voicerelay" // mDNS服务类型（和服务器RELAY_MDNS_SERVICE一致）
+#define RELAY_MDNS_TIMEOUT_MS 300        // mDNS查询等待应答的时间
+#define RELAY_PROBE_TIMEOUT_MS 500       // 每轮探测等待TCP建连的时间，超过算连不上
+#define RELAY_PROBE_ROUNDS 2             // 探测轮数，取最小的建连时间
+
+// WebSocket重连退避 - 第n次重连前随机等待[0, min(MAX, BASE*2^n)]，避免服务器重启后所有设备同时重连
+#define WS_RECONNECT_BASE_MS 1000
+#define WS_RECONNECT_MAX_MS 60000
+
+// WebSocket传输层参数（见WebSocketClient::TransportProfile）
+#define WS_TCP_NODELAY 1                 // 1=关闭Nagle，小音频帧立即发出
+#define WS_DSCP 46                       // 连接的DSCP：46=EF（WiFi上行AC_VI，AP按RFC 8325下行AC_VO），48=CS6（上行也走AC_VO），0=不标记
+#define WS_TLS_SESSION_RESUME 1          // wss://重连时复用TLS会话，省掉密钥交换和证书验证；0=每次完整握手
+#define WS_NATIVE_TRANSPORT 0            // 1=ws://不经过esp_websocket_client，直接在lwIP socket上分帧收发（见native_ws.h）
+#define WS_KEEPALIVE_IDLE_SEC 5          // TCP keep-alive：空闲多久开始探测，0=不启用
+#define WS_KEEPALIVE_INTERVAL_SEC 2
+#define WS_KEEPALIVE_COUNT 3
+#define WS_PING_INTERVAL_SEC 10          // WebSocket ping间隔
+#define WS_PINGPONG_TIMEOUT_SEC 30       // 收不到pong多久判定断开，0=不检测
+#define WS_MIN_TCP_WND 11520             // 推荐的lwIP接收窗口（8个MSS），启动时检查sdkconfig
+#define WS_MIN_TCP_SND_BUF 11520         // 推荐的lwIP发送缓冲区
+#define WS_BUFFER_BYTES 8192             // esp_websocket_client/精简传输的收发缓冲区（更大的帧分段回调）
+
+// WebSocket发送队列 - 调用方只把消息拷进队列，由发送任务写socket，TCP窗口卡住时不会卡住主循环
+#define WS_SEND_CONTROL_SLOTS 8          // 控制通道（JSON文本、控制帧）队列长度，优先于音频发送
+#define WS_SEND_CONTROL_SLOT_BYTES 1024  // 控制消息上限（完整的stats JSON）
+#define WS_SEND_AUDIO_SLOTS 12           // 音频通道队列长度（合包后约720ms）
+#define WS_SEND_AUDIO_DEADLINE_MS 400    // 上行音频在队列里等这么久还没发出就丢弃
+#define WS_SEND_BULK_SLOTS 4             // 后台通道（维护上传）队列长度，控制和音频都空了才发
+#define WS_SEND_BULK_SLOT_BYTES 2048     // 后台消息上限（定时stats JSON、作用域计时）
+
+// 应用层心跳 - 测量RTT，用来调整预缓冲目标和上行合包延迟
+#define WS_HEARTBEAT_INTERVAL_MS 5000    // 心跳间隔，0=关闭
+#define WS_HEARTBEAT_TIMEOUT_MS 15000    // 超过这个时间没有pong就断开重连
+
+// 🕐 统一帧时钟 - 采集分帧、上行编码/合包、下行块和播放块都是这个时长的整数倍，hello里告诉服务器（"frame_ms"）
+// 服务器按它对齐下行消息，设备上只有AFE块 → 帧（capture_ring）一处重新分帧。WakeNet/AFE的块大小由模型决定，不跟它走
+#define AUDIO_FRAME_MS 20
+#define AUDIO_FRAME_SAMPLES (AUDIO_FRAME_MS * 16)   // 16kHz
+#if AUDIO_FRAME_MS != 10 && AUDIO_FRAME_MS != 20 && AUDIO_FRAME_MS != 40 && AUDIO_FRAME_MS != 60
+#error "AUDIO_FRAME_MS必须是Opus支持的帧长（10/20/40/60ms）"
+#endif
+
+// 环形缓冲区容量（样本数，2的幂）- 采集环要装得下整段会话预录的回放
+#define CAPTURE_RING_SAMPLES (64 * 1024)             // 音频前端 → 录音任务（约4秒）
+#define SESSION_PREROLL_CAPACITY_SAMPLES (64 * 1024) // 会话预录（约4秒，SESSION_PREROLL_MS加上唤醒词音频要放得下）
+#define JITTER_BUFFER_SAMPLES (32 * 1024)            // 下行抖动缓冲区（约2秒，下行额度按它的空闲量给）
+
+// 音频帧池配置 - 录音帧预先分配，避免每帧一次malloc/free
+#define AUDIO_FRAME_POOL_SLOTS 24      // 槽位数量（需大于发送队列深度）
+#define AUDIO_FRAME_POOL_USE_PSRAM 0   // 1=放在PSRAM，0=放在内部RAM
+#define AUDIO_SEND_QUEUE_DEPTH 20      // 录音任务 → 上行发送任务的队列深度（每项占一个帧池槽位）
+
+// 任务拓扑 - 所有自建任务的核心和优先级都在这里配置，统一用xTaskCreatePinnedToCore创建
+// 核心0：网络。WiFi驱动(23)、esp_timer(22)、lwIP tcpip(18，sdkconfig中固定到核心0)、
+//        WebSocket收发、上行发送、主任务（CONFIG_ESP_MAIN_TASK_AFFINITY_CPU0）
+// 核心1：音频。I2S采集、AFE降噪/唤醒词、上行编码、播放
+// 所有应用任务的优先级都低于WiFi/lwIP：网络栈不能被音频任务饿死，音频一侧有DMA描述符和抖动缓冲区兜底。
+// 同一核心内按"错过截止时间的代价"排序：播放(I2S欠载可闻) > 采集(DMA块会被覆盖) > AFE > 编码
+#define PLAYBACK_TASK_CORE 1             // 抖动缓冲区 → I2S
+#define PLAYBACK_TASK_PRIORITY 8
+#define AFE_FEED_TASK_CORE 1             // I2S采集任务（在其中feed AFE）
+#define AFE_FEED_TASK_PRIORITY 7
+#define AFE_FETCH_TASK_CORE 1            // AFE处理和唤醒词检测
+#define AFE_FETCH_TASK_PRIORITY 6
+#define AFE_RINGBUF_FRAMES 50            // feed和fetch之间缓冲的块数：采集任务写后面的块时fetch任务在检测前面的块
+#define AUDIO_RECORD_TASK_CORE 1         // 取AFE输出、Opus编码、放入发送队列
+#define AUDIO_RECORD_TASK_PRIORITY 5
+#define AUDIO_SEND_TASK_CORE 0           // 发送队列 → WebSocket
+#define AUDIO_SEND_TASK_PRIORITY 5
+#define WS_TASK_PRIORITY 6               // esp_websocket_client内部收发任务（组件用xTaskCreate创建，无法指定核心）
+#define WORK_QUEUE_TASK_CORE 0           // 🧰 后台工作队列的工作任务：重连、心跳等零碎后台活（见work_queue.h）
+#define WORK_QUEUE_TASK_PRIORITY 4
+#define WS_SEND_TASK_CORE 0              // WebSocket发送任务（所有发送都在这里写socket）
+#define WS_SEND_TASK_PRIORITY 5          // 和上行发送任务同级，唤醒词所在的主任务不再等网络
+#define WS_EVENT_TASK_CORE 0             // WebSocket事件任务：连接状态和文本消息的处理函数（下行音频留在收发任务里）
+#define WS_EVENT_TASK_PRIORITY 4
+#define LOCAL_TTS_TASK_CORE 0            // 离线语音合成（只在连不上服务器时工作，网络核心这时是空的）
+#define LOCAL_TTS_TASK_PRIORITY 3
+#define WIFI_MONITOR_TASK_CORE 0         // 每秒采一次RSSI，漫游时做一次扫描
+#define WIFI_MONITOR_TASK_PRIORITY 2
+#define NETWORK_TASK_CORE 0              // 启动时的WiFi关联和首次连接服务器，完成后退出
+#define NETWORK_TASK_PRIORITY 5
+#define MODEL_COPY_TASK_CORE 0           // 模型权重后台拷进PSRAM（MODEL_RESIDENCY_PSRAM_DEFERRED），拷完退出
+#define MODEL_COPY_TASK_PRIORITY 1
+#define OTA_TASK_CORE 0                  // 下载并写入升级固件（见ota_updater.h），写完退出
+#define OTA_TASK_PRIORITY 1
+#define ASSET_FETCH_TASK_CORE 0          // 📦 下载并写入服务器推送的提示音（见asset_cache.h），下完退出
+#define ASSET_FETCH_TASK_PRIORITY 1
+#define MEDIA_TASK_CORE 0                // 📻 长音频的下载和解码任务（见media_stream.h）
+#define MEDIA_FETCH_TASK_PRIORITY 2
+#define MEDIA_PLAY_TASK_PRIORITY 3       // 解码写抖动缓冲区，和离线语音合成同级
+#define NET_TEST_TASK_CORE 0             // 网络自检（见net_self_test.h），测完退出
+#define NET_TEST_TASK_PRIORITY 2
+#define UDP_AUDIO_TASK_CORE 0            // UDP音频通道的接收任务（见udp_audio.h），和WebSocket收发任务同级
+#define UDP_AUDIO_TASK_PRIORITY 6
+#define SUPERVISOR_TASK_CORE 0           // 看门狗：检查各子系统的心跳，卡住时只重启那一个（见supervisor.h）
+#define SUPERVISOR_TASK_PRIORITY 3
+#define SOAK_LOAD_TASK_CORE 0            // 🔥 浸泡测试的后台WiFi负载（见soak_test.h），只在SOAK_TEST构建里创建
+#define SOAK_LOAD_TASK_PRIORITY 1
+#define DEFERRED_LOG_TASK_CORE 0         // 📮 延迟日志的排空任务（见deferred_log.h）：格式化、写串口都在这里
+#define DEFERRED_LOG_TASK_PRIORITY 1     // 最低一档，串口慢的时候记录积在环里，不拖别的任务
+#define CPU_LOAD_WARN_PERMILLE 900       // 性能统计中某个核心占用超过90%时告警
+// 任务栈放置（见task_factory.h）- 不碰Flash的后台任务栈放PSRAM，内部RAM留给WiFi缓冲区、DMA和实时音频
+#define TASK_INTERNAL_HEAP_WARN_BYTES (48 * 1024)   // 启动完成后内部RAM空闲低于这个值时告警
+// 任务栈大小（内存预算表按这些计算，见memory_budget.h）
+#define NETWORK_TASK_STACK (6 * 1024)
+#define AUDIO_RECORD_TASK_STACK (4 * 1024)
+#define AUDIO_SEND_TASK_STACK (4 * 1024)
+#define PLAYBACK_TASK_STACK (4 * 1024)
+#define I2S_CAPTURE_TASK_STACK (4 * 1024)
+#define AFE_FETCH_TASK_STACK (6 * 1024)
+#define WORK_QUEUE_TASK_STACK (4 * 1024)  // 每个工作任务的栈（PSRAM），要够最深的工作函数用
+#define WORK_QUEUE_WORKERS 2             // 工作任务个数：一个工作在等握手时另一个照常处理心跳和统计
+#define WORK_QUEUE_DEPTH 16              // 每一级优先级最多排队的工作
+// 内存预算（见memory_budget.h）- 每个子系统在内部RAM/PSRAM上最多占多少，编译时检查计划用量，启动后对照实测
+#define MEM_BUDGET_REPORT 1              // 1=启动完成后打印各子系统的实测占用和预算
+#define MEM_INTERNAL_HEAP_BYTES (360 * 1024)         // 启动时内部RAM堆的大致容量（ESP32-S3，实测见报告）
+#define MEM_PSRAM_HEAP_BYTES (7680 * 1024)           // 8MB PSRAM去掉映射和保留区后的堆容量
+#define MEM_BUDGET_WIFI_INTERNAL (64 * 1024)         // 驱动、静态接收缓冲区、lwIP、链路监测任务
+#define MEM_BUDGET_WIFI_PSRAM (32 * 1024)
+#define MEM_BUDGET_NETWORK_INTERNAL (40 * 1024)      // WebSocket/发送/网络/UDP任务栈、mbedTLS
+#define MEM_BUDGET_NETWORK_PSRAM (96 * 1024)         // 收发缓冲区、发送队列、事件任务栈和后台工作任务栈
+#define MEM_BUDGET_BOARD_INTERNAL (32 * 1024)        // I2S的DMA缓冲区和采集任务栈
+#define MEM_BUDGET_BOARD_PSRAM (16 * 1024)
+#define MEM_BUDGET_AUDIO_INTERNAL (72 * 1024)        // 音频任务栈、帧池、发送队列、提示音内存池、混音缓冲区
+#define MEM_BUDGET_AUDIO_PSRAM (768 * 1024)          // 采集环、抖动缓冲区、预录、上行补发缓存、会话存档
+#define MEM_BUDGET_MODELS_INTERNAL (96 * 1024)       // AFE/WakeNet/MultiNet的运行时状态、取数任务栈
+#define MEM_BUDGET_MODELS_PSRAM (4 * 1024 * 1024)    // 模型实例（MODEL_RESIDENCY选PSRAM时还有权重副本）
+
+// 上行合包配置 - 攒够N帧或到达延迟预算后合并为一条WebSocket消息
+#define UPLINK_COALESCE_FRAMES 3         // 每条消息最多合并的20ms帧数（1=不合包）
+#define UPLINK_COALESCE_MAX_DELAY_MS 60  // 第一帧最多等待的时间（测得RTT后按RTT/2调整，不超过这个值）
+
+// 上行存储转发（见uplink_backlog.h）- 会话中WebSocket短暂断开时继续录音，重连后把这句话整句补发
+#define UPLINK_BACKLOG_MS 3000           // 最多缓存的时长（按20ms一帧、每帧一个帧池槽位大小，放在PSRAM），0=断开即丢弃
+
+// 上行Opus编码 - 连接后通过hello消息与服务器协商，服务器确认后才启用
+#define UPLINK_OPUS_ENABLE 1             // 1=编译Opus编码支持，0=只发送PCM
+#define UPLINK_OPUS_BITRATE 24000        // Opus目标码率（bit/s）
+#define UPLINK_OPUS_COMPLEXITY 0         // Opus编码复杂度0~10（0最省CPU，给唤醒词和网络留出余量）
+// 上行码率自适应（见uplink_rate_controller.h）- 按RTT、发送队列积压和发送等待在码率/合包档位之间移动，只对Opus生效
+#define UPLINK_RATE_ADAPT_ENABLE 1       // 0=始终用UPLINK_OPUS_BITRATE和UPLINK_COALESCE_FRAMES
+#define UPLINK_RATE_CHECK_MS 500         // 评估间隔
+#define UPLINK_RATE_RTT_HIGH_MS 300      // 平滑RTT超过这个值算链路吃紧（低于一半才算宽松）
+#define UPLINK_RATE_QUEUE_HIGH_PCT 50    // 上行发送队列/WebSocket音频通道占用超过这个比例算积压
+#define UPLINK_RATE_WAIT_HIGH_MS 100     // 消息在WebSocket发送队列里等这么久算积压
+#define UPLINK_RATE_LOSS_HIGH_PCT 5      // 上行走UDP时服务器报告的丢失率超过这个值算吃紧
+#define UPLINK_RATE_DOWN_CHECKS 2        // 连续这么多次吃紧才降档（1秒内让出带宽）
+#define UPLINK_RATE_UP_CHECKS 10         // 连续这么多次宽松才升档（5秒，避免来回跳）
+#define UPLINK_RATE_MIN_BPS 12000        // 档位表里低于这个码率的不用
+#define UPLINK_RATE_MAX_BPS 32000        // 档位表里高于这个码率的不用
+
+// 流式播放配置 - 抖动缓冲区由独立的高优先级任务消费
+#define PLAYBACK_PREBUFFER_MS 40         // 开始播放（以及欠载后恢复）前预缓冲时长的下限（网络稳定时）
+#define PLAYBACK_PREBUFFER_MAX_MS 300    // 网络抖动大时预缓冲最多加到这么长
+#define PLAYOUT_DELAY_INITIAL_MS 80      // 还没测到下行到达抖动时的预缓冲目标（见playout_delay.h）
+#define PLAYOUT_DELAY_QUANTILE_PERCENT 95    // 预缓冲要盖住这么多比例的下行消息迟到
+#define PLAYBACK_STRETCH_PERCENT 25      // 缓冲低于目标时，回复的静音段最多拉长这么多（每个播放块补几毫秒舒适噪声）
+// 时钟漂移补偿（见playout_drift.h）- I2S时钟和服务器采样时钟不同源，按缓冲区水位估计偏差，分数重采样追回来
+#define PLAYOUT_DRIFT_ENABLE 1           // 0=始终按标称速度播放
+#define PLAYOUT_DRIFT_MAX_PPM 1000       // 补偿量上限（晶振偏差一般在百ppm以内，0.1%的变速听不出来）
+#define PLAYOUT_DRIFT_MIN_PPM 5          // 补偿量达到这么多才打开重采样，否则保持零拷贝
+#define PLAYOUT_DRIFT_FILTER_MS 2000     // 水位低通的时间常数，滤掉网络抖动
+#define PLAYOUT_DRIFT_KP 10              // 比例项：水位偏离参考点1ms补这么多ppm
+#define PLAYOUT_DRIFT_KI 1               // 积分项：偏离1ms持续1秒，偏差估计改这么多ppm
+#define PLAYOUT_DRIFT_BAND_MS 40         // 偏离超过这么多（卡顿、突发）时不更新偏差估计
+#define PLAYOUT_DRIFT_HOLD_MS 200        // 高出参考点这么多时是服务器按额度突发，只沿用已有估计
+#define DOWNLINK_CREDIT_STEP_BYTES 3200  // 下行额度增加这么多字节才上报一次（PCM约100ms）
+#define PLAYBACK_CHUNK_MS AUDIO_FRAME_MS // 每次写入I2S的块时长（一帧）
+#define DOWNLINK_RESAMPLE_ENABLE 1       // hello里下行多带f32_24k：服务器同意时豆包音频原样透传，设备上重采样到16kHz
+
+// 音频帧头 - 上下行音频消息带seq/时间戳（见audio_framing.h），丢包和设备端丢帧可以统计，下行缺口做丢包补偿
+#define AUDIO_FRAMING_ENABLE 1           // 1=在hello里提出"framing":"seq"，服务器同意后两个方向都加帧头
+#define AUDIO_PLC_FADE_MS 20             // 补偿时重复最后10ms，在这么长内淡出，之后补静音
+#define AUDIO_PLC_MAX_MS 200             // 一个缺口最多补这么长
+// 回复播到一半断开：重连的hello带上最后收到的下行seq和没播完的样本数，服务器从那里接着发（需要帧头）
+#define DOWNLINK_RESUME_ENABLE 1
+// UDP音频通道（见udp_audio.h）- 音频消息改走UDP数据报，丢一个包不再卡住后面的音频；控制消息和兜底留在WebSocket（需要帧头）
+#define UDP_AUDIO_ENABLE 1               // 1=在hello里提出"udp"，服务器开了RELAY_UDP_PORT才会同意
+#define UDP_AUDIO_ALLOW_WITH_TLS 0       // 数据报不加密：wss://连接时默认不提出
+#define UDP_AUDIO_TASK_STACK (4 * 1024)
+#define UDP_AUDIO_MAX_DATAGRAM 1200      // 一个数据报的最大载荷（低于常见路径MTU，lwIP默认不重组IP分片）
+#define UDP_AUDIO_REDUNDANCY 1           // 1=放得下时每个数据报附带上一条消息的副本，单个丢包直接补回
+#define UDP_AUDIO_PING_MS 200            // 还没收到PONG时的探测间隔
+#define UDP_AUDIO_PROBE_TIMEOUT_MS 3000  // 这么久没有PONG就放弃UDP，这次连接都走WebSocket
+#define UDP_AUDIO_KEEPALIVE_MS 10000     // 通了之后的PING间隔（保持NAT映射，顺便测UDP的RTT）
+#define UDP_AUDIO_REPORT_MS 1000         // 接收报告的间隔
+#define UDP_AUDIO_REPORT_TIMEOUT_MS 3500 // 上行走UDP时这么久没有服务器的报告，退回WebSocket
+#define UDP_AUDIO_FALLBACK_LOSS_PCT 20   // 一段报告里的丢失率超过这个值算差
+#define UDP_AUDIO_FALLBACK_REPORTS 3     // 连续这么多段差就退回WebSocket（直到重连）
+
+// 播放静音检测 - 每个播放块算一次能量，回复里的静音段换成舒适噪声（不再丢弃"没有变化"的消息）
+#define PLAYBACK_SILENCE_GATE_ENABLE 1
+#define PLAYBACK_SILENCE_RMS 24          // 低于这个RMS算静音（约-63dBFS）
+#define PLAYBACK_VOICE_RMS 48            // 静音状态下高于这个RMS才恢复（滞回）
+#define PLAYBACK_SILENCE_HANGOVER_MS 200 // 持续低于静音阈值这么久才切换，词间停顿保留原样
+#define PLAYBACK_COMFORT_NOISE_MAX_RMS 12  // 舒适噪声电平上限
+
+// 播放混音 - 回复语音、提示音、闹铃叠加成一路I2S输出
+#define MIXER_TTS_GAIN 1.0f              // 各声部增益（0.0~1.0）
+#define MIXER_EARCON_GAIN 1.0f
+#define MIXER_ALARM_GAIN 1.0f
+#define MIXER_DUCK_GAIN 0.3f             // 提示音/闹铃播放时回复语音压低到的增益
+#define MIXER_DUCK_RAMP_MS 100           // 增益渐变时长
+#define MIXER_CROSSFADE_MS 150           // "思考中"提示音被回复语音替换时的淡出时长
+
+// 提示音资源 - tools/convert_audio.py生成prompts.bin，随固件烧录到独立分区
+#define PROMPT_PARTITION_LABEL "prompts"
+#define PROMPT_STREAM_BLOCK_BYTES 1024   // 提示音在Flash上时每次拷进内部RAM的块大小（对齐到缓存行，拷完作废这些行）
+#define PROMPT_GREETING "hi"             // 唤醒后播放的提示音名称（即mp3文件名）
+
+// 服务器推送的提示音（见asset_cache.h）- 按内容哈希缓存在"assets"分区，同名时优先于提示音分区
+#ifndef ASSET_CACHE_ENABLE
+#define ASSET_CACHE_ENABLE 1             // 0=hello里不带"assets"，只用随固件烧录的提示音
+#endif
+#define ASSET_PARTITION_LABEL "assets"
+#define ASSET_MAX_ENTRIES 16             // 清单和分区里最多的条目数
+#define ASSET_MAX_BYTES (64 * 1024)      // 单个提示音的上限（ADPCM约16秒），下载时整个先放进PSRAM
+#define ASSET_HTTP_TIMEOUT_MS 10000
+#define ASSET_WRITE_CHUNK_BYTES 4096     // 每次写Flash的字节数，块之间检查是否空闲（会话开始就停下等）
+#define ASSET_FETCH_TASK_STACK (6 * 1024)  // 内部RAM（要写Flash），TLS握手
+
+// 音频前端（esp-sr AFE）配置 - feed任务读麦克风，fetch任务取出NS/AGC处理后的音频和唤醒/VAD结果
+#define AFE_VAD_MODE VAD_MODE_1          // VAD灵敏度：VAD_MODE_0（最灵敏）~ VAD_MODE_4
+#define AFE_VAD_MIN_SPEECH_MS 128        // 判定为语音的最短时长
+#define AFE_VAD_MIN_NOISE_MS 500         // 判定为静音的最短时长
+#define AFE_AGC_ENABLE 1                 // 1=启用WebRTC AGC
+#define AFE_AEC_ENABLE 1                 // 1=以I2S播放数据为参考信号做回声消除（输入格式"MR"）
+#define AFE_AEC_MAX_REF_LEAD_MS 160      // 参考信号最多领先麦克风的时长，超出部分丢弃防止漂移
+#define AFE_AEC_REF_MARGIN_MS 8          // 标定过扬声器→麦克风延迟时，参考信号比回声多领先这么久（见loopback_calibration.h）
+
+// 实时系数保护（见rtf_guard.h）- 上行处理（喂AFE、AFE处理、Opus编码）持续超出帧时长时依次降Opus复杂度、关降噪、缩短AEC尾长
+#define RTF_GUARD_ENABLE 1               // 0=只统计不降级
+#define RTF_GUARD_WINDOW_MS 500          // 评估窗口（音频时长）
+#define RTF_GUARD_HIGH_PERMILLE 850      // 处理时间超过音频时长的这么多（‰）算超预算
+#define RTF_GUARD_LOW_PERMILLE 600       // 低于这个值算宽松
+#define RTF_GUARD_DOWN_WINDOWS 4         // 连续这么多个窗口超预算才降一级（2秒，短暂的峰值不降）
+#define RTF_GUARD_UP_WINDOWS 20          // 连续这么多个窗口宽松才恢复一级（10秒）
+#define RTF_GUARD_OPUS_COMPLEXITY 0      // 降级时Opus用的复杂度（UPLINK_OPUS_COMPLEXITY不比它高时跳过这一级）
+#define RTF_GUARD_AEC_FILTER_LENGTH 2    // 降级时AEC的滤波器长度（帧，越短回声尾巴消得越少；下次空闲时重建AFE生效）
+
+// 轻量谱减降噪（见spectral_ns.h）- 录音任务里的上行流水线一级，AFE降噪没在运行时替它去掉稳态底噪
+#define UPLINK_LIGHT_NS 1                // 0=不用，1=AFE降噪没在运行（直通模式或被实时系数保护关掉）时用，2=总是用
+#define SPECTRAL_NS_FFT 256              // FFT点数（窗长，跳步为一半；256点在16kHz时输出延迟16ms）
+#define SPECTRAL_NS_OVERSUB 1.5f         // 过减系数：减去这么多倍的噪声功率
+#define SPECTRAL_NS_FLOOR 0.18f          // 增益下限（约-15dB），压得更低残留噪声会变成"音乐噪声"
+#define SPECTRAL_NS_NOISE_RISE_DB 3.0f   // 噪声估计每秒最多上涨的dB（说话期间不把语音当成噪声）
+
+// 扬声器→麦克风延迟标定 - 播一段扫频测回声的真实延迟，按DMA配置存进NVS，用于回声消除对齐和延迟统计
+#define LOOPBACK_CAL_ENABLE 1            // 1=当前DMA配置没标定过时启动后空闲时自动标定一次，服务器发loopback_cal时重新标定
+#define LOOPBACK_CAL_CHIRP_MS 100        // 扫频时长
+#define LOOPBACK_CAL_LEAD_MS 200         // 扫频前的静音（比发送DMA深度长，扫频写入时DMA已经满了）
+#define LOOPBACK_CAL_MAX_MS 300          // 能接受的最大延迟，放完之后也录这么久
+#define LOOPBACK_CAL_F0_HZ 400.0f        // 扫频起止频率
+#define LOOPBACK_CAL_F1_HZ 6000.0f
+#define LOOPBACK_CAL_LEVEL 0.25f         // 扫频幅度（满幅的比例，约-12dBFS）
+#define LOOPBACK_CAL_MIN_SCORE 0.3f      // 麦克风里互相关峰值归一化后至少这么高才算找到
+
+// 唤醒词默认参数 - NVS中保存的值优先（服务器wake_config命令写入，见wake_settings.h）
+#define WAKENET_DET_MODE DET_MODE_90     // DET_MODE_90误唤醒少，DET_MODE_95更灵敏
+#define WAKENET_MODEL ""                 // 主模型名，空=模型分区里第一个唤醒词模型
+#define WAKENET_MODEL_2 ""               // 第二个模型（如WN9S + TTS版本同时运行），空=不启用，"*"=分区里另一个唤醒词模型
+#define WAKENET_THRESHOLD 0.0f           // 检测阈值（0.4~0.9999），0=模型默认
+#define WAKENET_THRESHOLD_2 0.0f
+#define WAKENET_COST_PROBE 1             // 1=启动时逐个测量唤醒词模型的CPU占用和每块detect耗时（每个模型约几十毫秒）
+
+// 唤醒词能量门（见audio_front_end.h）- 空闲时持续安静就暂停WakeNet，一块超过门限立即恢复
+#define WAKE_GATE_ENABLE 1
+#define WAKE_GATE_MIN_LEVEL 40           // 门限下限（块平均绝对值，约-58dBFS）
+#define WAKE_GATE_RATIO 2                // 门限 = 底噪估计 × 倍数（约+6dB）
+#define WAKE_GATE_HOLD_MS 2000           // 最后一块有声音之后WakeNet再跑多久（盖住整个唤醒词和词间停顿）
+
+// 🔥 会话预热 - 空闲时能量门打开（可能是唤醒词的开头）就让服务器先开好豆包会话、断线时提前重连，
+// WakeNet确认后不用再等连接和StartSession（需要WAKE_GATE_ENABLE；服务器RELAY_WARMUP_S内没等到唤醒就释放）
+#define WARMUP_ENABLE 1
+#define WARMUP_MIN_INTERVAL_MS 10000     // 两次预热至少间隔多久（持续的环境噪声不会反复开会话）
+
+// 按键说话（见push_to_talk.h）- 展台等场景按住按键说话，不经过WakeNet，松开立即结束这句话
+#define PUSH_TO_TALK_ENABLE 0
+#define PUSH_TO_TALK_GPIO 0              // ESP32-S3开发板的BOOT键
+#define PUSH_TO_TALK_ACTIVE_LEVEL 0      // 按下时的电平
+#define PUSH_TO_TALK_WAKE_WORD 0         // 1=按键模式下唤醒词照常可用，0=不跑WakeNet
+#define PUSH_TO_TALK_DEBOUNCE_MS 30      // 按下/松开生效后这段时间内的抖动不看
+#define PUSH_TO_TALK_RELEASE_MS 20       // 松开后无效电平持续这么久才结束这句话
+#define PUSH_TO_TALK_PREROLL_MS 200      // 按下之前的音频补发这么多（手比嘴慢一点的情况）
+#define PUSH_TO_TALK_CONNECT_MS 2000     // 按下时WebSocket还没连上，最多等这么久
+
+// 🌙 深度睡眠和快速恢复（见fast_resume.h）- 电池供电时空闲一段时间进深度睡眠，醒来沿用睡前的AP、校准和服务器会话
+// 唤醒源：PUSH_TO_TALK_ENABLE时按键（PUSH_TO_TALK_GPIO要是RTC GPIO），DEEP_SLEEP_TIMER_MS>0时定时；都没有时不睡
+#define DEEP_SLEEP_ENABLE 0              // 1=空闲DEEP_SLEEP_IDLE_MS后进深度睡眠（睡眠期间听不到唤醒词）
+#define DEEP_SLEEP_IDLE_MS 600000        // 连续空闲（没有会话、没有播放）这么久才睡
+#define DEEP_SLEEP_TIMER_MS 0            // 定时醒来（0=只有按键唤醒）
+
+// 模型权重驻留位置（见model_loader.h）- 拷到PSRAM要占用和映射段一样大的PSRAM（模型日志里的"映射xxKB"）
+#define MODEL_RESIDENCY_FLASH 0          // 从Flash映射读取（默认）
+#define MODEL_RESIDENCY_PSRAM_BOOT 1     // 启动时拷进PSRAM，加载多花几百毫秒
+#define MODEL_RESIDENCY_PSRAM_DEFERRED 2 // 网络就绪后后台拷贝，空闲时重建AFE切过去
+#define MODEL_RESIDENCY MODEL_RESIDENCY_FLASH
+
+// 固件升级（见ota_updater.h）- 服务器下发差分补丁或完整镜像的地址，写进另一个OTA分区，重启后验证
+#define OTA_ENABLE 1                     // 0=忽略服务器的升级请求（刚升级的固件照常验证和回滚）
+#define OTA_VERIFY_TIMEOUT_MS 300000     // 新固件启动后这么久还没和服务器完成hello就回滚到上一个固件
+#define OTA_HTTP_TIMEOUT_MS 10000        // 下载时单次读取的超时
+#define OTA_TASK_STACK (6 * 1024)
+
+// 📻 长音频直连（见media_stream.h）- 服务器只发地址，设备用HTTP(S)直接下载WAV（16kHz单声道PCM16/IMA-ADPCM）
+#define MEDIA_STREAM_ENABLE 1            // 0=忽略服务器的media消息（不分配预取环）
+#define MEDIA_PREFETCH_BYTES (128 * 1024)    // PSRAM预取环，2的幂：PCM约4秒，ADPCM约16秒
+#define MEDIA_PREFETCH_START_MS 1500     // 预取这么多音频才开始出声（文件更短时下载完就播）
+#define MEDIA_HTTP_TIMEOUT_MS 5000       // 单次读取的超时，超时后按Range重连
+#define MEDIA_RETRY_MAX 3                // 连续重连失败这么多次放弃（间隔按次数递增MEDIA_RETRY_DELAY_MS）
+#define MEDIA_RETRY_DELAY_MS 500
+#define MEDIA_TASK_STACK (6 * 1024)      // 下载任务（TLS握手）
+
+// 延迟追踪 - 每轮对话结束输出唤醒/说完/首包下行/出声等节点的耗时（见latency_trace.h）
+#define LATENCY_TRACE_REPORT 1           // 1=同时把本轮耗时发给服务器，与服务器端日志对齐
+
+// 子系统看门狗（见supervisor.h）- I2S通道、WebSocket卡住时只重建那一部分，模型和WiFi不动
+#define SUPERVISOR_ENABLE 1
+#define SUPERVISOR_CHECK_MS 100          // 检查间隔
+#define SUPERVISOR_CAPTURE_TIMEOUT_MS 500        // 采集多久没有DMA块算卡住
+#define SUPERVISOR_PLAYBACK_TIMEOUT_MS 1000      // 播放期间写I2S多久没有进展算卡住
+#define SUPERVISOR_WS_TIMEOUT_MS 20000           // 发送任务单次写socket多久没返回算卡住（组件自己的网络超时是15秒）
+#define SUPERVISOR_MAX_RECOVERIES 3      // 同一子系统SUPERVISOR_RECOVERY_WINDOW_MS内热重启超过这么多次就整机重启
+#define SUPERVISOR_RECOVERY_WINDOW_MS 60000
+#define SUPERVISOR_LOCK_TIMEOUT_MS 200        // 热重启时等被卡住的子系统放锁的时间，拿不到就整机重启
+
+// 性能计数器 - 丢帧/欠载/队列水位/内存/任务CPU占用汇总上报（见perf_counters.h）
+#define PERF_REPORT_INTERVAL_MS 30000    // 连接期间定时上报间隔，服务器发get_stats时立即上报
+#define FLIGHT_RECORDER_ENABLE 1         // 1=关键事件记在RTC内存里，软件复位/崩溃后下次连上服务器时上传（见flight_recorder.h）
+#define FLIGHT_RECORDER_EVENTS 256       // 环形数组的事件数（2的幂，每个8字节，放在RTC慢速内存）
+#define FLIGHT_RECORDER_TICK_MS 1000     // 主循环心跳间隔（内部RAM空闲、发送队列深度）
+#define PERF_HISTORY_ENABLE 1            // 1=丢帧/欠载/复位等累计值存进NVS，跨重启保留，hello之后上报增量（见perf_history.h）
+#define PERF_HISTORY_SAVE_MS 900000      // 两次写NVS最少间隔（只在空闲时写），崩溃时最多丢这么久的计数
+#define FLASH_SCHEDULER_ENABLE 1         // 1=服务器下发的参数、记住AP等不急的NVS写入推迟到空闲时再写（见flash_scheduler.h）
+#define FLASH_SCHEDULER_SETTLE_MS 3000   // 回到空闲之后再等这么久才写（刚结束的会话马上又唤醒时不受影响）
+#define FLASH_STALL_WARN_US 20000        // 单次写Flash超过这么久记进黑匣子（会话期间的还打一行警告）
+
+// 后台上传调度（见upload_scheduler.h）- 定时统计、跨重启累计、黑匣子走WebSocket后台通道，按令牌桶限速
+#define UPLOAD_IDLE_BYTES_PER_SEC 8192   // 空闲时的限速
+#define UPLOAD_SESSION_BYTES_PER_SEC 1024 // 会话进行中的限速，0=会话中不发
+#define UPLOAD_BURST_BYTES 4096          // 桶深（攒着没发时一次最多发这么多）
+#define UPLOAD_WAKE_PAUSE_MAX_MS 8000    // 唤醒后暂停到第一条下行音频，最多暂停这么久
+// 🤝 hello协商的版本：设备先报能力（"v"和"features"），服务器回它选定的版本和参数；
+// 没有"v"的hello按1处理，新旧固件和新旧服务器可以混着用
+#define HELLO_PROTOCOL_VERSION 2
+#define CONTROL_BINARY_ENABLE 1          // 1=在hello里提出用二进制控制帧（见control_protocol.h），0=只用JSON文本
+#define SESSION_CAPTURE_ENABLE 1         // 1=服务器录制会话时上报设备端时间戳（见session_capture.h，需要二进制控制帧）
+#define SESSION_CAPTURE_FLUSH_MS 250     // 设备端时间戳攒不满一帧时最多等这么久再发
+
+// 堆监控（见heap_monitor.h）- 定时采样各类堆的空闲量/最大连续块/分配速率，随stats上报
+#define HEAP_MONITOR_SAMPLE_MS 5000      // 采样间隔（分配速率按这个周期平均）
+#define HEAP_MONITOR_LARGEST_WARN_BYTES (16 * 1024)  // 内部RAM最大连续块低于这个值时告警
+#ifndef HEAP_MONITOR_SITES
+#define HEAP_MONITOR_SITES 0             // 1=按调用栈统计分配点（调试用，每次分配都要回溯栈，需要CONFIG_HEAP_USE_HOOKS）
+#endif
+#define HEAP_MONITOR_SITE_SLOTS 32       // 分配点统计表大小
+#define HEAP_MONITOR_SITE_SKIP 2         // 跳过钩子自身的栈帧数
+#define HEAP_MONITOR_SITE_FRAMES 3       // 每个分配点记录的PC层数
+#define HEAP_MONITOR_SITE_REPORT 10      // get_stats时上报次数最多的前N个分配点
+#define HEAP_TRIPWIRE_ENABLE 1           // 1=启动完成后的每次分配计入late_allocs，第一次出现时告警（需要CONFIG_HEAP_USE_HOOKS）
+
+// 调度追踪（见sched_trace.h）- 构建参数 idf.py -DSCHED_TRACE_MODE=1 build（SystemView）或 =2（发给服务器）
+#ifndef SCHED_TRACE_MODE
+#define SCHED_TRACE_MODE 0               // 0=关闭，热路径上的标记宏展开为空
+#endif
+#define SCHED_TRACE_DEFAULT_MS 5000      // 服务器没给ms时的记录窗口
+#define SCHED_TRACE_MAX_MS 60000         // 记录窗口上限
+
+// 音频流水线每级计时（见audio_pipeline.h）- 构建参数 idf.py -DAUDIO_PIPELINE_TIMING=1 build
+#ifndef AUDIO_PIPELINE_TIMING
+#define AUDIO_PIPELINE_TIMING 0          // 0=不计时，各级之间没有任何额外开销
+#endif
+#define AUDIO_PIPELINE_REPORT_MS 10000   // 计时打开时录音任务每隔这么久打一次各级耗时
+
+// 作用域计时直方图（见scope_timer.h）- 构建参数 idf.py -DSCOPE_TIMERS=1 build
+#ifndef SCOPE_TIMERS
+#define SCOPE_TIMERS 0                   // 0=SCOPE_TIMER宏展开为空，不读周期计数器
+#endif
+#define SCOPE_TIMER_BUCKETS 16           // 每个计时点的log2桶数
+#define SCOPE_TIMER_SHIFT 8              // 桶0的上限是2^(SHIFT+1)个周期（240MHz时约2.1us）
+
+// 网络自检（见net_self_test.h）- 服务器发net_test时在空闲状态下测吞吐/RTT
+#define NET_TEST_TASK_STACK (4 * 1024)
+#define NET_TEST_DEFAULT_MS 5000         // 服务器没给ms时的测试时长
+#define NET_TEST_MAX_MS 30000            // 测试时长上限
+#define NET_TEST_DEFAULT_SIZE 1024       // 每条测试消息的字节数（ws模式不超过上行音频通道的槽位）
+#define NET_TEST_PING_MS 100             // ws模式的RTT探测间隔
+#define NET_TEST_DRAIN_MS 500            // 测完再等这么久收最后的回应和下行
+
+// 热路径日志（见log_throttle.h）- 同一位置的告警限频输出，发布配置下整体编译掉
+#ifndef LOG_RELEASE_PROFILE
+#define LOG_RELEASE_PROFILE 0            // 1=发布配置，也可以用 idf.py -DLOG_RELEASE_PROFILE=1 打开
+#endif
+#define LOG_RATE_LIMIT_MS 2000           // 同一调用点的最小输出间隔
+// 📮 延迟日志（见deferred_log.h）- 热路径日志只写进无锁环，排空任务在网络核心上格式化、写串口
+#ifndef DEFERRED_LOG_ENABLE
+#define DEFERRED_LOG_ENABLE 1            // 0=HOT_LOGx在调用方的任务里直接输出（主机基准测试这样编译）
+#endif
+#define DEFERRED_LOG_SLOTS 64            // 环的槽位数（2的幂），每个槽位36字节，放在内部RAM
+#define DEFERRED_LOG_POLL_MS 20          // 排空间隔：日志最多晚这么久出现
+#define DEFERRED_LOG_TASK_STACK (3 * 1024)
+#if LOG_RELEASE_PROFILE
+#undef HEAP_MONITOR_SITES
+#define HEAP_MONITOR_SITES 0             // 发布配置不做分配点统计
+#endif
+
+// 打断（barge-in）- 播放回复时检测到用户说话，立即停止播放并通知服务器
+#define BARGE_IN_ENABLE 1
+
+// 🔇 半双工上行 - 没有回声消除时，播放回复和提示音期间（加上停止后的HALF_DUPLEX_TAIL_MS）不上传，
+// 喇叭的声音不占上行带宽，也不会被豆包当成用户又说了一句；这时打断也不生效（触发它的只会是回声）
+#define HALF_DUPLEX_MODE 1               // 0=关闭，1=AEC没有启用时自动打开，2=总是打开
+#define HALF_DUPLEX_TAIL_MS 300          // 播放停止后再等多久恢复上传（DMA里剩下的和房间混响）
+
+// VAD上行门控 - 唤醒后只上传说话部分，说完立即发送speech_end让服务器结束本轮识别
+#define UPLINK_VAD_GATE_ENABLE 1         // 0=唤醒后持续上传所有音频
+#define UPLINK_VAD_PREROLL_MS 300        // 开始说话时补发的预录时长（需大于AFE_VAD_MIN_SPEECH_MS）
+#define UPLINK_VAD_HANGOVER_MS 200       // VAD判定静音后继续上传的时长
+
+// 对话会话（见conversation_session.h）- 回复播完后不用再唤醒就能接着说，没人说话时释放服务器上的豆包会话
+#define CONVERSATION_FOLLOW_UP_MS 8000   // 唤醒后和每轮回复播完后等用户开口的时长，超时回到空闲（WebSocket不断开）
+#define CONVERSATION_IDLE_TIMEOUT_MS 15000  // 说完后这么久没有任何下行音频也结束会话
+// 靠VAD门控判断有没有人说话，UPLINK_VAD_GATE_ENABLE为0时门一直开着，会话不会超时
+
+// "思考中"提示音（见thinking_filler.h）- 说完后迟迟没有回复音频时本地先出声，免得用户以为没听见又问一遍
+#define THINKING_EARCON_ENABLE 1
+#define PROMPT_THINKING "thinking"       // 提示音名称（没有thinking.mp3时convert_audio.py合成一段）
+#define THINKING_EARCON_DELAY_MS 1200    // 说完这么久还没有下行音频就播
+#define THINKING_EARCON_EARLY_MS 400     // 服务器预估（reply_eta）超过DELAY时提前到说完后这么久播
+#define THINKING_EARCON_REPEAT_MS 3000   // 还没有回复时每隔这么久再播一次
+#define THINKING_EARCON_MAX_PLAYS 3      // 每轮最多播几次
+
+// 会话预录 - 空闲时持续缓存最近的音频，唤醒后从唤醒词结束处开始上传，提示音不再阻塞录音
+#define SESSION_PREROLL_MS 2000          // 唤醒后最多保留的时长（放在PSRAM；需盖住本地命令词窗口）
+
+// 唤醒二次确认 - 服务器有更重的唤醒词模型时（hello里协商"wake_verify"），唤醒词那段音频留在会话预录里，
+// 作为会话上行最前面的WAKE_VERIFY_MS发给服务器复核；复核通过才转给豆包，没通过时服务器回wake_verdict，
+// 设备立即取消这次唤醒（停止上传和提示音，回到空闲）
+#define WAKE_VERIFY_ENABLE 1             // 0=不提出复核，唤醒词音频照旧在唤醒时丢掉
+#define WAKE_VERIFY_MS 1200              // 唤醒时保留的唤醒词音频时长（会话预录相应地多留这么多）
+#define WAKE_CLIP_LEAD_MS 150            // AFE给出了唤醒词长度时只留这么长再往前这么多，复核片段更短（不超过WAKE_VERIFY_MS）
+// 唤醒词修剪 - WakeNet在最后一个字没念完时就会触发，触发之后的这一段还是唤醒词的尾音，不交给云端识别
+// （不复核时设备直接跳过；复核时照常上传，session_start的wake_end告诉服务器从哪里开始转给豆包）
+#define WAKE_TRIM_TAIL_MS 100
+
+// 本地命令词（见local_commands.h）- 唤醒后先在设备上识别调音量/停止/再说一遍，命中就不走云端
+#define LOCAL_COMMAND_ENABLE 1           // 0=唤醒后直接上传（不加载MultiNet模型）
+#define LOCAL_COMMAND_WINDOW_MS 1500     // 唤醒后等待命令词的时长，超时再上传（这段音频从会话预录补发）
+#define LOCAL_VOLUME_STEP 0.2f           // 每次调音量改变的比例（相对MIXER_*_GAIN）
+#define LOCAL_VOLUME_MIN 0.2f            // 调小音量的下限，避免调到完全没声音
+#define PROMPT_LOCAL_ACK "hi"            // 本地命令执行后的确认提示音
+
+// "再说一遍"本地重放（见reply_cache.h）- 播放回复时把下行音频存进PSRAM，重放不走网络；没有缓存时再问服务器
+#define REPLY_CACHE_ENABLE 1
+#define REPLY_CACHE_BYTES (256 * 1024)   // ADPCM下行约32秒，PCM约8秒，更长的回复退回服务器重放
+#define REPLY_REPEAT_GPIO -1             // 重放按键（按下时的电平同PUSH_TO_TALK_ACTIVE_LEVEL），-1=只用命令词
+
+// 离线语音合成（见local_tts.h）- 连不上服务器时用esp-tts在设备上播报，不再静默回到空闲
+#define LOCAL_TTS_ENABLE 1               // 0=不使用（voice_data分区可以不烧）
+#define LOCAL_TTS_PARTITION_LABEL "voice_data"
+#define LOCAL_TTS_SPEED 3                // 语速：0（最慢）~ 5（最快）
+#define LOCAL_TTS_TEXT_OFFLINE "网络连接不上，请稍后再试"
+#define LOCAL_TTS_TEXT_NO_REPLY "网络断开了，没有可以重复的内容"
+#define LOCAL_TTS_TEXT_BUSY "现在使用的人太多，请稍后再试"    // 服务器回复busy（上游会话满了）时播报
+
+// 会话录音存档 - 调试抓音或本地回放用，整轮上行音频额外存一份到PSRAM（0=关闭，不分配内存）
+#define SESSION_CAPTURE_SEC 0            // 最长存档时长，每秒占用32KB
+
+// 会话内存池 - 提示音片段和解码缓冲区从预分配的内部RAM里切出，避免每轮对话反复malloc
+#define SESSION_ARENA_BYTES (12 * 1024)  // 约4条同时排队的Flash提示音（解码缓冲+拷贝块），不够时退回堆分配
+
+// 功放电源管理 - 播放结束后保持功放和I2S通道工作一段时间，下一轮回复不用重新唤醒功放
+#define AMP_LINGER_MS 5000               // 余温期：这么久没有播放才关闭功放
+#define AMP_OFF_SETTLE_MS 100            // 关闭功放后等这么久再禁用I2S通道（避免爆音）
+#define AMP_WAKEUP_MS 10                 // 冷启动时打开功放后的等待时间
+#define I2S_SINK_WRITE_TIMEOUT_MS 200    // 播放任务写一块最多等这么久（正常只等一个DMA描述符），超时丢掉没写进去的部分
+#define I2S_SINK_WRITE_SLICE_MS 4        // 写一块时每等这么久就检查一次打断请求，打断最多晚这么久生效
+#define I2S_SINK_STALL_MS 60             // 写一块时连续这么久一个字节都没写进去记一次卡死（正常最多等一个描述符）
+#define PLAYBACK_DRAIN_TIMEOUT_MS 200    // 回复结束时最多等这么久让DMA里的尾巴播完，再算播放结束
+#define PLAYBACK_ABORT_FADE_MS 4         // 打断/停止时清空DMA后从当前电平淡出到0的时长（避免爆音）
+#define PLAYBACK_ABORT_WAIT_MS 20        // stop_streaming_playback()最多等播放任务这么久完成清空
+
+// 麦克风采集位宽 - INMP441输出24位数据（左对齐在32位槽中），32位采集可以保留低位、提高信噪比
+#define MIC_CAPTURE_BITS 32              // 16=只取高16位（旧行为），32=读32位再移位收窄
+#define MIC_CAPTURE_SHIFT 14             // 32位采集时的右移位数：16=与16位采集电平相同，每少1位+6dB
+
+// 麦克风上电稳定检测 - INMP441时钟起来后先输出全零、再有一段衰减的直流冲击，逐块看直流和能量收敛了就开始采集
+#define MIC_SETTLE_MIN_MS 20             // 至少丢弃这么久（每块约8~16ms）
+#define MIC_SETTLE_MAX_MS 400            // 最多等这么久，到了不管稳没稳都开始采集（原来固定丢弃24KB约375ms）
+#define MIC_SETTLE_STABLE_BLOCKS 3       // 连续这么多块稳定才算稳定
+#define MIC_SETTLE_DC_DELTA 4096         // 相邻两块直流之差的上限（24位满量程的计数，约-66dBFS）
+#define MIC_SETTLE_ENERGY_RATIO 4.0f     // 相邻两块交流能量之比的上限（约±6dB）
+
+// 双麦克风 - 第二个INMP441的L/R脚接3.3V（右声道），WS/SCK/SD与第一个并联
+#define MIC_CHANNELS 1                   // 1=单麦克风（左声道），2=立体声采集，AFE做双麦克风波束形成（输入格式"MMR"）
+#define MIC_SPACING_M 0.065f             // 两个麦克风的间距（米），用于声源方向估计
+#define AFE_DOA_ENABLE 1                 // 双麦克风时估计说话人方向（0~180°），唤醒时记录并随session_start上报
+#define AFE_DOA_RESOLUTION_DEG 20.0f     // 方向搜索的角度分辨率
+
+// I2S全双工 - 功放的BCLK/LRC改接麦克风的SCK/WS（GPIO5/GPIO4），采集和播放是同一个端口上的一对通道，
+// 按同一个时钟逐样本对齐（AEC的参考信号不漂移），省下一个I2S外设和一套DMA中断。
+// 播放的采样率固定为采集的16kHz，DMA配置跟着采集（播放缓冲变深），见README「I2S全双工」
+#define I2S_FULL_DUPLEX 0                // 1=单端口全双工（要改接线），0=采集I2S0、播放I2S1各用各的时钟
+
+// I2S DMA配置 - 每个DMA帧（frame_num）对齐到一次读写的块大小，减少中断次数和不完整的读取
+#define I2S_DMA_PROFILE_LOW_LATENCY 0    // 小帧：块内分两次中断，播放缓冲更浅，延迟更低
+#define I2S_DMA_PROFILE_LOW_CPU 1        // 大帧：每块正好一次中断，CPU占用更低
+#define I2S_DMA_PROFILE I2S_DMA_PROFILE_LOW_CPU
+#define I2S_RX_CHUNK_SAMPLES 512         // WakeNet/AFE每次feed的样本数（16kHz下32ms）
+#define I2S_TX_CHUNK_SAMPLES AUDIO_FRAME_SAMPLES  // 播放任务每次写入的样本数（一帧）
+#if I2S_DMA_PROFILE == I2S_DMA_PROFILE_LOW_LATENCY
+#define I2S_RX_DMA_FRAME_NUM (I2S_RX_CHUNK_SAMPLES / 2)
+#define I2S_RX_DMA_DESC_NUM 8
+#define I2S_TX_DMA_FRAME_NUM (I2S_TX_CHUNK_SAMPLES / 2)
+#define I2S_TX_DMA_DESC_NUM 4
+#elif I2S_RX_CHUNK_SAMPLES * MIC_CHANNELS * MIC_CAPTURE_BITS / 8 > 4092
+// 双麦克风32位采集时一块超过单个DMA描述符的上限（4092字节），拆成两个描述符，总缓冲时长不变
+#define I2S_RX_DMA_FRAME_NUM (I2S_RX_CHUNK_SAMPLES / 2)
+#define I2S_RX_DMA_DESC_NUM 12
+#define I2S_TX_DMA_FRAME_NUM I2S_TX_CHUNK_SAMPLES
+#define I2S_TX_DMA_DESC_NUM 4
+#else
+#define I2S_RX_DMA_FRAME_NUM I2S_RX_CHUNK_SAMPLES
+#define I2S_RX_DMA_DESC_NUM 6
+#define I2S_TX_DMA_FRAME_NUM I2S_TX_CHUNK_SAMPLES
+#define I2S_TX_DMA_DESC_NUM 4
+#endif
+#if I2S_FULL_DUPLEX
+// 收发两个通道是一次i2s_new_channel创建的，共用一套DMA配置
+#undef I2S_TX_DMA_FRAME_NUM
+#undef I2S_TX_DMA_DESC_NUM
+#define I2S_TX_DMA_FRAME_NUM I2S_RX_DMA_FRAME_NUM
+#define I2S_TX_DMA_DESC_NUM I2S_RX_DMA_DESC_NUM
+#endif
+
+// 麦克风输入调理 - 在bsp_get_feed_data中用esp-dsp向量指令做去直流和增益（全部关闭时零开销）
+#define MIC_DC_BLOCK_ENABLE 0            // 1=去除麦克风直流偏置
+#define MIC_INPUT_GAIN 1.0f              // 输入增益（饱和处理），1.0=不调整
+#define MIC_CONDITIONER_PROFILE 0        // 1=定期打印每块处理耗费的CPU周期
+
+// 缓冲区放置 - 音频缓冲区按用途放在DMA可达的内部RAM/内部RAM/PSRAM（见buffer_placement.h）
+#define BUFFER_PLACEMENT_REPORT 1        // 1=唤醒就绪后打印每个缓冲区实际所在的内存和对齐
+#define BUFFER_PLACEMENT_BENCHMARK 0     // 1=启动时测一次各种放置组合的memcpy吞吐（约几十ms，临时占用约300KB PSRAM）
+
+// 实时音频配置 - 开关是构建参数 -DREALTIME_AUDIO_PROFILE=1（见realtime_audio.h）
+#define REALTIME_AUDIO_BENCHMARK 0       // 1=启动时测一次采集/播放热路径在指令cache冷/热时的耗时
+
+// DSP基准测试模式（见dsp_benchmark.h）- 打开后固件只跑基准测试：不连网络、不启动音频任务，测完停住
+#define DSP_BENCHMARK 0
+#define DSP_BENCHMARK_PROMPT "custom"    // 输入音频取自提示音分区里的这一条，分区没烧录时用合成信号
+#define DSP_BENCHMARK_SEC 4              // 输入循环到这么长（PSRAM里每秒32KB）
+#define DSP_BENCHMARK_STACK (16 * 1024)  // 每个测试任务的栈，报告里的栈使用量可用来确定上线任务的栈大小
+
+// 🔥 浸泡测试（见soak_test.h）- 开关是构建参数 -DSOAK_TEST=1：定时自动唤醒、随机断线、后台WiFi负载，
+// 配合中继的RELAY_SOAK_PROFILE（合成的突发、抖动回复，不走豆包），定时上报堆碎片、欠载、丢弃和延迟分位数
+#ifndef SOAK_TEST
+#define SOAK_TEST 0
+#endif
+#define SOAK_WAKE_INTERVAL_MS 20000      // 回到空闲后隔这么久自动唤醒一次
+#define SOAK_WAKE_JITTER_MS 10000        // 间隔再随机加上0~这么久，避开和定时任务同相
+#define SOAK_SPEAK_MS 3000               // 唤醒后这么久发speech_end（中继不看上行内容，麦克风收到什么都行）
+#define SOAK_DISCONNECT_PERMILLE 150     // 每次会话主动断开WebSocket的概率（‰），走会话中重连的路径
+#define SOAK_DISCONNECT_WINDOW_MS 8000   // 断开时刻在唤醒后0~这么久里随机选
+#define SOAK_LOAD_KBPS 256               // 后台WiFi负载：向网关的discard端口（UDP 9）发的码率，0=不加负载
+#define SOAK_LOAD_PACKET_BYTES 1024      // 每个负载数据报的字节数
+#define SOAK_LOAD_TASK_STACK (3 * 1024)
+#define SOAK_REPORT_MS 60000             // 浸泡报告的间隔
+#define SOAK_LATENCY_SAMPLES 256         // 延迟分位数按最近这么多轮算
+
+// 🪶 低内存配置 - 没有PSRAM的ESP32-S3模组（N8/N16），构建参数 idf.py -DLOW_MEMORY_PROFILE=1，配合sdkconfig.defaults.nopsram。
+// 所有缓冲区和任务栈都在内部RAM里：环形缓冲区缩到实际需要的长度，不要会话存档、回复缓存、上行补发缓存和长音频预取环，
+// 不加载MultiNet和离线语音合成，唤醒词只跑一个WakeNet9s，WebSocket收发缓冲区和发送队列减半；
+// 提示音照常从Flash按PROMPT_STREAM_BLOCK_BYTES边读边解码ADPCM，服务器推送的提示音要整条先下到内存里，不用。
+// 内存预算把PSRAM那部分也算进内部RAM，编译时检查连同WiFi收发缓冲区的峰值一起放得下（见memory_budget.cc）
+#ifndef LOW_MEMORY_PROFILE
+#define LOW_MEMORY_PROFILE 0
+#endif
+#if LOW_MEMORY_PROFILE
+#undef WIFI_PERF_PROFILE
+#define WIFI_PERF_PROFILE 0              // 省内存的WiFi配置，运行时参数也不能再切到更大的
+#undef WS_BUFFER_BYTES
+#define WS_BUFFER_BYTES 4096             // 仍然放得下EVENT_DATA_BYTES的文本消息，下行音频本来就分段
+#undef WS_MIN_TCP_WND
+#define WS_MIN_TCP_WND 5760              // 4个MSS（sdkconfig.defaults.nopsram），WiFi突发的动态缓冲区按它算
+#undef WS_MIN_TCP_SND_BUF
+#define WS_MIN_TCP_SND_BUF 5760
+#undef WS_SEND_CONTROL_SLOTS
+#define WS_SEND_CONTROL_SLOTS 4
+#undef WS_SEND_AUDIO_SLOTS
+#define WS_SEND_AUDIO_SLOTS 6            // 合包后约360ms
+#undef WS_SEND_BULK_SLOTS
+#define WS_SEND_BULK_SLOTS 2
+#undef UDP_AUDIO_ENABLE
+#define UDP_AUDIO_ENABLE 0               // 省下接收任务和重排缓冲区
+#undef CAPTURE_RING_SAMPLES
+#define CAPTURE_RING_SAMPLES (8 * 1024)  // 约0.5秒
+#undef SESSION_PREROLL_CAPACITY_SAMPLES
+#define SESSION_PREROLL_CAPACITY_SAMPLES (8 * 1024)
+#undef SESSION_PREROLL_MS
+#define SESSION_PREROLL_MS 500           // 连接常驻时唤醒到开始上传只有几十毫秒
+#undef JITTER_BUFFER_SAMPLES
+#define JITTER_BUFFER_SAMPLES (8 * 1024) // 约0.5秒，服务器按下行额度少发
+#undef PLAYBACK_PREBUFFER_MAX_MS
+#define PLAYBACK_PREBUFFER_MAX_MS 200
+#undef AUDIO_FRAME_POOL_SLOTS
+#define AUDIO_FRAME_POOL_SLOTS 12
+#undef AUDIO_SEND_QUEUE_DEPTH
+#define AUDIO_SEND_QUEUE_DEPTH 10
+#undef UPLINK_BACKLOG_MS
+#define UPLINK_BACKLOG_MS 0              // 会话中断线时这句话丢掉
+#undef REPLY_CACHE_ENABLE
+#define REPLY_CACHE_ENABLE 0             // "再说一遍"交给服务器重放
+#undef SESSION_CAPTURE_SEC
+#define SESSION_CAPTURE_SEC 0
+#undef MEDIA_STREAM_ENABLE
+#define MEDIA_STREAM_ENABLE 0
+#undef ASSET_CACHE_ENABLE
+#define ASSET_CACHE_ENABLE 0
+#undef LOCAL_COMMAND_ENABLE
+#define LOCAL_COMMAND_ENABLE 0           // 不加载MultiNet，唤醒后直接上传
+#undef LOCAL_TTS_ENABLE
+#define LOCAL_TTS_ENABLE 0
+#undef WAKE_VERIFY_ENABLE
+#define WAKE_VERIFY_ENABLE 0             // 唤醒词音频不留在预录里
+#undef WAKENET_MODEL_2
+#define WAKENET_MODEL_2 ""
+#undef AFE_RINGBUF_FRAMES
+#define AFE_RINGBUF_FRAMES 8
+#undef AFE_AEC_ENABLE
+#define AFE_AEC_ENABLE 0                 // 不做回声消除，HALF_DUPLEX_MODE=1时播放期间自动不上传
+#undef PROMPT_STREAM_BLOCK_BYTES
+#define PROMPT_STREAM_BLOCK_BYTES 512
+#undef SESSION_ARENA_BYTES
+#define SESSION_ARENA_BYTES (8 * 1024)
+#undef DSP_BENCHMARK_SEC
+#define DSP_BENCHMARK_SEC 1
+#undef TASK_INTERNAL_HEAP_WARN_BYTES
+#define TASK_INTERNAL_HEAP_WARN_BYTES (24 * 1024)
+#undef MEM_PSRAM_HEAP_BYTES
+#define MEM_PSRAM_HEAP_BYTES 0
+#undef MEM_BUDGET_WIFI_INTERNAL
+#define MEM_BUDGET_WIFI_INTERNAL (48 * 1024)
+#undef MEM_BUDGET_WIFI_PSRAM
+#define MEM_BUDGET_WIFI_PSRAM 0
+#undef MEM_BUDGET_NETWORK_INTERNAL
+#define MEM_BUDGET_NETWORK_INTERNAL (76 * 1024)   // 收发缓冲区、发送队列和工作队列的栈也在内部RAM
+#undef MEM_BUDGET_NETWORK_PSRAM
+#define MEM_BUDGET_NETWORK_PSRAM 0
+#undef MEM_BUDGET_BOARD_INTERNAL
+#define MEM_BUDGET_BOARD_INTERNAL (24 * 1024)
+#undef MEM_BUDGET_BOARD_PSRAM
+#define MEM_BUDGET_BOARD_PSRAM 0
+#undef MEM_BUDGET_AUDIO_INTERNAL
+#define MEM_BUDGET_AUDIO_INTERNAL (76 * 1024)   // 采集环、预录和抖动缓冲区各16KB，加上任务栈
+#undef MEM_BUDGET_AUDIO_PSRAM
+#define MEM_BUDGET_AUDIO_PSRAM 0
+#undef MEM_BUDGET_MODELS_INTERNAL
+#define MEM_BUDGET_MODELS_INTERNAL (88 * 1024)   // AFE（NS/VAD用WebRTC的）和WakeNet9s的运行时状态
+#undef MEM_BUDGET_MODELS_PSRAM
+#define MEM_BUDGET_MODELS_PSRAM 0
+#endif
+
+#if LOCAL_COMMAND_ENABLE && LOCAL_COMMAND_WINDOW_MS > SESSION_PREROLL_MS
+#error "LOCAL_COMMAND_WINDOW_MS不能超过SESSION_PREROLL_MS，否则转云端时开头的话会丢"
+#endif
+
+#if (SESSION_PREROLL_MS + (WAKE_VERIFY_ENABLE ? WAKE_VERIFY_MS : 0)) * 16 > SESSION_PREROLL_CAPACITY_SAMPLES
+#error "SESSION_PREROLL_MS + WAKE_VERIFY_MS超过了会话预录缓冲区的容量（SESSION_PREROLL_CAPACITY_SAMPLES）"
+#endif
+
+#if SESSION_PREROLL_CAPACITY_SAMPLES > CAPTURE_RING_SAMPLES
+#error "采集环（CAPTURE_RING_SAMPLES）要装得下整段会话预录的回放"
+#endif
+
+#if PLAYBACK_PREBUFFER_MAX_MS * 16 > JITTER_BUFFER_SAMPLES / 2
+#error "PLAYBACK_PREBUFFER_MAX_MS超过了抖动缓冲区（JITTER_BUFFER_SAMPLES）的一半，预缓冲时收不下后面的音频"
+#endif
+
 #endif // PROJECT_CONFIG_H
\ No newline at end of file
@@ -0,0 +1,119 @@
+/**
+ * @file prompt_store.cc
+ * @brief 🗂️ 提示音资源库实现
+ */
+
+#include "prompt_store.h"
+#include <string.h>
+#include <new>
+#include "esp_log.h"
+#include "audio_codec.h"
+
+const char* PromptStore::TAG = "PromptStore";
+
+PromptStore::PromptStore()
+    : mmap_handle_(0)
+    , base_(nullptr)
+    , assets_(nullptr)
+    , count_(0)
+{
+}
+
+PromptStore::~PromptStore() {
+    delete[] assets_;
+    if (base_) {
+        esp_partition_munmap(mmap_handle_);
+    }
+}
+
+esp_err_t PromptStore::init(const char* partition_label) {
+    if (base_) {
+        return ESP_OK;
+    }
+
+    const esp_partition_t* part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                           ESP_PARTITION_SUBTYPE_ANY, partition_label);
+    if (!part) {
+        ESP_LOGW(TAG, "⚠️ 未找到提示音分区 '%s'", partition_label);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    // 先读文件头，只映射实际用到的部分
+    FileHeader header;
+    esp_err_t ret = esp_partition_read(part, 0, &header, sizeof(header));
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (header.magic != MAGIC || header.version != VERSION) {
+        ESP_LOGW(TAG, "⚠️ 提示音分区未烧录或格式不匹配 (magic=0x%08lx, 版本=%u)",
+                 (unsigned long)header.magic, header.version);
+        return ESP_ERR_INVALID_VERSION;
+    }
+    size_t dir_end = sizeof(FileHeader) + (size_t)header.count * sizeof(DirEntry);
+    if (header.count == 0 || header.total_size < dir_end || header.total_size > part->size) {
+        ESP_LOGE(TAG, "❌ 提示音目录损坏 (条目=%u, 大小=%lu)", header.count, (unsigned long)header.total_size);
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    const void* mapped = nullptr;
+    esp_partition_mmap_handle_t handle;
+    ret = esp_partition_mmap(part, 0, header.total_size, ESP_PARTITION_MMAP_DATA, &mapped, &handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ 提示音分区映射失败: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    PromptAsset* assets = new (std::nothrow) PromptAsset[header.count];
+    if (!assets) {
+        esp_partition_munmap(handle);
+        return ESP_ERR_NO_MEM;
+    }
+
+    const uint8_t* base = (const uint8_t*)mapped;
+    const DirEntry* dir = (const DirEntry*)(base + sizeof(FileHeader));
+    size_t valid = 0;
+    for (size_t i = 0; i < header.count; i++) {
+        DirEntry entry;
+        memcpy(&entry, &dir[i], sizeof(entry));
+
+        bool ok = entry.name[NAME_LEN - 1] == '\0' &&
+                  entry.offset >= dir_end &&
+                  entry.size <= header.total_size - entry.offset &&
+                  entry.offset % 16 == 0;
+        if (ok && entry.codec == (uint8_t)PromptCodec::PCM16) {
+            ok = entry.size == entry.samples * sizeof(int16_t);
+        } else if (ok && entry.codec == (uint8_t)PromptCodec::IMA_ADPCM) {
+            ok = entry.block_bytes > ImaAdpcmDecoder::BLOCK_HEADER_SIZE && entry.block_bytes % 2 == 0;
+        } else {
+            ok = false;
+        }
+        if (!ok) {
+            ESP_LOGW(TAG, "⚠️ 跳过无效条目 #%u", (unsigned)i);
+            continue;
+        }
+
+        PromptAsset& asset = assets[valid++];
+        asset.name = dir[i].name;
+        asset.data = base + entry.offset;
+        asset.size = entry.size;
+        asset.samples = entry.samples;
+        asset.block_bytes = entry.codec == (uint8_t)PromptCodec::IMA_ADPCM ? entry.block_bytes : 0;
+        asset.codec = (PromptCodec)entry.codec;
+    }
+
+    mmap_handle_ = handle;
+    base_ = base;
+    assets_ = assets;
+    count_ = valid;
+    ESP_LOGI(TAG, "✅ 提示音分区已映射: %u条, %lu字节", (unsigned)count_, (unsigned long)header.total_size);
+    return ESP_OK;
+}
+
+const PromptAsset* PromptStore::find(const char* name) const {
+    for (size_t i = 0; i < count_; i++) {
+        if (strncmp(assets_[i].name, name, NAME_LEN) == 0) {
+            return &assets_[i];
+        }
+    }
+    return nullptr;
+}
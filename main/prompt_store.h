@@ -0,0 +1,105 @@
+/**
+ * @file prompt_store.h
+ * @brief 🗂️ 提示音资源库 - 从独立Flash分区内存映射，播放时边读边解码
+ *
+ * 提示音原来是编进固件的PCM数组（mock_voices下的.h头文件），每秒32KB，直接撑大app镜像，
+ * OTA和烧录都变慢。现在由tools/convert_audio.py把所有提示音压成IMA-ADPCM（4:1），
+ * 打包成prompts.bin烧到"prompts"分区，启动时用esp_partition_mmap映射进地址空间，
+ * 不占RAM，也不需要拷贝。
+ *
+ * 📦 打包格式（小端）：
+ *   [文件头16字节] "PRMT" | uint16版本 | uint16条目数 | uint32总字节数 | uint32保留
+ *   [目录，每条32字节] char名称[16] | uint32偏移 | uint32字节数 | uint32样本数
+ *                      | uint16块字节数 | uint8编码 | uint8保留
+ *   [数据区] 每条数据16字节对齐
+ *
+ * ADPCM数据由连续的块组成，块格式与下行音频相同（见ImaAdpcmDecoder），
+ * 每块自带预测值和步长索引，播放任务每次只需解码一块。
+ */
+
+#ifndef PROMPT_STORE_H
+#define PROMPT_STORE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_partition.h"
+
+/**
+ * @brief 提示音数据编码
+ */
+enum class PromptCodec : uint8_t {
+    PCM16 = 0,      // 原始16位PCM，可以直接送进混音器
+    IMA_ADPCM = 1,  // IMA-ADPCM块序列
+};
+
+/**
+ * @brief 一条提示音（数据指向内存映射的Flash，程序运行期间一直有效）
+ */
+struct PromptAsset {
+    const char* name;
+    const uint8_t* data;
+    size_t size;            // 字节数
+    uint32_t samples;       // 解码后的样本数
+    uint16_t block_bytes;   // ADPCM块大小（含块头），PCM为0
+    PromptCodec codec;
+};
+
+class PromptStore {
+public:
+    static constexpr uint32_t MAGIC = 0x544D5250;   // "PRMT"
+    static constexpr uint16_t VERSION = 1;
+    static constexpr size_t NAME_LEN = 16;
+
+    PromptStore();
+    ~PromptStore();
+
+    /**
+     * @brief 映射提示音分区并校验目录
+     *
+     * @param partition_label 分区名
+     * @return ESP_OK成功；ESP_ERR_NOT_FOUND=没有这个分区；ESP_ERR_INVALID_VERSION=分区未烧录或格式不对
+     */
+    esp_err_t init(const char* partition_label);
+
+    /**
+     * @brief 按名称查找提示音
+     *
+     * @return 找不到时返回nullptr
+     */
+    const PromptAsset* find(const char* name) const;
+
+    size_t count() const { return count_; }
+    bool isReady() const { return assets_ != nullptr; }
+
+private:
+    static const char* TAG;
+
+    struct __attribute__((packed)) FileHeader {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t count;
+        uint32_t total_size;
+        uint32_t reserved;
+    };
+
+    struct __attribute__((packed)) DirEntry {
+        char name[NAME_LEN];
+        uint32_t offset;
+        uint32_t size;
+        uint32_t samples;
+        uint16_t block_bytes;
+        uint8_t codec;
+        uint8_t reserved;
+    };
+
+    static_assert(sizeof(FileHeader) == 16, "FileHeader必须是16字节");
+    static_assert(sizeof(DirEntry) == 32, "DirEntry必须是32字节");
+
+    esp_partition_mmap_handle_t mmap_handle_;
+    const uint8_t* base_;
+    PromptAsset* assets_;
+    size_t count_;
+};
+
+#endif // PROMPT_STORE_H
@@ -0,0 +1,96 @@
+/**
+ * @file push_to_talk.cc
+ * @brief 🔘 按键说话实现
+ */
+
+#include "push_to_talk.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "project_config.h"
+
+const char* PushToTalk::TAG = "PushToTalk";
+
+PushToTalk::PushToTalk()
+    : gpio_(GPIO_NUM_NC)
+    , active_level_(0)
+    , notify_task_(nullptr)
+    , initialized_(false)
+    , held_(false)
+    , changed_us_(0)
+    , released_us_(0)
+{
+}
+
+esp_err_t PushToTalk::init(gpio_num_t gpio, int active_level, TaskHandle_t notify_task) {
+    gpio_ = gpio;
+    active_level_ = active_level;
+    notify_task_ = notify_task;
+
+    gpio_config_t cfg = {};
+    cfg.pin_bit_mask = 1ULL << gpio;
+    cfg.mode = GPIO_MODE_INPUT;
+    cfg.pull_up_en = active_level == 0 ? GPIO_PULLUP_ENABLE : GPIO_PULLUP_DISABLE;
+    cfg.pull_down_en = active_level == 0 ? GPIO_PULLDOWN_DISABLE : GPIO_PULLDOWN_ENABLE;
+    cfg.intr_type = GPIO_INTR_ANYEDGE;
+    esp_err_t ret = gpio_config(&cfg);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ 配置按键GPIO%d失败: %s", (int)gpio, esp_err_to_name(ret));
+        return ret;
+    }
+    // 别的模块已经装过中断服务时返回ESP_ERR_INVALID_STATE，可以直接用
+    ret = gpio_install_isr_service(0);
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+        ESP_LOGE(TAG, "❌ 安装GPIO中断服务失败: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    ret = gpio_isr_handler_add(gpio, isr, this);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ 注册按键中断失败: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    initialized_ = true;
+    ESP_LOGI(TAG, "🔘 按键说话: GPIO%d，%s电平按下", (int)gpio, active_level ? "高" : "低");
+    return ESP_OK;
+}
+
+void IRAM_ATTR PushToTalk::isr(void* arg) {
+    PushToTalk* self = (PushToTalk*)arg;
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(self->notify_task_, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+PushToTalk::Event PushToTalk::takeEvent() {
+    if (!initialized_) {
+        return Event::NONE;
+    }
+    int64_t now = esp_timer_get_time();
+    bool active = gpio_get_level(gpio_) == active_level_;
+    if (now - changed_us_ < (int64_t)PUSH_TO_TALK_DEBOUNCE_MS * 1000) {
+        return Event::NONE;
+    }
+    if (!held_) {
+        if (!active) {
+            return Event::NONE;
+        }
+        held_ = true;
+        changed_us_ = now;
+        released_us_ = 0;
+        return Event::PRESS;
+    }
+    if (active) {
+        released_us_ = 0;
+        return Event::NONE;
+    }
+    if (released_us_ == 0) {
+        released_us_ = now;
+    }
+    if (now - released_us_ < (int64_t)PUSH_TO_TALK_RELEASE_MS * 1000) {
+        return Event::NONE;
+    }
+    ESP_LOGD(TAG, "按住 %lld ms", (released_us_ - changed_us_) / 1000);
+    held_ = false;
+    changed_us_ = now;
+    return Event::RELEASE;
+}
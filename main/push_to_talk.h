@@ -0,0 +1,63 @@
+/**
+ * @file push_to_talk.h
+ * @brief 🔘 按键说话 - 按住按键就开始上传，松开立即结束这句话，不经过WakeNet和VAD拖尾
+ *
+ * 展台等场景用一个GPIO按键代替唤醒词：按下直接进入云端会话（WebSocket已经连着，
+ * 不播唤醒提示音），松开时马上发speech_end，服务器补齐静音让豆包立即结束识别。
+ * 省掉了唤醒词检测的延迟和VAD的拖尾等待，会话本身和唤醒词触发的是同一套状态机。
+ *
+ * GPIO中断只唤醒主任务，电平在主任务里读取和消抖：
+ * - 按下：读到有效电平立即生效（不等消抖），之后PUSH_TO_TALK_DEBOUNCE_MS内的抖动不看
+ * - 松开：无效电平持续PUSH_TO_TALK_RELEASE_MS才算，按键弹起时的抖动不会把一句话切成两句
+ */
+
+#ifndef PUSH_TO_TALK_H
+#define PUSH_TO_TALK_H
+
+#include <stdint.h>
+#include "driver/gpio.h"
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+class PushToTalk {
+public:
+    enum class Event {
+        NONE,
+        PRESS,
+        RELEASE,
+    };
+
+    PushToTalk();
+
+    /**
+     * @brief 配置按键GPIO（内部上拉/下拉按有效电平选择）并注册边沿中断
+     *
+     * @param gpio 按键引脚
+     * @param active_level 按下时的电平
+     * @param notify_task 边沿中断唤醒的任务（主任务），由它调用takeEvent()
+     */
+    esp_err_t init(gpio_num_t gpio, int active_level, TaskHandle_t notify_task);
+
+    /**
+     * @brief 取一个按键事件（主任务中调用，每次主循环都可以调用）
+     */
+    Event takeEvent();
+
+    bool isAvailable() const { return initialized_; }
+    bool isHeld() const { return held_; }
+
+private:
+    static void isr(void* arg);
+
+    static const char* TAG;
+    gpio_num_t gpio_;
+    int active_level_;
+    TaskHandle_t notify_task_;
+    bool initialized_;
+    bool held_;
+    int64_t changed_us_;        // 上次按下/松开生效的时间
+    int64_t released_us_;       // 开始读到无效电平的时间（0=还是按着的）
+};
+
+#endif // PUSH_TO_TALK_H
@@ -0,0 +1,117 @@
+/**
+ * @file realtime_audio.cc
+ * @brief ⚡ 热路径的指令cache冷/热耗时测试
+ */
+
+#include "realtime_audio.h"
+#include <string.h>
+#include "esp_log.h"
+#include "esp_cpu.h"
+#include "esp32s3/rom/cache.h"
+#include "buffer_placement.h"
+#include "mic_conditioner.h"
+#include "jitter_buffer.h"
+#include "preroll_buffer.h"
+#include "silence_gate.h"
+#include "project_config.h"
+
+static const char* TAG = "RealtimeAudio";
+
+static const int kWarmupRuns = 8;
+static const int kMeasureRuns = 32;
+static const size_t kCaptureSamples = 512;      // 一个AFE feed块
+static const size_t kPlaybackSamples = AUDIO_FRAME_SAMPLES;     // 一个播放块
+
+const char* RealtimeAudio::profileName() {
+#if REALTIME_AUDIO_PROFILE
+    return "realtime";
+#else
+    return "default";
+#endif
+}
+
+/**
+ * @brief 平均每次调用的CPU周期
+ *
+ * @param cold true=每次调用前清空指令cache，模拟WakeNet推理刚把热路径挤出去的情况
+ */
+template <typename F>
+static uint32_t measure_cycles(bool cold, F&& body) {
+    for (int i = 0; i < kWarmupRuns; i++) {
+        body();
+    }
+    uint64_t total = 0;
+    for (int i = 0; i < kMeasureRuns; i++) {
+        if (cold) {
+            Cache_Invalidate_ICache_All();
+        }
+        esp_cpu_cycle_count_t start = esp_cpu_get_cycle_count();
+        body();
+        total += esp_cpu_get_cycle_count() - start;
+    }
+    return (uint32_t)(total / kMeasureRuns);
+}
+
+template <typename F>
+static void report(const char* name, F&& body) {
+    uint32_t warm = measure_cycles(false, body);
+    uint32_t cold = measure_cycles(true, body);
+    uint32_t penalty = warm > 0 && cold > warm ? (cold - warm) * 100 / warm : 0;
+    ESP_LOGI(TAG, "  %-22s 热 %6lu 周期  冷 %6lu 周期 (+%lu%%)",
+             name, (unsigned long)warm, (unsigned long)cold, (unsigned long)penalty);
+}
+
+void RealtimeAudio::runBenchmark() {
+    int32_t* capture = (int32_t*)BufferPlacement::alloc("bench_capture", kCaptureSamples * sizeof(int32_t),
+                                                        Placement::INTERNAL);
+    int16_t* playback = (int16_t*)BufferPlacement::alloc("bench_playback", kPlaybackSamples * sizeof(int16_t),
+                                                         Placement::INTERNAL);
+    if (!capture || !playback) {
+        ESP_LOGW(TAG, "⚠️ 热路径测试跳过：测试缓冲区分配失败");
+        BufferPlacement::free(capture);
+        BufferPlacement::free(playback);
+        return;
+    }
+    for (size_t i = 0; i < kCaptureSamples; i++) {
+        capture[i] = (int32_t)((i * 7919) & 0xffff) << 14;
+    }
+    for (size_t i = 0; i < kPlaybackSamples; i++) {
+        playback[i] = (int16_t)((i * 7919) & 0x3fff) - 0x2000;
+    }
+
+    ESP_LOGI(TAG, "⚡ 热路径耗时（%s配置，冷=每次调用前清空指令cache）:", profileName());
+
+    // 去直流和增益都打开，走完整的向量内核
+    MicConditioner conditioner;
+    conditioner.configure(true, 2.0f);
+    report("采集收窄+调理", [&]() {
+        MicConditioner::narrow32(capture, kCaptureSamples, 14);
+        conditioner.process((int16_t*)capture, kCaptureSamples);
+    });
+
+    JitterBuffer* jitter = new JitterBuffer(true);
+    if (jitter->isValid()) {
+        report("抖动缓冲写入", [&]() {
+            jitter->write(playback, kPlaybackSamples);
+            jitter->clear();
+        });
+    }
+    delete jitter;
+
+    PrerollBuffer* preroll = new PrerollBuffer(kPlaybackSamples * 4, Placement::PSRAM);
+    if (preroll->isValid()) {
+        // 容量只有4块，每次写入都要丢弃最旧的一块
+        report("预录写入+丢弃最旧", [&]() {
+            preroll->push(playback, kPlaybackSamples, true);
+        });
+    }
+    delete preroll;
+
+    SilenceGate gate(16000, kPlaybackSamples);
+    report("播放静音检测", [&]() {
+        gate.process(playback, kPlaybackSamples);
+    });
+
+    BufferPlacement::free(capture);
+    BufferPlacement::free(playback);
+}
@@ -0,0 +1,53 @@
+/**
+ * @file realtime_audio.h
+ * @brief ⚡ 实时音频构建配置 - 采集/播放热路径放进IRAM，不和WakeNet抢指令cache
+ *
+ * 默认配置是-Os、模型从Flash映射（CONFIG_MODEL_IN_FLASH），采集和播放循环的代码也从Flash执行，
+ * 和WakeNet/AFE共用32KB指令cache：WakeNet每块推理都会把它们挤出去，下一块又要重新从Flash取指。
+ * 打开实时音频配置后：
+ *
+ * - AUDIO_HOT_IRAM标记的函数放进IRAM：采集任务和各个采集回调、环形缓冲区的写入/丢弃、
+ *   麦克风调理内核（含它调用的esp-dsp向量内核，见realtime_audio.lf）、播放的I2S写入路径
+ * - SpscRing的读写接口强制内联进这些函数（否则作为普通inline函数可能单独生成在Flash里）
+ * - 这些源文件单独用-O2编译（其余仍是-Os）
+ * - sdkconfig.defaults.realtime打开CONFIG_I2S_ISR_IRAM_SAFE：NVS写入等Flash操作关闭cache期间，
+ *   I2S中断照常把DMA块交给队列，Flash操作结束后采集任务一次处理完，不会丢块
+ *
+ * Flash擦写期间两个核心上的普通任务都会暂停（IRAM里的任务也一样），这段时间靠DMA描述符环撑住：
+ * 采集约6×32ms，播放约4×20ms（见project_config.h的I2S DMA配置）。不急的写入由FlashScheduler推迟到空闲时（见flash_scheduler.h）。
+ *
+ * 用法：idf.py -DREALTIME_AUDIO_PROFILE=1 -DSDKCONFIG_DEFAULTS="sdkconfig.defaults;sdkconfig.defaults.esp32s3;sdkconfig.defaults.realtime" build
+ * 额外占用几KB内部RAM（ESP32-S3的IRAM和DRAM共用同一块SRAM）。
+ * REALTIME_AUDIO_BENCHMARK打开时启动时测一次各热路径在指令cache冷/热时的耗时，
+ * 分别用默认配置和实时配置各跑一次就能看出差别。
+ */
+
+#ifndef REALTIME_AUDIO_H
+#define REALTIME_AUDIO_H
+
+#include "esp_attr.h"
+
+#if REALTIME_AUDIO_PROFILE
+#define AUDIO_HOT_IRAM IRAM_ATTR
+#define AUDIO_HOT_INLINE __attribute__((always_inline)) inline
+#else
+#define AUDIO_HOT_IRAM
+#define AUDIO_HOT_INLINE inline
+#endif
+
+class RealtimeAudio {
+public:
+    /**
+     * @brief 当前构建的配置名（"realtime"或"default"）
+     */
+    static const char* profileName();
+
+    /**
+     * @brief 测量各个热路径内核在指令cache热/冷（每次调用前清空指令cache）时的平均CPU周期并打印
+     *
+     * 在音频任务启动前调用（另一个核心空闲），临时分配测试缓冲区，测完释放。
+     */
+    static void runBenchmark();
+};
+
+#endif // REALTIME_AUDIO_H
@@ -0,0 +1,276 @@
+/**
+ * @file relay_selector.cc
+ * @brief 🧭 中继选择实现
+ */
+
+#include "relay_selector.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "lwip/sockets.h"
+#include "lwip/netdb.h"
+#include "mdns.h"
+#include "perf_counters.h"
+#include "project_config.h"
+
+const char* RelaySelector::TAG = "RelaySelector";
+
+RelaySelector::RelaySelector(const char* primary_uri)
+    : primary_(primary_uri)
+    , scheme_{}
+    , relays_{}
+    , count_(0)
+    , current_(0)
+{
+    const char* sep = strstr(primary_uri, "://");
+    size_t n = sep ? (size_t)(sep - primary_uri) + 3 : 0;
+    n = n < sizeof(scheme_) ? n : 0;
+    memcpy(scheme_, primary_uri, n);
+    scheme_[n] = '\0';
+
+    addCandidate(primary_uri, false);
+    char list[] = RELAY_FALLBACK_URIS;
+    char* save = nullptr;
+    for (char* item = strtok_r(list, ", ", &save); item != nullptr; item = strtok_r(nullptr, ", ", &save)) {
+        addCandidate(item, false);
+    }
+}
+
+void RelaySelector::addCandidate(const char* uri, bool from_mdns) {
+    if (scheme_[0] == '\0' || strncmp(uri, scheme_, strlen(scheme_)) != 0) {
+        ESP_LOGW(TAG, "⚠️ 跳过 %s：和配置的地址scheme不同", uri);
+        return;
+    }
+    for (size_t i = 0; i < count_; i++) {
+        if (strcmp(relays_[i].uri, uri) == 0) {
+            return;
+        }
+    }
+    if (count_ >= MAX_RELAYS || strlen(uri) >= sizeof(relays_[0].uri)) {
+        ESP_LOGW(TAG, "⚠️ 跳过 %s：候选太多或地址太长", uri);
+        return;
+    }
+
+    // scheme://host[:port][/path]
+    Relay& relay = relays_[count_];
+    snprintf(relay.uri, sizeof(relay.uri), "%s", uri);
+    const char* host = uri + strlen(scheme_);
+    size_t host_len = strcspn(host, ":/");
+    if (host_len == 0 || host_len >= sizeof(relay.host)) {
+        ESP_LOGW(TAG, "⚠️ 跳过 %s：主机名不对", uri);
+        return;
+    }
+    memcpy(relay.host, host, host_len);
+    relay.host[host_len] = '\0';
+    relay.port = host[host_len] == ':' ? (uint16_t)atoi(host + host_len + 1)
+                                       : (strcmp(scheme_, "wss://") == 0 ? 443 : 80);
+    relay.rtt_ms = RTT_UNREACHABLE;
+    relay.from_mdns = from_mdns;
+    count_++;
+}
+
+void RelaySelector::discoverMdns() {
+#if RELAY_MDNS_ENABLE
+    if (mdns_init() != ESP_OK) {
+        ESP_LOGW(TAG, "⚠️ mDNS初始化失败，只用配置的中继");
+        return;
+    }
+    mdns_result_t* results = nullptr;
+    esp_err_t err = mdns_query_ptr(RELAY_MDNS_SERVICE, "_tcp", RELAY_MDNS_TIMEOUT_MS, MAX_RELAYS, &results);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "⚠️ mDNS查询失败: %s", esp_err_to_name(err));
+    }
+    for (mdns_result_t* r = results; r != nullptr; r = r->next) {
+        // TXT：scheme=ws|wss，path=/...（服务器RELAY_MDNS广播时带上）
+        const char* scheme = "ws";
+        const char* path = "/";
+        for (size_t i = 0; i < r->txt_count; i++) {
+            if (r->txt[i].value == nullptr) {
+                continue;
+            }
+            if (strcmp(r->txt[i].key, "scheme") == 0) {
+                scheme = r->txt[i].value;
+            } else if (strcmp(r->txt[i].key, "path") == 0) {
+                path = r->txt[i].value;
+            }
+        }
+        for (mdns_ip_addr_t* a = r->addr; a != nullptr; a = a->next) {
+            if (a->addr.type != ESP_IPADDR_TYPE_V4) {
+                continue;
+            }
+            char uri[sizeof(relays_[0].uri)];
+            snprintf(uri, sizeof(uri), "%s://" IPSTR ":%u%s", scheme, IP2STR(&a->addr.u_addr.ip4),
+                     (unsigned)r->port, path);
+            ESP_LOGI(TAG, "🔎 mDNS发现中继 %s（%s）", uri, r->hostname ? r->hostname : "-");
+            addCandidate(uri, true);
+            break;
+        }
+    }
+    mdns_query_results_free(results);
+    mdns_free();    // 只在启动时查一次，不常驻mDNS任务
+#endif
+}
+
+void RelaySelector::probe() {
+    struct sockaddr_in addrs[MAX_RELAYS] = {};
+    bool resolved[MAX_RELAYS] = {};
+    for (size_t i = 0; i < count_; i++) {
+        Relay& relay = relays_[i];
+        relay.rtt_ms = RTT_UNREACHABLE;
+        struct addrinfo hints = {};
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+        struct addrinfo* res = nullptr;
+        if (getaddrinfo(relay.host, nullptr, &hints, &res) != 0 || res == nullptr) {
+            ESP_LOGW(TAG, "⚠️ 解析 %s 失败", relay.host);
+            continue;
+        }
+        addrs[i] = *(struct sockaddr_in*)res->ai_addr;
+        addrs[i].sin_port = htons(relay.port);
+        freeaddrinfo(res);
+        resolved[i] = true;
+
+        // 📌 ws://直接连解析好的IP，之后重连不再做DNS（wss://要用主机名校验证书）
+        if (strcmp(scheme_, "ws://") == 0) {
+            const char* host = relay.uri + strlen(scheme_);
+            const char* path = strchr(host, '/');
+            char ip[16];
+            inet_ntop(AF_INET, &addrs[i].sin_addr, ip, sizeof(ip));
+            char uri[sizeof(relay.uri)];
+            snprintf(uri, sizeof(uri), "%s%s:%u%s", scheme_, ip, (unsigned)relay.port, path ? path : "");
+            memcpy(relay.uri, uri, sizeof(uri));
+        }
+    }
+
+    // 所有候选同时建连，一轮最多等RELAY_PROBE_TIMEOUT_MS；第一轮没连上的后面不再试
+    for (int round = 0; round < RELAY_PROBE_ROUNDS; round++) {
+        int fds[MAX_RELAYS];
+        int64_t start_us[MAX_RELAYS] = {};
+        size_t pending = 0;
+        for (size_t i = 0; i < count_; i++) {
+            fds[i] = -1;
+            if (!resolved[i] || (round > 0 && relays_[i].rtt_ms == RTT_UNREACHABLE)) {
+                continue;
+            }
+            int fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+            if (fd < 0) {
+                continue;
+            }
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+            start_us[i] = esp_timer_get_time();
+            if (connect(fd, (struct sockaddr*)&addrs[i], sizeof(addrs[i])) != 0 && errno != EINPROGRESS) {
+                close(fd);
+                continue;
+            }
+            fds[i] = fd;
+            pending++;
+        }
+        int64_t deadline_us = esp_timer_get_time() + (int64_t)RELAY_PROBE_TIMEOUT_MS * 1000;
+        while (pending > 0) {
+            int64_t left_us = deadline_us - esp_timer_get_time();
+            if (left_us <= 0) {
+                break;
+            }
+            fd_set writable;
+            FD_ZERO(&writable);
+            int max_fd = -1;
+            for (size_t i = 0; i < count_; i++) {
+                if (fds[i] >= 0) {
+                    FD_SET(fds[i], &writable);
+                    max_fd = fds[i] > max_fd ? fds[i] : max_fd;
+                }
+            }
+            struct timeval tv = { (time_t)(left_us / 1000000), (suseconds_t)(left_us % 1000000) };
+            if (select(max_fd + 1, nullptr, &writable, nullptr, &tv) <= 0) {
+                break;
+            }
+            int64_t now = esp_timer_get_time();
+            for (size_t i = 0; i < count_; i++) {
+                if (fds[i] < 0 || !FD_ISSET(fds[i], &writable)) {
+                    continue;
+                }
+                int error = 0;
+                socklen_t len = sizeof(error);
+                if (getsockopt(fds[i], SOL_SOCKET, SO_ERROR, &error, &len) == 0 && error == 0) {
+                    uint32_t rtt_ms = (uint32_t)((now - start_us[i]) / 1000);
+                    relays_[i].rtt_ms = rtt_ms < relays_[i].rtt_ms ? rtt_ms : relays_[i].rtt_ms;
+                }
+                close(fds[i]);
+                fds[i] = -1;
+                pending--;
+            }
+        }
+        for (size_t i = 0; i < count_; i++) {
+            if (fds[i] >= 0) {
+                close(fds[i]);
+            }
+        }
+    }
+}
+
+void RelaySelector::sortByRtt() {
+    // 插入排序（稳定）：RTT相同、都没连上的保持配置顺序
+    for (size_t i = 1; i < count_; i++) {
+        Relay relay = relays_[i];
+        size_t j = i;
+        while (j > 0 && relays_[j - 1].rtt_ms > relay.rtt_ms) {
+            relays_[j] = relays_[j - 1];
+            j--;
+        }
+        relays_[j] = relay;
+    }
+}
+
+void RelaySelector::log() const {
+    for (size_t i = 0; i < count_; i++) {
+        const Relay& relay = relays_[i];
+        if (relay.rtt_ms == RTT_UNREACHABLE) {
+            ESP_LOGW(TAG, "%s %s%s：连不上", i == current_ ? "👉" : "  ", relay.uri, relay.from_mdns ? "（mDNS）" : "");
+        } else {
+            ESP_LOGI(TAG, "%s %s%s：%lu ms", i == current_ ? "👉" : "  ", relay.uri, relay.from_mdns ? "（mDNS）" : "",
+                     (unsigned long)relay.rtt_ms);
+        }
+    }
+}
+
+const char* RelaySelector::pick() {
+    if (count_ <= 1 && !RELAY_MDNS_ENABLE) {
+        return current();
+    }
+    int64_t start = esp_timer_get_time();
+    discoverMdns();
+    probe();
+    sortByRtt();
+    current_ = 0;
+    ESP_LOGI(TAG, "🧭 %u个候选中继，选择用时 %lld ms", (unsigned)count_, (esp_timer_get_time() - start) / 1000);
+    log();
+    return current();
+}
+
+bool RelaySelector::next(std::string* uri) {
+    if (count_ <= 1) {
+        return false;
+    }
+    // 上次探测连不上的跳过：建连超时一次就要等好几秒
+    size_t i = current_ + 1;
+    while (i < count_ && relays_[i].rtt_ms == RTT_UNREACHABLE) {
+        i++;
+    }
+    if (i < count_) {
+        ESP_LOGW(TAG, "⚠️ %s 连不上，换 %s", relays_[current_].uri, relays_[i].uri);
+        current_ = i;
+        uri->assign(relays_[i].uri);
+        PerfCounters::add(PerfCounter::RELAY_FAILOVERS);
+        return true;
+    }
+    // 换过一轮都不通：重新探测，从最好的那个开始，调用方按退避等一会儿
+    ESP_LOGW(TAG, "⚠️ %u个中继都连不上，重新探测", (unsigned)count_);
+    probe();
+    sortByRtt();
+    current_ = 0;
+    log();
+    uri->assign(relays_[0].uri);
+    return false;
+}
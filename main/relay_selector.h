@@ -0,0 +1,75 @@
+/**
+ * @file relay_selector.h
+ * @brief 🧭 中继选择 - 启动时在配置的和局域网里发现的中继之间按建连RTT挑最近的，连不上时换下一个
+ *
+ * 候选：CONFIG_EXAMPLE_WEBSOCKET_URI、RELAY_FALLBACK_URIS（逗号分隔），再加上mDNS查询
+ * RELAY_MDNS_SERVICE._tcp 发现的中继（服务器RELAY_MDNS=1时广播，TXT里带scheme和path）。
+ * 和CONFIG_EXAMPLE_WEBSOCKET_URI的scheme不同的候选不用：ws://和wss://的传输层在connect()时就定了。
+ *
+ * 探测：对每个候选同时发起非阻塞TCP连接，握手完成的时间就是一次RTT，做RELAY_PROBE_ROUNDS轮取最小值，
+ * RELAY_PROBE_TIMEOUT_MS内连不上的算不健康，排到最后（都不健康时仍按配置顺序逐个试）。
+ * 解析好的地址直接写进ws://的URI，之后每次重连不再做DNS；wss://要按主机名校验证书，保留主机名，
+ * 这次解析留在lwIP的DNS缓存里。
+ *
+ * 故障转移：WebSocketClient一次重连失败就调用next()，立即连下一个候选，不等退避；
+ * 换过一轮都不通时重新探测一次，然后按退避等待（见WebSocketClient::setFailover）。
+ * 只有一个候选、又没开mDNS时什么都不做，和原来一样直接连配置的地址。
+ */
+
+#ifndef RELAY_SELECTOR_H
+#define RELAY_SELECTOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+class RelaySelector {
+public:
+    static constexpr size_t MAX_RELAYS = 6;
+    static constexpr uint32_t RTT_UNREACHABLE = UINT32_MAX;
+
+    struct Relay {
+        char uri[96];           // 连接用的地址（ws://时主机已经换成解析好的IP）
+        char host[64];          // 原来的主机名（日志、重新解析用）
+        uint16_t port;
+        uint32_t rtt_ms;        // 最近一次探测的建连时间，RTT_UNREACHABLE=没连上
+        bool from_mdns;
+    };
+
+    explicit RelaySelector(const char* primary_uri);
+
+    /**
+     * @brief WiFi连上之后调用一次：收集候选、探测、排序，返回最好的地址
+     */
+    const char* pick();
+
+    /**
+     * @brief 当前用的候选
+     */
+    const char* current() const { return count_ > 0 ? relays_[current_].uri : primary_; }
+
+    /**
+     * @brief 当前的连接失败（重连工作里调用）：换下一个候选写进uri
+     *
+     * 换过一轮时先重新探测，uri填探测后最好的那个并返回false，调用方按退避等一会儿再连。
+     */
+    bool next(std::string* uri);
+
+    size_t count() const { return count_; }
+
+private:
+    void addCandidate(const char* uri, bool from_mdns);
+    void discoverMdns();
+    void probe();
+    void sortByRtt();
+    void log() const;
+
+    static const char* TAG;
+    const char* primary_;
+    char scheme_[8];            // "ws://"或"wss://"
+    Relay relays_[MAX_RELAYS];
+    size_t count_;
+    size_t current_;
+};
+
+#endif // RELAY_SELECTOR_H
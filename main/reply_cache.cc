@@ -0,0 +1,131 @@
+/**
+ * @file reply_cache.cc
+ * @brief 🔁 上一轮回复的本地缓存实现
+ */
+
+#include "reply_cache.h"
+#include <string.h>
+#include "esp_log.h"
+#include "audio_codec.h"
+#include "buffer_placement.h"
+
+const char* ReplyCache::TAG = "ReplyCache";
+
+// ADPCM块前面的长度字段
+static constexpr size_t kBlockHeaderBytes = 2;
+
+ReplyCache::ReplyCache(size_t capacity)
+    : buffer_(nullptr)
+    , capacity_(0)
+    , state_(State::EMPTY)
+    , format_(Format::PCM)
+    , length_(0)
+    , block_start_(0)
+    , block_len_(0)
+    , samples_(0)
+    , read_pos_(0)
+{
+    if (capacity > 0) {
+        buffer_ = (uint8_t*)BufferPlacement::alloc("reply_cache", capacity, Placement::PSRAM);
+        capacity_ = buffer_ ? capacity : 0;
+    }
+}
+
+ReplyCache::~ReplyCache() {
+    BufferPlacement::free(buffer_);
+}
+
+void ReplyCache::begin(Format format) {
+    if (!buffer_) {
+        return;
+    }
+    state_.store(State::EMPTY, std::memory_order_release);
+    format_ = format;
+    length_ = 0;
+    block_len_ = 0;
+    samples_ = 0;
+    state_.store(State::RECORDING, std::memory_order_release);
+}
+
+void ReplyCache::append(const uint8_t* data, size_t len) {
+    if (!isRecording() || len == 0) {
+        return;
+    }
+    size_t pos = length_;
+    if (format_ == Format::ADPCM) {
+        if (block_len_ == 0) {
+            block_start_ = length_;
+        }
+        pos = block_start_ + kBlockHeaderBytes + block_len_;
+    }
+    if (pos + len > capacity_ || (format_ == Format::ADPCM && block_len_ + len > UINT16_MAX)) {
+        ESP_LOGI(TAG, "回复超过 %zu 字节的缓存，这一轮不能本地重放", capacity_);
+        invalidate();
+        return;
+    }
+    memcpy(buffer_ + pos, data, len);
+    if (format_ == Format::ADPCM) {
+        block_len_ += len;
+    } else {
+        length_ += len;
+        samples_ += len / sizeof(int16_t);
+    }
+}
+
+void ReplyCache::endBlock() {
+    if (!isRecording() || format_ != Format::ADPCM || block_len_ == 0) {
+        return;
+    }
+    buffer_[block_start_] = (uint8_t)(block_len_ & 0xFF);
+    buffer_[block_start_ + 1] = (uint8_t)(block_len_ >> 8);
+    length_ = block_start_ + kBlockHeaderBytes + block_len_;
+    samples_ += ImaAdpcmDecoder::samplesInBlock(block_len_);
+    block_len_ = 0;
+}
+
+void ReplyCache::dropBlock() {
+    block_len_ = 0;
+}
+
+void ReplyCache::commit() {
+    if (!isRecording()) {
+        return;
+    }
+    block_len_ = 0;     // 没有收完的块不要
+    if (length_ == 0) {
+        invalidate();
+        return;
+    }
+    state_.store(State::READY, std::memory_order_release);
+    ESP_LOGI(TAG, "🔁 已缓存上一轮回复: %lu ms, %zu 字节（%s）", (unsigned long)durationMs(), length_,
+             format_ == Format::ADPCM ? "ADPCM" : "PCM");
+}
+
+uint32_t ReplyCache::durationMs() const {
+    return (uint32_t)(samples_ / 16);
+}
+
+bool ReplyCache::rewind() {
+    read_pos_ = 0;
+    return ready();
+}
+
+size_t ReplyCache::nextPcm(const uint8_t** data, size_t max_bytes) {
+    size_t n = length_ - read_pos_;
+    if (n > max_bytes) {
+        n = max_bytes & ~(size_t)1;
+    }
+    *data = buffer_ + read_pos_;
+    read_pos_ += n;
+    return n;
+}
+
+size_t ReplyCache::nextBlock(const uint8_t** data) {
+    if (read_pos_ + kBlockHeaderBytes > length_) {
+        return 0;
+    }
+    size_t len = buffer_[read_pos_] | ((size_t)buffer_[read_pos_ + 1] << 8);
+    *data = buffer_ + read_pos_ + kBlockHeaderBytes;
+    read_pos_ += kBlockHeaderBytes + len;
+    return len;
+}
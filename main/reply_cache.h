@@ -0,0 +1,124 @@
+/**
+ * @file reply_cache.h
+ * @brief 🔁 上一轮回复的本地缓存 - "再说一遍"直接在设备上重放，不走网络
+ *
+ * "再说一遍"以前要发{"type":"repeat"}让服务器把缓存的回复重新下发一遍，来回一趟网络，
+ * 服务器或WiFi不通时就只能说"没有回复"。现在播放回复的同时把下行音频按收到的格式存进PSRAM：
+ * - 下行是ADPCM时存原始的ADPCM块（每块前面2字节长度），4:1压缩，REPLY_CACHE_BYTES能存更长的回复
+ * - 下行是PCM时存PCM；24kHz float32存重采样之后的16kHz PCM（原始数据是它的3倍大）
+ *
+ * 一轮回复的第一条下行音频到达时从头开始录，tts_end（或帧头的FLAG_END）时commit()，之后ready()为true。
+ * 回复被打断、录满（回复太长）、下一轮开始时都作废，"再说一遍"退回问服务器。
+ * 丢包补偿填的样本不存，重放时缺口直接接上。
+ *
+ * 录制在WebSocket事件任务里，重放在AudioManager的播放任务里（重放期间下行音频一律丢弃），
+ * 两边不会同时访问数据；状态是原子的，invalidate()可以在任意任务调用。
+ */
+
+#ifndef REPLY_CACHE_H
+#define REPLY_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+class ReplyCache {
+public:
+    enum class Format : uint8_t {
+        PCM,        // 16位PCM字节流
+        ADPCM,      // [u16小端长度][ADPCM块] ...
+    };
+
+    /**
+     * @param capacity 缓存字节数（0=不启用，不分配内存）
+     */
+    explicit ReplyCache(size_t capacity);
+    ~ReplyCache();
+
+    ReplyCache(const ReplyCache&) = delete;
+    ReplyCache& operator=(const ReplyCache&) = delete;
+
+    bool isValid() const { return buffer_ != nullptr; }
+
+    // ===== 录制（WebSocket事件任务） =====
+
+    /**
+     * @brief 开始录一轮新的回复，之前缓存的作废
+     */
+    void begin(Format format);
+
+    bool isRecording() const { return state_.load(std::memory_order_acquire) == State::RECORDING; }
+
+    /**
+     * @brief 追加数据：PCM时是偶数长度的样本字节，ADPCM时是当前块的一段（块可以分几次追加）
+     *
+     * 放不下时整轮作废（回复太长），不存半截。
+     */
+    void append(const uint8_t* data, size_t len);
+
+    /**
+     * @brief ADPCM：当前块追加完了，补上长度
+     */
+    void endBlock();
+
+    /**
+     * @brief ADPCM：当前块损坏，丢掉已经追加的部分
+     */
+    void dropBlock();
+
+    /**
+     * @brief 这一轮回复完整收完，可以重放了（没在录或什么都没录到时什么都不做）
+     */
+    void commit();
+
+    /**
+     * @brief 作废（任意任务）
+     */
+    void invalidate() { state_.store(State::EMPTY, std::memory_order_release); }
+
+    bool ready() const { return state_.load(std::memory_order_acquire) == State::READY; }
+    Format format() const { return format_; }
+
+    /**
+     * @brief 缓存的回复时长（毫秒，16kHz）
+     */
+    uint32_t durationMs() const;
+
+    // ===== 重放（播放任务） =====
+
+    /**
+     * @brief 从头开始重放（ready()时才返回true）
+     */
+    bool rewind();
+
+    /**
+     * @brief PCM：取接下来最多max_bytes字节（偶数），返回0表示放完了
+     */
+    size_t nextPcm(const uint8_t** data, size_t max_bytes);
+
+    /**
+     * @brief ADPCM：取下一块，返回块的字节数，0表示放完了
+     */
+    size_t nextBlock(const uint8_t** data);
+
+private:
+    enum class State : uint8_t {
+        EMPTY,
+        RECORDING,
+        READY,
+    };
+
+    static const char* TAG;
+
+    uint8_t* buffer_;
+    size_t capacity_;
+    std::atomic<State> state_;
+    Format format_;
+    size_t length_;         // 已经写完的字节（ADPCM时只算完整的块）
+    size_t block_start_;    // ADPCM：当前块长度字段的位置
+    size_t block_len_;      // ADPCM：当前块已经追加的字节，0=还没开始
+    size_t samples_;        // 缓存的样本数
+    size_t read_pos_;       // 只在播放任务中访问
+};
+
+#endif // REPLY_CACHE_H
@@ -0,0 +1,71 @@
+/**
+ * @file rtf_guard.cc
+ * @brief 🛡️ 实时系数保护实现
+ */
+
+#include "rtf_guard.h"
+#include "esp_log.h"
+#include "perf_counters.h"
+#include "project_config.h"
+
+const char* RtfGuard::TAG = "RtfGuard";
+
+static const char* const kStageNames[] = { "Opus复杂度", "降噪", "AEC尾长" };
+static_assert(sizeof(kStageNames) / sizeof(kStageNames[0]) == (size_t)RtfStage::COUNT, "降级项名称不全");
+
+void RtfGuard::setAvailable(RtfStage stage, bool available) {
+    uint8_t bit = (uint8_t)(1u << (unsigned)stage);
+    if (available) {
+        available_mask_.fetch_or(bit, std::memory_order_relaxed);
+    } else {
+        available_mask_.fetch_and((uint8_t)~bit, std::memory_order_relaxed);
+    }
+}
+
+bool RtfGuard::endFrame(uint32_t frame_us) {
+    window_audio_us_ += frame_us;
+    if (window_audio_us_ < (uint32_t)RTF_GUARD_WINDOW_MS * 1000) {
+        return false;
+    }
+    uint32_t busy = busy_us_.exchange(0, std::memory_order_relaxed);
+    uint32_t permille = (uint32_t)((uint64_t)busy * 1000 / window_audio_us_);
+    window_audio_us_ = 0;
+    last_permille_.store(permille, std::memory_order_relaxed);
+    PerfCounters::noteMax(PerfGauge::RTF_MAX_PERMILLE, permille);
+
+#if RTF_GUARD_ENABLE
+    over_windows_ = permille > RTF_GUARD_HIGH_PERMILLE ? over_windows_ + 1 : 0;
+    under_windows_ = permille < RTF_GUARD_LOW_PERMILLE ? under_windows_ + 1 : 0;
+
+    uint8_t available = available_mask_.load(std::memory_order_relaxed);
+    uint8_t mask = degraded_mask_.load(std::memory_order_relaxed);
+    if (over_windows_ >= RTF_GUARD_DOWN_WINDOWS) {
+        over_windows_ = 0;
+        // 按顺序找下一个还没降、适用的项
+        for (unsigned i = 0; i < (unsigned)RtfStage::COUNT; i++) {
+            uint8_t bit = (uint8_t)(1u << i);
+            if ((available & bit) && !(mask & bit)) {
+                degraded_mask_.store(mask | bit, std::memory_order_relaxed);
+                PerfCounters::add(PerfCounter::RTF_DEGRADES);
+                ESP_LOGW(TAG, "🛡️ 上行处理占帧时长%lu‰，连续%d个窗口超预算，降级: %s",
+                         (unsigned long)permille, RTF_GUARD_DOWN_WINDOWS, kStageNames[i]);
+                return true;
+            }
+        }
+        ESP_LOGW(TAG, "⚠️ 上行处理占帧时长%lu‰，已经没有可以降级的项", (unsigned long)permille);
+    } else if (under_windows_ >= RTF_GUARD_UP_WINDOWS && mask != 0) {
+        under_windows_ = 0;
+        // 按相反顺序恢复最后降的那一项
+        for (int i = (int)RtfStage::COUNT - 1; i >= 0; i--) {
+            uint8_t bit = (uint8_t)(1u << i);
+            if (mask & bit) {
+                degraded_mask_.store(mask & ~bit, std::memory_order_relaxed);
+                PerfCounters::add(PerfCounter::RTF_RESTORES);
+                ESP_LOGI(TAG, "🛡️ 上行处理占帧时长%lu‰，恢复: %s", (unsigned long)permille, kStageNames[i]);
+                return true;
+            }
+        }
+    }
+#endif
+    return false;
+}
@@ -0,0 +1,83 @@
+/**
+ * @file rtf_guard.h
+ * @brief 🛡️ 实时系数保护 - 上行DSP处理持续超出帧时长时按固定顺序降级，压力消失后按相反顺序恢复
+ *
+ * 喂AFE（AEC）、AFE处理（NS/VAD/WakeNet）、Opus编码都在核心1上按帧处理，每帧必须在一帧的时长内做完，
+ * 否则AFE缓冲区越积越多、最后丢采集块。噪声大、双麦克风、NSNet这些情况下有的板子会超预算。
+ * 各级每帧把自己的处理时间（微秒）加进来，fetch任务每处理一块调用endFrame()：
+ *
+ * - 每RTF_GUARD_WINDOW_MS算一次实时系数 = 处理时间 / 音频时长（千分比）
+ * - 连续RTF_GUARD_DOWN_WINDOWS个窗口超过RTF_GUARD_HIGH_PERMILLE：降一级
+ * - 连续RTF_GUARD_UP_WINDOWS个窗口低于RTF_GUARD_LOW_PERMILLE：恢复一级（慢，避免在临界负载上来回跳）
+ *
+ * 降级顺序固定：先把Opus复杂度降到RTF_GUARD_OPUS_COMPLEXITY（CODEC），再关掉降噪（NS），
+ * 最后把AEC的滤波器长度（回声尾长）缩到RTF_GUARD_AEC_FILTER_LENGTH（AEC，要重建AFE，等空闲时生效）。
+ * 不适用的级（没有Opus或复杂度已经最低、没开NS、没有AEC）直接跳过。采集本身（I2S接收、麦克风调理）从不降级。
+ *
+ * RTF_GUARD_ENABLE=0时只统计（rtf_max水位），不降级。
+ * 状态是原子的：各任务可以随时加处理时间、读当前级别；endFrame()只在fetch任务里调用。
+ */
+
+#ifndef RTF_GUARD_H
+#define RTF_GUARD_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+/**
+ * @brief 降级项（数值就是降级顺序）
+ */
+enum class RtfStage : uint8_t {
+    CODEC = 0,      // Opus复杂度降到RTF_GUARD_OPUS_COMPLEXITY
+    NS,             // 关掉AFE降噪
+    AEC,            // 缩短AEC滤波器长度
+    COUNT
+};
+
+class RtfGuard {
+public:
+    /**
+     * @brief 某一级是否适用（启动时由各模块设置，不适用的级降级时跳过）
+     */
+    static void setAvailable(RtfStage stage, bool available);
+
+    /**
+     * @brief 累加这一帧某一级的处理时间（任意任务）
+     */
+    static void addBusy(uint32_t us) { busy_us_.fetch_add(us, std::memory_order_relaxed); }
+
+    /**
+     * @brief fetch任务每处理完一块调用：累计音频时长，满一个窗口时评估
+     *
+     * @return 降级状态变了返回true（调用者按degraded()应用NS/AEC的变化）
+     */
+    static bool endFrame(uint32_t frame_us);
+
+    /**
+     * @brief 这一项当前是否处于降级状态
+     */
+    static bool degraded(RtfStage stage) {
+        return (degraded_mask_.load(std::memory_order_relaxed) >> (unsigned)stage) & 1;
+    }
+
+    /**
+     * @brief 最近一个窗口的实时系数（千分比）
+     */
+    static uint32_t lastPermille() { return last_permille_.load(std::memory_order_relaxed); }
+
+private:
+    static const char* TAG;
+
+    static inline std::atomic<uint32_t> busy_us_ = 0;
+    static inline std::atomic<uint8_t> available_mask_ = 0;
+    static inline std::atomic<uint8_t> degraded_mask_ = 0;
+    static inline std::atomic<uint32_t> last_permille_ = 0;
+
+    // 以下只在fetch任务中访问
+    static inline uint32_t window_audio_us_ = 0;
+    static inline uint32_t over_windows_ = 0;
+    static inline uint32_t under_windows_ = 0;
+};
+
+#endif // RTF_GUARD_H
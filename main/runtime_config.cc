@@ -0,0 +1,115 @@
+/**
+ * @file runtime_config.cc
+ * @brief 🎚️ 运行时参数的取值范围和NVS读写
+ */
+
+#include "runtime_config.h"
+#include <string.h>
+#include "esp_log.h"
+#include "nvs.h"
+#include "project_config.h"
+
+static const char* TAG = "RuntimeConfig";
+static const char* NVS_NAMESPACE = "runtime";
+
+static const RuntimeConfig::Field kFields[(size_t)RuntimeParam::COUNT] = {
+    { "prebuffer_ms",    0,                            0,    PLAYBACK_PREBUFFER_MAX_MS, false },
+    { "uplink_delay_ms", UPLINK_COALESCE_MAX_DELAY_MS, 20,   200,                       false },
+    { "follow_up_ms",    CONVERSATION_FOLLOW_UP_MS,    2000, 60000,                     false },
+    { "idle_timeout_ms", CONVERSATION_IDLE_TIMEOUT_MS, 3000, 120000,                    false },
+    { "backoff_ms",      WS_RECONNECT_BASE_MS,         100,  60000,                     false },
+    { "backoff_max_ms",  WS_RECONNECT_MAX_MS,          1000, 600000,                    false },
+    { "heartbeat_ms",    WS_HEARTBEAT_INTERVAL_MS,     0,    60000,                     false },
+    { "hb_timeout_ms",   WS_HEARTBEAT_TIMEOUT_MS,      2000, 180000,                    false },
+    { "stats_ms",        PERF_REPORT_INTERVAL_MS,      1000, 3600000,                   false },
+    { "command_ms",      LOCAL_COMMAND_WINDOW_MS,      500,  SESSION_PREROLL_MS,        true  },
+    { "wifi_profile",    WIFI_PERF_PROFILE,            0,    LOW_MEMORY_PROFILE ? 0 : 2, true  },
+};
+
+RuntimeConfig::RuntimeConfig()
+    : value{}
+    , experiment{}
+{
+    for (size_t i = 0; i < (size_t)RuntimeParam::COUNT; i++) {
+        value[i] = kFields[i].default_value;
+    }
+}
+
+const RuntimeConfig::Field& RuntimeConfig::field(RuntimeParam param) {
+    return kFields[(size_t)param];
+}
+
+bool RuntimeConfig::set(RuntimeParam param, uint32_t v) {
+    const Field& f = field(param);
+    if (v < f.min || v > f.max) {
+        return false;
+    }
+    value[(size_t)param] = v;
+    return true;
+}
+
+bool RuntimeConfig::consistent() const {
+    if (get(RuntimeParam::BACKOFF_MS) > get(RuntimeParam::BACKOFF_MAX_MS)) {
+        return false;
+    }
+    uint32_t heartbeat = get(RuntimeParam::HEARTBEAT_MS);
+    return heartbeat == 0 || get(RuntimeParam::HEARTBEAT_TIMEOUT_MS) > heartbeat;
+}
+
+esp_err_t RuntimeConfig::load() {
+    nvs_handle_t nvs;
+    esp_err_t ret = nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs);
+    if (ret != ESP_OK) {
+        return ret;     // 从没保存过时命名空间不存在，使用默认值
+    }
+
+    RuntimeConfig saved = *this;
+    int overridden = 0;
+    for (size_t i = 0; i < (size_t)RuntimeParam::COUNT; i++) {
+        uint32_t v = 0;
+        if (nvs_get_u32(nvs, kFields[i].name, &v) == ESP_OK && saved.set((RuntimeParam)i, v) &&
+            v != kFields[i].default_value) {
+            overridden++;
+        }
+    }
+    size_t len = EXPERIMENT_LEN;
+    char name[EXPERIMENT_LEN];
+    if (nvs_get_str(nvs, "experiment", name, &len) == ESP_OK) {
+        memcpy(saved.experiment, name, EXPERIMENT_LEN);
+    }
+    nvs_close(nvs);
+
+    // 固件升级后默认值或范围变了，保存的组合可能不再成立，整组回到默认值
+    if (!saved.consistent()) {
+        ESP_LOGW(TAG, "⚠️ 保存的运行时参数互相矛盾，使用默认值");
+        return ESP_ERR_INVALID_STATE;
+    }
+    *this = saved;
+    ESP_LOGI(TAG, "✓ 已读取运行时参数: %d项不同于默认值, 实验组='%s'", overridden, experiment);
+    return ESP_OK;
+}
+
+esp_err_t RuntimeConfig::save() const {
+    nvs_handle_t nvs;
+    esp_err_t ret = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ 打开NVS失败: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    for (size_t i = 0; i < (size_t)RuntimeParam::COUNT && ret == ESP_OK; i++) {
+        ret = nvs_set_u32(nvs, kFields[i].name, value[i]);
+    }
+    if (ret == ESP_OK) {
+        ret = nvs_set_str(nvs, "experiment", experiment);
+    }
+    if (ret == ESP_OK) {
+        ret = nvs_commit(nvs);
+    }
+    nvs_close(nvs);
+
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ 保存运行时参数失败: %s", esp_err_to_name(ret));
+    }
+    return ret;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file runtime_config.h
+ * @brief 🎚️ 运行时参数 - 调优用的时长和间隔，保存在NVS里，服务器可以按设备下发，方便在整批设备上做A/B对比
+ *
+ * 默认值来自project_config.h，load()用NVS中保存的值覆盖。
+ * 服务器可以发{"type":"runtime_config","experiment":"...",<参数名>:<值>,...}修改，
+ * 只改消息里出现的参数；超出范围的参数忽略，在回复的rejected里列出。
+ * experiment是服务器给这组取值起的名字（最长23字节），设备只保存和回显，用来在日志里区分对照组。
+ *
+ * 大部分参数立即生效；标记为next_boot的在启动时读取一次（例如传给模块的init），保存后下次启动生效。
+ * 缓冲区大小、队列深度、DMA块长这类决定启动时内存布局的参数仍然在project_config.h里编译时确定。
+ */
+
+#ifndef RUNTIME_CONFIG_H
+#define RUNTIME_CONFIG_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+enum class RuntimeParam : uint8_t {
+    PREBUFFER_MS,       // 播放预缓冲目标，0=按下行到达抖动自适应
+    UPLINK_DELAY_MS,    // 上行合包延迟预算的上限（按RTT/2自适应，不超过这个值）
+    FOLLOW_UP_MS,       // 唤醒后和每轮回复后等用户开口的时长
+    IDLE_TIMEOUT_MS,    // 等回复时最长多久没有下行音频
+    BACKOFF_MS,         // WebSocket第一次重连的退避上限
+    BACKOFF_MAX_MS,     // WebSocket重连退避上限的最大值
+    HEARTBEAT_MS,       // 心跳间隔，0=关闭
+    HEARTBEAT_TIMEOUT_MS,   // 超过这个时间没有pong就断开重连
+    STATS_MS,           // 性能计数器定时上报间隔
+    COMMAND_MS,         // 唤醒后等待本地命令词的时长（下次启动生效）
+    WIFI_PROFILE,       // WiFi性能配置，WiFiManager::PerfProfile（下次启动生效）
+    COUNT
+};
+
+struct RuntimeConfig {
+    static constexpr size_t EXPERIMENT_LEN = 24;
+
+    /**
+     * @brief 参数描述：名称同时用作JSON字段名和NVS键（不超过15字节）
+     */
+    struct Field {
+        const char* name;
+        uint32_t default_value;
+        uint32_t min;
+        uint32_t max;
+        bool next_boot;
+    };
+
+    uint32_t value[(size_t)RuntimeParam::COUNT];
+    char experiment[EXPERIMENT_LEN];
+
+    RuntimeConfig();
+
+    uint32_t get(RuntimeParam param) const { return value[(size_t)param]; }
+
+    /**
+     * @brief 修改一个参数
+     *
+     * @return 超出范围时返回false，原值不变
+     */
+    bool set(RuntimeParam param, uint32_t v);
+
+    /**
+     * @brief 参数之间的约束（重连退避、心跳超时），不满足时调用方应放弃这次修改
+     */
+    bool consistent() const;
+
+    /**
+     * @brief 从NVS读取（没有保存过或超出范围的项保持默认值）
+     */
+    esp_err_t load();
+
+    /**
+     * @brief 写入NVS
+     */
+    esp_err_t save() const;
+
+    static const Field& field(RuntimeParam param);
+};
+
+#endif // RUNTIME_CONFIG_H
@@ -0,0 +1,189 @@
+/**
+ * @file sample_format.h
+ * @brief 🎛️ 编译期样本格式 - 采集/播放缓冲区和格式转换按样本类型、声道数做成模板，每种格式编译出自己的内核
+ *
+ * 以前32位采集、float处理、16位播放各写一套：采集任务每块判断一次rx_bits_per_chan，
+ * 麦克风稳定检测和打断淡出每个样本判断一次位宽，bsp_get_feed_data的参数是int16_t*、
+ * 32位采集时却要调用方按两倍字节分配。这里把格式变成类型：
+ *
+ * - SampleTraits<T>：int16_t（16位槽）、int32_t（32位I2S槽，INMP441的24位数据左对齐）、float（±1.0）
+ *   的槽位宽，以及到24位计数、16位满幅、float的换算，全部内联，没有分支
+ * - FrameFormat<T, CHANNELS>：一帧的样本类型、声道数和字节数
+ * - SampleConvert<In, Out>::run()：编译期选中的转换内核。缩窄的组合（int32→int16、float→int16）可以原地做：
+ *   每次先读进4个输入再写出，输出只覆盖已经读过的输入；相同类型就是memmove；没有特化的组合编译失败
+ * - SampleFormats::visit()：运行时的位宽和声道数（bsp_board_init的参数）只在建任务、开始读之前选一次模板实例，
+ *   之后的循环都是这个格式专用的
+ *
+ * ESP32-S3的向量指令（PIE）只有整数通道：16位的去直流和增益已经在MicConditioner里用esp-dsp的向量内核；
+ * 这里的转换是按4展开的标量循环（饱和被GCC编译成单条clamps，float走单精度FPU），加新格式只要加一个特化。
+ */
+
+#ifndef SAMPLE_FORMAT_H
+#define SAMPLE_FORMAT_H
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+#include "realtime_audio.h"
+
+template <typename T>
+struct SampleTraits;
+
+template <>
+struct SampleTraits<int16_t> {
+    static constexpr int SLOT_BITS = 16;
+
+    static AUDIO_HOT_INLINE int32_t toS24(int16_t s) { return (int32_t)s * 256; }
+    static AUDIO_HOT_INLINE int16_t toS16(int16_t s) { return s; }
+    static AUDIO_HOT_INLINE int16_t fromS16(int16_t s) { return s; }
+    static AUDIO_HOT_INLINE float toFloat(int16_t s) { return s * (1.0f / 32768.0f); }
+
+    static AUDIO_HOT_INLINE int16_t saturate(int32_t v) {
+        // GCC在Xtensa上会把这种写法编译成单条clamps指令
+        return (int16_t)(v < -32768 ? -32768 : (v > 32767 ? 32767 : v));
+    }
+};
+
+template <>
+struct SampleTraits<int32_t> {
+    static constexpr int SLOT_BITS = 32;
+
+    // 左对齐的24位数据：高16位是16位采集得到的值
+    static AUDIO_HOT_INLINE int32_t toS24(int32_t s) { return s >> 8; }
+    static AUDIO_HOT_INLINE int16_t toS16(int32_t s) { return (int16_t)(s >> 16); }
+    static AUDIO_HOT_INLINE int32_t fromS16(int16_t s) { return (int32_t)s * 65536; }
+    static AUDIO_HOT_INLINE float toFloat(int32_t s) { return s * (1.0f / 2147483648.0f); }
+};
+
+template <>
+struct SampleTraits<float> {
+    static constexpr int SLOT_BITS = 32;
+
+    static AUDIO_HOT_INLINE int32_t toS24(float s) { return (int32_t)(s * 8388608.0f); }
+    static AUDIO_HOT_INLINE int16_t toS16(float s) {
+        float v = s * 32768.0f;
+        return v >= 32767.0f ? 32767 : (v <= -32768.0f ? -32768 : (int16_t)lrintf(v));
+    }
+    static AUDIO_HOT_INLINE float fromS16(int16_t s) { return s * (1.0f / 32768.0f); }
+    static AUDIO_HOT_INLINE float toFloat(float s) { return s; }
+};
+
+/**
+ * @brief 一帧的格式：CHANNELS个T交织
+ */
+template <typename T, int CHANNELS>
+struct FrameFormat {
+    static_assert(CHANNELS == 1 || CHANNELS == 2, "只支持单声道和双声道");
+    using Sample = T;
+    static constexpr int channels = CHANNELS;
+    static constexpr size_t sample_bytes = sizeof(T);
+    static constexpr size_t frame_bytes = sizeof(T) * CHANNELS;
+    static constexpr int slot_bits = SampleTraits<T>::SLOT_BITS;
+};
+
+/**
+ * @brief 格式转换内核：run(in, out, count, shift)，count是样本数（不是帧数），shift只对int32→int16有意义
+ */
+template <typename In, typename Out>
+struct SampleConvert;
+
+template <typename T>
+struct SampleConvert<T, T> {
+    static AUDIO_HOT_INLINE void run(const T* in, T* out, size_t count, int shift = 0) {
+        if (in != out) {
+            memmove(out, in, count * sizeof(T));
+        }
+    }
+};
+
+// 原地缩窄时输出会覆盖还没读到的输入，必须告诉编译器两者可能别名
+typedef int16_t __attribute__((may_alias)) aliased_int16_t;
+
+template <>
+struct SampleConvert<int32_t, int16_t> {
+    // 右移shift位后饱和：shift=16等价于16位采集，每少移1位相当于+6dB
+    static AUDIO_HOT_INLINE void run(const int32_t* in, int16_t* out16, size_t count, int shift) {
+        aliased_int16_t* out = (aliased_int16_t*)out16;
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            int32_t a = in[i] >> shift;
+            int32_t b = in[i + 1] >> shift;
+            int32_t c = in[i + 2] >> shift;
+            int32_t d = in[i + 3] >> shift;
+            out[i] = SampleTraits<int16_t>::saturate(a);
+            out[i + 1] = SampleTraits<int16_t>::saturate(b);
+            out[i + 2] = SampleTraits<int16_t>::saturate(c);
+            out[i + 3] = SampleTraits<int16_t>::saturate(d);
+        }
+        for (; i < count; i++) {
+            out[i] = SampleTraits<int16_t>::saturate(in[i] >> shift);
+        }
+    }
+};
+
+template <>
+struct SampleConvert<float, int16_t> {
+    static AUDIO_HOT_INLINE void run(const float* in, int16_t* out16, size_t count, int shift = 0) {
+        aliased_int16_t* out = (aliased_int16_t*)out16;
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            float a = in[i];
+            float b = in[i + 1];
+            float c = in[i + 2];
+            float d = in[i + 3];
+            out[i] = SampleTraits<float>::toS16(a);
+            out[i + 1] = SampleTraits<float>::toS16(b);
+            out[i + 2] = SampleTraits<float>::toS16(c);
+            out[i + 3] = SampleTraits<float>::toS16(d);
+        }
+        for (; i < count; i++) {
+            out[i] = SampleTraits<float>::toS16(in[i]);
+        }
+    }
+};
+
+// 扩宽的组合不能原地做（输出比输入长）
+template <>
+struct SampleConvert<int16_t, float> {
+    static AUDIO_HOT_INLINE void run(const int16_t* in, float* out, size_t count, int shift = 0) {
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            out[i] = SampleTraits<int16_t>::toFloat(in[i]);
+            out[i + 1] = SampleTraits<int16_t>::toFloat(in[i + 1]);
+            out[i + 2] = SampleTraits<int16_t>::toFloat(in[i + 2]);
+            out[i + 3] = SampleTraits<int16_t>::toFloat(in[i + 3]);
+        }
+        for (; i < count; i++) {
+            out[i] = SampleTraits<int16_t>::toFloat(in[i]);
+        }
+    }
+};
+
+template <>
+struct SampleConvert<int16_t, int32_t> {
+    static AUDIO_HOT_INLINE void run(const int16_t* in, int32_t* out, size_t count, int shift = 0) {
+        for (size_t i = 0; i < count; i++) {
+            out[i] = SampleTraits<int32_t>::fromS16(in[i]);
+        }
+    }
+};
+
+class SampleFormats {
+public:
+    /**
+     * @brief 按运行时的槽位宽（16/32）和声道数（1/2）调用visitor(FrameFormat<...>{})，返回它的返回值
+     *
+     * 其余组合按16位单声道处理（调用方在初始化时已经检查过参数）。
+     */
+    template <typename Visitor>
+    static auto visit(int slot_bits, int channels, Visitor&& visitor) {
+        if (slot_bits == 32) {
+            return channels == 2 ? visitor(FrameFormat<int32_t, 2>{}) : visitor(FrameFormat<int32_t, 1>{});
+        }
+        return channels == 2 ? visitor(FrameFormat<int16_t, 2>{}) : visitor(FrameFormat<int16_t, 1>{});
+    }
+};
+
+#endif // SAMPLE_FORMAT_H
@@ -0,0 +1,224 @@
+/**
+ * @file sched_trace.cc
+ * @brief 🔬 调度追踪的SystemView/网络两种输出
+ */
+
+#include "sched_trace.h"
+#include <stdio.h>
+#include <string.h>
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#if SCHED_TRACE_MODE == 1
+#include "SEGGER_SYSVIEW.h"
+#endif
+
+static const char* TAG = "SchedTrace";
+
+// 和server/server.py的SCHED_MARKERS一致
+static const char* const kMarkerNames[] = {
+    "capture", "afe_feed", "afe_fetch", "uplink_push", "uplink_pop", "ws_enqueue", "ws_send", "ws_recv", "i2s_write",
+};
+static_assert(sizeof(kMarkerNames) / sizeof(kMarkerNames[0]) == (size_t)TraceMarker::COUNT, "标记名称不全");
+
+#if SCHED_TRACE_MODE == 2
+struct TraceEvent {
+    int64_t t_us;
+    uint32_t arg;
+    uint8_t marker;
+    uint8_t phase;      // Phase | 核心 << 7
+    uint8_t task;
+};
+
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static TraceEvent s_events[SchedTrace::CAPACITY];
+static size_t s_head = 0;
+static size_t s_count = 0;
+static uint32_t s_dropped = 0;
+static int64_t s_until_us = 0;          // 窗口结束时间，0=没有在记录
+static bool s_final_sent = true;        // 窗口结束后带结束标志的最后一批已经发出
+// 任务表：第一次出现时把名字拷下来（任务之后可能被删除，不能留着句柄再去取名字）
+static TaskHandle_t s_tasks[SchedTrace::MAX_TASKS];
+static char s_task_names[SchedTrace::MAX_TASKS][configMAX_TASK_NAME_LEN];
+static size_t s_task_count = 0;
+static size_t s_tasks_reported = 0;
+
+/**
+ * @brief 当前任务在任务表里的下标（在临界区里调用），表满时返回MAX_TASKS
+ */
+static IRAM_ATTR uint8_t task_index() {
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    for (size_t i = 0; i < s_task_count; i++) {
+        if (s_tasks[i] == self) {
+            return (uint8_t)i;
+        }
+    }
+    if (s_task_count == SchedTrace::MAX_TASKS) {
+        return (uint8_t)SchedTrace::MAX_TASKS;
+    }
+    const char* name = pcTaskGetName(nullptr);
+    size_t i = s_task_count++;
+    s_tasks[i] = self;
+    size_t n = 0;
+    while (n < configMAX_TASK_NAME_LEN - 1 && name[n] != '\0') {
+        s_task_names[i][n] = name[n];
+        n++;
+    }
+    s_task_names[i][n] = '\0';
+    return (uint8_t)i;
+}
+#endif
+
+void SchedTrace::init() {
+#if SCHED_TRACE_MODE == 1
+    ESP_LOGI(TAG, "🔬 调度追踪输出到SystemView，用户事件ID对照:");
+    for (size_t i = 0; i < (size_t)TraceMarker::COUNT; i++) {
+        ESP_LOGI(TAG, "   %u = %s", (unsigned)i, kMarkerNames[i]);
+    }
+#elif SCHED_TRACE_MODE == 2
+    ESP_LOGI(TAG, "🔬 调度追踪已编译进固件，等服务器发sched_trace开始记录");
+#endif
+}
+
+void SchedTrace::start(uint32_t duration_ms) {
+#if SCHED_TRACE_MODE == 2
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_lock);
+    s_head = 0;
+    s_count = 0;
+    s_dropped = 0;
+    s_until_us = now + (int64_t)duration_ms * 1000;
+    s_final_sent = false;
+    s_tasks_reported = 0;       // 每个窗口重新发一次任务表，服务器按窗口写文件
+    portEXIT_CRITICAL(&s_lock);
+    ESP_LOGI(TAG, "🔬 开始记录调度追踪 %lu ms", (unsigned long)duration_ms);
+#else
+    ESP_LOGW(TAG, "⚠️ 固件没有用SCHED_TRACE_MODE=2构建，忽略sched_trace（%lu ms）", (unsigned long)duration_ms);
+#endif
+}
+
+void SchedTrace::stop() {
+#if SCHED_TRACE_MODE == 2
+    portENTER_CRITICAL(&s_lock);
+    s_count = 0;
+    s_until_us = 0;
+    s_final_sent = true;
+    portEXIT_CRITICAL(&s_lock);
+#endif
+}
+
+IRAM_ATTR void SchedTrace::record(TraceMarker marker, Phase phase, uint32_t arg) {
+#if SCHED_TRACE_MODE == 1
+    if (phase != END) {
+        SEGGER_SYSVIEW_OnUserStart((unsigned)marker);
+    }
+    if (phase != BEGIN) {
+        SEGGER_SYSVIEW_OnUserStop((unsigned)marker);
+    }
+    (void)arg;
+#elif SCHED_TRACE_MODE == 2
+    int64_t now = esp_timer_get_time();
+    if (now >= s_until_us) {        // 没有在记录时不进临界区
+        return;
+    }
+    bool in_isr = xPortInIsrContext();
+    portENTER_CRITICAL_SAFE(&s_lock);
+    if (now < s_until_us) {
+        if (s_count < CAPACITY) {
+            TraceEvent& event = s_events[(s_head + s_count) % CAPACITY];
+            event.t_us = now;
+            event.arg = arg;
+            event.marker = (uint8_t)marker;
+            event.phase = (uint8_t)(phase | (xPortGetCoreID() << 7));
+            event.task = in_isr ? TASK_ISR : task_index();
+            s_count++;
+        } else {
+            s_dropped++;
+        }
+    }
+    portEXIT_CRITICAL_SAFE(&s_lock);
+#else
+    (void)marker;
+    (void)phase;
+    (void)arg;
+#endif
+}
+
+size_t SchedTrace::formatTasks(char* buf, size_t size) {
+#if SCHED_TRACE_MODE == 2
+    size_t pos = 0;
+    portENTER_CRITICAL(&s_lock);
+    size_t count = s_task_count;
+    size_t reported = s_tasks_reported;
+    portEXIT_CRITICAL(&s_lock);
+    if (count == reported) {
+        return 0;
+    }
+    // 每次发完整的表（最多MAX_TASKS个名字），服务器直接覆盖
+    int n = snprintf(buf, size, "{\"type\":\"sched_tasks\",\"tasks\":[");
+    pos = n > 0 ? (size_t)n : size;
+    for (size_t i = 0; i < count && pos < size; i++) {
+        n = snprintf(buf + pos, size - pos, "%s\"%s\"", i == 0 ? "" : ",", s_task_names[i]);
+        pos = (n < 0 || (size_t)n >= size - pos) ? size : pos + n;
+    }
+    if (pos < size) {
+        n = snprintf(buf + pos, size - pos, "]}");
+        pos = (n < 0 || (size_t)n >= size - pos) ? size : pos + n;
+    }
+    if (pos >= size) {
+        return 0;
+    }
+    portENTER_CRITICAL(&s_lock);
+    s_tasks_reported = count;
+    portEXIT_CRITICAL(&s_lock);
+    return pos;
+#else
+    (void)buf;
+    (void)size;
+    return 0;
+#endif
+}
+
+size_t SchedTrace::takeBatch(uint8_t* out) {
+#if SCHED_TRACE_MODE == 2
+    int64_t now = esp_timer_get_time();
+    size_t n = 0;
+    bool send = false;
+
+    portENTER_CRITICAL(&s_lock);
+    if (s_count > 0 || (!s_final_sent && now >= s_until_us)) {
+        send = true;
+        n = s_count < MAX_BATCH_EVENTS ? s_count : MAX_BATCH_EVENTS;
+        int64_t base_us = n > 0 ? s_events[s_head].t_us : now;
+        uint32_t flags = (now >= s_until_us && n == s_count) ? 1 : 0;
+        if (flags) {
+            s_final_sent = true;
+        }
+        memcpy(out, &base_us, sizeof(base_us));
+        memcpy(out + 8, &s_dropped, sizeof(s_dropped));
+        memcpy(out + 12, &flags, sizeof(flags));
+        uint8_t* p = out + BATCH_HEADER_BYTES;
+        for (size_t i = 0; i < n; i++) {
+            const TraceEvent& event = s_events[(s_head + i) % CAPACITY];
+            uint32_t dt_us = (uint32_t)(event.t_us - base_us);
+            memcpy(p, &dt_us, sizeof(dt_us));
+            p[4] = event.marker;
+            p[5] = event.phase;
+            p[6] = event.task;
+            p[7] = 0;
+            memcpy(p + 8, &event.arg, sizeof(event.arg));
+            p += EVENT_BYTES;
+        }
+        s_head = (s_head + n) % CAPACITY;
+        s_count -= n;
+    }
+    portEXIT_CRITICAL(&s_lock);
+
+    return send ? BATCH_HEADER_BYTES + n * EVENT_BYTES : 0;
+#else
+    (void)out;
+    return 0;
+#endif
+}
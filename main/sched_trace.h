@@ -0,0 +1,106 @@
+/**
+ * @file sched_trace.h
+ * @brief 🔬 调度追踪 - 在音频/网络热路径上打标记，看清任务之间的调度和核心争用
+ *
+ * 卡顿常常不是哪一段代码慢，而是采集任务、主循环里的WakeNet、WebSocket任务和WiFi之间的调度：
+ * 优先级反转、同一核心上互相抢占，日志看不出来。构建参数SCHED_TRACE_MODE打开后，
+ * 热路径上的SCHED_TRACE_*宏记录命名标记（采集一帧、喂AFE、取AFE结果、上行队列进出、
+ * WebSocket收发、写I2S），两种输出：
+ *
+ * - 1 = SystemView：标记映射成SEGGER SystemView的用户事件（OnUserStart/OnUserStop，ID=TraceMarker），
+ *   任务切换和中断由IDF的app_trace自动记录；sdkconfig.defaults.sysview里选JTAG（OpenOCD）或UART输出，
+ *   主机用SystemView软件打开追踪文件
+ * - 2 = 网络：标记连同任务、核心记在内存里的环形数组，服务器发{"type":"sched_trace","ms":N}开始一个
+ *   N毫秒的窗口，主循环用SCHED_TRACE控制帧发回服务器，server.py写成Chrome trace（Perfetto可以打开）。
+ *   拿不到任务切换（那要改FreeRTOS的trace宏），但每个标记带着当时的任务和核心，足够看出谁在抢谁：
+ *
+ *     base_us(u64) | dropped(u32) | flags(u32，bit0=窗口内最后一批) |
+ *     事件 × N：dt_us(u32，相对base_us) | marker(u8) | phase(u8，低2位0=标记/1=开始/2=结束，bit7=核心) |
+ *               task(u8，任务表下标) | 0(u8) | arg(u32)
+ *
+ *   任务表（下标→任务名）在出现新任务时先用{"type":"sched_tasks",...}文本消息发出
+ *
+ * 0（默认）时宏展开为空，参数不求值，热路径上没有任何开销。
+ * begin/end/mark可以在任意任务和中断中调用（网络模式下是一段很短的临界区）。
+ */
+
+#ifndef SCHED_TRACE_H
+#define SCHED_TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "project_config.h"
+#include "control_protocol.h"
+
+/**
+ * @brief 标记（数值是SystemView用户事件ID和网络追踪里的marker，只能在末尾追加）
+ */
+enum class TraceMarker : uint8_t {
+    CAPTURE,        // 采集任务处理一个DMA块并分发给各回调（arg=字节数）
+    AFE_FEED,       // 喂给AFE一帧
+    AFE_FETCH,      // AFE取一帧结果，包含WakeNet/VAD（arg=唤醒状态）
+    UPLINK_PUSH,    // 上行帧进发送队列（arg=0成功/1队列满）
+    UPLINK_POP,     // 发送任务从队列取出上行帧
+    WS_ENQUEUE,     // 消息进WebSocket发送队列（arg=lane << 16 | 长度）
+    WS_SEND,        // ws_send任务写socket（arg=长度）
+    WS_RECV,        // 收到一个WebSocket片段并分发（arg=长度）
+    I2S_WRITE,      // 写I2S发送通道（arg=字节数）
+    COUNT
+};
+
+class SchedTrace {
+public:
+    static constexpr size_t CAPACITY = 512;                 // 主循环来不及发时最多积压的事件
+    static constexpr size_t MAX_TASKS = 24;                 // 任务表大小，超出的任务记成MAX_TASKS
+    static constexpr size_t BATCH_HEADER_BYTES = 16;
+    static constexpr size_t EVENT_BYTES = 12;
+    static constexpr size_t MAX_BATCH_BYTES = ControlProtocol::MAX_FRAME - sizeof(ControlProtocol::Header);
+    static constexpr size_t MAX_BATCH_EVENTS = (MAX_BATCH_BYTES - BATCH_HEADER_BYTES) / EVENT_BYTES;
+    static constexpr uint8_t TASK_ISR = 0xFF;               // 在中断里记录的标记
+
+    enum Phase : uint8_t { MARK = 0, BEGIN = 1, END = 2 };
+
+    /**
+     * @brief 启动时调用一次：SystemView模式打印标记ID对照表
+     */
+    static void init();
+
+    /**
+     * @brief 网络模式：开始一个duration_ms的记录窗口（上一个窗口还没结束时重新计时）
+     */
+    static void start(uint32_t duration_ms);
+
+    /**
+     * @brief 网络模式：停止记录并丢弃没发出的事件（断开连接时调用）
+     */
+    static void stop();
+
+    static void record(TraceMarker marker, Phase phase, uint32_t arg);
+
+    /**
+     * @brief 网络模式：有新出现的任务时格式化成{"type":"sched_tasks","tasks":[...]}
+     *
+     * @return 写入的字符数，没有新任务时返回0
+     */
+    static size_t formatTasks(char* buf, size_t size);
+
+    /**
+     * @brief 网络模式：取出一批事件编码成SCHED_TRACE帧的负载
+     *
+     * @param out 至少MAX_BATCH_BYTES字节
+     * @return 负载字节数，没有事件（或窗口已经结束且最后一批已发出）时返回0
+     */
+    static size_t takeBatch(uint8_t* out);
+};
+
+#if SCHED_TRACE_MODE
+#define SCHED_TRACE_BEGIN(marker, arg) SchedTrace::record(TraceMarker::marker, SchedTrace::BEGIN, (uint32_t)(arg))
+#define SCHED_TRACE_END(marker, arg) SchedTrace::record(TraceMarker::marker, SchedTrace::END, (uint32_t)(arg))
+#define SCHED_TRACE_MARK(marker, arg) SchedTrace::record(TraceMarker::marker, SchedTrace::MARK, (uint32_t)(arg))
+#else
+#define SCHED_TRACE_BEGIN(marker, arg) do { (void)sizeof(arg); } while (0)
+#define SCHED_TRACE_END(marker, arg) do { (void)sizeof(arg); } while (0)
+#define SCHED_TRACE_MARK(marker, arg) do { (void)sizeof(arg); } while (0)
+#endif
+
+#endif // SCHED_TRACE_H
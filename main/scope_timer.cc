@@ -0,0 +1,58 @@
+/**
+ * @file scope_timer.cc
+ * @brief ⏱️ 作用域计时直方图汇总
+ */
+
+#include "scope_timer.h"
+
+#if SCOPE_TIMERS
+
+#include <stdio.h>
+#include "sdkconfig.h"
+
+static const char* const kSiteNames[] = {
+    "afe_feed", "afe_fetch", "capture", "feed_data", "feed_stream", "ws_send_binary", "ws_write", "i2s_write",
+};
+static_assert(sizeof(kSiteNames) / sizeof(kSiteNames[0]) == (size_t)TimerSite::COUNT, "计时点名称不全");
+
+size_t ScopeTimers::formatJson(char* buf, size_t size) {
+    int n = snprintf(buf, size, "{\"type\":\"scope_timers\",\"mhz\":%d,\"shift\":%u",
+                     CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ, SHIFT);
+    if (n < 0 || (size_t)n >= size) {
+        return 0;
+    }
+    size_t pos = n;
+    bool any = false;
+    for (size_t site = 0; site < (size_t)TimerSite::COUNT; site++) {
+        uint32_t counts[BUCKETS];
+        uint32_t total = 0;
+        for (size_t b = 0; b < BUCKETS; b++) {
+            counts[b] = 0;
+            for (int core = 0; core < portNUM_PROCESSORS; core++) {
+                counts[b] += buckets_[core][site][b].load(std::memory_order_relaxed);
+            }
+            total += counts[b];
+        }
+        if (total == 0) {
+            continue;
+        }
+        any = true;
+        n = snprintf(buf + pos, size - pos, ",\"%s\":[", kSiteNames[site]);
+        for (size_t b = 0; b < BUCKETS && n >= 0 && (size_t)n < size - pos; b++) {
+            pos += n;
+            n = snprintf(buf + pos, size - pos, b + 1 < BUCKETS ? "%lu," : "%lu]", (unsigned long)counts[b]);
+        }
+        if (n < 0 || (size_t)n >= size - pos) {
+            return 0;
+        }
+        pos += n;
+    }
+    if (!any || pos + 2 > size) {
+        return 0;
+    }
+    buf[pos++] = '}';
+    buf[pos] = '\0';
+    return pos;
+}
+
+#endif // SCOPE_TIMERS
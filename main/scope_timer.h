@@ -0,0 +1,100 @@
+/**
+ * @file scope_timer.h
+ * @brief ⏱️ 作用域计时 - 热路径函数的耗时分布（CPU周期，log2分桶）
+ *
+ * 计数器只有总量，I2S_WRITE_LE_*也只覆盖写I2S一处；卡顿时想知道的是喂AFE、取AFE结果（WakeNet/VAD）、
+ * 处理一条下行消息、发一帧这些调用的耗时分布：平均很快，偶尔一次慢到几十毫秒的长尾。
+ * 构建参数SCOPE_TIMERS=1打开后，SCOPE_TIMER(site)在当前作用域入口读一次esp_cpu_get_cycle_count()，
+ * 离开作用域（包括中途return）时按经过的周期数计入这个计时点的直方图：
+ *
+ * - 固定SCOPE_TIMER_BUCKETS个桶，桶k（0<k<最后一个）是[2^(k+SHIFT), 2^(k+SHIFT+1))个周期，
+ *   桶0是不到2^(SHIFT+1)个周期，最后一个桶是更长的（240MHz、SHIFT=8时桶0不到2.1us，最后一个桶超过35ms）
+ * - 每个核心一张表，只加自己核心的计数（relaxed原子加，同核心上的任务抢占也不会丢计数），
+ *   没有锁，两个核心不写同一个字
+ * - 启动以来累计，不清零；formatJson()把两个核心的表加起来，
+ *   主循环随stats一起以{"type":"scope_timers",...}上报，server.py算出每个计时点的p50/p99（微秒）
+ *
+ * 周期计数器是每个核心自己的：任务在两次读之间被换到另一个核心时这一次的值没有意义，按溢出
+ * （很大的无符号数）落进最后一个桶。热路径任务都绑定了核心（见project_config.h的任务拓扑），不受影响。
+ * 服务器按默认主频换算微秒；空闲降频（power_policy.h）期间的调用按周期算没错，换算成时间会偏小。
+ *
+ * 0（默认）时宏展开为空，不读周期计数器，也不占内存。
+ */
+
+#ifndef SCOPE_TIMER_H
+#define SCOPE_TIMER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "project_config.h"
+
+/**
+ * @brief 计时点（JSON里的键名见scope_timer.cc）
+ */
+enum class TimerSite : uint8_t {
+    AFE_FEED,       // 喂AFE一块（AEC在这里）
+    AFE_FETCH,      // 取AFE一块结果（WakeNet/VAD；AFE缓冲区空时包含等feed的时间）
+    CAPTURE,        // 采集任务处理一个DMA块并分发给各回调
+    FEED_DATA,      // bsp_get_feed_data（采集任务启动前的阻塞读）
+    FEED_STREAM,    // AudioManager处理一段下行音频（解码、重采样、进抖动缓冲区）
+    WS_SEND_BINARY, // WebSocketClient::sendBinary入队
+    WS_WRITE,       // ws_send任务写socket
+    I2S_WRITE,      // 写I2S发送通道（包含等DMA空位）
+    COUNT
+};
+
+#if SCOPE_TIMERS
+
+#include <atomic>
+#include "esp_cpu.h"
+#include "freertos/FreeRTOS.h"
+
+class ScopeTimers {
+public:
+    static constexpr size_t BUCKETS = SCOPE_TIMER_BUCKETS;
+    static constexpr unsigned SHIFT = SCOPE_TIMER_SHIFT;
+
+    static void record(TimerSite site, uint32_t cycles) {
+        unsigned bits = 32 - __builtin_clz(cycles | 1);
+        size_t bucket = bits > SHIFT + 1 ? bits - SHIFT - 1 : 0;
+        if (bucket >= BUCKETS) {
+            bucket = BUCKETS - 1;
+        }
+        buckets_[esp_cpu_get_core_id()][(size_t)site][bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 汇总成{"type":"scope_timers","mhz":..,"shift":..,"<计时点>":[各桶计数],...}（没有计数的计时点不输出）
+     *
+     * @return 写入的字符数（不含结尾'\0'），缓冲区不够或还没有任何计数时返回0
+     */
+    static size_t formatJson(char* buf, size_t size);
+
+private:
+    static inline std::atomic<uint32_t> buckets_[portNUM_PROCESSORS][(size_t)TimerSite::COUNT][BUCKETS] = {};
+};
+
+/**
+ * @brief RAII：构造时读周期计数器，析构时计入直方图
+ */
+class ScopeTimer {
+public:
+    explicit ScopeTimer(TimerSite site) : site_(site), start_(esp_cpu_get_cycle_count()) {}
+    ~ScopeTimer() { ScopeTimers::record(site_, (uint32_t)(esp_cpu_get_cycle_count() - start_)); }
+
+    ScopeTimer(const ScopeTimer&) = delete;
+    ScopeTimer& operator=(const ScopeTimer&) = delete;
+
+private:
+    TimerSite site_;
+    esp_cpu_cycle_count_t start_;
+};
+
+#define SCOPE_TIMER_CONCAT_(a, b) a##b
+#define SCOPE_TIMER_NAME_(line) SCOPE_TIMER_CONCAT_(scope_timer_, line)
+#define SCOPE_TIMER(site) ScopeTimer SCOPE_TIMER_NAME_(__LINE__)(TimerSite::site)
+#else
+#define SCOPE_TIMER(site) do { } while (0)
+#endif
+
+#endif // SCOPE_TIMER_H
@@ -0,0 +1,102 @@
+/**
+ * @file session_arena.cc
+ * @brief 🧱 会话内存池实现
+ */
+
+#include "session_arena.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+
+const char* SessionArena::TAG = "SessionArena";
+
+SessionArena::SessionArena(const char* name, size_t capacity, uint32_t caps)
+    : name_(name)
+    , base_(nullptr)
+    , capacity_(0)
+    , caps_(caps)
+    , offset_(0)
+    , live_(0)
+    , turn_peak_(0)
+    , peak_(0)
+    , fallbacks_(0)
+    , lock_(portMUX_INITIALIZER_UNLOCKED)
+{
+    base_ = (uint8_t*)heap_caps_aligned_alloc(16, capacity, caps);
+    if (base_) {
+        capacity_ = capacity;
+        ESP_LOGI(TAG, "✓ %s: %u 字节", name_, (unsigned)capacity_);
+    } else {
+        ESP_LOGE(TAG, "❌ %s 分配失败 (%u 字节)，退回逐次堆分配", name_, (unsigned)capacity);
+    }
+}
+
+SessionArena::~SessionArena() {
+    heap_caps_free(base_);
+}
+
+void* SessionArena::alloc(size_t bytes, size_t align) {
+    if (bytes == 0) {
+        return nullptr;
+    }
+    if (align < 4) {
+        align = 4;
+    }
+
+    void* ptr = nullptr;
+    portENTER_CRITICAL(&lock_);
+    size_t start = (offset_ + align - 1) & ~(align - 1);
+    if (base_ && align <= 16 && start + bytes <= capacity_) {
+        ptr = base_ + start;
+        offset_ = start + bytes;
+        live_++;
+        if (offset_ > turn_peak_) {
+            turn_peak_ = offset_;
+        }
+        if (offset_ > peak_) {
+            peak_ = offset_;
+        }
+    } else {
+        fallbacks_++;
+    }
+    portEXIT_CRITICAL(&lock_);
+
+    if (!ptr) {
+        ptr = heap_caps_aligned_alloc(align, bytes, caps_);
+    }
+    return ptr;
+}
+
+void SessionArena::release(void* ptr) {
+    if (!ptr) {
+        return;
+    }
+    if (!owns(ptr)) {
+        heap_caps_free(ptr);
+        return;
+    }
+
+    portENTER_CRITICAL(&lock_);
+    if (live_ > 0 && --live_ == 0) {
+        offset_ = 0;
+    }
+    portEXIT_CRITICAL(&lock_);
+}
+
+void SessionArena::endTurn() {
+    portENTER_CRITICAL(&lock_);
+    size_t turn_peak = turn_peak_;
+    size_t live = live_;
+    uint32_t fallbacks = fallbacks_;
+    turn_peak_ = offset_;
+    portEXIT_CRITICAL(&lock_);
+
+    ESP_LOGI(TAG, "📊 %s 本轮峰值 %u/%u 字节, 未归还 %u, 累计退回堆分配 %lu 次",
+             name_, (unsigned)turn_peak, (unsigned)capacity_, (unsigned)live, (unsigned long)fallbacks);
+}
+
+SessionArena::Stats SessionArena::stats() const {
+    portENTER_CRITICAL(&lock_);
+    Stats s = { capacity_, turn_peak_, peak_, fallbacks_ };
+    portEXIT_CRITICAL(&lock_);
+    return s;
+}
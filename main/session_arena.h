@@ -0,0 +1,107 @@
+/**
+ * @file session_arena.h
+ * @brief 🧱 会话内存池 - 一轮对话内的临时缓冲区从预分配的内存块里顺序切出
+ *
+ * 提示音片段、ADPCM解码缓冲区这类对象每轮对话都要申请和释放，直接走malloc会让堆碎片越来越多，
+ * 峰值内存也不好估计。这里启动时按指定的heap_caps（内部RAM/DMA/PSRAM）一次性申请一块内存，
+ * alloc()只移动指针；所有分配都归还后指针自动回到开头，下一轮从头复用。
+ *
+ * endTurn()在一轮对话结束（tts_end）时调用，记录本轮峰值；如果还有没归还的分配，
+ * 会等它们归还后再复用，不会切走仍在使用的内存。
+ * 内存块用完时退回heap_caps_malloc，release()按地址判断来源，调用方不用关心。
+ *
+ * alloc()/release()可以在不同任务中调用，内部用自旋锁保护（临界区只有几条指令）。
+ */
+
+#ifndef SESSION_ARENA_H
+#define SESSION_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <new>
+#include <utility>
+#include "freertos/FreeRTOS.h"
+
+class SessionArena {
+public:
+    /**
+     * @brief 使用统计（字节）
+     */
+    struct Stats {
+        size_t capacity;
+        size_t turn_peak;       // 本轮最高水位
+        size_t peak;            // 启动以来最高水位
+        uint32_t fallbacks;     // 内存块不够、退回堆分配的次数
+    };
+
+    /**
+     * @brief 创建内存池
+     *
+     * @param name 日志中的名称
+     * @param capacity 字节数
+     * @param caps heap_caps分配标志（I2S缓冲区用MALLOC_CAP_DMA，大块数据用MALLOC_CAP_SPIRAM）
+     */
+    SessionArena(const char* name, size_t capacity, uint32_t caps);
+    ~SessionArena();
+
+    SessionArena(const SessionArena&) = delete;
+    SessionArena& operator=(const SessionArena&) = delete;
+
+    bool isValid() const { return base_ != nullptr; }
+
+    /**
+     * @brief 分配一块内存（align必须是2的幂，最大16）
+     *
+     * @return 失败时返回nullptr
+     */
+    void* alloc(size_t bytes, size_t align = 4);
+
+    /**
+     * @brief 归还alloc()得到的内存（nullptr忽略）
+     */
+    void release(void* ptr);
+
+    /**
+     * @brief 在内存池里构造对象，用destroy()释放
+     */
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        void* mem = alloc(sizeof(T), alignof(T));
+        return mem ? new (mem) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    template <typename T>
+    void destroy(T* obj) {
+        if (obj) {
+            obj->~T();
+            release(obj);
+        }
+    }
+
+    /**
+     * @brief 一轮对话结束：输出本轮峰值并清零
+     */
+    void endTurn();
+
+    Stats stats() const;
+
+private:
+    static const char* TAG;
+
+    bool owns(const void* ptr) const {
+        return (const uint8_t*)ptr >= base_ && (const uint8_t*)ptr < base_ + capacity_;
+    }
+
+    const char* name_;
+    uint8_t* base_;
+    size_t capacity_;
+    uint32_t caps_;
+    size_t offset_;
+    size_t live_;           // 未归还的分配数（只统计内存块内的）
+    size_t turn_peak_;
+    size_t peak_;
+    uint32_t fallbacks_;
+    mutable portMUX_TYPE lock_;
+};
+
+#endif // SESSION_ARENA_H
@@ -0,0 +1,74 @@
+/**
+ * @file session_capture.cc
+ * @brief 🎙️ 会话录制的设备端时间戳
+ */
+
+#include "session_capture.h"
+#include <string.h>
+#include "esp_timer.h"
+
+SessionCapture::SessionCapture()
+    : lock_(portMUX_INITIALIZER_UNLOCKED)
+    , events_{}
+    , head_(0)
+    , count_(0)
+    , dropped_(0)
+    , enabled_(false)
+{
+}
+
+void SessionCapture::setEnabled(bool enabled) {
+    portENTER_CRITICAL(&lock_);
+    enabled_.store(enabled, std::memory_order_relaxed);
+    head_ = 0;
+    count_ = 0;
+    dropped_ = 0;
+    portEXIT_CRITICAL(&lock_);
+}
+
+void SessionCapture::record(Kind kind, size_t len) {
+    if (!isEnabled()) {
+        return;
+    }
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&lock_);
+    if (count_ < CAPACITY) {
+        Event& event = events_[(head_ + count_) % CAPACITY];
+        event.t_us = now;
+        event.len = len > MAX_LEN ? MAX_LEN : (uint32_t)len;
+        event.kind = kind;
+        count_++;
+    } else {
+        dropped_++;
+    }
+    portEXIT_CRITICAL(&lock_);
+}
+
+size_t SessionCapture::takeBatch(uint8_t* out, uint32_t max_delay_ms) {
+    int64_t now = esp_timer_get_time();
+    size_t n = 0;
+
+    // 一批最多29条，直接在临界区里编码，不在主任务栈上另存一份；负载不保证对齐，逐个memcpy
+    portENTER_CRITICAL(&lock_);
+    if (count_ >= MAX_BATCH_EVENTS ||
+        (count_ > 0 && now - events_[head_].t_us >= (int64_t)max_delay_ms * 1000)) {
+        n = count_ < MAX_BATCH_EVENTS ? count_ : MAX_BATCH_EVENTS;
+        int64_t base_us = events_[head_].t_us;
+        memcpy(out, &base_us, sizeof(base_us));
+        memcpy(out + 8, &dropped_, sizeof(dropped_));
+        uint8_t* p = out + BATCH_HEADER_BYTES;
+        for (size_t i = 0; i < n; i++) {
+            const Event& event = events_[(head_ + i) % CAPACITY];
+            uint32_t dt_us = (uint32_t)(event.t_us - base_us);
+            uint32_t kind_len = ((uint32_t)event.kind << 28) | event.len;
+            memcpy(p, &dt_us, sizeof(dt_us));
+            memcpy(p + 4, &kind_len, sizeof(kind_len));
+            p += EVENT_BYTES;
+        }
+        head_ = (head_ + n) % CAPACITY;
+        count_ -= n;
+    }
+    portEXIT_CRITICAL(&lock_);
+
+    return n == 0 ? 0 : BATCH_HEADER_BYTES + n * EVENT_BYTES;
+}
@@ -0,0 +1,88 @@
+/**
+ * @file session_capture.h
+ * @brief 🎙️ 会话录制 - 记录每条消息在设备上收发的时间，批量发给服务器写进录制文件
+ *
+ * 服务器设置RELAY_CAPTURE_DIR后，把每个连接的上下行消息原样写成.vcap文件（格式见server/server.py
+ * 的SessionRecorder），但时间戳是服务器的：下行消息在WiFi上排队、重传花的时间看不到。
+ * hello里双方都带"capture":true（需要二进制控制帧）时，设备另外记录每条消息的设备时间
+ * （esp_timer微秒）和长度，不带数据本身，攒成一批用CAPTURE控制帧发回服务器：
+ *
+ *   base_us(u64) | dropped(u32) | 事件 × N：dt_us(u32，相对base_us) | kind << 28 | len(u32)
+ *
+ * 设备只记音频消息和唤醒：WebSocket保证顺序，服务器把第n条设备端DOWNLINK_AUDIO和自己发出的
+ * 第n条下行音频对应起来。控制消息两边的条数对不上（PONG在WebSocketClient里就处理掉了），
+ * 回放时按前一条下行音频的时间差换算到设备时间。
+ * Kind的数值同时是录制文件里的记录类型，tools/host_bench和tools/replay_capture.py共用。
+ *
+ * record()可以在任意任务中调用（临界区里追加到固定大小的环形数组，满了丢弃并计数），
+ * 主循环每轮调用takeBatch()，攒够一帧或最早的事件等了max_delay_ms才取出。
+ */
+
+#ifndef SESSION_CAPTURE_H
+#define SESSION_CAPTURE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include "freertos/FreeRTOS.h"
+#include "control_protocol.h"
+
+class SessionCapture {
+public:
+    /**
+     * @brief 消息类型（数值写进录制文件，只能在末尾追加）
+     */
+    enum class Kind : uint8_t {
+        NONE = 0,
+        UPLINK_AUDIO,       // 设备→服务器的音频消息（合包后）
+        DOWNLINK_AUDIO,     // 服务器→设备的音频消息（按第一个片段到达的时间）
+        UPLINK_CONTROL,     // 设备→服务器的控制消息（只有服务器端记录）
+        DOWNLINK_CONTROL,   // 服务器→设备的控制消息（文本或二进制控制帧，只有服务器端记录）
+        SESSION,            // 唤醒，开始一次云端会话
+        COUNT
+    };
+
+    static constexpr size_t CAPACITY = 128;                 // 主循环卡住时最多积压的事件
+    static constexpr size_t BATCH_HEADER_BYTES = 12;
+    static constexpr size_t EVENT_BYTES = 8;
+    static constexpr size_t MAX_BATCH_BYTES = ControlProtocol::MAX_FRAME - sizeof(ControlProtocol::Header);
+    static constexpr size_t MAX_BATCH_EVENTS = (MAX_BATCH_BYTES - BATCH_HEADER_BYTES) / EVENT_BYTES;
+    static constexpr uint32_t MAX_LEN = (1u << 28) - 1;
+
+    SessionCapture();
+
+    /**
+     * @brief 打开/关闭记录（hello协商后打开，断开连接时关闭并清空没发出的事件）
+     */
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 记录一条消息（未打开时直接返回）
+     */
+    void record(Kind kind, size_t len);
+
+    /**
+     * @brief 取出一批事件编码成CAPTURE帧的负载
+     *
+     * @param out 至少MAX_BATCH_BYTES字节
+     * @return 负载字节数，没攒够一帧且最早的事件还没等到max_delay_ms时返回0
+     */
+    size_t takeBatch(uint8_t* out, uint32_t max_delay_ms);
+
+private:
+    struct Event {
+        int64_t t_us;
+        uint32_t len;
+        Kind kind;
+    };
+
+    mutable portMUX_TYPE lock_;
+    Event events_[CAPACITY];
+    size_t head_;           // 最早一条事件的下标
+    size_t count_;
+    uint32_t dropped_;      // 积压满了丢掉的事件（累计）
+    std::atomic<bool> enabled_;
+};
+
+#endif // SESSION_CAPTURE_H
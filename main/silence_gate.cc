@@ -0,0 +1,111 @@
+/**
+ * @file silence_gate.cc
+ * @brief 🤫 播放静音检测和舒适噪声
+ */
+
+#include "silence_gate.h"
+#include <math.h>
+#include <string.h>
+#include "buffer_placement.h"
+#include "dsps_dotprod.h"
+#include "project_config.h"
+#include "realtime_audio.h"
+
+// dsps_dotprod_s16_ae32要求至少4个样本，太短的片段直接算
+static const size_t kMinDotprodLength = 8;
+static const uint32_t kSilencePower = PLAYBACK_SILENCE_RMS * PLAYBACK_SILENCE_RMS;
+static const uint32_t kVoicePower = PLAYBACK_VOICE_RMS * PLAYBACK_VOICE_RMS;
+static const uint32_t kMaxNoisePower = PLAYBACK_COMFORT_NOISE_MAX_RMS * PLAYBACK_COMFORT_NOISE_MAX_RMS;
+
+SilenceGate::SilenceGate(uint32_t sample_rate, size_t max_count)
+    : noise_((int16_t*)BufferPlacement::alloc("comfort_noise", max_count * sizeof(int16_t), Placement::DMA))
+    , capacity_(max_count)
+    , hangover_samples_((size_t)sample_rate * PLAYBACK_SILENCE_HANGOVER_MS / 1000)
+    , quiet_samples_(0)
+    , noise_power_(0)
+    , noise_amplitude_(0)
+    , rng_(0x2545F491u)
+    , silent_(false)
+{
+}
+
+SilenceGate::~SilenceGate() {
+    BufferPlacement::free(noise_);
+}
+
+uint32_t AUDIO_HOT_IRAM SilenceGate::framePower(const int16_t* samples, size_t count) {
+    if (count == 0) {
+        return 0;
+    }
+    if (count < kMinDotprodLength) {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < count; i++) {
+            sum += (int32_t)samples[i] * samples[i];
+        }
+        return (uint32_t)(sum / count);
+    }
+
+    // 粗档 Σx² >> 30：累加器40位，一个播放块的满幅信号也装得下，结果只有几百
+    int16_t coarse = 0;
+    dsps_dotprod_s16(samples, samples, &coarse, (int)count, -15);
+    if (coarse > 0) {
+        return (uint32_t)(((uint64_t)coarse << 30) / count);
+    }
+    // Σx² < 2^30，细档 Σx² >> 15 放得进16位（向上取整后可能正好是32768，按无符号读），取区间中点
+    int16_t fine = 0;
+    dsps_dotprod_s16(samples, samples, &fine, (int)count, 0);
+    uint64_t sum = (uint64_t)(uint16_t)fine << 15;
+    return (uint32_t)((sum > 16384 ? sum - 16384 : 0) / count);
+}
+
+const int16_t* AUDIO_HOT_IRAM SilenceGate::process(const int16_t* samples, size_t count) {
+    if (!PLAYBACK_SILENCE_GATE_ENABLE || !noise_ || count == 0 || count > capacity_) {
+        return samples;
+    }
+
+    uint32_t power = framePower(samples, count);
+    if (silent_) {
+        if (power > kVoicePower) {
+            silent_ = false;
+            quiet_samples_ = 0;
+            return samples;
+        }
+    } else {
+        if (power >= kSilencePower) {
+            quiet_samples_ = 0;
+            return samples;
+        }
+        quiet_samples_ += count;
+        if (quiet_samples_ < hangover_samples_) {
+            return samples;
+        }
+        silent_ = true;
+    }
+
+    // 静音帧的能量就是底噪，平滑后决定舒适噪声的电平（幅度为A的均匀噪声RMS是A/√3）
+    uint32_t floor_power = power < kMaxNoisePower ? power : kMaxNoisePower;
+    noise_power_ = noise_power_ == 0 ? floor_power : noise_power_ - (noise_power_ >> 3) + (floor_power >> 3);
+    noise_amplitude_ = (int32_t)(sqrtf((float)noise_power_) * 1.732f + 0.5f);
+
+    fillComfortNoise(noise_, count);
+    return noise_;
+}
+
+void AUDIO_HOT_IRAM SilenceGate::fillComfortNoise(int16_t* out, size_t count) {
+    if (noise_amplitude_ == 0) {
+        memset(out, 0, count * sizeof(int16_t));
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        rng_ = rng_ * 1664525u + 1013904223u;
+        int32_t r = (int16_t)(rng_ >> 16);
+        out[i] = (int16_t)((r * noise_amplitude_) >> 15);
+    }
+}
+
+void SilenceGate::reset() {
+    quiet_samples_ = 0;
+    noise_power_ = 0;
+    noise_amplitude_ = 0;
+    silent_ = false;
+}
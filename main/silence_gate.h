@@ -0,0 +1,72 @@
+/**
+ * @file silence_gate.h
+ * @brief 🤫 播放静音检测 - 按帧能量判断回复里的静音段，用舒适噪声代替
+ *
+ * 以前下行PCM消息逐个样本比较相邻差值，"没有变化"的整条消息直接丢掉：
+ * 每条消息都要扫一遍，轻声的TTS段落也会被当成无效数据丢掉，播放时出现断音和欠载。
+ * 现在所有消息都写进抖动缓冲区，播放任务每输出一块计算一次平均能量：
+ * - dsps_dotprod_s16(x, x)求Σx²，先用粗档（>>30）排除响的帧，再用细档（>>15）算安静帧，16位结果不会溢出
+ * - 低于PLAYBACK_SILENCE_RMS持续PLAYBACK_SILENCE_HANGOVER_MS后进入静音，高于PLAYBACK_VOICE_RMS立即恢复（滞回）
+ * - 静音期间输出和底噪同电平的舒适噪声（上限PLAYBACK_COMFORT_NOISE_MAX_RMS），欠载补偿也用它填充，
+ *   听起来是连续的底噪，而不是一会儿有杂音一会儿完全没声
+ *
+ * 所有时长都按样本数折算，不依赖每次传入的块大小（抖动缓冲区绕回时一块会分两次传入）。
+ * 只在播放任务中调用，内部不加锁。
+ */
+
+#ifndef SILENCE_GATE_H
+#define SILENCE_GATE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+class SilenceGate {
+public:
+    /**
+     * @param sample_rate 采样率
+     * @param max_count 每次最多处理的样本数（播放块大小），舒适噪声缓冲区按它分配
+     */
+    SilenceGate(uint32_t sample_rate, size_t max_count);
+    ~SilenceGate();
+
+    SilenceGate(const SilenceGate&) = delete;
+    SilenceGate& operator=(const SilenceGate&) = delete;
+
+    bool isValid() const { return noise_ != nullptr; }
+
+    /**
+     * @brief 处理一帧回复音频
+     *
+     * @return 要输出的数据：有声时是samples本身，静音时是内部的舒适噪声缓冲区（下次调用前有效）
+     */
+    const int16_t* process(const int16_t* samples, size_t count);
+
+    /**
+     * @brief 按当前底噪电平生成舒适噪声（还没测到底噪时填0）
+     */
+    void fillComfortNoise(int16_t* out, size_t count);
+
+    /**
+     * @brief 回到有声状态，忘掉底噪（一段回复结束或被打断时调用）
+     */
+    void reset();
+
+    bool isSilent() const { return silent_; }
+
+    /**
+     * @brief 一帧的平均能量 Σx²/n
+     */
+    static uint32_t framePower(const int16_t* samples, size_t count);
+
+private:
+    int16_t* noise_;
+    size_t capacity_;
+    size_t hangover_samples_;
+    size_t quiet_samples_;          // 连续低于静音阈值的样本数
+    uint32_t noise_power_;          // 静音帧能量的平滑值
+    int32_t noise_amplitude_;       // 均匀分布噪声的幅度（RMS × √3）
+    uint32_t rng_;
+    bool silent_;
+};
+
+#endif // SILENCE_GATE_H
@@ -0,0 +1,268 @@
+/**
+ * @file soak_test.cc
+ * @brief 🔥 浸泡测试实现
+ */
+
+#include "soak_test.h"
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <algorithm>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_random.h"
+#include "esp_heap_caps.h"
+#include "esp_netif.h"
+#include "lwip/sockets.h"
+#include "perf_counters.h"
+#include "task_factory.h"
+
+const char* SoakTest::TAG = "SoakTest";
+
+// discard协议（RFC 863）：网关收下就扔，不会回包占下行
+static constexpr uint16_t kDiscardPort = 9;
+static constexpr uint32_t kHeapSampleMs = 1000;
+static constexpr uint32_t kInternalCaps = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+
+static uint32_t ws_drop_count() {
+    return PerfCounters::get(PerfCounter::WS_SEND_FULL_DROPS) + PerfCounters::get(PerfCounter::WS_SEND_STALE_DROPS);
+}
+
+static uint32_t uplink_drop_count() {
+    return PerfCounters::get(PerfCounter::UPLINK_POOL_DROPS) + PerfCounters::get(PerfCounter::UPLINK_QUEUE_DROPS) +
+           PerfCounters::get(PerfCounter::UPLINK_BACKLOG_DROPS);
+}
+
+SoakTest::SoakTest()
+    : started_(false)
+    , accepted_(false)
+    , in_session_(true)         // 第一次回到空闲时排定第一次唤醒
+    , speech_end_sent_(false)
+    , start_us_(0)
+    , next_wake_us_(0)
+    , session_start_us_(0)
+    , disconnect_at_us_(0)
+    , next_heap_us_(0)
+    , next_report_us_(0)
+    , sessions_(0)
+    , disconnects_(0)
+    , turns_(0)
+    , silent_turns_(0)
+    , base_underruns_(0)
+    , base_dropped_(0)
+    , base_ws_drops_(0)
+    , base_uplink_drops_(0)
+    , heap_start_(0)
+    , heap_min_(UINT32_MAX)
+    , largest_min_(UINT32_MAX)
+    , frag_max_pct_(0)
+    , latency_lock_(portMUX_INITIALIZER_UNLOCKED)
+    , latency_ms_{}
+    , latency_count_(0)
+    , load_task_(nullptr)
+    , load_bytes_(0)
+{
+}
+
+esp_err_t SoakTest::start() {
+    if (started_) {
+        return ESP_OK;
+    }
+    started_ = true;
+    start_us_ = esp_timer_get_time();
+    next_report_us_ = start_us_ + (int64_t)SOAK_REPORT_MS * 1000;
+    base_underruns_ = PerfCounters::get(PerfCounter::JITTER_UNDERRUNS);
+    base_dropped_ = PerfCounters::get(PerfCounter::JITTER_DROPPED_SAMPLES);
+    base_ws_drops_ = ws_drop_count();
+    base_uplink_drops_ = uplink_drop_count();
+    heap_start_ = heap_caps_get_free_size(kInternalCaps);
+    sampleHeap();
+    ESP_LOGW(TAG, "🔥 浸泡测试已启动: 每%lu~%lu秒唤醒一次，断线%lu‰，后台负载%lukbps，内部RAM空闲%lu字节",
+             (unsigned long)(SOAK_WAKE_INTERVAL_MS / 1000),
+             (unsigned long)((SOAK_WAKE_INTERVAL_MS + SOAK_WAKE_JITTER_MS) / 1000),
+             (unsigned long)SOAK_DISCONNECT_PERMILLE, (unsigned long)SOAK_LOAD_KBPS, (unsigned long)heap_start_);
+    if (SOAK_LOAD_KBPS > 0 &&
+        TaskFactory::create(load_task, "soak_load", SOAK_LOAD_TASK_STACK, this, SOAK_LOAD_TASK_PRIORITY, &load_task_,
+                            SOAK_LOAD_TASK_CORE, TaskStack::INTERNAL) != pdPASS) {
+        ESP_LOGE(TAG, "❌ 后台负载任务创建失败");
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+void SoakTest::setAccepted(bool accepted) {
+    if (accepted_.exchange(accepted) != accepted) {
+        if (accepted) {
+            ESP_LOGI(TAG, "🔥 中继已切到浸泡配置，开始自动唤醒");
+        } else {
+            ESP_LOGW(TAG, "⚠️ 中继没有打开RELAY_SOAK_PROFILE，暂停自动唤醒（不对着真实的豆包跑）");
+        }
+    }
+}
+
+int64_t SoakTest::randomMs(uint32_t max_ms) const {
+    return max_ms > 0 ? (int64_t)(esp_random() % (max_ms + 1)) * 1000 : 0;
+}
+
+SoakTest::Action SoakTest::poll(int64_t now_us, bool idle, bool session_active) {
+    if (!started_) {
+        return Action::NONE;
+    }
+    if (now_us >= next_heap_us_) {
+        next_heap_us_ = now_us + (int64_t)kHeapSampleMs * 1000;
+        sampleHeap();
+    }
+    if (idle) {
+        if (in_session_) {
+            in_session_ = false;
+            next_wake_us_ = now_us + (int64_t)SOAK_WAKE_INTERVAL_MS * 1000 + randomMs(SOAK_WAKE_JITTER_MS);
+        }
+        if (!accepted_ || now_us < next_wake_us_) {
+            return Action::NONE;
+        }
+        in_session_ = true;
+        speech_end_sent_ = false;
+        session_start_us_ = now_us;
+        disconnect_at_us_ = esp_random() % 1000 < SOAK_DISCONNECT_PERMILLE
+                                ? now_us + 1000 + randomMs(SOAK_DISCONNECT_WINDOW_MS)
+                                : 0;
+        sessions_++;
+        return Action::WAKE;
+    }
+    if (!session_active) {
+        return Action::NONE;
+    }
+    if (disconnect_at_us_ != 0 && now_us >= disconnect_at_us_) {
+        disconnect_at_us_ = 0;
+        disconnects_++;
+        return Action::DISCONNECT;
+    }
+    if (!speech_end_sent_ && now_us - session_start_us_ >= (int64_t)SOAK_SPEAK_MS * 1000) {
+        speech_end_sent_ = true;
+        return Action::SPEECH_END;
+    }
+    return Action::NONE;
+}
+
+void SoakTest::noteTurn(int32_t eos_to_playback_ms) {
+    if (!started_) {
+        return;
+    }
+    turns_.fetch_add(1, std::memory_order_relaxed);
+    if (eos_to_playback_ms < 0) {
+        silent_turns_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    portENTER_CRITICAL(&latency_lock_);
+    latency_ms_[latency_count_ % SOAK_LATENCY_SAMPLES] = (uint16_t)std::min<int32_t>(eos_to_playback_ms, UINT16_MAX);
+    latency_count_++;
+    portEXIT_CRITICAL(&latency_lock_);
+}
+
+void SoakTest::sampleHeap() {
+    uint32_t free_bytes = heap_caps_get_free_size(kInternalCaps);
+    uint32_t largest = heap_caps_get_largest_free_block(kInternalCaps);
+    heap_min_ = std::min(heap_min_, free_bytes);
+    largest_min_ = std::min(largest_min_, largest);
+    if (free_bytes > 0) {
+        frag_max_pct_ = std::max(frag_max_pct_, 100 - (uint32_t)((uint64_t)largest * 100 / free_bytes));
+    }
+}
+
+void SoakTest::percentiles(uint32_t* p50, uint32_t* p95, uint32_t* p99) {
+    uint16_t sorted[SOAK_LATENCY_SAMPLES];
+    portENTER_CRITICAL(&latency_lock_);
+    size_t n = std::min<uint32_t>(latency_count_, SOAK_LATENCY_SAMPLES);
+    memcpy(sorted, latency_ms_, n * sizeof(uint16_t));
+    portEXIT_CRITICAL(&latency_lock_);
+    if (n == 0) {
+        *p50 = *p95 = *p99 = 0;
+        return;
+    }
+    std::sort(sorted, sorted + n);
+    // 最近秩：第ceil(p×n)个
+    auto rank = [&](uint32_t pct) { return (uint32_t)sorted[(n * pct + 99) / 100 - 1]; };
+    *p50 = rank(50);
+    *p95 = rank(95);
+    *p99 = rank(99);
+}
+
+size_t SoakTest::takeReport(char* buf, size_t size, int64_t now_us) {
+    if (!started_ || now_us < next_report_us_) {
+        return 0;
+    }
+    next_report_us_ = now_us + (int64_t)SOAK_REPORT_MS * 1000;
+    uint32_t p50, p95, p99;
+    percentiles(&p50, &p95, &p99);
+    uint32_t free_bytes = heap_caps_get_free_size(kInternalCaps);
+    uint32_t largest = heap_caps_get_largest_free_block(kInternalCaps);
+    uint32_t frag_pct = free_bytes > 0 ? 100 - (uint32_t)((uint64_t)largest * 100 / free_bytes) : 100;
+    int n = snprintf(buf, size,
+                     "{\"type\":\"soak\",\"uptime_s\":%lu,\"sessions\":%lu,\"turns\":%lu,\"silent_turns\":%lu,"
+                     "\"disconnects\":%lu,\"p50_ms\":%lu,\"p95_ms\":%lu,\"p99_ms\":%lu,\"samples\":%lu,"
+                     "\"underruns\":%lu,\"jb_dropped\":%lu,\"ws_drops\":%lu,\"uplink_drops\":%lu,"
+                     "\"heap_free\":%lu,\"heap_start\":%lu,\"heap_min\":%lu,\"largest\":%lu,\"largest_min\":%lu,"
+                     "\"frag_pct\":%lu,\"frag_max_pct\":%lu,\"load_kb\":%lu}",
+                     (unsigned long)((now_us - start_us_) / 1000000), (unsigned long)sessions_,
+                     (unsigned long)turns_.load(), (unsigned long)silent_turns_.load(), (unsigned long)disconnects_,
+                     (unsigned long)p50, (unsigned long)p95, (unsigned long)p99,
+                     (unsigned long)std::min<uint32_t>(latency_count_, SOAK_LATENCY_SAMPLES),
+                     (unsigned long)(PerfCounters::get(PerfCounter::JITTER_UNDERRUNS) - base_underruns_),
+                     (unsigned long)(PerfCounters::get(PerfCounter::JITTER_DROPPED_SAMPLES) - base_dropped_),
+                     (unsigned long)(ws_drop_count() - base_ws_drops_),
+                     (unsigned long)(uplink_drop_count() - base_uplink_drops_), (unsigned long)free_bytes,
+                     (unsigned long)heap_start_, (unsigned long)heap_min_, (unsigned long)largest,
+                     (unsigned long)largest_min_, (unsigned long)frag_pct, (unsigned long)frag_max_pct_,
+                     (unsigned long)(load_bytes_.load() / 1024));
+    if (n <= 0 || (size_t)n >= size) {
+        return 0;
+    }
+    ESP_LOGI(TAG, "🔥 浸泡%lu分钟: %lu次会话 %lu轮，断线%lu次，延迟p50/p95/p99 %lu/%lu/%lu ms，欠载%lu，"
+             "内部RAM %lu字节（最低%lu，最大块%lu，碎片%lu%%）",
+             (unsigned long)((now_us - start_us_) / 60000000), (unsigned long)sessions_, (unsigned long)turns_.load(),
+             (unsigned long)disconnects_, (unsigned long)p50, (unsigned long)p95, (unsigned long)p99,
+             (unsigned long)(PerfCounters::get(PerfCounter::JITTER_UNDERRUNS) - base_underruns_),
+             (unsigned long)free_bytes, (unsigned long)heap_min_, (unsigned long)largest, (unsigned long)frag_pct);
+    return (size_t)n;
+}
+
+void SoakTest::load_task(void* arg) {
+    SoakTest* self = (SoakTest*)arg;
+    static uint8_t payload[SOAK_LOAD_PACKET_BYTES];
+    memset(payload, 0x5a, sizeof(payload));
+    // 每个数据报的间隔按码率算，至少1个tick
+    const TickType_t period = std::max<TickType_t>(
+        1, pdMS_TO_TICKS((uint32_t)SOAK_LOAD_PACKET_BYTES * 8 / SOAK_LOAD_KBPS));
+    int sock = -1;
+    struct sockaddr_in dest = {};
+    while (true) {
+        if (sock < 0) {
+            // 网关地址在连上WiFi、拿到IP之后才有；漫游后换了网关时下次出错重新取
+            esp_netif_ip_info_t ip_info = {};
+            esp_netif_t* netif = esp_netif_get_handle_from_ifkey("WIFI_STA_DEF");
+            if (!netif || esp_netif_get_ip_info(netif, &ip_info) != ESP_OK || ip_info.gw.addr == 0) {
+                vTaskDelay(pdMS_TO_TICKS(1000));
+                continue;
+            }
+            sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_IP);
+            if (sock < 0) {
+                vTaskDelay(pdMS_TO_TICKS(1000));
+                continue;
+            }
+            dest.sin_family = AF_INET;
+            dest.sin_port = htons(kDiscardPort);
+            dest.sin_addr.s_addr = ip_info.gw.addr;
+        }
+        int sent = sendto(sock, payload, sizeof(payload), 0, (struct sockaddr*)&dest, sizeof(dest));
+        if (sent > 0) {
+            self->load_bytes_.fetch_add((uint32_t)sent, std::memory_order_relaxed);
+        } else {
+            // 断网或发送缓冲区满：关掉重来，别在这里空转
+            close(sock);
+            sock = -1;
+            vTaskDelay(pdMS_TO_TICKS(1000));
+            continue;
+        }
+        vTaskDelay(period);
+    }
+}
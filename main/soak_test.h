@@ -0,0 +1,120 @@
+/**
+ * @file soak_test.h
+ * @brief 🔥 浸泡测试 - 连续几小时自动唤醒、随机断线、加后台WiFi负载，定时上报堆碎片、欠载、丢弃和延迟分位数
+ *
+ * 原来没有唤醒词模型时主循环每30秒"测试模式"自动唤醒一次，只能看出能不能连上，
+ * 几小时后才出现的堆碎片、欠载和丢包暴露不出来。构建时打开SOAK_TEST（idf.py -DSOAK_TEST=1 build）
+ * 后由这里驱动整台设备，作为出厂前的老化门槛：
+ *
+ * - 唤醒：回到空闲后隔SOAK_WAKE_INTERVAL_MS + 随机0~SOAK_WAKE_JITTER_MS自动唤醒，
+ *   SOAK_SPEAK_MS后发speech_end；回复播完、追问窗口超时后照常回到空闲
+ * - 断线：每次会话以SOAK_DISCONNECT_PERMILLE‰的概率在唤醒后随机时刻断开WebSocket（快速重连，见WebSocketClient::reconnect()），走会话中重连的路径
+ * - WiFi负载：低优先级任务按SOAK_LOAD_KBPS向网关的UDP discard端口发数据报，和音频抢空口
+ * - 报告：每SOAK_REPORT_MS发一次{"type":"soak",...}，计数都是测试开始以来的增量，
+ *   延迟是最近SOAK_LATENCY_SAMPLES轮"说完到开始播放"的p50/p95/p99，堆是内部RAM的空闲、最低、最大块和碎片率
+ *
+ * 回复由中继的浸泡配置合成（RELAY_SOAK_PROFILE，突发加抖动，不调用豆包）：hello里带"soak"，
+ * 中继同意了（hello回复的features里有"soak"）才开始自动唤醒，免得对着真实的豆包跑几个小时。
+ *
+ * noteTurn()和setAccepted()在WebSocket任务中调用，其余只在主任务中调用。
+ */
+
+#ifndef SOAK_TEST_H
+#define SOAK_TEST_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_err.h"
+#include "project_config.h"
+
+class SoakTest {
+public:
+    /**
+     * @brief 主循环这一轮要做的事
+     */
+    enum class Action : uint8_t {
+        NONE,
+        WAKE,           // 自动唤醒，进入云端会话
+        SPEECH_END,     // 假装说完了
+        DISCONNECT,     // 断开WebSocket（快速重连）
+    };
+
+    SoakTest();
+
+    /**
+     * @brief 记下计数和堆的起点，启动后台WiFi负载任务
+     */
+    esp_err_t start();
+
+    /**
+     * @brief 中继是否同意了浸泡配置（每次hello回复后设置，WebSocket任务）
+     */
+    void setAccepted(bool accepted);
+
+    /**
+     * @brief 主循环每轮调用
+     *
+     * @param idle 当前处于空闲状态
+     * @param session_active 当前处于云端会话中
+     */
+    Action poll(int64_t now_us, bool idle, bool session_active);
+
+    /**
+     * @brief 一轮回复结束（tts_end），记下"说完到开始播放"的延迟（-1=这一轮没有播放）
+     */
+    void noteTurn(int32_t eos_to_playback_ms);
+
+    /**
+     * @brief 到了上报时间时格式化报告
+     *
+     * @return 写入的字符数（不含结尾'\0'），没到时间或缓冲区不够时返回0
+     */
+    size_t takeReport(char* buf, size_t size, int64_t now_us);
+
+private:
+    static const char* TAG;
+
+    static void load_task(void* arg);
+    void sampleHeap();
+    void percentiles(uint32_t* p50, uint32_t* p95, uint32_t* p99);
+    int64_t randomMs(uint32_t max_ms) const;
+
+    bool started_;
+    std::atomic<bool> accepted_;    // WebSocket任务写
+    bool in_session_;           // 上一轮不是空闲（回到空闲时排下一次唤醒）
+    bool speech_end_sent_;
+    int64_t start_us_;
+    int64_t next_wake_us_;
+    int64_t session_start_us_;
+    int64_t disconnect_at_us_;  // 0=这次会话不断线
+    int64_t next_heap_us_;
+    int64_t next_report_us_;
+
+    uint32_t sessions_;
+    uint32_t disconnects_;
+    std::atomic<uint32_t> turns_;           // WebSocket任务写
+    std::atomic<uint32_t> silent_turns_;    // 结束时还没有开始播放的轮次
+
+    // 测试开始时的计数（报告里给增量）
+    uint32_t base_underruns_;
+    uint32_t base_dropped_;
+    uint32_t base_ws_drops_;
+    uint32_t base_uplink_drops_;
+
+    uint32_t heap_start_;
+    uint32_t heap_min_;
+    uint32_t largest_min_;
+    uint32_t frag_max_pct_;
+
+    portMUX_TYPE latency_lock_;
+    uint16_t latency_ms_[SOAK_LATENCY_SAMPLES];
+    uint32_t latency_count_;    // 累计写入的样本数，环形覆盖
+
+    TaskHandle_t load_task_;
+    std::atomic<uint32_t> load_bytes_;
+};
+
+#endif // SOAK_TEST_H
@@ -0,0 +1,199 @@
+/**
+ * @file spectral_ns.cc
+ * @brief 🔉 轻量谱减降噪实现
+ */
+
+#include "spectral_ns.h"
+#include <math.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "buffer_placement.h"
+#include "dl_rfft.h"
+
+const char* SpectralNoiseSuppressor::TAG = "SpectralNs";
+
+static_assert((SPECTRAL_NS_FFT & (SPECTRAL_NS_FFT - 1)) == 0 && SPECTRAL_NS_FFT >= 128 && SPECTRAL_NS_FFT <= 512,
+              "SPECTRAL_NS_FFT必须是128~512的2的幂");
+
+// 频点功率的平滑：每跳向新值靠近一半，压低逐跳的起伏（"音乐噪声"）
+static const float kPowerSmooth = 0.5f;
+// 功率不到噪声估计的这么多倍时当作噪声，按kNoiseTrack跟踪平均值；更高的当作语音，噪声估计只按上涨速度慢慢抬
+static const float kNoiseRatio = 4.0f;
+static const float kNoiseTrack = 0.1f;
+// 避免除零（单位是16位样本的FFT幅度平方，1只相当于远低于量化噪声的能量）
+static const float kPowerEpsilon = 1.0f;
+
+static inline int32_t synth_scale(int32_t v, int shift) {
+    if (shift > 0) {
+        return (v + (1 << (shift - 1))) >> shift;
+    }
+    int64_t wide = (int64_t)v << -shift;
+    return wide > INT32_MAX ? INT32_MAX : (wide < INT32_MIN ? INT32_MIN : (int32_t)wide);
+}
+
+static inline int16_t saturate16(int64_t v) {
+    return v > INT16_MAX ? INT16_MAX : (v < INT16_MIN ? INT16_MIN : (int16_t)v);
+}
+
+SpectralNoiseSuppressor::SpectralNoiseSuppressor()
+    : fft_(nullptr)
+    , buf_(nullptr)
+    , window_(nullptr)
+    , in_(nullptr)
+    , prev_in_(nullptr)
+    , tail_(nullptr)
+    , out_(nullptr)
+    , power_(nullptr)
+    , noise_(nullptr)
+    , in_fill_(0)
+    , noise_init_(false)
+    , noise_rise_(1.0f)
+{
+}
+
+SpectralNoiseSuppressor::~SpectralNoiseSuppressor() {
+    if (fft_) {
+        dl_rfft_s16_deinit((dl_fft_s16_t*)fft_);
+    }
+    BufferPlacement::free(buf_);
+}
+
+esp_err_t SpectralNoiseSuppressor::init(uint32_t sample_rate) {
+    if (fft_) {
+        return ESP_OK;
+    }
+    // 一次分配，按顺序切开：FFT工作区在最前面，保持16字节对齐
+    const size_t bytes = FFT * sizeof(int16_t) * 2 + HOP * sizeof(int16_t) * 3 + HOP * sizeof(int32_t)
+                       + BINS * sizeof(float) * 2;
+    uint8_t* block = (uint8_t*)BufferPlacement::alloc("spectral_ns", bytes, Placement::INTERNAL);
+    dl_fft_s16_t* fft = dl_rfft_s16_init(FFT, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!block || !fft) {
+        ESP_LOGE(TAG, "❌ 谱减降噪初始化失败（%u字节）", (unsigned)bytes);
+        BufferPlacement::free(block);
+        if (fft) {
+            dl_rfft_s16_deinit(fft);
+        }
+        return ESP_ERR_NO_MEM;
+    }
+    memset(block, 0, bytes);
+    buf_ = (int16_t*)block;
+    window_ = buf_ + FFT;
+    in_ = window_ + FFT;
+    prev_in_ = in_ + HOP;
+    out_ = prev_in_ + HOP;
+    tail_ = (int32_t*)(out_ + HOP);
+    power_ = (float*)(tail_ + HOP);
+    noise_ = power_ + BINS;
+
+    // 正弦窗：分析和合成各乘一次，相邻两跳的sin²+cos²=1
+    for (size_t n = 0; n < FFT; n++) {
+        window_[n] = (int16_t)lrintf(32767.0f * sinf((float)M_PI * (n + 0.5f) / FFT));
+    }
+    noise_rise_ = powf(10.0f, SPECTRAL_NS_NOISE_RISE_DB * HOP / sample_rate / 10.0f);
+    in_fill_ = 0;
+    noise_init_ = false;
+    fft_ = fft;
+    ESP_LOGI(TAG, "✓ 谱减降噪已就绪: FFT %u点，跳步%u样本，延迟%lums，%u字节",
+             (unsigned)FFT, (unsigned)HOP, (unsigned long)(DELAY * 1000 / sample_rate), (unsigned)bytes);
+    return ESP_OK;
+}
+
+void SpectralNoiseSuppressor::resetStream() {
+    if (!fft_) {
+        return;
+    }
+    memset(prev_in_, 0, HOP * sizeof(int16_t));
+    memset(out_, 0, HOP * sizeof(int16_t));
+    memset(tail_, 0, HOP * sizeof(int32_t));
+    in_fill_ = 0;
+}
+
+void SpectralNoiseSuppressor::process(int16_t* samples, size_t count) {
+    if (!fft_) {
+        return;
+    }
+    size_t pos = 0;
+    while (pos < count) {
+        size_t n = HOP - in_fill_;
+        if (n > count - pos) {
+            n = count - pos;
+        }
+        // 先收下输入再写出上一跳同位置的输出，原地处理也不会覆盖还没读的样本
+        memcpy(in_ + in_fill_, samples + pos, n * sizeof(int16_t));
+        memcpy(samples + pos, out_ + in_fill_, n * sizeof(int16_t));
+        in_fill_ += n;
+        pos += n;
+        if (in_fill_ == HOP) {
+            runHop();
+            in_fill_ = 0;
+        }
+    }
+}
+
+void SpectralNoiseSuppressor::runHop() {
+    // 📐 加窗：前半是上一跳的输入，后半是这一跳的
+    for (size_t n = 0; n < HOP; n++) {
+        buf_[n] = (int16_t)(((int32_t)prev_in_[n] * window_[n] + 16384) >> 15);
+        buf_[HOP + n] = (int16_t)(((int32_t)in_[n] * window_[HOP + n] + 16384) >> 15);
+    }
+    memcpy(prev_in_, in_, HOP * sizeof(int16_t));
+
+    int fft_exp = 0;
+    dl_rfft_s16_hp_run((dl_fft_s16_t*)fft_, buf_, 0, &fft_exp);
+
+    // 🔇 逐频点算增益：buf_[0]是直流，buf_[1]是FFT/2处的实部，其余每两个是一个复数频点
+    const float scale = ldexpf(1.0f, 2 * fft_exp);
+    for (size_t k = 0; k < BINS; k++) {
+        int16_t* re;
+        int16_t* im;
+        if (k == 0) {
+            re = &buf_[0];
+            im = nullptr;
+        } else if (k == BINS - 1) {
+            re = &buf_[1];
+            im = nullptr;
+        } else {
+            re = &buf_[2 * k];
+            im = &buf_[2 * k + 1];
+        }
+        uint32_t mag2 = (uint32_t)((int32_t)*re * *re) + (im ? (uint32_t)((int32_t)*im * *im) : 0);
+        float p = (float)mag2 * scale;
+        float power;
+        float noise;
+        if (!noise_init_) {
+            power = p;
+            noise = p;
+        } else {
+            power = power_[k] + (p - power_[k]) * kPowerSmooth;
+            noise = noise_[k];
+            if (power < noise * kNoiseRatio) {
+                noise += (power - noise) * kNoiseTrack;
+            } else {
+                noise *= noise_rise_;
+            }
+        }
+        power_[k] = power;
+        noise_[k] = noise;
+
+        float gain = 1.0f - SPECTRAL_NS_OVERSUB * noise / (power + kPowerEpsilon);
+        gain = gain < SPECTRAL_NS_FLOOR ? SPECTRAL_NS_FLOOR : gain;
+        int32_t q15 = (int32_t)(gain * 32767.0f + 0.5f);
+        *re = (int16_t)(((int32_t)*re * q15 + 16384) >> 15);
+        if (im) {
+            *im = (int16_t)(((int32_t)*im * q15 + 16384) >> 15);
+        }
+    }
+    noise_init_ = true;
+
+    int ifft_exp = 0;
+    dl_irfft_s16_hp_run((dl_fft_s16_t*)fft_, buf_, fft_exp, &ifft_exp);
+
+    // 🔁 合成窗 + 重叠相加：前半和上一跳留下的后半相加就是最终输出，后半留给下一跳
+    const int shift = 15 - ifft_exp;
+    for (size_t n = 0; n < HOP; n++) {
+        int32_t head = synth_scale((int32_t)buf_[n] * window_[n], shift);
+        out_[n] = saturate16((int64_t)head + tail_[n]);
+        tail_[n] = synth_scale((int32_t)buf_[HOP + n] * window_[HOP + n], shift);
+    }
+}
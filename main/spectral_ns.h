@@ -0,0 +1,78 @@
+/**
+ * @file spectral_ns.h
+ * @brief 🔉 轻量谱减降噪 - dl_fft的16位定点RFFT + 重叠相加，给AFE降噪没在运行时的上行音频去掉稳态底噪
+ *
+ * AFE的WebRTC NS/NSNet随AFE一起运行：AFE初始化失败退回直通、或者实时系数保护（rtf_guard.h）把降噪关掉之后，
+ * 上行就是原始麦克风信号，风扇、空调这类稳态噪声直接送去识别，也让Opus把码率花在噪声上。
+ * 这里是一个便宜得多的替代，在录音任务的上行流水线里按帧原地处理：
+ *
+ * - 正弦窗（根号Hann）分帧，窗长SPECTRAL_NS_FFT，跳步一半，分析和合成用同一个窗，重叠相加后完全重建
+ * - dl_rfft_s16_hp_run/dl_irfft_s16_hp_run（块浮点的16位定点FFT），增益用Q15乘回频谱
+ * - 每个频点的噪声功率按平滑后的功率跟踪：不到估计值4倍的当作噪声，跟踪它的平均值；更高的当作语音，
+ *   噪声估计每秒最多涨SPECTRAL_NS_NOISE_RISE_DB（说话持续几秒也不会把语音当成噪声，底噪变大时慢慢跟上）
+ * - 增益 = max(1 - SPECTRAL_NS_OVERSUB × 噪声/功率, SPECTRAL_NS_FLOOR)（功率谱减），频点统计用单精度浮点（S3有FPU）
+ *
+ * 跳步和帧长（AUDIO_FRAME_MS）不必对齐：内部攒够一跳处理一跳，输出固定延迟两跳（FFT为256时16ms）。
+ * 只在一个任务中使用，内部不加锁。
+ */
+
+#ifndef SPECTRAL_NS_H
+#define SPECTRAL_NS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "project_config.h"
+
+class SpectralNoiseSuppressor {
+public:
+    static constexpr size_t FFT = SPECTRAL_NS_FFT;
+    static constexpr size_t HOP = FFT / 2;
+    static constexpr size_t BINS = FFT / 2 + 1;
+    static constexpr size_t DELAY = 2 * HOP;        // 输出相对输入的固定延迟（样本）
+
+    SpectralNoiseSuppressor();
+    ~SpectralNoiseSuppressor();
+
+    SpectralNoiseSuppressor(const SpectralNoiseSuppressor&) = delete;
+    SpectralNoiseSuppressor& operator=(const SpectralNoiseSuppressor&) = delete;
+
+    /**
+     * @brief 分配FFT表和缓冲区（内部RAM，约4KB）
+     *
+     * @param sample_rate 采样率（Hz），决定噪声跟踪的时间常数
+     */
+    esp_err_t init(uint32_t sample_rate);
+
+    bool isReady() const { return fft_ != nullptr; }
+
+    /**
+     * @brief 原地处理一段样本，输出比输入晚DELAY个样本
+     */
+    void process(int16_t* samples, size_t count);
+
+    /**
+     * @brief 清掉重叠和延迟线里的音频（新一次录音开始时调用），噪声估计保留
+     */
+    void resetStream();
+
+private:
+    static const char* TAG;
+
+    void runHop();
+
+    void* fft_;             // dl_fft_s16_t*
+    int16_t* buf_;          // FFT工作区（FFT个样本，16字节对齐）
+    int16_t* window_;       // 正弦窗（Q15，FFT个点）
+    int16_t* in_;           // 正在攒的这一跳输入
+    int16_t* prev_in_;      // 上一跳输入（窗的前半）
+    int32_t* tail_;         // 上一跳合成结果的后半，等着和这一跳相加
+    int16_t* out_;          // 上一跳算完的输出，这一跳攒输入时按同样的位置取出
+    float* power_;          // 每个频点平滑后的功率
+    float* noise_;          // 每个频点的噪声功率估计
+    size_t in_fill_;
+    bool noise_init_;
+    float noise_rise_;      // 每跳噪声估计最多乘上的系数
+};
+
+#endif // SPECTRAL_NS_H
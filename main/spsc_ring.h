@@ -0,0 +1,178 @@
+/**
+ * @file spsc_ring.h
+ * @brief 🔁 单生产者/单消费者无锁环形缓冲区模板
+ *
+ * 生产者和消费者可以运行在不同核心上的两个任务中：
+ * - 写位置只由生产者修改，读位置只由消费者修改
+ * - 通过std::atomic的acquire/release保证数据先于位置可见
+ * - 容量N必须是2的幂，用位掩码代替取模，位置计数溢出回绕后下标仍然连续
+ *
+ * 除了拷贝式的write()/read()，还提供连续区间（span）接口：
+ * 消费者可以直接把readSpan()交给i2s_channel_write，省掉一次memcpy。
+ * 实时音频配置下读写接口强制内联进调用方（见realtime_audio.h）。
+ */
+
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include "buffer_placement.h"
+#include "realtime_audio.h"
+
+template <typename T, size_t N>
+class SpscRing {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "SpscRing容量必须是2的幂");
+
+public:
+    /**
+     * @brief 一段连续的存储区间
+     */
+    template <typename U>
+    struct Span {
+        U* data;
+        size_t count;
+    };
+
+    /**
+     * @brief 创建环形缓冲区
+     *
+     * @param name 缓冲区名字（见BufferPlacement::logReport()）
+     * @param placement 存储区放在哪里，首选区域不够时由BufferPlacement退回下一档
+     */
+    SpscRing(const char* name, Placement placement)
+        : buffer_((T*)BufferPlacement::alloc(name, N * sizeof(T), placement))
+        , head_(0)
+        , tail_(0)
+    {
+    }
+
+    ~SpscRing() { BufferPlacement::free(buffer_); }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    bool isValid() const { return buffer_ != nullptr; }
+    static constexpr size_t capacity() { return N; }
+    // p是否指向环形缓冲区的存储（判断一段数据是不是原地读出来的）
+    bool contains(const T* p) const { return p >= buffer_ && p < buffer_ + N; }
+
+    // ===== 生产者接口 =====
+
+    /**
+     * @brief 可写的连续区间（到缓冲区末尾或空闲空间用完为止）
+     */
+    AUDIO_HOT_INLINE Span<T> writeSpan() {
+        size_t head = head_.load(std::memory_order_relaxed);
+        size_t tail = tail_.load(std::memory_order_acquire);
+        size_t free_count = N - (head - tail);
+        size_t to_end = N - (head & MASK);
+        return { buffer_ + (head & MASK), free_count < to_end ? free_count : to_end };
+    }
+
+    /**
+     * @brief 提交通过writeSpan()写入的元素
+     */
+    AUDIO_HOT_INLINE void commitWrite(size_t count) {
+        head_.store(head_.load(std::memory_order_relaxed) + count, std::memory_order_release);
+    }
+
+    /**
+     * @brief 拷贝写入
+     * @return 实际写入的元素数，空间不足时只写入能放下的部分
+     */
+    AUDIO_HOT_INLINE size_t write(const T* src, size_t count) {
+        size_t written = 0;
+        while (written < count) {
+            Span<T> span = writeSpan();
+            if (span.count == 0) {
+                break;
+            }
+            size_t n = count - written < span.count ? count - written : span.count;
+            memcpy(span.data, src + written, n * sizeof(T));
+            commitWrite(n);
+            written += n;
+        }
+        return written;
+    }
+
+    AUDIO_HOT_INLINE size_t freeSpace() const {
+        return N - (head_.load(std::memory_order_relaxed) - tail_.load(std::memory_order_acquire));
+    }
+
+    /**
+     * @brief 写位置（已写入元素的累计个数），配合at()读回自己写过的数据
+     */
+    size_t writePosition() const { return head_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 生产者读回写位置之前的元素
+     *
+     * 生产者从来不写写位置之前的槽位，所以最近写入的N个元素即使已经被消费者读走，内容也还在。
+     */
+    const T& at(size_t position) const { return buffer_[position & MASK]; }
+
+    // ===== 消费者接口 =====
+
+    /**
+     * @brief 可读的连续区间（到缓冲区末尾或数据用完为止）
+     */
+    AUDIO_HOT_INLINE Span<const T> readSpan() const {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        size_t head = head_.load(std::memory_order_acquire);
+        size_t used = head - tail;
+        size_t to_end = N - (tail & MASK);
+        return { buffer_ + (tail & MASK), used < to_end ? used : to_end };
+    }
+
+    /**
+     * @brief 释放通过readSpan()消费掉的元素
+     */
+    AUDIO_HOT_INLINE void commitRead(size_t count) {
+        tail_.store(tail_.load(std::memory_order_relaxed) + count, std::memory_order_release);
+    }
+
+    /**
+     * @brief 拷贝读取
+     * @return 实际读取的元素数
+     */
+    AUDIO_HOT_INLINE size_t read(T* dst, size_t count) {
+        size_t got = 0;
+        while (got < count) {
+            Span<const T> span = readSpan();
+            if (span.count == 0) {
+                break;
+            }
+            size_t n = count - got < span.count ? count - got : span.count;
+            memcpy(dst + got, span.data, n * sizeof(T));
+            commitRead(n);
+            got += n;
+        }
+        return got;
+    }
+
+    /**
+     * @brief 当前可读元素数（两端都可以调用）
+     */
+    AUDIO_HOT_INLINE size_t size() const {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief 丢弃所有未读数据（仅消费者调用）
+     */
+    void clear() {
+        tail_.store(head_.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+private:
+    static constexpr size_t MASK = N - 1;
+
+    T* buffer_;
+    std::atomic<size_t> head_;  // 写位置（生产者）
+    std::atomic<size_t> tail_;  // 读位置（消费者）
+};
+
+#endif // SPSC_RING_H
@@ -0,0 +1,94 @@
+/**
+ * @file supervisor.cc
+ * @brief 🩺 子系统看门狗
+ */
+
+#include "supervisor.h"
+#include "esp_log.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "flight_recorder.h"
+#include "perf_counters.h"
+#include "project_config.h"
+#include "sdkconfig.h"
+#include "task_factory.h"
+#if CONFIG_ESP_TASK_WDT_EN
+#include "esp_task_wdt.h"
+#endif
+
+const char* Supervisor::TAG = "Supervisor";
+
+void Supervisor::watch(Watch watch, const char* name, uint32_t timeout_ms, RecoverFn recover, void* ctx) {
+    Slot& slot = slots_[(size_t)watch];
+    slot.name = name;
+    slot.timeout_ms = timeout_ms;
+    slot.recover = recover;
+    slot.ctx = ctx;
+}
+
+esp_err_t Supervisor::start() {
+#if SUPERVISOR_ENABLE
+    static TaskHandle_t handle = nullptr;
+    if (handle != nullptr) {
+        return ESP_OK;
+    }
+    if (TaskFactory::create(task, "supervisor", 3 * 1024, nullptr, SUPERVISOR_TASK_PRIORITY, &handle,
+                            SUPERVISOR_TASK_CORE, TaskStack::INTERNAL) != pdPASS) {
+        ESP_LOGE(TAG, "❌ 创建监控任务失败");
+        return ESP_ERR_NO_MEM;
+    }
+#endif
+    return ESP_OK;
+}
+
+void Supervisor::task(void* arg) {
+#if CONFIG_ESP_TASK_WDT_EN
+    esp_task_wdt_add(NULL);
+#endif
+    ESP_LOGI(TAG, "🩺 子系统看门狗已启动，每 %d ms 检查一次", SUPERVISOR_CHECK_MS);
+    while (true) {
+        vTaskDelay(pdMS_TO_TICKS(SUPERVISOR_CHECK_MS));
+#if CONFIG_ESP_TASK_WDT_EN
+        esp_task_wdt_reset();
+#endif
+        TickType_t now = xTaskGetTickCount();
+        for (Slot& slot : slots_) {
+            check(slot, now);
+        }
+    }
+}
+
+void Supervisor::check(Slot& slot, TickType_t now) {
+    if (slot.recover == nullptr || !slot.busy.load(std::memory_order_acquire)) {
+        return;
+    }
+    uint32_t stuck_ms = (uint32_t)(now - slot.last_tick.load(std::memory_order_relaxed)) * portTICK_PERIOD_MS;
+    if (stuck_ms < slot.timeout_ms) {
+        return;
+    }
+
+    FLIGHT_RECORD(WATCHDOG, stuck_ms, (uint8_t)(&slot - slots_));
+    if (slot.window_count == 0 || now - slot.window_start >= pdMS_TO_TICKS(SUPERVISOR_RECOVERY_WINDOW_MS)) {
+        slot.window_start = now;
+        slot.window_count = 0;
+    }
+    if (++slot.window_count > SUPERVISOR_MAX_RECOVERIES) {
+        ESP_LOGE(TAG, "💥 %s %d秒内卡住了%lu次，整机重启", slot.name, SUPERVISOR_RECOVERY_WINDOW_MS / 1000,
+                 (unsigned long)slot.window_count);
+        esp_restart();
+    }
+
+    ESP_LOGW(TAG, "🩺 %s %lu ms没有进展，热重启", slot.name, (unsigned long)stuck_ms);
+    int64_t start_us = esp_timer_get_time();
+    esp_err_t ret = slot.recover(slot.ctx);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "💥 %s热重启失败（%s），整机重启", slot.name, esp_err_to_name(ret));
+        esp_restart();
+    }
+    // 恢复期间段可能已经正常结束；还在段里时从现在重新计时
+    slot.last_tick.store(xTaskGetTickCount(), std::memory_order_relaxed);
+    slot.recoveries++;
+    PerfCounters::add(PerfCounter::WARM_RESTARTS);
+    ESP_LOGI(TAG, "✅ %s已热重启，用时 %lld ms（第%lu次）", slot.name, (esp_timer_get_time() - start_us) / 1000,
+             (unsigned long)slot.recoveries);
+}
@@ -0,0 +1,96 @@
+/**
+ * @file supervisor.h
+ * @brief 🩺 子系统看门狗 - I2S通道或WebSocket卡住时只重建那一部分，不整机重启
+ *
+ * 整机重启要重新走一遍启动：加载模型、扫描WiFi、DHCP、WebSocket握手，几秒钟听不见也说不了。
+ * 这里给每个会卡住的子系统一个心跳槽位：
+ * - 热路径只做一两次relaxed原子写（enter/beat/leave），在任意任务中调用，不加锁
+ * - enter()：开始需要有进展的一段（采集启动、开始写I2S、开始写socket），已经在段里时不变
+ * - beat()：有了进展（收到一个DMA块、写进去了数据）
+ * - leave()：这一段正常结束，之后不再检查（播放空闲、socket写完）
+ * 监控任务每SUPERVISOR_CHECK_MS检查一次：在段里、距离上次进展超过timeout的子系统算卡住，
+ * 在监控任务里调用登记的恢复函数，只重建这个子系统（I2S通道、WebSocket客户端），
+ * 模型、WiFi和其他任务都不动，恢复耗时记在日志和PerfCounter::WARM_RESTARTS里。
+ *
+ * 升级到整机重启：恢复函数返回错误（比如卡住的任务还占着锁），或者同一子系统
+ * SUPERVISOR_RECOVERY_WINDOW_MS内热重启超过SUPERVISOR_MAX_RECOVERIES次。
+ * 监控任务自己登记到任务看门狗（CONFIG_ESP_TASK_WDT_EN时），它卡住时由TWDT报出来。
+ */
+
+#ifndef SUPERVISOR_H
+#define SUPERVISOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+enum class Watch : uint8_t {
+    CAPTURE = 0,    // I2S采集：DMA块停了（接收通道卡住）
+    PLAYBACK,       // I2S播放：写入一直没有进展（发送DMA卡住）
+    WS_SEND,        // WebSocket发送任务：一次写socket超过组件自己的网络超时还没返回
+    COUNT
+};
+
+class Supervisor {
+public:
+    /**
+     * @brief 恢复函数（在监控任务中调用）：返回ESP_OK表示已经热重启，其他值升级为整机重启
+     */
+    using RecoverFn = esp_err_t (*)(void* ctx);
+
+    /**
+     * @brief 登记一个子系统（在start()之前调用）
+     */
+    static void watch(Watch watch, const char* name, uint32_t timeout_ms, RecoverFn recover, void* ctx);
+
+    /**
+     * @brief 启动监控任务（SUPERVISOR_ENABLE为0时什么都不做）
+     */
+    static esp_err_t start();
+
+    static void enter(Watch watch) {
+        Slot& slot = slots_[(size_t)watch];
+        if (!slot.busy.load(std::memory_order_relaxed)) {
+            slot.last_tick.store(xTaskGetTickCount(), std::memory_order_relaxed);
+            slot.busy.store(true, std::memory_order_release);
+        }
+    }
+
+    static void beat(Watch watch) {
+        slots_[(size_t)watch].last_tick.store(xTaskGetTickCount(), std::memory_order_relaxed);
+    }
+
+    static void leave(Watch watch) {
+        slots_[(size_t)watch].busy.store(false, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 启动以来这个子系统热重启的次数
+     */
+    static uint32_t recoveries(Watch watch) { return slots_[(size_t)watch].recoveries; }
+
+private:
+    struct Slot {
+        std::atomic<bool> busy;
+        std::atomic<TickType_t> last_tick;
+        // 以下只在登记时和监控任务中访问
+        const char* name;
+        uint32_t timeout_ms;
+        RecoverFn recover;
+        void* ctx;
+        uint32_t recoveries;
+        TickType_t window_start;
+        uint32_t window_count;
+    };
+
+    static void task(void* arg);
+    static void check(Slot& slot, TickType_t now);
+
+    static const char* TAG;
+    static inline Slot slots_[(size_t)Watch::COUNT] = {};
+};
+
+#endif // SUPERVISOR_H
@@ -0,0 +1,169 @@
+/**
+ * @file task_factory.cc
+ * @brief 🧵 任务工厂实现
+ */
+
+#include "task_factory.h"
+#include <string.h>
+#include <stdlib.h>
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+#include "buffer_placement.h"
+#include "project_config.h"
+#include "sdkconfig.h"
+
+const char* TaskFactory::TAG = "TaskFactory";
+
+// PSRAM栈的任务只有几个，登记表满了就退回内部RAM
+static const size_t kMaxStaticTasks = 8;
+
+struct StaticTaskSlot {
+    const char* name;
+    uint32_t stack_bytes;
+    StackType_t* stack;         // PSRAM（BufferPlacement登记）
+    StaticTask_t* tcb;          // 内部RAM：调度器在中断里也要访问TCB
+    TaskHandle_t handle;        // nullptr=空闲，可以给同名任务复用
+};
+
+static StaticTaskSlot s_slots[kMaxStaticTasks];
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/**
+ * @brief 找一个可以复用的同名空闲槽位，没有就占一个新槽位（stack为空），都没有返回nullptr
+ */
+static StaticTaskSlot* claim_slot(const char* name, uint32_t stack_bytes) {
+    StaticTaskSlot* fresh = nullptr;
+    StaticTaskSlot* found = nullptr;
+    portENTER_CRITICAL(&s_lock);
+    for (StaticTaskSlot& slot : s_slots) {
+        if (slot.name == nullptr) {
+            if (fresh == nullptr) {
+                fresh = &slot;
+            }
+        } else if (slot.handle == nullptr && slot.stack_bytes >= stack_bytes && strcmp(slot.name, name) == 0) {
+            found = &slot;
+            break;
+        }
+    }
+    if (found == nullptr && fresh != nullptr) {
+        fresh->name = name;
+        fresh->stack_bytes = stack_bytes;
+        found = fresh;
+    }
+    if (found != nullptr) {
+        found->handle = (TaskHandle_t)1;    // 占位，创建完再写真正的句柄
+    }
+    portEXIT_CRITICAL(&s_lock);
+    return found;
+}
+
+static void release_slot(StaticTaskSlot* slot) {
+    portENTER_CRITICAL(&s_lock);
+    if (slot->stack == nullptr) {
+        slot->name = nullptr;       // 还没分配过内存，整个槽位归还
+    }
+    slot->handle = nullptr;
+    portEXIT_CRITICAL(&s_lock);
+}
+
+BaseType_t TaskFactory::create(TaskFunction_t fn, const char* name, uint32_t stack_bytes, void* arg,
+                               UBaseType_t priority, TaskHandle_t* handle, BaseType_t core,
+                               TaskStack stack) {
+    if (stack == TaskStack::PSRAM) {
+#if CONFIG_SPIRAM_ALLOW_STACK_EXTERNAL_MEMORY
+        StaticTaskSlot* slot = claim_slot(name, stack_bytes);
+        if (slot != nullptr) {
+            if (slot->stack == nullptr) {
+                slot->stack = (StackType_t*)BufferPlacement::alloc(name, stack_bytes, Placement::PSRAM);
+                slot->tcb = (StaticTask_t*)heap_caps_malloc(sizeof(StaticTask_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+                if (slot->stack == nullptr || slot->tcb == nullptr) {
+                    BufferPlacement::free(slot->stack);
+                    free(slot->tcb);
+                    slot->stack = nullptr;
+                    slot->tcb = nullptr;
+                }
+            }
+            TaskHandle_t created = nullptr;
+            if (slot->stack != nullptr) {
+                created = xTaskCreateStaticPinnedToCore(fn, name, slot->stack_bytes, arg, priority,
+                                                        slot->stack, slot->tcb, core);
+            }
+            if (created != nullptr) {
+                portENTER_CRITICAL(&s_lock);
+                slot->handle = created;
+                portEXIT_CRITICAL(&s_lock);
+                if (handle != nullptr) {
+                    *handle = created;
+                }
+                ESP_LOGD(TAG, "🧵 %s: %lu 字节栈在%s", name, (unsigned long)stack_bytes,
+                         BufferPlacement::regionName(slot->stack));
+                return pdPASS;
+            }
+            release_slot(slot);
+        }
+        ESP_LOGW(TAG, "⚠️ %s的栈没能放进PSRAM，改用内部RAM", name);
+#elif CONFIG_SPIRAM
+        ESP_LOGW(TAG, "⚠️ 没有打开CONFIG_SPIRAM_ALLOW_STACK_EXTERNAL_MEMORY，%s的栈放在内部RAM", name);
+#else
+        ESP_LOGD(TAG, "🧵 没有PSRAM，%s的栈放在内部RAM", name);
+#endif
+    }
+    return xTaskCreatePinnedToCore(fn, name, stack_bytes, arg, priority, handle, core);
+}
+
+void TaskFactory::destroy(TaskHandle_t handle) {
+    if (handle == nullptr || handle == xTaskGetCurrentTaskHandle()) {
+        ESP_LOGE(TAG, "❌ destroy()只能删除其他任务");
+        return;
+    }
+    vTaskDelete(handle);
+    // 静态任务删除后内核不再访问栈；内存留在槽位里，下次create()同名任务时复用
+    portENTER_CRITICAL(&s_lock);
+    for (StaticTaskSlot& slot : s_slots) {
+        if (slot.handle == handle) {
+            slot.handle = nullptr;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&s_lock);
+}
+
+void TaskFactory::logReport() {
+#if CONFIG_FREERTOS_USE_TRACE_FACILITY
+    static constexpr UBaseType_t kMaxTasks = 32;
+    TaskStatus_t* tasks = (TaskStatus_t*)malloc(sizeof(TaskStatus_t) * kMaxTasks);
+    if (tasks != nullptr) {
+        UBaseType_t count = uxTaskGetSystemState(tasks, kMaxTasks, nullptr);
+        ESP_LOGI(TAG, "🧵 任务栈（%u个任务）:", (unsigned)count);
+        for (UBaseType_t i = 0; i < count; i++) {
+            // ESP-IDF的StackType_t是字节，高水位就是历史最小剩余字节数
+            ESP_LOGI(TAG, "   %-18s 优先级%2u  %-12s 最少剩余 %5u 字节", tasks[i].pcTaskName,
+                     (unsigned)tasks[i].uxCurrentPriority, BufferPlacement::regionName(tasks[i].pxStackBase),
+                     (unsigned)tasks[i].usStackHighWaterMark);
+        }
+        free(tasks);
+    }
+#endif
+    uint32_t psram_stacks = 0;
+    portENTER_CRITICAL(&s_lock);
+    for (const StaticTaskSlot& slot : s_slots) {
+        if (slot.stack != nullptr && esp_ptr_external_ram(slot.stack)) {
+            psram_stacks += slot.stack_bytes;
+        }
+    }
+    portEXIT_CRITICAL(&s_lock);
+
+    size_t internal_free = heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    ESP_LOGI(TAG, "📊 内部RAM: 空闲 %u 字节，历史最低 %u，最大连续块 %u，DMA可用 %u；"
+                  "PSRAM: 空闲 %u 字节，其中任务栈占 %lu",
+             (unsigned)internal_free,
+             (unsigned)heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT),
+             (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT),
+             (unsigned)heap_caps_get_free_size(MALLOC_CAP_DMA),
+             (unsigned)heap_caps_get_free_size(MALLOC_CAP_SPIRAM), (unsigned long)psram_stacks);
+    if (internal_free < TASK_INTERNAL_HEAP_WARN_BYTES) {
+        ESP_LOGW(TAG, "⚠️ 内部RAM只剩 %u 字节（建议至少 %u），WiFi动态缓冲区分配失败时吞吐会塌掉",
+                 (unsigned)internal_free, (unsigned)TASK_INTERNAL_HEAP_WARN_BYTES);
+    }
+}
@@ -0,0 +1,63 @@
+/**
+ * @file task_factory.h
+ * @brief 🧵 任务工厂 - 按任务的实时性决定任务栈放在内部RAM还是PSRAM
+ *
+ * CONFIG_SPIRAM_ALLOW_STACK_EXTERNAL_MEMORY打开了，但xTaskCreatePinnedToCore总是从内部RAM分配任务栈。
+ * 内部RAM同时是WiFi动态缓冲区、lwIP pbuf和DMA描述符的来源，剩得太少时WiFi收发缓冲区分配失败，
+ * 吞吐直接塌掉。这里把任务分两类：
+ *
+ * - TaskStack::INTERNAL：实时音频和所有会访问Flash的任务（写NVS、OTA、读分区、mmap），
+ *   和以前一样用xTaskCreatePinnedToCore创建
+ * - TaskStack::PSRAM：不碰Flash的后台任务（重连/心跳、WebSocket事件），
+ *   用xTaskCreateStaticPinnedToCore创建，栈在PSRAM（BufferPlacement登记），TCB在内部RAM。
+ *   Flash操作期间cache关闭，PSRAM栈上的任务不能运行，IDF会直接断言，所以Flash相关的任务不能放这里
+ *
+ * PSRAM栈的任务不能自己vTaskDelete(NULL)退出（静态任务的栈不会被内核释放）：
+ * 由其他任务调用destroy()删除，栈和TCB留着给下一个同名任务复用。
+ *
+ * logReport()在启动后列出每个任务的栈位置和剩余量，以及内部RAM的余量。
+ */
+
+#ifndef TASK_FACTORY_H
+#define TASK_FACTORY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+enum class TaskStack : uint8_t {
+    INTERNAL,       // 内部RAM：实时音频、访问Flash的任务
+    PSRAM,          // PSRAM：不碰Flash的后台任务
+};
+
+class TaskFactory {
+public:
+    /**
+     * @brief 创建任务（参数和xTaskCreatePinnedToCore相同，多一个栈的位置）
+     *
+     * PSRAM不够时退回内部RAM并打警告。
+     *
+     * @return pdPASS=成功
+     */
+    static BaseType_t create(TaskFunction_t fn, const char* name, uint32_t stack_bytes, void* arg,
+                             UBaseType_t priority, TaskHandle_t* handle, BaseType_t core,
+                             TaskStack stack);
+
+    /**
+     * @brief 删除另一个任务（不能删除自己）；PSRAM栈保留给下一次create()同名任务复用
+     */
+    static void destroy(TaskHandle_t handle);
+
+    /**
+     * @brief 打印每个任务的栈位置和历史最小剩余，以及内部RAM空闲/历史最低/最大连续块
+     *
+     * 内部RAM空闲低于TASK_INTERNAL_HEAP_WARN_BYTES时告警。
+     */
+    static void logReport();
+
+private:
+    static const char* TAG;
+};
+
+#endif // TASK_FACTORY_H
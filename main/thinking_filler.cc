@@ -0,0 +1,65 @@
+/**
+ * @file thinking_filler.cc
+ * @brief ⏳ "思考中"提示音的计时
+ */
+
+#include "thinking_filler.h"
+#include "esp_log.h"
+#include "perf_counters.h"
+#include "project_config.h"
+
+static const char* TAG = "ThinkingFiller";
+
+ThinkingFiller::ThinkingFiller()
+    : armed_us_(0)
+    , eta_ms_(0)
+    , playing_(false)
+    , turn_us_(0)
+    , plays_(0)
+    , fading_(false)
+{
+}
+
+void ThinkingFiller::arm(int64_t now_us) {
+    eta_ms_.store(0, std::memory_order_relaxed);
+    armed_us_.store(now_us > 0 ? now_us : 1, std::memory_order_relaxed);
+    PerfCounters::add(PerfCounter::REPLY_WAITS);
+}
+
+ThinkingFiller::Action ThinkingFiller::update(int64_t now_us, bool waiting) {
+    int64_t armed = armed_us_.load(std::memory_order_relaxed);
+    if (armed != turn_us_) {
+        turn_us_ = armed;
+        plays_ = 0;
+    }
+    bool playing = playing_.load(std::memory_order_relaxed);
+    if (armed == 0 || !waiting) {
+        if (armed != 0) {
+            cancel();   // 用户又开口了或者会话结束了：这一轮不再播
+        }
+        if (playing && !fading_) {
+            fading_ = true;
+            return Action::FADE;
+        }
+        return Action::NONE;
+    }
+    if (playing || plays_ >= THINKING_EARCON_MAX_PLAYS) {
+        return Action::NONE;
+    }
+
+    uint32_t eta_ms = eta_ms_.load(std::memory_order_relaxed);
+    int64_t delay_ms = eta_ms > THINKING_EARCON_DELAY_MS ? THINKING_EARCON_EARLY_MS : THINKING_EARCON_DELAY_MS;
+    delay_ms += (int64_t)plays_ * THINKING_EARCON_REPEAT_MS;
+    if (now_us - armed < delay_ms * 1000) {
+        return Action::NONE;
+    }
+    if (plays_ == 0) {
+        PerfCounters::add(PerfCounter::THINKING_EARCONS);
+        ESP_LOGI(TAG, "⏳ 说完%lld ms还没有回复音频（服务器预估%lu ms），播放思考提示音",
+                 (now_us - armed) / 1000, (unsigned long)eta_ms);
+    }
+    plays_++;
+    fading_ = false;
+    playing_.store(true, std::memory_order_relaxed);
+    return Action::PLAY;
+}
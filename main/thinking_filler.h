@@ -0,0 +1,83 @@
+/**
+ * @file thinking_filler.h
+ * @brief ⏳ "思考中"提示音 - 说完后迟迟没有回复音频时本地先出声，回复到了就交叉淡出
+ *
+ * 豆包慢的时候用户说完要等一两秒甚至更久才听到回复，一片安静很容易让人以为没听见又问一遍，
+ * 服务器上就多了一轮。说完（speech_end）时开始计时：
+ *
+ * - THINKING_EARCON_DELAY_MS内还没有下行音频，通过混音器的提示音声部播PROMPT_THINKING；
+ *   还等不到就每THINKING_EARCON_REPEAT_MS再播一次，每轮最多THINKING_EARCON_MAX_PLAYS次
+ * - 服务器协商了"reply_eta"时在说完后给出这一轮的预估（最近几轮说完到第一条下行的平均），
+ *   预估超过DELAY时提前到THINKING_EARCON_EARLY_MS播；从缓存回复时再发一次ms=0，按DELAY算
+ * - 第一条下行音频到了、用户又开口了、或者这一轮结束了：在播的提示音MIXER_CROSSFADE_MS内淡出，
+ *   同时回复语音的ducking恢复，两边交叉淡变
+ *
+ * REPLY_WAITS/THINKING_EARCONS两个计数器之比就是"第一条回复音频太慢"的轮次比例，服务器在STATS里算成thinking_pct。
+ *
+ * arm()在发送任务、setEta()/onDownlink()/cancel()在WebSocket或UDP接收任务、onPlayed()在播放任务，
+ * update()只在主任务中调用，跨任务的状态都是原子变量。
+ */
+
+#ifndef THINKING_FILLER_H
+#define THINKING_FILLER_H
+
+#include <stdint.h>
+#include <atomic>
+
+class ThinkingFiller {
+public:
+    enum class Action : uint8_t {
+        NONE,
+        PLAY,       // 现在播一次提示音（播完调用onPlayed）
+        FADE,       // 在播的提示音淡出
+    };
+
+    ThinkingFiller();
+
+    /**
+     * @brief 用户说完了，开始等回复
+     */
+    void arm(int64_t now_us);
+
+    /**
+     * @brief 服务器对这一轮的预估（reply_eta），0=马上就有或没有预估
+     */
+    void setEta(uint32_t ms) { eta_ms_.store(ms, std::memory_order_relaxed); }
+
+    /**
+     * @brief 收到下行音频（每条都会调用，只有等回复时才有写入）
+     */
+    void onDownlink() {
+        if (armed_us_.load(std::memory_order_relaxed) != 0) {
+            armed_us_.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief 这一轮不用再等了（tts_end、打断）
+     */
+    void cancel() { armed_us_.store(0, std::memory_order_relaxed); }
+
+    /**
+     * @brief 提示音播完或被淡出（播放任务的回调）
+     */
+    void onPlayed() { playing_.store(false, std::memory_order_relaxed); }
+
+    /**
+     * @brief 推进（主循环每10ms）
+     *
+     * @param waiting 会话还在、用户没有在说话
+     */
+    Action update(int64_t now_us, bool waiting);
+
+private:
+    std::atomic<int64_t> armed_us_;     // 说完的时间，0=没在等
+    std::atomic<uint32_t> eta_ms_;
+    std::atomic<bool> playing_;
+    // 只在主任务中访问
+    int64_t turn_us_;                   // 当前计时的这一轮（armed_us_变了就是新的一轮）
+    uint32_t plays_;
+    bool fading_;
+};
+
+#endif // THINKING_FILLER_H
@@ -0,0 +1,252 @@
+/**
+ * @file tls_transport.cc
+ * @brief 🔐 esp_tls上的esp_transport实现和TLS会话缓存
+ */
+
+#include "tls_transport.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_crt_bundle.h"
+#include "perf_counters.h"
+#include "mbedtls/ssl.h"
+#include "lwip/sockets.h"
+#include <cstring>
+#include <cerrno>
+
+static const char *TAG = "TlsTransport";
+
+TlsTransport::TlsTransport()
+    : tls_(nullptr)
+#ifdef CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS
+    , session_(nullptr)
+#endif
+    , session_start_(0)
+    , keep_alive_{}
+    , no_delay_(true)
+    , session_resume_(true)
+    , stats_{}
+{
+}
+
+TlsTransport::~TlsTransport() {
+    close();
+    forgetSession();
+}
+
+esp_transport_handle_t TlsTransport::create(const esp_transport_keep_alive_t* keep_alive, bool no_delay, bool session_resume) {
+    esp_transport_handle_t t = esp_transport_init();
+    if (t == nullptr) {
+        return nullptr;
+    }
+    keep_alive_ = {};
+    if (keep_alive != nullptr) {
+        keep_alive_.keep_alive_enable = keep_alive->keep_alive_enable;
+        keep_alive_.keep_alive_idle = keep_alive->keep_alive_idle;
+        keep_alive_.keep_alive_interval = keep_alive->keep_alive_interval;
+        keep_alive_.keep_alive_count = keep_alive->keep_alive_count;
+    }
+    no_delay_ = no_delay;
+    session_resume_ = session_resume;
+    if (!session_resume_) {
+        forgetSession();
+    }
+#ifndef CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS
+    ESP_LOGW(TAG, "⚠️ 未打开CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS，每次重连都是完整握手");
+#endif
+
+    // 销毁句柄时只断开连接，会话缓存留给下一个句柄
+    esp_transport_set_func(t, connectFn, readFn, writeFn, closeFn, pollReadFn, pollWriteFn, closeFn);
+    esp_transport_set_context_data(t, this);
+    esp_transport_set_default_port(t, 443);
+    return t;
+}
+
+void TlsTransport::forgetSession() {
+#ifdef CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS
+    if (session_ != nullptr) {
+        esp_tls_free_client_session(session_);
+        session_ = nullptr;
+    }
+#endif
+    session_start_ = 0;
+}
+
+TlsTransport* TlsTransport::self(esp_transport_handle_t t) {
+    return static_cast<TlsTransport*>(esp_transport_get_context_data(t));
+}
+
+int TlsTransport::connectFn(esp_transport_handle_t t, const char* host, int port, int timeout_ms) {
+    return self(t)->connect(host, port, timeout_ms);
+}
+
+int TlsTransport::readFn(esp_transport_handle_t t, char* buffer, int len, int timeout_ms) {
+    TlsTransport* tls = self(t);
+    int ready = tls->poll(timeout_ms, false);
+    if (ready <= 0) {
+        return ready;
+    }
+    int ret = esp_tls_conn_read(tls->tls_, buffer, len);
+    if (ret == ESP_TLS_ERR_SSL_WANT_READ || ret == ESP_TLS_ERR_SSL_WANT_WRITE) {
+        return ERR_TCP_TRANSPORT_CONNECTION_TIMEOUT;    // 只收到半条TLS记录
+    }
+    if (ret == 0) {
+        return ERR_TCP_TRANSPORT_CONNECTION_CLOSED_BY_FIN;
+    }
+    if (ret < 0) {
+        ESP_LOGW(TAG, "⚠️ TLS读取失败: -0x%04x", -ret);
+    }
+    return ret;
+}
+
+int TlsTransport::writeFn(esp_transport_handle_t t, const char* buffer, int len, int timeout_ms) {
+    TlsTransport* tls = self(t);
+    int ready = tls->poll(timeout_ms, true);
+    if (ready <= 0) {
+        return ready;
+    }
+    int ret = esp_tls_conn_write(tls->tls_, buffer, len);
+    if (ret == ESP_TLS_ERR_SSL_WANT_READ || ret == ESP_TLS_ERR_SSL_WANT_WRITE) {
+        return ERR_TCP_TRANSPORT_CONNECTION_TIMEOUT;
+    }
+    if (ret < 0) {
+        ESP_LOGW(TAG, "⚠️ TLS发送失败: -0x%04x", -ret);
+    }
+    return ret;
+}
+
+int TlsTransport::pollReadFn(esp_transport_handle_t t, int timeout_ms) {
+    return self(t)->poll(timeout_ms, false);
+}
+
+int TlsTransport::pollWriteFn(esp_transport_handle_t t, int timeout_ms) {
+    return self(t)->poll(timeout_ms, true);
+}
+
+int TlsTransport::closeFn(esp_transport_handle_t t) {
+    self(t)->close();
+    return 0;
+}
+
+int TlsTransport::connect(const char* host, int port, int timeout_ms) {
+    close();
+    tls_ = esp_tls_init();
+    if (tls_ == nullptr) {
+        return -1;
+    }
+
+    esp_tls_cfg_t cfg = {};
+    cfg.timeout_ms = timeout_ms;
+    cfg.crt_bundle_attach = esp_crt_bundle_attach;
+    cfg.keep_alive_cfg = keep_alive_.keep_alive_enable ? &keep_alive_ : nullptr;
+    bool offered = false;
+#ifdef CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS
+    cfg.client_session = session_;
+    offered = session_ != nullptr;
+#endif
+
+    int64_t start_us = esp_timer_get_time();
+    if (esp_tls_conn_new_sync(host, strlen(host), port, &cfg, tls_) <= 0) {
+        stats_.failures++;
+        ESP_LOGW(TAG, "⚠️ TLS连接%s:%d失败%s", host, port, offered ? "，丢弃缓存的会话" : "");
+        esp_tls_conn_destroy(tls_);
+        tls_ = nullptr;
+        // 服务器不认识旧会话时会正常完整握手，走到这里说明连接本身有问题，下次不再带旧会话
+        forgetSession();
+        return -1;
+    }
+    uint32_t elapsed_ms = (uint32_t)((esp_timer_get_time() - start_us) / 1000);
+
+    mbedtls_ssl_context* ssl = static_cast<mbedtls_ssl_context*>(esp_tls_get_ssl_context(tls_));
+    int64_t session_start = ssl != nullptr ? (int64_t)ssl->MBEDTLS_PRIVATE(session)->MBEDTLS_PRIVATE(start) : 0;
+    bool resumed = offered && session_start == session_start_;
+
+    stats_.handshakes++;
+    stats_.last_ms = elapsed_ms;
+    stats_.last_resumed = resumed;
+    if (resumed) {
+        stats_.resumed++;
+        stats_.last_resumed_ms = elapsed_ms;
+        PerfCounters::add(PerfCounter::TLS_RESUMED_HANDSHAKES);
+        PerfCounters::add(PerfCounter::TLS_RESUMED_MS, elapsed_ms);
+    } else {
+        stats_.last_full_ms = elapsed_ms;
+        PerfCounters::add(PerfCounter::TLS_FULL_HANDSHAKES);
+        PerfCounters::add(PerfCounter::TLS_FULL_MS, elapsed_ms);
+    }
+    ESP_LOGI(TAG, "🔐 TLS握手 %lu ms（%s，累计%lu次，复用%lu次）", (unsigned long)elapsed_ms,
+             resumed ? "复用会话" : offered ? "服务器未接受缓存的会话，完整握手" : "完整握手",
+             (unsigned long)stats_.handshakes, (unsigned long)stats_.resumed);
+
+#ifdef CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS
+    // 复用后服务器可能换发了新票据，每次都换成最新的会话
+    if (session_resume_) {
+        esp_tls_client_session_t* session = esp_tls_get_client_session(tls_);
+        if (session != nullptr) {
+            forgetSession();
+            session_ = session;
+            session_start_ = session_start;
+        }
+    }
+#endif
+
+    applyNoDelay();
+    return 0;
+}
+
+int TlsTransport::poll(int timeout_ms, bool write) {
+    if (tls_ == nullptr) {
+        return -1;
+    }
+    // mbedTLS已经解密、还没读走的数据在socket上看不到
+    if (!write && esp_tls_get_bytes_avail(tls_) > 0) {
+        return 1;
+    }
+    int sock = -1;
+    if (esp_tls_get_conn_sockfd(tls_, &sock) != ESP_OK || sock < 0) {
+        return -1;
+    }
+
+    fd_set fds;
+    fd_set errors;
+    FD_ZERO(&fds);
+    FD_ZERO(&errors);
+    FD_SET(sock, &fds);
+    FD_SET(sock, &errors);
+    struct timeval timeout = { timeout_ms / 1000, (timeout_ms % 1000) * 1000 };
+    int ret = select(sock + 1, write ? nullptr : &fds, write ? &fds : nullptr, &errors,
+                     timeout_ms < 0 ? nullptr : &timeout);
+    if (ret > 0 && FD_ISSET(sock, &errors)) {
+        int error = 0;
+        socklen_t len = sizeof(error);
+        getsockopt(sock, SOL_SOCKET, SO_ERROR, &error, &len);
+        ESP_LOGW(TAG, "⚠️ TLS socket错误: errno %d", error);
+        return -1;
+    }
+    return ret;
+}
+
+void TlsTransport::close() {
+    if (tls_ != nullptr) {
+        esp_tls_conn_destroy(tls_);
+        tls_ = nullptr;
+    }
+}
+
+int TlsTransport::socket() const {
+    int sock = -1;
+    if (tls_ == nullptr || esp_tls_get_conn_sockfd(tls_, &sock) != ESP_OK) {
+        return -1;
+    }
+    return sock;
+}
+
+void TlsTransport::applyNoDelay() {
+    int sock = -1;
+    if (!no_delay_ || esp_tls_get_conn_sockfd(tls_, &sock) != ESP_OK || sock < 0) {
+        return;
+    }
+    int one = 1;
+    if (setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one)) != 0) {
+        ESP_LOGW(TAG, "⚠️ 设置TCP_NODELAY失败: errno %d", errno);
+    }
+}
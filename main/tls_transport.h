@@ -0,0 +1,98 @@
+/**
+ * @file tls_transport.h
+ * @brief 🔐 wss://的TLS传输层 - 证书包验证服务器，TLS会话在重连之间复用
+ *
+ * esp_websocket_client内部创建的SSL传输层每次连接都是完整握手：ECDHE密钥交换加证书链验证，
+ * 在ESP32-S3上要几百毫秒，唤醒时重连全都算在首包延迟里。这里自己实现一个esp_transport，
+ * 底下是esp_tls（mbedTLS），和WebSocketClient自建的ws://传输层一样交给组件当ext_transport：
+ *
+ * - 服务器证书用ESP-IDF证书包（esp_crt_bundle_attach）验证，不需要在固件里写死CA
+ * - 每次握手成功后保存会话（esp_tls_get_client_session，TLS 1.2的session ticket或session ID），
+ *   下次连接带上它，服务器接受时只需一个RTT的简短握手，不再做密钥交换和证书验证；
+ *   服务器不认识时mbedTLS自动退回完整握手。会话缓存在本对象里，传输层句柄销毁后仍然保留
+ * - AES/SHA/大数运算走硬件加速（sdkconfig里的CONFIG_MBEDTLS_HARDWARE_*）
+ * - 每次握手记录耗时（含TCP建连）和是否复用了会话，见Stats
+ *
+ * 是否复用靠会话的建立时间判断：mbedTLS恢复会话时沿用缓存里的start，完整握手时取当前时间。
+ * 两次完整握手落在同一秒内时会被误记为复用，只影响统计。
+ *
+ * 所有回调都在WebSocket任务中执行，getStats()也只应在该任务（事件回调）中调用。
+ * 需要CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS，没打开时照常连接，只是每次都完整握手。
+ */
+
+#ifndef TLS_TRANSPORT_H
+#define TLS_TRANSPORT_H
+
+#include <stdint.h>
+#include "esp_transport.h"
+#include "esp_tls.h"
+#include "sdkconfig.h"
+
+class TlsTransport {
+public:
+    struct Stats {
+        uint32_t handshakes;        // 成功的握手次数
+        uint32_t resumed;           // 其中复用了会话的次数
+        uint32_t failures;          // 连接或握手失败的次数
+        uint32_t last_ms;           // 最近一次握手耗时（含TCP建连）
+        uint32_t last_full_ms;      // 最近一次完整握手耗时
+        uint32_t last_resumed_ms;   // 最近一次会话复用握手耗时
+        bool last_resumed;          // 最近一次握手复用了会话
+    };
+
+    TlsTransport();
+    ~TlsTransport();
+
+    TlsTransport(const TlsTransport&) = delete;
+    TlsTransport& operator=(const TlsTransport&) = delete;
+
+    /**
+     * @brief 创建传输层句柄，用esp_transport_ws_init()包上一层WebSocket
+     *
+     * 句柄加入esp_transport_list后由列表销毁；本对象必须比句柄活得久。
+     *
+     * @param keep_alive TCP keep-alive参数，nullptr=不启用
+     * @param no_delay 握手完成后关闭Nagle（TCP_NODELAY）
+     * @param session_resume 复用上次的TLS会话
+     * @return 句柄，内存不足时返回nullptr
+     */
+    esp_transport_handle_t create(const esp_transport_keep_alive_t* keep_alive, bool no_delay, bool session_resume);
+
+    /**
+     * @brief 当前连接的socket（没连着时返回-1），设置DSCP等socket选项用
+     */
+    int socket() const;
+
+    /**
+     * @brief 丢弃缓存的会话，下次连接完整握手
+     */
+    void forgetSession();
+
+    const Stats& getStats() const { return stats_; }
+
+private:
+    static TlsTransport* self(esp_transport_handle_t t);
+    static int connectFn(esp_transport_handle_t t, const char* host, int port, int timeout_ms);
+    static int readFn(esp_transport_handle_t t, char* buffer, int len, int timeout_ms);
+    static int writeFn(esp_transport_handle_t t, const char* buffer, int len, int timeout_ms);
+    static int pollReadFn(esp_transport_handle_t t, int timeout_ms);
+    static int pollWriteFn(esp_transport_handle_t t, int timeout_ms);
+    static int closeFn(esp_transport_handle_t t);
+
+    int connect(const char* host, int port, int timeout_ms);
+    int poll(int timeout_ms, bool write);
+    void close();
+    void applyNoDelay();
+
+    esp_tls_t* tls_;
+#ifdef CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS
+    esp_tls_client_session_t* session_;
+#endif
+    int64_t session_start_;         // 缓存会话的建立时间（mbedTLS的session start，秒）
+    tls_keep_alive_cfg_t keep_alive_;
+    bool no_delay_;
+    bool session_resume_;
+    Stats stats_;
+};
+
+#endif // TLS_TRANSPORT_H
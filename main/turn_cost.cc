@@ -0,0 +1,89 @@
+/**
+ * @file turn_cost.cc
+ * @brief 💰 每轮资源账单实现
+ */
+
+#include "turn_cost.h"
+#include <stdio.h>
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "perf_counters.h"
+
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+static constexpr bool kRunTimeStats = true;
+#else
+static constexpr bool kRunTimeStats = false;
+#endif
+
+TurnCost::TurnCost()
+    : start_us_(0)
+    , up_bytes_(0)
+    , down_bytes_(0)
+    , ws_write_us_(0)
+    , jitter_peak_ms_(0)
+    , ws_queue_peak_(0)
+    , uplink_queue_peak_(0)
+{
+    for (std::atomic<uint32_t>& idle : idle_) {
+        idle = 0;
+    }
+}
+
+uint32_t TurnCost::idleRunTime(int core) {
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    // 运行时间计数器用esp_timer，单位微秒；按32位相减，回绕不影响增量
+    return (uint32_t)ulTaskGetRunTimeCounter(xTaskGetIdleTaskHandleForCore(core));
+#else
+    return 0;
+#endif
+}
+
+void TurnCost::begin(uint32_t ws_write_us) {
+    start_us_ = esp_timer_get_time();
+    up_bytes_ = PerfCounters::get(PerfCounter::UPLINK_BYTES);
+    down_bytes_ = PerfCounters::get(PerfCounter::DOWNLINK_BYTES);
+    ws_write_us_ = ws_write_us;
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+        idle_[core] = idleRunTime(core);
+    }
+    jitter_peak_ms_ = 0;
+    ws_queue_peak_ = 0;
+    uplink_queue_peak_ = 0;
+}
+
+void TurnCost::noteMax(std::atomic<uint32_t>& slot, uint32_t value) {
+    uint32_t current = slot.load(std::memory_order_relaxed);
+    while (value > current && !slot.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+void TurnCost::notePeaks(uint32_t jitter_ms, uint32_t ws_queue_depth, uint32_t uplink_queue_depth) {
+    noteMax(jitter_peak_ms_, jitter_ms);
+    noteMax(ws_queue_peak_, ws_queue_depth);
+    noteMax(uplink_queue_peak_, uplink_queue_depth);
+}
+
+size_t TurnCost::formatTurn(char* buf, size_t size, const char* session, uint32_t turn, uint32_t ws_write_us) const {
+    int64_t start = start_us_.load();
+    if (start == 0) {
+        return 0;
+    }
+    uint32_t wall_us = (uint32_t)(esp_timer_get_time() - start);
+    long cpu_ms[portNUM_PROCESSORS];
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+        uint32_t idle_us = idleRunTime(core) - idle_[core].load();
+        cpu_ms[core] = kRunTimeStats ? (long)((wall_us > idle_us ? wall_us - idle_us : 0) / 1000) : -1L;
+    }
+    int len = snprintf(buf, size,
+                       "{\"type\":\"cost\",\"session\":\"%s\",\"turn\":%lu,\"ms\":%lu,"
+                       "\"up_bytes\":%lu,\"down_bytes\":%lu,\"cpu_ms\":[%ld,%ld],\"ws_write_ms\":%lu,"
+                       "\"jb_peak_ms\":%lu,\"ws_q_peak\":%lu,\"up_q_peak\":%lu}",
+                       session, (unsigned long)turn, (unsigned long)(wall_us / 1000),
+                       (unsigned long)(PerfCounters::get(PerfCounter::UPLINK_BYTES) - up_bytes_.load()),
+                       (unsigned long)(PerfCounters::get(PerfCounter::DOWNLINK_BYTES) - down_bytes_.load()),
+                       cpu_ms[0], portNUM_PROCESSORS > 1 ? cpu_ms[portNUM_PROCESSORS - 1] : -1L,
+                       (unsigned long)((ws_write_us - ws_write_us_.load()) / 1000),
+                       (unsigned long)jitter_peak_ms_.load(), (unsigned long)ws_queue_peak_.load(),
+                       (unsigned long)uplink_queue_peak_.load());
+    return (len > 0 && (size_t)len < size) ? (size_t)len : 0;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file turn_cost.h
+ * @brief 💰 每轮资源账单 - 一轮对话花了多少上下行流量、每个核心多少CPU、发送卡了多久、缓冲区最满到多少
+ *
+ * 做容量规划要知道"一轮对话"的成本，而不是30秒一次的统计平均：编码、VAD门控、合包这些功能到底省了多少，
+ * 要按轮次和服务器那边的重采样、上游流量放在一起看。每轮开始（唤醒、按键、上一轮tts_end）调用begin()记下起点，
+ * tts_end时formatTurn()算出增量，{"type":"cost","session":...,"turn":n,...}和trace一起发给服务器，
+ * 服务器按会话ID和自己这一轮的账单合并导出（RELAY_COST_LOG）：
+ *
+ * - up_bytes/down_bytes：上行音频消息、下行音频负载的字节（PerfCounter::UPLINK_BYTES/DOWNLINK_BYTES的增量）
+ * - cpu_ms：每个核心的忙碌时间 = 墙钟时间 - 空闲任务的运行时间（需要CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS，否则为-1）
+ * - ws_write_ms：发送任务写socket的累计耗时（TCP窗口满时卡在这里）
+ * - jb_peak_ms/ws_q_peak/up_q_peak：抖动缓冲区、WebSocket音频通道、上行发送队列的最高占用（主循环每轮采样）
+ *
+ * begin()可以在fetch任务、WebSocket任务或主任务中调用，notePeaks()在主任务，formatTurn()在WebSocket任务；
+ * 状态都是原子变量，同一时刻只有一处在开始新的一轮。
+ */
+
+#ifndef TURN_COST_H
+#define TURN_COST_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include "freertos/FreeRTOS.h"
+
+class TurnCost {
+public:
+    TurnCost();
+
+    /**
+     * @brief 新一轮开始：记下各累计值的起点，清掉峰值
+     *
+     * @param ws_write_us WebSocket各发送通道写socket的累计耗时（SendStats::write_us之和）
+     */
+    void begin(uint32_t ws_write_us);
+
+    /**
+     * @brief 主循环采样一次缓冲区占用
+     */
+    void notePeaks(uint32_t jitter_ms, uint32_t ws_queue_depth, uint32_t uplink_queue_depth);
+
+    /**
+     * @brief 把本轮账单格式化成发给服务器的JSON
+     *
+     * @return 写入的字符数（不含结尾'\0'），缓冲区不够时返回0
+     */
+    size_t formatTurn(char* buf, size_t size, const char* session, uint32_t turn, uint32_t ws_write_us) const;
+
+private:
+    static void noteMax(std::atomic<uint32_t>& slot, uint32_t value);
+    static uint32_t idleRunTime(int core);
+
+    std::atomic<int64_t> start_us_;
+    std::atomic<uint32_t> up_bytes_;
+    std::atomic<uint32_t> down_bytes_;
+    std::atomic<uint32_t> ws_write_us_;
+    std::atomic<uint32_t> idle_[portNUM_PROCESSORS];
+    std::atomic<uint32_t> jitter_peak_ms_;
+    std::atomic<uint32_t> ws_queue_peak_;
+    std::atomic<uint32_t> uplink_queue_peak_;
+};
+
+#endif // TURN_COST_H
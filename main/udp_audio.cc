@@ -0,0 +1,476 @@
+/**
+ * @file udp_audio.cc
+ * @brief 📡 UDP音频通道实现
+ */
+
+#include "udp_audio.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "lwip/sockets.h"
+#include "audio_framing.h"
+#include "buffer_placement.h"
+#include "flight_recorder.h"
+#include "json_message.h"
+#include "perf_counters.h"
+#include "task_factory.h"
+
+const char* UdpAudio::TAG = "UdpAudio";
+
+static constexpr int kRecvTimeoutMs = 50;           // 接收超时，PING/报告/超时检查按这个粒度
+static constexpr uint32_t kResyncGap = 1024;        // 序号一下跳这么多说明对端重新开始计数，不算丢失
+static constexpr uint32_t kReportMinMessages = 10;  // 一段报告里期望的条数太少时不算丢失率
+
+UdpAudio::UdpAudio(WebSocketClient* ws, AudioHandler on_audio)
+    : ws_(ws)
+    , on_audio_(on_audio)
+    , task_(nullptr)
+    , fd_lock_(nullptr)
+    , lock_(portMUX_INITIALIZER_UNLOCKED)
+    , peer_{}
+    , peer_len_(0)
+    , token_(0)
+    , generation_(0)
+    , wanted_(false)
+    , fd_(-1)
+    , opened_generation_(0)
+    , ready_(false)
+    , probe_start_us_(0)
+    , next_ping_us_(0)
+    , next_report_us_(0)
+    , tx_buf_(nullptr)
+    , prev_msg_(nullptr)
+    , prev_len_(0)
+    , tx_msg_id_(0)
+    , up_sent_(0)
+    , up_last_expected_(0)
+    , up_last_recv_(0)
+    , up_bad_reports_(0)
+    , up_loss_pct_(0)
+    , up_last_report_us_(0)
+    , up_fallback_(false)
+    , rx_buf_(nullptr)
+    , reasm_buf_(nullptr)
+    , reasm_id_(0)
+    , reasm_mask_(0)
+    , reasm_count_(0)
+    , reasm_len_(0)
+    , down_synced_(false)
+    , down_base_(0)
+    , down_high_(0)
+    , down_recv_(0)
+    , down_fec_(0)
+    , lost_{}
+    , lost_count_(0)
+    , rtt_ms_(0)
+{
+}
+
+esp_err_t UdpAudio::init() {
+    fd_lock_ = xSemaphoreCreateMutexStatic(&fd_lock_struct_);
+    tx_buf_ = (uint8_t*)BufferPlacement::alloc("udp_tx", HEADER_BYTES + UDP_AUDIO_MAX_DATAGRAM, Placement::INTERNAL);
+    prev_msg_ = (uint8_t*)BufferPlacement::alloc("udp_prev", UDP_AUDIO_MAX_DATAGRAM, Placement::INTERNAL);
+    rx_buf_ = (uint8_t*)BufferPlacement::alloc("udp_rx", HEADER_BYTES + UDP_AUDIO_MAX_DATAGRAM, Placement::INTERNAL);
+    reasm_buf_ = (uint8_t*)BufferPlacement::alloc("udp_reasm", MAX_MESSAGE, Placement::PSRAM);
+    if (!fd_lock_ || !tx_buf_ || !prev_msg_ || !rx_buf_ || !reasm_buf_) {
+        ESP_LOGE(TAG, "❌ UDP音频通道缓冲区分配失败");
+        return ESP_ERR_NO_MEM;
+    }
+    if (TaskFactory::create(rx_task, "udp_audio", UDP_AUDIO_TASK_STACK, this, UDP_AUDIO_TASK_PRIORITY, &task_,
+                            UDP_AUDIO_TASK_CORE, TaskStack::INTERNAL) != pdPASS) {
+        ESP_LOGE(TAG, "❌ 创建UDP音频接收任务失败");
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+void UdpAudio::start(uint16_t port, uint32_t token) {
+    struct sockaddr_storage peer = {};
+    socklen_t len = 0;
+    if (!task_ || !ws_->peerAddress(&peer, &len)) {
+        stop();
+        return;
+    }
+    if (peer.ss_family == AF_INET) {
+        ((struct sockaddr_in*)&peer)->sin_port = htons(port);
+    } else {
+        ((struct sockaddr_in6*)&peer)->sin6_port = htons(port);
+    }
+    ready_ = false;
+    up_fallback_ = false;
+    up_loss_pct_ = 0;
+    portENTER_CRITICAL(&lock_);
+    peer_ = peer;
+    peer_len_ = len;
+    token_ = token;
+    up_last_expected_ = 0;
+    up_last_recv_ = 0;
+    up_bad_reports_ = 0;
+    portEXIT_CRITICAL(&lock_);
+    generation_.fetch_add(1);
+    wanted_ = true;
+    xTaskNotifyGive(task_);
+}
+
+void UdpAudio::stop() {
+    ready_ = false;
+    if (!wanted_.exchange(false)) {
+        return;
+    }
+    generation_.fetch_add(1);
+    xTaskNotifyGive(task_);
+}
+
+void UdpAudio::writeHeader(uint8_t* out, Kind kind, uint8_t fragment, uint16_t msg_id, uint16_t len) const {
+    Header header = {MAGIC, (uint8_t)kind, fragment, 0, token_, msg_id, len};
+    memcpy(out, &header, sizeof(header));
+}
+
+int UdpAudio::send(const uint8_t* message, size_t len) {
+    if (!uplinkReady() || len == 0 || len > MAX_MESSAGE) {
+        return -1;
+    }
+    // 接收任务正在开关socket时不等，这一条走WebSocket
+    if (xSemaphoreTake(fd_lock_, 0) != pdTRUE) {
+        return -1;
+    }
+    int ret = -1;
+    if (fd_ >= 0) {
+        uint16_t id = tx_msg_id_++;
+        if (len <= UDP_AUDIO_MAX_DATAGRAM) {
+            size_t extra = UDP_AUDIO_REDUNDANCY && prev_len_ > 0 && len + prev_len_ <= UDP_AUDIO_MAX_DATAGRAM
+                               ? prev_len_ : 0;
+            writeHeader(tx_buf_, Kind::AUDIO, 0x01, id, (uint16_t)len);
+            memcpy(tx_buf_ + HEADER_BYTES, message, len);
+            memcpy(tx_buf_ + HEADER_BYTES + len, prev_msg_, extra);
+            ret = ::send(fd_, tx_buf_, HEADER_BYTES + len + extra, MSG_DONTWAIT) >= 0 ? (int)len : -1;
+            memcpy(prev_msg_, message, len);
+            prev_len_ = len;
+        } else {
+            // 分片的消息不带副本，也不作为下一条的副本
+            size_t count = (len + FRAGMENT_BYTES - 1) / FRAGMENT_BYTES;
+            ret = (int)len;
+            for (size_t i = 0; i < count; i++) {
+                size_t offset = i * FRAGMENT_BYTES;
+                size_t piece = std::min(FRAGMENT_BYTES, len - offset);
+                writeHeader(tx_buf_, Kind::AUDIO, (uint8_t)((i << 4) | count), id, (uint16_t)piece);
+                memcpy(tx_buf_ + HEADER_BYTES, message + offset, piece);
+                if (::send(fd_, tx_buf_, HEADER_BYTES + piece, MSG_DONTWAIT) < 0) {
+                    ret = -1;
+                    break;
+                }
+            }
+            prev_len_ = 0;
+        }
+    }
+    xSemaphoreGive(fd_lock_);
+    if (ret >= 0) {
+        up_sent_.fetch_add(1, std::memory_order_relaxed);
+        PerfCounters::add(PerfCounter::UDP_UP_MESSAGES);
+    }
+    return ret;
+}
+
+/**
+ * @brief 在紧凑JSON里找一个无符号整数字段（token是u32，float放不下）
+ */
+static bool json_u32(std::string_view text, const char* key, uint32_t* out) {
+    size_t pos = text.find(key);
+    if (pos == std::string_view::npos) {
+        return false;
+    }
+    char* end = nullptr;
+    const char* start = text.data() + pos + strlen(key);
+    unsigned long value = strtoul(start, &end, 10);
+    if (end == start) {
+        return false;
+    }
+    *out = (uint32_t)value;
+    return true;
+}
+
+void UdpAudio::onReport(std::string_view text) {
+    if (text.find("\"down\":false") != std::string_view::npos) {
+        ESP_LOGW(TAG, "⚠️ 服务器那边的下行UDP丢失太多，下行退回WebSocket");
+        FLIGHT_RECORD(UDP_FALLBACK, 0, 1);
+    }
+    uint32_t expected = 0;
+    uint32_t recv = 0;
+    if (!uplinkReady() || !json_u32(text, "\"expected\":", &expected) || !json_u32(text, "\"recv\":", &recv)) {
+        return;
+    }
+    up_last_report_us_ = esp_timer_get_time();
+    bool bad = false;
+    uint32_t loss_pct = 0;
+    bool judged = false;
+    portENTER_CRITICAL(&lock_);
+    uint32_t window = expected - up_last_expected_;
+    if (window >= kReportMinMessages) {
+        uint32_t got = recv - up_last_recv_;
+        loss_pct = got >= window ? 0 : (window - got) * 100 / window;
+        bad = loss_pct > UDP_AUDIO_FALLBACK_LOSS_PCT;
+        up_bad_reports_ = bad ? up_bad_reports_ + 1 : 0;
+        bad = up_bad_reports_ >= UDP_AUDIO_FALLBACK_REPORTS;
+        up_last_expected_ = expected;
+        up_last_recv_ = recv;
+        judged = true;
+    }
+    portEXIT_CRITICAL(&lock_);
+    if (!judged) {
+        return;     // 说话间隙没怎么发，攒到够数再算
+    }
+    up_loss_pct_ = loss_pct;
+    if (bad) {
+        fallBackUplink(loss_pct, "丢失太多");
+    }
+}
+
+void UdpAudio::fallBackUplink(uint32_t loss_pct, const char* reason) {
+    if (up_fallback_.exchange(true)) {
+        return;
+    }
+    ESP_LOGW(TAG, "⚠️ 上行UDP%s（最近一段丢失%lu%%），这次连接改回WebSocket", reason, (unsigned long)loss_pct);
+    PerfCounters::add(PerfCounter::UDP_FALLBACKS);
+    FLIGHT_RECORD(UDP_FALLBACK, loss_pct, 0);
+}
+
+void UdpAudio::rx_task(void* arg) {
+    ((UdpAudio*)arg)->run();
+}
+
+bool UdpAudio::openSocket() {
+    portENTER_CRITICAL(&lock_);
+    struct sockaddr_storage peer = peer_;
+    socklen_t peer_len = peer_len_;
+    portEXIT_CRITICAL(&lock_);
+    int fd = socket(peer.ss_family, SOCK_DGRAM, IPPROTO_UDP);
+    if (fd < 0) {
+        ESP_LOGW(TAG, "⚠️ 创建UDP socket失败: errno %d", errno);
+        return false;
+    }
+    // 📶 和WebSocket连接同一个DSCP（见WS_DSCP）
+    int tos = ws_->dscp() << 2;
+    if (tos != 0 && peer.ss_family == AF_INET) {
+        setsockopt(fd, IPPROTO_IP, IP_TOS, &tos, sizeof(tos));
+    }
+    struct timeval tv = {0, kRecvTimeoutMs * 1000};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    // connect之后只收服务器这个地址的数据报，发送也不用每次带地址
+    if (connect(fd, (struct sockaddr*)&peer, peer_len) != 0) {
+        ESP_LOGW(TAG, "⚠️ UDP connect失败: errno %d", errno);
+        close(fd);
+        return false;
+    }
+    xSemaphoreTake(fd_lock_, portMAX_DELAY);
+    fd_ = fd;
+    prev_len_ = 0;
+    xSemaphoreGive(fd_lock_);
+    int64_t now = esp_timer_get_time();
+    probe_start_us_ = now;
+    next_ping_us_ = now;
+    next_report_us_ = now + (int64_t)UDP_AUDIO_REPORT_MS * 1000;
+    reasm_mask_ = 0;
+    down_synced_ = false;
+    down_recv_ = 0;
+    down_fec_ = 0;
+    lost_count_ = 0;
+    up_sent_ = 0;
+    return true;
+}
+
+void UdpAudio::closeSocket() {
+    if (fd_ < 0) {
+        return;
+    }
+    xSemaphoreTake(fd_lock_, portMAX_DELAY);
+    close(fd_);
+    fd_ = -1;
+    xSemaphoreGive(fd_lock_);
+    if (down_recv_ > 0) {
+        uint32_t expected = down_synced_ ? down_high_ - down_base_ + 1 : 0;
+        ESP_LOGI(TAG, "📡 UDP下行: 期望%lu条，收到%lu条（副本补回%lu条），上行发出%lu条",
+                 (unsigned long)expected, (unsigned long)down_recv_, (unsigned long)down_fec_,
+                 (unsigned long)up_sent_.load());
+    }
+}
+
+void UdpAudio::run() {
+    while (true) {
+        uint32_t generation = generation_.load();
+        if (!wanted_.load() || (fd_ >= 0 && generation != opened_generation_)) {
+            closeSocket();
+        }
+        if (!wanted_.load()) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+        if (fd_ < 0) {
+            opened_generation_ = generation;
+            if (!openSocket()) {
+                wanted_ = false;
+                continue;
+            }
+        }
+        int n = recv(fd_, rx_buf_, HEADER_BYTES + UDP_AUDIO_MAX_DATAGRAM, 0);
+        int64_t now = esp_timer_get_time();
+        if (n > 0) {
+            handleDatagram(rx_buf_, (size_t)n, now);
+        }
+        if (!ready_.load()) {
+            if (now - probe_start_us_ > (int64_t)UDP_AUDIO_PROBE_TIMEOUT_MS * 1000) {
+                ESP_LOGW(TAG, "⚠️ %d ms没有收到UDP PONG（可能被防火墙或NAT挡住），这次连接走WebSocket",
+                         UDP_AUDIO_PROBE_TIMEOUT_MS);
+                PerfCounters::add(PerfCounter::UDP_FALLBACKS);
+                FLIGHT_RECORD(UDP_FALLBACK, 100, 2);
+                wanted_ = false;
+                continue;
+            }
+        } else {
+            if (now >= next_report_us_) {
+                next_report_us_ = now + (int64_t)UDP_AUDIO_REPORT_MS * 1000;
+                sendReport();
+            }
+            // 上行在走UDP，服务器却一直没有报告：可能是服务器收不到了
+            if (uplinkReady() && up_sent_.load(std::memory_order_relaxed) > 0 &&
+                now - up_last_report_us_.load() > (int64_t)UDP_AUDIO_REPORT_TIMEOUT_MS * 1000) {
+                fallBackUplink(100, "收不到服务器的报告");
+            }
+        }
+        if (now >= next_ping_us_) {
+            next_ping_us_ = now + (int64_t)(ready_.load() ? UDP_AUDIO_KEEPALIVE_MS : UDP_AUDIO_PING_MS) * 1000;
+            sendPing(now);
+        }
+    }
+}
+
+void UdpAudio::sendPing(int64_t now_us) {
+    uint8_t ping[HEADER_BYTES + 4];
+    uint32_t t_ms = (uint32_t)(now_us / 1000);
+    writeHeader(ping, Kind::PING, 0x01, 0, sizeof(t_ms));
+    memcpy(ping + HEADER_BYTES, &t_ms, sizeof(t_ms));
+    ::send(fd_, ping, sizeof(ping), MSG_DONTWAIT);
+}
+
+void UdpAudio::sendReport() {
+    char lost[MAX_LOST_REPORT * 6 + 3] = "[";
+    size_t pos = 1;
+    for (size_t i = 0; i < lost_count_; i++) {
+        pos += snprintf(lost + pos, sizeof(lost) - pos, i ? ",%u" : "%u", (unsigned)lost_[i]);
+    }
+    snprintf(lost + pos, sizeof(lost) - pos, "]");
+    JsonMessage<192> msg("udp_report");
+    msg.num("expected", down_synced_ ? down_high_ - down_base_ + 1 : 0)
+        .num("recv", down_recv_)
+        .num("fec", down_fec_)
+        .raw("lost", lost)
+        .num("rtt_ms", rtt_ms_);
+    if (ws_->sendText(msg.finish(), 50) >= 0) {
+        lost_count_ = 0;
+    }
+}
+
+void UdpAudio::handleDatagram(const uint8_t* data, size_t len, int64_t now_us) {
+    Header header;
+    if (len < HEADER_BYTES) {
+        return;
+    }
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != MAGIC || header.token != token_) {
+        return;
+    }
+    const uint8_t* payload = data + HEADER_BYTES;
+    size_t payload_len = len - HEADER_BYTES;
+    if (header.kind == (uint8_t)Kind::PONG) {
+        uint32_t t_ms = 0;
+        if (payload_len >= sizeof(t_ms)) {
+            memcpy(&t_ms, payload, sizeof(t_ms));
+            rtt_ms_ = (uint32_t)(now_us / 1000) - t_ms;
+        }
+        if (!ready_.exchange(true)) {
+            up_last_report_us_ = now_us;
+            next_ping_us_ = now_us + (int64_t)UDP_AUDIO_KEEPALIVE_MS * 1000;
+            ESP_LOGI(TAG, "📡 UDP音频通道通了（RTT %lu ms），音频改走UDP", (unsigned long)rtt_ms_);
+            JsonMessage<64> ready("udp_report");
+            ready.flag("ready", true).num("rtt_ms", rtt_ms_);
+            ws_->sendText(ready.finish(), 100);
+        }
+        return;
+    }
+    if (header.kind != (uint8_t)Kind::AUDIO || header.len > payload_len || !ready_.load()) {
+        return;
+    }
+    uint8_t count = header.fragment & 0x0F;
+    if (count > 1) {
+        reassemble(header, payload);
+        return;
+    }
+    // 副本是上一条消息：先交它（主数据报丢了时正好补上缺口），再交这一条
+    if (payload_len > header.len) {
+        deliver(payload + header.len, payload_len - header.len, true);
+    }
+    deliver(payload, header.len, false);
+}
+
+void UdpAudio::reassemble(const Header& header, const uint8_t* payload) {
+    uint8_t index = header.fragment >> 4;
+    uint8_t count = header.fragment & 0x0F;
+    size_t offset = (size_t)index * FRAGMENT_BYTES;
+    bool last = index + 1 == count;
+    if (index >= count || (!last && header.len != FRAGMENT_BYTES) || offset + header.len > MAX_MESSAGE) {
+        return;
+    }
+    if (reasm_mask_ == 0 || header.msg_id != reasm_id_) {
+        // 上一条没收齐就来了新的：缺片的那条丢了，序号缺口在交下一条时算进丢失
+        reasm_id_ = header.msg_id;
+        reasm_count_ = count;
+        reasm_mask_ = 0;
+        reasm_len_ = 0;
+    }
+    memcpy(reasm_buf_ + offset, payload, header.len);
+    reasm_mask_ |= (uint16_t)(1u << index);
+    if (last) {
+        reasm_len_ = offset + header.len;
+    }
+    if (reasm_mask_ == (uint16_t)((1u << reasm_count_) - 1)) {
+        reasm_mask_ = 0;
+        deliver(reasm_buf_, reasm_len_, false);
+    }
+}
+
+void UdpAudio::deliver(const uint8_t* message, size_t len, bool redundant) {
+    AudioFraming::Header frame;
+    if (!AudioFraming::parse(message, len, &frame)) {
+        return;
+    }
+    if (!down_synced_) {
+        down_synced_ = true;
+        down_base_ = frame.seq;
+        down_high_ = frame.seq;
+    } else {
+        uint16_t diff = (uint16_t)(frame.seq - (uint16_t)down_high_);
+        if (diff == 0 || diff >= 0x8000) {
+            return;     // 重复或迟到（副本对应的那条已经到了时也在这里），JitterBuffer那边本来也会丢掉
+        }
+        if (diff > kResyncGap) {
+            down_base_ += diff;     // 服务器重新开始计数
+        } else {
+            for (uint32_t seq = down_high_ + 1; seq < down_high_ + diff; seq++) {
+                PerfCounters::add(PerfCounter::UDP_DOWN_LOST);
+                if (lost_count_ < MAX_LOST_REPORT) {
+                    lost_[lost_count_++] = (uint16_t)seq;
+                }
+            }
+        }
+        down_high_ += diff;
+    }
+    down_recv_++;
+    PerfCounters::add(PerfCounter::UDP_DOWN_MESSAGES);
+    if (redundant) {
+        down_fec_++;
+        PerfCounters::add(PerfCounter::UDP_FEC_RECOVERED);
+    }
+    on_audio_(message, len);
+}
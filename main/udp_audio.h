@@ -0,0 +1,174 @@
+/**
+ * @file udp_audio.h
+ * @brief 📡 UDP音频通道 - 两个方向的音频消息改走UDP数据报，WebSocket只留控制消息和兜底
+ *
+ * TCP按序交付：WiFi上丢一个段，重传回来之前后面所有的音频都卡在接收端的TCP缓冲区里，
+ * 两个方向都是几百毫秒的停顿。音频消息本来就带帧头（序号+时间戳，见audio_framing.h），
+ * 缺一条下行由JitterBuffer补偿、上行由中继补静音，并不需要可靠交付。
+ *
+ * 协商：hello的features带"udp"，服务器开了RELAY_UDP_PORT且协商了帧头时回复"udp":{"port":P,"token":T}。
+ * start()后接收任务每UDP_AUDIO_PING_MS往WebSocket对端的同一台主机发PING，收到PONG说明两个方向都通：
+ * 发{"type":"udp_report","ready":true}，服务器下一段回复起下行改走UDP；上行等WebSocket音频通道排空后切过去。
+ * UDP_AUDIO_PROBE_TIMEOUT_MS内不通就放弃，这次连接都走WebSocket。通了之后每UDP_AUDIO_KEEPALIVE_MS一个PING保持NAT映射。
+ *
+ * 数据报：magic(u8)=0xD7 | kind(u8) | 分片(u8，高4位序号、低4位总数) | 0 | token(u32) | 消息号(u16) | 本段长度(u16) | 载荷
+ * - AUDIO：载荷是一条完整的帧头音频消息。放得下时后面再附上一条消息的副本（UDP_AUDIO_REDUNDANCY），
+ *   单独丢一个数据报时由下一个补回来；超过UDP_AUDIO_MAX_DATAGRAM的消息按FRAGMENT_BYTES分片，缺一片整条丢掉
+ * - PING/PONG：载荷是发送时间(u32 ms)，PONG原样带回，顺便测UDP的RTT
+ *
+ * 反馈：双方每UDP_AUDIO_REPORT_MS发一次udp_report，内容是按序号算出的期望条数和实际收到的条数（RTCP接收报告的做法），
+ * 设备的报告还带新丢的下行序号，服务器把这些消息从下行额度里扣回。发送方按报告算这一段的丢失率：
+ * 连续UDP_AUDIO_FALLBACK_REPORTS段超过UDP_AUDIO_FALLBACK_LOSS_PCT、或者UDP_AUDIO_REPORT_TIMEOUT_MS没有报告，
+ * 这个方向退回WebSocket直到重连。上行丢失率同时交给UplinkRateController降Opus码率。
+ *
+ * 数据报不加密，连接是wss://时默认不提出（UDP_AUDIO_ALLOW_WITH_TLS）。
+ */
+
+#ifndef UDP_AUDIO_H
+#define UDP_AUDIO_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <string_view>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "project_config.h"
+#include "websocket_client.h"
+
+class UdpAudio {
+public:
+    static constexpr uint8_t MAGIC = 0xD7;
+    static constexpr size_t FRAGMENT_BYTES = 1024;     // 分片时除最后一片外每片的长度（和server.py一致）
+    static constexpr size_t MAX_FRAGMENTS = 15;
+    static constexpr size_t MAX_MESSAGE = FRAGMENT_BYTES * MAX_FRAGMENTS;
+    static constexpr size_t MAX_LOST_REPORT = 16;       // 一次报告最多带这么多个丢失的下行序号
+
+    enum class Kind : uint8_t { AUDIO = 0, PING = 1, PONG = 2 };
+
+    struct __attribute__((packed)) Header {
+        uint8_t magic;
+        uint8_t kind;
+        uint8_t fragment;       // 高4位：第几片，低4位：共几片（不分片是0x01）
+        uint8_t reserved;
+        uint32_t token;
+        uint16_t msg_id;
+        uint16_t len;           // 本片（不分片时是主消息）的长度，后面多出来的是上一条消息的副本
+    };
+    static_assert(sizeof(Header) == 12, "Header必须是12字节");
+    static constexpr size_t HEADER_BYTES = sizeof(Header);
+    static_assert(FRAGMENT_BYTES <= UDP_AUDIO_MAX_DATAGRAM, "分片不能比数据报大");
+
+    /**
+     * @brief 收到一条完整的下行音频消息（接收任务里调用，不能阻塞）
+     */
+    using AudioHandler = void (*)(const uint8_t* message, size_t len);
+
+    UdpAudio(WebSocketClient* ws, AudioHandler on_audio);
+
+    /**
+     * @brief 分配缓冲区、创建接收任务（任务在start()之前一直睡着）
+     */
+    esp_err_t init();
+
+    /**
+     * @brief hello回复里服务器同意了：连到WebSocket对端主机的port开始探测（事件任务）
+     */
+    void start(uint16_t port, uint32_t token);
+
+    /**
+     * @brief 连接断开或新的hello没有同意：两个方向立即回到WebSocket，接收任务关掉socket
+     */
+    void stop();
+
+    /**
+     * @brief 探测通了、上行还没有因为丢失退回WebSocket
+     */
+    bool uplinkReady() const { return ready_.load(std::memory_order_relaxed) && !up_fallback_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 发一条帧头音频消息（上行发送任务），返回len，不能发时返回-1（调用方改走WebSocket）
+     */
+    int send(const uint8_t* message, size_t len);
+
+    /**
+     * @brief 服务器的udp_report（事件任务）：按上行的期望/收到条数算丢失率，必要时退回WebSocket
+     */
+    void onReport(std::string_view text);
+
+    /**
+     * @brief 上行最近一段的丢失率（%，没走UDP时为0）
+     */
+    uint32_t uplinkLossPct() const { return uplinkReady() ? up_loss_pct_.load(std::memory_order_relaxed) : 0; }
+
+private:
+    static void rx_task(void* arg);
+    void run();
+    bool openSocket();
+    void closeSocket();
+    void handleDatagram(const uint8_t* data, size_t len, int64_t now_us);
+    void reassemble(const Header& header, const uint8_t* payload);
+    void deliver(const uint8_t* message, size_t len, bool redundant);
+    void sendPing(int64_t now_us);
+    void sendReport();
+    void fallBackUplink(uint32_t loss_pct, const char* reason);
+    void writeHeader(uint8_t* out, Kind kind, uint8_t fragment, uint16_t msg_id, uint16_t len) const;
+
+    static const char* TAG;
+    WebSocketClient* ws_;
+    AudioHandler on_audio_;
+    TaskHandle_t task_;
+    SemaphoreHandle_t fd_lock_;         // 发送任务发数据报和接收任务开关socket互斥
+    StaticSemaphore_t fd_lock_struct_;
+    portMUX_TYPE lock_;                 // 保护下面的配置和上行报告状态
+
+    // start()给的配置（事件任务写，接收任务读）
+    struct sockaddr_storage peer_;
+    socklen_t peer_len_;
+    uint32_t token_;
+    std::atomic<uint32_t> generation_;  // start()/stop()各加一，接收任务按它重开socket
+    std::atomic<bool> wanted_;
+
+    // socket（只由接收任务打开和关闭，都在fd_lock_里）
+    int fd_;
+    uint32_t opened_generation_;
+    std::atomic<bool> ready_;           // 收到过这次连接的PONG
+    int64_t probe_start_us_;
+    int64_t next_ping_us_;
+    int64_t next_report_us_;
+
+    // 上行（发送任务）
+    uint8_t* tx_buf_;
+    uint8_t* prev_msg_;                 // 上一条消息，下一个数据报附带它的副本
+    size_t prev_len_;
+    uint16_t tx_msg_id_;
+    std::atomic<uint32_t> up_sent_;
+
+    // 上行反馈（事件任务写、读，接收任务读）
+    uint32_t up_last_expected_;
+    uint32_t up_last_recv_;
+    uint32_t up_bad_reports_;
+    std::atomic<uint32_t> up_loss_pct_;
+    std::atomic<int64_t> up_last_report_us_;
+    std::atomic<bool> up_fallback_;
+
+    // 下行（只在接收任务中访问）
+    uint8_t* rx_buf_;
+    uint8_t* reasm_buf_;
+    uint16_t reasm_id_;
+    uint16_t reasm_mask_;               // 收到了哪几片
+    uint8_t reasm_count_;
+    size_t reasm_len_;                  // 最后一片到了之后的总长度（0=还不知道）
+    bool down_synced_;
+    uint32_t down_base_;                // 第一条的序号（扩展成32位）
+    uint32_t down_high_;                // 收到过的最大序号（扩展成32位）
+    uint32_t down_recv_;
+    uint32_t down_fec_;
+    uint16_t lost_[MAX_LOST_REPORT];
+    size_t lost_count_;
+    uint32_t rtt_ms_;
+};
+
+#endif // UDP_AUDIO_H
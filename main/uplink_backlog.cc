@@ -0,0 +1,116 @@
+/**
+ * @file uplink_backlog.cc
+ * @brief 📼 上行存储转发的槽位环
+ */
+
+#include "uplink_backlog.h"
+#include <string.h>
+#include "esp_log.h"
+#include "buffer_placement.h"
+#include "perf_counters.h"
+
+static const char* TAG = "UplinkBacklog";
+
+UplinkBacklog::UplinkBacklog(size_t slot_bytes, size_t slots)
+    : storage_(nullptr)
+    , meta_(nullptr)
+    , slot_bytes_(slot_bytes)
+    , slots_(slots)
+    , head_(0)
+    , count_(0)
+    , sent_(0)
+    , stats_{}
+{
+    if (slots_ == 0) {
+        return;
+    }
+    storage_ = (uint8_t*)BufferPlacement::alloc("uplink_backlog", slots_ * slot_bytes_, Placement::PSRAM);
+    meta_ = (Meta*)BufferPlacement::alloc("backlog_meta", slots_ * sizeof(Meta), Placement::PSRAM);
+    if (!storage_ || !meta_) {
+        ESP_LOGE(TAG, "❌ 存储转发缓冲区分配失败（%zu 字节），断开期间的上行音频将被丢弃", slots_ * slot_bytes_);
+        BufferPlacement::free(storage_);
+        BufferPlacement::free(meta_);
+        storage_ = nullptr;
+        meta_ = nullptr;
+        return;
+    }
+    ESP_LOGI(TAG, "📼 存储转发缓冲区: %zu 帧 × %zu 字节 (%s)", slots_, slot_bytes_, BufferPlacement::regionName(storage_));
+}
+
+UplinkBacklog::~UplinkBacklog() {
+    BufferPlacement::free(storage_);
+    BufferPlacement::free(meta_);
+}
+
+void UplinkBacklog::append(const Meta& meta, const uint8_t* data) {
+    if (count_ == slots_) {
+        // 写满了挤掉最旧的：已经发出的只是少重发一点，没发出的这段音频就丢了
+        if (sent_ > 0) {
+            sent_--;
+        } else if (meta_[head_].kind == Kind::AUDIO) {
+            stats_.dropped++;
+            PerfCounters::add(PerfCounter::UPLINK_BACKLOG_DROPS);
+        }
+        head_ = (head_ + 1) % slots_;
+        count_--;
+    }
+    size_t slot = index(count_);
+    meta_[slot] = meta;
+    if (meta.len > 0) {
+        memcpy(storage_ + slot * slot_bytes_, data, meta.len);
+    }
+    count_++;
+}
+
+void UplinkBacklog::push(const uint8_t* data, size_t len, uint32_t timestamp, uint16_t samples, UplinkCodec codec) {
+    if (!storage_ || len > slot_bytes_) {
+        return;
+    }
+    append({ timestamp, (uint16_t)len, samples, codec, Kind::AUDIO }, data);
+    stats_.stored++;
+}
+
+void UplinkBacklog::pushSpeechEnd() {
+    if (storage_) {
+        append({ 0, 0, 0, UplinkCodec::PCM, Kind::SPEECH_END }, nullptr);
+    }
+}
+
+bool UplinkBacklog::next(Entry* entry) {
+    if (sent_ >= count_) {
+        return false;
+    }
+    size_t slot = index(sent_++);
+    const Meta& meta = meta_[slot];
+    entry->data = storage_ + slot * slot_bytes_;
+    entry->len = meta.len;
+    entry->samples = meta.samples;
+    entry->timestamp = meta.timestamp;
+    entry->codec = meta.codec;
+    entry->kind = meta.kind;
+    return true;
+}
+
+void UplinkBacklog::rewind() {
+    sent_ = 0;
+}
+
+void UplinkBacklog::discardSent() {
+    head_ = index(sent_);
+    count_ -= sent_;
+    sent_ = 0;
+}
+
+void UplinkBacklog::clear() {
+    head_ = 0;
+    count_ = 0;
+    sent_ = 0;
+}
+
+uint32_t UplinkBacklog::pendingSamples() const {
+    uint32_t samples = 0;
+    for (size_t n = sent_; n < count_; n++) {
+        samples += meta_[index(n)].samples;
+    }
+    return samples;
+}
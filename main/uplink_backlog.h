@@ -0,0 +1,126 @@
+/**
+ * @file uplink_backlog.h
+ * @brief 📼 上行存储转发 - WebSocket短暂断开时继续录音，重连后整句补发
+ *
+ * 以前连接一断，发送任务就把上行帧直接丢掉，DISCONNECTED还会停止录音，
+ * WiFi抖一下用户这句话就没了。现在发送任务把每一帧先放进这里（PSRAM，固定大小的槽位环）：
+ *
+ * - 连接正常时帧立即发出，但保留到这句话结束（speech_end发出后丢弃），
+ *   因为断开后重连的是新连接、新的豆包会话，之前发过的半句话也要重发
+ * - 断开期间（以及重连后服务器hello确认之前）帧只存不发
+ * - 重连后按顺序一口气补发（比实时快，受合包器和TCP限制），帧头里的时间戳仍是录音时钟，
+ *   服务器按时间戳拼接，中间被挤掉的帧由服务器补静音（见uplink_coalescer.h的FLAG_DISCONTINUITY）
+ * - 写满（超过UPLINK_BACKLOG_MS）时丢最旧的帧：还没发出去的计入dropped
+ *
+ * speech_end标记也按顺序存进来，补发到它时才通知服务器结束识别。
+ * 只在上行发送任务中使用，内部不加锁。
+ */
+
+#ifndef UPLINK_BACKLOG_H
+#define UPLINK_BACKLOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "audio_codec.h"
+
+class UplinkBacklog {
+public:
+    enum class Kind : uint8_t {
+        AUDIO,
+        SPEECH_END,     // 一句话说完（补发完前面的音频后发speech_end）
+    };
+
+    struct Entry {
+        const uint8_t* data;
+        uint16_t len;
+        uint16_t samples;
+        uint32_t timestamp;
+        UplinkCodec codec;      // 录音时的编码格式，和重连后协商的不一致时不能补发
+        Kind kind;
+    };
+
+    struct Stats {
+        uint32_t stored;        // 存入的音频帧
+        uint32_t dropped;       // 写满时被挤掉、没来得及发出去的帧
+        uint32_t skipped;       // 编码格式和新连接不一致、放弃补发的帧
+    };
+
+    /**
+     * @param slot_bytes 单帧最大字节数（帧池的槽位大小）
+     * @param slots 槽位数，0=关闭（isValid()返回false，调用方退回断开即丢弃）
+     */
+    UplinkBacklog(size_t slot_bytes, size_t slots);
+    ~UplinkBacklog();
+
+    UplinkBacklog(const UplinkBacklog&) = delete;
+    UplinkBacklog& operator=(const UplinkBacklog&) = delete;
+
+    bool isValid() const { return storage_ != nullptr; }
+
+    /**
+     * @brief 存入一帧（超过slot_bytes的帧丢弃）
+     */
+    void push(const uint8_t* data, size_t len, uint32_t timestamp, uint16_t samples, UplinkCodec codec);
+
+    /**
+     * @brief 存入speech_end标记
+     */
+    void pushSpeechEnd();
+
+    /**
+     * @brief 取出下一条还没发出的记录，data在下一次push之前有效
+     */
+    bool next(Entry* entry);
+
+    bool hasPending() const { return sent_ < count_; }
+
+    /**
+     * @brief 连接断开：保留的记录全部重新算作未发送
+     */
+    void rewind();
+
+    /**
+     * @brief 丢掉已经发出的记录（这句话的speech_end发出之后）
+     */
+    void discardSent();
+
+    /**
+     * @brief 全部丢弃（录音停止）
+     */
+    void clear();
+
+    /**
+     * @brief 记一次放弃补发的帧
+     */
+    void noteSkipped() { stats_.skipped++; }
+
+    /**
+     * @brief 还没发出的音频时长（样本数）
+     */
+    uint32_t pendingSamples() const;
+
+    const Stats& getStats() const { return stats_; }
+
+private:
+    struct Meta {
+        uint32_t timestamp;
+        uint16_t len;
+        uint16_t samples;
+        UplinkCodec codec;
+        Kind kind;
+    };
+
+    void append(const Meta& meta, const uint8_t* data);
+    size_t index(size_t n) const { return (head_ + n) % slots_; }
+
+    uint8_t* storage_;          // slots_ * slot_bytes_，PSRAM
+    Meta* meta_;
+    size_t slot_bytes_;
+    size_t slots_;
+    size_t head_;               // 最旧的记录
+    size_t count_;
+    size_t sent_;               // 从head_起已经发出的记录数
+    Stats stats_;
+};
+
+#endif // UPLINK_BACKLOG_H
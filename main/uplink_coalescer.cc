@@ -0,0 +1,130 @@
+/**
+ * @file uplink_coalescer.cc
+ * @brief 📦 上行音频合包器实现
+ */
+
+#include "uplink_coalescer.h"
+#include <string.h>
+#include "esp_log.h"
+#include "log_throttle.h"
+#include "buffer_placement.h"
+
+const char* UplinkCoalescer::TAG = "Coalescer";
+
+UplinkCoalescer::UplinkCoalescer(size_t max_bytes, uint32_t max_delay_ms, SendFunc send)
+    : buffer_(nullptr)
+    , capacity_(max_bytes)
+    , length_(0)
+    , max_delay_ticks_(pdMS_TO_TICKS(max_delay_ms))
+    , first_frame_tick_(0)
+    , send_(send)
+    , framing_(false)
+    , codec_(AudioFraming::Codec::PCM)
+    , seq_(0)
+    , first_timestamp_(0)
+    , next_timestamp_(0)
+    , samples_(0)
+    , frames_(0)
+    , max_frames_(0)
+    , flags_(0)
+    , has_position_(false)
+{
+    buffer_ = (uint8_t*)BufferPlacement::alloc("uplink_coalescer", AudioFraming::HEADER_BYTES + capacity_, Placement::INTERNAL);
+    if (!buffer_) {
+        ESP_LOGE(TAG, "❌ 合包缓冲区分配失败，将逐帧发送");
+        capacity_ = 0;
+    }
+}
+
+UplinkCoalescer::~UplinkCoalescer() {
+    BufferPlacement::free(buffer_);
+}
+
+void UplinkCoalescer::setFraming(bool enable, AudioFraming::Codec codec) {
+    if (enable == framing_ && codec == codec_) {
+        return;
+    }
+    flush();
+    framing_ = enable;
+    codec_ = codec;
+    seq_ = 0;
+    has_position_ = false;
+}
+
+void UplinkCoalescer::setMaxFrames(uint8_t max_frames) {
+    max_frames_ = max_frames;
+    if (max_frames_ > 0 && frames_ >= max_frames_) {
+        flush();
+    }
+}
+
+void UplinkCoalescer::push(const uint8_t* data, size_t len, uint32_t timestamp, uint16_t samples) {
+    // 缓冲区不可用或单帧超过上限时直接发送
+    if (len > capacity_) {
+        flush();
+        send_(data, len);
+        return;
+    }
+
+    // 不跨缺口合包：帧头只有一个时间戳
+    bool contiguous = has_position_ && timestamp == next_timestamp_;
+    if (length_ + len > capacity_ || (length_ > 0 && !contiguous)) {
+        flush();
+    }
+
+    if (length_ == 0) {
+        first_frame_tick_ = xTaskGetTickCount();
+        first_timestamp_ = timestamp;
+        samples_ = 0;
+        frames_ = 0;
+        if (!has_position_ || (int32_t)(timestamp - next_timestamp_) < 0) {
+            flags_ |= AudioFraming::FLAG_START;             // 新的一次录音
+        } else if (!contiguous) {
+            flags_ |= AudioFraming::FLAG_DISCONTINUITY;     // 录音任务丢过帧
+        }
+    }
+    memcpy(buffer_ + AudioFraming::HEADER_BYTES + length_, data, len);
+    length_ += len;
+    samples_ += samples;
+    frames_++;
+    next_timestamp_ = timestamp + samples;
+    has_position_ = true;
+
+    if (length_ == capacity_ || (max_frames_ > 0 && frames_ >= max_frames_)) {
+        flush();
+    }
+}
+
+void UplinkCoalescer::flush() {
+    if (length_ == 0) {
+        return;
+    }
+    int sent;
+    if (framing_) {
+        AudioFraming::write(buffer_, codec_, seq_++, first_timestamp_, samples_, flags_);
+        sent = send_(buffer_, AudioFraming::HEADER_BYTES + length_);
+    } else {
+        sent = send_(buffer_ + AudioFraming::HEADER_BYTES, length_);
+    }
+    flags_ = 0;
+    if (sent < 0) {
+        HOT_LOGW(TAG, "⚠️ 发送合并音频失败: %zu 字节", length_);
+    } else {
+        HOT_LOGD(TAG, "发送合并音频: %zu 字节", length_);
+    }
+    length_ = 0;
+}
+
+void UplinkCoalescer::poll() {
+    if (length_ > 0 && ticksUntilDeadline() == 0) {
+        flush();
+    }
+}
+
+TickType_t UplinkCoalescer::ticksUntilDeadline() const {
+    if (length_ == 0) {
+        return portMAX_DELAY;
+    }
+    TickType_t elapsed = xTaskGetTickCount() - first_frame_tick_;
+    return elapsed >= max_delay_ticks_ ? 0 : max_delay_ticks_ - elapsed;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file uplink_coalescer.h
+ * @brief 📦 上行音频合包器 - 把多个20ms小帧合并成一条WebSocket消息
+ *
+ * 每帧单独发送意味着每帧都有自己的WS头、TCP报文和服务器端处理开销。
+ * 合包器按帧数或延迟预算（先到为准）攒包，说话结束时立即冲刷。
+ *
+ * 每条消息的帧数上限可以运行时调小（上行码率自适应在差链路上多合几帧、好链路上逐帧发，
+ * 见uplink_rate_controller.h），字节上限仍然是构造时的缓冲区大小。
+ *
+ * 协商了音频帧头时（见audio_framing.h），每条合并后的消息前面写一个帧头：
+ * 缓冲区前面预留了帧头的位置，发送时不需要再拷贝一次。时间戳不连续（录音任务丢过帧）时
+ * 先把已攒的发出去，缺口之后的帧另起一条消息并带FLAG_DISCONTINUITY，服务器据此补齐时长。
+ */
+
+#ifndef UPLINK_COALESCER_H
+#define UPLINK_COALESCER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <functional>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "audio_framing.h"
+
+class UplinkCoalescer {
+public:
+    /**
+     * @brief 发送函数类型，返回发送的字节数，-1=失败
+     */
+    using SendFunc = std::function<int(const uint8_t*, size_t)>;
+
+    /**
+     * @brief 创建合包器
+     *
+     * @param max_bytes 单条消息最大字节数（达到后立即发送）
+     * @param max_delay_ms 第一帧进入后最多等待的时间
+     * @param send 实际发送函数（通常是WebSocketClient::sendAudio）
+     */
+    UplinkCoalescer(size_t max_bytes, uint32_t max_delay_ms, SendFunc send);
+    ~UplinkCoalescer();
+
+    /**
+     * @brief 追加一帧数据，攒满时自动发送
+     *
+     * @param timestamp 这一帧第一个样本的录音时钟位置
+     * @param samples 这一帧的样本数
+     */
+    void push(const uint8_t* data, size_t len, uint32_t timestamp, uint16_t samples);
+
+    /**
+     * @brief 打开/关闭帧头（hello协商后由发送任务调用；重新打开时序号从0开始）
+     *
+     * 合包缓冲区分配失败时逐帧直接发送，不带帧头。
+     */
+    void setFraming(bool enable, AudioFraming::Codec codec);
+
+    /**
+     * @brief 立即发送已攒的数据（说话结束时调用）
+     */
+    void flush();
+
+    /**
+     * @brief 丢弃已攒的数据（连接断开时调用）
+     */
+    void reset() { length_ = 0; has_position_ = false; }
+
+    /**
+     * @brief 调整延迟预算（按测得的RTT调整，只在发送任务中调用）
+     */
+    void setMaxDelay(uint32_t max_delay_ms) { max_delay_ticks_ = pdMS_TO_TICKS(max_delay_ms); }
+
+    /**
+     * @brief 调整每条消息最多合并的帧数（0=只看字节上限，只在发送任务中调用）
+     */
+    void setMaxFrames(uint8_t max_frames);
+
+    /**
+     * @brief 延迟预算到期则发送
+     */
+    void poll();
+
+    /**
+     * @brief 距离延迟预算到期还有多少tick，没有数据时返回portMAX_DELAY
+     */
+    TickType_t ticksUntilDeadline() const;
+
+private:
+    static const char* TAG;
+
+    uint8_t* buffer_;               // 前HEADER_BYTES字节留给帧头
+    size_t capacity_;               // 不含帧头
+    size_t length_;
+    TickType_t max_delay_ticks_;
+    TickType_t first_frame_tick_;
+    SendFunc send_;
+
+    bool framing_;
+    AudioFraming::Codec codec_;
+    uint16_t seq_;
+    uint32_t first_timestamp_;      // 已攒数据的第一个样本
+    uint32_t next_timestamp_;       // 上一帧之后的位置
+    uint16_t samples_;
+    uint8_t frames_;                // 已攒的帧数
+    uint8_t max_frames_;
+    uint16_t flags_;                // 下一条消息的帧头标志
+    bool has_position_;             // reset之后还没有收到过帧
+};
+
+#endif // UPLINK_COALESCER_H
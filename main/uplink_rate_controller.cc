@@ -0,0 +1,109 @@
+/**
+ * @file uplink_rate_controller.cc
+ * @brief 📶 上行码率自适应实现
+ */
+
+#include "uplink_rate_controller.h"
+#include "esp_log.h"
+#include "perf_counters.h"
+#include "project_config.h"
+
+const char* UplinkRateController::TAG = "UplinkRate";
+
+// 从低到高；超出UPLINK_RATE_MIN_BPS~UPLINK_RATE_MAX_BPS的档位不用。
+// 合包器的字节上限和延迟预算照常生效，帧数只能比UPLINK_COALESCE_FRAMES少
+static const UplinkRateController::Level kLevels[] = {
+    {12000, UPLINK_COALESCE_FRAMES},
+    {16000, UPLINK_COALESCE_FRAMES},
+    {24000, UPLINK_COALESCE_FRAMES},
+    {32000, UPLINK_COALESCE_FRAMES > 1 ? UPLINK_COALESCE_FRAMES - 1 : 1},
+};
+static constexpr int kLevelCount = sizeof(kLevels) / sizeof(kLevels[0]);
+
+static int lowest_level() {
+    for (int i = 0; i < kLevelCount; i++) {
+        if (kLevels[i].bitrate >= UPLINK_RATE_MIN_BPS) {
+            return i;
+        }
+    }
+    return kLevelCount - 1;
+}
+
+static int highest_level() {
+    for (int i = kLevelCount - 1; i > 0; i--) {
+        if (kLevels[i].bitrate <= UPLINK_RATE_MAX_BPS) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+UplinkRateController::UplinkRateController()
+    : index_(0)
+    , default_index_(0)
+    , bad_checks_(0)
+    , good_checks_(0)
+    , turn_kbps_sum_(0)
+    , turn_frames_(0)
+{
+    // 默认档位：不超过UPLINK_OPUS_BITRATE的最高一档
+    for (int i = lowest_level(); i <= highest_level(); i++) {
+        if (kLevels[i].bitrate <= UPLINK_OPUS_BITRATE) {
+            default_index_ = i;
+        }
+    }
+    if (default_index_ < lowest_level()) {
+        default_index_ = lowest_level();
+    }
+    index_ = default_index_;
+}
+
+void UplinkRateController::reset() {
+    index_ = default_index_;
+    bad_checks_ = 0;
+    good_checks_ = 0;
+}
+
+bool UplinkRateController::update(const Sample& sample) {
+    bool bad = sample.srtt_ms > UPLINK_RATE_RTT_HIGH_MS || sample.queue_pct > UPLINK_RATE_QUEUE_HIGH_PCT ||
+               sample.send_wait_ms > UPLINK_RATE_WAIT_HIGH_MS || sample.loss_pct > UPLINK_RATE_LOSS_HIGH_PCT;
+    bool good = sample.srtt_ms < UPLINK_RATE_RTT_HIGH_MS / 2 && sample.queue_pct < UPLINK_RATE_QUEUE_HIGH_PCT / 2 &&
+                sample.send_wait_ms < UPLINK_RATE_WAIT_HIGH_MS / 2 && sample.loss_pct < UPLINK_RATE_LOSS_HIGH_PCT / 2;
+    bad_checks_ = bad ? bad_checks_ + 1 : 0;
+    good_checks_ = good ? good_checks_ + 1 : 0;
+
+    int next = index_;
+    if (bad_checks_ >= UPLINK_RATE_DOWN_CHECKS && index_ > lowest_level()) {
+        next = index_ - 1;
+        PerfCounters::add(PerfCounter::UPLINK_RATE_DOWN);
+    } else if (good_checks_ >= UPLINK_RATE_UP_CHECKS && index_ < highest_level()) {
+        next = index_ + 1;
+        PerfCounters::add(PerfCounter::UPLINK_RATE_UP);
+    }
+    if (next == index_) {
+        return false;
+    }
+    ESP_LOGI(TAG, "📶 上行 %lu -> %lu bit/s，每条%u帧（RTT %lu ms，队列%lu%%，发送等待%lu ms，丢失%lu%%）",
+             (unsigned long)kLevels[index_].bitrate, (unsigned long)kLevels[next].bitrate,
+             (unsigned)kLevels[next].frames, (unsigned long)sample.srtt_ms, (unsigned long)sample.queue_pct,
+             (unsigned long)sample.send_wait_ms, (unsigned long)sample.loss_pct);
+    index_ = next;
+    bad_checks_ = 0;
+    good_checks_ = 0;
+    return true;
+}
+
+const UplinkRateController::Level& UplinkRateController::level() const {
+    return kLevels[index_];
+}
+
+void UplinkRateController::noteFrame() {
+    turn_kbps_sum_.fetch_add(kLevels[index_].bitrate / 1000, std::memory_order_relaxed);
+    turn_frames_.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint32_t UplinkRateController::takeTurnKbps() {
+    uint32_t frames = turn_frames_.exchange(0);
+    uint32_t sum = turn_kbps_sum_.exchange(0);
+    return frames > 0 ? sum / frames : 0;
+}
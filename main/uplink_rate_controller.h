@@ -0,0 +1,76 @@
+/**
+ * @file uplink_rate_controller.h
+ * @brief 📶 上行码率自适应 - 按RTT、发送队列积压和WebSocket发送等待调整Opus码率和每条消息的帧数
+ *
+ * 固定码率在好链路上白占空口，在差链路上s_audio_send_queue和WebSocket发送队列会积压、最后丢帧。
+ * 发送任务每UPLINK_RATE_CHECK_MS评估一次，在一张从低到高的档位表里上下移动：
+ * - 降档：RTT、队列占用、发送等待（上行走UDP时还有服务器报告的丢失率，见udp_audio.h）任一超过上限，连续UPLINK_RATE_DOWN_CHECKS次（很快，丢帧之前就让出带宽）
+ * - 升档：各项都低于上限的一半，连续UPLINK_RATE_UP_CHECKS次（慢，避免在临界链路上来回跳）
+ * - 两者之间：保持当前档位，两个计数都清零（滞后带）
+ *
+ * 低档位码率低、每条消息合并满UPLINK_COALESCE_FRAMES帧（消息头的开销摊薄，发送队列里的条数少）；
+ * 最高一档链路宽松，少合一帧换更低的上行延迟。Opus的帧时长是整个音频管线的帧时钟（AUDIO_FRAME_MS），
+ * 不能运行时改，这里调的是每条WebSocket消息的帧数。
+ * 只在上行是Opus时有意义（PCM的码率是固定的）。每轮对话的平均码率随turn trace上报（"up_kbps"）。
+ */
+
+#ifndef UPLINK_RATE_CONTROLLER_H
+#define UPLINK_RATE_CONTROLLER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+class UplinkRateController {
+public:
+    /**
+     * @brief 一次评估的输入（由发送任务采集）
+     */
+    struct Sample {
+        uint32_t srtt_ms;           // 心跳测得的平滑RTT（0=还没测到）
+        uint32_t queue_pct;         // s_audio_send_queue和WebSocket音频通道里占用较高的那个（%）
+        uint32_t send_wait_ms;      // 最近一条上行消息在WebSocket发送队列里的等待
+        uint32_t loss_pct;          // 上行走UDP时最近一段的丢失率（走WebSocket时为0）
+    };
+
+    struct Level {
+        uint32_t bitrate;           // Opus目标码率（bit/s）
+        uint8_t frames;             // 每条消息最多合并的帧数
+    };
+
+    UplinkRateController();
+
+    /**
+     * @brief 新连接：回到默认档位（UPLINK_OPUS_BITRATE对应的那一档）
+     */
+    void reset();
+
+    /**
+     * @brief 评估一次，档位变了返回true
+     */
+    bool update(const Sample& sample);
+
+    const Level& level() const;
+
+    /**
+     * @brief 发出一帧Opus时调用，按当前码率累计本轮的平均值
+     */
+    void noteFrame();
+
+    /**
+     * @brief 取出本轮上行的平均码率（kbit/s，0=本轮没有Opus帧）并清零，可以在其他任务中调用
+     */
+    uint32_t takeTurnKbps();
+
+private:
+    static const char* TAG;
+
+    int index_;
+    int default_index_;
+    uint32_t bad_checks_;
+    uint32_t good_checks_;
+    std::atomic<uint32_t> turn_kbps_sum_;
+    std::atomic<uint32_t> turn_frames_;
+};
+
+#endif // UPLINK_RATE_CONTROLLER_H
@@ -0,0 +1,74 @@
+/**
+ * @file upload_scheduler.cc
+ * @brief 🚚 后台上传调度实现
+ */
+
+#include "upload_scheduler.h"
+#include "esp_log.h"
+#include "perf_counters.h"
+#include "project_config.h"
+
+const char* UploadScheduler::TAG = "UploadSched";
+
+UploadScheduler::UploadScheduler()
+    : wake_paused_(false)
+    , session_active_(false)
+    , wake_us_(0)
+    , refill_us_(0)
+    , tokens_(UPLOAD_BURST_BYTES)
+    , last_ready_(true)
+{
+}
+
+void UploadScheduler::setSessionActive(bool active) {
+    if (session_active_ && !active && wake_paused_.exchange(false, std::memory_order_relaxed)) {
+        ESP_LOGD(TAG, "会话结束，恢复后台上传");
+    }
+    session_active_ = active;
+}
+
+void UploadScheduler::onWake(int64_t now_us) {
+    wake_us_ = now_us;
+    wake_paused_.store(true, std::memory_order_relaxed);
+}
+
+bool UploadScheduler::paused(int64_t now_us) {
+    if (!wake_paused_.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    if (now_us - wake_us_ >= (int64_t)UPLOAD_WAKE_PAUSE_MAX_MS * 1000) {
+        wake_paused_.store(false, std::memory_order_relaxed);     // 一直没有回复，不能永远不传
+        return false;
+    }
+    return true;
+}
+
+void UploadScheduler::refill(int64_t now_us) {
+    uint32_t rate = session_active_ ? UPLOAD_SESSION_BYTES_PER_SEC : UPLOAD_IDLE_BYTES_PER_SEC;
+    int64_t elapsed_us = now_us - refill_us_;
+    if (elapsed_us <= 0) {
+        return;
+    }
+    int64_t earned = elapsed_us * rate / 1000000;
+    if (earned == 0 && rate > 0) {
+        return;     // 不到一个字节先不动refill_us_，零头留到下一次
+    }
+    refill_us_ = now_us;
+    int64_t tokens = tokens_ + earned;
+    tokens_ = (int32_t)(tokens > UPLOAD_BURST_BYTES ? UPLOAD_BURST_BYTES : tokens);
+}
+
+bool UploadScheduler::ready(int64_t now_us) {
+    refill(now_us);
+    bool ok = tokens_ > 0 && !paused(now_us) && !(session_active_ && UPLOAD_SESSION_BYTES_PER_SEC == 0);
+    if (last_ready_ && !ok) {
+        PerfCounters::add(PerfCounter::UPLOAD_DEFERRALS);
+    }
+    last_ready_ = ok;
+    return ok;
+}
+
+void UploadScheduler::charge(size_t bytes) {
+    tokens_ -= (int32_t)bytes;
+    PerfCounters::add(PerfCounter::UPLOAD_BYTES, bytes);
+}
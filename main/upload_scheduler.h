@@ -0,0 +1,73 @@
+/**
+ * @file upload_scheduler.h
+ * @brief 🚚 后台上传调度 - 统计、黑匣子这类维护流量只在空闲或发送队列的后台通道有空时发，按令牌桶限速
+ *
+ * 定时统计、作用域计时、跨重启累计、复位前的黑匣子记录原来都走控制通道，和额度、打断排在一起，
+ * 恰好赶上唤醒后的第一句话时会把上行音频和首包回复往后推。现在它们都先问一下调度器：
+ *
+ * - 空闲时按UPLOAD_IDLE_BYTES_PER_SEC限速，会话进行中按UPLOAD_SESSION_BYTES_PER_SEC（0=会话中不发）
+ * - 桶深UPLOAD_BURST_BYTES；发完再扣（可以扣成负数，下一条要等还清），所以一条消息不必小于桶深
+ * - 唤醒时暂停，直到第一条下行音频到了、会话结束、或者过了UPLOAD_WAKE_PAUSE_MAX_MS：
+ *   这一段是延迟最敏感的；暂停期间WebSocket后台通道里已经入队的消息也不发（WebSocketClient::setBulkPaused）
+ *
+ * 被推迟的上传留到下一轮主循环再问（不丢弃），每次由放行变成推迟记一次UPLOAD_DEFERRALS。
+ * onReplyStart()在WebSocket或UDP接收任务中调用，其余只在主任务中调用。
+ */
+
+#ifndef UPLOAD_SCHEDULER_H
+#define UPLOAD_SCHEDULER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+class UploadScheduler {
+public:
+    UploadScheduler();
+
+    /**
+     * @brief 会话进行中/回到空闲（主循环每轮调用），回到空闲时解除唤醒暂停
+     */
+    void setSessionActive(bool active);
+
+    /**
+     * @brief 检测到唤醒，暂停到第一条回复
+     */
+    void onWake(int64_t now_us);
+
+    /**
+     * @brief 第一条下行音频到了（接收任务）
+     */
+    void onReplyStart() { wake_paused_.store(false, std::memory_order_relaxed); }
+
+    /**
+     * @brief 唤醒暂停中（主循环据此暂停WebSocket后台通道）
+     */
+    bool paused(int64_t now_us);
+
+    /**
+     * @brief 现在可以发一条维护消息
+     */
+    bool ready(int64_t now_us);
+
+    /**
+     * @brief 发出去了多少字节（入队成功后调用）
+     */
+    void charge(size_t bytes);
+
+private:
+    static const char* TAG;
+
+    void refill(int64_t now_us);
+
+    std::atomic<bool> wake_paused_;
+
+    // 以下只在主任务中访问
+    bool session_active_;
+    int64_t wake_us_;
+    int64_t refill_us_;
+    int32_t tokens_;            // 可以是负数（上一条超出的部分）
+    bool last_ready_;
+};
+
+#endif // UPLOAD_SCHEDULER_H
@@ -0,0 +1,77 @@
+/**
+ * @file vad_gate.cc
+ * @brief 🚪 VAD门控实现
+ */
+
+#include "vad_gate.h"
+#include "realtime_audio.h"
+
+VadGate::VadGate(uint32_t sample_rate, uint32_t preroll_ms, uint32_t hangover_ms)
+    : preroll_("vad_preroll", Placement::INTERNAL)
+    , preroll_samples_(sample_rate * preroll_ms / 1000)
+    , hangover_samples_(sample_rate * hangover_ms / 1000)
+    , hangover_left_(0)
+    , open_(false)
+{
+    if (preroll_samples_ > PrerollRing::capacity()) {
+        preroll_samples_ = PrerollRing::capacity();
+    }
+}
+
+void VadGate::reset() {
+    open_ = false;
+    hangover_left_ = 0;
+    preroll_.clear();
+}
+
+void AUDIO_HOT_IRAM VadGate::pushPreroll(const int16_t* samples, size_t count) {
+    if (preroll_samples_ == 0 || !preroll_.isValid()) {
+        return;
+    }
+    if (count > preroll_samples_) {
+        samples += count - preroll_samples_;
+        count = preroll_samples_;
+    }
+    // 读写都在同一个任务里，直接丢掉最旧的数据腾出空间
+    size_t used = preroll_.size();
+    if (used + count > preroll_samples_) {
+        preroll_.commitRead(used + count - preroll_samples_);
+    }
+    preroll_.write(samples, count);
+}
+
+VadGate::Event VadGate::process(const int16_t* samples, size_t count, bool is_speech, const OutputFunc& output) {
+    if (!open_) {
+        if (!is_speech) {
+            pushPreroll(samples, count);
+            return Event::NONE;
+        }
+
+        // 🗣️ 开门：先补发预录内容
+        open_ = true;
+        hangover_left_ = hangover_samples_;
+        while (preroll_.size() > 0) {
+            PrerollRing::Span<const int16_t> span = preroll_.readSpan();
+            output(span.data, span.count);
+            preroll_.commitRead(span.count);
+        }
+        output(samples, count);
+        return Event::SPEECH_START;
+    }
+
+    output(samples, count);
+
+    if (is_speech) {
+        hangover_left_ = hangover_samples_;
+        return Event::NONE;
+    }
+
+    // 🤫 静音：拖尾计时
+    if (hangover_left_ > count) {
+        hangover_left_ -= count;
+        return Event::NONE;
+    }
+    open_ = false;
+    hangover_left_ = 0;
+    return Event::SPEECH_END;
+}
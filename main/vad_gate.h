@@ -0,0 +1,71 @@
+/**
+ * @file vad_gate.h
+ * @brief 🚪 VAD门控 - 只把说话的那部分音频送进上行链路
+ *
+ * 门关着的时候，音频只进入一个很短的预录（pre-roll）环形缓冲区；
+ * VAD判定开始说话时先补发预录内容，找回被VAD判定延迟截掉的字头；
+ * 说话停止后再保持一段拖尾（hangover），避免句中短暂停顿把一句话切断。
+ * 拖尾结束时返回SPEECH_END，调用方据此通知服务器提前结束这一轮识别。
+ *
+ * 只在一个任务中调用（音频前端的fetch任务），内部不加锁。
+ */
+
+#ifndef VAD_GATE_H
+#define VAD_GATE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <functional>
+#include "spsc_ring.h"
+
+class VadGate {
+public:
+    enum class Event {
+        NONE,
+        SPEECH_START,   // 门打开（预录内容已经输出）
+        SPEECH_END,     // 拖尾结束，门关闭
+    };
+
+    // 通过门控的音频输出函数
+    using OutputFunc = std::function<void(const int16_t* samples, size_t count)>;
+
+    /**
+     * @brief 创建VAD门控
+     *
+     * @param sample_rate 采样率
+     * @param preroll_ms 开门时补发的预录时长（上限约500ms）
+     * @param hangover_ms VAD判定静音后继续放行的时长
+     */
+    VadGate(uint32_t sample_rate, uint32_t preroll_ms, uint32_t hangover_ms);
+
+    /**
+     * @brief 处理一块音频
+     *
+     * @param samples 音频样本
+     * @param count 样本数
+     * @param is_speech 这一块的VAD结果
+     * @param output 放行的音频通过它输出
+     * @return 本次处理产生的门控事件
+     */
+    Event process(const int16_t* samples, size_t count, bool is_speech, const OutputFunc& output);
+
+    /**
+     * @brief 关门并丢弃预录内容（新一轮录音开始前调用）
+     */
+    void reset();
+
+    bool isOpen() const { return open_; }
+
+private:
+    using PrerollRing = SpscRing<int16_t, 8192>;
+
+    void pushPreroll(const int16_t* samples, size_t count);
+
+    PrerollRing preroll_;
+    size_t preroll_samples_;
+    size_t hangover_samples_;
+    size_t hangover_left_;
+    bool open_;
+};
+
+#endif // VAD_GATE_H
@@ -0,0 +1,79 @@
+/**
+ * @file wake_settings.cc
+ * @brief 🎯 唤醒词参数的NVS读写
+ */
+
+#include "wake_settings.h"
+#include <string.h>
+#include "esp_log.h"
+#include "nvs.h"
+#include "project_config.h"
+
+static const char* TAG = "WakeSettings";
+static const char* NVS_NAMESPACE = "wake";
+
+// 阈值按万分比存成u32，避免依赖浮点blob的二进制布局
+static const char* const kThresholdKeys[WakeSettings::MAX_MODELS] = { "thr1", "thr2" };
+static const char* const kModelKeys[WakeSettings::MAX_MODELS] = { "model1", "model2" };
+
+WakeSettings::WakeSettings()
+    : mode(WAKENET_DET_MODE)
+    , threshold{ WAKENET_THRESHOLD, WAKENET_THRESHOLD_2 }
+    , model{ WAKENET_MODEL, WAKENET_MODEL_2 }
+{
+}
+
+esp_err_t WakeSettings::load() {
+    nvs_handle_t nvs;
+    esp_err_t ret = nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs);
+    if (ret != ESP_OK) {
+        return ret;     // 从没保存过时命名空间不存在，使用默认值
+    }
+
+    uint8_t saved_mode = 0;
+    if (nvs_get_u8(nvs, "mode", &saved_mode) == ESP_OK) {
+        mode = saved_mode == 95 ? DET_MODE_95 : DET_MODE_90;
+    }
+    for (int i = 0; i < MAX_MODELS; i++) {
+        uint32_t permyriad = 0;
+        if (nvs_get_u32(nvs, kThresholdKeys[i], &permyriad) == ESP_OK && validThreshold(permyriad / 10000.0f)) {
+            threshold[i] = permyriad / 10000.0f;
+        }
+        size_t len = MODEL_NAME_LEN;
+        char name[MODEL_NAME_LEN];
+        if (nvs_get_str(nvs, kModelKeys[i], name, &len) == ESP_OK) {
+            memcpy(model[i], name, MODEL_NAME_LEN);
+        }
+    }
+    nvs_close(nvs);
+
+    ESP_LOGI(TAG, "✓ 已读取唤醒词参数: 模式=%d, 阈值=%.4f/%.4f, 模型='%s'/'%s'",
+             modePercent(), threshold[0], threshold[1], model[0], model[1]);
+    return ESP_OK;
+}
+
+esp_err_t WakeSettings::save() const {
+    nvs_handle_t nvs;
+    esp_err_t ret = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ 打开NVS失败: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    ret = nvs_set_u8(nvs, "mode", (uint8_t)modePercent());
+    for (int i = 0; i < MAX_MODELS && ret == ESP_OK; i++) {
+        ret = nvs_set_u32(nvs, kThresholdKeys[i], (uint32_t)(threshold[i] * 10000.0f + 0.5f));
+        if (ret == ESP_OK) {
+            ret = nvs_set_str(nvs, kModelKeys[i], model[i]);
+        }
+    }
+    if (ret == ESP_OK) {
+        ret = nvs_commit(nvs);
+    }
+    nvs_close(nvs);
+
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ 保存唤醒词参数失败: %s", esp_err_to_name(ret));
+    }
+    return ret;
+}
@@ -0,0 +1,51 @@
+/**
+ * @file wake_settings.h
+ * @brief 🎯 唤醒词参数 - 检测模式、阈值和模型选择，保存在NVS里，不用重新烧录就能按现场调整
+ *
+ * 默认值来自project_config.h（WAKENET_*），load()用NVS中保存的值覆盖。
+ * 服务器可以发{"type":"wake_config",...}修改：
+ * - threshold/threshold2：两个模型的检测阈值（0.4~0.9999，0=模型默认），立即生效
+ * - mode：90或95（DET_MODE_90误唤醒少，DET_MODE_95更灵敏）
+ * - model/model2：模型名（model2为空=只用一个模型，"*"=分区里的另一个唤醒词模型）
+ * 模式和模型在创建AFE时确定，保存后下次启动生效。
+ */
+
+#ifndef WAKE_SETTINGS_H
+#define WAKE_SETTINGS_H
+
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_wn_iface.h"
+
+struct WakeSettings {
+    static constexpr int MAX_MODELS = 2;          // AFE最多同时运行两个WakeNet
+    static constexpr size_t MODEL_NAME_LEN = 32;  // 和模型目录里的名称长度一致
+
+    det_mode_t mode;
+    float threshold[MAX_MODELS];                  // 0=使用模型自带的阈值
+    char model[MAX_MODELS][MODEL_NAME_LEN];
+
+    WakeSettings();
+
+    /**
+     * @brief 从NVS读取（没有保存过的项保持默认值）
+     */
+    esp_err_t load();
+
+    /**
+     * @brief 写入NVS
+     */
+    esp_err_t save() const;
+
+    /**
+     * @brief 检测模式的百分比写法（90/95），用于日志和上报
+     */
+    int modePercent() const { return mode == DET_MODE_95 ? 95 : 90; }
+
+    /**
+     * @brief 阈值是否在esp-sr接受的范围内（0表示恢复默认，也是合法值）
+     */
+    static bool validThreshold(float threshold) { return threshold == 0.0f || (threshold >= 0.4f && threshold < 1.0f); }
+};
+
+#endif // WAKE_SETTINGS_H
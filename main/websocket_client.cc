@@ -13,23 +13,181 @@
 
 #include "websocket_client.h"
 #include "esp_log.h"
+#include "log_throttle.h"
+#include "buffer_placement.h"
+#include "json_message.h"
+#include "flight_recorder.h"
+#include "perf_counters.h"
+#include "project_config.h"
+#include "sched_trace.h"
+#include "scope_timer.h"
+#include "supervisor.h"
+#include "task_factory.h"
+#include "work_queue.h"
+#include "esp_random.h"
+#include "esp_timer.h"
+#include "esp_transport_tcp.h"
+#include "esp_transport_ws.h"
+#include "lwip/sockets.h"
+#include "sdkconfig.h"
 #include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <string_view>
 
 static const char *TAG = "WebSocketClient";
 
-WebSocketClient::WebSocketClient(const std::string& uri, bool auto_reconnect, 
-                               int reconnect_interval_ms)
-    : uri_(uri), auto_reconnect_(auto_reconnect), 
-      reconnect_interval_ms_(reconnect_interval_ms),
-      client_(nullptr), connected_(false), reconnect_task_handle_(nullptr) {
+WebSocketClient::WebSocketClient(std::string_view uri, bool auto_reconnect, 
+                               int reconnect_base_ms, int reconnect_max_ms)
+    : uri_(uri), secure_(uri.compare(0, 6, "wss://") == 0), auto_reconnect_(auto_reconnect), 
+      reconnect_base_ms_(reconnect_base_ms), reconnect_max_ms_(reconnect_max_ms),
+      client_(nullptr), transport_list_(nullptr), ws_transport_(nullptr), ext_transport_(nullptr), state_(State::STOPPED), events_(xEventGroupCreateStatic(&events_struct_)),
+      message_op_code_(0x02), component_running_(false), component_task_(nullptr), drop_pending_(false),
+      maint_lock_(xSemaphoreCreateMutexStatic(&maint_lock_struct_)), reconnecting_(false),
+      retry_attempt_(0), retry_backoff_round_(0), retry_failover_(false), reconnect_stats_{},
+      event_queue_(nullptr), event_queue_storage_(nullptr), event_task_handle_(nullptr), dropped_events_(0),
+      heartbeat_interval_ms_(0), heartbeat_timeout_ms_(0), ping_seq_(0), last_pong_us_(0),
+      link_quality_{}, route_port_(0), applied_port_(0), move_delay_ms_(-1), binary_control_(false), dscp_(0),
+      send_task_handle_(nullptr), bulk_paused_(false), client_lock_(xSemaphoreCreateMutexStatic(&client_lock_struct_)), connection_id_(0) {
 }
 
 WebSocketClient::~WebSocketClient() {
     disconnect();
+    if (send_task_handle_ != nullptr) {
+        TaskFactory::destroy(send_task_handle_);
+    }
+    if (event_task_handle_ != nullptr) {
+        TaskFactory::destroy(event_task_handle_);
+        vQueueDelete(event_queue_);
+    }
+    BufferPlacement::free(event_queue_storage_);
+    for (SendLaneQueue& lane : lanes_) {
+        if (lane.free != nullptr) {
+            vQueueDelete(lane.free);
+            vQueueDelete(lane.ready);
+        }
+        BufferPlacement::free(lane.slots);
+    }
+    vSemaphoreDelete(client_lock_);
+    vSemaphoreDelete(maint_lock_);
+    vEventGroupDelete(events_);
+}
+
+void WebSocketClient::setState(State state) {
+    state_ = state;
+    if (state == State::CONNECTED) {
+        xEventGroupClearBits(events_, DISCONNECTED_BIT);
+        xEventGroupSetBits(events_, CONNECTED_BIT);
+    } else {
+        xEventGroupClearBits(events_, CONNECTED_BIT);
+        if (state == State::DISCONNECTED || state == State::STOPPED) {
+            xEventGroupSetBits(events_, DISCONNECTED_BIT);  // 正在等握手的重连工作马上返回
+        }
+        if (state == State::DISCONNECTED) {
+            onDisconnected();
+        }
+    }
 }
 
-void WebSocketClient::setEventCallback(EventCallback callback) {
-    event_callback_ = callback;
+bool WebSocketClient::waitConnected(int timeout_ms) {
+    if (state_.load() == State::STOPPED) {
+        return false;
+    }
+    EventBits_t bits = xEventGroupWaitBits(events_, CONNECTED_BIT, pdFALSE, pdTRUE,
+                                           pdMS_TO_TICKS(timeout_ms));
+    return (bits & CONNECTED_BIT) != 0;
+}
+
+bool WebSocketClient::waitAttempt(int timeout_ms) {
+    // 🧭 连接被拒、握手失败时组件马上报断开/错误：不用等满超时，立即换下一个中继或开始退避
+    EventBits_t bits = xEventGroupWaitBits(events_, CONNECTED_BIT | DISCONNECTED_BIT, pdFALSE, pdFALSE,
+                                           pdMS_TO_TICKS(timeout_ms));
+    return (bits & CONNECTED_BIT) != 0;
+}
+
+void WebSocketClient::setInlineHandler(EventType type, EventHandler handler, void* ctx) {
+    listeners_[(size_t)type].inline_handler = handler;
+    listeners_[(size_t)type].inline_ctx = ctx;
+}
+
+void WebSocketClient::setDeferredHandler(EventType type, EventHandler handler, void* ctx) {
+    listeners_[(size_t)type].deferred_handler = handler;
+    listeners_[(size_t)type].deferred_ctx = ctx;
+}
+
+void WebSocketClient::dispatch(const EventData& event) {
+    const Listener& listener = listeners_[(size_t)event.type];
+    if (listener.inline_handler != nullptr) {
+        listener.inline_handler(event, listener.inline_ctx);
+    } else if (listener.deferred_handler != nullptr) {
+        defer(event);
+    }
+}
+
+bool WebSocketClient::defer(const EventData& event) {
+    if (event_queue_ == nullptr || listeners_[(size_t)event.type].deferred_handler == nullptr) {
+        return false;
+    }
+    // 分片的消息拼起来要缓冲整条，事件任务只收完整的小消息（文本控制消息都是单帧）
+    if (event.data_len > EVENT_DATA_BYTES ||
+        (event.data_len > 0 && !(event.message_start && event.message_end))) {
+        dropped_events_++;
+        HOT_LOGW(TAG, "⚠️ 事件数据过长或分片（%u 字节），不转给事件任务", (unsigned)event.data_len);
+        return false;
+    }
+    DeferredEvent item;
+    item.event = event;
+    if (event.data_len > 0) {
+        memcpy(item.data, event.data, event.data_len);
+    }
+    if (xQueueSend(event_queue_, &item, 0) != pdTRUE) {
+        dropped_events_++;
+        HOT_LOGW(TAG, "⚠️ 事件队列已满，丢弃事件 %d", (int)event.type);
+        return false;
+    }
+    return true;
+}
+
+esp_err_t WebSocketClient::createEventQueue() {
+    if (event_task_handle_ != nullptr) {
+        return ESP_OK;
+    }
+    // 8项×约800字节，内部RAM留给音频；事件任务只是memcpy出来，PSRAM够快
+    event_queue_storage_ = (uint8_t*)BufferPlacement::alloc("ws_events", EVENT_QUEUE_LEN * sizeof(DeferredEvent),
+                                                            Placement::PSRAM);
+    if (event_queue_storage_ == nullptr) {
+        return ESP_ERR_NO_MEM;
+    }
+    event_queue_ = xQueueCreateStatic(EVENT_QUEUE_LEN, sizeof(DeferredEvent), event_queue_storage_,
+                                      &event_queue_struct_);
+    // 事件处理函数不碰Flash（写Flash的操作都交给主循环），栈放PSRAM
+    if (TaskFactory::create(event_task, "ws_event", EVENT_TASK_STACK_SIZE, this, profile_.event_task_priority,
+                            &event_task_handle_, profile_.event_task_core, TaskStack::PSRAM) != pdPASS) {
+        event_task_handle_ = nullptr;
+        vQueueDelete(event_queue_);
+        event_queue_ = nullptr;
+        ESP_LOGE(TAG, "❌ 事件任务创建失败");
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+void WebSocketClient::event_task(void* arg) {
+    WebSocketClient* ws_client = static_cast<WebSocketClient*>(arg);
+    // 一项有八百多字节，放在静态区不占任务栈（只有这一个事件任务）
+    static DeferredEvent item;
+    while (true) {
+        if (xQueueReceive(ws_client->event_queue_, &item, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        if (item.event.data_len > 0) {
+            item.event.data = item.data;
+        }
+        const Listener& listener = ws_client->listeners_[(size_t)item.event.type];
+        if (listener.deferred_handler != nullptr) {
+            listener.deferred_handler(item.event, listener.deferred_ctx);
+        }
+    }
 }
 
 void WebSocketClient::websocket_event_handler(void* handler_args, esp_event_base_t base, 
@@ -38,208 +196,1048 @@ void WebSocketClient::websocket_event_handler(void* handler_args, esp_event_base
     WebSocketClient* ws_client = static_cast<WebSocketClient*>(handler_args);
     esp_websocket_event_data_t* data = (esp_websocket_event_data_t*)event_data;
     
-    EventData event;
-    event.data = nullptr;
-    event.data_len = 0;
-    event.op_code = 0;
-    
     switch (event_id) {
         case WEBSOCKET_EVENT_CONNECTED:
-            ESP_LOGI(TAG, "🔗 WebSocket已连接");
-            ws_client->connected_ = true;
-            event.type = EventType::CONNECTED;
+            ws_client->parkComponent();         // 在改状态之前：之后重连工作的叫醒不会被这里覆盖
+            ws_client->applySocketOptions();     // 每次重连都是新socket
+            ws_client->onTransportConnected();
             break;
             
         case WEBSOCKET_EVENT_DISCONNECTED:
-            ESP_LOGI(TAG, "🔌 WebSocket已断开");
-            ws_client->connected_ = false;
-            event.type = EventType::DISCONNECTED;
+        case WEBSOCKET_EVENT_CLOSED:            // 服务器关闭（enable_close_reconnect），组件同样回到等待重连
+            ws_client->parkComponent();
+            ws_client->onTransportDisconnected(event_id == WEBSOCKET_EVENT_CLOSED);
             break;
             
         case WEBSOCKET_EVENT_DATA:
-            ESP_LOGD(TAG, "收到WebSocket数据，长度: %d 字节, op_code: 0x%02x", 
-                    data->data_len, data->op_code);
-            event.data = (const uint8_t*)data->data_ptr;
-            event.data_len = data->data_len;
-            event.op_code = data->op_code;
-            
-            // 🎯 根据操作码判断数据类型
-            if (data->op_code == 0x01) {        // 文本帧（JSON等）
-                event.type = EventType::DATA_TEXT;
-            } else if (data->op_code == 0x02) { // 二进制帧（音频等）
-                event.type = EventType::DATA_BINARY;
-            } else if (data->op_code == 0x09) { // Ping帧（心跳检测）
-                event.type = EventType::PING;
-            } else if (data->op_code == 0x0A) { // Pong帧（心跳回应）
-                event.type = EventType::PONG;
-            } else {
-                event.type = EventType::DATA_BINARY; // 其他都当作二进制
-            }
+            ws_client->onFrame(data->op_code, data->fin, (const uint8_t*)data->data_ptr, data->data_len,
+                               data->payload_offset, data->payload_len);
             break;
             
-        case WEBSOCKET_EVENT_ERROR:
+        case WEBSOCKET_EVENT_ERROR: {
             ESP_LOGI(TAG, "❌ WebSocket错误");
-            ws_client->connected_ = false;
+            if (ws_client->state_.load() != State::STOPPED) {
+                ws_client->setState(State::DISCONNECTED);
+            }
+            EventData event = {};
             event.type = EventType::ERROR;
+            ws_client->dispatch(event);
             break;
+        }
             
         default:
+            break;
+    }
+}
+
+void WebSocketClient::native_frame(const NativeWs::Frame& frame, void* ctx) {
+    static_cast<WebSocketClient*>(ctx)->onFrame(frame.op_code, frame.fin, frame.data, frame.len, frame.offset,
+                                                frame.total);
+}
+
+void WebSocketClient::native_link(NativeWs::Link link, void* ctx) {
+    WebSocketClient* ws_client = static_cast<WebSocketClient*>(ctx);
+    switch (link) {
+        case NativeWs::Link::CONNECTED:
+            ws_client->dscp_ = ws_client->profile_.dscp;    // 建连前已经设在socket上
+            ws_client->onTransportConnected();
+            break;
+        case NativeWs::Link::DISCONNECTED:
+        case NativeWs::Link::CLOSED:
+            ws_client->onTransportDisconnected(link == NativeWs::Link::CLOSED);
+            break;
+        case NativeWs::Link::FAILED: {
+            // 和组件建连失败时一样报错误；重连工作等握手时马上看到DISCONNECTED_BIT
+            if (ws_client->state_.load() == State::CONNECTING) {
+                ws_client->setState(State::DISCONNECTED);
+            }
+            EventData event = {};
+            event.type = EventType::ERROR;
+            ws_client->dispatch(event);
+            break;
+        }
+    }
+}
+
+void WebSocketClient::onTransportConnected() {
+    ESP_LOGI(TAG, "🔗 WebSocket已连接");
+    last_pong_us_ = esp_timer_get_time();
+    link_quality_.min_rtt_ms = 0;
+    connection_id_++;        // 上一个连接没发出去的消息作废
+    setState(State::CONNECTED);
+    EventData event = {};
+    event.type = EventType::CONNECTED;
+    dispatch(event);
+}
+
+void WebSocketClient::onTransportDisconnected(bool closed) {
+    ESP_LOGI(TAG, "🔌 WebSocket已断开%s", closed ? "（服务器关闭）" : "");
+    if (state_.load() != State::STOPPED) {
+        setState(State::DISCONNECTED);
+    }
+    binary_control_ = false;     // 重连后重新协商
+    EventData event = {};
+    event.type = EventType::DISCONNECTED;
+    dispatch(event);
+}
+
+void WebSocketClient::onFrame(int op_code, bool fin, const uint8_t* data, size_t len, size_t offset, size_t total) {
+    SCHED_TRACE_MARK(WS_RECV, len);
+    HOT_LOGD(TAG, "收到WebSocket数据，长度: %d 字节, op_code: 0x%02x", (int)len, op_code);
+    EventData event;
+    event.data = data;
+    event.data_len = len;
+    event.op_code = op_code;
+    event.payload_offset = offset;
+    event.payload_len = total;
+    event.message_start = op_code != 0x00 && offset == 0;
+    event.message_end = fin && offset + len >= total;
+
+    // 延续帧按所属消息的类型分发，不能一律当作二进制
+    if (op_code == 0x01 || op_code == 0x02) {
+        message_op_code_ = op_code;
+    }
+    if (op_code == 0x00) {
+        event.type = message_op_code_ == 0x01 ? EventType::DATA_TEXT : EventType::DATA_BINARY;
+    } else if (op_code == 0x01) { // 文本帧（JSON等）
+        // 💓 心跳回应在这里消化，不转给上层
+        if (event.message_start && event.message_end && handlePong((const char*)data, len)) {
+            return;
+        }
+        event.type = EventType::DATA_TEXT;
+    } else if (op_code == 0x02) { // 二进制帧（音频等）
+        if (event.message_start && event.message_end && handleControlPong(data, len)) {
             return;
+        }
+        event.type = EventType::DATA_BINARY;
+    } else if (op_code == 0x09) { // Ping帧（心跳检测）
+        event.type = EventType::PING;
+    } else if (op_code == 0x0A) { // Pong帧（心跳回应）
+        event.type = EventType::PONG;
+    } else {
+        event.type = EventType::DATA_BINARY; // 其他都当作二进制
     }
     
-    // 📢 调用用户设置的事件处理函数
-    if (ws_client->event_callback_) {
-        ws_client->event_callback_(event);
+    // 📢 按类型分发：直接处理或转到事件任务
+    dispatch(event);
+}
+
+bool WebSocketClient::checkNetworkBuffers(int min_tcp_wnd, int min_snd_buf) {
+    bool ok = true;
+    ESP_LOGI(TAG, "📶 lwIP: TCP窗口 %d 字节, 发送缓冲区 %d 字节, MSS %d",
+             CONFIG_LWIP_TCP_WND_DEFAULT, CONFIG_LWIP_TCP_SND_BUF_DEFAULT, CONFIG_LWIP_TCP_MSS);
+    if (CONFIG_LWIP_TCP_WND_DEFAULT < min_tcp_wnd) {
+        ESP_LOGW(TAG, "⚠️ CONFIG_LWIP_TCP_WND_DEFAULT=%d 小于推荐值 %d，下行音频突发会等窗口",
+                 CONFIG_LWIP_TCP_WND_DEFAULT, min_tcp_wnd);
+        ok = false;
     }
+    if (CONFIG_LWIP_TCP_SND_BUF_DEFAULT < min_snd_buf) {
+        ESP_LOGW(TAG, "⚠️ CONFIG_LWIP_TCP_SND_BUF_DEFAULT=%d 小于推荐值 %d，上行发送可能阻塞",
+                 CONFIG_LWIP_TCP_SND_BUF_DEFAULT, min_snd_buf);
+        ok = false;
+    }
+    return ok;
 }
 
-void WebSocketClient::reconnect_task(void* arg) {
-    WebSocketClient* ws_client = static_cast<WebSocketClient*>(arg);
-    
-    // 🔁 重连任务主循环
-    while (1) {
-        // 检查是否需要重连
-        if (!ws_client->connected_ && ws_client->client_ != nullptr && ws_client->auto_reconnect_) {
-            ESP_LOGI(TAG, "🔄 尝试重新连接WebSocket...");
-            
-            // 先停止现有连接
-            esp_websocket_client_stop(ws_client->client_);
-            vTaskDelay(pdMS_TO_TICKS(500));
-            
-            // 重新启动连接
-            esp_err_t ret = esp_websocket_client_start(ws_client->client_);
-            if (ret != ESP_OK) {
-                ESP_LOGE(TAG, "❌ WebSocket重连失败: %s", esp_err_to_name(ret));
-            } else {
-                // 等待连接建立
-                int wait_count = 0;
-                while (!ws_client->connected_ && wait_count < 50) {  // 等待最多5秒
-                    vTaskDelay(pdMS_TO_TICKS(100));
-                    wait_count++;
-                }
-                
-                if (ws_client->connected_) {
-                    ESP_LOGI(TAG, "✅ WebSocket重连成功");
-                } else {
-                    ESP_LOGW(TAG, "⚠️ WebSocket重连超时");
-                }
-            }
+esp_err_t WebSocketClient::createTransport(esp_websocket_client_config_t* cfg) {
+    // 组件内部创建的传输层拿不到socket，也不能跨重连保留TLS会话，所以两种地址都自己创建
+    bool secure = isSecure();
+    if (!secure && uri_.compare(0, 5, "ws://") != 0) {
+        ESP_LOGW(TAG, "⚠️ 不认识的地址格式，传输层交给组件创建");
+        return ESP_OK;
+    }
+    int default_port = secure ? 443 : 80;
+
+    esp_transport_keep_alive_t keep_alive = {};
+    if (profile_.keepalive_idle_sec > 0) {
+        keep_alive.keep_alive_enable = true;
+        keep_alive.keep_alive_idle = profile_.keepalive_idle_sec;
+        keep_alive.keep_alive_interval = profile_.keepalive_interval_sec;
+        keep_alive.keep_alive_count = profile_.keepalive_count;
+    }
+
+    esp_transport_handle_t base = nullptr;
+    if (secure) {
+        base = tls_.create(keep_alive.keep_alive_enable ? &keep_alive : nullptr, profile_.no_delay,
+                           profile_.tls_session_resume);
+    } else {
+        base = esp_transport_tcp_init();
+        if (base != nullptr && keep_alive.keep_alive_enable) {
+            esp_transport_tcp_set_keep_alive(base, &keep_alive);
         }
-        
-        // 休眠一段时间后再检查
-        vTaskDelay(pdMS_TO_TICKS(ws_client->reconnect_interval_ms_));
+    }
+    if (base == nullptr) {
+        return ESP_ERR_NO_MEM;
+    }
+    esp_transport_set_default_port(base, default_port);
+
+    esp_transport_handle_t ws = esp_transport_ws_init(base);
+    if (ws == nullptr) {
+        esp_transport_destroy(base);
+        return ESP_ERR_NO_MEM;
+    }
+    esp_transport_set_default_port(ws, default_port);
+
+    // 外部传输层不会再经过组件的路径设置，这里从URI里取出路径
+    size_t host_start = uri_.find("://") + 3;
+    size_t path_start = uri_.find('/', host_start);
+    std::string path = path_start == std::string::npos ? "/" : uri_.substr(path_start);
+    esp_transport_ws_set_path(ws, path.c_str());
+
+    transport_list_ = esp_transport_list_init();
+    if (transport_list_ == nullptr) {
+        esp_transport_destroy(ws);
+        esp_transport_destroy(base);
+        return ESP_ERR_NO_MEM;
+    }
+    esp_transport_list_add(transport_list_, base, secure ? "_ssl" : "_tcp");
+    esp_transport_list_add(transport_list_, ws, secure ? "wss" : "ws");
+    ws_transport_ = secure ? nullptr : ws;
+    ext_transport_ = ws;
+    cfg->ext_transport = ws;
+    return ESP_OK;
+}
+
+void WebSocketClient::destroyTransport() {
+    if (transport_list_ != nullptr) {
+        esp_transport_list_destroy(transport_list_);
+        transport_list_ = nullptr;
+        ws_transport_ = nullptr;
+        ext_transport_ = nullptr;
+    }
+}
+
+void WebSocketClient::applySocketOptions() {
+    dscp_ = profile_.dscp;
+    int sock = socketFd();
+    if (sock < 0) {
+        if (ext_transport_ != nullptr) {
+            ESP_LOGW(TAG, "⚠️ 无法获取socket，TCP_NODELAY/DSCP未设置");
+        }
+        return;
+    }
+    // wss://的TCP_NODELAY由tls_在握手后设置
+    if (ws_transport_ != nullptr && profile_.no_delay) {
+        int one = 1;
+        if (setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one)) != 0) {
+            ESP_LOGW(TAG, "⚠️ 设置TCP_NODELAY失败: errno %d", errno);
+        } else {
+            ESP_LOGI(TAG, "✅ 已关闭Nagle (TCP_NODELAY)");
+        }
+    }
+    if (profile_.dscp != 0) {
+        applyDscp(sock, profile_.dscp);
+    }
+}
+
+int WebSocketClient::socketFd() {
+    if (native_.running()) {
+        return native_.socket();
+    }
+    if (ws_transport_ != nullptr) {
+        return esp_transport_get_socket(ws_transport_);
+    }
+    return ext_transport_ != nullptr ? tls_.socket() : -1;
+}
+
+void WebSocketClient::applyDscp(int sock, uint8_t dscp) {
+    int tos = dscp << 2;    // TOS的低2位是ECN
+    if (setsockopt(sock, IPPROTO_IP, IP_TOS, &tos, sizeof(tos)) != 0) {
+        ESP_LOGW(TAG, "⚠️ 设置DSCP %u失败: errno %d", (unsigned)dscp, errno);
+    } else {
+        ESP_LOGI(TAG, "✅ 音频连接标记DSCP %u", (unsigned)dscp);
+    }
+}
+
+void WebSocketClient::setDscp(uint8_t dscp) {
+    // disconnect()拿着锁销毁传输层
+    if (xSemaphoreTake(client_lock_, pdMS_TO_TICKS(SUPERVISOR_LOCK_TIMEOUT_MS)) != pdTRUE) {
+        return;
+    }
+    int sock = isConnected() ? socketFd() : -1;
+    if (sock >= 0) {
+        applyDscp(sock, dscp);
+        dscp_ = dscp;
+    }
+    xSemaphoreGive(client_lock_);
+}
+
+bool WebSocketClient::peerAddress(struct sockaddr_storage* addr, socklen_t* len) {
+    if (xSemaphoreTake(client_lock_, pdMS_TO_TICKS(SUPERVISOR_LOCK_TIMEOUT_MS)) != pdTRUE) {
+        return false;
+    }
+    int sock = isConnected() ? socketFd() : -1;
+    *len = sizeof(*addr);
+    bool ok = sock >= 0 && getpeername(sock, (struct sockaddr*)addr, len) == 0;
+    xSemaphoreGive(client_lock_);
+    return ok;
+}
+
+uint32_t WebSocketClient::nextBackoffMs(uint32_t attempt) const {
+    // full jitter：在[0, min(上限, 基数*2^n)]内均匀取值
+    uint32_t cap = reconnect_max_ms_ > 0 ? reconnect_max_ms_ : 1;
+    uint32_t ceiling = reconnect_base_ms_ > 0 ? reconnect_base_ms_ : 1;
+    for (uint32_t i = 0; i < attempt && ceiling < cap; i++) {
+        ceiling *= 2;
+    }
+    if (ceiling > cap) {
+        ceiling = cap;
+    }
+    return esp_random() % (ceiling + 1);
+}
+
+void WebSocketClient::applyRouteHint(uint32_t consecutive_failures) {
+    int port = route_port_.load();
+    if (port > 0 && consecutive_failures >= ROUTE_FALLBACK_FAILURES) {
+        ESP_LOGW(TAG, "⚠️ 路由端口%d连续%lu次连接失败，退回配置的地址", port, (unsigned long)consecutive_failures);
+        route_port_ = 0;
+        port = 0;
+    }
+    if (port == applied_port_) {
+        return;
+    }
+
+    // 只替换authority里的端口，主机和路径保持不变
+    std::string uri = uri_;
+    if (port > 0) {
+        size_t host_start = uri.find("://") + 3;
+        size_t host_end = std::min(uri.find('/', host_start), uri.size());
+        size_t colon = uri.rfind(':', host_end - 1);
+        if (colon == std::string::npos || colon < host_start) {
+            colon = host_end;
+        }
+        uri.replace(colon, host_end - colon, ":" + std::to_string(port));
+    }
+    esp_err_t ret = native_.running() ? native_.setUri(uri) : esp_websocket_client_set_uri(client_, uri.c_str());
+    if (ret == ESP_OK) {
+        applied_port_ = port;
+        ESP_LOGI(TAG, "🧭 连接地址切换为 %s", uri.c_str());
+    }
+}
+
+esp_err_t WebSocketClient::setUri(std::string_view uri) {
+    if ((uri.compare(0, 6, "wss://") == 0) != secure_ || started()) {
+        ESP_LOGW(TAG, "⚠️ 不能换成 %.*s（scheme不同或已经连接）", (int)uri.size(), uri.data());
+        return ESP_ERR_INVALID_STATE;
+    }
+    uri_ = uri;
+    return ESP_OK;
+}
+
+void WebSocketClient::switchUri(const std::string& uri) {
+    if (uri == uri_) {
+        return;
+    }
+    uri_ = uri;
+    // 路由提示是上一个中继给的；自建的传输层不经过组件设置路径，这里跟着换
+    route_port_ = 0;
+    applied_port_ = -1;
+    if (ext_transport_ != nullptr) {
+        size_t host_start = uri_.find("://") + 3;
+        size_t path_start = uri_.find('/', host_start);
+        esp_transport_ws_set_path(ext_transport_, path_start == std::string::npos ? "/" : uri_.c_str() + path_start);
+    }
+}
+
+void WebSocketClient::parkComponent() {
+    // 在组件任务里调用：记下任务句柄，把组件自己的重连间隔拉长，断开后停在等待状态
+    component_task_ = xTaskGetCurrentTaskHandle();
+    drop_pending_ = false;
+    esp_websocket_client_set_reconnect_timeout(client_, RECONNECT_PARK_MS);
+}
+
+void WebSocketClient::kickTransport() {
+    // 组件在等待状态里按重连间隔的一半vTaskDelay：间隔改成1 ms再打断这次延时，它马上重新建连。
+    // 拿着client_lock_，发送任务不会正占着组件的锁（打断的只能是那次延时）
+    xSemaphoreTake(client_lock_, portMAX_DELAY);
+    esp_websocket_client_set_reconnect_timeout(client_, 1);
+    TaskHandle_t task = component_task_.load();
+    if (task != nullptr && eTaskGetState(task) == eBlocked) {
+        xTaskAbortDelay(task);
+    }
+    xSemaphoreGive(client_lock_);
+}
+
+void WebSocketClient::stopComponent() {
+    if (component_running_.load()) {
+        esp_websocket_client_stop(client_);
+    }
+    component_running_ = false;
+    component_task_ = nullptr;     // 组件任务已经退出
+}
+
+void WebSocketClient::dropConnection() {
+    // 只关socket：组件自己读到出错、关闭传输层、报告断开并回到等待状态，任务和缓冲区都留着。
+    // 没有自建传输层拿不到socket，或者上次关了还没报告断开，才整个停掉组件
+    if (native_.running()) {
+        native_.drop();     // 精简传输的网络任务同样报告断开后等下一次open()
+        return;
+    }
+    int sock = socketFd();
+    if (sock >= 0 && component_running_.load() && !drop_pending_.exchange(true)) {
+        shutdown(sock, SHUT_RDWR);
+        return;
+    }
+    stopComponent();
+    setState(State::DISCONNECTED);
+    // 主动stop不会产生断开事件，这里补发给上层
+    EventData event = {};
+    event.type = EventType::DISCONNECTED;
+    dispatch(event);
+}
+
+void WebSocketClient::reconnectNow() {
+    if (state_.load() == State::DISCONNECTED && reconnecting_.load()) {
+        reconnect_stats_.fast_retries++;
+        ESP_LOGI(TAG, "⚡ 跳过退避，立即重连");
+        retry_timer_.startOnce(0);
+    }
+}
+
+void WebSocketClient::onDisconnected() {
+    // 一次断开只排一轮重连：这一轮在retry_work()里一直重试到连上、disconnect()或重新connect()
+    if (!auto_reconnect_ || reconnecting_.exchange(true)) {
+        return;
+    }
+    retry_attempt_ = 0;
+    retry_backoff_round_ = 0;
+    retry_failover_ = false;
+    scheduleRetry();
+}
+
+void WebSocketClient::scheduleRetry() {
+    // 每次失败后退避上限翻倍，直到连上或被disconnect()；换到下一个中继的那次不等
+    ReconnectStats& stats = reconnect_stats_;
+    // 🚚 服务器重启前给了错开的重连时间：第一次按它等
+    int32_t move_ms = retry_attempt_ == 0 ? move_delay_ms_.exchange(-1) : -1;
+    uint32_t backoff_ms = retry_failover_ ? 0
+                        : move_ms >= 0 ? (uint32_t)move_ms : nextBackoffMs(retry_backoff_round_++);
+    stats.last_backoff_ms = backoff_ms;
+    if (backoff_ms > stats.max_backoff_ms) {
+        stats.max_backoff_ms = backoff_ms;
+    }
+    ESP_LOGI(TAG, "⏳ 第%lu次重连，%lu ms后开始", (unsigned long)(retry_attempt_ + 1), (unsigned long)backoff_ms);
+    retry_timer_.startOnce(backoff_ms);
+}
+
+void WebSocketClient::retry_work(void* ctx) {
+    WebSocketClient* ws_client = static_cast<WebSocketClient*>(ctx);
+    xSemaphoreTake(ws_client->maint_lock_, portMAX_DELAY);
+    bool again = ws_client->attemptReconnect();
+    xSemaphoreGive(ws_client->maint_lock_);
+    if (again) {
+        ws_client->scheduleRetry();
+        return;
+    }
+    ws_client->reconnecting_ = false;
+    if (ws_client->state_.load() == State::DISCONNECTED) {
+        ws_client->onDisconnected();    // 这一轮结束前又断开了
+    }
+}
+
+bool WebSocketClient::attemptReconnect() {
+    if (state_.load() != State::DISCONNECTED || !started()) {
+        return false;   // 等待期间已被disconnect()或重新connect()
+    }
+    ReconnectStats& stats = reconnect_stats_;
+    stats.attempts++;
+    retry_attempt_++;
+    ESP_LOGI(TAG, "🔄 尝试重新连接WebSocket...");
+    applyRouteHint(stats.consecutive_failures);
+    setState(State::CONNECTING);
+    xEventGroupClearBits(events_, DISCONNECTED_BIT);     // 停掉旧连接时的断开不算这次的结果
+    esp_err_t ret = ESP_OK;
+    if (native_.running()) {
+        native_.open();     // 🪶 精简传输：网络任务一直在，叫醒它建连
+    } else if (component_running_.load()) {
+        // ⚡ 组件任务还停在等待状态：叫醒它重新建连，不重建任务、不重新分配缓冲区
+        kickTransport();
+    } else {
+        stats.task_restarts++;
+        ret = esp_websocket_client_start(client_);
+        component_running_ = ret == ESP_OK;
+    }
+    if (ret == ESP_OK && waitAttempt(RECONNECT_CONNECT_TIMEOUT_MS)) {
+        stats.successes++;
+        stats.consecutive_failures = 0;
+        ESP_LOGI(TAG, "✅ WebSocket重连成功（第%lu次尝试）", (unsigned long)retry_attempt_);
+        return false;
+    }
+
+    stats.consecutive_failures++;
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ WebSocket重连失败: %s", esp_err_to_name(ret));
+    } else {
+        ESP_LOGW(TAG, "⚠️ WebSocket重连超时");
+    }
+    if (state_.load() == State::CONNECTING) {
+        // 握手还卡在组件里（连接超时比这里长）：停掉组件，下次尝试重新start；
+        // 精简传输只打断这次建连，网络任务报告失败时状态已经是DISCONNECTED
+        if (native_.running()) {
+            native_.drop();
+        } else {
+            stopComponent();
+        }
+        setState(State::DISCONNECTED);
+    }
+    if (state_.load() != State::DISCONNECTED) {
+        return false;   // 等握手期间被disconnect()
+    }
+    // 🧭 有别的中继就立即换过去（见relay_selector.h）
+    retry_failover_ = false;
+    if (failover_) {
+        std::string next_uri;
+        retry_failover_ = failover_(&next_uri);
+        if (!next_uri.empty()) {
+            // 组件停在等待状态时只读配置里的地址，下次被叫醒建连时用新的，不用停掉
+            switchUri(next_uri);
+        }
+    }
+    return true;
+}
+
+void WebSocketClient::heartbeat_work(void* ctx) {
+    WebSocketClient* ws_client = static_cast<WebSocketClient*>(ctx);
+    xSemaphoreTake(ws_client->maint_lock_, portMAX_DELAY);
+    if (ws_client->started()) {
+        ws_client->checkHeartbeat();
+    }
+    xSemaphoreGive(ws_client->maint_lock_);
+}
+
+void WebSocketClient::setHeartbeat(int interval_ms, int timeout_ms) {
+    heartbeat_interval_ms_ = interval_ms;
+    heartbeat_timeout_ms_ = timeout_ms;
+    if (!started()) {
+        return;     // connect()时按这里的间隔启动
+    }
+    if (interval_ms > 0) {
+        heartbeat_timer_.startPeriodic(interval_ms);
+    } else {
+        heartbeat_timer_.stop();
     }
 }
 
 esp_err_t WebSocketClient::connect() {
-    if (client_ != nullptr) {
+    if (started()) {
         ESP_LOGW(TAG, "WebSocket客户端已存在");
         return ESP_OK;
     }
     
     ESP_LOGI(TAG, "🌐 正在连接WebSocket服务器: %s", uri_.c_str());
+
+    esp_err_t queue_ret = createSendQueue();
+    if (queue_ret == ESP_OK) {
+        queue_ret = createEventQueue();
+    }
+    if (queue_ret == ESP_OK) {
+        queue_ret = WorkQueue::start();
+    }
+    if (queue_ret == ESP_OK) {
+        queue_ret = retry_timer_.init("ws_retry", retry_work, this, WorkPriority::HIGH);
+    }
+    if (queue_ret == ESP_OK) {
+        queue_ret = heartbeat_timer_.init("ws_heartbeat", heartbeat_work, this, WorkPriority::HIGH);
+    }
+    if (queue_ret != ESP_OK) {
+        return queue_ret;
+    }
+    if (profile_.native_transport) {
+        if (!isSecure()) {
+            return startNative();
+        }
+        ESP_LOGW(TAG, "⚠️ 精简传输只支持ws://，wss://仍用esp_websocket_client");
+    }
     
     // 🔧 配置WebSocket参数
     esp_websocket_client_config_t ws_cfg = {};
     ws_cfg.uri = uri_.c_str();            // 服务器地址
-    ws_cfg.buffer_size = BUFFER_SIZE;     // 接收缓冲区8KB
-    ws_cfg.task_stack = TASK_STACK_SIZE;  // 任务栈大小8KB
-    ws_cfg.reconnect_timeout_ms = 15000;  // 重连超时15秒
-    ws_cfg.network_timeout_ms = 15000;    // 网络超时15秒
-    ws_cfg.transport = WEBSOCKET_TRANSPORT_OVER_TCP; // 使用TCP传输
+    ws_cfg.buffer_size = BUFFER_SIZE;     // 接收缓冲区（WS_BUFFER_BYTES）
+    ws_cfg.task_stack = isSecure() ? TLS_TASK_STACK_SIZE : TASK_STACK_SIZE;
+    // 重连统一由重连工作按退避策略处理：组件的自动重连开着，但间隔很长，断开后停着等叫醒（见kickTransport()）
+    ws_cfg.reconnect_timeout_ms = RECONNECT_PARK_MS;
+    ws_cfg.enable_close_reconnect = true; // 服务器关闭后也停在等待状态，不退出任务
+    ws_cfg.network_timeout_ms = NETWORK_TIMEOUT_MS;    // 网络超时15秒
+    ws_cfg.transport = isSecure() ? WEBSOCKET_TRANSPORT_OVER_SSL : WEBSOCKET_TRANSPORT_OVER_TCP;
+    ws_cfg.task_prio = profile_.task_priority;
+    ws_cfg.ping_interval_sec = profile_.ping_interval_sec;
+    if (profile_.pingpong_timeout_sec > 0) {
+        ws_cfg.pingpong_timeout_sec = profile_.pingpong_timeout_sec;
+    } else {
+        ws_cfg.disable_pingpong_discon = true;
+    }
+    // 组件自建传输层时用这组参数；自建传输层在createTransport()里设置
+    ws_cfg.keep_alive_enable = profile_.keepalive_idle_sec > 0;
+    ws_cfg.keep_alive_idle = profile_.keepalive_idle_sec;
+    ws_cfg.keep_alive_interval = profile_.keepalive_interval_sec;
+    ws_cfg.keep_alive_count = profile_.keepalive_count;
+    if (profile_.no_delay || profile_.dscp != 0 || isSecure()) {
+        esp_err_t tr_ret = createTransport(&ws_cfg);
+        if (tr_ret != ESP_OK) {
+            ESP_LOGE(TAG, "❌ 传输层创建失败: %s", esp_err_to_name(tr_ret));
+            return tr_ret;
+        }
+    }
     
     // 🎆 创建 WebSocket客户端实例
     client_ = esp_websocket_client_init(&ws_cfg);
     if (client_ == nullptr) {
         ESP_LOGE(TAG, "❌ WebSocket客户端初始化失败");
+        destroyTransport();
         return ESP_FAIL;
     }
     
+    applied_port_ = 0;
+    applyRouteHint(0);
+    
     // 📡 注册事件处理函数（所有事件都会通知我们）
     esp_websocket_register_events(client_, WEBSOCKET_EVENT_ANY, websocket_event_handler, this);
     
     // 启动WebSocket客户端
+    setState(State::CONNECTING);
     esp_err_t ret = esp_websocket_client_start(client_);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "WebSocket客户端启动失败: %s", esp_err_to_name(ret));
         esp_websocket_client_destroy(client_);
         client_ = nullptr;
+        destroyTransport();
+        setState(State::STOPPED);
         return ret;
     }
+    component_running_ = true;
     
-    // 🔁 创建自动重连任务
-    if (auto_reconnect_ && reconnect_task_handle_ == nullptr) {
-        xTaskCreate(reconnect_task, "ws_reconnect", RECONNECT_TASK_STACK_SIZE, 
-                   this, 5, &reconnect_task_handle_);
-        ESP_LOGI(TAG, "✅ 自动重连任务已启动");
+    // 🔁 重连和心跳在后台工作队列里做（见work_queue.h），不单独开任务
+    if (heartbeat_interval_ms_ > 0) {
+        heartbeat_timer_.startPeriodic(heartbeat_interval_ms_);
     }
     
     return ESP_OK;
 }
 
-void WebSocketClient::disconnect() {
-    // 🛑 停止自动重连任务
-    if (reconnect_task_handle_ != nullptr) {
-        vTaskDelete(reconnect_task_handle_);
-        reconnect_task_handle_ = nullptr;
-        ESP_LOGI(TAG, "🔌 自动重连任务已停止");
+esp_err_t WebSocketClient::startNative() {
+    NativeWs::Config cfg;
+    cfg.no_delay = profile_.no_delay;
+    cfg.dscp = profile_.dscp;
+    cfg.keepalive_idle_sec = profile_.keepalive_idle_sec;
+    cfg.keepalive_interval_sec = profile_.keepalive_interval_sec;
+    cfg.keepalive_count = profile_.keepalive_count;
+    cfg.ping_interval_sec = profile_.ping_interval_sec;
+    cfg.pingpong_timeout_sec = profile_.pingpong_timeout_sec;
+    cfg.connect_timeout_ms = RECONNECT_CONNECT_TIMEOUT_MS;
+    cfg.network_timeout_ms = NETWORK_TIMEOUT_MS;
+    cfg.buffer_bytes = BUFFER_SIZE;
+    cfg.task_stack = NATIVE_TASK_STACK_SIZE;
+    cfg.task_priority = profile_.task_priority;
+    esp_err_t ret = native_.setUri(uri_);
+    if (ret == ESP_OK) {
+        ret = native_.start(cfg, native_frame, native_link, this);
     }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ 精简传输启动失败: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    applied_port_ = 0;
+    applyRouteHint(0);
+    setState(State::CONNECTING);
+    native_.open();
+    if (heartbeat_interval_ms_ > 0) {
+        heartbeat_timer_.startPeriodic(heartbeat_interval_ms_);
+    }
+    return ESP_OK;
+}
+
+void WebSocketClient::disconnect() {
+    // 先标记为已停止，停止过程中触发的断开事件不会再排重连
+    setState(State::STOPPED);
+
+    // 🛑 停掉重连和心跳，等正在执行的那一次做完（已经排进队列的会看到STOPPED直接返回）
+    retry_timer_.stop();
+    heartbeat_timer_.stop();
+    xSemaphoreTake(maint_lock_, portMAX_DELAY);
+    reconnecting_ = false;
     
     // 🔌 断开并清理WebSocket连接
+    if (native_.running()) {
+        ESP_LOGI(TAG, "🔌 正在断开WebSocket连接...");
+        xSemaphoreTake(client_lock_, portMAX_DELAY);    // 等发送任务写完手上这一条
+        native_.stop();
+        xSemaphoreGive(client_lock_);
+        ESP_LOGI(TAG, "✅ WebSocket已完全断开");
+    }
     if (client_ != nullptr) {
         ESP_LOGI(TAG, "🔌 正在断开WebSocket连接...");
-        esp_websocket_client_stop(client_);      // 停止连接
+        xSemaphoreTake(client_lock_, portMAX_DELAY);    // 等发送任务写完手上这一条
+        stopComponent();                         // 停止连接
         esp_websocket_client_destroy(client_);   // 释放资源
         client_ = nullptr;
-        connected_ = false;
+        xSemaphoreGive(client_lock_);
+        destroyTransport();                      // 外部传输层不归组件管理
         ESP_LOGI(TAG, "✅ WebSocket已完全断开");
     }
+    xSemaphoreGive(maint_lock_);
 }
 
-int WebSocketClient::sendText(const std::string& text, int timeout_ms) {
-    if (client_ == nullptr || !connected_) {
-        ESP_LOGW(TAG, "⚠️ WebSocket未连接，无法发送文本");
-        return -1;
+esp_err_t WebSocketClient::restart() {
+    // 发送任务卡在socket写里时拿不到锁：关掉socket让那次写返回
+    if (xSemaphoreTake(client_lock_, pdMS_TO_TICKS(SUPERVISOR_LOCK_TIMEOUT_MS)) != pdTRUE) {
+        int sock = socketFd();
+        if (sock >= 0) {
+            shutdown(sock, SHUT_RDWR);
+        }
+        if (xSemaphoreTake(client_lock_, pdMS_TO_TICKS(SUPERVISOR_LOCK_TIMEOUT_MS)) != pdTRUE) {
+            ESP_LOGE(TAG, "❌ 发送任务一直占着连接，无法热重启");
+            return ESP_ERR_TIMEOUT;
+        }
     }
-    
-    // 📤 调用ESP-IDF的WebSocket API发送文本数据
-    int len = esp_websocket_client_send_text(client_, text.c_str(), text.length(), 
-                                            timeout_ms / portTICK_PERIOD_MS);
-    if (len < 0) {
-        ESP_LOGE(TAG, "❌ 发送文本失败");
+    xSemaphoreGive(client_lock_);
+
+    bool was_connected = isConnected();
+    disconnect();
+    if (was_connected) {
+        // 主动断开不会产生断开事件，这里补发给上层
+        EventData event = {};
+        event.type = EventType::DISCONNECTED;
+        dispatch(event);
+    }
+    return connect();
+}
+
+esp_err_t WebSocketClient::reconnect() {
+    if (!started() || (client_ != nullptr && !component_running_.load())) {
+        return restart();
+    }
+    ESP_LOGI(TAG, "⚡ 快速重连：只重建传输层");
+    move_delay_ms_ = 0;     // 这次断开是主动的，第一次重连不退避
+    if (isConnected()) {
+        dropConnection();
     } else {
-        ESP_LOGD(TAG, "✅ 发送文本成功: %d 字节", len);
+        reconnectNow();
     }
-    
-    return len;
+    return ESP_OK;
 }
 
-int WebSocketClient::sendBinary(const uint8_t* data, size_t len, int timeout_ms) {
-    if (client_ == nullptr || !connected_) {
-        ESP_LOGW(TAG, "⚠️ WebSocket未连接，无法发送二进制数据");
+esp_err_t WebSocketClient::createSendQueue() {
+    if (send_task_handle_ != nullptr) {
+        return ESP_OK;      // 队列跨重连保留
+    }
+    static const char* const kSlotNames[] = { "ws_send_ctrl", "ws_send_audio", "ws_send_bulk" };
+    const size_t counts[] = { profile_.control_slots, profile_.audio_slots, profile_.bulk_slots };
+    const size_t sizes[] = { profile_.control_slot_bytes, profile_.audio_slot_bytes, profile_.bulk_slot_bytes };
+    for (size_t i = 0; i < (size_t)SendLane::COUNT; i++) {
+        SendLaneQueue& lane = lanes_[i];
+        if (lane.free != nullptr) {
+            continue;
+        }
+        // 槽位号用uint8_t保存，单条长度用uint16_t
+        lane.slot_count = std::clamp<size_t>(counts[i], 1, 255);
+        lane.slot_bytes = std::min<size_t>(sizes[i], UINT16_MAX);
+        // 发送时lwIP会再拷一次，槽位区放PSRAM不影响发送路径
+        lane.slots = (uint8_t*)BufferPlacement::alloc(kSlotNames[i], lane.slot_count * lane.slot_bytes, Placement::PSRAM);
+        lane.free = xQueueCreate(lane.slot_count, sizeof(uint8_t));
+        lane.ready = xQueueCreate(lane.slot_count, sizeof(SendItem));
+        if (lane.slots == nullptr || lane.free == nullptr || lane.ready == nullptr) {
+            ESP_LOGE(TAG, "❌ 发送队列分配失败");
+            return ESP_ERR_NO_MEM;
+        }
+        for (size_t slot = 0; slot < lane.slot_count; slot++) {
+            uint8_t index = (uint8_t)slot;
+            xQueueSend(lane.free, &index, 0);
+        }
+    }
+    // 上行音频的必经之路，栈留在内部RAM
+    if (TaskFactory::create(send_task, "ws_send", SEND_TASK_STACK_SIZE, this, profile_.send_task_priority,
+                            &send_task_handle_, profile_.send_task_core, TaskStack::INTERNAL) != pdPASS) {
+        send_task_handle_ = nullptr;
+        ESP_LOGE(TAG, "❌ 发送任务创建失败");
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "✅ 发送队列: 控制 %u×%u 字节, 音频 %u×%u 字节（%lu ms过期）, 后台 %u×%u 字节",
+             (unsigned)lanes_[0].slot_count, (unsigned)lanes_[0].slot_bytes,
+             (unsigned)lanes_[1].slot_count, (unsigned)lanes_[1].slot_bytes,
+             (unsigned long)profile_.audio_deadline_ms,
+             (unsigned)lanes_[2].slot_count, (unsigned)lanes_[2].slot_bytes);
+    return ESP_OK;
+}
+
+static const char* laneName(WebSocketClient::SendLane lane) {
+    switch (lane) {
+        case WebSocketClient::SendLane::AUDIO: return "音频";
+        case WebSocketClient::SendLane::BULK: return "后台";
+        default: return "控制";
+    }
+}
+
+int WebSocketClient::enqueue(SendLane lane_id, int op_code, const uint8_t* data, size_t len, int timeout_ms) {
+    if (!started() || !isConnected() || send_task_handle_ == nullptr) {
+        HOT_LOGW(TAG, "⚠️ WebSocket未连接，无法发送");
         return -1;
     }
-    
-    // 📤 调用ESP-IDF的WebSocket API发送二进制数据（通常是音频）
-    int sent = esp_websocket_client_send_bin(client_, (const char*)data, len, 
-                                            timeout_ms / portTICK_PERIOD_MS);
-    if (sent < 0) {
-        ESP_LOGE(TAG, "❌ 发送二进制数据失败");
+    SendLaneQueue& lane = lanes_[(size_t)lane_id];
+    if (len > lane.slot_bytes) {
+        ESP_LOGE(TAG, "❌ 消息过长: %u 字节，通道上限 %u", (unsigned)len, (unsigned)lane.slot_bytes);
+        return -1;
+    }
+    SendItem item;
+    if (xQueueReceive(lane.free, &item.slot, 0) != pdTRUE) {
+        lane.counters.dropped_full++;
+        PerfCounters::add(PerfCounter::WS_SEND_FULL_DROPS);
+        HOT_LOGW(TAG, "⚠️ 发送队列已满（%s），丢弃 %u 字节", laneName(lane_id), (unsigned)len);
+        return -1;
+    }
+    memcpy(lane.slots + (size_t)item.slot * lane.slot_bytes, data, len);
+    item.op_code = (uint8_t)op_code;
+    item.len = (uint16_t)len;
+    item.connection_id = connection_id_.load();
+    item.timeout_ms = timeout_ms;
+    item.queued_us = esp_timer_get_time();
+    item.deadline_us = 0;
+    if (lane_id == SendLane::AUDIO && profile_.audio_deadline_ms > 0) {
+        item.deadline_us = item.queued_us + (int64_t)profile_.audio_deadline_ms * 1000;
+    }
+    xQueueSend(lane.ready, &item, 0);   // ready_和free_一样长，不会满
+    SCHED_TRACE_MARK(WS_ENQUEUE, (uint32_t)lane_id << 16 | len);
+    lane.counters.queued++;
+    uint32_t depth = uxQueueMessagesWaiting(lane.ready);
+    if (depth > lane.counters.max_depth.load()) {
+        lane.counters.max_depth = depth;
+    }
+    PerfCounters::noteMax(PerfGauge::WS_SEND_QUEUE_DEPTH, depth);
+    xTaskNotifyGive(send_task_handle_);
+    return (int)len;
+}
+
+void WebSocketClient::send_task(void* arg) {
+    WebSocketClient* ws_client = static_cast<WebSocketClient*>(arg);
+    SendLaneQueue& control = ws_client->lanes_[(size_t)SendLane::CONTROL];
+    SendLaneQueue& audio = ws_client->lanes_[(size_t)SendLane::AUDIO];
+    SendLaneQueue& bulk = ws_client->lanes_[(size_t)SendLane::BULK];
+
+    // 每次只取一条：发完一条音频先回头看控制通道，打断、额度不会排在一串音频后面；
+    // 后台消息只在前两个通道都空着时发，暂停时留在队列里（setBulkPaused(false)会唤醒这里）
+    while (true) {
+        SendItem item;
+        if (xQueueReceive(control.ready, &item, 0) == pdTRUE) {
+            ws_client->sendItem(control, item);
+        } else if (xQueueReceive(audio.ready, &item, 0) == pdTRUE) {
+            ws_client->sendItem(audio, item);
+        } else if (!ws_client->bulk_paused_.load() && xQueueReceive(bulk.ready, &item, 0) == pdTRUE) {
+            ws_client->sendItem(bulk, item);
+        } else {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        }
+    }
+}
+
+void WebSocketClient::sendItem(SendLaneQueue& lane, const SendItem& item) {
+    SendCounters& counters = lane.counters;
+    int64_t now = esp_timer_get_time();
+    uint32_t wait_ms = (uint32_t)((now - item.queued_us) / 1000);
+    if (wait_ms > counters.max_wait_ms.load()) {
+        counters.max_wait_ms = wait_ms;
+    }
+    counters.last_wait_ms = wait_ms;
+    PerfCounters::noteMax(PerfGauge::WS_SEND_WAIT_MAX_MS, wait_ms);
+
+    uint8_t* data = lane.slots + (size_t)item.slot * lane.slot_bytes;
+    if (item.connection_id != connection_id_.load() || !isConnected()) {
+        counters.dropped_offline++;
+    } else if (item.deadline_us != 0 && now >= item.deadline_us) {
+        counters.dropped_stale++;
+        PerfCounters::add(PerfCounter::WS_SEND_STALE_DROPS);
+        FLIGHT_RECORD(WS_STALE_DROP, wait_ms);
+        HOT_LOGW(TAG, "⚠️ 音频在发送队列里等了 %lu ms，丢弃", (unsigned long)wait_ms);
     } else {
-        ESP_LOGD(TAG, "✅ 发送二进制数据成功: %d 字节", sent);
+        // 不等过网络超时（disconnect()要等这一条写完）；有期限的消息也不超过剩余时间
+        int timeout_ms = (item.timeout_ms < 0 || item.timeout_ms > NETWORK_TIMEOUT_MS) ? NETWORK_TIMEOUT_MS : item.timeout_ms;
+        TickType_t ticks = pdMS_TO_TICKS(timeout_ms);
+        if (item.deadline_us != 0) {
+            ticks = std::min(ticks, pdMS_TO_TICKS((item.deadline_us - now) / 1000 + 1));
+        }
+        int sent = -1;
+        int64_t write_start = esp_timer_get_time();
+        SCHED_TRACE_BEGIN(WS_SEND, item.len);
+        xSemaphoreTake(client_lock_, portMAX_DELAY);
+        Supervisor::enter(Watch::WS_SEND);
+        if (native_.running()) {
+            // 槽位归发送任务所有，就地加掩码，不再拷一份
+            SCOPE_TIMER(WS_WRITE);
+            sent = native_.send(item.op_code, data, item.len, (int)pdTICKS_TO_MS(ticks));
+        } else if (client_ != nullptr) {
+            SCOPE_TIMER(WS_WRITE);
+            sent = item.op_code == 0x01 ? esp_websocket_client_send_text(client_, (const char*)data, item.len, ticks)
+                                        : esp_websocket_client_send_bin(client_, (const char*)data, item.len, ticks);
+        }
+        Supervisor::leave(Watch::WS_SEND);
+        xSemaphoreGive(client_lock_);
+        SCHED_TRACE_END(WS_SEND, sent);
+        counters.write_us += (uint32_t)(esp_timer_get_time() - write_start);
+        if (sent < 0) {
+            counters.failed++;
+            HOT_LOGW(TAG, "⚠️ 发送失败: %u 字节", (unsigned)item.len);
+        } else {
+            counters.completed++;
+            HOT_LOGD(TAG, "✅ 发送成功: %d 字节", sent);
+        }
     }
-    
-    return sent;
+    uint8_t slot = item.slot;
+    xQueueSend(lane.free, &slot, 0);
+}
+
+size_t WebSocketClient::sendQueueSpace(SendLane lane) const {
+    const SendLaneQueue& queue = lanes_[(size_t)lane];
+    return queue.free != nullptr ? uxQueueMessagesWaiting(queue.free) : 0;
+}
+
+WebSocketClient::SendStats WebSocketClient::getSendStats(SendLane lane) const {
+    const SendCounters& c = lanes_[(size_t)lane].counters;
+    SendStats stats;
+    stats.queued = c.queued.load();
+    stats.completed = c.completed.load();
+    stats.failed = c.failed.load();
+    stats.dropped_full = c.dropped_full.load();
+    stats.dropped_stale = c.dropped_stale.load();
+    stats.dropped_offline = c.dropped_offline.load();
+    stats.max_depth = c.max_depth.load();
+    stats.max_wait_ms = c.max_wait_ms.load();
+    stats.last_wait_ms = c.last_wait_ms.load();
+    stats.write_us = c.write_us.load();
+    return stats;
+}
+
+void WebSocketClient::setBulkPaused(bool paused) {
+    if (bulk_paused_.exchange(paused) && !paused && send_task_handle_ != nullptr) {
+        xTaskNotifyGive(send_task_handle_);     // 暂停期间入队的消息
+    }
+}
+
+int WebSocketClient::sendText(std::string_view text, int timeout_ms, SendLane lane) {
+    if (text.empty()) {
+        return -1;
+    }
+    return enqueue(lane, 0x01, (const uint8_t*)text.data(), text.size(), timeout_ms);
+}
+
+int WebSocketClient::sendBinary(const uint8_t* data, size_t len, int timeout_ms, SendLane lane) {
+    SCOPE_TIMER(WS_SEND_BINARY);
+    return enqueue(lane, 0x02, data, len, timeout_ms);
+}
+
+int WebSocketClient::sendAudio(const uint8_t* data, size_t len) {
+    return enqueue(SendLane::AUDIO, 0x02, data, len, portMAX_DELAY);
+}
+
+int WebSocketClient::sendControl(ControlProtocol::Type type, const void* payload, size_t len, int timeout_ms,
+                                 SendLane lane) {
+    uint8_t frame[ControlProtocol::MAX_FRAME];
+    size_t frame_len = ControlProtocol::encode(type, payload, len, frame, sizeof(frame));
+    if (frame_len == 0) {
+        ESP_LOGE(TAG, "❌ 控制帧过长: %s, %zu 字节", ControlProtocol::typeName(type), len);
+        return -1;
+    }
+    return sendBinary(frame, frame_len, timeout_ms, lane);
 }
 
 esp_err_t WebSocketClient::sendPing() {
-    if (client_ == nullptr || !connected_) {
+    if (!started() || !isConnected()) {
         ESP_LOGW(TAG, "⚠️ WebSocket未连接，无法发送ping");
         return ESP_ERR_INVALID_STATE;
     }
-    
-    // 💡 提示：ESP-IDF的WebSocket客户端会自动处理ping/pong心跳
-    // 如果需要手动发送ping包，可以在这里实现
-    // 心跳机制用于保持连接活跃，防止服务器超时断开
+
+    // 时间戳由服务器原样带回，设备端不需要记录每个ping的发送时间
+    if (binary_control_) {
+        if (sendControl(ControlProtocol::Type::PING, nullptr, 0, 1000) < 0) {
+            ESP_LOGW(TAG, "⚠️ 心跳发送失败");
+            return ESP_FAIL;
+        }
+        link_quality_.pings_sent++;
+        return ESP_OK;
+    }
+    JsonMessage<64> msg("ping");
+    msg.num("seq", ++ping_seq_).num("t", esp_timer_get_time() / 1000);
+    if (sendText(msg.finish(), 1000) < 0) {
+        ESP_LOGW(TAG, "⚠️ 心跳发送失败");
+        return ESP_FAIL;
+    }
+    link_quality_.pings_sent++;
     return ESP_OK;
+}
+
+bool WebSocketClient::handlePong(const char* data, size_t len) {
+    std::string_view text(data, len);
+    if (text.size() > 96 || text.find("\"pong\"") == std::string_view::npos) {
+        return false;
+    }
+    size_t pos = text.find("\"t\":");
+    if (pos == std::string_view::npos) {
+        return true;
+    }
+    // 数据不以'\0'结尾，拷到栈上再解析（strtoll会跳过冒号后的空格）
+    pos += 4;
+    char num[24];
+    size_t n = std::min(text.size() - pos, sizeof(num) - 1);
+    memcpy(num, text.data() + pos, n);
+    num[n] = '\0';
+    int64_t sent_ms = strtoll(num, nullptr, 10);
+    int64_t now_ms = esp_timer_get_time() / 1000;
+    if (sent_ms <= 0 || sent_ms > now_ms) {
+        return true;
+    }
+
+    updateRtt((uint32_t)(now_ms - sent_ms));
+    return true;
+}
+
+bool WebSocketClient::handleControlPong(const uint8_t* data, size_t len) {
+    ControlProtocol::Header header;
+    const uint8_t* payload = nullptr;
+    if (!ControlProtocol::parse(data, len, &header, &payload) || header.type != (uint8_t)ControlProtocol::Type::PONG) {
+        return false;
+    }
+    ControlProtocol::PongPayload pong;
+    if (header.len < sizeof(pong)) {
+        return true;
+    }
+    memcpy(&pong, payload, sizeof(pong));
+    // t_ms只有低32位，相减按无符号回绕，49天一圈也不影响RTT
+    updateRtt((uint32_t)(esp_timer_get_time() / 1000) - pong.ping_t_ms);
+    return true;
+}
+
+void WebSocketClient::updateRtt(uint32_t rtt) {
+    LinkQuality& q = link_quality_;
+    if (q.pongs_received == 0) {
+        q.srtt_ms = rtt;
+        q.rttvar_ms = rtt / 2;
+    } else {
+        uint32_t err = rtt > q.srtt_ms ? rtt - q.srtt_ms : q.srtt_ms - rtt;
+        q.rttvar_ms = (3 * q.rttvar_ms + err) / 4;
+        q.srtt_ms = (7 * q.srtt_ms + rtt) / 8;
+    }
+    q.last_rtt_ms = rtt;
+    if (q.min_rtt_ms == 0 || rtt < q.min_rtt_ms) {
+        q.min_rtt_ms = rtt;
+    }
+    q.pongs_received++;
+    last_pong_us_ = esp_timer_get_time();
+    ESP_LOGD(TAG, "💓 RTT %lu ms (平滑 %lu ms, 抖动 %lu ms)",
+             (unsigned long)rtt, (unsigned long)q.srtt_ms, (unsigned long)q.rttvar_ms);
+
+    if (link_quality_callback_) {
+        link_quality_callback_(q);
+    }
+}
+
+void WebSocketClient::checkHeartbeat() {
+    if (!isConnected()) {
+        return;
+    }
+    int64_t silent_ms = (esp_timer_get_time() - last_pong_us_.load()) / 1000;
+    if (heartbeat_timeout_ms_ > 0 && silent_ms > heartbeat_timeout_ms_) {
+        // 连接已经半死：TCP还没发现，但服务器不再回应。主动断开，交给重连流程
+        ESP_LOGW(TAG, "💔 %lld ms未收到心跳回应，断开重连", silent_ms);
+        link_quality_.timeouts++;
+        dropConnection();
+        return;
+    }
+    sendPing();
 }
\ No newline at end of file
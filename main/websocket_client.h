@@ -2,10 +2,24 @@
 #define WEBSOCKET_CLIENT_H
 
 #include "esp_websocket_client.h"
+#include "esp_transport.h"
+#include "lwip/sockets.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include <algorithm>
+#include <atomic>
+#include <span>
 #include <string>
+#include <string_view>
 #include <functional>
+#include "control_protocol.h"
+#include "native_ws.h"
+#include "tls_transport.h"
+#include "work_queue.h"
+#include "project_config.h"
 
 /**
  * @brief 🌐 WebSocket客户端类 - 与服务器实时通信
@@ -14,8 +28,10 @@
  * 
  * 🎆 主要特点：
  * - 支持文本和二进制数据传输
- * - 自动重连机制（断线后自动重连）
- * - 事件回调机制（连接、断开、收到数据等）
+ * - 自动重连机制（断线后按指数退避+随机抖动重连，唤醒时可立即重试）
+ * - 按事件类型登记处理函数：音频在WebSocket任务里直接处理，连接状态和文本消息转到事件任务
+ * - 发送不阻塞调用方：消息拷进内部发送队列就返回，由独立的发送任务写socket
+ * - ws://可以不用esp_websocket_client，改走自己的精简传输（TransportProfile::native_transport，见native_ws.h）
  * 
  * 📡 应用场景：
  * - 发送录音数据给服务器
@@ -36,7 +52,20 @@ public:
         DATA_BINARY,    // 📦 收到二进制数据（如音频）
         PING,           // 🏓 收到ping（心跳检测）
         PONG,           // 🏐 收到pong（心跳回应）
-        ERROR           // ❌ 发生错误
+        ERROR,          // ❌ 发生错误
+        COUNT
+    };
+
+    /**
+     * @brief 连接状态
+     *
+     * 由WebSocket任务（连接/断开事件）和调用connect()/disconnect()的任务共同修改，用原子变量保存。
+     */
+    enum class State : uint8_t {
+        STOPPED,        // 未启动或已调用disconnect()
+        CONNECTING,     // 已启动，等待握手完成
+        CONNECTED,      // 握手完成，可以收发
+        DISCONNECTED,   // 连接断开，等待重连
     };
     
     /**
@@ -48,25 +77,145 @@ public:
         EventType type;         // 事件类型
         const uint8_t* data;    // 数据指针（可能为空）
         size_t data_len;        // 数据长度
-        int op_code;            // WebSocket操作码
+        int op_code;            // WebSocket操作码（延续帧为0）
+
+        // 超过接收缓冲区的帧会分成多个片段回调，data只是其中一段
+        size_t payload_offset;  // 本片段在帧内的偏移
+        size_t payload_len;     // 整个帧的长度
+        bool message_start;     // 一条消息的第一个片段
+        bool message_end;       // 一条消息的最后一个片段（最后一帧的最后一段）
     };
     
     /**
-     * @brief 事件回调函数类型
-     * 
-     * 用户可以提供一个函数，当事件发生时会被调用。
+     * @brief 重连统计
+     */
+    struct ReconnectStats {
+        uint32_t attempts;              // 累计重连尝试次数
+        uint32_t successes;             // 累计重连成功次数
+        uint32_t consecutive_failures;  // 当前连续失败次数（连上后清零）
+        uint32_t fast_retries;          // reconnectNow()跳过退避等待的次数
+        uint32_t task_restarts;         // 组件任务没在运行、要stop/start重新创建任务的尝试次数
+        uint32_t last_backoff_ms;       // 最近一次退避等待时长
+        uint32_t max_backoff_ms;        // 启动以来最长的退避等待
+    };
+
+    /**
+     * @brief 链路质量（应用层心跳测得）
+     *
+     * RTT平滑方法与TCP相同（RFC 6298）：srtt每次向新样本靠近1/8，rttvar向偏差靠近1/4。
+     */
+    struct LinkQuality {
+        uint32_t last_rtt_ms;       // 最近一次RTT
+        uint32_t srtt_ms;           // 平滑RTT
+        uint32_t rttvar_ms;         // RTT抖动
+        uint32_t min_rtt_ms;        // 本次连接的最小RTT
+        uint32_t pings_sent;
+        uint32_t pongs_received;
+        uint32_t timeouts;          // 心跳超时断开的次数
+    };
+
+    /**
+     * @brief 链路质量更新回调（在WebSocket任务中调用，收到每个pong后触发）
+     */
+    using LinkQualityCallback = std::function<void(const LinkQuality&)>;
+
+    /**
+     * @brief 故障转移回调（在重连工作中调用，一次重连失败后触发）
+     *
+     * 把下次要连的地址写进next_uri（留空=不换）；返回true时立即用它重试、不等退避。
+     */
+    using FailoverCallback = std::function<bool(std::string* next_uri)>;
+
+    /**
+     * @brief 传输层参数（connect()之前设置，下次连接生效）
+     *
+     * 语音上行是每20~60ms一条的小消息，Nagle算法会把它们攒到上一个ACK回来才发，
+     * 白白增加一个RTT的延迟，所以默认关闭。TCP keep-alive负责发现半开连接，
+     * WebSocket ping负责应用层保活，两者互不替代。
+     *
+     * DSCP写进每个IP包的TOS字节：ESP-IDF的WiFi驱动按TOS的高3位选WMM接入类别（EF=46→UP5→AC_VI，
+     * CS6=48以上→AC_VO），AP和路由器按DSCP排下行队列（RFC 8325把EF映射到AC_VO）。
+     * 共享AP上下载把尽力而为队列塞满时，语音不用跟着排队。
+     */
+    struct TransportProfile {
+        bool no_delay = true;               // 关闭Nagle（TCP_NODELAY）
+        uint8_t dscp = 46;                  // IP头的DSCP（46=EF），0=不标记
+        bool tls_session_resume = true;     // wss://重连时复用上次的TLS会话（见tls_transport.h）
+        int keepalive_idle_sec = 5;         // 空闲多久开始发TCP keep-alive探测，0=不启用
+        int keepalive_interval_sec = 2;     // 探测间隔
+        int keepalive_count = 3;            // 连续几次无响应判定断开
+        int ping_interval_sec = 10;         // WebSocket ping间隔
+        int pingpong_timeout_sec = 30;      // 多久收不到pong判定断开，0=不检测
+        int task_priority = 5;              // WebSocket收发任务优先级
+        int send_task_priority = 5;         // 发送任务优先级
+        int send_task_core = tskNO_AFFINITY;
+        int event_task_priority = 4;        // 事件任务优先级（运行setDeferredHandler()登记的处理函数）
+        int event_task_core = tskNO_AFFINITY;
+        size_t control_slots = 8;           // 控制通道（文本和控制帧）的队列长度
+        size_t control_slot_bytes = 1024;   // 控制通道单条消息上限
+        size_t audio_slots = 12;            // 音频通道的队列长度
+        size_t audio_slot_bytes = 2048;     // 音频通道单条消息上限（合包后的一条上行消息）
+        uint32_t audio_deadline_ms = 400;   // 音频在队列里等了这么久还没发出就丢弃，0=不过期
+        size_t bulk_slots = 4;              // 后台通道（统计、黑匣子等维护上传）的队列长度
+        size_t bulk_slot_bytes = 2048;      // 后台通道单条消息上限
+        bool native_transport = false;      // ws://时用精简传输（见native_ws.h），wss://仍走组件
+    };
+
+    /**
+     * @brief 发送通道：发送任务总是先发完控制通道，再发音频，两者都空了才发后台通道
      */
-    using EventCallback = std::function<void(const EventData&)>;
+    enum class SendLane : uint8_t {
+        CONTROL,        // sendText/sendControl：hello、额度、打断、心跳等，不过期
+        AUDIO,          // sendAudio：上行音频，超过audio_deadline_ms就丢弃
+        BULK,           // sendText/sendControl指定：维护上传（见upload_scheduler.h），setBulkPaused()时留在队列里不发
+        COUNT
+    };
+
+    /**
+     * @brief 发送队列统计（按通道）
+     */
+    struct SendStats {
+        uint32_t queued;            // 进入队列的消息
+        uint32_t completed;         // 已写进socket的消息
+        uint32_t failed;            // 写socket失败（连接在发送途中断开或超时）
+        uint32_t dropped_full;      // 队列满，调用方拿到-1
+        uint32_t dropped_stale;     // 等待超过期限丢弃（只有音频通道）
+        uint32_t dropped_offline;   // 发出前连接已断开（或已换成新连接）丢弃
+        uint32_t max_depth;         // 队列最大深度
+        uint32_t max_wait_ms;       // 入队到开始发送的最长等待
+        uint32_t last_wait_ms;      // 最近一条的等待（上行码率自适应看这个，见uplink_rate_controller.h）
+        uint32_t write_us;          // 写socket的累计耗时（TCP窗口满时发送任务卡在这里，见turn_cost.h）
+    };
+
+    // 📦 配置常量（内存预算表也按这些计算，见memory_budget.h）
+    static constexpr int BUFFER_SIZE = WS_BUFFER_BYTES;     // 数据缓冲区大小（默认8KB）
+    static constexpr int TASK_STACK_SIZE = 8192;            // WebSocket任务栈大小
+    static constexpr int TLS_TASK_STACK_SIZE = 10240;       // wss://时握手（证书链验证）在WebSocket任务里做，栈要大一些
+    static constexpr int NATIVE_TASK_STACK_SIZE = 6144;     // 精简传输的网络任务：只有分帧和下行音频的处理函数
+    static constexpr int SEND_TASK_STACK_SIZE = 4096;       // 发送任务栈大小（wss://时在这里做加密）
+    static constexpr int EVENT_TASK_STACK_SIZE = 6144;      // 事件任务栈大小（应用的处理函数在这里拼hello、算固件哈希）
+    static constexpr int NETWORK_TIMEOUT_MS = 15000;        // 组件的网络超时，也是发送任务单次写socket的上限
+    static constexpr int RECONNECT_CONNECT_TIMEOUT_MS = 5000;   // 每次重连等待握手完成的时间
+    static constexpr int RECONNECT_PARK_MS = 3600 * 1000;       // 组件自己的重连间隔：设成很长让它停着等重连工作叫醒
+    static constexpr uint32_t ROUTE_FALLBACK_FAILURES = 3;      // 提示端口连续失败几次后退回配置的地址
+    static constexpr size_t EVENT_DATA_BYTES = 768;     // 转到事件任务的消息上限（最长的是runtime_config）
+    static constexpr size_t EVENT_QUEUE_LEN = 8;
+
+    /**
+     * @brief 事件处理函数类型（普通函数指针加上下文，登记和分发都不分配内存）
+     */
+    using EventHandler = void (*)(const EventData& event, void* ctx);
     
     /**
      * @brief 创建WebSocket客户端
      * 
-     * @param uri 服务器地址（如 ws://192.168.1.100:8888）
+     * @param uri 服务器地址（如 ws://192.168.1.100:8888 或 wss://voice.example.com:8443）
      * @param auto_reconnect 是否自动重连（默认开启）
-     * @param reconnect_interval_ms 重连间隔时间（默认5秒）
+     * @param reconnect_base_ms 第一次重连的退避上限（默认1秒）
+     * @param reconnect_max_ms 退避上限的最大值（默认60秒）
      */
-    WebSocketClient(const std::string& uri, bool auto_reconnect = true, 
-                   int reconnect_interval_ms = 5000);
+    WebSocketClient(std::string_view uri, bool auto_reconnect = true, 
+                   int reconnect_base_ms = 1000, int reconnect_max_ms = 60000);
     
     /**
      * @brief 析构函数
@@ -74,13 +223,31 @@ public:
     ~WebSocketClient();
     
     /**
-     * @brief 设置事件处理函数
-     * 
-     * 当WebSocket发生事件时，会调用您设置的这个函数。
-     * 
-     * @param callback 事件处理函数
+     * @brief 登记在WebSocket任务里直接调用的处理函数（下行音频这类必须按到达顺序立即处理的事件）
+     *
+     * 处理函数不能阻塞：WebSocket任务同时负责收包，这里卡住整条下行都会卡住。
+     * 有不急的部分时调用defer()把这个事件转给同类型的延后处理函数。
+     * 登记了直接处理函数的类型不会再自动转到事件任务。
+     */
+    void setInlineHandler(EventType type, EventHandler handler, void* ctx = nullptr);
+
+    /**
+     * @brief 登记在事件任务里调用的处理函数（连接、断开、文本消息等可以晚几毫秒、可能耗时的事件）
+     *
+     * 事件连同数据（不超过EVENT_DATA_BYTES的完整消息）拷进事件队列，WebSocket任务不等待；
+     * 队列满、数据过长或分片的消息丢弃并计数（见droppedEvents()）。同一个队列，事件按到达顺序处理。
+     * 在connect()之前登记。
+     */
+    void setDeferredHandler(EventType type, EventHandler handler, void* ctx = nullptr);
+
+    /**
+     * @brief 把事件转给它的延后处理函数（在直接处理函数中调用）
+     *
+     * @return true=已放进事件队列；没有延后处理函数、数据过长或队列满时返回false
      */
-    void setEventCallback(EventCallback callback);
+    bool defer(const EventData& event);
+
+    uint32_t droppedEvents() const { return dropped_events_.load(); }
     
     /**
      * @brief 连接到服务器
@@ -95,42 +262,130 @@ public:
      * @brief 断开WebSocket连接
      */
     void disconnect();
+
+    /**
+     * @brief 热重启连接（子系统看门狗在发送任务卡住时调用，见supervisor.h）
+     *
+     * 发送任务还占着连接时先关掉socket让它返回，然后断开（上层收到DISCONNECTED）并重新连接，
+     * 发送队列和TLS会话缓存保留。
+     *
+     * @return ESP_OK=已经重新开始连接，ESP_ERR_TIMEOUT=发送任务放不开连接
+     */
+    esp_err_t restart();
+
+    /**
+     * @brief 快速重连：只断开并重建传输层，组件的客户端句柄、收发缓冲区和WebSocket任务都留着
+     *
+     * 关掉socket，组件自己发现断开、回到等待重连，重连工作不退避立即叫醒它重新建连；
+     * 不释放、不重新分配内存，也不重新创建任务。上层照常收到DISCONNECTED和CONNECTED。
+     * 客户端还没启动时退回restart()。
+     */
+    esp_err_t reconnect();
     
     /**
-     * @brief 发送文本消息
+     * @brief 发送文本消息（控制通道）
      * 
-     * 用于发送JSON等文本格式的数据。
+     * 用于发送JSON等文本格式的数据。消息拷进发送队列后立即返回，不等网络。
+     * 字符串字面量、栈上的char数组和JsonMessage（见json_message.h）都不经过堆。
      * 
-     * @param text 要发送的文本内容
-     * @param timeout_ms 超时时间（默认永不超时）
-     * @return 发送的字节数，-1=失败
+     * @param text 要发送的文本内容（空串当作失败，JsonMessage溢出时就是空串）
+     * @param timeout_ms 发送任务写socket的超时（默认等到网络超时），不阻塞调用方
+     * @param lane CONTROL或BULK
+     * @return 入队的字节数，-1=未连接、队列满、消息为空或过长
      */
-    int sendText(const std::string& text, int timeout_ms = portMAX_DELAY);
+    int sendText(std::string_view text, int timeout_ms = portMAX_DELAY, SendLane lane = SendLane::CONTROL);
     
     /**
-     * @brief 发送二进制数据
-     * 
-     * 用于发送音频等二进制格式的数据。
+     * @brief 发送二进制数据（控制通道）
      * 
      * @param data 数据指针
      * @param len 数据字节数
-     * @param timeout_ms 超时时间（默认永不超时）
-     * @return 发送的字节数，-1=失败
+     * @param timeout_ms 发送任务写socket的超时（默认等到网络超时），不阻塞调用方
+     * @param lane CONTROL或BULK
+     * @return 入队的字节数，-1=未连接、队列满或消息过长
      */
-    int sendBinary(const uint8_t* data, size_t len, int timeout_ms = portMAX_DELAY);
+    int sendBinary(const uint8_t* data, size_t len, int timeout_ms = portMAX_DELAY, SendLane lane = SendLane::CONTROL);
+    int sendBinary(std::span<const uint8_t> data, int timeout_ms = portMAX_DELAY) {
+        return sendBinary(data.data(), data.size(), timeout_ms);
+    }
+
+    /**
+     * @brief 发送上行音频（音频通道，排在所有控制消息后面）
+     *
+     * 在队列里等待超过TransportProfile::audio_deadline_ms还没发出就丢弃：
+     * TCP窗口卡住时送过去的旧音频只会拖慢识别，不如让服务器按帧头seq看到缺口。
+     *
+     * @return 入队的字节数，-1=未连接、队列满或消息过长
+     */
+    int sendAudio(const uint8_t* data, size_t len);
+
+    /**
+     * @brief 通道里还能放几条消息（补发缓存的音频时先看一眼，免得把队列灌满）
+     */
+    size_t sendQueueSpace(SendLane lane) const;
+
+    SendStats getSendStats(SendLane lane) const;
+
+    /**
+     * @brief 暂停/恢复后台通道（刚唤醒、等第一句回复时暂停，已经入队的维护消息也先不发）
+     */
+    void setBulkPaused(bool paused);
     
     /**
-     * @brief 发送ping包
+     * @brief 发送应用层心跳 {"type":"ping","seq":n,"t":毫秒}
+     *
+     * 服务器原样带回seq和t（{"type":"pong",...}），收到后更新RTT。
+     * 心跳工作按setHeartbeat()的间隔自动调用，一般不需要手动发送。
+     *
      * @return ESP_OK表示成功，其他值表示失败
      */
     esp_err_t sendPing();
+
+    /**
+     * @brief 发送一条二进制控制帧（见control_protocol.h）
+     *
+     * @return 发送的字节数，-1=失败
+     */
+    int sendControl(ControlProtocol::Type type, const void* payload, size_t len, int timeout_ms = portMAX_DELAY,
+                    SendLane lane = SendLane::CONTROL);
+
+    /**
+     * @brief 服务器在hello里确认支持二进制控制帧后打开（断开时自动关闭，重连后重新协商）
+     *
+     * 打开后心跳改用PING/PONG控制帧，上层的credit、interrupt、stats也按binaryControl()选择格式。
+     */
+    void setBinaryControl(bool enable) { binary_control_ = enable; }
+
+    bool binaryControl() const { return binary_control_.load(); }
+
+    /**
+     * @brief 设置心跳参数（0=关闭心跳）
+     *
+     * @param interval_ms 心跳间隔
+     * @param timeout_ms 超过这个时间没有收到pong就断开重连
+     */
+    void setHeartbeat(int interval_ms, int timeout_ms);
+
+    void setLinkQualityCallback(LinkQualityCallback callback) { link_quality_callback_ = callback; }
+
+    LinkQuality getLinkQuality() const { return link_quality_; }
     
     /**
      * @brief 查询连接状态
      * 
      * @return true=已连接，false=未连接
      */
-    bool isConnected() const { return connected_; }
+    bool isConnected() const { return state_.load() == State::CONNECTED; }
+
+    State getState() const { return state_.load(); }
+
+    /**
+     * @brief 阻塞等待连接建立（事件驱动，连上的瞬间返回，不轮询）
+     *
+     * @param timeout_ms 最长等待时间
+     * @return true=已连接，false=超时
+     */
+    bool waitConnected(int timeout_ms);
     
     /**
      * @brief 设置是否自动重连
@@ -139,40 +394,250 @@ public:
     void setAutoReconnect(bool enable) { auto_reconnect_ = enable; }
     
     /**
-     * @brief 设置重连间隔
-     * @param interval_ms 重连间隔（毫秒）
+     * @brief 设置重连退避参数
+     *
+     * 第n次重连（从0开始）前等待[0, min(max_ms, base_ms * 2^n)]内的随机时长（full jitter），
+     * 服务器重启时各设备的重连时间自然错开，不会同时涌入。
+     *
+     * @param base_ms 第一次重连的退避上限（毫秒）
+     * @param max_ms 退避上限的最大值（毫秒）
+     */
+    void setReconnectBackoff(int base_ms, int max_ms) {
+        reconnect_base_ms_ = base_ms;
+        reconnect_max_ms_ = max_ms;
+    }
+
+    /**
+     * @brief 设置传输层参数（见TransportProfile）
+     */
+    void setTransportProfile(const TransportProfile& profile) { profile_ = profile; }
+
+    const TransportProfile& getTransportProfile() const { return profile_; }
+
+    /**
+     * @brief 改当前连接的DSCP（立即生效，重连后恢复成TransportProfile::dscp），网络自检对比标记前后用
+     */
+    void setDscp(uint8_t dscp);
+
+    /**
+     * @brief 当前连接用的DSCP
+     */
+    uint8_t dscp() const { return dscp_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 当前连接的服务器地址（UDP音频通道连同一台主机，见udp_audio.h），没连上时返回false
+     */
+    bool peerAddress(struct sockaddr_storage* addr, socklen_t* len);
+
+    /**
+     * @brief 检查lwIP的TCP窗口和发送缓冲区是否满足要求（启动时调用一次）
+     *
+     * 这两个参数只能在sdkconfig里改，运行时无法调整；不满足时输出警告，
+     * 下行TTS突发会被接收窗口卡住。
+     *
+     * @param min_tcp_wnd 推荐的最小接收窗口（字节）
+     * @param min_snd_buf 推荐的最小发送缓冲区（字节）
+     * @return true=满足推荐值
      */
-    void setReconnectInterval(int interval_ms) { reconnect_interval_ms_ = interval_ms; }
+    static bool checkNetworkBuffers(int min_tcp_wnd, int min_snd_buf);
+
+    /**
+     * @brief 跳过当前的退避等待，立即重连一次（用户唤醒时调用）
+     *
+     * 只在重连正在退避等待时生效，不会重置退避计数。
+     */
+    void reconnectNow();
+
+    ReconnectStats getReconnectStats() const { return reconnect_stats_; }
+
+    bool isSecure() const { return secure_; }
+
+    /**
+     * @brief 换服务器地址（connect()之前调用，比如中继选择的结果）
+     *
+     * scheme必须和构造时的一样：ws://和wss://的传输层不同，connect()时就建好了。
+     */
+    esp_err_t setUri(std::string_view uri);
+
+    /**
+     * @brief 设置故障转移回调（connect()之前调用，见FailoverCallback和relay_selector.h）
+     */
+    void setFailover(FailoverCallback callback) { failover_ = callback; }
+
+    /**
+     * @brief 设置服务器下发的路由提示：之后重连改用这个端口（主机和路径不变）
+     *
+     * 多进程服务器按设备ID把设备固定到某个worker，hello回复里带route_port。
+     * 提示端口连续ROUTE_FALLBACK_FAILURES次连不上时自动退回配置的地址。
+     *
+     * @param port 端口，0=清除提示
+     */
+    void setRouteHint(int port) { route_port_ = port; }
+
+    /**
+     * @brief 服务器要重启（move提示）：断开后第一次重连改成等delay_ms，不走随机退避
+     *
+     * 服务器排空时给每个连接一个随机的delay_ms，设备错开重连到新进程。只影响下一次断开后的第一次重连。
+     */
+    void deferReconnect(uint32_t delay_ms) { move_delay_ms_ = (int32_t)std::min<uint32_t>(delay_ms, INT32_MAX); }
 
 private:
     // WebSocket事件处理器
     static void websocket_event_handler(void* handler_args, esp_event_base_t base, 
                                       int32_t event_id, void* event_data);
+    // 精简传输的回调（网络任务中执行）
+    static void native_frame(const NativeWs::Frame& frame, void* ctx);
+    static void native_link(NativeWs::Link link, void* ctx);
+    // 两种传输共用的连接、断开和收帧处理
+    void onTransportConnected();
+    void onTransportDisconnected(bool closed);
+    void onFrame(int op_code, bool fin, const uint8_t* data, size_t len, size_t offset, size_t total);
+    esp_err_t startNative();
+    bool started() const { return client_ != nullptr || native_.running(); }
     
-    // 重连任务
-    static void reconnect_task(void* arg);
+    // 重连和心跳（后台工作队列里执行）
+    static void retry_work(void* ctx);
+    static void heartbeat_work(void* ctx);
+    void onDisconnected();
+    void scheduleRetry();
+    bool attemptReconnect();
+    static void send_task(void* arg);
+    static void event_task(void* arg);
+    void dispatch(const EventData& event);
+    esp_err_t createEventQueue();
+    bool handlePong(const char* data, size_t len);
+    bool handleControlPong(const uint8_t* data, size_t len);
+    void updateRtt(uint32_t rtt);
+    void checkHeartbeat();
+    void parkComponent();
+    void kickTransport();
+    void dropConnection();
+    void stopComponent();
+    esp_err_t createTransport(esp_websocket_client_config_t* cfg);
+    void destroyTransport();
+    void applySocketOptions();
+    int socketFd();
+    void applyDscp(int sock, uint8_t dscp);
+    uint32_t nextBackoffMs(uint32_t attempt) const;
+    void applyRouteHint(uint32_t consecutive_failures);
+    void switchUri(const std::string& uri);
+    bool waitAttempt(int timeout_ms);
+    esp_err_t createSendQueue();
+    int enqueue(SendLane lane, int op_code, const uint8_t* data, size_t len, int timeout_ms);
     
-    // 配置参数
+    // 配置参数（uri_只在客户端没有运行时改：connect()之前，或者重连工作里两次尝试之间）
     std::string uri_;
+    const bool secure_;
+    FailoverCallback failover_;
     bool auto_reconnect_;
-    int reconnect_interval_ms_;
+    int reconnect_base_ms_;
+    int reconnect_max_ms_;
+    
+    TransportProfile profile_;
     
     // WebSocket客户端句柄
     esp_websocket_client_handle_t client_;
+    // 自己创建传输层（为空时由组件内部创建）：ws://时是TCP+WS，这样才能拿到socket设置TCP_NODELAY和DSCP；
+    // wss://时是TlsTransport+WS，TLS会话缓存在tls_里，跨重连保留
+    esp_transport_list_handle_t transport_list_;
+    esp_transport_handle_t ws_transport_;   // 只在ws://时设置，wss://的TCP_NODELAY由tls_在握手后设置
+    esp_transport_handle_t ext_transport_;  // 交给组件的最外层传输（ws和wss都有）
+    TlsTransport tls_;
+    NativeWs native_;       // native_transport时代替组件（client_保持为空）
     
     // 状态变量
-    bool connected_;
-    
-    // 重连任务句柄
-    TaskHandle_t reconnect_task_handle_;
+    static constexpr EventBits_t CONNECTED_BIT = BIT0;
+    static constexpr EventBits_t DISCONNECTED_BIT = BIT1;  // 断开或disconnect()，等握手的重连工作看这一位
+    void setState(State state);
+
+    std::atomic<State> state_;
+    StaticEventGroup_t events_struct_;
+    EventGroupHandle_t events_;     // CONNECTED_BIT/DISCONNECTED_BIT与state_同步
+    int message_op_code_;       // 当前消息的操作码，延续帧（op_code=0）沿用它的类型（只在事件任务中访问）
     
-    // 事件回调
-    EventCallback event_callback_;
+    // 组件的WebSocket任务：开着组件的自动重连但停在等待状态，由重连工作按退避叫醒（kickTransport()），
+    // 断线重连不再stop/start重新创建任务。component_task_在组件任务的事件里记下，stop之后清空
+    std::atomic<bool> component_running_;
+    std::atomic<TaskHandle_t> component_task_;
+    std::atomic<bool> drop_pending_;    // 已经关了socket，等组件报告断开
+
+    // 重连和心跳：后台工作队列里的两个定时工作（见work_queue.h），maint_lock_让它们和disconnect()互斥
+    WorkQueue::Timer retry_timer_;
+    WorkQueue::Timer heartbeat_timer_;
+    StaticSemaphore_t maint_lock_struct_;
+    SemaphoreHandle_t maint_lock_;
+    std::atomic<bool> reconnecting_;    // 这一轮重连已经排上，直到连上或disconnect()
+    uint32_t retry_attempt_;            // 以下只在持有maint_lock_的重连工作中访问（开始一轮时除外）
+    uint32_t retry_backoff_round_;
+    bool retry_failover_;
+    ReconnectStats reconnect_stats_;    // 只由重连工作写入（fast_retries除外）
     
-    // 📦 内部配置常量
-    static constexpr int BUFFER_SIZE = 8192;                // 数据缓冲区大小（8KB）
-    static constexpr int TASK_STACK_SIZE = 8192;            // WebSocket任务栈大小
-    static constexpr int RECONNECT_TASK_STACK_SIZE = 4096;  // 重连任务栈大小
+    // 事件处理函数（connect()之前登记，之后只读）
+    struct Listener {
+        EventHandler inline_handler = nullptr;
+        void* inline_ctx = nullptr;
+        EventHandler deferred_handler = nullptr;
+        void* deferred_ctx = nullptr;
+    };
+    Listener listeners_[(size_t)EventType::COUNT];
+    // 事件队列里的一项：事件本身和数据的拷贝（处理时data指回这份拷贝）
+    struct DeferredEvent {
+        EventData event;
+        uint8_t data[EVENT_DATA_BYTES];
+    };
+    QueueHandle_t event_queue_;
+    StaticQueue_t event_queue_struct_;
+    uint8_t* event_queue_storage_;      // 在PSRAM上，队列长度×sizeof(DeferredEvent)
+    TaskHandle_t event_task_handle_;
+    std::atomic<uint32_t> dropped_events_;
+    LinkQualityCallback link_quality_callback_;
+
+    // 心跳（last_pong_us_和in-flight信息在WebSocket任务和心跳工作之间共享）
+    int heartbeat_interval_ms_;
+    int heartbeat_timeout_ms_;
+    uint32_t ping_seq_;
+    std::atomic<int64_t> last_pong_us_;
+    LinkQuality link_quality_;      // 只由WebSocket任务写入（timeouts除外）
+
+    // 路由提示（route_port_由WebSocket任务写入，applied_port_只在建连前访问）
+    std::atomic<int> route_port_;
+    int applied_port_;              // 客户端当前使用的提示端口，0=配置的地址
+    std::atomic<int32_t> move_delay_ms_;    // 🚚 服务器的move提示（-1=没有）
+
+    std::atomic<bool> binary_control_;  // 本次连接协商了二进制控制帧
+    std::atomic<uint8_t> dscp_;         // 当前连接的DSCP（见setDscp）
+
+    // 发送队列：每个通道一块定长槽位区，free_放空闲槽位号，ready_按入队顺序放待发消息。
+    // 生产者只做非阻塞的入队，所有esp_websocket_client_send_*（精简传输是NativeWs::send）都在发送任务里调用
+    struct SendCounters {
+        std::atomic<uint32_t> queued{0}, completed{0}, failed{0};
+        std::atomic<uint32_t> dropped_full{0}, dropped_stale{0}, dropped_offline{0};
+        std::atomic<uint32_t> max_depth{0}, max_wait_ms{0}, last_wait_ms{0}, write_us{0};
+    };
+    struct SendItem {
+        uint8_t slot;
+        uint8_t op_code;            // 0x01文本，0x02二进制
+        uint16_t len;
+        uint32_t connection_id;
+        int timeout_ms;             // 写socket的超时（portMAX_DELAY转成int是负数，按网络超时处理）
+        int64_t queued_us;
+        int64_t deadline_us;        // 0=不过期
+    };
+    struct SendLaneQueue {
+        uint8_t* slots = nullptr;
+        size_t slot_count = 0;
+        size_t slot_bytes = 0;
+        QueueHandle_t free = nullptr;
+        QueueHandle_t ready = nullptr;
+        SendCounters counters;
+    };
+    SendLaneQueue lanes_[(size_t)SendLane::COUNT];
+    void sendItem(SendLaneQueue& lane, const SendItem& item);
+    TaskHandle_t send_task_handle_;
+    std::atomic<bool> bulk_paused_;
+    StaticSemaphore_t client_lock_struct_;
+    SemaphoreHandle_t client_lock_;     // 发送任务写socket时持有，disconnect()销毁客户端前要拿到
+    std::atomic<uint32_t> connection_id_;   // 每次连上加一，入队时记录，换了连接的旧消息不再发
 };
 
 #endif // WEBSOCKET_CLIENT_H
\ No newline at end of file
@@ -12,21 +12,63 @@
  */
 
 #include "wifi_manager.h"
+#include "task_factory.h"
+#include "flash_scheduler.h"
 #include "esp_log.h"
 #include "esp_netif.h"
+#include "esp_timer.h"
 #include "nvs_flash.h"
+#include "nvs.h"
+#include "sdkconfig.h"
+#if CONFIG_ESP_WIFI_11KV_SUPPORT
+#include "esp_wnm.h"
+#endif
+#include <algorithm>
 #include <cstring>
 
 static const char *TAG = "WiFiManager";
+static const char *NVS_NAMESPACE = "wifi";
+
+// ⚡ NVS中保存的上次连上的AP（SSID不同就不用）
+struct CachedAp {
+    char ssid[33];
+    uint8_t bssid[6];
+    uint8_t channel;
+};
+
+// 🚄 性能配置的驱动参数（BALANCED不改，沿用sdkconfig）
+struct ProfileParams {
+    int static_rx_buf;      // 启动时分配、常驻内部RAM（每个约1.6KB）
+    int dynamic_rx_buf;     // 收包时按需分配，决定一次突发最多能缓存多少个包
+    int dynamic_tx_buf;
+    int rx_ba_win;          // 接收AMPDU的块确认窗口，不超过2×静态缓冲区和动态缓冲区的一半
+    bool ampdu_tx;
+    bool ht40;
+    int min_tcp_wnd;        // lwIP窗口小于这个值时缓冲区再多也跑不满（sdkconfig.defaults.throughput）
+};
+
+static const ProfileParams kProfiles[(size_t)WiFiManager::PerfProfile::COUNT] = {
+    { WiFiManager::LOW_MEMORY_STATIC_RX_BUFFERS, 16, 16, 4, false, false, 0 },    // LOW_MEMORY
+    { 0,  0,  0,  0,  true,  false, 0     },    // BALANCED
+    { WiFiManager::MAX_STATIC_RX_BUFFERS, 48, 48, 16, true, true, 23040 },    // HIGH_THROUGHPUT
+};
+static const char* const kProfileNames[(size_t)WiFiManager::PerfProfile::COUNT] = {
+    "low_memory", "balanced", "high_throughput",
+};
 
 // 🎯 静态成员初始化（这些变量在所有WiFiManager实例之间共享）
 EventGroupHandle_t WiFiManager::s_wifi_event_group = NULL;  // 事件组句柄
+static StaticEventGroup_t s_wifi_event_group_struct;        // 事件组的静态存储（删除后重建时复用）
 int WiFiManager::s_retry_num = 0;                          // 当前重试次数
 esp_ip4_addr_t WiFiManager::s_ip_addr = {0};               // IP地址结构体
 
 WiFiManager::WiFiManager(const std::string& ssid, const std::string& password, int max_retry)
     : ssid_(ssid), password_(password), max_retry_(max_retry), initialized_(false),
-      instance_any_id_(nullptr), instance_got_ip_(nullptr) {
+      fast_attempt_(false), connect_start_us_(0), netif_(nullptr), sta_config_{},
+      monitor_task_(nullptr), rssi_history_{}, rssi_count_(0), low_samples_(0), last_roam_us_(0),
+      btm_tried_(false), link_lock_(portMUX_INITIALIZER_UNLOCKED), busy_(false), ever_connected_(false),
+      roam_pending_(false), reconnect_due_us_(0), reconnect_delay_ms_(0), disconnects_(0),
+      pending_bssid_{}, pending_channel_(0), instance_any_id_(nullptr), instance_got_ip_(nullptr) {
 }
 
 WiFiManager::~WiFiManager() {
@@ -45,10 +87,39 @@ void WiFiManager::event_handler(void* arg, esp_event_base_t event_base,
     } 
     // 🔴 WiFi连接断开（可能是密码错误、信号太弱等）
     else if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_DISCONNECTED) {
+        wifi_event_sta_disconnected_t* event = (wifi_event_sta_disconnected_t*) event_data;
+        wifi_config_t& config = wifi_manager->sta_config_;
+        xEventGroupClearBits(s_wifi_event_group, WIFI_CONNECTED_BIT);
+        if (wifi_manager->ever_connected_) {
+            wifi_manager->disconnects_++;
+        }
+        if (wifi_manager->roam_pending_.exchange(false)) {
+            // 📡 主动漫游：目标AP已经写进配置，直接连
+            esp_wifi_connect();
+            return;
+        }
+        if (config.sta.bssid_set) {
+            // ⚡ 不再锁定上次的AP和信道，之后按SSID完整扫描
+            config.sta.bssid_set = false;
+            config.sta.channel = 0;
+            config.sta.scan_method = WIFI_ALL_CHANNEL_SCAN;
+            esp_wifi_set_config(WIFI_IF_STA, &config);
+        }
+        if (wifi_manager->fast_attempt_) {
+            // 上次的AP连不上（换了信道、下线或换了路由器），完整扫描一次，不算重试
+            wifi_manager->fast_attempt_ = false;
+            ESP_LOGW(TAG, "⚡ 快速连接失败（原因%d），改为完整扫描", event->reason);
+            clearCachedAp();
+            esp_wifi_connect();
+            return;
+        }
         if (s_retry_num < wifi_manager->max_retry_) {
             esp_wifi_connect();
             s_retry_num++;
             ESP_LOGI(TAG, "🔄 重试连接WiFi... (%d/%d)", s_retry_num, wifi_manager->max_retry_);
+        } else if (wifi_manager->ever_connected_ && wifi_manager->monitor_task_) {
+            // 连上过就不放弃（路由器重启、短暂出了覆盖范围），由监测任务按退避继续重连
+            wifi_manager->scheduleReconnect();
         } else {
             xEventGroupSetBits(s_wifi_event_group, WIFI_FAIL_BIT);
         }
@@ -59,6 +130,23 @@ void WiFiManager::event_handler(void* arg, esp_event_base_t event_base,
         ip_event_got_ip_t* event = (ip_event_got_ip_t*) event_data;
         s_ip_addr = event->ip_info.ip;
         ESP_LOGI(TAG, "🏠 获得IP地址:" IPSTR, IP2STR(&event->ip_info.ip));
+        if (wifi_manager->connect_start_us_ != 0) {
+            ESP_LOGI(TAG, "⏱️ WiFi连接耗时 %lld ms（%s）", (esp_timer_get_time() - wifi_manager->connect_start_us_) / 1000,
+                     wifi_manager->fast_attempt_ ? "快速连接" : "完整扫描");
+            wifi_manager->connect_start_us_ = 0;
+        }
+        wifi_manager->fast_attempt_ = false;
+        wifi_manager->ever_connected_ = true;
+        wifi_manager->reconnect_delay_ms_ = 0;
+        wifi_ap_record_t ap_info;
+        if (esp_wifi_sta_get_ap_info(&ap_info) == ESP_OK) {
+            if (wifi_manager->options_.fast_connect) {
+                wifi_manager->saveCachedAp(ap_info.bssid, ap_info.primary);
+            }
+            if (kProfiles[(size_t)wifi_manager->options_.perf_profile].ht40 && ap_info.second == WIFI_SECOND_CHAN_NONE) {
+                ESP_LOGI(TAG, "🚄 AP在信道%d上只用20MHz，HT40没有生效", ap_info.primary);
+            }
+        }
         s_retry_num = 0;  // 重置重试计数器
         xEventGroupSetBits(s_wifi_event_group, WIFI_CONNECTED_BIT);  // 设置连接成功标志
     }
@@ -71,11 +159,7 @@ esp_err_t WiFiManager::connect() {
     }
     
     // 🎯 创建事件组（用于等待WiFi连接结果）
-    s_wifi_event_group = xEventGroupCreate();
-    if (!s_wifi_event_group) {
-        ESP_LOGE(TAG, "❌ 创建事件组失败");
-        return ESP_FAIL;
-    }
+    s_wifi_event_group = xEventGroupCreateStatic(&s_wifi_event_group_struct);
     
     // 🌐 初始化TCP/IP协议栈（让ESP32能够使用网络）
     ESP_ERROR_CHECK(esp_netif_init());
@@ -88,10 +172,14 @@ esp_err_t WiFiManager::connect() {
     }
     
     // 📡 创建默认WiFi STA接口（STA=Station，即WiFi客户端模式）
-    esp_netif_create_default_wifi_sta();
+    netif_ = esp_netif_create_default_wifi_sta();
+    if (!options_.static_ip.empty()) {
+        applyStaticIp();
+    }
     
-    // 🔧 初始化WiFi驱动（使用默认配置）
+    // 🔧 初始化WiFi驱动（默认配置按性能配置改写缓冲区和AMPDU）
     wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
+    applyProfileInit(&cfg);
     ESP_ERROR_CHECK(esp_wifi_init(&cfg));
     
     // 🔔 注册事件处理函数
@@ -116,12 +204,36 @@ esp_err_t WiFiManager::connect() {
     std::strncpy((char*)wifi_config.sta.password, password_.c_str(), sizeof(wifi_config.sta.password) - 1);
     // 设置加密方式（至少WPA2，更安全）
     wifi_config.sta.threshold.authmode = WIFI_AUTH_WPA2_PSK;
+    // 📡 声明支持802.11k/v，AP可以在信号变差时推荐（或要求）切换到更好的AP
+    wifi_config.sta.rm_enabled = options_.roam_11kv;
+    wifi_config.sta.btm_enabled = options_.roam_11kv;
     // 支持WPA3加密（更高级的安全性）
     wifi_config.sta.sae_pwe_h2e = WPA3_SAE_PWE_BOTH;
+    // ⚡ 有上次的AP记录时只在那个信道上直连，不扫描其他信道（深度睡眠醒来时用睡前RTC里留的那个）
+    if (options_.fast_connect && options_.resume_channel != 0) {
+        std::memcpy(wifi_config.sta.bssid, options_.resume_bssid, sizeof(wifi_config.sta.bssid));
+        wifi_config.sta.channel = options_.resume_channel;
+        fast_attempt_ = true;
+    } else {
+        fast_attempt_ = options_.fast_connect && loadCachedAp(wifi_config.sta.bssid, &wifi_config.sta.channel);
+    }
+    if (fast_attempt_) {
+        wifi_config.sta.bssid_set = true;
+        wifi_config.sta.scan_method = WIFI_FAST_SCAN;
+        ESP_LOGI(TAG, "⚡ 快速连接上次的AP: %02x:%02x:%02x:%02x:%02x:%02x, 信道%d",
+                 wifi_config.sta.bssid[0], wifi_config.sta.bssid[1], wifi_config.sta.bssid[2],
+                 wifi_config.sta.bssid[3], wifi_config.sta.bssid[4], wifi_config.sta.bssid[5],
+                 wifi_config.sta.channel);
+    } else {
+        wifi_config.sta.scan_method = WIFI_ALL_CHANNEL_SCAN;
+    }
+    sta_config_ = wifi_config;
+    connect_start_us_ = esp_timer_get_time();
     
     // 🚀 设置WiFi工作模式并启动
     ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA));      // 设为客户端模式
-    ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &wifi_config));  // 应用配置
+    applyProfileLink();
+    ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &sta_config_));  // 应用配置
     ESP_ERROR_CHECK(esp_wifi_start());                      // 启动WiFi
     
     ESP_LOGI(TAG, "📶 WiFi初始化完成，正在连接到 %s", ssid_.c_str());
@@ -223,4 +335,308 @@ int8_t WiFiManager::getRssi() const {
         return ap_info.rssi;  // 返回信号强度（负数，越接近0信号越好）
     }
     return 0;
-}
\ No newline at end of file
+}
+
+bool WiFiManager::loadCachedAp(uint8_t bssid[6], uint8_t* channel) const {
+    nvs_handle_t nvs;
+    if (nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK) {
+        return false;   // 从没连上过
+    }
+    CachedAp ap = {};
+    size_t len = sizeof(ap);
+    esp_err_t ret = nvs_get_blob(nvs, "ap", &ap, &len);
+    nvs_close(nvs);
+    if (ret != ESP_OK || len != sizeof(ap) || ap.channel == 0 ||
+        strncmp(ap.ssid, ssid_.c_str(), sizeof(ap.ssid)) != 0) {
+        return false;
+    }
+    memcpy(bssid, ap.bssid, sizeof(ap.bssid));
+    *channel = ap.channel;
+    return true;
+}
+
+void WiFiManager::saveCachedAp(const uint8_t bssid[6], uint8_t channel) {
+    // 会话中漫游也会走到这里，写NVS等空闲时再做；还没写的那份总是换成最新的AP
+    portENTER_CRITICAL(&link_lock_);
+    memcpy(pending_bssid_, bssid, sizeof(pending_bssid_));
+    pending_channel_ = channel;
+    portEXIT_CRITICAL(&link_lock_);
+    uint8_t cached_bssid[6];
+    uint8_t cached_channel = 0;
+    if (loadCachedAp(cached_bssid, &cached_channel) && cached_channel == channel &&
+        memcmp(cached_bssid, bssid, sizeof(cached_bssid)) == 0) {
+        return;     // 没变化就不写Flash
+    }
+    FlashScheduler::defer("wifi_ap", writeCachedAp, this);
+}
+
+esp_err_t WiFiManager::writeCachedAp(void* ctx) {
+    WiFiManager* self = (WiFiManager*)ctx;
+    CachedAp ap = {};
+    strncpy(ap.ssid, self->ssid_.c_str(), sizeof(ap.ssid) - 1);
+    portENTER_CRITICAL(&self->link_lock_);
+    memcpy(ap.bssid, self->pending_bssid_, sizeof(ap.bssid));
+    ap.channel = self->pending_channel_;
+    portEXIT_CRITICAL(&self->link_lock_);
+
+    nvs_handle_t nvs;
+    esp_err_t ret = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ret = nvs_set_blob(nvs, "ap", &ap, sizeof(ap));
+    if (ret == ESP_OK) {
+        ret = nvs_commit(nvs);
+    }
+    nvs_close(nvs);
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "⚡ 已记住AP（信道%d），下次启动直接连接", ap.channel);
+    }
+    return ret;
+}
+
+void WiFiManager::clearCachedAp() {
+    nvs_handle_t nvs;
+    if (nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs) != ESP_OK) {
+        return;
+    }
+    if (nvs_erase_key(nvs, "ap") == ESP_OK) {
+        nvs_commit(nvs);
+    }
+    nvs_close(nvs);
+}
+
+void WiFiManager::applyStaticIp() {
+    esp_netif_ip_info_t ip_info = {};
+    if (esp_netif_str_to_ip4(options_.static_ip.c_str(), &ip_info.ip) != ESP_OK ||
+        esp_netif_str_to_ip4(options_.netmask.c_str(), &ip_info.netmask) != ESP_OK) {
+        ESP_LOGW(TAG, "⚠️ 静态IP配置无效（%s/%s），使用DHCP", options_.static_ip.c_str(), options_.netmask.c_str());
+        return;
+    }
+    if (options_.gateway.empty() || esp_netif_str_to_ip4(options_.gateway.c_str(), &ip_info.gw) != ESP_OK) {
+        // 默认网关取同网段的.1（lwIP的地址是网络字节序，最后一段在高字节）
+        ip_info.gw.addr = (ip_info.ip.addr & ip_info.netmask.addr) | (1u << 24);
+    }
+
+    esp_err_t ret = esp_netif_dhcpc_stop(netif_);
+    if (ret == ESP_OK) {
+        ret = esp_netif_set_ip_info(netif_, &ip_info);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "⚠️ 设置静态IP失败: %s，使用DHCP", esp_err_to_name(ret));
+        return;
+    }
+    esp_netif_dns_info_t dns = {};
+    if (options_.dns.empty() || esp_netif_str_to_ip4(options_.dns.c_str(), &dns.ip.u_addr.ip4) != ESP_OK) {
+        dns.ip.u_addr.ip4 = ip_info.gw;
+    }
+    dns.ip.type = ESP_IPADDR_TYPE_V4;
+    esp_netif_set_dns_info(netif_, ESP_NETIF_DNS_MAIN, &dns);
+    ESP_LOGI(TAG, "🏠 使用静态IP: %s（不走DHCP）", options_.static_ip.c_str());
+}
+
+const char* WiFiManager::profileName(PerfProfile profile) {
+    return profile < PerfProfile::COUNT ? kProfileNames[(size_t)profile] : "?";
+}
+
+void WiFiManager::applyProfileInit(wifi_init_config_t* cfg) const {
+    const ProfileParams& p = kProfiles[(size_t)options_.perf_profile];
+    if (p.static_rx_buf > 0) {
+        cfg->static_rx_buf_num = p.static_rx_buf;
+        cfg->dynamic_rx_buf_num = p.dynamic_rx_buf;
+        cfg->dynamic_tx_buf_num = p.dynamic_tx_buf;
+        cfg->rx_ba_win = std::min({ p.rx_ba_win, 2 * p.static_rx_buf, p.dynamic_rx_buf / 2 });
+    }
+    cfg->ampdu_tx_enable = cfg->ampdu_tx_enable && p.ampdu_tx;    // sdkconfig里关掉的不能在这里打开
+    ESP_LOGI(TAG, "🚄 WiFi性能配置 %s: 接收缓冲区 %d+%d, 发送缓冲区 %d, AMPDU 收%s/发%s, 接收BA窗口 %d, %s",
+             profileName(options_.perf_profile), cfg->static_rx_buf_num, cfg->dynamic_rx_buf_num,
+             cfg->dynamic_tx_buf_num, cfg->ampdu_rx_enable ? "开" : "关", cfg->ampdu_tx_enable ? "开" : "关",
+             cfg->rx_ba_win, p.ht40 ? "HT40" : "HT20");
+
+    // 对端按lwIP通告的窗口一口气发过来，驱动的动态接收缓冲区装不下时就在驱动里丢包重传
+    if (CONFIG_LWIP_TCP_WND_DEFAULT > cfg->dynamic_rx_buf_num * CONFIG_LWIP_TCP_MSS) {
+        ESP_LOGW(TAG, "⚠️ TCP窗口 %d 字节超过 %d 个接收缓冲区能装下的量，突发下行会在驱动里丢包",
+                 CONFIG_LWIP_TCP_WND_DEFAULT, cfg->dynamic_rx_buf_num);
+    }
+    if (CONFIG_LWIP_TCP_WND_DEFAULT < p.min_tcp_wnd) {
+        ESP_LOGW(TAG, "⚠️ %s配置下TCP窗口 %d 字节仍是瓶颈，用sdkconfig.defaults.throughput构建",
+                 profileName(options_.perf_profile), CONFIG_LWIP_TCP_WND_DEFAULT);
+    }
+}
+
+void WiFiManager::applyProfileLink() const {
+    const ProfileParams& p = kProfiles[(size_t)options_.perf_profile];
+    esp_wifi_set_protocol(WIFI_IF_STA, WIFI_PROTOCOL_11B | WIFI_PROTOCOL_11G | WIFI_PROTOCOL_11N);
+    esp_err_t ret = esp_wifi_set_bandwidth(WIFI_IF_STA, p.ht40 ? WIFI_BW_HT40 : WIFI_BW_HT20);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "⚠️ 设置带宽失败: %s", esp_err_to_name(ret));
+    }
+}
+
+esp_err_t WiFiManager::startLinkMonitor() {
+    if (monitor_task_) {
+        return ESP_OK;
+    }
+    // 漫游时esp_wifi_set_config()会把配置写进NVS，栈留在内部RAM
+    if (TaskFactory::create(monitor_task, "wifi_monitor", MONITOR_TASK_STACK, this, options_.monitor_task_priority,
+                            &monitor_task_, options_.monitor_task_core, TaskStack::INTERNAL) != pdPASS) {
+        monitor_task_ = nullptr;
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "📡 链路监测已启动: 每%lu ms采样, 漫游阈值%d dBm",
+             (unsigned long)options_.monitor_interval_ms, options_.roam_rssi_dbm);
+    return ESP_OK;
+}
+
+WiFiManager::LinkQuality WiFiManager::getLinkQuality() const {
+    portENTER_CRITICAL(&link_lock_);
+    LinkQuality q = link_;
+    portEXIT_CRITICAL(&link_lock_);
+    return q;
+}
+
+void WiFiManager::scheduleReconnect() {
+    reconnect_delay_ms_ = reconnect_delay_ms_ == 0 ? 1000 : std::min(reconnect_delay_ms_ * 2, options_.reconnect_max_ms);
+    reconnect_due_us_ = esp_timer_get_time() + (int64_t)reconnect_delay_ms_ * 1000;
+    ESP_LOGW(TAG, "🔄 WiFi仍未连上，%lu ms后再试", (unsigned long)reconnect_delay_ms_);
+}
+
+void WiFiManager::monitor_task(void* arg) {
+    WiFiManager* self = static_cast<WiFiManager*>(arg);
+    while (true) {
+        vTaskDelay(pdMS_TO_TICKS(self->options_.monitor_interval_ms));
+        int64_t due = self->reconnect_due_us_.load();
+        if (due != 0 && esp_timer_get_time() >= due) {
+            self->reconnect_due_us_ = 0;
+            s_retry_num = 0;    // 新的一轮重试
+            esp_wifi_connect();
+        }
+        self->sampleLink();
+    }
+}
+
+void WiFiManager::sampleLink() {
+    LinkQuality q = link_;
+    q.disconnects = disconnects_.load();
+    wifi_ap_record_t ap_info;
+    bool connected = s_wifi_event_group && (xEventGroupGetBits(s_wifi_event_group) & WIFI_CONNECTED_BIT) &&
+                     esp_wifi_sta_get_ap_info(&ap_info) == ESP_OK;
+    if (!connected) {
+        q.level = LinkQuality::Level::DOWN;
+        rssi_count_ = 0;
+        low_samples_ = 0;
+        btm_tried_ = false;
+    } else {
+        rssi_history_[rssi_count_ % RSSI_HISTORY_LEN] = ap_info.rssi;
+        rssi_count_++;
+        int n = std::min(rssi_count_, RSSI_HISTORY_LEN);
+        int avg_n = std::min(n, RSSI_AVG_SAMPLES);
+        int sum = 0;
+        int8_t min_rssi = 0;
+        for (int i = 0; i < n; i++) {
+            int8_t r = rssi_history_[(rssi_count_ - 1 - i) % RSSI_HISTORY_LEN];
+            if (i < avg_n) {
+                sum += r;
+            }
+            min_rssi = i == 0 ? r : std::min(min_rssi, r);
+        }
+        q.rssi = ap_info.rssi;
+        q.rssi_avg = (int8_t)(sum / avg_n);
+        q.rssi_min = min_rssi;
+        q.level = q.rssi_avg >= options_.good_rssi_dbm ? LinkQuality::Level::GOOD
+                : q.rssi_avg >= options_.roam_rssi_dbm ? LinkQuality::Level::FAIR
+                : LinkQuality::Level::POOR;
+        if (q.level == LinkQuality::Level::POOR) {
+            low_samples_++;
+        } else {
+            low_samples_ = 0;
+            btm_tried_ = false;
+        }
+    }
+
+    bool changed = q.level != link_.level;
+    portENTER_CRITICAL(&link_lock_);
+    link_ = q;
+    portEXIT_CRITICAL(&link_lock_);
+    if (changed) {
+        static const char* const kLevelNames[] = { "GOOD", "FAIR", "POOR", "DOWN" };
+        ESP_LOGI(TAG, "📡 链路质量 %s: RSSI %d dBm（平均%d，最差%d），断开%lu次，漫游%lu次",
+                 kLevelNames[(int)q.level], q.rssi, q.rssi_avg, q.rssi_min,
+                 (unsigned long)q.disconnects, (unsigned long)q.roams);
+        if (link_callback_) {
+            link_callback_(q);
+        }
+    }
+
+    if (low_samples_ >= ROAM_LOW_SAMPLES &&
+        esp_timer_get_time() - last_roam_us_ >= (int64_t)options_.roam_cooldown_ms * 1000) {
+        tryRoam();
+    }
+}
+
+void WiFiManager::tryRoam() {
+    last_roam_us_ = esp_timer_get_time();
+#if CONFIG_ESP_WIFI_11KV_SUPPORT
+    if (options_.roam_11kv && !btm_tried_ && esp_wnm_is_btm_supported_connection()) {
+        // AP知道周围还有哪些AP，让它推荐；supplicant收到BTM请求后自动切换
+        btm_tried_ = true;
+        if (esp_wnm_send_bss_transition_mgmt_query(REASON_RSSI, NULL, 0) == 0) {
+            ESP_LOGI(TAG, "📡 信号变差（平均%d dBm），已请求AP推荐漫游目标", link_.rssi_avg);
+            portENTER_CRITICAL(&link_lock_);
+            link_.roams++;
+            portEXIT_CRITICAL(&link_lock_);
+            return;
+        }
+    }
+#endif
+    if (busy_) {
+        return;     // 会话中不做离信道扫描，等回到空闲再说
+    }
+    if (scanForBetterAp(link_.rssi)) {
+        portENTER_CRITICAL(&link_lock_);
+        link_.roams++;
+        portEXIT_CRITICAL(&link_lock_);
+    }
+}
+
+bool WiFiManager::scanForBetterAp(int8_t current_rssi) {
+    wifi_ap_record_t current;
+    if (esp_wifi_sta_get_ap_info(&current) != ESP_OK) {
+        return false;
+    }
+    wifi_scan_config_t scan = {};
+    scan.ssid = (uint8_t*)ssid_.c_str();
+    if (esp_wifi_scan_start(&scan, true) != ESP_OK) {
+        return false;
+    }
+    wifi_ap_record_t records[8];
+    uint16_t count = sizeof(records) / sizeof(records[0]);
+    if (esp_wifi_scan_get_ap_records(&count, records) != ESP_OK) {
+        return false;
+    }
+
+    const wifi_ap_record_t* best = nullptr;
+    for (uint16_t i = 0; i < count; i++) {
+        if (memcmp(records[i].bssid, current.bssid, sizeof(current.bssid)) == 0) {
+            continue;
+        }
+        if (records[i].rssi >= current_rssi + options_.roam_hysteresis_db && (!best || records[i].rssi > best->rssi)) {
+            best = &records[i];
+        }
+    }
+    if (!best) {
+        ESP_LOGI(TAG, "📡 没有找到比当前（%d dBm）更好的AP", current_rssi);
+        return false;
+    }
+
+    ESP_LOGI(TAG, "📡 漫游到 %02x:%02x:%02x:%02x:%02x:%02x（信道%d, %d dBm）",
+             best->bssid[0], best->bssid[1], best->bssid[2], best->bssid[3], best->bssid[4], best->bssid[5],
+             best->primary, best->rssi);
+    memcpy(sta_config_.sta.bssid, best->bssid, sizeof(sta_config_.sta.bssid));
+    sta_config_.sta.bssid_set = true;
+    sta_config_.sta.channel = best->primary;
+    esp_wifi_set_config(WIFI_IF_STA, &sta_config_);
+    roam_pending_ = true;
+    esp_wifi_disconnect();
+    return true;
+}
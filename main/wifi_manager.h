@@ -4,6 +4,9 @@
 #include "esp_wifi.h"
 #include "esp_event.h"
 #include "freertos/event_groups.h"
+#include "freertos/task.h"
+#include <atomic>
+#include <functional>
 #include <string>
 
 /**
@@ -19,6 +22,69 @@
  */
 class WiFiManager {
 public:
+    /**
+     * @brief 🚄 WiFi性能配置（esp_wifi_init之前选定，运行中不能切换）
+     *
+     * - LOW_MEMORY：收发缓冲区减半，只开接收AMPDU，HT20，省下十几KB内部RAM
+     * - BALANCED：和IDF默认一样（sdkconfig里的缓冲区数量、AMPDU），HT20
+     * - HIGH_THROUGHPUT：接收/发送缓冲区和接收BA窗口加大，开HT40，下行TTS突发能把链路跑满；
+     *   lwIP的TCP窗口是编译时的，要配合sdkconfig.defaults.throughput一起用，否则窗口仍然是瓶颈
+     *
+     * HT40在拥挤的2.4GHz上AP通常会退回20MHz，效果因现场而异，用网络自检（net_self_test.h）对比
+     */
+    enum class PerfProfile : uint8_t { LOW_MEMORY, BALANCED, HIGH_THROUGHPUT, COUNT };
+
+    static constexpr uint32_t MONITOR_TASK_STACK = 3 * 1024;    // 链路监测任务栈（内部RAM）
+    static constexpr int MAX_STATIC_RX_BUFFERS = 16;            // HIGH_THROUGHPUT的静态接收缓冲区数（内存预算按它算）
+    static constexpr int LOW_MEMORY_STATIC_RX_BUFFERS = 6;      // LOW_MEMORY的静态接收缓冲区数（低内存构建的预算按它算）
+    static constexpr uint32_t STATIC_RX_BUFFER_BYTES = 1600;    // 每个静态接收缓冲区约1.6KB，常驻内部RAM
+
+    static const char* profileName(PerfProfile profile);
+
+    /**
+     * @brief ⚡ 连接选项（connect()之前设置）
+     *
+     * 上电到连上WiFi的时间主要花在全信道扫描和DHCP上：
+     * - fast_connect：连上后把AP的BSSID和信道存进NVS，下次只在这个信道上直接连这个AP，
+     *   连不上（AP换了信道或下线）再退回完整扫描，不计入重试次数
+     * - static_ip：非空时不走DHCP（DHCP续用上次的地址由lwIP的CONFIG_LWIP_DHCP_RESTORE_LAST_IP负责）
+     */
+    struct ConnectOptions {
+        bool fast_connect = true;
+        uint8_t resume_bssid[6] = {};           // 🌙 深度睡眠前连着的AP（resume_channel=0表示没有，用NVS里的记录）
+        uint8_t resume_channel = 0;
+        std::string static_ip;                  // 如"192.168.1.50"，空=DHCP
+        std::string netmask = "255.255.255.0";
+        std::string gateway;                    // 空=与IP同网段的.1
+        std::string dns;                        // 空=网关
+        PerfProfile perf_profile = PerfProfile::BALANCED;
+
+        // 📡 链路监测和漫游（startLinkMonitor()之后生效）
+        int good_rssi_dbm = -65;                // 平均RSSI高于这个值为GOOD
+        int roam_rssi_dbm = -75;                // 低于这个值为POOR，持续一段时间后尝试漫游
+        bool roam_11kv = true;                  // 先请AP推荐更好的AP（802.11v BTM，需要CONFIG_ESP_WIFI_11KV_SUPPORT）
+        int roam_hysteresis_db = 8;             // 自己扫描时，新AP至少比当前强这么多才切换
+        uint32_t roam_cooldown_ms = 30000;      // 两次漫游尝试的最小间隔
+        uint32_t monitor_interval_ms = 1000;    // RSSI采样间隔
+        uint32_t reconnect_max_ms = 30000;      // 连上过之后断开：重试max_retry次后按退避一直重连，最长间隔
+        int monitor_task_priority = 2;
+        int monitor_task_core = tskNO_AFFINITY;
+    };
+
+    /**
+     * @brief 📡 链路质量（监测任务每次采样更新，等级变化时回调）
+     */
+    struct LinkQuality {
+        enum class Level : uint8_t { GOOD, FAIR, POOR, DOWN };
+        Level level = Level::DOWN;
+        int8_t rssi = 0;            // 最新采样
+        int8_t rssi_avg = 0;        // 最近几次的平均（判断等级用，避免单次抖动）
+        int8_t rssi_min = 0;        // 历史窗口内最差
+        uint32_t disconnects = 0;   // 连上之后的断开次数
+        uint32_t roams = 0;         // 发起的漫游次数
+    };
+    using LinkCallback = std::function<void(const LinkQuality&)>;
+
     /**
      * @brief 创建WiFi管理器
      * 
@@ -46,6 +112,31 @@ public:
      * @return ESP_OK=连接成功，ESP_FAIL=连接失败
      */
     esp_err_t connect();
+
+    void setConnectOptions(const ConnectOptions& options) { options_ = options; }
+
+    PerfProfile perfProfile() const { return options_.perf_profile; }
+
+    /**
+     * @brief 📡 启动链路监测任务（connect()成功之后调用）
+     *
+     * 每monitor_interval_ms采样一次RSSI，保留最近RSSI_HISTORY_LEN次；
+     * 平均RSSI持续低于roam_rssi_dbm时先发BTM请求让AP推荐，仍然不行再自己扫描同名AP切换
+     * （会话中不做离信道扫描，避免音频中断，见setBusy）。连上过之后的断开不再放弃，按退避一直重连。
+     */
+    esp_err_t startLinkMonitor();
+
+    /**
+     * @brief 等级变化时回调（在监测任务中执行）
+     */
+    void setLinkCallback(LinkCallback cb) { link_callback_ = cb; }
+
+    /**
+     * @brief 会话中置为true：漫游只发BTM请求，不做会打断收发的扫描
+     */
+    void setBusy(bool busy) { busy_ = busy; }
+
+    LinkQuality getLinkQuality() const;
     
     /**
      * @brief 🔌 断开WiFi连接
@@ -90,11 +181,33 @@ private:
     // 当WiFi发生事件时（如连接、断开、获得IP等），系统会调用这个函数
     static void event_handler(void* arg, esp_event_base_t event_base,
                             int32_t event_id, void* event_data);
+
+    // ⚡ 快速连接：NVS中的上次AP、静态IP
+    bool loadCachedAp(uint8_t bssid[6], uint8_t* channel) const;
+    void saveCachedAp(const uint8_t bssid[6], uint8_t channel);
+    static esp_err_t writeCachedAp(void* ctx);     // FlashScheduler在空闲时调用
+    static void clearCachedAp();
+    void applyStaticIp();
+
+    // 🚄 性能配置：改写esp_wifi_init的缓冲区参数，esp_wifi_set_mode之后设带宽
+    void applyProfileInit(wifi_init_config_t* cfg) const;
+    void applyProfileLink() const;
+
+    // 📡 链路监测
+    static constexpr int RSSI_HISTORY_LEN = 16;
+    static constexpr int RSSI_AVG_SAMPLES = 4;
+    static constexpr int ROAM_LOW_SAMPLES = 5;     // 连续这么多次POOR才尝试漫游
+    static void monitor_task(void* arg);
+    void sampleLink();
+    void tryRoam();
+    bool scanForBetterAp(int8_t current_rssi);
+    void scheduleReconnect();
     
     // 🔐 配置参数
     std::string ssid_;              // WiFi网络名称
     std::string password_;          // WiFi密码
     int max_retry_;                 // 最大重试次数
+    ConnectOptions options_;
     
     // 📊 状态管理
     static EventGroupHandle_t s_wifi_event_group;  // 事件组句柄（用于线程同步）
@@ -104,6 +217,29 @@ private:
     
     // 🟢 状态变量
     bool initialized_;              // 是否已初始化
+    bool fast_attempt_;             // 正在用NVS中的BSSID/信道直连，失败时改为完整扫描
+    int64_t connect_start_us_;      // 开始连接的时间，用于统计连接耗时
+    esp_netif_t* netif_;
+    wifi_config_t sta_config_;      // 断开后重连时可能要去掉BSSID锁定，保留一份
+
+    // 📡 链路监测状态（除标注外只在监测任务中访问）
+    TaskHandle_t monitor_task_;
+    LinkCallback link_callback_;
+    int8_t rssi_history_[RSSI_HISTORY_LEN];
+    int rssi_count_;
+    int low_samples_;
+    int64_t last_roam_us_;
+    bool btm_tried_;                // 这次信号变差已经发过BTM请求，下次改为自己扫描
+    LinkQuality link_;              // getLinkQuality()在其他任务中读取，用link_lock_保护
+    mutable portMUX_TYPE link_lock_;
+    std::atomic<bool> busy_;
+    std::atomic<bool> ever_connected_;      // 事件任务写入
+    std::atomic<bool> roam_pending_;        // 主动漫游：新AP已写入配置，断开后直接连它
+    std::atomic<int64_t> reconnect_due_us_; // 事件任务安排，监测任务到时间发起重连
+    uint32_t reconnect_delay_ms_;           // 事件任务中访问
+    std::atomic<uint32_t> disconnects_;
+    uint8_t pending_bssid_[6];              // 等空闲时写进NVS的AP（用link_lock_保护）
+    uint8_t pending_channel_;
     
     // 🎟️ 事件处理器句柄
     esp_event_handler_instance_t instance_any_id_;  // 处理所有WiFi事件
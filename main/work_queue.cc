@@ -0,0 +1,168 @@
+/**
+ * @file work_queue.cc
+ * @brief 🧰 后台工作队列
+ */
+
+#include "work_queue.h"
+#include "esp_log.h"
+#include "project_config.h"
+#include "task_factory.h"
+
+const char* WorkQueue::TAG = "WorkQueue";
+
+static void note_max(std::atomic<uint32_t>& slot, uint32_t value) {
+    uint32_t seen = slot.load(std::memory_order_relaxed);
+    while (value > seen && !slot.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {
+    }
+}
+
+esp_err_t WorkQueue::start() {
+    if (running_.load()) {
+        return ESP_OK;
+    }
+    pending_ = xSemaphoreCreateCounting(WORK_QUEUE_DEPTH * (size_t)WorkPriority::COUNT, 0);
+    if (pending_ == nullptr) {
+        return ESP_ERR_NO_MEM;
+    }
+    for (QueueHandle_t& queue : queues_) {
+        queue = xQueueCreate(WORK_QUEUE_DEPTH, sizeof(Item));
+        if (queue == nullptr) {
+            ESP_LOGE(TAG, "❌ 工作队列创建失败");
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    for (int i = 0; i < WORK_QUEUE_WORKERS; i++) {
+        // 同名的PSRAM栈可以被复用（见task_factory.h），每个工作任务各用一个名字
+        static const char* const kNames[] = {"work_0", "work_1", "work_2", "work_3"};
+        static_assert(WORK_QUEUE_WORKERS <= sizeof(kNames) / sizeof(kNames[0]), "工作任务名字不够");
+        if (TaskFactory::create(worker_task, kNames[i], WORK_QUEUE_TASK_STACK, nullptr, WORK_QUEUE_TASK_PRIORITY,
+                                nullptr, WORK_QUEUE_TASK_CORE, TaskStack::PSRAM) != pdPASS) {
+            ESP_LOGE(TAG, "❌ 创建工作任务%d失败", i);
+            return i == 0 ? ESP_ERR_NO_MEM : ESP_OK;
+        }
+        running_ = true;
+    }
+    ESP_LOGI(TAG, "🧰 后台工作队列已启动：%d个工作任务，每级最多排队%d个", WORK_QUEUE_WORKERS, WORK_QUEUE_DEPTH);
+    return ESP_OK;
+}
+
+bool WorkQueue::post(WorkFn fn, void* ctx, WorkPriority priority) {
+    if (!running_.load()) {
+        return false;
+    }
+    Item item = {fn, ctx, esp_timer_get_time()};
+    if (xQueueSend(queues_[(size_t)priority], &item, 0) != pdTRUE) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        ESP_LOGW(TAG, "⚠️ 工作队列满，丢弃一个工作");
+        return false;
+    }
+    posted_.fetch_add(1, std::memory_order_relaxed);
+    xSemaphoreGive(pending_);
+    return true;
+}
+
+void WorkQueue::worker_task(void* arg) {
+    while (true) {
+        xSemaphoreTake(pending_, portMAX_DELAY);
+        // 信号量计的是总数，高优先级的先取
+        Item item;
+        bool got = false;
+        for (QueueHandle_t queue : queues_) {
+            if (xQueueReceive(queue, &item, 0) == pdTRUE) {
+                got = true;
+                break;
+            }
+        }
+        if (!got) {
+            continue;
+        }
+        int64_t start_us = esp_timer_get_time();
+        note_max(max_wait_ms_, (uint32_t)((start_us - item.posted_us) / 1000));
+        item.fn(item.ctx);
+        note_max(max_run_ms_, (uint32_t)((esp_timer_get_time() - start_us) / 1000));
+        completed_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+WorkQueue::Stats WorkQueue::getStats() {
+    Stats stats;
+    stats.posted = posted_.load(std::memory_order_relaxed);
+    stats.completed = completed_.load(std::memory_order_relaxed);
+    stats.dropped = dropped_.load(std::memory_order_relaxed);
+    stats.coalesced = coalesced_.load(std::memory_order_relaxed);
+    stats.max_wait_ms = max_wait_ms_.load(std::memory_order_relaxed);
+    stats.max_run_ms = max_run_ms_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+WorkQueue::Timer::~Timer() {
+    if (timer_ != nullptr) {
+        esp_timer_stop(timer_);
+        esp_timer_delete(timer_);
+    }
+}
+
+esp_err_t WorkQueue::Timer::init(const char* name, WorkFn fn, void* ctx, WorkPriority priority) {
+    if (timer_ != nullptr) {
+        return ESP_OK;
+    }
+    fn_ = fn;
+    ctx_ = ctx;
+    priority_ = priority;
+    esp_timer_create_args_t args = {};
+    args.callback = on_timer;
+    args.arg = this;
+    args.name = name;
+    args.skip_unhandled_events = true;
+    esp_err_t err = esp_timer_create(&args, &timer_);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "❌ 定时器%s创建失败: %s", name, esp_err_to_name(err));
+        timer_ = nullptr;
+    }
+    return err;
+}
+
+esp_err_t WorkQueue::Timer::startPeriodic(uint32_t period_ms) {
+    if (timer_ == nullptr) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_timer_stop(timer_);
+    return esp_timer_start_periodic(timer_, (uint64_t)period_ms * 1000);
+}
+
+esp_err_t WorkQueue::Timer::startOnce(uint32_t delay_ms) {
+    if (timer_ == nullptr) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_timer_stop(timer_);
+    if (delay_ms == 0) {
+        on_timer(this);
+        return ESP_OK;
+    }
+    return esp_timer_start_once(timer_, (uint64_t)delay_ms * 1000);
+}
+
+void WorkQueue::Timer::stop() {
+    // 已经投进队列的那一次照常执行
+    if (timer_ != nullptr) {
+        esp_timer_stop(timer_);
+    }
+}
+
+void WorkQueue::Timer::on_timer(void* arg) {
+    // esp_timer任务里：只投递，不执行
+    Timer* timer = static_cast<Timer*>(arg);
+    if (timer->pending_.exchange(true)) {
+        coalesced_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (!post(run, timer, timer->priority_)) {
+        timer->pending_ = false;
+    }
+}
+
+void WorkQueue::Timer::run(void* arg) {
+    Timer* timer = static_cast<Timer*>(arg);
+    timer->pending_ = false;    // 执行期间再到期的会重新投递
+    timer->fn_(timer->ctx_);
+}
@@ -0,0 +1,112 @@
+/**
+ * @file work_queue.h
+ * @brief 🧰 后台工作队列 - 重连、心跳这类零碎的后台活共用几个工作任务，不再每样单独开一个任务
+ *
+ * 每个后台杂活一个任务时，任务大部分时间在阻塞等待，栈却一直占着（ws_reconnect就是4KB），
+ * 以后的统计、遥测、日志、提示音解码再各加一个，空闲任务和栈会越来越多。这里改成：
+ *
+ * - WORK_QUEUE_WORKERS个工作任务，在非实时的网络核心上（WORK_QUEUE_TASK_CORE），栈在PSRAM
+ * - 两级优先：HIGH（重连、心跳）总是先于LOW（统计、上报）取出，同一级按投递顺序
+ * - post()只把函数指针和上下文放进队列，不分配内存、不阻塞，任意任务和esp_timer回调里都能调用
+ * - Timer：esp_timer到期时把工作投进队列（周期或单次）；上一次投递还没执行时不重复投递
+ *
+ * 工作函数跑在共用的任务里：可以等一会儿（比如等一次握手，几秒以内），但不能无限期阻塞，
+ * 栈在PSRAM上所以不能写Flash（NVS、OTA、分区），这类任务仍然单独创建（见task_factory.h）。
+ */
+
+#ifndef WORK_QUEUE_H
+#define WORK_QUEUE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+enum class WorkPriority : uint8_t {
+    HIGH = 0,       // 连接维护：重连、心跳
+    LOW,            // 统计、遥测、日志等可以晚一点的
+    COUNT
+};
+
+class WorkQueue {
+public:
+    using WorkFn = void (*)(void* ctx);
+
+    struct Stats {
+        uint32_t posted;        // 累计投递
+        uint32_t completed;     // 累计执行完
+        uint32_t dropped;       // 队列满被拒的投递
+        uint32_t coalesced;     // 定时器到期时上一次还没执行、没有重复投递的次数
+        uint32_t max_wait_ms;   // 投递到开始执行的最长等待
+        uint32_t max_run_ms;    // 单个工作最长的执行时间
+    };
+
+    /**
+     * @brief 定时投递的工作（对象的生命周期要长过定时器，一般是成员变量或静态变量）
+     */
+    class Timer {
+    public:
+        Timer() = default;
+        ~Timer();
+
+        /**
+         * @brief 创建定时器（只创建一次，之后可以反复start/stop）
+         */
+        esp_err_t init(const char* name, WorkFn fn, void* ctx, WorkPriority priority = WorkPriority::LOW);
+
+        esp_err_t startPeriodic(uint32_t period_ms);
+
+        /**
+         * @brief delay_ms后投递一次（0=立即投递）；已经在计时的先取消
+         */
+        esp_err_t startOnce(uint32_t delay_ms);
+
+        void stop();
+
+    private:
+        static void on_timer(void* arg);
+        static void run(void* arg);
+
+        esp_timer_handle_t timer_ = nullptr;
+        WorkFn fn_ = nullptr;
+        void* ctx_ = nullptr;
+        WorkPriority priority_ = WorkPriority::LOW;
+        std::atomic<bool> pending_{false};     // 已经投进队列、还没执行
+    };
+
+    /**
+     * @brief 创建队列和工作任务（可以重复调用）
+     */
+    static esp_err_t start();
+
+    static bool isRunning() { return running_.load(); }
+
+    /**
+     * @brief 投递一个工作，队列满时返回false（不等待）
+     */
+    static bool post(WorkFn fn, void* ctx, WorkPriority priority = WorkPriority::LOW);
+
+    static Stats getStats();
+
+private:
+    struct Item {
+        WorkFn fn;
+        void* ctx;
+        int64_t posted_us;
+    };
+
+    static void worker_task(void* arg);
+
+    static const char* TAG;
+    static inline std::atomic<bool> running_{false};
+    static inline QueueHandle_t queues_[(size_t)WorkPriority::COUNT] = {};
+    static inline SemaphoreHandle_t pending_ = nullptr;    // 各级队列里的工作总数
+    static inline std::atomic<uint32_t> posted_{0}, completed_{0}, dropped_{0}, coalesced_{0};
+    static inline std::atomic<uint32_t> max_wait_ms_{0}, max_run_ms_{0};
+};
+
+#endif // WORK_QUEUE_H
@@ -0,0 +1,322 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+中转服务器热路径微基准
+
+单独测server.py里每个豆包帧都要经过的几个函数，给出每次调用的耗时（ns/op）和吞吐（bytes/s），
+和保存的基线比较，吞吐下降超过阈值时返回1，改动热路径前后各跑一次就知道有没有变慢：
+1. 帧构造：create_protocol_header、create_audio_message（上行音频帧）
+2. 帧解析：parse_doubao_response（ASR/对话JSON帧和TTS音频帧分开统计）
+3. 重采样：StreamingResampler.process，numpy向量化和纯Python两条路径
+4. 下行分块：StreamBuffer按稳定块时长攒包、取块（memoryview切片）；ADPCM编码单独一项
+
+测试数据是线上录下来的豆包原始帧：server.py设置RELAY_UPSTREAM_FIXTURE=xxx.dbfx后
+把收到的前RELAY_UPSTREAM_FIXTURE_FRAMES帧原样写进文件。没有样本文件时按bench_relay.py的模拟上游
+合成同样结构的帧（ASR结果、TTS音频包），结果只适合和同样合成的数据比较。
+
+使用方法:
+    python bench_hotpaths.py --fixtures doubao.dbfx --save baseline.json     # 改动前记录基线
+    python bench_hotpaths.py --fixtures doubao.dbfx --baseline baseline.json --max-regress 10
+    python bench_hotpaths.py --only parse,resample                          # 只跑名字包含这些词的项目
+
+依赖:
+    - server.py的依赖（见requirements.txt）；没有numpy时跳过numpy重采样
+"""
+
+import argparse
+import contextlib
+import gzip
+import json
+import math
+import platform
+import struct
+import sys
+import time
+from pathlib import Path
+
+SCRIPT_DIR = Path(__file__).resolve().parent
+sys.path.insert(0, str(SCRIPT_DIR))
+
+import server  # noqa: E402
+
+DEFAULT_FIXTURES = SCRIPT_DIR / "bench_fixtures" / "doubao_frames.dbfx"
+SESSION_ID = "3f2b8c1e-6a4d-4e59-9b7a-0c1d2e3f4a5b"
+UPLINK_FRAME_BYTES = 640        # 20ms 16kHz PCM，和固件一致
+
+
+# ---------------------------------------------------------------------------
+# 测试数据
+# ---------------------------------------------------------------------------
+
+def load_fixtures(path: Path):
+    """
+    读取server.py写的豆包帧样本文件（格式见UpstreamFixtureRecorder）
+    """
+    data = path.read_bytes()
+    header = server.UPSTREAM_FIXTURE_HEADER
+    if len(data) < header.size:
+        raise ValueError("文件太短")
+    magic, version = header.unpack_from(data)
+    if magic != server.UPSTREAM_FIXTURE_MAGIC or version != server.UPSTREAM_FIXTURE_VERSION:
+        raise ValueError(f"不是豆包帧样本文件（{magic!r} v{version}）")
+    frames = []
+    offset = header.size
+    record = server.UPSTREAM_FIXTURE_RECORD
+    while offset + record.size <= len(data):
+        size = record.unpack_from(data, offset)[0]
+        offset += record.size
+        if offset + size > len(data):
+            break   # 录制中途停止，最后一帧不完整
+        frames.append(data[offset:offset + size])
+        offset += size
+    return frames
+
+
+def _frame(message_type: int, event: int, payload: bytes, use_json: bool, use_gzip: bool) -> bytes:
+    """
+    构造豆包服务端帧（和bench_relay.py的模拟上游一致，JSON帧可以gzip）
+    """
+    if use_gzip:
+        payload = gzip.compress(payload)
+    header = bytes([0x11, (message_type << 4) | 0b0100, ((0b0001 if use_json else 0) << 4) | use_gzip, 0x00])
+    sid = SESSION_ID.encode("utf-8")
+    return b"".join((header, struct.pack(">I", event), struct.pack(">I", len(sid)), sid,
+                     struct.pack(">I", len(payload)), payload))
+
+
+def synth_fixtures(turns: int = 4, reply_s: float = 3.0):
+    """
+    没有样本文件时合成的帧：每轮若干条ASR中间结果和最终结果、对话文本、40~120ms不等的24kHz float32 TTS包
+    """
+    frames = []
+    rate = server.DOUBAO_SAMPLE_RATE
+    for turn in range(turns):
+        text = "今天天气怎么样，明天会下雨吗"
+        for n in range(1, len(text) + 1, 3):
+            asr = {"results": [{"text": text[:n], "is_interim": n < len(text)}]}
+            frames.append(_frame(0b1001, 451, json.dumps(asr, ensure_ascii=False).encode("utf-8"), True, True))
+        frames.append(_frame(0b1001, 459, b"{}", True, True))
+        frames.append(_frame(0b1001, 550, json.dumps({"content": "明天多云转小雨，出门记得带伞。"},
+                                                      ensure_ascii=False).encode("utf-8"), True, True))
+        start = 0
+        total = int(rate * reply_s)
+        while start < total:
+            samples = rate * (40 + 40 * ((start // 960 + turn) % 3)) // 1000
+            pcm = [0.3 * math.sin(2 * math.pi * 440 * (start + i) / rate) * (0.7 + 0.3 * math.sin((start + i) / 1500))
+                   for i in range(samples)]
+            frames.append(_frame(0b1011, 352, struct.pack(f"<{samples}f", *pcm), False, False))
+            start += samples
+        frames.append(_frame(0b1001, 559, b"{}", True, True))
+    return frames
+
+
+def split_fixtures(frames, tts_format: str):
+    """
+    解析一遍样本：分出JSON帧、音频帧，音频转成重采样输入（24kHz float32）和下行PCM（16kHz int16）
+    """
+    control, audio, payloads = [], [], []
+    for frame in frames:
+        response = server.parse_doubao_response(frame)
+        if "audio_data" in response:
+            audio.append(frame)
+            payloads.append(bytes(response["audio_data"]))
+        elif response:
+            control.append(frame)
+
+    resample_in, downlink_pcm = [], []
+    resampler = server.StreamingResampler()
+    for payload in payloads:
+        if tts_format == "s16le_16k":
+            # 豆包直接给16kHz PCM时服务器不重采样；重采样项目用同样的语音转成float32来测
+            count = len(payload) // 2
+            samples = struct.unpack(f"<{count}h", payload[:count * 2])
+            resample_in.append(struct.pack(f"<{count}f", *[s / 32768 for s in samples]))
+            downlink_pcm.append(payload[:count * 2])
+        else:
+            resample_in.append(payload)
+            downlink_pcm.append(resampler.process(payload))
+    return control, audio, resample_in, [p for p in downlink_pcm if p]
+
+
+# ---------------------------------------------------------------------------
+# 计时
+# ---------------------------------------------------------------------------
+
+def measure(call, items, sizes, min_time: float, repeat: int):
+    """
+    按顺序循环调用call(item)：先翻倍调用次数直到一轮超过min_time/10，再按min_time定次数，
+    取repeat轮里最快的一轮，返回(ns/op, bytes/s, 每轮调用次数)
+    """
+    n = len(items)
+
+    def run(count):
+        start = time.perf_counter_ns()
+        for i in range(count):
+            call(items[i % n])
+        return time.perf_counter_ns() - start
+
+    count = 1
+    while True:
+        elapsed = run(count)
+        if elapsed >= min_time * 1e8 or count >= 1 << 24:
+            break
+        count *= 2
+    count = max(1, int(count * min_time * 1e9 / max(elapsed, 1)))
+    best = min(run(count) for _ in range(repeat))
+    # 每轮都从items[0]开始，字节数按实际调用到的条目算
+    total_bytes = sizes_total(sizes, count)
+    return best / count, total_bytes * 1e9 / max(best, 1), count
+
+
+def sizes_total(sizes, count: int) -> int:
+    n = len(sizes)
+    full, rest = divmod(count, n)
+    return full * sum(sizes) + sum(sizes[:rest])
+
+
+@contextlib.contextmanager
+def numpy_disabled():
+    """StreamingResampler在调用时才看server.HAS_NUMPY，临时关掉就走纯Python路径"""
+    saved = server.HAS_NUMPY
+    server.HAS_NUMPY = False
+    try:
+        yield
+    finally:
+        server.HAS_NUMPY = saved
+
+
+# ---------------------------------------------------------------------------
+# 测试项目
+# ---------------------------------------------------------------------------
+
+def build_cases(control, audio, resample_in, downlink_pcm, chunk_ms: int):
+    """
+    返回[(名字, 函数, 条目, 每个条目计入的字节数, 上下文)]，上下文为None时直接运行
+    """
+    cases = []
+    header_args = [(0b0001, True, True, True), (0b0010, True, False, False)]
+    cases.append(("create_protocol_header", lambda a: server.create_protocol_header(*a),
+                  header_args, [4] * len(header_args), None))
+
+    uplink = [bytes(UPLINK_FRAME_BYTES)]
+    cases.append(("create_audio_message", lambda pcm: server.create_audio_message(SESSION_ID, pcm),
+                  uplink, [len(p) for p in uplink], None))
+
+    if control:
+        cases.append(("parse_doubao_response/json", server.parse_doubao_response,
+                      control, [len(f) for f in control], None))
+    if audio:
+        cases.append(("parse_doubao_response/audio", server.parse_doubao_response,
+                      audio, [len(f) for f in audio], None))
+
+    if resample_in:
+        sizes = [len(p) for p in resample_in]
+        if server.HAS_NUMPY:
+            fast = server.StreamingResampler()
+            cases.append(("resample_24k_to_16k/numpy", fast.process, resample_in, sizes, None))
+        with numpy_disabled():
+            slow = server.StreamingResampler()
+        cases.append(("resample_24k_to_16k/python", slow.process, resample_in, sizes, numpy_disabled))
+
+    if downlink_pcm:
+        chunk_size = chunk_ms * 32
+        buffer = server.StreamBuffer()
+
+        def chunker(pcm):
+            # 和转发任务一样：追加一个TTS包，攒满一个稳定块就取走（视图release之后才能再追加）
+            buffer.append(pcm)
+            while len(buffer) >= chunk_size:
+                buffer.take(chunk_size).release()
+
+        sizes = [len(p) for p in downlink_pcm]
+        cases.append(("downlink_chunker", chunker, downlink_pcm, sizes, None))
+
+        encoder = server.ImaAdpcmEncoder()
+        blocks = [p[i:i + chunk_size] for p in downlink_pcm[:32] for i in range(0, len(p), chunk_size)]
+        blocks = [b for b in blocks if len(b) >= 4]
+        cases.append(("adpcm_encode_block", encoder.encode_block, blocks, [len(b) for b in blocks], None))
+    return cases
+
+
+def format_rate(bps: float) -> str:
+    for unit in ("B/s", "KB/s", "MB/s", "GB/s"):
+        if bps < 1024 or unit == "GB/s":
+            return f"{bps:8.1f} {unit}"
+        bps /= 1024
+
+
+def main():
+    parser = argparse.ArgumentParser(description="中转服务器热路径微基准")
+    parser.add_argument("--fixtures", default=str(DEFAULT_FIXTURES),
+                        help="豆包帧样本（server.py的RELAY_UPSTREAM_FIXTURE），不存在时用合成的帧")
+    parser.add_argument("--tts-format", choices=("f32_24k", "s16le_16k"), default="f32_24k",
+                        help="样本里TTS音频的格式（录制时和豆包协商的格式）")
+    parser.add_argument("--chunk-ms", type=int, default=None, help="下行稳定块时长，默认同server.py")
+    parser.add_argument("--min-time", type=float, default=0.3, help="每轮计时的最短时间（秒）")
+    parser.add_argument("--repeat", type=int, default=5, help="每个项目计时几轮，取最快的一轮")
+    parser.add_argument("--only", default="", help="只跑名字包含这些词的项目（逗号分隔）")
+    parser.add_argument("--save", help="结果写成JSON（作为以后的基线）")
+    parser.add_argument("--baseline", help="和这个JSON基线比较吞吐")
+    parser.add_argument("--max-regress", type=float, default=15.0, help="吞吐比基线低超过这个百分比时返回1")
+    args = parser.parse_args()
+
+    fixtures = Path(args.fixtures)
+    if fixtures.exists():
+        frames = load_fixtures(fixtures)
+        source = f"{fixtures}（{len(frames)}帧）"
+    else:
+        frames = synth_fixtures()
+        source = f"合成数据（{len(frames)}帧，没有找到 {fixtures}）"
+    control, audio, resample_in, downlink_pcm = split_fixtures(frames, args.tts_format)
+    chunk_ms = args.chunk_ms or server.downlink_chunk_ms(None)
+
+    only = [w for w in args.only.split(",") if w]
+    cases = [c for c in build_cases(control, audio, resample_in, downlink_pcm, chunk_ms)
+             if not only or any(w in c[0] for w in only)]
+
+    print("=" * 72)
+    print(f"🧪 样本: {source}")
+    print(f"   JSON帧 {len(control)}，音频帧 {len(audio)}，numpy {'有' if server.HAS_NUMPY else '无'}，"
+          f"稳定块 {chunk_ms}ms，Python {platform.python_version()}")
+    print("-" * 72)
+    print(f"{'项目':<32}{'ns/op':>14}{'吞吐':>16}{'次数':>10}")
+    results = {}
+    for name, call, items, sizes, context in cases:
+        with (context() if context else contextlib.nullcontext()):
+            ns_per_op, bps, count = measure(call, items, sizes, args.min_time, args.repeat)
+        results[name] = {"ns_per_op": ns_per_op, "bytes_per_s": bps}
+        print(f"{name:<32}{ns_per_op:>14.0f}{format_rate(bps):>16}{count:>10}")
+
+    failed = []
+    if args.baseline:
+        baseline = json.loads(Path(args.baseline).read_text()).get("results", {})
+        print("-" * 72)
+        print(f"对比基线 {args.baseline}（吞吐下降超过 {args.max_regress:.0f}% 判为回退）")
+        for name, result in results.items():
+            base = baseline.get(name)
+            if not base or base.get("bytes_per_s", 0) <= 0:
+                print(f"{name:<32}{'基线里没有':>14}")
+                continue
+            change = (result["bytes_per_s"] / base["bytes_per_s"] - 1) * 100
+            bad = change < -args.max_regress
+            if bad:
+                failed.append(name)
+            print(f"{name:<32}{change:>+13.1f}%  {'❌ 回退' if bad else '✅'}")
+
+    if args.save:
+        Path(args.save).write_text(json.dumps({
+            "fixtures": source,
+            "python": platform.python_version(),
+            "numpy": server.HAS_NUMPY,
+            "chunk_ms": chunk_ms,
+            "results": results,
+        }, ensure_ascii=False, indent=2) + "\n")
+        print(f"💾 结果已保存: {args.save}")
+    print("=" * 72)
+    if failed:
+        print(f"❌ {len(failed)} 项吞吐回退: {', '.join(failed)}")
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,437 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+语音中转服务器压测工具
+
+模拟N台ESP32同时对话，测量中转服务器（server.py）的延迟和资源占用：
+1. 每台模拟设备按实时节奏（20ms一帧）上传录好的16kHz PCM，说完发送speech_end
+2. 按真实固件的方式上报下行额度（credit），模拟以实时速度消耗的抖动缓冲区
+3. 统计每轮对话的 唤醒→首个下行音频、说完→首个TTS字节、下行包间隔抖动
+4. --spawn-relay时由本工具启动server.py，按/proc统计它的CPU和内存，折算到每台设备
+
+默认同时启动一个模拟豆包服务（--no-mock关闭），收到server.py补发的静音后
+回复ASR结果和一段TTS音频，不需要联网和密钥。
+
+使用方法:
+    python bench_relay.py --devices 20 --turns 3                 # 离线：模拟上游 + 自动启动server.py
+    python bench_relay.py --devices 5 --relay ws://10.0.0.2:8888 --no-mock   # 压测已部署的服务器
+
+依赖:
+    - websockets
+    - ffmpeg（--audio给MP3时需要，默认读取 ../main/mock_voices/hi.mp3）
+"""
+
+import argparse
+import asyncio
+import gzip
+import json
+import math
+import os
+import statistics
+import struct
+import subprocess
+import sys
+import time
+import wave
+from pathlib import Path
+
+import websockets
+
+SAMPLE_RATE = 16000
+FRAME_MS = 20
+FRAME_BYTES = SAMPLE_RATE * 2 * FRAME_MS // 1000
+PLAYBACK_BUFFER_BYTES = SAMPLE_RATE * 2 * 2     # 模拟设备的2秒抖动缓冲区（与固件一致）
+CREDIT_INTERVAL_S = 0.1
+
+SCRIPT_DIR = Path(__file__).resolve().parent
+DEFAULT_AUDIO = SCRIPT_DIR.parent / "main" / "mock_voices" / "hi.mp3"
+
+
+# ---------------------------------------------------------------------------
+# 模拟豆包上游
+# ---------------------------------------------------------------------------
+
+def _frame(message_type: int, event: int, session_id: str, payload: bytes, use_json: bool) -> bytes:
+    """
+    构造豆包服务端帧（SERVER_FULL_RESPONSE / SERVER_ACK），不压缩
+    """
+    header = bytes([0x11, (message_type << 4) | 0b0100, (0b0001 if use_json else 0) << 4, 0x00])
+    sid = session_id.encode("utf-8")
+    return b"".join((header, struct.pack(">I", event), struct.pack(">I", len(sid)), sid,
+                     struct.pack(">I", len(payload)), payload))
+
+
+def _parse_client_frame(data: bytes):
+    """
+    解析server.py发给豆包的帧，返回(事件, 会话ID, 载荷)；StartConnection没有会话ID
+    """
+    header_size = (data[0] & 0x0f) * 4
+    use_gzip = bool(data[2] & 0x0f)
+    offset = header_size
+    event = struct.unpack_from(">I", data, offset)[0]
+    offset += 4
+    session_id = ""
+    if event >= 100:
+        sid_len = struct.unpack_from(">I", data, offset)[0]
+        session_id = data[offset + 4:offset + 4 + sid_len].decode("utf-8", errors="ignore")
+        offset += 4 + sid_len
+    size = struct.unpack_from(">I", data, offset)[0]
+    payload = data[offset + 4:offset + 4 + size]
+    if use_gzip:
+        payload = gzip.decompress(payload)
+    return event, session_id, payload
+
+
+class MockDoubao:
+    """
+    模拟豆包实时对话服务
+
+    收到连续SILENCE_FRAMES段100ms全零音频（server.py补发的静音）后认为一轮说完：
+    回复ASR最终结果(451)、识别结束(459)，再按TTS_SPEED倍实时速度下发reply_s秒TTS，最后发559。
+    TTS格式按StartSession里请求的audio_config生成（s16le 16kHz或float32 24kHz）。
+    """
+
+    SILENCE_FRAMES = 5
+    TTS_PACKET_MS = 40
+    TTS_SPEED = 2.0
+
+    def __init__(self, reply_s: float):
+        self.reply_s = reply_s
+        self.sessions = 0
+        self.turns = 0
+
+    def _tts_packets(self, audio_config: dict):
+        rate = int(audio_config.get("sample_rate", 24000))
+        s16 = audio_config.get("format") == "pcm_s16le"
+        per_packet = rate * self.TTS_PACKET_MS // 1000
+        total = int(rate * self.reply_s)
+        for start in range(0, total, per_packet):
+            samples = [0.3 * math.sin(2 * math.pi * 440 * (start + i) / rate) for i in range(per_packet)]
+            if s16:
+                yield struct.pack(f"<{per_packet}h", *[int(v * 32767) for v in samples])
+            else:
+                yield struct.pack(f"<{per_packet}f", *samples)
+
+    async def _reply(self, ws, session_id: str, audio_config: dict):
+        self.turns += 1
+        asr = {"results": [{"text": "模拟的用户语音", "is_interim": False}]}
+        await ws.send(_frame(0b1001, 451, session_id, json.dumps(asr).encode("utf-8"), True))
+        await ws.send(_frame(0b1001, 459, session_id, b"{}", True))
+        interval = self.TTS_PACKET_MS / 1000 / self.TTS_SPEED
+        for packet in self._tts_packets(audio_config):
+            await ws.send(_frame(0b1011, 352, session_id, packet, False))
+            await asyncio.sleep(interval)
+        await ws.send(_frame(0b1001, 559, session_id, b"{}", True))
+
+    async def handle(self, ws, path=None):
+        configs = {}
+        silent = {}
+        replies = set()
+        try:
+            async for data in ws:
+                if isinstance(data, str) or len(data) < 8:
+                    continue
+                event, session_id, payload = _parse_client_frame(data)
+                if event == 1:
+                    await ws.send(_frame(0b1001, 50, "", b"{}", True))
+                elif event == 100:
+                    self.sessions += 1
+                    configs[session_id] = json.loads(payload or b"{}").get("tts", {}).get("audio_config", {})
+                    silent[session_id] = 0
+                    await ws.send(_frame(0b1001, 150, session_id, b"{}", True))
+                elif event == 102:
+                    configs.pop(session_id, None)
+                    await ws.send(_frame(0b1001, 152, session_id, b"{}", True))
+                elif event == 200 and session_id in configs:
+                    # 设备上传的20ms帧不计入，只认server.py补发的100ms整段静音
+                    is_fill = len(payload) >= SAMPLE_RATE * 2 // 10 and not payload.strip(b"\0")
+                    silent[session_id] = silent[session_id] + 1 if is_fill else 0
+                    if silent[session_id] == self.SILENCE_FRAMES:
+                        task = asyncio.create_task(self._reply(ws, session_id, configs[session_id]))
+                        replies.add(task)
+                        task.add_done_callback(replies.discard)
+        except websockets.exceptions.ConnectionClosed:
+            pass
+        finally:
+            for task in replies:
+                task.cancel()
+
+
+# ---------------------------------------------------------------------------
+# 模拟ESP32
+# ---------------------------------------------------------------------------
+
+class TurnResult:
+    def __init__(self):
+        self.wake_to_first_audio_ms = None
+        self.eos_to_first_tts_ms = None
+        self.jitter_ms = None           # 下行包间隔的标准差
+        self.max_gap_ms = None
+        self.underruns = 0              # 模拟播放时缓冲区被取空的次数
+        self.downlink_bytes = 0
+
+
+class SimulatedDevice:
+    """
+    一台模拟ESP32：协商PCM上下行，按实时节奏上传音频，模拟抖动缓冲区并上报额度
+    """
+
+    def __init__(self, index: int, uri: str, pcm: bytes, turns: int, pause_s: float):
+        self.index = index
+        self.uri = uri
+        self.pcm = pcm
+        self.turns = turns
+        self.pause_s = pause_s
+        self.results = []
+        self.error = None
+
+    async def run(self):
+        try:
+            async with websockets.connect(self.uri, max_size=None, ping_interval=None) as ws:
+                await self._wait_text(ws, "ready")
+                await ws.send(json.dumps({
+                    "type": "hello",
+                    "device_id": f"bench{self.index:04d}",
+                    "audio": {"uplink": ["pcm"], "downlink": ["pcm"],
+                              "sample_rate": SAMPLE_RATE, "frame_ms": FRAME_MS},
+                }, separators=(",", ":")))
+                await self._wait_text(ws, "hello")
+                for _ in range(self.turns):
+                    self.results.append(await self._turn(ws))
+                    await asyncio.sleep(self.pause_s)
+        except Exception as e:
+            self.error = f"{type(e).__name__}: {e}"
+
+    async def _wait_text(self, ws, msg_type: str, timeout: float = 15):
+        deadline = time.monotonic() + timeout
+        while True:
+            data = await asyncio.wait_for(ws.recv(), timeout=max(0.01, deadline - time.monotonic()))
+            if isinstance(data, str) and json.loads(data).get("type") == msg_type:
+                return
+
+    async def _turn(self, ws) -> TurnResult:
+        result = TurnResult()
+        wake = time.monotonic()
+        state = {"eos": None, "recv": 0, "first": None, "arrivals": [], "done": asyncio.Event()}
+
+        async def receive():
+            async for data in ws:
+                now = time.monotonic()
+                if isinstance(data, bytes):
+                    if state["first"] is None:
+                        state["first"] = now
+                    state["recv"] += len(data)
+                    state["arrivals"].append((now, len(data)))
+                elif json.loads(data).get("type") == "tts_end":
+                    state["done"].set()
+                    return
+
+        async def report_credit():
+            # 和固件一样：已收字节数 + 缓冲区剩余空间（按实时速度播放）
+            while not state["done"].is_set():
+                played = 0
+                if state["first"] is not None:
+                    played = min(state["recv"], int((time.monotonic() - state["first"]) * SAMPLE_RATE * 2))
+                free = max(0, PLAYBACK_BUFFER_BYTES - (state["recv"] - played))
+                await ws.send(json.dumps({"type": "credit", "recv": state["recv"], "free": free},
+                                         separators=(",", ":")))
+                await asyncio.sleep(CREDIT_INTERVAL_S)
+
+        receiver = asyncio.create_task(receive())
+        credit = asyncio.create_task(report_credit())
+        try:
+            # 按实时节奏上传，用绝对时间校正，避免sleep误差累积
+            for i, start in enumerate(range(0, len(self.pcm), FRAME_BYTES)):
+                await ws.send(self.pcm[start:start + FRAME_BYTES])
+                delay = wake + (i + 1) * FRAME_MS / 1000 - time.monotonic()
+                if delay > 0:
+                    await asyncio.sleep(delay)
+            state["eos"] = time.monotonic()
+            await ws.send(json.dumps({"type": "speech_end"}, separators=(",", ":")))
+            await asyncio.wait_for(state["done"].wait(), timeout=60)
+        finally:
+            credit.cancel()
+            if not receiver.done():
+                receiver.cancel()
+
+        arrivals = state["arrivals"]
+        if state["first"] is not None:
+            result.wake_to_first_audio_ms = (state["first"] - wake) * 1000
+            result.eos_to_first_tts_ms = (state["first"] - state["eos"]) * 1000
+        if len(arrivals) > 2:
+            gaps = [(b[0] - a[0]) * 1000 for a, b in zip(arrivals, arrivals[1:])]
+            result.jitter_ms = statistics.pstdev(gaps)
+            result.max_gap_ms = max(gaps)
+            # 以第一个包到达为播放起点，检查每个包到达时是否已经播空
+            queued_until = arrivals[0][0] + arrivals[0][1] / (SAMPLE_RATE * 2)
+            for at, size in arrivals[1:]:
+                if at > queued_until:
+                    result.underruns += 1
+                queued_until = max(queued_until, at) + size / (SAMPLE_RATE * 2)
+        result.downlink_bytes = state["recv"]
+        return result
+
+
+# ---------------------------------------------------------------------------
+# 进程资源统计
+# ---------------------------------------------------------------------------
+
+def read_proc_usage(pid: int):
+    """
+    返回(CPU秒数, RSS字节)；非Linux或进程不存在时返回None
+    """
+    try:
+        with open(f"/proc/{pid}/stat") as f:
+            fields = f.read().rsplit(")", 1)[1].split()
+        ticks = os.sysconf("SC_CLK_TCK")
+        cpu = (int(fields[11]) + int(fields[12])) / ticks
+        with open(f"/proc/{pid}/status") as f:
+            rss = next(int(line.split()[1]) * 1024 for line in f if line.startswith("VmRSS:"))
+        return cpu, rss
+    except (OSError, StopIteration, IndexError, ValueError):
+        return None
+
+
+def load_pcm(path: Path, seconds: float) -> bytes:
+    """
+    读取16kHz单声道16位PCM（.wav / .pcm，其他格式用ffmpeg转换）；文件不可用时生成带噪声的测试音
+    """
+    try:
+        if path.suffix == ".wav":
+            with wave.open(str(path)) as w:
+                if w.getframerate() != SAMPLE_RATE or w.getnchannels() != 1 or w.getsampwidth() != 2:
+                    raise ValueError("WAV必须是16kHz单声道16位")
+                return w.readframes(w.getnframes())
+        if path.suffix == ".pcm":
+            return path.read_bytes()
+        return subprocess.run(
+            ["ffmpeg", "-v", "error", "-i", str(path), "-f", "s16le", "-ac", "1", "-ar", str(SAMPLE_RATE), "-"],
+            check=True, capture_output=True).stdout
+    except (OSError, ValueError, subprocess.CalledProcessError) as e:
+        print(f"⚠️ 无法读取 {path}（{e}），改用{seconds}秒合成测试音")
+        n = int(SAMPLE_RATE * seconds)
+        return struct.pack(f"<{n}h", *[int(8000 * math.sin(2 * math.pi * 300 * i / SAMPLE_RATE)
+                                          * (0.6 + 0.4 * math.sin(i / 997))) for i in range(n)])
+
+
+def percentile(values, p: float):
+    values = sorted(v for v in values if v is not None)
+    if not values:
+        return float("nan")
+    k = (len(values) - 1) * p / 100
+    lo, hi = math.floor(k), math.ceil(k)
+    return values[lo] + (values[hi] - values[lo]) * (k - lo)
+
+
+def print_report(devices, elapsed_s: float, usage_before, usage_after, rss_peak):
+    results = [r for d in devices for r in d.results]
+    failed = [d for d in devices if d.error]
+    print("=" * 60)
+    print(f"📊 {len(devices)} 台设备, {len(results)} 轮对话, 失败 {len(failed)} 台, 用时 {elapsed_s:.1f}s")
+    for d in failed[:5]:
+        print(f"   ❌ 设备{d.index}: {d.error}")
+    rows = [
+        ("唤醒→首个下行音频(ms)", [r.wake_to_first_audio_ms for r in results]),
+        ("说完→首个TTS字节(ms)", [r.eos_to_first_tts_ms for r in results]),
+        ("下行包间隔抖动(ms)", [r.jitter_ms for r in results]),
+        ("下行最大间隔(ms)", [r.max_gap_ms for r in results]),
+    ]
+    print(f"{'指标':<24}{'p50':>10}{'p95':>10}{'max':>10}")
+    for name, values in rows:
+        print(f"{name:<24}{percentile(values, 50):>10.1f}{percentile(values, 95):>10.1f}{percentile(values, 100):>10.1f}")
+    underruns = sum(r.underruns for r in results)
+    print(f"模拟播放欠载: {underruns} 次 / {len(results)} 轮")
+    if usage_before and usage_after:
+        cpu_s = usage_after[0] - usage_before[0]
+        n = max(1, len(devices))
+        print(f"中转进程CPU: {cpu_s / elapsed_s * 100:.1f}% (每台设备 {cpu_s / elapsed_s * 100 / n:.2f}%)")
+        print(f"中转进程内存: 峰值 {rss_peak / 1e6:.1f}MB, "
+              f"增量每台设备 {(rss_peak - usage_before[1]) / n / 1e3:.0f}KB")
+    print("=" * 60)
+
+
+async def run_benchmark(args):
+    mock = None
+    mock_server = None
+    relay = None
+    relay_uri = args.relay
+    try:
+        if not args.no_mock:
+            mock = MockDoubao(args.reply_seconds)
+            mock_server = await websockets.serve(mock.handle, "127.0.0.1", args.mock_port, max_size=None)
+            print(f"🧪 模拟豆包上游: ws://127.0.0.1:{args.mock_port}")
+
+        if args.spawn_relay:
+            env = dict(os.environ, RELAY_PORT=str(args.relay_port), RELAY_WORKERS="1")
+            if mock:
+                env["DOUBAO_BASE_URL"] = f"ws://127.0.0.1:{args.mock_port}"
+            relay = subprocess.Popen([sys.executable, str(SCRIPT_DIR / "server.py")], env=env,
+                                     stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+            relay_uri = f"ws://127.0.0.1:{args.relay_port}"
+            # 等端口可连
+            for _ in range(100):
+                try:
+                    _, writer = await asyncio.open_connection("127.0.0.1", args.relay_port)
+                    writer.close()
+                    break
+                except OSError:
+                    await asyncio.sleep(0.1)
+            print(f"🚀 已启动server.py (pid {relay.pid}): {relay_uri}")
+
+        pcm = load_pcm(Path(args.audio), args.speech_seconds)
+        print(f"🎤 上行音频 {len(pcm) / (SAMPLE_RATE * 2):.2f}s, {args.devices} 台设备, 每台 {args.turns} 轮")
+
+        devices = [SimulatedDevice(i, relay_uri, pcm, args.turns, args.pause) for i in range(args.devices)]
+        usage_before = read_proc_usage(relay.pid) if relay else None
+        rss_peak = usage_before[1] if usage_before else 0
+        start = time.monotonic()
+        tasks = []
+        for d in devices:
+            tasks.append(asyncio.create_task(d.run()))
+            await asyncio.sleep(args.ramp / max(1, args.devices))   # 错开建连
+        pending = set(tasks)
+        while pending:
+            _, pending = await asyncio.wait(pending, timeout=0.5)
+            usage = read_proc_usage(relay.pid) if relay else None
+            if usage:
+                rss_peak = max(rss_peak, usage[1])
+        elapsed = time.monotonic() - start
+        usage_after = read_proc_usage(relay.pid) if relay else None
+        print_report(devices, elapsed, usage_before, usage_after, rss_peak)
+        if mock:
+            print(f"🧪 模拟上游: 会话 {mock.sessions} 个, 回复 {mock.turns} 轮")
+    finally:
+        if relay:
+            relay.terminate()
+            try:
+                relay.wait(timeout=5)
+            except subprocess.TimeoutExpired:
+                relay.kill()
+        if mock_server:
+            mock_server.close()
+            await mock_server.wait_closed()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="语音中转服务器压测")
+    parser.add_argument("--devices", type=int, default=10, help="模拟设备数")
+    parser.add_argument("--turns", type=int, default=3, help="每台设备的对话轮数")
+    parser.add_argument("--pause", type=float, default=1.0, help="两轮对话之间的间隔（秒）")
+    parser.add_argument("--ramp", type=float, default=2.0, help="所有设备在这么多秒内陆续连入")
+    parser.add_argument("--audio", default=str(DEFAULT_AUDIO), help="上行音频（wav/pcm/mp3）")
+    parser.add_argument("--speech-seconds", type=float, default=1.5, help="音频文件不可用时合成测试音的长度")
+    parser.add_argument("--relay", default="ws://127.0.0.1:8888", help="已运行的中转服务器地址")
+    parser.add_argument("--spawn-relay", action="store_true", default=None,
+                        help="由本工具启动server.py（使用模拟上游时默认开启）")
+    parser.add_argument("--relay-port", type=int, default=18888, help="--spawn-relay时server.py的端口")
+    parser.add_argument("--no-mock", action="store_true", help="不启动模拟上游，server.py连接真实豆包")
+    parser.add_argument("--mock-port", type=int, default=18999, help="模拟上游端口")
+    parser.add_argument("--reply-seconds", type=float, default=3.0, help="模拟上游每轮回复的TTS时长")
+    args = parser.parse_args()
+    if args.spawn_relay is None:
+        args.spawn_relay = not args.no_mock
+    asyncio.run(run_benchmark(args))
+
+
+if __name__ == "__main__":
+    main()
@@ -20,19 +20,70 @@ import gzip
 import uuid
 import logging
 import signal
+import threading
+import queue
 import sys
-from typing import Dict, Any, Optional
+import os
+import socket
+import zlib
+import time
+import math
+import random
+import array
+import functools
+import hashlib
+import re
+import ssl
+import urllib.parse
+import wave
+import collections.abc
+from concurrent.futures import ThreadPoolExecutor
+from http import HTTPStatus
+from collections import OrderedDict, deque
+from typing import Dict, Any, Optional, Tuple
 
 # 尝试导入音频处理依赖库
-# scipy用于高质量音频重采样，如果未安装则使用简单重采样方法
+# numpy用于向量化重采样，如果未安装则用纯Python逐点计算（同样的滤波器，只是慢）
 try:
-    import scipy.signal
     import numpy as np
-    HAS_SCIPY = True
-    print("✅ 已安装scipy，将使用高质量音频重采样")
+    HAS_NUMPY = True
+    print("✅ 已安装numpy，将使用向量化音频重采样")
 except ImportError:
-    HAS_SCIPY = False
-    print("⚠️ 未安装scipy，将使用简单重采样（建议：pip install scipy numpy）")
+    HAS_NUMPY = False
+    print("⚠️ 未安装numpy，将使用纯Python重采样（建议：pip install numpy）")
+
+# 尝试导入uvloop
+# uvloop用libuv实现asyncio事件循环，socket读写和任务调度比默认循环快，单进程能带更多设备
+try:
+    import uvloop
+    HAS_UVLOOP = True
+except ImportError:
+    HAS_UVLOOP = False
+
+# 尝试导入Opus解码库
+# opuslib用于解码ESP32上行的Opus音频，如果未安装则只接受PCM上行
+try:
+    import opuslib
+    HAS_OPUS = True
+    print("✅ 已安装opuslib，支持ESP32 Opus上行音频")
+except Exception:
+    HAS_OPUS = False
+    print("⚠️ 未安装opuslib，只接受PCM上行音频（建议：pip install opuslib）")
+
+# webrtcvad用于中继端VAD（RELAY_VAD），如果未安装则按能量判断
+try:
+    import webrtcvad
+    HAS_WEBRTCVAD = True
+except Exception:
+    HAS_WEBRTCVAD = False
+
+# zeroconf用于在局域网里用mDNS广播中继地址（RELAY_MDNS），如果未安装则不广播
+try:
+    from zeroconf import ServiceInfo
+    from zeroconf.asyncio import AsyncZeroconf
+    HAS_ZEROCONF = True
+except Exception:
+    HAS_ZEROCONF = False
 
 # 音频采样率配置
 ESP32_SAMPLE_RATE = 16000  # ESP32端采样率（Hz）
@@ -41,7 +92,8 @@ DOUBAO_SAMPLE_RATE = 24000  # 豆包AI输出采样率（Hz）
 # 豆包AI API配置
 # 注意：以下密钥为示例，请替换为您自己的密钥
 DOUBAO_CONFIG = {
-    "base_url": "wss://openspeech.bytedance.com/api/v3/realtime/dialogue",  # 豆包AI WebSocket API地址
+    # 豆包AI WebSocket API地址（压测时用DOUBAO_BASE_URL指向bench_relay.py的模拟上游）
+    "base_url": os.environ.get("DOUBAO_BASE_URL", "wss://openspeech.bytedance.com/api/v3/realtime/dialogue"),
     "headers": {
         "X-Api-App-ID": "你的APP ID",           # 应用ID
         "X-Api-Access-Key": "你的 Access Token",  # 访问密钥
@@ -50,6 +102,9 @@ DOUBAO_CONFIG = {
         "X-Api-Connect-Id": "",                # 连接ID，每次连接时重新生成 固定值
     },
 }
+# 🌐 多个接入点（逗号分隔，比如不同地域的接入域名）时按延迟选最快的健康接入点，失败时自动换下一个
+DOUBAO_CONFIG["base_urls"] = ([u.strip() for u in os.environ.get("DOUBAO_BASE_URLS", "").split(",") if u.strip()]
+                              or [DOUBAO_CONFIG["base_url"]])
 
 # 豆包AI会话配置
 SESSION_CONFIG = {
@@ -60,7 +115,7 @@ SESSION_CONFIG = {
     },
     "tts": {
         "speaker": "zh_male_yunzhou_jupiter_bigtts",  # TTS发音人
-        "audio_config": {
+        "audio_config": {          # 实际发送时按协商结果替换（见session_config）
             "channel": 1,           # 音频通道数
             "format": "pcm",        # 音频格式
             "sample_rate": 24000    # 音频采样率（Hz）
@@ -79,141 +134,2007 @@ SESSION_CONFIG = {
     },
 }
 
+# ESP32发送speech_end后立即补发的静音时长：ASR结束平滑窗口 + SPEECH_END_SILENCE_EXTRA_MS（毫秒）
+# ESP32开启VAD门控后说完话就不再上传音频，由服务器一次性补齐ASR结束平滑窗口所需的静音，
+# 豆包无需等待实时静音即可结束本轮识别
+SPEECH_END_SILENCE_EXTRA_MS = 200
+SPEECH_END_SILENCE_CHUNK_MS = 100
+
+# 🎯 中继端VAD：hello里没有"vad":true的设备（没有VAD门控、一直上传的固件）由服务器判断说完了，
+# 说完后静音持续RELAY_VAD_SILENCE_MS毫秒就和speech_end一样一次性补齐静音，之后的静音不再转发
+# （只留最近RELAY_VAD_PREROLL_MS毫秒，重新开口时连同开口一起发）。auto=按hello，on=所有设备，off=不用。
+# 装了webrtcvad时用它（RELAY_VAD_AGGRESSIVENESS 0~3），否则按能量（高于底噪10dB且高于RELAY_VAD_ENERGY_DB）
+RELAY_VAD = os.environ.get("RELAY_VAD", "auto")
+RELAY_VAD_SILENCE_MS = int(os.environ.get("RELAY_VAD_SILENCE_MS", "500"))
+RELAY_VAD_HANGOVER_MS = int(os.environ.get("RELAY_VAD_HANGOVER_MS", "200"))
+RELAY_VAD_PREROLL_MS = int(os.environ.get("RELAY_VAD_PREROLL_MS", "300"))
+RELAY_VAD_AGGRESSIVENESS = int(os.environ.get("RELAY_VAD_AGGRESSIVENESS", "2"))
+RELAY_VAD_ENERGY_DB = float(os.environ.get("RELAY_VAD_ENERGY_DB", "-45"))
+# 有人替豆包判断说完了（设备VAD或者中继端VAD）时，ASR结束平滑窗口可以短一些：中继端VAD的设备用
+# RELAY_VAD_END_WINDOW_MS；设备VAD的hello可以带"end_window_ms"自己指定。0/不带=用会话配置里的end_smooth_window_ms
+RELAY_VAD_END_WINDOW_MS = int(os.environ.get("RELAY_VAD_END_WINDOW_MS", "500"))
+
+# 📏 自适应结束平滑窗口：按每台设备（device_id）过去几轮的说话停顿学习窗口，每次开会话时设置。
+# 句中停顿（说话之间的静音，至少RELAY_ENDPOINT_PAUSE_MIN_MS）记最近RELAY_ENDPOINT_HISTORY个，
+# 窗口 = 停顿的90分位 + RELAY_ENDPOINT_MARGIN_MS，限制在[RELAY_ENDPOINT_MIN_MS, RELAY_ENDPOINT_MAX_MS]；
+# 不到RELAY_ENDPOINT_MIN_PAUSES个样本时不改。一句话识别结束后RELAY_ENDPOINT_CUTOFF_MS内又开口（上行VAD或者
+# 豆包又出了识别中间结果）算被截断：窗口加RELAY_ENDPOINT_CUTOFF_BUMP_MS，之后每个没被截断的回合减回一点。
+# 中继端VAD的设备同时用它作为判定说完的静音时长；hello里自己带end_window_ms的设备不调整。0=关闭
+RELAY_ENDPOINT_ADAPT = os.environ.get("RELAY_ENDPOINT_ADAPT", "1") == "1"
+RELAY_ENDPOINT_MIN_MS = int(os.environ.get("RELAY_ENDPOINT_MIN_MS", "400"))
+RELAY_ENDPOINT_MAX_MS = int(os.environ.get("RELAY_ENDPOINT_MAX_MS", "2000"))
+RELAY_ENDPOINT_MARGIN_MS = int(os.environ.get("RELAY_ENDPOINT_MARGIN_MS", "250"))
+RELAY_ENDPOINT_PAUSE_MIN_MS = int(os.environ.get("RELAY_ENDPOINT_PAUSE_MIN_MS", "150"))
+RELAY_ENDPOINT_HISTORY = int(os.environ.get("RELAY_ENDPOINT_HISTORY", "64"))
+RELAY_ENDPOINT_MIN_PAUSES = int(os.environ.get("RELAY_ENDPOINT_MIN_PAUSES", "8"))
+RELAY_ENDPOINT_CUTOFF_MS = int(os.environ.get("RELAY_ENDPOINT_CUTOFF_MS", "800"))
+RELAY_ENDPOINT_CUTOFF_BUMP_MS = int(os.environ.get("RELAY_ENDPOINT_CUTOFF_BUMP_MS", "300"))
+RELAY_ENDPOINT_DEVICES = int(os.environ.get("RELAY_ENDPOINT_DEVICES", "10000"))    # 最多记多少台设备
+
+# 🔁 热更新：RELAY_CONFIG_FILE是一个JSON文件，{"session": {...}, "doubao": {"headers": {...}, "base_urls": [...]}}，
+# 按层合并到上面的SESSION_CONFIG/DOUBAO_CONFIG上（只写要改的字段）。启动时读一次，之后收到SIGHUP（多进程时发给
+# 主进程）或GET /reload_config时重新读，只影响之后开始的豆包会话和新建的连接，已连接的设备和进行中的会话不受影响
+RELAY_CONFIG_FILE = os.environ.get("RELAY_CONFIG_FILE", "")
+
+# 豆包TTS输出格式，按顺序协商：StartSession被拒绝时换下一种，被拒绝的格式之后不再尝试
+# s16le_16k与ESP32播放格式一致，音频直接透传，不用解码和重采样；f32_24k是豆包默认格式，需要重采样
+# 如果上游不按请求的采样率输出（播放变调），把s16le_16k从列表里去掉即可
+TTS_AUDIO_FORMATS = {
+    "s16le_16k": {"channel": 1, "format": "pcm_s16le", "sample_rate": ESP32_SAMPLE_RATE},
+    "f32_24k": {"channel": 1, "format": "pcm", "sample_rate": DOUBAO_SAMPLE_RATE},
+}
+TTS_PREFERRED_FORMATS = ["s16le_16k", "f32_24k"]
+TTS_PASSTHROUGH_FORMATS = {"s16le_16k"}
+
+# 下行额度耗尽后最多等待多久（秒）；ESP32正常播放时每100ms左右就会上报一次
+CREDIT_WAIT_TIMEOUT_S = 2.0
+
+# 🕐 帧时钟：设备在hello里带frame_ms（采集、上行编码和播放块的时长，见main/project_config.h的AUDIO_FRAME_MS），
+# 下行消息都按它的整数倍切，设备的播放任务一条消息正好播整数块；回复里原样带回frame_ms确认。旧固件不带时按20ms
+AUDIO_FRAME_DEFAULT_MS = 20
+AUDIO_FRAME_CHOICES = (10, 20, 40, 60)
+
+# ⚡ 下行分块：每段回复的第一个TTS包到了立即下发（不等攒满一块），首包越早到设备越早出声；之后按稳定块下发，
+# 消息数少、每条的帧头和WebSocket开销摊得薄。稳定块取hello里设备抖动缓冲目标jitter_ms的一半（一块迟到
+# 也吃不空缓冲），按帧对齐并限制在MIN~MAX之间，回复里的chunk_ms告诉设备；旧固件不带jitter_ms时用DEFAULT
+DOWNLINK_CHUNK_DEFAULT_MS = 60
+DOWNLINK_CHUNK_MIN_MS = 40
+DOWNLINK_CHUNK_MAX_MS = 120
+
+
+def audio_frame_ms(value) -> int:
+    """hello里设备的帧时长，不认识的值按默认"""
+    try:
+        value = int(value)
+    except (TypeError, ValueError):
+        return AUDIO_FRAME_DEFAULT_MS
+    return value if value in AUDIO_FRAME_CHOICES else AUDIO_FRAME_DEFAULT_MS
+
+
+def downlink_chunk_ms(jitter_ms, frame_ms: int = AUDIO_FRAME_DEFAULT_MS) -> int:
+    """
+    按设备的抖动缓冲目标选稳定块时长（帧的整数倍，至少一帧）
+    """
+    try:
+        jitter_ms = int(jitter_ms)
+    except (TypeError, ValueError):
+        jitter_ms = 0
+    target = jitter_ms // 2 if jitter_ms > 0 else DOWNLINK_CHUNK_DEFAULT_MS
+    target = min(max(target, DOWNLINK_CHUNK_MIN_MS), DOWNLINK_CHUNK_MAX_MS)
+    return max(target // frame_ms, 1) * frame_ms
+
+# 豆包预热连接池
+# 每条连接提前完成TLS握手、鉴权和StartConnection，ESP32连上时直接取一条发StartSession，
+# 省掉建连的几个往返。StartSession不提前发：会话空闲超过recv_timeout会被豆包结束
+WARM_POOL_SIZE = 2          # 池中保持的空闲连接数，0=关闭预热
+WARM_POOL_MAX_AGE_S = 60    # 空闲连接超过这个时间丢弃重建，避免被中间设备悄悄断开
+
+# 每条豆包连接最多承载的会话数（帧按session_id路由）
+# 豆包文档没有承诺同一连接上的并发会话，默认1即每台设备独占一条连接；确认服务端支持后再调大
+MAX_SESSIONS_PER_UPSTREAM = 1
+
+# 🚦 过载保护：每个worker同时最多RELAY_MAX_UPSTREAM_SESSIONS个豆包会话（0=不限，按账号的并发配额设置），
+# 满了时新会话排队（最多RELAY_UPSTREAM_QUEUE个、每个最多等RELAY_UPSTREAM_WAIT_S秒），排不上的立即给设备回busy，
+# 设备本地播报"稍后再试"。连接数超过RELAY_MAX_DEVICES（0=不限）时新连接回busy后直接断开
+RELAY_MAX_UPSTREAM_SESSIONS = int(os.environ.get("RELAY_MAX_UPSTREAM_SESSIONS", "64"))
+RELAY_UPSTREAM_QUEUE = int(os.environ.get("RELAY_UPSTREAM_QUEUE", "16"))
+RELAY_UPSTREAM_WAIT_S = float(os.environ.get("RELAY_UPSTREAM_WAIT_S", "3"))
+RELAY_MAX_DEVICES = int(os.environ.get("RELAY_MAX_DEVICES", "0"))
+BUSY_RETRY_S = 5.0          # 回过busy后这么久之内，旧固件继续发来的音频不再重试开会话
+
+# 🌐 豆包接入点选择：DOUBAO_BASE_URLS有多个时，后台每RELAY_UPSTREAM_PROBE_S秒对每个接入点建连一次（0=不探测），
+# 建连耗时做指数平均，新连接总用最快的健康接入点。建连超过RELAY_UPSTREAM_CONNECT_TIMEOUT_S、或者StartSession
+# 超过RELAY_UPSTREAM_START_TIMEOUT_S没有确认时，这个接入点冷却（连续失败时加倍，最长UPSTREAM_COOLDOWN_MAX_S），
+# 正在开始的会话立即换下一个接入点重试，设备只多等一次建连
+RELAY_UPSTREAM_PROBE_S = float(os.environ.get("RELAY_UPSTREAM_PROBE_S", "30"))
+RELAY_UPSTREAM_CONNECT_TIMEOUT_S = float(os.environ.get("RELAY_UPSTREAM_CONNECT_TIMEOUT_S", "5"))
+RELAY_UPSTREAM_START_TIMEOUT_S = float(os.environ.get("RELAY_UPSTREAM_START_TIMEOUT_S", "5"))
+# ⏱️ 建连提速：接入点域名的解析结果缓存RELAY_UPSTREAM_DNS_TTL_S秒（0=每次解析；解析失败时先用过期的），
+# 所有豆包连接共用一个TLS上下文（不再每条连接重新加载系统CA证书）；预热池空着、要现场建连时
+# StartConnection发出去不等确认就接着发StartSession（RELAY_UPSTREAM_PIPELINE=0关闭），少等一个往返
+RELAY_UPSTREAM_DNS_TTL_S = float(os.environ.get("RELAY_UPSTREAM_DNS_TTL_S", "300"))
+RELAY_UPSTREAM_PIPELINE = os.environ.get("RELAY_UPSTREAM_PIPELINE", "1") != "0"
+UPSTREAM_COOLDOWN_S = 15.0
+UPSTREAM_COOLDOWN_MAX_S = 300.0
+UPSTREAM_LATENCY_ALPHA = 0.3    # 建连耗时指数平均的权重
+
+# 📮 每台设备的下行消息先进有界队列，由单独的任务写进WebSocket：链路慢时队列超过RELAY_SEND_QUEUE_BYTES
+# 就从最早的音频开始丢（控制消息不丢），一条消息RELAY_SEND_TIMEOUT_S秒写不出去（链路已死）就断开连接。
+# 发给豆包的音频同样最多等RELAY_SEND_TIMEOUT_S秒
+RELAY_SEND_QUEUE_BYTES = int(os.environ.get("RELAY_SEND_QUEUE_BYTES", str(96 * 1024)))
+RELAY_SEND_TIMEOUT_S = float(os.environ.get("RELAY_SEND_TIMEOUT_S", "10"))
+
+# 🧮 每个会话的内存上限：设备WebSocket的收发缓冲按音频码率收紧（设备的消息最大几KB，RELAY_WS_MAX_SIZE留足余量；
+# 排着没读的最多RELAY_WS_MAX_QUEUE条），豆包响应队列里排着的TTS音频超过RELAY_SESSION_TTS_QUEUE_BYTES时
+# 这一轮后面的音频不再排队；每RELAY_MEMORY_CHECK_S秒统计一次会话占用的缓冲区，超过RELAY_SESSION_BUDGET_BYTES
+# （0=不限）时按 上一轮回复→要缓存的回复→本轮回复的副本→排着的TTS音频 的顺序裁掉，音频少一截、进程不涨。
+# 设置了RELAY_MAX_DEVICES时启动日志给出整台中继的最大占用
+RELAY_WS_MAX_SIZE = int(os.environ.get("RELAY_WS_MAX_SIZE", str(64 * 1024)))
+RELAY_WS_MAX_QUEUE = int(os.environ.get("RELAY_WS_MAX_QUEUE", "8"))
+RELAY_WS_READ_LIMIT = int(os.environ.get("RELAY_WS_READ_LIMIT", str(16 * 1024)))
+RELAY_WS_WRITE_LIMIT = int(os.environ.get("RELAY_WS_WRITE_LIMIT", str(32 * 1024)))
+RELAY_SESSION_TTS_QUEUE_BYTES = int(os.environ.get("RELAY_SESSION_TTS_QUEUE_BYTES", str(1024 * 1024)))
+RELAY_SESSION_BUDGET_BYTES = int(os.environ.get("RELAY_SESSION_BUDGET_BYTES", str(4 * 1024 * 1024)))
+RELAY_MEMORY_CHECK_S = float(os.environ.get("RELAY_MEMORY_CHECK_S", "1"))
+
+# 📤 发给豆包的上行音频也先进有界队列（RELAY_UPLINK_QUEUE_FRAMES条设备消息），由单独的任务写：豆包那边写得慢时
+# 照样读ESP32的消息。积压了几条时写任务把同一会话连续的PCM合成一条消息，最多RELAY_UPLINK_BATCH_MS毫秒；
+# 队列满了（豆包真的跟不上）读ESP32才等待
+RELAY_UPLINK_QUEUE_FRAMES = int(os.environ.get("RELAY_UPLINK_QUEUE_FRAMES", "100"))
+RELAY_UPLINK_BATCH_MS = int(os.environ.get("RELAY_UPLINK_BATCH_MS", "100"))
+# 不积压时写任务也可以等一会儿再发：第一条到了之后最多再等RELAY_UPLINK_LATENCY_MS毫秒，把后面到的接上一起发
+# （设备20ms一帧时40ms大约少一半的消息）；speech_end和换会话时立即发出，不影响说完到识别结束的延迟。0=不等
+RELAY_UPLINK_LATENCY_MS = int(os.environ.get("RELAY_UPLINK_LATENCY_MS", "40"))
+
+# 监听地址
+RELAY_HOST = "0.0.0.0"
+RELAY_PORT = int(os.environ.get("RELAY_PORT", "8888"))
+
+# 多进程模式：RELAY_WORKERS>1时主进程只负责fork和守护worker，每个worker用SO_REUSEPORT监听RELAY_PORT，
+# 另外各自监听直连端口RELAY_WORKER_PORT_BASE+序号。设备hello里带device_id，
+# 不归当前worker的设备会收到route_port提示，之后重连直接连到固定的worker
+RELAY_WORKERS = int(os.environ.get("RELAY_WORKERS", "1"))
+RELAY_WORKER_PORT_BASE = 8900
+RELAY_DRAIN_TIMEOUT_S = float(os.environ.get("RELAY_DRAIN_TIMEOUT_S", "30"))   # 收到SIGTERM后停止接入新连接，最多等这么久让已有对话结束
+
+# 🚚 滚动重启：RELAY_ROLLING_RESTART=1时所有监听端口都带SO_REUSEPORT，新进程先起来和旧进程一起监听，
+# 再给旧进程发SIGTERM：旧进程关掉监听socket（新连接只落到新进程），每个连接等这一轮对话结束
+# （上下行RELAY_MOVE_IDLE_S秒没有音频）后发{"type":"move","delay_ms":...}再断开，delay_ms在0~RELAY_MOVE_SPREAD_MS里随机，
+# 设备按它错开重连、不走退避。学到的停顿统计（ASR结束窗口）写进RELAY_HANDOFF_FILE，新进程启动时读回
+# （文件超过RELAY_HANDOFF_MAX_AGE_S秒不用；多进程时每个worker一个文件，按序号区分）
+RELAY_ROLLING_RESTART = os.environ.get("RELAY_ROLLING_RESTART", "0") == "1"
+RELAY_MOVE_IDLE_S = float(os.environ.get("RELAY_MOVE_IDLE_S", "1"))
+RELAY_MOVE_SPREAD_MS = int(os.environ.get("RELAY_MOVE_SPREAD_MS", "10000"))
+RELAY_HANDOFF_FILE = os.environ.get("RELAY_HANDOFF_FILE", "")
+RELAY_HANDOFF_MAX_AGE_S = float(os.environ.get("RELAY_HANDOFF_MAX_AGE_S", "600"))
+
+# 🔐 同时设置证书链和私钥时监听wss://（设备端URI改成wss://，用ESP-IDF证书包验证，自签名证书需要加进自定义证书包）
+# 只开TLS 1.2：设备上的mbedTLS只启用了1.2，session ticket由OpenSSL自动签发，设备重连时复用会话跳过完整握手。
+# 票据密钥每个worker进程各自生成，设备按route_port固定到某个worker后重连才能复用
+RELAY_TLS_CERT = os.environ.get("RELAY_TLS_CERT", "")
+RELAY_TLS_KEY = os.environ.get("RELAY_TLS_KEY", "")
+
+# 按部署现场调整ESP32唤醒词参数（误唤醒率和CPU之间取舍），设备hello后下发，设备写入NVS
+# 例如 RELAY_WAKE_CONFIG='{"mode":95,"threshold":0.62,"model2":"*"}'，字段含义见main/wake_settings.h
+RELAY_WAKE_CONFIG = json.loads(os.environ.get("RELAY_WAKE_CONFIG", "null"))
+
+# 🎚️ 按设备下发运行时参数（预缓冲、超时、重连退避、心跳等，字段见main/runtime_config.h），设备hello后下发，设备写入NVS
+# 一个对象=所有设备相同；数组=A/B对比，每台设备按device_id固定分到其中一组，
+# 例如 RELAY_RUNTIME_CONFIG='[{"experiment":"a"},{"experiment":"b","prebuffer_ms":120}]'。
+# 设备回复和之后的STATS日志都带experiment，按组汇总即可对比
+RELAY_RUNTIME_CONFIG = json.loads(os.environ.get("RELAY_RUNTIME_CONFIG", "null"))
+
+# 📦 固件升级：RELAY_OTA_DIR是tools/make_delta.py的输出目录（manifest.json + 补丁和完整镜像），
+# RELAY_OTA_URL是设备访问这个目录的HTTP(S)地址（例如另起 python -m http.server -d ota 8000）。
+# 设备hello里带当前固件的哈希，有对应的差分补丁就发补丁，没有就发完整镜像；
+# 每个worker同时最多RELAY_OTA_MAX_ACTIVE台设备在下载，其余在之后的STATS上报时再轮到，免得挤满AP
+RELAY_OTA_DIR = os.environ.get("RELAY_OTA_DIR", "")
+RELAY_OTA_URL = os.environ.get("RELAY_OTA_URL", "").rstrip("/")
+RELAY_OTA_MAX_ACTIVE = int(os.environ.get("RELAY_OTA_MAX_ACTIVE", "4"))
+
+# 📻 长音频直连（见main/media_stream.h）：GET /media?action=play&url=<地址>[&offset_ms=N][&device=<device_id>]
+# 让设备自己用HTTP(S)下载播放一段WAV（16kHz单声道PCM16/IMA-ADPCM），音频不经过中继；action=pause/resume/stop控制播放。
+# 设备回media_status（暂停、播完时带offset和played_ms），打成"📻 MEDIA"日志；设备被唤醒打断时停在reason=interrupted，
+# 要接着播就再发resume（设备记着地址和位置），设备重启过就用play带offset_ms=played_ms。
+# 地址要能被设备直接访问，支持Range请求时断线和恢复不用从头下载
+
+# 📦 推送提示音（见main/asset_cache.h）：RELAY_ASSET_DIR下的*.wav（16kHz单声道16位），文件名去掉扩展名就是提示音名称
+# （最多15字节，和提示音分区里同名的优先用这里的），启动时编成IMA-ADPCM，按内容的SHA-256前16个十六进制字符寻址。
+# 协商了"assets"的设备在hello回复之后收到分页清单，缺的自己从GET /asset/<哈希>下载（走中继的WebSocket端口），
+# 换了内容的文件哈希跟着变，设备下次连上就换；GET /asset_play?name=<名称>（或id=<哈希>）[&device=<device_id>]让空闲的设备播一条
+RELAY_ASSET_DIR = os.environ.get("RELAY_ASSET_DIR", "")
+ASSET_BLOCK_SAMPLES = 320       # ADPCM块164字节，最后一块补静音
+ASSET_MAX_ENTRIES = 16          # 和设备的ASSET_MAX_ENTRIES、ASSET_MAX_BYTES一致
+ASSET_MAX_BYTES = 64 * 1024
+ASSET_MANIFEST_PAGE = 6         # 每页清单的条目数：base最长127字节时一页也不超过设备事件任务的消息上限（768字节）
+
+# 💾 回复缓存：同一个问题（ASR文本归一化后相同）在有效期内直接重放上次的回复音频，不等豆包生成
+# RELAY_CACHE_TTL_S=0关闭；设置RELAY_CACHE_DIR后同时存到磁盘，重启和多个worker之间共享
+RESPONSE_CACHE_TTL_S = float(os.environ.get("RELAY_CACHE_TTL_S", "600"))
+RESPONSE_CACHE_DIR = os.environ.get("RELAY_CACHE_DIR", "")
+RESPONSE_CACHE_MAX_ENTRIES = 64
+RESPONSE_CACHE_MAX_BYTES = ESP32_SAMPLE_RATE * 2 * 20     # 超过20秒的回复不缓存
+# 🛫 同一个问题正在被别的会话回答（还没进缓存）：跟着那一路的TTS下发（每台设备按自己的额度发，快慢互不影响），
+# 自己这一路豆包生成的音频丢弃，和缓存命中一样。领头的回复被打断或断开时跟随的设备就在那里结束这轮回复。
+# RELAY_SINGLEFLIGHT_CONTEXT=first时只在两边都是会话第一轮（没有上下文）时合并，any=不管上下文。0=关闭
+RELAY_SINGLEFLIGHT = os.environ.get("RELAY_SINGLEFLIGHT", "1") == "1"
+RELAY_SINGLEFLIGHT_CONTEXT = os.environ.get("RELAY_SINGLEFLIGHT_CONTEXT", "first")
+# 答案随时间变化的问题不缓存（天气这类变化慢的靠有效期兜底）
+RESPONSE_CACHE_SKIP = re.compile(r"几点|时间|几号|日期|星期几|礼拜几|周几")
+
+# 🤝 hello协议版本：设备的hello带"v"和"features"（它懂的可选行为），服务器回min(设备版本, HELLO_VERSION)
+# 和它同意的features；没有"v"的旧固件按版本1，只用hello里原有的字段。不发hello的更旧固件照样按PCM服务
+HELLO_VERSION = 2
+HELLO_FEATURES = ("credit", "move", "playback_resume", "text_query", "udp", "reply_eta", "media", "soak", "assets")
+
+# ⏳ 回复预估：协商了"reply_eta"的设备在说完时收到{"type":"reply_eta","ms":E}，E是最近几轮（不含缓存命中）
+# 说完到第一条下行的指数平均；E超过设备的等待阈值时设备提前播"思考中"提示音（见main/thinking_filler.h），
+# 这一轮从缓存回复时再发一次ms=0。RELAY_REPLY_ETA_ALPHA是新样本的权重，0=不发
+RELAY_REPLY_ETA_ALPHA = float(os.environ.get("RELAY_REPLY_ETA_ALPHA", "0.2"))
+
+# 📦 ESP32在hello里提出用二进制控制帧时同意（见main/control_protocol.h）；设为json时一直用JSON文本，方便抓包调试
+RELAY_CONTROL = os.environ.get("RELAY_CONTROL", "binary")
+
+# 🧾 ESP32在hello里带"framing":"seq"时同意给上下行音频消息加帧头（序号+时间戳，见main/audio_framing.h）
+# 设为0时音频消息只有负载，和旧固件一样
+RELAY_AUDIO_FRAMING = os.environ.get("RELAY_AUDIO_FRAMING", "1") == "1"
+
+# 🎚️ ESP32在hello里下行带f32_24k（设备上重采样）、豆包又输出f32_24k时，音频原样透传，服务器不重采样
+# 下行带宽是16kHz PCM的3倍、ADPCM的12倍，适合信号好的局域网；默认关闭，仍由服务器重采样后按ADPCM/PCM下发
+RELAY_DEVICE_RESAMPLE = os.environ.get("RELAY_DEVICE_RESAMPLE", "0") == "1"
+
+# 🎙️ 会话录制：设置后每个连接的上下行消息原样写成 <目录>/<时间>-<会话ID前8位>.vcap
+# ESP32同意时（hello里"capture":true）同时写入设备端收发时间，回放见tools/replay_capture.py
+RELAY_CAPTURE_DIR = os.environ.get("RELAY_CAPTURE_DIR", "")
+
+# 🧪 豆包帧样本：设置后把从豆包收到的前RELAY_UPSTREAM_FIXTURE_FRAMES帧原样写进这个文件（多worker时加.<pid>后缀），
+# 给bench_hotpaths.py当测试数据，用线上真实的帧测解析和重采样的吞吐；写满后关闭，不影响转发
+RELAY_UPSTREAM_FIXTURE = os.environ.get("RELAY_UPSTREAM_FIXTURE", "")
+RELAY_UPSTREAM_FIXTURE_FRAMES = int(os.environ.get("RELAY_UPSTREAM_FIXTURE_FRAMES", "2000"))
+
+# 🗄️ 音频归档（质检用）：设置后每轮对话的上行音频和TTS回复各存一段 <目录>/<日期>/<时间>-<会话>-t<轮>-up|down.opus
+# 转发路径只把PCM放进有上限的队列，压缩和写盘在单独的线程里；队列里超过RELAY_ARCHIVE_QUEUE_BYTES时
+# 先丢归档（计入relay_archive_bytes_total{result="dropped"}），从不拖慢实时音频。没有opuslib时存成.pcm.gz
+RELAY_ARCHIVE_DIR = os.environ.get("RELAY_ARCHIVE_DIR", "")
+RELAY_ARCHIVE_QUEUE_BYTES = int(os.environ.get("RELAY_ARCHIVE_QUEUE_BYTES", str(8 * 1024 * 1024)))
+RELAY_ARCHIVE_BITRATE = int(os.environ.get("RELAY_ARCHIVE_BITRATE", "24000"))
+ARCHIVE_IDLE_S = 30.0           # 这么久没有新数据的段（连接异常断开、会话释放）由写线程自己收尾
+ARCHIVE_PAGE_PACKETS = 50       # 每个Ogg页放1秒（50个20ms包），攒够一页才写一次文件
+
+# 🔬 调度追踪：SIGUSR2时让所有ESP32记录RELAY_SCHED_TRACE_MS毫秒的调度标记（固件需用SCHED_TRACE_MODE=2构建），
+# 每台设备写成 <目录>/<时间>-<设备>.trace.json（Chrome trace格式，用Perfetto或chrome://tracing打开）
+RELAY_SCHED_TRACE_DIR = os.environ.get("RELAY_SCHED_TRACE_DIR", "sched_traces")
+RELAY_SCHED_TRACE_MS = int(os.environ.get("RELAY_SCHED_TRACE_MS", "5000"))
+
+# 🛩️ 黑匣子：设备软件复位/崩溃后连上来时上传复位前的事件记录（见main/flight_recorder.h），
+# 写成 <目录>/<时间>-<设备>.flight.json，并打一行"🛩️ FLIGHT"汇总（空=只打日志不写文件）
+RELAY_FLIGHT_DIR = os.environ.get("RELAY_FLIGHT_DIR", "flight_records")
+
+# 💰 每轮资源账单：设备的{"type":"cost"}（上下行字节、各核心CPU、写socket耗时、缓冲区峰值，见main/turn_cost.h）
+# 和中继这一轮的上游字节、重采样CPU、事件循环时间按会话ID合并，打一行"💰 COST"；
+# 设置RELAY_COST_LOG时同时追加到这个JSONL文件，按codec/VAD/合包等功能组合汇总就是容量规划的数据
+RELAY_COST_LOG = os.environ.get("RELAY_COST_LOG", "")
+RELAY_COST_JOIN_S = float(os.environ.get("RELAY_COST_JOIN_S", "30"))    # 中继账单等设备账单的最长时间，超时只导出中继一侧
+
+# 🔥 浸泡测试（见main/soak_test.h）：设为下面的配置名后，hello里带"soak"的设备（-DSOAK_TEST=1的固件）不开豆包会话，
+# 每次speech_end回一段中继合成的回复（调幅音调），按配置突发、抖动地下发，偶尔在回复中途断开连接；
+# 设备定时发{"type":"soak",...}报告，中继按下面的门槛判定通过与否，打一行"🔥 SOAK"。空=不接受浸泡设备
+#   burst: 几块攒在一起发，发完停同样的时长（平均仍是实时）；jitter_ms: 每次发送前再随机等0~这么久；
+#   drop_p: 每次回复在中途断开WebSocket的概率（设备走重连和续播）
+SOAK_PROFILES = {
+    "steady": {"burst": 1, "jitter_ms": 0, "drop_p": 0.0},
+    "bursty": {"burst": 8, "jitter_ms": 0, "drop_p": 0.0},
+    "jittery": {"burst": 1, "jitter_ms": 150, "drop_p": 0.0},
+    "chaos": {"burst": 6, "jitter_ms": 200, "drop_p": 0.05},
+}
+RELAY_SOAK_PROFILE = os.environ.get("RELAY_SOAK_PROFILE", "")
+RELAY_SOAK_THINK_MS = (int(os.environ.get("RELAY_SOAK_THINK_MIN_MS", "200")),
+                       int(os.environ.get("RELAY_SOAK_THINK_MAX_MS", "900")))     # 说完到第一块回复的随机延迟
+RELAY_SOAK_REPLY_MS = (int(os.environ.get("RELAY_SOAK_REPLY_MIN_MS", "1500")),
+                       int(os.environ.get("RELAY_SOAK_REPLY_MAX_MS", "6000")))    # 合成回复的随机时长
+# 门槛：每小时的计数按报告里的uptime_s折算；heap_leak是内部RAM比测试开始时少了多少字节
+RELAY_SOAK_MAX_P95_MS = int(os.environ.get("RELAY_SOAK_MAX_P95_MS", "1500"))
+RELAY_SOAK_MAX_UNDERRUNS_PER_H = float(os.environ.get("RELAY_SOAK_MAX_UNDERRUNS_PER_H", "20"))
+RELAY_SOAK_MAX_DROPS_PER_H = float(os.environ.get("RELAY_SOAK_MAX_DROPS_PER_H", "50"))
+RELAY_SOAK_MAX_FRAG_PCT = int(os.environ.get("RELAY_SOAK_MAX_FRAG_PCT", "60"))
+RELAY_SOAK_MAX_HEAP_LEAK = int(os.environ.get("RELAY_SOAK_MAX_HEAP_LEAK", "16384"))
+
+# 🛰️ 网络自检：GET /net_test?mode=ws|tcp&ms=5000&size=1024[&device=<device_id>]让空闲的ESP32测双向吞吐和满载RTT，
+# 结果和当前音频编码需要的码率一起打成"🛰️ NETTEST"日志；tcp模式的裸TCP测试连到RELAY_NET_TEST_PORT（0=不监听）
+RELAY_NET_TEST_PORT = int(os.environ.get("RELAY_NET_TEST_PORT", "8890"))
+
+# 📶 发往设备的包的DSCP（和固件的WS_DSCP对应）：46=EF，AP按RFC 8325放进WMM语音队列（AC_VO），0=不标记。
+# /net_test带dscp=N时自检期间设备和服务器两侧都临时换成N，连着测dscp=0和dscp=46就能看出标记前后的RTT差别
+RELAY_DSCP = int(os.environ.get("RELAY_DSCP", "46"))
+
+# 📡 UDP音频通道（见main/udp_audio.h）：设备hello带"udp"且协商了帧头时回复"udp":{"port":P,"token":T}，
+# 两个方向的音频改走UDP数据报，丢一个包不再卡住后面的音频；控制消息和兜底留在WebSocket。
+# 多进程时每个worker监听RELAY_UDP_PORT+序号。数据报不加密，0=不开
+RELAY_UDP_PORT = int(os.environ.get("RELAY_UDP_PORT", "0"))
+RELAY_UDP_REDUNDANCY = os.environ.get("RELAY_UDP_REDUNDANCY", "1") == "1"     # 放得下时每个下行数据报附带上一条消息的副本
+RELAY_UDP_REORDER_MS = int(os.environ.get("RELAY_UDP_REORDER_MS", "60"))      # speech_end比最后几个上行数据报先到：等这么久再结束这句话
+RELAY_UDP_REPORT_S = float(os.environ.get("RELAY_UDP_REPORT_S", "1.0"))       # 给设备发上行接收报告的间隔
+RELAY_UDP_REPORT_TIMEOUT_S = float(os.environ.get("RELAY_UDP_REPORT_TIMEOUT_S", "3.5"))  # 下行走UDP时设备这么久没报告就退回WebSocket
+RELAY_UDP_FALLBACK_LOSS_PCT = int(os.environ.get("RELAY_UDP_FALLBACK_LOSS_PCT", "20"))  # 一段报告的丢失率超过这个值算差
+RELAY_UDP_FALLBACK_REPORTS = int(os.environ.get("RELAY_UDP_FALLBACK_REPORTS", "3"))     # 连续这么多段差，下行退回WebSocket
+RELAY_UDP_INBOX = 64            # 一个连接排着还没处理的上行UDP消息上限（读循环跟不上时丢最新的）
+
+# 🧭 在局域网里用mDNS广播本中继（见main/relay_selector.h）：设备启动时在发现的和配置的中继之间按建连RTT挑最近的。
+# 需要pip install zeroconf；多进程时只有worker 0广播公共端口RELAY_PORT，排空（滚动重启）时先撤掉广播
+RELAY_MDNS = os.environ.get("RELAY_MDNS", "0") == "1"
+RELAY_MDNS_SERVICE = os.environ.get("RELAY_MDNS_SERVICE", "_voicerelay")     # 和固件的RELAY_MDNS_SERVICE一致
+RELAY_MDNS_NAME = os.environ.get("RELAY_MDNS_NAME", socket.gethostname())   # 服务实例名，重名时自动加后缀
+
+# 🧵 豆包帧解析（gzip+JSON）、下行重采样和ADPCM编码放到线程池里，事件循环只负责收发，
+# 一台设备的大TTS包不会给同一进程的其他设备加延迟。RELAY_CPU_THREADS=0时仍在事件循环里执行
+RELAY_CPU_THREADS = int(os.environ.get("RELAY_CPU_THREADS", str(min(4, os.cpu_count() or 1))))
+CPU_OFFLOAD_MIN_BYTES = 4096    # 比这小的豆包帧直接解析，换线程的开销比解析本身还大
+
+# 🧮 下行重采样跨会话合批：RELAY_RESAMPLE_BATCH_MS毫秒内所有设备要重采样的TTS包攒成一批，一次线程池任务、一次numpy点积，
+# 设备多时省掉大部分逐包的调度开销（每包最多多等这么久）；攒够RELAY_RESAMPLE_BATCH_MAX个包立即提交。0=逐包处理
+RELAY_RESAMPLE_BATCH_MS = float(os.environ.get("RELAY_RESAMPLE_BATCH_MS", "5"))
+RELAY_RESAMPLE_BATCH_MAX = int(os.environ.get("RELAY_RESAMPLE_BATCH_MAX", "64"))
+
+# ⚖️ 会话间公平调度：事件循环上每个会话连续执行超过RELAY_FAIR_SLICE_MS毫秒就让出一次；每RELAY_FAIR_TICK_MS毫秒里
+# 各会话按权重分RELAY_FAIR_BUDGET_MS毫秒的循环时间，有别的会话在抢时超过份额的会话等到下一个tick再接着处理
+# （没人抢时不限）。权重默认1，RELAY_FAIR_WEIGHTS="设备ID:权重,..."单独指定；RELAY_FAIR=0关闭（只统计不调度）
+RELAY_FAIR = os.environ.get("RELAY_FAIR", "1") != "0"
+RELAY_FAIR_TICK_MS = float(os.environ.get("RELAY_FAIR_TICK_MS", "20"))
+RELAY_FAIR_BUDGET_MS = float(os.environ.get("RELAY_FAIR_BUDGET_MS", "10"))
+RELAY_FAIR_SLICE_MS = float(os.environ.get("RELAY_FAIR_SLICE_MS", "2"))
+RELAY_FAIR_WEIGHTS = {
+    name.strip(): float(weight)
+    for name, _, weight in (item.rpartition(":") for item in os.environ.get("RELAY_FAIR_WEIGHTS", "").split(","))
+    if name.strip()
+}
+
+# 💤 ESP32会话超时（没人说话）时发session_end，服务器结束豆包会话、保留ESP32连接，下次唤醒的session_start
+# 或音频到达时再开始新会话。旧固件不发session_end，上下行都空闲超过RELAY_SESSION_IDLE_S秒时服务器自己释放，0=不释放
+RELAY_SESSION_IDLE_S = float(os.environ.get("RELAY_SESSION_IDLE_S", "120"))
+
+# 🔌 设备断开后它的豆包会话按hello里的device_id暂存RELAY_RESUME_GRACE_S秒（0=立即结束），期间同一设备重连时直接接上：
+# WiFi闪断只多一次TCP/WebSocket握手，不用重新StartConnection/StartSession，对话上下文和"再说一遍"的内容都还在。
+# 旧连接还没发现断开时新连接的hello会把会话直接接过来。暂存期间会话照样占着RELAY_MAX_UPSTREAM_SESSIONS的名额
+RELAY_RESUME_GRACE_S = float(os.environ.get("RELAY_RESUME_GRACE_S", "30"))
+# 🔌 回复放到一半断开：重连的hello带"playback":{"seq":断开前最后收到的下行seq,"unplayed":还没播的样本数}，
+# 服务器按本轮记下的下行消息序号找到播到的那一条，从那里接着发（最多重复半条消息），后面的TTS照常转发。
+# 要求协商了帧头、下行编码和断开前一样；对不上时和以前一样丢弃这轮剩下的回复。0=总是丢弃
+RELAY_DOWNLINK_RESUME = os.environ.get("RELAY_DOWNLINK_RESUME", "1") == "1"
+
+# 💬 文字问题：设备的本地命令词已经听懂了整句问题（例如问天气）时发{"type":"text_query","text":...}，
+# 不上传音频；服务器在同一个豆包会话里发ChatTextQuery(501)开一轮对话，跳过云端识别和说完判定，
+# 回复和语音轮次一样下发（缓存、同问题跟随照常）。hello的features里有"text_query"才会发，0=不同意
+RELAY_TEXT_QUERY = os.environ.get("RELAY_TEXT_QUERY", "1") == "1"
+RELAY_TEXT_QUERY_MAX_CHARS = 200
+
+# 🌙 ESP32进深度睡眠前发{"type":"sleep","ms":N}（N=定时醒来的毫秒数，0=只有按键唤醒），断开后豆包会话改为暂存
+# min(RELAY_SLEEP_PARK_S, N/1000+RELAY_RESUME_GRACE_S)秒（0=和普通断开一样）。醒来的hello带resume.session，
+# 和暂存的会话对得上才接上；对不上（比如中途换过一次服务器会话）就结束它，按新会话开始
+RELAY_SLEEP_PARK_S = float(os.environ.get("RELAY_SLEEP_PARK_S", "120"))
+
+# 🔥 预热：ESP32空闲时麦克风能量突然起来（可能是唤醒词的开头）就发{"type":"warmup"}，服务器趁WakeNet确认的这几百毫秒
+# 先开好豆包会话，session_start到的时候直接用。RELAY_WARMUP_S秒内没有确认的唤醒（或者仲裁输了、复核没通过）
+# 就释放，一次误触发只多一次StartSession/FinishSession（0=忽略warmup）。会话名额满时不排队，也不回busy
+RELAY_WARMUP_S = float(os.environ.get("RELAY_WARMUP_S", "5"))
+
+# 🛡️ 唤醒二次确认：ESP32在hello里提出"wake_verify"时，会话上行最前面是唤醒词那段音频（session_start的verify=样本数），
+# 服务器用更重的模型复核，分数到RELAY_WAKE_VERIFY_THRESHOLD才开始/接上豆包会话并转发后面的音频，没到就回
+# wake_verdict让ESP32取消这次唤醒，这段上行全部丢弃。RELAY_WAKE_VERIFIER=openwakeword:<模型名或模型文件>，空=不复核。
+# 唤醒词音频RELAY_WAKE_VERIFY_WAIT_S秒内没收齐、或者模型出错时放行（宁可多开会话也不吞掉真唤醒）
+RELAY_WAKE_VERIFIER = os.environ.get("RELAY_WAKE_VERIFIER", "")
+RELAY_WAKE_VERIFY_THRESHOLD = float(os.environ.get("RELAY_WAKE_VERIFY_THRESHOLD", "0.5"))
+RELAY_WAKE_VERIFY_WAIT_S = float(os.environ.get("RELAY_WAKE_VERIFY_WAIT_S", "2"))
+WAKE_HOLD_MAX_BYTES = ESP32_SAMPLE_RATE * 2 * 10    # 复核结果出来之前最多攒10秒后面的音频
+
+# 🏠 多设备唤醒仲裁：同一个房间里几台设备同时听到唤醒词时只让一台开豆包会话。RELAY_WAKE_ROOMS按hello里的
+# device_id分组，格式"客厅=dev-a,dev-b;办公区=dev-c,dev-d"，不在任何房间里的设备不参与。房间里第一台的
+# session_start到达后等RELAY_WAKE_ARBITRATION_MS（0=关闭），窗口内唤醒词音量（session_start的wake_db）最大的
+# 继续，一样大时先到的继续；其余的回wake_verdict（reason=arbitration），设备安静地回到空闲，这次的上行全部丢弃。
+# 选出之后再过一个窗口才到的也算输。等窗口期间这台设备的消息暂不处理（最多多等一个窗口）。
+# 多进程时同一房间的设备按房间名路由到同一个worker
+RELAY_WAKE_ROOMS = os.environ.get("RELAY_WAKE_ROOMS", "")
+RELAY_WAKE_ARBITRATION_MS = int(os.environ.get("RELAY_WAKE_ARBITRATION_MS", "150"))
+WAKE_ROOM_OF = {device.strip(): room.strip()
+                for room, _, devices in (part.partition("=") for part in RELAY_WAKE_ROOMS.split(";") if part.strip())
+                for device in devices.split(",") if device.strip()}
+
+# 📈 按现场自动调唤醒词阈值：RELAY_WAKE_TUNING=1时中继记下每次唤醒（session_start带触发的模型和设备当前阈值，
+# 置信度取二次确认的得分，没有复核时用唤醒词音量）后面有没有真的问题（非空的ASR最终结果、设备本地识别的文字或本地命令），
+# 下一次唤醒或session_end之前都没有就算误唤醒，复核没通过的直接算误唤醒；按键说话、仲裁输了和中途断开的不算。
+# 一个现场=RELAY_WAKE_ROOMS里的一个房间（不在房间里的设备自己一个现场），每个现场每个模型保留最近
+# RELAY_WAKE_TUNE_WINDOW次唤醒，攒够RELAY_WAKE_TUNE_MIN_SAMPLES次后：误唤醒比例高于RELAY_WAKE_TUNE_FALSE_HIGH就把阈值
+# 提高RELAY_WAKE_TUNE_STEP（少开上游会话），低于RELAY_WAKE_TUNE_FALSE_LOW就降低一步（更容易叫醒，漏唤醒中继看不到，
+# 只能靠误唤醒少时往灵敏的方向试），阈值限制在RELAY_WAKE_TUNE_MIN~RELAY_WAKE_TUNE_MAX。调整后清空这一窗口重新统计，
+# 新阈值用wake_config下发给这个现场所有在线的设备（设备立即生效并写进NVS），之后hello的设备也下发。
+# 设备用的是模型默认阈值（上报0）时从RELAY_WAKE_TUNE_START开始调；中继重启后从设备上报的阈值接着调
+RELAY_WAKE_TUNING = os.environ.get("RELAY_WAKE_TUNING", "0") == "1"
+RELAY_WAKE_TUNE_WINDOW = int(os.environ.get("RELAY_WAKE_TUNE_WINDOW", "50"))
+RELAY_WAKE_TUNE_MIN_SAMPLES = int(os.environ.get("RELAY_WAKE_TUNE_MIN_SAMPLES", "20"))
+RELAY_WAKE_TUNE_FALSE_LOW = float(os.environ.get("RELAY_WAKE_TUNE_FALSE_LOW", "0.1"))
+RELAY_WAKE_TUNE_FALSE_HIGH = float(os.environ.get("RELAY_WAKE_TUNE_FALSE_HIGH", "0.3"))
+RELAY_WAKE_TUNE_STEP = float(os.environ.get("RELAY_WAKE_TUNE_STEP", "0.02"))
+RELAY_WAKE_TUNE_MIN = float(os.environ.get("RELAY_WAKE_TUNE_MIN", "0.5"))
+RELAY_WAKE_TUNE_MAX = float(os.environ.get("RELAY_WAKE_TUNE_MAX", "0.8"))
+RELAY_WAKE_TUNE_START = float(os.environ.get("RELAY_WAKE_TUNE_START", "0.6"))
+
+# 📊 WebSocket端口上同时提供GET /metrics（Prometheus文本格式），0=关闭。多进程时RELAY_PORT由内核随机分给某个worker，
+# 应该分别抓取各worker的直连端口（RELAY_WORKER_PORT_BASE+序号），每个序列都带worker标签
+RELAY_METRICS = os.environ.get("RELAY_METRICS", "1") == "1"
+METRICS_LOOP_LAG_INTERVAL_S = 0.5   # 事件循环延迟的采样间隔
+
 # 设置日志配置
-logging.basicConfig(level=logging.INFO)
+# RELAY_LOG_LEVEL=WARNING即发布配置：逐包日志全部关闭，只保留告警
+RELAY_LOG_LEVEL = os.environ.get("RELAY_LOG_LEVEL", "INFO").upper()
+LOG_SAMPLE_INTERVAL_S = float(os.environ.get("RELAY_LOG_SAMPLE_S", "5"))   # 逐包日志的汇总间隔
+logging.basicConfig(level=getattr(logging, RELAY_LOG_LEVEL, logging.INFO))
 logger = logging.getLogger(__name__)
 
+
+class SampledLog:
+    """
+    热路径日志采样：每个音频包只累加次数和字节数，每LOG_SAMPLE_INTERVAL_S秒最多输出一行汇总
+
+    原来每转发一包就打一行INFO，几十台设备时日志格式化和写终端本身就占掉一截CPU。
+    级别未开启时log()只做两次加法，不格式化字符串。
+    """
+
+    __slots__ = ("level", "label", "count", "nbytes", "last")
+
+    def __init__(self, level: int, label: str):
+        self.level = level
+        self.label = label
+        self.count = 0
+        self.nbytes = 0
+        self.last = time.monotonic()
+
+    def log(self, nbytes: int):
+        self.count += 1
+        self.nbytes += nbytes
+        now = time.monotonic()
+        if now - self.last < LOG_SAMPLE_INTERVAL_S:
+            return
+        if logger.isEnabledFor(self.level):
+            logger.log(self.level, f"{self.label}: {now - self.last:.1f}秒内 {self.count} 包，共 {self.nbytes} 字节")
+        self.count = 0
+        self.nbytes = 0
+        self.last = now
+
+# numpy和zlib计算时释放GIL，和事件循环真正并行；纯Python的部分（ADPCM编码、没有numpy时的重采样）仍要抢GIL，
+# 事件循环每个切换间隔能拿回一次，切换间隔从默认5ms调到1ms（几个线程轮流时5ms会叠成几十ms）。
+# 线程在第一次提交任务时才创建，多进程模式下fork之前不会有线程
+cpu_pool = None
+if RELAY_CPU_THREADS > 0:
+    cpu_pool = ThreadPoolExecutor(max_workers=RELAY_CPU_THREADS, thread_name_prefix="relay-cpu")
+    sys.setswitchinterval(0.001)
+
+
+class CpuLane:
+    """
+    一个连接的CPU任务通道：任务按提交顺序一个接一个在共享线程池里执行
+
+    重采样器和ADPCM编码器带跨包状态，同一连接的任务既不能并行也不能乱序；asyncio.Lock按等待顺序唤醒，
+    每个提交者等到自己的结果才继续，排队的任务数不超过等待它的协程数（有界，不会无限堆积）。
+    不同连接的任务在线程池里并行。
+    """
+
+    __slots__ = ("_lock", "jobs", "busy_s", "max_s")
+
+    def __init__(self):
+        self._lock = asyncio.Lock()
+        self.jobs = 0
+        self.busy_s = 0.0   # 任务执行的累计时间（不含排队）
+        self.max_s = 0.0
+
+    async def run(self, fn, *args, inline: bool = False):
+        """
+        按顺序执行fn(*args)并返回结果；inline=True时在事件循环里执行（很轻的操作，只需要和其他任务排好先后）
+        """
+        async with self._lock:
+            if inline or cpu_pool is None:
+                return fn(*args)
+            return await asyncio.get_running_loop().run_in_executor(cpu_pool, self._timed, fn, args)
+
+    async def run_batched(self, batcher, *args):
+        """
+        和run()一样按顺序排队，轮到时交给跨连接的批处理（batcher.process），等它的结果
+        """
+        async with self._lock:
+            return await batcher.process(self, *args)
+
+    def note(self, elapsed: float):
+        self.jobs += 1
+        self.busy_s += elapsed
+        self.max_s = max(self.max_s, elapsed)
+
+    def _timed(self, fn, args):
+        start = time.perf_counter()
+        try:
+            return fn(*args)
+        finally:
+            elapsed = time.perf_counter() - start
+            self.note(elapsed)
+            METRIC_CPU.inc(elapsed)
+            METRIC_CPU_JOBS.inc()
+
+    def summary(self) -> str:
+        return f"{self.jobs}个任务，累计{self.busy_s * 1000:.0f}ms，最长{self.max_s * 1000:.1f}ms"
+
+
+class FairLane:
+    """
+    ⚖️ 一个连接在事件循环上的时间账户：wrap()包起来的任务每执行一步（两次挂起之间）都记到这里
+    """
+
+    __slots__ = ("name", "weight", "tick", "used_s", "total_s", "steps", "max_step_s", "deferred", "step_start")
+
+    def __init__(self, name: str):
+        self.name = name        # 指标的device标签，hello后换成device_id
+        self.weight = RELAY_FAIR_WEIGHTS.get(name, 1.0)
+        self.tick = -1          # used_s属于哪个tick
+        self.used_s = 0.0
+        self.total_s = 0.0
+        self.steps = 0
+        self.max_step_s = 0.0
+        self.deferred = 0
+        self.step_start = 0.0   # 正在执行的这一步的开始时间（0=没在执行）
+
+    def rename(self, name: str):
+        self.name = name
+        self.weight = RELAY_FAIR_WEIGHTS.get(name, 1.0)
+
+    def wrap(self, coro) -> "_FairStep":
+        return _FairStep(coro, self)
+
+    def summary(self) -> str:
+        return (f"循环时间累计{self.total_s * 1000:.0f}ms，{self.steps}步，最长一步{self.max_step_s * 1000:.1f}ms，"
+                f"让出{self.deferred}次")
+
+
+class _FairStep(collections.abc.Coroutine):
+    """
+    包一层协程：Task每次send()/throw()推进一步，计时记到FairLane
+    """
+
+    __slots__ = ("_coro", "_lane")
+
+    def __init__(self, coro, lane: FairLane):
+        self._coro = coro
+        self._lane = lane
+
+    def _step(self, fn, *args):
+        lane = self._lane
+        lane.step_start = start = time.perf_counter()
+        try:
+            return fn(*args)
+        finally:
+            lane.step_start = 0.0
+            fair_scheduler.charge(lane, time.perf_counter() - start)
+
+    def send(self, value):
+        return self._step(self._coro.send, value)
+
+    def throw(self, *args):
+        return self._step(self._coro.throw, *args)
+
+    def close(self):
+        return self._coro.close()
+
+    def __await__(self):
+        return self
+
+    def __iter__(self):
+        return self
+
+    def __next__(self):
+        return self.send(None)
+
+
+class FairScheduler:
+    """
+    ⚖️ 会话间公平调度（加权轮转）
+
+    所有会话的收发、帧头、编码调度都在同一个事件循环上先来先服务：一台设备积压了一整段TTS时，
+    它的转发任务从队列里一口气取几十个包都不用挂起，其他设备的包只能等它处理完。
+    线程池那边每个连接经CpuLane排队，最多占一个线程，本来就是轮转的；这里管事件循环上的部分：
+    - 连续执行超过slice_s：让出一次（sleep(0)），排着的其他回调先跑
+    - 每tick_s按权重分budget_s：这个tick（或上一个tick）里还有别的会话在执行时，用完份额的会话等到下一个tick
+    只在转发循环的turn()处调度（一条消息处理完、取下一条之前），不会把一条消息拆开
+    """
+
+    def __init__(self, tick_s: float, budget_s: float, slice_s: float, enabled: bool):
+        self.tick_s = tick_s
+        self.budget_s = budget_s
+        self.slice_s = slice_s
+        self.enabled = enabled and tick_s > 0
+        self.lanes = set()
+        self.tick = 0
+        self._tick_at = time.monotonic()
+        self._weight = 0.0          # 这个tick里执行过的会话的权重和
+        self._prev_weight = 0.0
+
+    def _roll(self):
+        now = time.monotonic()
+        if now - self._tick_at < self.tick_s:
+            return
+        ticks = int((now - self._tick_at) / self.tick_s)
+        self.tick += ticks
+        self._tick_at += ticks * self.tick_s
+        self._prev_weight = self._weight if ticks == 1 else 0.0
+        self._weight = 0.0
+
+    def open(self, name: str) -> FairLane:
+        lane = FairLane(name)
+        self.lanes.add(lane)
+        return lane
+
+    def close(self, lane: FairLane):
+        self.lanes.discard(lane)
+
+    def charge(self, lane: FairLane, elapsed: float):
+        self._roll()
+        if lane.tick != self.tick:
+            lane.tick = self.tick
+            lane.used_s = 0.0
+            self._weight += lane.weight
+        lane.used_s += elapsed
+        lane.total_s += elapsed
+        lane.steps += 1
+        lane.max_step_s = max(lane.max_step_s, elapsed)
+
+    async def turn(self, lane: FairLane):
+        """
+        转发循环每处理完一条消息调用一次：该让出时在这里挂起
+        """
+        if not self.enabled:
+            return
+        self._roll()
+        running = time.perf_counter() - lane.step_start if lane.step_start else 0.0
+        if lane.tick == self.tick:
+            contending = max(self._weight, self._prev_weight)
+            if contending > lane.weight and lane.used_s + running >= self.budget_s * lane.weight / contending:
+                lane.deferred += 1
+                METRIC_FAIR_DEFERRED.inc(reason="budget")
+                await asyncio.sleep(max(0.0, self._tick_at + self.tick_s - time.monotonic()))
+                return
+        if running >= self.slice_s:
+            lane.deferred += 1
+            METRIC_FAIR_DEFERRED.inc(reason="slice")
+            await asyncio.sleep(0)
+
+
+fair_scheduler = FairScheduler(RELAY_FAIR_TICK_MS / 1000, RELAY_FAIR_BUDGET_MS / 1000, RELAY_FAIR_SLICE_MS / 1000,
+                               RELAY_FAIR)
+
+
+def _metric_value(value) -> str:
+    # 字节计数会到十亿级，不能用%g（只保留6位有效数字）
+    return str(int(value)) if float(value).is_integer() else repr(float(value))
+
+
+class Metric:
+    """
+    📊 一个指标族：按标签值保存各序列，render()输出Prometheus文本格式
+
+    不依赖prometheus_client：指标只有十几个，全部在事件循环里更新（CpuLane的耗时在线程里累加，
+    浮点加法在GIL下不会丢），抓取时一次性格式化。
+    """
+
+    def __init__(self, name: str, kind: str, help_text: str, labels=()):
+        self.name = name
+        self.kind = kind
+        self.help = help_text
+        self.labels = tuple(labels)
+        self.series: Dict[tuple, Any] = {}
+        self.collect = None     # 抓取时调用，返回{标签值元组: 值}，覆盖series（现算的gauge）
+        metrics_registry.append(self)
+
+    def _key(self, labels: Dict[str, Any]) -> tuple:
+        return tuple(str(labels.get(name, "")) for name in self.labels)
+
+    @staticmethod
+    def _format_labels(names, values, extra: str = "") -> str:
+        pairs = [f'worker="{worker_index}"']
+        for n, v in zip(names, values):
+            v = str(v).replace("\\", "\\\\").replace('"', '\\"').replace("\n", "\\n")
+            pairs.append(f'{n}="{v}"')
+        if extra:
+            pairs.append(extra)
+        return "{" + ",".join(pairs) + "}"
+
+    def render(self, out: list):
+        out.append(f"# HELP {self.name} {self.help}")
+        out.append(f"# TYPE {self.name} {self.kind}")
+        series = self.collect() if self.collect else self.series
+        for key, value in series.items():
+            out.append(f"{self.name}{self._format_labels(self.labels, key)} {_metric_value(value)}")
+
+
+class Counter(Metric):
+    def __init__(self, name: str, help_text: str, labels=()):
+        super().__init__(name, "counter", help_text, labels)
+
+    def inc(self, amount: float = 1, **labels):
+        key = self._key(labels)
+        self.series[key] = self.series.get(key, 0) + amount
+
+
+class Gauge(Metric):
+    def __init__(self, name: str, help_text: str, labels=(), collect=None):
+        super().__init__(name, "gauge", help_text, labels)
+        self.collect = collect
+
+
+class Histogram(Metric):
+    def __init__(self, name: str, help_text: str, buckets, labels=()):
+        super().__init__(name, "histogram", help_text, labels)
+        self.buckets = tuple(buckets)
+
+    def observe(self, value: float, **labels):
+        key = self._key(labels)
+        state = self.series.get(key)
+        if state is None:
+            state = self.series[key] = [[0] * len(self.buckets), 0.0, 0]    # 各桶计数（不累积）、总和、次数
+        for i, bound in enumerate(self.buckets):
+            if value <= bound:
+                state[0][i] += 1
+                break
+        state[1] += value
+        state[2] += 1
+
+    def render(self, out: list):
+        out.append(f"# HELP {self.name} {self.help}")
+        out.append(f"# TYPE {self.name} histogram")
+        for key, (counts, total, n) in self.series.items():
+            cumulative = 0
+            for bound, count in zip(self.buckets, counts):
+                cumulative += count
+                le = self._format_labels(self.labels, key, f'le="{bound:g}"')
+                out.append(f"{self.name}_bucket{le} {cumulative}")
+            le = self._format_labels(self.labels, key, 'le="+Inf"')
+            out.append(f"{self.name}_bucket{le} {n}")
+            out.append(f"{self.name}_sum{self._format_labels(self.labels, key)} {_metric_value(total)}")
+            out.append(f"{self.name}_count{self._format_labels(self.labels, key)} {n}")
+
+
+def render_metrics() -> bytes:
+    out = []
+    for metric in metrics_registry:
+        metric.render(out)
+    out.append("")
+    return "\n".join(out).encode("utf-8")
+
+
+metrics_registry = []
+LATENCY_BUCKETS = (0.05, 0.1, 0.2, 0.3, 0.5, 0.75, 1.0, 1.5, 2.0, 3.0, 5.0, 10.0)
+# 指标名是对外接口（看板和告警按名字查询），改名要同步改看板
+METRIC_DEVICES = Gauge("relay_connected_devices", "当前连接的ESP32数",
+                       collect=lambda: {(): len(connected_devices)})
+METRIC_UPSTREAM_SESSIONS = Gauge("relay_upstream_sessions", "豆包连接上正在进行的会话数",
+                                 collect=lambda: {(): sum(len(c.sessions) for c in doubao_mux.connections)})
+METRIC_UPSTREAM_CONNECTIONS = Gauge("relay_upstream_connections", "打开的豆包连接数（不含预热池）",
+                                    collect=lambda: {(): len(doubao_mux.connections)})
+METRIC_WARM_POOL = Gauge("relay_warm_pool_idle", "预热池里空闲的豆包连接数",
+                         collect=lambda: {(): len(warm_pool._idle)})
+METRIC_UPSTREAM_CONNECT = Histogram("relay_upstream_connect_seconds",
+                                    "豆包建连（connection: WebSocket+StartConnection）和开始会话（session）的耗时",
+                                    LATENCY_BUCKETS, labels=("stage",))
+METRIC_TURN_LATENCY = Histogram("relay_turn_latency_seconds", "每轮对话各阶段的耗时（和TRACE日志的字段同名）",
+                                LATENCY_BUCKETS, labels=("stage",))
+METRIC_BYTES = Counter("relay_bytes_total", "转发的字节数", labels=("peer", "direction"))
+METRIC_CPU = Counter("relay_downlink_cpu_seconds_total", "下行重采样/ADPCM编码在线程池里的累计CPU时间")
+METRIC_CPU_JOBS = Counter("relay_downlink_cpu_jobs_total", "下行重采样/ADPCM编码的任务数（合批的重采样一批算一个）")
+METRIC_RESAMPLE_BATCH = Histogram("relay_resample_batch_size", "跨会话合批重采样每批的TTS包数",
+                                  (1, 2, 4, 8, 16, 32, 64, 128))
+METRIC_LOOP_LAG = Histogram("relay_event_loop_lag_seconds", "事件循环定时唤醒的延迟",
+                            (0.001, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0))
+METRIC_SEND_QUEUE = Gauge("relay_send_queue_bytes", "每台设备排队和WebSocket发送缓冲区里还没写出的字节数",
+                          labels=("device",),
+                          collect=lambda: {(sender.name,): sender.pending_bytes()
+                                           for sender in list(device_senders.values())})
+METRIC_UPLINK_QUEUE = Histogram("relay_uplink_queue_depth", "上行写任务每次取数据时队列里排着的设备消息数（含取走的这条）",
+                                (1, 2, 4, 8, 16, 32, 64, 128))
+METRIC_UPLINK_MESSAGES = Counter("relay_uplink_messages_total",
+                                 "发给豆包的上行音频（frames=设备来的消息，messages=合并后发出的消息）", labels=("kind",))
+METRIC_SEND_DROPPED = Counter("relay_send_dropped_bytes_total", "发送队列超过上限时丢掉的下行音频字节数")
+METRIC_ADMISSION = Counter("relay_upstream_admission_total", "开始豆包会话的准入结果（admitted/queued/rejected）",
+                           labels=("result",))
+METRIC_UPSTREAM_WAITING = Gauge("relay_upstream_waiting", "排队等豆包会话名额的设备数",
+                                collect=lambda: {(): len(doubao_mux.admission.waiters)})
+METRIC_WARMUP = Counter("relay_warmup_total", "预热的豆包会话（opened=开好了，used=被唤醒用上，expired=超时释放，"
+                                             "busy=名额满没开，error=开会话出错）", labels=("result",))
+METRIC_WAKE_VERIFY = Counter("relay_wake_verify_total", "唤醒二次确认结果（accept/reject/timeout/error）",
+                             labels=("result",))
+METRIC_WAKE_ARBITRATION = Counter("relay_wake_arbitration_total",
+                                  "多设备唤醒仲裁结果（alone=窗口内只有它，won=赢了别的设备，lost=让给了别的设备）",
+                                  labels=("result",))
+METRIC_WAKE_OUTCOME = Counter("relay_wake_outcome_total", "自动调阈值统计的唤醒结果（real=后面有问题，false=误唤醒）",
+                              labels=("outcome",))
+METRIC_WAKE_TUNE = Counter("relay_wake_tune_total", "自动调整唤醒词阈值的次数（up=提高，down=降低）", labels=("direction",))
+METRIC_WAKE_THRESHOLD = Gauge("relay_wake_threshold", "各现场各唤醒词模型当前推荐的阈值", labels=("site", "model"),
+                              collect=lambda: wake_tuner.threshold_series())
+METRIC_UPSTREAM_FAILOVER = Counter("relay_upstream_failover_total",
+                                   "豆包接入点失败后换接入点重试的次数（connect=建连，session=StartSession）",
+                                   labels=("stage",))
+METRIC_UPSTREAM_ENDPOINT = Gauge("relay_upstream_endpoint_latency_seconds",
+                                 "各豆包接入点建连耗时的指数平均（冷却中的接入点为-1）", labels=("endpoint",),
+                                 collect=lambda: upstream_endpoints.latency_series())
+METRIC_RESUME = Counter("relay_upstream_resume_total", "断开时暂存的豆包会话（resumed=重连接上，expired=过期结束，dead=暂存期间断了，"
+                        "stale=睡眠醒来的session对不上）",
+                        labels=("result",))
+METRIC_ARCHIVE = Counter("relay_archive_bytes_total",
+                         "音频归档的字节数（written=写进文件的压缩后字节，dropped=队列积压时丢掉的PCM字节）",
+                         labels=("result",))
+for _result in ("written", "dropped"):
+    METRIC_ARCHIVE.inc(0, result=_result)    # 归档线程只加已有的序列，导出时不会遇到字典变大
+METRIC_ENDPOINT_CUTOFFS = Counter("relay_endpoint_cutoffs_total", "识别结束后马上又开口（结束平滑窗口太短）的次数")
+METRIC_ENDPOINT_WINDOW = Histogram("relay_endpoint_window_seconds", "开会话时设置的ASR结束平滑窗口",
+                                   (0.3, 0.5, 0.7, 1.0, 1.5, 2.0))
+METRIC_DOWNLINK_RESUME = Counter("relay_downlink_resume_total", "断开时回复没发完的重连（resumed=接着发，"
+                                                                 "dropped=丢弃剩下的回复）", labels=("result",))
+METRIC_SINGLEFLIGHT = Counter("relay_singleflight_total", "同一问题并发时跟着别的会话的回复下发（led=领头，"
+                                                         "joined=跟随，aborted=领头中断）", labels=("result",))
+METRIC_RELAY_VAD = Counter("relay_vad_endpoints_total", "中继端VAD判定说完、提前补齐静音的次数")
+METRIC_SESSION_MEMORY = Gauge("relay_session_memory_bytes", "所有会话的缓冲区占用（最近一次统计）",
+                               collect=lambda: {(): sum(session_memory.values())})
+METRIC_SESSION_MEMORY_PEAK = Histogram("relay_session_memory_peak_bytes", "每个连接缓冲区占用的峰值（断开时记录）",
+                                       (64 << 10, 256 << 10, 512 << 10, 1 << 20, 2 << 20, 4 << 20, 8 << 20))
+METRIC_MEMORY_TRIMMED = Counter("relay_memory_trimmed_bytes_total", "超过会话内存上限时裁掉的字节数（last_reply/reply_cache/"
+                                                                     "reply_copy=回复副本，tts_queue=排着的TTS音频）",
+                                labels=("what",))
+METRIC_SESSION_LOOP = Gauge("relay_session_loop_seconds", "每个会话在事件循环上累计执行的时间", labels=("device",),
+                            collect=lambda: {(lane.name,): lane.total_s for lane in list(fair_scheduler.lanes)})
+METRIC_SESSION_STEP = Gauge("relay_session_loop_max_step_seconds", "每个会话在事件循环上最长的一次连续执行",
+                            labels=("device",),
+                            collect=lambda: {(lane.name,): lane.max_step_s for lane in list(fair_scheduler.lanes)})
+METRIC_FAIR_DEFERRED = Counter("relay_fair_deferred_total", "公平调度让出的次数（slice=连续执行太久，budget=用完了这个tick的份额）",
+                               labels=("reason",))
+METRIC_MOVE = Counter("relay_move_total", "排空时让设备换到新进程的连接（idle=等到这一轮结束，timeout=排空快到时限）",
+                      labels=("reason",))
+METRIC_HELLO = Counter("relay_hello_total", "设备hello协商出的协议版本（1=不带版本的旧固件）", labels=("version",))
+METRIC_TEXT_QUERY = Counter("relay_text_query_total", "设备发来的文字问题（sent=交给豆包，busy=没有会话，rejected=没协商或为空）",
+                            labels=("result",))
+METRIC_DEVICE_HISTORY = Counter("relay_device_history_total", "设备跨重启累计的性能计数（按每次上报的增量累加："
+                                                              "boots/resets_panic/resets_brownout/sessions/uplink_drops/"
+                                                              "underruns/capture_drops/reconnects/uptime_s）",
+                                labels=("field",))
+METRIC_FLIGHT_RECORDS = Counter("relay_flight_records_total", "设备上传的黑匣子记录（按复位原因）", labels=("reason",))
+METRIC_UDP_FALLBACK = Counter("relay_udp_fallback_total", "UDP音频通道的下行退回WebSocket（loss=丢失太多，timeout=设备没有报告）",
+                              labels=("reason",))
+METRIC_UDP_MESSAGES = Counter("relay_udp_messages_total", "走UDP的音频消息（up_fec=由副本补回的上行消息）", labels=("direction",))
+METRIC_REPLY_ETA = Gauge("relay_reply_eta_seconds", "说完到第一条下行音频的指数平均（发给设备的reply_eta）",
+                         collect=lambda: {(): (reply_eta.ms or 0) / 1000})
+METRIC_BUSY = Counter("relay_busy_total", "回给设备的busy（upstream=会话名额满，devices=连接数满）", labels=("reason",))
+METRIC_TURN_COST = Counter("relay_turn_cost_total", "导出的每轮资源账单（joined=两侧都到了）", labels=("result",))
+METRIC_SOAK = Counter("relay_soak_reports_total", "浸泡测试设备的定时报告，按门槛判定", labels=("verdict",))
+METRIC_ASSET_FETCH = Counter("relay_asset_fetch_total", "设备下载推送提示音（ok/not_found）", labels=("result",))
+METRIC_MEDIA = Counter("relay_media_total", "设备长音频直连的状态上报（playing/paused/done/failed……）", labels=("state",))
+METRIC_DOUBAO_ERRORS = Counter("relay_doubao_errors_total", "豆包返回的错误帧和会话拒绝，按错误码", labels=("code",))
+
+
+async def metrics_http(path, request_headers):
+    """
+    websockets的process_request钩子：GET /metrics直接返回HTTP响应，其余路径继续WebSocket握手
+    """
+    route, _, query = path.partition("?")
+    if route == "/reload_config":
+        # 🔁 只重新加载处理这个请求的worker；多进程时给主进程发SIGHUP
+        return HTTPStatus.OK, [("Content-Type", "text/plain; charset=utf-8")], (relay_config.reload() + "\n").encode()
+    if route == "/net_test":
+        return HTTPStatus.OK, [("Content-Type", "text/plain; charset=utf-8")], request_net_test(query)
+    if route == "/loopback_cal":
+        return HTTPStatus.OK, [("Content-Type", "text/plain; charset=utf-8")], request_loopback_cal(query)
+    if route == "/media":
+        return HTTPStatus.OK, [("Content-Type", "text/plain; charset=utf-8")], request_media(query)
+    if route.startswith("/asset/"):
+        asset = ASSETS_BY_ID.get(route[len("/asset/"):])
+        METRIC_ASSET_FETCH.inc(result="ok" if asset else "not_found")
+        if asset is None:
+            return HTTPStatus.NOT_FOUND, [("Content-Type", "text/plain; charset=utf-8")], b"unknown asset\n"
+        return HTTPStatus.OK, [("Content-Type", "application/octet-stream")], asset["data"]
+    if route == "/asset_play":
+        return HTTPStatus.OK, [("Content-Type", "text/plain; charset=utf-8")], request_asset_play(query)
+    if route != "/metrics" or not RELAY_METRICS:
+        return None
+    return HTTPStatus.OK, [("Content-Type", "text/plain; version=0.0.4; charset=utf-8")], render_metrics()
+
+
+def request_net_test(query: str) -> bytes:
+    """
+    🛰️ GET /net_test：让已连接的ESP32（或device指定的那台）跑一次网络自检，返回发出请求的设备数
+    """
+    params = urllib.parse.parse_qs(query)
+    mode = params.get("mode", ["ws"])[0]
+    if mode not in ("ws", "tcp"):
+        return b"mode must be ws or tcp\n"
+    try:
+        ms = int(params.get("ms", ["5000"])[0])
+        size = int(params.get("size", ["1024"])[0])
+    except ValueError:
+        return b"ms/size must be integers\n"
+    device = params.get("device", [None])[0]
+    test = {"type": "net_test", "mode": mode, "ms": ms, "size": size, "port": RELAY_NET_TEST_PORT}
+    if "dscp" in params:
+        try:
+            test["dscp"] = int(params["dscp"][0])
+        except ValueError:
+            return b"dscp must be an integer\n"
+        if not 0 <= test["dscp"] < 64:
+            return b"dscp must be 0-63\n"
+    request = esp32_json(test)
+    count = 0
+    for sender in list(device_senders.values()):
+        if device is None or sender.name == device:
+            if sender.put(request):
+                count += 1
+    logger.info(f"🛰️ 向 {count} 个设备请求 {mode} 网络自检（{ms} ms，{size} 字节/条"
+                f"{'，DSCP ' + str(test['dscp']) if 'dscp' in test else ''}）")
+    return f"{count}\n".encode()
+
+
+def request_loopback_cal(query: str) -> bytes:
+    """
+    🔊 GET /loopback_cal：让已连接的ESP32（或device指定的那台）空闲时重新标定扬声器→麦克风延迟，返回发出请求的设备数
+    """
+    device = urllib.parse.parse_qs(query).get("device", [None])[0]
+    request = esp32_json({"type": "loopback_cal"})
+    count = 0
+    for sender in list(device_senders.values()):
+        if device is None or sender.name == device:
+            if sender.put(request):
+                count += 1
+    logger.info(f"🔊 向 {count} 个设备请求标定扬声器→麦克风延迟")
+    return f"{count}\n".encode()
+
+
+def request_media(query: str) -> bytes:
+    """
+    📻 GET /media：让已连接的ESP32（或device指定的那台）直接下载播放一段长音频，或者暂停/恢复/停止，返回发出请求的设备数
+    """
+    params = urllib.parse.parse_qs(query)
+    action = params.get("action", ["play"])[0]
+    if action not in ("play", "pause", "resume", "stop"):
+        return b"action must be play, pause, resume or stop\n"
+    request = {"type": "media", "action": action}
+    if action == "play":
+        url = params.get("url", [""])[0]
+        if not url.startswith(("http://", "https://")) or len(url) >= 256:    # 和MediaStream::URL_LEN一致
+            return b"url must be http(s) and shorter than 256 bytes\n"
+        request["url"] = url
+        try:
+            request["offset_ms"] = max(0, int(params.get("offset_ms", ["0"])[0]))
+        except ValueError:
+            return b"offset_ms must be an integer\n"
+    device = params.get("device", [None])[0]
+    message = esp32_json(request)
+    count = 0
+    for sender in list(device_senders.values()):
+        if device is None or sender.name == device:
+            if sender.put(message):
+                count += 1
+    logger.info(f"📻 向 {count} 个设备发长音频{action}{'：' + request['url'] if 'url' in request else ''}")
+    return f"{count}\n".encode()
+
+
+def request_asset_play(query: str) -> bytes:
+    """
+    📦 GET /asset_play：让已连接的ESP32（或device指定的那台）空闲时播一条推送提示音，返回发出请求的设备数
+    """
+    params = urllib.parse.parse_qs(query)
+    asset_id = params.get("id", [""])[0]
+    name = params.get("name", [""])[0]
+    if name:
+        asset_id = ASSETS[name]["id"] if name in ASSETS else ""
+    if asset_id not in ASSETS_BY_ID:
+        return b"unknown asset (name or id)\n"
+    device = params.get("device", [None])[0]
+    message = esp32_json({"type": "play_asset", "id": asset_id})
+    count = 0
+    for sender in list(device_senders.values()):
+        if device is None or sender.name == device:
+            if sender.put(message):
+                count += 1
+    logger.info(f"📦 向 {count} 个设备请求播放提示音 {ASSETS_BY_ID[asset_id]['name']}（{asset_id}）")
+    return f"{count}\n".encode()
+
+
+def asset_manifests(host: str, secure: bool) -> list:
+    """
+    📦 推送提示音的清单，分页；base是设备下载用的地址（设备连中继用的主机名和端口）
+    """
+    base = f"{'https' if secure else 'http'}://{host}/asset/"
+    entries = [{"n": a["name"], "h": a["id"], "s": len(a["data"]), "c": a["samples"], "b": a["block"]}
+               for a in ASSETS.values()]
+    pages = [entries[i:i + ASSET_MANIFEST_PAGE] for i in range(0, len(entries), ASSET_MANIFEST_PAGE)]
+    return [{"type": "assets", "base": base, "page": i, "last": i == len(pages) - 1, "list": page}
+            for i, page in enumerate(pages)]
+
+
+async def sample_loop_lag():
+    """
+    每METRICS_LOOP_LAG_INTERVAL_S秒睡一次，实际醒来比预期晚多少就是事件循环被占住的时间
+    """
+    while running:
+        start = time.monotonic()
+        await asyncio.sleep(METRICS_LOOP_LAG_INTERVAL_S)
+        METRIC_LOOP_LAG.observe(max(0.0, time.monotonic() - start - METRICS_LOOP_LAG_INTERVAL_S))
+
+
 # 全局变量用于优雅关闭
-server = None
+servers = []
 running = True
+worker_index = 0        # 当前worker序号（单进程模式为0）
+active_clients = 0      # 正在处理的ESP32连接数，排空时等它归零
+session_memory = {}     # 🧮 websocket -> 最近一次统计的缓冲区字节数
+connected_devices = set()   # 当前连接的ESP32，SIGUSR1时向它们请求性能统计
+device_senders = {}     # 📮 连接 -> DeviceSender
+udp_server = None       # 📡 RELAY_UDP_PORT打开时的UdpAudioServer
+ota_downloads = 0       # 本worker正在下载固件的设备数
+
 
-def resample_audio_24k_to_16k(audio_data: bytes) -> bytes:
+def worker_for_device(device_id: str) -> int:
     """
-    将24kHz音频重采样为16kHz并转换为int16格式
-    
-    这是解决音频杂音问题的核心功能。豆包AI输出24kHz音频，而ESP32需要16kHz音频，
-    因此需要进行重采样处理。
-    
-    Args:
-        audio_data (bytes): 原始24kHz音频数据
-        
-    Returns:
-        bytes: 重采样后的16kHz音频数据
+    设备固定分到的worker（crc32在各进程间一致，不受PYTHONHASHSEED影响）
     """
-    # 如果没有音频数据，直接返回
-    if not audio_data:
-        return audio_data
-    
+    room = WAKE_ROOM_OF.get(device_id)
+    key = f"room:{room}" if room is not None else device_id     # 🏠 同一房间的设备要在同一个worker里仲裁
+    return zlib.crc32(key.encode('utf-8')) % RELAY_WORKERS
+
+
+def ota_offer(fw: Dict[str, Any], full_image: bool = False) -> Optional[dict]:
+    """
+    按设备hello里的固件信息决定要不要升级，返回要下发的ota消息（不需要升级时为None）
+
+    full_image: 不找差分补丁，直接发完整镜像（补丁的基础固件和设备上的对不上时）
+    """
+    if not RELAY_OTA_DIR or not RELAY_OTA_URL or not fw.get("ota"):
+        return None
     try:
-        # 如果安装了scipy库，使用高质量重采样方法
-        if HAS_SCIPY:
-            # 将音频数据转换为numpy数组（float32格式）
-            audio_samples = np.frombuffer(audio_data, dtype=np.float32)
-            if len(audio_samples) == 0:
-                return audio_data
-            
-            # 计算目标采样点数
-            target_length = int(len(audio_samples) * ESP32_SAMPLE_RATE / DOUBAO_SAMPLE_RATE)
-            
-            # 使用scipy进行重采样
-            resampled_samples = scipy.signal.resample(audio_samples, target_length)
-            
-            # 将float32转换为int16格式
-            # 将浮点数范围[-1.0, 1.0]缩放到整数范围[-32768, 32767]
-            int16_samples = (resampled_samples * 32767).astype(np.int16)
-            return int16_samples.tobytes()
-        else:
-            # 如果没有scipy库，使用简单重采样方法
-            # 每3个24kHz样本取2个16kHz样本
-            samples = struct.unpack(f'<{len(audio_data)//4}f', audio_data)
-            resampled = []
-            for i in range(0, len(samples), 3):
-                if i < len(samples):
-                    resampled.append(samples[i])
-                if i + 1 < len(samples):
-                    resampled.append(samples[i + 1])
-            
-            # 转换为int16格式
-            int16_samples = [int(max(-32768, min(32767, sample * 32767))) for sample in resampled]
-            return struct.pack(f'<{len(int16_samples)}h', *int16_samples)
-    except Exception as e:
-        logger.error(f"音频重采样失败: {e}")
-        return audio_data
+        with open(os.path.join(RELAY_OTA_DIR, "manifest.json"), encoding="utf-8") as f:
+            manifest = json.load(f)
+    except (OSError, ValueError) as e:
+        logger.warning(f"⚠️ 读取固件manifest失败: {e}")
+        return None
+    sha = str(fw.get("sha", ""))
+    if not sha or manifest["sha256"].startswith(sha):
+        return None
+    patch = None if full_image else manifest.get("patches", {}).get(sha)
+    name = patch["file"] if patch else manifest["image"]
+    return {"type": "ota", "url": f"{RELAY_OTA_URL}/{name}", "sha256": manifest["sha256"],
+            "version": manifest.get("version", ""), "delta": patch is not None}
 
-def create_protocol_header(message_type=0b0001, has_event=True, use_json=True, use_gzip=True):
+
+def runtime_config_for_device(device_id: str) -> Optional[dict]:
     """
-    创建豆包AI协议头
-    
-    Args:
-        message_type (int): 消息类型
-        has_event (bool): 是否包含事件
-        use_json (bool): 是否使用JSON格式
-        use_gzip (bool): 是否使用gzip压缩
-        
-    Returns:
-        bytearray: 协议头数据
+    设备所属的运行时参数组（同一台设备总是分到同一组，和worker分配用不同的盐，两者互不相关）
     """
-    header = bytearray()
-    header_size = 1
-    version = 0b0001
-    header.append((version << 4) | header_size)
-    flags = 0b0100 if has_event else 0b0000
-    header.append((message_type << 4) | flags)
-    serial = 0b0001 if use_json else 0b0000
-    compress = 0b0001 if use_gzip else 0b0000
-    header.append((serial << 4) | compress)
-    header.append(0x00)
-    return header
+    if isinstance(RELAY_RUNTIME_CONFIG, list):
+        if not RELAY_RUNTIME_CONFIG:
+            return None
+        arm = zlib.crc32(("runtime:" + device_id).encode('utf-8')) % len(RELAY_RUNTIME_CONFIG)
+        return RELAY_RUNTIME_CONFIG[arm]
+    return RELAY_RUNTIME_CONFIG or None
 
-def parse_doubao_response(data: bytes) -> Dict[str, Any]:
+class StreamingResampler:
     """
-    解析豆包AI服务器响应
-    
-    Args:
-        data (bytes): 服务器响应数据
-        
-    Returns:
-        Dict[str, Any]: 解析后的响应数据
+    24kHz float32 → 16kHz int16 流式重采样（3:2多相FIR）
+
+    原来每个豆包音频包单独做一次scipy.signal.resample（整包FFT），包与包之间不连续，
+    接缝处会有咔嗒声。这里先2倍插值再3倍抽取，低通滤波器拆成2个相位，
+    每个输出样本只算一个相位的TAPS_PER_PHASE次乘加；上一包末尾的样本作为滤波历史保留，
+    跨包输出和整段一次性处理结果一致。
     """
-    # 如果数据为空或长度不足，返回空字典
-    if isinstance(data, str) or len(data) < 4:
-        return {}
-    
-    try:
-        # 解析协议头
-        header_size = (data[0] & 0x0f) * 4
-        message_type = data[1] >> 4
-        message_flags = data[1] & 0x0f
-        has_event = bool(message_flags & 0b0100)
-        compression = data[2] & 0x0f
-        use_gzip = bool(compression)
-        use_json = bool(data[2] >> 4)
-        
-        # 提取有效载荷数据
-        payload = data[header_size:]
-        result = {"message_type": "unknown"}
-        offset = 0
-        
-        # 解析事件ID
-        if has_event and len(payload) >= offset + 4:
-            result["event"] = int.from_bytes(payload[offset:offset+4], "big")
-            offset += 4
-        
-        # 解析会话ID
-        if len(payload) >= offset + 4:
-            session_id_len = int.from_bytes(payload[offset:offset+4], "big")
-            offset += 4
-            if len(payload) >= offset + session_id_len:
-                session_id = payload[offset:offset+session_id_len]
-                result["session_id"] = session_id.decode('utf-8', errors='ignore')
+
+    UP = 2
+    DOWN = 3
+    TAPS_PER_PHASE = 48
+    CUTOFF_HZ = 7200    # 低于16kHz的奈奎斯特频率，留出过渡带抑制混叠
+
+    def __init__(self):
+        num_taps = self.UP * self.TAPS_PER_PHASE
+        upsampled_rate = DOUBAO_SAMPLE_RATE * self.UP
+        fc = self.CUTOFF_HZ / upsampled_rate
+        center = (num_taps - 1) / 2
+        taps = []
+        for n in range(num_taps):
+            x = n - center
+            sinc = 2 * fc if x == 0 else math.sin(2 * math.pi * fc * x) / (math.pi * x)
+            # Blackman窗
+            window = (0.42 - 0.5 * math.cos(2 * math.pi * n / (num_taps - 1))
+                      + 0.08 * math.cos(4 * math.pi * n / (num_taps - 1)))
+            taps.append(sinc * window)
+        gain = self.UP / sum(taps)
+        # 每个相位的系数倒序存放，直接和按时间顺序排列的输入窗口做点积
+        self.phases = [[t * gain for t in taps[p::self.UP]][::-1] for p in range(self.UP)]
+        if HAS_NUMPY:
+            self.phases = np.array(self.phases, dtype=np.float32)
+        self.reset()
+
+    def reset(self):
+        """
+        清空滤波历史（回复被打断时调用，旧回复的尾巴不混进新回复）
+        """
+        self.history = [0.0] * (self.TAPS_PER_PHASE - 1)
+        if HAS_NUMPY:
+            self.history = np.zeros(self.TAPS_PER_PHASE - 1, dtype=np.float32)
+        self.next_pos = 0       # 下一个输出样本在插值后序列中的位置（相对本包开头）
+        self.pending = b""      # 不足一个float32的残余字节
+
+    def process(self, audio_data: bytes) -> bytes:
+        """
+        重采样一个豆包音频包
+
+        Args:
+            audio_data (bytes): 24kHz float32单声道PCM
+
+        Returns:
+            bytes: 16kHz int16单声道PCM（长度随包内样本数和相位变化，累计上严格是输入的2/3）
+        """
+        if HAS_NUMPY:
+            windows, coeffs = self.prepare(audio_data)
+            return self.to_pcm16(np.einsum("ij,ij->i", windows, coeffs))
+
+        step = self._advance(audio_data)
+        if step is None:
+            return b""
+        audio_data, count, first, out_count = step
+        history_len = self.TAPS_PER_PHASE - 1
+        samples = struct.unpack(f"<{count}f", audio_data[:count * 4])
+        buf = self.history + list(samples)
+        self.history = buf[-history_len:]
+        out = []
+        for k in range(out_count):
+            pos = first + k * self.DOWN
+            start = pos // self.UP
+            taps = self.phases[pos % self.UP]
+            acc = 0.0
+            for i, t in enumerate(taps):
+                acc += t * buf[start + i]
+            out.append(int(max(-32768, min(32767, acc * 32767))))
+        return struct.pack(f"<{len(out)}h", *out)
+
+    def _advance(self, audio_data: bytes):
+        """
+        拼上上一包剩下的字节、推进输出相位：返回(数据, 输入样本数, 第一个输出位置, 输出样本数)，不足一个样本时返回None
+        """
+        if self.pending:
+            audio_data = self.pending + audio_data
+        usable = len(audio_data) - len(audio_data) % 4
+        self.pending = bytes(audio_data[usable:])
+        count = usable // 4
+        if count == 0:
+            return None
+
+        # 输出位置j对应输入样本j//UP、相位j%UP；要求j//UP落在本包内
+        first = self.next_pos
+        out_count = max(0, (count * self.UP - first + self.DOWN - 1) // self.DOWN)
+        self.next_pos = first + out_count * self.DOWN - count * self.UP
+        return audio_data, count, first, out_count
+
+    def prepare(self, audio_data: bytes):
+        """
+        numpy：更新滤波历史，返回本包每个输出样本的输入窗口和对应相位的系数（两个out_count×TAPS_PER_PHASE的矩阵），
+        逐行点积就是输出；ResampleBatcher把多个包的矩阵接起来一次算完
+        """
+        step = self._advance(audio_data)
+        if step is None:
+            empty = np.zeros((0, self.TAPS_PER_PHASE), dtype=np.float32)
+            return empty, empty
+        audio_data, count, first, out_count = step
+        samples = np.frombuffer(audio_data, dtype=np.float32, count=count)
+        buf = np.concatenate((self.history, samples))
+        self.history = buf[-(self.TAPS_PER_PHASE - 1):].copy()
+        pos = first + np.arange(out_count) * self.DOWN
+        windows = np.lib.stride_tricks.sliding_window_view(buf, self.TAPS_PER_PHASE)[pos // self.UP]
+        return windows, self.phases[pos % self.UP]
+
+    @staticmethod
+    def to_pcm16(out) -> bytes:
+        return np.clip(out * 32767, -32768, 32767).astype("<i2").tobytes()
+
+
+class ResampleBatcher:
+    """
+    🧮 跨会话批量重采样：tick_s内所有连接提交的TTS包合成一次线程池任务、一次numpy点积
+
+    几百台设备时每个包单独提交，要各付一次线程切换和十几次numpy调用的固定开销，真正的乘加反而不多
+    （一个包只有几十毫秒音频）。合批后各连接的跨包状态（滤波历史、相位）仍在任务里按提交顺序逐个更新，
+    窗口矩阵接在一起做一次点积、限幅和转int16，结果按每个包的输出长度切开交回各自的协程。
+    同一连接经过CpuLane排队，一批里最多有它的一个包。代价是每个包最多多等一个tick；
+    攒够max_jobs个包时不等tick直接提交。没有numpy时只省线程切换，逐包调用process()。
+    """
+
+    __slots__ = ("tick_s", "max_jobs", "_pending", "_timer", "batches", "jobs")
+
+    def __init__(self, tick_s: float, max_jobs: int):
+        self.tick_s = tick_s
+        self.max_jobs = max(1, max_jobs)
+        self._pending = []      # (CpuLane, StreamingResampler, 数据, future)
+        self._timer = None
+        self.batches = 0
+        self.jobs = 0
+
+    async def process(self, lane: "CpuLane", resampler: StreamingResampler, audio_data: bytes) -> bytes:
+        loop = asyncio.get_running_loop()
+        future = loop.create_future()
+        self._pending.append((lane, resampler, audio_data, future))
+        if len(self._pending) >= self.max_jobs:
+            self._flush()
+        elif self._timer is None:
+            self._timer = loop.call_later(self.tick_s, self._flush)
+        return await future
+
+    def _flush(self):
+        if self._timer is not None:
+            self._timer.cancel()
+            self._timer = None
+        jobs, self._pending = self._pending, []
+        if jobs:
+            asyncio.ensure_future(self._run(jobs))
+
+    async def _run(self, jobs):
+        work = [(resampler, data) for _, resampler, data, _ in jobs]
+        try:
+            if cpu_pool is None:
+                outputs, elapsed = self._compute(work)
+            else:
+                outputs, elapsed = await asyncio.get_running_loop().run_in_executor(cpu_pool, self._compute, work)
+        except Exception as e:
+            for *_, future in jobs:
+                if not future.done():
+                    future.set_exception(e)
+            return
+        self.batches += 1
+        self.jobs += len(jobs)
+        METRIC_RESAMPLE_BATCH.observe(len(jobs))
+        METRIC_CPU.inc(elapsed)
+        METRIC_CPU_JOBS.inc()
+        total = sum(len(data) for _, data in work) or 1
+        for (lane, _, data, future), out in zip(jobs, outputs):
+            lane.note(elapsed * len(data) / total)     # 按输入长度分摊到各连接
+            if not future.done():
+                future.set_result(out)
+
+    @staticmethod
+    def _compute(work):
+        start = time.perf_counter()
+        if not HAS_NUMPY:
+            return [resampler.process(data) for resampler, data in work], time.perf_counter() - start
+        prepared = [resampler.prepare(data) for resampler, data in work]
+        windows = np.concatenate([w for w, _ in prepared])
+        coeffs = np.concatenate([c for _, c in prepared])
+        pcm = StreamingResampler.to_pcm16(np.einsum("ij,ij->i", windows, coeffs))
+        outputs = []
+        offset = 0
+        for w, _ in prepared:
+            size = len(w) * 2
+            outputs.append(pcm[offset:offset + size])
+            offset += size
+        return outputs, time.perf_counter() - start
+
+
+resample_batcher = ResampleBatcher(RELAY_RESAMPLE_BATCH_MS / 1000, RELAY_RESAMPLE_BATCH_MAX) \
+    if RELAY_RESAMPLE_BATCH_MS > 0 else None
+
+def decode_opus_uplink(decoder, data: bytes) -> bytes:
+    """
+    解码ESP32上行的Opus音频
+
+    ESP32端会把多个Opus包合并为一条消息，每个包前面带2字节大端长度：
+    [长度][Opus包][长度][Opus包]...
+
+    Args:
+        decoder: opuslib.Decoder实例
+        data (bytes): 合并后的上行数据
+
+    Returns:
+        bytes: 解码后的16kHz int16 PCM数据
+    """
+    pcm = bytearray()
+    frame_size = ESP32_SAMPLE_RATE * 20 // 1000  # 每包20ms
+    offset = 0
+    while offset + 2 <= len(data):
+        packet_len = int.from_bytes(data[offset:offset+2], "big")
+        offset += 2
+        if offset + packet_len > len(data):
+            logger.warning(f"⚠️ Opus包长度越界: {packet_len} 字节")
+            break
+        try:
+            pcm.extend(decoder.decode(bytes(data[offset:offset+packet_len]), frame_size))
+        except Exception as e:
+            logger.warning(f"Opus解码失败: {e}")
+        offset += packet_len
+    return bytes(pcm)
+
+class WakeVerifier:
+    """
+    🛡️ 唤醒词二次确认模型：score()在线程池里运行，返回唤醒词音频的最高得分（0~1）
+
+    目前接的是openWakeWord（pip install openwakeword），模型比设备上的WakeNet大得多，
+    只在每次唤醒时对1秒多的音频跑一次。换别的模型只要实现同样的score()。
+    """
+
+    def __init__(self, spec: str):
+        backend, _, model = spec.partition(":")
+        if backend != "openwakeword":
+            raise ValueError(f"不支持的复核模型: {backend}")
+        if not HAS_NUMPY:
+            raise RuntimeError("需要numpy")
+        from openwakeword.model import Model
+        self.name = spec
+        self.model = Model(wakeword_models=[model] if model else [])
+        self.lock = threading.Lock()    # 模型带流式状态，同一时间只给一个连接用
+
+    def score(self, pcm: bytes) -> float:
+        samples = np.frombuffer(pcm, dtype=np.int16)
+        with self.lock:
+            self.model.reset()
+            predictions = self.model.predict_clip(samples)
+        return max((max(p.values()) for p in predictions if p), default=0.0)
+
+WAKE_VERIFIER = None
+if RELAY_WAKE_VERIFIER:
+    try:
+        WAKE_VERIFIER = WakeVerifier(RELAY_WAKE_VERIFIER)
+        print(f"✅ 唤醒二次确认模型: {RELAY_WAKE_VERIFIER}")
+    except Exception as e:
+        print(f"⚠️ 唤醒二次确认模型加载失败，不复核: {e}")
+
+class WakeCheck:
+    """
+    🛡️ 一次唤醒的二次确认：按帧头时间戳收齐会话上行最前面的clip_samples个样本（唤醒词），
+    结果出来之前后面的音频先攒着，通过后一起转发
+
+    ✂️ 设备在session_start的wake_end里带了唤醒词连同触发后尾音结束的位置时，clip_samples到wake_end之间
+    既不拿去复核也不转给豆包（旧固件不带，按clip_samples）
+    """
+
+    def __init__(self, clip_samples: int, wake_end: int = 0):
+        self.clip_samples = clip_samples
+        self.wake_end = max(clip_samples, wake_end)
+        self.base = None            # 本次录音第一条消息的时间戳
+        self.clip = bytearray()
+        self.held = []              # 唤醒词之后的PCM
+        self.held_bytes = 0
+        self.rejected = False       # 没通过：直到下一次session_start都丢弃上行
+        self.started = time.monotonic()
+
+    def feed(self, pcm: bytes, timestamp: int) -> bool:
+        """收下一条解码后的上行PCM（timestamp=第一个样本的录音位置），返回唤醒词是否已经收齐"""
+        if self.base is None:
+            self.base = timestamp
+        position = timestamp - self.base
+        split = max(0, min(len(pcm), (self.clip_samples - position) * 2))
+        keep = max(split, min(len(pcm), (self.wake_end - position) * 2))
+        self.clip.extend(pcm[:split])
+        if keep < len(pcm) and self.held_bytes < WAKE_HOLD_MAX_BYTES:
+            self.held.append(pcm[keep:])
+            self.held_bytes += len(pcm) - keep
+        return position + len(pcm) // 2 >= self.wake_end
+
+    def expired(self) -> bool:
+        return time.monotonic() - self.started >= RELAY_WAKE_VERIFY_WAIT_S
+
+
+class SpeechDetector:
+    """
+    🎯 判断一条上行PCM是不是有人在说话：装了webrtcvad时用它（按20ms一帧，过半有声算说话），
+    否则按能量（高于底噪10dB且高于RELAY_VAD_ENERGY_DB）
+    """
+
+    FRAME_BYTES = ESP32_SAMPLE_RATE * 2 * 20 // 1000
+
+    def __init__(self):
+        self.vad = webrtcvad.Vad(RELAY_VAD_AGGRESSIVENESS) if HAS_WEBRTCVAD else None
+        self.floor_db = None        # 能量判断时的底噪估计
+
+    def is_speech(self, pcm: bytes) -> bool:
+        if self.vad is not None:
+            frames = [pcm[i:i + self.FRAME_BYTES] for i in range(0, len(pcm) - self.FRAME_BYTES + 1, self.FRAME_BYTES)]
+            if frames:
+                voiced = sum(1 for frame in frames if self.vad.is_speech(frame, ESP32_SAMPLE_RATE))
+                return voiced * 2 > len(frames)
+        samples = array.array("h", pcm[:len(pcm) // 2 * 2])
+        if not samples:
+            return False
+        level_db = 10 * math.log10(sum(x * x for x in samples) / len(samples) / (32768.0 * 32768.0) + 1e-10)
+        if self.floor_db is None or level_db < self.floor_db:
+            self.floor_db = level_db
+        else:
+            self.floor_db += (level_db - self.floor_db) * 0.01   # 底噪慢慢往上跟，说话时也不会跟上去太多
+        return level_db > max(RELAY_VAD_ENERGY_DB, self.floor_db + 10)
+
+
+def pcm_ms(pcm: bytes) -> int:
+    return len(pcm) * 1000 // (ESP32_SAMPLE_RATE * 2)
+
+
+class UplinkEndpointer:
+    """
+    🎯 中继端VAD：给没有VAD门控的设备判断一句话什么时候说完
+
+    开口之后的静音先照常转发RELAY_VAD_HANGOVER_MS，再往后的先攒着：重新开口就连同开口一起发出，
+    静音满silence_limit_ms就判定说完（攒着的丢掉，由调用者补齐静音）。说完之后的静音都不转发，
+    只留最近RELAY_VAD_PREROLL_MS毫秒作为下一句的开头
+    """
+
+    def __init__(self):
+        self.silence_limit_ms = RELAY_VAD_SILENCE_MS    # 📏 自适应窗口按设备调整
+        self.reset()
+
+    def reset(self):
+        self.heard = False          # 这句话开口了
+        self.ended = False          # 判定说完了，之后的静音不转发
+        self.silence_ms = 0
+        self.held = []
+        self.held_ms = 0
+
+    def end(self):
+        """设备自己发了speech_end：和判定说完一样处理"""
+        self.held.clear()
+        self.held_ms = 0
+        self.heard = False
+        self.ended = True
+
+    def feed(self, pcm: bytes, speech: bool) -> Tuple[bytes, bool]:
+        """
+        收下一条上行PCM（speech：SpeechDetector的判断）
+
+        Returns:
+            (现在要转发的音频, 是否刚判定说完)
+        """
+        ms = pcm_ms(pcm)
+        if speech:
+            out = b"".join(self.held) + pcm if self.held else pcm
+            self.held.clear()
+            self.held_ms = 0
+            self.heard = True
+            self.ended = False
+            self.silence_ms = 0
+            return out, False
+        if self.ended:
+            self.held.append(pcm)
+            self.held_ms += ms
+            while len(self.held) > 1 and self.held_ms - pcm_ms(self.held[0]) >= RELAY_VAD_PREROLL_MS:
+                self.held_ms -= pcm_ms(self.held.pop(0))
+            return b"", False
+        if not self.heard:
+            return pcm, False       # 还没开口（唤醒词后面的停顿）：照常转发
+        self.silence_ms += ms
+        if self.silence_ms <= RELAY_VAD_HANGOVER_MS:
+            return pcm, False
+        if self.silence_ms < self.silence_limit_ms:
+            self.held.append(pcm)
+            self.held_ms += ms
+            return b"", False
+        self.end()
+        return b"", True
+
+
+class EndpointStats:
+    """📏 一台设备的停顿统计"""
+
+    __slots__ = ("pauses", "bias_ms", "cutoffs")
+
+    def __init__(self):
+        self.pauses = deque(maxlen=RELAY_ENDPOINT_HISTORY)
+        self.bias_ms = 0            # 被截断时加上、之后慢慢减回
+        self.cutoffs = 0
+
+
+class EndpointPolicy:
+    """
+    📏 按设备学习ASR结束平滑窗口（进程内，按最近使用淘汰；多进程时设备固定连同一个worker）
+    """
+
+    def __init__(self, max_devices: int):
+        self.max_devices = max_devices
+        self.devices: "OrderedDict[str, EndpointStats]" = OrderedDict()
+
+    def _stats(self, device_id: str) -> EndpointStats:
+        stats = self.devices.get(device_id)
+        if stats is None:
+            stats = self.devices[device_id] = EndpointStats()
+            while len(self.devices) > self.max_devices:
+                self.devices.popitem(last=False)
+        else:
+            self.devices.move_to_end(device_id)
+        return stats
+
+    def pause(self, device_id: str, ms: int):
+        self._stats(device_id).pauses.append(ms)
+
+    def cutoff(self, device_id: str, gap_ms: int):
+        """识别结束后gap_ms又开口了：这次窗口太短"""
+        stats = self._stats(device_id)
+        stats.cutoffs += 1
+        stats.bias_ms = min(RELAY_ENDPOINT_MAX_MS, stats.bias_ms + RELAY_ENDPOINT_CUTOFF_BUMP_MS)
+        METRIC_ENDPOINT_CUTOFFS.inc()
+        logger.info(f"📏 设备 {device_id} 的话被截断了（识别结束后 {gap_ms}ms 又开口），"
+                    f"窗口加 {RELAY_ENDPOINT_CUTOFF_BUMP_MS}ms")
+
+    def turn(self, device_id: str):
+        """一个没被截断的回合：截断加上的余量减回一点"""
+        stats = self.devices.get(device_id)
+        if stats is not None and stats.bias_ms > 0:
+            stats.bias_ms = max(0, stats.bias_ms - RELAY_ENDPOINT_CUTOFF_BUMP_MS // 6)
+
+    def export(self) -> Dict[str, Any]:
+        """🚚 滚动重启时交给新进程"""
+        return {device_id: {"pauses": list(stats.pauses), "bias_ms": stats.bias_ms, "cutoffs": stats.cutoffs}
+                for device_id, stats in self.devices.items()}
+
+    def load(self, devices: Dict[str, Any]):
+        for device_id, item in devices.items():
+            stats = self._stats(device_id)
+            stats.pauses.extend(int(ms) for ms in item.get("pauses", ()))
+            stats.bias_ms = int(item.get("bias_ms", 0))
+            stats.cutoffs = int(item.get("cutoffs", 0))
+
+    def window(self, device_id: str, default_ms: int) -> int:
+        """这台设备现在该用的窗口（样本不够时返回default_ms）"""
+        stats = self.devices.get(device_id) if RELAY_ENDPOINT_ADAPT and device_id else None
+        if stats is None or len(stats.pauses) < RELAY_ENDPOINT_MIN_PAUSES:
+            return default_ms
+        ordered = sorted(stats.pauses)
+        p90 = ordered[min(len(ordered) - 1, len(ordered) * 9 // 10)]
+        return max(RELAY_ENDPOINT_MIN_MS, min(RELAY_ENDPOINT_MAX_MS, p90 + RELAY_ENDPOINT_MARGIN_MS + stats.bias_ms))
+
+
+class PauseMeter:
+    """
+    📏 一条连接上的停顿测量：句中停顿和识别结束后马上又开口（截断）交给EndpointPolicy
+    """
+
+    def __init__(self, policy: EndpointPolicy, device_id: str):
+        self.policy = policy
+        self.device_id = device_id
+        self.heard = False          # 这句话开口了
+        self.silence_ms = 0
+        self.final_at = None        # 上一句识别结束的时间（截断检查窗口内）
+
+    def note(self, ms: int, speech: bool):
+        if not speech:
+            if self.heard:
+                self.silence_ms += ms
+            return
+        if self.heard and self.silence_ms >= RELAY_ENDPOINT_PAUSE_MIN_MS:
+            self.policy.pause(self.device_id, self.silence_ms)
+        self.heard = True
+        self.silence_ms = 0
+        self.resumed()
+
+    def resumed(self):
+        """又开口了（上行VAD，或者豆包出了新一句的识别中间结果）"""
+        if self.final_at is not None:
+            gap_ms = round((time.monotonic() - self.final_at) * 1000)
+            self.final_at = None
+            if gap_ms <= RELAY_ENDPOINT_CUTOFF_MS:
+                self.policy.cutoff(self.device_id, gap_ms)
+            else:
+                self.policy.turn(self.device_id)
+
+    def speech_end(self):
+        """这句话说完了：最后那段静音不是句中停顿"""
+        self.heard = False
+        self.silence_ms = 0
+
+    def asr_final(self):
+        if self.final_at is not None:
+            self.policy.turn(self.device_id)    # 上一句之后没人接着说
+        self.heard = False
+        self.silence_ms = 0
+        self.final_at = time.monotonic()
+
+
+endpoint_policy = EndpointPolicy(RELAY_ENDPOINT_DEVICES)
+
+
+class WakeRound:
+    """
+    🏠 一个房间里的一轮唤醒：第一台设备开窗，窗口结束时选出唤醒词音量最大的
+    """
+
+    def __init__(self):
+        self.candidates = []        # (音量dB, 到达时间, device_id)
+        self.winner = None
+        self.decided_at = 0.0
+        self.done = asyncio.Event()
+
+
+class WakeArbiter:
+    """
+    🏠 多设备唤醒仲裁（见RELAY_WAKE_ROOMS）：每个房间同时只有一轮，定时器到点就出结果，
+    不依赖开窗的那个连接还在不在
+    """
+
+    def __init__(self, rooms: Dict[str, str], window_ms: int):
+        self.rooms = rooms
+        self.window_s = window_ms / 1000
+        self.rounds = {}            # 房间 -> 最近一轮WakeRound
+
+    def room_of(self, device_id: Optional[str]) -> Optional[str]:
+        if self.window_s <= 0 or not device_id:
+            return None
+        return self.rooms.get(device_id)
+
+    async def arbitrate(self, room: str, device_id: str, level: Optional[float]) -> bool:
+        """
+        这台设备的唤醒参加仲裁，等到出结果，返回它是否继续（level=None的旧固件按最小音量算）
+        """
+        now = time.monotonic()
+        current = self.rounds.get(room)
+        if current is not None and current.winner is not None and now - current.decided_at < self.window_s:
+            # 已经选出来了，同一次唤醒的迟到者
+            won = current.winner == device_id
+            METRIC_WAKE_ARBITRATION.inc(result="won" if won else "lost")
+            return won
+        if current is None or current.winner is not None:
+            current = WakeRound()
+            self.rounds[room] = current
+            asyncio.get_running_loop().call_later(self.window_s, self._decide, room, current)
+        current.candidates.append((float("-inf") if level is None else float(level), now, device_id))
+        await current.done.wait()
+        won = current.winner == device_id
+        if len(current.candidates) == 1:
+            METRIC_WAKE_ARBITRATION.inc(result="alone")
+        else:
+            METRIC_WAKE_ARBITRATION.inc(result="won" if won else "lost")
+        return won
+
+    def _decide(self, room: str, current: WakeRound):
+        level, _, current.winner = max(current.candidates, key=lambda c: (c[0], -c[1]))
+        current.decided_at = time.monotonic()
+        current.done.set()
+        if len(current.candidates) > 1:
+            others = ", ".join(f"{c[2]}({c[0]:.1f}dB)" for c in current.candidates if c[2] != current.winner)
+            logger.info(f"🏠 {room}: {len(current.candidates)}台设备同时唤醒，{current.winner}（{level:.1f}dB）继续，"
+                        f"{others}回到空闲")
+
+
+wake_arbiter = WakeArbiter(WAKE_ROOM_OF, RELAY_WAKE_ARBITRATION_MS)
+
+
+class WakeTrial:
+    """
+    📈 一次还没定性的唤醒（session_start到下一次问题/唤醒/session_end之间）
+    """
+    __slots__ = ("site", "model", "threshold", "confidence")
+
+    def __init__(self, site: str, model: int, threshold: float, confidence: Optional[float]):
+        self.site = site
+        self.model = model
+        self.threshold = threshold
+        self.confidence = confidence
+
+
+class WakeTuner:
+    """
+    📈 按现场自动调唤醒词阈值（见RELAY_WAKE_TUNING）：每个现场每个模型一个滑动窗口，
+    误唤醒比例超出目标区间就调一步，推给这个现场在线的设备
+    """
+
+    def __init__(self, rooms: Dict[str, str]):
+        self.rooms = rooms
+        self.outcomes = {}      # (现场, 模型序号) -> deque[(是否真唤醒, 置信度)]
+        self.thresholds = {}    # (现场, 模型序号) -> 当前阈值（推荐过的，或者设备上报的）
+        self.tuned = set()      # 调整过、要下发给设备的(现场, 模型序号)
+        self.senders = {}       # 现场 -> {连接: DeviceSender}
+
+    def site_of(self, device_id: str) -> str:
+        room = self.rooms.get(device_id)
+        return f"room:{room}" if room is not None else device_id
+
+    def attach(self, websocket, device_id: str, sender) -> Optional[dict]:
+        """
+        设备hello：登记它的发送队列，返回这个现场要下发的wake_config（还没调过时为None）
+        """
+        site = self.site_of(device_id)
+        self.senders.setdefault(site, {})[websocket] = sender
+        return self._config(site)
+
+    def detach(self, websocket, device_id: str):
+        site = self.site_of(device_id)
+        senders = self.senders.get(site)
+        if senders is not None:
+            senders.pop(websocket, None)
+            if not senders:
+                del self.senders[site]
+
+    def begin(self, device_id: str, msg: Dict[str, Any]) -> WakeTrial:
+        """
+        session_start：模型序号从1开始（旧固件不带时算模型1），阈值0=模型默认
+        """
+        site = self.site_of(device_id)
+        model = 2 if msg.get("wake_model") == 2 else 1
+        threshold = float(msg.get("wake_thr") or 0)
+        key = (site, model)
+        if key not in self.thresholds and threshold > 0:
+            self.thresholds[key] = threshold    # 中继重启后从设备NVS里的阈值接着调
+        level = msg.get("wake_db")
+        return WakeTrial(site, model, threshold, None if level is None else float(level))
+
+    def settle(self, trial: WakeTrial, real: bool):
+        METRIC_WAKE_OUTCOME.inc(outcome="real" if real else "false")
+        key = (trial.site, trial.model)
+        window = self.outcomes.get(key)
+        if window is None:
+            window = self.outcomes[key] = deque(maxlen=RELAY_WAKE_TUNE_WINDOW)
+        window.append((real, trial.confidence))
+        if len(window) < RELAY_WAKE_TUNE_MIN_SAMPLES:
+            return
+        false_rate = sum(1 for real, _ in window if not real) / len(window)
+        if RELAY_WAKE_TUNE_FALSE_LOW <= false_rate <= RELAY_WAKE_TUNE_FALSE_HIGH:
+            return
+        current = self.thresholds.get(key) or RELAY_WAKE_TUNE_START
+        step = RELAY_WAKE_TUNE_STEP if false_rate > RELAY_WAKE_TUNE_FALSE_HIGH else -RELAY_WAKE_TUNE_STEP
+        target = round(min(RELAY_WAKE_TUNE_MAX, max(RELAY_WAKE_TUNE_MIN, current + step)), 4)
+        if target == self.thresholds.get(key):
+            return      # 已经到头了
+        real_conf = [c for r, c in window if r and c is not None]
+        false_conf = [c for r, c in window if not r and c is not None]
+        logger.info(f"📈 {trial.site} 唤醒词模型{trial.model}最近{len(window)}次唤醒误唤醒{false_rate:.0%}"
+                    f"（置信度中位数 真{self._median(real_conf)} 误{self._median(false_conf)}），"
+                    f"阈值 {current:.4f} → {target:.4f}")
+        METRIC_WAKE_TUNE.inc(direction="up" if step > 0 else "down")
+        self.thresholds[key] = target
+        self.tuned.add(key)
+        window.clear()          # 旧阈值下的统计不再代表新阈值
+        config = self._config(trial.site)
+        request = esp32_json(config)
+        for sender in list(self.senders.get(trial.site, {}).values()):
+            sender.put(request)
+
+    def threshold_series(self) -> Dict[tuple, float]:
+        return {(site, str(model)): threshold for (site, model), threshold in list(self.thresholds.items())}
+
+    def _config(self, site: str) -> Optional[dict]:
+        config = {}
+        for model, key in ((1, "threshold"), (2, "threshold2")):
+            if (site, model) in self.tuned:
+                config[key] = self.thresholds[(site, model)]
+        return dict(config, type="wake_config") if config else None
+
+    @staticmethod
+    def _median(values) -> str:
+        return f"{sorted(values)[len(values) // 2]:.2f}" if values else "-"
+
+
+wake_tuner = WakeTuner(WAKE_ROOM_OF)
+
+# IMA-ADPCM 标准步长表和索引调整表（与ESP32端audio_codec.cc保持一致）
+ADPCM_STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+]
+ADPCM_INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8]
+
+class ImaAdpcmEncoder:
+    """
+    IMA-ADPCM编码器（下行音频4:1压缩）
+
+    每次encode_block输出一个独立的块，块头携带当前预测值和步长索引，
+    ESP32端即使丢了某个块也能从下一个块正确解码。
+    块格式: [int16小端初始样本][uint8步长索引][uint8保留][4bit编码，低半字节在前]
+    """
+
+    def __init__(self):
+        self.predictor = 0
+        self.index = 0
+
+    def _encode_sample(self, sample: int) -> int:
+        step = ADPCM_STEP_TABLE[self.index]
+        diff = sample - self.predictor
+        nibble = 0
+        if diff < 0:
+            nibble = 8
+            diff = -diff
+        delta = step >> 3
+        if diff >= step:
+            nibble |= 4
+            diff -= step
+            delta += step
+        step >>= 1
+        if diff >= step:
+            nibble |= 2
+            diff -= step
+            delta += step
+        step >>= 1
+        if diff >= step:
+            nibble |= 1
+            delta += step
+
+        self.predictor += -delta if nibble & 8 else delta
+        self.predictor = max(-32768, min(32767, self.predictor))
+        self.index = max(0, min(88, self.index + ADPCM_INDEX_TABLE[nibble]))
+        return nibble
+
+    def encode_block(self, pcm: bytes) -> bytes:
+        """
+        编码一段16位PCM为一个ADPCM块
+
+        Args:
+            pcm (bytes): 16kHz int16 PCM数据（偶数个样本）
+
+        Returns:
+            bytes: ADPCM块
+        """
+        count = len(pcm) // 2
+        count -= count % 2
+        samples = struct.unpack(f'<{count}h', pcm[:count * 2])
+        block = bytearray(struct.pack('<hBB', self.predictor, self.index, 0))
+        for i in range(0, count, 2):
+            low = self._encode_sample(samples[i])
+            high = self._encode_sample(samples[i + 1])
+            block.append(low | (high << 4))
+        return bytes(block)
+
+def load_assets(directory: str) -> "OrderedDict[str, dict]":
+    """
+    📦 读RELAY_ASSET_DIR下的WAV，编成ADPCM（最后一块补静音，数据长度是块字节数的整数倍）
+
+    Returns:
+        OrderedDict: 名称 -> {"name", "id", "data", "samples", "block"}
+    """
+    assets = OrderedDict()
+    for filename in sorted(os.listdir(directory)):
+        name, ext = os.path.splitext(filename)
+        if ext.lower() != ".wav":
+            continue
+        try:
+            with wave.open(os.path.join(directory, filename), "rb") as wav:
+                if (wav.getframerate(), wav.getnchannels(), wav.getsampwidth()) != (ESP32_SAMPLE_RATE, 1, 2):
+                    raise ValueError(f"要求{ESP32_SAMPLE_RATE}Hz单声道16位")
+                pcm = wav.readframes(wav.getnframes())
+        except (OSError, EOFError, wave.Error, ValueError) as e:
+            print(f"⚠️ 提示音 {filename} 跳过: {e}")
+            continue
+        if len(name.encode()) > 15 or len(assets) >= ASSET_MAX_ENTRIES:
+            print(f"⚠️ 提示音 {filename} 跳过: 名称超过15字节或已满{ASSET_MAX_ENTRIES}条")
+            continue
+        samples = len(pcm) // 2
+        pcm += bytes(-len(pcm) % (ASSET_BLOCK_SAMPLES * 2))
+        encoder = ImaAdpcmEncoder()
+        data = b"".join(encoder.encode_block(pcm[i:i + ASSET_BLOCK_SAMPLES * 2])
+                        for i in range(0, len(pcm), ASSET_BLOCK_SAMPLES * 2))
+        if not data or len(data) > ASSET_MAX_BYTES:
+            print(f"⚠️ 提示音 {filename} 跳过: 编码后{len(data)}字节，超过{ASSET_MAX_BYTES}")
+            continue
+        assets[name] = {"name": name, "id": hashlib.sha256(data).hexdigest()[:16], "data": data,
+                        "samples": samples, "block": 4 + ASSET_BLOCK_SAMPLES // 2}
+    return assets
+
+ASSETS = load_assets(RELAY_ASSET_DIR) if RELAY_ASSET_DIR else OrderedDict()
+ASSETS_BY_ID = {a["id"]: a for a in ASSETS.values()}
+if ASSETS:
+    print(f"✅ 推送提示音 {len(ASSETS)} 条: {', '.join(ASSETS)}")
+
+def create_protocol_header(message_type=0b0001, has_event=True, use_json=True, use_gzip=True):
+    """
+    创建豆包AI协议头
+    
+    Args:
+        message_type (int): 消息类型
+        has_event (bool): 是否包含事件
+        use_json (bool): 是否使用JSON格式
+        use_gzip (bool): 是否使用gzip压缩
+        
+    Returns:
+        bytearray: 协议头数据
+    """
+    header = bytearray()
+    header_size = 1
+    version = 0b0001
+    header.append((version << 4) | header_size)
+    flags = 0b0100 if has_event else 0b0000
+    header.append((message_type << 4) | flags)
+    serial = 0b0001 if use_json else 0b0000
+    compress = 0b0001 if use_gzip else 0b0000
+    header.append((serial << 4) | compress)
+    header.append(0x00)
+    return header
+
+# 固定的协议头和整数编解码（热路径上不再逐字节拼）
+_U32 = struct.Struct(">I")
+_HEADER_FULL = bytes(create_protocol_header())
+_HEADER_AUDIO = bytes(create_protocol_header(message_type=0b0010, use_json=False, use_gzip=False))
+_HEADER_AUDIO_GZIP = bytes(create_protocol_header(message_type=0b0010, use_json=False, use_gzip=True))
+
+@functools.lru_cache(maxsize=256)
+def _audio_message_prefix(session_id: str, compress: bool) -> bytes:
+    """
+    音频消息中长度字段之前的部分：协议头 | 事件200 | 会话ID长度 | 会话ID，每个会话只算一次
+    """
+    session_bytes = session_id.encode('utf-8')
+    header = _HEADER_AUDIO_GZIP if compress else _HEADER_AUDIO
+    return header + _U32.pack(200) + _U32.pack(len(session_bytes)) + session_bytes
+
+def create_audio_message(session_id: str, pcm: bytes, compress: bool = False) -> bytes:
+    """
+    构造发送给豆包AI的音频消息（事件200）
+    
+    实时PCM几乎压不动（640字节的帧gzip后反而变大），每帧压缩还要几十微秒CPU，
+    所以默认不压缩；只有补发的静音这类高度重复的数据才值得gzip。
+    
+    Args:
+        session_id (str): 会话ID
+        pcm (bytes): 16kHz 16位单声道PCM
+        compress (bool): 是否gzip压缩
+        
+    Returns:
+        bytes: 完整的协议消息
+    """
+    payload = gzip.compress(pcm) if compress else pcm
+    return b"".join((_audio_message_prefix(session_id, compress), _U32.pack(len(payload)), payload))
+
+def parse_doubao_response(data: bytes) -> Dict[str, Any]:
+    """
+    解析豆包AI服务器响应
+    
+    Args:
+        data (bytes): 服务器响应数据
+        
+    Returns:
+        Dict[str, Any]: 解析后的响应数据
+    """
+    # 如果数据为空或长度不足，返回空字典
+    if isinstance(data, str) or len(data) < 4:
+        return {}
+    
+    try:
+        # 解析协议头
+        header_size = (data[0] & 0x0f) * 4
+        message_type = data[1] >> 4
+        message_flags = data[1] & 0x0f
+        has_event = bool(message_flags & 0b0100)
+        compression = data[2] & 0x0f
+        use_gzip = bool(compression)
+        use_json = bool(data[2] >> 4)
+        
+        # 直接在原始数据上按偏移解析，不先切出payload（音频帧切片会复制整包）
+        end = len(data)
+        result = {"message_type": "unknown"}
+        offset = header_size
+        
+        # 错误帧: [错误码][长度][内容]，不带事件和会话ID
+        if message_type == 0b1111:
+            result["message_type"] = "error"
+            if end >= offset + 8:
+                result["error_code"] = _U32.unpack_from(data, offset)[0]
+                msg_len = _U32.unpack_from(data, offset + 4)[0]
+                msg_data = data[offset + 8:offset + 8 + msg_len]
+                if use_gzip and msg_data:
+                    try:
+                        msg_data = gzip.decompress(msg_data)
+                    except:
+                        pass
+                result["payload"] = msg_data.decode('utf-8', errors='ignore')
+            return result
+        
+        # 解析事件ID
+        if has_event and end >= offset + 4:
+            result["event"] = _U32.unpack_from(data, offset)[0]
+            offset += 4
+        
+        # 解析会话ID
+        if end >= offset + 4:
+            session_id_len = _U32.unpack_from(data, offset)[0]
+            offset += 4
+            if end >= offset + session_id_len:
+                session_id = data[offset:offset+session_id_len]
+                result["session_id"] = session_id.decode('utf-8', errors='ignore')
                 offset += session_id_len
         
         # 解析消息数据
-        if len(payload) >= offset + 4:
-            msg_len = int.from_bytes(payload[offset:offset+4], "big")
+        if end >= offset + 4:
+            msg_len = _U32.unpack_from(data, offset)[0]
             offset += 4
-            if len(payload) >= offset + msg_len:
-                msg_data = payload[offset:offset+msg_len]
+            if end >= offset + msg_len:
+                msg_data = data[offset:offset+msg_len]
                 
                 # 解压缩数据
                 if use_gzip and msg_data:
@@ -230,16 +2151,12 @@ def parse_doubao_response(data: bytes) -> Dict[str, Any]:
                             result["payload"] = json.loads(msg_data.decode('utf-8'))
                         except:
                             # 不是JSON格式，直接作为音频数据处理
-                            logger.info(f"🎵 接收到豆包音频数据: {len(msg_data)} 字节，正在重采样...")
-                            resampled_audio = resample_audio_24k_to_16k(msg_data)
-                            result["audio_data"] = resampled_audio
-                            logger.info(f"✅ 重采样完成: {len(resampled_audio)} 字节")
+                            # 原始音频，格式取决于协商结果（见TTS_PREFERRED_FORMATS），由会话决定是否重采样
+                            result["audio_data"] = msg_data
                     else:
                         # 直接是音频数据
-                        logger.info(f"🎵 接收到豆包音频数据: {len(msg_data)} 字节，正在重采样...")
-                        resampled_audio = resample_audio_24k_to_16k(msg_data)
-                        result["audio_data"] = resampled_audio
-                        logger.info(f"✅ 重采样完成: {len(resampled_audio)} 字节")
+                        # 原始音频，格式取决于协商结果（见TTS_PREFERRED_FORMATS），由会话决定是否重采样
+                        result["audio_data"] = msg_data
                 elif message_type == 0b1001:  # SERVER_FULL_RESPONSE（完整响应）
                     result["message_type"] = "response"
                     if use_json and msg_data:
@@ -255,23 +2172,2516 @@ def parse_doubao_response(data: bytes) -> Dict[str, Any]:
         logger.error(f"解析豆包响应失败: {e}")
         return {}
 
-async def safe_send(websocket, data):
+class StreamBuffer:
+    """
+    下行音频流缓冲区
+
+    bytes拼接再切片每取一块都要复制剩下的全部数据，回复越长越慢（O(n²)）。
+    这里用一个可增长的bytearray加读指针：取块返回memoryview切片，不复制；
+    已读部分在下次追加时整体前移（剩余数据通常不足一块，前移几乎没有开销）。
+
+    取出的memoryview在调用release()之前不能追加数据（bytearray被引用时不能改变大小），
+    clear()只移动读指针，可以在任何时候调用。
+    """
+
+    def __init__(self):
+        self._buf = bytearray()
+        self._pos = 0
+
+    def __len__(self) -> int:
+        return len(self._buf) - self._pos
+
+    def append(self, data):
+        if self._pos:
+            del self._buf[:self._pos]
+            self._pos = 0
+        self._buf += data
+
+    def take(self, n: int) -> memoryview:
+        """
+        取出最多n字节，返回指向内部缓冲区的视图
+        """
+        n = min(n, len(self))
+        view = memoryview(self._buf)[self._pos:self._pos + n]
+        self._pos += n
+        return view
+
+    def clear(self):
+        self._pos = len(self._buf)
+
+    def peek(self) -> bytes:
+        """剩下的数据（复制一份，不移动读指针）"""
+        return bytes(self._buf[self._pos:])
+
+
+class ResponseQueue(asyncio.Queue):
+    """
+    🧮 一个会话的豆包响应队列：记着排队的TTS音频字节数
+
+    转发任务跟不上时（设备链路慢、下行额度卡住）豆包照样按生成速度推音频，不设限整段回复都会堆在这里。
+    排着的音频超过limit字节时这一轮后面的音频直接丢弃（到TTS结束为止，不会播一段丢一段），控制消息照常排队。
+    """
+
+    def __init__(self, limit: int):
+        super().__init__()
+        self.limit = limit
+        self.audio_bytes = 0
+        self.truncated = False      # 本轮已经超过上限，559之前的音频不再排队
+        self.dropped = 0
+
+    def put_nowait(self, item):
+        audio = item.get("audio_data") if isinstance(item, dict) else None
+        if audio is not None:
+            if self.truncated or (self.limit > 0 and self.audio_bytes + len(audio) > self.limit):
+                self.truncated = True
+                self.dropped += len(audio)
+                METRIC_MEMORY_TRIMMED.inc(len(audio), what="tts_queue")
+                return
+            self.audio_bytes += len(audio)
+        elif isinstance(item, dict) and item.get("event") == 559:
+            self.truncated = False
+        super().put_nowait(item)
+
+    def _get(self):
+        item = super()._get()
+        if isinstance(item, dict) and "audio_data" in item:
+            self.audio_bytes -= len(item["audio_data"])
+        return item
+
+    def trim(self) -> int:
+        """
+        丢掉排着的TTS音频（这一轮后面的也不再排队），返回丢掉的字节数
+        """
+        dropped = self.audio_bytes
+        if dropped:
+            self._queue = deque(item for item in self._queue
+                                if not (isinstance(item, dict) and "audio_data" in item))
+            self.audio_bytes = 0
+            # 这一轮的559已经排在队列里时，下一轮照常排队
+            self.truncated = not any(isinstance(item, dict) and item.get("event") == 559 for item in self._queue)
+            self.dropped += dropped
+        return dropped
+
+
+class ResponseCache:
+    """
+    💾 回复音频缓存（16kHz PCM，重放时再按连接协商的格式编码）
+
+    内存里按LRU保留最近RESPONSE_CACHE_MAX_ENTRIES条；配置了目录时同时写一份文件，
+    内存未命中再按文件修改时间判断是否过期。豆包的对话上下文里仍然有这一轮，
+    命中时只是不再等它生成，后面的多轮对话不受影响。
+    """
+
+    def __init__(self, ttl_s: float, directory: str, max_entries: int):
+        self.ttl_s = ttl_s
+        self.directory = directory
+        self.max_entries = max_entries
+        self._entries = OrderedDict()   # key -> (过期时间, pcm)
+        self.hits = 0
+        self.misses = 0
+        if directory:
+            os.makedirs(directory, exist_ok=True)
+
+    @property
+    def enabled(self) -> bool:
+        return self.ttl_s > 0
+
+    @staticmethod
+    def key_for(text: str) -> Optional[str]:
+        """
+        归一化ASR文本：去掉空白和标点、转小写；不适合缓存的问题返回None
+        """
+        key = re.sub(r"[\W_]+", "", text).lower()
+        if not key or RESPONSE_CACHE_SKIP.search(key):
+            return None
+        return key
+
+    def _path(self, key: str) -> str:
+        return os.path.join(self.directory, hashlib.sha1(key.encode("utf-8")).hexdigest() + ".pcm")
+
+    def get(self, key: str) -> Optional[bytes]:
+        now = time.time()
+        entry = self._entries.get(key)
+        if entry is not None:
+            if entry[0] > now:
+                self._entries.move_to_end(key)
+                self.hits += 1
+                return entry[1]
+            del self._entries[key]
+        if self.directory:
+            path = self._path(key)
+            try:
+                mtime = os.path.getmtime(path)
+                if mtime + self.ttl_s > now:
+                    with open(path, "rb") as f:
+                        pcm = f.read()
+                    self._remember(key, pcm, mtime + self.ttl_s)
+                    self.hits += 1
+                    return pcm
+                os.remove(path)
+            except OSError:
+                pass
+        self.misses += 1
+        return None
+
+    def put(self, key: str, pcm: bytes):
+        if not pcm or len(pcm) > RESPONSE_CACHE_MAX_BYTES:
+            return
+        self._remember(key, pcm, time.time() + self.ttl_s)
+        if self.directory:
+            try:
+                with open(self._path(key), "wb") as f:
+                    f.write(pcm)
+            except OSError as e:
+                logger.warning(f"写入回复缓存失败: {e}")
+
+    def _remember(self, key: str, pcm: bytes, expires_at: float):
+        self._entries[key] = (expires_at, pcm)
+        self._entries.move_to_end(key)
+        while len(self._entries) > self.max_entries:
+            self._entries.popitem(last=False)
+
+
+response_cache = ResponseCache(RESPONSE_CACHE_TTL_S, RESPONSE_CACHE_DIR, RESPONSE_CACHE_MAX_ENTRIES)
+
+
+class ReplyFlight:
+    """
+    🛫 一路正在生成的回复：领头的会话边下发边追加16kHz PCM，跟随的会话各自按自己的进度读
+    """
+
+    def __init__(self, key: str):
+        self.key = key
+        self.chunks = []
+        self.done = False
+        self.aborted = False        # 领头的回复没有正常结束
+        self.subscribers = 0
+        self._changed = asyncio.Event()
+
+    def publish(self, pcm: bytes):
+        self.chunks.append(pcm)
+        self._wake()
+
+    def finish(self, ok: bool):
+        if not self.done:
+            self.done = True
+            self.aborted = not ok
+            self._wake()
+
+    def _wake(self):
+        self._changed.set()
+        self._changed = asyncio.Event()
+
+    async def read(self, index: int) -> Optional[bytes]:
+        """第index块（还没生成时等待），回复结束了返回None"""
+        while index >= len(self.chunks) and not self.done:
+            await self._changed.wait()
+        return self.chunks[index] if index < len(self.chunks) else None
+
+
+class ReplyFlights:
+    """
+    🛫 进程内正在生成的回复，按ResponseCache.key_for归一化后的问题索引
+    """
+
+    def __init__(self):
+        self.flights: Dict[str, ReplyFlight] = {}
+
+    def join(self, key: str) -> Optional[ReplyFlight]:
+        flight = self.flights.get(key)
+        if flight is None or flight.done:
+            return None
+        flight.subscribers += 1
+        return flight
+
+    def lead(self, key: str) -> ReplyFlight:
+        flight = self.flights[key] = ReplyFlight(key)
+        return flight
+
+    def end(self, flight: ReplyFlight, ok: bool):
+        flight.finish(ok)
+        if self.flights.get(flight.key) is flight:
+            del self.flights[flight.key]
+        if flight.subscribers:
+            METRIC_SINGLEFLIGHT.inc(result="led")
+            if not ok:
+                METRIC_SINGLEFLIGHT.inc(result="aborted")
+
+
+reply_flights = ReplyFlights()
+
+
+class ReplyEta:
+    """
+    ⏳ 说完到第一条下行音频的指数平均（进程内所有会话共用：慢的时候一般是豆包那边整体慢）
+    """
+
+    def __init__(self, alpha: float):
+        self.alpha = alpha
+        self.ms: Optional[float] = None
+
+    def observe(self, ms: int):
+        self.ms = ms if self.ms is None else self.ms + self.alpha * (ms - self.ms)
+
+    def estimate(self) -> int:
+        return round(self.ms) if self.ms is not None else 0
+
+
+reply_eta = ReplyEta(RELAY_REPLY_ETA_ALPHA)
+
+
+def esp32_json(msg: Dict[str, Any]) -> str:
+    """
+    序列化发给ESP32的文本消息
+
+    ESP32没有JSON解析器，按 "type":"xxx" 这样的子串匹配消息，必须用紧凑格式（冒号后不带空格）
+    """
+    return json.dumps(msg, ensure_ascii=False, separators=(",", ":"))
+
+# 📦 二进制控制帧，布局和类型值必须和main/control_protocol.h一致（小端）：
+# magic(u8) type(u8) seq(u16) t_ms(u32) len(u16) flags(u16) + payload[len]
+CTRL_MAGIC = 0xC7
+CTRL_HEADER = struct.Struct("<BBHIHH")
+CTRL_READY = 1
+CTRL_TTS_END = 2
+CTRL_CREDIT = 3
+CTRL_PING = 4
+CTRL_PONG = 5
+CTRL_INTERRUPT = 6
+CTRL_INTERRUPT_ACK = 7
+CTRL_STATS = 8
+CTRL_CAPTURE = 9
+CTRL_SCHED_TRACE = 10
+CTRL_FLIGHT_RECORD = 11
+CTRL_TYPE_NAMES = {
+    CTRL_READY: "ready", CTRL_TTS_END: "tts_end", CTRL_CREDIT: "credit", CTRL_PING: "ping",
+    CTRL_PONG: "pong", CTRL_INTERRUPT: "interrupt", CTRL_INTERRUPT_ACK: "interrupt_ack", CTRL_STATS: "stats",
+    CTRL_CAPTURE: "capture", CTRL_SCHED_TRACE: "sched_trace", CTRL_FLIGHT_RECORD: "flight_record",
+}
+CTRL_CREDIT_PAYLOAD = struct.Struct("<II")      # 已收到字节数、抖动缓冲区剩余字节数
+CTRL_PONG_PAYLOAD = struct.Struct("<HHI")       # 原样带回ping的seq和t_ms
+# STATS负载是u32数组，顺序见PerfCounters::formatBinary（计数器名和main/perf_counters.cc一致）
+STATS_FIELDS = [
+    "uptime_s",
+    "cap", "cap_ovr", "up_frames", "up_pool_drop", "up_queue_drop", "up_msgs", "up_bytes",
+    "down_bytes", "underruns", "jb_drop", "i2s_writes", "i2s_us",
+    "local_hits", "local_misses", "comfort", "down_lost", "down_late", "plc", "stretch",
+    "tls_full", "tls_full_ms", "tls_resumed", "tls_resumed_ms",
+    "follow_ups", "session_timeouts", "up_replay", "up_backlog_drop",
+    "server_busy", "ws_full", "ws_stale", "drift_ins", "drift_del",
+    "i2s_partial", "i2s_preload", "prompt_flash", "wake_rejects",
+    "i2s_le5ms", "i2s_le25ms", "i2s_le100ms", "i2s_slow", "i2s_stalls", "i2s_lock_to",
+    "i2s_dma_under",
+    "wake_gated", "wake_lost", "warm_restarts", "cap_gap", "cap_ring_drop", "duplex_muted",
+    "up_rate_down", "up_rate_up", "flash_ops", "flash_us", "flash_live", "flash_deferred",
+    "udp_up", "udp_down", "udp_down_lost", "udp_fec", "udp_fallback", "relay_failover",
+    "reply_waits", "thinking", "play_direct", "play_mixed", "rtf_down", "rtf_up",
+    "upload_bytes", "upload_deferred", "log_deferred", "log_drop",
+    "send_q_max", "jb_max", "i2s_max_us", "ws_q_max", "ws_wait_max", "amp_wake_max_us", "drain_max_us",
+    "abort_max_us", "afe_backlog_max", "afe_cb_max_us", "flash_max_us", "rtf_max",
+    "heap_min", "heap_free", "psram_min",
+    "heap_largest", "heap_largest_min", "psram_free", "psram_largest", "allocs_s", "psram_allocs_s", "alloc_fail",
+    "late_allocs",
+]
+
+
+def scope_timer_summary(msg: Dict[str, Any]) -> Dict[str, Any]:
+    """
+    ⏱️ 设备作用域计时直方图（main/scope_timer.h，log2分桶的CPU周期数）→ 每个计时点的次数和p50/p99（微秒）
+
+    分位数取所在桶的上限；落在最后一个桶（超出范围）时取它的下限，slow是最后一个桶的次数
+    """
+    mhz = msg.get("mhz") or 240
+    shift = msg.get("shift", 8)
+    summary = {}
+    for site, counts in msg.items():
+        if not isinstance(counts, list) or not counts or not sum(counts):
+            continue
+        total = sum(counts)
+        last = len(counts) - 1
+
+        def percentile_us(p: float) -> float:
+            acc = 0
+            for k, count in enumerate(counts):
+                acc += count
+                if acc * 100 >= total * p:
+                    return round(2 ** (k + shift + (0 if k == last else 1)) / mhz, 1)
+            return round(2 ** (last + shift) / mhz, 1)
+
+        summary[site] = {"n": total, "p50_us": percentile_us(50), "p99_us": percentile_us(99), "slow": counts[last]}
+    return summary
+
+
+def ctrl_frame(msg_type: int, seq: int, payload: bytes = b"") -> bytes:
+    """组一条发给ESP32的二进制控制帧"""
+    t_ms = int(time.monotonic() * 1000) & 0xFFFFFFFF
+    return CTRL_HEADER.pack(CTRL_MAGIC, msg_type, seq & 0xFFFF, t_ms, len(payload), 0) + payload
+
+
+def decode_control(data: bytes) -> Optional[Dict[str, Any]]:
+    """
+    把ESP32发来的二进制控制帧转成和JSON文本一样的消息字典，后面按同一套逻辑处理
+
+    不是控制帧（上行音频）时返回None：magic、类型和长度三项都对上才算
+    """
+    if len(data) < CTRL_HEADER.size or data[0] != CTRL_MAGIC:
+        return None
+    _, msg_type, seq, t_ms, length, _ = CTRL_HEADER.unpack_from(data)
+    if msg_type not in CTRL_TYPE_NAMES or CTRL_HEADER.size + length != len(data):
+        return None
+    payload = data[CTRL_HEADER.size:]
+    msg = {"type": CTRL_TYPE_NAMES[msg_type]}
+    if msg_type == CTRL_PING:
+        msg.update(seq=seq, t=t_ms)
+    elif msg_type == CTRL_CREDIT and length >= CTRL_CREDIT_PAYLOAD.size:
+        msg["recv"], msg["free"] = CTRL_CREDIT_PAYLOAD.unpack_from(payload)
+    elif msg_type == CTRL_STATS:
+        values = struct.unpack_from(f"<{length // 4}I", payload)
+        names = STATS_FIELDS + [f"v{i}" for i in range(len(STATS_FIELDS), len(values))]
+        msg.update(zip(names, values))
+    elif msg_type in (CTRL_CAPTURE, CTRL_SCHED_TRACE, CTRL_FLIGHT_RECORD):
+        msg["payload"] = payload
+    return msg
+
+
+# 🧾 音频帧头，布局和编码值必须和main/audio_framing.h一致（小端）：
+# magic(u8)=0xA5 codec(u8) seq(u16) timestamp(u32) samples(u16) flags(u16) + payload
+# timestamp和samples都按16kHz样本计，上行从录音开始、下行从每段回复开始
+AUDIO_MAGIC = 0xA5
+AUDIO_HEADER = struct.Struct("<BBHIHH")
+AUDIO_FLAG_START = 0x0001           # 新的一段流，接收端重新同步
+AUDIO_FLAG_DISCONTINUITY = 0x0002   # 发送端在这条消息之前丢过数据
+AUDIO_FLAG_END = 0x0004             # 这段流的最后一条消息（负载可以为空）
+AUDIO_CODECS = {"pcm": 0, "opus": 1, "adpcm": 2, "f32_24k": 3}
+UPLINK_GAP_FILL_MAX_SAMPLES = ESP32_SAMPLE_RATE * 200 // 1000   # 上行缺口最多补200ms静音
+
+
+class FrameTracker:
+    """
+    🧾 接收端的序号检查，逻辑和main/audio_framing.h的AudioFraming::Tracker一样
+
+    accept()返回(结论, 缺的样本数)：seq跳了或时间戳跳了是GAP，seq倒退是LATE（迟到或重复，应丢弃）
+    """
+    IN_ORDER, GAP, LATE = range(3)
+
+    def __init__(self):
+        self.messages = 0
+        self.lost_messages = 0
+        self.lost_samples = 0
+        self.late_messages = 0
+        self.sender_drops = 0
+        self.next_seq = 0
+        self.next_timestamp = 0
+        self.synced = False
+
+    def accept(self, seq: int, timestamp: int, samples: int, flags: int):
+        self.messages += 1
+        if flags & AUDIO_FLAG_DISCONTINUITY:
+            self.sender_drops += 1
+        verdict, missing = self.IN_ORDER, 0
+        if self.synced and not flags & AUDIO_FLAG_START:
+            seq_delta = ((seq - self.next_seq + 0x8000) & 0xFFFF) - 0x8000
+            if seq_delta < 0:
+                self.late_messages += 1
+                return self.LATE, 0
+            ts_delta = ((timestamp - self.next_timestamp + 0x80000000) & 0xFFFFFFFF) - 0x80000000
+            if seq_delta > 0:
+                self.lost_messages += seq_delta
+                self.lost_samples += max(ts_delta, 0)
+            # seq连续但时间戳跳了：发送端丢过数据
+            if ts_delta > 0:
+                verdict, missing = self.GAP, ts_delta
+        self.next_seq = (seq + 1) & 0xFFFF
+        self.next_timestamp = (timestamp + samples) & 0xFFFFFFFF
+        self.synced = True
+        return verdict, missing
+
+    def summary(self) -> str:
+        return (f"{self.messages}条, 丢失{self.lost_messages}条({self.lost_samples}样本), "
+                f"迟到{self.late_messages}条, 发送端丢帧{self.sender_drops}次")
+
+
+# 🎙️ 录制文件（小端），记录类型和main/session_capture.h的SessionCapture::Kind一致：
+# 文件头 magic"VCAP" version(u8) reserved(u8) sample_rate(u16) start_unix_us(u64)
+# 记录   t_us(u64) kind(u8) flags(u8) reserved(u16) len(u32) + data[len]
+# 服务器记录的t_us从文件开始计时，数据是线上原样的消息；带CAP_FLAG_DEVICE的记录来自ESP32，
+# t_us是设备的esp_timer时间，数据只有u32的消息长度
+CAPTURE_MAGIC = b"VCAP"
+CAPTURE_VERSION = 1
+CAPTURE_FILE_HEADER = struct.Struct("<4sBBHQ")
+CAPTURE_RECORD = struct.Struct("<QBBHI")
+CAP_UPLINK_AUDIO = 1
+CAP_DOWNLINK_AUDIO = 2
+CAP_UPLINK_CONTROL = 3
+CAP_DOWNLINK_CONTROL = 4
+CAP_SESSION = 5
+CAP_FLAG_BINARY = 0x01      # 控制消息是二进制控制帧（否则是JSON文本）
+CAP_FLAG_DEVICE = 0x02      # 设备端时间戳
+CAP_FLAG_OPUS = 0x04        # 上行音频是Opus
+CAP_FLAG_ADPCM = 0x08       # 下行音频是IMA-ADPCM
+CAP_FLAG_F32 = 0x10         # 下行音频是豆包原始的24kHz float32
+CAP_FLAG_FRAMED = 0x20      # 音频消息以AUDIO_HEADER开头
+CAPTURE_BATCH_HEADER = struct.Struct("<QI")     # 设备CAPTURE帧：base_us、累计丢弃的事件数
+CAPTURE_BATCH_EVENT = struct.Struct("<II")      # dt_us、kind << 28 | len
+
+
+class SessionRecorder:
+    """
+    🎙️ 把一个连接的上下行消息写进录制文件
+
+    写文件是带缓冲的同步写，每条音频消息只有一次write，不会明显拖慢转发；
+    文件句柄在连接结束时关闭，异常退出时最多丢掉缓冲区里的最后一段。
+    """
+
+    def __init__(self, path: str):
+        self.path = path
+        self.file = open(path, "wb", buffering=64 * 1024)
+        self.file.write(CAPTURE_FILE_HEADER.pack(CAPTURE_MAGIC, CAPTURE_VERSION, 0, ESP32_SAMPLE_RATE,
+                                                 int(time.time() * 1_000_000)))
+        self.t0 = time.monotonic()
+        self.records = 0
+        self.device_events = 0
+        self.device_dropped = 0
+
+    @classmethod
+    def open(cls, directory: str, session_id: str) -> Optional["SessionRecorder"]:
+        try:
+            os.makedirs(directory, exist_ok=True)
+            name = f"{time.strftime('%Y%m%d-%H%M%S')}-{session_id[:8]}.vcap"
+            return cls(os.path.join(directory, name))
+        except OSError as e:
+            logger.warning(f"⚠️ 无法创建录制文件: {e}")
+            return None
+
+    def record(self, kind: int, data, flags: int = 0, t_us: Optional[int] = None):
+        if isinstance(data, str):
+            data = data.encode("utf-8")
+        if t_us is None:
+            t_us = int((time.monotonic() - self.t0) * 1_000_000)
+        self.file.write(CAPTURE_RECORD.pack(t_us, kind, flags, 0, len(data)))
+        self.file.write(data)
+        self.records += 1
+
+    def device_batch(self, payload: bytes):
+        """ESP32的CAPTURE控制帧：展开成设备时间的记录"""
+        if len(payload) < CAPTURE_BATCH_HEADER.size:
+            return
+        base_us, dropped = CAPTURE_BATCH_HEADER.unpack_from(payload)
+        if dropped > self.device_dropped:
+            logger.warning(f"⚠️ ESP32录制积压，丢弃了 {dropped - self.device_dropped} 条设备端时间戳")
+            self.device_dropped = dropped
+        for dt_us, kind_len in CAPTURE_BATCH_EVENT.iter_unpack(payload[CAPTURE_BATCH_HEADER.size:]):
+            self.record(kind_len >> 28, struct.pack("<I", kind_len & 0x0FFFFFFF), CAP_FLAG_DEVICE, base_us + dt_us)
+            self.device_events += 1
+
+    def close(self):
+        self.file.close()
+        logger.info(f"🎙️ 会话录制已保存: {self.path}（{self.records}条记录，其中设备端{self.device_events}条）")
+
+
+# 豆包帧样本文件：[4s魔数][u8版本][3字节保留]，之后每帧[u32小端长度][帧]
+UPSTREAM_FIXTURE_MAGIC = b"DBFX"
+UPSTREAM_FIXTURE_VERSION = 1
+UPSTREAM_FIXTURE_HEADER = struct.Struct("<4sB3x")
+UPSTREAM_FIXTURE_RECORD = struct.Struct("<I")
+
+
+class UpstreamFixtureRecorder:
+    """
+    🧪 把豆包原始帧写进样本文件（RELAY_UPSTREAM_FIXTURE），所有上游连接共用，写满limit帧后关闭
+    """
+
+    def __init__(self, path: str, limit: int):
+        self.path = path
+        self.limit = limit
+        self.frames = 0
+        self.file = None
+
+    def record(self, data):
+        if self.frames >= self.limit or isinstance(data, str):
+            return
+        try:
+            if self.file is None:
+                # 第一帧到达时才打开：worker是fork出来的，这时的pid才是自己的
+                if RELAY_WORKERS > 1:
+                    self.path = f"{self.path}.{os.getpid()}"
+                self.file = open(self.path, "wb", buffering=64 * 1024)
+                self.file.write(UPSTREAM_FIXTURE_HEADER.pack(UPSTREAM_FIXTURE_MAGIC, UPSTREAM_FIXTURE_VERSION))
+            self.file.write(UPSTREAM_FIXTURE_RECORD.pack(len(data)))
+            self.file.write(data)
+        except OSError as e:
+            logger.warning(f"⚠️ 无法写入豆包帧样本: {e}")
+            self.frames = self.limit
+            return
+        self.frames += 1
+        if self.frames >= self.limit:
+            self.file.close()
+            logger.info(f"🧪 豆包帧样本已保存: {self.path}（{self.frames}帧）")
+
+
+upstream_fixture = UpstreamFixtureRecorder(RELAY_UPSTREAM_FIXTURE, RELAY_UPSTREAM_FIXTURE_FRAMES) \
+    if RELAY_UPSTREAM_FIXTURE else None
+
+
+def _ogg_crc_table():
+    table = []
+    for i in range(256):
+        crc = i << 24
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x04C11DB7) if crc & 0x80000000 else crc << 1
+        table.append(crc & 0xFFFFFFFF)
+    return table
+
+
+OGG_CRC_TABLE = _ogg_crc_table()
+OGG_PAGE_HEADER = struct.Struct("<4sBBqIII")    # capture_pattern version header_type granule serial seq crc
+
+
+class OggOpusSegment:
+    """
+    🗄️ 一段16kHz单声道PCM压成Ogg/Opus（RFC 7845）：20ms一个包，攒满ARCHIVE_PAGE_PACKETS个包写一页
+
+    只在归档线程里使用
+    """
+
+    FRAME_SAMPLES = ESP32_SAMPLE_RATE // 50
+    SUFFIX = ".opus"
+
+    def __init__(self, path: str):
+        self.file = open(path, "wb")
+        self.encoder = opuslib.Encoder(ESP32_SAMPLE_RATE, 1, opuslib.APPLICATION_VOIP)
+        self.encoder.bitrate = RELAY_ARCHIVE_BITRATE
+        self.serial = zlib.crc32(path.encode("utf-8"))
+        self.page_seq = 0
+        self.granule = 0            # Ogg/Opus的粒度位置固定按48kHz计
+        self.pending = bytearray()  # 不够一个20ms包的PCM
+        self.packets = []
+        self.bytes = 0
+        head = b"OpusHead" + struct.pack("<BBHIhB", 1, 1, 312, ESP32_SAMPLE_RATE, 0, 0)
+        vendor = b"esp32-relay"
+        tags = b"OpusTags" + struct.pack("<I", len(vendor)) + vendor + struct.pack("<I", 0)
+        self._page([head], 0x02)
+        self._page([tags], 0)
+
+    def _page(self, packets, header_type: int):
+        lacing = bytearray()
+        for packet in packets:
+            lacing += b"\xff" * (len(packet) // 255) + bytes((len(packet) % 255,))
+        body = b"".join(packets)
+        header = OGG_PAGE_HEADER.pack(b"OggS", 0, header_type, self.granule, self.serial, self.page_seq, 0)
+        page = bytearray(header + bytes((len(lacing),)) + lacing + body)
+        crc = 0
+        for byte in page:
+            crc = ((crc << 8) & 0xFFFFFFFF) ^ OGG_CRC_TABLE[(crc >> 24) ^ byte]
+        struct.pack_into("<I", page, 22, crc)
+        self.file.write(page)
+        self.bytes += len(page)
+        self.page_seq += 1
+
+    def write(self, pcm: bytes):
+        self.pending += pcm
+        frame_bytes = self.FRAME_SAMPLES * 2
+        offset = 0
+        while len(self.pending) - offset >= frame_bytes:
+            self.packets.append(self.encoder.encode(bytes(self.pending[offset:offset + frame_bytes]),
+                                                    self.FRAME_SAMPLES))
+            self.granule += self.FRAME_SAMPLES * 3
+            offset += frame_bytes
+            if len(self.packets) >= ARCHIVE_PAGE_PACKETS:
+                self._page(self.packets, 0)
+                self.packets = []
+        del self.pending[:offset]
+
+    def close(self):
+        if self.pending:
+            self.write(bytes(self.FRAME_SAMPLES * 2 - len(self.pending)))
+        self._page(self.packets, 0x04)
+        self.file.close()
+
+
+class GzipPcmSegment:
+    """🗄️ 没有opuslib时的归档格式：16kHz s16le PCM直接gzip（压缩率差得多，但不缺依赖）"""
+
+    SUFFIX = ".pcm.gz"
+
+    def __init__(self, path: str):
+        self.file = gzip.open(path, "wb", compresslevel=3)
+        self.pending = []
+        self.pending_bytes = 0
+        self.bytes = 0
+
+    def write(self, pcm: bytes):
+        self.pending.append(pcm)
+        self.pending_bytes += len(pcm)
+        if self.pending_bytes >= ESP32_SAMPLE_RATE * 2:     # 攒够1秒写一次
+            self._flush()
+
+    def _flush(self):
+        self.file.write(b"".join(self.pending))
+        self.bytes += self.pending_bytes
+        self.pending = []
+        self.pending_bytes = 0
+
+    def close(self):
+        self._flush()
+        self.file.close()
+
+
+class AudioArchiver:
+    """
+    🗄️ 每轮对话的上行/TTS音频归档，压缩和写盘都在一个后台线程里
+
+    submit()只在事件循环里调用：数据放进队列就返回，不做任何IO；队列里积压的字节超过上限时直接丢掉这一块，
+    并在这段结束时打日志说明丢了多少（质检时知道这段不完整）。线程在第一次提交时才创建，多进程模式下fork之前不会有线程。
+    """
+
+    def __init__(self, directory: str, max_bytes: int):
+        self.directory = directory
+        self.max_bytes = max_bytes
+        self.queue = queue.SimpleQueue()
+        self.queued_bytes = 0           # 事件循环加、归档线程减，都在lock下
+        self.lock = threading.Lock()
+        self.thread = None
+        self.dropped = {}               # 段名 -> 丢掉的字节数（事件循环写，结束标记带给归档线程）
+
+    @property
+    def enabled(self) -> bool:
+        return bool(self.directory)
+
+    def submit(self, name: str, pcm):
+        if not pcm:
+            return
+        with self.lock:
+            if self.queued_bytes + len(pcm) > self.max_bytes:
+                self.dropped[name] = self.dropped.get(name, 0) + len(pcm)
+                METRIC_ARCHIVE.inc(len(pcm), result="dropped")
+                return
+            self.queued_bytes += len(pcm)
+        self._ensure_thread()
+        self.queue.put((name, bytes(pcm)))
+
+    def finish(self, name: str):
+        """这一段结束，归档线程写完剩余数据后关闭文件"""
+        if self.thread is None:
+            return
+        self.queue.put((name, self.dropped.pop(name, 0)))
+
+    def close(self):
+        if self.thread is not None:
+            self.queue.put(None)
+            self.thread.join(timeout=10)
+
+    def _ensure_thread(self):
+        if self.thread is None:
+            self.thread = threading.Thread(target=self._run, name="relay-archive", daemon=True)
+            self.thread.start()
+
+    def _open(self, name: str):
+        segment_type = OggOpusSegment if HAS_OPUS else GzipPcmSegment
+        directory = os.path.join(self.directory, time.strftime("%Y%m%d"))
+        os.makedirs(directory, exist_ok=True)
+        return segment_type(os.path.join(directory, f"{time.strftime('%H%M%S')}-{name}{segment_type.SUFFIX}"))
+
+    def _close(self, name: str, segment, dropped: int):
+        try:
+            segment.close()
+        except Exception as e:
+            logger.warning(f"⚠️ 归档 {name} 收尾失败: {e}")
+            return
+        METRIC_ARCHIVE.inc(segment.bytes, result="written")
+        if dropped:
+            logger.warning(f"🗄️ 归档 {name} 不完整：队列积压丢掉了 {dropped} 字节PCM")
+
+    def _run(self):
+        segments = {}       # 段名 -> [segment, 最后写入时间]
+        failed = set()      # 打不开文件的段，之后的数据直接扔掉
+        while True:
+            try:
+                item = self.queue.get(timeout=ARCHIVE_IDLE_S / 3)
+            except queue.Empty:
+                item = ()
+            if item is None:
+                break
+            now = time.monotonic()
+            if item:
+                name, data = item
+                entry = segments.get(name)
+                if isinstance(data, int):
+                    if entry is not None:
+                        self._close(name, entry[0], data)
+                        del segments[name]
+                    failed.discard(name)
+                    continue
+                with self.lock:
+                    self.queued_bytes -= len(data)
+                if name in failed:
+                    continue
+                try:
+                    if entry is None:
+                        entry = segments[name] = [self._open(name), now]
+                    entry[0].write(data)
+                    entry[1] = now
+                except Exception as e:
+                    logger.warning(f"⚠️ 归档 {name} 写入失败，这一段不再归档: {e}")
+                    failed.add(name)
+                    segments.pop(name, None)
+            for name in [n for n, (_, last) in segments.items() if now - last >= ARCHIVE_IDLE_S]:
+                self._close(name, segments.pop(name)[0], 0)
+        for name, (segment, _) in segments.items():
+            self._close(name, segment, 0)
+
+
+audio_archiver = AudioArchiver(RELAY_ARCHIVE_DIR, RELAY_ARCHIVE_QUEUE_BYTES)
+
+
+class TurnCostJoiner:
+    """
+    💰 按会话ID合并设备和中继两侧的每轮账单
+
+    中继在发tts_end时记下自己这一轮，设备收到tts_end后才发它的，同一会话里两侧的顺序一致：
+    设备的账单配给这个会话最早一条还在等的中继账单（设备和中继的轮次编号不一定对得上，导出时各自保留）。
+    中继账单最多等RELAY_COST_JOIN_S（旧固件不发cost、连接断开），超时后只导出中继这一侧
+    """
+
+    def __init__(self, path: str, wait_s: float):
+        self.path = path
+        self.wait_s = wait_s
+        self.pending = {}   # session -> deque[(截止时间, 轮次, 中继账单)]
+
+    def relay(self, session: str, turn: int, cost: Dict[str, Any]):
+        now = time.monotonic()
+        self.expire(now)
+        self.pending.setdefault(session, deque()).append((now + self.wait_s, turn, cost))
+
+    def device(self, session: str, cost: Dict[str, Any]):
+        self.expire(time.monotonic())
+        waiting = self.pending.get(session)
+        if not waiting:
+            self.export(session, cost.get("turn", 0), {"device": cost})
+            return
+        _, turn, relay_cost = waiting.popleft()
+        if not waiting:
+            del self.pending[session]
+        self.export(session, turn, {"device": cost, "relay": relay_cost})
+
+    def expire(self, now: float):
+        for session in list(self.pending):
+            waiting = self.pending[session]
+            while waiting and waiting[0][0] <= now:
+                _, turn, relay_cost = waiting.popleft()
+                self.export(session, turn, {"relay": relay_cost})
+            if not waiting:
+                del self.pending[session]
+
+    def export(self, session: str, turn: int, sides: Dict[str, Any]):
+        result = "joined" if len(sides) == 2 else f"{next(iter(sides))}_only"
+        METRIC_TURN_COST.inc(result=result)
+        line = json.dumps({"session": session, "turn": turn, **sides}, ensure_ascii=False)
+        logger.info("💰 COST " + line)
+        if not self.path:
+            return
+        try:
+            with open(self.path, "a", encoding="utf-8") as f:
+                f.write(line + "\n")
+        except OSError as e:
+            logger.warning(f"⚠️ 无法写入资源账单: {e}")
+
+
+turn_costs = TurnCostJoiner(RELAY_COST_LOG, RELAY_COST_JOIN_S)
+
+
+# 🔥 浸泡测试的回复音调：220Hz按4Hz调幅（像一个个音节），250ms正好是整数个周期，按格式各算一次循环拼接
+_soak_cycles: Dict[bool, bytes] = {}
+
+
+def soak_tone(ms: int, passthrough: bool) -> bytes:
+    """
+    🔥 ms毫秒的合成回复：16kHz int16，透传下行时24kHz float32
+    """
+    cycle = _soak_cycles.get(passthrough)
+    if cycle is None:
+        rate = 24000 if passthrough else ESP32_SAMPLE_RATE
+        samples = [0.3 * math.sin(2 * math.pi * 220 * n / rate) * (0.5 - 0.5 * math.cos(2 * math.pi * 4 * n / rate))
+                   for n in range(rate // 4)]
+        if passthrough:
+            cycle = array.array("f", samples).tobytes()
+        else:
+            cycle = array.array("h", (int(v * 32767) for v in samples)).tobytes()
+        _soak_cycles[passthrough] = cycle
+    size = ms * len(cycle) // 250
+    size -= size % (4 if passthrough else 2)
+    return (cycle * (size // len(cycle) + 1))[:size]
+
+
+def soak_verdict(report: Dict[str, Any]) -> list:
+    """
+    🔥 按门槛检查一份浸泡报告，返回没通过的项（空=通过）
+    """
+    hours = max(float(report.get("uptime_s") or 0) / 3600, 1 / 60)
+    failed = []
+    if int(report.get("p95_ms") or 0) > RELAY_SOAK_MAX_P95_MS:
+        failed.append(f"p95 {report.get('p95_ms')}ms > {RELAY_SOAK_MAX_P95_MS}ms")
+    underruns = int(report.get("underruns") or 0)
+    if underruns / hours > RELAY_SOAK_MAX_UNDERRUNS_PER_H:
+        failed.append(f"欠载 {underruns / hours:.1f}/h > {RELAY_SOAK_MAX_UNDERRUNS_PER_H:g}/h")
+    drops = int(report.get("ws_drops") or 0) + int(report.get("uplink_drops") or 0)
+    if drops / hours > RELAY_SOAK_MAX_DROPS_PER_H:
+        failed.append(f"丢弃 {drops / hours:.1f}/h > {RELAY_SOAK_MAX_DROPS_PER_H:g}/h")
+    if int(report.get("frag_max_pct") or 0) > RELAY_SOAK_MAX_FRAG_PCT:
+        failed.append(f"碎片 {report.get('frag_max_pct')}% > {RELAY_SOAK_MAX_FRAG_PCT}%")
+    leak = int(report.get("heap_start") or 0) - int(report.get("heap_free") or 0)
+    if leak > RELAY_SOAK_MAX_HEAP_LEAK:
+        failed.append(f"内部RAM少了 {leak}字节 > {RELAY_SOAK_MAX_HEAP_LEAK}")
+    return failed
+
+
+# 🔬 设备SCHED_TRACE帧，布局和main/sched_trace.h一致
+SCHED_BATCH_HEADER = struct.Struct("<QII")      # base_us、累计丢弃的事件数、flags（bit0=窗口内最后一批）
+SCHED_BATCH_EVENT = struct.Struct("<IBBBBI")    # dt_us、marker、phase | 核心 << 7、任务下标、0、arg
+SCHED_MARKERS = ["capture", "afe_feed", "afe_fetch", "uplink_push", "uplink_pop",
+                 "ws_enqueue", "ws_send", "ws_recv", "i2s_write"]       # 和main/sched_trace.cc的kMarkerNames一致
+SCHED_TASK_ISR = 0xFF
+
+
+class SchedTraceWriter:
+    """
+    🔬 收集一台设备一个窗口的调度追踪，收到最后一批时写成Chrome trace
+
+    每个任务一条轨道（tid=设备任务表下标），开始/结束标记成对显示为一段，单点标记显示为瞬时事件；
+    事件参数里带核心号和arg，同一核心上的两段重叠就是抢占。
+    """
+
+    def __init__(self, directory: str, device: str):
+        self.directory = directory
+        self.device = device
+        self.tasks = []
+        self.events = []
+        self.dropped = 0
+
+    def set_tasks(self, names):
+        self.tasks = [str(name) for name in names]
+
+    def batch(self, payload: bytes) -> Optional[str]:
+        """追加一批事件；窗口结束时写文件并返回路径"""
+        if len(payload) < SCHED_BATCH_HEADER.size:
+            return None
+        base_us, dropped, flags = SCHED_BATCH_HEADER.unpack_from(payload)
+        self.dropped = dropped
+        body = payload[SCHED_BATCH_HEADER.size:]
+        body = body[:len(body) - len(body) % SCHED_BATCH_EVENT.size]
+        for dt_us, marker, phase, task, _, arg in SCHED_BATCH_EVENT.iter_unpack(body):
+            self.events.append((base_us + dt_us, marker, phase & 0x03, phase >> 7, task, arg))
+        return self.write() if flags & 1 else None
+
+    def write(self) -> Optional[str]:
+        trace = [{"name": "process_name", "ph": "M", "pid": 1, "args": {"name": self.device}}]
+        for tid, name in enumerate(self.tasks + ["?"]):
+            trace.append({"name": "thread_name", "ph": "M", "pid": 1, "tid": tid, "args": {"name": name}})
+        trace.append({"name": "thread_name", "ph": "M", "pid": 1, "tid": SCHED_TASK_ISR, "args": {"name": "isr"}})
+        for t_us, marker, phase, core, task, arg in self.events:
+            name = SCHED_MARKERS[marker] if marker < len(SCHED_MARKERS) else f"m{marker}"
+            event = {"name": name, "ph": "iBE"[phase] if phase < 3 else "i", "ts": t_us, "pid": 1, "tid": task,
+                     "args": {"core": core, "arg": arg}}
+            if event["ph"] == "i":
+                event["s"] = "t"
+            trace.append(event)
+        self.events = []
+        try:
+            os.makedirs(self.directory, exist_ok=True)
+            safe_name = "".join(c if c.isalnum() else "_" for c in self.device)
+            path = os.path.join(self.directory, f"{time.strftime('%Y%m%d-%H%M%S')}-{safe_name}.trace.json")
+            with open(path, "w", encoding="utf-8") as f:
+                json.dump({"traceEvents": trace, "displayTimeUnit": "ms"}, f)
+        except OSError as e:
+            logger.warning(f"⚠️ 无法写入调度追踪: {e}")
+            return None
+        if self.dropped:
+            logger.warning(f"⚠️ {self.device} 调度追踪积压，丢弃了 {self.dropped} 个事件")
+        return path
+
+
+# 🛩️ 设备FLIGHT_RECORD帧，布局和main/flight_recorder.h一致
+FLIGHT_BATCH_HEADER = struct.Struct("<BBHHH")   # 复位原因、flags（bit0=最后一批）、事件总数、这批第一条的序号、0
+FLIGHT_EVENT = struct.Struct("<IBBH")           # t_us、event、aux（bit7=核心）、arg
+FLIGHT_EVENTS = ["boot", "tick", "capture_overrun", "capture_gap", "uplink_pool_drop", "uplink_queue_drop",
+                 "ws_connect", "ws_disconnect", "ws_stale_drop", "i2s_stall", "i2s_lock_timeout", "i2s_dma_underrun",
+                 "jitter_underrun", "watchdog", "session_start", "session_end", "restart", "flash_stall",
+                 "udp_fallback"]  # 和FlightEvent一致
+FLIGHT_RESET_REASONS = {3: "sw", 4: "panic", 5: "int_wdt", 6: "task_wdt", 7: "wdt", 9: "brownout"}  # esp_reset_reason_t
+FLIGHT_SUMMARY_LAST = 8         # 汇总日志里列出复位前最后这么多个事件
+
+
+class FlightRecordCollector:
+    """
+    🛩️ 拼起一台设备分批上传的黑匣子记录，最后一批到了就换算时间、写文件
+
+    设备的时间戳是启动后的微秒（u32回绕），按环形数组里的顺序以最后一条为基准往前换算成"复位前多少毫秒"，
+    比最后一条还新的（两个核心同时追加时RTC里的位置落后了一条）换算成负数，排序后回到正确的位置。
+    """
+
+    def __init__(self, directory: str, device: str):
+        self.directory = directory
+        self.device = device
+        self.events = []
+
+    def batch(self, payload: bytes) -> Optional[Dict[str, Any]]:
+        """追加一批事件；整份记录收齐时返回汇总"""
+        if len(payload) < FLIGHT_BATCH_HEADER.size:
+            return None
+        reason, flags, total, first, _ = FLIGHT_BATCH_HEADER.unpack_from(payload)
+        if first == 0:
+            self.events = []    # 断线后设备从头重发
+        body = payload[FLIGHT_BATCH_HEADER.size:]
+        body = body[:len(body) - len(body) % FLIGHT_EVENT.size]
+        self.events.extend(FLIGHT_EVENT.iter_unpack(body))
+        if not flags & 1:
+            return None
+        events, self.events = self.events, []
+        if not events:
+            return None
+        last_us = events[-1][0]
+        records = []
+        for t_us, event, aux, arg in events:
+            dt_us = (last_us - t_us) & 0xFFFFFFFF
+            if dt_us >= 1 << 31:
+                dt_us -= 1 << 32
+            records.append({"before_ms": round(dt_us / 1000, 1),
+                            "event": FLIGHT_EVENTS[event] if event < len(FLIGHT_EVENTS) else f"e{event}",
+                            "core": aux >> 7, "aux": aux & 0x7F, "arg": arg})
+        records.sort(key=lambda r: -r["before_ms"])
+        counts = {}
+        for record in records:
+            counts[record["event"]] = counts.get(record["event"], 0) + 1
+        summary = {"reason": FLIGHT_RESET_REASONS.get(reason, str(reason)), "events": len(records),
+                   "expected": total, "span_ms": records[0]["before_ms"] - records[-1]["before_ms"],
+                   "counts": counts, "last": records[-FLIGHT_SUMMARY_LAST:]}
+        path = self.write(summary, records)
+        if path:
+            summary["path"] = path
+        return summary
+
+    def write(self, summary: Dict[str, Any], records) -> Optional[str]:
+        if not self.directory:
+            return None
+        try:
+            os.makedirs(self.directory, exist_ok=True)
+            safe_name = "".join(c if c.isalnum() else "_" for c in self.device)
+            path = os.path.join(self.directory, f"{time.strftime('%Y%m%d-%H%M%S')}-{safe_name}.flight.json")
+            with open(path, "w", encoding="utf-8") as f:
+                json.dump({"device": self.device, "reason": summary["reason"], "events": records}, f,
+                          ensure_ascii=False, indent=1)
+        except OSError as e:
+            logger.warning(f"⚠️ 无法写入黑匣子记录: {e}")
+            return None
+        return path
+
+
+# 🛰️ 网络自检的测试消息，布局和main/net_self_test.h一致
+NET_TEST_HEADER = struct.Struct("<BcII")       # magic=0xE7、'N'、seq、发送时的t_ms
+NET_TEST_MAGIC = b"\xe7N"
+NET_TEST_DOWN_KBPS = {"adpcm": 64, "pcm": 256, "f32_24k": 768}     # 各下行编码的码率
+NET_TEST_HEADROOM = 1.5     # 测出来的吞吐至少是音频码率的这么多倍才算够用
+
+
+class NetTestSession:
+    """
+    🛰️ 一台设备的一次ws模式自检：统计上行测试消息，同时按发送队列的余量尽快下发测试消息
+
+    下行和音频一样经过DeviceSender，只把排队控制在一半上限以内，不触发丢弃，测的就是链路本身
+    """
+
+    def __init__(self, sender: "DeviceSender", ms: int, size: int, dscp: Optional[int] = None):
+        self.start = time.monotonic()
+        # 📶 设备按请求换了DSCP时下行也跟着换，测完恢复成RELAY_DSCP
+        self.sock = sender.websocket.transport.get_extra_info("socket") if dscp is not None else None
+        if self.sock is not None and dscp != RELAY_DSCP:
+            set_socket_dscp(self.sock, dscp)
+        else:
+            self.sock = None
+        self.up_bytes = 0
+        self.up_msgs = 0
+        self.up_gaps = 0
+        self.up_last = self.start
+        self.next_seq = 0
+        self.down_sent = 0
+        self.task = asyncio.create_task(self._downlink(sender, ms / 1000, max(size, NET_TEST_HEADER.size)))
+
+    def uplink(self, data: bytes):
+        if len(data) < NET_TEST_HEADER.size:
+            return
+        _, _, seq, _ = NET_TEST_HEADER.unpack_from(data)
+        if seq > self.next_seq:
+            self.up_gaps += seq - self.next_seq
+        self.next_seq = max(self.next_seq, seq + 1)
+        self.up_bytes += len(data)
+        self.up_msgs += 1
+        self.up_last = time.monotonic()
+
+    def up_kbps(self) -> int:
+        elapsed = self.up_last - self.start
+        return int(self.up_bytes * 8 / elapsed / 1000) if elapsed > 0 else 0
+
+    async def _downlink(self, sender: "DeviceSender", duration: float, size: int):
+        filler = bytes(size - NET_TEST_HEADER.size)
+        end = self.start + duration
+        while time.monotonic() < end and not sender.closed:
+            if sender.pending_bytes() < sender.limit // 2:
+                t_ms = int((time.monotonic() - self.start) * 1000)
+                sender.put(NET_TEST_HEADER.pack(0xE7, b"N", self.down_sent, t_ms) + filler, droppable=True)
+                self.down_sent += 1
+                await asyncio.sleep(0)
+            else:
+                await asyncio.sleep(0.005)
+
+    def close(self):
+        self.task.cancel()
+        if self.sock is not None:
+            set_socket_dscp(self.sock, RELAY_DSCP)
+            self.sock = None
+
+
+def set_socket_dscp(sock: Optional[socket.socket], dscp: int) -> bool:
+    """
+    📶 给已连接的socket设置DSCP（TOS/Traffic Class的高6位），不支持时返回False
+    """
+    if sock is None:
+        return False
+    tos = (dscp & 0x3F) << 2
+    try:
+        if sock.family == socket.AF_INET6:
+            sock.setsockopt(socket.IPPROTO_IPV6, socket.IPV6_TCLASS, tos)
+            try:
+                sock.setsockopt(socket.IPPROTO_IP, socket.IP_TOS, tos)     # 双栈socket上的IPv4映射地址
+            except OSError:
+                pass
+        else:
+            sock.setsockopt(socket.IPPROTO_IP, socket.IP_TOS, tos)
+        return True
+    except (OSError, AttributeError) as e:
+        logger.debug(f"📶 设置DSCP {dscp}失败: {e}")
+        return False
+
+
+net_test_tcp_uploads = {}   # 🛰️ 设备IP -> 裸TCP上传测到的kbit/s，等设备的net_test_result来取
+
+
+async def handle_net_test_tcp(reader: asyncio.StreamReader, writer: asyncio.StreamWriter):
+    """
+    🛰️ 网络自检的裸TCP连接，第一个字节是命令：
+    E=8字节回显直到对方关闭，U=计数上传的字节直到对方关闭，D=读u32毫秒数后尽快下发这么久再关闭
+    """
+    peer = writer.get_extra_info("peername")
+    host = peer[0] if peer else "?"
+    if RELAY_DSCP:
+        set_socket_dscp(writer.get_extra_info("socket"), RELAY_DSCP)
+    try:
+        command = await asyncio.wait_for(reader.readexactly(1), timeout=5)
+        if command == b"E":
+            while True:
+                data = await reader.readexactly(8)
+                writer.write(data)
+                await writer.drain()
+        elif command == b"U":
+            total = 0
+            start = time.monotonic()
+            while True:
+                data = await reader.read(65536)
+                if not data:
+                    break
+                total += len(data)
+            elapsed = time.monotonic() - start
+            kbps = int(total * 8 / elapsed / 1000) if elapsed > 0 else 0
+            net_test_tcp_uploads[host] = kbps
+            logger.info(f"🛰️ {host} 裸TCP上传: {total} 字节，{kbps} kbit/s")
+        elif command == b"D":
+            ms, = struct.unpack("<I", await reader.readexactly(4))
+            chunk = bytes(4096)
+            end = time.monotonic() + min(ms, 60000) / 1000
+            while time.monotonic() < end:
+                writer.write(chunk)
+                await writer.drain()
+    except (asyncio.IncompleteReadError, asyncio.TimeoutError, ConnectionError):
+        pass
+    finally:
+        writer.close()
+
+
+def log_net_test_result(msg: Dict[str, Any], client_address, downlink_codec: str,
+                        session: Optional[NetTestSession]):
+    """
+    🛰️ 把设备测的结果和服务器测的上行合在一起，和当前音频需要的码率比较后打一行NETTEST日志
+    """
+    msg.pop("type")
+    if "error" in msg:
+        logger.warning(f"🛰️ {client_address} 网络自检没有运行: {msg['error']}")
+        return
+    if session is not None and msg.get("mode") == "ws":
+        msg["server_up_kbps"] = session.up_kbps()
+        msg["server_up_msgs"] = session.up_msgs
+        msg["server_up_gaps"] = session.up_gaps
+        msg["server_down_sent"] = session.down_sent
+    elif msg.get("mode") == "tcp" and client_address[0] in net_test_tcp_uploads:
+        msg["server_up_kbps"] = net_test_tcp_uploads.pop(client_address[0])
+    msg["need_down_kbps"] = NET_TEST_DOWN_KBPS.get(downlink_codec, 256)
+    up = msg.get("server_up_kbps", msg.get("up_kbps", 0))
+    need_up = msg.get("need_up_kbps") or 0
+    down = msg.get("down_kbps") or 0
+    if msg.get("pongs"):
+        msg["rtt_jitter"] = msg.get("rtt_p90", 0) - msg.get("rtt_p50", 0)   # 📶 对比DSCP标记前后主要看它
+    msg["up_headroom"] = round(up / need_up, 1) if need_up else None
+    msg["down_headroom"] = round(down / msg["need_down_kbps"], 1)
+    msg["verdict"] = "ok" if (up >= need_up * NET_TEST_HEADROOM
+                              and down >= msg["need_down_kbps"] * NET_TEST_HEADROOM) else "insufficient"
+    logger.info("🛰️ NETTEST " + json.dumps(dict(msg, client=str(client_address)), ensure_ascii=False))
+
+
+# 📡 UDP音频数据报，布局和main/udp_audio.h一致（小端）：
+# magic(u8)=0xD7 | kind(u8) | 分片(u8，高4位序号、低4位总数) | 0 | token(u32) | 消息号(u16) | 本段长度(u16) | 载荷
+UDP_MAGIC = 0xD7
+UDP_HEADER = struct.Struct("<BBBBIHH")
+UDP_KIND_AUDIO, UDP_KIND_PING, UDP_KIND_PONG = range(3)
+UDP_MAX_DATAGRAM = 1200         # 一个数据报的最大载荷（和UDP_AUDIO_MAX_DATAGRAM一致）
+UDP_FRAGMENT_BYTES = 1024       # 分片时除最后一片外每片的长度（和UdpAudio::FRAGMENT_BYTES一致）
+UDP_MAX_FRAGMENTS = 15
+UDP_DOWN_HISTORY = 512          # 记住最近这么多条UDP下行消息的长度，设备报告丢了哪条时从下行额度里扣回
+UDP_RESYNC_GAP = 1024           # 序号一下跳这么多说明对端重新开始计数，不算丢失
+UDP_REPORT_MIN_MESSAGES = 10    # 一段报告里期望的条数太少时不算丢失率
+
+
+class UdpSettled(str):
+    """📡 speech_end等过RELAY_UDP_REORDER_MS后重新放回消息流（不再录制，也不再等）"""
+
+
+class UdpSeqCounter:
+    """
+    📡 按帧头序号数期望条数和收到条数（RTCP接收报告的做法），和UdpAudio::deliver()一样，迟到和重复的不交
+    """
+
+    __slots__ = ("synced", "base", "high", "recv", "fec")
+
+    def __init__(self):
+        self.synced = False
+        self.base = 0       # 序号都扩展成不回绕的整数
+        self.high = 0
+        self.recv = 0
+        self.fec = 0
+
+    def accept(self, seq: int) -> Optional[range]:
+        """这条该交出去时返回中间丢掉的序号（扩展后的），迟到或重复时返回None"""
+        if not self.synced:
+            self.synced = True
+            self.base = self.high = seq
+            self.recv += 1
+            return range(0)
+        diff = (seq - self.high) & 0xFFFF
+        if diff == 0 or diff >= 0x8000:
+            return None
+        lost = range(self.high + 1, self.high + diff)
+        if diff > UDP_RESYNC_GAP:
+            self.base += diff
+            lost = range(0)
+        self.high += diff
+        self.recv += 1
+        return lost
+
+    @property
+    def expected(self) -> int:
+        return self.high - self.base + 1 if self.synced else 0
+
+
+class UdpLink:
+    """
+    📡 一个设备连接的UDP音频通道：上行数据报还原成帧头音频消息放进inbox（和WebSocket消息合成一个流处理），
+    下行音频在设备确认两个方向都通之后、从一段回复的开头起改走UDP，按设备的报告在丢失太多时退回WebSocket
+    """
+
+    __slots__ = ("server", "token", "name", "addr", "inbox", "up", "overflow", "reasm", "down_ready", "down_active",
+                 "down_fallback", "down_msg_id", "down_prev", "down_sizes", "down_sent", "report_expected",
+                 "report_recv", "bad_reports", "last_report")
+
+    def __init__(self, server, token: int, name: str):
+        self.server = server
+        self.token = token
+        self.name = name
+        self.addr = None            # 设备最近一个数据报的源地址（NAT重新映射后跟着换）
+        self.inbox = asyncio.Queue()
+        self.up = UdpSeqCounter()
+        self.overflow = 0
+        self.reasm = None           # 正在拼的分片消息：(消息号, 总片数, {序号: 数据})
+        self.down_ready = False     # 设备收到了PONG
+        self.down_active = False
+        self.down_fallback = False
+        self.down_msg_id = 0
+        self.down_prev = b""
+        self.down_sizes = OrderedDict()     # 下行seq(u16) -> 消息长度
+        self.down_sent = 0
+        self.report_expected = 0
+        self.report_recv = 0
+        self.bad_reports = 0
+        self.last_report = 0.0
+
+    def receive(self, fragment: int, msg_id: int, length: int, payload: bytes):
+        count = fragment & 0x0F
+        if count > 1:
+            self._reassemble(fragment >> 4, count, msg_id, payload[:length])
+            return
+        # 副本是上一条消息：先交它（主数据报丢了时正好补上缺口），再交这一条
+        if len(payload) > length:
+            self._deliver(payload[length:], True)
+        self._deliver(payload[:length], False)
+
+    def _reassemble(self, index: int, count: int, msg_id: int, piece: bytes):
+        last = index + 1 == count
+        if index >= count or (not last and len(piece) != UDP_FRAGMENT_BYTES):
+            return
+        if self.reasm is None or self.reasm[0] != msg_id:
+            self.reasm = (msg_id, count, {})    # 上一条没收齐：丢了，序号缺口在交下一条时算
+        self.reasm[2][index] = piece
+        if len(self.reasm[2]) == count:
+            pieces = self.reasm[2]
+            self.reasm = None
+            self._deliver(b"".join(pieces[i] for i in range(count)), False)
+
+    def _deliver(self, message: bytes, redundant: bool):
+        if len(message) < AUDIO_HEADER.size or message[0] != AUDIO_MAGIC:
+            return
+        if self.up.accept(AUDIO_HEADER.unpack_from(message)[2]) is None:
+            return
+        if redundant:
+            self.up.fec += 1
+            METRIC_UDP_MESSAGES.inc(direction="up_fec")
+        if self.inbox.qsize() >= RELAY_UDP_INBOX:
+            self.overflow += 1
+            return
+        METRIC_UDP_MESSAGES.inc(direction="up")
+        self.inbox.put_nowait(message)
+
+    def settle(self, message: str):
+        """过RELAY_UDP_REORDER_MS把控制消息放回流里，排在这段时间到的上行数据报后面"""
+        asyncio.get_running_loop().call_later(RELAY_UDP_REORDER_MS / 1000, self.inbox.put_nowait, UdpSettled(message))
+
+    def route(self, data: bytes, ws_idle: bool) -> bool:
+        """
+        下行音频走UDP时发出去返回True；还没切过来、已经退回或者发不了时返回False，调用方走WebSocket。
+        只在一段回复的第一条（AUDIO_FLAG_START）、WebSocket发送队列也空了的时候切过来，设备那边两条路不会交错
+        """
+        if not self.down_active:
+            if (not self.down_ready or self.down_fallback or self.addr is None or not ws_idle
+                    or len(data) < AUDIO_HEADER.size or data[0] != AUDIO_MAGIC
+                    or not AUDIO_HEADER.unpack_from(data)[5] & AUDIO_FLAG_START):
+                return False
+            self.down_active = True
+            self.last_report = time.monotonic()
+            logger.info(f"📡 {self.name} 下行音频改走UDP {self.addr[0]}:{self.addr[1]}")
+        if len(data) > UDP_FRAGMENT_BYTES * UDP_MAX_FRAGMENTS or self.server.transport is None:
+            return False
+        msg_id = self.down_msg_id
+        self.down_msg_id = (msg_id + 1) & 0xFFFF
+        if len(data) <= UDP_MAX_DATAGRAM:
+            extra = self.down_prev if RELAY_UDP_REDUNDANCY and len(data) + len(self.down_prev) <= UDP_MAX_DATAGRAM else b""
+            self._sendto(UDP_HEADER.pack(UDP_MAGIC, UDP_KIND_AUDIO, 0x01, 0, self.token, msg_id, len(data)) + data + extra)
+            self.down_prev = bytes(data)
+        else:
+            count = (len(data) + UDP_FRAGMENT_BYTES - 1) // UDP_FRAGMENT_BYTES
+            for i in range(count):
+                piece = data[i * UDP_FRAGMENT_BYTES:(i + 1) * UDP_FRAGMENT_BYTES]
+                self._sendto(UDP_HEADER.pack(UDP_MAGIC, UDP_KIND_AUDIO, (i << 4) | count, 0, self.token, msg_id,
+                                             len(piece)) + piece)
+            self.down_prev = b""
+        self.down_sizes[AUDIO_HEADER.unpack_from(data)[2]] = len(data)
+        if len(self.down_sizes) > UDP_DOWN_HISTORY:
+            self.down_sizes.popitem(last=False)
+        self.down_sent += 1
+        METRIC_UDP_MESSAGES.inc(direction="down")
+        return True
+
+    def _sendto(self, datagram: bytes):
+        self.server.transport.sendto(datagram, self.addr)
+        METRIC_BYTES.inc(len(datagram), peer="device", direction="out")
+
+    def on_report(self, msg: Dict[str, Any]) -> Tuple[int, Optional[str]]:
+        """
+        设备的udp_report：返回(丢掉的下行消息字节数, 退回WebSocket的原因或None)
+        """
+        self.last_report = time.monotonic()
+        lost = msg.get("lost") if isinstance(msg.get("lost"), list) else []
+        lost_bytes = sum(self.down_sizes.pop(seq & 0xFFFF, 0) for seq in lost if isinstance(seq, int))
+        try:
+            expected, recv = int(msg.get("expected") or 0), int(msg.get("recv") or 0)
+        except (TypeError, ValueError):
+            return lost_bytes, None
+        window = expected - self.report_expected
+        if not self.down_active or window < UDP_REPORT_MIN_MESSAGES:
+            return lost_bytes, None
+        loss_pct = max(window - (recv - self.report_recv), 0) * 100 // window
+        self.report_expected, self.report_recv = expected, recv
+        self.bad_reports = self.bad_reports + 1 if loss_pct > RELAY_UDP_FALLBACK_LOSS_PCT else 0
+        if self.bad_reports >= RELAY_UDP_FALLBACK_REPORTS:
+            return lost_bytes, f"丢失{loss_pct}%"
+        return lost_bytes, None
+
+    def fall_back(self, reason: str):
+        self.down_active = False
+        self.down_fallback = True
+        METRIC_UDP_FALLBACK.inc(reason="timeout" if reason == "timeout" else "loss")
+        logger.warning(f"📡 {self.name} 下行UDP{'没有报告' if reason == 'timeout' else reason}，这次连接改回WebSocket")
+
+    def report(self) -> Dict[str, Any]:
+        return {"type": "udp_report", "expected": self.up.expected, "recv": self.up.recv}
+
+    def summary(self) -> str:
+        return (f"上行期望{self.up.expected}条、收到{self.up.recv}条（副本补回{self.up.fec}条"
+                f"{f'，处理不过来丢弃{self.overflow}条' if self.overflow else ''}），下行发出{self.down_sent}条"
+                f"{'（已退回WebSocket）' if self.down_fallback else ''}")
+
+
+class UdpAudioServer(asyncio.DatagramProtocol):
+    """
+    📡 UDP音频端口：按token找到连接，PING回PONG，音频数据报交给对应的UdpLink
+    """
+
+    def __init__(self, port: int):
+        self.port = port
+        self.transport = None
+        self.links: Dict[int, UdpLink] = {}
+
+    def connection_made(self, transport):
+        global udp_server
+        self.transport = transport
+        udp_server = self
+        if RELAY_DSCP:
+            set_socket_dscp(transport.get_extra_info("socket"), RELAY_DSCP)
+
+    def open(self, name: str) -> UdpLink:
+        token = random.getrandbits(32)
+        while token == 0 or token in self.links:
+            token = random.getrandbits(32)
+        link = UdpLink(self, token, name)
+        self.links[token] = link
+        return link
+
+    def close(self, link: UdpLink):
+        self.links.pop(link.token, None)
+
+    def datagram_received(self, data: bytes, addr):
+        if len(data) < UDP_HEADER.size:
+            return
+        magic, kind, fragment, _, token, msg_id, length = UDP_HEADER.unpack_from(data)
+        link = self.links.get(token) if magic == UDP_MAGIC else None
+        if link is None:
+            return      # 滚动重启时新旧进程共用端口，分到别人的数据报token对不上
+        link.addr = addr
+        if kind == UDP_KIND_PING:
+            self.transport.sendto(UDP_HEADER.pack(UDP_MAGIC, UDP_KIND_PONG, 0x01, 0, token, msg_id, length)
+                                  + data[UDP_HEADER.size:UDP_HEADER.size + 4], addr)
+        elif kind == UDP_KIND_AUDIO and length <= len(data) - UDP_HEADER.size:
+            link.receive(fragment, msg_id, length, data[UDP_HEADER.size:])
+
+
+async def safe_send(websocket, data):
+    """
+    安全地向WebSocket发送数据
+    
+    Args:
+        websocket: WebSocket连接对象
+        data: 要发送的数据
+    """
+    if websocket is None or websocket.closed:
+        return False
+        
+    try:
+        await websocket.send(data)
+        return True
+    except Exception as e:
+        logger.debug(f"发送数据失败（连接可能已关闭）: {e}")
+        return False
+
+class DeviceSender:
+    """
+    📮 一台设备的下行发送队列：所有消息按顺序排队，由一个任务逐条写进WebSocket
+
+    websockets的send()在写缓冲区满时会一直等，慢链路上转发任务和控制消息都被卡住，豆包那边的响应继续堆积。
+    改成put()立即返回：排队字节数超过上限时从最早的音频开始丢（帧头序号让设备把缺口当丢包补偿），
+    控制消息不丢；丢掉的字节通过on_drop()告诉调用方，从下行额度里扣回。
+    """
+
+    __slots__ = ("websocket", "name", "limit", "on_drop", "_queue", "_bytes", "_wakeup", "_task", "dropped",
+                 "_drop_log")
+
+    def __init__(self, websocket, name: str, limit: int, on_drop=None):
+        self.websocket = websocket
+        self.name = name            # 指标的device标签，hello后换成device_id
+        self.limit = limit
+        self.on_drop = on_drop
+        self._queue = deque()       # (数据, 可丢弃)
+        self._bytes = 0
+        self._wakeup = asyncio.Event()
+        self.dropped = 0
+        self._drop_log = SampledLog(logging.WARNING, f"📮 {name} 下行积压超过{limit}字节，丢弃最早的音频")
+        self._task = asyncio.create_task(self._run())
+
+    @property
+    def closed(self) -> bool:
+        return self._task.done() or self.websocket.closed
+
+    def pending_bytes(self) -> int:
+        transport = self.websocket.transport
+        return self._bytes + (transport.get_write_buffer_size() if transport is not None else 0)
+
+    def put(self, data, droppable: bool = False) -> bool:
+        """
+        排进发送队列；连接已关闭时返回False
+        """
+        if self.closed:
+            return False
+        self._queue.append((data, droppable))
+        self._bytes += len(data)
+        if self._bytes > self.limit:
+            self._drop_oldest_audio()
+        self._wakeup.set()
+        return True
+
+    def _drop_oldest_audio(self):
+        kept = deque()
+        dropped = 0
+        while self._queue and self._bytes > self.limit:
+            data, droppable = self._queue.popleft()
+            if droppable and self._queue:   # 刚放进来的最后一条不丢
+                self._bytes -= len(data)
+                dropped += len(data)
+            else:
+                kept.append((data, droppable))
+        kept.extend(self._queue)
+        self._queue = kept
+        if dropped:
+            self.dropped += dropped
+            METRIC_SEND_DROPPED.inc(dropped)
+            self._drop_log.log(dropped)
+            if self.on_drop is not None:
+                self.on_drop(dropped)
+
+    async def _run(self):
+        try:
+            while True:
+                while not self._queue:
+                    self._wakeup.clear()
+                    await self._wakeup.wait()
+                data, _ = self._queue.popleft()
+                self._bytes -= len(data)
+                await asyncio.wait_for(self.websocket.send(data), timeout=RELAY_SEND_TIMEOUT_S)
+                METRIC_BYTES.inc(len(data), peer="device", direction="out")
+        except asyncio.TimeoutError:
+            logger.warning(f"📮 {self.name} 一条下行消息{RELAY_SEND_TIMEOUT_S:.0f}秒没写出去，断开连接")
+            self.websocket.transport.abort()
+        except asyncio.CancelledError:
+            pass
+        except Exception as e:
+            logger.debug(f"下行发送任务结束（连接可能已关闭）: {e}")
+        finally:
+            self._queue.clear()
+            self._bytes = 0
+
+    async def flush(self, timeout_s: float):
+        """等排着的消息写出去（最多timeout_s秒）"""
+        deadline = time.monotonic() + timeout_s
+        while (self._queue or self.pending_bytes()) and not self.closed and time.monotonic() < deadline:
+            await asyncio.sleep(0.05)
+
+    def close(self):
+        self._task.cancel()
+
+
+class UpstreamWriter:
+    """
+    📤 一台设备发给豆包的上行队列：读ESP32的循环只负责解析、解码和入队，由一个任务写进豆包的WebSocket
+
+    原来每条上行音频在读循环里直接await doubao_ws.send()，豆包那边写得慢时设备的消息也不读了，
+    设备的TCP窗口被填满、sendBinary跟着阻塞。改成有界队列后：
+    - 写任务取数据时队列里已经积压了几条，就把同一会话连续的PCM合成一条消息（最多batch_bytes），
+      少付几次协议头、会话ID和send()；不积压时从第一条入队起最多再等latency_s，凑不满也发出
+    - 补发静音这类已经构造好的消息按顺序排在音频中间，不会插到还没发出去的音频前面
+    - 队列满了put()才等待，压力照原来的方式传回设备；一条消息RELAY_SEND_TIMEOUT_S秒写不出去就结束，
+      之后put()返回False，由读循环断开连接
+    每条数据带着入队时的豆包连接和会话ID，会话释放后还在排队的音频写不进新会话。
+    """
+
+    __slots__ = ("name", "limit", "batch_bytes", "latency_s", "_queue", "_wakeup", "_space", "_task",
+                 "frames", "messages", "max_depth", "bytes")
+
+    def __init__(self, name: str, limit: int, batch_bytes: int, latency_s: float = 0.0):
+        self.name = name
+        self.limit = max(1, limit)
+        self.batch_bytes = batch_bytes
+        self.latency_s = latency_s
+        self._queue = deque()       # (豆包连接, 会话ID, PCM, 构造好的消息, 入队时间)
+        self._wakeup = asyncio.Event()
+        self._space = asyncio.Event()
+        self.frames = 0
+        self.messages = 0
+        self.max_depth = 0
+        self.bytes = 0              # 写给豆包的字节（含协议头，💰 每轮账单取增量）
+        self._task = asyncio.create_task(self._run())
+
+    @property
+    def closed(self) -> bool:
+        return self._task.done()
+
+    async def put(self, ws, session_id: str, pcm: bytes = b"", messages=None) -> bool:
+        """
+        排进上行队列（messages是构造好的消息列表，按顺序原样发送）；写任务已经结束时返回False
+        """
+        while len(self._queue) >= self.limit and not self.closed:
+            self._space.clear()
+            await self._space.wait()
+        if self.closed:
+            return False
+        self._queue.append((ws, session_id, pcm, messages, time.monotonic()))
+        self.max_depth = max(self.max_depth, len(self._queue))
+        self._wakeup.set()
+        return True
+
+    async def _take_batch(self, ws, session_id: str, pcm: bytes, queued_at: float) -> bytes:
+        # 同一会话的PCM接在后面，凑到batch_bytes为止；队列空了就等后面的，直到第一条入队latency_s之后
+        parts = [pcm]
+        size = len(pcm)
+        deadline = queued_at + self.latency_s
+        while size < self.batch_bytes:
+            if not self._queue:
+                remaining = deadline - time.monotonic()
+                if remaining <= 0:
+                    break
+                self._wakeup.clear()
+                try:
+                    await asyncio.wait_for(self._wakeup.wait(), timeout=remaining)
+                except asyncio.TimeoutError:
+                    break
+                continue
+            next_ws, next_session, next_pcm, next_messages, _ = self._queue[0]
+            if next_messages is not None or next_ws is not ws or next_session != session_id or \
+                    size + len(next_pcm) > self.batch_bytes:
+                break   # speech_end、换了会话或者凑满了：立即发出
+            self._queue.popleft()
+            self._space.set()
+            parts.append(next_pcm)
+            size += len(next_pcm)
+        self.frames += len(parts)
+        METRIC_UPLINK_MESSAGES.inc(len(parts), kind="frames")
+        return b"".join(parts) if len(parts) > 1 else pcm
+
+    async def _run(self):
+        try:
+            while True:
+                while not self._queue:
+                    self._wakeup.clear()
+                    await self._wakeup.wait()
+                METRIC_UPLINK_QUEUE.observe(len(self._queue))
+                ws, session_id, pcm, messages, queued_at = self._queue.popleft()
+                self._space.set()
+                if messages is None:
+                    pcm = await self._take_batch(ws, session_id, pcm, queued_at)
+                    messages = (create_audio_message(session_id, pcm),)
+                if ws.closed:
+                    continue    # 豆包连接已经断了，转发任务会结束这个会话
+                for message in messages:
+                    await asyncio.wait_for(ws.send(message), timeout=RELAY_SEND_TIMEOUT_S)
+                    METRIC_BYTES.inc(len(message), peer="upstream", direction="out")
+                    self.bytes += len(message)
+                    self.messages += 1
+                    METRIC_UPLINK_MESSAGES.inc(kind="messages")
+        except asyncio.CancelledError:
+            pass
+        except Exception as e:
+            logger.warning(f"📤 {self.name} 转发音频到豆包失败: {e}")
+        finally:
+            self._queue.clear()
+            self._space.set()
+
+    def summary(self) -> str:
+        return (f"设备消息{self.frames}条合成{self.messages}条发出（平均每条{self.frames / max(1, self.messages):.1f}条），"
+                f"最多排队{self.max_depth}条")
+
+    def close(self):
+        self._task.cancel()
+
+
+class UpstreamEndpoints:
+    """
+    🌐 豆包接入点的延迟和健康状态
+
+    每次建连（包括后台探测）都更新对应接入点的耗时平均；失败的接入点冷却一段时间，
+    pick()在不冷却的接入点里选最快的（还没测过的按列表顺序排在测过的后面），全部冷却时选最早恢复的。
+    """
+
+    def __init__(self, urls):
+        self.urls = list(urls)
+        self.latency = {url: None for url in self.urls}     # 建连耗时的指数平均（秒），None=还没成功过
+        self.failures = {url: 0 for url in self.urls}       # 连续失败次数
+        self.cooldown_until = {url: 0.0 for url in self.urls}
+        self._task = None
+
+    def set_urls(self, urls):
+        """
+        🔁 热更新换接入点列表：留下来的接入点保留测得的延迟和冷却状态
+        """
+        self.urls = list(urls)
+        self.latency = {url: self.latency.get(url) for url in self.urls}
+        self.failures = {url: self.failures.get(url, 0) for url in self.urls}
+        self.cooldown_until = {url: self.cooldown_until.get(url, 0.0) for url in self.urls}
+        if self._task is None and running:
+            self.start()
+
+    def healthy(self, url: str) -> bool:
+        return time.monotonic() >= self.cooldown_until.get(url, 0.0)
+
+    def pick(self, exclude=()) -> Optional[str]:
+        candidates = [url for url in self.urls if url not in exclude]
+        if not candidates:
+            return None
+        healthy = [url for url in candidates if self.healthy(url)]
+        if not healthy:
+            return min(candidates, key=lambda url: self.cooldown_until[url])
+        return min(healthy, key=lambda url: (self.latency[url] is None, self.latency[url] or 0.0,
+                                             self.urls.index(url)))
+
+    def report(self, url: str, elapsed: Optional[float]):
+        """
+        记录一次建连或开始会话的结果，elapsed=None表示失败
+        """
+        if url not in self.latency:
+            return
+        if elapsed is not None:
+            previous = self.latency[url]
+            self.latency[url] = elapsed if previous is None else previous + (elapsed - previous) * UPSTREAM_LATENCY_ALPHA
+            if self.failures[url]:
+                logger.info(f"🌐 豆包接入点 {url} 恢复，建连 {elapsed * 1000:.0f}ms")
+            self.failures[url] = 0
+            self.cooldown_until[url] = 0.0
+            return
+        self.failures[url] += 1
+        cooldown = min(UPSTREAM_COOLDOWN_S * 2 ** (self.failures[url] - 1), UPSTREAM_COOLDOWN_MAX_S)
+        self.cooldown_until[url] = time.monotonic() + cooldown
+        if len(self.urls) > 1:
+            logger.warning(f"🌐 豆包接入点 {url} 连续失败{self.failures[url]}次，{cooldown:.0f}秒内不用")
+
+    def latency_series(self) -> Dict[tuple, float]:
+        return {(url,): (-1 if not self.healthy(url) else self.latency[url] or 0.0) for url in self.urls}
+
+    def summary(self) -> str:
+        return ", ".join(f"{url}={'冷却' if not self.healthy(url) else '-' if self.latency[url] is None else f'{self.latency[url] * 1000:.0f}ms'}"
+                         for url in self.urls)
+
+    def start(self):
+        if len(self.urls) > 1 and RELAY_UPSTREAM_PROBE_S > 0 and self._task is None:
+            self._task = asyncio.create_task(self._probe_loop())
+
+    async def _probe_loop(self):
+        while running:
+            for url in self.urls:
+                try:
+                    ws = await connect_doubao_endpoint(url)
+                    await ws.close()
+                except Exception as e:
+                    logger.debug(f"探测豆包接入点 {url} 失败: {e}")
+            logger.info(f"🌐 豆包接入点: {self.summary()}")
+            await asyncio.sleep(RELAY_UPSTREAM_PROBE_S)
+
+    async def close(self):
+        if self._task:
+            self._task.cancel()
+            self._task = None
+
+
+upstream_endpoints = UpstreamEndpoints(DOUBAO_CONFIG["base_urls"])
+
+
+class HostResolver:
+    """
+    🌐 豆包接入点的DNS缓存：同一个域名RELAY_UPSTREAM_DNS_TTL_S秒内只解析一次
+
+    getaddrinfo在线程池里跑，慢的时候几十到几百毫秒，原来每条预热连接、每次现场建连都要付一次。
+    缓存按(域名, 端口)保存解析出的地址；连接失败时丢掉这一项，下次重新解析（接入点换了IP也能很快跟上）。
+    重新解析失败时先用过期的地址，不因为DNS抖动就连不上。
+    """
+
+    def __init__(self, ttl_s: float):
+        self.ttl_s = ttl_s
+        self._cache: Dict[tuple, tuple] = {}    # (域名, 端口) -> (地址列表, 过期时间)
+
+    async def resolve(self, host: str, port: int) -> Optional[str]:
+        """
+        返回缓存的第一个地址；host本来就是IP或者不缓存时返回None（交给websockets自己解析）
+        """
+        if self.ttl_s <= 0 or _is_ip_literal(host):
+            return None
+        key = (host, port)
+        cached = self._cache.get(key)
+        now = time.monotonic()
+        if cached is not None and now < cached[1]:
+            return cached[0][0]
+        try:
+            infos = await asyncio.get_running_loop().getaddrinfo(host, port, type=socket.SOCK_STREAM)
+        except OSError as e:
+            if cached is None:
+                raise
+            logger.warning(f"🌐 解析 {host} 失败（{e}），先用上次的地址 {cached[0][0]}")
+            return cached[0][0]
+        addresses = list(dict.fromkeys(info[4][0] for info in infos))
+        if not addresses:
+            raise OSError(f"{host} 没有解析出地址")
+        self._cache[key] = (addresses, now + self.ttl_s)
+        return addresses[0]
+
+    def forget(self, host: str, port: int):
+        self._cache.pop((host, port), None)
+
+
+def _is_ip_literal(host: str) -> bool:
+    try:
+        socket.inet_pton(socket.AF_INET6 if ":" in host else socket.AF_INET, host)
+        return True
+    except OSError:
+        return False
+
+
+upstream_resolver = HostResolver(RELAY_UPSTREAM_DNS_TTL_S)
+_upstream_tls_context = None
+
+
+def upstream_tls_context() -> ssl.SSLContext:
+    """
+    所有豆包连接共用的TLS客户端上下文（websockets的ssl=True每条连接都新建一个、重新加载系统CA证书）
+    """
+    global _upstream_tls_context
+    if _upstream_tls_context is None:
+        _upstream_tls_context = ssl.create_default_context()
+    return _upstream_tls_context
+
+
+async def connect_doubao_endpoint(url: str, pipelined: bool = False):
+    """
+    建立到指定豆包接入点的WebSocket连接并完成StartConnection，结果记进upstream_endpoints
+
+    pipelined: 发出StartConnection不等确认就返回，调用者接着发StartSession（确认由UpstreamConnection的读取任务
+               收下丢掉；StartConnection失败时StartSession跟着失败）。这样建的连接不计入接入点的延迟统计
+
+    Returns:
+        已就绪、可以发StartSession的连接（relay_endpoint属性是接入点地址，relay_timing是各阶段耗时，秒）
+    """
+    start = time.monotonic()
+    headers = dict(relay_config.current.headers)
+    headers["X-Api-Connect-Id"] = str(uuid.uuid4())  # 每条连接单独的ID，不修改全局配置
+    parsed = urllib.parse.urlsplit(url)
+    secure = parsed.scheme == "wss"
+    port = parsed.port or (443 if secure else 80)
+    timing = {}
+    address = None
+    try:
+        address = await asyncio.wait_for(upstream_resolver.resolve(parsed.hostname, port),
+                                         timeout=RELAY_UPSTREAM_CONNECT_TIMEOUT_S)
+        timing["dns"] = time.monotonic() - start
+        options = {}
+        if address is not None:
+            options.update(host=address, port=port)     # Host头和证书校验仍然按URL里的域名
+        if secure:
+            options.update(ssl=upstream_tls_context(), server_hostname=parsed.hostname)
+        doubao_ws = await asyncio.wait_for(websockets.connect(
+            url,
+            extra_headers=headers,
+            ping_interval=None,
+            **options,
+        ), timeout=max(0.1, RELAY_UPSTREAM_CONNECT_TIMEOUT_S - (time.monotonic() - start)))
+        timing["handshake"] = time.monotonic() - start - timing["dns"]
+        try:
+            # StartConnection消息
+            header = create_protocol_header()
+            message = bytearray(header)
+            message.extend((1).to_bytes(4, 'big'))
+            payload = gzip.compress(b"{}")
+            message.extend(len(payload).to_bytes(4, 'big'))
+            message.extend(payload)
+            await doubao_ws.send(message)
+            if not pipelined:
+                # 接收确认响应
+                acked = time.monotonic()
+                await asyncio.wait_for(doubao_ws.recv(), timeout=max(0.1, RELAY_UPSTREAM_CONNECT_TIMEOUT_S
+                                                                      - (time.monotonic() - start)))
+                timing["start_connection"] = time.monotonic() - acked
+        except BaseException:
+            await doubao_ws.close()
+            raise
+    except Exception:
+        if address is not None:
+            upstream_resolver.forget(parsed.hostname, port)
+        upstream_endpoints.report(url, None)
+        raise
+    elapsed = time.monotonic() - start
+    METRIC_UPSTREAM_CONNECT.observe(timing["dns"], stage="dns")
+    METRIC_UPSTREAM_CONNECT.observe(timing["handshake"], stage="handshake")
+    if not pipelined:
+        upstream_endpoints.report(url, elapsed)
+        METRIC_UPSTREAM_CONNECT.observe(elapsed, stage="connection")
+    doubao_ws.relay_endpoint = url
+    doubao_ws.relay_timing = timing
+    return doubao_ws
+
+
+def format_connect_timing(timing: Dict[str, float]) -> str:
+    """
+    ⏱️ 建连各阶段耗时，用在会话就绪的日志里
+    """
+    names = (("dns", "DNS"), ("handshake", "TCP+TLS+WebSocket"), ("start_connection", "StartConnection"))
+    return "，".join(f"{label} {timing[key] * 1000:.0f}ms" for key, label in names if key in timing)
+
+
+async def open_doubao_connection(exclude=(), pipelined: bool = False):
+    """
+    在最快的健康接入点上建立豆包连接，失败时依次换其他接入点
+
+    Args:
+        exclude: 这次不用的接入点（刚刚在上面开始会话失败）
+        pipelined: 不等StartConnection的确认（见connect_doubao_endpoint）
+
+    Returns:
+        已就绪、可以发StartSession的连接
+    """
+    tried = list(exclude)
+    while True:
+        url = upstream_endpoints.pick(exclude=tried)
+        if url is None:
+            raise ConnectionError(f"没有可用的豆包接入点（{upstream_endpoints.summary()}）")
+        try:
+            return await connect_doubao_endpoint(url, pipelined)
+        except Exception as e:
+            tried.append(url)
+            if upstream_endpoints.pick(exclude=tried) is None:
+                raise
+            METRIC_UPSTREAM_FAILOVER.inc(stage="connect")
+            logger.warning(f"🌐 豆包接入点 {url} 建连失败（{e!r}），换下一个")
+
+
+def create_session_message(event: int, session_id: str, payload: bytes, compressed: bool = False) -> bytes:
+    """
+    构造会话级控制消息（StartSession=100 / FinishSession=102 / ChatTextQuery=501）
+
+    compressed: payload已经gzip过（StartSession负载按配置版本缓存，见RelayConfig）
+    """
+    session_bytes = session_id.encode('utf-8')
+    if not compressed:
+        payload = gzip.compress(payload)
+    return b"".join((_HEADER_FULL, _U32.pack(event), _U32.pack(len(session_bytes)), session_bytes,
+                     _U32.pack(len(payload)), payload))
+
+
+def merge_config(base: Dict[str, Any], override: Dict[str, Any]) -> Dict[str, Any]:
+    """
+    按层合并：override里的字典递归合并到base的同名字典上，其余值直接替换；不修改base
+    """
+    merged = dict(base)
+    for key, value in override.items():
+        if isinstance(value, dict) and isinstance(merged.get(key), dict):
+            merged[key] = merge_config(merged[key], value)
+        else:
+            merged[key] = value
+    return merged
+
+
+class ConfigVersion:
+    """
+    一个版本的豆包配置（生成后不再修改），StartSession负载按输出格式序列化、gzip一次后所有会话共用
+    """
+
+    def __init__(self, version: int, session: Dict[str, Any], headers: Dict[str, str], base_urls):
+        self.version = version
+        self.session = session
+        self.headers = headers
+        self.base_urls = list(base_urls)
+        self.end_window_ms = int(session.get("asr", {}).get("extra", {}).get("end_smooth_window_ms", 1500))
+        self.speech_end_silence_ms = self.end_window_ms + SPEECH_END_SILENCE_EXTRA_MS
+        self._payloads: Dict[Tuple[str, int], bytes] = {}
+
+    def speech_end_silence_for(self, end_window_ms: int = 0) -> int:
+        """
+        speech_end后补发的静音时长（end_window_ms：这台设备的结束平滑窗口，0=按配置）
+        """
+        return (end_window_ms or self.end_window_ms) + SPEECH_END_SILENCE_EXTRA_MS
+
+    def session_config(self, audio_format: str, end_window_ms: int = 0) -> Dict[str, Any]:
+        """
+        生成StartSession配置，TTS输出格式替换为audio_format，end_window_ms不为0时替换ASR结束平滑窗口
+        """
+        config = dict(self.session)
+        config["tts"] = dict(self.session.get("tts", {}), audio_config=TTS_AUDIO_FORMATS[audio_format])
+        if end_window_ms:
+            asr = self.session.get("asr", {})
+            config["asr"] = dict(asr, extra=dict(asr.get("extra", {}), end_smooth_window_ms=end_window_ms))
+        return config
+
+    def start_session_payload(self, audio_format: str, end_window_ms: int = 0) -> bytes:
+        key = (audio_format, end_window_ms)
+        payload = self._payloads.get(key)
+        if payload is None:
+            payload = gzip.compress(json.dumps(self.session_config(audio_format, end_window_ms)).encode('utf-8'))
+            self._payloads[key] = payload
+        return payload
+
+
+class RelayConfig:
+    """
+    🔁 可热更新的豆包配置：current总是最新的ConfigVersion，重新加载时整体替换（不在原地修改），
+    正在用旧版本的会话不受影响
+    """
+
+    def __init__(self, path: str):
+        self.path = path
+        self.current = ConfigVersion(0, SESSION_CONFIG, DOUBAO_CONFIG["headers"], DOUBAO_CONFIG["base_urls"])
+
+    def reload(self) -> str:
+        """
+        重新读RELAY_CONFIG_FILE，返回结果说明（文件有错时保留当前版本）
+        """
+        if not self.path:
+            return "RELAY_CONFIG_FILE未设置"
+        try:
+            with open(self.path, encoding="utf-8") as f:
+                override = json.load(f)
+            if not isinstance(override, dict):
+                raise ValueError("顶层必须是对象")
+            doubao = override.get("doubao") or {}
+            base_urls = doubao.get("base_urls") or DOUBAO_CONFIG["base_urls"]
+            if not isinstance(base_urls, list) or not all(isinstance(u, str) and u for u in base_urls):
+                raise ValueError("doubao.base_urls必须是非空字符串列表")
+            version = ConfigVersion(self.current.version + 1,
+                                    merge_config(SESSION_CONFIG, override.get("session") or {}),
+                                    merge_config(DOUBAO_CONFIG["headers"], doubao.get("headers") or {}),
+                                    base_urls)
+            for audio_format in TTS_PREFERRED_FORMATS:
+                version.start_session_payload(audio_format)     # 序列化出错时不切换
+        except Exception as e:
+            logger.warning(f"🔁 重新加载配置失败，继续用版本{self.current.version}: {e}")
+            return f"error: {e}"
+        previous, self.current = self.current, version
+        upstream_endpoints.set_urls(version.base_urls)
+        if version.headers != previous.headers:
+            warm_pool.discard_idle()     # 鉴权头变了，用旧头建的预热连接不再用
+        tts = version.session.get("tts", {})
+        logger.info(f"🔁 配置已更新到版本{version.version}: 发音人 {tts.get('speaker')}, "
+                    f"结束平滑窗口 {version.speech_end_silence_ms - SPEECH_END_SILENCE_EXTRA_MS}ms, "
+                    f"接入点 {len(version.base_urls)} 个（之后开始的会话生效）")
+        return f"version {version.version}"
+
+
+relay_config = RelayConfig(RELAY_CONFIG_FILE)
+
+
+class SessionRejected(Exception):
+    """
+    豆包拒绝了StartSession（例如不支持请求的输出格式）
+    """
+
+
+# 投递到已释放会话的响应队列：下行转发任务等新会话开始后改读新队列
+SESSION_RELEASED = object()
+
+
+class UpstreamConnection:
+    """
+    一条豆包连接，承载一个或多个会话
+
+    豆包的每帧都带session_id，读取任务是这条连接上唯一调用recv()的地方，
+    解析后按session_id投递到各会话自己的队列；连接断开时向所有队列投递None。
+    """
+
+    def __init__(self, ws):
+        self.ws = ws
+        self.endpoint = getattr(ws, "relay_endpoint", "")
+        self.sessions: Dict[str, asyncio.Queue] = {}
+        self.start_session_s = 0.0      # 最近一次StartSession到确认的耗时
+        self._reader = asyncio.create_task(self._read_loop())
+
+    @property
+    def closed(self) -> bool:
+        return self.ws.closed or self._reader.done()
+
+    async def _read_loop(self):
+        try:
+            loop = asyncio.get_running_loop()
+            async for data in self.ws:
+                METRIC_BYTES.inc(len(data), peer="upstream", direction="in")
+                if upstream_fixture is not None:
+                    upstream_fixture.record(data)
+                # 这里是这条连接唯一的读取者，逐帧等解析结果，分发顺序和到达顺序一致；
+                # 解析下一帧时各会话的转发任务同时在处理上一帧
+                if cpu_pool is not None and len(data) >= CPU_OFFLOAD_MIN_BYTES:
+                    response = await loop.run_in_executor(cpu_pool, parse_doubao_response, data)
+                else:
+                    response = parse_doubao_response(data)
+                if not response:
+                    continue
+                response["wire_bytes"] = len(data)     # 💰 按会话记上游下行字节
+                if response.get("message_type") == "error":
+                    METRIC_DOUBAO_ERRORS.inc(code=response.get("error_code", ""))
+                elif response.get("event") == 153:
+                    METRIC_DOUBAO_ERRORS.inc(code="session_failed")
+                queue = self.sessions.get(response.get("session_id", ""))
+                if queue is not None:
+                    queue.put_nowait(response)
+                elif response.get("message_type") == "error" or response.get("event") == 51:
+                    # 错误帧和ConnectionFailed（流水线建连时StartConnection的失败回复）不带会话ID，通知这条连接上的所有会话
+                    logger.warning(f"⚠️ 豆包返回错误 {response.get('error_code', response.get('event'))}: "
+                                   f"{response.get('payload')}")
+                    for q in self.sessions.values():
+                        q.put_nowait(response)
+                else:
+                    logger.debug(f"丢弃无主的豆包消息: event={response.get('event')}")
+        except Exception as e:
+            logger.debug(f"豆包连接读取结束: {e}")
+        finally:
+            for queue in self.sessions.values():
+                queue.put_nowait(None)
+
+    async def start_session(self, session_id: str, audio_format: str, end_window_ms: int = 0) -> asyncio.Queue:
+        """
+        在这条连接上开始会话，等到豆包确认后返回该会话的响应队列
+
+        Raises:
+            SessionRejected: 豆包返回错误帧或SessionFailed(153)
+        """
+        queue = ResponseQueue(RELAY_SESSION_TTS_QUEUE_BYTES)
+        self.sessions[session_id] = queue
+        start = time.monotonic()
+        try:
+            await self.ws.send(create_session_message(
+                100, session_id, relay_config.current.start_session_payload(audio_format, end_window_ms), compressed=True))
+            ack = await asyncio.wait_for(queue.get(), timeout=RELAY_UPSTREAM_START_TIMEOUT_S)
+            if ack is None:
+                raise websockets.exceptions.ConnectionClosedError(None, None)
+            if ack.get("event") == 51:
+                raise ConnectionError(f"StartConnection失败: {ack.get('payload')}")
+            if ack.get("message_type") == "error" or ack.get("event") == 153:
+                raise SessionRejected(f"{ack.get('error_code', ack.get('event'))}: {ack.get('payload')}")
+        except BaseException:
+            self.sessions.pop(session_id, None)
+            raise
+        self.start_session_s = time.monotonic() - start
+        return queue
+
+    async def finish_session(self, session_id: str):
+        if self.sessions.pop(session_id, None) is None:
+            return
+        if not self.ws.closed:
+            try:
+                await self.ws.send(create_session_message(102, session_id, b"{}"))
+            except Exception as e:
+                logger.debug(f"发送FinishSession失败: {e}")
+
+    async def close(self):
+        self._reader.cancel()
+        try:
+            await self.ws.close()
+        except Exception:
+            pass
+
+
+class RelayBusy(Exception):
+    """
+    豆包会话名额已满，排队也没排上
+    """
+
+
+class UpstreamAdmission:
+    """
+    🚦 豆包会话的并发上限：名额满时按先来后到排队，队列满或等超时立即拒绝
+
+    名额在DoubaoMux.open_session()里占用、close_session()时归还：设备连着但会话已经释放时不占名额。
+    归还时直接转给队首的等待者，后来的不会插队。
+    """
+
+    def __init__(self, limit: int, queue_len: int, wait_s: float):
+        self.limit = limit
+        self.queue_len = queue_len
+        self.wait_s = wait_s
+        self.active = 0
+        self.waiters = deque()
+
+    async def acquire(self, wait: bool = True):
+        """
+        占一个名额；wait=False时没有空位立即拒绝（连接建立时预开的会话不排队）
+
+        Raises:
+            RelayBusy: 没有空位且队列已满、不排队或等待超时
+        """
+        if self.limit <= 0 or (self.active < self.limit and not self.waiters):
+            self.active += 1
+            METRIC_ADMISSION.inc(result="admitted")
+            return
+        if not wait or len(self.waiters) >= self.queue_len:
+            METRIC_ADMISSION.inc(result="rejected")
+            raise RelayBusy(f"豆包会话已满（{self.active}/{self.limit}，排队{len(self.waiters)}个）")
+        METRIC_ADMISSION.inc(result="queued")
+        future = asyncio.get_running_loop().create_future()
+        self.waiters.append(future)
+        try:
+            await asyncio.wait_for(asyncio.shield(future), timeout=self.wait_s)
+        except BaseException as e:
+            if future.done():
+                self.release()          # 名额已经转给了自己，还回去
+            else:
+                future.cancel()
+                self.waiters.remove(future)
+            if isinstance(e, asyncio.TimeoutError):
+                METRIC_ADMISSION.inc(result="rejected")
+                raise RelayBusy(f"等了{self.wait_s:g}秒没有空出的豆包会话") from None
+            raise
+
+    def release(self):
+        while self.waiters:
+            future = self.waiters.popleft()
+            if not future.done():
+                future.set_result(None)     # 名额直接转交，active不变
+                return
+        self.active -= 1
+
+
+class DoubaoMux:
+    """
+    豆包会话多路复用
+
+    新会话优先放到还有空位（少于MAX_SESSIONS_PER_UPSTREAM个会话）的连接上，
+    没有空位时从预热池取一条新连接。连接上最后一个会话结束后关闭连接。
+    """
+
+    def __init__(self, pool, max_sessions: int, admission: UpstreamAdmission):
+        self.pool = pool
+        self.max_sessions = max(1, max_sessions)
+        self.admission = admission
+        self.connections = []
+        self.rejected_formats = set()   # 豆包拒绝过的TTS输出格式
+
+    async def open_session(self, session_id: str, wait: bool = True, end_window_ms: int = 0):
+        """
+        占一个会话名额，按TTS_PREFERRED_FORMATS依次协商输出格式，返回第一个被接受的
+        （end_window_ms：这台设备的ASR结束平滑窗口，0=按配置）
+
+        Returns:
+            (连接, 响应队列, 输出格式)
+
+        Raises:
+            RelayBusy: 会话名额已满（wait=False时不排队）
+        """
+        start = time.monotonic()
+        await self.admission.acquire(wait)
+        queued_s = time.monotonic() - start
+        try:
+            conn, queue, audio_format, path = await self._negotiate(session_id, end_window_ms)
+        except BaseException:
+            self.admission.release()
+            raise
+        logger.info(f"⏱️ 豆包会话 {session_id[:8]} 建立: 排队 {queued_s * 1000:.0f}ms，{path}，"
+                    f"StartSession {conn.start_session_s * 1000:.0f}ms")
+        return conn, queue, audio_format
+
+    async def _negotiate(self, session_id: str, end_window_ms: int):
+        formats = [f for f in TTS_PREFERRED_FORMATS if f not in self.rejected_formats]
+        for i, audio_format in enumerate(formats):
+            try:
+                conn, queue, path = await self._start(session_id, audio_format, end_window_ms)
+                return conn, queue, audio_format, path
+            except SessionRejected as e:
+                if i == len(formats) - 1:
+                    for conn in [c for c in self.connections if not c.sessions]:
+                        await self._drop(conn)
+                    raise
+                logger.warning(f"⚠️ 豆包不接受输出格式 {audio_format}（{e}），改用 {formats[i + 1]}")
+                self.rejected_formats.add(audio_format)
+        raise SessionRejected("没有可用的TTS输出格式")
+
+    async def _start(self, session_id: str, audio_format: str, end_window_ms: int):
+        self.connections = [c for c in self.connections if not c.closed]
+        for conn in self.connections:
+            if len(conn.sessions) < self.max_sessions:
+                try:
+                    return conn, await conn.start_session(session_id, audio_format, end_window_ms), "共享连接"
+                except SessionRejected:
+                    raise
+                except Exception as e:
+                    logger.warning(f"共享连接上开始会话失败，换一条连接: {e}")
+
+        # 预热连接可能已被对端关闭，失败时现场重建；StartSession超时说明接入点有问题，换一个接入点重试
+        ws, pooled = await self.pool.acquire()
+        conn = UpstreamConnection(ws)
+        excluded = []
+        for attempt in range(len(upstream_endpoints.urls) + 1):
+            # 先登记：会话被拒绝时连接留给下一种格式复用
+            self.connections.append(conn)
+            try:
+                queue = await conn.start_session(session_id, audio_format, end_window_ms)
+                break
+            except SessionRejected:
+                raise
+            except (asyncio.TimeoutError, websockets.exceptions.ConnectionClosed, OSError) as e:
+                await self._drop(conn)
+                if isinstance(e, asyncio.TimeoutError):
+                    upstream_endpoints.report(conn.endpoint, None)
+                    excluded.append(conn.endpoint)
+                    logger.warning(f"🌐 豆包接入点 {conn.endpoint} {RELAY_UPSTREAM_START_TIMEOUT_S:g}秒没有确认StartSession，"
+                                   f"换接入点重试")
+                else:
+                    logger.warning("预热连接已失效，重新建连")
+                if attempt == len(upstream_endpoints.urls) or upstream_endpoints.pick(exclude=excluded) is None:
+                    raise
+                METRIC_UPSTREAM_FAILOVER.inc(stage="session")
+                conn = UpstreamConnection(await open_doubao_connection(exclude=excluded,
+                                                                       pipelined=RELAY_UPSTREAM_PIPELINE))
+                pooled = False
+            except BaseException:
+                await self._drop(conn)
+                raise
+        logger.info(f"📊 豆包连接 {len(self.connections)} 条, "
+                    f"会话 {sum(len(c.sessions) for c in self.connections)} 个")
+        timing = getattr(conn.ws, "relay_timing", {})
+        if pooled:
+            path = "预热连接"
+        else:
+            path = f"现场建连（{format_connect_timing(timing)}）"
+            if "start_connection" not in timing:
+                path += "，StartSession和StartConnection一起发出"
+        return conn, queue, path
+
+    async def _drop(self, conn: UpstreamConnection):
+        if conn in self.connections:
+            self.connections.remove(conn)
+        await conn.close()
+
+    async def close_session(self, conn: UpstreamConnection, session_id: str):
+        self.admission.release()
+        await conn.finish_session(session_id)
+        if not conn.sessions:
+            if conn in self.connections:
+                self.connections.remove(conn)
+            await conn.close()
+
+
+class DoubaoWarmPool:
     """
-    安全地向WebSocket发送数据
-    
-    Args:
-        websocket: WebSocket连接对象
-        data: 要发送的数据
+    豆包预热连接池
+
+    后台任务保持WARM_POOL_SIZE条已完成StartConnection的空闲连接；acquire()立即取走一条
+    （池空时现场建连），然后唤醒后台任务补充。超龄或已关闭的连接在取用和补充时丢弃。
     """
-    if websocket is None or websocket.closed:
-        return False
-        
-    try:
-        await websocket.send(data)
-        return True
-    except Exception as e:
-        logger.debug(f"发送数据失败（连接可能已关闭）: {e}")
-        return False
+
+    def __init__(self, size: int, max_age_s: float):
+        self.size = size
+        self.max_age_s = max_age_s
+        self._idle = deque()            # (连接, 建立时间)
+        self._wakeup = asyncio.Event()
+        self._task = None
+        self.hits = 0                   # 直接用上预热连接的次数
+        self.misses = 0                 # 池空时现场建连的次数
+
+    def start(self):
+        if self.size > 0 and self._task is None:
+            self._task = asyncio.create_task(self._refill_loop())
+
+    def _drop_stale(self):
+        now = time.monotonic()
+        fresh = deque()
+        while self._idle:
+            ws, created = self._idle.popleft()
+            # 接入点进了冷却（比如StartSession超时）或者被热更新去掉时，它上面的预热连接也不再用
+            if (ws.closed or now - created > self.max_age_s or ws.relay_endpoint not in upstream_endpoints.urls
+                    or not upstream_endpoints.healthy(ws.relay_endpoint)):
+                asyncio.create_task(ws.close())
+            else:
+                fresh.append((ws, created))
+        self._idle = fresh
+
+    async def _refill_loop(self):
+        backoff = 1.0
+        while running:
+            self._drop_stale()
+            while len(self._idle) < self.size and running:
+                try:
+                    start = time.monotonic()
+                    ws = await open_doubao_connection()
+                    self._idle.append((ws, time.monotonic()))
+                    backoff = 1.0
+                    logger.info(f"🔥 预热连接就绪 ({len(self._idle)}/{self.size})，"
+                                f"建连耗时 {(time.monotonic() - start) * 1000:.0f}ms")
+                except Exception as e:
+                    logger.warning(f"预热连接失败，{backoff:.0f}秒后重试: {e}")
+                    await asyncio.sleep(backoff)
+                    backoff = min(backoff * 2, 30.0)
+            # 池满后等待取用，或定期检查连接年龄
+            self._wakeup.clear()
+            try:
+                await asyncio.wait_for(self._wakeup.wait(), timeout=self.max_age_s / 4)
+            except asyncio.TimeoutError:
+                pass
+
+    def discard_idle(self):
+        """
+        关闭所有空闲的预热连接，后台任务按当前配置重新建
+        """
+        while self._idle:
+            ws, _ = self._idle.popleft()
+            asyncio.create_task(ws.close())
+        self._wakeup.set()
+
+    async def acquire(self):
+        """
+        取一条可以发StartSession的连接，返回(连接, 是否来自预热池)
+
+        池空时现场建连，RELAY_UPSTREAM_PIPELINE时不等StartConnection的确认
+        """
+        self._drop_stale()
+        conn = None
+        if self._idle:
+            conn, _ = self._idle.popleft()
+            self.hits += 1
+        self._wakeup.set()  # 让后台任务补充
+        pooled = conn is not None
+        if conn is None:
+            self.misses += 1
+            conn = await open_doubao_connection(pipelined=RELAY_UPSTREAM_PIPELINE)
+        logger.info(f"📊 预热池: 命中{self.hits}次, 现场建连{self.misses}次, 剩余{len(self._idle)}条")
+        return conn, pooled
+
+    async def close(self):
+        if self._task:
+            self._task.cancel()
+            self._task = None
+        while self._idle:
+            ws, _ = self._idle.popleft()
+            try:
+                await ws.close()
+            except Exception:
+                pass
+
+
+warm_pool = DoubaoWarmPool(WARM_POOL_SIZE, WARM_POOL_MAX_AGE_S)
+doubao_mux = DoubaoMux(warm_pool, MAX_SESSIONS_PER_UPSTREAM,
+                       UpstreamAdmission(RELAY_MAX_UPSTREAM_SESSIONS, RELAY_UPSTREAM_QUEUE, RELAY_UPSTREAM_WAIT_S))
+
+
+class ParkedUpstream:
+    """
+    🔌 设备断开时暂存的豆包会话和重连后还要用的连接状态
+    """
+
+    __slots__ = ("conn", "queue", "session_id", "tts_format", "speech_end_silence_ms", "last_reply", "mid_reply",
+                 "timer", "sleeping", "reply", "reply_index", "downlink_codec", "pending")
+
+    def __init__(self, conn, queue, session_id: str, tts_format: str, speech_end_silence_ms: int,
+                 last_reply, mid_reply: bool, reply=(), reply_index=(), downlink_codec: str = "", pending: bytes = b""):
+        self.conn = conn
+        self.queue = queue
+        self.session_id = session_id
+        self.tts_format = tts_format
+        self.speech_end_silence_ms = speech_end_silence_ms
+        self.last_reply = last_reply
+        self.mid_reply = mid_reply      # 断开时回复还没发完：能续播就接着发，否则剩下的TTS音频重连后丢弃
+        self.timer = None
+        self.sleeping = False           # 设备进了深度睡眠，醒来的hello要带上对得上的resume.session
+        # 🔌 续播用：本轮已经下发（或正要下发）的消息、它们的(seq, 样本数)、下行编码、还没攒够一块的PCM
+        self.reply = list(reply)
+        self.reply_index = list(reply_index)
+        self.downlink_codec = downlink_codec
+        self.pending = pending
+
+    def resume_from(self, seq: int, unplayed: int) -> Optional[int]:
+        """
+        设备最后收到seq、还有unplayed个样本没播：返回要从第几条消息接着发（找不到seq时返回None）
+        """
+        if len(self.reply_index) != len(self.reply):
+            return None
+        for i in range(len(self.reply_index) - 1, -1, -1):
+            if self.reply_index[i][0] == seq & 0xFFFF:
+                break
+        else:
+            return None
+        # 往回数掉没播的样本，落在哪一条里就从那一条开始（那一条会重复播一部分）
+        start = i + 1
+        while unplayed > 0 and start > 0:
+            start -= 1
+            unplayed -= self.reply_index[start][1]
+        return start
+
+
+class UpstreamRegistry:
+    """
+    🔌 按device_id暂存断开设备的豆包会话，RELAY_RESUME_GRACE_S内同一设备重连时交给新连接
+
+    active记录每台设备当前的连接（hello之后）：新连接到来时旧连接可能还没发现断开，
+    调用它登记的detach协程立即交出会话。
+    """
+
+    def __init__(self, grace_s: float):
+        self.grace_s = grace_s
+        self.parked: Dict[str, ParkedUpstream] = {}
+        self.active: Dict[str, Any] = {}
+
+    def park(self, device_id: str, parked: ParkedUpstream, sleep_hold_s: float = 0):
+        """
+        sleep_hold_s > 0时设备是去深度睡眠了：按它暂存，醒来要核对resume.session
+        """
+        previous = self.parked.pop(device_id, None)
+        if previous is not None:
+            previous.timer.cancel()
+            asyncio.create_task(self._finish(previous, "被新暂存的会话替换"))
+        hold_s = sleep_hold_s if sleep_hold_s > 0 else self.grace_s
+        parked.sleeping = sleep_hold_s > 0
+        parked.timer = asyncio.create_task(self._expire(device_id, parked, hold_s))
+        self.parked[device_id] = parked
+        reason = "进入深度睡眠" if parked.sleeping else "断开"
+        logger.info(f"🔌 设备 {device_id} {reason}，豆包会话 {parked.session_id} 暂存{hold_s:g}秒等它重连")
+
+    async def _expire(self, device_id: str, parked: ParkedUpstream, hold_s: float):
+        await asyncio.sleep(hold_s)
+        if self.parked.get(device_id) is parked:
+            del self.parked[device_id]
+            METRIC_RESUME.inc(result="expired")
+            await self._finish(parked, f"设备 {device_id} {hold_s:g}秒内没有重连")
+
+    async def _finish(self, parked: ParkedUpstream, reason: str):
+        try:
+            await doubao_mux.close_session(parked.conn, parked.session_id)
+        except Exception as e:
+            logger.debug(f"结束暂存的豆包会话时出错: {e}")
+        logger.info(f"💤 暂存的豆包会话 {parked.session_id} 已结束（{reason}）")
+
+    async def resume(self, device_id: str, token: str = "") -> Optional[ParkedUpstream]:
+        """
+        取走设备暂存的会话（没有或者暂存期间豆包连接断了时返回None）；断开期间到达的响应丢弃。
+        深度睡眠暂存的会话只交给带着同一个session（token）醒来的hello
+        """
+        parked = self.parked.pop(device_id, None)
+        if parked is None:
+            return None
+        parked.timer.cancel()
+        if parked.sleeping and token != parked.session_id:
+            METRIC_RESUME.inc(result="stale")
+            await self._finish(parked, "醒来的hello没有带上对应的session")
+            return None
+        alive = not parked.conn.closed
+        while alive and not parked.queue.empty():
+            if parked.queue.get_nowait() is None:
+                alive = False
+        if not alive:
+            METRIC_RESUME.inc(result="dead")
+            await self._finish(parked, "暂存期间豆包连接已断开")
+            return None
+        METRIC_RESUME.inc(result="resumed")
+        return parked
+
+    async def close(self):
+        while self.parked:
+            _, parked = self.parked.popitem()
+            parked.timer.cancel()
+            await self._finish(parked, "服务器关闭")
+
+
+upstream_registry = UpstreamRegistry(RELAY_RESUME_GRACE_S)
+
 
 async def handle_esp32_client(websocket, path):
     """
@@ -281,87 +4691,1365 @@ async def handle_esp32_client(websocket, path):
         websocket: WebSocket连接对象
         path: 请求路径
     """
+    global active_clients, ota_downloads
     client_address = websocket.remote_address
     logger.info(f"🔗 ESP32客户端连接: {client_address}")
+    if RELAY_MAX_DEVICES > 0 and active_clients >= RELAY_MAX_DEVICES:
+        # 🚦 连接数已满：不开豆包会话，回busy后断开，设备按重连退避稍后再来
+        logger.warning(f"🚦 已有{active_clients}个连接，拒绝 {client_address}")
+        METRIC_BUSY.inc(reason="devices")
+        await safe_send(websocket, esp32_json({"type": "busy", "reason": "devices"}))
+        await websocket.close()
+        return
+    active_clients += 1
+    connected_devices.add(websocket)
+    if RELAY_DSCP:
+        set_socket_dscp(websocket.transport.get_extra_info("socket"), RELAY_DSCP)    # 📶 下行音频走WMM语音队列
     
     # 初始化变量
     doubao_ws = None
-    audio_stream_buffer = b''  # 音频流缓冲区
+    upstream = None
+    responses = None
+    tts_format = ""
+    upstream_ready = asyncio.Event()    # 有豆包会话；会话超时释放后清除，新会话开始后置位
+    last_activity = time.monotonic()    # 最近一次上行或下行音频，RELAY_SESSION_IDLE_S按它判断
+    session_id = ""
+    device_id = ""      # hello里的设备ID，断开时按它暂存豆包会话
+    audio_stream_buffer = StreamBuffer()  # 音频流缓冲区
+    resampler = None  # 下行24kHz→16kHz，跨包保留滤波状态；透传格式时为None
+    downlink_cpu = CpuLane()  # resampler和adpcm_encoder只通过它调用，保证按顺序执行
     tasks = []  # 存储任务引用以便正确清理
+    uplink_codec = "pcm"  # 上行编码格式，ESP32发送hello后协商
+    opus_decoder = None
+    adpcm_encoder = None  # 下行ADPCM编码器，协商成功后创建
+    downlink_passthrough = False  # 协商了f32_24k：豆包音频原样下发，ESP32自己重采样
+    tts_interrupted = False  # ESP32打断了当前回复，丢弃剩余TTS音频直到新一轮识别结束
+    # 下行流控：ESP32上报 已收到字节数+抖动缓冲区剩余字节数，已发送不能超过两者之和
+    # 没收到过credit（旧固件）时为None，退回固定节奏发送
+    credit_limit = None
+    downlink_sent = 0
+    credit_event = asyncio.Event()
+    # ⏱️ 本轮各节点的时间（monotonic秒），559时输出一行耗时日志，和ESP32上报的trace按(session, turn)对齐
+    turn_trace = {}
+    trace_turn = 0
+    # 🔁 本轮和上一轮发给ESP32的下行音频（已编码），ESP32本地识别到"再说一遍"时直接重发
+    current_reply = []
+    last_reply = []
+    reply_index = []    # 🔌 current_reply每条消息的(下行seq, 16kHz样本数)，协商了帧头时才有
+    resume_reply = None     # 🔌 接上的暂存会话断开时回复没发完：hello里决定接着发还是丢弃
+    reply_resumed = asyncio.Event()     # 🔌 续播的消息发完之前不转发新的TTS
+    reply_resumed.set()
+    # 💾 回复缓存：本轮的缓存键（不缓存时为None）、已下发的PCM、是否已经从缓存回复
+    cache_key = None
+    reply_pcm = []
+    cached_turn = False
+    flight = None       # 🛫 本轮领头生成的回复（同一问题的其他会话跟着下发）
+    session_turns = 0   # 这个豆包会话已经答完的轮数（0=还没有上下文）
+    # 📦 hello里协商了二进制控制帧后，ready/tts_end/pong/interrupt_ack改用二进制帧发送
+    binary_control = False
+    ctrl_seq = 0
+    experiment = ""     # 🎚️ 设备确认的运行时参数组，附在STATS日志里
+    hello_version = 0   # 🤝 协商出的hello协议版本（0=还没收到hello）
+    device_features = set()     # 🤝 双方都同意的可选行为
+    soak = None         # 🔥 浸泡测试设备：SOAK_PROFILES里的配置，不开豆包会话
+    soak_reply = None   # 🔥 正在下发的合成回复
+    device_fw = {}      # 📦 hello里的固件信息
+    ota_state = ""      # 📦 本连接的升级进度：""=还没下发，"offered"=占着下载名额，"done"=不再下发
+    recorder = None     # 🎙️ 设置了RELAY_CAPTURE_DIR时录制本连接
+    sched_trace = None  # 🔬 设备发来调度追踪时创建
+    flight_record = None    # 🛩️ 设备上传黑匣子记录时创建
+    net_test = None     # 🛰️ ws模式网络自检进行中时的服务器端
+    udp_link = None     # 📡 hello里同意了UDP音频通道时的UdpLink
+    # 🧾 hello里协商了帧头后，上行音频按序号检查、下行音频加帧头
+    audio_framing = False
+    uplink_tracker = FrameTracker()
+    downlink_codec = "pcm"
+    downlink_seq = 0
+    downlink_timestamp_bytes = 0    # 本段回复已发出的负载字节数，换算成16kHz时间戳
+    downlink_stream_start = True    # 下一条下行音频是新一段回复的开头
+    reply_head = True               # ⚡ 本段回复还没有下发过音频，下一个TTS包走首包快速通道
+    frame_ms = AUDIO_FRAME_DEFAULT_MS       # 🕐 设备的帧时长，下行消息都是它的整数倍
+    chunk_ms = downlink_chunk_ms(None)      # 稳定块时长，hello里按设备的抖动缓冲目标协商
+    uplink_log = SampledLog(logging.INFO, f"🎵 {client_address} 转发音频到豆包")
+    downlink_log = SampledLog(logging.DEBUG, f"🔊 {client_address} 发送音频到ESP32")
+    busy_until = 0.0    # 🚦 回过busy的时间+BUSY_RETRY_S，之前旧固件的音频不再重试开会话
+    speech_end_silence_ms = relay_config.current.speech_end_silence_ms     # 🔁 按当前豆包会话开始时的配置
+    wake_verify = False     # 🛡️ hello协商了唤醒二次确认
+    wake_check = None       # 🛡️ 这次唤醒还没复核完（或没通过）的WakeCheck
+    sleep_hold_s = 0.0      # 🌙 ESP32说了要去深度睡眠：断开后会话按这个时长暂存
+    wake_lost = False       # 🏠 这次唤醒仲裁输给了同一房间的另一台设备，直到下一次session_start都丢弃上行
+    wake_trial = None       # 📈 自动调阈值：这次唤醒后面还没等到问题
+    warmup_open = None      # 🔥 正在开预热会话的任务
+    endpointer = None       # 🎯 设备没有VAD时由中继判断说完（hello里决定）
+    end_window_ms = 0       # 这台设备的ASR结束平滑窗口（0=按会话配置）
+    end_window_adapt = False    # 📏 开会话时按学到的停顿调整窗口（hello里自己指定了窗口的不调整）
+    pause_meter = None      # 📏 测这台设备的说话停顿
+    speech_detector = None  # 上面两个共用的上行VAD
+    warmup_expiry = None    # 🔥 预热会话开好了、还没被唤醒用上：到时释放它的任务
+    memory_peak = 0         # 🧮 本连接缓冲区占用的峰值
+    # 💰 本轮账单的起点（上轮tts_end时的累计值）和本轮从豆包收到的字节
+    cost_start = {"upstream_out": 0, "cpu_s": 0.0, "loop_s": 0.0}
+    cost_upstream_in = 0
+    memory_log = SampledLog(logging.WARNING, f"🧮 {client_address} 超过会话内存上限，裁掉回复音频")
+
+    def on_downlink_drop(nbytes: int):
+        # 📮 发送队列丢掉的音频设备收不到，也不会计入它上报的额度，从已发送里扣掉
+        nonlocal downlink_sent
+        downlink_sent = max(0, downlink_sent - nbytes)
+
+    sender = DeviceSender(websocket, f"{client_address[0]}:{client_address[1]}" if client_address else "",
+                          RELAY_SEND_QUEUE_BYTES, on_downlink_drop)
+    device_senders[websocket] = sender
+    fair_lane = fair_scheduler.open(sender.name)     # ⚖️ 本连接的任务在事件循环上的时间
+    uplink_writer = UpstreamWriter(f"{client_address[0]}:{client_address[1]}" if client_address else "",
+                                   RELAY_UPLINK_QUEUE_FRAMES, RELAY_UPLINK_BATCH_MS * ESP32_SAMPLE_RATE * 2 // 1000,
+                                   RELAY_UPLINK_LATENCY_MS / 1000)
+
+    def trace_mark(point: str):
+        turn_trace.setdefault(point, time.monotonic())
+
+    def trace_span(start: str, end: str) -> int:
+        if start not in turn_trace or end not in turn_trace:
+            return -1
+        return round((turn_trace[end] - turn_trace[start]) * 1000)
+
+    def archive_name(direction: str) -> str:
+        # 🗄️ 和TRACE日志的(session, turn)对应：本轮还没结束，轮次是trace_turn + 1
+        return f"{session_id[:8]}-t{trace_turn + 1}-{direction}"
+
+    def archive(direction: str, pcm):
+        if audio_archiver.enabled and session_id:
+            audio_archiver.submit(archive_name(direction), pcm)
+
+    def finish_archive():
+        if audio_archiver.enabled and session_id:
+            audio_archiver.finish(archive_name("up"))
+            audio_archiver.finish(archive_name("down"))
     
+    async def open_upstream(new_session_id: str, wait: bool = True):
+        """
+        在共享的豆包连接上开始新会话（没有空位时从预热池取一条新连接）
+
+        wait: 会话名额满时排队等待（False时直接抛RelayBusy）
+        """
+        nonlocal upstream, responses, tts_format, resampler, doubao_ws, session_id, speech_end_silence_ms
+        nonlocal session_turns
+        bind_start = time.monotonic()
+        config = relay_config.current   # 这次会话按开始时的配置版本补静音
+        window_ms = endpoint_policy.window(device_id, end_window_ms) if end_window_adapt else end_window_ms
+        if window_ms != end_window_ms:
+            logger.info(f"📏 设备 {device_id} 按学到的停顿用结束平滑窗口 {window_ms}ms")
+        METRIC_ENDPOINT_WINDOW.observe((window_ms or config.end_window_ms) / 1000)
+        conn, queue, audio_format = await doubao_mux.open_session(new_session_id, wait, window_ms)
+        if downlink_passthrough and audio_format != tts_format:
+            # ESP32按hello协商的格式解码，换格式只能断开重连重新协商
+            await doubao_mux.close_session(conn, new_session_id)
+            raise SessionRejected(f"新会话的TTS输出格式变成了{audio_format}，和已协商的透传格式不一致")
+        upstream, responses, tts_format, session_id = conn, queue, audio_format, new_session_id
+        session_turns = 0
+        speech_end_silence_ms = config.speech_end_silence_for(window_ms)
+        # 协商到ESP32播放格式时直接透传，否则逐包重采样（每个会话从新的滤波状态开始）
+        resampler = None if tts_format in TTS_PASSTHROUGH_FORMATS or downlink_passthrough else StreamingResampler()
+        doubao_ws = upstream.ws
+        upstream_ready.set()
+        METRIC_UPSTREAM_CONNECT.observe(time.monotonic() - bind_start, stage="session")
+        logger.info(f"⏱️ 豆包会话就绪耗时 {(time.monotonic() - bind_start) * 1000:.0f}ms")
+        logger.info(f"✅ 豆包会话初始化完成，TTS输出格式 {tts_format}")
+
+    def park_upstream() -> bool:
+        """
+        🔌 把豆包会话暂存到upstream_registry等设备重连，返回是否暂存了（不满足条件时由调用者结束会话）
+        """
+        nonlocal upstream, doubao_ws
+        if not device_id or upstream is None or upstream.closed or not running:
+            return False
+        if RELAY_RESUME_GRACE_S <= 0 and sleep_hold_s <= 0:
+            return False
+        upstream_registry.park(device_id, ParkedUpstream(upstream, responses, session_id, tts_format,
+                                                         speech_end_silence_ms, list(last_reply), bool(current_reply),
+                                                         current_reply, reply_index, downlink_codec,
+                                                         audio_stream_buffer.peek()),
+                               sleep_hold_s)
+        upstream = None
+        doubao_ws = None
+        upstream_ready.clear()
+        return True
+
+    async def detach_upstream():
+        """
+        🔌 同一设备从新连接上来了，这条连接其实已经断了：立即交出豆包会话并断开
+        """
+        logger.info(f"🔌 设备 {device_id} 从新连接重连，旧连接 {client_address} 交出豆包会话")
+        park_upstream()
+        try:
+            websocket.transport.abort()
+        except Exception:
+            pass
+
+    async def attach_upstream(resume_token: str = ""):
+        """
+        hello之后绑定豆包会话：同一设备刚断开过（或者从深度睡眠醒来）就接上暂存的会话，否则预开一个新会话
+        （不排队：名额满时设备照常连着，开口时再由ensure_upstream()排队）
+        """
+        nonlocal upstream, responses, tts_format, resampler, doubao_ws, session_id, speech_end_silence_ms
+        nonlocal last_reply, tts_interrupted, resume_reply, session_turns
+        if device_id:
+            previous = upstream_registry.active.get(device_id)
+            if previous is not None and previous is not detach_upstream:
+                await previous()
+            upstream_registry.active[device_id] = detach_upstream
+            parked = await upstream_registry.resume(device_id, resume_token)
+            if parked is not None:
+                upstream, responses, tts_format = parked.conn, parked.queue, parked.tts_format
+                session_id, speech_end_silence_ms = parked.session_id, parked.speech_end_silence_ms
+                last_reply = parked.last_reply
+                session_turns = 1   # 接上的会话之前聊过什么不知道，按有上下文处理
+                if parked.mid_reply and RELAY_DOWNLINK_RESUME and parked.reply_index:
+                    # 🔌 先不转发新的TTS，等hello里的播放位置决定接着发还是丢弃
+                    resume_reply = parked
+                    reply_resumed.clear()
+                else:
+                    tts_interrupted = parked.mid_reply
+                resampler = None if tts_format in TTS_PASSTHROUGH_FORMATS else StreamingResampler()
+                doubao_ws = upstream.ws
+                upstream_ready.set()
+                logger.info(f"🔌 {client_address} 设备 {device_id} 重连，接上暂存的豆包会话 {session_id}")
+                return
+        try:
+            await open_upstream(session_id, wait=False)
+        except RelayBusy as e:
+            logger.warning(f"🚦 {client_address} 暂不预开豆包会话: {e}")
+
     try:
-        # 1. 连接豆包AI服务器
+        # 1. 豆包会话在hello里绑定（同一设备重连时接上暂存的会话）；没有hello的旧固件开口时再开始
         session_id = str(uuid.uuid4())
-        DOUBAO_CONFIG["headers"]["X-Api-Connect-Id"] = str(uuid.uuid4())
-        
-        logger.info("🚀 正在连接豆包服务器...")
-        doubao_ws = await websockets.connect(
-            DOUBAO_CONFIG['base_url'],
-            extra_headers=DOUBAO_CONFIG['headers'],
-            ping_interval=None,
-        )
-        logger.info("✅ 豆包服务器连接成功！")
-        
-        # 2. 初始化豆包AI会话
-        # 2.1 发送StartConnection消息
-        header = create_protocol_header()
-        message = bytearray(header)
-        message.extend((1).to_bytes(4, 'big'))
-        payload = gzip.compress(b"{}")
-        message.extend(len(payload).to_bytes(4, 'big'))
-        message.extend(payload)
+        if RELAY_CAPTURE_DIR:
+            recorder = SessionRecorder.open(RELAY_CAPTURE_DIR, session_id)
         
-        if not doubao_ws.closed:
-            await doubao_ws.send(message)
-            await doubao_ws.recv()  # 接收确认响应
-        
-        # 2.2 发送StartSession消息
-        header = create_protocol_header()
-        message = bytearray(header)
-        message.extend((100).to_bytes(4, 'big'))
-        session_bytes = session_id.encode('utf-8')
-        message.extend(len(session_bytes).to_bytes(4, 'big'))
-        message.extend(session_bytes)
-        payload = gzip.compress(json.dumps(SESSION_CONFIG).encode('utf-8'))
-        message.extend(len(payload).to_bytes(4, 'big'))
-        message.extend(payload)
-        
-        if not doubao_ws.closed:
-            await doubao_ws.send(message)
-            await doubao_ws.recv()  # 接收确认响应
-        logger.info("✅ 豆包会话初始化完成")
-        
-        # 向ESP32发送就绪消息
-        await safe_send(websocket, json.dumps({
-            "type": "ready",
-            "message": "🎤 服务器已就绪，可以开始语音对话"
-        }))
-        
-        # 3. 创建双向数据转发任务
+        # 就绪消息在ESP32的hello之后发出，这时已经知道控制消息用什么格式
+
+        # 2. 创建双向数据转发任务
+        def downlink_silence(pcm_bytes: int) -> bytes:
+            # 和pcm_bytes字节16kHz PCM等长的静音（透传时按24kHz float32）
+            return bytes(pcm_bytes * 3 if downlink_passthrough else pcm_bytes)
+
+        def downlink_bytes_per_ms() -> int:
+            # 16kHz int16；透传时24kHz float32
+            return 96 if downlink_passthrough else 32
+
+        def keep_reply(pcm):
+            # 💾 要缓存的回复留一份PCM，🛫 领头的回复同时交给跟着的会话
+            if len(pcm) and (cache_key or flight is not None):
+                pcm = bytes(pcm)
+                if cache_key:
+                    reply_pcm.append(pcm)
+                if flight is not None:
+                    flight.publish(pcm)
+
+        def end_flight(ok: bool):
+            nonlocal flight
+            if flight is not None:
+                reply_flights.end(flight, ok)
+                flight = None
+
+        async def send_buffered(size: int) -> bool:
+            """
+            从audio_stream_buffer取size字节编码后下发（memoryview切片，不复制）
+            """
+            chunk = audio_stream_buffer.take(size)
+            try:
+                keep_reply(chunk)
+                sent = await send_downlink(await encode_downlink(chunk))
+            finally:
+                chunk.release()
+            if sent:
+                downlink_log.log(size)
+            return sent
+
+        async def encode_downlink(pcm: bytes) -> bytes:
+            # 协商了ADPCM时压缩下行音频（在线程池里按顺序编码），否则直接发送PCM
+            if adpcm_encoder is not None:
+                return await downlink_cpu.run(adpcm_encoder.encode_block, pcm)
+            return pcm
+
+        async def send_esp32(data, kind: int, flags: int = 0) -> bool:
+            """
+            发给ESP32，录制会话时同时写进录制文件（按发出的时间）
+            """
+            if recorder is not None:
+                recorder.record(kind, data, flags)
+            # 📡 下行音频能走UDP就走UDP，WebSocket只剩控制消息
+            if kind == CAP_DOWNLINK_AUDIO and udp_link is not None and udp_link.route(data, sender.pending_bytes() == 0):
+                return True
+            return sender.put(data, droppable=kind == CAP_DOWNLINK_AUDIO)
+
+        async def send_control(msg_type: int, msg: Dict[str, Any], payload: bytes = b"") -> bool:
+            """
+            📦 发送控制消息：协商了二进制控制帧时发msg_type对应的帧，否则发JSON文本msg
+            """
+            nonlocal ctrl_seq, downlink_stream_start, reply_head
+            if msg_type == CTRL_TTS_END:
+                downlink_stream_start = True    # tts_end之后的音频属于下一段回复
+                reply_head = True
+            if binary_control:
+                ctrl_seq += 1
+                return await send_esp32(ctrl_frame(msg_type, ctrl_seq, payload), CAP_DOWNLINK_CONTROL, CAP_FLAG_BINARY)
+            return await send_esp32(esp32_json(msg), CAP_DOWNLINK_CONTROL)
+
+        async def offer_ota(full_image: bool = False):
+            """
+            📦 有新固件且还有下载名额时让设备开始升级
+            """
+            nonlocal ota_state
+            global ota_downloads
+            if ota_state or ota_downloads >= RELAY_OTA_MAX_ACTIVE:
+                return
+            offer = ota_offer(device_fw, full_image)
+            if offer is None:
+                ota_state = "done"
+                return
+            ota_state = "offered"
+            ota_downloads += 1
+            logger.info(f"📦 {client_address} 固件 {device_fw.get('version')} -> {offer['version']}"
+                        f"（{'差分补丁' if offer['delta'] else '完整镜像'}）: {offer['url']}")
+            await send_esp32(esp32_json(offer), CAP_DOWNLINK_CONTROL)
+
+        async def send_downlink(data, record_reply: bool = True, end: bool = False) -> bool:
+            """
+            按ESP32上报的额度发送一条下行音频，额度不够时等待新的credit
+
+            record_reply: 同时记进本轮回复，ESP32本地识别到"再说一遍"时原样重发
+            end: 本段回复的最后一条（只在协商了帧头时有意义，帧头带AUDIO_FLAG_END）
+            """
+            nonlocal downlink_sent, last_activity
+            last_activity = time.monotonic()
+            record = record_reply and len(data) > 0
+            if record:
+                current_reply.append(bytes(data))
+            if audio_framing:
+                data = frame_downlink(data, end)
+                if record:
+                    # 🔌 记下这条的seq和时长，断开重连后按设备播到的位置续播
+                    _, _, seq, _, samples, _ = AUDIO_HEADER.unpack_from(data)
+                    reply_index.append((seq, samples))
+            while credit_limit is not None and downlink_sent + len(data) > credit_limit:
+                credit_event.clear()
+                try:
+                    await asyncio.wait_for(credit_event.wait(), timeout=CREDIT_WAIT_TIMEOUT_S)
+                except asyncio.TimeoutError:
+                    logger.warning(f"⚠️ {CREDIT_WAIT_TIMEOUT_S}秒没有收到下行额度，强制发送")
+                    break
+            flags = CAP_FLAG_ADPCM if adpcm_encoder is not None else CAP_FLAG_F32 if downlink_passthrough else 0
+            if audio_framing:
+                flags |= CAP_FLAG_FRAMED
+            if not await send_esp32(data, CAP_DOWNLINK_AUDIO, flags):
+                return False
+            downlink_sent += len(data)
+            trace_mark("first_downlink")
+            if credit_limit is None:
+                await asyncio.sleep(0.01)  # 旧固件不上报额度，保持原来的发送节奏
+            return True
+
+        def frame_downlink(payload, end: bool = False) -> bytes:
+            """
+            🧾 给一条下行音频加帧头：seq按连接计数，时间戳从本段回复开始按16kHz样本计
+            """
+            nonlocal downlink_seq, downlink_timestamp_bytes, downlink_stream_start
+            flags = AUDIO_FLAG_END if end else 0
+            if downlink_stream_start:
+                flags |= AUDIO_FLAG_START
+                downlink_timestamp_bytes = 0
+                downlink_stream_start = False
+            # 各格式每字节对应的16kHz时长不同：ADPCM块头4字节后每字节2个样本，float32按24kHz每6字节一个
+            length = max(len(payload) - 4, 0) * 4 if downlink_codec == "adpcm" else len(payload)
+            bytes_per_sample = 6 if downlink_codec == "f32_24k" else 2
+            timestamp = downlink_timestamp_bytes // bytes_per_sample
+            downlink_timestamp_bytes += length
+            samples = downlink_timestamp_bytes // bytes_per_sample - timestamp
+            header = AUDIO_HEADER.pack(AUDIO_MAGIC, AUDIO_CODECS[downlink_codec], downlink_seq,
+                                       timestamp & 0xFFFFFFFF, samples, flags)
+            downlink_seq = (downlink_seq + 1) & 0xFFFF
+            return header + payload
+
+        async def replay_last_reply():
+            """
+            🔁 重发上一轮回复（ESP32本地识别到"再说一遍"，不经过豆包）
+            """
+            if not last_reply:
+                logger.info("🔁 没有可以重发的回复")
+            frames = list(last_reply)
+            for i, frame in enumerate(frames):
+                await fair_scheduler.turn(fair_lane)
+                if not await send_downlink(frame, record_reply=False, end=i == len(frames) - 1):
+                    return
+            await send_control(CTRL_TTS_END, {"type": "tts_end", "message": "重发结束"})
+            logger.info(f"🔁 已重发上一轮回复: {len(frames)} 包")
+
+        async def resume_downlink(parked: ParkedUpstream, start: int):
+            """
+            🔌 断开前没播完的回复：从设备播到的那一条接着发，然后放开新的TTS
+            """
+            try:
+                for frame in parked.reply[start:]:
+                    await fair_scheduler.turn(fair_lane)
+                    if not await send_downlink(frame):
+                        return
+                audio_stream_buffer.append(parked.pending)
+            finally:
+                reply_resumed.set()
+            logger.info(f"🔌 已接着断开前的位置续播 {len(parked.reply) - start} 条下行消息"
+                        f"（本轮共 {len(parked.reply)} 条）")
+
+        async def play_cached_reply(pcm: bytes):
+            """
+            💾 缓存命中：按块重放上次的回复，豆包这一轮生成的音频在559之前全部丢弃
+            """
+            nonlocal current_reply, last_reply
+            trace_mark("first_tts")
+            archive("down", pcm)
+            chunk_size = chunk_ms * downlink_bytes_per_ms()
+            for offset in range(0, len(pcm), chunk_size):
+                await fair_scheduler.turn(fair_lane)
+                if tts_interrupted:
+                    return
+                last = offset + chunk_size >= len(pcm)
+                if not await send_downlink(await encode_downlink(pcm[offset:offset + chunk_size]), end=last):
+                    return
+            # 旧固件没有结束标记：和正常回复一样补一段静音再结束
+            if not audio_framing and not await send_downlink(await encode_downlink(downlink_silence(1024))):
+                return
+            await send_control(CTRL_TTS_END, {"type": "tts_end", "message": "缓存回复结束"})
+            trace_mark("tts_end")
+            last_reply, current_reply = current_reply, []
+            reply_index.clear()
+            logger.info(f"💾 CACHE 命中，已重放 {len(pcm)} 字节"
+                        f"（累计命中{response_cache.hits}次/未命中{response_cache.misses}次）")
+
+        async def play_flight_reply(joined: ReplyFlight):
+            """
+            🛫 同一个问题别的会话正在回答：跟着它的回复按自己的额度下发，豆包这一路生成的音频在559之前全部丢弃
+            """
+            nonlocal current_reply, last_reply
+            trace_mark("first_tts")
+            sent = 0
+            try:
+                while True:
+                    pcm = await joined.read(sent)
+                    if pcm is None or tts_interrupted:
+                        break
+                    sent += 1
+                    archive("down", pcm)
+                    if not await send_downlink(await encode_downlink(pcm)):
+                        return
+            finally:
+                joined.subscribers -= 1
+            if tts_interrupted:
+                return
+            if joined.aborted:
+                logger.info("🛫 领头的回复中断了，这轮回复到此结束")
+            if audio_framing:
+                if not await send_downlink(b"", end=True):
+                    return
+            elif not await send_downlink(await encode_downlink(downlink_silence(1024))):
+                return
+            await send_control(CTRL_TTS_END, {"type": "tts_end", "message": "跟随回复结束"})
+            trace_mark("tts_end")
+            last_reply, current_reply = current_reply, []
+            reply_index.clear()
+            METRIC_SINGLEFLIGHT.inc(result="joined")
+            logger.info(f"🛫 跟着同一问题的另一路回复下发了 {sent} 块")
+
+        async def send_reply_eta(ms: int):
+            """
+            ⏳ 告诉设备这一轮大概多久才有第一条下行音频（设备据此决定要不要提前播"思考中"提示音）
+            """
+            if "reply_eta" in device_features and RELAY_REPLY_ETA_ALPHA > 0:
+                await send_esp32(esp32_json({"type": "reply_eta", "ms": ms}), CAP_DOWNLINK_CONTROL)
+
+        def settle_wake(real: bool):
+            """
+            📈 这次唤醒定性了（后面有问题=真唤醒），计入现场的误唤醒统计
+            """
+            nonlocal wake_trial
+            if wake_trial is not None:
+                wake_tuner.settle(wake_trial, real)
+                wake_trial = None
+
+        def begin_reply(text: str):
+            """
+            👤 这一轮的问题定下来了（ASR最终结果或设备发来的文字问题）：新一轮回复从这里开始，
+            缓存里有就直接回，同一问题有别的会话在生成就跟着下发，否则领头生成
+            """
+            if text.strip():
+                settle_wake(True)
+            nonlocal cache_key, cached_turn, flight
+            current_reply.clear()
+            reply_index.clear()
+            reply_pcm.clear()
+            end_flight(False)       # 上一轮没等到559
+            # 缓存的是16kHz PCM，透传的会话不读写缓存
+            reply_key = ResponseCache.key_for(text) if not downlink_passthrough else None
+            cache_key = reply_key if response_cache.enabled else None
+            cached = response_cache.get(cache_key) if cache_key else None
+            # 🛫 有上下文的会话，回答可能跟前面聊的有关
+            context_free = RELAY_SINGLEFLIGHT_CONTEXT == "any" or session_turns == 0
+            joined = (reply_flights.join(reply_key)
+                      if cached is None and reply_key and RELAY_SINGLEFLIGHT and context_free
+                      else None)
+            if cached is not None or joined is not None:
+                # ⏳ 马上就有音频：撤回说完时的预估，这一轮也不算进reply_eta
+                trace_mark("reply_cached")
+                tasks.append(asyncio.create_task(send_reply_eta(0)))
+            if cached is not None:
+                cached_turn = True
+                cache_key = None
+                tasks.append(asyncio.create_task(fair_lane.wrap(play_cached_reply(cached))))
+            elif joined is not None:
+                cached_turn = True
+                cache_key = None
+                tasks.append(asyncio.create_task(fair_lane.wrap(play_flight_reply(joined))))
+            elif reply_key and RELAY_SINGLEFLIGHT and context_free:
+                flight = reply_flights.lead(reply_key)
+
+        async def play_soak_reply(profile: Dict[str, Any]):
+            """
+            🔥 浸泡测试：等一段随机的"思考"时间，按配置突发、抖动地下发一段合成回复，然后tts_end
+            """
+            nonlocal current_reply, last_reply, tts_interrupted
+            tts_interrupted = False
+            await asyncio.sleep(random.uniform(*RELAY_SOAK_THINK_MS) / 1000)
+            trace_mark("first_tts")
+            reply_ms = random.randint(*RELAY_SOAK_REPLY_MS)
+            pcm = soak_tone(reply_ms, downlink_passthrough)
+            chunk_size = chunk_ms * downlink_bytes_per_ms()
+            burst = max(1, int(profile["burst"]))
+            drop_at = random.randrange(0, len(pcm)) if random.random() < profile["drop_p"] else -1
+            for index, offset in enumerate(range(0, len(pcm), chunk_size)):
+                if profile["jitter_ms"] > 0:
+                    await asyncio.sleep(random.uniform(0, profile["jitter_ms"]) / 1000)
+                await fair_scheduler.turn(fair_lane)
+                if tts_interrupted:
+                    return
+                if 0 <= drop_at < offset + chunk_size:
+                    logger.info(f"🔥 {client_address} 浸泡测试在回复中途断开连接")
+                    await websocket.close(1011, "soak drop")
+                    return
+                last = offset + chunk_size >= len(pcm)
+                if not await send_downlink(await encode_downlink(pcm[offset:offset + chunk_size]), end=last):
+                    return
+                # 一组发完停这一组的时长：平均速度是实时，抖动缓冲区要顶住突发和空档
+                if (index + 1) % burst == 0:
+                    await asyncio.sleep(burst * chunk_ms / 1000)
+            if not audio_framing and not await send_downlink(await encode_downlink(downlink_silence(1024))):
+                return
+            await send_control(CTRL_TTS_END, {"type": "tts_end", "message": "浸泡测试回复结束"})
+            trace_mark("tts_end")
+            last_reply, current_reply = current_reply, []
+            reply_index.clear()
+            logger.info(f"🔥 {client_address} 浸泡回复 {reply_ms} ms，说完到第一块"
+                        f" {trace_span('speech_end', 'first_tts')} ms")
+
+        async def ensure_upstream():
+            """
+            💬 会话超时释放后ESP32又开始说话：开始新的豆包会话，把新会话ID告诉ESP32（用于对齐延迟日志）
+            """
+            nonlocal busy_until, warmup_expiry
+            if soak is not None:
+                return      # 🔥 浸泡测试不用豆包
+            if warmup_open is not None:
+                # 🔥 预热会话还在开：等它开好直接用，不再开第二个
+                await warmup_open
+            if warmup_expiry is not None:
+                warmup_expiry.cancel()
+                warmup_expiry = None
+                if upstream is not None:
+                    METRIC_WARMUP.inc(result="used")
+                    logger.info(f"🔥 {client_address} 唤醒用上了预热的豆包会话")
+            if upstream is not None or time.monotonic() < busy_until:
+                return
+            try:
+                await open_upstream(str(uuid.uuid4()))
+            except RelayBusy as e:
+                # 🚦 排队也没排上：告诉ESP32结束这次唤醒（本地播报），这段时间的音频丢弃
+                logger.warning(f"🚦 {client_address} {e}，回复busy")
+                METRIC_BUSY.inc(reason="upstream")
+                busy_until = time.monotonic() + BUSY_RETRY_S
+                await send_esp32(esp32_json({"type": "busy", "reason": "upstream"}), CAP_DOWNLINK_CONTROL)
+                return
+            except Exception as e:
+                logger.warning(f"⚠️ {client_address} 重新开始豆包会话失败，断开连接: {e}")
+                raise
+            await send_esp32(esp32_json({"type": "session", "session": session_id}), CAP_DOWNLINK_CONTROL)
+
+        async def warm_upstream():
+            """
+            🔥 ESP32听到了可能是唤醒词的声音：先开好豆包会话（不排队），RELAY_WARMUP_S秒内没被唤醒用上就释放
+            """
+            nonlocal warmup_open, warmup_expiry, last_activity
+            try:
+                await open_upstream(str(uuid.uuid4()), wait=False)
+            except RelayBusy:
+                METRIC_WARMUP.inc(result="busy")
+                return
+            except Exception as e:
+                logger.debug(f"预热豆包会话失败: {e}")
+                METRIC_WARMUP.inc(result="error")
+                return
+            finally:
+                warmup_open = None
+            last_activity = time.monotonic()    # 别让空闲释放抢在唤醒之前
+            METRIC_WARMUP.inc(result="opened")
+            await send_esp32(esp32_json({"type": "session", "session": session_id}), CAP_DOWNLINK_CONTROL)
+            warmup_expiry = asyncio.create_task(expire_warmup())
+            tasks.append(warmup_expiry)
+
+        async def expire_warmup():
+            nonlocal warmup_expiry
+            await asyncio.sleep(RELAY_WARMUP_S)
+            warmup_expiry = None
+            METRIC_WARMUP.inc(result="expired")
+            await release_upstream(f"预热后{RELAY_WARMUP_S:.0f}秒没有唤醒")
+
+        async def release_upstream(reason: str):
+            """
+            💤 结束豆包会话、腾出上游名额，ESP32连接保持，下次唤醒时由ensure_upstream()重新开始
+            """
+            nonlocal upstream, doubao_ws, cache_key, downlink_stream_start, reply_head
+            if upstream is None:
+                return
+            conn, queue = upstream, responses
+            finish_archive()
+            upstream = None
+            doubao_ws = None
+            upstream_ready.clear()
+            # 上一轮留下的只有"再说一遍"要用的last_reply，其余按新会话重来
+            cache_key = None
+            end_flight(False)
+            reply_pcm.clear()
+            current_reply.clear()
+            reply_index.clear()
+            audio_stream_buffer.clear()
+            turn_trace.clear()
+            downlink_stream_start = True
+            reply_head = True
+            queue.put_nowait(SESSION_RELEASED)
+            try:
+                await doubao_mux.close_session(conn, session_id)
+            except Exception as e:
+                logger.debug(f"结束豆包会话时出错: {e}")
+            logger.info(f"💤 {client_address} 豆包会话已释放（{reason}），ESP32连接保持")
+
+        async def release_idle_upstream():
+            """
+            💤 旧固件不发session_end：上下行都空闲超过RELAY_SESSION_IDLE_S时服务器自己释放豆包会话
+            """
+            while True:
+                await asyncio.sleep(min(RELAY_SESSION_IDLE_S, 10.0))
+                if upstream is not None and time.monotonic() - last_activity >= RELAY_SESSION_IDLE_S:
+                    await release_upstream(f"{RELAY_SESSION_IDLE_S:.0f}秒没有音频")
+
+        def memory_usage() -> int:
+            """
+            🧮 这个会话占着的缓冲区字节数（发送队列、下行缓冲、排着的TTS、回复副本、还没读的设备消息）
+            """
+            pending = getattr(websocket, "messages", ())
+            return (sender.pending_bytes() + len(audio_stream_buffer)
+                    + (responses.audio_bytes if isinstance(responses, ResponseQueue) else 0)
+                    + sum(len(c) for c in current_reply) + sum(len(c) for c in last_reply)
+                    + sum(len(c) for c in reply_pcm) + sum(len(m) for m in pending))
+
+        def trim_memory(used: int):
+            """
+            🧮 超过RELAY_SESSION_BUDGET_BYTES：先裁掉少了也能正常对话的副本，最后才丢排着的TTS音频
+            """
+            nonlocal cache_key
+            trimmed = 0
+
+            def drop(what: str, nbytes: int):
+                nonlocal trimmed
+                if nbytes:
+                    METRIC_MEMORY_TRIMMED.inc(nbytes, what=what)
+                    trimmed += nbytes
+
+            if used - trimmed > RELAY_SESSION_BUDGET_BYTES and last_reply:
+                drop("last_reply", sum(len(c) for c in last_reply))     # ESP32的"再说一遍"这次没得重发
+                last_reply.clear()
+            if used - trimmed > RELAY_SESSION_BUDGET_BYTES and reply_pcm:
+                drop("reply_cache", sum(len(c) for c in reply_pcm))     # 这一轮不缓存了
+                reply_pcm.clear()
+                cache_key = None
+            if used - trimmed > RELAY_SESSION_BUDGET_BYTES and current_reply:
+                drop("reply_copy", sum(len(c) for c in current_reply))  # 断开重连时不续播这一轮
+                current_reply.clear()
+                reply_index.clear()
+            if used - trimmed > RELAY_SESSION_BUDGET_BYTES and isinstance(responses, ResponseQueue):
+                drop("tts_queue", responses.trim())
+            if trimmed:
+                memory_log.log(trimmed)
+
+        async def enforce_memory_budget():
+            """
+            🧮 每RELAY_MEMORY_CHECK_S秒统计一次本连接的缓冲区，超过上限时裁掉
+            """
+            nonlocal memory_peak
+            while True:
+                await asyncio.sleep(RELAY_MEMORY_CHECK_S)
+                used = memory_usage()
+                if RELAY_SESSION_BUDGET_BYTES > 0 and used > RELAY_SESSION_BUDGET_BYTES:
+                    trim_memory(used)
+                    used = memory_usage()
+                memory_peak = max(memory_peak, used)
+                session_memory[websocket] = used
+
+        async def move_on_drain():
+            """
+            🚚 进程要退出（滚动重启）：等这一轮对话结束，让设备错开一会儿重连到新进程
+            """
+            while running:
+                await asyncio.sleep(0.5)
+            deadline = time.monotonic() + max(0.0, RELAY_DRAIN_TIMEOUT_S - 2)
+            while time.monotonic() - last_activity < RELAY_MOVE_IDLE_S and time.monotonic() < deadline:
+                await asyncio.sleep(0.2)
+            reason = "idle" if time.monotonic() < deadline else "timeout"
+            delay_ms = random.randint(0, max(0, RELAY_MOVE_SPREAD_MS))
+            METRIC_MOVE.inc(reason=reason)
+            logger.info(f"🚚 {client_address} 服务器重启，{delay_ms}ms后重连"
+                        f"{'' if reason == 'idle' else '（排空快到时限，没等这一轮结束）'}")
+            if "move" in device_features:
+                await send_esp32(esp32_json({"type": "move", "delay_ms": delay_ms}), CAP_DOWNLINK_CONTROL)
+                await sender.flush(1.0)
+            else:
+                # 旧固件按自己的退避重连，断开的时间错开
+                await asyncio.sleep(max(0.0, min(delay_ms / 1000, deadline + 1 - time.monotonic())))
+            await websocket.close(1012, "service restart")
+
+        async def udp_feedback():
+            """
+            📡 每RELAY_UDP_REPORT_S告诉设备上行收到了多少条；下行走UDP时设备太久没有报告就退回WebSocket
+            """
+            while True:
+                await asyncio.sleep(RELAY_UDP_REPORT_S)
+                link = udp_link
+                if link is None:
+                    continue
+                if link.down_ready:
+                    # 没在说话时也发：设备按多久没收到报告判断服务器还收不收得到
+                    await send_esp32(esp32_json(link.report()), CAP_DOWNLINK_CONTROL)
+                if link.down_active and time.monotonic() - link.last_report > RELAY_UDP_REPORT_TIMEOUT_S:
+                    link.fall_back("timeout")
+                    await send_esp32(esp32_json({"type": "udp_report", "down": False}), CAP_DOWNLINK_CONTROL)
+
+        async def device_messages():
+            """
+            📡 WebSocket消息和UDP上行音频合成一个流（协商了UDP之后两边都可能来音频）
+            """
+            ws_recv = udp_get = None
+            udp_from = None
+            try:
+                while True:
+                    if ws_recv is None:
+                        ws_recv = asyncio.ensure_future(websocket.recv())
+                    if udp_get is not None and udp_from is not udp_link:
+                        udp_get.cancel()    # 重新hello换了通道
+                        udp_get = None
+                    if udp_get is None and udp_link is not None:
+                        udp_from = udp_link
+                        udp_get = asyncio.ensure_future(udp_from.inbox.get())
+                    waiting = (ws_recv,) if udp_get is None else (ws_recv, udp_get)
+                    done, _ = await asyncio.wait(waiting, return_when=asyncio.FIRST_COMPLETED)
+                    if udp_get is not None and udp_get in done:
+                        item, udp_get = udp_get.result(), None
+                        yield item
+                    if ws_recv in done:
+                        try:
+                            item = ws_recv.result()
+                        except websockets.exceptions.ConnectionClosedOK:
+                            return
+                        ws_recv = None
+                        yield item
+            finally:
+                for task in (ws_recv, udp_get):
+                    if task is not None and not task.done():
+                        task.cancel()
+
         async def forward_esp32_to_doubao():
             """
             转发ESP32音频数据到豆包AI
             """
+            nonlocal uplink_codec, opus_decoder, adpcm_encoder, tts_interrupted, credit_limit, cache_key
+            nonlocal binary_control, downlink_passthrough, resampler, audio_framing, downlink_codec, downlink_stream_start
+            nonlocal reply_head, chunk_ms, frame_ms
+            nonlocal last_activity, experiment, device_fw, ota_state, busy_until, sched_trace, flight_record, net_test
+            nonlocal wake_verify, wake_check, wake_lost, wake_trial, device_id, sleep_hold_s, warmup_open, resume_reply
+            nonlocal hello_version, device_features, udp_link, downlink_sent, soak, soak_reply
+            nonlocal endpointer, end_window_ms, end_window_adapt, pause_meter, speech_detector
+            global ota_downloads
+
+            async def finish_speech(reason: str) -> bool:
+                """
+                🤫 这句话说完了：一次性补齐ASR结束平滑窗口的静音，让豆包立即结束本轮识别（写任务结束了返回False）
+                """
+                trace_mark("speech_end")
+                await send_reply_eta(reply_eta.estimate())
+                if pause_meter is not None:
+                    pause_meter.speech_end()
+                chunk = bytes(ESP32_SAMPLE_RATE * 2 * SPEECH_END_SILENCE_CHUNK_MS // 1000)
+                silence = create_audio_message(session_id, chunk, compress=True)
+                # 📤 排在这句话还没写出去的音频后面
+                if not await uplink_writer.put(doubao_ws, session_id, messages=[silence] * (
+                        speech_end_silence_ms // SPEECH_END_SILENCE_CHUNK_MS)):
+                    return False
+                logger.info(f"🤫 {reason}，补发 {speech_end_silence_ms}ms 静音")
+                return True
+
+            async def finish_wake_check() -> Optional[bytes]:
+                """
+                🛡️ 唤醒词收齐（或等超时）：复核并把结果告诉ESP32，通过时返回攒下的后续音频，没通过返回None
+                """
+                nonlocal wake_check
+                check = wake_check
+                score = None
+                if len(check.clip) >= check.clip_samples * 2:
+                    try:
+                        score = await downlink_cpu.run(WAKE_VERIFIER.score, bytes(check.clip))
+                    except Exception as e:
+                        logger.warning(f"⚠️ {client_address} 唤醒二次确认出错，放行: {e}")
+                        METRIC_WAKE_VERIFY.inc(result="error")
+                    else:
+                        METRIC_WAKE_VERIFY.inc(result="accept" if score >= RELAY_WAKE_VERIFY_THRESHOLD else "reject")
+                else:
+                    logger.warning(f"⚠️ {client_address} {RELAY_WAKE_VERIFY_WAIT_S}秒内没收齐唤醒词音频，放行")
+                    METRIC_WAKE_VERIFY.inc(result="timeout")
+                ok = score is None or score >= RELAY_WAKE_VERIFY_THRESHOLD
+                elapsed_ms = (time.monotonic() - check.started) * 1000
+                logger.info(f"🛡️ {client_address} 唤醒二次确认{'通过' if ok else '没通过'}: "
+                            f"得分{'-' if score is None else f'{score:.3f}'}，唤醒词{len(check.clip) // 32}ms"
+                            f"（尾音另去掉{(check.wake_end - check.clip_samples) * 1000 // ESP32_SAMPLE_RATE}ms），"
+                            f"用时{elapsed_ms:.0f}ms")
+                verdict = {"type": "wake_verdict", "ok": ok}
+                if score is not None:
+                    verdict["score"] = round(score, 3)
+                await send_esp32(esp32_json(verdict), CAP_DOWNLINK_CONTROL)
+                if score is not None and wake_trial is not None:
+                    wake_trial.confidence = score     # 📈 有复核时置信度用复核模型的得分
+                if not ok:
+                    settle_wake(False)
+                    check.rejected = True
+                    check.held.clear()
+                    return None
+                wake_check = None
+                return b"".join(check.held)
+
+            messages = websocket if udp_server is None else device_messages()
             try:
-                async for audio_chunk in websocket:
+                async for audio_chunk in messages:
+                    await fair_scheduler.turn(fair_lane)
+                    METRIC_BYTES.inc(len(audio_chunk), peer="device", direction="in")
+                    if net_test is not None and isinstance(audio_chunk, bytes) and audio_chunk[:2] == NET_TEST_MAGIC:
+                        net_test.uplink(audio_chunk)       # 🛰️ 上行测试消息只计数，不录制也不转发
+                        continue
+                    # 控制消息：JSON文本，或者协商后的二进制控制帧（转成同样的字典）
+                    msg = decode_control(audio_chunk) if isinstance(audio_chunk, bytes) else None
+                    if recorder is not None and not isinstance(audio_chunk, UdpSettled):
+                        if isinstance(audio_chunk, str):
+                            recorder.record(CAP_UPLINK_CONTROL, audio_chunk)
+                        elif msg is not None:
+                            if msg["type"] == "capture":
+                                recorder.device_batch(msg["payload"])
+                            else:
+                                recorder.record(CAP_UPLINK_CONTROL, audio_chunk, CAP_FLAG_BINARY)
+                        else:
+                            recorder.record(CAP_UPLINK_AUDIO, audio_chunk, (CAP_FLAG_OPUS if uplink_codec == "opus" else 0)
+                                            | (CAP_FLAG_FRAMED if audio_framing else 0))
+                    if isinstance(audio_chunk, str) or msg is not None:
+                        if msg is None:
+                            try:
+                                msg = json.loads(audio_chunk)
+                            except ValueError:
+                                continue
+                        # 处理ESP32的hello消息，协商上行编码格式
+                        if msg.get("type") == "hello":
+                            # 🔌 先绑定豆包会话：透传格式的协商要看会话的TTS输出格式
+                            device_id = str(msg.get("device_id", ""))
+                            # 🤝 版本取双方都支持的；features只留服务器也支持的
+                            try:
+                                hello_version = max(1, min(HELLO_VERSION, int(msg.get("v") or 1)))
+                            except (TypeError, ValueError):
+                                hello_version = 1
+                            features = msg.get("features") if hello_version >= 2 else None
+                            device_features = {f for f in features if f in HELLO_FEATURES} if isinstance(
+                                features, list) else set()
+                            if not RELAY_DOWNLINK_RESUME:
+                                device_features.discard("playback_resume")
+                            if not RELAY_TEXT_QUERY:
+                                device_features.discard("text_query")
+                            if udp_server is None:
+                                device_features.discard("udp")
+                            if RELAY_SOAK_PROFILE not in SOAK_PROFILES:
+                                device_features.discard("soak")
+                            if not ASSETS:
+                                device_features.discard("assets")
+                            soak = SOAK_PROFILES[RELAY_SOAK_PROFILE] if "soak" in device_features else None
+                            if soak is not None:
+                                logger.info(f"🔥 {client_address} 浸泡测试设备 {device_id}，配置 {RELAY_SOAK_PROFILE}")
+                            METRIC_HELLO.inc(version=hello_version)
+                            resume = msg.get("resume") if isinstance(msg.get("resume"), dict) else {}
+                            if resume:
+                                logger.info(f"🌙 设备 {device_id} 从深度睡眠醒来（睡了 {resume.get('slept_ms')} ms）")
+                            # 🎯 设备没有VAD门控（不发speech_end）时由中继判断说完；结束平滑窗口在开会话之前定下来
+                            use_vad = RELAY_VAD == "on" or (RELAY_VAD == "auto" and msg.get("vad") is not True)
+                            endpointer = UplinkEndpointer() if use_vad else None
+                            if use_vad:
+                                end_window_ms = RELAY_VAD_END_WINDOW_MS
+                            else:
+                                try:
+                                    end_window_ms = max(0, int(msg.get("end_window_ms") or 0))
+                                except (TypeError, ValueError):
+                                    end_window_ms = 0
+                            # 📏 自己指定了窗口的设备不调整
+                            end_window_adapt = RELAY_ENDPOINT_ADAPT and bool(device_id) and (
+                                use_vad or not end_window_ms)
+                            pause_meter = PauseMeter(endpoint_policy, device_id) if end_window_adapt else None
+                            speech_detector = SpeechDetector() if endpointer or pause_meter else None
+                            if endpointer is not None and end_window_adapt:
+                                endpointer.silence_limit_ms = endpoint_policy.window(device_id, RELAY_VAD_SILENCE_MS)
+                            if upstream is None and soak is None:
+                                await attach_upstream(str(resume.get("session", "")))
+                            offered = msg.get("audio", {}).get("uplink", [])
+                            if "opus" in offered and HAS_OPUS:
+                                uplink_codec = "opus"
+                                opus_decoder = opuslib.Decoder(ESP32_SAMPLE_RATE, 1)
+                            else:
+                                uplink_codec = "pcm"
+                                opus_decoder = None
+                            downlink_offered = msg.get("audio", {}).get("downlink", [])
+                            downlink_passthrough = (RELAY_DEVICE_RESAMPLE and "f32_24k" in downlink_offered
+                                                    and tts_format == "f32_24k")
+                            if downlink_passthrough:
+                                adpcm_encoder = None
+                                resampler = None
+                                downlink_codec = "f32_24k"
+                            else:
+                                adpcm_encoder = ImaAdpcmEncoder() if "adpcm" in downlink_offered else None
+                                downlink_codec = "adpcm" if adpcm_encoder else "pcm"
+                            control = "binary" if msg.get("control") == "binary" and RELAY_CONTROL == "binary" else "json"
+                            audio_framing = RELAY_AUDIO_FRAMING and msg.get("framing") == "seq"
+                            # 🛡️ 按帧头时间戳切出唤醒词音频，所以复核要求帧头
+                            wake_verify = WAKE_VERIFIER is not None and audio_framing and msg.get("wake_verify") is True
+                            wake_check = None
+                            uplink_tracker.synced = False
+                            downlink_stream_start = True
+                            reply_head = True
+                            frame_ms = audio_frame_ms(msg.get("audio", {}).get("frame_ms"))
+                            chunk_ms = downlink_chunk_ms(msg.get("audio", {}).get("jitter_ms"), frame_ms)
+                            logger.info(f"🤝 协商结果(v{hello_version}): 上行={uplink_codec}, 下行={downlink_codec}, 控制={control}, "
+                                        f"帧头={'seq' if audio_framing else '无'}, 帧={frame_ms}ms, 下行块={chunk_ms}ms, "
+                                        f"VAD={'中继' if endpointer else '设备'}"
+                                        f"{f', 结束平滑窗口={end_window_ms}ms' if end_window_ms else ''}")
+                            # 🔌 断开时回复没发完：按设备播到的位置接着发，对不上就丢弃这轮剩下的
+                            resume_start = None
+                            if resume_reply is not None:
+                                parked, resume_reply = resume_reply, None
+                                playback = msg.get("playback") if isinstance(msg.get("playback"), dict) else {}
+                                if audio_framing and downlink_codec == parked.downlink_codec and "seq" in playback:
+                                    try:
+                                        resume_start = parked.resume_from(int(playback["seq"]),
+                                                                          max(0, int(playback.get("unplayed") or 0)))
+                                    except (TypeError, ValueError):
+                                        resume_start = None
+                                if resume_start is None:
+                                    tts_interrupted = True
+                                    reply_resumed.set()
+                                    METRIC_DOWNLINK_RESUME.inc(result="dropped")
+                                    logger.info(f"🔌 {client_address} 对不上断开前的播放位置，丢弃这轮剩下的回复")
+                                else:
+                                    # 续播之前的消息留着（"再说一遍"要用），它们的seq属于旧连接，不会再匹配上
+                                    current_reply[:] = parked.reply[:resume_start]
+                                    reply_index[:] = [(-1, n) for _, n in parked.reply_index[:resume_start]]
+                                    METRIC_DOWNLINK_RESUME.inc(result="resumed")
+                            reply = {
+                                "type": "hello",
+                                "v": hello_version,
+                                "session": session_id,
+                                "audio": {"uplink": uplink_codec, "downlink": downlink_codec, "chunk_ms": chunk_ms,
+                                          "frame_ms": frame_ms},
+                                "control": control,
+                            }
+                            if hello_version >= 2:
+                                reply["features"] = sorted(device_features)
+                            if audio_framing:
+                                reply["framing"] = "seq"
+                            if wake_verify:
+                                reply["wake_verify"] = True
+                            # 📡 UDP音频通道要靠帧头的序号排序和找丢失，token按连接随机，重新hello时换一个
+                            if udp_link is not None:
+                                logger.info(f"📡 {client_address} UDP音频: {udp_link.summary()}")
+                                udp_server.close(udp_link)
+                                udp_link = None
+                            if "udp" in device_features and audio_framing:
+                                udp_link = udp_server.open(str(client_address))
+                                reply["udp"] = {"port": udp_server.port, "token": udp_link.token}
+                            if resume_start is not None:
+                                reply["playback_resume"] = True
+                            # 🎙️ 录制时请ESP32上报设备端收发时间（走CAPTURE控制帧）
+                            if recorder is not None and msg.get("capture") and control == "binary":
+                                reply["capture"] = True
+                            # 🧭 多进程时提示设备以后直接连它所属的worker
+                            if device_id:
+                                sender.name = device_id
+                                fair_lane.rename(device_id)
+                            if RELAY_WORKERS > 1 and device_id:
+                                owner = worker_for_device(device_id)
+                                if owner != worker_index:
+                                    reply["route_port"] = RELAY_WORKER_PORT_BASE + owner
+                                    logger.info(f"🧭 设备 {device_id} 属于worker {owner}，已下发路由提示")
+                            await send_esp32(esp32_json(reply), CAP_DOWNLINK_CONTROL)
+                            # hello回复本身总是文本，ESP32收到后才切换
+                            binary_control = control == "binary"
+                            await send_control(CTRL_READY, {
+                                "type": "ready",
+                                "message": "🎤 服务器已就绪，可以开始语音对话"
+                            })
+                            if resume_start is not None:
+                                # 发送要等credit，而credit就是这个循环收的
+                                tasks.append(asyncio.create_task(fair_lane.wrap(resume_downlink(parked, resume_start))))
+                            if RELAY_WAKE_CONFIG:
+                                await send_esp32(esp32_json(dict(RELAY_WAKE_CONFIG, type="wake_config")), CAP_DOWNLINK_CONTROL)
+                            tuned = wake_tuner.attach(websocket, device_id, sender) \
+                                if RELAY_WAKE_TUNING and soak is None and device_id else None
+                            if tuned:
+                                # 📈 这个现场自动调过的阈值，覆盖RELAY_WAKE_CONFIG里的
+                                await send_esp32(esp32_json(tuned), CAP_DOWNLINK_CONTROL)
+                            runtime_config = runtime_config_for_device(device_id)
+                            if runtime_config:
+                                await send_esp32(esp32_json(dict(runtime_config, type="runtime_config")), CAP_DOWNLINK_CONTROL)
+                            if "assets" in device_features:
+                                host = websocket.request_headers.get("Host") or f"{RELAY_HOST}:{RELAY_PORT}"
+                                for page in asset_manifests(host, bool(RELAY_TLS_CERT and RELAY_TLS_KEY)):
+                                    await send_esp32(esp32_json(page), CAP_DOWNLINK_CONTROL)
+                            device_fw = msg.get("fw") or {}
+                            if device_fw.get("pending"):
+                                logger.info(f"📦 {client_address} 新固件 {device_fw.get('version')} 首次连上，已确认")
+                            await offer_ota()
+                        elif msg.get("type") == "credit":
+                            # 📬 下行额度更新，唤醒正在等额度的发送
+                            credit_limit = int(msg.get("recv", 0)) + int(msg.get("free", 0))
+                            credit_event.set()
+                        elif msg.get("type") == "udp_report":
+                            # 📡 设备的UDP接收报告：下行丢掉的消息从额度里扣回，丢失太多时退回WebSocket
+                            if udp_link is None:
+                                continue
+                            if msg.get("ready"):
+                                udp_link.down_ready = True
+                                logger.info(f"📡 {client_address} UDP音频通道已通，RTT {msg.get('rtt_ms')}ms")
+                                continue
+                            lost_bytes, fallback = udp_link.on_report(msg)
+                            downlink_sent = max(0, downlink_sent - lost_bytes)
+                            if fallback:
+                                udp_link.fall_back(fallback)
+                                await send_esp32(esp32_json({"type": "udp_report", "down": False}), CAP_DOWNLINK_CONTROL)
+                        elif msg.get("type") == "trace":
+                            # ⏱️ ESP32本轮的设备端耗时
+                            msg.pop("type")
+                            logger.info("⏱️ TRACE " + json.dumps(dict(msg, side="device"), ensure_ascii=False))
+                        elif msg.get("type") == "soak":
+                            # 🔥 浸泡测试设备的定时报告：按门槛判定，出厂老化看最后一份是不是PASS
+                            msg.pop("type")
+                            failed = soak_verdict(msg)
+                            METRIC_SOAK.inc(verdict="fail" if failed else "pass")
+                            line = "🔥 SOAK " + json.dumps(dict(msg, device=device_id, profile=RELAY_SOAK_PROFILE,
+                                                                verdict="fail" if failed else "pass"), ensure_ascii=False)
+                            if failed:
+                                logger.warning(line + " ❌ " + "；".join(failed))
+                            else:
+                                logger.info(line)
+                        elif msg.get("type") == "cost":
+                            # 💰 ESP32本轮的资源账单，和中继这一侧按会话ID合并
+                            msg.pop("type")
+                            turn_costs.device(str(msg.pop("session", session_id)), msg)
+                        elif msg.get("type") == "boot":
+                            # 🚀 ESP32启动时间线（上电起的毫秒数，-1=没有到达该阶段）
+                            msg.pop("type")
+                            logger.info("🚀 BOOT " + json.dumps(dict(msg, client=str(client_address)), ensure_ascii=False))
+                        elif msg.get("type") == "wake_config":
+                            # 🎯 ESP32回复当前生效的唤醒词参数和各模型CPU占用（千分比）
+                            msg.pop("type")
+                            logger.info("🎯 WAKE " + json.dumps(dict(msg, client=str(client_address)), ensure_ascii=False))
+                        elif msg.get("type") == "ota_status":
+                            # 📦 ESP32升级进度；补丁对不上当前固件时改发完整镜像
+                            logger.info(f"📦 {client_address} 升级 {msg.get('state')}: {msg.get('received')}/{msg.get('total')}字节"
+                                        f"{'，原因 ' + msg['reason'] if msg.get('reason') else ''}")
+                            if msg.get("state") in ("ready", "failed") and ota_state == "offered":
+                                ota_downloads -= 1
+                                ota_state = "done"
+                                if msg.get("reason") == "base_mismatch":
+                                    ota_state = ""
+                                    await offer_ota(full_image=True)
+                        elif msg.get("type") == "media_status":
+                            # 📻 设备长音频直连的状态变化（音频不经过中继，这里只记位置）
+                            msg.pop("type")
+                            METRIC_MEDIA.inc(state=str(msg.get("state", "")))
+                            logger.info("📻 MEDIA " + json.dumps(dict(msg, client=str(client_address)), ensure_ascii=False))
+                        elif msg.get("type") == "runtime_config":
+                            # 🎚️ ESP32回复当前生效的运行时参数（rejected=超出范围被忽略的字段）
+                            msg.pop("type")
+                            experiment = str(msg.get("experiment", ""))
+                            logger.info("🎚️ RUNTIME " + json.dumps(dict(msg, client=str(client_address)), ensure_ascii=False))
+                        elif msg.get("type") == "stats":
+                            # 📈 ESP32性能计数器（定时上报，或响应SIGUSR1触发的get_stats）
+                            msg.pop("type")
+                            if experiment:
+                                msg["experiment"] = experiment
+                            await offer_ota()   # 之前下载名额满了的设备在这里轮到
+                            if msg.get("heap_free") and msg.get("heap_largest") is not None:
+                                # 🧱 内部RAM碎片率：空闲总量里不能用来做一次大分配的比例
+                                msg["heap_frag"] = round(100 - msg["heap_largest"] * 100 / msg["heap_free"], 1)
+                            if msg.get("cap") is not None and msg.get("cap_gap") is not None:
+                                # 📏 采集连续性：漏掉的DMA块（中断来晚了+采集任务来不及）占应有块数的比例
+                                lost = msg["cap_gap"] + msg.get("cap_ovr", 0)
+                                if msg["cap"] + lost > 0:
+                                    msg["cap_lost_pct"] = round(lost * 100 / (msg["cap"] + lost), 3)
+                            if msg.get("reply_waits"):
+                                # ⏳ 第一条回复音频慢到要播"思考中"提示音的轮次比例（延迟SLO）
+                                msg["thinking_pct"] = round(msg.get("thinking", 0) * 100 / msg["reply_waits"], 1)
+                            logger.info("📈 STATS " + json.dumps(dict(msg, client=str(client_address)), ensure_ascii=False))
+                        elif msg.get("type") == "scope_timers":
+                            # ⏱️ SCOPE_TIMERS构建的固件跟着stats上报热路径函数的耗时分布（启动以来累计）
+                            logger.info("⏱️ TIMERS " + json.dumps(dict(scope_timer_summary(msg), client=str(client_address)),
+                                                                 ensure_ascii=False))
+                        elif msg.get("type") == "perf_history":
+                            # 🗄️ ESP32存在NVS里的性能累计（每次hello之后一次），delta是上次上报以来的增量（跨重启）
+                            msg.pop("type")
+                            for field, value in (msg.get("delta") or {}).items():
+                                if isinstance(value, int) and 0 < value < 1 << 31:
+                                    METRIC_DEVICE_HISTORY.inc(value, field=str(field))
+                            logger.info("🗄️ HISTORY " + json.dumps(dict(msg, client=str(client_address)), ensure_ascii=False))
+                        elif msg.get("type") == "flight_record" and "payload" in msg:
+                            # 🛩️ 软件复位/崩溃前的黑匣子记录，分几批到
+                            if flight_record is None:
+                                flight_record = FlightRecordCollector(RELAY_FLIGHT_DIR, sender.name)
+                            summary = flight_record.batch(msg["payload"])
+                            if summary:
+                                METRIC_FLIGHT_RECORDS.inc(reason=summary["reason"])
+                                logger.warning("🛩️ FLIGHT " + json.dumps(dict(summary, client=str(client_address)),
+                                                                        ensure_ascii=False))
+                        elif msg.get("type") == "loopback_cal":
+                            # 🔊 ESP32标定的扬声器→麦克风延迟（按DMA配置存在设备NVS里，sink_us是发送DMA深度）
+                            msg.pop("type")
+                            logger.info("🔊 LOOPBACK " + json.dumps(dict(msg, client=str(client_address)), ensure_ascii=False))
+                        elif msg.get("type") == "sched_tasks":
+                            # 🔬 调度追踪的任务表（下标→任务名），每个记录窗口开始时发一次
+                            if sched_trace is None:
+                                sched_trace = SchedTraceWriter(RELAY_SCHED_TRACE_DIR, sender.name)
+                            sched_trace.set_tasks(msg.get("tasks") or [])
+                        elif msg.get("type") == "sched_trace" and "payload" in msg:
+                            # 🔬 一批调度追踪事件，窗口的最后一批到了就写文件
+                            if sched_trace is None:
+                                sched_trace = SchedTraceWriter(RELAY_SCHED_TRACE_DIR, sender.name)
+                            path = sched_trace.batch(msg["payload"])
+                            if path:
+                                logger.info(f"🔬 {client_address} 调度追踪已保存: {path}")
+                        elif msg.get("type") == "net_test_start":
+                            # 🛰️ ws模式自检开始：服务器统计上行测试消息，同时尽快下发
+                            if net_test is not None:
+                                net_test.close()
+                            dscp = msg.get("dscp")
+                            net_test = NetTestSession(sender, int(msg.get("ms") or 0), int(msg.get("size") or 0),
+                                                      int(dscp) if isinstance(dscp, int) and 0 <= dscp < 64 else None)
+                        elif msg.get("type") == "net_test_ping":
+                            await send_esp32(esp32_json({"type": "net_test_pong", "seq": int(msg.get("seq") or 0)}),
+                                             CAP_DOWNLINK_CONTROL)
+                        elif msg.get("type") == "net_test_result":
+                            log_net_test_result(msg, client_address, downlink_codec, net_test)
+                            if net_test is not None:
+                                net_test.close()
+                                net_test = None
+                        elif msg.get("type") == "heap_sites":
+                            # 🧱 ESP32调试构建的分配点统计：[PC链, 次数, 字节]，PC用addr2line对照固件ELF
+                            msg.pop("type")
+                            logger.info("🧱 HEAP_SITES " + json.dumps(dict(msg, client=str(client_address)), ensure_ascii=False))
+                        elif msg.get("type") == "ping":
+                            # 💓 心跳：原样带回seq和时间戳，ESP32据此计算RTT（不经过豆包，立即回复）
+                            seq = int(msg.get("seq") or 0)
+                            t = int(msg.get("t") or 0)
+                            await send_control(CTRL_PONG, {"type": "pong", "seq": seq, "t": t},
+                                               CTRL_PONG_PAYLOAD.pack(seq & 0xFFFF, 0, t & 0xFFFFFFFF))
+                        elif msg.get("type") == "repeat":
+                            # 🔁 在独立任务里重发：发送要等credit，而credit就是这个循环收的
+                            tasks.append(asyncio.create_task(fair_lane.wrap(replay_last_reply())))
+                        elif msg.get("type") == "text_query":
+                            # 💬 设备本地听懂了整句问题：以文字开一轮对话，不经过云端识别（没有音频、不用等说完）
+                            text = str(msg.get("text") or "").strip()[:RELAY_TEXT_QUERY_MAX_CHARS]
+                            if not text or "text_query" not in device_features:
+                                METRIC_TEXT_QUERY.inc(result="rejected")
+                                continue
+                            await ensure_upstream()
+                            if upstream is None or not doubao_ws or doubao_ws.closed:
+                                METRIC_TEXT_QUERY.inc(result="busy")
+                                continue
+                            tts_interrupted = False     # 打断后的下一轮不会再有459
+                            trace_mark("speech_end")
+                            await send_reply_eta(reply_eta.estimate())
+                            logger.info(f"👤 用户说（设备本地识别，{msg.get('intent', 'ask')}）: {text}")
+                            trace_mark("asr_final")
+                            begin_reply(text)
+                            query = create_session_message(501, session_id, json.dumps(
+                                {"content": text}, ensure_ascii=False).encode("utf-8"))
+                            if not await uplink_writer.put(doubao_ws, session_id, messages=[query]):
+                                break
+                            METRIC_TEXT_QUERY.inc(result="sent")
+                        elif msg.get("type") == "session_start":
+                            # 💬 ESP32唤醒：上次会话超时释放了就重新开始（还在时什么都不做）
+                            if msg.get("doa") is not None:
+                                logger.info(f"🧭 ESP32双麦克风: 说话人方向 {msg.get('doa')}°")
+                            busy_until = 0.0    # 新的一次唤醒，重新排队
+                            wake_check = None
+                            settle_wake(False)  # 📈 上一次唤醒到现在都没有问题
+                            if endpointer is not None:
+                                endpointer.reset()
+                                if end_window_adapt:
+                                    endpointer.silence_limit_ms = endpoint_policy.window(device_id, RELAY_VAD_SILENCE_MS)
+                            # 🔘 按键触发的是用户明确按了这一台，不参加仲裁
+                            push_to_talk = bool(msg.get("ptt"))
+                            if push_to_talk:
+                                logger.info("🔘 ESP32按键说话")
+                            # 🏠 同一房间里别的设备也听到了：仲裁输了就不开会话
+                            room = None if push_to_talk else wake_arbiter.room_of(device_id)
+                            wake_lost = room is not None and not await wake_arbiter.arbitrate(
+                                room, device_id, msg.get("wake_db"))
+                            if wake_lost:
+                                await send_esp32(esp32_json({"type": "wake_verdict", "ok": False,
+                                                             "reason": "arbitration"}), CAP_DOWNLINK_CONTROL)
+                                continue
+                            if RELAY_WAKE_TUNING and not push_to_talk and soak is None and device_id:
+                                wake_trial = wake_tuner.begin(device_id, msg)
+                            # 🛡️ 要复核：先收唤醒词音频，通过后再开始/接上豆包会话
+                            clip_samples = int(msg.get("verify") or 0)
+                            wake_check = (WakeCheck(clip_samples, int(msg.get("wake_end") or 0))
+                                          if wake_verify and clip_samples > 0 else None)
+                            if wake_check is None:
+                                await ensure_upstream()
+                        elif msg.get("type") == "warmup":
+                            # 🔥 可能马上要唤醒：没有会话、没在busy退避时先开一个，确认的唤醒走ensure_upstream()接着用
+                            if RELAY_WARMUP_S > 0 and upstream is None and warmup_open is None and \
+                                    warmup_expiry is None and time.monotonic() >= busy_until and soak is None:
+                                warmup_open = asyncio.create_task(warm_upstream())
+                                tasks.append(warmup_open)
+                        elif msg.get("type") == "session_end":
+                            # 💤 ESP32没人说话超时回到空闲
+                            wake_check = None
+                            settle_wake(False)
+                            wake_lost = False
+                            await release_upstream("ESP32会话超时")
+                        elif msg.get("type") == "sleep":
+                            # 🌙 ESP32马上进深度睡眠：断开后豆包会话多暂存一会儿，醒来的hello接上
+                            wake_ms = max(0, int(msg.get("ms") or 0))
+                            if RELAY_SLEEP_PARK_S > 0:
+                                sleep_hold_s = min(RELAY_SLEEP_PARK_S, wake_ms / 1000 + RELAY_RESUME_GRACE_S) \
+                                    if wake_ms > 0 else RELAY_SLEEP_PARK_S
+                            logger.info(f"🌙 设备 {device_id} 进入深度睡眠（{wake_ms} ms后定时醒来，0=只有按键）")
+                        elif msg.get("type") == "local_command":
+                            # 📍 ESP32本地处理掉的命令（没有上传音频），只记录命中情况
+                            logger.info(f"📍 ESP32本地命令: {msg.get('intent')} ({msg.get('ms')} ms)")
+                            settle_wake(True)
+                        elif msg.get("type") == "interrupt":
+                            # ✋ 用户打断：丢弃还没发出去的TTS音频，确认后ESP32才恢复接收
+                            tts_interrupted = True
+                            current_reply.clear()
+                            reply_index.clear()
+                            cache_key = None    # 没听完的回复不缓存
+                            end_flight(False)
+                            audio_stream_buffer.clear()
+                            if resampler is not None:
+                                await downlink_cpu.run(resampler.reset, inline=True)
+                            downlink_stream_start = True
+                            reply_head = True
+                            logger.info("✋ ESP32打断了当前回复")
+                            await send_control(CTRL_INTERRUPT_ACK, {"type": "interrupt_ack"})
+                        elif msg.get("type") == "speech_end" and soak is not None:
+                            # 🔥 浸泡测试：不识别，回一段合成的回复（上一段还没发完时忽略）
+                            if soak_reply is None or soak_reply.done():
+                                turn_trace.clear()
+                                trace_mark("speech_end")
+                                soak_reply = asyncio.create_task(fair_lane.wrap(play_soak_reply(soak)))
+                                tasks.append(soak_reply)
+                        elif msg.get("type") == "speech_end" and doubao_ws and not doubao_ws.closed:
+                            # 🤫 ESP32的VAD判定说完了（中继端VAD已经判定过的不再补一次）
+                            if udp_link is not None and udp_link.up.synced and not isinstance(audio_chunk, UdpSettled):
+                                # 📡 上行走UDP时这句话的最后几条可能还在路上：等一个乱序窗口再处理
+                                udp_link.settle(audio_chunk if isinstance(audio_chunk, str) else json.dumps(msg))
+                                continue
+                            if endpointer is not None:
+                                if endpointer.ended:
+                                    continue
+                                endpointer.end()
+                            if not await finish_speech("ESP32说话结束"):
+                                break
+                        continue
+
+                    # 🧾 协商了帧头：去掉帧头，丢弃迟到的消息，缺口在解码后补静音（豆包按时长对齐识别）
+                    gap_samples = 0
+                    timestamp = None
+                    if audio_framing and len(audio_chunk) >= AUDIO_HEADER.size and audio_chunk[0] == AUDIO_MAGIC:
+                        _, _, seq, timestamp, samples, flags = AUDIO_HEADER.unpack_from(audio_chunk)
+                        if not uplink_tracker.synced and timestamp > 0:
+                            # 📼 设备断线期间继续录音：新连接上的第一条从录音中途开始，是补发的整句话
+                            logger.info(f"📼 {client_address} 补发断线前后的上行音频，从录音第"
+                                        f"{timestamp * 1000 // ESP32_SAMPLE_RATE}ms开始")
+                        verdict, missing = uplink_tracker.accept(seq, timestamp, samples, flags)
+                        if verdict == FrameTracker.LATE:
+                            logger.debug(f"🧾 丢弃迟到的上行音频: seq={seq}")
+                            continue
+                        if verdict == FrameTracker.GAP:
+                            gap_samples = min(missing, UPLINK_GAP_FILL_MAX_SAMPLES)
+                            logger.warning(f"🧾 上行音频缺口: seq={seq}, 缺{missing}样本"
+                                           f"{'（设备端丢帧）' if flags & AUDIO_FLAG_DISCONTINUITY else ''}")
+                        audio_chunk = audio_chunk[AUDIO_HEADER.size:]
+
+                    if uplink_codec == "opus" and isinstance(audio_chunk, bytes):
+                        audio_chunk = decode_opus_uplink(opus_decoder, audio_chunk)
+                        if not audio_chunk:
+                            continue
+                    if gap_samples:
+                        audio_chunk = bytes(gap_samples * 2) + audio_chunk
+
+                    if wake_lost and isinstance(audio_chunk, bytes):
+                        continue
+                    # 🛡️ 复核没出结果之前不转发：唤醒词留给模型，后面的先攒着；没通过的这次唤醒全部丢弃
+                    if wake_check is not None and isinstance(audio_chunk, bytes) and timestamp is not None:
+                        if wake_check.rejected:
+                            continue
+                        if not wake_check.feed(audio_chunk, timestamp - gap_samples) and not wake_check.expired():
+                            continue
+                        audio_chunk = await finish_wake_check()
+                        if not audio_chunk:
+                            continue
+
+                    speech = None
+                    if isinstance(audio_chunk, bytes) and speech_detector is not None:
+                        speech = speech_detector.is_speech(audio_chunk)
+                        if pause_meter is not None:
+                            pause_meter.note(pcm_ms(audio_chunk), speech)
+                    if isinstance(audio_chunk, bytes) and endpointer is not None:
+                        # 🎯 中继端VAD：说完了就提前补齐静音，之后的静音不转发（也不算活动，会话照常超时释放）
+                        audio_chunk, ended = endpointer.feed(audio_chunk, speech)
+                        if ended and doubao_ws and not doubao_ws.closed:
+                            METRIC_RELAY_VAD.inc()
+                            if not await finish_speech("中继VAD判定说话结束"):
+                                break
+                        if not audio_chunk:
+                            continue
+
+                    if isinstance(audio_chunk, bytes):
+                        last_activity = time.monotonic()
+                        await ensure_upstream()     # 没发session_start的旧固件
                     if isinstance(audio_chunk, bytes) and doubao_ws and not doubao_ws.closed:
-                        # 构造并发送音频数据到豆包AI
-                        header = create_protocol_header(message_type=0b0010, use_json=False)
-                        message = bytearray(header)
-                        message.extend((200).to_bytes(4, 'big'))
-                        session_bytes = session_id.encode('utf-8')
-                        message.extend(len(session_bytes).to_bytes(4, 'big'))
-                        message.extend(session_bytes)
-                        compressed_audio = gzip.compress(audio_chunk)
-                        message.extend(len(compressed_audio).to_bytes(4, 'big'))
-                        message.extend(compressed_audio)
-                        
-                        try:
-                            await doubao_ws.send(message)
-                            logger.info(f"🎵 转发音频到豆包: {len(audio_chunk)} 字节")
-                        except Exception as e:
-                            logger.warning(f"转发音频到豆包失败: {e}")
+                        # 📤 交给上行写任务，豆包那边写得慢时不耽误读ESP32
+                        trace_mark("first_uplink")
+                        if not await uplink_writer.put(doubao_ws, session_id, audio_chunk):
                             break
+                        uplink_log.log(len(audio_chunk))
+                        archive("up", audio_chunk)
             except Exception as e:
                 logger.debug(f"ESP32音频转发任务结束: {e}")
         
@@ -369,97 +6057,203 @@ async def handle_esp32_client(websocket, path):
             """
             转发豆包AI响应到ESP32（流式版本）
             """
-            nonlocal audio_stream_buffer
+            nonlocal tts_interrupted, downlink_sent, trace_turn, current_reply, last_reply
+            nonlocal cache_key, cached_turn, reply_head, flight, session_turns, cost_upstream_in
             
             try:
                 while True:
-                    response_data = await doubao_ws.recv()
-                    response = parse_doubao_response(response_data)
-                    if not response:
+                    if responses is None:
+                        await upstream_ready.wait()     # 连上时名额满、还没开过会话
+                        continue
+                    await fair_scheduler.turn(fair_lane)
+                    # 连接读取任务已按session_id解析分发，None表示连接断开
+                    response = await responses.get()
+                    if response is None:
+                        break
+                    if response is SESSION_RELEASED:
+                        await upstream_ready.wait()     # 之后改读新会话的队列
                         continue
+                    if not reply_resumed.is_set():
+                        await reply_resumed.wait()      # 🔌 续播的消息先发完
+                    cost_upstream_in += response.get("wire_bytes", 0)
                     
                     # 处理音频数据
                     if "audio_data" in response:
+                        if tts_interrupted or cached_turn:
+                            continue  # 被打断的回复或已经从缓存回复，剩余音频直接丢弃
                         audio_data = response["audio_data"]
+                        trace_mark("first_tts")
+                        if resampler is not None:
+                            if resample_batcher is not None:
+                                audio_data = await downlink_cpu.run_batched(resample_batcher, resampler, audio_data)
+                            else:
+                                audio_data = await downlink_cpu.run(resampler.process, audio_data)
+                            if tts_interrupted or cached_turn:
+                                continue    # 重采样期间被打断
                         if len(audio_data) > 0:
+                            if not downlink_passthrough:
+                                archive("down", audio_data)     # 透传的24kHz float32不归档
                             # 将音频数据添加到流缓冲区
-                            audio_stream_buffer += audio_data
-                            logger.debug(f"🔊 添加音频数据到缓冲区: {len(audio_data)} 字节，缓冲区总大小: {len(audio_stream_buffer)} 字节")
-                            
-                            # 当缓冲区达到一定大小时，发送给ESP32
-                            chunk_size = 1600  # 50ms的音频数据 (16000Hz * 0.05s * 2bytes)
-                            
-                            while len(audio_stream_buffer) >= chunk_size:
-                                # 取出一个块发送
-                                chunk = audio_stream_buffer[:chunk_size]
-                                audio_stream_buffer = audio_stream_buffer[chunk_size:]
-                                
-                                # 检查音频数据有效性（确保是整数采样）
-                                if len(chunk) % 2 != 0:
-                                    logger.debug(f"⚠️ 过滤非整数采样数据: {len(chunk)} 字节")
-                                    continue
-                                
-                                if not await safe_send(websocket, chunk):
+                            audio_stream_buffer.append(audio_data)
+                            bytes_per_ms = downlink_bytes_per_ms()
+
+                            # ⚡ 本段回复的第一个包：够一帧就发，手上有几整帧发几帧
+                            frame_bytes = frame_ms * bytes_per_ms
+                            if reply_head and len(audio_stream_buffer) >= frame_bytes:
+                                reply_head = False
+                                if not await send_buffered(len(audio_stream_buffer) // frame_bytes * frame_bytes):
+                                    logger.warning("ESP32连接已关闭，无法发送音频")
+                                    return
+
+                            # 之后攒满一个稳定块再发
+                            chunk_size = chunk_ms * bytes_per_ms
+                            while not reply_head and len(audio_stream_buffer) >= chunk_size:
+                                if not await send_buffered(chunk_size):
                                     logger.warning("ESP32连接已关闭，无法发送音频")
                                     return
-                                
-                                logger.info(f"🔊 发送音频块到ESP32: {len(chunk)} 字节")
-                                
-                                # 稍微延迟，保持流式播放的均匀性
-                                await asyncio.sleep(0.01)  # 10ms延迟
                     
                     # 处理其他响应数据
                     elif "payload" in response:
                         event = response.get("event")
                         payload = response["payload"]
                         
+                        # 新一轮识别结束，后面的TTS属于新回复
+                        if event == 459 and tts_interrupted:
+                            tts_interrupted = False
+                            logger.info("✅ 打断后的新一轮识别结束，恢复下发TTS")
+
                         # 处理ASR结果（语音识别结果）
                         if event == 451 and isinstance(payload, dict) and "results" in payload:
-                            if payload["results"] and not payload["results"][0].get("is_interim", True):
+                            if payload["results"] and payload["results"][0].get("is_interim", True):
+                                # 📏 上一句识别结束后又出了中间结果：用户接着在说
+                                if pause_meter is not None and payload["results"][0].get("text"):
+                                    pause_meter.resumed()
+                            elif payload["results"]:
                                 text = payload["results"][0].get("text", "")
                                 logger.info(f"👤 用户说: {text}")
+                                trace_mark("asr_final")
+                                if pause_meter is not None:
+                                    pause_meter.asr_final()
+                                begin_reply(text)
                                 
                         # 处理TTS结束事件
                         elif event == 559:
-                            # 等待一段时间确保所有音频数据发送完成
-                            await asyncio.sleep(0.2)
-                            
-                            # TTS结束，发送剩余的音频数据
-                            if len(audio_stream_buffer) > 0:
-                                logger.info(f"🎵 TTS结束，发送剩余音频: {len(audio_stream_buffer)} 字节")
-                                if len(audio_stream_buffer) % 2 == 0:  # 确保整数采样
-                                    if not await safe_send(websocket, audio_stream_buffer):
+                            if cached_turn:
+                                # 本轮已经从缓存回复过（tts_end也已发出），只清掉豆包生成的残余
+                                cached_turn = False
+                                audio_stream_buffer.clear()
+                                if resampler is not None:
+                                    await downlink_cpu.run(resampler.reset, inline=True)
+                                logger.info("💾 本轮已从缓存回复，豆包生成的音频已丢弃")
+                            else:
+                                if audio_framing:
+                                    # 🏁 剩余音频作为最后一条下发，帧头带结束标记（没有剩余时发空负载）：
+                                    # 下行消息本来就按顺序发出，设备播完缓冲区就收尾，不用再等、不用补静音
+                                    tail = b""
+                                    if len(audio_stream_buffer) > 0:
+                                        sample_mask = ~7 if downlink_passthrough else ~3
+                                        rest = audio_stream_buffer.take(len(audio_stream_buffer) & sample_mask)
+                                        tail = bytes(rest)
+                                        rest.release()
+                                        audio_stream_buffer.clear()
+                                        if tail:
+                                            keep_reply(tail)
+                                    if not await send_downlink(await encode_downlink(tail) if tail else b"", end=True):
                                         logger.warning("ESP32连接已关闭，无法发送剩余音频")
+                                    await send_control(CTRL_TTS_END, {"type": "tts_end", "message": "TTS结束"})
+                                    logger.info(f"🤖 AI回复结束（最后一条 {len(tail)} 字节带结束标记）")
+                                else:
+                                    # 旧固件（没有帧头）：等待一段时间确保所有音频数据发送完成
+                                    await asyncio.sleep(0.2)
+                            
+                                    # TTS结束，发送剩余的音频数据
+                                    if len(audio_stream_buffer) > 0:
+                                        logger.info(f"🎵 TTS结束，发送剩余音频: {len(audio_stream_buffer)} 字节")
+                                        sample_mask = ~3 if downlink_passthrough else ~1
+                                        rest = audio_stream_buffer.take(len(audio_stream_buffer) & sample_mask)  # 确保整数采样
+                                        try:
+                                            keep_reply(rest)
+                                            if len(rest) and not await send_downlink(await encode_downlink(rest)):
+                                                logger.warning("ESP32连接已关闭，无法发送剩余音频")
+                                        finally:
+                                            rest.release()
                                 
-                                audio_stream_buffer = b''  # 清空缓冲区
+                                        audio_stream_buffer.clear()  # 清空缓冲区
                             
-                            # 等待确保剩余音频数据发送完成
-                            await asyncio.sleep(0.1)
+                                    # 等待确保剩余音频数据发送完成
+                                    await asyncio.sleep(0.1)
                             
-                            # 再次发送一段静音数据确保缓冲区清空
-                            silence_data = bytes([0] * 1024)  # 1KB静音数据
-                            if not await safe_send(websocket, silence_data):
-                                logger.warning("ESP32连接已关闭，无法发送静音数据")
+                                    # 再次发送一段静音数据确保缓冲区清空
+                                    silence_data = downlink_silence(1024)  # 1KB静音数据（16kHz PCM的时长）
+                                    if not await send_downlink(await encode_downlink(silence_data)):
+                                        logger.warning("ESP32连接已关闭，无法发送静音数据")
                             
-                            # 等待确保静音数据发送完成
-                            await asyncio.sleep(0.05)
+                                    # 等待确保静音数据发送完成
+                                    await asyncio.sleep(0.05)
                             
-                            # 发送明确的停止播放信号
-                            if not await safe_send(websocket, json.dumps({
-                                "type": "tts_end",
-                                "message": "TTS结束，停止流式播放"
-                            })):
-                                logger.warning("ESP32连接已关闭，无法发送停止信号")
+                                    # 发送明确的停止播放信号
+                                    if not await send_control(CTRL_TTS_END, {
+                                        "type": "tts_end",
+                                        "message": "TTS结束，停止流式播放"
+                                    }):
+                                        logger.warning("ESP32连接已关闭，无法发送停止信号")
                             
-                            logger.info("🤖 AI回复结束，已发送停止信号")
+                                    logger.info("🤖 AI回复结束，已发送停止信号")
+                                if current_reply:
+                                    last_reply, current_reply = current_reply, []
+                                reply_index.clear()
+                                if cache_key and reply_pcm:
+                                    response_cache.put(cache_key, b"".join(reply_pcm))
+                                    logger.info(f"💾 已缓存本轮回复: {sum(len(c) for c in reply_pcm)} 字节")
+                                end_flight(True)
+                            cache_key = None
+                            reply_pcm.clear()
+                            session_turns += 1
+                            trace_mark("tts_end")
+                            finish_archive()
+                            trace_turn += 1
+                            spans = {
+                                "eos_to_asr_final": trace_span("speech_end", "asr_final"),
+                                "asr_final_to_first_tts": trace_span("asr_final", "first_tts"),
+                                "first_tts_to_downlink": trace_span("first_tts", "first_downlink"),
+                                "eos_to_first_downlink": trace_span("speech_end", "first_downlink"),
+                                "eos_to_tts_end": trace_span("speech_end", "tts_end"),
+                            }
+                            for stage, ms in spans.items():
+                                if ms >= 0:
+                                    METRIC_TURN_LATENCY.observe(ms / 1000, stage=stage)
+                            if spans["eos_to_first_downlink"] >= 0 and "reply_cached" not in turn_trace:
+                                reply_eta.observe(spans["eos_to_first_downlink"])
+                            logger.info("⏱️ TRACE " + json.dumps(dict(
+                                {"session": session_id, "turn": trace_turn, "side": "relay"}, **spans)))
+                            turn_trace.clear()
+                            # 💰 中继这一侧的账单，等设备的cost到了一起导出
+                            turn_costs.relay(session_id, trace_turn, {
+                                "upstream_out": uplink_writer.bytes - cost_start["upstream_out"],
+                                "upstream_in": cost_upstream_in,
+                                "resample_ms": round((downlink_cpu.busy_s - cost_start["cpu_s"]) * 1000, 1),
+                                "loop_ms": round((fair_lane.total_s - cost_start["loop_s"]) * 1000, 1),
+                                "codec": uplink_codec, "down_codec": downlink_codec,
+                                "features": sorted(device_features),
+                            })
+                            cost_start.update(upstream_out=uplink_writer.bytes, cpu_s=downlink_cpu.busy_s,
+                                              loop_s=fair_lane.total_s)
+                            cost_upstream_in = 0
                             
             except Exception as e:
                 logger.debug(f"豆包响应转发任务结束: {e}")
         
         # 创建并运行双向转发任务
-        task1 = asyncio.create_task(forward_esp32_to_doubao())
-        task2 = asyncio.create_task(forward_doubao_to_esp32())
+        task1 = asyncio.create_task(fair_lane.wrap(forward_esp32_to_doubao()))
+        task2 = asyncio.create_task(fair_lane.wrap(forward_doubao_to_esp32()))
         tasks = [task1, task2]
+        if RELAY_SESSION_IDLE_S > 0:
+            tasks.append(asyncio.create_task(release_idle_upstream()))
+        if RELAY_MEMORY_CHECK_S > 0:
+            tasks.append(asyncio.create_task(enforce_memory_budget()))
+        tasks.append(asyncio.create_task(move_on_drain()))
+        if udp_server is not None:
+            tasks.append(asyncio.create_task(udp_feedback()))
         
         # 等待任一任务完成或出现异常
         done, pending = await asyncio.wait(tasks, return_when=asyncio.FIRST_COMPLETED)
@@ -474,65 +6268,251 @@ async def handle_esp32_client(websocket, path):
     finally:
         # 清理资源
         logger.info("🧹 清理连接资源...")
+        if audio_framing and uplink_tracker.messages:
+            logger.info(f"🧾 {client_address} 上行音频: {uplink_tracker.summary()}")
+        if downlink_cpu.jobs:
+            logger.info(f"🧵 {client_address} 下行重采样/编码: {downlink_cpu.summary()}")
+        if net_test is not None:
+            net_test.close()
+        if udp_link is not None:
+            udp_server.close(udp_link)
+            if udp_link.up.recv or udp_link.down_sent:
+                logger.info(f"📡 {client_address} UDP音频: {udp_link.summary()}")
+        if uplink_writer.frames:
+            logger.info(f"📤 {client_address} 上行写任务: {uplink_writer.summary()}")
+        uplink_writer.close()
+        fair_scheduler.close(fair_lane)
+        if fair_lane.steps:
+            logger.info(f"⚖️ {client_address} {fair_lane.summary()}")
+        if sender.dropped:
+            logger.warning(f"📮 {client_address} 下行链路太慢，共丢弃 {sender.dropped} 字节音频")
+        if isinstance(responses, ResponseQueue) and responses.dropped:
+            logger.warning(f"🧮 {client_address} TTS音频排队超过上限，共丢弃 {responses.dropped} 字节")
+        if memory_peak:
+            METRIC_SESSION_MEMORY_PEAK.observe(memory_peak)
+        session_memory.pop(websocket, None)
         
         # 取消所有运行中的任务
         for task in tasks:
             if not task.done():
                 task.cancel()
+        if flight is not None:
+            reply_flights.end(flight, False)    # 🛫 跟着的会话在这里结束这轮回复
         
-        # 关闭豆包WebSocket连接
-        if doubao_ws:
+        # 🔌 设备可能马上重连：豆包会话先暂存，否则结束（连接上没有其他会话时一并关闭）
+        if device_id and upstream_registry.active.get(device_id) is detach_upstream:
+            del upstream_registry.active[device_id]
+        if upstream and not park_upstream():
             try:
                 # 等待一小段时间确保所有数据发送完成
                 await asyncio.sleep(0.1)
-                if not doubao_ws.closed:
-                    await doubao_ws.close()
-                logger.info("✅ 豆包连接已关闭")
+                await doubao_mux.close_session(upstream, session_id)
+                logger.info("✅ 豆包会话已结束")
             except Exception as e:
-                logger.debug(f"关闭豆包连接时出错（可能是正常关闭）: {e}")
+                logger.debug(f"结束豆包会话时出错（可能是正常关闭）: {e}")
         
+        if recorder is not None:
+            recorder.close()
+        finish_archive()
+        if ota_state == "offered":
+            ota_downloads -= 1
+        active_clients -= 1
+        connected_devices.discard(websocket)
+        device_senders.pop(websocket, None)
+        wake_tuner.detach(websocket, device_id)     # 📈 没定性的唤醒（断开了）不计入统计
+        sender.close()
         logger.info(f"✅ 客户端 {client_address} 处理完成")
 
-def signal_handler(signum, frame):
+def signal_handler():
     """
-    信号处理函数，用于优雅关闭服务器
+    信号处理函数：停止接入新连接，进入排空
     """
-    global running, server
+    global running
     logger.info("👋 收到停止信号")
     running = False
-    
-    # 关闭服务器
-    if server:
-        server.close()
-    
-    # 退出程序
-    sys.exit(0)
+
+def request_device_sched_trace():
+    """
+    SIGUSR2：让所有已连接的ESP32记录一段调度追踪，结果写到RELAY_SCHED_TRACE_DIR
+    """
+    logger.info(f"🔬 向 {len(connected_devices)} 个设备请求 {RELAY_SCHED_TRACE_MS} ms 调度追踪")
+    request = esp32_json({"type": "sched_trace", "ms": RELAY_SCHED_TRACE_MS})
+    for sender in list(device_senders.values()):
+        sender.put(request)
+
+def request_device_stats():
+    """
+    SIGUSR1：向所有已连接的ESP32请求一次性能统计，结果以"📈 STATS"日志输出
+    """
+    logger.info(f"📈 向 {len(connected_devices)} 个设备请求性能统计")
+    request = esp32_json({"type": "get_stats"})
+    for sender in list(device_senders.values()):
+        sender.put(request)
+
+def make_tls_context() -> Optional[ssl.SSLContext]:
+    """RELAY_TLS_CERT/RELAY_TLS_KEY都设置时返回wss://用的SSLContext，否则返回None（ws://）"""
+    if not RELAY_TLS_CERT or not RELAY_TLS_KEY:
+        return None
+    context = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+    context.minimum_version = ssl.TLSVersion.TLSv1_2
+    context.maximum_version = ssl.TLSVersion.TLSv1_2
+    context.load_cert_chain(RELAY_TLS_CERT, RELAY_TLS_KEY)
+    return context
+
+
+def handoff_path() -> str:
+    # 多进程时设备按route_port固定在某个序号的worker上，新进程的同一序号接着用
+    return f"{RELAY_HANDOFF_FILE}.{worker_index}" if RELAY_WORKERS > 1 else RELAY_HANDOFF_FILE
+
+
+def save_handoff():
+    """
+    🚚 排空结束：把新进程接着要用的状态写进RELAY_HANDOFF_FILE（先写临时文件再改名）
+    """
+    path = handoff_path()
+    state = {"saved_at": time.time(), "endpoint_policy": endpoint_policy.export()}
+    try:
+        with open(path + ".tmp", "w") as f:
+            json.dump(state, f)
+        os.replace(path + ".tmp", path)
+        logger.info(f"🚚 已保存 {len(state['endpoint_policy'])} 台设备的停顿统计到 {path}")
+    except OSError as e:
+        logger.warning(f"⚠️ 保存交接状态失败: {e}")
+
+
+def load_handoff():
+    """
+    🚚 启动时读回上一个进程留下的状态（太旧的不用）
+    """
+    path = handoff_path()
+    try:
+        with open(path) as f:
+            state = json.load(f)
+    except FileNotFoundError:
+        return
+    except (OSError, ValueError) as e:
+        logger.warning(f"⚠️ 读取交接状态失败: {e}")
+        return
+    age_s = time.time() - state.get("saved_at", 0)
+    if age_s > RELAY_HANDOFF_MAX_AGE_S:
+        logger.info(f"🚚 交接状态是 {age_s:.0f} 秒前的，不用")
+        return
+    endpoint_policy.load(state.get("endpoint_policy", {}))
+    logger.info(f"🚚 接过上一个进程 {len(endpoint_policy.devices)} 台设备的停顿统计（{age_s:.0f} 秒前保存）")
+
+
+def lan_address() -> str:
+    """
+    🧭 本机在局域网里的地址：RELAY_HOST是0.0.0.0时取默认路由的出口网卡（UDP connect只选路由，不发包）
+    """
+    if RELAY_HOST not in ("", "0.0.0.0"):
+        return RELAY_HOST
+    with socket.socket(socket.AF_INET, socket.SOCK_DGRAM) as probe:
+        try:
+            probe.connect(("10.255.255.255", 1))
+            return probe.getsockname()[0]
+        except OSError:
+            return "127.0.0.1"
+
+
+async def start_mdns(scheme: str):
+    """
+    🧭 用mDNS广播本中继，TXT带scheme和path（设备按它们拼出URI），返回(zeroconf, info)，没有广播时返回None
+    """
+    if not HAS_ZEROCONF:
+        logger.warning("⚠️ RELAY_MDNS=1但没有安装zeroconf，不广播（建议：pip install zeroconf）")
+        return None
+    service = f"{RELAY_MDNS_SERVICE}._tcp.local."
+    address = lan_address()
+    info = ServiceInfo(service, f"{RELAY_MDNS_NAME}.{service}", addresses=[socket.inet_aton(address)],
+                       port=RELAY_PORT, properties={"scheme": scheme, "path": "/"})
+    zc = AsyncZeroconf()
+    try:
+        await zc.async_register_service(info, allow_name_change=True)
+    except Exception as e:
+        logger.warning(f"⚠️ mDNS广播失败: {e}")
+        await zc.async_close()
+        return None
+    logger.info(f"🧭 mDNS广播 {info.name} -> {scheme}://{address}:{RELAY_PORT}")
+    return zc, info
+
 
 async def main():
     """
     主函数
     启动WebSocket服务器并等待连接
     """
-    global server, running
-    
-    host = "0.0.0.0"  # 监听所有网络接口
-    port = 8888       # 监听端口
+    global running
+
+    tls_context = make_tls_context()
+    net_test_server = None
+    mdns = None
+    scheme = "wss" if tls_context else "ws"
     
     logger.info("=" * 60)
-    logger.info("🎯 ESP32语音助手服务器 (杂音修复版)")
+    logger.info(f"🎯 ESP32语音助手服务器 (杂音修复版) worker {worker_index}/{RELAY_WORKERS}")
     logger.info("=" * 60)
     logger.info(f"📡 关键修复: 豆包24kHz -> ESP32 16kHz音频重采样")
-    logger.info(f"🚀 服务器启动: ws://{host}:{port}")
+    logger.info(f"🚀 服务器启动: {scheme}://{RELAY_HOST}:{RELAY_PORT}")
     logger.info("=" * 60)
     logger.info("等待ESP32连接...")
     
     # 注册信号处理器
-    signal.signal(signal.SIGINT, signal_handler)
-    signal.signal(signal.SIGTERM, signal_handler)
+    loop = asyncio.get_running_loop()
+    loop.add_signal_handler(signal.SIGINT, signal_handler)
+    loop.add_signal_handler(signal.SIGTERM, signal_handler)
+    loop.add_signal_handler(signal.SIGUSR1, request_device_stats)
+    loop.add_signal_handler(signal.SIGUSR2, request_device_sched_trace)
+    loop.add_signal_handler(signal.SIGHUP, relay_config.reload)
     
     try:
-        server = await websockets.serve(handle_esp32_client, host, port)
-        logger.info("✅ WebSocket服务器启动成功")
+        # /asset/<哈希>要给设备下载提示音，不开指标时也要挂上
+        process_request = metrics_http if RELAY_METRICS or ASSETS else None
+        # 🧮 设备连接的收发缓冲（库默认每条连接能排16条1MB的消息）
+        ws_limits = dict(max_size=RELAY_WS_MAX_SIZE, max_queue=RELAY_WS_MAX_QUEUE, read_limit=RELAY_WS_READ_LIMIT,
+                         write_limit=RELAY_WS_WRITE_LIMIT)
+        if RELAY_HANDOFF_FILE:
+            load_handoff()
+        # 🚚 滚动重启时新旧进程同时监听同一批端口
+        reuse_port = RELAY_ROLLING_RESTART or None
+        if RELAY_WORKERS > 1:
+            servers.append(await websockets.serve(handle_esp32_client, RELAY_HOST, RELAY_PORT, reuse_port=True,
+                                                  ssl=tls_context, process_request=process_request, **ws_limits))
+            direct_port = RELAY_WORKER_PORT_BASE + worker_index
+            servers.append(await websockets.serve(handle_esp32_client, RELAY_HOST, direct_port, reuse_port=reuse_port,
+                                                  ssl=tls_context, process_request=process_request, **ws_limits))
+            logger.info(f"✅ WebSocket服务器启动成功（直连端口 {direct_port}）")
+        else:
+            servers.append(await websockets.serve(handle_esp32_client, RELAY_HOST, RELAY_PORT, reuse_port=reuse_port,
+                                                  ssl=tls_context, process_request=process_request, **ws_limits))
+            logger.info("✅ WebSocket服务器启动成功")
+        if RELAY_SESSION_BUDGET_BYTES > 0:
+            # 会话缓冲区按上限裁剪；WebSocket的收发缓冲不在统计里，按配置的最大值另算
+            session_max = (RELAY_SESSION_BUDGET_BYTES + RELAY_WS_MAX_SIZE * RELAY_WS_MAX_QUEUE + RELAY_WS_READ_LIMIT
+                           + RELAY_WS_WRITE_LIMIT)
+            if RELAY_MAX_DEVICES > 0:
+                logger.info(f"🧮 每个会话最多 {session_max / 1048576:.1f} MB 缓冲区，{RELAY_MAX_DEVICES}台设备共 "
+                            f"{session_max * RELAY_MAX_DEVICES / 1048576:.0f} MB")
+            else:
+                logger.info(f"🧮 每个会话最多 {session_max / 1048576:.1f} MB 缓冲区（RELAY_MAX_DEVICES不限，总量没有上限）")
+        if RELAY_NET_TEST_PORT:
+            net_test_server = await asyncio.start_server(handle_net_test_tcp, RELAY_HOST, RELAY_NET_TEST_PORT,
+                                                         reuse_port=RELAY_WORKERS > 1 or RELAY_ROLLING_RESTART)
+        if RELAY_UDP_PORT:
+            # 📡 多进程时每个worker一个UDP端口（设备连的是哪个worker，hello回复里就给哪个）
+            udp_port = RELAY_UDP_PORT + (worker_index if RELAY_WORKERS > 1 else 0)
+            await loop.create_datagram_endpoint(functools.partial(UdpAudioServer, udp_port),
+                                                local_addr=(RELAY_HOST, udp_port), reuse_port=reuse_port)
+            logger.info(f"📡 UDP音频端口 {udp_port}")
+        if RELAY_CONFIG_FILE:
+            relay_config.reload()
+        if RELAY_MDNS and worker_index == 0:
+            mdns = await start_mdns(scheme)
+        warm_pool.start()
+        upstream_endpoints.start()
+        if RELAY_METRICS:
+            lag_task = asyncio.create_task(sample_loop_lag())
+            logger.info(f"📊 指标: http://{RELAY_HOST}:{RELAY_PORT}/metrics，网络自检: /net_test")
         
         # 保持服务器运行
         while running:
@@ -542,22 +6522,121 @@ async def main():
         logger.error(f"服务器运行出错: {e}")
     finally:
         logger.info("🛑 正在关闭服务器...")
+        # 🧭 先撤掉mDNS广播，新启动的设备不会再选到这个要退出的进程
+        if mdns is not None:
+            zc, info = mdns
+            await zc.async_unregister_service(info)
+            await zc.async_close()
+        
+        # 先只关监听socket，已有连接继续服务；设备重连会落到其他worker（滚动重启时是新进程），
+        # 每个连接这一轮对话结束后收到move提示再断开
+        for srv in servers:
+            srv.server.close()
+        if net_test_server is not None:
+            net_test_server.close()
+        deadline = time.monotonic() + RELAY_DRAIN_TIMEOUT_S
+        if active_clients:
+            logger.info(f"⏳ 等待 {active_clients} 个连接结束（最多{RELAY_DRAIN_TIMEOUT_S}秒）")
+        while active_clients and time.monotonic() < deadline:
+            await asyncio.sleep(0.5)
+        if RELAY_HANDOFF_FILE:
+            save_handoff()
+        if udp_server is not None and udp_server.transport is not None:
+            udp_server.transport.close()
+        await upstream_registry.close()
+        await warm_pool.close()
+        await upstream_endpoints.close()
+        await asyncio.get_running_loop().run_in_executor(None, audio_archiver.close)
         
         # 关闭服务器
-        if server:
+        for srv in servers:
             try:
-                server.close()
-                await server.wait_closed()
-                logger.info("✅ WebSocket服务器已关闭")
+                srv.close()
+                await srv.wait_closed()
             except Exception as e:
                 logger.debug(f"关闭服务器时出错（可能是正常关闭）: {e}")
-        
+        logger.info("✅ WebSocket服务器已关闭")
         logger.info("🛑 服务器已停止")
 
-if __name__ == "__main__":
+def run_worker():
+    """
+    在当前进程里运行一个worker
+    """
+    if HAS_UVLOOP:
+        asyncio.set_event_loop_policy(uvloop.EventLoopPolicy())
+        logger.info("⚡ 使用uvloop事件循环")
+    else:
+        logger.info("未安装uvloop，使用默认事件循环（建议：pip install uvloop）")
     try:
         asyncio.run(main())
     except KeyboardInterrupt:
         logger.info("👋 程序被用户中断")
     except Exception as e:
-        logger.error(f"程序运行出错: {e}")
\ No newline at end of file
+        logger.error(f"程序运行出错: {e}")
+
+def run_supervisor():
+    """
+    多进程模式：fork RELAY_WORKERS个worker，异常退出的worker原样拉起；
+    收到SIGTERM/SIGINT后转发给所有worker，等它们排空退出
+    """
+    children = {}
+    stopping = False
+
+    def spawn(index: int):
+        global worker_index
+        pid = os.fork()
+        if pid == 0:
+            signal.signal(signal.SIGTERM, signal.SIG_DFL)
+            signal.signal(signal.SIGINT, signal.SIG_DFL)
+            signal.signal(signal.SIGUSR1, signal.SIG_DFL)
+            signal.signal(signal.SIGUSR2, signal.SIG_DFL)
+            signal.signal(signal.SIGHUP, signal.SIG_DFL)
+            worker_index = index
+            run_worker()
+            os._exit(0)
+        children[pid] = index
+        logger.info(f"👷 worker {index} 已启动 (pid {pid})")
+
+    def stop(signum, frame):
+        nonlocal stopping
+        stopping = True
+        for pid in list(children):
+            try:
+                os.kill(pid, signal.SIGTERM)
+            except ProcessLookupError:
+                pass
+
+    def forward_stats_request(signum, frame):
+        for pid in list(children):
+            try:
+                os.kill(pid, signum)
+            except ProcessLookupError:
+                pass
+
+    signal.signal(signal.SIGTERM, stop)
+    signal.signal(signal.SIGINT, stop)
+    signal.signal(signal.SIGUSR1, forward_stats_request)
+    signal.signal(signal.SIGUSR2, forward_stats_request)
+    signal.signal(signal.SIGHUP, forward_stats_request)
+    for index in range(RELAY_WORKERS):
+        spawn(index)
+
+    while children:
+        try:
+            pid, status = os.wait()
+        except ChildProcessError:
+            break
+        index = children.pop(pid, None)
+        if index is None or stopping:
+            continue
+        logger.warning(f"⚠️ worker {index} 意外退出 (状态 {status})，1秒后重启")
+        time.sleep(1)
+        if not stopping:
+            spawn(index)
+    logger.info("🛑 所有worker已退出")
+
+if __name__ == "__main__":
+    if RELAY_WORKERS > 1:
+        run_supervisor()
+    else:
+        run_worker()
@@ -2,16 +2,21 @@
 # -*- coding: utf-8 -*-
 """
 音频文件转换工具
-将 MP3 音频文件转换为 ESP32 可用的 C 头文件格式
+将 MP3 音频文件打包为 ESP32 提示音分区镜像（prompts.bin）
 
 使用方法:
-    python convert_audio.py
+    python convert_audio.py            # 生成 ../main/mock_voices/prompts.bin
+    python convert_audio.py --pcm      # 不压缩，直接打包16位PCM
+    python convert_audio.py --header   # 旧格式：每个文件生成一个 C 头文件
 
 功能:
     - 自动扫描 ../main/mock_voices/ 目录中的 MP3 文件
     - 使用 ffmpeg 将 MP3 转换为 16kHz 单声道 16位 PCM 格式
-    - 生成对应的 C 头文件，包含音频数据数组
-    - 支持覆盖已存在的头文件
+    - 压缩为 IMA-ADPCM（4:1），与下行音频使用同一种块格式
+    - 所有提示音打包成一个镜像，idf.py flash 时烧录到 prompts 分区，
+      固件通过 esp_partition_mmap 直接读取（格式见 main/prompt_store.h）
+    - 提示音名称就是 MP3 文件名（不含扩展名，最长15个字符）
+    - 没有 thinking.mp3 时合成一段柔和的双音"思考中"提示音（固件见 main/thinking_filler.h）
 
 依赖:
     - ffmpeg (需要在系统 PATH 中)
@@ -22,11 +27,39 @@
 
 import os
 import sys
+import math
+import struct
+import argparse
 import subprocess
 import tempfile
 from pathlib import Path
 
 
+# 提示音分区格式（与 main/prompt_store.h 保持一致）
+PACK_MAGIC = b'PRMT'
+PACK_VERSION = 1
+PACK_NAME_LEN = 16
+PACK_ALIGN = 16
+PACK_PARTITION_SIZE = 1024 * 1024   # partitions.csv 中 prompts 分区的大小
+CODEC_PCM16 = 0
+CODEC_IMA_ADPCM = 1
+ADPCM_BLOCK_SAMPLES = 320           # 每块20ms，正好是固件的一个播放块
+SAMPLE_RATE = 16000
+THINKING_PROMPT = "thinking"        # 与 main/project_config.h 的 PROMPT_THINKING 一致
+
+# IMA-ADPCM 标准步长表和索引调整表（与ESP32端audio_codec.cc保持一致）
+ADPCM_STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+]
+ADPCM_INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8]
+
+
 def check_ffmpeg():
     """检查 ffmpeg 是否可用"""
     try:
@@ -126,6 +159,178 @@ const unsigned char {array_name}[] = {{
         return False
 
 
+def adpcm_encode(pcm_data, block_samples=ADPCM_BLOCK_SAMPLES):
+    """
+    将 16位 PCM 编码为 IMA-ADPCM 块序列
+
+    块格式: [int16小端初始样本][uint8步长索引][uint8保留][4bit编码，低半字节在前]
+    每块携带编码器当前状态，固件可以逐块独立解码。
+
+    Args:
+        pcm_data: 16位小端 PCM 数据
+        block_samples: 每块样本数（偶数）
+
+    Returns:
+        tuple: (ADPCM数据, 块字节数)
+    """
+    count = len(pcm_data) // 2
+    samples = list(struct.unpack(f'<{count}h', pcm_data[:count * 2]))
+    if len(samples) % 2:
+        samples.append(0)
+
+    predictor = 0
+    index = 0
+    out = bytearray()
+    for start in range(0, len(samples), block_samples):
+        out += struct.pack('<hBB', predictor, index, 0)
+        block = samples[start:start + block_samples]
+        nibbles = []
+        for sample in block:
+            step = ADPCM_STEP_TABLE[index]
+            diff = sample - predictor
+            nibble = 0
+            if diff < 0:
+                nibble = 8
+                diff = -diff
+            delta = step >> 3
+            if diff >= step:
+                nibble |= 4
+                diff -= step
+                delta += step
+            step >>= 1
+            if diff >= step:
+                nibble |= 2
+                diff -= step
+                delta += step
+            step >>= 1
+            if diff >= step:
+                nibble |= 1
+                delta += step
+            predictor += -delta if nibble & 8 else delta
+            predictor = max(-32768, min(32767, predictor))
+            index = max(0, min(88, index + ADPCM_INDEX_TABLE[nibble]))
+            nibbles.append(nibble)
+        for i in range(0, len(nibbles), 2):
+            out.append(nibbles[i] | (nibbles[i + 1] << 4))
+
+    return bytes(out), 4 + block_samples // 2
+
+
+def synth_thinking_earcon():
+    """
+    合成"思考中"提示音：两个上行的柔和音符（升余弦包络，不会有咔哒声），约0.6秒，-18dBFS左右
+
+    Returns:
+        bytes: 16kHz 单声道 16位 PCM
+    """
+    notes = [(660.0, 0.18), (880.0, 0.26)]     # (频率Hz, 时长秒)
+    gap = int(SAMPLE_RATE * 0.08)
+    samples = []
+    for freq, duration in notes:
+        count = int(SAMPLE_RATE * duration)
+        for i in range(count):
+            envelope = 0.5 - 0.5 * math.cos(2 * math.pi * i / (count - 1))
+            tone = math.sin(2 * math.pi * freq * i / SAMPLE_RATE) + 0.25 * math.sin(4 * math.pi * freq * i / SAMPLE_RATE)
+            samples.append(int(4000 * envelope * tone))
+        samples.extend([0] * gap)
+    return struct.pack(f'<{len(samples)}h', *samples)
+
+
+def build_prompt_pack(prompts, use_adpcm=True):
+    """
+    把多段 PCM 打包成提示音分区镜像
+
+    Args:
+        prompts: [(名称, 16位PCM数据), ...]
+        use_adpcm: True=压缩为ADPCM，False=直接存PCM
+
+    Returns:
+        bytes: 分区镜像
+    """
+    def align(n):
+        return (n + PACK_ALIGN - 1) // PACK_ALIGN * PACK_ALIGN
+
+    offset = align(16 + 32 * len(prompts))
+    directory = bytearray()
+    payload = bytearray()
+    for name, pcm_data in prompts:
+        encoded = name.encode('utf-8')
+        if len(encoded) >= PACK_NAME_LEN:
+            raise ValueError(f"提示音名称过长（最多{PACK_NAME_LEN - 1}字节）: {name}")
+        sample_count = len(pcm_data) // 2
+        if use_adpcm:
+            data, block_bytes = adpcm_encode(pcm_data)
+            codec = CODEC_IMA_ADPCM
+        else:
+            data, block_bytes, codec = pcm_data[:sample_count * 2], 0, CODEC_PCM16
+
+        directory += struct.pack(f'<{PACK_NAME_LEN}sIIIHBB', encoded, offset + len(payload),
+                                 len(data), sample_count, block_bytes, codec, 0)
+        payload += data
+        payload += bytes(align(len(payload)) - len(payload))
+
+    total = offset + len(payload)
+    header = struct.pack('<4sHHII', PACK_MAGIC, PACK_VERSION, len(prompts), total, 0)
+    head = header + directory
+    return head + bytes(offset - len(head)) + payload
+
+
+def pack_audio_files(mp3_files, pack_path, use_adpcm=True):
+    """
+    转换所有 MP3 文件并打包为提示音分区镜像
+
+    Args:
+        mp3_files: MP3 文件路径列表
+        pack_path: 输出的镜像路径
+        use_adpcm: 是否压缩为ADPCM
+
+    Returns:
+        int: 成功打包的文件数
+    """
+    prompts = []
+    for mp3_path in sorted(mp3_files):
+        print(f"🔄 正在转换: {mp3_path.name}")
+        with tempfile.NamedTemporaryFile(suffix='.pcm', delete=False) as temp_pcm:
+            temp_pcm_path = temp_pcm.name
+        try:
+            if not convert_mp3_to_pcm(mp3_path, temp_pcm_path):
+                continue
+            with open(temp_pcm_path, 'rb') as f:
+                pcm_data = f.read()
+            if len(pcm_data) < 2:
+                print(f"❌ PCM 数据为空: {mp3_path.name}")
+                continue
+            prompts.append((mp3_path.stem, pcm_data))
+            print(f"✓ {mp3_path.stem}: {len(pcm_data) // 2} 个样本 ({len(pcm_data) / 32000:.2f}秒)")
+        finally:
+            try:
+                os.unlink(temp_pcm_path)
+            except OSError:
+                pass
+
+    if not prompts:
+        return 0
+    if THINKING_PROMPT not in (name for name, _ in prompts):
+        pcm_data = synth_thinking_earcon()
+        prompts.append((THINKING_PROMPT, pcm_data))
+        print(f"✓ {THINKING_PROMPT}: 合成提示音 {len(pcm_data) // 2} 个样本 ({len(pcm_data) / 32000:.2f}秒)")
+
+    try:
+        image = build_prompt_pack(prompts, use_adpcm)
+    except ValueError as e:
+        print(f"❌ {e}")
+        return 0
+    if len(image) > PACK_PARTITION_SIZE:
+        print(f"❌ 镜像大小 {len(image)} 字节超过 prompts 分区 ({PACK_PARTITION_SIZE} 字节)")
+        return 0
+
+    with open(pack_path, 'wb') as f:
+        f.write(image)
+    pcm_total = sum(len(pcm) for _, pcm in prompts)
+    print(f"✓ 生成提示音镜像: {pack_path} ({len(image)} 字节，原始PCM {pcm_total} 字节)")
+    return len(prompts)
+
+
 def convert_audio_file(mp3_path, output_dir):
     """
     转换单个音频文件
@@ -173,6 +378,11 @@ def convert_audio_file(mp3_path, output_dir):
 
 def main():
     """主函数"""
+    parser = argparse.ArgumentParser(description="ESP32 提示音转换工具")
+    parser.add_argument('--pcm', action='store_true', help="不压缩，直接打包16位PCM")
+    parser.add_argument('--header', action='store_true', help="旧格式：生成 C 头文件")
+    args = parser.parse_args()
+
     print("🎵 ESP32 音频文件转换工具")
     print("=" * 50)
     
@@ -207,30 +417,48 @@ def main():
     for mp3_file in mp3_files:
         print(f"  - {mp3_file.name}")
     
+    if args.header:
+        convert_headers(mp3_files, mock_voices_dir)
+        return
+
     print("\n🔄 开始转换...")
-    
+    pack_path = mock_voices_dir / "prompts.bin"
+    success_count = pack_audio_files(mp3_files, pack_path, use_adpcm=not args.pcm)
+
+    print("=" * 50)
+    print(f"✅ 打包完成: {success_count}/{len(mp3_files)} 个文件")
+    if success_count > 0:
+        print("\n💡 使用提示:")
+        print("1. idf.py flash 会把 prompts.bin 一起烧录到 prompts 分区")
+        print("   只更新提示音: parttool.py write_partition --partition-name prompts --input main/mock_voices/prompts.bin")
+        print("2. 在代码中按文件名查找: prompt_store.find(\"hi\")，再交给 play_prompt_async() 播放")
+
+
+def convert_headers(mp3_files, mock_voices_dir):
+    """旧格式：每个 MP3 生成一个包含 PCM 数组的 C 头文件"""
+    print("\n🔄 开始转换...")
+
     # 转换每个文件
     success_count = 0
     for mp3_file in mp3_files:
         if convert_audio_file(mp3_file, mock_voices_dir):
             success_count += 1
         print()  # 空行分隔
-    
+
     # 输出结果
     print("=" * 50)
     print(f"✅ 转换完成: {success_count}/{len(mp3_files)} 个文件成功")
-    
+
     if success_count > 0:
         print("\n📝 生成的头文件:")
         for mp3_file in mp3_files:
             header_file = mock_voices_dir / f"{mp3_file.stem}.h"
             if header_file.exists():
                 print(f"  - {header_file.name}")
-        
+
         print("\n💡 使用提示:")
         print("1. 在 C 代码中包含头文件: #include \"mock_voices/filename.h\"")
-        print("2. 使用数组: bsp_play_audio(array_name, array_name_len);")
-
+        print("2. 使用数组: audio_manager->play_audio(array_name, array_name_len);")
 
 if __name__ == "__main__":
     main()
@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+本地命令词表生成工具
+把main/local_commands.csv（意图,中文说法,拼音）转成command_table.h：constexpr的命令表
+（命令ID=表下标，拼音在kPinyin里的偏移，意图），LocalCommands::init()一次性注册给MultiNet，
+识别结果按命令ID直接查表得到意图
+
+使用方法:
+    python gen_command_table.py --csv main/local_commands.csv --out build/command_table.h   # 构建时由main/CMakeLists.txt调用
+    python gen_command_table.py --csv main/local_commands.csv --fill                       # 把空着的拼音补全写回CSV
+
+功能:
+    - 拼音列为空时用multinet_pinyin.py转换（MultiNet7中文模型用不带声调的拼音）
+    - 检查拼音只含小写字母和空格、不超过MultiNet的长度和条数上限、没有重复的说法，有问题直接报错，不生成半张表
+    - 内容没变时不重写输出文件，避免每次构建都重新编译
+
+依赖:
+    - python3；拼音都填好时只用标准库，补拼音时需要pypinyin和pypinyin_dict
+"""
+
+import argparse
+import csv
+import os
+import re
+import sys
+
+MAX_PHRASE_LEN = 63         # esp_mn_iface.h的ESP_MN_MAX_PHRASE_LEN
+MAX_PHRASE_NUM = 400        # ESP_MN_MAX_PHRASE_NUM
+PINYIN_RE = re.compile(r"^[a-z]+( [a-z]+)*$")
+
+
+def read_rows(path):
+    rows = []
+    with open(path, encoding="utf-8") as f:
+        for line_no, row in enumerate(csv.reader(f), 1):
+            if not row or not row[0].strip() or row[0].lstrip().startswith("#"):
+                continue
+            if len(row) < 2:
+                sys.exit(f"{path}:{line_no}: 至少要有意图和中文说法两列")
+            intent = row[0].strip()
+            text = row[1].strip()
+            pinyin = row[2].strip() if len(row) > 2 else ""
+            rows.append([line_no, intent, text, pinyin])
+    return rows
+
+
+def fill_pinyin(rows):
+    missing = [row for row in rows if not row[3]]
+    if not missing:
+        return False
+    sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+    try:
+        import multinet_pinyin
+    except ImportError as e:
+        sys.exit(f"有{len(missing)}条命令词没有拼音，需要pypinyin转换: {e}（pip install pypinyin pypinyin-dict）")
+    multinet_pinyin.init_pinyin()
+    for row in missing:
+        row[3] = multinet_pinyin.get_pinyin(row[2], verbose=False)
+    return True
+
+
+def check(path, rows):
+    if not rows:
+        sys.exit(f"{path}: 命令词表是空的")
+    if len(rows) > MAX_PHRASE_NUM:
+        sys.exit(f"{path}: {len(rows)}条命令词超过MultiNet上限{MAX_PHRASE_NUM}")
+    seen = {}
+    for line_no, intent, text, pinyin in rows:
+        if not re.match(r"^[a-z][a-z0-9_]*$", intent):
+            sys.exit(f"{path}:{line_no}: 意图名'{intent}'只能用小写字母、数字和下划线")
+        if not PINYIN_RE.match(pinyin):
+            sys.exit(f"{path}:{line_no}: 拼音'{pinyin}'只能是空格分隔的小写字母（不带声调）")
+        if len(pinyin) > MAX_PHRASE_LEN:
+            sys.exit(f"{path}:{line_no}: 拼音超过{MAX_PHRASE_LEN}字节")
+        if pinyin in seen:
+            sys.exit(f"{path}:{line_no}: '{text}'和第{seen[pinyin]}行的拼音重复")
+        seen[pinyin] = line_no
+
+
+def render(path, rows):
+    pinyin_blob = []
+    entries = []
+    offset = 0
+    for _, intent, text, pinyin in rows:
+        pinyin_blob.append(pinyin)
+        entries.append(f"    {{ LocalCommands::Intent::{intent.upper()}, {offset}, \"{text}\" }},")
+        offset += len(pinyin) + 1
+    blob = "".join(f"\n    \"{p}\\0\"" for p in pinyin_blob)
+    return f"""// 由tools/gen_command_table.py根据{os.path.basename(path)}生成，不要手改
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "local_commands.h"
+
+namespace CommandTable {{
+
+struct Entry {{
+    LocalCommands::Intent intent;
+    uint16_t pinyin;        // 在kPinyin里的偏移
+    const char* text;       // 中文说法：日志；ask意图时作为文字问题发给服务器
+}};
+
+constexpr size_t COUNT = {len(rows)};
+
+// esp_mn_phrase_t的字符串是char*，拼音放在可写的数组里
+inline char kPinyin[] ={blob};
+
+// 下标就是注册给MultiNet的命令ID
+inline constexpr Entry kEntries[COUNT] = {{
+{chr(10).join(entries)}
+}};
+
+}}  // namespace CommandTable
+"""
+
+
+def write_csv(path, rows):
+    with open(path, encoding="utf-8") as f:
+        lines = f.read().splitlines()
+    by_line = {row[0]: row for row in rows}
+    out = []
+    for line_no, line in enumerate(lines, 1):
+        row = by_line.get(line_no)
+        out.append(",".join(row[1:]) if row else line)
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("\n".join(out) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="本地命令词表生成工具")
+    parser.add_argument("--csv", required=True, help="命令词表（意图,中文说法,拼音）")
+    parser.add_argument("--out", help="生成的command_table.h")
+    parser.add_argument("--fill", action="store_true", help="把补全的拼音写回CSV")
+    args = parser.parse_args()
+
+    rows = read_rows(args.csv)
+    filled = fill_pinyin(rows)
+    check(args.csv, rows)
+    if args.fill and filled:
+        write_csv(args.csv, rows)
+        print(f"✅ 已补全拼音: {args.csv}")
+    if args.out:
+        content = render(args.csv, rows)
+        try:
+            with open(args.out, encoding="utf-8") as f:
+                if f.read() == content:
+                    return
+        except OSError:
+            pass
+        os.makedirs(os.path.dirname(os.path.abspath(args.out)), exist_ok=True)
+        with open(args.out, "w", encoding="utf-8") as f:
+            f.write(content)
+        print(f"✅ {len(rows)}条命令词 -> {args.out}")
+
+
+if __name__ == "__main__":
+    main()
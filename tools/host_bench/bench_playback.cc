@@ -0,0 +1,611 @@
+/**
+ * @file bench_playback.cc
+ * @brief ⏱️ 下行播放链路基准测试 - 把一串下行消息按时间回放给AudioManager，统计CPU、拷贝和欠载
+ *
+ * 输入可以是合成的TTS回复（默认），也可以是server.py录制的会话文件（--capture，见RELAY_CAPTURE_DIR），
+ * 有设备端时间戳时按ESP32实际收到每条下行消息的时间回放，WiFi上的排队和重传也算在里面。
+ * 回放线程扮演WebSocket事件任务调用feed_streaming_fragment()，播放任务是固件里的原样代码，
+ * 输出写进模拟I2S（见shim/host_shim.h）。结束后输出：
+ * - 每条下行消息在WebSocket任务里花的CPU时间和memcpy次数/字节
+ * - 每个播放块在播放任务里花的CPU时间和memcpy次数/字节
+ * - 抖动缓冲区欠载、丢弃和最高水位（PerfCounters），模拟I2S的断音次数
+ * - 时钟漂移补偿插入/去掉的样本（--rate 0.999这类接近1的值就是服务器按实时节奏、时钟差1000ppm）
+ * 给了--max-*阈值时超出任一项返回1，可以放进CI做回归检查。
+ *
+ * --write-capture可以把合成的输入存成录制文件，方便修改前后用同一份输入对比，
+ * 也可以用tools/replay_capture.py info查看。
+ *
+ * --framing给合成的消息加上音频帧头（见audio_framing.h），--loss再按比例丢掉一些消息，
+ * 可以看丢包补偿填了多少、听起来怎么样（--out）。
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "audio_manager.h"
+#include "esp_log.h"
+#include "host_shim.h"
+#include "perf_counters.h"
+#include "project_config.h"
+#include "session_capture.h"
+
+// main.cc里定义的全局变量，基准测试不走上行，保持为空
+QueueHandle_t s_audio_send_queue = nullptr;
+AudioFramePool* s_audio_frame_pool = nullptr;
+
+static const uint32_t SAMPLE_RATE = 16000;
+
+// 会话录制文件格式（和server/server.py的SessionRecorder一致，记录类型是SessionCapture::Kind）
+static const char CAPTURE_MAGIC[4] = { 'V', 'C', 'A', 'P' };
+static const uint8_t CAPTURE_VERSION = 1;
+static const size_t CAPTURE_FILE_HEADER_BYTES = 16;    // magic, u8版本, u8保留, u16采样率, u64开始时间(unix us)
+static const size_t CAPTURE_RECORD_BYTES = 16;         // u64 t_us, u8类型, u8标志, u16保留, u32长度
+static const uint8_t CAPTURE_FLAG_BINARY = 0x01;
+static const uint8_t CAPTURE_FLAG_DEVICE = 0x02;
+static const uint8_t CAPTURE_FLAG_ADPCM = 0x08;
+static const uint8_t CAPTURE_FLAG_F32 = 0x10;
+static const uint8_t CAPTURE_FLAG_FRAMED = 0x20;
+
+enum RecordKind : uint8_t {
+    RECORD_AUDIO = 0,
+    RECORD_TTS_END = 1,
+    RECORD_REPLY_START = 2,
+};
+
+struct Record {
+    int64_t t_us;
+    RecordKind kind;
+    std::vector<uint8_t> data;
+};
+
+struct CaptureRecord {
+    int64_t t_us;
+    SessionCapture::Kind kind;
+    uint8_t flags;
+    std::vector<uint8_t> data;
+};
+
+struct Trace {
+    DownlinkCodec codec = DownlinkCodec::PCM;
+    bool framed = false;            // 下行音频带帧头
+    std::vector<Record> records;
+};
+
+struct Options {
+    const char* capture_path = nullptr;
+    const char* write_capture_path = nullptr;
+    const char* out_path = nullptr;
+    int replies = 3;
+    int reply_ms = 4000;
+    int msg_ms = 50;              // 服务器每条下行消息50ms
+    double rate = 1.5;            // TTS产出速度（相对实时）
+    int jitter_ms = 30;           // 每条消息额外的随机延迟上限
+    int stall_every = 0;          // 每隔多少条消息卡顿一次（0=不卡顿）
+    int stall_ms = 200;
+    size_t fragment = 0;          // 按WebSocket接收缓冲区切片（0=整条消息送入）
+    int prebuffer_ms = 0;         // 0=按到达抖动自适应（和固件一样）
+    double speed = 4.0;
+    unsigned seed = 1;
+    bool f32_24k = false;         // 合成豆包原始的24kHz float32（设备端重采样）
+    bool framing = false;         // 合成的消息带音频帧头
+    double loss = 0;              // 合成时丢掉的消息比例（0~1）
+    bool json = false;
+    // 回归阈值（<0表示不检查）
+    long max_underruns = -1;
+    long max_gaps = -1;
+    long max_chunk_us = -1;       // 播放块CPU时间p99
+    long max_msg_us = -1;         // 下行消息CPU时间p99
+    double max_chunk_copies = -1; // 每个播放块平均memcpy次数
+};
+
+// ---------------------------------------------------------------- 输入
+
+/**
+ * @brief 合成一段像语音的信号：基频缓慢变化的谐波叠加，按音节调幅，词间有低电平噪声
+ */
+static void synth_speech(std::vector<int16_t>& out, size_t count, uint32_t rate, std::mt19937& rng) {
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+    double phase = 0.0;
+    for (size_t i = 0; i < count; i++) {
+        double t = (double)i / rate;
+        double f0 = 170.0 + 50.0 * sin(2 * M_PI * 0.7 * t);
+        phase += 2 * M_PI * f0 / rate;
+        double syllable = 0.5 - 0.5 * cos(2 * M_PI * 4.0 * t);
+        bool pause = fmod(t, 1.7) > 1.45;
+        double voiced = sin(phase) + 0.5 * sin(2 * phase) + 0.25 * sin(3 * phase);
+        double value = pause ? 60.0 * unit(rng) : 6000.0 * syllable * voiced + 200.0 * unit(rng);
+        out.push_back((int16_t)std::max(-32768.0, std::min(32767.0, value)));
+    }
+}
+
+static Trace synth_trace(const Options& opt) {
+    Trace trace;
+    std::mt19937 rng(opt.seed);
+    std::uniform_int_distribution<int> jitter(0, std::max(0, opt.jitter_ms));
+    std::bernoulli_distribution lost(std::min(1.0, std::max(0.0, opt.loss)));
+    const uint32_t rate = opt.f32_24k ? DownlinkResampler::INPUT_RATE : SAMPLE_RATE;
+    const size_t msg_samples = (size_t)opt.msg_ms * rate / 1000;
+    const size_t reply_samples = (size_t)opt.reply_ms * rate / 1000;
+    trace.codec = opt.f32_24k ? DownlinkCodec::F32_24K : DownlinkCodec::PCM;
+    trace.framed = opt.framing;
+    const AudioFraming::Codec framing_codec = opt.f32_24k ? AudioFraming::Codec::F32_24K : AudioFraming::Codec::PCM;
+    int64_t reply_start_us = 200 * 1000;
+    int msg_index = 0;
+    uint16_t seq = 0;
+
+    for (int r = 0; r < opt.replies; r++) {
+        std::vector<int16_t> pcm;
+        synth_speech(pcm, reply_samples, rate, rng);
+        trace.records.push_back({ reply_start_us, RECORD_REPLY_START, {} });
+
+        int64_t last_us = reply_start_us;
+        int64_t stall_us = 0;
+        for (size_t pos = 0; pos < pcm.size(); pos += msg_samples) {
+            size_t n = std::min(msg_samples, pcm.size() - pos);
+            if (opt.stall_every > 0 && ++msg_index % opt.stall_every == 0) {
+                stall_us += (int64_t)opt.stall_ms * 1000;
+            }
+            int64_t ideal_us = reply_start_us + (int64_t)(pos * 1000000 / rate / opt.rate);
+            int64_t t_us = std::max(last_us, ideal_us + stall_us + (int64_t)jitter(rng) * 1000);
+            std::vector<uint8_t> data;
+            if (opt.framing) {
+                // 时间戳和样本数按16kHz播放时钟计
+                uint8_t header[AudioFraming::HEADER_BYTES];
+                AudioFraming::write(header, framing_codec, seq++, (uint32_t)(pos * SAMPLE_RATE / rate),
+                                    (uint16_t)(n * SAMPLE_RATE / rate), pos == 0 ? AudioFraming::FLAG_START : 0);
+                data.assign(header, header + sizeof(header));
+            }
+            if (opt.f32_24k) {
+                std::vector<float> f32(n);
+                for (size_t i = 0; i < n; i++) {
+                    f32[i] = pcm[pos + i] / 32768.0f;
+                }
+                const uint8_t* bytes = (const uint8_t*)f32.data();
+                data.insert(data.end(), bytes, bytes + n * sizeof(float));
+            } else {
+                const uint8_t* bytes = (const uint8_t*)(pcm.data() + pos);
+                data.insert(data.end(), bytes, bytes + n * sizeof(int16_t));
+            }
+            // 第一条不丢，回复总有起点
+            if (pos > 0 && lost(rng)) {
+                continue;
+            }
+            trace.records.push_back({ t_us, RECORD_AUDIO, std::move(data) });
+            last_us = t_us;
+        }
+        trace.records.push_back({ last_us, RECORD_TTS_END, {} });
+        // 下一段回复在这段播完之后再来（播放时长 + 预缓冲 + 1秒间隔）
+        int64_t prebuffer_us = (int64_t)(opt.prebuffer_ms > 0 ? opt.prebuffer_ms : PLAYOUT_DELAY_INITIAL_MS) * 1000;
+        int64_t play_end_us = reply_start_us + (int64_t)opt.reply_ms * 1000 + prebuffer_us;
+        reply_start_us = std::max(last_us, play_end_us) + 1000 * 1000;
+    }
+    return trace;
+}
+
+static bool read_exact(FILE* f, void* buf, size_t len) {
+    return fread(buf, 1, len, f) == len;
+}
+
+static bool is_tts_end(const CaptureRecord& record) {
+    if (record.flags & CAPTURE_FLAG_BINARY) {
+        return record.data.size() >= sizeof(ControlProtocol::Header) && record.data[0] == ControlProtocol::MAGIC &&
+               record.data[1] == (uint8_t)ControlProtocol::Type::TTS_END;
+    }
+    std::string_view text((const char*)record.data.data(), record.data.size());
+    return text.find("\"type\":\"tts_end\"") != std::string_view::npos;
+}
+
+/**
+ * @brief 读取会话录制文件，取出下行音频和tts_end
+ *
+ * 有设备端时间戳时第n条下行音频用设备收到的时间（按顺序和服务器发出的第n条对应），
+ * tts_end按前一条下行音频的时间差换算到设备时间；没有时用服务器发出的时间。
+ * 空闲后或tts_end之后的第一条音频前补一个回复开始。
+ */
+static bool load_capture(const char* path, Trace* trace) {
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        fprintf(stderr, "❌ 打不开录制文件: %s\n", path);
+        return false;
+    }
+    std::vector<CaptureRecord> relay;
+    std::vector<int64_t> device_audio_us;
+    uint8_t header[CAPTURE_FILE_HEADER_BYTES];
+    bool ok = read_exact(f, header, sizeof(header)) && memcmp(header, CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC)) == 0;
+    if (ok) {
+        uint8_t rec[CAPTURE_RECORD_BYTES];
+        while (read_exact(f, rec, sizeof(rec))) {
+            CaptureRecord record;
+            uint64_t t_us;
+            uint32_t len;
+            memcpy(&t_us, rec, sizeof(t_us));
+            memcpy(&len, rec + 12, sizeof(len));
+            record.t_us = (int64_t)t_us;
+            record.kind = (SessionCapture::Kind)rec[8];
+            record.flags = rec[9];
+            record.data.resize(len);
+            if (len > 0 && !read_exact(f, record.data.data(), len)) {
+                break;      // 录制时进程被杀，最后一条不完整
+            }
+            if (record.flags & CAPTURE_FLAG_DEVICE) {
+                if (record.kind == SessionCapture::Kind::DOWNLINK_AUDIO) {
+                    device_audio_us.push_back(record.t_us);
+                }
+            } else if (record.kind == SessionCapture::Kind::DOWNLINK_AUDIO ||
+                       (record.kind == SessionCapture::Kind::DOWNLINK_CONTROL && is_tts_end(record))) {
+                relay.push_back(std::move(record));
+            }
+        }
+    }
+    fclose(f);
+    if (!ok) {
+        fprintf(stderr, "❌ 录制文件格式错误: %s\n", path);
+        return false;
+    }
+
+    size_t audio_index = 0;
+    int64_t offset_us = 0;          // 设备时间 - 服务器时间（最近一条下行音频）
+    int64_t base_us = -1;
+    bool in_reply = false;
+    for (CaptureRecord& record : relay) {
+        bool audio = record.kind == SessionCapture::Kind::DOWNLINK_AUDIO;
+        if (audio) {
+            if (audio_index == 0) {
+                trace->codec = (record.flags & CAPTURE_FLAG_ADPCM) ? DownlinkCodec::ADPCM
+                             : (record.flags & CAPTURE_FLAG_F32)  ? DownlinkCodec::F32_24K
+                                                                  : DownlinkCodec::PCM;
+                trace->framed = (record.flags & CAPTURE_FLAG_FRAMED) != 0;
+            }
+            if (audio_index < device_audio_us.size()) {
+                offset_us = device_audio_us[audio_index] - record.t_us;
+            }
+            audio_index++;
+        }
+        int64_t t_us = record.t_us + offset_us;
+        if (base_us < 0) {
+            base_us = t_us - 200 * 1000;
+        }
+        t_us = std::max<int64_t>(t_us - base_us, trace->records.empty() ? 0 : trace->records.back().t_us);
+        if (audio && !in_reply) {
+            trace->records.push_back({ t_us, RECORD_REPLY_START, {} });
+        }
+        in_reply = audio;
+        trace->records.push_back({ t_us, audio ? RECORD_AUDIO : RECORD_TTS_END, std::move(record.data) });
+    }
+    if (!device_audio_us.empty() && device_audio_us.size() != audio_index) {
+        fprintf(stderr, "⚠️ 下行音频条数不一致：服务器端%zu条，设备端%zu条，多出的按服务器时间\n",
+                audio_index, device_audio_us.size());
+    }
+    return true;
+}
+
+/**
+ * @brief 把输入存成录制文件（只有服务器端的下行音频和JSON文本tts_end）
+ */
+static bool save_capture(const char* path, const Trace& trace) {
+    FILE* f = fopen(path, "wb");
+    if (!f) {
+        fprintf(stderr, "❌ 无法写入录制文件: %s\n", path);
+        return false;
+    }
+    static const char TTS_END_JSON[] = "{\"type\":\"tts_end\"}";
+    uint8_t header[CAPTURE_FILE_HEADER_BYTES] = {};
+    uint16_t sample_rate = SAMPLE_RATE;
+    memcpy(header, CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC));
+    header[4] = CAPTURE_VERSION;
+    memcpy(header + 6, &sample_rate, sizeof(sample_rate));
+    fwrite(header, 1, sizeof(header), f);
+    for (const Record& record : trace.records) {
+        if (record.kind == RECORD_REPLY_START) {
+            continue;
+        }
+        bool audio = record.kind == RECORD_AUDIO;
+        uint8_t rec[CAPTURE_RECORD_BYTES] = {};
+        uint64_t t_us = (uint64_t)record.t_us;
+        uint32_t len = audio ? (uint32_t)record.data.size() : (uint32_t)strlen(TTS_END_JSON);
+        memcpy(rec, &t_us, sizeof(t_us));
+        rec[8] = (uint8_t)(audio ? SessionCapture::Kind::DOWNLINK_AUDIO : SessionCapture::Kind::DOWNLINK_CONTROL);
+        rec[9] = !audio ? 0
+               : trace.codec == DownlinkCodec::ADPCM   ? CAPTURE_FLAG_ADPCM
+               : trace.codec == DownlinkCodec::F32_24K ? CAPTURE_FLAG_F32
+                                                       : 0;
+        if (audio && trace.framed) {
+            rec[9] |= CAPTURE_FLAG_FRAMED;
+        }
+        memcpy(rec + 12, &len, sizeof(len));
+        fwrite(rec, 1, sizeof(rec), f);
+        fwrite(audio ? (const void*)record.data.data() : (const void*)TTS_END_JSON, 1, len, f);
+    }
+    fclose(f);
+    return true;
+}
+
+// ---------------------------------------------------------------- 测量
+
+struct Sample {
+    int64_t cpu_us;
+    uint64_t copies;
+    uint64_t copy_bytes;
+};
+
+// 播放任务里每两次写I2S之间的开销（写I2S本身的阻塞不占CPU）
+struct ChunkMeter {
+    bool started = false;
+    int64_t last_cpu_us = 0;
+    HostCopyStats last_copy = {};
+    std::vector<Sample> samples;
+    FILE* out = nullptr;
+};
+
+static void on_sink_write(const int16_t* samples, size_t count, void* ctx) {
+    ChunkMeter* meter = (ChunkMeter*)ctx;
+    int64_t cpu = host_thread_cpu_us();
+    HostCopyStats copy = host_copy_stats();
+    if (meter->started) {
+        meter->samples.push_back({ cpu - meter->last_cpu_us, copy.calls - meter->last_copy.calls,
+                                   copy.bytes - meter->last_copy.bytes });
+    }
+    if (meter->out) {
+        fwrite(samples, sizeof(int16_t), count, meter->out);
+    }
+    meter->started = true;
+    // 不把回调自己（和写文件）的开销算进下一块
+    meter->last_cpu_us = host_thread_cpu_us();
+    meter->last_copy = host_copy_stats();
+}
+
+struct Summary {
+    size_t count = 0;
+    int64_t p50 = 0;
+    int64_t p99 = 0;
+    int64_t max = 0;
+    double copies = 0;
+    double copy_bytes = 0;
+};
+
+static Summary summarize(std::vector<Sample> samples) {
+    Summary s;
+    s.count = samples.size();
+    if (samples.empty()) {
+        return s;
+    }
+    uint64_t copies = 0, bytes = 0;
+    for (const Sample& sample : samples) {
+        copies += sample.copies;
+        bytes += sample.copy_bytes;
+    }
+    std::sort(samples.begin(), samples.end(), [](const Sample& a, const Sample& b) { return a.cpu_us < b.cpu_us; });
+    s.p50 = samples[samples.size() / 2].cpu_us;
+    s.p99 = samples[std::min(samples.size() - 1, samples.size() * 99 / 100)].cpu_us;
+    s.max = samples.back().cpu_us;
+    s.copies = (double)copies / samples.size();
+    s.copy_bytes = (double)bytes / samples.size();
+    return s;
+}
+
+// ---------------------------------------------------------------- 回放
+
+static std::vector<Sample> replay(AudioManager& audio, const Trace& trace, const Options& opt) {
+    std::vector<Sample> messages;
+    const int64_t t0 = host_now_us();
+    for (const Record& record : trace.records) {
+        host_sleep_until_us(t0 + record.t_us);
+        if (record.kind == RECORD_REPLY_START) {
+            audio.start_streaming_playback();
+            continue;
+        }
+        if (record.kind == RECORD_TTS_END) {
+            audio.finish_streaming_playback();
+            continue;
+        }
+
+        int64_t cpu = host_thread_cpu_us();
+        HostCopyStats copy = host_copy_stats();
+        const uint8_t* data = record.data.data();
+        size_t len = record.data.size();
+        size_t step = opt.fragment > 0 ? opt.fragment : std::max<size_t>(len, 1);
+        for (size_t pos = 0; pos < len || pos == 0; pos += step) {
+            size_t n = std::min(step, len - pos);
+            audio.feed_streaming_fragment(data + pos, n, pos == 0, pos + n >= len);
+            if (len == 0) {
+                break;
+            }
+        }
+        HostCopyStats after = host_copy_stats();
+        messages.push_back({ host_thread_cpu_us() - cpu, after.calls - copy.calls, after.bytes - copy.bytes });
+    }
+
+    // 等最后一段回复播完（播放任务releaseI2S之后还要并入统计，多等一个播放块）
+    const int64_t deadline = host_now_us() + 30 * 1000 * 1000;
+    do {
+        host_sleep_until_us(host_now_us() + PLAYBACK_CHUNK_MS * 1000);
+    } while (host_sink_active() && host_now_us() < deadline);
+    host_sleep_until_us(host_now_us() + 2 * PLAYBACK_CHUNK_MS * 1000);
+    return messages;
+}
+
+// ---------------------------------------------------------------- 命令行
+
+static void usage(const char* argv0) {
+    fprintf(stderr,
+            "用法: %s [选项]\n"
+            "  --capture FILE        回放会话录制文件里的下行（默认合成TTS回复）\n"
+            "  --write-capture FILE  把输入存成录制文件\n"
+            "  --out FILE            把模拟I2S的输出存成16kHz单声道PCM\n"
+            "  --f32-24k             合成24kHz float32下行（设备端重采样）\n"
+            "  --framing             合成的下行消息带音频帧头\n"
+            "  --loss PCT            合成时随机丢掉的消息百分比（配合--framing看丢包补偿）\n"
+            "  --replies N           合成的回复段数（默认3）\n"
+            "  --reply-ms MS         每段回复时长（默认4000）\n"
+            "  --msg-ms MS           每条下行消息的时长（默认50）\n"
+            "  --rate X              TTS产出速度，相对实时（默认1.5）\n"
+            "  --jitter-ms MS        每条消息额外随机延迟上限（默认30）\n"
+            "  --stall-every N       每N条消息卡顿一次（默认0=不卡顿）\n"
+            "  --stall-ms MS         每次卡顿时长（默认200）\n"
+            "  --fragment BYTES      按WebSocket接收缓冲区切片送入（默认0=整条）\n"
+            "  --prebuffer-ms MS     固定预缓冲目标（默认0=按到达抖动自适应）\n"
+            "  --speed X             回放倍速（默认4）\n"
+            "  --seed N              随机种子（默认1）\n"
+            "  --json                只输出一行JSON结果\n"
+            "  --verbose             输出固件的ESP_LOGI日志\n"
+            "  --debug               再加上ESP_LOGD（每条消息、每次欠载）\n"
+            "  --max-underruns N     欠载次数上限\n"
+            "  --max-gaps N          模拟I2S断音次数上限\n"
+            "  --max-chunk-us US     播放块CPU时间p99上限\n"
+            "  --max-msg-us US       下行消息CPU时间p99上限\n"
+            "  --max-chunk-copies N  每个播放块平均memcpy次数上限\n",
+            argv0);
+}
+
+static bool parse_args(int argc, char** argv, Options* opt) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&]() -> const char* {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "❌ %s 缺少参数\n", arg.c_str());
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--capture") opt->capture_path = value();
+        else if (arg == "--write-capture") opt->write_capture_path = value();
+        else if (arg == "--out") opt->out_path = value();
+        else if (arg == "--f32-24k") opt->f32_24k = true;
+        else if (arg == "--framing") opt->framing = true;
+        else if (arg == "--loss") opt->loss = atof(value()) / 100.0;
+        else if (arg == "--replies") opt->replies = atoi(value());
+        else if (arg == "--reply-ms") opt->reply_ms = atoi(value());
+        else if (arg == "--msg-ms") opt->msg_ms = std::max(1, atoi(value()));
+        else if (arg == "--rate") opt->rate = std::max(0.1, atof(value()));
+        else if (arg == "--jitter-ms") opt->jitter_ms = atoi(value());
+        else if (arg == "--stall-every") opt->stall_every = atoi(value());
+        else if (arg == "--stall-ms") opt->stall_ms = atoi(value());
+        else if (arg == "--fragment") opt->fragment = (size_t)atol(value());
+        else if (arg == "--prebuffer-ms") opt->prebuffer_ms = atoi(value());
+        else if (arg == "--speed") opt->speed = atof(value());
+        else if (arg == "--seed") opt->seed = (unsigned)atol(value());
+        else if (arg == "--json") opt->json = true;
+        else if (arg == "--verbose") host_log_level = 2;
+        else if (arg == "--debug") host_log_level = 3;
+        else if (arg == "--max-underruns") opt->max_underruns = atol(value());
+        else if (arg == "--max-gaps") opt->max_gaps = atol(value());
+        else if (arg == "--max-chunk-us") opt->max_chunk_us = atol(value());
+        else if (arg == "--max-msg-us") opt->max_msg_us = atol(value());
+        else if (arg == "--max-chunk-copies") opt->max_chunk_copies = atof(value());
+        else {
+            usage(argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parse_args(argc, argv, &opt)) {
+        return 2;
+    }
+    host_set_speed(opt.speed);
+
+    Trace trace;
+    if (opt.capture_path) {
+        if (!load_capture(opt.capture_path, &trace)) {
+            return 2;
+        }
+    } else {
+        trace = synth_trace(opt);
+    }
+    if (opt.write_capture_path && !save_capture(opt.write_capture_path, trace)) {
+        return 2;
+    }
+
+    ChunkMeter meter;
+    if (opt.out_path && !(meter.out = fopen(opt.out_path, "wb"))) {
+        fprintf(stderr, "❌ 无法写入输出文件: %s\n", opt.out_path);
+        return 2;
+    }
+    host_sink_set_hook(on_sink_write, &meter);
+
+    AudioManager* audio = new AudioManager(SAMPLE_RATE, 0);    // 播放任务一直在跑，不析构
+    audio->set_downlink_codec(trace.codec);
+    audio->set_audio_framing(trace.framed);
+    audio->set_prebuffer_ms(opt.prebuffer_ms);
+
+    Summary msg = summarize(replay(*audio, trace, opt));
+    host_sink_set_hook(nullptr, nullptr);
+    Summary chunk = summarize(meter.samples);
+    if (meter.out) {
+        fclose(meter.out);
+    }
+
+    HostSinkStats sink = host_sink_stats();
+    uint32_t underruns = PerfCounters::get(PerfCounter::JITTER_UNDERRUNS);
+    uint32_t dropped = PerfCounters::get(PerfCounter::JITTER_DROPPED_SAMPLES);
+    uint32_t max_fill = PerfCounters::get(PerfGauge::JITTER_FILL);
+    uint32_t lost_messages = PerfCounters::get(PerfCounter::DOWNLINK_LOST_MESSAGES);
+    uint32_t concealed = PerfCounters::get(PerfCounter::PLC_SAMPLES);
+    uint32_t stretched = PerfCounters::get(PerfCounter::PLAYOUT_STRETCH_SAMPLES);
+    uint32_t drift_inserted = PerfCounters::get(PerfCounter::PLAYOUT_DRIFT_INSERTED);
+    uint32_t drift_removed = PerfCounters::get(PerfCounter::PLAYOUT_DRIFT_REMOVED);
+    AudioManager::Footprint footprint = audio->get_footprint();
+
+    if (opt.json) {
+        printf("{\"messages\":%zu,\"msg_cpu_p50_us\":%lld,\"msg_cpu_p99_us\":%lld,\"msg_cpu_max_us\":%lld,"
+               "\"msg_copies\":%.2f,\"msg_copy_bytes\":%.0f,"
+               "\"chunks\":%zu,\"chunk_cpu_p50_us\":%lld,\"chunk_cpu_p99_us\":%lld,\"chunk_cpu_max_us\":%lld,"
+               "\"chunk_copies\":%.2f,\"chunk_copy_bytes\":%.0f,"
+               "\"underruns\":%lu,\"dropped_samples\":%lu,\"max_fill\":%lu,\"gaps\":%lu,\"gap_ms\":%.1f,"
+               "\"lost_messages\":%lu,\"concealed_samples\":%lu,\"prebuffer_ms\":%lu,\"stretched_samples\":%lu,"
+               "\"drift_inserted\":%lu,\"drift_removed\":%lu,\"played_samples\":%llu,\"internal_bytes\":%zu,\"psram_bytes\":%zu}\n",
+               msg.count, (long long)msg.p50, (long long)msg.p99, (long long)msg.max, msg.copies, msg.copy_bytes,
+               chunk.count, (long long)chunk.p50, (long long)chunk.p99, (long long)chunk.max, chunk.copies, chunk.copy_bytes,
+               (unsigned long)underruns, (unsigned long)dropped, (unsigned long)max_fill,
+               (unsigned long)sink.gaps, sink.gap_us / 1000.0,
+               (unsigned long)lost_messages, (unsigned long)concealed,
+               (unsigned long)audio->get_prebuffer_ms(), (unsigned long)stretched,
+               (unsigned long)drift_inserted, (unsigned long)drift_removed, (unsigned long long)sink.samples,
+               footprint.internal_bytes, footprint.psram_bytes);
+    } else {
+        printf("📊 下行播放基准: %zu条消息, 播出%.1f s, 回放倍速%.1fx\n",
+               msg.count, sink.samples / (double)SAMPLE_RATE, opt.speed);
+        printf("  下行消息: CPU p50 %lld us / p99 %lld us / max %lld us, memcpy %.2f次 %.0f字节\n",
+               (long long)msg.p50, (long long)msg.p99, (long long)msg.max, msg.copies, msg.copy_bytes);
+        printf("  播放块:   %zu块, CPU p50 %lld us / p99 %lld us / max %lld us, memcpy %.2f次 %.0f字节\n",
+               chunk.count, (long long)chunk.p50, (long long)chunk.p99, (long long)chunk.max, chunk.copies, chunk.copy_bytes);
+        printf("  抖动缓冲: 欠载%lu次, 丢弃%lu样本, 最高水位%lu样本\n",
+               (unsigned long)underruns, (unsigned long)dropped, (unsigned long)max_fill);
+        printf("  播放延迟: 预缓冲目标%lu ms, 静音段拉长%lu样本, 漂移补偿插入%lu/去掉%lu样本\n",
+               (unsigned long)audio->get_prebuffer_ms(), (unsigned long)stretched,
+               (unsigned long)drift_inserted, (unsigned long)drift_removed);
+        if (trace.framed) {
+            printf("  丢包补偿: 缺%lu条消息, 补偿%lu样本\n", (unsigned long)lost_messages, (unsigned long)concealed);
+        }
+        printf("  模拟I2S:  断音%lu次 (%.1f ms), 非零样本%llu\n",
+               (unsigned long)sink.gaps, sink.gap_us / 1000.0, (unsigned long long)sink.nonzero_samples);
+        printf("  内存占用: 内部RAM %zu 字节, PSRAM %zu 字节\n", footprint.internal_bytes, footprint.psram_bytes);
+    }
+
+    bool failed = false;
+    auto check = [&failed](const char* name, bool over, double value, double limit) {
+        if (over) {
+            fprintf(stderr, "❌ %s超出阈值: %.2f > %.2f\n", name, value, limit);
+            failed = true;
+        }
+    };
+    check("欠载次数", opt.max_underruns >= 0 && underruns > opt.max_underruns, underruns, opt.max_underruns);
+    check("断音次数", opt.max_gaps >= 0 && sink.gaps > opt.max_gaps, sink.gaps, opt.max_gaps);
+    check("播放块CPU p99", opt.max_chunk_us >= 0 && chunk.p99 > opt.max_chunk_us, chunk.p99, opt.max_chunk_us);
+    check("下行消息CPU p99", opt.max_msg_us >= 0 && msg.p99 > opt.max_msg_us, msg.p99, opt.max_msg_us);
+    check("每块memcpy次数", opt.max_chunk_copies >= 0 && chunk.copies > opt.max_chunk_copies,
+          chunk.copies, opt.max_chunk_copies);
+
+    fflush(stdout);
+    _exit(failed ? 1 : 0);     // 播放任务是分离的线程，直接退出
+}
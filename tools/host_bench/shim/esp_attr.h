@@ -0,0 +1,9 @@
+/**
+ * @file esp_attr.h
+ * @brief 🖥️ 段属性垫片 - 主机上没有IRAM和RTC内存，IRAM_ATTR/RTC_NOINIT_ATTR展开为空
+ */
+
+#pragma once
+
+#define IRAM_ATTR
+#define RTC_NOINIT_ATTR
@@ -0,0 +1,22 @@
+/**
+ * @file esp_cache.h
+ * @brief 🖥️ 缓存同步垫片 - 主机上没有要作废的缓存行
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include "esp_err.h"
+
+#define ESP_CACHE_MSYNC_FLAG_INVALIDATE (1 << 0)
+#define ESP_CACHE_MSYNC_FLAG_UNALIGNED (1 << 1)
+#define ESP_CACHE_MSYNC_FLAG_DIR_C2M (1 << 2)
+#define ESP_CACHE_MSYNC_FLAG_DIR_M2C (1 << 3)
+#define ESP_CACHE_MSYNC_FLAG_TYPE_DATA (1 << 4)
+
+static inline esp_err_t esp_cache_msync(void* addr, size_t size, int flags) {
+    (void)addr;
+    (void)size;
+    (void)flags;
+    return ESP_OK;
+}
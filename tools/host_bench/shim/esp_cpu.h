@@ -0,0 +1,8 @@
+/**
+ * @file esp_cpu.h
+ * @brief 🖥️ CPU垫片 - 主机上的线程都记成核心0
+ */
+
+#pragma once
+
+static inline int esp_cpu_get_core_id(void) { return 0; }
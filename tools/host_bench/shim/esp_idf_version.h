@@ -0,0 +1,9 @@
+/**
+ * @file esp_idf_version.h
+ * @brief 🖥️ 主机构建垫片：esp-dsp的公共头文件会检查IDF版本
+ */
+
+#pragma once
+
+#define ESP_IDF_VERSION_VAL(major, minor, patch) (((major) << 16) | ((minor) << 8) | (patch))
+#define ESP_IDF_VERSION ESP_IDF_VERSION_VAL(5, 5, 0)
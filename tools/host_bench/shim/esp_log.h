@@ -0,0 +1,22 @@
+/**
+ * @file esp_log.h
+ * @brief 🖥️ ESP_LOGx垫片 - 打到stderr，级别由基准测试的--verbose决定（默认只输出告警和错误）
+ */
+
+#pragma once
+
+#include <stdio.h>
+
+extern int host_log_level;     // 0=E 1=W 2=I 3=D
+
+#define HOST_LOG(level, letter, tag, format, ...) do { \
+        if (host_log_level >= (level)) { \
+            fprintf(stderr, letter " (%s) " format "\n", tag, ##__VA_ARGS__); \
+        } \
+    } while (0)
+
+#define ESP_LOGE(tag, format, ...) HOST_LOG(0, "E", tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) HOST_LOG(1, "W", tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) HOST_LOG(2, "I", tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) HOST_LOG(3, "D", tag, format, ##__VA_ARGS__)
+#define ESP_LOGV(tag, format, ...) do { } while (0)
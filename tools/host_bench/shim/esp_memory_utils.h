@@ -0,0 +1,28 @@
+/**
+ * @file esp_memory_utils.h
+ * @brief 🖥️ 地址区域判断垫片 - 主机上只有一种内存，全部算作DMA可达的内部RAM
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+static inline bool esp_ptr_external_ram(const void* ptr) {
+    (void)ptr;
+    return false;
+}
+
+static inline bool esp_ptr_internal(const void* ptr) {
+    return ptr != NULL;
+}
+
+static inline bool esp_ptr_dma_capable(const void* ptr) {
+    return ptr != NULL;
+}
+
+// 主机上没有经过缓存映射的Flash，提示音都按RAM数据直接读
+static inline bool esp_ptr_in_drom(const void* ptr) {
+    (void)ptr;
+    return false;
+}
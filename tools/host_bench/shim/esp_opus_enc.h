@@ -0,0 +1,46 @@
+/**
+ * @file esp_opus_enc.h
+ * @brief 🖥️ Opus编码器垫片 - 打开总是失败，上行退回PCM（基准测试只测下行播放链路）
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef void* esp_audio_enc_handle_t;
+typedef enum { ESP_AUDIO_ERR_OK = 0, ESP_AUDIO_ERR_FAIL = -1 } esp_audio_err_t;
+typedef enum {
+    ESP_OPUS_ENC_FRAME_DURATION_20_MS = 3,
+    ESP_OPUS_ENC_FRAME_DURATION_40_MS,
+    ESP_OPUS_ENC_FRAME_DURATION_60_MS,
+} esp_opus_enc_frame_duration_t;
+typedef enum { ESP_OPUS_ENC_APPLICATION_VOIP, ESP_OPUS_ENC_APPLICATION_AUDIO } esp_opus_enc_application_t;
+typedef struct {
+    uint32_t sample_rate;
+    uint8_t channel;
+    uint8_t bits_per_sample;
+    int bitrate;
+    esp_opus_enc_frame_duration_t frame_duration;
+    esp_opus_enc_application_t application_mode;
+    int complexity;
+    bool enable_fec;
+    bool enable_dtx;
+    bool enable_vbr;
+} esp_opus_enc_config_t;
+#define ESP_OPUS_ENC_CONFIG_DEFAULT() \
+    { 16000, 1, 16, 24000, ESP_OPUS_ENC_FRAME_DURATION_20_MS, ESP_OPUS_ENC_APPLICATION_VOIP, 0, false, false, true }
+typedef struct { uint8_t* buffer; uint32_t len; } esp_audio_enc_in_frame_t;
+typedef struct { uint8_t* buffer; uint32_t len; uint32_t encoded_bytes; uint64_t pts; } esp_audio_enc_out_frame_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+esp_audio_err_t esp_opus_enc_open(void* cfg, uint32_t cfg_size, void** handle);
+esp_audio_err_t esp_opus_enc_close(void* handle);
+esp_audio_err_t esp_opus_enc_get_frame_size(void* handle, int* in_size, int* out_size);
+esp_audio_err_t esp_opus_enc_process(void* handle, esp_audio_enc_in_frame_t* in, esp_audio_enc_out_frame_t* out);
+esp_audio_err_t esp_opus_enc_set_bitrate(void* handle, int bitrate);
+#ifdef __cplusplus
+}
+#endif
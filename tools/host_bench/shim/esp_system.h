@@ -0,0 +1,29 @@
+/**
+ * @file esp_system.h
+ * @brief 🖥️ 系统垫片 - 复位原因总是上电，关机回调只登记不调用（基准测试不重启）
+ */
+
+#pragma once
+
+#include "esp_err.h"
+
+typedef enum {
+    ESP_RST_UNKNOWN,
+    ESP_RST_POWERON,
+    ESP_RST_EXT,
+    ESP_RST_SW,
+    ESP_RST_PANIC,
+    ESP_RST_INT_WDT,
+    ESP_RST_TASK_WDT,
+    ESP_RST_WDT,
+    ESP_RST_DEEPSLEEP,
+    ESP_RST_BROWNOUT,
+} esp_reset_reason_t;
+
+typedef void (*shutdown_handler_t)(void);
+
+static inline esp_reset_reason_t esp_reset_reason(void) { return ESP_RST_POWERON; }
+static inline esp_err_t esp_register_shutdown_handler(shutdown_handler_t handler) {
+    (void)handler;
+    return ESP_OK;
+}
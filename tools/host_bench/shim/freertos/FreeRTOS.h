@@ -0,0 +1,55 @@
+/**
+ * @file FreeRTOS.h
+ * @brief 🖥️ 主机基准测试用的FreeRTOS垫片 - 任务是std::thread，1 tick = 1 ms（按回放倍速缩放）
+ *
+ * 只实现main/里音频链路用到的那部分API，行为对齐FreeRTOS：
+ * 任务通知是计数型的，队列按值拷贝固定大小的条目，临界区是一把全局互斥锁。
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef void (*TaskFunction_t)(void*);
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+#define portMAX_DELAY ((TickType_t)0xffffffffUL)
+#define configTICK_RATE_HZ 1000
+#define portTICK_PERIOD_MS 1
+#define portNUM_PROCESSORS 2
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define tskNO_AFFINITY 0x7fffffff
+#ifndef BIT0
+#define BIT0 0x00000001
+#define BIT1 0x00000002
+#define BIT2 0x00000004
+#define BIT3 0x00000008
+#endif
+
+typedef struct {
+    int reserved;
+} portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED { 0 }
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void host_critical_enter(void);
+void host_critical_exit(void);
+#define portENTER_CRITICAL(mux) ((void)(mux), host_critical_enter())
+#define portEXIT_CRITICAL(mux) ((void)(mux), host_critical_exit())
+#define portENTER_CRITICAL_ISR(mux) portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_ISR(mux) portEXIT_CRITICAL(mux)
+#define configASSERT(x) do { if (!(x)) { host_assert_failed(#x, __FILE__, __LINE__); } } while (0)
+void host_assert_failed(const char* expr, const char* file, int line);
+#ifdef __cplusplus
+}
+#endif
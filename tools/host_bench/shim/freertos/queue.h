@@ -0,0 +1,29 @@
+/**
+ * @file queue.h
+ * @brief 🖥️ FreeRTOS队列API垫片（见FreeRTOS.h）
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+struct HostQueue;
+typedef struct HostQueue* QueueHandle_t;
+typedef struct {
+    void* reserved;
+} StaticQueue_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size);
+// 主机上不用调用方给的存储，照样在堆上建（只有设备上才关心分配）
+QueueHandle_t xQueueCreateStatic(UBaseType_t length, UBaseType_t item_size, uint8_t* storage, StaticQueue_t* buffer);
+void vQueueDelete(QueueHandle_t queue);
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks);
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticks);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
+#define xQueueSendToBack xQueueSend
+#ifdef __cplusplus
+}
+#endif
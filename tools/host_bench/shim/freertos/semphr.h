@@ -0,0 +1,23 @@
+/**
+ * @file semphr.h
+ * @brief 🖥️ FreeRTOS二值信号量垫片（用长度为1的队列实现，和FreeRTOS一样）
+ */
+
+#pragma once
+
+#include "freertos/queue.h"
+
+typedef QueueHandle_t SemaphoreHandle_t;
+typedef StaticQueue_t StaticSemaphore_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t* buffer);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks);
+#define vSemaphoreDelete(sem) vQueueDelete(sem)
+#ifdef __cplusplus
+}
+#endif
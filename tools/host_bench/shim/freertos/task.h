@@ -0,0 +1,31 @@
+/**
+ * @file task.h
+ * @brief 🖥️ FreeRTOS任务API垫片（见FreeRTOS.h）
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+struct HostTask;
+typedef struct HostTask* TaskHandle_t;
+// 和ESP-IDF一样按字节计栈；主机上不建静态任务，只用到类型
+typedef uint8_t StackType_t;
+typedef struct { uint8_t reserved[1]; } StaticTask_t;
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack_depth, void* arg,
+                                   UBaseType_t priority, TaskHandle_t* handle, BaseType_t core);
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stack_depth, void* arg,
+                       UBaseType_t priority, TaskHandle_t* handle);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+TickType_t xTaskGetTickCount(void);
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+#ifdef __cplusplus
+}
+#endif
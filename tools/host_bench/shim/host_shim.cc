@@ -0,0 +1,574 @@
+/**
+ * @file host_shim.cc
+ * @brief 🖥️ 垫片实现 - FreeRTOS任务/队列、heap_caps、esp_timer、模拟I2S和memcpy计数
+ */
+
+#include "host_shim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_opus_enc.h"
+#include "esp_partition.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "bsp_board.h"
+#include "project_config.h"
+
+int host_log_level = 1;
+
+// ---------------------------------------------------------------- 虚拟时钟
+
+static const auto s_epoch = std::chrono::steady_clock::now();
+static std::atomic<double> s_speed{1.0};
+
+void host_set_speed(double speed) {
+    s_speed = speed > 0 ? speed : 1.0;
+}
+
+int64_t host_now_us() {
+    auto real = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - s_epoch);
+    return (int64_t)(real.count() * s_speed.load());
+}
+
+// 虚拟时长换算成真实时长
+static std::chrono::microseconds real_duration(int64_t virtual_us) {
+    return std::chrono::microseconds((int64_t)(virtual_us / s_speed.load()));
+}
+
+void host_sleep_until_us(int64_t t_us) {
+    int64_t now = host_now_us();
+    if (t_us > now) {
+        std::this_thread::sleep_for(real_duration(t_us - now));
+    }
+}
+
+static std::chrono::steady_clock::time_point deadline_for(TickType_t ticks) {
+    if (ticks == portMAX_DELAY) {
+        return std::chrono::steady_clock::time_point::max();
+    }
+    return std::chrono::steady_clock::now() + real_duration((int64_t)ticks * 1000);
+}
+
+extern "C" int64_t esp_timer_get_time(void) {
+    return host_now_us();
+}
+
+// 定时器只发句柄不触发（HeapMonitor等周期采样在基准测试里没有意义）
+struct esp_timer {
+    esp_timer_create_args_t args;
+};
+
+extern "C" esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* out_handle) {
+    *out_handle = new esp_timer{ *args };
+    return ESP_OK;
+}
+
+extern "C" esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period_us) {
+    (void)timer;
+    (void)period_us;
+    return ESP_OK;
+}
+
+extern "C" esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+    (void)timer;
+    return ESP_OK;
+}
+
+extern "C" esp_err_t esp_timer_delete(esp_timer_handle_t timer) {
+    delete timer;
+    return ESP_OK;
+}
+
+int64_t host_thread_cpu_us() {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// ---------------------------------------------------------------- 任务
+
+struct HostTask {
+    std::mutex mutex;
+    std::condition_variable cv;
+    uint32_t notify_count = 0;
+};
+
+// vTaskDelete(NULL)从任务函数里一路抛到线程入口，和FreeRTOS一样不再返回
+struct HostTaskExit {};
+
+static thread_local HostTask* t_current_task = nullptr;
+static HostTask s_main_task;     // 不是由xTaskCreate创建的线程（基准测试的主线程）共用
+
+extern "C" BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack_depth, void* arg,
+                                              UBaseType_t priority, TaskHandle_t* handle, BaseType_t core) {
+    (void)name;
+    (void)stack_depth;
+    (void)priority;
+    (void)core;
+    HostTask* task = new HostTask();
+    if (handle) {
+        *handle = task;
+    }
+    std::thread([fn, arg, task]() {
+        t_current_task = task;
+        try {
+            fn(arg);
+        } catch (const HostTaskExit&) {
+        }
+    }).detach();
+    return pdPASS;
+}
+
+extern "C" BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stack_depth, void* arg,
+                                  UBaseType_t priority, TaskHandle_t* handle) {
+    return xTaskCreatePinnedToCore(fn, name, stack_depth, arg, priority, handle, tskNO_AFFINITY);
+}
+
+extern "C" void vTaskDelete(TaskHandle_t task) {
+    if (task == nullptr || task == t_current_task) {
+        throw HostTaskExit();
+    }
+    // 线程不能从外部终止：只在析构AudioManager时删除别的任务，基准测试退出前不会再用到
+}
+
+extern "C" void vTaskDelay(TickType_t ticks) {
+    std::this_thread::sleep_until(deadline_for(ticks));
+}
+
+extern "C" TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    return t_current_task ? t_current_task : &s_main_task;
+}
+
+extern "C" TickType_t xTaskGetTickCount(void) {
+    return (TickType_t)(host_now_us() / 1000);
+}
+
+extern "C" uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks) {
+    HostTask* task = xTaskGetCurrentTaskHandle();
+    std::unique_lock<std::mutex> lock(task->mutex);
+    task->cv.wait_until(lock, deadline_for(ticks), [task] { return task->notify_count > 0; });
+    uint32_t value = task->notify_count;
+    if (value > 0) {
+        task->notify_count = clear_on_exit ? 0 : value - 1;
+    }
+    return value;
+}
+
+extern "C" BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    {
+        std::lock_guard<std::mutex> lock(task->mutex);
+        task->notify_count++;
+    }
+    task->cv.notify_one();
+    return pdPASS;
+}
+
+// ---------------------------------------------------------------- 临界区
+
+static std::recursive_mutex s_critical;
+
+extern "C" void host_critical_enter(void) {
+    s_critical.lock();
+}
+
+extern "C" void host_critical_exit(void) {
+    s_critical.unlock();
+}
+
+extern "C" void host_assert_failed(const char* expr, const char* file, int line) {
+    fprintf(stderr, "assert failed: %s (%s:%d)\n", expr, file, line);
+    abort();
+}
+
+// ---------------------------------------------------------------- 队列
+
+struct HostQueue {
+    std::mutex mutex;
+    std::condition_variable not_empty;
+    std::condition_variable not_full;
+    std::deque<std::vector<uint8_t>> items;
+    size_t length;
+    size_t item_size;
+};
+
+extern "C" QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size) {
+    HostQueue* queue = new HostQueue();
+    queue->length = length;
+    queue->item_size = item_size;
+    return queue;
+}
+
+extern "C" QueueHandle_t xQueueCreateStatic(UBaseType_t length, UBaseType_t item_size, uint8_t* storage,
+                                            StaticQueue_t* buffer) {
+    (void)storage;
+    (void)buffer;
+    return xQueueCreate(length, item_size);
+}
+
+extern "C" void vQueueDelete(QueueHandle_t queue) {
+    delete queue;
+}
+
+extern "C" BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks) {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!queue->not_full.wait_until(lock, deadline_for(ticks), [queue] { return queue->items.size() < queue->length; })) {
+        return pdFAIL;
+    }
+    const uint8_t* bytes = (const uint8_t*)item;
+    queue->items.emplace_back(bytes, bytes + queue->item_size);
+    queue->not_empty.notify_one();
+    return pdPASS;
+}
+
+extern "C" BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticks) {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!queue->not_empty.wait_until(lock, deadline_for(ticks), [queue] { return !queue->items.empty(); })) {
+        return pdFAIL;
+    }
+    memcpy(item, queue->items.front().data(), queue->item_size);
+    queue->items.pop_front();
+    queue->not_full.notify_one();
+    return pdPASS;
+}
+
+extern "C" UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    return (UBaseType_t)queue->items.size();
+}
+
+extern "C" SemaphoreHandle_t xSemaphoreCreateBinary(void) {
+    return xQueueCreate(1, 0);
+}
+
+extern "C" SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t* buffer) {
+    (void)buffer;
+    return xQueueCreate(1, 0);
+}
+
+extern "C" BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+    return xQueueSend(sem, nullptr, 0);
+}
+
+extern "C" BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks) {
+    uint8_t unused;
+    return xQueueReceive(sem, &unused, ticks);
+}
+
+// ---------------------------------------------------------------- heap_caps
+
+// 按分配时的caps分别记账，AudioManager的内存占用统计在主机上也有意义
+static const size_t HOST_INTERNAL_BYTES = 320 * 1024;
+static const size_t HOST_PSRAM_BYTES = 8 * 1024 * 1024;
+
+struct HostHeap {
+    std::mutex mutex;
+    std::unordered_map<void*, std::pair<size_t, bool>> blocks;   // 地址 → (大小, 是否PSRAM)
+    size_t used[2] = {};
+    size_t peak[2] = {};
+};
+
+static HostHeap& host_heap() {
+    static HostHeap heap;
+    return heap;
+}
+
+static void* track_alloc(void* ptr, size_t size, uint32_t caps) {
+    if (!ptr) {
+        return nullptr;
+    }
+    bool psram = (caps & MALLOC_CAP_SPIRAM) != 0;
+    HostHeap& heap = host_heap();
+    std::lock_guard<std::mutex> lock(heap.mutex);
+    heap.blocks[ptr] = { size, psram };
+    heap.used[psram] += size;
+    heap.peak[psram] = std::max(heap.peak[psram], heap.used[psram]);
+    return ptr;
+}
+
+extern "C" void* heap_caps_malloc(size_t size, uint32_t caps) {
+    return track_alloc(malloc(size), size, caps);
+}
+
+extern "C" void* heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+    return track_alloc(calloc(n, size), n * size, caps);
+}
+
+extern "C" void* heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps) {
+    void* ptr = nullptr;
+    if (posix_memalign(&ptr, std::max(alignment, sizeof(void*)), size) != 0) {
+        return nullptr;
+    }
+    return track_alloc(ptr, size, caps);
+}
+
+extern "C" void heap_caps_free(void* ptr) {
+    if (!ptr) {
+        return;
+    }
+    HostHeap& heap = host_heap();
+    {
+        std::lock_guard<std::mutex> lock(heap.mutex);
+        auto it = heap.blocks.find(ptr);
+        if (it != heap.blocks.end()) {
+            heap.used[it->second.second] -= it->second.first;
+            heap.blocks.erase(it);
+        }
+    }
+    free(ptr);
+}
+
+static size_t heap_free(uint32_t caps, bool minimum) {
+    bool psram = (caps & MALLOC_CAP_SPIRAM) != 0;
+    HostHeap& heap = host_heap();
+    std::lock_guard<std::mutex> lock(heap.mutex);
+    size_t total = psram ? HOST_PSRAM_BYTES : HOST_INTERNAL_BYTES;
+    size_t used = minimum ? heap.peak[psram] : heap.used[psram];
+    return used < total ? total - used : 0;
+}
+
+extern "C" size_t heap_caps_get_free_size(uint32_t caps) {
+    return heap_free(caps, false);
+}
+
+extern "C" size_t heap_caps_get_minimum_free_size(uint32_t caps) {
+    return heap_free(caps, true);
+}
+
+extern "C" size_t heap_caps_get_largest_free_block(uint32_t caps) {
+    return heap_free(caps, false);
+}
+
+// 主机堆不碎：空闲量就是一整块
+extern "C" void heap_caps_get_info(multi_heap_info_t* info, uint32_t caps) {
+    *info = {};
+    info->total_free_bytes = heap_free(caps, false);
+    info->minimum_free_bytes = heap_free(caps, true);
+    info->largest_free_block = info->total_free_bytes;
+    info->free_blocks = 1;
+}
+
+extern "C" esp_err_t heap_caps_register_failed_alloc_callback(esp_alloc_failed_hook_t callback) {
+    (void)callback;
+    return ESP_OK;
+}
+
+// ---------------------------------------------------------------- 其他ESP-IDF接口
+
+extern "C" const char* esp_err_to_name(esp_err_t code) {
+    switch (code) {
+        case ESP_OK:                return "ESP_OK";
+        case ESP_FAIL:              return "ESP_FAIL";
+        case ESP_ERR_NO_MEM:        return "ESP_ERR_NO_MEM";
+        case ESP_ERR_INVALID_ARG:   return "ESP_ERR_INVALID_ARG";
+        case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+        case ESP_ERR_INVALID_SIZE:  return "ESP_ERR_INVALID_SIZE";
+        case ESP_ERR_NOT_FOUND:     return "ESP_ERR_NOT_FOUND";
+        case ESP_ERR_NOT_SUPPORTED: return "ESP_ERR_NOT_SUPPORTED";
+        case ESP_ERR_TIMEOUT:       return "ESP_ERR_TIMEOUT";
+        case ESP_ERR_INVALID_VERSION: return "ESP_ERR_INVALID_VERSION";
+        default:                    return "UNKNOWN";
+    }
+}
+
+// 主机上没有提示音分区，PromptStore初始化失败，AudioManager照常工作
+extern "C" const esp_partition_t* esp_partition_find_first(esp_partition_type_t, esp_partition_subtype_t, const char*) {
+    return nullptr;
+}
+
+extern "C" esp_err_t esp_partition_read(const esp_partition_t*, size_t, void*, size_t) {
+    return ESP_ERR_NOT_FOUND;
+}
+
+extern "C" esp_err_t esp_partition_mmap(const esp_partition_t*, size_t, size_t, esp_partition_mmap_memory_t,
+                                        const void**, esp_partition_mmap_handle_t*) {
+    return ESP_ERR_NOT_FOUND;
+}
+
+extern "C" void esp_partition_munmap(esp_partition_mmap_handle_t) {
+}
+
+// 基准测试只跑下行播放，上行保持PCM，Opus编码器打开失败即可
+extern "C" esp_audio_err_t esp_opus_enc_open(void*, uint32_t, void**) {
+    return ESP_AUDIO_ERR_FAIL;
+}
+
+extern "C" esp_audio_err_t esp_opus_enc_close(void*) {
+    return ESP_AUDIO_ERR_OK;
+}
+
+extern "C" esp_audio_err_t esp_opus_enc_get_frame_size(void*, int*, int*) {
+    return ESP_AUDIO_ERR_FAIL;
+}
+
+extern "C" esp_audio_err_t esp_opus_enc_process(void*, esp_audio_enc_in_frame_t*, esp_audio_enc_out_frame_t*) {
+    return ESP_AUDIO_ERR_FAIL;
+}
+
+extern "C" esp_audio_err_t esp_opus_enc_set_bitrate(void*, int) {
+    return ESP_AUDIO_ERR_FAIL;
+}
+
+// ---------------------------------------------------------------- 模拟I2S
+
+static const int64_t SINK_DEFAULT_RATE = 16000;
+static const int64_t SINK_GAP_SLACK_US = 500;    // 主机线程调度的误差，不算断音
+
+struct HostSink {
+    std::mutex mutex;
+    bool active = false;
+    int64_t sample_rate = SINK_DEFAULT_RATE;    // bsp_audio_set_format()可以修改
+    int64_t dma_end_us = 0;      // DMA里已排队的数据播完的虚拟时间
+    HostSinkStats stats = {};
+    HostSinkHook hook = nullptr;
+    void* hook_ctx = nullptr;
+};
+
+static HostSink s_sink;
+
+void host_sink_set_hook(HostSinkHook hook, void* ctx) {
+    std::lock_guard<std::mutex> lock(s_sink.mutex);
+    s_sink.hook = hook;
+    s_sink.hook_ctx = ctx;
+}
+
+HostSinkStats host_sink_stats() {
+    std::lock_guard<std::mutex> lock(s_sink.mutex);
+    return s_sink.stats;
+}
+
+bool host_sink_active() {
+    std::lock_guard<std::mutex> lock(s_sink.mutex);
+    return s_sink.active;
+}
+
+extern "C" esp_err_t bsp_audio_sink_open(void) {
+    return ESP_OK;
+}
+
+extern "C" esp_err_t bsp_audio_sink_write(const void* data, size_t len, size_t* written, uint32_t timeout_ms) {
+    (void)timeout_ms;   // 模拟的DMA不会卡住，写入总是完整的
+    const int16_t* samples = (const int16_t*)data;
+    size_t count = len / sizeof(int16_t);
+    if (written) {
+        *written = len;
+    }
+
+    std::unique_lock<std::mutex> lock(s_sink.mutex);
+    int64_t duration_us = (int64_t)count * 1000000 / s_sink.sample_rate;
+    int64_t dma_us = (int64_t)I2S_TX_DMA_DESC_NUM * I2S_TX_DMA_FRAME_NUM * 1000000 / s_sink.sample_rate;
+    if (s_sink.hook) {
+        s_sink.hook(samples, count, s_sink.hook_ctx);
+    }
+    int64_t now = host_now_us();
+    if (s_sink.active && now > s_sink.dma_end_us + SINK_GAP_SLACK_US) {
+        s_sink.stats.gaps++;
+        s_sink.stats.gap_us += now - s_sink.dma_end_us;
+    }
+    if (!s_sink.active || now > s_sink.dma_end_us) {
+        s_sink.dma_end_us = now;
+    }
+    s_sink.active = true;
+
+    // DMA描述符写满时阻塞到腾出这一块的空间
+    int64_t wake_us = s_sink.dma_end_us + duration_us - dma_us;
+    s_sink.dma_end_us += duration_us;
+    s_sink.stats.writes++;
+    s_sink.stats.samples += count;
+    for (size_t i = 0; i < count; i++) {
+        s_sink.stats.nonzero_samples += samples[i] != 0;
+    }
+    lock.unlock();
+
+    host_sleep_until_us(wake_us);
+    return ESP_OK;
+}
+
+extern "C" esp_err_t bsp_audio_sink_drain(uint32_t timeout_ms) {
+    std::unique_lock<std::mutex> lock(s_sink.mutex);
+    int64_t end_us = s_sink.dma_end_us;
+    bool active = s_sink.active;
+    lock.unlock();
+    if (active && timeout_ms > 0) {
+        host_sleep_until_us(std::min(end_us, host_now_us() + (int64_t)timeout_ms * 1000));
+    }
+    lock.lock();
+    s_sink.active = false;
+    return ESP_OK;
+}
+
+extern "C" esp_err_t bsp_audio_sink_abort(uint32_t fade_ms) {
+    (void)fade_ms;
+    std::lock_guard<std::mutex> lock(s_sink.mutex);
+    s_sink.active = false;
+    return ESP_OK;
+}
+
+extern "C" esp_err_t bsp_audio_sink_reset(void) {
+    std::lock_guard<std::mutex> lock(s_sink.mutex);
+    s_sink.active = false;
+    return ESP_OK;
+}
+
+extern "C" uint32_t bsp_audio_sink_latency_us(void) {
+    std::lock_guard<std::mutex> lock(s_sink.mutex);
+    return (uint32_t)((int64_t)I2S_TX_DMA_DESC_NUM * I2S_TX_DMA_FRAME_NUM * 1000000 / s_sink.sample_rate);
+}
+
+extern "C" esp_err_t bsp_audio_set_format(uint32_t sample_rate, int bits_per_chan, int channel_format) {
+    if (sample_rate == 0 || bits_per_chan != 16 || channel_format != 1) {
+        return ESP_ERR_INVALID_ARG;     // 模拟的I2S只接受16位单声道
+    }
+    std::lock_guard<std::mutex> lock(s_sink.mutex);
+    if (s_sink.sample_rate != (int64_t)sample_rate) {
+        // 和设备上一样，切换时DMA里没播完的数据被丢弃
+        s_sink.sample_rate = sample_rate;
+        s_sink.active = false;
+    }
+    return ESP_OK;
+}
+
+extern "C" uint32_t bsp_get_play_sample_rate(void) {
+    std::lock_guard<std::mutex> lock(s_sink.mutex);
+    return (uint32_t)s_sink.sample_rate;
+}
+
+// ---------------------------------------------------------------- 拷贝计数
+
+static thread_local HostCopyStats t_copy_stats;
+
+HostCopyStats host_copy_stats() {
+    return t_copy_stats;
+}
+
+extern "C" void* __real_memcpy(void* dst, const void* src, size_t n);
+extern "C" void* __real_memmove(void* dst, const void* src, size_t n);
+
+extern "C" void* __wrap_memcpy(void* dst, const void* src, size_t n) {
+    t_copy_stats.calls++;
+    t_copy_stats.bytes += n;
+    return __real_memcpy(dst, src, n);
+}
+
+extern "C" void* __wrap_memmove(void* dst, const void* src, size_t n) {
+    t_copy_stats.calls++;
+    t_copy_stats.bytes += n;
+    return __real_memmove(dst, src, n);
+}
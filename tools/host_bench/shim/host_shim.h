@@ -0,0 +1,46 @@
+/**
+ * @file host_shim.h
+ * @brief 🖥️ 垫片的控制接口 - 虚拟时钟、模拟I2S播放和拷贝计数，只给基准测试程序用
+ *
+ * 虚拟时钟：esp_timer_get_time、vTaskDelay和各种超时都按host_set_speed()的倍速换算成真实时间，
+ * 倍速回放时音频链路看到的时序和设备上一致，只是跑得更快。
+ *
+ * 模拟I2S：bsp_audio_sink_write()按16kHz单声道（bsp_audio_set_format()可改采样率）消耗样本，DMA描述符（I2S_TX_DMA_DESC_NUM ×
+ * I2S_TX_DMA_FRAME_NUM）写满时阻塞，和真实驱动一样用写入节奏卡住播放任务。
+ * 两次写入之间DMA被放空就记一次断音（设备上会重复旧数据或输出静音，听得见）；
+ * bsp_audio_sink_abort/bsp_audio_sink_drain之后的空闲不算，drain按虚拟时间等DMA里的数据播完。
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct HostSinkStats {
+    uint32_t writes;
+    uint64_t samples;
+    uint32_t gaps;              // DMA放空的次数
+    uint64_t gap_us;            // 放空的总时长（虚拟时间）
+    uint64_t nonzero_samples;   // 非零样本，用来确认确实播出了数据
+};
+
+// 每次写入I2S时回调（在播放任务中执行，阻塞之前）
+using HostSinkHook = void (*)(const int16_t* samples, size_t count, void* ctx);
+
+void host_set_speed(double speed);
+int64_t host_now_us();                   // 虚拟时间
+void host_sleep_until_us(int64_t t_us);  // 按虚拟时间睡眠
+
+void host_sink_set_hook(HostSinkHook hook, void* ctx);
+HostSinkStats host_sink_stats();
+bool host_sink_active();                 // 播放任务正在输出（stop/release之后为false）
+
+// memcpy/memmove计数（链接时用--wrap包住，按线程统计）
+struct HostCopyStats {
+    uint64_t calls;
+    uint64_t bytes;
+};
+HostCopyStats host_copy_stats();         // 当前线程的累计值
+
+// 当前线程消耗的CPU时间（微秒，不含阻塞等待）
+int64_t host_thread_cpu_us();
@@ -0,0 +1,9 @@
+/**
+ * @file sdkconfig.h
+ * @brief 🖥️ 主机构建的配置（不生成任务CPU占用，其他按固件默认值）
+ */
+
+#pragma once
+
+#define CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS 0
+#define CONFIG_SPIRAM 1
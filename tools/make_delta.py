@@ -0,0 +1,251 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+固件差分补丁生成工具
+用新固件镜像和每个线上旧版本的镜像生成差分补丁，连同完整镜像和manifest.json一起放进输出目录，
+server.py按RELAY_OTA_DIR读取manifest，按设备hello里的固件哈希下发对应的补丁（没有就发完整镜像）
+
+使用方法:
+    python make_delta.py --new build/speech_commands_recognition.bin --old releases/1.0.0.bin --out ota/
+    python make_delta.py --new build/speech_commands_recognition.bin --old releases/*.bin --out ota/
+    python make_delta.py info ota/<补丁>.delta         # 查看补丁头
+
+功能:
+    - 补丁格式见main/delta_patch.h：bsdiff式的记录流（diff按字节相减 + 原样插入的extra + seek），整体zlib压缩
+    - 匹配：旧镜像每4字节建一个16字节块的索引，新镜像每个位置查表，优先沿用上一段的偏移
+      （代码整体移动时大部分地址只差一个常数），找到后向前精确扩展、向后按bsdiff的得分规则近似扩展
+    - 生成后在本机按设备的算法应用一遍，结果和新镜像逐字节一致才写出
+    - 镜像哈希和设备上esp_partition_get_sha256()一致：镜像末尾附带了SHA-256时就是这32字节
+
+依赖:
+    - python3（只用标准库）
+"""
+
+import argparse
+import hashlib
+import json
+import os
+import struct
+import sys
+import zlib
+
+PATCH_MAGIC = b"EDP1"
+PATCH_HEADER = struct.Struct("<4sIII32s32s")     # 和main/delta_patch.h的HEADER_SIZE一致（80字节）
+RECORD = struct.Struct("<IIi")
+IMAGE_MAGIC = 0xE9
+APP_DESC_VERSION = slice(48, 80)    # 镜像头24字节 + 段头8字节 + esp_app_desc_t里version之前的16字节
+
+BLOCK = 16          # 索引块长度
+STRIDE = 4          # 旧镜像每隔几个字节建一个索引
+MIN_MATCH = 24      # 精确匹配至少这么长才开始一段diff
+GIVE_UP = 64        # 近似扩展时得分比最好时低这么多就停止
+
+
+def image_sha256(image: bytes) -> bytes:
+    """
+    和设备上esp_partition_get_sha256()相同的镜像哈希
+    """
+    if len(image) < 24 or image[0] != IMAGE_MAGIC:
+        raise ValueError("不是ESP应用镜像（第一个字节不是0xE9）")
+    if image[23] == 1:      # hash_appended：esptool在镜像末尾附带了除这32字节外全部内容的SHA-256
+        digest = image[-32:]
+        if hashlib.sha256(image[:-32]).digest() != digest:
+            raise ValueError("镜像末尾的SHA-256和内容不符")
+        return digest
+    return hashlib.sha256(image).digest()
+
+
+def image_version(image: bytes) -> str:
+    return image[APP_DESC_VERSION].split(b"\0", 1)[0].decode("utf-8", "replace")
+
+
+def build_index(old: bytes) -> dict:
+    index = {}
+    for pos in range(0, len(old) - BLOCK + 1, STRIDE):
+        index.setdefault(old[pos:pos + BLOCK], pos)
+    return index
+
+
+def exact_length(old: bytes, new: bytes, opos: int, npos: int, limit: int) -> int:
+    n = 0
+    end = min(limit, len(old) - opos, len(new) - npos)
+    while n < end and old[opos + n] == new[npos + n]:
+        n += 1
+    return n
+
+
+def extend_forward(old: bytes, new: bytes, opos: int, npos: int) -> int:
+    """
+    bsdiff的lenf：相同字节记+1、不同记-1，取累计得分最高的长度；得分掉下去GIVE_UP就不再往后看
+    """
+    score = best = length = i = 0
+    end = min(len(old) - opos, len(new) - npos)
+    while i < end:
+        score += 1 if old[opos + i] == new[npos + i] else -1
+        i += 1
+        if score > best:
+            best, length = score, i
+        elif score < best - GIVE_UP:
+            break
+    return length
+
+
+def find_segments(old: bytes, new: bytes) -> list:
+    """
+    按新镜像顺序找出(npos, length, opos)：这些段用diff编码，段之间的字节作为extra原样插入
+    """
+    index = build_index(old)
+    segments = []
+    delta = 0           # 上一段 opos - npos
+    npos = 0
+    covered = 0         # 已经被前面的段覆盖到的位置
+    while npos <= len(new) - BLOCK:
+        candidates = [npos + delta]
+        hit = index.get(new[npos:npos + BLOCK])
+        if hit is not None:
+            candidates.append(hit)
+        best_opos, best_len = -1, 0
+        for opos in candidates:
+            if 0 <= opos <= len(old) - BLOCK:
+                n = exact_length(old, new, opos, npos, 4096)
+                if n > best_len:
+                    best_opos, best_len = opos, n
+        if best_len < MIN_MATCH:
+            npos += 1
+            continue
+        # 索引按STRIDE对齐，匹配可能从更前面就开始了
+        opos = best_opos
+        while npos > covered and opos > 0 and old[opos - 1] == new[npos - 1]:
+            npos -= 1
+            opos -= 1
+        length = max(extend_forward(old, new, opos, npos), best_len)
+        segments.append((npos, length, opos))
+        delta = opos - npos
+        npos += length
+        covered = npos
+    return segments
+
+
+def make_patch(old: bytes, new: bytes) -> bytes:
+    segments = find_segments(old, new)
+    body = bytearray()
+    old_pos = 0
+    new_pos = 0
+    # 第一段之前的字节：diff为空的记录，只有extra
+    first = segments[0] if segments else (len(new), 0, 0)
+    body += RECORD.pack(0, first[0], first[2])
+    body += new[:first[0]]
+    new_pos = first[0]
+    old_pos = first[2]
+    for i, (npos, length, opos) in enumerate(segments):
+        assert npos == new_pos and opos == old_pos
+        nxt = segments[i + 1] if i + 1 < len(segments) else (len(new), 0, opos + length)
+        extra = new[npos + length:nxt[0]]
+        body += RECORD.pack(length, len(extra), nxt[2] - (opos + length))
+        body += bytes((new[npos + k] - old[opos + k]) & 0xFF for k in range(length))
+        body += extra
+        new_pos = nxt[0]
+        old_pos = nxt[2]
+    header = PATCH_HEADER.pack(PATCH_MAGIC, len(old), len(new), 0, image_sha256(old), image_sha256(new))
+    return header + zlib.compress(bytes(body), 9)
+
+
+def apply_patch(old: bytes, patch: bytes) -> bytes:
+    """
+    和main/delta_patch.cc相同的应用过程，用来自检
+    """
+    magic, old_size, new_size, _, _, _ = PATCH_HEADER.unpack_from(patch)
+    if magic != PATCH_MAGIC or old_size != len(old):
+        raise ValueError("补丁头不对")
+    body = zlib.decompress(patch[PATCH_HEADER.size:])
+    out = bytearray()
+    pos = old_pos = 0
+    while pos < len(body):
+        diff_len, extra_len, seek = RECORD.unpack_from(body, pos)
+        pos += RECORD.size
+        if old_pos < 0 or old_pos + diff_len > len(old):
+            raise ValueError("补丁引用了旧镜像范围之外的数据")
+        out += bytes((old[old_pos + k] + body[pos + k]) & 0xFF for k in range(diff_len))
+        pos += diff_len
+        out += body[pos:pos + extra_len]
+        pos += extra_len
+        old_pos += diff_len + seek
+    if len(out) != new_size:
+        raise ValueError("补丁输出长度不对")
+    return bytes(out)
+
+
+def build(args):
+    with open(args.new, "rb") as f:
+        new = f.read()
+    new_sha = image_sha256(new)
+    os.makedirs(args.out, exist_ok=True)
+    manifest_path = os.path.join(args.out, "manifest.json")
+    manifest = {}
+    if os.path.exists(manifest_path):
+        with open(manifest_path, encoding="utf-8") as f:
+            manifest = json.load(f)
+    if manifest.get("sha256") != new_sha.hex():
+        manifest = {"patches": {}}      # 换了目标固件，之前的补丁都作废
+
+    image_name = f"{new_sha.hex()[:16]}.bin"
+    with open(os.path.join(args.out, image_name), "wb") as f:
+        f.write(new)
+    manifest.update(version=image_version(new), sha256=new_sha.hex(), image=image_name, size=len(new))
+    print(f"📦 新固件 {manifest['version']} {new_sha.hex()[:16]}，{len(new) / 1024:.0f}KB")
+
+    for old_path in args.old:
+        with open(old_path, "rb") as f:
+            old = f.read()
+        old_sha = image_sha256(old).hex()[:16]
+        if old_sha == new_sha.hex()[:16]:
+            continue
+        patch = make_patch(old, new)
+        if apply_patch(old, patch) != new:
+            raise SystemExit(f"❌ {old_path}: 补丁自检失败")
+        name = f"{old_sha}-{new_sha.hex()[:16]}.delta"
+        with open(os.path.join(args.out, name), "wb") as f:
+            f.write(patch)
+        manifest["patches"][old_sha] = {"file": name, "size": len(patch), "from": image_version(old)}
+        print(f"   {image_version(old)} {old_sha}: 补丁 {len(patch) / 1024:.0f}KB（完整镜像的 {len(patch) * 100 / len(new):.1f}%）")
+
+    with open(manifest_path, "w", encoding="utf-8") as f:
+        json.dump(manifest, f, ensure_ascii=False, indent=2)
+    print(f"✅ 已写入 {manifest_path}")
+
+
+def info(args):
+    with open(args.patch, "rb") as f:
+        patch = f.read()
+    magic, old_size, new_size, _, old_sha, new_sha = PATCH_HEADER.unpack_from(patch)
+    if magic != PATCH_MAGIC:
+        raise SystemExit("❌ 不是差分补丁")
+    body = zlib.decompress(patch[PATCH_HEADER.size:])
+    records = diff_bytes = extra_bytes = 0
+    pos = 0
+    while pos < len(body):
+        diff_len, extra_len, _ = RECORD.unpack_from(body, pos)
+        pos += RECORD.size + diff_len + extra_len
+        records += 1
+        diff_bytes += diff_len
+        extra_bytes += extra_len
+    print(f"旧镜像 {old_sha.hex()[:16]} {old_size}字节 -> 新镜像 {new_sha.hex()[:16]} {new_size}字节")
+    print(f"补丁 {len(patch)}字节，{records}条记录，diff {diff_bytes}字节，extra {extra_bytes}字节")
+
+
+def main():
+    if len(sys.argv) > 1 and sys.argv[1] == "info":
+        parser = argparse.ArgumentParser(description="查看差分补丁")
+        parser.add_argument("command")
+        parser.add_argument("patch")
+        info(parser.parse_args())
+        return
+    parser = argparse.ArgumentParser(description="生成固件差分补丁和manifest.json")
+    parser.add_argument("--new", required=True, help="新固件镜像（build/<项目名>.bin）")
+    parser.add_argument("--old", nargs="*", default=[], help="线上各旧版本的镜像")
+    parser.add_argument("--out", required=True, help="输出目录（server.py的RELAY_OTA_DIR）")
+    build(parser.parse_args())
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,285 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+会话录制回放工具
+读取server.py录制的.vcap文件（RELAY_CAPTURE_DIR），统计延迟和抖动，或者按原始时间把上行消息重新发给server.py
+
+使用方法:
+    python replay_capture.py info session.vcap
+    python replay_capture.py replay session.vcap --uri ws://127.0.0.1:8888
+    python replay_capture.py replay session.vcap --speed 2     # 两倍速回放
+
+功能:
+    - info：每轮 speech_end → 第一段下行音频 / tts_end 的耗时，下行消息的发送间隔；
+      有设备端时间戳时另外给出每条下行音频从服务器发出到设备收到的排队时延（相对最小值）
+    - replay：扮演ESP32连接server.py，按录制时的时间发送hello、上行音频和speech_end/interrupt等控制消息，
+      下行额度按"抖动缓冲区一直有空"回复（录制里的credit/ping/stats不重发），
+      结束后把回放得到的每轮延迟和录制时的放在一起对比
+    - 下行播放的回放在主机上跑固件代码：tools/host_bench/bench_playback --capture session.vcap
+
+文件格式见server/server.py的SessionRecorder，记录类型和main/session_capture.h一致。
+
+依赖:
+    - python3
+    - websockets（仅replay需要，见server/requirements.txt）
+"""
+
+import argparse
+import asyncio
+import json
+import statistics
+import struct
+import sys
+import time
+from collections import namedtuple
+
+# 和server/server.py的CAPTURE_*/CAP_*/CTRL_*保持一致
+CAPTURE_MAGIC = b"VCAP"
+CAPTURE_FILE_HEADER = struct.Struct("<4sBBHQ")
+CAPTURE_RECORD = struct.Struct("<QBBHI")
+CAP_UPLINK_AUDIO = 1
+CAP_DOWNLINK_AUDIO = 2
+CAP_UPLINK_CONTROL = 3
+CAP_DOWNLINK_CONTROL = 4
+CAP_SESSION = 5
+CAP_FLAG_BINARY = 0x01
+CAP_FLAG_DEVICE = 0x02
+KIND_NAMES = {
+    CAP_UPLINK_AUDIO: "uplink_audio", CAP_DOWNLINK_AUDIO: "downlink_audio",
+    CAP_UPLINK_CONTROL: "uplink_control", CAP_DOWNLINK_CONTROL: "downlink_control", CAP_SESSION: "session",
+}
+
+CTRL_MAGIC = 0xC7
+CTRL_HEADER = struct.Struct("<BBHIHH")
+CTRL_TYPE_NAMES = {1: "ready", 2: "tts_end", 3: "credit", 4: "ping", 5: "pong", 6: "interrupt",
+                   7: "interrupt_ack", 8: "stats", 9: "capture"}
+CTRL_CREDIT = 3
+CTRL_CREDIT_PAYLOAD = struct.Struct("<II")
+
+# 回放时原样重发的上行控制消息；credit由回放工具自己回复，其余是设备上报，和服务器行为无关
+REPLAY_CONTROL_TYPES = {"hello", "speech_end", "interrupt", "repeat", "local_command"}
+REPLAY_CREDIT_FREE_BYTES = 60000    # 按抖动缓冲区一直有空回复额度（固件的缓冲区是64KB）
+REPLAY_TAIL_TIMEOUT_S = 15          # 最后一条上行之后最多等这么久的tts_end
+
+Record = namedtuple("Record", "t_us kind flags data")
+
+
+def read_capture(path):
+    """读取录制文件，返回(录制开始的unix时间, 服务器端记录, 设备端记录)"""
+    with open(path, "rb") as f:
+        blob = f.read()
+    if len(blob) < CAPTURE_FILE_HEADER.size or blob[:4] != CAPTURE_MAGIC:
+        raise ValueError(f"不是录制文件: {path}")
+    _, _, _, _, start_us = CAPTURE_FILE_HEADER.unpack_from(blob)
+    relay, device = [], []
+    pos = CAPTURE_FILE_HEADER.size
+    while pos + CAPTURE_RECORD.size <= len(blob):
+        t_us, kind, flags, _, length = CAPTURE_RECORD.unpack_from(blob, pos)
+        pos += CAPTURE_RECORD.size
+        data = blob[pos:pos + length]
+        pos += length
+        if len(data) < length:
+            break   # 录制时进程被杀，最后一条不完整
+        (device if flags & CAP_FLAG_DEVICE else relay).append(Record(t_us, kind, flags, data))
+    return start_us / 1e6, relay, device
+
+
+def control_type(data, binary):
+    """控制消息的类型名（JSON文本的type字段，或二进制控制帧的类型）"""
+    if binary or isinstance(data, bytes) and data[:1] == bytes([CTRL_MAGIC]):
+        if len(data) >= CTRL_HEADER.size and data[0] == CTRL_MAGIC:
+            return CTRL_TYPE_NAMES.get(data[1], "unknown")
+        return None
+    try:
+        return json.loads(data).get("type")
+    except (ValueError, AttributeError):
+        return None
+
+
+def is_control_frame(data):
+    if len(data) < CTRL_HEADER.size or data[0] != CTRL_MAGIC:
+        return False
+    _, msg_type, _, _, length, _ = CTRL_HEADER.unpack_from(data)
+    return msg_type in CTRL_TYPE_NAMES and CTRL_HEADER.size + length == len(data)
+
+
+def turn_latencies(events):
+    """
+    events: 按时间排序的(t秒, 名称)，名称是"speech_end" / "audio" / "tts_end"
+    返回每轮(speech_end→第一段下行音频, speech_end→tts_end)，毫秒
+    """
+    turns = []
+    speech_end = None
+    first_audio = None
+    for t, name in events:
+        if name == "speech_end":
+            speech_end, first_audio = t, None
+        elif name == "audio" and speech_end is not None and first_audio is None:
+            first_audio = t
+        elif name == "tts_end" and speech_end is not None:
+            turns.append(((first_audio - speech_end) * 1000 if first_audio is not None else None,
+                          (t - speech_end) * 1000))
+            speech_end = None
+    return turns
+
+
+def percentile(values, p):
+    if not values:
+        return 0.0
+    values = sorted(values)
+    return values[min(len(values) - 1, int(len(values) * p / 100))]
+
+
+def gap_stats(times):
+    """同一段回复内相邻下行消息的间隔（毫秒）：p50/p95/max"""
+    gaps = [(b - a) * 1000 for a, b in zip(times, times[1:]) if b - a < 1.0]    # 超过1秒算两段回复之间
+    return percentile(gaps, 50), percentile(gaps, 95), max(gaps, default=0.0)
+
+
+def relay_events(relay):
+    events = []
+    for r in relay:
+        if r.kind == CAP_DOWNLINK_AUDIO:
+            events.append((r.t_us / 1e6, "audio"))
+        elif r.kind in (CAP_UPLINK_CONTROL, CAP_DOWNLINK_CONTROL):
+            name = control_type(r.data, r.flags & CAP_FLAG_BINARY)
+            if name in ("speech_end", "tts_end"):
+                events.append((r.t_us / 1e6, name))
+    return events
+
+
+def print_turns(label, turns):
+    for i, (first, end) in enumerate(turns, 1):
+        first_text = f"{first:.0f} ms" if first is not None else "-"
+        print(f"  {label} 第{i}轮: speech_end → 第一段下行 {first_text}, → tts_end {end:.0f} ms")
+
+
+def cmd_info(args):
+    start, relay, device = read_capture(args.file)
+    duration = (relay[-1].t_us / 1e6) if relay else 0.0
+    print(f"🎙️ {args.file}: 开始于 {time.strftime('%Y-%m-%d %H:%M:%S', time.localtime(start))}, 时长 {duration:.1f} s")
+    for kind, name in KIND_NAMES.items():
+        rs = [r for r in relay if r.kind == kind]
+        ds = [r for r in device if r.kind == kind]
+        if rs or ds:
+            print(f"  {name:17s} 服务器端 {len(rs):5d} 条 {sum(len(r.data) for r in rs):9d} 字节, 设备端 {len(ds):5d} 条")
+
+    print_turns("录制", turn_latencies(relay_events(relay)))
+    down = [r for r in relay if r.kind == CAP_DOWNLINK_AUDIO]
+    p50, p95, worst = gap_stats([r.t_us / 1e6 for r in down])
+    print(f"  下行发送间隔: p50 {p50:.1f} ms, p95 {p95:.1f} ms, max {worst:.1f} ms")
+
+    # 设备端第n条下行音频 ↔ 服务器发出的第n条：时钟不同步，只看相对最小值的额外时延
+    device_down = [r for r in device if r.kind == CAP_DOWNLINK_AUDIO]
+    if device_down:
+        n = min(len(down), len(device_down))
+        delays = [(d.t_us - r.t_us) / 1000 for r, d in zip(down[:n], device_down[:n])]
+        base = min(delays)
+        queued = [d - base for d in delays]
+        p50, p95, worst = gap_stats([d.t_us / 1e6 for d in device_down])
+        print(f"  设备端到达间隔: p50 {p50:.1f} ms, p95 {p95:.1f} ms, max {worst:.1f} ms")
+        print(f"  下行排队时延（相对最小值）: p50 {percentile(queued, 50):.1f} ms, "
+              f"p95 {percentile(queued, 95):.1f} ms, max {max(queued):.1f} ms（{n}条）")
+        if len(down) != len(device_down):
+            print(f"  ⚠️ 下行音频条数不一致：服务器端{len(down)}条，设备端{len(device_down)}条，只对比前{n}条")
+    return 0
+
+
+async def replay(args):
+    import websockets
+
+    _, relay, _ = read_capture(args.file)
+    uplink = []
+    for r in relay:
+        if r.kind == CAP_UPLINK_AUDIO:
+            uplink.append(r)
+        elif r.kind == CAP_UPLINK_CONTROL and control_type(r.data, r.flags & CAP_FLAG_BINARY) in REPLAY_CONTROL_TYPES:
+            uplink.append(r)
+    if not uplink:
+        print("❌ 录制文件里没有上行消息", file=sys.stderr)
+        return 2
+
+    loop = asyncio.get_running_loop()
+    events = []             # 回放得到的(t秒, 名称)，按录制的时间轴
+    state = {"binary": False, "received": 0, "last_tts_end": 0.0}
+
+    async with websockets.connect(args.uri, max_size=None) as ws:
+        t0 = loop.time()
+
+        def now():
+            return (loop.time() - t0) * args.speed
+
+        async def send_credit():
+            if state["binary"]:
+                payload = CTRL_CREDIT_PAYLOAD.pack(state["received"] & 0xFFFFFFFF, REPLAY_CREDIT_FREE_BYTES)
+                await ws.send(CTRL_HEADER.pack(CTRL_MAGIC, CTRL_CREDIT, 0, 0, len(payload), 0) + payload)
+            else:
+                await ws.send(json.dumps({"type": "credit", "recv": state["received"],
+                                          "free": REPLAY_CREDIT_FREE_BYTES}, separators=(",", ":")))
+
+        async def receive():
+            async for message in ws:
+                t = now()
+                if isinstance(message, str):
+                    name = control_type(message, False)
+                    if name == "hello":
+                        state["binary"] = '"control":"binary"' in message
+                        await send_credit()
+                elif is_control_frame(message):
+                    name = CTRL_TYPE_NAMES.get(message[1])
+                else:
+                    name = "audio"
+                    state["received"] += len(message)
+                    await send_credit()
+                if name in ("audio", "tts_end"):
+                    events.append((t, name))
+                if name == "tts_end":
+                    state["last_tts_end"] = t
+
+        receiver = asyncio.create_task(receive())
+        for r in uplink:
+            delay = r.t_us / 1e6 / args.speed - (loop.time() - t0)
+            if delay > 0:
+                await asyncio.sleep(delay)
+            data = r.data
+            if r.kind == CAP_UPLINK_CONTROL and not r.flags & CAP_FLAG_BINARY:
+                data = data.decode("utf-8")
+                if control_type(data, False) == "speech_end":
+                    events.append((now(), "speech_end"))
+            await ws.send(data)
+
+        # 等最后一轮回复结束
+        deadline = loop.time() + REPLAY_TAIL_TIMEOUT_S
+        last_speech_end = max((t for t, name in events if name == "speech_end"), default=0.0)
+        while loop.time() < deadline and state["last_tts_end"] < last_speech_end:
+            await asyncio.sleep(0.1)
+        receiver.cancel()
+
+    events.sort()
+    recorded = turn_latencies(relay_events(relay))
+    replayed = turn_latencies(events)
+    print_turns("录制", recorded)
+    print_turns("回放", replayed)
+    p50, p95, worst = gap_stats([t for t, name in events if name == "audio"])
+    print(f"  回放下行到达间隔: p50 {p50:.1f} ms, p95 {p95:.1f} ms, max {worst:.1f} ms")
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="会话录制（.vcap）统计和回放")
+    sub = parser.add_subparsers(dest="command", required=True)
+    info = sub.add_parser("info", help="统计录制文件里的延迟和抖动")
+    info.add_argument("file")
+    rp = sub.add_parser("replay", help="按录制时的时间把上行消息重新发给server.py")
+    rp.add_argument("file")
+    rp.add_argument("--uri", default="ws://127.0.0.1:8888")
+    rp.add_argument("--speed", type=float, default=1.0, help="回放倍速（默认按原始时间）")
+    args = parser.parse_args()
+
+    if args.command == "info":
+        return cmd_info(args)
+    return asyncio.run(replay(args))
+
+
+if __name__ == "__main__":
+    sys.exit(main())